@@ -26,7 +26,7 @@ int main() {
 
             phase += 0.1f;
 
-            Superluminal::Update();
+            Superluminal::Update("Sine");
             std::this_thread::sleep_for(std::chrono::milliseconds(10));
         }
     });
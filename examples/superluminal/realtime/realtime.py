@@ -18,7 +18,7 @@ def callback():
         phase += 0.1
 
         # Update the plot.
-        lm.update()
+        lm.update("Sine")
 
         # Sleep for 10 ms.
         time.sleep(0.01)
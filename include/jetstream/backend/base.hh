@@ -8,6 +8,7 @@
 #include "jetstream/types.hh"
 #include "jetstream/macros.hh"
 #include "jetstream/logger.hh"
+#include "jetstream/startup.hh"
 #include "jetstream/backend/config.hh"
 
 // TODO: Refactor this entire thing. It's a mess.
@@ -86,14 +87,40 @@ class JETSTREAM_API Instance {
         using BackendType = typename GetBackend<DeviceId>::Type;
         std::lock_guard lock(mutex);
         if (!backends.contains(DeviceId)) {
+            JST_STARTUP_PHASE("Backend Initialization");
             JST_DEBUG("Initializing {} backend.", DeviceId);
             backends[DeviceId] = std::make_unique<BackendType>(config);
         }
         return Result::SUCCESS;
     }
 
+    // Counts a user of the backend, initializing it if needed. Users
+    // sharing a backend share its device, queues, and caches.
+    template<Device DeviceId>
+    Result acquire(const Config& config) {
+        JST_CHECK(initialize<DeviceId>(config));
+        std::lock_guard lock(mutex);
+        users[DeviceId] += 1;
+        return Result::SUCCESS;
+    }
+
+    // Destroys the backend once its last user releases it.
+    Result release(const Device& id) {
+        std::lock_guard lock(mutex);
+        if (!users.contains(id)) {
+            return Result::SUCCESS;
+        }
+        if (--users[id] == 0) {
+            JST_DEBUG("Releasing {} backend.", id);
+            users.erase(id);
+            backends.erase(id);
+        }
+        return Result::SUCCESS;
+    }
+
     Result destroy(const Device& id) {
         std::lock_guard lock(mutex);
+        users.erase(id);
         if (backends.contains(id)) {
             JST_DEBUG("Destroying {} backend.", id);
             backends.erase(id);
@@ -119,6 +146,8 @@ class JETSTREAM_API Instance {
     }
 
     Result destroyAll() {
+        std::lock_guard lock(mutex);
+        users.clear();
         backends.clear();
         return Result::SUCCESS;
     }
@@ -143,6 +172,7 @@ class JETSTREAM_API Instance {
     > BackendHolder;
 
     std::unordered_map<Device, BackendHolder> backends;
+    std::unordered_map<Device, U64> users;
     std::mutex mutex;
 };
 
@@ -158,6 +188,15 @@ Result Initialize(const Config& config) {
     return Get().initialize<D>(config);
 }
 
+template<Device D>
+Result Acquire(const Config& config) {
+    return Get().acquire<D>(config);
+}
+
+inline Result Release(const Device& id) {
+    return Get().release(id);
+}
+
 template<Device D>
 Result Destroy() {
     return Get().destroy(D);
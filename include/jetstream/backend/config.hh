@@ -42,6 +42,8 @@ struct Config {
     bool validationEnabled = false;
 #endif
     U64 stagingBufferSize = 64*1024*1024;
+    U64 memoryPoolSize = 256*1024*1024;
+    bool mirroredMemory = false;
     U64 multisampling = 4;
     bool remote = false;
 };
@@ -0,0 +1,75 @@
+#ifndef JETSTREAM_BACKEND_DEVICE_CPU_DISPATCH_HH
+#define JETSTREAM_BACKEND_DEVICE_CPU_DISPATCH_HH
+
+#include <initializer_list>
+#include <utility>
+
+#include "jetstream/types.hh"
+#include "jetstream/macros.hh"
+
+namespace Jetstream::Backend {
+
+// Instruction set extensions a CPU kernel variant can be written for.
+enum class SimdLevel : U8 {
+    Scalar = 0,
+    SSE4   = 1,
+    AVX2   = 2,
+    AVX512 = 3,
+    NEON   = 4,
+    WASM   = 5,
+};
+
+JETSTREAM_API const char* GetSimdLevelName(const SimdLevel& level);
+
+// Whether the host is able to run the level regardless of the override.
+JETSTREAM_API bool HostSupportsSimdLevel(const SimdLevel& level);
+
+// Widest level CPU kernels are allowed to use. Defaults to the widest level
+// supported by the host and can be lowered with the JST_CPU_SIMD environment
+// variable (scalar, sse4, avx2, avx512, neon, wasm) to compare variants.
+JETSTREAM_API SimdLevel MaxSimdLevel();
+
+// Whether kernels written for the level can be used.
+JETSTREAM_API bool SimdLevelAllowed(const SimdLevel& level);
+
+// Picks the widest allowed variant of a kernel. The first variant is the
+// fallback and should be the scalar one.
+template<typename Kernel>
+class KernelDispatch {
+ public:
+    typedef std::pair<SimdLevel, Kernel> Variant;
+
+    KernelDispatch(std::initializer_list<Variant> variants) {
+        for (const auto& [variantLevel, variantKernel] : variants) {
+            if (_kernel && (!SimdLevelAllowed(variantLevel) || Rank(variantLevel) < Rank(_level))) {
+                continue;
+            }
+            _level = variantLevel;
+            _kernel = variantKernel;
+        }
+    }
+
+    constexpr const Kernel& kernel() const {
+        return _kernel;
+    }
+
+    constexpr const SimdLevel& level() const {
+        return _level;
+    }
+
+    const char* name() const {
+        return GetSimdLevelName(_level);
+    }
+
+ private:
+    SimdLevel _level = SimdLevel::Scalar;
+    Kernel _kernel = nullptr;
+
+    static constexpr U8 Rank(const SimdLevel& level) {
+        return (level == SimdLevel::NEON || level == SimdLevel::WASM) ? 1 : static_cast<U8>(level);
+    }
+};
+
+}  // namespace Jetstream::Backend
+
+#endif
@@ -0,0 +1,139 @@
+#ifndef JETSTREAM_BACKEND_DEVICE_CPU_FIR_HH
+#define JETSTREAM_BACKEND_DEVICE_CPU_FIR_HH
+
+#include <vector>
+#include <algorithm>
+
+#include "jetstream/types.hh"
+#include "jetstream/logger.hh"
+#include "jetstream/backend/devices/cpu/simd.hh"
+
+namespace Jetstream::Backend {
+
+//
+// Streaming FIR filter with real taps.
+//
+// Resamples by interpolation / decimation with a polyphase bank, so only the
+// kept outputs are computed and the zeros of the upsampled signal are never
+// multiplied. Every phase stores its taps reversed and contiguous, and the
+// samples of each output are read as a contiguous window: straight from the
+// input, or from a doubled history buffer holding the tail of the previous
+// block followed by the head of the current one. There's no per-tap
+// indexing, and every output is a single dot product kernel call.
+//
+// Blocks must hold a multiple of decimation / gcd(interpolation, decimation)
+// samples, so every block starts at the same phase.
+//
+
+template<typename T>
+class PolyphaseFir {
+ public:
+    static_assert(std::is_same_v<T, F32> || std::is_same_v<T, CF32>,
+                  "PolyphaseFir supports F32 and CF32 samples.");
+
+    // Rebuilds the bank. The history is kept unless the number of taps per
+    // phase changed.
+    Result configure(const F32* taps, const U64& size, const U64& interpolation, const U64& decimation) {
+        if (size == 0 || interpolation == 0 || decimation == 0) {
+            JST_ERROR("[FIR] Invalid configuration ({} taps, {}/{} resampling).", size, interpolation, decimation);
+            return Result::ERROR;
+        }
+
+        _interpolation = interpolation;
+        _decimation = decimation;
+
+        const U64 phaseTaps = (size + interpolation - 1) / interpolation;
+        if (phaseTaps != _phaseTaps) {
+            _phaseTaps = phaseTaps;
+            _history.assign(_phaseTaps - 1, T{});
+        }
+
+        // Complex samples read every tap twice.
+        const U64 width = std::is_same_v<T, CF32> ? 2 : 1;
+        _bank.assign(_interpolation * _phaseTaps * width, 0.0f);
+
+        for (U64 p = 0; p < _interpolation; p++) {
+            F32* phase = _bank.data() + p * _phaseTaps * width;
+            for (U64 j = 0; j < _phaseTaps; j++) {
+                const U64 k = p + (_phaseTaps - 1 - j) * _interpolation;
+                const F32 tap = (k < size) ? taps[k] : 0.0f;
+                for (U64 w = 0; w < width; w++) {
+                    phase[j * width + w] = tap;
+                }
+            }
+        }
+
+        return Result::SUCCESS;
+    }
+
+    void reset() {
+        std::fill(_history.begin(), _history.end(), T{});
+    }
+
+    bool validInputSize(const U64& size) const {
+        return ((size * _interpolation) % _decimation) == 0;
+    }
+
+    U64 outputSize(const U64& inputSize) const {
+        return (inputSize * _interpolation) / _decimation;
+    }
+
+    const U64& phaseTaps() const {
+        return _phaseTaps;
+    }
+
+    const char* kernelName() const {
+        if constexpr (std::is_same_v<T, CF32>) {
+            return ComplexFirDot().name();
+        } else {
+            return RealFirDot().name();
+        }
+    }
+
+    // Filters one block. The input size must be valid and the output must
+    // hold outputSize() samples.
+    void process(const T* input, const U64& inputSize, T* output) {
+        const U64 tail = _phaseTaps - 1;
+        const U64 head = std::min(inputSize, tail);
+        const U64 width = std::is_same_v<T, CF32> ? 2 : 1;
+
+        // Windows starting in the history read from [history | input head].
+        _window.resize(tail + head);
+        std::copy(_history.begin(), _history.end(), _window.begin());
+        std::copy(input, input + head, _window.begin() + tail);
+
+        const U64 outputs = outputSize(inputSize);
+        for (U64 m = 0; m < outputs; m++) {
+            const U64 u = m * _decimation;
+            const U64 n = u / _interpolation;
+            const F32* taps = _bank.data() + (u % _interpolation) * _phaseTaps * width;
+            const T* samples = (n < tail) ? _window.data() + n : input + (n - tail);
+
+            if constexpr (std::is_same_v<T, CF32>) {
+                output[m] = ComplexFirDot().kernel()(taps, samples, _phaseTaps);
+            } else {
+                output[m] = RealFirDot().kernel()(taps, samples, _phaseTaps);
+            }
+        }
+
+        // Keep the last samples for the next block.
+        if (inputSize >= tail) {
+            std::copy(input + inputSize - tail, input + inputSize, _history.begin());
+        } else {
+            std::copy(_window.begin() + head, _window.end(), _history.begin());
+        }
+    }
+
+ private:
+    U64 _interpolation = 1;
+    U64 _decimation = 1;
+    U64 _phaseTaps = 0;
+
+    std::vector<F32> _bank;
+    std::vector<T> _history;
+    std::vector<T> _window;
+};
+
+}  // namespace Jetstream::Backend
+
+#endif
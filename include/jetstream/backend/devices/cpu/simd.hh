@@ -0,0 +1,3098 @@
+#ifndef JETSTREAM_BACKEND_DEVICE_CPU_SIMD_HH
+#define JETSTREAM_BACKEND_DEVICE_CPU_SIMD_HH
+
+#include <bit>
+#include <cmath>
+#include <utility>
+#include <algorithm>
+
+#include "jetstream/types.hh"
+#include "jetstream/backend/devices/cpu/dispatch.hh"
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define JST_SIMD_X86
+#include <immintrin.h>
+#endif
+
+#if (defined(__ARM_NEON) || defined(__ARM_NEON__)) && defined(__aarch64__)
+#define JST_SIMD_NEON
+#include <arm_neon.h>
+#endif
+
+// Browser builds enable SIMD128 at compile time, there's no runtime detection.
+#if defined(__wasm_simd128__)
+#define JST_SIMD_WASM
+#include <wasm_simd128.h>
+#endif
+
+namespace Jetstream::Backend {
+
+//
+// Power in decibels.
+//
+// Same polynomial as ApproxLog10 with the exponent and mantissa read straight
+// from the bits, so every lane of every variant returns the same value. The
+// power is expected to be positive. Zero maps to roughly -380 dB.
+//
+
+namespace Detail {
+
+inline constexpr F32 Log10Poly3 =  1.23149591368684f;
+inline constexpr F32 Log10Poly2 = -4.11852516267426f;
+inline constexpr F32 Log10Poly1 =  6.02197014179219f;
+inline constexpr F32 Log10Poly0 = -3.13396450166353f;
+inline constexpr F32 DecibelsPerOctave = 10.0f * 0.3010299956639812f;
+
+}  // namespace Detail
+
+inline F32 ApproxPowerToDecibels(const F32& power, const F32& offset) {
+    const U32 bits = std::bit_cast<U32>(power);
+    const F32 E = static_cast<F32>(static_cast<I32>(bits >> 23) - 126);
+    const F32 F = std::bit_cast<F32>((bits & 0x007FFFFF) | 0x3F000000);
+
+    F32 Y = Detail::Log10Poly3;
+    Y = Y * F + Detail::Log10Poly2;
+    Y = Y * F + Detail::Log10Poly1;
+    Y = Y * F + Detail::Log10Poly0;
+    Y += E;
+
+    return Y * Detail::DecibelsPerOctave + offset;
+}
+
+// Kernels computing 10 * log10(|x|^2) + offset over contiguous arrays.
+
+typedef void (*ComplexDecibelsKernel)(const CF32* input, F32* output, const U64& size, const F32& offset);
+typedef void (*RealDecibelsKernel)(const F32* input, F32* output, const U64& size, const F32& offset);
+
+inline void ComplexDecibelsScalar(const CF32* input, F32* output, const U64& size, const F32& offset) {
+    for (U64 i = 0; i < size; i++) {
+        const F32 re = input[i].real();
+        const F32 im = input[i].imag();
+        output[i] = ApproxPowerToDecibels(re * re + im * im, offset);
+    }
+}
+
+inline void RealDecibelsScalar(const F32* input, F32* output, const U64& size, const F32& offset) {
+    for (U64 i = 0; i < size; i++) {
+        output[i] = ApproxPowerToDecibels(input[i] * input[i], offset);
+    }
+}
+
+#ifdef JST_SIMD_X86
+
+__attribute__((target("avx2,fma")))
+inline __m256 PowerToDecibelsAVX2(const __m256& power, const __m256& offset) {
+    const __m256i bits = _mm256_castps_si256(power);
+    const __m256 E = _mm256_cvtepi32_ps(_mm256_sub_epi32(_mm256_srli_epi32(bits, 23), _mm256_set1_epi32(126)));
+    const __m256 F = _mm256_castsi256_ps(_mm256_or_si256(_mm256_and_si256(bits, _mm256_set1_epi32(0x007FFFFF)),
+                                                         _mm256_set1_epi32(0x3F000000)));
+
+    __m256 Y = _mm256_set1_ps(Detail::Log10Poly3);
+    Y = _mm256_fmadd_ps(Y, F, _mm256_set1_ps(Detail::Log10Poly2));
+    Y = _mm256_fmadd_ps(Y, F, _mm256_set1_ps(Detail::Log10Poly1));
+    Y = _mm256_fmadd_ps(Y, F, _mm256_set1_ps(Detail::Log10Poly0));
+    Y = _mm256_add_ps(Y, E);
+
+    return _mm256_fmadd_ps(Y, _mm256_set1_ps(Detail::DecibelsPerOctave), offset);
+}
+
+__attribute__((target("avx2,fma")))
+inline void ComplexDecibelsAVX2(const CF32* input, F32* output, const U64& size, const F32& offset) {
+    const F32* in = reinterpret_cast<const F32*>(input);
+    const __m256 off = _mm256_set1_ps(offset);
+
+    U64 i = 0;
+    for (; i + 8 <= size; i += 8) {
+        const __m256 a = _mm256_loadu_ps(in + 2 * i);
+        const __m256 b = _mm256_loadu_ps(in + 2 * i + 8);
+
+        // Pairwise sums come out as [a0 a1 b0 b1 | a2 a3 b2 b3] in 64-bit lanes.
+        const __m256 sum = _mm256_hadd_ps(_mm256_mul_ps(a, a), _mm256_mul_ps(b, b));
+        const __m256 power = _mm256_castpd_ps(_mm256_permute4x64_pd(_mm256_castps_pd(sum), 0b11011000));
+
+        _mm256_storeu_ps(output + i, PowerToDecibelsAVX2(power, off));
+    }
+
+    ComplexDecibelsScalar(input + i, output + i, size - i, offset);
+}
+
+__attribute__((target("avx2,fma")))
+inline void RealDecibelsAVX2(const F32* input, F32* output, const U64& size, const F32& offset) {
+    const __m256 off = _mm256_set1_ps(offset);
+
+    U64 i = 0;
+    for (; i + 8 <= size; i += 8) {
+        const __m256 x = _mm256_loadu_ps(input + i);
+        _mm256_storeu_ps(output + i, PowerToDecibelsAVX2(_mm256_mul_ps(x, x), off));
+    }
+
+    RealDecibelsScalar(input + i, output + i, size - i, offset);
+}
+
+// GCC reports false uninitialized warnings from its own AVX-512 headers.
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+
+__attribute__((target("avx512f")))
+inline __m512 PowerToDecibelsAVX512(const __m512& power, const __m512& offset) {
+    const __m512i bits = _mm512_castps_si512(power);
+    const __m512 E = _mm512_cvtepi32_ps(_mm512_sub_epi32(_mm512_srli_epi32(bits, 23), _mm512_set1_epi32(126)));
+    const __m512 F = _mm512_castsi512_ps(_mm512_or_si512(_mm512_and_si512(bits, _mm512_set1_epi32(0x007FFFFF)),
+                                                         _mm512_set1_epi32(0x3F000000)));
+
+    __m512 Y = _mm512_set1_ps(Detail::Log10Poly3);
+    Y = _mm512_fmadd_ps(Y, F, _mm512_set1_ps(Detail::Log10Poly2));
+    Y = _mm512_fmadd_ps(Y, F, _mm512_set1_ps(Detail::Log10Poly1));
+    Y = _mm512_fmadd_ps(Y, F, _mm512_set1_ps(Detail::Log10Poly0));
+    Y = _mm512_add_ps(Y, E);
+
+    return _mm512_fmadd_ps(Y, _mm512_set1_ps(Detail::DecibelsPerOctave), offset);
+}
+
+__attribute__((target("avx512f")))
+inline void ComplexDecibelsAVX512(const CF32* input, F32* output, const U64& size, const F32& offset) {
+    const F32* in = reinterpret_cast<const F32*>(input);
+    const __m512 off = _mm512_set1_ps(offset);
+    const __m512i even = _mm512_setr_epi32(0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30);
+    const __m512i odd = _mm512_setr_epi32(1, 3, 5, 7, 9, 11, 13, 15, 17, 19, 21, 23, 25, 27, 29, 31);
+
+    U64 i = 0;
+    for (; i + 16 <= size; i += 16) {
+        const __m512 a = _mm512_loadu_ps(in + 2 * i);
+        const __m512 b = _mm512_loadu_ps(in + 2 * i + 16);
+        const __m512 aa = _mm512_mul_ps(a, a);
+        const __m512 bb = _mm512_mul_ps(b, b);
+
+        const __m512 power = _mm512_add_ps(_mm512_permutex2var_ps(aa, even, bb),
+                                           _mm512_permutex2var_ps(aa, odd, bb));
+
+        _mm512_storeu_ps(output + i, PowerToDecibelsAVX512(power, off));
+    }
+
+    ComplexDecibelsScalar(input + i, output + i, size - i, offset);
+}
+
+__attribute__((target("avx512f")))
+inline void RealDecibelsAVX512(const F32* input, F32* output, const U64& size, const F32& offset) {
+    const __m512 off = _mm512_set1_ps(offset);
+
+    U64 i = 0;
+    for (; i + 16 <= size; i += 16) {
+        const __m512 x = _mm512_loadu_ps(input + i);
+        _mm512_storeu_ps(output + i, PowerToDecibelsAVX512(_mm512_mul_ps(x, x), off));
+    }
+
+    RealDecibelsScalar(input + i, output + i, size - i, offset);
+}
+
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+
+#endif  // JST_SIMD_X86
+
+#ifdef JST_SIMD_NEON
+
+inline float32x4_t PowerToDecibelsNEON(const float32x4_t& power, const float32x4_t& offset) {
+    const uint32x4_t bits = vreinterpretq_u32_f32(power);
+    const float32x4_t E = vcvtq_f32_s32(vsubq_s32(vreinterpretq_s32_u32(vshrq_n_u32(bits, 23)), vdupq_n_s32(126)));
+    const float32x4_t F = vreinterpretq_f32_u32(vorrq_u32(vandq_u32(bits, vdupq_n_u32(0x007FFFFF)),
+                                                          vdupq_n_u32(0x3F000000)));
+
+    float32x4_t Y = vdupq_n_f32(Detail::Log10Poly3);
+    Y = vfmaq_f32(vdupq_n_f32(Detail::Log10Poly2), Y, F);
+    Y = vfmaq_f32(vdupq_n_f32(Detail::Log10Poly1), Y, F);
+    Y = vfmaq_f32(vdupq_n_f32(Detail::Log10Poly0), Y, F);
+    Y = vaddq_f32(Y, E);
+
+    return vfmaq_f32(offset, Y, vdupq_n_f32(Detail::DecibelsPerOctave));
+}
+
+inline void ComplexDecibelsNEON(const CF32* input, F32* output, const U64& size, const F32& offset) {
+    const F32* in = reinterpret_cast<const F32*>(input);
+    const float32x4_t off = vdupq_n_f32(offset);
+
+    U64 i = 0;
+    for (; i + 4 <= size; i += 4) {
+        const float32x4x2_t z = vld2q_f32(in + 2 * i);
+        const float32x4_t power = vfmaq_f32(vmulq_f32(z.val[0], z.val[0]), z.val[1], z.val[1]);
+        vst1q_f32(output + i, PowerToDecibelsNEON(power, off));
+    }
+
+    ComplexDecibelsScalar(input + i, output + i, size - i, offset);
+}
+
+inline void RealDecibelsNEON(const F32* input, F32* output, const U64& size, const F32& offset) {
+    const float32x4_t off = vdupq_n_f32(offset);
+
+    U64 i = 0;
+    for (; i + 4 <= size; i += 4) {
+        const float32x4_t x = vld1q_f32(input + i);
+        vst1q_f32(output + i, PowerToDecibelsNEON(vmulq_f32(x, x), off));
+    }
+
+    RealDecibelsScalar(input + i, output + i, size - i, offset);
+}
+
+#endif  // JST_SIMD_NEON
+
+#ifdef JST_SIMD_WASM
+
+inline v128_t PowerToDecibelsWASM(const v128_t& power, const v128_t& offset) {
+    const v128_t E = wasm_f32x4_convert_i32x4(wasm_i32x4_sub(wasm_u32x4_shr(power, 23), wasm_i32x4_splat(126)));
+    const v128_t F = wasm_v128_or(wasm_v128_and(power, wasm_i32x4_splat(0x007FFFFF)),
+                                  wasm_i32x4_splat(0x3F000000));
+
+    // No fused multiply-add without relaxed SIMD.
+    v128_t Y = wasm_f32x4_splat(Detail::Log10Poly3);
+    Y = wasm_f32x4_add(wasm_f32x4_mul(Y, F), wasm_f32x4_splat(Detail::Log10Poly2));
+    Y = wasm_f32x4_add(wasm_f32x4_mul(Y, F), wasm_f32x4_splat(Detail::Log10Poly1));
+    Y = wasm_f32x4_add(wasm_f32x4_mul(Y, F), wasm_f32x4_splat(Detail::Log10Poly0));
+    Y = wasm_f32x4_add(Y, E);
+
+    return wasm_f32x4_add(wasm_f32x4_mul(Y, wasm_f32x4_splat(Detail::DecibelsPerOctave)), offset);
+}
+
+inline void ComplexDecibelsWASM(const CF32* input, F32* output, const U64& size, const F32& offset) {
+    const F32* in = reinterpret_cast<const F32*>(input);
+    const v128_t off = wasm_f32x4_splat(offset);
+
+    U64 i = 0;
+    for (; i + 4 <= size; i += 4) {
+        const v128_t a = wasm_v128_load(in + 2 * i);
+        const v128_t b = wasm_v128_load(in + 2 * i + 4);
+        const v128_t aa = wasm_f32x4_mul(a, a);
+        const v128_t bb = wasm_f32x4_mul(b, b);
+
+        const v128_t power = wasm_f32x4_add(wasm_i32x4_shuffle(aa, bb, 0, 2, 4, 6),
+                                            wasm_i32x4_shuffle(aa, bb, 1, 3, 5, 7));
+
+        wasm_v128_store(output + i, PowerToDecibelsWASM(power, off));
+    }
+
+    ComplexDecibelsScalar(input + i, output + i, size - i, offset);
+}
+
+inline void RealDecibelsWASM(const F32* input, F32* output, const U64& size, const F32& offset) {
+    const v128_t off = wasm_f32x4_splat(offset);
+
+    U64 i = 0;
+    for (; i + 4 <= size; i += 4) {
+        const v128_t x = wasm_v128_load(input + i);
+        wasm_v128_store(output + i, PowerToDecibelsWASM(wasm_f32x4_mul(x, x), off));
+    }
+
+    RealDecibelsScalar(input + i, output + i, size - i, offset);
+}
+
+#endif  // JST_SIMD_WASM
+
+//
+// Complex multiply.
+//
+// Kernels computing c = a * b and c = a * k over contiguous arrays. The
+// output may alias one of the inputs. The slide kernel computes
+// s = (s + d) * t in place, one sample step of a sliding DFT. The
+// conjugate kernel accumulates c += a * conj(b), a cross-power spectrum.
+//
+
+typedef void (*ComplexMultiplyKernel)(const CF32* a, const CF32* b, CF32* c, const U64& size);
+typedef void (*ComplexScaleKernel)(const CF32* a, const CF32& k, CF32* c, const U64& size);
+typedef void (*ComplexSlideKernel)(CF32* s, const CF32* t, const CF32& d, const U64& size);
+typedef void (*ComplexConjugateMultiplyAddKernel)(const CF32* a, const CF32* b, CF32* c, const U64& size);
+
+inline void ComplexMultiplyScalar(const CF32* a, const CF32* b, CF32* c, const U64& size) {
+    for (U64 i = 0; i < size; i++) {
+        const CF32 x = a[i];
+        const CF32 y = b[i];
+        c[i] = CF32(x.real() * y.real() - x.imag() * y.imag(),
+                    x.real() * y.imag() + x.imag() * y.real());
+    }
+}
+
+inline void ComplexScaleScalar(const CF32* a, const CF32& k, CF32* c, const U64& size) {
+    const F32 kr = k.real();
+    const F32 ki = k.imag();
+    for (U64 i = 0; i < size; i++) {
+        const CF32 x = a[i];
+        c[i] = CF32(x.real() * kr - x.imag() * ki,
+                    x.real() * ki + x.imag() * kr);
+    }
+}
+
+inline void ComplexSlideScalar(CF32* s, const CF32* t, const CF32& d, const U64& size) {
+    for (U64 i = 0; i < size; i++) {
+        const CF32 x = s[i] + d;
+        const CF32 y = t[i];
+        s[i] = CF32(x.real() * y.real() - x.imag() * y.imag(),
+                    x.real() * y.imag() + x.imag() * y.real());
+    }
+}
+
+inline void ComplexConjugateMultiplyAddScalar(const CF32* a, const CF32* b, CF32* c, const U64& size) {
+    for (U64 i = 0; i < size; i++) {
+        const CF32 x = a[i];
+        const CF32 y = b[i];
+        c[i] += CF32(x.real() * y.real() + x.imag() * y.imag(),
+                     x.imag() * y.real() - x.real() * y.imag());
+    }
+}
+
+#ifdef JST_SIMD_X86
+
+// Products of interleaved pairs: (ar * br - ai * bi, ai * br + ar * bi).
+__attribute__((target("avx2,fma")))
+inline __m256 ComplexProductAVX2(const __m256& a, const __m256& br, const __m256& bi) {
+    return _mm256_fmaddsub_ps(a, br, _mm256_mul_ps(_mm256_permute_ps(a, 0xB1), bi));
+}
+
+__attribute__((target("avx2,fma")))
+inline void ComplexMultiplyAVX2(const CF32* a, const CF32* b, CF32* c, const U64& size) {
+    const F32* x = reinterpret_cast<const F32*>(a);
+    const F32* y = reinterpret_cast<const F32*>(b);
+    F32* z = reinterpret_cast<F32*>(c);
+
+    U64 i = 0;
+    for (; i + 4 <= size; i += 4) {
+        const __m256 av = _mm256_loadu_ps(x + 2 * i);
+        const __m256 bv = _mm256_loadu_ps(y + 2 * i);
+        _mm256_storeu_ps(z + 2 * i, ComplexProductAVX2(av, _mm256_moveldup_ps(bv), _mm256_movehdup_ps(bv)));
+    }
+
+    ComplexMultiplyScalar(a + i, b + i, c + i, size - i);
+}
+
+__attribute__((target("avx2,fma")))
+inline void ComplexScaleAVX2(const CF32* a, const CF32& k, CF32* c, const U64& size) {
+    const F32* x = reinterpret_cast<const F32*>(a);
+    F32* z = reinterpret_cast<F32*>(c);
+    const __m256 kr = _mm256_set1_ps(k.real());
+    const __m256 ki = _mm256_set1_ps(k.imag());
+
+    U64 i = 0;
+    for (; i + 4 <= size; i += 4) {
+        _mm256_storeu_ps(z + 2 * i, ComplexProductAVX2(_mm256_loadu_ps(x + 2 * i), kr, ki));
+    }
+
+    ComplexScaleScalar(a + i, k, c + i, size - i);
+}
+
+__attribute__((target("avx2,fma")))
+inline void ComplexSlideAVX2(CF32* s, const CF32* t, const CF32& d, const U64& size) {
+    F32* x = reinterpret_cast<F32*>(s);
+    const F32* y = reinterpret_cast<const F32*>(t);
+    const __m256 dv = _mm256_setr_ps(d.real(), d.imag(), d.real(), d.imag(),
+                                     d.real(), d.imag(), d.real(), d.imag());
+
+    U64 i = 0;
+    for (; i + 4 <= size; i += 4) {
+        const __m256 av = _mm256_add_ps(_mm256_loadu_ps(x + 2 * i), dv);
+        const __m256 bv = _mm256_loadu_ps(y + 2 * i);
+        _mm256_storeu_ps(x + 2 * i, ComplexProductAVX2(av, _mm256_moveldup_ps(bv), _mm256_movehdup_ps(bv)));
+    }
+
+    ComplexSlideScalar(s + i, t + i, d, size - i);
+}
+
+// Same as the product with the subtraction on the odd lanes, (ar * br + ai * bi, ai * br - ar * bi).
+__attribute__((target("avx2,fma")))
+inline void ComplexConjugateMultiplyAddAVX2(const CF32* a, const CF32* b, CF32* c, const U64& size) {
+    const F32* x = reinterpret_cast<const F32*>(a);
+    const F32* y = reinterpret_cast<const F32*>(b);
+    F32* z = reinterpret_cast<F32*>(c);
+
+    U64 i = 0;
+    for (; i + 4 <= size; i += 4) {
+        const __m256 av = _mm256_loadu_ps(x + 2 * i);
+        const __m256 bv = _mm256_loadu_ps(y + 2 * i);
+        const __m256 pv = _mm256_fmsubadd_ps(av, _mm256_moveldup_ps(bv),
+                                             _mm256_mul_ps(_mm256_permute_ps(av, 0xB1), _mm256_movehdup_ps(bv)));
+        _mm256_storeu_ps(z + 2 * i, _mm256_add_ps(_mm256_loadu_ps(z + 2 * i), pv));
+    }
+
+    ComplexConjugateMultiplyAddScalar(a + i, b + i, c + i, size - i);
+}
+
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+
+__attribute__((target("avx512f")))
+inline __m512 ComplexProductAVX512(const __m512& a, const __m512& br, const __m512& bi) {
+    return _mm512_fmaddsub_ps(a, br, _mm512_mul_ps(_mm512_permute_ps(a, 0xB1), bi));
+}
+
+__attribute__((target("avx512f")))
+inline void ComplexMultiplyAVX512(const CF32* a, const CF32* b, CF32* c, const U64& size) {
+    const F32* x = reinterpret_cast<const F32*>(a);
+    const F32* y = reinterpret_cast<const F32*>(b);
+    F32* z = reinterpret_cast<F32*>(c);
+
+    U64 i = 0;
+    for (; i + 8 <= size; i += 8) {
+        const __m512 av = _mm512_loadu_ps(x + 2 * i);
+        const __m512 bv = _mm512_loadu_ps(y + 2 * i);
+        _mm512_storeu_ps(z + 2 * i, ComplexProductAVX512(av, _mm512_moveldup_ps(bv), _mm512_movehdup_ps(bv)));
+    }
+
+    ComplexMultiplyScalar(a + i, b + i, c + i, size - i);
+}
+
+__attribute__((target("avx512f")))
+inline void ComplexScaleAVX512(const CF32* a, const CF32& k, CF32* c, const U64& size) {
+    const F32* x = reinterpret_cast<const F32*>(a);
+    F32* z = reinterpret_cast<F32*>(c);
+    const __m512 kr = _mm512_set1_ps(k.real());
+    const __m512 ki = _mm512_set1_ps(k.imag());
+
+    U64 i = 0;
+    for (; i + 8 <= size; i += 8) {
+        _mm512_storeu_ps(z + 2 * i, ComplexProductAVX512(_mm512_loadu_ps(x + 2 * i), kr, ki));
+    }
+
+    ComplexScaleScalar(a + i, k, c + i, size - i);
+}
+
+__attribute__((target("avx512f")))
+inline void ComplexSlideAVX512(CF32* s, const CF32* t, const CF32& d, const U64& size) {
+    F32* x = reinterpret_cast<F32*>(s);
+    const F32* y = reinterpret_cast<const F32*>(t);
+    const __m512 dv = _mm512_castpd_ps(_mm512_set1_pd(std::bit_cast<F64>(d)));
+
+    U64 i = 0;
+    for (; i + 8 <= size; i += 8) {
+        const __m512 av = _mm512_add_ps(_mm512_loadu_ps(x + 2 * i), dv);
+        const __m512 bv = _mm512_loadu_ps(y + 2 * i);
+        _mm512_storeu_ps(x + 2 * i, ComplexProductAVX512(av, _mm512_moveldup_ps(bv), _mm512_movehdup_ps(bv)));
+    }
+
+    ComplexSlideScalar(s + i, t + i, d, size - i);
+}
+
+__attribute__((target("avx512f")))
+inline void ComplexConjugateMultiplyAddAVX512(const CF32* a, const CF32* b, CF32* c, const U64& size) {
+    const F32* x = reinterpret_cast<const F32*>(a);
+    const F32* y = reinterpret_cast<const F32*>(b);
+    F32* z = reinterpret_cast<F32*>(c);
+
+    U64 i = 0;
+    for (; i + 8 <= size; i += 8) {
+        const __m512 av = _mm512_loadu_ps(x + 2 * i);
+        const __m512 bv = _mm512_loadu_ps(y + 2 * i);
+        const __m512 pv = _mm512_fmsubadd_ps(av, _mm512_moveldup_ps(bv),
+                                             _mm512_mul_ps(_mm512_permute_ps(av, 0xB1), _mm512_movehdup_ps(bv)));
+        _mm512_storeu_ps(z + 2 * i, _mm512_add_ps(_mm512_loadu_ps(z + 2 * i), pv));
+    }
+
+    ComplexConjugateMultiplyAddScalar(a + i, b + i, c + i, size - i);
+}
+
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+
+#endif  // JST_SIMD_X86
+
+#ifdef JST_SIMD_NEON
+
+inline void ComplexMultiplyNEON(const CF32* a, const CF32* b, CF32* c, const U64& size) {
+    const F32* x = reinterpret_cast<const F32*>(a);
+    const F32* y = reinterpret_cast<const F32*>(b);
+    F32* z = reinterpret_cast<F32*>(c);
+
+    U64 i = 0;
+    for (; i + 4 <= size; i += 4) {
+        const float32x4x2_t av = vld2q_f32(x + 2 * i);
+        const float32x4x2_t bv = vld2q_f32(y + 2 * i);
+
+        float32x4x2_t cv;
+        cv.val[0] = vfmsq_f32(vmulq_f32(av.val[0], bv.val[0]), av.val[1], bv.val[1]);
+        cv.val[1] = vfmaq_f32(vmulq_f32(av.val[0], bv.val[1]), av.val[1], bv.val[0]);
+        vst2q_f32(z + 2 * i, cv);
+    }
+
+    ComplexMultiplyScalar(a + i, b + i, c + i, size - i);
+}
+
+inline void ComplexScaleNEON(const CF32* a, const CF32& k, CF32* c, const U64& size) {
+    const F32* x = reinterpret_cast<const F32*>(a);
+    F32* z = reinterpret_cast<F32*>(c);
+    const float32x4_t kr = vdupq_n_f32(k.real());
+    const float32x4_t ki = vdupq_n_f32(k.imag());
+
+    U64 i = 0;
+    for (; i + 4 <= size; i += 4) {
+        const float32x4x2_t av = vld2q_f32(x + 2 * i);
+
+        float32x4x2_t cv;
+        cv.val[0] = vfmsq_f32(vmulq_f32(av.val[0], kr), av.val[1], ki);
+        cv.val[1] = vfmaq_f32(vmulq_f32(av.val[0], ki), av.val[1], kr);
+        vst2q_f32(z + 2 * i, cv);
+    }
+
+    ComplexScaleScalar(a + i, k, c + i, size - i);
+}
+
+inline void ComplexSlideNEON(CF32* s, const CF32* t, const CF32& d, const U64& size) {
+    F32* x = reinterpret_cast<F32*>(s);
+    const F32* y = reinterpret_cast<const F32*>(t);
+    const float32x4_t dr = vdupq_n_f32(d.real());
+    const float32x4_t di = vdupq_n_f32(d.imag());
+
+    U64 i = 0;
+    for (; i + 4 <= size; i += 4) {
+        const float32x4x2_t sv = vld2q_f32(x + 2 * i);
+        const float32x4x2_t tv = vld2q_f32(y + 2 * i);
+        const float32x4_t ar = vaddq_f32(sv.val[0], dr);
+        const float32x4_t ai = vaddq_f32(sv.val[1], di);
+
+        float32x4x2_t cv;
+        cv.val[0] = vfmsq_f32(vmulq_f32(ar, tv.val[0]), ai, tv.val[1]);
+        cv.val[1] = vfmaq_f32(vmulq_f32(ar, tv.val[1]), ai, tv.val[0]);
+        vst2q_f32(x + 2 * i, cv);
+    }
+
+    ComplexSlideScalar(s + i, t + i, d, size - i);
+}
+
+inline void ComplexConjugateMultiplyAddNEON(const CF32* a, const CF32* b, CF32* c, const U64& size) {
+    const F32* x = reinterpret_cast<const F32*>(a);
+    const F32* y = reinterpret_cast<const F32*>(b);
+    F32* z = reinterpret_cast<F32*>(c);
+
+    U64 i = 0;
+    for (; i + 4 <= size; i += 4) {
+        const float32x4x2_t av = vld2q_f32(x + 2 * i);
+        const float32x4x2_t bv = vld2q_f32(y + 2 * i);
+
+        float32x4x2_t cv = vld2q_f32(z + 2 * i);
+        cv.val[0] = vfmaq_f32(vfmaq_f32(cv.val[0], av.val[0], bv.val[0]), av.val[1], bv.val[1]);
+        cv.val[1] = vfmsq_f32(vfmaq_f32(cv.val[1], av.val[1], bv.val[0]), av.val[0], bv.val[1]);
+        vst2q_f32(z + 2 * i, cv);
+    }
+
+    ComplexConjugateMultiplyAddScalar(a + i, b + i, c + i, size - i);
+}
+
+#endif  // JST_SIMD_NEON
+
+#ifdef JST_SIMD_WASM
+
+// Products of two interleaved pairs: a * br + swap(a) * (-bi, bi).
+inline v128_t ComplexProductWASM(const v128_t& a, const v128_t& br, const v128_t& bi) {
+    const v128_t swapped = wasm_i32x4_shuffle(a, a, 1, 0, 3, 2);
+    const v128_t sign = wasm_f32x4_make(-1.0f, 1.0f, -1.0f, 1.0f);
+    return wasm_f32x4_add(wasm_f32x4_mul(a, br), wasm_f32x4_mul(swapped, wasm_f32x4_mul(bi, sign)));
+}
+
+inline void ComplexMultiplyWASM(const CF32* a, const CF32* b, CF32* c, const U64& size) {
+    const F32* x = reinterpret_cast<const F32*>(a);
+    const F32* y = reinterpret_cast<const F32*>(b);
+    F32* z = reinterpret_cast<F32*>(c);
+
+    U64 i = 0;
+    for (; i + 2 <= size; i += 2) {
+        const v128_t av = wasm_v128_load(x + 2 * i);
+        const v128_t bv = wasm_v128_load(y + 2 * i);
+        const v128_t br = wasm_i32x4_shuffle(bv, bv, 0, 0, 2, 2);
+        const v128_t bi = wasm_i32x4_shuffle(bv, bv, 1, 1, 3, 3);
+        wasm_v128_store(z + 2 * i, ComplexProductWASM(av, br, bi));
+    }
+
+    ComplexMultiplyScalar(a + i, b + i, c + i, size - i);
+}
+
+inline void ComplexScaleWASM(const CF32* a, const CF32& k, CF32* c, const U64& size) {
+    const F32* x = reinterpret_cast<const F32*>(a);
+    F32* z = reinterpret_cast<F32*>(c);
+    const v128_t kr = wasm_f32x4_splat(k.real());
+    const v128_t ki = wasm_f32x4_splat(k.imag());
+
+    U64 i = 0;
+    for (; i + 2 <= size; i += 2) {
+        wasm_v128_store(z + 2 * i, ComplexProductWASM(wasm_v128_load(x + 2 * i), kr, ki));
+    }
+
+    ComplexScaleScalar(a + i, k, c + i, size - i);
+}
+
+#endif  // JST_SIMD_WASM
+
+//
+// FIR dot products.
+//
+// Kernels computing sum(taps[i] * samples[i]) for real taps. Complex samples
+// take the taps duplicated for both parts (t0 t0 t1 t1 ...), so they're read
+// as a plain interleaved array and the real and imaginary sums fall out of
+// the even and odd lanes.
+//
+
+typedef F32 (*RealFirDotKernel)(const F32* taps, const F32* samples, const U64& size);
+typedef CF32 (*ComplexFirDotKernel)(const F32* taps, const CF32* samples, const U64& size);
+
+inline F32 RealFirDotScalar(const F32* taps, const F32* samples, const U64& size) {
+    F32 sum = 0.0f;
+    for (U64 i = 0; i < size; i++) {
+        sum += taps[i] * samples[i];
+    }
+    return sum;
+}
+
+inline CF32 ComplexFirDotScalar(const F32* taps, const CF32* samples, const U64& size) {
+    F32 re = 0.0f;
+    F32 im = 0.0f;
+    for (U64 i = 0; i < size; i++) {
+        re += taps[2 * i] * samples[i].real();
+        im += taps[2 * i] * samples[i].imag();
+    }
+    return {re, im};
+}
+
+#ifdef JST_SIMD_X86
+
+// Sum of the even and odd lanes.
+__attribute__((target("avx2,fma")))
+inline std::pair<F32, F32> PairSumAVX2(const __m256& v) {
+    const __m128 q = _mm_add_ps(_mm256_castps256_ps128(v), _mm256_extractf128_ps(v, 1));
+    const __m128 h = _mm_add_ps(q, _mm_movehl_ps(q, q));
+    return {_mm_cvtss_f32(h), _mm_cvtss_f32(_mm_shuffle_ps(h, h, 0x01))};
+}
+
+__attribute__((target("avx2,fma")))
+inline F32 RealFirDotAVX2(const F32* taps, const F32* samples, const U64& size) {
+    __m256 acc0 = _mm256_setzero_ps();
+    __m256 acc1 = _mm256_setzero_ps();
+
+    U64 i = 0;
+    for (; i + 16 <= size; i += 16) {
+        acc0 = _mm256_fmadd_ps(_mm256_loadu_ps(taps + i), _mm256_loadu_ps(samples + i), acc0);
+        acc1 = _mm256_fmadd_ps(_mm256_loadu_ps(taps + i + 8), _mm256_loadu_ps(samples + i + 8), acc1);
+    }
+    for (; i + 8 <= size; i += 8) {
+        acc0 = _mm256_fmadd_ps(_mm256_loadu_ps(taps + i), _mm256_loadu_ps(samples + i), acc0);
+    }
+
+    const auto [even, odd] = PairSumAVX2(_mm256_add_ps(acc0, acc1));
+    return even + odd + RealFirDotScalar(taps + i, samples + i, size - i);
+}
+
+__attribute__((target("avx2,fma")))
+inline CF32 ComplexFirDotAVX2(const F32* taps, const CF32* samples, const U64& size) {
+    const F32* in = reinterpret_cast<const F32*>(samples);
+    __m256 acc0 = _mm256_setzero_ps();
+    __m256 acc1 = _mm256_setzero_ps();
+
+    U64 i = 0;
+    for (; i + 8 <= size; i += 8) {
+        acc0 = _mm256_fmadd_ps(_mm256_loadu_ps(taps + 2 * i), _mm256_loadu_ps(in + 2 * i), acc0);
+        acc1 = _mm256_fmadd_ps(_mm256_loadu_ps(taps + 2 * i + 8), _mm256_loadu_ps(in + 2 * i + 8), acc1);
+    }
+    for (; i + 4 <= size; i += 4) {
+        acc0 = _mm256_fmadd_ps(_mm256_loadu_ps(taps + 2 * i), _mm256_loadu_ps(in + 2 * i), acc0);
+    }
+
+    const auto [re, im] = PairSumAVX2(_mm256_add_ps(acc0, acc1));
+    return CF32(re, im) + ComplexFirDotScalar(taps + 2 * i, samples + i, size - i);
+}
+
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+
+__attribute__((target("avx512f")))
+inline F32 RealFirDotAVX512(const F32* taps, const F32* samples, const U64& size) {
+    __m512 acc0 = _mm512_setzero_ps();
+    __m512 acc1 = _mm512_setzero_ps();
+
+    U64 i = 0;
+    for (; i + 32 <= size; i += 32) {
+        acc0 = _mm512_fmadd_ps(_mm512_loadu_ps(taps + i), _mm512_loadu_ps(samples + i), acc0);
+        acc1 = _mm512_fmadd_ps(_mm512_loadu_ps(taps + i + 16), _mm512_loadu_ps(samples + i + 16), acc1);
+    }
+    for (; i + 16 <= size; i += 16) {
+        acc0 = _mm512_fmadd_ps(_mm512_loadu_ps(taps + i), _mm512_loadu_ps(samples + i), acc0);
+    }
+
+    return _mm512_reduce_add_ps(_mm512_add_ps(acc0, acc1)) +
+           RealFirDotScalar(taps + i, samples + i, size - i);
+}
+
+__attribute__((target("avx512f")))
+inline CF32 ComplexFirDotAVX512(const F32* taps, const CF32* samples, const U64& size) {
+    const F32* in = reinterpret_cast<const F32*>(samples);
+    __m512 acc0 = _mm512_setzero_ps();
+    __m512 acc1 = _mm512_setzero_ps();
+
+    U64 i = 0;
+    for (; i + 16 <= size; i += 16) {
+        acc0 = _mm512_fmadd_ps(_mm512_loadu_ps(taps + 2 * i), _mm512_loadu_ps(in + 2 * i), acc0);
+        acc1 = _mm512_fmadd_ps(_mm512_loadu_ps(taps + 2 * i + 16), _mm512_loadu_ps(in + 2 * i + 16), acc1);
+    }
+    for (; i + 8 <= size; i += 8) {
+        acc0 = _mm512_fmadd_ps(_mm512_loadu_ps(taps + 2 * i), _mm512_loadu_ps(in + 2 * i), acc0);
+    }
+
+    const __m512 acc = _mm512_add_ps(acc0, acc1);
+    const F32 re = _mm512_mask_reduce_add_ps(0x5555, acc);
+    const F32 im = _mm512_mask_reduce_add_ps(0xAAAA, acc);
+
+    return CF32(re, im) + ComplexFirDotScalar(taps + 2 * i, samples + i, size - i);
+}
+
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+
+#endif  // JST_SIMD_X86
+
+#ifdef JST_SIMD_NEON
+
+inline F32 RealFirDotNEON(const F32* taps, const F32* samples, const U64& size) {
+    float32x4_t acc0 = vdupq_n_f32(0.0f);
+    float32x4_t acc1 = vdupq_n_f32(0.0f);
+
+    U64 i = 0;
+    for (; i + 8 <= size; i += 8) {
+        acc0 = vfmaq_f32(acc0, vld1q_f32(taps + i), vld1q_f32(samples + i));
+        acc1 = vfmaq_f32(acc1, vld1q_f32(taps + i + 4), vld1q_f32(samples + i + 4));
+    }
+    for (; i + 4 <= size; i += 4) {
+        acc0 = vfmaq_f32(acc0, vld1q_f32(taps + i), vld1q_f32(samples + i));
+    }
+
+    return vaddvq_f32(vaddq_f32(acc0, acc1)) + RealFirDotScalar(taps + i, samples + i, size - i);
+}
+
+inline CF32 ComplexFirDotNEON(const F32* taps, const CF32* samples, const U64& size) {
+    const F32* in = reinterpret_cast<const F32*>(samples);
+    float32x4_t acc0 = vdupq_n_f32(0.0f);
+    float32x4_t acc1 = vdupq_n_f32(0.0f);
+
+    U64 i = 0;
+    for (; i + 4 <= size; i += 4) {
+        acc0 = vfmaq_f32(acc0, vld1q_f32(taps + 2 * i), vld1q_f32(in + 2 * i));
+        acc1 = vfmaq_f32(acc1, vld1q_f32(taps + 2 * i + 4), vld1q_f32(in + 2 * i + 4));
+    }
+    for (; i + 2 <= size; i += 2) {
+        acc0 = vfmaq_f32(acc0, vld1q_f32(taps + 2 * i), vld1q_f32(in + 2 * i));
+    }
+
+    // Lanes alternate between real and imaginary parts.
+    const float32x4_t acc = vaddq_f32(acc0, acc1);
+    const float32x2_t pair = vadd_f32(vget_low_f32(acc), vget_high_f32(acc));
+
+    return CF32(vget_lane_f32(pair, 0), vget_lane_f32(pair, 1)) +
+           ComplexFirDotScalar(taps + 2 * i, samples + i, size - i);
+}
+
+#endif  // JST_SIMD_NEON
+
+#ifdef JST_SIMD_WASM
+
+inline F32 RealFirDotWASM(const F32* taps, const F32* samples, const U64& size) {
+    v128_t acc0 = wasm_f32x4_splat(0.0f);
+    v128_t acc1 = wasm_f32x4_splat(0.0f);
+
+    U64 i = 0;
+    for (; i + 8 <= size; i += 8) {
+        acc0 = wasm_f32x4_add(acc0, wasm_f32x4_mul(wasm_v128_load(taps + i), wasm_v128_load(samples + i)));
+        acc1 = wasm_f32x4_add(acc1, wasm_f32x4_mul(wasm_v128_load(taps + i + 4), wasm_v128_load(samples + i + 4)));
+    }
+    for (; i + 4 <= size; i += 4) {
+        acc0 = wasm_f32x4_add(acc0, wasm_f32x4_mul(wasm_v128_load(taps + i), wasm_v128_load(samples + i)));
+    }
+
+    const v128_t acc = wasm_f32x4_add(acc0, acc1);
+    const v128_t pair = wasm_f32x4_add(acc, wasm_i32x4_shuffle(acc, acc, 2, 3, 0, 1));
+
+    return wasm_f32x4_extract_lane(pair, 0) + wasm_f32x4_extract_lane(pair, 1) +
+           RealFirDotScalar(taps + i, samples + i, size - i);
+}
+
+inline CF32 ComplexFirDotWASM(const F32* taps, const CF32* samples, const U64& size) {
+    const F32* in = reinterpret_cast<const F32*>(samples);
+    v128_t acc0 = wasm_f32x4_splat(0.0f);
+    v128_t acc1 = wasm_f32x4_splat(0.0f);
+
+    U64 i = 0;
+    for (; i + 4 <= size; i += 4) {
+        acc0 = wasm_f32x4_add(acc0, wasm_f32x4_mul(wasm_v128_load(taps + 2 * i), wasm_v128_load(in + 2 * i)));
+        acc1 = wasm_f32x4_add(acc1, wasm_f32x4_mul(wasm_v128_load(taps + 2 * i + 4), wasm_v128_load(in + 2 * i + 4)));
+    }
+    for (; i + 2 <= size; i += 2) {
+        acc0 = wasm_f32x4_add(acc0, wasm_f32x4_mul(wasm_v128_load(taps + 2 * i), wasm_v128_load(in + 2 * i)));
+    }
+
+    // Lanes alternate between real and imaginary parts.
+    const v128_t acc = wasm_f32x4_add(acc0, acc1);
+    const v128_t pair = wasm_f32x4_add(acc, wasm_i32x4_shuffle(acc, acc, 2, 3, 0, 1));
+
+    return CF32(wasm_f32x4_extract_lane(pair, 0), wasm_f32x4_extract_lane(pair, 1)) +
+           ComplexFirDotScalar(taps + 2 * i, samples + i, size - i);
+}
+
+#endif  // JST_SIMD_WASM
+
+//
+// FM discriminator.
+//
+// Kernels computing arg(conj(x[n - 1]) * x[n]) * gain over contiguous arrays,
+// with x[-1] taken from the previous buffer. The arctangent is a degree 11
+// odd polynomial on [0, 1] folded to the four quadrants, within 1e-5 rad of
+// atan2 in every variant.
+//
+
+namespace Detail {
+
+inline constexpr F32 AtanPoly11 = -0.01172120f;
+inline constexpr F32 AtanPoly9  =  0.05265332f;
+inline constexpr F32 AtanPoly7  = -0.11643287f;
+inline constexpr F32 AtanPoly5  =  0.19354346f;
+inline constexpr F32 AtanPoly3  = -0.33262347f;
+inline constexpr F32 AtanPoly1  =  0.99997726f;
+inline constexpr F32 Pi = 3.14159265358979f;
+inline constexpr F32 HalfPi = 1.57079632679490f;
+inline constexpr F32 MinNormal = 1.17549435e-38f;
+
+}  // namespace Detail
+
+inline F32 ApproxPolyAtan2(const F32& y, const F32& x) {
+    const F32 ax = std::fabs(x);
+    const F32 ay = std::fabs(y);
+    const F32 a = std::min(ax, ay) / std::max(std::max(ax, ay), Detail::MinNormal);
+    const F32 s = a * a;
+
+    F32 r = Detail::AtanPoly11;
+    r = r * s + Detail::AtanPoly9;
+    r = r * s + Detail::AtanPoly7;
+    r = r * s + Detail::AtanPoly5;
+    r = r * s + Detail::AtanPoly3;
+    r = r * s + Detail::AtanPoly1;
+    r *= a;
+
+    r = (ay > ax) ? Detail::HalfPi - r : r;
+    r = (x < 0.0f) ? Detail::Pi - r : r;
+    return (y < 0.0f) ? -r : r;
+}
+
+typedef void (*FmDemodulateKernel)(const CF32* input, const CF32& previous, F32* output, const U64& size, const F32& gain);
+
+inline void FmDemodulateScalar(const CF32* input, const CF32& previous, F32* output, const U64& size, const F32& gain) {
+    CF32 p = previous;
+    for (U64 i = 0; i < size; i++) {
+        const CF32 c = input[i];
+        const F32 re = p.real() * c.real() + p.imag() * c.imag();
+        const F32 im = p.real() * c.imag() - p.imag() * c.real();
+        output[i] = ApproxPolyAtan2(im, re) * gain;
+        p = c;
+    }
+}
+
+#ifdef JST_SIMD_X86
+
+__attribute__((target("avx2,fma")))
+inline __m256 PolyAtan2AVX2(const __m256& y, const __m256& x) {
+    const __m256 sign = _mm256_set1_ps(-0.0f);
+    const __m256 ax = _mm256_andnot_ps(sign, x);
+    const __m256 ay = _mm256_andnot_ps(sign, y);
+    const __m256 a = _mm256_div_ps(_mm256_min_ps(ax, ay),
+                                   _mm256_max_ps(_mm256_max_ps(ax, ay), _mm256_set1_ps(Detail::MinNormal)));
+    const __m256 s = _mm256_mul_ps(a, a);
+
+    __m256 r = _mm256_set1_ps(Detail::AtanPoly11);
+    r = _mm256_fmadd_ps(r, s, _mm256_set1_ps(Detail::AtanPoly9));
+    r = _mm256_fmadd_ps(r, s, _mm256_set1_ps(Detail::AtanPoly7));
+    r = _mm256_fmadd_ps(r, s, _mm256_set1_ps(Detail::AtanPoly5));
+    r = _mm256_fmadd_ps(r, s, _mm256_set1_ps(Detail::AtanPoly3));
+    r = _mm256_fmadd_ps(r, s, _mm256_set1_ps(Detail::AtanPoly1));
+    r = _mm256_mul_ps(r, a);
+
+    r = _mm256_blendv_ps(r, _mm256_sub_ps(_mm256_set1_ps(Detail::HalfPi), r), _mm256_cmp_ps(ay, ax, _CMP_GT_OQ));
+    r = _mm256_blendv_ps(r, _mm256_sub_ps(_mm256_set1_ps(Detail::Pi), r), _mm256_cmp_ps(x, _mm256_setzero_ps(), _CMP_LT_OQ));
+    return _mm256_blendv_ps(r, _mm256_sub_ps(_mm256_setzero_ps(), r), _mm256_cmp_ps(y, _mm256_setzero_ps(), _CMP_LT_OQ));
+}
+
+__attribute__((target("avx2,fma")))
+inline void FmDemodulateAVX2(const CF32* input, const CF32& previous, F32* output, const U64& size, const F32& gain) {
+    if (size == 0) {
+        return;
+    }
+    FmDemodulateScalar(input, previous, output, 1, gain);
+
+    const F32* in = reinterpret_cast<const F32*>(input);
+    const __m256 g = _mm256_set1_ps(gain);
+
+    U64 i = 1;
+    for (; i + 8 <= size; i += 8) {
+        const __m256 c0 = _mm256_loadu_ps(in + 2 * i);
+        const __m256 c1 = _mm256_loadu_ps(in + 2 * i + 8);
+        const __m256 p0 = _mm256_loadu_ps(in + 2 * i - 2);
+        const __m256 p1 = _mm256_loadu_ps(in + 2 * i + 6);
+
+        // Parts come out as [0 1 4 5 | 2 3 6 7] and are put back in order at the end.
+        const __m256 cr = _mm256_shuffle_ps(c0, c1, 0x88);
+        const __m256 ci = _mm256_shuffle_ps(c0, c1, 0xDD);
+        const __m256 pr = _mm256_shuffle_ps(p0, p1, 0x88);
+        const __m256 pi = _mm256_shuffle_ps(p0, p1, 0xDD);
+
+        const __m256 re = _mm256_fmadd_ps(pr, cr, _mm256_mul_ps(pi, ci));
+        const __m256 im = _mm256_fmsub_ps(pr, ci, _mm256_mul_ps(pi, cr));
+
+        const __m256 phase = _mm256_mul_ps(PolyAtan2AVX2(im, re), g);
+        _mm256_storeu_ps(output + i, _mm256_castpd_ps(_mm256_permute4x64_pd(_mm256_castps_pd(phase), 0b11011000)));
+    }
+
+    FmDemodulateScalar(input + i, input[i - 1], output + i, size - i, gain);
+}
+
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+
+__attribute__((target("avx512f")))
+inline __m512 PolyAtan2AVX512(const __m512& y, const __m512& x) {
+    const __m512 ax = _mm512_abs_ps(x);
+    const __m512 ay = _mm512_abs_ps(y);
+    const __m512 a = _mm512_div_ps(_mm512_min_ps(ax, ay),
+                                   _mm512_max_ps(_mm512_max_ps(ax, ay), _mm512_set1_ps(Detail::MinNormal)));
+    const __m512 s = _mm512_mul_ps(a, a);
+
+    __m512 r = _mm512_set1_ps(Detail::AtanPoly11);
+    r = _mm512_fmadd_ps(r, s, _mm512_set1_ps(Detail::AtanPoly9));
+    r = _mm512_fmadd_ps(r, s, _mm512_set1_ps(Detail::AtanPoly7));
+    r = _mm512_fmadd_ps(r, s, _mm512_set1_ps(Detail::AtanPoly5));
+    r = _mm512_fmadd_ps(r, s, _mm512_set1_ps(Detail::AtanPoly3));
+    r = _mm512_fmadd_ps(r, s, _mm512_set1_ps(Detail::AtanPoly1));
+    r = _mm512_mul_ps(r, a);
+
+    r = _mm512_mask_sub_ps(r, _mm512_cmp_ps_mask(ay, ax, _CMP_GT_OQ), _mm512_set1_ps(Detail::HalfPi), r);
+    r = _mm512_mask_sub_ps(r, _mm512_cmp_ps_mask(x, _mm512_setzero_ps(), _CMP_LT_OQ), _mm512_set1_ps(Detail::Pi), r);
+    return _mm512_mask_sub_ps(r, _mm512_cmp_ps_mask(y, _mm512_setzero_ps(), _CMP_LT_OQ), _mm512_setzero_ps(), r);
+}
+
+__attribute__((target("avx512f")))
+inline void FmDemodulateAVX512(const CF32* input, const CF32& previous, F32* output, const U64& size, const F32& gain) {
+    if (size == 0) {
+        return;
+    }
+    FmDemodulateScalar(input, previous, output, 1, gain);
+
+    const F32* in = reinterpret_cast<const F32*>(input);
+    const __m512 g = _mm512_set1_ps(gain);
+    const __m512i even = _mm512_setr_epi32(0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30);
+    const __m512i odd = _mm512_setr_epi32(1, 3, 5, 7, 9, 11, 13, 15, 17, 19, 21, 23, 25, 27, 29, 31);
+
+    U64 i = 1;
+    for (; i + 16 <= size; i += 16) {
+        const __m512 c0 = _mm512_loadu_ps(in + 2 * i);
+        const __m512 c1 = _mm512_loadu_ps(in + 2 * i + 16);
+        const __m512 p0 = _mm512_loadu_ps(in + 2 * i - 2);
+        const __m512 p1 = _mm512_loadu_ps(in + 2 * i + 14);
+
+        const __m512 cr = _mm512_permutex2var_ps(c0, even, c1);
+        const __m512 ci = _mm512_permutex2var_ps(c0, odd, c1);
+        const __m512 pr = _mm512_permutex2var_ps(p0, even, p1);
+        const __m512 pi = _mm512_permutex2var_ps(p0, odd, p1);
+
+        const __m512 re = _mm512_fmadd_ps(pr, cr, _mm512_mul_ps(pi, ci));
+        const __m512 im = _mm512_fmsub_ps(pr, ci, _mm512_mul_ps(pi, cr));
+
+        _mm512_storeu_ps(output + i, _mm512_mul_ps(PolyAtan2AVX512(im, re), g));
+    }
+
+    FmDemodulateScalar(input + i, input[i - 1], output + i, size - i, gain);
+}
+
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+
+#endif  // JST_SIMD_X86
+
+#ifdef JST_SIMD_NEON
+
+inline float32x4_t PolyAtan2NEON(const float32x4_t& y, const float32x4_t& x) {
+    const float32x4_t ax = vabsq_f32(x);
+    const float32x4_t ay = vabsq_f32(y);
+    const float32x4_t a = vdivq_f32(vminq_f32(ax, ay), vmaxq_f32(vmaxq_f32(ax, ay), vdupq_n_f32(Detail::MinNormal)));
+    const float32x4_t s = vmulq_f32(a, a);
+
+    float32x4_t r = vdupq_n_f32(Detail::AtanPoly11);
+    r = vfmaq_f32(vdupq_n_f32(Detail::AtanPoly9), r, s);
+    r = vfmaq_f32(vdupq_n_f32(Detail::AtanPoly7), r, s);
+    r = vfmaq_f32(vdupq_n_f32(Detail::AtanPoly5), r, s);
+    r = vfmaq_f32(vdupq_n_f32(Detail::AtanPoly3), r, s);
+    r = vfmaq_f32(vdupq_n_f32(Detail::AtanPoly1), r, s);
+    r = vmulq_f32(r, a);
+
+    r = vbslq_f32(vcgtq_f32(ay, ax), vsubq_f32(vdupq_n_f32(Detail::HalfPi), r), r);
+    r = vbslq_f32(vcltq_f32(x, vdupq_n_f32(0.0f)), vsubq_f32(vdupq_n_f32(Detail::Pi), r), r);
+    return vbslq_f32(vcltq_f32(y, vdupq_n_f32(0.0f)), vnegq_f32(r), r);
+}
+
+inline void FmDemodulateNEON(const CF32* input, const CF32& previous, F32* output, const U64& size, const F32& gain) {
+    if (size == 0) {
+        return;
+    }
+    FmDemodulateScalar(input, previous, output, 1, gain);
+
+    const F32* in = reinterpret_cast<const F32*>(input);
+    const float32x4_t g = vdupq_n_f32(gain);
+
+    U64 i = 1;
+    for (; i + 4 <= size; i += 4) {
+        const float32x4x2_t c = vld2q_f32(in + 2 * i);
+        const float32x4x2_t p = vld2q_f32(in + 2 * i - 2);
+
+        const float32x4_t re = vfmaq_f32(vmulq_f32(p.val[0], c.val[0]), p.val[1], c.val[1]);
+        const float32x4_t im = vfmsq_f32(vmulq_f32(p.val[0], c.val[1]), p.val[1], c.val[0]);
+
+        vst1q_f32(output + i, vmulq_f32(PolyAtan2NEON(im, re), g));
+    }
+
+    FmDemodulateScalar(input + i, input[i - 1], output + i, size - i, gain);
+}
+
+#endif  // JST_SIMD_NEON
+
+//
+// Gain control.
+//
+// Kernels over interleaved floats where every sample has width lanes, one
+// for real and two for complex samples. PeakPower returns the largest
+// squared magnitude. GainRamp scales sample s by gain + (s + 1) * step, so a
+// gain change is spread over the whole array instead of stepping.
+//
+
+typedef F32 (*PeakPowerKernel)(const F32* input, const U64& size, const U64& width);
+typedef void (*GainRampKernel)(const F32* input, F32* output, const U64& size, const U64& width,
+                               const F32& gain, const F32& step);
+
+inline F32 PeakPowerScalar(const F32* input, const U64& size, const U64& width) {
+    F32 peak = 0.0f;
+    for (U64 i = 0; i + width <= size; i += width) {
+        F32 power = 0.0f;
+        for (U64 w = 0; w < width; w++) {
+            power += input[i + w] * input[i + w];
+        }
+        peak = std::max(peak, power);
+    }
+    return peak;
+}
+
+inline void GainRampScalar(const F32* input, F32* output, const U64& size, const U64& width,
+                           const F32& gain, const F32& step) {
+    for (U64 i = 0; i < size; i++) {
+        output[i] = input[i] * (gain + static_cast<F32>(i / width + 1) * step);
+    }
+}
+
+#ifdef JST_SIMD_X86
+
+__attribute__((target("avx2,fma")))
+inline F32 PeakPowerAVX2(const F32* input, const U64& size, const U64& width) {
+    __m256 peak = _mm256_setzero_ps();
+
+    U64 i = 0;
+    for (; i + 8 <= size; i += 8) {
+        const __m256 x = _mm256_loadu_ps(input + i);
+        __m256 power = _mm256_mul_ps(x, x);
+        if (width == 2) {
+            power = _mm256_add_ps(power, _mm256_permute_ps(power, 0xB1));
+        }
+        peak = _mm256_max_ps(peak, power);
+    }
+
+    alignas(32) F32 lanes[8];
+    _mm256_store_ps(lanes, peak);
+    return std::max(*std::max_element(lanes, lanes + 8), PeakPowerScalar(input + i, size - i, width));
+}
+
+__attribute__((target("avx2,fma")))
+inline void GainRampAVX2(const F32* input, F32* output, const U64& size, const U64& width,
+                         const F32& gain, const F32& step) {
+    const __m256 index = (width == 2) ? _mm256_setr_ps(1, 1, 2, 2, 3, 3, 4, 4) :
+                                        _mm256_setr_ps(1, 2, 3, 4, 5, 6, 7, 8);
+    const __m256 s = _mm256_set1_ps(step);
+
+    U64 i = 0;
+    for (; i + 8 <= size; i += 8) {
+        const __m256 base = _mm256_set1_ps(gain + static_cast<F32>(i / width) * step);
+        const __m256 g = _mm256_fmadd_ps(index, s, base);
+        _mm256_storeu_ps(output + i, _mm256_mul_ps(_mm256_loadu_ps(input + i), g));
+    }
+
+    GainRampScalar(input + i, output + i, size - i, width, gain + static_cast<F32>(i / width) * step, step);
+}
+
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+
+__attribute__((target("avx512f")))
+inline F32 PeakPowerAVX512(const F32* input, const U64& size, const U64& width) {
+    __m512 peak = _mm512_setzero_ps();
+
+    U64 i = 0;
+    for (; i + 16 <= size; i += 16) {
+        const __m512 x = _mm512_loadu_ps(input + i);
+        __m512 power = _mm512_mul_ps(x, x);
+        if (width == 2) {
+            power = _mm512_add_ps(power, _mm512_permute_ps(power, 0xB1));
+        }
+        peak = _mm512_max_ps(peak, power);
+    }
+
+    return std::max(_mm512_reduce_max_ps(peak), PeakPowerScalar(input + i, size - i, width));
+}
+
+__attribute__((target("avx512f")))
+inline void GainRampAVX512(const F32* input, F32* output, const U64& size, const U64& width,
+                           const F32& gain, const F32& step) {
+    const __m512 index = (width == 2) ? _mm512_setr_ps(1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7, 8, 8) :
+                                        _mm512_setr_ps(1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16);
+    const __m512 s = _mm512_set1_ps(step);
+
+    U64 i = 0;
+    for (; i + 16 <= size; i += 16) {
+        const __m512 base = _mm512_set1_ps(gain + static_cast<F32>(i / width) * step);
+        const __m512 g = _mm512_fmadd_ps(index, s, base);
+        _mm512_storeu_ps(output + i, _mm512_mul_ps(_mm512_loadu_ps(input + i), g));
+    }
+
+    GainRampScalar(input + i, output + i, size - i, width, gain + static_cast<F32>(i / width) * step, step);
+}
+
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+
+#endif  // JST_SIMD_X86
+
+#ifdef JST_SIMD_NEON
+
+inline F32 PeakPowerNEON(const F32* input, const U64& size, const U64& width) {
+    float32x4_t peak = vdupq_n_f32(0.0f);
+
+    U64 i = 0;
+    for (; i + 4 <= size; i += 4) {
+        const float32x4_t x = vld1q_f32(input + i);
+        float32x4_t power = vmulq_f32(x, x);
+        if (width == 2) {
+            power = vaddq_f32(power, vrev64q_f32(power));
+        }
+        peak = vmaxq_f32(peak, power);
+    }
+
+    return std::max(vmaxvq_f32(peak), PeakPowerScalar(input + i, size - i, width));
+}
+
+inline void GainRampNEON(const F32* input, F32* output, const U64& size, const U64& width,
+                         const F32& gain, const F32& step) {
+    static const F32 complexIndex[4] = {1, 1, 2, 2};
+    static const F32 realIndex[4] = {1, 2, 3, 4};
+    const float32x4_t index = vld1q_f32((width == 2) ? complexIndex : realIndex);
+
+    U64 i = 0;
+    for (; i + 4 <= size; i += 4) {
+        const float32x4_t base = vdupq_n_f32(gain + static_cast<F32>(i / width) * step);
+        const float32x4_t g = vfmaq_n_f32(base, index, step);
+        vst1q_f32(output + i, vmulq_f32(vld1q_f32(input + i), g));
+    }
+
+    GainRampScalar(input + i, output + i, size - i, width, gain + static_cast<F32>(i / width) * step, step);
+}
+
+#endif  // JST_SIMD_NEON
+
+//
+// Numerically controlled oscillator.
+//
+// Kernels writing amplitude * exp(j * (phase + n * increment)) over
+// contiguous arrays, as interleaved complex samples for width two and as the
+// real part alone for width one. Every lane advances by a complex rotator
+// instead of evaluating sin and cos per sample. The rotators are reseeded
+// from double precision every NcoReseedInterval samples, which keeps the
+// float recursion from drifting in phase or magnitude.
+//
+
+inline constexpr U64 NcoReseedInterval = 1024;
+
+typedef void (*NcoKernel)(F32* output, const U64& size, const U64& width,
+                          const F64& phase, const F64& increment, const F32& amplitude);
+
+inline void NcoScalar(F32* output, const U64& size, const U64& width,
+                      const F64& phase, const F64& increment, const F32& amplitude) {
+    const CF32 rotator(std::cos(increment), std::sin(increment));
+
+    for (U64 c = 0; c < size; c += NcoReseedInterval) {
+        const U64 n = std::min(NcoReseedInterval, size - c);
+        const F64 theta = phase + static_cast<F64>(c) * increment;
+        CF32 p(amplitude * std::cos(theta), amplitude * std::sin(theta));
+
+        for (U64 i = c; i < c + n; i++) {
+            output[i * width] = p.real();
+            if (width == 2) {
+                output[i * width + 1] = p.imag();
+            }
+            p = CF32(p.real() * rotator.real() - p.imag() * rotator.imag(),
+                     p.real() * rotator.imag() + p.imag() * rotator.real());
+        }
+    }
+}
+
+// Seeds lanes samples starting at theta and the rotator advancing all of them
+// by lanes samples.
+inline void NcoSeed(F32* re, F32* im, F32* rotator, const U64& lanes,
+                    const F64& theta, const F64& increment, const F32& amplitude) {
+    for (U64 k = 0; k < lanes; k++) {
+        const F64 x = theta + static_cast<F64>(k) * increment;
+        re[k] = amplitude * static_cast<F32>(std::cos(x));
+        im[k] = amplitude * static_cast<F32>(std::sin(x));
+    }
+    rotator[0] = static_cast<F32>(std::cos(static_cast<F64>(lanes) * increment));
+    rotator[1] = static_cast<F32>(std::sin(static_cast<F64>(lanes) * increment));
+}
+
+#ifdef JST_SIMD_X86
+
+__attribute__((target("avx2,fma")))
+inline void NcoAVX2(F32* output, const U64& size, const U64& width,
+                    const F64& phase, const F64& increment, const F32& amplitude) {
+    alignas(32) F32 seedRe[8];
+    alignas(32) F32 seedIm[8];
+    F32 rotator[2];
+
+    for (U64 c = 0; c < size; c += NcoReseedInterval) {
+        const U64 n = std::min(NcoReseedInterval, size - c);
+        const F64 theta = phase + static_cast<F64>(c) * increment;
+        NcoSeed(seedRe, seedIm, rotator, 8, theta, increment, amplitude);
+
+        __m256 re = _mm256_load_ps(seedRe);
+        __m256 im = _mm256_load_ps(seedIm);
+        const __m256 rr = _mm256_set1_ps(rotator[0]);
+        const __m256 ri = _mm256_set1_ps(rotator[1]);
+
+        U64 i = 0;
+        for (; i + 8 <= n; i += 8) {
+            F32* out = output + (c + i) * width;
+            if (width == 2) {
+                const __m256 lo = _mm256_unpacklo_ps(re, im);
+                const __m256 hi = _mm256_unpackhi_ps(re, im);
+                _mm256_storeu_ps(out, _mm256_permute2f128_ps(lo, hi, 0x20));
+                _mm256_storeu_ps(out + 8, _mm256_permute2f128_ps(lo, hi, 0x31));
+            } else {
+                _mm256_storeu_ps(out, re);
+            }
+
+            const __m256 next = _mm256_fmsub_ps(re, rr, _mm256_mul_ps(im, ri));
+            im = _mm256_fmadd_ps(re, ri, _mm256_mul_ps(im, rr));
+            re = next;
+        }
+
+        if (i < n) {
+            NcoScalar(output + (c + i) * width, n - i, width,
+                      theta + static_cast<F64>(i) * increment, increment, amplitude);
+        }
+    }
+}
+
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+
+__attribute__((target("avx512f")))
+inline void NcoAVX512(F32* output, const U64& size, const U64& width,
+                      const F64& phase, const F64& increment, const F32& amplitude) {
+    alignas(64) F32 seedRe[16];
+    alignas(64) F32 seedIm[16];
+    F32 rotator[2];
+
+    const __m512i lowIndex = _mm512_setr_epi32(0, 16, 1, 17, 2, 18, 3, 19, 4, 20, 5, 21, 6, 22, 7, 23);
+    const __m512i highIndex = _mm512_setr_epi32(8, 24, 9, 25, 10, 26, 11, 27, 12, 28, 13, 29, 14, 30, 15, 31);
+
+    for (U64 c = 0; c < size; c += NcoReseedInterval) {
+        const U64 n = std::min(NcoReseedInterval, size - c);
+        const F64 theta = phase + static_cast<F64>(c) * increment;
+        NcoSeed(seedRe, seedIm, rotator, 16, theta, increment, amplitude);
+
+        __m512 re = _mm512_load_ps(seedRe);
+        __m512 im = _mm512_load_ps(seedIm);
+        const __m512 rr = _mm512_set1_ps(rotator[0]);
+        const __m512 ri = _mm512_set1_ps(rotator[1]);
+
+        U64 i = 0;
+        for (; i + 16 <= n; i += 16) {
+            F32* out = output + (c + i) * width;
+            if (width == 2) {
+                _mm512_storeu_ps(out, _mm512_permutex2var_ps(re, lowIndex, im));
+                _mm512_storeu_ps(out + 16, _mm512_permutex2var_ps(re, highIndex, im));
+            } else {
+                _mm512_storeu_ps(out, re);
+            }
+
+            const __m512 next = _mm512_fmsub_ps(re, rr, _mm512_mul_ps(im, ri));
+            im = _mm512_fmadd_ps(re, ri, _mm512_mul_ps(im, rr));
+            re = next;
+        }
+
+        if (i < n) {
+            NcoScalar(output + (c + i) * width, n - i, width,
+                      theta + static_cast<F64>(i) * increment, increment, amplitude);
+        }
+    }
+}
+
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+
+#endif  // JST_SIMD_X86
+
+#ifdef JST_SIMD_NEON
+
+inline void NcoNEON(F32* output, const U64& size, const U64& width,
+                    const F64& phase, const F64& increment, const F32& amplitude) {
+    F32 seedRe[4];
+    F32 seedIm[4];
+    F32 rotator[2];
+
+    for (U64 c = 0; c < size; c += NcoReseedInterval) {
+        const U64 n = std::min(NcoReseedInterval, size - c);
+        const F64 theta = phase + static_cast<F64>(c) * increment;
+        NcoSeed(seedRe, seedIm, rotator, 4, theta, increment, amplitude);
+
+        float32x4_t re = vld1q_f32(seedRe);
+        float32x4_t im = vld1q_f32(seedIm);
+
+        U64 i = 0;
+        for (; i + 4 <= n; i += 4) {
+            F32* out = output + (c + i) * width;
+            if (width == 2) {
+                vst2q_f32(out, (float32x4x2_t{{re, im}}));
+            } else {
+                vst1q_f32(out, re);
+            }
+
+            const float32x4_t next = vfmsq_n_f32(vmulq_n_f32(re, rotator[0]), im, rotator[1]);
+            im = vfmaq_n_f32(vmulq_n_f32(im, rotator[0]), re, rotator[1]);
+            re = next;
+        }
+
+        if (i < n) {
+            NcoScalar(output + (c + i) * width, n - i, width,
+                      theta + static_cast<F64>(i) * increment, increment, amplitude);
+        }
+    }
+}
+
+#endif  // JST_SIMD_NEON
+
+//
+// Gaussian noise.
+//
+// Kernels writing white Gaussian noise of standard deviation sigma over
+// contiguous arrays, as interleaved complex samples for width two and as the
+// real part alone for width one. Sample n hashes seed and counter + n into
+// two uniforms and turns them into a complex normal with Box-Muller. There's
+// no generator state, so any range of samples can be computed on its own and
+// every lane runs in parallel. The hash and the transform match the CUDA and
+// Metal kernels, with polynomials for the logarithm and the sine and cosine.
+//
+
+namespace Detail {
+
+inline constexpr U32 NoiseHashMultiplier0 = 0x7feb352du;
+inline constexpr U32 NoiseHashMultiplier1 = 0x846ca68bu;
+inline constexpr F32 NoiseUnit = 5.9604644775390625e-8f;
+inline constexpr F32 Sqrt2 = 1.41421356237310f;
+inline constexpr F32 Ln2 = 0.69314718055995f;
+inline constexpr F32 TwoPi = 6.28318530717959f;
+
+inline constexpr F32 LogPoly8 =  7.0376836292e-2f;
+inline constexpr F32 LogPoly7 = -1.1514610310e-1f;
+inline constexpr F32 LogPoly6 =  1.1676998740e-1f;
+inline constexpr F32 LogPoly5 = -1.2420140846e-1f;
+inline constexpr F32 LogPoly4 =  1.4249322787e-1f;
+inline constexpr F32 LogPoly3 = -1.6668057665e-1f;
+inline constexpr F32 LogPoly2 =  2.0000714765e-1f;
+inline constexpr F32 LogPoly1 = -2.4999993993e-1f;
+inline constexpr F32 LogPoly0 =  3.3333331174e-1f;
+
+inline constexpr F32 SinPoly2 = -1.9515295891e-4f;
+inline constexpr F32 SinPoly1 =  8.3321608736e-3f;
+inline constexpr F32 SinPoly0 = -1.6666654611e-1f;
+inline constexpr F32 CosPoly2 =  2.443315711809948e-5f;
+inline constexpr F32 CosPoly1 = -1.388731625493765e-3f;
+inline constexpr F32 CosPoly0 =  4.166664568298827e-2f;
+
+}  // namespace Detail
+
+inline constexpr U32 NoiseHash(U32 x) {
+    x ^= x >> 16;
+    x *= Detail::NoiseHashMultiplier0;
+    x ^= x >> 15;
+    x *= Detail::NoiseHashMultiplier1;
+    x ^= x >> 16;
+    return x;
+}
+
+// Natural logarithm of a positive normal float. The mantissa is folded
+// around one and its logarithm taken from a polynomial.
+inline F32 ApproxLog(const F32& x) {
+    const U32 bits = std::bit_cast<U32>(x);
+    I32 e = static_cast<I32>(bits >> 23) - 127;
+    F32 m = std::bit_cast<F32>((bits & 0x007FFFFFu) | 0x3F800000u);
+    if (m > Detail::Sqrt2) {
+        m *= 0.5f;
+        e += 1;
+    }
+
+    const F32 f = m - 1.0f;
+    const F32 z = f * f;
+
+    F32 p = Detail::LogPoly8;
+    p = p * f + Detail::LogPoly7;
+    p = p * f + Detail::LogPoly6;
+    p = p * f + Detail::LogPoly5;
+    p = p * f + Detail::LogPoly4;
+    p = p * f + Detail::LogPoly3;
+    p = p * f + Detail::LogPoly2;
+    p = p * f + Detail::LogPoly1;
+    p = p * f + Detail::LogPoly0;
+
+    return f + (f * z * p - 0.5f * z) + static_cast<F32>(e) * Detail::Ln2;
+}
+
+// Cosine and sine of 2 * pi * u. The quarter turns are taken out exactly, the
+// polynomials only cover an eighth of a turn on each side of zero.
+inline void ApproxSinCosTurns(const F32& u, F32& c, F32& s) {
+    const I32 q = static_cast<I32>(std::nearbyint(u * 4.0f));
+    const F32 x = (u - static_cast<F32>(q) * 0.25f) * Detail::TwoPi;
+    const F32 z = x * x;
+
+    F32 ps = Detail::SinPoly2;
+    ps = ps * z + Detail::SinPoly1;
+    ps = ps * z + Detail::SinPoly0;
+    F32 pc = Detail::CosPoly2;
+    pc = pc * z + Detail::CosPoly1;
+    pc = pc * z + Detail::CosPoly0;
+
+    const F32 sv = x + x * z * ps;
+    const F32 cv = 1.0f - 0.5f * z + z * z * pc;
+
+    switch (q & 3) {
+        case 0:  c =  cv; s =  sv; break;
+        case 1:  c = -sv; s =  cv; break;
+        case 2:  c = -cv; s = -sv; break;
+        default: c =  sv; s = -cv; break;
+    }
+}
+
+typedef void (*GaussianNoiseKernel)(F32* output, const U64& size, const U64& width,
+                                    const U32& seed, const U32& counter, const F32& sigma);
+
+inline void GaussianNoiseScalar(F32* output, const U64& size, const U64& width,
+                                const U32& seed, const U32& counter, const F32& sigma) {
+    for (U64 i = 0; i < size; i++) {
+        const U32 key = NoiseHash(seed ^ NoiseHash(counter + static_cast<U32>(i)));
+        const F32 u1 = static_cast<F32>((NoiseHash(key) >> 8) + 1) * Detail::NoiseUnit;
+        const F32 u2 = static_cast<F32>(NoiseHash(key + 1) >> 8) * Detail::NoiseUnit;
+        const F32 r = sigma * std::sqrt(-2.0f * ApproxLog(u1));
+
+        F32 c, s;
+        ApproxSinCosTurns(u2, c, s);
+
+        output[i * width] = r * c;
+        if (width == 2) {
+            output[i * width + 1] = r * s;
+        }
+    }
+}
+
+#ifdef JST_SIMD_X86
+
+__attribute__((target("avx2,fma")))
+inline __m256i NoiseHashAVX2(__m256i x) {
+    x = _mm256_xor_si256(x, _mm256_srli_epi32(x, 16));
+    x = _mm256_mullo_epi32(x, _mm256_set1_epi32(static_cast<I32>(Detail::NoiseHashMultiplier0)));
+    x = _mm256_xor_si256(x, _mm256_srli_epi32(x, 15));
+    x = _mm256_mullo_epi32(x, _mm256_set1_epi32(static_cast<I32>(Detail::NoiseHashMultiplier1)));
+    return _mm256_xor_si256(x, _mm256_srli_epi32(x, 16));
+}
+
+__attribute__((target("avx2,fma")))
+inline __m256 LogAVX2(const __m256& x) {
+    const __m256i bits = _mm256_castps_si256(x);
+    __m256i e = _mm256_sub_epi32(_mm256_srli_epi32(bits, 23), _mm256_set1_epi32(127));
+    __m256 m = _mm256_castsi256_ps(_mm256_or_si256(_mm256_and_si256(bits, _mm256_set1_epi32(0x007FFFFF)),
+                                                   _mm256_set1_epi32(0x3F800000)));
+
+    const __m256 fold = _mm256_cmp_ps(m, _mm256_set1_ps(Detail::Sqrt2), _CMP_GT_OQ);
+    m = _mm256_blendv_ps(m, _mm256_mul_ps(m, _mm256_set1_ps(0.5f)), fold);
+    e = _mm256_sub_epi32(e, _mm256_castps_si256(fold));
+
+    const __m256 f = _mm256_sub_ps(m, _mm256_set1_ps(1.0f));
+    const __m256 z = _mm256_mul_ps(f, f);
+
+    __m256 p = _mm256_set1_ps(Detail::LogPoly8);
+    p = _mm256_fmadd_ps(p, f, _mm256_set1_ps(Detail::LogPoly7));
+    p = _mm256_fmadd_ps(p, f, _mm256_set1_ps(Detail::LogPoly6));
+    p = _mm256_fmadd_ps(p, f, _mm256_set1_ps(Detail::LogPoly5));
+    p = _mm256_fmadd_ps(p, f, _mm256_set1_ps(Detail::LogPoly4));
+    p = _mm256_fmadd_ps(p, f, _mm256_set1_ps(Detail::LogPoly3));
+    p = _mm256_fmadd_ps(p, f, _mm256_set1_ps(Detail::LogPoly2));
+    p = _mm256_fmadd_ps(p, f, _mm256_set1_ps(Detail::LogPoly1));
+    p = _mm256_fmadd_ps(p, f, _mm256_set1_ps(Detail::LogPoly0));
+
+    const __m256 y = _mm256_fnmadd_ps(_mm256_set1_ps(0.5f), z, _mm256_mul_ps(_mm256_mul_ps(f, z), p));
+    return _mm256_fmadd_ps(_mm256_cvtepi32_ps(e), _mm256_set1_ps(Detail::Ln2), _mm256_add_ps(f, y));
+}
+
+__attribute__((target("avx2,fma")))
+inline void SinCosTurnsAVX2(const __m256& u, __m256& c, __m256& s) {
+    const __m256i q = _mm256_cvtps_epi32(_mm256_mul_ps(u, _mm256_set1_ps(4.0f)));
+    const __m256 x = _mm256_mul_ps(_mm256_fnmadd_ps(_mm256_cvtepi32_ps(q), _mm256_set1_ps(0.25f), u),
+                                   _mm256_set1_ps(Detail::TwoPi));
+    const __m256 z = _mm256_mul_ps(x, x);
+
+    __m256 ps = _mm256_set1_ps(Detail::SinPoly2);
+    ps = _mm256_fmadd_ps(ps, z, _mm256_set1_ps(Detail::SinPoly1));
+    ps = _mm256_fmadd_ps(ps, z, _mm256_set1_ps(Detail::SinPoly0));
+    __m256 pc = _mm256_set1_ps(Detail::CosPoly2);
+    pc = _mm256_fmadd_ps(pc, z, _mm256_set1_ps(Detail::CosPoly1));
+    pc = _mm256_fmadd_ps(pc, z, _mm256_set1_ps(Detail::CosPoly0));
+
+    const __m256 sv = _mm256_fmadd_ps(_mm256_mul_ps(x, z), ps, x);
+    const __m256 cv = _mm256_fmadd_ps(_mm256_mul_ps(z, z), pc, _mm256_fnmadd_ps(_mm256_set1_ps(0.5f), z, _mm256_set1_ps(1.0f)));
+
+    // Odd quarter turns swap the two, the sign bits follow from the quadrant.
+    const __m256 swap = _mm256_castsi256_ps(_mm256_cmpeq_epi32(_mm256_and_si256(q, _mm256_set1_epi32(1)), _mm256_set1_epi32(1)));
+    const __m256 cosSign = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_and_si256(_mm256_add_epi32(q, _mm256_set1_epi32(1)), _mm256_set1_epi32(2)), 30));
+    const __m256 sinSign = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_and_si256(q, _mm256_set1_epi32(2)), 30));
+
+    c = _mm256_xor_ps(_mm256_blendv_ps(cv, sv, swap), cosSign);
+    s = _mm256_xor_ps(_mm256_blendv_ps(sv, cv, swap), sinSign);
+}
+
+__attribute__((target("avx2,fma")))
+inline void GaussianNoiseAVX2(F32* output, const U64& size, const U64& width,
+                              const U32& seed, const U32& counter, const F32& sigma) {
+    const __m256i lane = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+    const __m256i s = _mm256_set1_epi32(static_cast<I32>(seed));
+    const __m256i one = _mm256_set1_epi32(1);
+    const __m256 unit = _mm256_set1_ps(Detail::NoiseUnit);
+    const __m256 scale = _mm256_set1_ps(-2.0f);
+    const __m256 k = _mm256_set1_ps(sigma);
+
+    U64 i = 0;
+    for (; i + 8 <= size; i += 8) {
+        const __m256i n = _mm256_add_epi32(_mm256_set1_epi32(static_cast<I32>(counter + static_cast<U32>(i))), lane);
+        const __m256i key = NoiseHashAVX2(_mm256_xor_si256(s, NoiseHashAVX2(n)));
+        const __m256i a = _mm256_srli_epi32(NoiseHashAVX2(key), 8);
+        const __m256i b = _mm256_srli_epi32(NoiseHashAVX2(_mm256_add_epi32(key, one)), 8);
+
+        const __m256 u1 = _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_add_epi32(a, one)), unit);
+        const __m256 u2 = _mm256_mul_ps(_mm256_cvtepi32_ps(b), unit);
+        const __m256 r = _mm256_mul_ps(k, _mm256_sqrt_ps(_mm256_mul_ps(scale, LogAVX2(u1))));
+
+        __m256 c, sn;
+        SinCosTurnsAVX2(u2, c, sn);
+        const __m256 re = _mm256_mul_ps(r, c);
+
+        F32* out = output + i * width;
+        if (width == 2) {
+            const __m256 im = _mm256_mul_ps(r, sn);
+            const __m256 lo = _mm256_unpacklo_ps(re, im);
+            const __m256 hi = _mm256_unpackhi_ps(re, im);
+            _mm256_storeu_ps(out, _mm256_permute2f128_ps(lo, hi, 0x20));
+            _mm256_storeu_ps(out + 8, _mm256_permute2f128_ps(lo, hi, 0x31));
+        } else {
+            _mm256_storeu_ps(out, re);
+        }
+    }
+
+    GaussianNoiseScalar(output + i * width, size - i, width, seed, counter + static_cast<U32>(i), sigma);
+}
+
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+
+__attribute__((target("avx512f")))
+inline __m512i NoiseHashAVX512(__m512i x) {
+    x = _mm512_xor_si512(x, _mm512_srli_epi32(x, 16));
+    x = _mm512_mullo_epi32(x, _mm512_set1_epi32(static_cast<I32>(Detail::NoiseHashMultiplier0)));
+    x = _mm512_xor_si512(x, _mm512_srli_epi32(x, 15));
+    x = _mm512_mullo_epi32(x, _mm512_set1_epi32(static_cast<I32>(Detail::NoiseHashMultiplier1)));
+    return _mm512_xor_si512(x, _mm512_srli_epi32(x, 16));
+}
+
+__attribute__((target("avx512f")))
+inline __m512 LogAVX512(const __m512& x) {
+    const __m512i bits = _mm512_castps_si512(x);
+    __m512i e = _mm512_sub_epi32(_mm512_srli_epi32(bits, 23), _mm512_set1_epi32(127));
+    __m512 m = _mm512_castsi512_ps(_mm512_or_si512(_mm512_and_si512(bits, _mm512_set1_epi32(0x007FFFFF)),
+                                                   _mm512_set1_epi32(0x3F800000)));
+
+    const __mmask16 fold = _mm512_cmp_ps_mask(m, _mm512_set1_ps(Detail::Sqrt2), _CMP_GT_OQ);
+    m = _mm512_mask_mul_ps(m, fold, m, _mm512_set1_ps(0.5f));
+    e = _mm512_mask_add_epi32(e, fold, e, _mm512_set1_epi32(1));
+
+    const __m512 f = _mm512_sub_ps(m, _mm512_set1_ps(1.0f));
+    const __m512 z = _mm512_mul_ps(f, f);
+
+    __m512 p = _mm512_set1_ps(Detail::LogPoly8);
+    p = _mm512_fmadd_ps(p, f, _mm512_set1_ps(Detail::LogPoly7));
+    p = _mm512_fmadd_ps(p, f, _mm512_set1_ps(Detail::LogPoly6));
+    p = _mm512_fmadd_ps(p, f, _mm512_set1_ps(Detail::LogPoly5));
+    p = _mm512_fmadd_ps(p, f, _mm512_set1_ps(Detail::LogPoly4));
+    p = _mm512_fmadd_ps(p, f, _mm512_set1_ps(Detail::LogPoly3));
+    p = _mm512_fmadd_ps(p, f, _mm512_set1_ps(Detail::LogPoly2));
+    p = _mm512_fmadd_ps(p, f, _mm512_set1_ps(Detail::LogPoly1));
+    p = _mm512_fmadd_ps(p, f, _mm512_set1_ps(Detail::LogPoly0));
+
+    const __m512 y = _mm512_fnmadd_ps(_mm512_set1_ps(0.5f), z, _mm512_mul_ps(_mm512_mul_ps(f, z), p));
+    return _mm512_fmadd_ps(_mm512_cvtepi32_ps(e), _mm512_set1_ps(Detail::Ln2), _mm512_add_ps(f, y));
+}
+
+__attribute__((target("avx512f")))
+inline void SinCosTurnsAVX512(const __m512& u, __m512& c, __m512& s) {
+    const __m512i q = _mm512_cvtps_epi32(_mm512_mul_ps(u, _mm512_set1_ps(4.0f)));
+    const __m512 x = _mm512_mul_ps(_mm512_fnmadd_ps(_mm512_cvtepi32_ps(q), _mm512_set1_ps(0.25f), u),
+                                   _mm512_set1_ps(Detail::TwoPi));
+    const __m512 z = _mm512_mul_ps(x, x);
+
+    __m512 ps = _mm512_set1_ps(Detail::SinPoly2);
+    ps = _mm512_fmadd_ps(ps, z, _mm512_set1_ps(Detail::SinPoly1));
+    ps = _mm512_fmadd_ps(ps, z, _mm512_set1_ps(Detail::SinPoly0));
+    __m512 pc = _mm512_set1_ps(Detail::CosPoly2);
+    pc = _mm512_fmadd_ps(pc, z, _mm512_set1_ps(Detail::CosPoly1));
+    pc = _mm512_fmadd_ps(pc, z, _mm512_set1_ps(Detail::CosPoly0));
+
+    const __m512 sv = _mm512_fmadd_ps(_mm512_mul_ps(x, z), ps, x);
+    const __m512 cv = _mm512_fmadd_ps(_mm512_mul_ps(z, z), pc, _mm512_fnmadd_ps(_mm512_set1_ps(0.5f), z, _mm512_set1_ps(1.0f)));
+
+    const __mmask16 swap = _mm512_test_epi32_mask(q, _mm512_set1_epi32(1));
+    const __m512i cosSign = _mm512_slli_epi32(_mm512_and_si512(_mm512_add_epi32(q, _mm512_set1_epi32(1)), _mm512_set1_epi32(2)), 30);
+    const __m512i sinSign = _mm512_slli_epi32(_mm512_and_si512(q, _mm512_set1_epi32(2)), 30);
+
+    c = _mm512_castsi512_ps(_mm512_xor_si512(_mm512_castps_si512(_mm512_mask_blend_ps(swap, cv, sv)), cosSign));
+    s = _mm512_castsi512_ps(_mm512_xor_si512(_mm512_castps_si512(_mm512_mask_blend_ps(swap, sv, cv)), sinSign));
+}
+
+__attribute__((target("avx512f")))
+inline void GaussianNoiseAVX512(F32* output, const U64& size, const U64& width,
+                                const U32& seed, const U32& counter, const F32& sigma) {
+    const __m512i lane = _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+    const __m512i s = _mm512_set1_epi32(static_cast<I32>(seed));
+    const __m512i one = _mm512_set1_epi32(1);
+    const __m512 unit = _mm512_set1_ps(Detail::NoiseUnit);
+    const __m512 scale = _mm512_set1_ps(-2.0f);
+    const __m512 k = _mm512_set1_ps(sigma);
+
+    const __m512i lowIndex = _mm512_setr_epi32(0, 16, 1, 17, 2, 18, 3, 19, 4, 20, 5, 21, 6, 22, 7, 23);
+    const __m512i highIndex = _mm512_setr_epi32(8, 24, 9, 25, 10, 26, 11, 27, 12, 28, 13, 29, 14, 30, 15, 31);
+
+    U64 i = 0;
+    for (; i + 16 <= size; i += 16) {
+        const __m512i n = _mm512_add_epi32(_mm512_set1_epi32(static_cast<I32>(counter + static_cast<U32>(i))), lane);
+        const __m512i key = NoiseHashAVX512(_mm512_xor_si512(s, NoiseHashAVX512(n)));
+        const __m512i a = _mm512_srli_epi32(NoiseHashAVX512(key), 8);
+        const __m512i b = _mm512_srli_epi32(NoiseHashAVX512(_mm512_add_epi32(key, one)), 8);
+
+        const __m512 u1 = _mm512_mul_ps(_mm512_cvtepi32_ps(_mm512_add_epi32(a, one)), unit);
+        const __m512 u2 = _mm512_mul_ps(_mm512_cvtepi32_ps(b), unit);
+        const __m512 r = _mm512_mul_ps(k, _mm512_sqrt_ps(_mm512_mul_ps(scale, LogAVX512(u1))));
+
+        __m512 c, sn;
+        SinCosTurnsAVX512(u2, c, sn);
+        const __m512 re = _mm512_mul_ps(r, c);
+
+        F32* out = output + i * width;
+        if (width == 2) {
+            const __m512 im = _mm512_mul_ps(r, sn);
+            _mm512_storeu_ps(out, _mm512_permutex2var_ps(re, lowIndex, im));
+            _mm512_storeu_ps(out + 16, _mm512_permutex2var_ps(re, highIndex, im));
+        } else {
+            _mm512_storeu_ps(out, re);
+        }
+    }
+
+    GaussianNoiseScalar(output + i * width, size - i, width, seed, counter + static_cast<U32>(i), sigma);
+}
+
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+
+#endif  // JST_SIMD_X86
+
+#ifdef JST_SIMD_NEON
+
+inline uint32x4_t NoiseHashNEON(uint32x4_t x) {
+    x = veorq_u32(x, vshrq_n_u32(x, 16));
+    x = vmulq_n_u32(x, Detail::NoiseHashMultiplier0);
+    x = veorq_u32(x, vshrq_n_u32(x, 15));
+    x = vmulq_n_u32(x, Detail::NoiseHashMultiplier1);
+    return veorq_u32(x, vshrq_n_u32(x, 16));
+}
+
+inline float32x4_t LogNEON(const float32x4_t& x) {
+    const uint32x4_t bits = vreinterpretq_u32_f32(x);
+    int32x4_t e = vsubq_s32(vreinterpretq_s32_u32(vshrq_n_u32(bits, 23)), vdupq_n_s32(127));
+    float32x4_t m = vreinterpretq_f32_u32(vorrq_u32(vandq_u32(bits, vdupq_n_u32(0x007FFFFFu)), vdupq_n_u32(0x3F800000u)));
+
+    const uint32x4_t fold = vcgtq_f32(m, vdupq_n_f32(Detail::Sqrt2));
+    m = vbslq_f32(fold, vmulq_n_f32(m, 0.5f), m);
+    e = vsubq_s32(e, vreinterpretq_s32_u32(fold));
+
+    const float32x4_t f = vsubq_f32(m, vdupq_n_f32(1.0f));
+    const float32x4_t z = vmulq_f32(f, f);
+
+    float32x4_t p = vdupq_n_f32(Detail::LogPoly8);
+    p = vfmaq_f32(vdupq_n_f32(Detail::LogPoly7), p, f);
+    p = vfmaq_f32(vdupq_n_f32(Detail::LogPoly6), p, f);
+    p = vfmaq_f32(vdupq_n_f32(Detail::LogPoly5), p, f);
+    p = vfmaq_f32(vdupq_n_f32(Detail::LogPoly4), p, f);
+    p = vfmaq_f32(vdupq_n_f32(Detail::LogPoly3), p, f);
+    p = vfmaq_f32(vdupq_n_f32(Detail::LogPoly2), p, f);
+    p = vfmaq_f32(vdupq_n_f32(Detail::LogPoly1), p, f);
+    p = vfmaq_f32(vdupq_n_f32(Detail::LogPoly0), p, f);
+
+    const float32x4_t y = vfmsq_n_f32(vmulq_f32(vmulq_f32(f, z), p), z, 0.5f);
+    return vfmaq_n_f32(vaddq_f32(f, y), vcvtq_f32_s32(e), Detail::Ln2);
+}
+
+inline void SinCosTurnsNEON(const float32x4_t& u, float32x4_t& c, float32x4_t& s) {
+    const int32x4_t q = vcvtnq_s32_f32(vmulq_n_f32(u, 4.0f));
+    const float32x4_t x = vmulq_n_f32(vfmsq_n_f32(u, vcvtq_f32_s32(q), 0.25f), Detail::TwoPi);
+    const float32x4_t z = vmulq_f32(x, x);
+
+    float32x4_t ps = vdupq_n_f32(Detail::SinPoly2);
+    ps = vfmaq_f32(vdupq_n_f32(Detail::SinPoly1), ps, z);
+    ps = vfmaq_f32(vdupq_n_f32(Detail::SinPoly0), ps, z);
+    float32x4_t pc = vdupq_n_f32(Detail::CosPoly2);
+    pc = vfmaq_f32(vdupq_n_f32(Detail::CosPoly1), pc, z);
+    pc = vfmaq_f32(vdupq_n_f32(Detail::CosPoly0), pc, z);
+
+    const float32x4_t sv = vfmaq_f32(x, vmulq_f32(x, z), ps);
+    const float32x4_t cv = vfmaq_f32(vfmsq_n_f32(vdupq_n_f32(1.0f), z, 0.5f), vmulq_f32(z, z), pc);
+
+    const uint32x4_t swap = vtstq_s32(q, vdupq_n_s32(1));
+    const uint32x4_t cosSign = vshlq_n_u32(vandq_u32(vreinterpretq_u32_s32(vaddq_s32(q, vdupq_n_s32(1))), vdupq_n_u32(2)), 30);
+    const uint32x4_t sinSign = vshlq_n_u32(vandq_u32(vreinterpretq_u32_s32(q), vdupq_n_u32(2)), 30);
+
+    c = vreinterpretq_f32_u32(veorq_u32(vreinterpretq_u32_f32(vbslq_f32(swap, sv, cv)), cosSign));
+    s = vreinterpretq_f32_u32(veorq_u32(vreinterpretq_u32_f32(vbslq_f32(swap, cv, sv)), sinSign));
+}
+
+inline void GaussianNoiseNEON(F32* output, const U64& size, const U64& width,
+                              const U32& seed, const U32& counter, const F32& sigma) {
+    const uint32x4_t lane = {0, 1, 2, 3};
+    const uint32x4_t s = vdupq_n_u32(seed);
+    const uint32x4_t one = vdupq_n_u32(1);
+
+    U64 i = 0;
+    for (; i + 4 <= size; i += 4) {
+        const uint32x4_t n = vaddq_u32(vdupq_n_u32(counter + static_cast<U32>(i)), lane);
+        const uint32x4_t key = NoiseHashNEON(veorq_u32(s, NoiseHashNEON(n)));
+        const uint32x4_t a = vshrq_n_u32(NoiseHashNEON(key), 8);
+        const uint32x4_t b = vshrq_n_u32(NoiseHashNEON(vaddq_u32(key, one)), 8);
+
+        const float32x4_t u1 = vmulq_n_f32(vcvtq_f32_u32(vaddq_u32(a, one)), Detail::NoiseUnit);
+        const float32x4_t u2 = vmulq_n_f32(vcvtq_f32_u32(b), Detail::NoiseUnit);
+        const float32x4_t r = vmulq_n_f32(vsqrtq_f32(vmulq_n_f32(LogNEON(u1), -2.0f)), sigma);
+
+        float32x4_t c, sn;
+        SinCosTurnsNEON(u2, c, sn);
+        const float32x4_t re = vmulq_f32(r, c);
+
+        F32* out = output + i * width;
+        if (width == 2) {
+            vst2q_f32(out, (float32x4x2_t{{re, vmulq_f32(r, sn)}}));
+        } else {
+            vst1q_f32(out, re);
+        }
+    }
+
+    GaussianNoiseScalar(output + i * width, size - i, width, seed, counter + static_cast<U32>(i), sigma);
+}
+
+#endif  // JST_SIMD_NEON
+
+//
+// Sample conversion.
+//
+// Kernels converting interleaved sample formats to floats over contiguous
+// arrays, each value multiplied by scale. Unsigned bytes are offset binary
+// and are centered on 127.5 first. Packed 12-bit complex samples take three
+// bytes each, the real part in the low 12 bits of the little-endian 24-bit
+// word and the imaginary part in the high ones, and write two floats per
+// sample. RealPart keeps the real part of complex floats. The quantizers go
+// the other way and AbsMax finds the largest magnitude to scale them by.
+//
+
+inline constexpr F32 UnsignedByteMidpoint = 127.5f;
+
+typedef void (*RealPartKernel)(const CF32* input, F32* output, const U64& size);
+typedef void (*ConvertI8Kernel)(const I8* input, F32* output, const U64& size, const F32& scale);
+typedef void (*ConvertU8Kernel)(const U8* input, F32* output, const U64& size, const F32& scale);
+typedef void (*ConvertI16Kernel)(const I16* input, F32* output, const U64& size, const F32& scale);
+typedef void (*ConvertI12Kernel)(const U8* input, F32* output, const U64& size, const F32& scale);
+typedef void (*QuantizeI16Kernel)(const F32* input, I16* output, const U64& size, const F32& scale);
+typedef void (*QuantizeI8Kernel)(const F32* input, I8* output, const U64& size, const F32& scale);
+typedef F32 (*AbsMaxKernel)(const F32* input, const U64& size);
+
+inline void RealPartScalar(const CF32* input, F32* output, const U64& size) {
+    for (U64 i = 0; i < size; i++) {
+        output[i] = input[i].real();
+    }
+}
+
+inline void ConvertI8Scalar(const I8* input, F32* output, const U64& size, const F32& scale) {
+    for (U64 i = 0; i < size; i++) {
+        output[i] = static_cast<F32>(input[i]) * scale;
+    }
+}
+
+inline void ConvertU8Scalar(const U8* input, F32* output, const U64& size, const F32& scale) {
+    for (U64 i = 0; i < size; i++) {
+        output[i] = (static_cast<F32>(input[i]) - UnsignedByteMidpoint) * scale;
+    }
+}
+
+inline void ConvertI16Scalar(const I16* input, F32* output, const U64& size, const F32& scale) {
+    for (U64 i = 0; i < size; i++) {
+        output[i] = static_cast<F32>(input[i]) * scale;
+    }
+}
+
+inline void ConvertI12Scalar(const U8* input, F32* output, const U64& size, const F32& scale) {
+    for (U64 i = 0; i < size; i++) {
+        const U32 word = static_cast<U32>(input[3 * i]) |
+                         (static_cast<U32>(input[3 * i + 1]) << 8) |
+                         (static_cast<U32>(input[3 * i + 2]) << 16);
+        const I32 real = static_cast<I32>(word << 20) >> 20;
+        const I32 imag = static_cast<I32>(word << 8) >> 20;
+        output[2 * i] = static_cast<F32>(real) * scale;
+        output[2 * i + 1] = static_cast<F32>(imag) * scale;
+    }
+}
+
+// Scaled samples are rounded to nearest and saturated. The comparisons are
+// written like the vector min and max, so NaNs end up at the lower bound.
+inline void QuantizeI16Scalar(const F32* input, I16* output, const U64& size, const F32& scale) {
+    for (U64 i = 0; i < size; i++) {
+        F32 x = input[i] * scale;
+        x = (x > -32768.0f) ? x : -32768.0f;
+        x = (x < 32767.0f) ? x : 32767.0f;
+        output[i] = static_cast<I16>(std::nearbyint(x));
+    }
+}
+
+inline void QuantizeI8Scalar(const F32* input, I8* output, const U64& size, const F32& scale) {
+    for (U64 i = 0; i < size; i++) {
+        F32 x = input[i] * scale;
+        x = (x > -128.0f) ? x : -128.0f;
+        x = (x < 127.0f) ? x : 127.0f;
+        output[i] = static_cast<I8>(std::nearbyint(x));
+    }
+}
+
+inline F32 AbsMaxScalar(const F32* input, const U64& size) {
+    F32 peak = 0.0f;
+    for (U64 i = 0; i < size; i++) {
+        const F32 x = std::abs(input[i]);
+        peak = (x > peak) ? x : peak;
+    }
+    return peak;
+}
+
+#ifdef JST_SIMD_X86
+
+__attribute__((target("avx2,fma")))
+inline void RealPartAVX2(const CF32* input, F32* output, const U64& size) {
+    const F32* in = reinterpret_cast<const F32*>(input);
+
+    U64 i = 0;
+    for (; i + 8 <= size; i += 8) {
+        const __m256 a = _mm256_loadu_ps(in + 2 * i);
+        const __m256 b = _mm256_loadu_ps(in + 2 * i + 8);
+        const __m256 real = _mm256_shuffle_ps(a, b, 0x88);
+        _mm256_storeu_ps(output + i, _mm256_castpd_ps(_mm256_permute4x64_pd(_mm256_castps_pd(real), 0xD8)));
+    }
+
+    RealPartScalar(input + i, output + i, size - i);
+}
+
+__attribute__((target("avx2,fma")))
+inline void ConvertI8AVX2(const I8* input, F32* output, const U64& size, const F32& scale) {
+    const __m256 s = _mm256_set1_ps(scale);
+
+    U64 i = 0;
+    for (; i + 16 <= size; i += 16) {
+        const __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i));
+        const __m256 lo = _mm256_cvtepi32_ps(_mm256_cvtepi8_epi32(x));
+        const __m256 hi = _mm256_cvtepi32_ps(_mm256_cvtepi8_epi32(_mm_srli_si128(x, 8)));
+        _mm256_storeu_ps(output + i, _mm256_mul_ps(lo, s));
+        _mm256_storeu_ps(output + i + 8, _mm256_mul_ps(hi, s));
+    }
+
+    ConvertI8Scalar(input + i, output + i, size - i, scale);
+}
+
+__attribute__((target("avx2,fma")))
+inline void ConvertU8AVX2(const U8* input, F32* output, const U64& size, const F32& scale) {
+    const __m256 s = _mm256_set1_ps(scale);
+    const __m256 offset = _mm256_set1_ps(-UnsignedByteMidpoint * scale);
+
+    U64 i = 0;
+    for (; i + 16 <= size; i += 16) {
+        const __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i));
+        const __m256 lo = _mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(x));
+        const __m256 hi = _mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(_mm_srli_si128(x, 8)));
+        _mm256_storeu_ps(output + i, _mm256_fmadd_ps(lo, s, offset));
+        _mm256_storeu_ps(output + i + 8, _mm256_fmadd_ps(hi, s, offset));
+    }
+
+    ConvertU8Scalar(input + i, output + i, size - i, scale);
+}
+
+__attribute__((target("avx2,fma")))
+inline void ConvertI16AVX2(const I16* input, F32* output, const U64& size, const F32& scale) {
+    const __m256 s = _mm256_set1_ps(scale);
+
+    U64 i = 0;
+    for (; i + 16 <= size; i += 16) {
+        const __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(input + i));
+        const __m256 lo = _mm256_cvtepi32_ps(_mm256_cvtepi16_epi32(_mm256_castsi256_si128(x)));
+        const __m256 hi = _mm256_cvtepi32_ps(_mm256_cvtepi16_epi32(_mm256_extracti128_si256(x, 1)));
+        _mm256_storeu_ps(output + i, _mm256_mul_ps(lo, s));
+        _mm256_storeu_ps(output + i + 8, _mm256_mul_ps(hi, s));
+    }
+
+    ConvertI16Scalar(input + i, output + i, size - i, scale);
+}
+
+__attribute__((target("avx2,fma")))
+inline void ConvertI12AVX2(const U8* input, F32* output, const U64& size, const F32& scale) {
+    // Both halves hold the same 16 bytes. The lower one unpacks samples 0 and
+    // 1, the upper one samples 2 and 3, with every part moved to the top of
+    // its lane. Reals still carry the low nibble of the imaginary part above
+    // them and are shifted out before the sign-extending shift.
+    const __m256i shuffle = _mm256_setr_epi8(-1, -1, 0, 1, -1, -1, 1, 2, -1, -1, 3, 4, -1, -1, 4, 5,
+                                             -1, -1, 6, 7, -1, -1, 7, 8, -1, -1, 9, 10, -1, -1, 10, 11);
+    const __m256i align = _mm256_setr_epi32(4, 0, 4, 0, 4, 0, 4, 0);
+    const __m256 s = _mm256_set1_ps(scale);
+
+    U64 i = 0;
+    for (; 3 * i + 16 <= 3 * size; i += 4) {
+        const __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + 3 * i));
+        const __m256i bytes = _mm256_shuffle_epi8(_mm256_broadcastsi128_si256(x), shuffle);
+        const __m256i parts = _mm256_srai_epi32(_mm256_sllv_epi32(bytes, align), 20);
+        _mm256_storeu_ps(output + 2 * i, _mm256_mul_ps(_mm256_cvtepi32_ps(parts), s));
+    }
+
+    ConvertI12Scalar(input + 3 * i, output + 2 * i, size - i, scale);
+}
+
+__attribute__((target("avx2,fma")))
+inline void QuantizeI16AVX2(const F32* input, I16* output, const U64& size, const F32& scale) {
+    const __m256 s = _mm256_set1_ps(scale);
+    const __m256 lo = _mm256_set1_ps(-32768.0f);
+    const __m256 hi = _mm256_set1_ps(32767.0f);
+
+    U64 i = 0;
+    for (; i + 16 <= size; i += 16) {
+        const __m256 a = _mm256_min_ps(_mm256_max_ps(_mm256_mul_ps(_mm256_loadu_ps(input + i), s), lo), hi);
+        const __m256 b = _mm256_min_ps(_mm256_max_ps(_mm256_mul_ps(_mm256_loadu_ps(input + i + 8), s), lo), hi);
+
+        // Packing works within 128-bit lanes, the permute puts them back in order.
+        const __m256i packed = _mm256_packs_epi32(_mm256_cvtps_epi32(a), _mm256_cvtps_epi32(b));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(output + i), _mm256_permute4x64_epi64(packed, 0xD8));
+    }
+
+    QuantizeI16Scalar(input + i, output + i, size - i, scale);
+}
+
+__attribute__((target("avx2,fma")))
+inline void QuantizeI8AVX2(const F32* input, I8* output, const U64& size, const F32& scale) {
+    const __m256 s = _mm256_set1_ps(scale);
+    const __m256 lo = _mm256_set1_ps(-128.0f);
+    const __m256 hi = _mm256_set1_ps(127.0f);
+    const __m256i order = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
+
+    U64 i = 0;
+    for (; i + 32 <= size; i += 32) {
+        __m256i q[4];
+        for (U64 j = 0; j < 4; j++) {
+            const __m256 x = _mm256_mul_ps(_mm256_loadu_ps(input + i + j * 8), s);
+            q[j] = _mm256_cvtps_epi32(_mm256_min_ps(_mm256_max_ps(x, lo), hi));
+        }
+
+        const __m256i ab = _mm256_packs_epi32(q[0], q[1]);
+        const __m256i cd = _mm256_packs_epi32(q[2], q[3]);
+
+        // Packing works within 128-bit lanes, the permute puts the words back in order.
+        const __m256i packed = _mm256_packs_epi16(ab, cd);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(output + i), _mm256_permutevar8x32_epi32(packed, order));
+    }
+
+    QuantizeI8Scalar(input + i, output + i, size - i, scale);
+}
+
+__attribute__((target("avx2,fma")))
+inline F32 AbsMaxAVX2(const F32* input, const U64& size) {
+    const __m256 mask = _mm256_castsi256_ps(_mm256_set1_epi32(0x7FFFFFFF));
+    __m256 acc0 = _mm256_setzero_ps();
+    __m256 acc1 = _mm256_setzero_ps();
+
+    U64 i = 0;
+    for (; i + 16 <= size; i += 16) {
+        acc0 = _mm256_max_ps(acc0, _mm256_and_ps(_mm256_loadu_ps(input + i), mask));
+        acc1 = _mm256_max_ps(acc1, _mm256_and_ps(_mm256_loadu_ps(input + i + 8), mask));
+    }
+
+    alignas(32) F32 lanes[8];
+    _mm256_store_ps(lanes, _mm256_max_ps(acc0, acc1));
+
+    return std::max(*std::max_element(lanes, lanes + 8), AbsMaxScalar(input + i, size - i));
+}
+
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+
+__attribute__((target("avx512f")))
+inline void RealPartAVX512(const CF32* input, F32* output, const U64& size) {
+    const F32* in = reinterpret_cast<const F32*>(input);
+    const __m512i index = _mm512_setr_epi32(0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30);
+
+    U64 i = 0;
+    for (; i + 16 <= size; i += 16) {
+        const __m512 a = _mm512_loadu_ps(in + 2 * i);
+        const __m512 b = _mm512_loadu_ps(in + 2 * i + 16);
+        _mm512_storeu_ps(output + i, _mm512_permutex2var_ps(a, index, b));
+    }
+
+    RealPartScalar(input + i, output + i, size - i);
+}
+
+__attribute__((target("avx512f")))
+inline void ConvertI8AVX512(const I8* input, F32* output, const U64& size, const F32& scale) {
+    const __m512 s = _mm512_set1_ps(scale);
+
+    U64 i = 0;
+    for (; i + 16 <= size; i += 16) {
+        const __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i));
+        _mm512_storeu_ps(output + i, _mm512_mul_ps(_mm512_cvtepi32_ps(_mm512_cvtepi8_epi32(x)), s));
+    }
+
+    ConvertI8Scalar(input + i, output + i, size - i, scale);
+}
+
+__attribute__((target("avx512f")))
+inline void ConvertU8AVX512(const U8* input, F32* output, const U64& size, const F32& scale) {
+    const __m512 s = _mm512_set1_ps(scale);
+    const __m512 offset = _mm512_set1_ps(-UnsignedByteMidpoint * scale);
+
+    U64 i = 0;
+    for (; i + 16 <= size; i += 16) {
+        const __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i));
+        _mm512_storeu_ps(output + i, _mm512_fmadd_ps(_mm512_cvtepi32_ps(_mm512_cvtepu8_epi32(x)), s, offset));
+    }
+
+    ConvertU8Scalar(input + i, output + i, size - i, scale);
+}
+
+__attribute__((target("avx512f")))
+inline void ConvertI16AVX512(const I16* input, F32* output, const U64& size, const F32& scale) {
+    const __m512 s = _mm512_set1_ps(scale);
+
+    U64 i = 0;
+    for (; i + 16 <= size; i += 16) {
+        const __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(input + i));
+        _mm512_storeu_ps(output + i, _mm512_mul_ps(_mm512_cvtepi32_ps(_mm512_cvtepi16_epi32(x)), s));
+    }
+
+    ConvertI16Scalar(input + i, output + i, size - i, scale);
+}
+
+// Byte shuffles need AVX-512BW, so this level runs the AVX2 kernel.
+__attribute__((target("avx512f")))
+inline void ConvertI12AVX512(const U8* input, F32* output, const U64& size, const F32& scale) {
+    ConvertI12AVX2(input, output, size, scale);
+}
+
+__attribute__((target("avx512f")))
+inline void QuantizeI16AVX512(const F32* input, I16* output, const U64& size, const F32& scale) {
+    const __m512 s = _mm512_set1_ps(scale);
+    const __m512 lo = _mm512_set1_ps(-32768.0f);
+    const __m512 hi = _mm512_set1_ps(32767.0f);
+
+    U64 i = 0;
+    for (; i + 16 <= size; i += 16) {
+        const __m512 x = _mm512_min_ps(_mm512_max_ps(_mm512_mul_ps(_mm512_loadu_ps(input + i), s), lo), hi);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(output + i), _mm512_cvtsepi32_epi16(_mm512_cvtps_epi32(x)));
+    }
+
+    QuantizeI16Scalar(input + i, output + i, size - i, scale);
+}
+
+__attribute__((target("avx512f")))
+inline void QuantizeI8AVX512(const F32* input, I8* output, const U64& size, const F32& scale) {
+    const __m512 s = _mm512_set1_ps(scale);
+    const __m512 lo = _mm512_set1_ps(-128.0f);
+    const __m512 hi = _mm512_set1_ps(127.0f);
+
+    U64 i = 0;
+    for (; i + 16 <= size; i += 16) {
+        const __m512 x = _mm512_min_ps(_mm512_max_ps(_mm512_mul_ps(_mm512_loadu_ps(input + i), s), lo), hi);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(output + i), _mm512_cvtsepi32_epi8(_mm512_cvtps_epi32(x)));
+    }
+
+    QuantizeI8Scalar(input + i, output + i, size - i, scale);
+}
+
+__attribute__((target("avx512f")))
+inline F32 AbsMaxAVX512(const F32* input, const U64& size) {
+    __m512 acc = _mm512_setzero_ps();
+
+    U64 i = 0;
+    for (; i + 16 <= size; i += 16) {
+        acc = _mm512_max_ps(acc, _mm512_abs_ps(_mm512_loadu_ps(input + i)));
+    }
+
+    return std::max(_mm512_reduce_max_ps(acc), AbsMaxScalar(input + i, size - i));
+}
+
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+
+#endif  // JST_SIMD_X86
+
+#ifdef JST_SIMD_NEON
+
+inline void RealPartNEON(const CF32* input, F32* output, const U64& size) {
+    const F32* in = reinterpret_cast<const F32*>(input);
+
+    U64 i = 0;
+    for (; i + 4 <= size; i += 4) {
+        vst1q_f32(output + i, vld2q_f32(in + 2 * i).val[0]);
+    }
+
+    RealPartScalar(input + i, output + i, size - i);
+}
+
+inline void ConvertI8NEON(const I8* input, F32* output, const U64& size, const F32& scale) {
+    U64 i = 0;
+    for (; i + 8 <= size; i += 8) {
+        const int16x8_t x = vmovl_s8(vld1_s8(input + i));
+        vst1q_f32(output + i, vmulq_n_f32(vcvtq_f32_s32(vmovl_s16(vget_low_s16(x))), scale));
+        vst1q_f32(output + i + 4, vmulq_n_f32(vcvtq_f32_s32(vmovl_s16(vget_high_s16(x))), scale));
+    }
+
+    ConvertI8Scalar(input + i, output + i, size - i, scale);
+}
+
+inline void ConvertU8NEON(const U8* input, F32* output, const U64& size, const F32& scale) {
+    const float32x4_t offset = vdupq_n_f32(-UnsignedByteMidpoint * scale);
+
+    U64 i = 0;
+    for (; i + 8 <= size; i += 8) {
+        const uint16x8_t x = vmovl_u8(vld1_u8(input + i));
+        vst1q_f32(output + i, vfmaq_n_f32(offset, vcvtq_f32_u32(vmovl_u16(vget_low_u16(x))), scale));
+        vst1q_f32(output + i + 4, vfmaq_n_f32(offset, vcvtq_f32_u32(vmovl_u16(vget_high_u16(x))), scale));
+    }
+
+    ConvertU8Scalar(input + i, output + i, size - i, scale);
+}
+
+inline void ConvertI16NEON(const I16* input, F32* output, const U64& size, const F32& scale) {
+    U64 i = 0;
+    for (; i + 8 <= size; i += 8) {
+        const int16x8_t x = vld1q_s16(input + i);
+        vst1q_f32(output + i, vmulq_n_f32(vcvtq_f32_s32(vmovl_s16(vget_low_s16(x))), scale));
+        vst1q_f32(output + i + 4, vmulq_n_f32(vcvtq_f32_s32(vmovl_s16(vget_high_s16(x))), scale));
+    }
+
+    ConvertI16Scalar(input + i, output + i, size - i, scale);
+}
+
+inline void ConvertI12NEON(const U8* input, F32* output, const U64& size, const F32& scale) {
+    U64 i = 0;
+    for (; i + 8 <= size; i += 8) {
+        // Loads the first, second and third byte of 8 samples.
+        const uint8x8x3_t bytes = vld3_u8(input + 3 * i);
+        const uint16x8_t b0 = vmovl_u8(bytes.val[0]);
+        const uint16x8_t b1 = vmovl_u8(bytes.val[1]);
+        const uint16x8_t b2 = vmovl_u8(bytes.val[2]);
+
+        // Parts are assembled in the top 12 bits and sign-extended down.
+        const int16x8_t real = vshrq_n_s16(vreinterpretq_s16_u16(vorrq_u16(vshlq_n_u16(b0, 4), vshlq_n_u16(b1, 12))), 4);
+        const int16x8_t imag = vshrq_n_s16(vreinterpretq_s16_u16(vorrq_u16(vandq_u16(b1, vdupq_n_u16(0xF0)), vshlq_n_u16(b2, 8))), 4);
+
+        float32x4x2_t low;
+        low.val[0] = vmulq_n_f32(vcvtq_f32_s32(vmovl_s16(vget_low_s16(real))), scale);
+        low.val[1] = vmulq_n_f32(vcvtq_f32_s32(vmovl_s16(vget_low_s16(imag))), scale);
+        vst2q_f32(output + 2 * i, low);
+
+        float32x4x2_t high;
+        high.val[0] = vmulq_n_f32(vcvtq_f32_s32(vmovl_s16(vget_high_s16(real))), scale);
+        high.val[1] = vmulq_n_f32(vcvtq_f32_s32(vmovl_s16(vget_high_s16(imag))), scale);
+        vst2q_f32(output + 2 * i + 8, high);
+    }
+
+    ConvertI12Scalar(input + 3 * i, output + 2 * i, size - i, scale);
+}
+
+inline void QuantizeI16NEON(const F32* input, I16* output, const U64& size, const F32& scale) {
+    const float32x4_t lo = vdupq_n_f32(-32768.0f);
+    const float32x4_t hi = vdupq_n_f32(32767.0f);
+
+    U64 i = 0;
+    for (; i + 8 <= size; i += 8) {
+        const float32x4_t a = vminq_f32(vmaxq_f32(vmulq_n_f32(vld1q_f32(input + i), scale), lo), hi);
+        const float32x4_t b = vminq_f32(vmaxq_f32(vmulq_n_f32(vld1q_f32(input + i + 4), scale), lo), hi);
+        vst1q_s16(output + i, vcombine_s16(vqmovn_s32(vcvtnq_s32_f32(a)), vqmovn_s32(vcvtnq_s32_f32(b))));
+    }
+
+    QuantizeI16Scalar(input + i, output + i, size - i, scale);
+}
+
+inline void QuantizeI8NEON(const F32* input, I8* output, const U64& size, const F32& scale) {
+    const float32x4_t lo = vdupq_n_f32(-128.0f);
+    const float32x4_t hi = vdupq_n_f32(127.0f);
+
+    U64 i = 0;
+    for (; i + 16 <= size; i += 16) {
+        int16x4_t q[4];
+        for (U64 j = 0; j < 4; j++) {
+            const float32x4_t x = vmulq_n_f32(vld1q_f32(input + i + j * 4), scale);
+            q[j] = vqmovn_s32(vcvtnq_s32_f32(vminq_f32(vmaxq_f32(x, lo), hi)));
+        }
+
+        const int16x8_t a = vcombine_s16(q[0], q[1]);
+        const int16x8_t b = vcombine_s16(q[2], q[3]);
+        vst1q_s8(output + i, vcombine_s8(vqmovn_s16(a), vqmovn_s16(b)));
+    }
+
+    QuantizeI8Scalar(input + i, output + i, size - i, scale);
+}
+
+inline F32 AbsMaxNEON(const F32* input, const U64& size) {
+    float32x4_t acc0 = vdupq_n_f32(0.0f);
+    float32x4_t acc1 = vdupq_n_f32(0.0f);
+
+    U64 i = 0;
+    for (; i + 8 <= size; i += 8) {
+        acc0 = vmaxq_f32(acc0, vabsq_f32(vld1q_f32(input + i)));
+        acc1 = vmaxq_f32(acc1, vabsq_f32(vld1q_f32(input + i + 4)));
+    }
+
+    return std::max(vmaxvq_f32(vmaxq_f32(acc0, acc1)), AbsMaxScalar(input + i, size - i));
+}
+
+#endif  // JST_SIMD_NEON
+
+//
+// Bin reduction.
+//
+// Kernels splitting a contiguous array in bins of width samples and adding
+// the sum, minimum or maximum of every bin to the matching output element.
+// Wide bins are reduced with vector accumulators and single sample bins are
+// a vector addition.
+//
+
+typedef void (*BinReduceKernel)(const F32* input, F32* output, const U64& bins, const U64& width);
+
+namespace Detail {
+
+enum class BinOp { Sum, Min, Max };
+
+template<BinOp Op>
+inline F32 BinCombine(const F32& a, const F32& b) {
+    if constexpr (Op == BinOp::Sum) {
+        return a + b;
+    } else if constexpr (Op == BinOp::Min) {
+        return std::min(a, b);
+    } else {
+        return std::max(a, b);
+    }
+}
+
+template<BinOp Op>
+inline void BinReduce(const F32* input, F32* output, const U64& bins, const U64& width) {
+    for (U64 i = 0; i < bins; i++) {
+        const F32* x = input + i * width;
+        F32 acc = x[0];
+        for (U64 k = 1; k < width; k++) {
+            acc = BinCombine<Op>(acc, x[k]);
+        }
+        output[i] += acc;
+    }
+}
+
+}  // namespace Detail
+
+inline void BinSumScalar(const F32* input, F32* output, const U64& bins, const U64& width) {
+    Detail::BinReduce<Detail::BinOp::Sum>(input, output, bins, width);
+}
+
+inline void BinMinScalar(const F32* input, F32* output, const U64& bins, const U64& width) {
+    Detail::BinReduce<Detail::BinOp::Min>(input, output, bins, width);
+}
+
+inline void BinMaxScalar(const F32* input, F32* output, const U64& bins, const U64& width) {
+    Detail::BinReduce<Detail::BinOp::Max>(input, output, bins, width);
+}
+
+#ifdef JST_SIMD_X86
+
+template<Detail::BinOp Op>
+__attribute__((target("avx2,fma")))
+inline __m256 BinCombineAVX2(const __m256& a, const __m256& b) {
+    if constexpr (Op == Detail::BinOp::Sum) {
+        return _mm256_add_ps(a, b);
+    } else if constexpr (Op == Detail::BinOp::Min) {
+        return _mm256_min_ps(a, b);
+    } else {
+        return _mm256_max_ps(a, b);
+    }
+}
+
+template<Detail::BinOp Op>
+__attribute__((target("avx2,fma")))
+inline void BinReduceAVX2(const F32* input, F32* output, const U64& bins, const U64& width) {
+    if (width == 1) {
+        U64 i = 0;
+        for (; i + 8 <= bins; i += 8) {
+            _mm256_storeu_ps(output + i, _mm256_add_ps(_mm256_loadu_ps(output + i), _mm256_loadu_ps(input + i)));
+        }
+        Detail::BinReduce<Op>(input + i, output + i, bins - i, width);
+        return;
+    }
+
+    if (width < 8) {
+        Detail::BinReduce<Op>(input, output, bins, width);
+        return;
+    }
+
+    for (U64 i = 0; i < bins; i++) {
+        const F32* x = input + i * width;
+
+        __m256 acc = _mm256_loadu_ps(x);
+        U64 k = 8;
+        for (; k + 8 <= width; k += 8) {
+            acc = BinCombineAVX2<Op>(acc, _mm256_loadu_ps(x + k));
+        }
+
+        __m128 half = _mm256_castps256_ps128(BinCombineAVX2<Op>(acc, _mm256_permute2f128_ps(acc, acc, 0x01)));
+        alignas(16) F32 lanes[4];
+        _mm_store_ps(lanes, half);
+
+        F32 result = Detail::BinCombine<Op>(Detail::BinCombine<Op>(lanes[0], lanes[1]),
+                                            Detail::BinCombine<Op>(lanes[2], lanes[3]));
+        for (; k < width; k++) {
+            result = Detail::BinCombine<Op>(result, x[k]);
+        }
+        output[i] += result;
+    }
+}
+
+__attribute__((target("avx2,fma")))
+inline void BinSumAVX2(const F32* input, F32* output, const U64& bins, const U64& width) {
+    BinReduceAVX2<Detail::BinOp::Sum>(input, output, bins, width);
+}
+
+__attribute__((target("avx2,fma")))
+inline void BinMinAVX2(const F32* input, F32* output, const U64& bins, const U64& width) {
+    BinReduceAVX2<Detail::BinOp::Min>(input, output, bins, width);
+}
+
+__attribute__((target("avx2,fma")))
+inline void BinMaxAVX2(const F32* input, F32* output, const U64& bins, const U64& width) {
+    BinReduceAVX2<Detail::BinOp::Max>(input, output, bins, width);
+}
+
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+
+template<Detail::BinOp Op>
+__attribute__((target("avx512f")))
+inline void BinReduceAVX512(const F32* input, F32* output, const U64& bins, const U64& width) {
+    if (width == 1) {
+        U64 i = 0;
+        for (; i + 16 <= bins; i += 16) {
+            _mm512_storeu_ps(output + i, _mm512_add_ps(_mm512_loadu_ps(output + i), _mm512_loadu_ps(input + i)));
+        }
+        Detail::BinReduce<Op>(input + i, output + i, bins - i, width);
+        return;
+    }
+
+    if (width < 16) {
+        Detail::BinReduce<Op>(input, output, bins, width);
+        return;
+    }
+
+    for (U64 i = 0; i < bins; i++) {
+        const F32* x = input + i * width;
+
+        __m512 acc = _mm512_loadu_ps(x);
+        U64 k = 16;
+        F32 result;
+
+        if constexpr (Op == Detail::BinOp::Sum) {
+            for (; k + 16 <= width; k += 16) {
+                acc = _mm512_add_ps(acc, _mm512_loadu_ps(x + k));
+            }
+            result = _mm512_reduce_add_ps(acc);
+        } else if constexpr (Op == Detail::BinOp::Min) {
+            for (; k + 16 <= width; k += 16) {
+                acc = _mm512_min_ps(acc, _mm512_loadu_ps(x + k));
+            }
+            result = _mm512_reduce_min_ps(acc);
+        } else {
+            for (; k + 16 <= width; k += 16) {
+                acc = _mm512_max_ps(acc, _mm512_loadu_ps(x + k));
+            }
+            result = _mm512_reduce_max_ps(acc);
+        }
+
+        for (; k < width; k++) {
+            result = Detail::BinCombine<Op>(result, x[k]);
+        }
+        output[i] += result;
+    }
+}
+
+__attribute__((target("avx512f")))
+inline void BinSumAVX512(const F32* input, F32* output, const U64& bins, const U64& width) {
+    BinReduceAVX512<Detail::BinOp::Sum>(input, output, bins, width);
+}
+
+__attribute__((target("avx512f")))
+inline void BinMinAVX512(const F32* input, F32* output, const U64& bins, const U64& width) {
+    BinReduceAVX512<Detail::BinOp::Min>(input, output, bins, width);
+}
+
+__attribute__((target("avx512f")))
+inline void BinMaxAVX512(const F32* input, F32* output, const U64& bins, const U64& width) {
+    BinReduceAVX512<Detail::BinOp::Max>(input, output, bins, width);
+}
+
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+
+#endif  // JST_SIMD_X86
+
+#ifdef JST_SIMD_NEON
+
+template<Detail::BinOp Op>
+inline void BinReduceNEON(const F32* input, F32* output, const U64& bins, const U64& width) {
+    if (width == 1) {
+        U64 i = 0;
+        for (; i + 4 <= bins; i += 4) {
+            vst1q_f32(output + i, vaddq_f32(vld1q_f32(output + i), vld1q_f32(input + i)));
+        }
+        Detail::BinReduce<Op>(input + i, output + i, bins - i, width);
+        return;
+    }
+
+    if (width < 4) {
+        Detail::BinReduce<Op>(input, output, bins, width);
+        return;
+    }
+
+    for (U64 i = 0; i < bins; i++) {
+        const F32* x = input + i * width;
+
+        float32x4_t acc = vld1q_f32(x);
+        U64 k = 4;
+        F32 result;
+
+        if constexpr (Op == Detail::BinOp::Sum) {
+            for (; k + 4 <= width; k += 4) {
+                acc = vaddq_f32(acc, vld1q_f32(x + k));
+            }
+            result = vaddvq_f32(acc);
+        } else if constexpr (Op == Detail::BinOp::Min) {
+            for (; k + 4 <= width; k += 4) {
+                acc = vminq_f32(acc, vld1q_f32(x + k));
+            }
+            result = vminvq_f32(acc);
+        } else {
+            for (; k + 4 <= width; k += 4) {
+                acc = vmaxq_f32(acc, vld1q_f32(x + k));
+            }
+            result = vmaxvq_f32(acc);
+        }
+
+        for (; k < width; k++) {
+            result = Detail::BinCombine<Op>(result, x[k]);
+        }
+        output[i] += result;
+    }
+}
+
+inline void BinSumNEON(const F32* input, F32* output, const U64& bins, const U64& width) {
+    BinReduceNEON<Detail::BinOp::Sum>(input, output, bins, width);
+}
+
+inline void BinMinNEON(const F32* input, F32* output, const U64& bins, const U64& width) {
+    BinReduceNEON<Detail::BinOp::Min>(input, output, bins, width);
+}
+
+inline void BinMaxNEON(const F32* input, F32* output, const U64& bins, const U64& width) {
+    BinReduceNEON<Detail::BinOp::Max>(input, output, bins, width);
+}
+
+#endif  // JST_SIMD_NEON
+
+//
+// Copy and decay.
+//
+// Kernels copying a contiguous state array to the output and then scaling
+// the state in place, so a decaying accumulator is published and aged in a
+// single pass over memory.
+//
+
+typedef void (*CopyDecayKernel)(F32* state, F32* output, const U64& size, const F32& factor);
+
+inline void CopyDecayScalar(F32* state, F32* output, const U64& size, const F32& factor) {
+    for (U64 i = 0; i < size; i++) {
+        const F32 x = state[i];
+        output[i] = x;
+        state[i] = x * factor;
+    }
+}
+
+#ifdef JST_SIMD_X86
+
+__attribute__((target("avx2,fma")))
+inline void CopyDecayAVX2(F32* state, F32* output, const U64& size, const F32& factor) {
+    const __m256 k = _mm256_set1_ps(factor);
+
+    U64 i = 0;
+    for (; i + 8 <= size; i += 8) {
+        const __m256 x = _mm256_loadu_ps(state + i);
+        _mm256_storeu_ps(output + i, x);
+        _mm256_storeu_ps(state + i, _mm256_mul_ps(x, k));
+    }
+
+    CopyDecayScalar(state + i, output + i, size - i, factor);
+}
+
+__attribute__((target("avx512f")))
+inline void CopyDecayAVX512(F32* state, F32* output, const U64& size, const F32& factor) {
+    const __m512 k = _mm512_set1_ps(factor);
+
+    U64 i = 0;
+    for (; i + 16 <= size; i += 16) {
+        const __m512 x = _mm512_loadu_ps(state + i);
+        _mm512_storeu_ps(output + i, x);
+        _mm512_storeu_ps(state + i, _mm512_mul_ps(x, k));
+    }
+
+    CopyDecayScalar(state + i, output + i, size - i, factor);
+}
+
+#endif  // JST_SIMD_X86
+
+#ifdef JST_SIMD_NEON
+
+inline void CopyDecayNEON(F32* state, F32* output, const U64& size, const F32& factor) {
+    const float32x4_t k = vdupq_n_f32(factor);
+
+    U64 i = 0;
+    for (; i + 4 <= size; i += 4) {
+        const float32x4_t x = vld1q_f32(state + i);
+        vst1q_f32(output + i, x);
+        vst1q_f32(state + i, vmulq_f32(x, k));
+    }
+
+    CopyDecayScalar(state + i, output + i, size - i, factor);
+}
+
+#endif  // JST_SIMD_NEON
+
+#ifdef JST_SIMD_WASM
+
+inline void CopyDecayWASM(F32* state, F32* output, const U64& size, const F32& factor) {
+    const v128_t k = wasm_f32x4_splat(factor);
+
+    U64 i = 0;
+    for (; i + 4 <= size; i += 4) {
+        const v128_t x = wasm_v128_load(state + i);
+        wasm_v128_store(output + i, x);
+        wasm_v128_store(state + i, wasm_f32x4_mul(x, k));
+    }
+
+    CopyDecayScalar(state + i, output + i, size - i, factor);
+}
+
+#endif  // JST_SIMD_WASM
+
+//
+// Real addition.
+//
+// Kernels computing c = a + b over contiguous arrays. Complex arrays are
+// added as interleaved scalars. The output may alias one of the inputs.
+//
+
+typedef void (*RealAddKernel)(const F32* a, const F32* b, F32* c, const U64& size);
+
+inline void RealAddScalar(const F32* a, const F32* b, F32* c, const U64& size) {
+    for (U64 i = 0; i < size; i++) {
+        c[i] = a[i] + b[i];
+    }
+}
+
+#ifdef JST_SIMD_X86
+
+__attribute__((target("avx2,fma")))
+inline void RealAddAVX2(const F32* a, const F32* b, F32* c, const U64& size) {
+    U64 i = 0;
+    for (; i + 8 <= size; i += 8) {
+        _mm256_storeu_ps(c + i, _mm256_add_ps(_mm256_loadu_ps(a + i), _mm256_loadu_ps(b + i)));
+    }
+
+    RealAddScalar(a + i, b + i, c + i, size - i);
+}
+
+__attribute__((target("avx512f")))
+inline void RealAddAVX512(const F32* a, const F32* b, F32* c, const U64& size) {
+    U64 i = 0;
+    for (; i + 16 <= size; i += 16) {
+        _mm512_storeu_ps(c + i, _mm512_add_ps(_mm512_loadu_ps(a + i), _mm512_loadu_ps(b + i)));
+    }
+
+    RealAddScalar(a + i, b + i, c + i, size - i);
+}
+
+#endif  // JST_SIMD_X86
+
+#ifdef JST_SIMD_NEON
+
+inline void RealAddNEON(const F32* a, const F32* b, F32* c, const U64& size) {
+    U64 i = 0;
+    for (; i + 4 <= size; i += 4) {
+        vst1q_f32(c + i, vaddq_f32(vld1q_f32(a + i), vld1q_f32(b + i)));
+    }
+
+    RealAddScalar(a + i, b + i, c + i, size - i);
+}
+
+#endif  // JST_SIMD_NEON
+
+#ifdef JST_SIMD_WASM
+
+inline void RealAddWASM(const F32* a, const F32* b, F32* c, const U64& size) {
+    U64 i = 0;
+    for (; i + 4 <= size; i += 4) {
+        wasm_v128_store(c + i, wasm_f32x4_add(wasm_v128_load(a + i), wasm_v128_load(b + i)));
+    }
+
+    RealAddScalar(a + i, b + i, c + i, size - i);
+}
+
+#endif  // JST_SIMD_WASM
+
+//
+// Real multiply-accumulate.
+//
+// Kernels computing c += a * b over contiguous arrays. Complex arrays scaled
+// by real weights take the weights duplicated for both parts, like the FIR
+// dot products.
+//
+
+typedef void (*RealMultiplyAddKernel)(const F32* a, const F32* b, F32* c, const U64& size);
+
+inline void RealMultiplyAddScalar(const F32* a, const F32* b, F32* c, const U64& size) {
+    for (U64 i = 0; i < size; i++) {
+        c[i] += a[i] * b[i];
+    }
+}
+
+#ifdef JST_SIMD_X86
+
+__attribute__((target("avx2,fma")))
+inline void RealMultiplyAddAVX2(const F32* a, const F32* b, F32* c, const U64& size) {
+    U64 i = 0;
+    for (; i + 8 <= size; i += 8) {
+        _mm256_storeu_ps(c + i, _mm256_fmadd_ps(_mm256_loadu_ps(a + i), _mm256_loadu_ps(b + i), _mm256_loadu_ps(c + i)));
+    }
+
+    RealMultiplyAddScalar(a + i, b + i, c + i, size - i);
+}
+
+__attribute__((target("avx512f")))
+inline void RealMultiplyAddAVX512(const F32* a, const F32* b, F32* c, const U64& size) {
+    U64 i = 0;
+    for (; i + 16 <= size; i += 16) {
+        _mm512_storeu_ps(c + i, _mm512_fmadd_ps(_mm512_loadu_ps(a + i), _mm512_loadu_ps(b + i), _mm512_loadu_ps(c + i)));
+    }
+
+    RealMultiplyAddScalar(a + i, b + i, c + i, size - i);
+}
+
+#endif  // JST_SIMD_X86
+
+#ifdef JST_SIMD_NEON
+
+inline void RealMultiplyAddNEON(const F32* a, const F32* b, F32* c, const U64& size) {
+    U64 i = 0;
+    for (; i + 4 <= size; i += 4) {
+        vst1q_f32(c + i, vfmaq_f32(vld1q_f32(c + i), vld1q_f32(a + i), vld1q_f32(b + i)));
+    }
+
+    RealMultiplyAddScalar(a + i, b + i, c + i, size - i);
+}
+
+#endif  // JST_SIMD_NEON
+
+#ifdef JST_SIMD_WASM
+
+inline void RealMultiplyAddWASM(const F32* a, const F32* b, F32* c, const U64& size) {
+    U64 i = 0;
+    for (; i + 4 <= size; i += 4) {
+        const v128_t product = wasm_f32x4_mul(wasm_v128_load(a + i), wasm_v128_load(b + i));
+        wasm_v128_store(c + i, wasm_f32x4_add(wasm_v128_load(c + i), product));
+    }
+
+    RealMultiplyAddScalar(a + i, b + i, c + i, size - i);
+}
+
+#endif  // JST_SIMD_WASM
+
+//
+// Kernels returning the sum of 10^(x / 10) over a contiguous array of
+// decibels, the integrated linear power of a span of a spectrum. The power is
+// rebuilt as 2^I * 2^F with a polynomial for the fraction, accurate to a few
+// parts per million. Inputs are clamped to +/- 300 dB to stay normal.
+//
+
+namespace Detail {
+
+inline constexpr F32 OctavesPerDecibel = 0.3321928094887362f;
+inline constexpr F32 DecibelsLimit = 300.0f;
+inline constexpr F32 Exp2Poly4 = 0.013670309f;
+inline constexpr F32 Exp2Poly3 = 0.051744998f;
+inline constexpr F32 Exp2Poly2 = 0.241604357f;
+inline constexpr F32 Exp2Poly1 = 0.692972922f;
+inline constexpr F32 Exp2Poly0 = 1.000003493f;
+
+}  // namespace Detail
+
+inline F32 ApproxDecibelsToPower(const F32& decibels) {
+    const F32 X = std::clamp(decibels, -Detail::DecibelsLimit, Detail::DecibelsLimit) * Detail::OctavesPerDecibel;
+    const F32 I = std::floor(X);
+    const F32 F = X - I;
+
+    F32 Y = Detail::Exp2Poly4;
+    Y = Y * F + Detail::Exp2Poly3;
+    Y = Y * F + Detail::Exp2Poly2;
+    Y = Y * F + Detail::Exp2Poly1;
+    Y = Y * F + Detail::Exp2Poly0;
+
+    return Y * std::bit_cast<F32>(static_cast<U32>(static_cast<I32>(I) + 127) << 23);
+}
+
+typedef F32 (*DecibelsPowerSumKernel)(const F32* input, const U64& size);
+
+inline F32 DecibelsPowerSumScalar(const F32* input, const U64& size) {
+    F32 sum = 0.0f;
+    for (U64 i = 0; i < size; i++) {
+        sum += ApproxDecibelsToPower(input[i]);
+    }
+    return sum;
+}
+
+#ifdef JST_SIMD_X86
+
+__attribute__((target("avx2,fma")))
+inline F32 DecibelsPowerSumAVX2(const F32* input, const U64& size) {
+    const __m256 lower = _mm256_set1_ps(-Detail::DecibelsLimit);
+    const __m256 upper = _mm256_set1_ps(Detail::DecibelsLimit);
+    __m256 sum = _mm256_setzero_ps();
+
+    U64 i = 0;
+    for (; i + 8 <= size; i += 8) {
+        const __m256 x = _mm256_min_ps(_mm256_max_ps(_mm256_loadu_ps(input + i), lower), upper);
+        const __m256 X = _mm256_mul_ps(x, _mm256_set1_ps(Detail::OctavesPerDecibel));
+        const __m256 I = _mm256_floor_ps(X);
+        const __m256 F = _mm256_sub_ps(X, I);
+
+        __m256 Y = _mm256_set1_ps(Detail::Exp2Poly4);
+        Y = _mm256_fmadd_ps(Y, F, _mm256_set1_ps(Detail::Exp2Poly3));
+        Y = _mm256_fmadd_ps(Y, F, _mm256_set1_ps(Detail::Exp2Poly2));
+        Y = _mm256_fmadd_ps(Y, F, _mm256_set1_ps(Detail::Exp2Poly1));
+        Y = _mm256_fmadd_ps(Y, F, _mm256_set1_ps(Detail::Exp2Poly0));
+
+        const __m256i E = _mm256_slli_epi32(_mm256_add_epi32(_mm256_cvtps_epi32(I), _mm256_set1_epi32(127)), 23);
+        sum = _mm256_fmadd_ps(Y, _mm256_castsi256_ps(E), sum);
+    }
+
+    alignas(32) F32 lanes[8];
+    _mm256_store_ps(lanes, sum);
+    F32 total = 0.0f;
+    for (U64 l = 0; l < 8; l++) {
+        total += lanes[l];
+    }
+    return total + DecibelsPowerSumScalar(input + i, size - i);
+}
+
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+
+__attribute__((target("avx512f")))
+inline F32 DecibelsPowerSumAVX512(const F32* input, const U64& size) {
+    const __m512 lower = _mm512_set1_ps(-Detail::DecibelsLimit);
+    const __m512 upper = _mm512_set1_ps(Detail::DecibelsLimit);
+    __m512 sum = _mm512_setzero_ps();
+
+    U64 i = 0;
+    for (; i + 16 <= size; i += 16) {
+        const __m512 x = _mm512_min_ps(_mm512_max_ps(_mm512_loadu_ps(input + i), lower), upper);
+        const __m512 X = _mm512_mul_ps(x, _mm512_set1_ps(Detail::OctavesPerDecibel));
+        const __m512 I = _mm512_roundscale_ps(X, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC);
+        const __m512 F = _mm512_sub_ps(X, I);
+
+        __m512 Y = _mm512_set1_ps(Detail::Exp2Poly4);
+        Y = _mm512_fmadd_ps(Y, F, _mm512_set1_ps(Detail::Exp2Poly3));
+        Y = _mm512_fmadd_ps(Y, F, _mm512_set1_ps(Detail::Exp2Poly2));
+        Y = _mm512_fmadd_ps(Y, F, _mm512_set1_ps(Detail::Exp2Poly1));
+        Y = _mm512_fmadd_ps(Y, F, _mm512_set1_ps(Detail::Exp2Poly0));
+
+        const __m512i E = _mm512_slli_epi32(_mm512_add_epi32(_mm512_cvtps_epi32(I), _mm512_set1_epi32(127)), 23);
+        sum = _mm512_fmadd_ps(Y, _mm512_castsi512_ps(E), sum);
+    }
+
+    return _mm512_reduce_add_ps(sum) + DecibelsPowerSumScalar(input + i, size - i);
+}
+
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+
+#endif  // JST_SIMD_X86
+
+#ifdef JST_SIMD_NEON
+
+inline F32 DecibelsPowerSumNEON(const F32* input, const U64& size) {
+    const float32x4_t lower = vdupq_n_f32(-Detail::DecibelsLimit);
+    const float32x4_t upper = vdupq_n_f32(Detail::DecibelsLimit);
+    float32x4_t sum = vdupq_n_f32(0.0f);
+
+    U64 i = 0;
+    for (; i + 4 <= size; i += 4) {
+        const float32x4_t x = vminq_f32(vmaxq_f32(vld1q_f32(input + i), lower), upper);
+        const float32x4_t X = vmulq_f32(x, vdupq_n_f32(Detail::OctavesPerDecibel));
+        const float32x4_t I = vrndmq_f32(X);
+        const float32x4_t F = vsubq_f32(X, I);
+
+        float32x4_t Y = vdupq_n_f32(Detail::Exp2Poly4);
+        Y = vfmaq_f32(vdupq_n_f32(Detail::Exp2Poly3), Y, F);
+        Y = vfmaq_f32(vdupq_n_f32(Detail::Exp2Poly2), Y, F);
+        Y = vfmaq_f32(vdupq_n_f32(Detail::Exp2Poly1), Y, F);
+        Y = vfmaq_f32(vdupq_n_f32(Detail::Exp2Poly0), Y, F);
+
+        const int32x4_t E = vshlq_n_s32(vaddq_s32(vcvtq_s32_f32(I), vdupq_n_s32(127)), 23);
+        sum = vfmaq_f32(sum, Y, vreinterpretq_f32_s32(E));
+    }
+
+    return vaddvq_f32(sum) + DecibelsPowerSumScalar(input + i, size - i);
+}
+
+#endif  // JST_SIMD_NEON
+
+//
+// Dispatchers.
+//
+// Widest variant of each kernel allowed on the host. Shared by every module.
+// Only the kernels on the hot paths of browser sessions have a SIMD128
+// variant, the others fall back to the scalar one there.
+//
+
+#define JST_SIMD_VARIANTS(Name) \
+    {SimdLevel::Scalar, Name##Scalar}, \
+    JST_SIMD_X86_VARIANTS(Name) \
+    JST_SIMD_NEON_VARIANTS(Name)
+
+#ifdef JST_SIMD_X86
+#define JST_SIMD_X86_VARIANTS(Name) {SimdLevel::AVX2, Name##AVX2}, {SimdLevel::AVX512, Name##AVX512},
+#else
+#define JST_SIMD_X86_VARIANTS(Name)
+#endif
+
+#ifdef JST_SIMD_NEON
+#define JST_SIMD_NEON_VARIANTS(Name) {SimdLevel::NEON, Name##NEON},
+#else
+#define JST_SIMD_NEON_VARIANTS(Name)
+#endif
+
+#ifdef JST_SIMD_WASM
+#define JST_SIMD_WASM_VARIANTS(Name) {SimdLevel::WASM, Name##WASM},
+#else
+#define JST_SIMD_WASM_VARIANTS(Name)
+#endif
+
+inline const KernelDispatch<ComplexDecibelsKernel>& ComplexDecibels() {
+    static const KernelDispatch<ComplexDecibelsKernel> dispatch({JST_SIMD_VARIANTS(ComplexDecibels) JST_SIMD_WASM_VARIANTS(ComplexDecibels)});
+    return dispatch;
+}
+
+inline const KernelDispatch<RealDecibelsKernel>& RealDecibels() {
+    static const KernelDispatch<RealDecibelsKernel> dispatch({JST_SIMD_VARIANTS(RealDecibels) JST_SIMD_WASM_VARIANTS(RealDecibels)});
+    return dispatch;
+}
+
+inline const KernelDispatch<ComplexMultiplyKernel>& ComplexMultiply() {
+    static const KernelDispatch<ComplexMultiplyKernel> dispatch({JST_SIMD_VARIANTS(ComplexMultiply) JST_SIMD_WASM_VARIANTS(ComplexMultiply)});
+    return dispatch;
+}
+
+inline const KernelDispatch<ComplexScaleKernel>& ComplexScale() {
+    static const KernelDispatch<ComplexScaleKernel> dispatch({JST_SIMD_VARIANTS(ComplexScale) JST_SIMD_WASM_VARIANTS(ComplexScale)});
+    return dispatch;
+}
+
+inline const KernelDispatch<ComplexSlideKernel>& ComplexSlide() {
+    static const KernelDispatch<ComplexSlideKernel> dispatch({JST_SIMD_VARIANTS(ComplexSlide)});
+    return dispatch;
+}
+
+inline const KernelDispatch<ComplexConjugateMultiplyAddKernel>& ComplexConjugateMultiplyAdd() {
+    static const KernelDispatch<ComplexConjugateMultiplyAddKernel> dispatch({JST_SIMD_VARIANTS(ComplexConjugateMultiplyAdd)});
+    return dispatch;
+}
+
+inline const KernelDispatch<RealFirDotKernel>& RealFirDot() {
+    static const KernelDispatch<RealFirDotKernel> dispatch({JST_SIMD_VARIANTS(RealFirDot) JST_SIMD_WASM_VARIANTS(RealFirDot)});
+    return dispatch;
+}
+
+inline const KernelDispatch<ComplexFirDotKernel>& ComplexFirDot() {
+    static const KernelDispatch<ComplexFirDotKernel> dispatch({JST_SIMD_VARIANTS(ComplexFirDot) JST_SIMD_WASM_VARIANTS(ComplexFirDot)});
+    return dispatch;
+}
+
+inline const KernelDispatch<FmDemodulateKernel>& FmDemodulate() {
+    static const KernelDispatch<FmDemodulateKernel> dispatch({JST_SIMD_VARIANTS(FmDemodulate)});
+    return dispatch;
+}
+
+inline const KernelDispatch<PeakPowerKernel>& PeakPower() {
+    static const KernelDispatch<PeakPowerKernel> dispatch({JST_SIMD_VARIANTS(PeakPower)});
+    return dispatch;
+}
+
+inline const KernelDispatch<GainRampKernel>& GainRamp() {
+    static const KernelDispatch<GainRampKernel> dispatch({JST_SIMD_VARIANTS(GainRamp)});
+    return dispatch;
+}
+
+inline const KernelDispatch<NcoKernel>& Nco() {
+    static const KernelDispatch<NcoKernel> dispatch({JST_SIMD_VARIANTS(Nco)});
+    return dispatch;
+}
+
+inline const KernelDispatch<GaussianNoiseKernel>& GaussianNoise() {
+    static const KernelDispatch<GaussianNoiseKernel> dispatch({JST_SIMD_VARIANTS(GaussianNoise)});
+    return dispatch;
+}
+
+inline const KernelDispatch<RealPartKernel>& RealPart() {
+    static const KernelDispatch<RealPartKernel> dispatch({JST_SIMD_VARIANTS(RealPart)});
+    return dispatch;
+}
+
+inline const KernelDispatch<ConvertI8Kernel>& ConvertI8() {
+    static const KernelDispatch<ConvertI8Kernel> dispatch({JST_SIMD_VARIANTS(ConvertI8)});
+    return dispatch;
+}
+
+inline const KernelDispatch<ConvertU8Kernel>& ConvertU8() {
+    static const KernelDispatch<ConvertU8Kernel> dispatch({JST_SIMD_VARIANTS(ConvertU8)});
+    return dispatch;
+}
+
+inline const KernelDispatch<ConvertI16Kernel>& ConvertI16() {
+    static const KernelDispatch<ConvertI16Kernel> dispatch({JST_SIMD_VARIANTS(ConvertI16)});
+    return dispatch;
+}
+
+inline const KernelDispatch<ConvertI12Kernel>& ConvertI12() {
+    static const KernelDispatch<ConvertI12Kernel> dispatch({JST_SIMD_VARIANTS(ConvertI12)});
+    return dispatch;
+}
+
+inline const KernelDispatch<QuantizeI16Kernel>& QuantizeI16() {
+    static const KernelDispatch<QuantizeI16Kernel> dispatch({JST_SIMD_VARIANTS(QuantizeI16)});
+    return dispatch;
+}
+
+inline const KernelDispatch<QuantizeI8Kernel>& QuantizeI8() {
+    static const KernelDispatch<QuantizeI8Kernel> dispatch({JST_SIMD_VARIANTS(QuantizeI8)});
+    return dispatch;
+}
+
+inline const KernelDispatch<AbsMaxKernel>& AbsMax() {
+    static const KernelDispatch<AbsMaxKernel> dispatch({JST_SIMD_VARIANTS(AbsMax)});
+    return dispatch;
+}
+
+inline const KernelDispatch<BinReduceKernel>& BinSum() {
+    static const KernelDispatch<BinReduceKernel> dispatch({JST_SIMD_VARIANTS(BinSum)});
+    return dispatch;
+}
+
+inline const KernelDispatch<BinReduceKernel>& BinMin() {
+    static const KernelDispatch<BinReduceKernel> dispatch({JST_SIMD_VARIANTS(BinMin)});
+    return dispatch;
+}
+
+inline const KernelDispatch<BinReduceKernel>& BinMax() {
+    static const KernelDispatch<BinReduceKernel> dispatch({JST_SIMD_VARIANTS(BinMax)});
+    return dispatch;
+}
+
+inline const KernelDispatch<CopyDecayKernel>& CopyDecay() {
+    static const KernelDispatch<CopyDecayKernel> dispatch({JST_SIMD_VARIANTS(CopyDecay) JST_SIMD_WASM_VARIANTS(CopyDecay)});
+    return dispatch;
+}
+
+inline const KernelDispatch<RealAddKernel>& RealAdd() {
+    static const KernelDispatch<RealAddKernel> dispatch({JST_SIMD_VARIANTS(RealAdd) JST_SIMD_WASM_VARIANTS(RealAdd)});
+    return dispatch;
+}
+
+inline const KernelDispatch<RealMultiplyAddKernel>& RealMultiplyAdd() {
+    static const KernelDispatch<RealMultiplyAddKernel> dispatch({JST_SIMD_VARIANTS(RealMultiplyAdd) JST_SIMD_WASM_VARIANTS(RealMultiplyAdd)});
+    return dispatch;
+}
+
+inline const KernelDispatch<DecibelsPowerSumKernel>& DecibelsPowerSum() {
+    static const KernelDispatch<DecibelsPowerSumKernel> dispatch({JST_SIMD_VARIANTS(DecibelsPowerSum)});
+    return dispatch;
+}
+
+}  // namespace Jetstream::Backend
+
+#endif
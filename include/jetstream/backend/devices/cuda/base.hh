@@ -1,6 +1,8 @@
 #ifndef JETSTREAM_BACKEND_DEVICE_CUDA_HH
 #define JETSTREAM_BACKEND_DEVICE_CUDA_HH
 
+#include <vector>
+
 #include <cuda.h>
 #include <cuda_runtime.h>
 
@@ -17,8 +19,12 @@ class CUDA {
     std::string getDeviceName() const;
     std::string getApiVersion() const;
     std::string getComputeCapability() const;
+    // Compute capability as a number, `86` for 8.6.
+    U64 getArchitecture() const;
     PhysicalDeviceType getPhysicalDeviceType() const;
     U64 getPhysicalMemory() const;
+    // Theoretical peak memory bandwidth in bytes per second.
+    U64 getMemoryBandwidth() const;
 
     bool hasUnifiedMemory() const;
     bool canExportDeviceMemory() const;
@@ -29,19 +35,43 @@ class CUDA {
         return config.deviceId;
     }
 
+    // Number of GPUs blocks can be placed on.
+    U64 getDeviceCount() const;
+    // True if kernels on one device can read the memory of the other directly.
+    bool canAccessPeer(const U64& device, const U64& peer) const;
+
+    // Makes a GPU current on the calling thread until it goes out of scope.
+    // Negative indices keep the device of the backend.
+    class Placement {
+     public:
+        explicit Placement(const I32& index);
+        ~Placement();
+
+        Placement(const Placement&) = delete;
+        Placement& operator=(const Placement&) = delete;
+
+     private:
+        CUcontext previous = nullptr;
+        bool placed = false;
+    };
+
  private:
     Config config;
     CUdevice device;
     CUcontext context;
     bool _isAvailable = false;
+    U64 deviceCount = 0;
+    std::vector<std::vector<bool>> peerAccess;
 
     struct {
         std::string deviceName;
         std::string apiVersion;
         std::string computeCapability;
+        U64 architecture;
         PhysicalDeviceType physicalDeviceType;
         bool hasUnifiedMemory;
         U64 physicalMemory;
+        U64 memoryBandwidth;
         bool canImportDeviceMemory;
         bool canImportHostMemory;
         bool canExportDeviceMemory;
@@ -36,11 +36,22 @@ class Metal {
         return device;
     }
 
+    // Archive of compiled pipelines. Persisted in the user cache folder
+    // between runs. Null if the archive couldn't be created.
+    constexpr MTL::BinaryArchive* getBinaryArchive() {
+        return binaryArchive;
+    }
+
  private:
     Config config;
     MTL::Device* device;
     NS::ProcessInfo* info;
+    MTL::BinaryArchive* binaryArchive = nullptr;
+    std::string binaryArchivePath;
     bool _isAvailable = false;
+
+    void createBinaryArchive();
+    void destroyBinaryArchive();
 };
 
 }  // namespace Jetstream::Backend
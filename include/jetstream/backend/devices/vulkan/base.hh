@@ -2,6 +2,7 @@
 #define JETSTREAM_BACKEND_DEVICE_VULKAN_HH
 
 #include <set>
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -28,6 +29,7 @@
 #endif
 
 #include "jetstream/backend/config.hh"
+#include "jetstream/backend/devices/vulkan/helpers.hh"
 
 namespace Jetstream::Backend {
 
@@ -50,6 +52,7 @@ class Vulkan {
     bool canExportDeviceMemory() const;
     bool canImportDeviceMemory() const;
     bool canImportHostMemory() const;
+    bool canExportDmaBufMemory() const;
 
     constexpr const U64& getDeviceId() const {
         return config.deviceId;
@@ -83,10 +86,29 @@ class Vulkan {
         return computeQueue;
     }
 
+    constexpr VkQueue& getTransferQueue() {
+        return transferQueue;
+    }
+
+    constexpr const QueueFamilyIndices& getQueueFamilies() const {
+        return queueFamilies;
+    }
+
+    // Tensors are written by the compute and transfer queues and read by the
+    // graphics queue. When their families differ, buffers are shared by all of
+    // them instead of moving their ownership at every frame.
+    void setSharingMode(VkBufferCreateInfo& info) const;
+
     constexpr VkDescriptorPool& getDescriptorPool() {
         return descriptorPool;
     }
 
+    // Pipeline cache shared by every pipeline. Persisted in the user cache
+    // folder between runs.
+    constexpr VkPipelineCache& getPipelineCache() {
+        return pipelineCache;
+    }
+
     constexpr void* getStagingBufferMappedMemory() {
         return stagingBufferMappedMemory;
     }
@@ -115,22 +137,75 @@ class Vulkan {
         return defaultCommandBuffer;
     }
 
+    // Like the default command buffer but for the graphics queue. Shares the default fence.
+    constexpr VkCommandBuffer& getGraphicsCommandBuffer() {
+        return graphicsCommandBuffer;
+    }
+
+    // Copy host data into a device buffer through the staging ring. The copy is
+    // recorded without waiting for the device and payloads larger than a slot are
+    // split in chunks. Recorded copies are submitted to the transfer queue when a
+    // slot fills up or by flushStagingRing(). With a dedicated transfer family,
+    // the copies wait for the graphics work already submitted and the graphics
+    // work submitted afterwards waits for the copies.
+    Result stageBufferUpload(const VkBuffer& buffer,
+                             const U64& offset,
+                             const void* data,
+                             const U64& size);
+
+    // Submit the pending copies. Must be called before submitting work that reads
+    // the updated buffers to the graphics queue.
+    Result flushStagingRing();
+
+    // Submit the pending copies and wait for every slot to be executed.
+    Result synchronizeStagingRing();
+
  private:
+    static constexpr U64 StagingRingSlots = 4;
+    static constexpr U64 StagingRingSlotSize = 4*1024*1024;
+
+    struct StagingSlot {
+        U64 offset = 0;
+        U64 used = 0;
+        bool recording = false;
+        VkFence fence;
+        VkCommandBuffer commandBuffer;
+
+        // Only used with a dedicated transfer family.
+        VkSemaphore idleSemaphore = VK_NULL_HANDLE;
+        VkSemaphore copiedSemaphore = VK_NULL_HANDLE;
+    };
+
     Config config;
     VkDevice device;
     VkInstance instance;
     VkPhysicalDevice physicalDevice;
     VkPhysicalDeviceProperties properties;
     VkDescriptorPool descriptorPool;
+    VkPipelineCache pipelineCache = VK_NULL_HANDLE;
+    std::string pipelineCachePath;
     VkBuffer stagingBuffer;
     VkDeviceMemory stagingBufferMemory;
     void* stagingBufferMappedMemory;
     VkFence defaultFence;
     VkCommandBuffer defaultCommandBuffer;
     VkCommandPool defaultCommandPool;
+    VkCommandBuffer graphicsCommandBuffer;
+    VkCommandPool graphicsCommandPool;
+    VkBuffer stagingRingBuffer;
+    VkDeviceMemory stagingRingMemory;
+    void* stagingRingMappedMemory;
+    VkCommandPool stagingRingCommandPool;
+    bool stagingRingDedicated = false;
+    std::vector<StagingSlot> stagingRingSlots;
+    U64 stagingRingIndex = 0;
+    std::mutex stagingRingMutex;
     VkQueue graphicsQueue;
     VkQueue computeQueue;
+    VkQueue transferQueue;
     VkQueue presentQueue;
+    QueueFamilyIndices queueFamilies;
+    std::vector<U32> sharedQueueFamilies;
     std::set<std::string> supportedDeviceExtensions;
     std::set<std::string> supportedInstanceExtensions;
     bool _isAvailable = false;
@@ -147,10 +222,14 @@ class Vulkan {
         bool canImportDeviceMemory;
         bool canImportHostMemory;
         bool canExportDeviceMemory;
+        bool canExportDmaBufMemory;
     } cache;
 
     VkDebugReportCallbackEXT debugReportCallback{};
 
+    Result createPipelineCache();
+    void destroyPipelineCache();
+
     std::set<std::string> getRequiredInstanceExtensions();
     std::set<std::string> getOptionalInstanceExtensions();
     std::set<std::string> checkInstanceExtensionSupport(const std::set<std::string>& extensions);
@@ -164,6 +243,9 @@ class Vulkan {
                                                       const std::set<std::string>& extensions);
 
     bool isDeviceSuitable(const VkPhysicalDevice& device);
+
+    Result beginStagingSlot(StagingSlot& slot);
+    Result submitStagingSlot(StagingSlot& slot);
 };
 
 }  // namespace Jetstream::Backend
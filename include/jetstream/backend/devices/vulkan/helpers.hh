@@ -2,6 +2,7 @@
 #define JETSTREAM_BACKEND_DEVICE_VULKAN_HELPERS_HH
 
 #include <set>
+#include <mutex>
 #include <optional>
 #include <vector>
 #include <thread>
@@ -110,14 +111,19 @@ static inline const char* JstVkResultToString(VkResult input_value) {
 
 namespace Jetstream::Backend {
 
+// Families of the queues used by the backend. Compute and transfer prefer
+// families without graphics support, which run asynchronously to rendering
+// on most discrete GPUs, and fall back to the graphics family otherwise.
 struct QueueFamilyIndices {
     std::optional<uint32_t> graphicFamily;
     std::optional<uint32_t> computeFamily;
+    std::optional<uint32_t> transferFamily;
     std::optional<uint32_t> presentFamily;
 
     bool isComplete() const {
         return graphicFamily.has_value() &&
                computeFamily.has_value() &&
+               transferFamily.has_value() &&
                presentFamily.has_value();
     }
 };
@@ -130,25 +136,38 @@ inline QueueFamilyIndices FindQueueFamilies(const VkPhysicalDevice& device) {
     std::vector<VkQueueFamilyProperties> queueFamilies(queueFamilyCount);
     vkGetPhysicalDeviceQueueFamilyProperties(device, &queueFamilyCount, queueFamilies.data());
 
-    int i = 0;
-    for (const auto& queueFamily : queueFamilies) {
-        if (queueFamily.queueFlags & VK_QUEUE_GRAPHICS_BIT) {
+    std::optional<uint32_t> sharedComputeFamily;
+    std::optional<uint32_t> dedicatedComputeFamily;
+    std::optional<uint32_t> dedicatedTransferFamily;
+
+    for (uint32_t i = 0; i < queueFamilyCount; i++) {
+        const auto& flags = queueFamilies[i].queueFlags;
+        const bool graphics = flags & VK_QUEUE_GRAPHICS_BIT;
+        const bool compute = flags & VK_QUEUE_COMPUTE_BIT;
+
+        if (graphics && !indices.graphicFamily.has_value()) {
             indices.graphicFamily = i;
         }
 
-        if (queueFamily.queueFlags & VK_QUEUE_COMPUTE_BIT) {
-            indices.computeFamily = i;
+        if (compute && graphics && !sharedComputeFamily.has_value()) {
+            sharedComputeFamily = i;
         }
 
-        indices.presentFamily = i;
-
-        if (indices.isComplete()) {
-            break;
+        if (compute && !graphics && !dedicatedComputeFamily.has_value()) {
+            dedicatedComputeFamily = i;
         }
 
-        i++;
+        if ((flags & VK_QUEUE_TRANSFER_BIT) && !graphics && !compute && !dedicatedTransferFamily.has_value()) {
+            dedicatedTransferFamily = i;
+        }
     }
 
+    // Graphics and compute families also support transfers.
+
+    indices.presentFamily = indices.graphicFamily;
+    indices.computeFamily = dedicatedComputeFamily.has_value() ? dedicatedComputeFamily : sharedComputeFamily;
+    indices.transferFamily = dedicatedTransferFamily.has_value() ? dedicatedTransferFamily : indices.graphicFamily;
+
     if (!indices.computeFamily.has_value()) {
         indices.computeFamily = indices.graphicFamily;
         JST_WARN("[VULKAN] Compute queue not found. Using graphics queue instead. This may cause issues.");
@@ -187,6 +206,13 @@ inline VkShaderModule LoadShader(const std::vector<U8>& data, VkDevice device) {
     return shaderModule;
 }
 
+// Queues have to be externally synchronized. The compute, transfer, and
+// graphics queues can be the same object and are submitted from several threads.
+inline std::mutex& QueueMutex() {
+    static std::mutex mutex;
+    return mutex;
+}
+
 inline Result ExecuteOnce(VkDevice& device,
                           VkQueue& queue,
                           VkFence& fence,
@@ -194,6 +220,9 @@ inline Result ExecuteOnce(VkDevice& device,
                           std::function<Result(VkCommandBuffer&)> func,
                           const std::vector<VkSemaphore>& waitSemaphores = {},
                           const std::vector<VkPipelineStageFlags>& waitSemaphoresStageMasks = {}) {
+    // The default command buffer and fence are shared as well.
+    std::lock_guard<std::mutex> lock(QueueMutex());
+
     VkCommandBufferBeginInfo cmdBeginInfo = {};
     cmdBeginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
     cmdBeginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
@@ -25,6 +25,9 @@
 #include "jetstream/flowgraph.hh"
 #include "jetstream/parser.hh"
 #include "jetstream/benchmark.hh"
+#include "jetstream/metrics.hh"
+#include "jetstream/quality.hh"
+#include "jetstream/startup.hh"
 
 //
 // Functional Imports
@@ -1,7 +1,12 @@
 #ifndef JETSTREAM_BENCHMARK_HH
 #define JETSTREAM_BENCHMARK_HH
 
+#include <regex>
+#include <numeric>
+#include <vector>
 #include <iostream>
+#include <functional>
+#include <unordered_map>
 
 #include "jetstream/types.hh"
 #include "jetstream/macros.hh"
@@ -11,13 +16,98 @@
 
 namespace Jetstream {
 
+class Instance;
+
 class Benchmark {
  public:
+    // End-to-end run of a flowgraph through the scheduler.
+    struct FlowgraphConfig {
+        std::string path;
+        U64 frames = 1000;
+        U64 warmupFrames = 100;
+    };
+
+    // Work done by one run of a benchmark.
+    struct Throughput {
+        // Elements read from the inputs.
+        U64 elements = 0;
+        // Bytes read from the inputs and written to the outputs.
+        U64 bytes = 0;
+        // Floating point operations. Zero if unknown.
+        F64 flops = 0.0;
+
+        // Measure the tensors of a module. The operations are counted from
+        // the operations needed to compute each output element.
+        template<typename RecordMap>
+        static Throughput Measure(const RecordMap& inputs, const RecordMap& outputs, const F64& flopsPerElement) {
+            const auto count = [](const auto& record) {
+                return std::accumulate(record.shape.begin(), record.shape.end(), U64{1}, std::multiplies<U64>());
+            };
+
+            Throughput throughput;
+            U64 outputElements = 0;
+            for (const auto& [_, record] : inputs) {
+                if (record.shape.empty()) {
+                    continue;
+                }
+                throughput.elements += count(record);
+                throughput.bytes += record.size_bytes;
+            }
+            for (const auto& [_, record] : outputs) {
+                if (record.shape.empty()) {
+                    continue;
+                }
+                outputElements += count(record);
+                throughput.bytes += record.size_bytes;
+            }
+            throughput.flops = flopsPerElement * static_cast<F64>(outputElements);
+
+            return throughput;
+        }
+    };
+
+    // Render run of the present path of the visualization blocks.
+    struct RenderConfig {
+        U64 frames = 300;
+        U64 warmupFrames = 30;
+    };
+
+    // Selection and timing of the benchmarks. Filters are case-insensitive
+    // regular expressions, an empty filter matches everything.
+    struct Options {
+        std::string module = "";
+        std::string device = "";
+        std::string type = "";
+        std::string name = "";
+        // Epochs per case. Zero keeps the nanobench default.
+        U64 epochs = 0;
+        U64 minEpochTimeMs = 100;
+    };
+
+    // Parameters of a case generated by a sweep.
+    struct SweepPoint {
+        std::string module;
+        std::string device;
+        std::string type;
+        std::string group;
+        U64 batch;
+        U64 size;
+    };
+
     struct ResultEntry {
         std::string name;
         F64 ops_per_sec;
         F64 ms_per_op;
         F64 error;
+        F64 samples_per_sec;
+        F64 gb_per_sec;
+        F64 gflops_per_sec;
+        // Time spent on the device by one run, measured by the graph
+        // timers. Zero on the CPU or if the device can't be timed.
+        F64 kernel_ms_per_op;
+        F64 kernel_gb_per_sec;
+        // Peak memory bandwidth reported by the device. Zero if unknown.
+        F64 peak_gb_per_sec;
     };
 
     typedef std::function<void(ankerl::nanobench::Bench& bench, std::string name)> BenchmarkFuncType;
@@ -35,6 +125,59 @@ class Benchmark {
         getInstance().run(outputType, out);
     }
 
+    // Run the benchmarks and compare them with a baseline written by the `json`
+    // output. Returns an error if any case is significantly slower.
+    static Result Compare(const std::string& baselinePath, std::ostream& out = std::cout) {
+        return getInstance().compare(baselinePath, out);
+    }
+
+    // Run a flowgraph on a headless instance with synthetic sources and
+    // report the sustained rate, the frame latency and the module breakdown.
+    static Result RunFlowgraph(Instance& instance,
+                               const FlowgraphConfig& config,
+                               std::ostream& out = std::cout) {
+        return getInstance().runFlowgraph(instance, config, out);
+    }
+
+    static Result SetOptions(const Options& options) {
+        return getInstance().setOptions(options);
+    }
+
+    // Check if a case passes the name filter.
+    static bool Selected(const std::string& name) {
+        return getInstance().selected(name);
+    }
+
+    // Draw the visualization blocks on the window of an instance and report the
+    // frame time, the present time, the draw calls and the upload bandwidth.
+    static Result RunRender(Instance& instance,
+                            const RenderConfig& config,
+                            std::ostream& out = std::cout) {
+        return getInstance().runRender(instance, config, out);
+    }
+
+    static void SetThroughput(const std::string& name, const Throughput& throughput) {
+        getInstance().throughputs[name] = throughput;
+    }
+
+    // Device time of one run of a case, without the host overhead.
+    static void SetDeviceTime(const std::string& name, const Device& device, const F64& milliseconds) {
+        getInstance().deviceTimes[name] = {device, milliseconds};
+    }
+
+    // Batch and size pairs to sweep. Empty unless running with the `sweep` output.
+    static const std::vector<std::pair<U64, U64>>& SweepPoints() {
+        return getInstance().sweepPoints();
+    }
+
+    // Name a sweep case and remember its parameters for the grouped output.
+    static std::string SweepName(const std::string& name,
+                                 const std::string& group,
+                                 const U64& batch,
+                                 const U64& size) {
+        return getInstance().sweepName(name, group, batch, size);
+    }
+
     static U64 TotalCount() {
         return getInstance().totalCount();
     }
@@ -56,17 +199,38 @@ class Benchmark {
 
     BenchmarkMapType benchmarks;
     ResultMapType results;
+    std::unordered_map<std::string, Throughput> throughputs;
+    std::unordered_map<std::string, std::pair<Device, F64>> deviceTimes;
+    std::unordered_map<std::string, SweepPoint> sweeps;
+    Options options;
+    std::regex moduleFilter;
+    std::regex deviceFilter;
+    std::regex typeFilter;
+    std::regex nameFilter;
+    std::string currentModule;
+    bool sweeping = false;
 
     U64 totalCount();
     U64 currentCount();
     void resetResults();
     const ResultMapType& getResults();
+    Result setOptions(const Options& options);
+    bool selected(const std::string& name);
+    bool selected(const std::string& module, const std::string& prefix);
+    const std::vector<std::pair<U64, U64>>& sweepPoints();
+    std::string sweepName(const std::string& name,
+                          const std::string& group,
+                          const U64& batch,
+                          const U64& size);
 
     void add(const std::string& module,
              const std::string& device,
              const std::string& type,
              const BenchmarkFuncType& benchmark);
     void run(const std::string& outputType, std::ostream& out);
+    Result runFlowgraph(Instance& instance, const FlowgraphConfig& config, std::ostream& out);
+    Result compare(const std::string& baselinePath, std::ostream& out);
+    Result runRender(Instance& instance, const RenderConfig& config, std::ostream& out);
 };
 
 }  // namespace Jetstream
@@ -36,8 +36,12 @@ class JETSTREAM_API Block {
         bool controlEnabled = false;
         bool fullscreenEnabled = false;
         Extent2D<F32> nodePos = {0.0f, 0.0f};
+        // GPU the block runs on. Negative uses the device of the backend.
+        I32 deviceIndex = -1;
+        // Worker running the block in a distributed flowgraph. Empty runs it locally.
+        std::string host;
 
-        JST_SERDES(nodeWidth, viewEnabled, previewEnabled, controlEnabled, fullscreenEnabled, nodePos);
+        JST_SERDES(nodeWidth, viewEnabled, previewEnabled, controlEnabled, fullscreenEnabled, nodePos, deviceIndex, host);
     };
 
     constexpr const State& getState() const {
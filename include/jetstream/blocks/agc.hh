@@ -13,7 +13,12 @@ class AGC : public Block {
     // Configuration
 
     struct Config {
-        JST_SERDES();
+        F32 level = 1.0f;
+        F32 attack = 1e-1f;
+        F32 decay = 1e-3f;
+        F32 maxGain = 1e5f;
+
+        JST_SERDES(level, attack, decay, maxGain);
     };
 
     constexpr const Config& getConfig() const {
@@ -67,15 +72,28 @@ class AGC : public Block {
     }
 
     std::string description() const {
-        // TODO: Add decent block description describing internals and I/O.
-        return "Adjusts the gain of the input signal to a constant level.";
+        return "Adjusts the gain of the input signal to a constant level. The envelope follows the peak "
+               "magnitude of the signal, rising with the attack factor and falling with the decay factor, "
+               "and the gain ramps smoothly between updates. The state is kept between buffers, so there's "
+               "no pumping at buffer boundaries.\n\n"
+
+               "## Parameters\n"
+               "- **Level**: Target peak magnitude of the output.\n"
+               "- **Attack**: Per-sample smoothing when the envelope rises (0 to 1, higher is faster).\n"
+               "- **Decay**: Per-sample smoothing when the envelope falls (0 to 1, higher is faster).\n"
+               "- **Max Gain**: Upper bound of the gain applied to weak signals.";
     }
 
     // Constructor
 
     Result create() {
         JST_CHECK(instance().addModule(
-            agc, "agc", {}, {
+            agc, "agc", {
+                .level = config.level,
+                .attack = config.attack,
+                .decay = config.decay,
+                .maxGain = config.maxGain,
+            }, {
                 .buffer = input.buffer,
             },
             locale()
@@ -94,6 +112,38 @@ class AGC : public Block {
         return Result::SUCCESS;
     }
 
+    // Interface
+
+    void drawControl() {
+        const auto drawSetting = [&](const char* label, const char* id, F32& value, const char* format) {
+            ImGui::TableNextRow();
+            ImGui::TableSetColumnIndex(0);
+            ImGui::TextUnformatted(label);
+            ImGui::TableSetColumnIndex(1);
+            ImGui::SetNextItemWidth(-1);
+            F32 setting = value;
+            if (ImGui::InputFloat(id, &setting, 0.0f, 0.0f, format, ImGuiInputTextFlags_EnterReturnsTrue)) {
+                if (setting > 0.0f) {
+                    value = setting;
+
+                    JST_DISPATCH_ASYNC([&](){
+                        ImGui::InsertNotification({ ImGuiToastType_Info, 1000, "Reloading block..." });
+                        JST_CHECK_NOTIFY(instance().reloadBlock(locale()));
+                    });
+                }
+            }
+        };
+
+        drawSetting("Level", "##agc-level", config.level, "%.3f");
+        drawSetting("Attack", "##agc-attack", config.attack, "%.5f");
+        drawSetting("Decay", "##agc-decay", config.decay, "%.5f");
+        drawSetting("Max Gain", "##agc-max-gain", config.maxGain, "%.0f");
+    }
+
+    constexpr bool shouldDrawControl() const {
+        return true;
+    }
+
  private:
     std::shared_ptr<Jetstream::AGC<D, IT>> agc;
 
@@ -13,7 +13,9 @@ class Amplitude : public Block {
     // Configuration
 
     struct Config {
-        JST_SERDES();
+        bool inPlace = false;
+
+        JST_SERDES(inPlace);
     };
 
     constexpr const Config& getConfig() const {
@@ -68,14 +70,18 @@ class Amplitude : public Block {
 
     std::string description() const {
         // TODO: Add decent block description describing internals and I/O.
-        return "Calculates the amplitude of a complex signal.";
+        return "Calculates the amplitude of a complex signal. "
+               "With `In-Place`, the amplitude of a real signal is written over the input on the CPU, "
+               "which requires the other readers of the input to run first.";
     }
 
     // Constructor
 
     Result create() {
         JST_CHECK(instance().addModule(
-            amplitude, "amplitude", {}, {
+            amplitude, "amplitude", {
+                .inPlace = config.inPlace,
+            }, {
                 .buffer = input.buffer,
             },
             locale()
@@ -94,6 +100,28 @@ class Amplitude : public Block {
         return Result::SUCCESS;
     }
 
+    // Interface
+
+    void drawControl() {
+        if constexpr (std::is_same_v<IT, OT>) {
+            ImGui::TableNextRow();
+            ImGui::TableSetColumnIndex(0);
+            ImGui::TextUnformatted("In-Place");
+            ImGui::TableSetColumnIndex(1);
+            ImGui::SetNextItemWidth(-1);
+            if (ImGui::Checkbox("##InPlace", &config.inPlace)) {
+                JST_DISPATCH_ASYNC([&](){
+                    ImGui::InsertNotification({ ImGuiToastType_Info, 1000, "Reloading block..." });
+                    JST_CHECK_NOTIFY(instance().reloadBlock(locale()));
+                });
+            }
+        }
+    }
+
+    constexpr bool shouldDrawControl() const {
+        return std::is_same_v<IT, OT>;
+    }
+
  private:
     std::shared_ptr<Jetstream::Amplitude<D, IT, OT>> amplitude;
 
@@ -111,6 +111,30 @@ class Audio : public Block {
 
     // Interface
 
+    void drawInfo() {
+        ImGui::TableNextRow();
+        ImGui::TableSetColumnIndex(0);
+        ImGui::TextUnformatted("Latency");
+        ImGui::TableSetColumnIndex(1);
+        ImGui::TextFormatted("{:.1f} ms", audio->getLatency() * 1e3);
+
+        ImGui::TableNextRow();
+        ImGui::TableSetColumnIndex(0);
+        ImGui::TextUnformatted("Underruns");
+        ImGui::TableSetColumnIndex(1);
+        ImGui::TextFormatted("{} ({} samples)", audio->getUnderruns(), audio->getUnderrunSamples());
+
+        ImGui::TableNextRow();
+        ImGui::TableSetColumnIndex(0);
+        ImGui::TextUnformatted("Overflows");
+        ImGui::TableSetColumnIndex(1);
+        ImGui::TextFormatted("{}", audio->getOverflows());
+    }
+
+    constexpr bool shouldDrawInfo() const {
+        return true;
+    }
+
     void drawControl() {
         ImGui::TableNextRow();
         ImGui::TableSetColumnIndex(0);
@@ -33,6 +33,11 @@
 #define JETSTREAM_BLOCK_SOAPY_AVAILABLE
 #endif
 
+#if defined(JETSTREAM_MODULE_SOAPY_SINK_AVAILABLE)
+#include "jetstream/blocks/soapy_sink.hh"
+#define JETSTREAM_BLOCK_SOAPY_SINK_AVAILABLE
+#endif
+
 #if defined(JETSTREAM_MODULE_MULTIPLY_AVAILABLE)
 #include "jetstream/blocks/multiply.hh"
 #define JETSTREAM_BLOCK_MULTIPLY_AVAILABLE
@@ -176,17 +181,52 @@
 #define JETSTREAM_BLOCK_FILE_READER_AVAILABLE
 #endif
 
+#if defined(JETSTREAM_MODULE_NETWORK_SINK_AVAILABLE)
+#include "jetstream/blocks/network_sink.hh"
+#define JETSTREAM_BLOCK_NETWORK_SINK_AVAILABLE
+#endif
+
+#if defined(JETSTREAM_MODULE_NETWORK_SOURCE_AVAILABLE)
+#include "jetstream/blocks/network_source.hh"
+#define JETSTREAM_BLOCK_NETWORK_SOURCE_AVAILABLE
+#endif
+
+#if defined(JETSTREAM_MODULE_SHARED_MEMORY_SINK_AVAILABLE)
+#include "jetstream/blocks/shared_memory_sink.hh"
+#define JETSTREAM_BLOCK_SHARED_MEMORY_SINK_AVAILABLE
+#endif
+
+#if defined(JETSTREAM_MODULE_SHARED_MEMORY_SOURCE_AVAILABLE)
+#include "jetstream/blocks/shared_memory_source.hh"
+#define JETSTREAM_BLOCK_SHARED_MEMORY_SOURCE_AVAILABLE
+#endif
+
 #if defined(JETSTREAM_MODULE_THROTTLE_AVAILABLE)
 #include "jetstream/blocks/throttle.hh"
 #define JETSTREAM_BLOCK_THROTTLE_AVAILABLE
 #endif
 
-#if defined(JETSTREAM_MODULE_ARITHMETIC_AVAILABLE) && \
-    defined(JETSTREAM_MODULE_DUPLICATE_AVAILABLE)
+#if defined(JETSTREAM_MODULE_DECIMATOR_AVAILABLE)
 #include "jetstream/blocks/decimator.hh"
 #define JETSTREAM_BLOCK_DECIMATOR_AVAILABLE
 #endif
 
+#if defined(JETSTREAM_MODULE_CHANNELIZER_AVAILABLE)
+#include "jetstream/blocks/channelizer.hh"
+#define JETSTREAM_BLOCK_CHANNELIZER_AVAILABLE
+#endif
+
+#if defined(JETSTREAM_MODULE_XLATING_FILTER_AVAILABLE) && \
+    defined(JETSTREAM_MODULE_FILTER_TAPS_AVAILABLE)
+#include "jetstream/blocks/xlating_filter.hh"
+#define JETSTREAM_BLOCK_XLATING_FILTER_AVAILABLE
+#endif
+
+#if defined(JETSTREAM_MODULE_RESAMPLER_AVAILABLE)
+#include "jetstream/blocks/resampler.hh"
+#define JETSTREAM_BLOCK_RESAMPLER_AVAILABLE
+#endif
+
 #if defined(JETSTREAM_MODULE_WINDOW_AVAILABLE) && \
     defined(JETSTREAM_MODULE_MULTIPLY_AVAILABLE) && \
     defined(JETSTREAM_MODULE_INVERT_AVAILABLE) && \
@@ -198,6 +238,29 @@
 #define JETSTREAM_BLOCK_SPECTRUM_ENGINE_AVAILABLE
 #endif
 
+#if defined(JETSTREAM_MODULE_FILTER_TAPS_AVAILABLE) && \
+    defined(JETSTREAM_MODULE_XLATING_FILTER_AVAILABLE) && \
+    defined(JETSTREAM_MODULE_FRAMER_AVAILABLE) && \
+    defined(JETSTREAM_MODULE_WINDOW_AVAILABLE) && \
+    defined(JETSTREAM_MODULE_MULTIPLY_AVAILABLE) && \
+    defined(JETSTREAM_MODULE_INVERT_AVAILABLE) && \
+    defined(JETSTREAM_MODULE_FFT_AVAILABLE) && \
+    defined(JETSTREAM_MODULE_AMPLITUDE_AVAILABLE) && \
+    defined(JETSTREAM_MODULE_SCALE_AVAILABLE)
+#include "jetstream/blocks/zoom_fft.hh"
+#define JETSTREAM_BLOCK_ZOOM_FFT_AVAILABLE
+#endif
+
+#if defined(JETSTREAM_MODULE_SPECTRUM_MEASURE_AVAILABLE)
+#include "jetstream/blocks/spectrum_measure.hh"
+#define JETSTREAM_BLOCK_SPECTRUM_MEASURE_AVAILABLE
+#endif
+
+#if defined(JETSTREAM_MODULE_BURST_DETECTOR_AVAILABLE)
+#include "jetstream/blocks/burst_detector.hh"
+#define JETSTREAM_BLOCK_BURST_DETECTOR_AVAILABLE
+#endif
+
 #if defined(JETSTREAM_MODULE_SIGNAL_GENERATOR_AVAILABLE)
 #include "jetstream/blocks/signal_generator.hh"
 #define JETSTREAM_BLOCK_SIGNAL_GENERATOR_AVAILABLE
@@ -218,6 +281,21 @@
 #define JETSTREAM_BLOCK_ADD_AVAILABLE
 #endif
 
+#if defined(JETSTREAM_MODULE_SLIDING_FFT_AVAILABLE)
+#include "jetstream/blocks/sliding_fft.hh"
+#define JETSTREAM_BLOCK_SLIDING_FFT_AVAILABLE
+#endif
+
+#if defined(JETSTREAM_MODULE_CORRELATOR_AVAILABLE)
+#include "jetstream/blocks/correlator.hh"
+#define JETSTREAM_BLOCK_CORRELATOR_AVAILABLE
+#endif
+
+#if defined(JETSTREAM_MODULE_HISTORY_AVAILABLE)
+#include "jetstream/blocks/history.hh"
+#define JETSTREAM_BLOCK_HISTORY_AVAILABLE
+#endif
+
 // [NEW BLOCK HOOK]
 
 #endif  // JETSTREAM_BLOCKS_BASE_HH
@@ -0,0 +1,218 @@
+#ifndef JETSTREAM_BLOCK_BURST_DETECTOR_BASE_HH
+#define JETSTREAM_BLOCK_BURST_DETECTOR_BASE_HH
+
+#include "jetstream/block.hh"
+#include "jetstream/instance.hh"
+#include "jetstream/modules/burst_detector.hh"
+
+namespace Jetstream::Blocks {
+
+template<Device D, typename IT, typename OT>
+class BurstDetector : public Block {
+ public:
+    // Configuration
+
+    struct Config {
+        F32 threshold = -60.0f;
+        U64 preTrigger = 4;
+        U64 postTrigger = 16;
+
+        JST_SERDES(threshold, preTrigger, postTrigger);
+    };
+
+    constexpr const Config& getConfig() const {
+        return config;
+    }
+
+    // Input
+
+    struct Input {
+        Tensor<D, IT> buffer;
+        Tensor<D, F32> level;
+
+        JST_SERDES(buffer, level);
+    };
+
+    constexpr const Input& getInput() const {
+        return input;
+    }
+
+    // Output
+
+    struct Output {
+        Tensor<D, IT> buffer;
+
+        JST_SERDES(buffer);
+    };
+
+    constexpr const Output& getOutput() const {
+        return output;
+    }
+
+    constexpr const Tensor<D, IT>& getOutputBuffer() const {
+        return this->output.buffer;
+    }
+
+    // Housekeeping
+
+    constexpr Device device() const {
+        return D;
+    }
+
+    std::string id() const {
+        return "burst-detector";
+    }
+
+    std::string name() const {
+        return "Burst Detector";
+    }
+
+    std::string summary() const {
+        return "Gates a signal around bursts of power.";
+    }
+
+    std::string description() const {
+        return "The Burst Detector block keeps only the parts of a signal around bursts of energy. Each buffer "
+               "is a frame. A frame triggers when any value of the level input, like the band power of a "
+               "Spectrum Measure block, reaches the threshold. The signal comes out delayed by the pre-trigger "
+               "frames with a gate that opens from the pre-trigger frames before a trigger to the post-trigger "
+               "frames after it. A File Writer fed by this block only writes while the gate is open, so "
+               "recordings hold the bursts and their surroundings instead of the whole capture.\n\n"
+
+               "## Parameters\n"
+               "- **Threshold**: The level that triggers a burst (in dB).\n"
+               "- **Pre-Trigger**: The number of frames kept before a trigger.\n"
+               "- **Post-Trigger**: The number of frames kept after the last trigger.\n\n"
+
+               "## Useful For:\n"
+               "- Recording intermittent transmissions.\n"
+               "- Reducing disk usage of long captures.\n\n"
+
+               "## Examples:\n"
+               "- Record bursts in a channel:\n"
+               "  Spectrum Engine → Spectrum Measure (power) → Burst Detector (level)\n"
+               "  Source → Burst Detector (buffer) → File Writer\n"
+               "  Input: CF32[8, 8192], F32[8, 1] → Output: CF32[8, 8192]\n\n"
+
+               "## Implementation:\n"
+               "Input → Burst Detector → Output\n"
+               "1. The newest frame is stored in a ring of the last pre-trigger frames.\n"
+               "2. The oldest frame of the ring is the output.\n"
+               "3. The gate is set as an attribute of the output and read by the consumers.";
+    }
+
+    // Constructor
+
+    Result create() {
+        JST_CHECK(instance().addModule(
+            detector, "detector", {
+                .threshold = config.threshold,
+                .preTrigger = config.preTrigger,
+                .postTrigger = config.postTrigger,
+            }, {
+                .buffer = input.buffer,
+                .level = input.level,
+            },
+            locale()
+        ));
+
+        JST_CHECK(Block::LinkOutput("buffer", output.buffer, detector->getOutputBuffer()));
+
+        return Result::SUCCESS;
+    }
+
+    Result destroy() {
+        if (detector) {
+            JST_CHECK(instance().eraseModule(detector->locale()));
+        }
+
+        return Result::SUCCESS;
+    }
+
+    // Interface
+
+    void drawInfo() {
+        ImGui::TableNextRow();
+        ImGui::TableSetColumnIndex(0);
+        ImGui::TextUnformatted("Gate");
+        ImGui::TableSetColumnIndex(1);
+        ImGui::TextUnformatted(detector->gate() ? "Open" : "Closed");
+
+        ImGui::TableNextRow();
+        ImGui::TableSetColumnIndex(0);
+        ImGui::TextUnformatted("Bursts");
+        ImGui::TableSetColumnIndex(1);
+        ImGui::TextFormatted("{}", detector->bursts());
+    }
+
+    constexpr bool shouldDrawInfo() const {
+        return true;
+    }
+
+    void drawControl() {
+        ImGui::TableNextRow();
+        ImGui::TableSetColumnIndex(0);
+        ImGui::TextUnformatted("Threshold");
+        ImGui::TableSetColumnIndex(1);
+        ImGui::SetNextItemWidth(-1);
+        F32 threshold = config.threshold;
+        if (ImGui::InputFloat("##burst-threshold", &threshold, 1.0f, 5.0f, "%.1f dB", ImGuiInputTextFlags_EnterReturnsTrue)) {
+            config.threshold = threshold;
+
+            JST_DISPATCH_ASYNC([&](){
+                ImGui::InsertNotification({ ImGuiToastType_Info, 1000, "Reloading block..." });
+                JST_CHECK_NOTIFY(instance().reloadBlock(locale()));
+            });
+        }
+
+        ImGui::TableNextRow();
+        ImGui::TableSetColumnIndex(0);
+        ImGui::TextUnformatted("Pre-Trigger");
+        ImGui::TableSetColumnIndex(1);
+        ImGui::SetNextItemWidth(-1);
+        F32 preTrigger = config.preTrigger;
+        if (ImGui::InputFloat("##burst-pre-trigger", &preTrigger, 1.0f, 1.0f, "%.0f frames", ImGuiInputTextFlags_EnterReturnsTrue)) {
+            if (preTrigger >= 0) {
+                config.preTrigger = static_cast<U64>(preTrigger);
+
+                JST_DISPATCH_ASYNC([&](){
+                    ImGui::InsertNotification({ ImGuiToastType_Info, 1000, "Reloading block..." });
+                    JST_CHECK_NOTIFY(instance().reloadBlock(locale()));
+                });
+            }
+        }
+
+        ImGui::TableNextRow();
+        ImGui::TableSetColumnIndex(0);
+        ImGui::TextUnformatted("Post-Trigger");
+        ImGui::TableSetColumnIndex(1);
+        ImGui::SetNextItemWidth(-1);
+        F32 postTrigger = config.postTrigger;
+        if (ImGui::InputFloat("##burst-post-trigger", &postTrigger, 1.0f, 1.0f, "%.0f frames", ImGuiInputTextFlags_EnterReturnsTrue)) {
+            if (postTrigger >= 0) {
+                config.postTrigger = static_cast<U64>(postTrigger);
+
+                JST_DISPATCH_ASYNC([&](){
+                    ImGui::InsertNotification({ ImGuiToastType_Info, 1000, "Reloading block..." });
+                    JST_CHECK_NOTIFY(instance().reloadBlock(locale()));
+                });
+            }
+        }
+    }
+
+    constexpr bool shouldDrawControl() const {
+        return true;
+    }
+
+ private:
+    std::shared_ptr<Jetstream::BurstDetector<D, IT>> detector;
+
+    JST_DEFINE_IO()
+};
+
+}  // namespace Jetstream::Blocks
+
+JST_BLOCK_ENABLE(BurstDetector, is_specialized<Jetstream::BurstDetector<D, IT>>::value &&
+                                std::is_same<OT, void>::value)
+
+#endif
@@ -76,13 +76,17 @@ class Cast : public Block {
                "floating-point transformations.\n\n"
 
                "## Arguments:\n"
-               "- **Scaler**: Scaling factor applied during conversion. For CI8 to CF32, default "
-               "is 128.0 to normalize integer values to floating-point range. For CF32 to F32, "
-               "no scaling is applied as only the real part is extracted.\n\n"
+               "- **Scaler**: Full scale of the input. Integer samples are divided by it, so "
+               "zero picks the full scale of the input format: 128 for CI8 and CU8, 32768 for "
+               "CI16 and 2048 for packed 12-bit samples. For CF32 to CI16, samples are multiplied "
+               "by it instead, 32768 by default. For CF32 to F32, no scaling is applied as only the "
+               "real part is extracted.\n\n"
 
                "## Useful For:\n"
                "- Converting complex signals to real-valued data by extracting the real component.\n"
-               "- Normalizing integer-based complex data to floating-point for further processing.\n"
+               "- Normalizing raw SDR samples (CI8, CI16, offset binary CU8 or packed 12-bit) to "
+               "floating-point for further processing.\n"
+               "- Quantizing CF32 to CI16 to halve the memory traffic of stored or transported samples.\n"
                "- Adapting data types between different processing stages in the flowgraph.\n"
                "- Preparing data for modules that require specific numeric formats.\n\n"
 
@@ -92,13 +96,21 @@ class Cast : public Block {
                "  Input: CF32[8192] → Output: F32[8192]\n"
                "- Integer complex normalization:\n"
                "  Config: Scaler=128.0\n"
-               "  Input: CI8[4096] → Output: CF32[4096]\n\n"
+               "  Input: CI8[4096] → Output: CF32[4096]\n"
+               "- Quantization to 16-bit integers:\n"
+               "  Config: Scaler=32768.0\n"
+               "  Input: CF32[4096] → Output: CI16[4096]\n"
+               "- Packed 12-bit samples, three bytes each:\n"
+               "  Config: Scaler=2048.0\n"
+               "  Input: U8[12288] → Output: CF32[4096]\n\n"
 
                "## Implementation:\n"
-               "The module performs direct type conversion with optional scaling. For CF32 to F32, "
-               "it extracts the real component and discards the imaginary part. For CI8 to CF32, "
-               "it converts integer components to floating-point and applies the scaler for "
-               "normalization. Other conversions apply scaling and clamping to prevent overflow.";
+               "The module converts with SIMD kernels on the CPU and a kernel per sample on CUDA, "
+               "multiplying by the reciprocal of the scaler. For CF32 to F32, it extracts the real "
+               "component and discards the imaginary part. Offset binary CU8 samples are centered "
+               "on 127.5 before scaling. Quantized samples are rounded to nearest and saturated. "
+               "Bytes cast to CF32 are read as packed 12-bit complex samples, with the real part "
+               "in the low 12 bits of each little-endian 24-bit word.";
     }
 
     // Constructor
@@ -129,7 +141,7 @@ class Cast : public Block {
     // Interface
 
     void drawControl() {
-        if constexpr (std::is_same<IT, CF32>::value && std::is_same<OT, F32>::value) {
+        if constexpr ((std::is_same<IT, CF32>::value && std::is_same<OT, F32>::value) || CastIsQuantized<IT, OT>) {
             ImGui::TableNextRow();
             ImGui::TableSetColumnIndex(0);
             ImGui::TextUnformatted("Scaler");
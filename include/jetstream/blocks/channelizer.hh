@@ -0,0 +1,208 @@
+#ifndef JETSTREAM_BLOCK_CHANNELIZER_BASE_HH
+#define JETSTREAM_BLOCK_CHANNELIZER_BASE_HH
+
+#include "jetstream/block.hh"
+#include "jetstream/instance.hh"
+#include "jetstream/modules/channelizer.hh"
+
+namespace Jetstream::Blocks {
+
+template<Device D, typename IT, typename OT>
+class Channelizer : public Block {
+ public:
+    // Configuration
+
+    struct Config {
+        U64 channels = 8;
+        U64 oversampling = 1;
+        U64 tapsPerChannel = 8;
+
+        JST_SERDES(channels, oversampling, tapsPerChannel);
+    };
+
+    constexpr const Config& getConfig() const {
+        return config;
+    }
+
+    // Input
+
+    struct Input {
+        Tensor<D, IT> buffer;
+
+        JST_SERDES(buffer);
+    };
+
+    constexpr const Input& getInput() const {
+        return input;
+    }
+
+    // Output
+
+    struct Output {
+        Tensor<D, IT> buffer;
+
+        JST_SERDES(buffer);
+    };
+
+    constexpr const Output& getOutput() const {
+        return output;
+    }
+
+    constexpr const Tensor<D, IT>& getOutputBuffer() const {
+        return this->output.buffer;
+    }
+
+    // Housekeeping
+
+    constexpr Device device() const {
+        return D;
+    }
+
+    std::string id() const {
+        return "channelizer";
+    }
+
+    std::string name() const {
+        return "Channelizer";
+    }
+
+    std::string summary() const {
+        return "Splits a signal into equally spaced channels.";
+    }
+
+    std::string description() const {
+        return "The Channelizer block splits a complex signal into a number of equally spaced channels with a "
+               "polyphase filter bank. Every channel is filtered by the same windowed-sinc prototype, shifted to "
+               "baseband and decimated in a single pass, so the cost is close to one FIR filter and one small "
+               "FFT per output sample instead of a mixer and decimator per channel. The filter state and the "
+               "channel phases are kept between buffers, so consecutive buffers channelize as one continuous "
+               "stream.\n\n"
+
+               "## Parameters\n"
+               "- **Channels**: The number of channels. Channel k is centered at k times the sample rate over "
+               "the number of channels, channels past the middle are the negative frequencies.\n"
+               "- **Oversampling**: The output rate of each channel relative to the channel spacing. One is "
+               "critically sampled, two keeps the transition bands free of aliasing. The number of channels "
+               "should be a multiple of it.\n"
+               "- **Taps Per Channel**: Prototype filter length per channel. Longer filters have sharper channel "
+               "edges at a higher cost.\n\n"
+
+               "## Useful For:\n"
+               "- Monitoring many narrowband signals inside a wideband capture at once.\n"
+               "- Feeding batched blocks like Lineplot or FM with one channel per row.\n"
+               "- Replacing a bank of mixers and decimators.\n\n"
+
+               "## Examples:\n"
+               "- Critically sampled:\n"
+               "  Config: Channels=8, Oversampling=1\n"
+               "  Input: CF32[65536] → Output: CF32[8, 8192]\n"
+               "- Oversampled:\n"
+               "  Config: Channels=8, Oversampling=2\n"
+               "  Input: CF32[65536] → Output: CF32[8, 16384]\n\n"
+
+               "## Implementation:\n"
+               "Input → Channelizer → Output\n"
+               "1. The prototype filter is designed for the channel spacing and split into one branch per channel.\n"
+               "2. Every output step folds the input window into the branches and rotates them to the sample position.\n"
+               "3. An inverse FFT of the branches yields all channels of that output step.\n"
+               "4. The last input samples are kept as the history for the next buffer.";
+    }
+
+    // Constructor
+
+    Result create() {
+        JST_CHECK(instance().addModule(
+            channelizer, "channelizer", {
+                .channels = config.channels,
+                .oversampling = config.oversampling,
+                .tapsPerChannel = config.tapsPerChannel,
+            }, {
+                .buffer = input.buffer,
+            },
+            locale()
+        ));
+
+        JST_CHECK(Block::LinkOutput("buffer", output.buffer, channelizer->getOutputBuffer()));
+
+        return Result::SUCCESS;
+    }
+
+    Result destroy() {
+        if (channelizer) {
+            JST_CHECK(instance().eraseModule(channelizer->locale()));
+        }
+
+        return Result::SUCCESS;
+    }
+
+    // Interface
+
+    void drawControl() {
+        ImGui::TableNextRow();
+        ImGui::TableSetColumnIndex(0);
+        ImGui::TextUnformatted("Channels");
+        ImGui::TableSetColumnIndex(1);
+        ImGui::SetNextItemWidth(-1);
+        F32 channels = config.channels;
+        if (ImGui::InputFloat("##channels", &channels, 1.0f, 1.0f, "%.0f", ImGuiInputTextFlags_EnterReturnsTrue)) {
+            if (channels >= 2) {
+                config.channels = static_cast<U64>(channels);
+
+                JST_DISPATCH_ASYNC([&](){
+                    ImGui::InsertNotification({ ImGuiToastType_Info, 1000, "Reloading block..." });
+                    JST_CHECK_NOTIFY(instance().reloadBlock(locale()));
+                });
+            }
+        }
+
+        ImGui::TableNextRow();
+        ImGui::TableSetColumnIndex(0);
+        ImGui::TextUnformatted("Oversampling");
+        ImGui::TableSetColumnIndex(1);
+        ImGui::SetNextItemWidth(-1);
+        F32 oversampling = config.oversampling;
+        if (ImGui::InputFloat("##oversampling", &oversampling, 1.0f, 1.0f, "%.0f", ImGuiInputTextFlags_EnterReturnsTrue)) {
+            if (oversampling >= 1) {
+                config.oversampling = static_cast<U64>(oversampling);
+
+                JST_DISPATCH_ASYNC([&](){
+                    ImGui::InsertNotification({ ImGuiToastType_Info, 1000, "Reloading block..." });
+                    JST_CHECK_NOTIFY(instance().reloadBlock(locale()));
+                });
+            }
+        }
+
+        ImGui::TableNextRow();
+        ImGui::TableSetColumnIndex(0);
+        ImGui::TextUnformatted("Taps Per Channel");
+        ImGui::TableSetColumnIndex(1);
+        ImGui::SetNextItemWidth(-1);
+        F32 tapsPerChannel = config.tapsPerChannel;
+        if (ImGui::InputFloat("##taps-per-channel", &tapsPerChannel, 1.0f, 1.0f, "%.0f", ImGuiInputTextFlags_EnterReturnsTrue)) {
+            if (tapsPerChannel >= 1) {
+                config.tapsPerChannel = static_cast<U64>(tapsPerChannel);
+
+                JST_DISPATCH_ASYNC([&](){
+                    ImGui::InsertNotification({ ImGuiToastType_Info, 1000, "Reloading block..." });
+                    JST_CHECK_NOTIFY(instance().reloadBlock(locale()));
+                });
+            }
+        }
+    }
+
+    constexpr bool shouldDrawControl() const {
+        return true;
+    }
+
+ private:
+    std::shared_ptr<Jetstream::Channelizer<D, IT>> channelizer;
+
+    JST_DEFINE_IO()
+};
+
+}  // namespace Jetstream::Blocks
+
+JST_BLOCK_ENABLE(Channelizer, is_specialized<Jetstream::Channelizer<D, IT>>::value &&
+                              std::is_same<OT, void>::value)
+
+#endif
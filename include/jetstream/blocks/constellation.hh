@@ -14,9 +14,12 @@ class Constellation : public Block {
     // Configuration
 
     struct Config {
+        bool enableDensity = false;
+        U64 resolution = 256;
+        F32 decay = 0.9f;
         Extent2D<U64> viewSize = {512, 512};
 
-        JST_SERDES(viewSize);
+        JST_SERDES(enableDensity, resolution, decay, viewSize);
     };
 
     constexpr const Config& getConfig() const {
@@ -64,8 +67,18 @@ class Constellation : public Block {
     }
 
     std::string description() const {
-        // TODO: Add decent block description describing internals and I/O.
-        return "Visualizes modulated data in a 2D scatter plot. Commonly used in digital communication to represent symbol modulation.";
+        return "Visualizes modulated data in a 2D scatter plot. Commonly used in digital communication to represent symbol modulation.\n\n"
+
+               "## Parameters\n"
+               "- **Density**: Bins the points into a decaying histogram instead of drawing each one. The display "
+               "cost then depends on the resolution only, not on the number of points per frame.\n"
+               "- **Resolution**: The number of cells on each side of the histogram.\n"
+               "- **Decay**: How much of the histogram is kept from one frame to the next. Higher values give a "
+               "longer persistence.\n\n"
+
+               "## Useful For:\n"
+               "- Inspecting symbol modulation.\n"
+               "- Persistence views of high rate signals, where rare points still show up.";
     }
 
     // Constructor
@@ -73,6 +86,9 @@ class Constellation : public Block {
     Result create() {
         JST_CHECK(instance().addModule(
             constellation, "constellation", {
+                .enableDensity = config.enableDensity,
+                .resolution = config.resolution,
+                .decay = config.decay,
                 .viewSize = config.viewSize,
             }, {
                 .buffer = input.buffer,
@@ -119,6 +135,62 @@ class Constellation : public Block {
         return true;
     }
 
+    void drawControl() {
+        ImGui::TableNextRow();
+        ImGui::TableSetColumnIndex(0);
+        ImGui::TextUnformatted("Density");
+        ImGui::TableSetColumnIndex(1);
+        ImGui::SetNextItemWidth(-1);
+        if (ImGui::Checkbox("##enableDensity", &config.enableDensity)) {
+            JST_DISPATCH_ASYNC([&](){
+                ImGui::InsertNotification({ ImGuiToastType_Info, 1000, "Reloading block..." });
+                JST_CHECK_NOTIFY(instance().reloadBlock(locale()));
+            });
+        }
+
+        if (!config.enableDensity) {
+            return;
+        }
+
+        ImGui::TableNextRow();
+        ImGui::TableSetColumnIndex(0);
+        ImGui::TextUnformatted("Resolution");
+        ImGui::TableSetColumnIndex(1);
+        ImGui::SetNextItemWidth(-1);
+        F32 resolution = config.resolution;
+        if (ImGui::InputFloat("##constellation-resolution", &resolution, 16.0f, 64.0f, "%.0f", ImGuiInputTextFlags_EnterReturnsTrue)) {
+            if (resolution >= 16 && resolution <= 4096) {
+                config.resolution = static_cast<U64>(resolution);
+
+                JST_DISPATCH_ASYNC([&](){
+                    ImGui::InsertNotification({ ImGuiToastType_Info, 1000, "Reloading block..." });
+                    JST_CHECK_NOTIFY(instance().reloadBlock(locale()));
+                });
+            }
+        }
+
+        ImGui::TableNextRow();
+        ImGui::TableSetColumnIndex(0);
+        ImGui::TextUnformatted("Decay");
+        ImGui::TableSetColumnIndex(1);
+        ImGui::SetNextItemWidth(-1);
+        F32 decay = config.decay;
+        if (ImGui::InputFloat("##constellation-decay", &decay, 0.01f, 0.05f, "%.2f", ImGuiInputTextFlags_EnterReturnsTrue)) {
+            if (decay >= 0.0f && decay < 1.0f) {
+                config.decay = decay;
+
+                JST_DISPATCH_ASYNC([&](){
+                    ImGui::InsertNotification({ ImGuiToastType_Info, 1000, "Reloading block..." });
+                    JST_CHECK_NOTIFY(instance().reloadBlock(locale()));
+                });
+            }
+        }
+    }
+
+    constexpr bool shouldDrawControl() const {
+        return true;
+    }
+
  private:
     std::shared_ptr<Jetstream::Constellation<D, IT>> constellation;
 
@@ -0,0 +1,187 @@
+#ifndef JETSTREAM_BLOCK_CORRELATOR_BASE_HH
+#define JETSTREAM_BLOCK_CORRELATOR_BASE_HH
+
+#include "jetstream/block.hh"
+#include "jetstream/instance.hh"
+#include "jetstream/modules/correlator.hh"
+
+namespace Jetstream::Blocks {
+
+template<Device D, typename IT, typename OT>
+class Correlator : public Block {
+ public:
+    // Configuration
+
+    struct Config {
+        U64 channels = 1024;
+        U64 integration = 1;
+
+        JST_SERDES(channels, integration);
+    };
+
+    constexpr const Config& getConfig() const {
+        return config;
+    }
+
+    // Input
+
+    struct Input {
+        Tensor<D, IT> buffer;
+
+        JST_SERDES(buffer);
+    };
+
+    constexpr const Input& getInput() const {
+        return input;
+    }
+
+    // Output
+
+    struct Output {
+        Tensor<D, IT> visibilities;
+
+        JST_SERDES(visibilities);
+    };
+
+    constexpr const Output& getOutput() const {
+        return output;
+    }
+
+    constexpr const Tensor<D, IT>& getOutputVisibilities() const {
+        return this->output.visibilities;
+    }
+
+    // Housekeeping
+
+    constexpr Device device() const {
+        return D;
+    }
+
+    std::string id() const {
+        return "correlator";
+    }
+
+    std::string name() const {
+        return "Correlator";
+    }
+
+    std::string summary() const {
+        return "Cross-correlates the spectra of antenna pairs.";
+    }
+
+    std::string description() const {
+        return "The Correlator block is an FX correlator. It transforms the samples of every antenna into spectra "
+               "(F) and multiplies the spectra of every antenna pair with the conjugate of the other (X). The "
+               "products are averaged over time into one visibility spectrum per pair, including each antenna "
+               "with itself.\n\n"
+
+               "## Parameters\n"
+               "- **Channels**: The number of frequency channels of every spectrum.\n"
+               "- **Integration**: The number of input buffers averaged in every visibility. The output is "
+               "updated once per integration.\n\n"
+
+               "## Inputs\n"
+               "- **Buffer**: CF32[antennas, samples] with one row per antenna. The number of samples should be a "
+               "multiple of the number of channels.\n\n"
+
+               "## Outputs\n"
+               "- **Visibilities**: CF32[baselines, channels] with antennas * (antennas + 1) / 2 rows, the pairs "
+               "(0, 0), (0, 1), ..., (0, N-1), (1, 1), ... in order. Channels are in the order of the FFT block.\n\n"
+
+               "## Useful For:\n"
+               "- Radio interferometry and aperture synthesis.\n"
+               "- Direction finding and array calibration.\n"
+               "- Measuring the coherence between receivers.\n\n"
+
+               "## Examples:\n"
+               "- Four antennas:\n"
+               "  Config: Channels=1024, Integration=8\n"
+               "  Input: CF32[4, 8192] → Output: CF32[10, 1024]\n\n"
+
+               "## Implementation:\n"
+               "Input → Correlator → Output\n"
+               "1. Every antenna is split in frames of one spectrum and transformed in a single batch.\n"
+               "2. The spectra of every pair are multiplied with the conjugate of the other and summed over the frames.\n"
+               "3. The sums are carried over the integration and divided by the number of frames once it's complete.";
+    }
+
+    // Constructor
+
+    Result create() {
+        JST_CHECK(instance().addModule(
+            correlator, "correlator", {
+                .channels = config.channels,
+                .integration = config.integration,
+            }, {
+                .buffer = input.buffer,
+            },
+            locale()
+        ));
+
+        JST_CHECK(Block::LinkOutput("visibilities", output.visibilities, correlator->getOutputVisibilities()));
+
+        return Result::SUCCESS;
+    }
+
+    Result destroy() {
+        if (correlator) {
+            JST_CHECK(instance().eraseModule(correlator->locale()));
+        }
+
+        return Result::SUCCESS;
+    }
+
+    // Interface
+
+    void drawControl() {
+        ImGui::TableNextRow();
+        ImGui::TableSetColumnIndex(0);
+        ImGui::TextUnformatted("Channels");
+        ImGui::TableSetColumnIndex(1);
+        ImGui::SetNextItemWidth(-1);
+        F32 channels = config.channels;
+        if (ImGui::InputFloat("##correlator-channels", &channels, 1.0f, 1.0f, "%.0f", ImGuiInputTextFlags_EnterReturnsTrue)) {
+            if (channels >= 2 && channels != config.channels) {
+                config.channels = static_cast<U64>(channels);
+
+                JST_DISPATCH_ASYNC([&](){
+                    ImGui::InsertNotification({ ImGuiToastType_Info, 1000, "Reloading block..." });
+                    JST_CHECK_NOTIFY(instance().reloadBlock(locale()));
+                });
+            }
+        }
+
+        ImGui::TableNextRow();
+        ImGui::TableSetColumnIndex(0);
+        ImGui::TextUnformatted("Integration");
+        ImGui::TableSetColumnIndex(1);
+        ImGui::SetNextItemWidth(-1);
+        F32 integration = config.integration;
+        if (ImGui::InputFloat("##correlator-integration", &integration, 1.0f, 1.0f, "%.0f", ImGuiInputTextFlags_EnterReturnsTrue)) {
+            if (integration >= 1 && integration != config.integration) {
+                config.integration = static_cast<U64>(integration);
+
+                JST_DISPATCH_ASYNC([&](){
+                    ImGui::InsertNotification({ ImGuiToastType_Info, 1000, "Reloading block..." });
+                    JST_CHECK_NOTIFY(instance().reloadBlock(locale()));
+                });
+            }
+        }
+    }
+
+    constexpr bool shouldDrawControl() const {
+        return true;
+    }
+
+ private:
+    std::shared_ptr<Jetstream::Correlator<D, IT>> correlator;
+
+    JST_DEFINE_IO()
+};
+
+}  // namespace Jetstream::Blocks
+
+JST_BLOCK_ENABLE(Correlator, is_specialized<Jetstream::Correlator<D, IT>>::value &&
+                             std::is_same<OT, void>::value)
+
+#endif
@@ -3,9 +3,8 @@
 
 #include "jetstream/block.hh"
 #include "jetstream/instance.hh"
-#include "jetstream/modules/arithmetic.hh"
-#include "jetstream/modules/tensor_modifier.hh"
-#include "jetstream/modules/duplicate.hh"
+#include "jetstream/modules/decimator.hh"
+#include "jetstream/modules/cic_decimator.hh"
 
 namespace Jetstream::Blocks {
 
@@ -17,8 +16,10 @@ class Decimator : public Block {
     struct Config {
         U64 axis = 1;
         U64 ratio = 4;
+        U64 tapsPerPhase = 8;
+        U64 cicStages = 0;
 
-        JST_SERDES(axis, ratio);
+        JST_SERDES(axis, ratio, tapsPerPhase, cicStages);
     };
 
     constexpr const Config& getConfig() const {
@@ -68,117 +69,94 @@ class Decimator : public Block {
     }
 
     std::string summary() const {
-        return "Decimates a signal by summing along an axis and slicing.";
+        return "Low-pass filters and decimates a signal along an axis.";
     }
 
     std::string description() const {
-        return "The Decimator block reduces tensor dimensionality by first reshaping the input to separate "
-               "the specified axis into ratio chunks, then summing elements along the new axis, and finally "
-               "extracting the first element of the reduced dimension. This effectively decimates the signal "
-               "by the specified ratio while preserving accumulated values.\n\n"
+        return "The Decimator block reduces the sample rate of a signal along the specified axis by an integer "
+               "ratio. A windowed-sinc low-pass filter with the cutoff at the output Nyquist frequency removes "
+               "the content that would otherwise alias, then only every ratio-th output is kept. Filtering and "
+               "decimation happen in a single pass and the discarded outputs are never computed. The filter "
+               "state is kept between buffers, so consecutive buffers filter as one continuous stream.\n\n"
 
                "## Parameters\n"
-               "- **Axis**: The axis along which to reshape and decimate the input tensor.\n"
-               "- **Ratio**: The decimation ratio that determines how many chunks to create from the axis.\n\n"
+               "- **Axis**: The axis along which to decimate the input tensor.\n"
+               "- **Ratio**: The decimation ratio. The axis size should be a multiple of it.\n"
+               "- **Taps Per Phase**: Filter length per kept output. Longer filters have a sharper transition "
+               "and better alias rejection at a higher cost.\n"
+               "- **CIC Stages**: Zero uses the windowed-sinc filter. A positive number uses a CIC filter with "
+               "that many stages followed by a short compensation filter instead. Its cost doesn't grow with "
+               "the ratio, which suits ratios in the hundreds or thousands.\n\n"
 
                "## Useful For:\n"
-               "- Implementing decimation filters for signal processing.\n"
-               "- Downsampling data by a fixed ratio.\n"
-               "- Aggregating sensor data from multiple sources.\n\n"
+               "- Reducing the sample rate of a signal before further processing.\n"
+               "- Downsampling data by a fixed ratio without aliasing.\n"
+               "- Narrowing the bandwidth of a capture around DC.\n"
+               "- Decimating by very large ratios with CIC stages.\n\n"
 
                "## Examples:\n"
                "- Time-domain decimation:\n"
                "  Config: Axis=1, Ratio=4\n"
-               "  Input: CF32[8192] → Output: CF32[2048]\n"
+               "  Input: CF32[1, 8192] → Output: CF32[1, 2048]\n"
+               "- Narrowband monitoring:\n"
+               "  Config: Axis=1, Ratio=512, CIC Stages=4\n"
+               "  Input: CF32[1, 65536] → Output: CF32[1, 128]\n\n"
 
                "## Implementation:\n"
-               "Input → Reshape → Add Axis → Squeeze Axis → Duplicate → Output\n"
-               "1. Reshape module separates the specified axis into ratio chunks.\n"
-               "2. Arithmetic module sums all elements along the new ratio axis.\n"
-               "3. Tensor modifier slices the result to extract index 0 from the reduced dimension.\n"
-               "4. Duplicate module ensures proper output buffering and host accessibility.";
+               "Input → Decimator → Output\n"
+               "1. The filter taps are designed for the ratio and split into phases.\n"
+               "2. Each kept output is computed as a single dot product over the input and the filter history.\n"
+               "3. The last input samples are kept as the history for the next buffer.";
     }
 
     // Constructor
 
     Result create() {
-        JST_CHECK(instance().addModule(
-            reshape, "reshape", {
-                .callback = [&](auto& mod) {
-                    // Separate the axis into ratio chunks
-                    // e.g. [8192] -> [2048, 4] where axis size / ratio = new size
-                    const auto& shape = input.buffer.shape();
-                    auto new_shape = shape;
-
-                    if (config.axis < shape.size()) {
-                        U64 axis_size = shape[config.axis];
-                        U64 new_axis_size = axis_size / config.ratio;
-
-                        new_shape[config.axis] = new_axis_size;
-                        new_shape.insert(new_shape.begin() + config.axis + 1, config.ratio);
-
-                        mod.reshape(new_shape);
-                    }
-
-                    return Result::SUCCESS;
-                }
-            }, {
-                .buffer = input.buffer,
-            },
-            locale()
-        ));
-
-        JST_CHECK(instance().addModule(
-            arithmetic, "arithmetic", {
-                .operation = ArithmeticOp::Add,
-                .axis = config.axis + 1,  // Adjust axis after reshape
-            }, {
-                .buffer = reshape->getOutputBuffer(),
-            },
-            locale()
-        ));
-
-        JST_CHECK(instance().addModule(
-            slicer, "slicer", {
-                .callback = [&](auto& mod) {
-                    mod.squeeze_dims(config.axis + 1);
-                    return Result::SUCCESS;
-                }
-            }, {
-                .buffer = arithmetic->getOutputBuffer(),
-            },
-            locale()
-        ));
+        if (config.cicStages > 0) {
+            if constexpr (is_specialized<Jetstream::CicDecimator<D, IT>>::value) {
+                JST_CHECK(instance().addModule(
+                    cic, "cic", {
+                        .axis = config.axis,
+                        .ratio = config.ratio,
+                        .stages = config.cicStages,
+                    }, {
+                        .buffer = input.buffer,
+                    },
+                    locale()
+                ));
+
+                JST_CHECK(Block::LinkOutput("buffer", output.buffer, cic->getOutputBuffer()));
+
+                return Result::SUCCESS;
+            } else {
+                JST_ERROR("CIC decimation isn't available for this device.");
+                return Result::ERROR;
+            }
+        }
 
         JST_CHECK(instance().addModule(
-            duplicate, "duplicate", {
-                .hostAccessible = true,
+            decimator, "decimator", {
+                .axis = config.axis,
+                .ratio = config.ratio,
+                .tapsPerPhase = config.tapsPerPhase,
             }, {
-                .buffer = slicer->getOutputBuffer(),
+                .buffer = input.buffer,
             },
             locale()
         ));
 
-        JST_CHECK(Block::LinkOutput("buffer", output.buffer, duplicate->getOutputBuffer()));
+        JST_CHECK(Block::LinkOutput("buffer", output.buffer, decimator->getOutputBuffer()));
 
         return Result::SUCCESS;
     }
 
     Result destroy() {
-        if (duplicate) {
-            JST_CHECK(instance().eraseModule(duplicate->locale()));
-        }
-
-        if (slicer) {
-            JST_CHECK(instance().eraseModule(slicer->locale()));
+        if (decimator) {
+            JST_CHECK(instance().eraseModule(decimator->locale()));
         }
 
-        if (arithmetic) {
-            JST_CHECK(instance().eraseModule(arithmetic->locale()));
-        }
-
-        if (reshape) {
-            JST_CHECK(instance().eraseModule(reshape->locale()));
+        if (cic) {
+            JST_CHECK(instance().eraseModule(cic->locale()));
         }
 
         return Result::SUCCESS;
@@ -220,6 +198,40 @@ class Decimator : public Block {
                 });
             }
         }
+
+        ImGui::TableNextRow();
+        ImGui::TableSetColumnIndex(0);
+        ImGui::TextUnformatted("Taps Per Phase");
+        ImGui::TableSetColumnIndex(1);
+        ImGui::SetNextItemWidth(-1);
+        F32 tapsPerPhase = config.tapsPerPhase;
+        if (ImGui::InputFloat("##taps-per-phase", &tapsPerPhase, 1.0f, 1.0f, "%.0f", ImGuiInputTextFlags_EnterReturnsTrue)) {
+            if (tapsPerPhase >= 1) {
+                config.tapsPerPhase = static_cast<U64>(tapsPerPhase);
+
+                JST_DISPATCH_ASYNC([&](){
+                    ImGui::InsertNotification({ ImGuiToastType_Info, 1000, "Reloading block..." });
+                    JST_CHECK_NOTIFY(instance().reloadBlock(locale()));
+                });
+            }
+        }
+
+        ImGui::TableNextRow();
+        ImGui::TableSetColumnIndex(0);
+        ImGui::TextUnformatted("CIC Stages");
+        ImGui::TableSetColumnIndex(1);
+        ImGui::SetNextItemWidth(-1);
+        F32 cicStages = config.cicStages;
+        if (ImGui::InputFloat("##cic-stages", &cicStages, 1.0f, 1.0f, "%.0f", ImGuiInputTextFlags_EnterReturnsTrue)) {
+            if (cicStages >= 0) {
+                config.cicStages = static_cast<U64>(cicStages);
+
+                JST_DISPATCH_ASYNC([&](){
+                    ImGui::InsertNotification({ ImGuiToastType_Info, 1000, "Reloading block..." });
+                    JST_CHECK_NOTIFY(instance().reloadBlock(locale()));
+                });
+            }
+        }
     }
 
     constexpr bool shouldDrawControl() const {
@@ -227,18 +239,15 @@ class Decimator : public Block {
     }
 
  private:
-    std::shared_ptr<Jetstream::TensorModifier<D, IT>> reshape;
-    std::shared_ptr<Jetstream::Arithmetic<D, IT>> arithmetic;
-    std::shared_ptr<Jetstream::TensorModifier<D, IT>> slicer;
-    std::shared_ptr<Jetstream::Duplicate<D, IT>> duplicate;
+    std::shared_ptr<Jetstream::Decimator<D, IT>> decimator;
+    std::shared_ptr<Jetstream::CicDecimator<D, IT>> cic;
 
     JST_DEFINE_IO()
 };
 
 }  // namespace Jetstream::Blocks
 
-JST_BLOCK_ENABLE(Decimator, is_specialized<Jetstream::Arithmetic<D, IT>>::value &&
-                            is_specialized<Jetstream::Duplicate<D, IT>>::value &&
+JST_BLOCK_ENABLE(Decimator, is_specialized<Jetstream::Decimator<D, IT>>::value &&
                             std::is_same<OT, void>::value)
 
 #endif
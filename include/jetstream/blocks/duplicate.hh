@@ -14,8 +14,9 @@ class Duplicate : public Block {
 
     struct Config {
         bool hostAccessible = true;
+        bool copyOnWrite = false;
 
-        JST_SERDES(hostAccessible);
+        JST_SERDES(hostAccessible, copyOnWrite);
     };
 
     constexpr const Config& getConfig() const {
@@ -72,7 +73,9 @@ class Duplicate : public Block {
         // TODO: Add decent block description describing internals and I/O.
         return "Duplicates the input signal by copying it to the output buffer. "
                "This block also converts non-contiguous input buffers to contiguous output buffers. "
-               "This block is also useful to transfer data between host and device with the `Host Acessible` option.";
+               "This block is also useful to transfer data between host and device with the `Host Acessible` option. "
+               "With the `Copy-on-Write` option, a contiguous CPU input is shared with the output instead of copied, "
+               "and the copy is only made if a downstream block modifies the output in-place.";
     }
 
     // Constructor
@@ -81,6 +84,7 @@ class Duplicate : public Block {
         JST_CHECK(instance().addModule(
             duplicate, "duplicate", {
                 .hostAccessible = config.hostAccessible,
+                .copyOnWrite = config.copyOnWrite,
             }, {
                 .buffer = input.buffer,
             },
@@ -112,6 +116,18 @@ class Duplicate : public Block {
                 JST_CHECK_NOTIFY(instance().reloadBlock(locale())); \
             });
         }
+
+        ImGui::TableNextRow();
+        ImGui::TableSetColumnIndex(0);
+        ImGui::TextUnformatted("Copy-on-Write");
+        ImGui::TableSetColumnIndex(1);
+        ImGui::SetNextItemWidth(-1);
+        if (ImGui::Checkbox("##CopyOnWrite", &config.copyOnWrite)) {
+            JST_DISPATCH_ASYNC([&](){ \
+                ImGui::InsertNotification({ ImGuiToastType_Info, 1000, "Reloading block..." }); \
+                JST_CHECK_NOTIFY(instance().reloadBlock(locale())); \
+            });
+        }
     }
 
     constexpr bool shouldDrawControl() const {
@@ -70,7 +70,9 @@ class FFT : public Block {
 
     std::string description() const {
         // TODO: Add decent block description describing internals and I/O.
-        return "Fast Fourier Transform that converts time-domain data to its frequency components. Supports real and complex data types.";
+        return "Fast Fourier Transform that converts time-domain data to its frequency components. Supports real and complex data types. "
+               "On the CPU, CI16 inputs are normalized to full scale CF32 and transformed in place, without an "
+               "intermediate Cast.";
     }
 
     // Constructor
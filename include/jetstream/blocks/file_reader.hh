@@ -21,8 +21,12 @@ class FileReader : public Block {
         bool playing = false;
         bool loop = true;
         std::string shape = "[8192]";
+        U64 batchSize = 1;
+        U64 readAhead = 0;
+        bool realTime = false;
+        F32 sampleRate = 0.0f;
 
-        JST_SERDES(fileFormat, filepath, playing, loop, shape);
+        JST_SERDES(fileFormat, filepath, playing, loop, shape, batchSize, readAhead, realTime, sampleRate);
     };
 
     constexpr const Config& getConfig() const {
@@ -75,7 +79,10 @@ class FileReader : public Block {
 
     std::string description() const {
         // TODO: Add decent block description describing internals and I/O.
-        return "Reads a signal from a file.";
+        return "Reads a signal from a file, either raw samples, a SigMF recording or a compressed recording. Outputs read from a "
+               "SigMF recording carry its sample rate and the frequency of the current capture. Playback runs "
+               "as fast as the graph consumes it, or paced at the sample rate in real-time mode, and can seek "
+               "to any sample or to the start of a capture.";
     }
 
     // Constructor
@@ -100,6 +107,10 @@ class FileReader : public Block {
                 .playing = config.playing,
                 .loop = config.loop,
                 .shape = parsedShape,
+                .batchSize = config.batchSize,
+                .readAhead = config.readAhead,
+                .realTime = config.realTime,
+                .sampleRate = config.sampleRate,
             }, {
             },
             locale()
@@ -165,6 +176,26 @@ class FileReader : public Block {
         ImGui::SetNextItemWidth(-1);
         ImGui::InputText("##Shape", &config.shape);
 
+        ImGui::TableNextRow();
+        ImGui::TableSetColumnIndex(0);
+        ImGui::TextUnformatted("Batch Size");
+        ImGui::TableSetColumnIndex(1);
+        ImGui::SetNextItemWidth(-1);
+        F32 batchSize = config.batchSize;
+        if (ImGui::InputFloat("##BatchSize", &batchSize, 1.0f, 1.0f, "%.0f")) {
+            config.batchSize = static_cast<U64>(std::max(batchSize, 1.0f));
+        }
+
+        ImGui::TableNextRow();
+        ImGui::TableSetColumnIndex(0);
+        ImGui::TextUnformatted("Read Ahead");
+        ImGui::TableSetColumnIndex(1);
+        ImGui::SetNextItemWidth(-1);
+        F32 readAhead = config.readAhead;
+        if (ImGui::InputFloat("##ReadAhead", &readAhead, 1.0f, 4.0f, "%.0f")) {
+            config.readAhead = static_cast<U64>(std::max(readAhead, 0.0f));
+        }
+
         ImGui::TableNextRow();
         ImGui::TableSetColumnIndex(0);
         ImGui::TextUnformatted("Loop");
@@ -172,6 +203,23 @@ class FileReader : public Block {
         ImGui::SetNextItemWidth(-1);
         ImGui::Checkbox("##Loop", &config.loop);
 
+        ImGui::TableNextRow();
+        ImGui::TableSetColumnIndex(0);
+        ImGui::TextUnformatted("Real Time");
+        ImGui::TableSetColumnIndex(1);
+        ImGui::SetNextItemWidth(-1);
+        ImGui::Checkbox("##RealTime", &config.realTime);
+
+        ImGui::TableNextRow();
+        ImGui::TableSetColumnIndex(0);
+        ImGui::TextUnformatted("Sample Rate");
+        ImGui::TableSetColumnIndex(1);
+        ImGui::SetNextItemWidth(-1);
+        F32 sampleRate = config.sampleRate / JST_MHZ;
+        if (ImGui::InputFloat("##SampleRate", &sampleRate, 1.0f, 1.0f, "%.3f MHz")) {
+            config.sampleRate = std::max(sampleRate, 0.0f) * JST_MHZ;
+        }
+
         if (file_reader->playing()) {
             ImGui::EndDisabled();
         }
@@ -192,6 +240,49 @@ class FileReader : public Block {
                 ImGui::SetNextItemWidth(-1);
                 ImGui::ProgressBar(progress, ImVec2(0.0f, 0.0f), progressOverlay.c_str());
             }
+
+            if (file_reader->playing() && file_reader->getNumberOfSamples() > 0) {
+                const U64 samples = file_reader->getNumberOfSamples();
+                const F32 sampleRate = file_reader->getSampleRate();
+
+                ImGui::TableNextRow();
+                ImGui::TableSetColumnIndex(0);
+                ImGui::TextUnformatted("Seek");
+                ImGui::TableSetColumnIndex(1);
+                ImGui::SetNextItemWidth(-1);
+                F32 seek = static_cast<F32>(file_reader->getCurrentSample()) / static_cast<F32>(samples) * 100.0f;
+                const auto seekOverlay = (sampleRate > 0.0f) ?
+                    jst::fmt::format("{:.2f} s", (seek / 100.0f) * static_cast<F32>(samples) / sampleRate) :
+                    jst::fmt::format("{:.1f}%", seek);
+                ImGui::SliderFloat("##Seek", &seek, 0.0f, 100.0f, seekOverlay.c_str());
+                if (ImGui::IsItemDeactivatedAfterEdit()) {
+                    JST_CHECK_NOTIFY(file_reader->seek(static_cast<U64>((seek / 100.0f) * static_cast<F32>(samples))));
+                }
+
+                const U64 captures = file_reader->getNumberOfCaptures();
+                for (U64 i = 0; captures > 1 && i < captures; i++) {
+                    ImGui::TableNextRow();
+                    ImGui::TableSetColumnIndex(0);
+                    ImGui::TableSetColumnIndex(1);
+                    const auto captureLabel = jst::fmt::format("Capture #{:02}", i);
+                    if (ImGui::Button(captureLabel.c_str(), ImVec2(fullWidth, 0))) {
+                        JST_CHECK_NOTIFY(file_reader->seekCapture(i));
+                    }
+                }
+            }
+
+            if (file_reader->playing() && config.readAhead > 0) {
+                const U64 buffered = file_reader->getReadAheadOccupancy();
+
+                ImGui::TableNextRow();
+                ImGui::TableSetColumnIndex(0);
+                ImGui::TextUnformatted("Buffered");
+                ImGui::TableSetColumnIndex(1);
+                const F32 ratio = static_cast<F32>(buffered) / static_cast<F32>(config.readAhead);
+                const auto bufferedOverlay = jst::fmt::format("{}/{} outputs", buffered, config.readAhead);
+                ImGui::SetNextItemWidth(-1);
+                ImGui::ProgressBar(ratio, ImVec2(0.0f, 0.0f), bufferedOverlay.c_str());
+            }
         }
 
         // Play/Pause controls
@@ -23,8 +23,11 @@ class FileWriter : public Block {
         F32 centerFrequency = 0.0f;
         bool overwrite = false;
         bool recording = false;
+        bool directIO = false;
+        U64 backlog = 64;
 
-        JST_SERDES(fileFormat, filepath, name, description, author, sampleRate, centerFrequency, overwrite, recording);
+        JST_SERDES(fileFormat, filepath, name, description, author, sampleRate, centerFrequency, overwrite, recording,
+                   directIO, backlog);
     };
 
     constexpr const Config& getConfig() const {
@@ -68,12 +71,16 @@ class FileWriter : public Block {
     }
 
     std::string summary() const {
-        return "Writes a signal to a file.";
+        return "Writes a signal to a file. Gated inputs, like the output of a Burst Detector, are only "
+               "written while the gate is open.";
     }
 
     std::string description() const {
         // TODO: Add decent block description describing internals and I/O.
-        return "Writes a signal to a file.";
+        return "Writes a signal to a file, either as raw samples or as a SigMF recording. SigMF recordings "
+               "add a metadata file with a capture for every retune of the source and an annotation for "
+               "every burst of a gated input. Compressed recordings quantize the samples to 16-bit integers and "
+               "compress them in chunks on the writer thread, taking a fraction of the space of raw samples.";
     }
 
     // Constructor
@@ -90,6 +97,8 @@ class FileWriter : public Block {
                 .centerFrequency = config.centerFrequency,
                 .overwrite = config.overwrite,
                 .recording = config.recording,
+                .directIO = config.directIO,
+                .backlog = config.backlog,
             }, {
                 .buffer = input.buffer,
             },
@@ -197,10 +206,60 @@ class FileWriter : public Block {
         ImGui::SetNextItemWidth(-1);
         ImGui::Checkbox("##Overwrite", &config.overwrite);
 
+        ImGui::TableNextRow();
+        ImGui::TableSetColumnIndex(0);
+        ImGui::TextUnformatted("Direct IO");
+        ImGui::TableSetColumnIndex(1);
+        ImGui::SetNextItemWidth(-1);
+        ImGui::Checkbox("##DirectIO", &config.directIO);
+
+        ImGui::TableNextRow();
+        ImGui::TableSetColumnIndex(0);
+        ImGui::TextUnformatted("Backlog");
+        ImGui::TableSetColumnIndex(1);
+        ImGui::SetNextItemWidth(-1);
+        F32 backlog = config.backlog;
+        if (ImGui::InputFloat("##Backlog", &backlog, 16.0f, 64.0f, "%.0f MB")) {
+            config.backlog = static_cast<U64>(std::max(backlog, 8.0f));
+        }
+
         if (file_writer->recording()) {
             ImGui::EndDisabled();
         }
 
+        // Writer statistics.
+        if (file_writer->recording()) {
+            const F32 writtenMB = static_cast<F32>(file_writer->getBytesWritten()) / JST_MB;
+            const F32 bandwidthMB = static_cast<F32>(file_writer->getWriteBandwidth()) / JST_MB;
+            const F32 backlogMB = static_cast<F32>(file_writer->getBacklog()) / JST_MB;
+            const F32 droppedMB = static_cast<F32>(file_writer->getBytesDropped()) / JST_MB;
+
+            ImGui::TableNextRow();
+            ImGui::TableSetColumnIndex(0);
+            ImGui::TextUnformatted("Written");
+            ImGui::TableSetColumnIndex(1);
+            ImGui::TextFormatted("{:.1f} MB ({:.0f} MB/s)", writtenMB, bandwidthMB);
+
+            if (config.fileFormat == FileFormatType::Compressed) {
+                const F32 storedMB = static_cast<F32>(file_writer->getBytesStored()) / JST_MB;
+
+                ImGui::TableNextRow();
+                ImGui::TableSetColumnIndex(0);
+                ImGui::TextUnformatted("Stored");
+                ImGui::TableSetColumnIndex(1);
+                ImGui::TextFormatted("{:.1f} MB ({:.1f}x)", storedMB, (storedMB > 0.0f) ? writtenMB / storedMB : 0.0f);
+            }
+
+            ImGui::TableNextRow();
+            ImGui::TableSetColumnIndex(0);
+            ImGui::TextUnformatted("Backlog");
+            ImGui::TableSetColumnIndex(1);
+            const F32 ratio = backlogMB / static_cast<F32>(config.backlog);
+            const auto backlogOverlay = jst::fmt::format("{:.0f}/{} MB ({:.1f} MB dropped)", backlogMB, config.backlog, droppedMB);
+            ImGui::SetNextItemWidth(-1);
+            ImGui::ProgressBar(ratio, ImVec2(0.0f, 0.0f), backlogOverlay.c_str());
+        }
+
         ImGui::TableNextRow();
         ImGui::TableSetColumnIndex(0);
         ImGui::TableSetColumnIndex(1);
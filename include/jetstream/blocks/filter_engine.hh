@@ -10,6 +10,8 @@
 #include "jetstream/modules/overlap_add.hh"
 #include "jetstream/modules/fold.hh"
 #include "jetstream/modules/tensor_modifier.hh"
+#include "jetstream/modules/xlating_filter.hh"
+#include "jetstream/modules/multiply_constant.hh"
 
 namespace Jetstream::Blocks {
 
@@ -76,7 +78,9 @@ class FilterEngine : public Block {
     std::string description() const {
         // TODO: Add decent block description describing internals and I/O.
         return "Filter the input signal using the provided filter taps. This block applies "
-               "the filter using the overlap-add method in the frequency domain.";
+               "the filter using the overlap-add method in the frequency domain. Short "
+               "single-head filters are applied directly in the time domain instead when "
+               "the device supports it and that's estimated to be cheaper.";
     }
 
     // Constructor
@@ -92,6 +96,15 @@ class FilterEngine : public Block {
         U64 signalMaxRank = input.signal.rank() - 1;
         const U64 signalSize = input.signal.shape()[signalMaxRank];
 
+        const bool resample = calculateResampleHeuristics(filterSize, signalSize);
+
+        if constexpr (is_specialized<Jetstream::XlatingFilter<D, IT>>::value &&
+                      is_specialized<Jetstream::MultiplyConstant<D, IT>>::value) {
+            if (shouldFilterDirectly(resample, filterSize, signalSize)) {
+                return createDirect(resample, filterSize, signalSize);
+            }
+        }
+
         JST_CHECK(instance().addModule(
             padSignal, "padSignal", {
                 .size = filterSize - 1,
@@ -161,7 +174,7 @@ class FilterEngine : public Block {
 
         auto ifftInput = multiply->getOutputProduct();
 
-        if (calculateResampleHeuristics(filterSize, signalSize)) {
+        if (resample) {
             JST_CHECK(instance().addModule(
                 fold, "fold", {
                     .axis = std::max(filterMaxRank, signalMaxRank),
@@ -211,6 +224,18 @@ class FilterEngine : public Block {
     }
 
     Result destroy() {
+        if (reshape) {
+            JST_CHECK(instance().eraseModule(reshape->locale()));
+        }
+
+        if (gain) {
+            JST_CHECK(instance().eraseModule(gain->locale()));
+        }
+
+        if (direct) {
+            JST_CHECK(instance().eraseModule(direct->locale()));
+        }
+
         if (overlap) {
             JST_CHECK(instance().eraseModule(overlap->locale()));
         }
@@ -274,6 +299,121 @@ class FilterEngine : public Block {
     std::shared_ptr<Jetstream::FFT<D, IT, IT>> ifft;
     std::shared_ptr<Jetstream::Unpad<D, IT>> unpad;
     std::shared_ptr<Jetstream::OverlapAdd<D, IT>> overlap;
+    std::shared_ptr<Jetstream::XlatingFilter<D, IT>> direct;
+    std::shared_ptr<Jetstream::MultiplyConstant<D, IT>> gain;
+    std::shared_ptr<Jetstream::TensorModifier<D, IT>> reshape;
+
+    // Rough cost of the frequency domain path in units of one complex tap of
+    // the direct form. Each transform is weighted per sample and radix-2
+    // stage, and each of the other module passes per sample. The weights put
+    // the crossover near 64 taps for a buffer of 8192 samples. Retune them with
+    // the FFT and Xlating Filter benchmarks.
+    static constexpr F64 FrequencyDomainStageCost = 1.5;
+    static constexpr F64 FrequencyDomainPassCost = 1.0;
+    static constexpr F64 FrequencyDomainPasses = 7.0;
+
+    U64 resamplerRatio(const bool& resample, const U64& filterSize, const U64& signalSize) const {
+        if (!resample || resamplerSize == 0) {
+            return 1;
+        }
+        return (filterSize + signalSize - 1) / resamplerSize;
+    }
+
+    bool shouldFilterDirectly(const bool& resample, const U64& filterSize, const U64& signalSize) const {
+        // The direct path uses one stream and one head.
+
+        if (input.signal.rank() > 2 || input.filter.rank() > 2) {
+            return false;
+        }
+
+        if (input.filter.rank() == 2 && input.filter.shape()[0] != 1) {
+            return false;
+        }
+
+        // The Xlating Filter rotates to baseband whenever the taps carry their
+        // center frequency, while the frequency domain path only shifts when
+        // resampling.
+
+        const auto& attributes = input.filter.attributes();
+        if (!resample && attributes.contains("center") && attributes.contains("sample_rate")) {
+            const auto& center = input.filter.attribute("center").template get<std::vector<F32>>();
+            if (std::any_of(center.begin(), center.end(), [](const F32& c) { return c != 0.0f; })) {
+                return false;
+            }
+        }
+
+        // Compare the estimated cost of both paths for the whole buffer.
+
+        const F64 ratio = static_cast<F64>(resamplerRatio(resample, filterSize, signalSize));
+        const F64 batch = static_cast<F64>(input.signal.size() / signalSize);
+        const F64 fullSize = static_cast<F64>(filterSize + signalSize - 1);
+        const F64 foldedSize = fullSize / ratio;
+
+        const F64 directCost = batch * (static_cast<F64>(signalSize) / ratio) * static_cast<F64>(filterSize);
+        const F64 frequencyDomainCost = FrequencyDomainStageCost * (
+                                            (batch + 1.0) * fullSize * std::log2(fullSize) +
+                                            batch * foldedSize * std::log2(foldedSize)
+                                        ) +
+                                        FrequencyDomainPassCost * FrequencyDomainPasses * batch * fullSize;
+
+        JST_DEBUG("[FILTER_ENGINE] Direct cost: {:.0f}; Frequency domain cost: {:.0f}.",
+                  directCost, frequencyDomainCost);
+
+        return directCost < frequencyDomainCost;
+    }
+
+    Result createDirect(const bool& resample, const U64& filterSize, const U64& signalSize) {
+        const U64 ratio = resamplerRatio(resample, filterSize, signalSize);
+
+        JST_CHECK(instance().addModule(
+            direct, "direct", {
+                .decimation = ratio,
+            }, {
+                .buffer = input.signal,
+                .filter = input.filter,
+            },
+            locale()
+        ));
+
+        // The frequency domain path doesn't normalize its inverse transform,
+        // so its output carries the transform size as a gain. It's matched
+        // here so both paths have the same level.
+
+        const F32 transformSize = static_cast<F32>((filterSize + signalSize - 1) / ratio);
+
+        JST_CHECK(instance().addModule(
+            gain, "gain", {
+                .constant = IT(transformSize),
+            }, {
+                .factor = direct->getOutputBuffer(),
+            },
+            locale()
+        ));
+
+        // Restore the shape of the frequency domain path, the filtered signal
+        // with one head axis before the samples when the filter has two.
+
+        std::vector<U64> shape = input.signal.shape();
+        shape.back() = signalSize / ratio;
+        if (input.filter.rank() == 2) {
+            shape.insert(shape.end() - 1, 1);
+        }
+
+        JST_CHECK(instance().addModule(
+            reshape, "reshape", {
+                .callback = [shape](auto& mod) {
+                    return mod.reshape(shape);
+                }
+            }, {
+                .buffer = gain->getOutputProduct(),
+            },
+            locale()
+        ));
+
+        JST_CHECK(Block::LinkOutput("buffer", output.buffer, reshape->getOutputBuffer()));
+
+        return Result::SUCCESS;
+    }
 
     bool calculateResampleHeuristics(const U64& filterSize, const U64& signalSize) {
         // Calculate default pad size without resampling.
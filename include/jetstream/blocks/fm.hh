@@ -14,8 +14,9 @@ class FM : public Block {
 
     struct Config {
         F32 sampleRate = 240e3f;
+        U64 axis = 0;
 
-        JST_SERDES(sampleRate);
+        JST_SERDES(sampleRate, axis);
     };
 
     constexpr const Config& getConfig() const {
@@ -69,8 +70,21 @@ class FM : public Block {
     }
 
     std::string description() const {
-        // TODO: Add decent block description describing internals and I/O.
-        return "Demodulates a complex-valued frequency modulated signal.";
+        return "Demodulates a complex-valued frequency modulated signal. The output is the phase difference "
+               "between consecutive samples, scaled for a 100 kHz deviation.\n\n"
+
+               "## Parameters\n"
+               "- **Sample Rate**: The sample rate of the input signal.\n"
+               "- **Axis**: The axis of the samples. Axes before it index independent channels, each one "
+               "demodulated with its own state. The default treats the whole input as a single stream.\n\n"
+
+               "## Examples:\n"
+               "- Single station:\n"
+               "  Config: Axis=0\n"
+               "  Input: CF32[8, 8000] → Output: F32[8, 8000]\n"
+               "- Stations from a channelizer:\n"
+               "  Config: Axis=1\n"
+               "  Input: CF32[32, 8000] → Output: F32[32, 8000]";
     }
 
     // Constructor
@@ -79,6 +93,7 @@ class FM : public Block {
         JST_CHECK(instance().addModule(
             fm, "fm", {
                 .sampleRate = config.sampleRate,
+                .axis = config.axis,
             }, {
                 .buffer = input.buffer,
             },
@@ -115,6 +130,23 @@ class FM : public Block {
                 JST_CHECK_NOTIFY(instance().reloadBlock(locale()));
             });
         }
+
+        ImGui::TableNextRow();
+        ImGui::TableSetColumnIndex(0);
+        ImGui::TextUnformatted("Axis");
+        ImGui::TableSetColumnIndex(1);
+        ImGui::SetNextItemWidth(-1);
+        F32 axis = config.axis;
+        if (ImGui::InputFloat("##axis", &axis, 1.0f, 1.0f, "%.0f", ImGuiInputTextFlags_EnterReturnsTrue)) {
+            if (axis >= 0 && axis < input.buffer.rank() && axis != config.axis) {
+                config.axis = static_cast<U64>(axis);
+
+                JST_DISPATCH_ASYNC([&](){
+                    ImGui::InsertNotification({ ImGuiToastType_Info, 1000, "Reloading block..." });
+                    JST_CHECK_NOTIFY(instance().reloadBlock(locale()));
+                });
+            }
+        }
     }
 
     constexpr bool shouldDrawControl() const {
@@ -0,0 +1,269 @@
+#ifndef JETSTREAM_BLOCK_HISTORY_BASE_HH
+#define JETSTREAM_BLOCK_HISTORY_BASE_HH
+
+#include "jetstream/block.hh"
+#include "jetstream/instance.hh"
+#include "jetstream/modules/history.hh"
+
+namespace Jetstream::Blocks {
+
+template<Device D, typename IT, typename OT>
+class History : public Block {
+ public:
+    // Configuration
+
+    struct Config {
+        F32 sampleRate = 1.0e6f;
+        F32 duration = 10.0f;
+        F32 window = 1.0f;
+        F32 delay = 0.0f;
+        bool hugePages = false;
+        bool pinned = false;
+
+        JST_SERDES(sampleRate, duration, window, delay, hugePages, pinned);
+    };
+
+    constexpr const Config& getConfig() const {
+        return config;
+    }
+
+    // Input
+
+    struct Input {
+        Tensor<D, IT> buffer;
+
+        JST_SERDES(buffer);
+    };
+
+    constexpr const Input& getInput() const {
+        return input;
+    }
+
+    // Output
+
+    struct Output {
+        Tensor<D, IT> buffer;
+
+        JST_SERDES(buffer);
+    };
+
+    constexpr const Output& getOutput() const {
+        return output;
+    }
+
+    constexpr const Tensor<D, IT>& getOutputBuffer() const {
+        return this->output.buffer;
+    }
+
+    // Housekeeping
+
+    constexpr Device device() const {
+        return D;
+    }
+
+    std::string id() const {
+        return "history";
+    }
+
+    std::string name() const {
+        return "History";
+    }
+
+    std::string summary() const {
+        return "Keeps the last seconds of a signal.";
+    }
+
+    std::string description() const {
+        return "The History block keeps the last seconds of a signal in memory, like a time machine. Each "
+               "buffer is a frame. The output is a window of the stored frames, ending a given delay before "
+               "the newest one, so an event can be analyzed again after it happened. Pressing Dump opens the "
+               "gate of the output for one frame. A File Writer fed by this block then writes the window, "
+               "capturing the seconds that led to the trigger instead of the ones after it.\n\n"
+
+               "## Parameters\n"
+               "- **Sample Rate**: The sample rate of the signal (in MHz).\n"
+               "- **Duration**: The length of signal kept in memory (in seconds).\n"
+               "- **Window**: The length of the output (in seconds).\n"
+               "- **Delay**: The age of the end of the window (in seconds). Changes without a reload.\n"
+               "- **Huge Pages**: Backs the memory with huge pages.\n"
+               "- **Pinned**: Registers the memory with CUDA for asynchronous copies.\n\n"
+
+               "## Useful For:\n"
+               "- Recording a transmission after noticing it.\n"
+               "- Scrubbing through the recent past of a signal.\n\n"
+
+               "## Examples:\n"
+               "- Dump the last second of a capture:\n"
+               "  Source → History → File Writer\n"
+               "  Input: CF32[8, 8192] → Output: CF32[8 * window frames, 8192]\n\n"
+
+               "## Implementation:\n"
+               "Input → History → Output\n"
+               "1. The newest frame is copied into a ring allocated once.\n"
+               "2. The start of the ring is repeated past its end, so every window is contiguous.\n"
+               "3. The output points to the window inside the ring, so moving it doesn't copy.\n"
+               "4. The gate is set as an attribute of the output and read by the consumers.";
+    }
+
+    // Constructor
+
+    Result create() {
+        JST_CHECK(instance().addModule(
+            history, "history", {
+                .sampleRate = config.sampleRate,
+                .duration = config.duration,
+                .window = config.window,
+                .delay = config.delay,
+                .hugePages = config.hugePages,
+                .pinned = config.pinned,
+            }, {
+                .buffer = input.buffer,
+            },
+            locale()
+        ));
+
+        JST_CHECK(Block::LinkOutput("buffer", output.buffer, history->getOutputBuffer()));
+
+        return Result::SUCCESS;
+    }
+
+    Result destroy() {
+        if (history) {
+            JST_CHECK(instance().eraseModule(history->locale()));
+        }
+
+        return Result::SUCCESS;
+    }
+
+    // Interface
+
+    void drawInfo() {
+        ImGui::TableNextRow();
+        ImGui::TableSetColumnIndex(0);
+        ImGui::TextUnformatted("Frames");
+        ImGui::TableSetColumnIndex(1);
+        ImGui::TextFormatted("{} / {}", history->frames(), history->capacity());
+
+        ImGui::TableNextRow();
+        ImGui::TableSetColumnIndex(0);
+        ImGui::TextUnformatted("Dumps");
+        ImGui::TableSetColumnIndex(1);
+        ImGui::TextFormatted("{}", history->triggers());
+    }
+
+    constexpr bool shouldDrawInfo() const {
+        return true;
+    }
+
+    void drawControl() {
+        ImGui::TableNextRow();
+        ImGui::TableSetColumnIndex(0);
+        ImGui::TextUnformatted("Sample Rate");
+        ImGui::TableSetColumnIndex(1);
+        ImGui::SetNextItemWidth(-1);
+        F32 sampleRate = config.sampleRate / JST_MHZ;
+        if (ImGui::InputFloat("##history-sample-rate", &sampleRate, 1.0f, 1.0f, "%.3f MHz", ImGuiInputTextFlags_EnterReturnsTrue)) {
+            if (sampleRate > 0.0f) {
+                config.sampleRate = sampleRate * JST_MHZ;
+
+                JST_DISPATCH_ASYNC([&](){
+                    ImGui::InsertNotification({ ImGuiToastType_Info, 1000, "Reloading block..." });
+                    JST_CHECK_NOTIFY(instance().reloadBlock(locale()));
+                });
+            }
+        }
+
+        ImGui::TableNextRow();
+        ImGui::TableSetColumnIndex(0);
+        ImGui::TextUnformatted("Duration");
+        ImGui::TableSetColumnIndex(1);
+        ImGui::SetNextItemWidth(-1);
+        F32 duration = config.duration;
+        if (ImGui::InputFloat("##history-duration", &duration, 1.0f, 10.0f, "%.1f s", ImGuiInputTextFlags_EnterReturnsTrue)) {
+            if (duration > 0.0f) {
+                config.duration = duration;
+
+                JST_DISPATCH_ASYNC([&](){
+                    ImGui::InsertNotification({ ImGuiToastType_Info, 1000, "Reloading block..." });
+                    JST_CHECK_NOTIFY(instance().reloadBlock(locale()));
+                });
+            }
+        }
+
+        ImGui::TableNextRow();
+        ImGui::TableSetColumnIndex(0);
+        ImGui::TextUnformatted("Window");
+        ImGui::TableSetColumnIndex(1);
+        ImGui::SetNextItemWidth(-1);
+        F32 window = config.window;
+        if (ImGui::InputFloat("##history-window", &window, 0.1f, 1.0f, "%.2f s", ImGuiInputTextFlags_EnterReturnsTrue)) {
+            if (window > 0.0f) {
+                config.window = window;
+
+                JST_DISPATCH_ASYNC([&](){
+                    ImGui::InsertNotification({ ImGuiToastType_Info, 1000, "Reloading block..." });
+                    JST_CHECK_NOTIFY(instance().reloadBlock(locale()));
+                });
+            }
+        }
+
+        ImGui::TableNextRow();
+        ImGui::TableSetColumnIndex(0);
+        ImGui::TextUnformatted("Delay");
+        ImGui::TableSetColumnIndex(1);
+        ImGui::SetNextItemWidth(-1);
+        F32 delay = config.delay;
+        if (ImGui::InputFloat("##history-delay", &delay, 0.1f, 1.0f, "%.2f s", ImGuiInputTextFlags_EnterReturnsTrue)) {
+            config.delay = delay;
+            JST_MODULE_UPDATE(history, setDelay(config.delay));
+        }
+
+        ImGui::TableNextRow();
+        ImGui::TableSetColumnIndex(0);
+        ImGui::TextUnformatted("Huge Pages");
+        ImGui::TableSetColumnIndex(1);
+        ImGui::SetNextItemWidth(-1);
+        if (ImGui::Checkbox("##history-huge-pages", &config.hugePages)) {
+            JST_DISPATCH_ASYNC([&](){
+                ImGui::InsertNotification({ ImGuiToastType_Info, 1000, "Reloading block..." });
+                JST_CHECK_NOTIFY(instance().reloadBlock(locale()));
+            });
+        }
+
+        ImGui::TableNextRow();
+        ImGui::TableSetColumnIndex(0);
+        ImGui::TextUnformatted("Pinned");
+        ImGui::TableSetColumnIndex(1);
+        ImGui::SetNextItemWidth(-1);
+        if (ImGui::Checkbox("##history-pinned", &config.pinned)) {
+            JST_DISPATCH_ASYNC([&](){
+                ImGui::InsertNotification({ ImGuiToastType_Info, 1000, "Reloading block..." });
+                JST_CHECK_NOTIFY(instance().reloadBlock(locale()));
+            });
+        }
+
+        ImGui::TableNextRow();
+        ImGui::TableSetColumnIndex(0);
+        ImGui::TableSetColumnIndex(1);
+        const F32 fullWidth = ImGui::GetContentRegionAvail().x;
+        if (ImGui::Button("Dump", ImVec2(fullWidth, 0))) {
+            history->trigger();
+        }
+    }
+
+    constexpr bool shouldDrawControl() const {
+        return true;
+    }
+
+ private:
+    std::shared_ptr<Jetstream::History<D, IT>> history;
+
+    JST_DEFINE_IO()
+};
+
+}  // namespace Jetstream::Blocks
+
+JST_BLOCK_ENABLE(History, is_specialized<Jetstream::History<D, IT>>::value &&
+                          std::is_same<OT, void>::value)
+
+#endif
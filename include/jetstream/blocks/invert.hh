@@ -13,7 +13,9 @@ class Invert : public Block {
     // Configuration
 
     struct Config {
-        JST_SERDES();
+        bool inPlace = false;
+
+        JST_SERDES(inPlace);
     };
 
     constexpr const Config& getConfig() const {
@@ -68,14 +70,18 @@ class Invert : public Block {
 
     std::string description() const {
         // TODO: Add decent block description describing internals and I/O.
-        return "Inverts the complex-valued input signal. Useful for ploting the spectrum of a signal.";
+        return "Inverts the complex-valued input signal. Useful for ploting the spectrum of a signal. "
+               "With `In-Place`, the result is written over the input on the CPU, "
+               "which requires the other readers of the input to run first.";
     }
 
     // Constructor
 
     Result create() {
         JST_CHECK(instance().addModule(
-            invert, "invert", {}, {
+            invert, "invert", {
+                .inPlace = config.inPlace,
+            }, {
                 .buffer = input.buffer,
             },
             locale()
@@ -94,6 +100,26 @@ class Invert : public Block {
         return Result::SUCCESS;
     }
 
+    // Interface
+
+    void drawControl() {
+        ImGui::TableNextRow();
+        ImGui::TableSetColumnIndex(0);
+        ImGui::TextUnformatted("In-Place");
+        ImGui::TableSetColumnIndex(1);
+        ImGui::SetNextItemWidth(-1);
+        if (ImGui::Checkbox("##InPlace", &config.inPlace)) {
+            JST_DISPATCH_ASYNC([&](){
+                ImGui::InsertNotification({ ImGuiToastType_Info, 1000, "Reloading block..." });
+                JST_CHECK_NOTIFY(instance().reloadBlock(locale()));
+            });
+        }
+    }
+
+    constexpr bool shouldDrawControl() const {
+        return true;
+    }
+
  private:
     std::shared_ptr<Jetstream::Invert<D, IT>> invert;
 
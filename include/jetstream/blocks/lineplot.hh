@@ -15,6 +15,7 @@ class Lineplot : public Block {
     struct Config {
         U64 averaging = 1;
         U64 decimation = 1;
+        LineplotDecimation decimationMode = LineplotDecimation::Average;
         U64 numberOfVerticalLines = 11;
         U64 numberOfHorizontalLines = 5;
         Extent2D<U64> viewSize = {512, 384};
@@ -22,7 +23,7 @@ class Lineplot : public Block {
         F32 translation = 0.0f;
         F32 thickness = 1.0f;
 
-        JST_SERDES(averaging, decimation, numberOfVerticalLines, numberOfHorizontalLines, viewSize, zoom, translation, thickness);
+        JST_SERDES(averaging, decimation, decimationMode, numberOfVerticalLines, numberOfHorizontalLines, viewSize, zoom, translation, thickness);
     };
 
     constexpr const Config& getConfig() const {
@@ -81,6 +82,7 @@ class Lineplot : public Block {
             lineplot, "lineplot", {
                 .averaging = config.averaging,
                 .decimation = config.decimation,
+                .decimationMode = config.decimationMode,
                 .numberOfVerticalLines = config.numberOfVerticalLines,
                 .numberOfHorizontalLines = config.numberOfHorizontalLines,
                 .viewSize = config.viewSize,
@@ -120,7 +122,7 @@ class Lineplot : public Block {
     }
 
     void drawView() {
-        lineplot->scale(ImGui::GetIO().DisplayFramebufferScale.x);
+        lineplot->scale(ImGui::GetIO().DisplayFramebufferScale.x * instance().quality().resolutionScale());
 
         const auto& viewSize = lineplot->viewSize(GetContentRegion());
         ImGui::Image(ImTextureRef(lineplot->getTexture().raw()), ImVec2(viewSize.x, viewSize.y));
@@ -176,6 +178,25 @@ class Lineplot : public Block {
         if (ImGui::DragFloat("##Averaging", &averaging, 1.0f, 1.0f, 16384.0f, "%.0f", ImGuiSliderFlags_AlwaysClamp)) {
             config.averaging = lineplot->averaging(static_cast<U64>(averaging));
         }
+
+        ImGui::TableNextRow();
+        ImGui::TableSetColumnIndex(0);
+        ImGui::TextUnformatted("Decimation");
+        ImGui::TableSetColumnIndex(1);
+        ImGui::SetNextItemWidth(-1);
+        if (ImGui::BeginCombo("##DecimationMode", config.decimationMode.string().c_str())) {
+            for (const auto& [key, value] : config.decimationMode.rmap()) {
+                bool isSelected = (config.decimationMode == key);
+                if (ImGui::Selectable(value.c_str(), isSelected)) {
+                    config.decimationMode = key;
+                    JST_CHECK_NOTIFY(instance().reloadBlock(locale()));
+                }
+                if (isSelected) {
+                    ImGui::SetItemDefaultFocus();
+                }
+            }
+            ImGui::EndCombo();
+        }
     }
 
     constexpr bool shouldDrawControl() const {
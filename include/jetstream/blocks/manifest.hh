@@ -19,13 +19,20 @@ namespace Jetstream::Blocks {
     JST_BLOCKS_MANIFEST_ADD(BLOCK, DEVICE, void, void) \
     JST_BLOCKS_MANIFEST_ADD(BLOCK, DEVICE, CF32, void) \
     JST_BLOCKS_MANIFEST_ADD(BLOCK, DEVICE, F32, void) \
+    JST_BLOCKS_MANIFEST_ADD(BLOCK, DEVICE, CI16, void) \
+    JST_BLOCKS_MANIFEST_ADD(BLOCK, DEVICE, CI8, void) \
     JST_BLOCKS_MANIFEST_ADD(BLOCK, DEVICE, void, CF32) \
     JST_BLOCKS_MANIFEST_ADD(BLOCK, DEVICE, void, F32) \
     JST_BLOCKS_MANIFEST_ADD(BLOCK, DEVICE, CF32, CF32) \
     JST_BLOCKS_MANIFEST_ADD(BLOCK, DEVICE, CF32, F32) \
+    JST_BLOCKS_MANIFEST_ADD(BLOCK, DEVICE, CF32, CI16) \
     JST_BLOCKS_MANIFEST_ADD(BLOCK, DEVICE, F32, CF32) \
     JST_BLOCKS_MANIFEST_ADD(BLOCK, DEVICE, F32, F32) \
-    JST_BLOCKS_MANIFEST_ADD(BLOCK, DEVICE, F32, I16)
+    JST_BLOCKS_MANIFEST_ADD(BLOCK, DEVICE, F32, I16) \
+    JST_BLOCKS_MANIFEST_ADD(BLOCK, DEVICE, CI8, CF32) \
+    JST_BLOCKS_MANIFEST_ADD(BLOCK, DEVICE, CI16, CF32) \
+    JST_BLOCKS_MANIFEST_ADD(BLOCK, DEVICE, CU8, CF32) \
+    JST_BLOCKS_MANIFEST_ADD(BLOCK, DEVICE, U8, CF32)
     
 #define JST_BLOCKS_MANIFEST_DEVICE(BLOCK) \
     JST_BLOCKS_MANIFEST_TYPE(BLOCK, Device::CPU) \
@@ -112,6 +119,9 @@ inline void GetDefaultManifest(Block::ConstructorManifest& constructorManifest,
 #ifdef JETSTREAM_BLOCK_SOAPY_AVAILABLE
     JST_BLOCKS_MANIFEST(Blocks::Soapy);
 #endif
+#ifdef JETSTREAM_BLOCK_SOAPY_SINK_AVAILABLE
+    JST_BLOCKS_MANIFEST(Blocks::SoapySink);
+#endif
 #ifdef JETSTREAM_BLOCK_MULTIPLY_AVAILABLE
     JST_BLOCKS_MANIFEST(Blocks::Multiply);
 #endif
@@ -200,15 +210,45 @@ inline void GetDefaultManifest(Block::ConstructorManifest& constructorManifest,
 #ifdef JETSTREAM_BLOCK_FILE_READER_AVAILABLE
     JST_BLOCKS_MANIFEST(Blocks::FileReader);
 #endif
+#ifdef JETSTREAM_BLOCK_NETWORK_SINK_AVAILABLE
+    JST_BLOCKS_MANIFEST(Blocks::NetworkSink);
+#endif
+#ifdef JETSTREAM_BLOCK_NETWORK_SOURCE_AVAILABLE
+    JST_BLOCKS_MANIFEST(Blocks::NetworkSource);
+#endif
+#ifdef JETSTREAM_BLOCK_SHARED_MEMORY_SINK_AVAILABLE
+    JST_BLOCKS_MANIFEST(Blocks::SharedMemorySink);
+#endif
+#ifdef JETSTREAM_BLOCK_SHARED_MEMORY_SOURCE_AVAILABLE
+    JST_BLOCKS_MANIFEST(Blocks::SharedMemorySource);
+#endif
 #ifdef JETSTREAM_BLOCK_THROTTLE_AVAILABLE
     JST_BLOCKS_MANIFEST(Blocks::Throttle);
 #endif
 #ifdef JETSTREAM_BLOCK_DECIMATOR_AVAILABLE
     JST_BLOCKS_MANIFEST(Blocks::Decimator);
 #endif
+#ifdef JETSTREAM_BLOCK_CHANNELIZER_AVAILABLE
+    JST_BLOCKS_MANIFEST(Blocks::Channelizer);
+#endif
+#ifdef JETSTREAM_BLOCK_XLATING_FILTER_AVAILABLE
+    JST_BLOCKS_MANIFEST(Blocks::XlatingFilter);
+#endif
+#ifdef JETSTREAM_BLOCK_RESAMPLER_AVAILABLE
+    JST_BLOCKS_MANIFEST(Blocks::Resampler);
+#endif
 #ifdef JETSTREAM_BLOCK_SPECTRUM_ENGINE_AVAILABLE
     JST_BLOCKS_MANIFEST(Blocks::SpectrumEngine);
 #endif
+#ifdef JETSTREAM_BLOCK_ZOOM_FFT_AVAILABLE
+    JST_BLOCKS_MANIFEST(Blocks::ZoomFFT);
+#endif
+#ifdef JETSTREAM_BLOCK_SPECTRUM_MEASURE_AVAILABLE
+    JST_BLOCKS_MANIFEST(Blocks::SpectrumMeasure);
+#endif
+#ifdef JETSTREAM_BLOCK_BURST_DETECTOR_AVAILABLE
+    JST_BLOCKS_MANIFEST(Blocks::BurstDetector);
+#endif
 #ifdef JETSTREAM_BLOCK_SIGNAL_GENERATOR_AVAILABLE
     JST_BLOCKS_MANIFEST(Blocks::SignalGenerator);
 #endif
@@ -220,6 +260,15 @@ inline void GetDefaultManifest(Block::ConstructorManifest& constructorManifest,
 #endif
 #ifdef JETSTREAM_BLOCK_ADD_AVAILABLE
     JST_BLOCKS_MANIFEST(Blocks::Add);
+#endif
+#ifdef JETSTREAM_BLOCK_SLIDING_FFT_AVAILABLE
+    JST_BLOCKS_MANIFEST(Blocks::SlidingFFT);
+#endif
+#ifdef JETSTREAM_BLOCK_CORRELATOR_AVAILABLE
+    JST_BLOCKS_MANIFEST(Blocks::Correlator);
+#endif
+#ifdef JETSTREAM_BLOCK_HISTORY_AVAILABLE
+    JST_BLOCKS_MANIFEST(Blocks::History);
 #endif
     // [NEW BLOCK HOOK]
 }
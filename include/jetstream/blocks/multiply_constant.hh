@@ -14,8 +14,9 @@ class MultiplyConstant : public Block {
 
     struct Config {
         IT constant;
+        bool inPlace = false;
 
-        JST_SERDES(constant);
+        JST_SERDES(constant, inPlace);
     };
 
     constexpr const Config& getConfig() const {
@@ -70,14 +71,19 @@ class MultiplyConstant : public Block {
 
     std::string description() const {
         // TODO: Add decent block description describing internals and I/O.
-        return "Takes 'factor' as input and multiplied it with the const value producing the result as 'product'.";
+        return "Takes 'factor' as input and multiplied it with the const value producing the result as 'product'. "
+               "With `In-Place`, the result is written over the input on the CPU, "
+               "which requires the other readers of the input to run first.";
     }
 
     // Constructor
 
     Result create() {
         JST_CHECK(instance().addModule(
-            multiply, "multiply", {}, {
+            multiply, "multiply", {
+                .constant = config.constant,
+                .inPlace = config.inPlace,
+            }, {
                 .factor = input.factor,
             },
             locale()
@@ -113,6 +119,18 @@ class MultiplyConstant : public Block {
                 JST_CHECK_NOTIFY(instance().reloadBlock(locale()));
             });
         }
+
+        ImGui::TableNextRow();
+        ImGui::TableSetColumnIndex(0);
+        ImGui::TextUnformatted("In-Place");
+        ImGui::TableSetColumnIndex(1);
+        ImGui::SetNextItemWidth(-1);
+        if (ImGui::Checkbox("##InPlace", &config.inPlace)) {
+            JST_DISPATCH_ASYNC([&](){
+                ImGui::InsertNotification({ ImGuiToastType_Info, 1000, "Reloading block..." });
+                JST_CHECK_NOTIFY(instance().reloadBlock(locale()));
+            });
+        }
     }
 
     constexpr bool shouldDrawControl() const {
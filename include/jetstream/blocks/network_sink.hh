@@ -0,0 +1,285 @@
+#ifndef JETSTREAM_BLOCK_NETWORK_SINK_BASE_HH
+#define JETSTREAM_BLOCK_NETWORK_SINK_BASE_HH
+
+#include "jetstream/block.hh"
+#include "jetstream/instance.hh"
+#include "jetstream/modules/network_sink.hh"
+
+namespace Jetstream::Blocks {
+
+template<Device D, typename IT, typename OT>
+class NetworkSink : public Block {
+ public:
+    // Configuration
+
+    struct Config {
+        NetworkProtocolType protocol = NetworkProtocolType::UDP;
+        std::string address = "127.0.0.1";
+        U64 port = 5000;
+        U64 packetSize = 8192;
+        U64 batchSize = 1;
+        U64 multicastTtl = 1;
+        NetworkCompressionType compression = NetworkCompressionType::None;
+
+        JST_SERDES(protocol, address, port, packetSize, batchSize, multicastTtl, compression);
+    };
+
+    constexpr const Config& getConfig() const {
+        return config;
+    }
+
+    // Input
+
+    struct Input {
+        Tensor<D, IT> buffer;
+
+        JST_SERDES(buffer);
+    };
+
+    constexpr const Input& getInput() const {
+        return input;
+    }
+
+    // Output
+
+    struct Output {
+        JST_SERDES();
+    };
+
+    constexpr const Output& getOutput() const {
+        return output;
+    }
+
+    // Housekeeping
+
+    constexpr Device device() const {
+        return D;
+    }
+
+    std::string id() const {
+        return "network-sink";
+    }
+
+    std::string name() const {
+        return "Network Sink";
+    }
+
+    std::string summary() const {
+        return "Streams a signal to the network over UDP or TCP.";
+    }
+
+    std::string description() const {
+        // TODO: Add decent block description describing internals and I/O.
+        return "Streams every input to the network, to be received by a Network Source in another flowgraph. "
+               "With UDP, inputs are split in datagrams sent to a unicast or multicast address, and are dropped "
+               "when the socket can't keep up. With TCP, the block listens on the address and streams to every "
+               "connected client. Each record carries a sequence number so the receiver can detect losses. "
+               "Compression quantizes every input to 16 or 8-bit integers scaled to its peak, the Network Source "
+               "restores the floats.";
+    }
+
+    // Constructor
+
+    Result create() {
+        JST_CHECK(instance().addModule(
+            network_sink, "network_sink", {
+                .protocol = config.protocol,
+                .address = config.address,
+                .port = config.port,
+                .packetSize = config.packetSize,
+                .batchSize = config.batchSize,
+                .multicastTtl = config.multicastTtl,
+                .compression = config.compression,
+            }, {
+                .buffer = input.buffer,
+            },
+            locale()
+        ));
+
+        return Result::SUCCESS;
+    }
+
+    Result destroy() {
+        if (network_sink) {
+            JST_CHECK(instance().eraseModule(network_sink->locale()));
+        }
+
+        return Result::SUCCESS;
+    }
+
+    // Interface
+
+    void drawInfo() {
+        const F32 sentMB = static_cast<F32>(network_sink->getBytesSent()) / JST_MB;
+
+        ImGui::TableNextRow();
+        ImGui::TableSetColumnIndex(0);
+        ImGui::TextUnformatted("Sent");
+        ImGui::TableSetColumnIndex(1);
+        ImGui::TextFormatted("{} frames ({:.1f} MB)", network_sink->getFramesSent(), sentMB);
+
+        ImGui::TableNextRow();
+        ImGui::TableSetColumnIndex(0);
+        ImGui::TextUnformatted("Dropped");
+        ImGui::TableSetColumnIndex(1);
+        ImGui::TextFormatted("{} frames", network_sink->getFramesDropped());
+
+        if (config.protocol == NetworkProtocolType::TCP) {
+            ImGui::TableNextRow();
+            ImGui::TableSetColumnIndex(0);
+            ImGui::TextUnformatted("Clients");
+            ImGui::TableSetColumnIndex(1);
+            ImGui::TextFormatted("{}", network_sink->getNumberOfClients());
+        }
+    }
+
+    constexpr bool shouldDrawInfo() const {
+        return true;
+    }
+
+    void drawControl() {
+        ImGui::TableNextRow();
+        ImGui::TableSetColumnIndex(0);
+        ImGui::TextUnformatted("Protocol");
+        ImGui::TableSetColumnIndex(1);
+        ImGui::SetNextItemWidth(-1);
+        if (ImGui::BeginCombo("##Protocol", config.protocol.string().c_str())) {
+            for (const auto& [key, value] : config.protocol.rmap()) {
+                bool isSelected = (config.protocol == key);
+                if (ImGui::Selectable(value.c_str(), isSelected)) {
+                    config.protocol = key;
+
+                    JST_DISPATCH_ASYNC([&](){
+                        ImGui::InsertNotification({ ImGuiToastType_Info, 1000, "Reloading block..." });
+                        JST_CHECK_NOTIFY(instance().reloadBlock(locale()));
+                    });
+                }
+                if (isSelected) {
+                    ImGui::SetItemDefaultFocus();
+                }
+            }
+            ImGui::EndCombo();
+        }
+
+        ImGui::TableNextRow();
+        ImGui::TableSetColumnIndex(0);
+        ImGui::TextUnformatted("Address");
+        ImGui::TableSetColumnIndex(1);
+        ImGui::SetNextItemWidth(-1);
+        if (ImGui::InputText("##Address", &config.address, ImGuiInputTextFlags_EnterReturnsTrue)) {
+            JST_DISPATCH_ASYNC([&](){
+                ImGui::InsertNotification({ ImGuiToastType_Info, 1000, "Reloading block..." });
+                JST_CHECK_NOTIFY(instance().reloadBlock(locale()));
+            });
+        }
+
+        ImGui::TableNextRow();
+        ImGui::TableSetColumnIndex(0);
+        ImGui::TextUnformatted("Port");
+        ImGui::TableSetColumnIndex(1);
+        ImGui::SetNextItemWidth(-1);
+        F32 port = config.port;
+        if (ImGui::InputFloat("##Port", &port, 1.0f, 1.0f, "%.0f", ImGuiInputTextFlags_EnterReturnsTrue)) {
+            if (port >= 1.0f && port <= 65535.0f) {
+                config.port = static_cast<U64>(port);
+
+                JST_DISPATCH_ASYNC([&](){
+                    ImGui::InsertNotification({ ImGuiToastType_Info, 1000, "Reloading block..." });
+                    JST_CHECK_NOTIFY(instance().reloadBlock(locale()));
+                });
+            }
+        }
+
+        ImGui::TableNextRow();
+        ImGui::TableSetColumnIndex(0);
+        ImGui::TextUnformatted("Packet Size");
+        ImGui::TableSetColumnIndex(1);
+        ImGui::SetNextItemWidth(-1);
+        F32 packetSize = config.packetSize;
+        if (ImGui::InputFloat("##PacketSize", &packetSize, 512.0f, 1024.0f, "%.0f B", ImGuiInputTextFlags_EnterReturnsTrue)) {
+            if (packetSize >= 512.0f && packetSize <= 65507.0f) {
+                config.packetSize = static_cast<U64>(packetSize);
+
+                JST_DISPATCH_ASYNC([&](){
+                    ImGui::InsertNotification({ ImGuiToastType_Info, 1000, "Reloading block..." });
+                    JST_CHECK_NOTIFY(instance().reloadBlock(locale()));
+                });
+            }
+        }
+
+        ImGui::TableNextRow();
+        ImGui::TableSetColumnIndex(0);
+        ImGui::TextUnformatted("Batch Size");
+        ImGui::TableSetColumnIndex(1);
+        ImGui::SetNextItemWidth(-1);
+        F32 batchSize = config.batchSize;
+        if (ImGui::InputFloat("##BatchSize", &batchSize, 1.0f, 1.0f, "%.0f", ImGuiInputTextFlags_EnterReturnsTrue)) {
+            if (batchSize >= 1.0f) {
+                config.batchSize = static_cast<U64>(batchSize);
+
+                JST_DISPATCH_ASYNC([&](){
+                    ImGui::InsertNotification({ ImGuiToastType_Info, 1000, "Reloading block..." });
+                    JST_CHECK_NOTIFY(instance().reloadBlock(locale()));
+                });
+            }
+        }
+
+        ImGui::TableNextRow();
+        ImGui::TableSetColumnIndex(0);
+        ImGui::TextUnformatted("Compression");
+        ImGui::TableSetColumnIndex(1);
+        ImGui::SetNextItemWidth(-1);
+        if (ImGui::BeginCombo("##Compression", config.compression.string().c_str())) {
+            for (const auto& [key, value] : config.compression.rmap()) {
+                bool isSelected = (config.compression == key);
+                if (ImGui::Selectable(value.c_str(), isSelected)) {
+                    config.compression = key;
+
+                    JST_DISPATCH_ASYNC([&](){
+                        ImGui::InsertNotification({ ImGuiToastType_Info, 1000, "Reloading block..." });
+                        JST_CHECK_NOTIFY(instance().reloadBlock(locale()));
+                    });
+                }
+                if (isSelected) {
+                    ImGui::SetItemDefaultFocus();
+                }
+            }
+            ImGui::EndCombo();
+        }
+
+        if (config.protocol == NetworkProtocolType::UDP) {
+            ImGui::TableNextRow();
+            ImGui::TableSetColumnIndex(0);
+            ImGui::TextUnformatted("Multicast TTL");
+            ImGui::TableSetColumnIndex(1);
+            ImGui::SetNextItemWidth(-1);
+            F32 multicastTtl = config.multicastTtl;
+            if (ImGui::InputFloat("##MulticastTtl", &multicastTtl, 1.0f, 1.0f, "%.0f", ImGuiInputTextFlags_EnterReturnsTrue)) {
+                if (multicastTtl >= 0.0f && multicastTtl <= 255.0f) {
+                    config.multicastTtl = static_cast<U64>(multicastTtl);
+
+                    JST_DISPATCH_ASYNC([&](){
+                        ImGui::InsertNotification({ ImGuiToastType_Info, 1000, "Reloading block..." });
+                        JST_CHECK_NOTIFY(instance().reloadBlock(locale()));
+                    });
+                }
+            }
+        }
+    }
+
+    constexpr bool shouldDrawControl() const {
+        return true;
+    }
+
+ private:
+    std::shared_ptr<Jetstream::NetworkSink<D, IT>> network_sink;
+
+    JST_DEFINE_IO()
+};
+
+}  // namespace Jetstream::Blocks
+
+JST_BLOCK_ENABLE(NetworkSink, is_specialized<Jetstream::NetworkSink<D, IT>>::value &&
+                              std::is_same<OT, void>::value)
+
+#endif
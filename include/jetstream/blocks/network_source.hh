@@ -0,0 +1,264 @@
+#ifndef JETSTREAM_BLOCK_NETWORK_SOURCE_BASE_HH
+#define JETSTREAM_BLOCK_NETWORK_SOURCE_BASE_HH
+
+#include <regex>
+
+#include "jetstream/block.hh"
+#include "jetstream/instance.hh"
+#include "jetstream/modules/network_source.hh"
+
+namespace Jetstream::Blocks {
+
+template<Device D, typename IT, typename OT>
+class NetworkSource : public Block {
+ public:
+    // Configuration
+
+    struct Config {
+        NetworkProtocolType protocol = NetworkProtocolType::UDP;
+        std::string address = "0.0.0.0";
+        U64 port = 5000;
+        std::string shape = "[8192]";
+        U64 bufferMultiplier = 8;
+
+        JST_SERDES(protocol, address, port, shape, bufferMultiplier);
+    };
+
+    constexpr const Config& getConfig() const {
+        return config;
+    }
+
+    // Input
+
+    struct Input {
+        JST_SERDES();
+    };
+
+    constexpr const Input& getInput() const {
+        return input;
+    }
+
+    // Output
+
+    struct Output {
+        Tensor<D, IT> buffer;
+
+        JST_SERDES(buffer);
+    };
+
+    constexpr const Output& getOutput() const {
+        return output;
+    }
+
+    constexpr const Tensor<D, IT>& getOutputBuffer() const {
+        return this->output.buffer;
+    }
+
+    // Housekeeping
+
+    constexpr Device device() const {
+        return D;
+    }
+
+    std::string id() const {
+        return "network-source";
+    }
+
+    std::string name() const {
+        return "Network Source";
+    }
+
+    std::string summary() const {
+        return "Receives a signal from the network over UDP or TCP.";
+    }
+
+    std::string description() const {
+        // TODO: Add decent block description describing internals and I/O.
+        return "Receives the stream of a Network Sink running in another flowgraph. With UDP, the block listens "
+               "on the address and joins it when it's a multicast group. With TCP, it connects to the sink and "
+               "reconnects when the link drops. Received frames are buffered before the graph consumes them. "
+               "Frames with lost records are dropped and counted.";
+    }
+
+    // Constructor
+
+    Result create() {
+        std::vector<U64> parsedShape;
+
+        std::regex re(R"(\d+)");
+        std::sregex_iterator next(config.shape.begin(), config.shape.end(), re);
+        std::sregex_iterator end;
+
+        while (next != end) {
+            std::smatch match = *next;
+            parsedShape.push_back(std::stoull(match.str()));
+            next++;
+        }
+
+        JST_CHECK(instance().addModule(
+            network_source, "network_source", {
+                .protocol = config.protocol,
+                .address = config.address,
+                .port = config.port,
+                .shape = parsedShape,
+                .bufferMultiplier = config.bufferMultiplier,
+            }, {
+            },
+            locale()
+        ));
+
+        JST_CHECK(Block::LinkOutput("buffer", output.buffer, network_source->getOutputBuffer()));
+
+        return Result::SUCCESS;
+    }
+
+    Result destroy() {
+        if (network_source) {
+            JST_CHECK(instance().eraseModule(network_source->locale()));
+        }
+
+        return Result::SUCCESS;
+    }
+
+    // Interface
+
+    void drawInfo() {
+        const auto& buffer = network_source->getCircularBuffer();
+
+        ImGui::TableNextRow();
+        ImGui::TableSetColumnIndex(0);
+        ImGui::TextUnformatted("Status");
+        ImGui::TableSetColumnIndex(1);
+        ImGui::TextUnformatted(network_source->isConnected() ? "Connected" : "Waiting");
+
+        ImGui::TableNextRow();
+        ImGui::TableSetColumnIndex(0);
+        ImGui::TextUnformatted("Received");
+        ImGui::TableSetColumnIndex(1);
+        ImGui::TextFormatted("{} frames", network_source->getFramesReceived());
+
+        ImGui::TableNextRow();
+        ImGui::TableSetColumnIndex(0);
+        ImGui::TextUnformatted("Dropped");
+        ImGui::TableSetColumnIndex(1);
+        ImGui::TextFormatted("{} frames ({} records lost)", network_source->getFramesDropped(),
+                                                             network_source->getRecordsLost());
+
+        const F32 bufferOccupancy = buffer.getOccupancy();
+        const F32 bufferCapacity = buffer.getCapacity();
+
+        ImGui::TableNextRow();
+        ImGui::TableSetColumnIndex(0);
+        ImGui::TextUnformatted("Buffer Health");
+        ImGui::TableSetColumnIndex(1);
+        const F32 bufferUsageRatio = bufferOccupancy / bufferCapacity;
+        const auto bufferOverlay = jst::fmt::format("{:.0f}/{:.0f} MB ({})", bufferOccupancy * sizeof(IT) / JST_MB,
+                                                                             bufferCapacity * sizeof(IT) / JST_MB,
+                                                                             buffer.getOverflows());
+        ImGui::SetNextItemWidth(-1);
+        ImGui::ProgressBar(bufferUsageRatio, ImVec2(0.0f, 0.0f), bufferOverlay.c_str());
+    }
+
+    constexpr bool shouldDrawInfo() const {
+        return true;
+    }
+
+    void drawControl() {
+        ImGui::TableNextRow();
+        ImGui::TableSetColumnIndex(0);
+        ImGui::TextUnformatted("Protocol");
+        ImGui::TableSetColumnIndex(1);
+        ImGui::SetNextItemWidth(-1);
+        if (ImGui::BeginCombo("##Protocol", config.protocol.string().c_str())) {
+            for (const auto& [key, value] : config.protocol.rmap()) {
+                bool isSelected = (config.protocol == key);
+                if (ImGui::Selectable(value.c_str(), isSelected)) {
+                    config.protocol = key;
+
+                    JST_DISPATCH_ASYNC([&](){
+                        ImGui::InsertNotification({ ImGuiToastType_Info, 1000, "Reloading block..." });
+                        JST_CHECK_NOTIFY(instance().reloadBlock(locale()));
+                    });
+                }
+                if (isSelected) {
+                    ImGui::SetItemDefaultFocus();
+                }
+            }
+            ImGui::EndCombo();
+        }
+
+        ImGui::TableNextRow();
+        ImGui::TableSetColumnIndex(0);
+        ImGui::TextUnformatted("Address");
+        ImGui::TableSetColumnIndex(1);
+        ImGui::SetNextItemWidth(-1);
+        if (ImGui::InputText("##Address", &config.address, ImGuiInputTextFlags_EnterReturnsTrue)) {
+            JST_DISPATCH_ASYNC([&](){
+                ImGui::InsertNotification({ ImGuiToastType_Info, 1000, "Reloading block..." });
+                JST_CHECK_NOTIFY(instance().reloadBlock(locale()));
+            });
+        }
+
+        ImGui::TableNextRow();
+        ImGui::TableSetColumnIndex(0);
+        ImGui::TextUnformatted("Port");
+        ImGui::TableSetColumnIndex(1);
+        ImGui::SetNextItemWidth(-1);
+        F32 port = config.port;
+        if (ImGui::InputFloat("##Port", &port, 1.0f, 1.0f, "%.0f", ImGuiInputTextFlags_EnterReturnsTrue)) {
+            if (port >= 1.0f && port <= 65535.0f) {
+                config.port = static_cast<U64>(port);
+
+                JST_DISPATCH_ASYNC([&](){
+                    ImGui::InsertNotification({ ImGuiToastType_Info, 1000, "Reloading block..." });
+                    JST_CHECK_NOTIFY(instance().reloadBlock(locale()));
+                });
+            }
+        }
+
+        ImGui::TableNextRow();
+        ImGui::TableSetColumnIndex(0);
+        ImGui::TextUnformatted("Output Shape");
+        ImGui::TableSetColumnIndex(1);
+        ImGui::SetNextItemWidth(-1);
+        if (ImGui::InputText("##Shape", &config.shape, ImGuiInputTextFlags_EnterReturnsTrue)) {
+            JST_DISPATCH_ASYNC([&](){
+                ImGui::InsertNotification({ ImGuiToastType_Info, 1000, "Reloading block..." });
+                JST_CHECK_NOTIFY(instance().reloadBlock(locale()));
+            });
+        }
+
+        ImGui::TableNextRow();
+        ImGui::TableSetColumnIndex(0);
+        ImGui::TextUnformatted("Buffer Multiplier");
+        ImGui::TableSetColumnIndex(1);
+        ImGui::SetNextItemWidth(-1);
+        F32 bufferMultiplier = config.bufferMultiplier;
+        if (ImGui::InputFloat("##BufferMultiplier", &bufferMultiplier, 1.0f, 4.0f, "%.0f", ImGuiInputTextFlags_EnterReturnsTrue)) {
+            if (bufferMultiplier >= 1.0f) {
+                config.bufferMultiplier = static_cast<U64>(bufferMultiplier);
+
+                JST_DISPATCH_ASYNC([&](){
+                    ImGui::InsertNotification({ ImGuiToastType_Info, 1000, "Reloading block..." });
+                    JST_CHECK_NOTIFY(instance().reloadBlock(locale()));
+                });
+            }
+        }
+    }
+
+    constexpr bool shouldDrawControl() const {
+        return true;
+    }
+
+ private:
+    std::shared_ptr<Jetstream::NetworkSource<D, IT>> network_source;
+
+    JST_DEFINE_IO()
+};
+
+}  // namespace Jetstream::Blocks
+
+JST_BLOCK_ENABLE(NetworkSource, is_specialized<Jetstream::NetworkSource<D, IT>>::value &&
+                                std::is_same<OT, void>::value)
+
+#endif
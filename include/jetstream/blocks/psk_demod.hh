@@ -21,9 +21,10 @@ class PskDemod : public Block {
         F64 dampingFactor = 0.707;
         F64 excessBandwidth = 0.35;
         U64 bufferSize = 8192;
+        U64 axis = 0;
 
         JST_SERDES(pskType, sampleRate, symbolRate, frequencyLoopBandwidth,
-                   timingLoopBandwidth, dampingFactor, excessBandwidth, bufferSize);
+                   timingLoopBandwidth, dampingFactor, excessBandwidth, bufferSize, axis);
     };
 
     constexpr const Config& getConfig() const {
@@ -90,7 +91,9 @@ class PskDemod : public Block {
                "- **Timing Loop Bandwidth**: Symbol timing recovery loop bandwidth (0-1).\n"
                "- **Damping Factor**: Loop filter damping coefficient for stability.\n"
                "- **Excess Bandwidth**: Root-raised cosine filter excess bandwidth (future use).\n"
-               "- **Buffer Size**: Processing buffer size.\n\n"
+               "- **Buffer Size**: Processing buffer size.\n"
+               "- **Axis**: The axis of the samples. Axes before it index independent channels, each one "
+               "with its own recovery loops. The default treats the whole input as a single stream.\n\n"
 
                "## Useful For:\n"
                "- Demodulating digital satellite communication signals.\n"
@@ -104,7 +107,10 @@ class PskDemod : public Block {
                "  Input: CF32[8192] → Output: CF32[2048]\n"
                "- BPSK demodulation:\n"
                "  Config: PSK Type=BPSK, Sample Rate=1000000, Symbol Rate=125000\n"
-               "  Input: CF32[8192] → Output: CF32[1024]\n\n"
+               "  Input: CF32[8192] → Output: CF32[1024]\n"
+               "- QPSK demodulation of channelizer outputs:\n"
+               "  Config: PSK Type=QPSK, Sample Rate=2000000, Symbol Rate=500000, Axis=1\n"
+               "  Input: CF32[32, 8192] → Output: CF32[32, 2048]\n\n"
 
                "## Implementation:\n"
                "Input → Frequency Correction → Timing Recovery → Soft Symbol Output\n"
@@ -128,6 +134,7 @@ class PskDemod : public Block {
                 .dampingFactor = config.dampingFactor,
                 .excessBandwidth = config.excessBandwidth,
                 .bufferSize = config.bufferSize,
+                .axis = config.axis,
             }, {
                 .buffer = input.buffer,
             },
@@ -207,6 +214,23 @@ class PskDemod : public Block {
             }
         }
 
+        ImGui::TableNextRow();
+        ImGui::TableSetColumnIndex(0);
+        ImGui::TextUnformatted("Axis");
+        ImGui::TableSetColumnIndex(1);
+        ImGui::SetNextItemWidth(-1);
+        F32 axis = config.axis;
+        if (ImGui::InputFloat("##axis", &axis, 1.0f, 1.0f, "%.0f", ImGuiInputTextFlags_EnterReturnsTrue)) {
+            if (axis >= 0 && axis < input.buffer.rank() && axis != config.axis) {
+                config.axis = static_cast<U64>(axis);
+
+                JST_DISPATCH_ASYNC([&](){
+                    ImGui::InsertNotification({ ImGuiToastType_Info, 1000, "Reloading block..." });
+                    JST_CHECK_NOTIFY(instance().reloadBlock(locale()));
+                });
+            }
+        }
+
         ImGui::TableNextRow();
         ImGui::TableSetColumnIndex(0);
         ImGui::TextUnformatted("Freq Loop");
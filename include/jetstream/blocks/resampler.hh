@@ -0,0 +1,226 @@
+#ifndef JETSTREAM_BLOCK_RESAMPLER_BASE_HH
+#define JETSTREAM_BLOCK_RESAMPLER_BASE_HH
+
+#include "jetstream/block.hh"
+#include "jetstream/instance.hh"
+#include "jetstream/modules/resampler.hh"
+
+namespace Jetstream::Blocks {
+
+template<Device D, typename IT, typename OT>
+class Resampler : public Block {
+ public:
+    // Configuration
+
+    struct Config {
+        U64 axis = 1;
+        U64 interpolation = 1;
+        U64 decimation = 1;
+        U64 tapsPerPhase = 16;
+
+        JST_SERDES(axis, interpolation, decimation, tapsPerPhase);
+    };
+
+    constexpr const Config& getConfig() const {
+        return config;
+    }
+
+    // Input
+
+    struct Input {
+        Tensor<D, IT> buffer;
+
+        JST_SERDES(buffer);
+    };
+
+    constexpr const Input& getInput() const {
+        return input;
+    }
+
+    // Output
+
+    struct Output {
+        Tensor<D, IT> buffer;
+
+        JST_SERDES(buffer);
+    };
+
+    constexpr const Output& getOutput() const {
+        return output;
+    }
+
+    constexpr const Tensor<D, IT>& getOutputBuffer() const {
+        return this->output.buffer;
+    }
+
+    // Housekeeping
+
+    constexpr Device device() const {
+        return D;
+    }
+
+    std::string id() const {
+        return "resampler";
+    }
+
+    std::string name() const {
+        return "Resampler";
+    }
+
+    std::string summary() const {
+        return "Changes the sample rate of a signal by a rational ratio.";
+    }
+
+    std::string description() const {
+        return "The Resampler block changes the sample rate of a signal along the specified axis by "
+               "interpolation / decimation. A windowed-sinc low-pass filter with the cutoff at the lower of the "
+               "input and output Nyquist frequencies removes images and aliases. The filter is split into one "
+               "phase per interpolation step, so only the kept outputs are computed and the zeros of the "
+               "upsampled signal are never multiplied. The filter state is kept between buffers, so consecutive "
+               "buffers resample as one continuous stream. Use it to match SDR rates to demodulator or audio "
+               "rates inside the graph.\n\n"
+
+               "## Parameters\n"
+               "- **Axis**: The axis along which to resample the input tensor.\n"
+               "- **Interpolation**: The upsampling factor.\n"
+               "- **Decimation**: The downsampling factor. The ratio is reduced first, and the axis size should "
+               "be a multiple of the reduced decimation.\n"
+               "- **Taps Per Phase**: Filter length per output. Longer filters have a sharper transition and "
+               "better image and alias rejection at a higher cost.\n\n"
+
+               "## Useful For:\n"
+               "- Bringing a demodulated signal to an audio device rate.\n"
+               "- Matching the sample rate of a capture to a demodulator.\n"
+               "- Converting between rates without an integer ratio.\n\n"
+
+               "## Examples:\n"
+               "- 240 kHz to 48 kHz:\n"
+               "  Config: Axis=1, Interpolation=1, Decimation=5\n"
+               "  Input: F32[1, 7680] → Output: F32[1, 1536]\n"
+               "- 48 kHz to 44.1 kHz:\n"
+               "  Config: Axis=1, Interpolation=147, Decimation=160\n"
+               "  Input: F32[1, 7680] → Output: F32[1, 7056]\n\n"
+
+               "## Implementation:\n"
+               "Input → Resampler → Output\n"
+               "1. The ratio is reduced and the filter taps are designed for it and split into phases.\n"
+               "2. Each output is computed as a single dot product of one phase over the input and the filter history.\n"
+               "3. The last input samples are kept as the history for the next buffer.";
+    }
+
+    // Constructor
+
+    Result create() {
+        JST_CHECK(instance().addModule(
+            resampler, "resampler", {
+                .axis = config.axis,
+                .interpolation = config.interpolation,
+                .decimation = config.decimation,
+                .tapsPerPhase = config.tapsPerPhase,
+            }, {
+                .buffer = input.buffer,
+            },
+            locale()
+        ));
+
+        JST_CHECK(Block::LinkOutput("buffer", output.buffer, resampler->getOutputBuffer()));
+
+        return Result::SUCCESS;
+    }
+
+    Result destroy() {
+        if (resampler) {
+            JST_CHECK(instance().eraseModule(resampler->locale()));
+        }
+
+        return Result::SUCCESS;
+    }
+
+    // Interface
+
+    void drawControl() {
+        ImGui::TableNextRow();
+        ImGui::TableSetColumnIndex(0);
+        ImGui::TextUnformatted("Axis");
+        ImGui::TableSetColumnIndex(1);
+        ImGui::SetNextItemWidth(-1);
+        F32 axis = config.axis;
+        if (ImGui::InputFloat("##axis", &axis, 1.0f, 1.0f, "%.0f", ImGuiInputTextFlags_EnterReturnsTrue)) {
+            if (axis >= 0 && axis < input.buffer.rank()) {
+                config.axis = static_cast<U64>(axis);
+
+                JST_DISPATCH_ASYNC([&](){
+                    ImGui::InsertNotification({ ImGuiToastType_Info, 1000, "Reloading block..." });
+                    JST_CHECK_NOTIFY(instance().reloadBlock(locale()));
+                });
+            }
+        }
+
+        ImGui::TableNextRow();
+        ImGui::TableSetColumnIndex(0);
+        ImGui::TextUnformatted("Interpolation");
+        ImGui::TableSetColumnIndex(1);
+        ImGui::SetNextItemWidth(-1);
+        F32 interpolation = config.interpolation;
+        if (ImGui::InputFloat("##interpolation", &interpolation, 1.0f, 1.0f, "%.0f", ImGuiInputTextFlags_EnterReturnsTrue)) {
+            if (interpolation >= 1) {
+                config.interpolation = static_cast<U64>(interpolation);
+
+                JST_DISPATCH_ASYNC([&](){
+                    ImGui::InsertNotification({ ImGuiToastType_Info, 1000, "Reloading block..." });
+                    JST_CHECK_NOTIFY(instance().reloadBlock(locale()));
+                });
+            }
+        }
+
+        ImGui::TableNextRow();
+        ImGui::TableSetColumnIndex(0);
+        ImGui::TextUnformatted("Decimation");
+        ImGui::TableSetColumnIndex(1);
+        ImGui::SetNextItemWidth(-1);
+        F32 decimation = config.decimation;
+        if (ImGui::InputFloat("##decimation", &decimation, 1.0f, 1.0f, "%.0f", ImGuiInputTextFlags_EnterReturnsTrue)) {
+            if (decimation >= 1) {
+                config.decimation = static_cast<U64>(decimation);
+
+                JST_DISPATCH_ASYNC([&](){
+                    ImGui::InsertNotification({ ImGuiToastType_Info, 1000, "Reloading block..." });
+                    JST_CHECK_NOTIFY(instance().reloadBlock(locale()));
+                });
+            }
+        }
+
+        ImGui::TableNextRow();
+        ImGui::TableSetColumnIndex(0);
+        ImGui::TextUnformatted("Taps Per Phase");
+        ImGui::TableSetColumnIndex(1);
+        ImGui::SetNextItemWidth(-1);
+        F32 tapsPerPhase = config.tapsPerPhase;
+        if (ImGui::InputFloat("##taps-per-phase", &tapsPerPhase, 1.0f, 1.0f, "%.0f", ImGuiInputTextFlags_EnterReturnsTrue)) {
+            if (tapsPerPhase >= 1) {
+                config.tapsPerPhase = static_cast<U64>(tapsPerPhase);
+
+                JST_DISPATCH_ASYNC([&](){
+                    ImGui::InsertNotification({ ImGuiToastType_Info, 1000, "Reloading block..." });
+                    JST_CHECK_NOTIFY(instance().reloadBlock(locale()));
+                });
+            }
+        }
+    }
+
+    constexpr bool shouldDrawControl() const {
+        return true;
+    }
+
+ private:
+    std::shared_ptr<Jetstream::Resampler<D, IT>> resampler;
+
+    JST_DEFINE_IO()
+};
+
+}  // namespace Jetstream::Blocks
+
+JST_BLOCK_ENABLE(Resampler, is_specialized<Jetstream::Resampler<D, IT>>::value &&
+                            std::is_same<OT, void>::value)
+
+#endif
@@ -17,8 +17,10 @@ class RRCFilter : public Block {
         F32 sampleRate = 2.0e6f;
         F32 rollOff = 0.35f;
         U64 taps = 101;
+        U64 interpolation = 1;
+        U64 decimation = 1;
 
-        JST_SERDES(symbolRate, sampleRate, rollOff, taps);
+        JST_SERDES(symbolRate, sampleRate, rollOff, taps, interpolation, decimation);
     };
 
     constexpr const Config& getConfig() const {
@@ -81,7 +83,10 @@ class RRCFilter : public Block {
                "- **Sample Rate**: The sampling rate of the input signal in samples per second.\n"
                "- **Symbol Rate**: The symbol rate of the input signal in symbols per second.\n"
                "- **Roll-off Factor**: Controls the bandwidth and spectral efficiency trade-off (0.0 to 1.0).\n"
-               "- **Taps**: Number of filter coefficients determining filter length and performance.\n\n"
+               "- **Taps**: Number of filter coefficients determining filter length and performance.\n"
+               "- **Interpolation**: Upsampling factor applied before filtering (1 to disable).\n"
+               "- **Decimation**: Downsampling factor applied after filtering (1 to disable). Only the kept "
+               "outputs are computed, e.g. matched filtering straight to symbol rate.\n\n"
 
                "## Useful For:\n"
                "- Matched filtering in PSK demodulation systems.\n"
@@ -95,13 +100,17 @@ class RRCFilter : public Block {
                "  Input: CF32[8192] → Output: CF32[8192]\n"
                "- BPSK with oversampling:\n"
                "  Config: Symbol Rate=500kHz, Sample Rate=2MHz, Roll-off=0.22\n"
-               "  Input: CF32[4096] → Output: CF32[4096]\n\n"
+               "  Input: CF32[4096] → Output: CF32[4096]\n"
+               "- Matched filter at symbol rate:\n"
+               "  Config: Symbol Rate=1MHz, Sample Rate=4MHz, Decimation=4\n"
+               "  Input: CF32[8192] → Output: CF32[2048]\n\n"
 
                "## Implementation:\n"
                "Input → RRC Filter Module → Output\n"
                "1. RRC filter module generates optimal matched filter coefficients based on symbol rate and roll-off.\n"
                "2. Filter coefficients are computed using the standard RRC pulse shaping formula.\n"
-               "3. Input signal is convolved with the RRC coefficients to maximize SNR for symbol detection.";
+               "3. Input signal is convolved with the RRC coefficients to maximize SNR for symbol detection.\n"
+               "4. Resampling uses a polyphase filter bank, so only the kept output samples are computed.";
     }
 
     // Constructor
@@ -113,6 +122,8 @@ class RRCFilter : public Block {
                 .sampleRate = config.sampleRate,
                 .rollOff = config.rollOff,
                 .taps = config.taps,
+                .interpolation = config.interpolation,
+                .decimation = config.decimation,
             }, {
                 .buffer = input.buffer,
             },
@@ -179,6 +190,40 @@ class RRCFilter : public Block {
             config.taps = newTaps;
             JST_MODULE_UPDATE(filter, setTaps(newTaps));
         }
+
+        ImGui::TableNextRow();
+        ImGui::TableSetColumnIndex(0);
+        ImGui::TextUnformatted("Interpolation");
+        ImGui::TableSetColumnIndex(1);
+        ImGui::SetNextItemWidth(-1);
+        F32 interpolation = config.interpolation;
+        if (ImGui::InputFloat("##rrc-interpolation", &interpolation, 1.0f, 1.0f, "%.0f", ImGuiInputTextFlags_EnterReturnsTrue)) {
+            if (interpolation >= 1.0f) {
+                config.interpolation = static_cast<U64>(interpolation);
+
+                JST_DISPATCH_ASYNC([&](){
+                    ImGui::InsertNotification({ ImGuiToastType_Info, 1000, "Reloading block..." });
+                    JST_CHECK_NOTIFY(instance().reloadBlock(locale()));
+                });
+            }
+        }
+
+        ImGui::TableNextRow();
+        ImGui::TableSetColumnIndex(0);
+        ImGui::TextUnformatted("Decimation");
+        ImGui::TableSetColumnIndex(1);
+        ImGui::SetNextItemWidth(-1);
+        F32 decimation = config.decimation;
+        if (ImGui::InputFloat("##rrc-decimation", &decimation, 1.0f, 1.0f, "%.0f", ImGuiInputTextFlags_EnterReturnsTrue)) {
+            if (decimation >= 1.0f) {
+                config.decimation = static_cast<U64>(decimation);
+
+                JST_DISPATCH_ASYNC([&](){
+                    ImGui::InsertNotification({ ImGuiToastType_Info, 1000, "Reloading block..." });
+                    JST_CHECK_NOTIFY(instance().reloadBlock(locale()));
+                });
+            }
+        }
     }
 
     constexpr bool shouldDrawControl() const {
@@ -14,8 +14,9 @@ class Scale : public Block {
 
     struct Config {
         Range<IT> range = {-1.0, +1.0};
+        bool inPlace = false;
 
-        JST_SERDES(range);
+        JST_SERDES(range, inPlace);
     };
 
     constexpr const Config& getConfig() const {
@@ -70,7 +71,9 @@ class Scale : public Block {
 
     std::string description() const {
         // TODO: Add decent block description describing internals and I/O.
-        return "Multiplies each data point in the input by a specified scaling factor, adjusting its magnitude.";
+        return "Multiplies each data point in the input by a specified scaling factor, adjusting its magnitude. "
+               "With `In-Place`, the result is written over the input on the CPU, "
+               "which requires the other readers of the input to run first.";
     }
 
     // Constructor
@@ -79,6 +82,7 @@ class Scale : public Block {
         JST_CHECK(instance().addModule(
             scale, "scale", {
                 .range = config.range,
+                .inPlace = config.inPlace,
             }, {
                 .buffer = input.buffer,
             },
@@ -111,6 +115,18 @@ class Scale : public Block {
                     1, -300, 0, "Min: %.0f", "Max: %.0f")) {
             config.range = scale->range({min, max});
         }
+
+        ImGui::TableNextRow();
+        ImGui::TableSetColumnIndex(0);
+        ImGui::TextUnformatted("In-Place");
+        ImGui::TableSetColumnIndex(1);
+        ImGui::SetNextItemWidth(-1);
+        if (ImGui::Checkbox("##InPlace", &config.inPlace)) {
+            JST_DISPATCH_ASYNC([&](){
+                ImGui::InsertNotification({ ImGuiToastType_Info, 1000, "Reloading block..." });
+                JST_CHECK_NOTIFY(instance().reloadBlock(locale()));
+            });
+        }
     }
 
     constexpr bool shouldDrawControl() const {
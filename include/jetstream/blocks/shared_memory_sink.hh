@@ -0,0 +1,176 @@
+#ifndef JETSTREAM_BLOCK_SHARED_MEMORY_SINK_BASE_HH
+#define JETSTREAM_BLOCK_SHARED_MEMORY_SINK_BASE_HH
+
+#include "jetstream/block.hh"
+#include "jetstream/instance.hh"
+#include "jetstream/modules/shared_memory_sink.hh"
+
+namespace Jetstream::Blocks {
+
+template<Device D, typename IT, typename OT>
+class SharedMemorySink : public Block {
+ public:
+    // Configuration
+
+    struct Config {
+        std::string name = "cyberether";
+        U64 bufferMultiplier = 8;
+
+        JST_SERDES(name, bufferMultiplier);
+    };
+
+    constexpr const Config& getConfig() const {
+        return config;
+    }
+
+    // Input
+
+    struct Input {
+        Tensor<D, IT> buffer;
+
+        JST_SERDES(buffer);
+    };
+
+    constexpr const Input& getInput() const {
+        return input;
+    }
+
+    // Output
+
+    struct Output {
+        JST_SERDES();
+    };
+
+    constexpr const Output& getOutput() const {
+        return output;
+    }
+
+    // Housekeeping
+
+    constexpr Device device() const {
+        return D;
+    }
+
+    std::string id() const {
+        return "shared-memory-sink";
+    }
+
+    std::string name() const {
+        return "Shared Memory Sink";
+    }
+
+    std::string summary() const {
+        return "Shares a signal with another process on the same machine.";
+    }
+
+    std::string description() const {
+        // TODO: Add decent block description describing internals and I/O.
+        return "Writes every input to a named ring in shared memory, to be read by a Shared Memory Source in "
+               "another process on the same machine. Inputs go straight into the ring without passing through "
+               "the kernel. The flowgraph never waits for the reader, inputs that don't fit are dropped and "
+               "counted. Only one reader can be attached to a ring.";
+    }
+
+    // Constructor
+
+    Result create() {
+        JST_CHECK(instance().addModule(
+            shared_memory_sink, "shared_memory_sink", {
+                .name = config.name,
+                .bufferMultiplier = config.bufferMultiplier,
+            }, {
+                .buffer = input.buffer,
+            },
+            locale()
+        ));
+
+        return Result::SUCCESS;
+    }
+
+    Result destroy() {
+        if (shared_memory_sink) {
+            JST_CHECK(instance().eraseModule(shared_memory_sink->locale()));
+        }
+
+        return Result::SUCCESS;
+    }
+
+    // Interface
+
+    void drawInfo() {
+        ImGui::TableNextRow();
+        ImGui::TableSetColumnIndex(0);
+        ImGui::TextUnformatted("Sent");
+        ImGui::TableSetColumnIndex(1);
+        ImGui::TextFormatted("{} frames", shared_memory_sink->getFramesSent());
+
+        ImGui::TableNextRow();
+        ImGui::TableSetColumnIndex(0);
+        ImGui::TextUnformatted("Dropped");
+        ImGui::TableSetColumnIndex(1);
+        ImGui::TextFormatted("{} frames", shared_memory_sink->getFramesDropped());
+
+        const F32 occupancy = shared_memory_sink->getOccupancy();
+        const F32 capacity = shared_memory_sink->getCapacity();
+
+        ImGui::TableNextRow();
+        ImGui::TableSetColumnIndex(0);
+        ImGui::TextUnformatted("Buffer Health");
+        ImGui::TableSetColumnIndex(1);
+        const F32 usageRatio = (capacity > 0.0f) ? occupancy / capacity : 0.0f;
+        const auto bufferOverlay = jst::fmt::format("{:.1f}/{:.1f} MB", occupancy / JST_MB, capacity / JST_MB);
+        ImGui::SetNextItemWidth(-1);
+        ImGui::ProgressBar(usageRatio, ImVec2(0.0f, 0.0f), bufferOverlay.c_str());
+    }
+
+    constexpr bool shouldDrawInfo() const {
+        return true;
+    }
+
+    void drawControl() {
+        ImGui::TableNextRow();
+        ImGui::TableSetColumnIndex(0);
+        ImGui::TextUnformatted("Name");
+        ImGui::TableSetColumnIndex(1);
+        ImGui::SetNextItemWidth(-1);
+        if (ImGui::InputText("##Name", &config.name, ImGuiInputTextFlags_EnterReturnsTrue)) {
+            JST_DISPATCH_ASYNC([&](){
+                ImGui::InsertNotification({ ImGuiToastType_Info, 1000, "Reloading block..." });
+                JST_CHECK_NOTIFY(instance().reloadBlock(locale()));
+            });
+        }
+
+        ImGui::TableNextRow();
+        ImGui::TableSetColumnIndex(0);
+        ImGui::TextUnformatted("Buffer Multiplier");
+        ImGui::TableSetColumnIndex(1);
+        ImGui::SetNextItemWidth(-1);
+        F32 bufferMultiplier = config.bufferMultiplier;
+        if (ImGui::InputFloat("##BufferMultiplier", &bufferMultiplier, 1.0f, 4.0f, "%.0f", ImGuiInputTextFlags_EnterReturnsTrue)) {
+            if (bufferMultiplier >= 1.0f) {
+                config.bufferMultiplier = static_cast<U64>(bufferMultiplier);
+
+                JST_DISPATCH_ASYNC([&](){
+                    ImGui::InsertNotification({ ImGuiToastType_Info, 1000, "Reloading block..." });
+                    JST_CHECK_NOTIFY(instance().reloadBlock(locale()));
+                });
+            }
+        }
+    }
+
+    constexpr bool shouldDrawControl() const {
+        return true;
+    }
+
+ private:
+    std::shared_ptr<Jetstream::SharedMemorySink<D, IT>> shared_memory_sink;
+
+    JST_DEFINE_IO()
+};
+
+}  // namespace Jetstream::Blocks
+
+JST_BLOCK_ENABLE(SharedMemorySink, is_specialized<Jetstream::SharedMemorySink<D, IT>>::value &&
+                                   std::is_same<OT, void>::value)
+
+#endif
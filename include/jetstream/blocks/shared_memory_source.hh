@@ -0,0 +1,195 @@
+#ifndef JETSTREAM_BLOCK_SHARED_MEMORY_SOURCE_BASE_HH
+#define JETSTREAM_BLOCK_SHARED_MEMORY_SOURCE_BASE_HH
+
+#include <regex>
+
+#include "jetstream/block.hh"
+#include "jetstream/instance.hh"
+#include "jetstream/modules/shared_memory_source.hh"
+
+namespace Jetstream::Blocks {
+
+template<Device D, typename IT, typename OT>
+class SharedMemorySource : public Block {
+ public:
+    // Configuration
+
+    struct Config {
+        std::string name = "cyberether";
+        std::string shape = "[8192]";
+
+        JST_SERDES(name, shape);
+    };
+
+    constexpr const Config& getConfig() const {
+        return config;
+    }
+
+    // Input
+
+    struct Input {
+        JST_SERDES();
+    };
+
+    constexpr const Input& getInput() const {
+        return input;
+    }
+
+    // Output
+
+    struct Output {
+        Tensor<D, IT> buffer;
+
+        JST_SERDES(buffer);
+    };
+
+    constexpr const Output& getOutput() const {
+        return output;
+    }
+
+    constexpr const Tensor<D, IT>& getOutputBuffer() const {
+        return this->output.buffer;
+    }
+
+    // Housekeeping
+
+    constexpr Device device() const {
+        return D;
+    }
+
+    std::string id() const {
+        return "shared-memory-source";
+    }
+
+    std::string name() const {
+        return "Shared Memory Source";
+    }
+
+    std::string summary() const {
+        return "Receives a signal from another process on the same machine.";
+    }
+
+    std::string description() const {
+        // TODO: Add decent block description describing internals and I/O.
+        return "Reads the ring in shared memory written by a Shared Memory Sink in another process on the same "
+               "machine. The block attaches once the sink creates the ring and reattaches whenever the sink is "
+               "recreated. It sleeps until the sink writes enough samples for an output, without polling.";
+    }
+
+    // Constructor
+
+    Result create() {
+        std::vector<U64> parsedShape;
+
+        std::regex re(R"(\d+)");
+        std::sregex_iterator next(config.shape.begin(), config.shape.end(), re);
+        std::sregex_iterator end;
+
+        while (next != end) {
+            std::smatch match = *next;
+            parsedShape.push_back(std::stoull(match.str()));
+            next++;
+        }
+
+        JST_CHECK(instance().addModule(
+            shared_memory_source, "shared_memory_source", {
+                .name = config.name,
+                .shape = parsedShape,
+            }, {
+            },
+            locale()
+        ));
+
+        JST_CHECK(Block::LinkOutput("buffer", output.buffer, shared_memory_source->getOutputBuffer()));
+
+        return Result::SUCCESS;
+    }
+
+    Result destroy() {
+        if (shared_memory_source) {
+            JST_CHECK(instance().eraseModule(shared_memory_source->locale()));
+        }
+
+        return Result::SUCCESS;
+    }
+
+    // Interface
+
+    void drawInfo() {
+        ImGui::TableNextRow();
+        ImGui::TableSetColumnIndex(0);
+        ImGui::TextUnformatted("Status");
+        ImGui::TableSetColumnIndex(1);
+        ImGui::TextUnformatted(shared_memory_source->isConnected() ? "Attached" : "Waiting for sink");
+
+        ImGui::TableNextRow();
+        ImGui::TableSetColumnIndex(0);
+        ImGui::TextUnformatted("Received");
+        ImGui::TableSetColumnIndex(1);
+        ImGui::TextFormatted("{} frames", shared_memory_source->getFramesReceived());
+
+        ImGui::TableNextRow();
+        ImGui::TableSetColumnIndex(0);
+        ImGui::TextUnformatted("Dropped");
+        ImGui::TableSetColumnIndex(1);
+        ImGui::TextFormatted("{} samples", shared_memory_source->getSamplesDropped());
+
+        const F32 occupancy = shared_memory_source->getOccupancy();
+        const F32 capacity = shared_memory_source->getCapacity();
+
+        ImGui::TableNextRow();
+        ImGui::TableSetColumnIndex(0);
+        ImGui::TextUnformatted("Buffer Health");
+        ImGui::TableSetColumnIndex(1);
+        const F32 usageRatio = (capacity > 0.0f) ? occupancy / capacity : 0.0f;
+        const auto bufferOverlay = jst::fmt::format("{:.1f}/{:.1f} MB", occupancy / JST_MB, capacity / JST_MB);
+        ImGui::SetNextItemWidth(-1);
+        ImGui::ProgressBar(usageRatio, ImVec2(0.0f, 0.0f), bufferOverlay.c_str());
+    }
+
+    constexpr bool shouldDrawInfo() const {
+        return true;
+    }
+
+    void drawControl() {
+        ImGui::TableNextRow();
+        ImGui::TableSetColumnIndex(0);
+        ImGui::TextUnformatted("Name");
+        ImGui::TableSetColumnIndex(1);
+        ImGui::SetNextItemWidth(-1);
+        if (ImGui::InputText("##Name", &config.name, ImGuiInputTextFlags_EnterReturnsTrue)) {
+            JST_DISPATCH_ASYNC([&](){
+                ImGui::InsertNotification({ ImGuiToastType_Info, 1000, "Reloading block..." });
+                JST_CHECK_NOTIFY(instance().reloadBlock(locale()));
+            });
+        }
+
+        ImGui::TableNextRow();
+        ImGui::TableSetColumnIndex(0);
+        ImGui::TextUnformatted("Output Shape");
+        ImGui::TableSetColumnIndex(1);
+        ImGui::SetNextItemWidth(-1);
+        if (ImGui::InputText("##Shape", &config.shape, ImGuiInputTextFlags_EnterReturnsTrue)) {
+            JST_DISPATCH_ASYNC([&](){
+                ImGui::InsertNotification({ ImGuiToastType_Info, 1000, "Reloading block..." });
+                JST_CHECK_NOTIFY(instance().reloadBlock(locale()));
+            });
+        }
+    }
+
+    constexpr bool shouldDrawControl() const {
+        return true;
+    }
+
+ private:
+    std::shared_ptr<Jetstream::SharedMemorySource<D, IT>> shared_memory_source;
+
+    JST_DEFINE_IO()
+};
+
+}  // namespace Jetstream::Blocks
+
+JST_BLOCK_ENABLE(SharedMemorySource, is_specialized<Jetstream::SharedMemorySource<D, IT>>::value &&
+                                     std::is_same<OT, void>::value)
+
+#endif
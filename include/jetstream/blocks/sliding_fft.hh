@@ -0,0 +1,208 @@
+#ifndef JETSTREAM_BLOCK_SLIDING_FFT_BASE_HH
+#define JETSTREAM_BLOCK_SLIDING_FFT_BASE_HH
+
+#include "jetstream/block.hh"
+#include "jetstream/instance.hh"
+#include "jetstream/modules/sliding_fft.hh"
+
+namespace Jetstream::Blocks {
+
+template<Device D, typename IT, typename OT>
+class SlidingFFT : public Block {
+ public:
+    // Configuration
+
+    struct Config {
+        U64 size = 1024;
+        U64 hop = 8;
+        bool window = true;
+        bool center = true;
+
+        JST_SERDES(size, hop, window, center);
+    };
+
+    constexpr const Config& getConfig() const {
+        return config;
+    }
+
+    // Input
+
+    struct Input {
+        Tensor<D, IT> buffer;
+
+        JST_SERDES(buffer);
+    };
+
+    constexpr const Input& getInput() const {
+        return input;
+    }
+
+    // Output
+
+    struct Output {
+        Tensor<D, IT> buffer;
+
+        JST_SERDES(buffer);
+    };
+
+    constexpr const Output& getOutput() const {
+        return output;
+    }
+
+    constexpr const Tensor<D, IT>& getOutputBuffer() const {
+        return this->output.buffer;
+    }
+
+    // Housekeeping
+
+    constexpr Device device() const {
+        return D;
+    }
+
+    std::string id() const {
+        return "sliding-fft";
+    }
+
+    std::string name() const {
+        return "Sliding FFT";
+    }
+
+    std::string summary() const {
+        return "Computes a spectrum every few samples.";
+    }
+
+    std::string description() const {
+        return "The Sliding FFT block computes the spectrum of the last window of samples every hop, instead of "
+               "once per window like the FFT block. Spectra overlap by all but a hop, so short events show up "
+               "as soon as their samples arrive without transforming the whole window for every new spectrum.\n\n"
+
+               "## Parameters\n"
+               "- **Size**: The number of bins and the length of the window.\n"
+               "- **Hop**: The number of samples between two spectra.\n"
+               "- **Window**: Applies a Hann window to the spectra.\n"
+               "- **Center**: Moves the zero frequency to the middle of the spectra.\n\n"
+
+               "## Useful For:\n"
+               "- Low latency spectrum displays.\n"
+               "- Detecting short bursts.\n"
+               "- Time resolution finer than the window length.\n\n"
+
+               "## Examples:\n"
+               "- Fine time resolution:\n"
+               "  Config: Size=1024, Hop=4\n"
+               "  Input: CF32[8192] → Output: CF32[2048, 1024]\n\n"
+
+               "## Implementation:\n"
+               "Input → Sliding FFT → Output\n"
+               "1. Short hops slide the previous spectrum one sample at a time with one complex multiply per bin.\n"
+               "2. The slid spectrum is transformed again from the window once per window to drop rounding errors.\n"
+               "3. Long hops transform the last window directly.\n"
+               "4. The Hann window is applied as a three tap convolution of the spectrum.";
+    }
+
+    // Constructor
+
+    Result create() {
+        JST_CHECK(instance().addModule(
+            sliding, "sliding", {
+                .size = config.size,
+                .hop = config.hop,
+                .window = config.window,
+                .center = config.center,
+            }, {
+                .buffer = input.buffer,
+            },
+            locale()
+        ));
+
+        JST_CHECK(Block::LinkOutput("buffer", output.buffer, sliding->getOutputBuffer()));
+
+        return Result::SUCCESS;
+    }
+
+    Result destroy() {
+        if (sliding) {
+            JST_CHECK(instance().eraseModule(sliding->locale()));
+        }
+
+        return Result::SUCCESS;
+    }
+
+    // Interface
+
+    void drawControl() {
+        ImGui::TableNextRow();
+        ImGui::TableSetColumnIndex(0);
+        ImGui::TextUnformatted("Size");
+        ImGui::TableSetColumnIndex(1);
+        ImGui::SetNextItemWidth(-1);
+        F32 size = config.size;
+        if (ImGui::InputFloat("##sliding-size", &size, 1.0f, 1.0f, "%.0f", ImGuiInputTextFlags_EnterReturnsTrue)) {
+            if (size >= 2 && size != config.size) {
+                config.size = static_cast<U64>(size);
+
+                JST_DISPATCH_ASYNC([&](){
+                    ImGui::InsertNotification({ ImGuiToastType_Info, 1000, "Reloading block..." });
+                    JST_CHECK_NOTIFY(instance().reloadBlock(locale()));
+                });
+            }
+        }
+
+        ImGui::TableNextRow();
+        ImGui::TableSetColumnIndex(0);
+        ImGui::TextUnformatted("Hop");
+        ImGui::TableSetColumnIndex(1);
+        ImGui::SetNextItemWidth(-1);
+        F32 hop = config.hop;
+        if (ImGui::InputFloat("##sliding-hop", &hop, 1.0f, 1.0f, "%.0f", ImGuiInputTextFlags_EnterReturnsTrue)) {
+            if (hop >= 1 && hop != config.hop) {
+                config.hop = static_cast<U64>(hop);
+
+                JST_DISPATCH_ASYNC([&](){
+                    ImGui::InsertNotification({ ImGuiToastType_Info, 1000, "Reloading block..." });
+                    JST_CHECK_NOTIFY(instance().reloadBlock(locale()));
+                });
+            }
+        }
+
+        ImGui::TableNextRow();
+        ImGui::TableSetColumnIndex(0);
+        ImGui::TextUnformatted("Window");
+        ImGui::TableSetColumnIndex(1);
+        ImGui::SetNextItemWidth(-1);
+        if (ImGui::Checkbox("##sliding-window", &config.window)) {
+            JST_DISPATCH_ASYNC([&](){
+                ImGui::InsertNotification({ ImGuiToastType_Info, 1000, "Reloading block..." });
+                JST_CHECK_NOTIFY(instance().reloadBlock(locale()));
+            });
+        }
+
+        ImGui::TableNextRow();
+        ImGui::TableSetColumnIndex(0);
+        ImGui::TextUnformatted("Center");
+        ImGui::TableSetColumnIndex(1);
+        ImGui::SetNextItemWidth(-1);
+        if (ImGui::Checkbox("##sliding-center", &config.center)) {
+            JST_DISPATCH_ASYNC([&](){
+                ImGui::InsertNotification({ ImGuiToastType_Info, 1000, "Reloading block..." });
+                JST_CHECK_NOTIFY(instance().reloadBlock(locale()));
+            });
+        }
+    }
+
+    constexpr bool shouldDrawControl() const {
+        return true;
+    }
+
+ private:
+    std::shared_ptr<Jetstream::SlidingFFT<D, IT>> sliding;
+
+    JST_DEFINE_IO()
+};
+
+}  // namespace Jetstream::Blocks
+
+JST_BLOCK_ENABLE(SlidingFFT, is_specialized<Jetstream::SlidingFFT<D, IT>>::value &&
+                             std::is_same<OT, void>::value)
+
+#endif
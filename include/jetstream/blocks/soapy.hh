@@ -24,11 +24,15 @@ class Soapy : public Block {
         U64 numberOfBatches = 8;
         U64 numberOfTimeSamples = 8192;
         U64 bufferMultiplier = 4;
+        U64 numberOfChannels = 1;
+        bool adaptiveBuffer = false;
+        F32 maxLatencyMs = 500.0f;
 
         JST_SERDES(hintString, deviceString, streamString,
                    frequency, sampleRate, automaticGain,
                    numberOfBatches, numberOfTimeSamples,
-                   bufferMultiplier);
+                   bufferMultiplier, numberOfChannels,
+                   adaptiveBuffer, maxLatencyMs);
     };
 
     constexpr const Config& getConfig() const {
@@ -81,7 +85,16 @@ class Soapy : public Block {
 
     std::string description() const {
         // TODO: Add decent block description describing internals and I/O.
-        return "Provides an interface to communicate and control SoapySDR supported devices, facilitating data acquisition and device configuration.";
+        return "Provides an interface to communicate and control SoapySDR supported devices, facilitating data acquisition and device configuration. "
+               "The CI16 and CI8 variants stream the integer samples of the driver without converting them to floats, "
+               "reducing the memory traffic from the device to the graph. Use a Cast block to convert them downstream. "
+               "Devices with more than one receiver can stream several channels at once, coherently. The output "
+               "then gains a leading channel axis, [channel, batch, samples], with aligned frames. "
+               "Every frame carries the stream state of its first sample as attributes: `sample_index` counts "
+               "the samples since the start, including the ones dropped by overflows, `time_ns` is the hardware "
+               "timestamp (-1 if the driver has none), and `frequency` and `sample_rate` are the tuning in use. "
+               "The adaptive buffer deepens after overflows and gets shallower while the flowgraph keeps up, "
+               "never holding more than the maximum latency of samples.";
     }
 
     // Constructor
@@ -111,6 +124,9 @@ class Soapy : public Block {
                 .numberOfBatches = config.numberOfBatches,
                 .numberOfTimeSamples = config.numberOfTimeSamples,
                 .bufferMultiplier = config.bufferMultiplier,
+                .numberOfChannels = config.numberOfChannels,
+                .adaptiveBuffer = config.adaptiveBuffer,
+                .maxLatencyMs = config.maxLatencyMs,
             }, {},
             locale()
         ));
@@ -146,13 +162,13 @@ class Soapy : public Block {
         ImGui::TextFormatted("{} ({})", soapy->getDeviceName(), soapy->getDeviceHardwareKey());
 
         const F32& bufferOccupancy = buffer.getOccupancy();
-        const F32 bufferOccupancyMB = (bufferOccupancy * sizeof(CF32) / JST_MB);
+        const F32 bufferOccupancyMB = (bufferOccupancy * sizeof(IT) / JST_MB);
 
         const F32& bufferCapacity = buffer.getCapacity();
-        const F32 bufferCapacityMB = (bufferCapacity * sizeof(CF32) / JST_MB);
+        const F32 bufferCapacityMB = (bufferCapacity * sizeof(IT) / JST_MB);
 
         const F32& bufferThroughput = buffer.getThroughput();
-        const F32 bufferThroughputMB = (bufferThroughput * sizeof(CF32) / JST_MB);
+        const F32 bufferThroughputMB = (bufferThroughput * sizeof(IT) / JST_MB);
 
         ImGui::TableNextRow();
         ImGui::TableSetColumnIndex(0);
@@ -163,11 +179,25 @@ class Soapy : public Block {
         ImGui::SetNextItemWidth(-1);
         ImGui::ProgressBar(bufferUsageRatio, ImVec2(0.0f, 0.0f), bufferOverlay.c_str());
 
+        ImGui::TableNextRow();
+        ImGui::TableSetColumnIndex(0);
+        ImGui::TextUnformatted("Buffer Depth");
+        ImGui::TableSetColumnIndex(1);
+        const U64 depth = soapy->getBufferDepth();
+        const F32 depthMs = (depth * config.numberOfBatches * config.numberOfTimeSamples) / config.sampleRate * 1e3f;
+        ImGui::TextFormatted("{} frames ({:.0f} ms)", depth, depthMs);
+
+        ImGui::TableNextRow();
+        ImGui::TableSetColumnIndex(0);
+        ImGui::TextUnformatted("Latency");
+        ImGui::TableSetColumnIndex(1);
+        ImGui::TextFormatted("{:.1f} ms", soapy->getBufferLatency() * 1e3f);
+
         ImGui::TableNextRow();
         ImGui::TableSetColumnIndex(0);
         ImGui::TextUnformatted("Throughput");
         ImGui::TableSetColumnIndex(1);
-        const F32 sdrThroughputMB = ((soapy->getConfig().sampleRate * sizeof(CF32)) / JST_MB);
+        const F32 sdrThroughputMB = ((soapy->getConfig().sampleRate * sizeof(IT)) / JST_MB);
         const F32 throughputRatio = (bufferThroughputMB / sdrThroughputMB) * 0.5f;
         const auto throughputOverlay = jst::fmt::format("{:.0f}/{:.0f} MB/s", bufferThroughputMB, sdrThroughputMB);
         ImGui::SetNextItemWidth(-1);
@@ -198,6 +228,54 @@ class Soapy : public Block {
             });
         }
 
+        ImGui::TableNextRow();
+        ImGui::TableSetColumnIndex(0);
+        ImGui::TextUnformatted("Channels");
+        ImGui::TableSetColumnIndex(1);
+        ImGui::SetNextItemWidth(-1);
+        F32 numberOfChannels = config.numberOfChannels;
+        if (ImGui::InputFloat("##channels", &numberOfChannels, 1.0f, 1.0f, "%.0f", ImGuiInputTextFlags_EnterReturnsTrue)) {
+            if (numberOfChannels >= 1) {
+                config.numberOfChannels = static_cast<U64>(numberOfChannels);
+
+                JST_DISPATCH_ASYNC([&](){
+                    ImGui::InsertNotification({ ImGuiToastType_Info, 1000, "Reloading block..." });
+                    JST_CHECK_NOTIFY(instance().reloadBlock(locale()));
+                });
+            }
+        }
+
+        ImGui::TableNextRow();
+        ImGui::TableSetColumnIndex(0);
+        ImGui::TextUnformatted("Adaptive Buffer");
+        ImGui::TableSetColumnIndex(1);
+        ImGui::SetNextItemWidth(-1);
+        if (ImGui::Checkbox("##AdaptiveBuffer", &config.adaptiveBuffer)) {
+            JST_DISPATCH_ASYNC([&](){
+                ImGui::InsertNotification({ ImGuiToastType_Info, 1000, "Reloading block..." });
+                JST_CHECK_NOTIFY(instance().reloadBlock(locale()));
+            });
+        }
+
+        if (config.adaptiveBuffer) {
+            ImGui::TableNextRow();
+            ImGui::TableSetColumnIndex(0);
+            ImGui::TextUnformatted("Max Latency");
+            ImGui::TableSetColumnIndex(1);
+            ImGui::SetNextItemWidth(-1);
+            F32 maxLatencyMs = config.maxLatencyMs;
+            if (ImGui::InputFloat("##MaxLatency", &maxLatencyMs, 10.0f, 100.0f, "%.0f ms", ImGuiInputTextFlags_EnterReturnsTrue)) {
+                if (maxLatencyMs >= 1.0f) {
+                    config.maxLatencyMs = maxLatencyMs;
+
+                    JST_DISPATCH_ASYNC([&](){
+                        ImGui::InsertNotification({ ImGuiToastType_Info, 1000, "Reloading block..." });
+                        JST_CHECK_NOTIFY(instance().reloadBlock(locale()));
+                    });
+                }
+            }
+        }
+
         ImGui::TableNextRow();
         ImGui::TableSetColumnIndex(0);
         ImGui::TextUnformatted("Sample Rate");
@@ -0,0 +1,312 @@
+#ifndef JETSTREAM_BLOCK_SOAPY_SINK_BASE_HH
+#define JETSTREAM_BLOCK_SOAPY_SINK_BASE_HH
+
+#include "jetstream/block.hh"
+#include "jetstream/instance.hh"
+#include "jetstream/modules/soapy_sink.hh"
+
+namespace Jetstream::Blocks {
+
+template<Device D, typename IT, typename OT>
+class SoapySink : public Block {
+ public:
+    using SoapySinkModule = Jetstream::SoapySink<D, IT>;
+
+    // Configuration
+
+    struct Config {
+        std::string hintString = "";
+        std::string deviceString = "";
+        std::string streamString = "";
+        F32 frequency = 96.9e6;
+        F32 sampleRate = 2.0e6;
+        F32 gain = 0.0f;
+        U64 bufferMultiplier = 4;
+        bool nativeFormat = true;
+
+        JST_SERDES(hintString, deviceString, streamString,
+                   frequency, sampleRate, gain,
+                   bufferMultiplier, nativeFormat);
+    };
+
+    constexpr const Config& getConfig() const {
+        return config;
+    }
+
+    // Input
+
+    struct Input {
+        Tensor<D, IT> buffer;
+
+        JST_SERDES(buffer);
+    };
+
+    constexpr const Input& getInput() const {
+        return input;
+    }
+
+    // Output
+
+    struct Output {
+        JST_SERDES();
+    };
+
+    constexpr const Output& getOutput() const {
+        return output;
+    }
+
+    // Housekeeping
+
+    constexpr Device device() const {
+        return D;
+    }
+
+    std::string id() const {
+        return "soapy-sink";
+    }
+
+    std::string name() const {
+        return "Soapy Sink";
+    }
+
+    std::string summary() const {
+        return "Transmits a signal with SoapySDR devices.";
+    }
+
+    std::string description() const {
+        // TODO: Add decent block description describing internals and I/O.
+        return "Transmits every input with a SoapySDR device able to transmit, like a signal generated by the "
+               "Signal Generator or read by the File Reader. Inputs are queued in a lock-free ring drained by a "
+               "device thread, straight into the buffers of the driver when it has direct buffer access. "
+               "When the device streams CS16, float inputs are quantized to its full scale in the flowgraph, so the "
+               "driver sends them without converting them. The CI16 variant sends integer samples as they are. "
+               "The flowgraph waits while the ring is full, so it runs at the device rate. When the ring runs dry, "
+               "zeros are transmitted and counted as underflows, next to the underflows reported by the driver.";
+    }
+
+    // Constructor
+
+    Result create() {
+        // Preload configuration device string.
+        std::string deviceString = config.deviceString;
+
+        // Gather list of available devices according to the hint string.
+        availableDeviceList = SoapySinkModule::ListAvailableDevices(config.hintString);
+
+        // Load the first device if device string is empty and there are devices available.
+        if (deviceString.empty() && !availableDeviceList.empty()) {
+            const auto& [_, device] = *availableDeviceList.begin();
+            deviceString = device.toString();
+        }
+
+        // Starting sub-modules.
+
+        JST_CHECK(instance().addModule(
+            soapy, "soapy_sink", {
+                .deviceString = deviceString,
+                .streamString = config.streamString,
+                .frequency = config.frequency,
+                .sampleRate = config.sampleRate,
+                .gain = config.gain,
+                .bufferMultiplier = config.bufferMultiplier,
+                .nativeFormat = config.nativeFormat,
+            }, {
+                .buffer = input.buffer,
+            },
+            locale()
+        ));
+
+        // Fetching configuration.
+
+        currentDevice = soapy->getDeviceLabel();
+
+        return Result::SUCCESS;
+    }
+
+    Result destroy() {
+        if (soapy) {
+            JST_CHECK(instance().eraseModule(soapy->locale()));
+        }
+
+        return Result::SUCCESS;
+    }
+
+    // Interface
+
+    void drawInfo() {
+        ImGui::TableNextRow();
+        ImGui::TableSetColumnIndex(0);
+        ImGui::TextUnformatted("Device Name");
+        ImGui::TableSetColumnIndex(1);
+        ImGui::TextFormatted("{} ({})", soapy->getDeviceName(), soapy->getDeviceHardwareKey());
+
+        ImGui::TableNextRow();
+        ImGui::TableSetColumnIndex(0);
+        ImGui::TextUnformatted("Stream Format");
+        ImGui::TableSetColumnIndex(1);
+        ImGui::TextFormatted("{}", soapy->getStreamFormat());
+
+        ImGui::TableNextRow();
+        ImGui::TableSetColumnIndex(0);
+        ImGui::TextUnformatted("Sent");
+        ImGui::TableSetColumnIndex(1);
+        ImGui::TextFormatted("{:.1f} MS", static_cast<F32>(soapy->getSamplesSent()) / 1e6f);
+
+        ImGui::TableNextRow();
+        ImGui::TableSetColumnIndex(0);
+        ImGui::TextUnformatted("Underflows");
+        ImGui::TableSetColumnIndex(1);
+        ImGui::TextFormatted("{} ({} samples), {} device", soapy->getUnderflows(),
+                                                           soapy->getUnderflowSamples(),
+                                                           soapy->getDeviceUnderflows());
+
+        ImGui::TableNextRow();
+        ImGui::TableSetColumnIndex(0);
+        ImGui::TextUnformatted("Latency");
+        ImGui::TableSetColumnIndex(1);
+        ImGui::TextFormatted("{:.1f} ms", soapy->getBufferLatency() * 1e3f);
+    }
+
+    constexpr bool shouldDrawInfo() const {
+        return true;
+    }
+
+    void drawControl() {
+        ImGui::TableNextRow();
+        ImGui::TableSetColumnIndex(0);
+        ImGui::TextUnformatted("Sample Rate");
+        ImGui::TableSetColumnIndex(1);
+        ImGui::SetNextItemWidth(-1);
+        F32 sampleRate = config.sampleRate / 1e6f;
+        if (ImGui::InputFloat("##SampleRate", &sampleRate, 1.0f, 2.0f, "%.3f MHz", ImGuiInputTextFlags_EnterReturnsTrue)) {
+            config.sampleRate = sampleRate * 1e6;
+
+            JST_DISPATCH_ASYNC([&](){
+                ImGui::InsertNotification({ ImGuiToastType_Info, 1000, "Reloading block..." });
+                JST_CHECK_NOTIFY(instance().reloadBlock(locale()));
+            });
+        }
+
+        ImGui::TableNextRow();
+        ImGui::TableSetColumnIndex(0);
+        ImGui::TextUnformatted("Gain");
+        ImGui::TableSetColumnIndex(1);
+        ImGui::SetNextItemWidth(-1);
+        if (ImGui::InputFloat("##Gain", &config.gain, 1.0f, 5.0f, "%.1f dB")) {
+            JST_MODULE_UPDATE(soapy, setGain(config.gain));
+        }
+
+        ImGui::TableNextRow();
+        ImGui::TableSetColumnIndex(0);
+        ImGui::TextUnformatted("Buffer Multiplier");
+        ImGui::TableSetColumnIndex(1);
+        ImGui::SetNextItemWidth(-1);
+        F32 bufferMultiplier = config.bufferMultiplier;
+        if (ImGui::InputFloat("##BufferMultiplier", &bufferMultiplier, 1.0f, 1.0f, "%.0f", ImGuiInputTextFlags_EnterReturnsTrue)) {
+            if (bufferMultiplier >= 2.0f) {
+                config.bufferMultiplier = static_cast<U64>(bufferMultiplier);
+
+                JST_DISPATCH_ASYNC([&](){
+                    ImGui::InsertNotification({ ImGuiToastType_Info, 1000, "Reloading block..." });
+                    JST_CHECK_NOTIFY(instance().reloadBlock(locale()));
+                });
+            }
+        }
+
+        if constexpr (std::is_same_v<IT, CF32>) {
+            ImGui::TableNextRow();
+            ImGui::TableSetColumnIndex(0);
+            ImGui::TextUnformatted("Native Format");
+            ImGui::TableSetColumnIndex(1);
+            ImGui::SetNextItemWidth(-1);
+            if (ImGui::Checkbox("##NativeFormat", &config.nativeFormat)) {
+                JST_DISPATCH_ASYNC([&](){
+                    ImGui::InsertNotification({ ImGuiToastType_Info, 1000, "Reloading block..." });
+                    JST_CHECK_NOTIFY(instance().reloadBlock(locale()));
+                });
+            }
+        }
+
+        ImGui::TableNextRow();
+        ImGui::TableSetColumnIndex(0);
+        ImGui::TextUnformatted("Device Hint");
+        ImGui::TableSetColumnIndex(1);
+        ImGui::SetNextItemWidth(-1);
+        ImGui::InputText("##DeviceHintInput", &config.hintString);
+
+        ImGui::TableNextRow();
+        ImGui::TableSetColumnIndex(0);
+        ImGui::TextUnformatted("Device List");
+        ImGui::TableSetColumnIndex(1);
+        ImGui::SetNextItemWidth(-1);
+        static const char* noDeviceMessage = "No device found";
+        if (ImGui::BeginCombo("##DeviceList", availableDeviceList.empty() ? noDeviceMessage : currentDevice.c_str())) {
+            for (const auto& [label, device] : availableDeviceList) {
+                bool isSelected = (currentDevice == label);
+                if (ImGui::Selectable(label.c_str(), isSelected)) {
+                    currentDevice = label;
+                    config.deviceString = device.toString();
+
+                    JST_DISPATCH_ASYNC([&](){
+                        ImGui::InsertNotification({ ImGuiToastType_Info, 1000, "Reloading block..." });
+                        JST_CHECK_NOTIFY(instance().reloadBlock(locale()));
+                    });
+                }
+                if (isSelected) {
+                    ImGui::SetItemDefaultFocus();
+                }
+            }
+            ImGui::EndCombo();
+        }
+
+        ImGui::TableNextRow();
+        ImGui::TableSetColumnIndex(0);
+        ImGui::TableSetColumnIndex(1);
+        const F32 fullWidth = ImGui::GetContentRegionAvail().x;
+        if (ImGui::Button("Reload Device List", ImVec2(fullWidth, 0))) {
+            JST_DISPATCH_ASYNC([&](){
+                ImGui::InsertNotification({ ImGuiToastType_Info, 1000, "Reloading device list..." });
+                availableDeviceList = SoapySinkModule::ListAvailableDevices(config.hintString);
+                JST_CHECK_NOTIFY(Result::SUCCESS);
+            });
+        }
+
+        ImGui::TableNextRow();
+        ImGui::TableSetColumnIndex(0);
+        ImGui::TextUnformatted("Frequency");
+        ImGui::TableSetColumnIndex(1);
+        ImGui::SetNextItemWidth(-1);
+        F32 frequency = config.frequency / JST_MHZ;
+        if (ImGui::InputFloat("##Frequency", &frequency, stepSize, stepSize, "%.3f MHz")) {
+            config.frequency = frequency * JST_MHZ;
+            JST_MODULE_UPDATE(soapy, setTunerFrequency(config.frequency));
+        }
+
+        ImGui::TableNextRow();
+        ImGui::TableSetColumnIndex(0);
+        ImGui::TextUnformatted("Step Size");
+        ImGui::TableSetColumnIndex(1);
+        ImGui::SetNextItemWidth(-1);
+        ImGui::InputFloat("##StepSize", &stepSize, 1.0f, 5.0f, "%.3f MHz");
+    }
+
+    constexpr bool shouldDrawControl() const {
+        return true;
+    }
+
+ private:
+    F32 stepSize = 10.0f;
+    std::string currentDevice;
+    typename SoapySinkModule::DeviceList availableDeviceList;
+
+    std::shared_ptr<SoapySinkModule> soapy;
+
+    JST_DEFINE_IO()
+};
+
+}  // namespace Jetstream::Blocks
+
+JST_BLOCK_ENABLE(SoapySink, is_specialized<Jetstream::SoapySink<D, IT>>::value &&
+                            std::is_same<OT, void>::value)
+
+#endif
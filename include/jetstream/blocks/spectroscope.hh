@@ -180,18 +180,37 @@ class Spectroscope : public Block {
             ));
         }
 
+        // The waterfall draws complex bins in decibels itself, so its whole
+        // history follows the range.
+
         if (config.waterfall) {
-            JST_CHECK(instance().addModule(
-                waterfall, "waterfall", {
-                    .zoom = 1.0,
-                    .offset = 0,
-                    .height = 512,
-                    .viewSize = individualViewSize,
-                }, {
-                    .buffer = scale->getOutputBuffer(),
-                },
-                locale()
-            ));
+            if constexpr (IsComplex<IT>::value) {
+                JST_CHECK(instance().addModule(
+                    waterfall, "waterfall", {
+                        .zoom = 1.0,
+                        .offset = 0,
+                        .height = 512,
+                        .viewSize = individualViewSize,
+                        .decibels = true,
+                        .range = config.range,
+                    }, {
+                        .buffer = fft->getOutputBuffer(),
+                    },
+                    locale()
+                ));
+            } else {
+                JST_CHECK(instance().addModule(
+                    waterfall, "waterfall", {
+                        .zoom = 1.0,
+                        .offset = 0,
+                        .height = 512,
+                        .viewSize = individualViewSize,
+                    }, {
+                        .buffer = scale->getOutputBuffer(),
+                    },
+                    locale()
+                ));
+            }
         }
 
         JST_CHECK(Block::LinkOutput("buffer", output.buffer, scale->getOutputBuffer()));
@@ -255,6 +274,10 @@ class Spectroscope : public Block {
         if (ImGui::DragFloatRange2("##ScaleRange", &min, &max,
                                    1, -300, 0, "Min: %.0f", "Max: %.0f")) {
             config.range = scale->range({min, max});
+
+            if (waterfall) {
+                waterfall->range(config.range);
+            }
         }
 
         ImGui::TableNextRow();
@@ -378,7 +401,7 @@ class Spectroscope : public Block {
 
     std::shared_ptr<Jetstream::Spectrogram<D, OT>> spectrogram;
     std::shared_ptr<Jetstream::Lineplot<D, OT>> lineplot;
-    std::shared_ptr<Jetstream::Waterfall<D, OT>> waterfall;
+    std::shared_ptr<Jetstream::Waterfall<D, IT>> waterfall;
 
     JST_DEFINE_IO()
 };
@@ -386,7 +409,7 @@ class Spectroscope : public Block {
 }  // namespace Jetstream::Blocks
 
 JST_BLOCK_ENABLE(Spectroscope, is_specialized<Jetstream::Spectrogram<D, OT>>::value &&
-                               is_specialized<Jetstream::Waterfall<D, OT>>::value &&
+                               is_specialized<Jetstream::Waterfall<D, IT>>::value &&
                                is_specialized<Jetstream::Lineplot<D, OT>>::value &&
                                is_specialized<Jetstream::Scale<D, OT>>::value &&
                                is_specialized<Jetstream::Amplitude<D, IT, OT>>::value &&
@@ -5,6 +5,7 @@
 #include "jetstream/instance.hh"
 #include "jetstream/macros.hh"
 #include "jetstream/modules/tensor_modifier.hh"
+#include "jetstream/modules/framer.hh"
 #include "jetstream/modules/window.hh"
 #include "jetstream/modules/multiply.hh"
 #include "jetstream/modules/fft.hh"
@@ -25,8 +26,11 @@ class SpectrumEngine : public Block {
         bool enableAGC = false;
         bool enableScale = false;
         Range<OT> range = {-120.0, 0.0};
+        bool enableWelch = false;
+        F32 overlap = 0.5f;
+        U64 averages = 8;
 
-        JST_SERDES(axis, enableAGC, enableScale, range);
+        JST_SERDES(axis, enableAGC, enableScale, range, enableWelch, overlap, averages);
     };
 
     constexpr const Config& getConfig() const {
@@ -88,7 +92,10 @@ class SpectrumEngine : public Block {
                "- **Axis**: The axis along which to compute the spectrum (determines window size).\n"
                "- **Enable AGC**: Whether to apply automatic gain control after the FFT.\n"
                "- **Enable Scale**: Whether to apply scaling to the final output.\n"
-               "- **Scale Range**: The minimum and maximum values for scaling (in dBFS).\n\n"
+               "- **Scale Range**: The minimum and maximum values for scaling (in dBFS).\n"
+               "- **Enable Welch**: Whether to average overlapped frames in linear power before the log.\n"
+               "- **Overlap**: The fraction of each frame shared with the next one in Welch mode.\n"
+               "- **Averages**: The number of frames averaged into each output in Welch mode.\n\n"
 
                "## Processing Chain:\n"
                "Input → Window → Multiply → FFT → [AGC] → Amplitude → [Scale] → Output\n"
@@ -99,6 +106,14 @@ class SpectrumEngine : public Block {
                "5. Amplitude module computes the magnitude of the complex spectrum.\n"
                "6. Optional Scale module applies the specified scaling range.\n\n"
 
+               "## Welch Mode:\n"
+               "Input → Framer → Window → Multiply → FFT → [AGC] → Amplitude (Averaged) → [Scale] → Output\n"
+               "The input is cut into frames as long as the axis, each starting a hop after the previous one "
+               "and keeping the overlap across buffers. The power of every group of frames is averaged before "
+               "the conversion to decibels, so the log runs once per output and the estimate has a much "
+               "lower variance than averaging in display space. The number of frames is the input size "
+               "divided by the hop and should be a multiple of the averages.\n\n"
+
                "## Useful For:\n"
                "- Spectral analysis and visualization\n"
                "- Power spectral density computation\n"
@@ -107,7 +122,10 @@ class SpectrumEngine : public Block {
                "## Examples:\n"
                "- Time-domain spectrum analysis:\n"
                "  Config: Axis=1, Enable AGC=true, Enable Scale=true\n"
-               "  Input: CF32[8192, 1024] → Output: OT[8192, 1024]";
+               "  Input: CF32[8192, 1024] → Output: OT[8192, 1024]\n"
+               "- Welch power spectral density:\n"
+               "  Config: Axis=1, Enable Welch=true, Overlap=0.5, Averages=16\n"
+               "  Input: CF32[64, 1024] → Output: OT[8, 1024]";
     }
 
     // Constructor
@@ -135,6 +153,40 @@ class SpectrumEngine : public Block {
             locale()
         ));
 
+        auto frames = modifier->getOutputBuffer();
+
+        // Welch mode cuts overlapped frames along the last axis.
+
+        if (config.enableWelch) {
+            if (config.axis != input.buffer.rank() - 1) {
+                JST_ERROR("Welch mode requires the axis ({}) to be the last one.", config.axis);
+                return Result::ERROR;
+            }
+
+            if (config.overlap < 0.0f || config.overlap >= 1.0f) {
+                JST_ERROR("Overlap ({}) should be between 0 and 1.", config.overlap);
+                return Result::ERROR;
+            }
+
+            if constexpr (is_specialized<Jetstream::Framer<D, IT>>::value) {
+                const U64 hop = std::max<U64>(1, std::llround(windowSize * (1.0f - config.overlap)));
+
+                JST_CHECK(instance().addModule(
+                    framer, "framer", {
+                        .hop = hop,
+                    }, {
+                        .buffer = frames,
+                    },
+                    locale()
+                ));
+
+                frames = framer->getOutputBuffer();
+            } else {
+                JST_ERROR("Welch mode isn't available for this device.");
+                return Result::ERROR;
+            }
+        }
+
         JST_CHECK(instance().addModule(
             window, "window", {
                 .size = windowSize,
@@ -151,8 +203,8 @@ class SpectrumEngine : public Block {
 
         JST_CHECK(instance().addModule(
             multiply, "multiply", {}, {
-                .factorA = modifier->getOutputBuffer(),
-                .factorB = invert->getOutputBuffer(),
+                .factorA = invert->getOutputBuffer(),
+                .factorB = frames,
             },
             locale()
         ));
@@ -180,7 +232,9 @@ class SpectrumEngine : public Block {
         }
 
         JST_CHECK(instance().addModule(
-            amplitude, "amplitude", {}, {
+            amplitude, "amplitude", {
+                .averages = (config.enableWelch) ? config.averages : 1,
+            }, {
                 .buffer = fftOutput,
             },
             locale()
@@ -235,6 +289,10 @@ class SpectrumEngine : public Block {
             JST_CHECK(instance().eraseModule(window->locale()));
         }
 
+        if (framer) {
+            JST_CHECK(instance().eraseModule(framer->locale()));
+        }
+
         if (modifier) {
             JST_CHECK(instance().eraseModule(modifier->locale()));
         }
@@ -286,6 +344,54 @@ class SpectrumEngine : public Block {
             });
         }
 
+        ImGui::TableNextRow();
+        ImGui::TableSetColumnIndex(0);
+        ImGui::TextUnformatted("Enable Welch");
+        ImGui::TableSetColumnIndex(1);
+        ImGui::SetNextItemWidth(-1);
+        if (ImGui::Checkbox("##enableWelch", &config.enableWelch)) {
+            JST_DISPATCH_ASYNC([&](){
+                ImGui::InsertNotification({ ImGuiToastType_Info, 1000, "Reloading block..." });
+                JST_CHECK_NOTIFY(instance().reloadBlock(locale()));
+            });
+        }
+
+        if (config.enableWelch) {
+            ImGui::TableNextRow();
+            ImGui::TableSetColumnIndex(0);
+            ImGui::TextUnformatted("Overlap");
+            ImGui::TableSetColumnIndex(1);
+            ImGui::SetNextItemWidth(-1);
+            F32 overlap = config.overlap * 100.0f;
+            if (ImGui::InputFloat("##overlap", &overlap, 25.0f, 25.0f, "%.0f %%", ImGuiInputTextFlags_EnterReturnsTrue)) {
+                if (overlap >= 0.0f && overlap < 100.0f) {
+                    config.overlap = overlap / 100.0f;
+
+                    JST_DISPATCH_ASYNC([&](){
+                        ImGui::InsertNotification({ ImGuiToastType_Info, 1000, "Reloading block..." });
+                        JST_CHECK_NOTIFY(instance().reloadBlock(locale()));
+                    });
+                }
+            }
+
+            ImGui::TableNextRow();
+            ImGui::TableSetColumnIndex(0);
+            ImGui::TextUnformatted("Averages");
+            ImGui::TableSetColumnIndex(1);
+            ImGui::SetNextItemWidth(-1);
+            F32 averages = config.averages;
+            if (ImGui::InputFloat("##averages", &averages, 1.0f, 1.0f, "%.0f", ImGuiInputTextFlags_EnterReturnsTrue)) {
+                if (averages >= 1) {
+                    config.averages = static_cast<U64>(averages);
+
+                    JST_DISPATCH_ASYNC([&](){
+                        ImGui::InsertNotification({ ImGuiToastType_Info, 1000, "Reloading block..." });
+                        JST_CHECK_NOTIFY(instance().reloadBlock(locale()));
+                    });
+                }
+            }
+        }
+
         if (config.enableScale && scale) {
             ImGui::TableNextRow();
             ImGui::TableSetColumnIndex(0);
@@ -306,6 +412,7 @@ class SpectrumEngine : public Block {
 
  private:
     std::shared_ptr<Jetstream::TensorModifier<D, IT>> modifier;
+    std::shared_ptr<Jetstream::Framer<D, IT>> framer;
     std::shared_ptr<Jetstream::Window<D, IT>> window;
     std::shared_ptr<Jetstream::Invert<D, IT>> invert;
     std::shared_ptr<Jetstream::Multiply<D, IT>> multiply;
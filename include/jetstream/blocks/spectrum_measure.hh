@@ -0,0 +1,312 @@
+#ifndef JETSTREAM_BLOCK_SPECTRUM_MEASURE_BASE_HH
+#define JETSTREAM_BLOCK_SPECTRUM_MEASURE_BASE_HH
+
+#include "jetstream/block.hh"
+#include "jetstream/instance.hh"
+#include "jetstream/modules/spectrum_measure.hh"
+
+namespace Jetstream::Blocks {
+
+template<Device D, typename IT, typename OT>
+class SpectrumMeasure : public Block {
+ public:
+    // Configuration
+
+    struct Config {
+        F32 sampleRate = 2.0e6f;
+        U64 numberOfPeaks = 8;
+        F32 threshold = 10.0f;
+        std::vector<F32> center = {0.0e6f};
+        std::vector<F32> bandwidth = {200.0e3f};
+
+        JST_SERDES(sampleRate, numberOfPeaks, threshold, center, bandwidth);
+    };
+
+    constexpr const Config& getConfig() const {
+        return config;
+    }
+
+    // Input
+
+    struct Input {
+        Tensor<D, IT> buffer;
+
+        JST_SERDES(buffer);
+    };
+
+    constexpr const Input& getInput() const {
+        return input;
+    }
+
+    // Output
+
+    struct Output {
+        Tensor<D, IT> peaks;
+        Tensor<D, IT> floor;
+        Tensor<D, IT> power;
+
+        JST_SERDES(peaks, floor, power);
+    };
+
+    constexpr const Output& getOutput() const {
+        return output;
+    }
+
+    constexpr const Tensor<D, IT>& getOutputPeaks() const {
+        return this->output.peaks;
+    }
+
+    constexpr const Tensor<D, IT>& getOutputFloor() const {
+        return this->output.floor;
+    }
+
+    constexpr const Tensor<D, IT>& getOutputPower() const {
+        return this->output.power;
+    }
+
+    // Housekeeping
+
+    constexpr Device device() const {
+        return D;
+    }
+
+    std::string id() const {
+        return "spectrum-measure";
+    }
+
+    std::string name() const {
+        return "Spectrum Measure";
+    }
+
+    std::string summary() const {
+        return "Finds peaks, noise floor and channel power of a spectrum.";
+    }
+
+    std::string description() const {
+        return "The Spectrum Measure block reduces a spectrum in decibels, like the output of the Spectrum "
+               "Engine without scaling, to a handful of measurements. It reports the strongest peaks, a noise "
+               "floor estimate and the integrated power of a set of bands for every spectrum of the batch. "
+               "The outputs are a few values per spectrum, small enough to ship to a remote consumer instead "
+               "of the full spectrum.\n\n"
+
+               "## Parameters\n"
+               "- **Sample Rate**: The sample rate of the signal the spectrum was computed from.\n"
+               "- **Peaks**: The number of peaks to report.\n"
+               "- **Threshold**: How far above the noise floor a peak should be (in dB).\n"
+               "- **Bands**: The number of bands to measure.\n"
+               "- **Center** and **Bandwidth**: The span of each band relative to the center of the spectrum.\n\n"
+
+               "## Outputs\n"
+               "- **Peaks**: F32[batch, peaks, 2] with the frequency relative to the center and the level of "
+               "each peak, strongest first. Unused slots are NaN.\n"
+               "- **Floor**: F32[batch] with the median level of each spectrum.\n"
+               "- **Power**: F32[batch, bands] with the power of each band (in dB).\n\n"
+
+               "## Useful For:\n"
+               "- Signal detection and logging.\n"
+               "- Channel occupancy and power monitoring.\n"
+               "- Feeding measurements to remote consumers.\n\n"
+
+               "## Examples:\n"
+               "- Two channels:\n"
+               "  Config: Peaks=4, Center=[-250 kHz, 250 kHz], Bandwidth=[200 kHz, 200 kHz]\n"
+               "  Input: F32[8, 8192] → Peaks: F32[8, 4, 2], Floor: F32[8], Power: F32[8, 2]\n\n"
+
+               "## Implementation:\n"
+               "Input → Spectrum Measure → Outputs\n"
+               "1. The noise floor is the median bin, robust to a few strong carriers.\n"
+               "2. Band power is summed in linear units with a vectorized reduction.\n"
+               "3. Peaks are local maxima above the threshold, refined with a parabola through their neighbours.";
+    }
+
+    // Constructor
+
+    Result create() {
+        JST_CHECK(instance().addModule(
+            measure, "measure", {
+                .sampleRate = config.sampleRate,
+                .numberOfPeaks = config.numberOfPeaks,
+                .threshold = config.threshold,
+                .center = config.center,
+                .bandwidth = config.bandwidth,
+            }, {
+                .buffer = input.buffer,
+            },
+            locale()
+        ));
+
+        JST_CHECK(Block::LinkOutput("peaks", output.peaks, measure->getOutputPeaks()));
+        JST_CHECK(Block::LinkOutput("floor", output.floor, measure->getOutputFloor()));
+        JST_CHECK(Block::LinkOutput("power", output.power, measure->getOutputPower()));
+
+        return Result::SUCCESS;
+    }
+
+    Result destroy() {
+        if (measure) {
+            JST_CHECK(instance().eraseModule(measure->locale()));
+        }
+
+        return Result::SUCCESS;
+    }
+
+    // Interface
+
+    void drawInfo() {
+        // Measurements of the first spectrum of the batch.
+
+        if constexpr (D == Device::CPU) {
+            const auto& floor = measure->getOutputFloor();
+            const auto& power = measure->getOutputPower();
+            const auto& peaks = measure->getOutputPeaks();
+
+            ImGui::TableNextRow();
+            ImGui::TableSetColumnIndex(0);
+            ImGui::TextUnformatted("Noise Floor");
+            ImGui::TableSetColumnIndex(1);
+            ImGui::TextFormatted("{:.1f} dB", floor[0]);
+
+            for (U64 b = 0; b < config.center.size(); b++) {
+                ImGui::TableNextRow();
+                ImGui::TableSetColumnIndex(0);
+                ImGui::TextFormatted("Power #{:02}", b);
+                ImGui::TableSetColumnIndex(1);
+                ImGui::TextFormatted("{:.1f} dB", power[{0, b}]);
+            }
+
+            for (U64 k = 0; k < config.numberOfPeaks; k++) {
+                const F32 frequency = peaks[{0, k, 0}];
+                if (std::isnan(frequency)) {
+                    break;
+                }
+
+                ImGui::TableNextRow();
+                ImGui::TableSetColumnIndex(0);
+                ImGui::TextFormatted("Peak #{:02}", k);
+                ImGui::TableSetColumnIndex(1);
+                ImGui::TextFormatted("{:.3f} MHz ({:.1f} dB)", frequency / JST_MHZ, peaks[{0, k, 1}]);
+            }
+        }
+    }
+
+    constexpr bool shouldDrawInfo() const {
+        return D == Device::CPU;
+    }
+
+    void drawControl() {
+        ImGui::TableNextRow();
+        ImGui::TableSetColumnIndex(0);
+        ImGui::TextUnformatted("Sample Rate");
+        ImGui::TableSetColumnIndex(1);
+        ImGui::SetNextItemWidth(-1);
+        F32 sampleRate = config.sampleRate / JST_MHZ;
+        if (ImGui::InputFloat("##measure-sample-rate", &sampleRate, 1.0f, 1.0f, "%.3f MHz", ImGuiInputTextFlags_EnterReturnsTrue)) {
+            config.sampleRate = sampleRate * JST_MHZ;
+
+            JST_DISPATCH_ASYNC([&](){
+                ImGui::InsertNotification({ ImGuiToastType_Info, 1000, "Reloading block..." });
+                JST_CHECK_NOTIFY(instance().reloadBlock(locale()));
+            });
+        }
+
+        ImGui::TableNextRow();
+        ImGui::TableSetColumnIndex(0);
+        ImGui::TextUnformatted("Peaks");
+        ImGui::TableSetColumnIndex(1);
+        ImGui::SetNextItemWidth(-1);
+        F32 numberOfPeaks = config.numberOfPeaks;
+        if (ImGui::InputFloat("##measure-peaks", &numberOfPeaks, 1.0f, 1.0f, "%.0f", ImGuiInputTextFlags_EnterReturnsTrue)) {
+            if (numberOfPeaks >= 1) {
+                config.numberOfPeaks = static_cast<U64>(numberOfPeaks);
+
+                JST_DISPATCH_ASYNC([&](){
+                    ImGui::InsertNotification({ ImGuiToastType_Info, 1000, "Reloading block..." });
+                    JST_CHECK_NOTIFY(instance().reloadBlock(locale()));
+                });
+            }
+        }
+
+        ImGui::TableNextRow();
+        ImGui::TableSetColumnIndex(0);
+        ImGui::TextUnformatted("Threshold");
+        ImGui::TableSetColumnIndex(1);
+        ImGui::SetNextItemWidth(-1);
+        F32 threshold = config.threshold;
+        if (ImGui::InputFloat("##measure-threshold", &threshold, 1.0f, 5.0f, "%.1f dB", ImGuiInputTextFlags_EnterReturnsTrue)) {
+            config.threshold = threshold;
+
+            JST_DISPATCH_ASYNC([&](){
+                ImGui::InsertNotification({ ImGuiToastType_Info, 1000, "Reloading block..." });
+                JST_CHECK_NOTIFY(instance().reloadBlock(locale()));
+            });
+        }
+
+        ImGui::TableNextRow();
+        ImGui::TableSetColumnIndex(0);
+        ImGui::TextUnformatted("Bands");
+        ImGui::TableSetColumnIndex(1);
+        ImGui::SetNextItemWidth(-1);
+        F32 bands = config.center.size();
+        if (ImGui::InputFloat("##measure-bands", &bands, 1.0f, 1.0f, "%.0f", ImGuiInputTextFlags_EnterReturnsTrue)) {
+            if (bands >= 1 && bands != config.center.size()) {
+                config.center.resize(bands, 0.0f);
+                config.bandwidth.resize(bands, 200.0e3f);
+
+                JST_DISPATCH_ASYNC([&](){
+                    ImGui::InsertNotification({ ImGuiToastType_Info, 1000, "Reloading block..." });
+                    JST_CHECK_NOTIFY(instance().reloadBlock(locale()));
+                });
+            }
+        }
+
+        for (U64 i = 0; i < config.center.size(); i++) {
+            ImGui::TableNextRow();
+            ImGui::TableSetColumnIndex(0);
+            ImGui::TextFormatted("Center #{:02}", i);
+            ImGui::TableSetColumnIndex(1);
+            ImGui::SetNextItemWidth(-1);
+            const std::string centerId = jst::fmt::format("##measure-center-{}", i);
+            F32 center = config.center[i] / JST_MHZ;
+            if (ImGui::InputFloat(centerId.c_str(), &center, 0.1f, 1.0f, "%.3f MHz", ImGuiInputTextFlags_EnterReturnsTrue)) {
+                config.center[i] = center * JST_MHZ;
+
+                JST_DISPATCH_ASYNC([&](){
+                    ImGui::InsertNotification({ ImGuiToastType_Info, 1000, "Reloading block..." });
+                    JST_CHECK_NOTIFY(instance().reloadBlock(locale()));
+                });
+            }
+
+            ImGui::TableNextRow();
+            ImGui::TableSetColumnIndex(0);
+            ImGui::TextFormatted("Bandwidth #{:02}", i);
+            ImGui::TableSetColumnIndex(1);
+            ImGui::SetNextItemWidth(-1);
+            const std::string bandwidthId = jst::fmt::format("##measure-bandwidth-{}", i);
+            F32 bandwidth = config.bandwidth[i] / JST_MHZ;
+            if (ImGui::InputFloat(bandwidthId.c_str(), &bandwidth, 0.1f, 1.0f, "%.3f MHz", ImGuiInputTextFlags_EnterReturnsTrue)) {
+                config.bandwidth[i] = bandwidth * JST_MHZ;
+
+                JST_DISPATCH_ASYNC([&](){
+                    ImGui::InsertNotification({ ImGuiToastType_Info, 1000, "Reloading block..." });
+                    JST_CHECK_NOTIFY(instance().reloadBlock(locale()));
+                });
+            }
+        }
+    }
+
+    constexpr bool shouldDrawControl() const {
+        return true;
+    }
+
+ private:
+    std::shared_ptr<Jetstream::SpectrumMeasure<D, IT>> measure;
+
+    JST_DEFINE_IO()
+};
+
+}  // namespace Jetstream::Blocks
+
+JST_BLOCK_ENABLE(SpectrumMeasure, is_specialized<Jetstream::SpectrumMeasure<D, IT>>::value &&
+                                  std::is_same<OT, void>::value)
+
+#endif
@@ -14,8 +14,9 @@ class Throttle : public Block {
 
     struct Config {
         U64 intervalMs = 100;
+        F64 sampleRate = 0.0;
 
-        JST_SERDES(intervalMs);
+        JST_SERDES(intervalMs, sampleRate);
     };
 
     constexpr const Config& getConfig() const {
@@ -65,12 +66,14 @@ class Throttle : public Block {
     }
 
     std::string summary() const {
-        return "Throttles tensor data to a specified interval.";
+        return "Throttles tensor data to a specified interval or sample rate.";
     }
 
     std::string description() const {
         // TODO: Add decent block description describing internals and I/O.
-        return "Throttles the flow of tensor data by only allowing data to pass through at specified time intervals. The interval is specified in milliseconds and accounts for execution time to maintain accurate timing.";
+        return "Throttles the flow of tensor data by only allowing data to pass through at specified time intervals. The interval is specified in milliseconds and accounts for execution time to maintain accurate timing. "
+               "With a sample rate set, each input passes once the time spanned by its samples has elapsed instead. Deadlines are kept on a "
+               "fixed schedule, so late wake-ups don't accumulate as drift.";
     }
 
     // Constructor
@@ -79,6 +82,7 @@ class Throttle : public Block {
         JST_CHECK(instance().addModule(
             throttle, "throttle", {
                 .intervalMs = config.intervalMs,
+                .sampleRate = config.sampleRate,
             }, {
                 .buffer = input.buffer,
             },
@@ -100,7 +104,45 @@ class Throttle : public Block {
 
     // Interface
 
+    void drawInfo() {
+        ImGui::TableNextRow();
+        ImGui::TableSetColumnIndex(0);
+        ImGui::TextUnformatted("Rate");
+        ImGui::TableSetColumnIndex(1);
+        const F64 rate = throttle->getRate();
+        if (config.sampleRate > 0.0) {
+            const F64 samplesRate = rate * static_cast<F64>(input.buffer.size()) / JST_MHZ;
+            ImGui::TextFormatted("{:.3f} MS/s ({:.1f} Hz)", samplesRate, rate);
+        } else {
+            ImGui::TextFormatted("{:.1f} Hz", rate);
+        }
+
+        ImGui::TableNextRow();
+        ImGui::TableSetColumnIndex(0);
+        ImGui::TextUnformatted("Lateness");
+        ImGui::TableSetColumnIndex(1);
+        ImGui::TextFormatted("{:.3f} ms", throttle->getLateness() * 1e3);
+    }
+
+    constexpr bool shouldDrawInfo() const {
+        return true;
+    }
+
     void drawControl() {
+        ImGui::TableNextRow();
+        ImGui::TableSetColumnIndex(0);
+        ImGui::TextUnformatted("Sample Rate");
+        ImGui::TableSetColumnIndex(1);
+        ImGui::SetNextItemWidth(-1);
+        F32 sampleRate = static_cast<F32>(config.sampleRate / JST_MHZ);
+        if (ImGui::InputFloat("##ThrottleSampleRate", &sampleRate, 0.1f, 1.0f, "%.3f MHz")) {
+            config.sampleRate = throttle->sampleRate(std::max(sampleRate, 0.0f) * JST_MHZ);
+        }
+
+        if (config.sampleRate > 0.0) {
+            ImGui::BeginDisabled();
+        }
+
         ImGui::TableNextRow();
         ImGui::TableSetColumnIndex(0);
         ImGui::TextUnformatted("Interval (ms)");
@@ -113,6 +155,10 @@ class Throttle : public Block {
                 throttle->intervalMs(config.intervalMs);
             }
         }
+
+        if (config.sampleRate > 0.0) {
+            ImGui::EndDisabled();
+        }
     }
 
     constexpr bool shouldDrawControl() const {
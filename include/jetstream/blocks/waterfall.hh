@@ -18,8 +18,15 @@ class Waterfall : public Block {
         U64 height = 512;
         bool interpolate = true;
         Extent2D<U64> viewSize = {512, 384};
-
-        JST_SERDES(zoom, offset, height, interpolate, viewSize);
+        bool decibels = false;
+        Range<F32> range = {-100.0, 0.0};
+        WaterfallStorage storage = WaterfallStorage::Float32;
+        std::string historyPath = "";
+        U64 historyDepth = 262144;
+        U64 historyLevels = 4;
+
+        JST_SERDES(zoom, offset, height, interpolate, viewSize, decibels, range, storage,
+                   historyPath, historyDepth, historyLevels);
     };
 
     constexpr const Config& getConfig() const {
@@ -68,7 +75,15 @@ class Waterfall : public Block {
 
     std::string description() const {
         // TODO: Add decent block description describing internals and I/O.
-        return "Visualizes frequency-domain data over time in a 2D color-coded format. Suitable for spectral analysis.";
+        return "Visualizes frequency-domain data over time in a 2D color-coded format. Suitable for spectral analysis. "
+               "Real inputs are drawn as values between zero and one, or as linear power in decibels. Complex inputs "
+               "are the bins of a forward FFT and are drawn in decibels. Decibels are mapped from the range while "
+               "drawing, so changing it recolors the whole history.\n"
+               "The history can be stored as 16 or 8-bit values to save memory. These are mapped from the range as "
+               "rows arrive, so changing it only recolors the new rows.\n"
+               "With a history file, every row is also spilled to disk for scrollback. Scroll over the view or use "
+               "the controls to go back in time. Each time scale halves the rows and bins of the previous one, "
+               "keeping the peak, so hours of history load quickly. Only available on the CPU.";
     }
 
     // Constructor
@@ -81,6 +96,12 @@ class Waterfall : public Block {
                 .height = config.height,
                 .interpolate = config.interpolate,
                 .viewSize = config.viewSize,
+                .decibels = config.decibels,
+                .range = config.range,
+                .storage = config.storage,
+                .historyPath = config.historyPath,
+                .historyDepth = config.historyDepth,
+                .historyLevels = config.historyLevels,
             }, {
                 .buffer = input.buffer,
             },
@@ -131,6 +152,12 @@ class Waterfall : public Block {
         } else {
             position = 0;
         }
+
+        const F32 wheel = ImGui::GetIO().MouseWheel;
+        if (ImGui::IsItemHovered() && wheel != 0.0f && waterfall->historyRows() > 0) {
+            const I64 step = static_cast<I64>(wheel * (config.height / 8));
+            waterfall->scrollback(std::max<I64>(static_cast<I64>(waterfall->scrollback()) + step, 0));
+        }
     }
 
     constexpr bool shouldDrawView() const {
@@ -157,6 +184,92 @@ class Waterfall : public Block {
         if (ImGui::DragFloat("##Zoom", &zoom, 0.01, 1.0, 5.0, "%f", ImGuiSliderFlags_AlwaysClamp)) {
             waterfall->zoom(zoom);
         }
+
+        if constexpr (!IsComplex<IT>::value) {
+            ImGui::TableNextRow();
+            ImGui::TableSetColumnIndex(0);
+            ImGui::TextUnformatted("Decibels");
+            ImGui::TableSetColumnIndex(1);
+            ImGui::SetNextItemWidth(-1);
+            if (ImGui::Checkbox("##Decibels", &config.decibels)) {
+                JST_DISPATCH_ASYNC([&](){
+                    ImGui::InsertNotification({ ImGuiToastType_Info, 1000, "Reloading block..." });
+                    JST_CHECK_NOTIFY(instance().reloadBlock(locale()));
+                });
+            }
+        }
+
+        if (config.decibels || IsComplex<IT>::value) {
+            ImGui::TableNextRow();
+            ImGui::TableSetColumnIndex(0);
+            ImGui::TextUnformatted("Range (dBFS)");
+            ImGui::TableSetColumnIndex(1);
+            ImGui::SetNextItemWidth(-1);
+            auto [min, max] = waterfall->range();
+            if (ImGui::DragFloatRange2("##ScaleRange", &min, &max,
+                                       1, -300, 0, "Min: %.0f", "Max: %.0f")) {
+                config.range = waterfall->range({min, max});
+            }
+        }
+
+        ImGui::TableNextRow();
+        ImGui::TableSetColumnIndex(0);
+        ImGui::TextUnformatted("Storage");
+        ImGui::TableSetColumnIndex(1);
+        ImGui::SetNextItemWidth(-1);
+        if (ImGui::BeginCombo("##Storage", config.storage.string().c_str())) {
+            for (const auto& [key, value] : config.storage.rmap()) {
+                bool isSelected = (config.storage == key);
+                if (ImGui::Selectable(value.c_str(), isSelected) && !isSelected) {
+                    config.storage = key;
+
+                    JST_DISPATCH_ASYNC([&](){
+                        ImGui::InsertNotification({ ImGuiToastType_Info, 1000, "Reloading block..." });
+                        JST_CHECK_NOTIFY(instance().reloadBlock(locale()));
+                    });
+                }
+                if (isSelected) {
+                    ImGui::SetItemDefaultFocus();
+                }
+            }
+            ImGui::EndCombo();
+        }
+
+        ImGui::TableNextRow();
+        ImGui::TableSetColumnIndex(0);
+        ImGui::TextUnformatted("History");
+        ImGui::TableSetColumnIndex(1);
+        ImGui::SetNextItemWidth(-1);
+        if (ImGui::InputText("##HistoryPath", &config.historyPath, ImGuiInputTextFlags_EnterReturnsTrue)) {
+            JST_DISPATCH_ASYNC([&](){
+                ImGui::InsertNotification({ ImGuiToastType_Info, 1000, "Reloading block..." });
+                JST_CHECK_NOTIFY(instance().reloadBlock(locale()));
+            });
+        }
+
+        if (!config.historyPath.empty()) {
+            ImGui::TableNextRow();
+            ImGui::TableSetColumnIndex(0);
+            ImGui::TextUnformatted("Time Scale");
+            ImGui::TableSetColumnIndex(1);
+            ImGui::SetNextItemWidth(-1);
+            int level = waterfall->historyLevel();
+            const auto scale = jst::fmt::format("1:{}", 1 << level);
+            if (ImGui::SliderInt("##TimeScale", &level, 0, config.historyLevels - 1, scale.c_str())) {
+                waterfall->historyLevel(level);
+            }
+
+            ImGui::TableNextRow();
+            ImGui::TableSetColumnIndex(0);
+            ImGui::TextUnformatted("Scrollback");
+            ImGui::TableSetColumnIndex(1);
+            ImGui::SetNextItemWidth(-1);
+            F32 scrollback = waterfall->scrollback();
+            if (ImGui::InputFloat("##Scrollback", &scrollback, config.height / 8.0f, config.height,
+                                  "%.0f rows", ImGuiInputTextFlags_EnterReturnsTrue)) {
+                waterfall->scrollback(static_cast<U64>(std::max(scrollback, 0.0f)));
+            }
+        }
     }
 
     constexpr bool shouldDrawControl() const {
@@ -0,0 +1,267 @@
+#ifndef JETSTREAM_BLOCK_XLATING_FILTER_BASE_HH
+#define JETSTREAM_BLOCK_XLATING_FILTER_BASE_HH
+
+#include "jetstream/block.hh"
+#include "jetstream/instance.hh"
+#include "jetstream/modules/filter_taps.hh"
+#include "jetstream/modules/xlating_filter.hh"
+
+namespace Jetstream::Blocks {
+
+template<Device D, typename IT, typename OT>
+class XlatingFilter : public Block {
+ public:
+    // Configuration
+
+    struct Config {
+        std::vector<F32> center = {0.0e6f};
+        F32 sampleRate = 2.0e6f;
+        F32 bandwidth = 200.0e3f;
+        U64 taps = 101;
+        U64 decimation = 4;
+
+        JST_SERDES(center, sampleRate, bandwidth, taps, decimation);
+    };
+
+    constexpr const Config& getConfig() const {
+        return config;
+    }
+
+    // Input
+
+    struct Input {
+        Tensor<D, IT> buffer;
+
+        JST_SERDES(buffer);
+    };
+
+    constexpr const Input& getInput() const {
+        return input;
+    }
+
+    // Output
+
+    struct Output {
+        Tensor<D, IT> buffer;
+
+        JST_SERDES(buffer);
+    };
+
+    constexpr const Output& getOutput() const {
+        return output;
+    }
+
+    constexpr const Tensor<D, IT>& getOutputBuffer() const {
+        return this->output.buffer;
+    }
+
+    // Housekeeping
+
+    constexpr Device device() const {
+        return D;
+    }
+
+    std::string id() const {
+        return "xlating-filter";
+    }
+
+    std::string name() const {
+        return "Xlating Filter";
+    }
+
+    std::string summary() const {
+        return "Tunes, filters and decimates a signal in one pass.";
+    }
+
+    std::string description() const {
+        return "The Xlating Filter block extracts one or more narrowband signals from a wideband capture. Each "
+               "head filters the input with band-pass taps centered on its frequency, keeps every decimation-th "
+               "output and rotates it back to baseband. Only the kept outputs are computed, so the cost drops "
+               "with the decimation instead of running a full-rate filter followed by a mixer and a decimator. "
+               "The taps are the same as the Filter block's, and the filter state and rotation phase are kept "
+               "between buffers.\n\n"
+
+               "## Parameters\n"
+               "- **Sample Rate**: The sample rate of the input signal.\n"
+               "- **Bandwidth**: The bandwidth of each head.\n"
+               "- **Taps**: The number of filter taps. Should be odd.\n"
+               "- **Decimation**: The decimation ratio. The input size should be a multiple of it.\n"
+               "- **Heads**: The number of signals to extract.\n"
+               "- **Center**: The center frequency of each head relative to the input.\n\n"
+
+               "## Useful For:\n"
+               "- Tuning to a narrowband signal inside a wideband capture.\n"
+               "- Extracting several signals from the same capture at once.\n"
+               "- Reducing the sample rate before demodulation.\n\n"
+
+               "## Examples:\n"
+               "- Single signal:\n"
+               "  Config: Center=[250 kHz], Decimation=8\n"
+               "  Input: CF32[65536] → Output: CF32[1, 8192]\n\n"
+
+               "## Implementation:\n"
+               "Input → Filter Taps → Xlating Filter → Output\n"
+               "1. Filter Taps builds the band-pass taps of every head.\n"
+               "2. Each kept output is a single dot product over the input and the filter history.\n"
+               "3. The output is rotated back to baseband by its sample position.";
+    }
+
+    // Constructor
+
+    Result create() {
+        JST_CHECK(instance().addModule(
+            taps, "taps", {
+                .center = config.center,
+                .sampleRate = config.sampleRate,
+                .bandwidth = config.bandwidth,
+                .taps = config.taps,
+            }, {},
+            locale()
+        ));
+
+        JST_CHECK(instance().addModule(
+            filter, "filter", {
+                .decimation = config.decimation,
+            }, {
+                .buffer = input.buffer,
+                .filter = taps->getOutputCoeffs(),
+            },
+            locale()
+        ));
+
+        JST_CHECK(Block::LinkOutput("buffer", output.buffer, filter->getOutputBuffer()));
+
+        return Result::SUCCESS;
+    }
+
+    Result destroy() {
+        if (filter) {
+            JST_CHECK(instance().eraseModule(filter->locale()));
+        }
+
+        if (taps) {
+            JST_CHECK(instance().eraseModule(taps->locale()));
+        }
+
+        return Result::SUCCESS;
+    }
+
+    // Interface
+
+    void drawControl() {
+        ImGui::TableNextRow();
+        ImGui::TableSetColumnIndex(0);
+        ImGui::TextUnformatted("Sample Rate");
+        ImGui::TableSetColumnIndex(1);
+        ImGui::SetNextItemWidth(-1);
+        F32 sampleRate = config.sampleRate / JST_MHZ;
+        if (ImGui::InputFloat("##xlating-sample-rate", &sampleRate, 1.0f, 1.0f, "%.3f MHz", ImGuiInputTextFlags_EnterReturnsTrue)) {
+            config.sampleRate = sampleRate * JST_MHZ;
+
+            JST_DISPATCH_ASYNC([&](){
+                ImGui::InsertNotification({ ImGuiToastType_Info, 1000, "Reloading block..." });
+                JST_CHECK_NOTIFY(instance().reloadBlock(locale()));
+            });
+        }
+
+        ImGui::TableNextRow();
+        ImGui::TableSetColumnIndex(0);
+        ImGui::TextUnformatted("Bandwidth");
+        ImGui::TableSetColumnIndex(1);
+        ImGui::SetNextItemWidth(-1);
+        F32 bandwidth = config.bandwidth / JST_MHZ;
+        if (ImGui::InputFloat("##xlating-bandwidth", &bandwidth, 1.0f, 1.0f, "%.3f MHz", ImGuiInputTextFlags_EnterReturnsTrue)) {
+            config.bandwidth = bandwidth * JST_MHZ;
+
+            JST_DISPATCH_ASYNC([&](){
+                ImGui::InsertNotification({ ImGuiToastType_Info, 1000, "Reloading block..." });
+                JST_CHECK_NOTIFY(instance().reloadBlock(locale()));
+            });
+        }
+
+        ImGui::TableNextRow();
+        ImGui::TableSetColumnIndex(0);
+        ImGui::TextUnformatted("Taps");
+        ImGui::TableSetColumnIndex(1);
+        ImGui::SetNextItemWidth(-1);
+        F32 taps = config.taps;
+        if (ImGui::InputFloat("##xlating-taps", &taps, 2.0f, 2.0f, "%.0f", ImGuiInputTextFlags_EnterReturnsTrue)) {
+            config.taps = static_cast<U64>(taps);
+
+            JST_DISPATCH_ASYNC([&](){
+                ImGui::InsertNotification({ ImGuiToastType_Info, 1000, "Reloading block..." });
+                JST_CHECK_NOTIFY(instance().reloadBlock(locale()));
+            });
+        }
+
+        ImGui::TableNextRow();
+        ImGui::TableSetColumnIndex(0);
+        ImGui::TextUnformatted("Decimation");
+        ImGui::TableSetColumnIndex(1);
+        ImGui::SetNextItemWidth(-1);
+        F32 decimation = config.decimation;
+        if (ImGui::InputFloat("##xlating-decimation", &decimation, 1.0f, 1.0f, "%.0f", ImGuiInputTextFlags_EnterReturnsTrue)) {
+            if (decimation >= 1) {
+                config.decimation = static_cast<U64>(decimation);
+
+                JST_DISPATCH_ASYNC([&](){
+                    ImGui::InsertNotification({ ImGuiToastType_Info, 1000, "Reloading block..." });
+                    JST_CHECK_NOTIFY(instance().reloadBlock(locale()));
+                });
+            }
+        }
+
+        ImGui::TableNextRow();
+        ImGui::TableSetColumnIndex(0);
+        ImGui::TextUnformatted("Heads");
+        ImGui::TableSetColumnIndex(1);
+        ImGui::SetNextItemWidth(-1);
+        F32 heads = config.center.size();
+        if (ImGui::InputFloat("##xlating-heads", &heads, 1.0f, 1.0f, "%.0f", ImGuiInputTextFlags_EnterReturnsTrue)) {
+            if (heads >= 1 && heads != config.center.size()) {
+                config.center.resize(heads);
+
+                JST_DISPATCH_ASYNC([&](){
+                    ImGui::InsertNotification({ ImGuiToastType_Info, 1000, "Reloading block..." });
+                    JST_CHECK_NOTIFY(instance().reloadBlock(locale()));
+                });
+            }
+        }
+
+        for (U64 i = 0; i < config.center.size(); i++) {
+            ImGui::TableNextRow();
+            ImGui::TableSetColumnIndex(0);
+            ImGui::TextFormatted("Center #{:02}", i);
+            ImGui::TableSetColumnIndex(1);
+            ImGui::SetNextItemWidth(-1);
+            const std::string id = jst::fmt::format("##xlating-center-{}", i);
+            F32 center = config.center[i] / JST_MHZ;
+            if (ImGui::InputFloat(id.c_str(), &center, 1.0f, 1.0f, "%.3f MHz", ImGuiInputTextFlags_EnterReturnsTrue)) {
+                config.center[i] = center * JST_MHZ;
+
+                JST_DISPATCH_ASYNC([&](){
+                    ImGui::InsertNotification({ ImGuiToastType_Info, 1000, "Reloading block..." });
+                    JST_CHECK_NOTIFY(instance().reloadBlock(locale()));
+                });
+            }
+        }
+    }
+
+    constexpr bool shouldDrawControl() const {
+        return true;
+    }
+
+ private:
+    std::shared_ptr<Jetstream::FilterTaps<D, IT>> taps;
+    std::shared_ptr<Jetstream::XlatingFilter<D, IT>> filter;
+
+    JST_DEFINE_IO()
+};
+
+}  // namespace Jetstream::Blocks
+
+JST_BLOCK_ENABLE(XlatingFilter, is_specialized<Jetstream::FilterTaps<D, IT>>::value &&
+                                is_specialized<Jetstream::XlatingFilter<D, IT>>::value &&
+                                std::is_same<OT, void>::value)
+
+#endif
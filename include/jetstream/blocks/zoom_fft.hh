@@ -0,0 +1,420 @@
+#ifndef JETSTREAM_BLOCK_ZOOM_FFT_BASE_HH
+#define JETSTREAM_BLOCK_ZOOM_FFT_BASE_HH
+
+#include "jetstream/block.hh"
+#include "jetstream/instance.hh"
+#include "jetstream/modules/filter_taps.hh"
+#include "jetstream/modules/xlating_filter.hh"
+#include "jetstream/modules/framer.hh"
+#include "jetstream/modules/window.hh"
+#include "jetstream/modules/invert.hh"
+#include "jetstream/modules/multiply.hh"
+#include "jetstream/modules/fft.hh"
+#include "jetstream/modules/amplitude.hh"
+#include "jetstream/modules/scale.hh"
+
+namespace Jetstream::Blocks {
+
+template<Device D, typename IT, typename OT>
+class ZoomFFT : public Block {
+ public:
+    // Configuration
+
+    struct Config {
+        F32 center = 0.0e6f;
+        F32 span = 100.0e3f;
+        F32 sampleRate = 2.0e6f;
+        U64 size = 1024;
+        U64 taps = 0;
+        bool enableScale = true;
+        Range<OT> range = {-120.0, 0.0};
+
+        JST_SERDES(center, span, sampleRate, size, taps, enableScale, range);
+    };
+
+    constexpr const Config& getConfig() const {
+        return config;
+    }
+
+    // Input
+
+    struct Input {
+        Tensor<D, IT> buffer;
+
+        JST_SERDES(buffer);
+    };
+
+    constexpr const Input& getInput() const {
+        return input;
+    }
+
+    // Output
+
+    struct Output {
+        Tensor<D, OT> buffer;
+
+        JST_SERDES(buffer);
+    };
+
+    constexpr const Output& getOutput() const {
+        return output;
+    }
+
+    constexpr const Tensor<D, OT>& getOutputBuffer() const {
+        return this->output.buffer;
+    }
+
+    // Housekeeping
+
+    constexpr Device device() const {
+        return D;
+    }
+
+    std::string id() const {
+        return "zoom-fft";
+    }
+
+    std::string name() const {
+        return "Zoom FFT";
+    }
+
+    std::string summary() const {
+        return "Computes a high-resolution spectrum of a narrow span.";
+    }
+
+    std::string description() const {
+        return "The Zoom FFT block computes the spectrum of a narrow span of a wideband capture. The span is "
+               "tuned to baseband, filtered and decimated in one pass, then framed and transformed. Only the "
+               "decimated samples reach the FFT, so a fine resolution over a few kHz costs a fraction of a "
+               "full-bandwidth FFT with the same bin width. Frames slide over past buffers when the decimated "
+               "buffer is shorter than the FFT, and the power of every frame of a buffer is averaged into a "
+               "single spectrum.\n\n"
+
+               "## Parameters\n"
+               "- **Center**: The center frequency of the span relative to the input.\n"
+               "- **Span**: The bandwidth to zoom into. The displayed band is the input sample rate divided "
+               "by the largest decimation that fits the span and divides the input size.\n"
+               "- **Sample Rate**: The sample rate of the input signal.\n"
+               "- **Size**: The number of FFT bins across the displayed band.\n"
+               "- **Taps**: The number of filter taps. Zero picks four per decimated sample.\n"
+               "- **Enable Scale**: Whether to apply scaling to the final output.\n"
+               "- **Scale Range**: The minimum and maximum values for scaling (in dBFS).\n\n"
+
+               "## Useful For:\n"
+               "- Inspecting a narrowband signal inside a wideband capture.\n"
+               "- Resolving closely spaced carriers.\n"
+               "- Following the span shown by a zoomed Lineplot or Waterfall. The span of a view is the "
+               "sample rate divided by its zoom.\n\n"
+
+               "## Examples:\n"
+               "- 10 kHz out of a 20 MHz capture:\n"
+               "  Config: Center=1.2 MHz, Span=10 kHz, Sample Rate=20 MHz, Size=1024\n"
+               "  Input: CF32[8, 250000] → Output: F32[1, 1024]\n\n"
+
+               "## Implementation:\n"
+               "Input → Filter Taps → Xlating Filter → Framer → Window → Multiply → FFT → Amplitude → [Scale] → Output\n"
+               "1. Filter Taps builds a band-pass filter over the span.\n"
+               "2. Xlating Filter tunes, filters and decimates the input.\n"
+               "3. Framer cuts the decimated stream into FFT-sized frames.\n"
+               "4. Window and Multiply apply the window to every frame.\n"
+               "5. FFT computes the forward transform.\n"
+               "6. Amplitude averages the power of all frames before the conversion to decibels.\n"
+               "7. Optional Scale module applies the specified scaling range.";
+    }
+
+    // Constructor
+
+    Result create() {
+        if (config.span <= 0.0f || config.span > config.sampleRate) {
+            JST_ERROR("Span ({}) should be positive and not larger than the sample rate ({}).",
+                      config.span, config.sampleRate);
+            return Result::ERROR;
+        }
+
+        if (config.size < 2) {
+            JST_ERROR("Size ({}) should be at least 2.", config.size);
+            return Result::ERROR;
+        }
+
+        // Largest decimation that keeps the span and divides the input, so
+        // every buffer yields the same number of decimated samples.
+
+        const U64 inputSize = input.buffer.size();
+        const U64 maxDecimation = std::max<U64>(1, static_cast<U64>(config.sampleRate / config.span));
+
+        decimation = 1;
+        for (U64 d = std::min(maxDecimation, inputSize); d > 1; d--) {
+            if ((inputSize % d) == 0) {
+                decimation = d;
+                break;
+            }
+        }
+
+        const U64 numberOfTaps = (config.taps == 0) ? (4 * decimation + 1) : config.taps;
+
+        JST_CHECK(instance().addModule(
+            taps, "taps", {
+                .center = {config.center},
+                .sampleRate = config.sampleRate,
+                .bandwidth = config.span,
+                .taps = numberOfTaps,
+            }, {},
+            locale()
+        ));
+
+        JST_CHECK(instance().addModule(
+            filter, "filter", {
+                .decimation = decimation,
+            }, {
+                .buffer = input.buffer,
+                .filter = taps->getOutputCoeffs(),
+            },
+            locale()
+        ));
+
+        // Decimated buffers shorter than the FFT produce one frame sliding
+        // over the previous ones.
+
+        const U64 decimatedSize = filter->getOutputBuffer().size();
+
+        JST_CHECK(instance().addModule(
+            framer, "framer", {
+                .size = config.size,
+                .hop = std::min(config.size, decimatedSize),
+            }, {
+                .buffer = filter->getOutputBuffer(),
+            },
+            locale()
+        ));
+
+        JST_CHECK(instance().addModule(
+            window, "window", {
+                .size = config.size,
+            }, {},
+            locale()
+        ));
+
+        JST_CHECK(instance().addModule(
+            invert, "invert", {}, {
+                .buffer = window->getOutputWindow(),
+            },
+            locale()
+        ));
+
+        JST_CHECK(instance().addModule(
+            multiply, "multiply", {}, {
+                .factorA = framer->getOutputBuffer(),
+                .factorB = invert->getOutputBuffer(),
+            },
+            locale()
+        ));
+
+        JST_CHECK(instance().addModule(
+            fft, "fft", {
+                .forward = true,
+            }, {
+                .buffer = multiply->getOutputProduct(),
+            },
+            locale()
+        ));
+
+        JST_CHECK(instance().addModule(
+            amplitude, "amplitude", {
+                .averages = framer->getOutputBuffer().shape()[0],
+            }, {
+                .buffer = fft->getOutputBuffer(),
+            },
+            locale()
+        ));
+
+        if (config.enableScale) {
+            JST_CHECK(instance().addModule(
+                scale, "scale", {
+                    .range = config.range,
+                }, {
+                    .buffer = amplitude->getOutputBuffer(),
+                },
+                locale()
+            ));
+
+            JST_CHECK(Block::LinkOutput("buffer", output.buffer, scale->getOutputBuffer()));
+        } else {
+            JST_CHECK(Block::LinkOutput("buffer", output.buffer, amplitude->getOutputBuffer()));
+        }
+
+        return Result::SUCCESS;
+    }
+
+    Result destroy() {
+        if (scale) {
+            JST_CHECK(instance().eraseModule(scale->locale()));
+        }
+
+        if (amplitude) {
+            JST_CHECK(instance().eraseModule(amplitude->locale()));
+        }
+
+        if (fft) {
+            JST_CHECK(instance().eraseModule(fft->locale()));
+        }
+
+        if (multiply) {
+            JST_CHECK(instance().eraseModule(multiply->locale()));
+        }
+
+        if (invert) {
+            JST_CHECK(instance().eraseModule(invert->locale()));
+        }
+
+        if (window) {
+            JST_CHECK(instance().eraseModule(window->locale()));
+        }
+
+        if (framer) {
+            JST_CHECK(instance().eraseModule(framer->locale()));
+        }
+
+        if (filter) {
+            JST_CHECK(instance().eraseModule(filter->locale()));
+        }
+
+        if (taps) {
+            JST_CHECK(instance().eraseModule(taps->locale()));
+        }
+
+        return Result::SUCCESS;
+    }
+
+    // Interface
+
+    void drawControl() {
+        ImGui::TableNextRow();
+        ImGui::TableSetColumnIndex(0);
+        ImGui::TextUnformatted("Center");
+        ImGui::TableSetColumnIndex(1);
+        ImGui::SetNextItemWidth(-1);
+        F32 center = config.center / JST_MHZ;
+        if (ImGui::InputFloat("##zoom-center", &center, 0.1f, 1.0f, "%.6f MHz", ImGuiInputTextFlags_EnterReturnsTrue)) {
+            config.center = center * JST_MHZ;
+
+            JST_DISPATCH_ASYNC([&](){
+                ImGui::InsertNotification({ ImGuiToastType_Info, 1000, "Reloading block..." });
+                JST_CHECK_NOTIFY(instance().reloadBlock(locale()));
+            });
+        }
+
+        ImGui::TableNextRow();
+        ImGui::TableSetColumnIndex(0);
+        ImGui::TextUnformatted("Span");
+        ImGui::TableSetColumnIndex(1);
+        ImGui::SetNextItemWidth(-1);
+        F32 span = config.span / JST_KHZ;
+        if (ImGui::InputFloat("##zoom-span", &span, 1.0f, 10.0f, "%.3f kHz", ImGuiInputTextFlags_EnterReturnsTrue)) {
+            if (span > 0.0f) {
+                config.span = span * JST_KHZ;
+
+                JST_DISPATCH_ASYNC([&](){
+                    ImGui::InsertNotification({ ImGuiToastType_Info, 1000, "Reloading block..." });
+                    JST_CHECK_NOTIFY(instance().reloadBlock(locale()));
+                });
+            }
+        }
+
+        ImGui::TableNextRow();
+        ImGui::TableSetColumnIndex(0);
+        ImGui::TextUnformatted("Sample Rate");
+        ImGui::TableSetColumnIndex(1);
+        ImGui::SetNextItemWidth(-1);
+        F32 sampleRate = config.sampleRate / JST_MHZ;
+        if (ImGui::InputFloat("##zoom-sample-rate", &sampleRate, 1.0f, 1.0f, "%.3f MHz", ImGuiInputTextFlags_EnterReturnsTrue)) {
+            config.sampleRate = sampleRate * JST_MHZ;
+
+            JST_DISPATCH_ASYNC([&](){
+                ImGui::InsertNotification({ ImGuiToastType_Info, 1000, "Reloading block..." });
+                JST_CHECK_NOTIFY(instance().reloadBlock(locale()));
+            });
+        }
+
+        ImGui::TableNextRow();
+        ImGui::TableSetColumnIndex(0);
+        ImGui::TextUnformatted("Size");
+        ImGui::TableSetColumnIndex(1);
+        ImGui::SetNextItemWidth(-1);
+        F32 size = config.size;
+        if (ImGui::InputFloat("##zoom-size", &size, 256.0f, 1024.0f, "%.0f", ImGuiInputTextFlags_EnterReturnsTrue)) {
+            if (size >= 2) {
+                config.size = static_cast<U64>(size);
+
+                JST_DISPATCH_ASYNC([&](){
+                    ImGui::InsertNotification({ ImGuiToastType_Info, 1000, "Reloading block..." });
+                    JST_CHECK_NOTIFY(instance().reloadBlock(locale()));
+                });
+            }
+        }
+
+        ImGui::TableNextRow();
+        ImGui::TableSetColumnIndex(0);
+        ImGui::TextUnformatted("Resolution");
+        ImGui::TableSetColumnIndex(1);
+        ImGui::TextFormatted("{:.3f} Hz", config.sampleRate / decimation / config.size);
+
+        ImGui::TableNextRow();
+        ImGui::TableSetColumnIndex(0);
+        ImGui::TextUnformatted("Enable Scale");
+        ImGui::TableSetColumnIndex(1);
+        ImGui::SetNextItemWidth(-1);
+        if (ImGui::Checkbox("##zoom-enable-scale", &config.enableScale)) {
+            JST_DISPATCH_ASYNC([&](){
+                ImGui::InsertNotification({ ImGuiToastType_Info, 1000, "Reloading block..." });
+                JST_CHECK_NOTIFY(instance().reloadBlock(locale()));
+            });
+        }
+
+        if (config.enableScale && scale) {
+            ImGui::TableNextRow();
+            ImGui::TableSetColumnIndex(0);
+            ImGui::TextUnformatted("Range (dBFS)");
+            ImGui::TableSetColumnIndex(1);
+            ImGui::SetNextItemWidth(-1);
+            auto [min, max] = scale->range();
+            if (ImGui::DragFloatRange2("##zoom-scale-range", &min, &max,
+                        1, -300, 0, "Min: %.0f", "Max: %.0f")) {
+                config.range = scale->range({min, max});
+            }
+        }
+    }
+
+    constexpr bool shouldDrawControl() const {
+        return true;
+    }
+
+ private:
+    U64 decimation = 1;
+
+    std::shared_ptr<Jetstream::FilterTaps<D, IT>> taps;
+    std::shared_ptr<Jetstream::XlatingFilter<D, IT>> filter;
+    std::shared_ptr<Jetstream::Framer<D, IT>> framer;
+    std::shared_ptr<Jetstream::Window<D, IT>> window;
+    std::shared_ptr<Jetstream::Invert<D, IT>> invert;
+    std::shared_ptr<Jetstream::Multiply<D, IT>> multiply;
+    std::shared_ptr<Jetstream::FFT<D, IT, IT>> fft;
+    std::shared_ptr<Jetstream::Amplitude<D, IT, OT>> amplitude;
+    std::shared_ptr<Jetstream::Scale<D, OT>> scale;
+
+    JST_DEFINE_IO()
+};
+
+}  // namespace Jetstream::Blocks
+
+JST_BLOCK_ENABLE(ZoomFFT, is_specialized<Jetstream::FilterTaps<D, IT>>::value &&
+                          is_specialized<Jetstream::XlatingFilter<D, IT>>::value &&
+                          is_specialized<Jetstream::Framer<D, IT>>::value &&
+                          is_specialized<Jetstream::Window<D, IT>>::value &&
+                          is_specialized<Jetstream::Invert<D, IT>>::value &&
+                          is_specialized<Jetstream::Multiply<D, IT>>::value &&
+                          is_specialized<Jetstream::FFT<D, IT, IT>>::value &&
+                          is_specialized<Jetstream::Amplitude<D, IT, OT>>::value &&
+                          is_specialized<Jetstream::Scale<D, OT>>::value &&
+                          !std::is_same<OT, void>::value)
+
+#endif
@@ -2,6 +2,7 @@
 #define JETSTREAM_COMPOSITOR_HH
 
 #include <tuple>
+#include <chrono>
 #include <stack>
 #include <memory>
 #include <vector>
@@ -56,6 +57,12 @@ class JETSTREAM_API Compositor {
     Result draw();
     Result processInteractions();
 
+    // True if a view, fullscreen view or on-screen preview of the
+    // block was drawn in the last frame.
+    bool isBlockVisible(const Locale& locale) const {
+        return visibleBlocks.contains(locale);
+    }
+
     constexpr ImGui::MarkdownConfig& markdownConfig() {
         return _markdownConfig;
     }
@@ -89,6 +96,30 @@ class JETSTREAM_API Compositor {
         std::unordered_map<PinId, Locale> inputs;
         std::unordered_map<PinId, Locale> outputs;
         std::unordered_set<NodeId> edges;
+
+        // Text measurements of the node. Rebuilt by the flowgraph render
+        // after the state is refreshed or the scaling factor changes.
+        struct Pin {
+            PinId id;
+            std::string name;
+            F32 width;
+        };
+
+        struct {
+            F32 scalingFactor = 0.0f;
+            F32 titleWidth = 0.0f;
+            F32 errorIconWidth = 0.0f;
+            F32 warningIconWidth = 0.0f;
+            std::vector<Pin> inputPins;
+            std::vector<Pin> outputPins;
+        } layout;
+    };
+
+    struct LinkState {
+        LinkId id;
+        PinId inputPinId;
+        PinId outputPinId;
+        std::shared_ptr<Block> outputBlock;
     };
 
     void lock();
@@ -113,6 +144,7 @@ class JETSTREAM_API Compositor {
     bool flowgraphEnabled;
     bool debugDemoEnabled;
     bool debugLatencyEnabled;
+    bool frameBudgetEnabled;
     bool debugViewportEnabled;
     bool fullscreenEnabled;
     bool debugEnableTrace;
@@ -132,11 +164,31 @@ class JETSTREAM_API Compositor {
                           std::shared_ptr<Render::Texture>& texture);
 
     std::unordered_map<Locale, NodeState, Locale::Hasher> nodeStates;
+    std::unordered_set<Locale, Locale::Hasher> visibleBlocks;
+
+    // Latency of the modules of each block, refreshed every frame while profiling.
+    std::unordered_map<Locale, std::vector<std::pair<std::string, LatencyHistogram::Summary>>, Locale::Hasher> blockLatency;
     std::unordered_map<Locale, std::vector<Locale>, Locale::Hasher> outputInputCache;
+
+    // Frame time split across the present thread stages and the compute graphs.
+    // Percentiles cover the durations recorded since the previous refresh.
+    struct FrameBudget {
+        F32 targetRate = 60.0f;
+        std::chrono::steady_clock::time_point lastUpdate;
+        std::vector<LatencyHistogram::Snapshot> stageSnapshots;
+        std::vector<LatencyHistogram::Snapshot> graphSnapshots;
+        std::unordered_map<Locale, LatencyHistogram::Snapshot, Locale::Hasher> moduleSnapshots;
+        std::vector<std::pair<std::string, LatencyHistogram::Summary>> stages;
+        std::vector<std::pair<std::string, LatencyHistogram::Summary>> graphs;
+        std::vector<std::pair<Locale, LatencyHistogram::Summary>> slowestModules;
+    } frameBudget;
+
+    void updateFrameBudget();
     std::vector<std::vector<std::vector<NodeId>>> nodeTopology;
     std::unordered_map<std::string, std::pair<bool, ImGuiID>> stacks;
 
     std::unordered_map<LinkId, std::pair<Locale, Locale>> linkLocaleMap;
+    std::vector<LinkState> linkStates;
     std::unordered_map<Locale, PinId, Locale::Hasher> inputLocalePinMap;
     std::unordered_map<Locale, PinId, Locale::Hasher> outputLocalePinMap;
     std::unordered_map<PinId, Locale> pinLocaleMap;
@@ -190,6 +242,7 @@ class JETSTREAM_API Compositor {
     ImFont* _boldFont;
 
     F32 previousScalingFactor;
+    F32 drawTime = 0.0f;
 
     ImGui::MarkdownConfig _markdownConfig;
 
@@ -12,6 +12,9 @@
 #ifdef JETSTREAM_GRAPH_CUDA_AVAILABLE
 #include "jetstream/compute/graph/cuda.hh"
 #endif
+#ifdef JETSTREAM_GRAPH_VULKAN_AVAILABLE
+#include "jetstream/compute/graph/vulkan.hh"
+#endif
 
 namespace Jetstream {
 
@@ -25,10 +28,10 @@ inline std::unique_ptr<Graph> NewGraph(const Device& device) {
         case Device::CUDA:
             return std::make_unique<CUDA>();
 #endif
-// #ifdef JETSTREAM_GRAPH_VULKAN_AVAILABLE 
-//         case Device::Vulkan:
-//             return std::make_unique<Vulkan>();
-// #endif
+#ifdef JETSTREAM_GRAPH_VULKAN_AVAILABLE 
+        case Device::Vulkan:
+            return std::make_unique<Vulkan>();
+#endif
 #ifdef JETSTREAM_GRAPH_METAL_AVAILABLE 
         case Device::Metal:
             return std::make_unique<Metal>();
@@ -39,6 +42,61 @@ inline std::unique_ptr<Graph> NewGraph(const Device& device) {
     };
 }
 
+// Runs a module alone in a graph of its device. Used by the benchmark
+// macros. Device cases run a few more times with the graph timers
+// enabled to measure the kernel time without the host overhead.
+template<Device D, typename M>
+void BenchmarkModule(ankerl::nanobench::Bench& bench,
+                     const std::string& name,
+                     const F64& flopsPerElement,
+                     const typename M::Config& config,
+                     const typename M::Input& input) {
+    if (!Benchmark::Selected(name)) {
+        return;
+    }
+
+    auto graph = NewGraph(D);
+    auto module = std::make_shared<M>();
+    module->init_benchmark_mode(config, input);
+    module->create();
+    graph->setModule(module, {}, {});
+    graph->create();
+
+    {
+        Parser::RecordMap inputs, outputs;
+        auto moduleInput = module->getInput();
+        auto moduleOutput = module->getOutput();
+        moduleInput >> inputs;
+        moduleOutput >> outputs;
+        Benchmark::SetThroughput(name, Benchmark::Throughput::Measure(inputs, outputs, flopsPerElement));
+    }
+
+    bench.run(name, [&] {
+        std::unordered_set<U64> yielded;
+        graph->compute(yielded);
+        graph->synchronize();
+    });
+
+    if constexpr (D != Device::CPU) {
+        const bool profiling = Graph::Profiling();
+        Graph::SetProfiling(true);
+        for (U64 i = 0; i < 32; i++) {
+            std::unordered_set<U64> yielded;
+            graph->compute(yielded);
+            graph->synchronize();
+        }
+        Graph::SetProfiling(profiling);
+
+        const auto kernel = module->computeLatency().summary();
+        if (kernel.count > 0) {
+            Benchmark::SetDeviceTime(name, D, kernel.mean);
+        }
+    }
+
+    graph->destroy();
+    module->destroy();
+}
+
 }  // namespace Jetstream
 
 #endif
@@ -18,6 +18,69 @@ class CPU : public Graph {
     Result compute(std::unordered_set<U64>& yielded);
     Result computeReady();
     Result destroy();
+
+    // Pool shared by the CPU graphs. Might be null or not running.
+    constexpr WorkerPool* pool() const {
+        return workerPool;
+    }
+
+ private:
+    struct ExecutionState;
+    struct PipelineState;
+
+    // Elements per slice of a fused run. Small enough to keep the
+    // intermediate tensors of a run within the L2 cache.
+    static constexpr U64 FusedSliceSize = 4096;
+
+    // Elements per row tile of a fused run with rowwise units. Larger than
+    // a slice, since rowwise units like transforms need whole rows per call.
+    static constexpr U64 FusedTileSize = 32768;
+
+    bool parallel = false;
+    std::vector<U64> dependencyCount;
+    std::vector<std::vector<U64>> dependents;
+
+    // Number of units fused into the run starting at each unit.
+    // Zero for units computed as part of a previous run.
+    std::vector<U64> fusedRuns;
+
+    // Number of rows of each run with rowwise units and the rows
+    // per tile. Zero rows for runs computed over plain slices.
+    std::vector<U64> fusedRows;
+    std::vector<U64> fusedTileRows;
+
+    // Elements per row of the elementwise units of such runs.
+    // Zero for rowwise units, which are given rows instead.
+    std::vector<U64> fusedRowSizes;
+
+    // First unit of each stage of a pipelined chain, followed by the number
+    // of units. Empty when the graph isn't pipelined.
+    std::vector<U64> stageBounds;
+
+    // Last unit of each stage reading the tensors written by the previous
+    // stage, and the run of each stage writing the ones read by the next.
+    std::vector<U64> stageLastReaders;
+    std::vector<U64> stageHandoffs;
+
+    // Tensors yielded by each stage in the last frame. The next
+    // stage computes that frame, so it yields them too.
+    std::vector<std::unordered_set<U64>> stageYielded;
+
+    // Memory shared by transient outputs with disjoint lifetimes.
+    Tensor<Device::CPU, U8> arena;
+    std::vector<std::shared_ptr<TensorBuffer<Device::CPU>>> aliasedBuffers;
+
+    Result createDependencies();
+    Result createFusedRuns();
+    Result createStages();
+    Result createMemoryPlan();
+    Result destroyMemoryPlan();
+    Result computeUnit(const U64& index, std::unordered_set<U64>& yielded);
+    Result computeFusedRun(const U64& index);
+    Result computeTiledRun(const U64& index);
+    void dispatchUnit(const U64& index, ExecutionState& state);
+    Result computePipeline(std::unordered_set<U64>& yielded);
+    Result computeStage(const U64& stage, std::unordered_set<U64>& yielded, PipelineState& state);
 };
 
 }  // namespace Jetstream
@@ -14,23 +14,42 @@ class CUDA : public Graph {
         return Device::CUDA;
     }
 
+    // Stream of the block currently being created or computed.
     constexpr const cudaStream_t& stream() const {
-        return _stream;
+        return _currentStream;
     }
 
     Result create();
     Result compute(std::unordered_set<U64>& yielded);
     Result computeReady();
+    Result synchronize();
+    Result synchronizeInputs();
     Result destroy();
 
+    U64 migratedBytes() const;
+
     enum class KernelHeader {
         NONE,
         COMPLEX,
     };
 
+    // Compile-time constant declared as `constexpr` ahead of the kernel
+    // source, so NVRTC can fold sizes and strides fixed at creation.
+    struct KernelConstant {
+        std::string name;
+        std::string type;
+        std::string value;
+    };
+
+    static KernelConstant Constant(const std::string& name, const U64& value);
+    static KernelConstant Constant(const std::string& name, const I64& value);
+    static KernelConstant Constant(const std::string& name, const F32& value);
+    static KernelConstant Constant(const std::string& name, const bool& value);
+
     Result createKernel(const std::string& name, 
                         const std::string& source,
-                        const std::vector<KernelHeader>& headers = {});
+                        const std::vector<KernelHeader>& headers = {},
+                        const std::vector<KernelConstant>& constants = {});
 
     Result launchKernel(const std::string& name, 
                         const std::vector<U64>& grid,
@@ -41,9 +60,12 @@ class CUDA : public Graph {
 
  private:
     cudaStream_t _stream;
+    cudaStream_t _currentStream;
 
     struct Impl;
     std::unique_ptr<Impl> pimpl;
+
+    Result computeUnit(const U64& index, std::unordered_set<U64>& yielded, bool& didYield);
 };
 
 }  // namespace Jetstream
@@ -2,11 +2,15 @@
 #define JETSTREAM_COMPUTE_GRAPH_GENERIC_HH
 
 #include <set>
+#include <chrono>
 #include <memory>
 
 #include "jetstream/memory/types.hh"
 #include "jetstream/logger.hh"
 #include "jetstream/module.hh"
+#include "jetstream/compute/worker_pool.hh"
+#include "jetstream/compute/tracer.hh"
+#include "jetstream/compute/sampler.hh"
 
 namespace Jetstream { 
 
@@ -21,6 +25,36 @@ class Graph {
     Result setExternallyWiredInput(const U64& input);
     Result setExternallyWiredOutput(const U64& output);
 
+    // Mark an output as read only by units of this graph while they compute.
+    // Graphs may place it in memory shared with other transient tensors.
+    Result setTransientOutput(const U64& output, const std::shared_ptr<TensorStorageMetadata>& storage);
+
+    // Mark an output as read by modules of other graphs. Pipelined graphs only
+    // let their last stage write it, so other graphs see a single frame.
+    Result setExternalOutput(const U64& output);
+
+    // Mark a wired tensor as exchanged with a graph of another device. Graphs
+    // keeping host mirrors refresh them before computing inputs and after
+    // computing outputs.
+    Result setMirroredInput(const U64& input, const std::shared_ptr<TensorStorageMetadata>& storage);
+    Result setMirroredOutput(const U64& output, const std::shared_ptr<TensorStorageMetadata>& storage);
+    Result clearMirrored();
+
+    Result setWorkerPool(WorkerPool* pool);
+
+    // Place the graph on a GPU. Negative uses the device of the backend.
+    Result setDeviceIndex(const I32& index);
+
+    // Split simple chains in up to this many stages computing consecutive
+    // frames at the same time. Graphs that can't be pipelined ignore it.
+    Result setPipelineStages(const U64& stages);
+
+    constexpr const I32& deviceIndex() const {
+        return _deviceIndex;
+    }
+
+    bool hasModule(const std::shared_ptr<Compute>& block) const;
+
     constexpr const std::set<U64>& getWiredInputs() const {
         return wiredInputSet;
     }
@@ -43,22 +77,78 @@ class Graph {
     virtual Result computeReady() = 0;
     virtual Result destroy() = 0;
 
+    // Wait for the work enqueued by `compute` to finish. Graphs
+    // completing asynchronously have to override this method.
+    virtual Result synchronize() {
+        return Result::SUCCESS;
+    }
+
+    // Wait until the work enqueued by `compute` is done reading the inputs
+    // written by other graphs, so their producers can overwrite them. Graphs
+    // copying their inputs ahead of the compute may return before it finishes.
+    virtual Result synchronizeInputs() {
+        return synchronize();
+    }
+
+    // Bytes copied between host mirrors and the device by the last frame.
+    virtual U64 migratedBytes() const {
+        return 0;
+    }
+
     static void YieldCompute(std::unordered_set<U64>& yielded, const std::unordered_set<U64>& outputSet);
     static bool ShouldYield(std::unordered_set<U64>& yielded, const std::unordered_set<U64>& inputSet);
 
+    // Pseudo input of a module that can be suspended. Adding it to the yielded
+    // set makes the module and everything reading its outputs yield.
+    static U64 SuspendHash(const Compute* block);
+
+    // Time every unit into the latency histogram of its module. Device
+    // graphs time the work on the device where they can.
+    static void SetProfiling(const bool& enabled);
+    static bool Profiling();
+
  protected:
+    // Time the units of this frame. True while profiling and on the
+    // cycles picked by the sampler.
+    static bool Timing() {
+        return Profiling() || Sampler::Sampling();
+    }
+
+    static void RecordLatency(const std::shared_ptr<Compute>& block, const U64& nanoseconds);
+
+    static const char* TraceName(const std::shared_ptr<Compute>& block) {
+        return block->traceName;
+    }
+
+    static U64 ElapsedNanoseconds(const std::chrono::steady_clock::time_point& start) {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+    }
+
     struct ComputeUnit {
         std::shared_ptr<Compute> block;
         std::unordered_set<U64> inputSet;
         std::unordered_set<U64> outputSet;
     };
 
+    // List the previous units each unit has to wait for. A unit depends on every
+    // unit producing one of its inputs and in-place units are ordered against
+    // every other unit reading the same tensors.
+    std::vector<std::vector<U64>> unitDependencies() const;
+
     std::shared_ptr<Compute::Context> context;
     std::vector<ComputeUnit> computeUnits;
     std::set<U64> wiredInputSet;
     std::set<U64> wiredOutputSet;
     std::set<U64> externallyWiredInputSet;
     std::set<U64> externallyWiredOutputSet;
+    std::unordered_map<U64, std::shared_ptr<TensorStorageMetadata>> transientOutputs;
+    std::unordered_set<U64> externalOutputs;
+    std::unordered_map<U64, std::shared_ptr<TensorStorageMetadata>> mirroredInputs;
+    std::unordered_map<U64, std::shared_ptr<TensorStorageMetadata>> mirroredOutputs;
+    bool mirrorsChanged = false;
+    WorkerPool* workerPool = nullptr;
+    U64 pipelineStages = 1;
+    I32 _deviceIndex = -1;
 };
 
 }  // namespace Jetstream
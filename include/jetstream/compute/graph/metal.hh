@@ -1,6 +1,9 @@
 #ifndef JETSTREAM_COMPUTE_GRAPH_METAL_HH
 #define JETSTREAM_COMPUTE_GRAPH_METAL_HH
 
+#include <atomic>
+#include <semaphore>
+
 #include "jetstream/memory/base.hh"
 #include "jetstream/compute/graph/generic.hh"
 
@@ -18,12 +21,14 @@ class Metal : public Graph {
     Result create();
     Result compute(std::unordered_set<U64>& yielded);
     Result computeReady();
+    Result synchronize();
     Result destroy();
 
     constexpr MTL::CommandQueue* commandQueue() const {
         return _commandQueue;
     }
 
+    // Command buffer of the frame currently being encoded.
     constexpr MTL::CommandBuffer* commandBuffer() const {
         return _commandBuffer;
     }
@@ -44,8 +49,14 @@ class Metal : public Graph {
     }
 
  private:
+    // Frames encoded ahead of the GPU before compute blocks.
+    static constexpr U64 MaxFramesInFlight = 3;
+
     NS::AutoreleasePool* innerPool;
 
+    std::counting_semaphore<MaxFramesInFlight> framesInFlight{MaxFramesInFlight};
+    std::atomic<bool> commandBufferFailed{false};
+
     MTL::CommandQueue* _commandQueue;
     MTL::CommandBuffer* _commandBuffer;
 };
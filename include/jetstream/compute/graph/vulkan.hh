@@ -0,0 +1,49 @@
+#ifndef JETSTREAM_COMPUTE_GRAPH_VULKAN_HH
+#define JETSTREAM_COMPUTE_GRAPH_VULKAN_HH
+
+#include "jetstream/memory/base.hh"
+#include "jetstream/compute/graph/generic.hh"
+
+namespace Jetstream {
+
+class Vulkan : public Graph {
+ public:
+    Vulkan();
+    ~Vulkan();
+
+    constexpr Device device() const {
+        return Device::Vulkan;
+    }
+
+    Result create();
+    Result compute(std::unordered_set<U64>& yielded);
+    Result computeReady();
+    Result synchronize();
+    Result destroy();
+
+    // Command buffer of the frame currently being recorded.
+    constexpr VkCommandBuffer& commandBuffer() {
+        return _commandBuffer;
+    }
+
+    Result createKernel(const std::string& name,
+                        const std::vector<U8>& kernel,
+                        const std::vector<VkBuffer>& buffers,
+                        const U64& constantsSize = 0);
+
+    Result dispatchKernel(const std::string& name,
+                          const std::vector<U64>& grid,
+                          const void* constants = nullptr);
+
+    Result destroyKernel(const std::string& name);
+
+ private:
+    VkCommandBuffer _commandBuffer;
+
+    struct Impl;
+    std::unique_ptr<Impl> pimpl;
+};
+
+}  // namespace Jetstream
+
+#endif
@@ -0,0 +1,83 @@
+#ifndef JETSTREAM_COMPUTE_LATENCY_HH
+#define JETSTREAM_COMPUTE_LATENCY_HH
+
+#include <array>
+#include <atomic>
+
+#include "jetstream/types.hh"
+#include "jetstream/macros.hh"
+
+namespace Jetstream {
+
+/**
+ * @class LatencyHistogram
+ * @brief Lock-free histogram of durations recorded by one thread and read by any other.
+ *
+ * Durations are counted in buckets spaced by half an octave, from one nanosecond to about
+ * four seconds. Recording is a handful of relaxed atomic operations, so it can stay in the
+ * compute loop. Percentiles are approximated by the geometric center of their bucket.
+ */
+class JETSTREAM_API LatencyHistogram {
+ public:
+    static constexpr U64 BucketCount = 64;
+
+    // Copy of the counters. Two copies summarize the durations recorded in between.
+    struct Snapshot {
+        std::array<U64, BucketCount> buckets{};
+        U64 count = 0;
+        U64 total = 0;
+        U64 last = 0;
+    };
+
+    struct Summary {
+        U64 count = 0;
+        F32 last = 0.0f;
+        F32 mean = 0.0f;
+        F32 p50 = 0.0f;
+        F32 p90 = 0.0f;
+        F32 p99 = 0.0f;
+    };
+
+    /**
+     * @brief Record a duration.
+     * @param nanoseconds Duration in nanoseconds.
+     */
+    void record(const U64& nanoseconds);
+
+    /**
+     * @brief Forget every recorded duration.
+     */
+    void reset();
+
+    /**
+     * @brief Summarize the recorded durations in milliseconds.
+     */
+    Summary summary() const;
+
+    /**
+     * @brief Copy the counters.
+     */
+    Snapshot snapshot() const;
+
+    /**
+     * @brief Summarize the durations recorded between two snapshots in milliseconds.
+     * @param current The latest snapshot.
+     * @param previous An earlier snapshot of the same histogram.
+     */
+    static Summary Summarize(const Snapshot& current, const Snapshot& previous);
+
+    /**
+     * @brief Summarize every duration recorded up to a snapshot in milliseconds.
+     */
+    static Summary Summarize(const Snapshot& current);
+
+ private:
+    std::array<std::atomic<U64>, BucketCount> buckets{};
+    std::atomic<U64> count{0};
+    std::atomic<U64> total{0};
+    std::atomic<U64> last{0};
+};
+
+}  // namespace Jetstream
+
+#endif
@@ -0,0 +1,90 @@
+#ifndef JETSTREAM_COMPUTE_SAMPLER_HH
+#define JETSTREAM_COMPUTE_SAMPLER_HH
+
+#include <string>
+
+#include "jetstream/types.hh"
+#include "jetstream/macros.hh"
+
+namespace Jetstream {
+
+/**
+ * @class Sampler
+ * @brief Process-wide always-on profiler timing the modules of one compute cycle out of many.
+ *
+ * The modules of a sampled cycle are timed like while profiling and their timings are written
+ * to a fixed-size ring in memory, the oldest ones are overwritten once it's full. The duration
+ * of every cycle is checked against a threshold. A slower cycle is written to the ring and the
+ * ring is dumped to a file in the background, so spikes can be diagnosed after the fact.
+ *
+ * Dumps are CSV files with one row per cycle or module timing. Device graphs read the timings
+ * of their units once the work finished, these are attributed to the cycle collecting them.
+ */
+class JETSTREAM_API Sampler {
+ public:
+    struct Config {
+        // Time the modules of one cycle out of this many.
+        U64 interval = 100;
+        // Number of timings kept in memory.
+        U64 capacity = 1 << 16;
+        // Dump the ring when a cycle takes longer, in milliseconds. Zero disables it.
+        F32 threshold = 0.0f;
+        // Folder automatic dumps are written to.
+        std::string folder = ".";
+    };
+
+    /**
+     * @brief Start sampling. Timings recorded before are discarded.
+     * @param config The sampling configuration. The capacity is only used by the first call.
+     */
+    static void Enable(const Config& config);
+
+    /**
+     * @brief Stop sampling. Recorded timings are kept until the next `Enable`.
+     */
+    static void Disable();
+
+    /**
+     * @brief Check if cycles are being sampled.
+     */
+    static bool Enabled();
+
+    /**
+     * @brief Get the configuration of the last `Enable`.
+     */
+    static Config GetConfig();
+
+    /**
+     * @brief Start a compute cycle. Called by the scheduler before computing the graphs.
+     */
+    static void BeginCycle();
+
+    /**
+     * @brief Finish the current compute cycle.
+     * @param nanoseconds Duration of the cycle.
+     */
+    static void EndCycle(const U64& nanoseconds);
+
+    /**
+     * @brief Check if the modules of the current cycle are timed.
+     */
+    static bool Sampling();
+
+    /**
+     * @brief Record the duration of a module in the current cycle.
+     * @param name Name of the module. Must outlive the sampler.
+     * @param nanoseconds Duration of the module.
+     */
+    static void Record(const char* name, const U64& nanoseconds);
+
+    /**
+     * @brief Write the recorded timings to a CSV file.
+     * @param path The path of the file.
+     * @return Result::SUCCESS if the file was written.
+     */
+    static Result Dump(const std::string& path);
+};
+
+}  // namespace Jetstream
+
+#endif
@@ -11,13 +11,71 @@
 #include <unordered_set>
 
 #include "jetstream/compute/graph/base.hh"
+#include "jetstream/compute/signal.hh"
+#include "jetstream/compute/latency.hh"
+#include "jetstream/compute/worker_pool.hh"
 
 namespace Jetstream {
 
 class JETSTREAM_API Scheduler {
  public:
+    struct Config {
+        // Number of threads used to compute independent sub-graphs.
+        // One runs every graph serially on the compute thread and zero
+        // uses the hardware concurrency.
+        U64 computeThreads = 1;
+
+        // Number of threads used to execute independent modules inside
+        // a CPU graph. Same convention as `computeThreads`.
+        U64 graphThreads = 1;
+
+        // Number of threads creating the graphs built by one commit, like
+        // the ones of a flowgraph import. Same convention as `computeThreads`.
+        // CUDA and Metal graphs are always created on the calling thread.
+        U64 createThreads = 0;
+
+        // Number of stages a CPU graph made of a simple chain is split in.
+        // Stages compute consecutive frames at the same time on the graph
+        // threads, delaying the outputs by one frame per extra stage.
+        // One computes every frame through the whole chain at once.
+        U64 pipelineStages = 1;
+
+        // Present modules publishing snapshots without holding the
+        // compute lock. Slow frames stop throttling the compute thread.
+        bool decoupledPresent = false;
+
+        // Sub-graphs only feeding present modules compute at most once per
+        // presented frame and not at all while every view is hidden.
+        bool paceDisplayGraphs = true;
+
+        // Modules only feeding hidden views yield and hidden views
+        // aren't presented.
+        bool suspendHiddenViews = true;
+
+        // CPU modules of the same type and configuration reading the same
+        // inputs, like the front-ends of two spectrum views of one source,
+        // are computed once. Duplicates copy the outputs still read.
+        bool shareModules = true;
+
+        // Time every module into a latency histogram. Adds a little
+        // overhead and splits captured and batched device work.
+        bool profileModules = false;
+    };
+
+    struct GraphStatistics {
+        Device device;
+        I32 deviceIndex;
+        U64 clusterId;
+        U64 blockCount;
+        F32 computeTime;
+        F32 averageComputeTime;
+        U64 migratedBytes;
+    };
+
     Scheduler();
 
+    Result configure(const Config& config);
+
     Result addModule(const Locale& locale, 
                      const std::shared_ptr<Module>& module,
                      const Parser::RecordMap& inputMap,
@@ -25,24 +83,71 @@ class JETSTREAM_API Scheduler {
                      std::shared_ptr<Compute>& compute,
                      std::shared_ptr<Present>& present);
     Result removeModule(const Locale& locale);
+
+    // Defer graph creation until the outermost transaction is committed.
+    // Compute and present are halted while a transaction is open.
+    Result beginTransaction();
+    Result commitTransaction();
+
     Result compute();
     Result present();
     Result destroy();
 
     void drawDebugMessage() const;
 
+    std::vector<GraphStatistics> statistics() const;
+
+    // Enable or disable module profiling. Histograms are cleared when enabled.
+    void setProfiling(const bool& enabled);
+    bool profiling() const;
+
+    // Compute display sub-graphs once every `divisor` presented frames and
+    // modules only feeding views once every `divisor` compute cycles. Raised
+    // by the instance to shed display work under thermal or frame time pressure.
+    void setDisplayDivisor(const U64& divisor);
+    U64 getDisplayDivisor() const;
+
+    // Latency summary of every compute module keyed by locale.
+    std::unordered_map<Locale, LatencyHistogram::Summary, Locale::Hasher> moduleLatency() const;
+
+    // Latency counters of every compute module keyed by locale. Two calls
+    // summarize the latency in between with `LatencyHistogram::Summarize`.
+    std::unordered_map<Locale, LatencyHistogram::Snapshot, Locale::Hasher> moduleLatencySnapshots() const;
+
+    // Compute time counters of every graph, in the order of `statistics`.
+    std::vector<LatencyHistogram::Snapshot> graphLatencySnapshots() const;
+
+    // Buffers of every compute module keyed by locale.
+    std::unordered_map<Locale, std::vector<Compute::BufferStatistics>, Locale::Hasher> moduleBuffers() const;
+
+    // Number of compute cycles run. Present modules might have new data when it changes.
+    U64 computeCycles() const {
+        return cycles.load(std::memory_order_relaxed);
+    }
+
+    // Number of frames skipped because a graph ran out of input.
+    U64 graphUnderruns() const {
+        return underruns.load(std::memory_order_relaxed);
+    }
+
+    constexpr const Config& getConfig() const {
+        return config;
+    }
+
  private:
     typedef std::vector<std::string> ExecutionOrder;
     typedef std::vector<std::pair<Device, ExecutionOrder>> DeviceExecutionOrder;
 
     struct ComputeModuleState {
+        Locale locale;
         std::shared_ptr<Compute> module;
         Parser::RecordMap inputMap;
         Parser::RecordMap outputMap;
         Device device;
+        I32 deviceIndex;
         U64 clusterId;
-        std::unordered_map<std::string, const Parser::Record*> activeInputs;
-        std::unordered_map<std::string, const Parser::Record*> activeOutputs;
+        std::vector<std::pair<std::string, const Parser::Record*>> activeInputs;
+        std::vector<std::pair<std::string, const Parser::Record*>> activeOutputs;
     };
 
     struct PresentModuleState {
@@ -51,7 +156,10 @@ class JETSTREAM_API Scheduler {
         Parser::RecordMap outputMap;
     };
 
+    Config config;
+
     std::mutex sharedMutex;
+    std::mutex presentMutex;
     std::condition_variable presentCond;
     std::condition_variable computeCond;
     bool computeSync = false;
@@ -60,6 +168,10 @@ class JETSTREAM_API Scheduler {
     std::atomic_flag computeWait{false};
     std::atomic_flag computeHalt{true};
     std::atomic_flag presentHalt{true};
+    std::atomic<U64> cycles{0};
+    std::atomic<U64> presentCycles{0};
+    std::atomic<U64> underruns{0};
+    std::atomic<U64> displayDivisor{1};
 
     std::unordered_map<std::string, ComputeModuleState> computeModuleStates;
     std::unordered_map<std::string, PresentModuleState> presentModuleStates;
@@ -69,16 +181,81 @@ class JETSTREAM_API Scheduler {
 
     bool running = true;
     std::vector<std::shared_ptr<Graph>> graphs;
+    std::vector<U64> graphSignatures;
+    std::vector<const char*> graphTraceNames;
     ExecutionOrder executionOrder;
     DeviceExecutionOrder deviceExecutionOrder;
+
+    // In-place modules each module has to run before.
+    std::unordered_map<std::string, std::unordered_set<std::string>> inplaceOrder;
     
     std::unordered_set<U64> yielded;
+    ComputeSignal signal;
+
+    WorkerPool pool;
+    WorkerPool graphPool;
+    std::vector<std::vector<U64>> clusterGraphs;
+    std::vector<std::unordered_set<U64>> clusterYielded;
+
+    // Sub-graphs sorted by priority and the modules with deadlines.
+    std::vector<U64> clusterPriority;
+    std::vector<U64> clusterOrder;
+    std::vector<std::pair<U64, std::shared_ptr<Compute>>> deadlineModules;
+
+    // Sub-graphs paced to the display, their views, and the present cycle
+    // they last computed for.
+    std::vector<bool> clusterDisplayOnly;
+    std::vector<std::vector<std::shared_ptr<Present>>> clusterPresents;
+    std::vector<U64> clusterPresentCycle;
+
+    // Modules only feeding views, consumers first. A module is suspended
+    // while its view is hidden and every module reading it is suspended.
+    struct SuspendableModuleState {
+        U64 hash;
+        std::shared_ptr<Present> view;
+        std::vector<U64> consumers;
+        std::vector<std::shared_ptr<Present>> viewers;
+    };
+    std::vector<SuspendableModuleState> suspendableModules;
+    std::vector<bool> suspendedFlags;
+    std::vector<U64> suspendedHashes;
+
+    // Duplicated modules copying the outputs of their original, and the
+    // outputs they copy. See `Config::shareModules`.
+    class SharedCompute;
+    std::unordered_map<std::string, std::shared_ptr<SharedCompute>> sharedModules;
+    std::unordered_set<U64> sharedOutputs;
+
+    // Graphs with device work possibly still running.
+    std::vector<U64> inFlight;
+    std::vector<std::vector<U64>> clusterInFlight;
+
+    std::atomic<U64> transactionDepth{0};
+    bool transactionDirty = false;
+    std::thread::id transactionOwner;
+
+    mutable std::mutex statisticsMutex;
+    std::vector<GraphStatistics> graphStatistics;
+    std::vector<std::unique_ptr<LatencyHistogram>> graphLatencies;
+    std::vector<std::pair<Locale, std::shared_ptr<Compute>>> statisticsModules;
 
     Result removeInactive();
+    Result shareDuplicates();
     Result arrangeDependencyOrder();
     Result checkSequenceValidity();
     Result createExecutionGraphs();
+    Result createMirrors();
+    Result updateExecutionGraphs();
+
+    Result computeGraphs(const std::vector<U64>& indices,
+                         std::unordered_set<U64>& yieldedSet,
+                         std::vector<U64>& pending);
+    Result computeGraph(const U64& index, std::unordered_set<U64>& yieldedSet);
+    Result synchronizeGraphs();
+    void updateSuspended();
 
+    void acquireState();
+    void releaseState();
     Result lockState(const std::function<Result()>& func);
 };
 
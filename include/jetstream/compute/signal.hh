@@ -0,0 +1,60 @@
+#ifndef JETSTREAM_COMPUTE_SIGNAL_HH
+#define JETSTREAM_COMPUTE_SIGNAL_HH
+
+#include <mutex>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+
+#include "jetstream/types.hh"
+#include "jetstream/macros.hh"
+
+namespace Jetstream {
+
+/**
+ * @class ComputeSignal
+ * @brief Wake-up primitive used by sources to tell the scheduler that new data is available.
+ *
+ * Every notification increments an epoch counter. The waiting thread reads the epoch before
+ * checking for readiness and then blocks until the epoch changes, so notifications sent in
+ * between are never lost. Sources without a producer thread (e.g. timers) can schedule a
+ * notification for a point in time instead.
+ */
+class JETSTREAM_API ComputeSignal {
+ public:
+    typedef std::chrono::steady_clock::time_point TimePoint;
+
+    /**
+     * @brief Wake up the waiting thread.
+     */
+    void notify();
+
+    /**
+     * @brief Wake up the waiting thread at a point in time.
+     * @param deadline Time of the notification. The earliest pending deadline wins.
+     */
+    void notifyAt(const TimePoint& deadline);
+
+    /**
+     * @brief Block until a notification newer than `epoch` arrives.
+     * @param epoch Epoch read before checking for readiness.
+     * @param timeout Maximum amount of time to wait.
+     *
+     * @return Result::SUCCESS if notified, Result::TIMEOUT otherwise.
+     */
+    Result wait(const U64& epoch, const std::chrono::milliseconds& timeout);
+
+    U64 epoch() const {
+        return counter.load();
+    }
+
+ private:
+    std::mutex mutex;
+    std::condition_variable cond;
+    std::atomic<U64> counter{0};
+    TimePoint deadline = TimePoint::max();
+};
+
+}  // namespace Jetstream
+
+#endif
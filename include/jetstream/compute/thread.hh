@@ -0,0 +1,89 @@
+#ifndef JETSTREAM_COMPUTE_THREAD_HH
+#define JETSTREAM_COMPUTE_THREAD_HH
+
+#include <string>
+#include <vector>
+
+#include "jetstream/types.hh"
+#include "jetstream/macros.hh"
+
+namespace Jetstream {
+
+/**
+ * @brief Threads with a configurable scheduling policy.
+ */
+enum class ThreadRole : U8 {
+    Compute,    ///< Thread calling `Instance::compute`.
+    Present,    ///< Thread calling `Instance::present`.
+    Worker,     ///< Worker pool threads computing sub-graphs and modules.
+    IO,         ///< Device threads feeding buffers, like the Soapy reader.
+    Audio,      ///< Audio device callback thread.
+};
+
+/**
+ * @brief Placement and priority of a thread.
+ *
+ * Only Linux supports every option. Other platforms apply what they can
+ * and ignore the rest. Options the process isn't permitted to use, like
+ * real-time priorities without CAP_SYS_NICE, log a warning and are skipped.
+ */
+struct ThreadPolicy {
+    // Cores the thread may run on. Empty for any core.
+    std::vector<U64> cores;
+    // Run on the cores of this NUMA node when `cores` is empty. Negative for any node.
+    I32 numaNode = -1;
+    // SCHED_FIFO priority between 1 and 99. Zero keeps the default scheduler.
+    U64 realtimePriority = 0;
+
+    constexpr bool enabled() const {
+        return !cores.empty() || numaNode >= 0 || realtimePriority > 0;
+    }
+};
+
+/**
+ * @brief Scheduling policy of every thread role.
+ */
+struct ThreadPolicies {
+    ThreadPolicy compute;
+    ThreadPolicy present;
+    ThreadPolicy worker;
+    ThreadPolicy io;
+    ThreadPolicy audio;
+
+    const ThreadPolicy& get(const ThreadRole& role) const;
+};
+
+/**
+ * @brief Set the process-wide policies used by `ApplyThreadPolicy`.
+ * @param policies The policy of every role.
+ */
+JETSTREAM_API void SetThreadPolicies(const ThreadPolicies& policies);
+
+/**
+ * @brief Apply the policy of a role to the calling thread.
+ * @param role The role of the calling thread.
+ *
+ * @return Result indicating the success or failure of the operation.
+ */
+JETSTREAM_API Result ApplyThreadPolicy(const ThreadRole& role);
+
+/**
+ * @brief Apply a policy to the calling thread.
+ * @param policy The policy to be applied.
+ *
+ * @return Result indicating the success or failure of the operation.
+ */
+JETSTREAM_API Result ApplyThreadPolicy(const ThreadPolicy& policy);
+
+/**
+ * @brief Parse a core list like `0-3,8,10-11`.
+ * @param list The core list.
+ * @param[out] cores The parsed cores.
+ *
+ * @return Result indicating the success or failure of the operation.
+ */
+JETSTREAM_API Result ParseCoreList(const std::string& list, std::vector<U64>& cores);
+
+}  // namespace Jetstream
+
+#endif
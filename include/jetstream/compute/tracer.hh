@@ -0,0 +1,108 @@
+#ifndef JETSTREAM_COMPUTE_TRACER_HH
+#define JETSTREAM_COMPUTE_TRACER_HH
+
+#include <string>
+
+#include "jetstream/types.hh"
+#include "jetstream/macros.hh"
+
+namespace Jetstream {
+
+/**
+ * @class Tracer
+ * @brief Process-wide recorder of timed spans exported as a Chrome trace.
+ *
+ * Spans are written to a fixed-size ring in memory, the oldest ones are overwritten once it's full.
+ * Recording is a couple of atomic operations and nothing is recorded while the tracer is disabled.
+ * The dump is a Chrome trace event JSON file, it opens in `chrome://tracing` and in the Perfetto UI.
+ *
+ * Span and category names aren't copied, they must outlive the tracer. Names built at runtime
+ * are kept alive by `Intern`.
+ */
+class JETSTREAM_API Tracer {
+ public:
+    static constexpr U64 DefaultCapacity = 1 << 18;
+
+    /**
+     * @class Span
+     * @brief Record the lifetime of the object as a span of the calling thread.
+     */
+    class Span {
+     public:
+        explicit Span(const char* name, const char* category = "jetstream")
+             : name(name),
+               category(category),
+               active(Tracer::Enabled()),
+               start(active ? Tracer::Now() : 0) {}
+
+        ~Span() {
+            if (active) {
+                Tracer::Record(name, category, start, Tracer::Now());
+            }
+        }
+
+        Span(const Span&) = delete;
+        Span& operator=(const Span&) = delete;
+
+     private:
+        const char* name;
+        const char* category;
+        bool active;
+        U64 start;
+    };
+
+    /**
+     * @brief Start recording. Spans recorded before are discarded.
+     * @param capacity Number of spans kept in memory. Only used by the first call.
+     */
+    static void Enable(const U64& capacity = DefaultCapacity);
+
+    /**
+     * @brief Stop recording. Recorded spans are kept until the next `Enable`.
+     */
+    static void Disable();
+
+    /**
+     * @brief Check if spans are being recorded.
+     */
+    static bool Enabled();
+
+    /**
+     * @brief Get the current time of the trace clock in nanoseconds.
+     */
+    static U64 Now();
+
+    /**
+     * @brief Record a span of the calling thread.
+     * @param name Name of the span.
+     * @param category Category of the span.
+     * @param start Start time from `Now`.
+     * @param end End time from `Now`.
+     */
+    static void Record(const char* name, const char* category, const U64& start, const U64& end);
+
+    /**
+     * @brief Get a copy of a string living as long as the process.
+     * @param name The string. Equal strings share the same copy.
+     */
+    static const char* Intern(const std::string& name);
+
+    /**
+     * @brief Name the calling thread in the trace.
+     * @param name The name of the thread.
+     */
+    static void SetThreadName(const std::string& name);
+
+    /**
+     * @brief Write the recorded spans to a Chrome trace event JSON file.
+     * @param path The path of the file.
+     * @return Result::SUCCESS if the file was written.
+     */
+    static Result Dump(const std::string& path);
+};
+
+}  // namespace Jetstream
+
+#define JST_TRACE_SPAN(...) Jetstream::Tracer::Span JST_UNIQUE(_jstTraceSpan)(__VA_ARGS__)
+
+#endif
@@ -0,0 +1,106 @@
+#ifndef JETSTREAM_COMPUTE_WORKER_POOL_HH
+#define JETSTREAM_COMPUTE_WORKER_POOL_HH
+
+#include <mutex>
+#include <deque>
+#include <atomic>
+#include <memory>
+#include <vector>
+#include <thread>
+#include <functional>
+#include <condition_variable>
+
+#include "jetstream/types.hh"
+#include "jetstream/macros.hh"
+
+namespace Jetstream {
+
+/**
+ * @class WorkerPool
+ * @brief Fixed-size work-stealing pool of threads used to execute independent work.
+ *
+ * Every worker owns a task queue. Tasks dispatched from inside a worker are pushed
+ * to the front of its own queue and tasks dispatched from outside are distributed
+ * round-robin. Idle workers steal from the back of the other queues.
+ *
+ * The caller can either block on `wait` until every task dispatched so far has
+ * finished or track its own completion and call `runPending` to help while waiting.
+ */
+class JETSTREAM_API WorkerPool {
+ public:
+    typedef std::function<void()> Task;
+
+    WorkerPool() = default;
+    ~WorkerPool();
+
+    WorkerPool(const WorkerPool&) = delete;
+    WorkerPool& operator=(const WorkerPool&) = delete;
+
+    /**
+     * @brief Start the worker threads.
+     * @param count Number of threads. Zero means the hardware concurrency.
+     *
+     * @return Result indicating the success or failure of the operation.
+     */
+    Result start(const U64& count);
+
+    /**
+     * @brief Stop and join all worker threads. Pending tasks are executed before returning.
+     *
+     * @return Result indicating the success or failure of the operation.
+     */
+    Result stop();
+
+    /**
+     * @brief Enqueue a task to be executed by the next free worker.
+     * @param task Function to be executed.
+     */
+    void dispatch(Task&& task);
+
+    /**
+     * @brief Block until all dispatched tasks finish.
+     */
+    void wait();
+
+    /**
+     * @brief Execute one pending task on the calling thread if there is any.
+     *
+     * @return True if a task was executed, false otherwise.
+     */
+    bool runPending();
+
+    constexpr U64 size() const {
+        return queues.size();
+    }
+
+    constexpr bool running() const {
+        return !queues.empty();
+    }
+
+ private:
+    struct Queue {
+        std::mutex mutex;
+        std::deque<Task> tasks;
+    };
+
+    std::mutex mutex;
+    std::condition_variable taskCond;
+    std::condition_variable doneCond;
+
+    std::vector<std::unique_ptr<Queue>> queues;
+    std::vector<std::thread> workers;
+
+    std::atomic<U64> queued{0};
+    std::atomic<U64> pending{0};
+    std::atomic<U64> roundRobin{0};
+    bool halt = false;
+
+    bool pop(const U64& index, Task& task);
+    bool steal(const U64& index, Task& task);
+    void finish();
+    void workerLoop(const U64 index);
+};
+
+}  // namespace Jetstream
+
+#endif
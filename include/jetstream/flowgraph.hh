@@ -37,8 +37,40 @@ class JETSTREAM_API Flowgraph {
     Result exportToFile(const std::string& path);
     Result exportToBlob(std::vector<char>& blob);
 
+    // Binary flowgraphs hold the same graph as the YAML one with the file already
+    // parsed. They are loaded by `importFromFile` and `importFromBlob` as well.
+    Result exportToSnapshot(std::vector<char>& blob);
+
+    static bool IsSnapshot(const std::vector<char>& blob);
+    static Result ConvertToSnapshot(const std::vector<char>& yaml, std::vector<char>& snapshot);
+    static Result ConvertToYaml(const std::vector<char>& snapshot, std::vector<char>& yaml);
+    // Writes YAML to `.yml` and `.yaml` paths, a binary flowgraph otherwise.
+    static Result ConvertFile(const std::string& inputPath, const std::string& outputPath);
+
+    struct Snapshot;
+
     Result print() const;
 
+    // Replace the SDR, file, network and shared memory sources of imported
+    // flowgraphs by generated noise of the same shape.
+    void setSyntheticSources(const bool& enabled) {
+        _syntheticSources = enabled;
+    }
+
+    // Run the parts of distributed flowgraphs sent by a coordinator. Blocks
+    // with a `host` in their interface are sent to the worker at that address
+    // when the flowgraph is imported, the others run here. The worker listens
+    // on loopback unless given another address, and only accepts coordinators
+    // presenting its token.
+    Result startWorker(const U64& port, const std::string& address = "127.0.0.1");
+    Result stopWorker();
+
+    // Token shared by a coordinator and its workers. Read from the
+    // `JST_WORKER_TOKEN` environment variable when empty.
+    void setWorkerToken(const std::string& token) {
+        _workerToken = token;
+    }
+
     U64 empty() const {
         return _nodes.empty();
     }
@@ -154,6 +186,7 @@ class JETSTREAM_API Flowgraph {
     }
 
     friend class Instance;
+    friend class Benchmark;
     friend Superluminal;
 
  private:
@@ -165,7 +198,15 @@ class JETSTREAM_API Flowgraph {
     struct YamlImpl;
     std::unique_ptr<YamlImpl> _yaml;
 
+    struct Partition;
+    std::unique_ptr<Partition> _partition;
+
+    struct Worker;
+    std::unique_ptr<Worker> _worker;
+
     bool _created = false;
+    bool _syntheticSources = false;
+    std::string _workerToken;
 
     std::string _protocolVersion;
     std::string _cyberetherVersion;
@@ -174,6 +215,14 @@ class JETSTREAM_API Flowgraph {
     std::string _author;
     std::string _license;
     std::string _description;  
+
+    Result importSnapshot(const Snapshot& snapshot);
+    Result importDistributed(const Snapshot& snapshot);
+    static std::string WorkerToken(const std::string& token);
+
+    Result addSyntheticSource(const std::string& nodeKey,
+                              const Block::Fingerprint& fingerprint,
+                              Parser::RecordMap& configMap);
 };
 
 }  // namespace Jetstream
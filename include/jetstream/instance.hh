@@ -1,10 +1,14 @@
 #ifndef JETSTREAM_INSTANCE_HH
 #define JETSTREAM_INSTANCE_HH
 
+#include <map>
 #include <tuple>
+#include <chrono>
 #include <stack>
 #include <memory>
 #include <vector>
+#include <deque>
+#include <optional>
 #include <algorithm>
 #include <unordered_set>
 #include <unordered_map>
@@ -14,8 +18,13 @@
 #include "jetstream/block.hh"
 #include "jetstream/parser.hh"
 #include "jetstream/flowgraph.hh"
+#include "jetstream/startup.hh"
+#include "jetstream/quality.hh"
 #include "jetstream/compositor.hh"
 #include "jetstream/compute/base.hh"
+#include "jetstream/compute/thread.hh"
+#include "jetstream/memory/footprint.hh"
+#include "jetstream/memory/devices/cpu/pool.hh"
 
 namespace Jetstream {
 
@@ -24,18 +33,36 @@ class JETSTREAM_API Instance {
     struct Config {
         Device preferredDevice = Device::None;
         bool renderCompositor = false;
+        // Build without viewport, window and compositor. Blocks with views are left incomplete.
+        bool headless = false;
+        // Headless, with the view modules kept as no-op sinks instead. They're never
+        // created, so blocks with views stay complete without allocating or computing.
+        bool computeOnly = false;
         Backend::Config backendConfig = {};
         Viewport::Config viewportConfig = {};
         Render::Window::Config renderConfig = {};
+        Scheduler::Config schedulerConfig = {};
+        CPUMemoryHints memoryHints = {};
+        ThreadPolicies threadPolicies = {};
+        // Lowers the framerate, the display sub-graphs rate and the plot resolution
+        // while the platform is hot or frames take longer than the budget.
+        QualityController::Config qualityConfig = {};
+        // Variants of each block kept created after changing its backend or data type.
+        // Switching back to one of them reuses its modules instead of creating them again.
+        U64 warmBlockVariants = 0;
     };
 
     Instance();
 
     Result build(const Config& config);
 
+    // Backends are shared with the other instances of the process
+    // and destroyed when the last instance using them is destroyed.
     template<Device D>
     Result buildBackend(const Backend::Config& config) {
-        return Backend::Initialize<D>(config);
+        JST_CHECK(Backend::Acquire<D>(config));
+        _backends.push_back(D);
+        return Result::SUCCESS;
     }
 
     template<class Platform, typename... Args>
@@ -47,6 +74,7 @@ class JETSTREAM_API Instance {
 
         // Create viewport.
 
+        JST_STARTUP_PHASE("Viewport Creation");
         _viewport = std::make_shared<Platform>(config, args...);
         JST_CHECK(_viewport->create());
 
@@ -72,6 +100,7 @@ class JETSTREAM_API Instance {
 
         // Create window.
 
+        JST_STARTUP_PHASE("Window Creation");
         auto viewport = std::dynamic_pointer_cast<Viewport::Adapter<D>>(_viewport);
         _window = std::make_shared<Render::WindowImp<D>>(config, viewport);
         JST_CHECK(_window->create());
@@ -158,7 +187,7 @@ class JETSTREAM_API Instance {
         // Validate module type.
 
         if constexpr (std::is_base_of<Present, B>::value) {
-            if (!_window) {
+            if (!_window && !this->config.computeOnly) {
                 JST_FATAL("[INSTANCE] A window is required because "
                           "a graphical module was added.");
                 return Result::FATAL;
@@ -203,7 +232,38 @@ class JETSTREAM_API Instance {
         module->config = config;
         module->input = input;
 
-        // Create module and load state.
+        // Modules run on the GPU their block is placed on.
+
+        if (_flowgraph.nodes().contains(locale.block())) {
+            const auto& block = _flowgraph.nodes().at(locale.block())->block;
+            if (block) {
+                module->_deviceIndex = block->getState().deviceIndex;
+            }
+        }
+
+        // Views of compute-only instances only keep their inputs.
+
+        if constexpr (std::is_base_of<Present, B>::value) {
+            if (this->config.computeOnly) {
+                JST_DEBUG("[INSTANCE] Module '{}' is a view, keeping it as a no-op sink.", locale);
+
+                JST_CHECK(module->input >> node->inputMap);
+
+                _flowgraph.nodes()[locale] = node;
+                _flowgraph.nodesOrder().push_back(locale);
+
+                return Result::SUCCESS;
+            }
+        }
+
+        // Create module and load state. Device memory is allocated on its GPU.
+
+#ifdef JETSTREAM_BACKEND_CUDA_AVAILABLE
+        std::optional<Backend::CUDA::Placement> placement;
+        if constexpr (D == Device::CUDA) {
+            placement.emplace(module->deviceIndex());
+        }
+#endif
 
         if (module->create() != Result::SUCCESS) {
             JST_DEBUG("[INSTANCE] Module '{}' is incomplete.", locale);
@@ -216,6 +276,10 @@ class JETSTREAM_API Instance {
             return Result::SUCCESS;
         }
 
+#ifdef JETSTREAM_BACKEND_CUDA_AVAILABLE
+        placement.reset();
+#endif
+
         // Populate block state record data.
 
         JST_CHECK(module->input >> node->inputMap);
@@ -249,6 +313,14 @@ class JETSTREAM_API Instance {
             node->present = module;
         }
 
+        // Modules computing the same outputs from the same inputs are shared by the scheduler.
+
+        if constexpr (std::is_base_of<Compute, B>::value && !std::is_base_of<Present, B>::value) {
+            if (module->computeShareable()) {
+                JST_CHECK(ShareSignature(*module, module->shareSignature));
+            }
+        }
+
         // Add block to the scheduler.
 
         JST_CHECK(_scheduler.addModule(locale,
@@ -345,13 +417,23 @@ class JETSTREAM_API Instance {
         block->config = config;
         block->input = input;
 
-        // Create block and load state.
+        // Create block and load state. Internal blocks and modules
+        // created by it inherit its memory hints and are accounted to it.
+
+        std::optional<CPUMemoryPool::ScopedHints> memoryHints;
+        if (blockMemoryHints.contains(locale.blockId)) {
+            memoryHints.emplace(blockMemoryHints.at(locale.blockId));
+        }
+        std::optional<MemoryFootprint::ScopedBlock> memoryOwner(locale.blockId);
 
         if (block->create() != Result::SUCCESS) {
             JST_DEBUG("[INSTANCE] Block '{}' is incomplete.", locale);
             block->setComplete(false);
         }
 
+        memoryOwner.reset();
+        memoryHints.reset();
+
         // Populate block state record data.
 
         JST_CHECK(block->input >> node->inputMap);
@@ -374,12 +456,14 @@ class JETSTREAM_API Instance {
 
         // Add block to the compositor.
 
-        JST_CHECK(_compositor->addBlock(locale,
-                                        block,
-                                        node->inputMap,
-                                        node->outputMap,
-                                        node->stateMap,
-                                        node->fingerprint));
+        if (_compositor) {
+            JST_CHECK(_compositor->addBlock(locale,
+                                            block,
+                                            node->inputMap,
+                                            node->outputMap,
+                                            node->stateMap,
+                                            node->fingerprint));
+        }
 
         return Result::SUCCESS;
     }
@@ -411,6 +495,15 @@ class JETSTREAM_API Instance {
     Result changeBlockBackend(Locale input, Device device);
     Result changeBlockDataType(Locale input, std::tuple<std::string, std::string> type);
 
+    // Override the global memory hints for CPU tensors allocated by a block.
+    // Applied the next time the block is created or reloaded.
+    Result setBlockMemoryHints(Locale locale, const CPUMemoryHints& hints);
+
+    // Batch many block changes into a single scheduler update.
+    Result beginTransaction();
+    Result commitTransaction();
+    Result transaction(const std::function<Result()>& func);
+
     Result reset();
     Result eraseModule(Locale locale);
     Result eraseBlock(Locale locale);
@@ -431,6 +524,22 @@ class JETSTREAM_API Instance {
     Result present();
     Result end();
 
+    // Duration of the stages of the frames drawn by the present thread.
+    struct FrameLatency {
+        // From `begin` to the end of `end`.
+        LatencyHistogram::Snapshot frame;
+        // Present logic of the modules.
+        LatencyHistogram::Snapshot present;
+        // Compositor interface.
+        LatencyHistogram::Snapshot interface;
+        // Recording and submission of the frame.
+        LatencyHistogram::Snapshot render;
+        // Encoding of the frame by a remote viewport. Empty otherwise.
+        LatencyHistogram::Snapshot encode;
+    };
+
+    FrameLatency frameLatency() const;
+
     Compositor& compositor() {
         return *_compositor;
     }
@@ -439,6 +548,10 @@ class JETSTREAM_API Instance {
         return _scheduler;
     }
 
+    const QualityController& quality() const {
+        return _quality;
+    }
+
     Render::Window& window() {
         return *_window;
     }
@@ -456,17 +569,73 @@ class JETSTREAM_API Instance {
 
     Scheduler _scheduler;
     Flowgraph _flowgraph;
+    QualityController _quality;
 
     std::shared_ptr<Compositor> _compositor;
     std::shared_ptr<Render::Window> _window;
     std::shared_ptr<Viewport::Generic> _viewport;
+    std::vector<Device> _backends;
 
     bool presentRunning;
     bool computeRunning;
 
+    std::chrono::steady_clock::time_point frameStart;
+    std::chrono::steady_clock::time_point lastFrameStart;
+    LatencyHistogram frameHistogram;
+    LatencyHistogram presentHistogram;
+    LatencyHistogram interfaceHistogram;
+    LatencyHistogram renderHistogram;
+
+    std::unordered_map<std::string, CPUMemoryHints> blockMemoryHints;
+
+    // Block and module nodes of a block taken out of the flowgraph without being destroyed.
+    struct WarmVariant {
+        std::string signature;
+        std::vector<std::pair<Locale, std::shared_ptr<Flowgraph::Node>>> nodes;
+    };
+
+    std::unordered_map<std::string, std::deque<WarmVariant>> warmVariants;
+
+    Result parkBlock(Locale locale);
+    Result restoreBlock(const Flowgraph::Node& record, bool& restored);
+    Result createBlock(Flowgraph::Node& record, const bool& warm);
+    Result evictWarmVariants(const std::string& blockId);
+    Result destroyWarmVariant(WarmVariant& variant);
+
+    static bool VariantSignature(const Flowgraph::Node& record, std::string& signature);
+
+    // Type and configuration of a module. Empty if the configuration can't be compared.
+    template<typename B>
+    static Result ShareSignature(B& module, std::string& signature) {
+        signature.clear();
+
+        auto config = module.config;
+        Parser::RecordMap configMap;
+        JST_CHECK(config >> configMap);
+
+        std::map<std::string, std::string> fields;
+        for (const auto& [key, record] : configMap) {
+            std::string value;
+            JST_CHECK(Parser::AnyToString(record.object, value, true));
+            if (value.empty()) {
+                return Result::SUCCESS;
+            }
+            fields[key] = value;
+        }
+
+        signature = typeid(B).name();
+        for (const auto& [key, value] : fields) {
+            signature += jst::fmt::format("|{}={}", key, value);
+        }
+
+        return Result::SUCCESS;
+    }
+
     Result fetchDependencyTree(Locale locale, std::vector<Locale>& storage);
 
-    Result blockUpdater(Locale locale, const std::function<Result(std::shared_ptr<Flowgraph::Node>&)>& updater);
+    Result blockUpdater(Locale locale,
+                        const std::function<Result(std::shared_ptr<Flowgraph::Node>&)>& updater,
+                        const bool& warm = false);
 };
 
 }  // namespace Jetstream
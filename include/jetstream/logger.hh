@@ -4,6 +4,7 @@
 #include <ostream>
 #include <string>
 #include <mutex>
+#include <iterator>
 
 #ifndef JST_FMT_INCLUDED
 #define JST_FMT_INCLUDED
@@ -39,39 +40,52 @@ void JST_LOG_RESTORE_STDOUT();
 void JST_LOG_COLOR(bool);
 jst::fmt::text_style JST_LOG_STYLE(const jst::fmt::text_style&);
 
-#define _JST_LOG_SINK          (JST_LOG_SINK())
-#define _JST_LOG_ENDL          std::endl
 #define _JST_LOG_FORMAT        jst::fmt::format
-
-#define _JST_LOG_TAINT(style, ...)   _JST_LOG_FORMAT(JST_LOG_STYLE(style), __VA_ARGS__)
-
 #define _JST_LOG_DEFAULT(...)  _JST_LOG_FORMAT(__VA_ARGS__)
-#define _JST_LOG_BOLD(...)     _JST_LOG_TAINT(jst::fmt::emphasis::bold, __VA_ARGS__)
-#define _JST_LOG_ORANGE(...)   _JST_LOG_TAINT(jst::fmt::fg(jst::fmt::color::orange), __VA_ARGS__)
-#define _JST_LOG_YELLOW(...)   _JST_LOG_TAINT(jst::fmt::fg(jst::fmt::color::yellow), __VA_ARGS__)
-#define _JST_LOG_CYAN(...)     _JST_LOG_TAINT(jst::fmt::fg(jst::fmt::color::aqua), __VA_ARGS__)
-#define _JST_LOG_RED(...)      _JST_LOG_TAINT(jst::fmt::fg(jst::fmt::color::red), __VA_ARGS__)
-#define _JST_LOG_MAGENTA(...)  _JST_LOG_TAINT(jst::fmt::fg(jst::fmt::color::fuchsia), __VA_ARGS__)
-
-#define _JST_LOG_NAME          _JST_LOG_BOLD("JETSTREAM ")
-#define _JST_LOG_SEPR          _JST_LOG_BOLD("| ")
-#define _JST_LOG_TRACE         _JST_LOG_BOLD("[TRACE] ")
-#define _JST_LOG_DEBUG         _JST_LOG_BOLD("[DEBUG] ")
-#define _JST_LOG_WARN          _JST_LOG_BOLD("[WARN]  ")
-#define _JST_LOG_INFO          _JST_LOG_BOLD("[INFO]  ")
-#define _JST_LOG_ERROR         _JST_LOG_BOLD("[ERROR] ")
-#define _JST_LOG_FATAL         _JST_LOG_BOLD("[FATAL] ")
+
+#define _JST_LOG_BOLD          jst::fmt::emphasis::bold
+#define _JST_LOG_PLAIN         jst::fmt::text_style()
+#define _JST_LOG_ORANGE        jst::fmt::fg(jst::fmt::color::orange)
+#define _JST_LOG_YELLOW        jst::fmt::fg(jst::fmt::color::yellow)
+#define _JST_LOG_CYAN          jst::fmt::fg(jst::fmt::color::aqua)
+#define _JST_LOG_RED           jst::fmt::fg(jst::fmt::color::red)
+#define _JST_LOG_MAGENTA       jst::fmt::fg(jst::fmt::color::fuchsia)
+
+#define _JST_LOG_TRACE         "[TRACE] "
+#define _JST_LOG_DEBUG         "[DEBUG] "
+#define _JST_LOG_WARN          "[WARN]  "
+#define _JST_LOG_INFO          "[INFO]  "
+#define _JST_LOG_ERROR         "[ERROR] "
+#define _JST_LOG_FATAL         "[FATAL] "
+
+// Lines are written by the calling thread under a mutex by default. In the
+// asynchronous mode they're queued without locking and written by a
+// background thread, dropping lines while the queue is full. Fatal lines
+// wait for the queue to be written. In both modes, a line repeated within a
+// second is only counted and reported once the next different line comes.
+void JST_LOG_ASYNC(bool);
+void JST_LOG_FLUSH();
+void _JST_LOG_WRITE(int level, const char* line, size_t size);
+
+// Formats the line in a stack buffer, so short lines don't allocate.
+template<typename... Args>
+inline void _JST_LOG_EMIT(int level,
+                          const char* tag,
+                          const jst::fmt::text_style& style,
+                          jst::fmt::format_string<Args...> format,
+                          Args&&... args) {
+    jst::fmt::memory_buffer line;
+    jst::fmt::vformat_to(std::back_inserter(line), JST_LOG_STYLE(_JST_LOG_BOLD),
+                         jst::fmt::string_view("JETSTREAM {}| "), jst::fmt::make_format_args(tag));
+    jst::fmt::vformat_to(std::back_inserter(line), JST_LOG_STYLE(style),
+                         static_cast<jst::fmt::string_view>(format), jst::fmt::make_format_args(args...));
+    _JST_LOG_WRITE(level, line.data(), line.size());
+}
 
 #ifndef JST_TRACE
 #ifdef JST_DEBUG_MODE
 #define JST_TRACE(...) if (_JST_LOG_DEBUG_LEVEL() >= 4) { \
-                       std::lock_guard<std::mutex> lock(_JST_LOG_MUTEX()); \
-                       _JST_LOG_SINK                 << \
-                       _JST_LOG_NAME                 << \
-                       _JST_LOG_TRACE                << \
-                       _JST_LOG_SEPR                 << \
-                       _JST_LOG_DEFAULT(__VA_ARGS__) << \
-                       _JST_LOG_ENDL; }
+                       _JST_LOG_EMIT(4, _JST_LOG_TRACE, _JST_LOG_PLAIN, __VA_ARGS__); }
 #else
 #define JST_TRACE(...)
 #endif
@@ -79,26 +93,14 @@ jst::fmt::text_style JST_LOG_STYLE(const jst::fmt::text_style&);
 
 #ifndef JST_DEBUG
 #define JST_DEBUG(...) if (_JST_LOG_DEBUG_LEVEL() >= 3) { \
-                       std::lock_guard<std::mutex> lock(_JST_LOG_MUTEX()); \
-                       _JST_LOG_SINK                << \
-                       _JST_LOG_NAME                << \
-                       _JST_LOG_DEBUG               << \
-                       _JST_LOG_SEPR                << \
-                       _JST_LOG_ORANGE(__VA_ARGS__) << \
-                       _JST_LOG_ENDL; }
+                       _JST_LOG_EMIT(3, _JST_LOG_DEBUG, _JST_LOG_ORANGE, __VA_ARGS__); }
 #else
 #define JST_DEBUG(...)
 #endif
 
 #ifndef JST_INFO
 #define JST_INFO(...) if (_JST_LOG_DEBUG_LEVEL() >= 2) { \
-                      std::lock_guard<std::mutex> lock(_JST_LOG_MUTEX()); \
-                      _JST_LOG_SINK              << \
-                      _JST_LOG_NAME              << \
-                      _JST_LOG_INFO              << \
-                      _JST_LOG_SEPR              << \
-                      _JST_LOG_CYAN(__VA_ARGS__) << \
-                      _JST_LOG_ENDL; }
+                      _JST_LOG_EMIT(2, _JST_LOG_INFO, _JST_LOG_CYAN, __VA_ARGS__); }
 #else
 #define JST_INFO(...)
 #endif
@@ -106,13 +108,7 @@ jst::fmt::text_style JST_LOG_STYLE(const jst::fmt::text_style&);
 #ifndef JST_WARN
 #define JST_WARN(...) if (_JST_LOG_DEBUG_LEVEL() >= 1) { \
                       JST_LOG_LAST_WARNING() = _JST_LOG_DEFAULT(__VA_ARGS__); \
-                      std::lock_guard<std::mutex> lock(_JST_LOG_MUTEX()); \
-                      _JST_LOG_SINK                << \
-                      _JST_LOG_NAME                << \
-                      _JST_LOG_WARN                << \
-                      _JST_LOG_SEPR                << \
-                      _JST_LOG_YELLOW(__VA_ARGS__) << \
-                      _JST_LOG_ENDL; }
+                      _JST_LOG_EMIT(1, _JST_LOG_WARN, _JST_LOG_YELLOW, __VA_ARGS__); }
 #else
 #define JST_WARN(...)
 #endif
@@ -120,13 +116,7 @@ jst::fmt::text_style JST_LOG_STYLE(const jst::fmt::text_style&);
 #ifndef JST_ERROR
 #define JST_ERROR(...) if (_JST_LOG_DEBUG_LEVEL() >= 0) { \
                        JST_LOG_LAST_ERROR() = _JST_LOG_DEFAULT(__VA_ARGS__); \
-                       std::lock_guard<std::mutex> lock(_JST_LOG_MUTEX()); \
-                       _JST_LOG_SINK             << \
-                       _JST_LOG_NAME             << \
-                       _JST_LOG_ERROR            << \
-                       _JST_LOG_SEPR             << \
-                       _JST_LOG_RED(__VA_ARGS__) << \
-                       _JST_LOG_ENDL; }
+                       _JST_LOG_EMIT(0, _JST_LOG_ERROR, _JST_LOG_RED, __VA_ARGS__); }
 #else
 #define JST_ERROR(...)
 #endif
@@ -134,13 +124,7 @@ jst::fmt::text_style JST_LOG_STYLE(const jst::fmt::text_style&);
 #ifndef JST_FATAL
 #define JST_FATAL(...) if (_JST_LOG_DEBUG_LEVEL() >= 0) { \
                        JST_LOG_LAST_FATAL() = _JST_LOG_DEFAULT(__VA_ARGS__); \
-                       std::lock_guard<std::mutex> lock(_JST_LOG_MUTEX()); \
-                       _JST_LOG_SINK                 << \
-                       _JST_LOG_NAME                 << \
-                       _JST_LOG_FATAL                << \
-                       _JST_LOG_SEPR                 << \
-                       _JST_LOG_MAGENTA(__VA_ARGS__) << \
-                       _JST_LOG_ENDL; }
+                       _JST_LOG_EMIT(-1, _JST_LOG_FATAL, _JST_LOG_MAGENTA, __VA_ARGS__); }
 #else
 #define JST_FATAL(...)
 #endif
@@ -138,22 +138,30 @@
 
 #ifndef JST_BENCHMARK_RUN
 #define JST_BENCHMARK_RUN(TestName, Config, Input, ...) \
-    { \
-        auto graph = NewGraph(D); \
-        auto module = std::make_shared<Module<D, __VA_ARGS__>>(); \
-        module->init_benchmark_mode(Config, Input); \
-        module->create(); \
-        graph->setModule(module, {}, {}); \
-        graph->create(); \
-        bench.run(name + TestName, [&] { \
-            std::unordered_set<U64> yielded; \
-            graph->compute(yielded); \
-        }); \
-        graph->destroy(); \
-        module->destroy(); \
-    }
+    BenchmarkModule<D, Module<D, __VA_ARGS__>>(bench, name + TestName, 0.0, Config, Input);
 #endif  // JST_BENCHMARK_RUN
 
+// Same as `JST_BENCHMARK_RUN` with the floating point operations
+// needed to compute each output element, for FLOP/s reporting.
+// Both expand to a single call so `COMMA` in the arguments is only
+// expanded once.
+#ifndef JST_BENCHMARK_RUN_FLOPS
+#define JST_BENCHMARK_RUN_FLOPS(TestName, FlopsPerElement, Config, Input, ...) \
+    BenchmarkModule<D, Module<D, __VA_ARGS__>>(bench, name + TestName, FlopsPerElement, Config, Input);
+#endif  // JST_BENCHMARK_RUN_FLOPS
+
+// Repeat a benchmark over the sweep batch counts and sizes. Only runs
+// with the `sweep` output. Cases are named with `JST_BENCHMARK_SWEEP_NAME`.
+#ifndef JST_BENCHMARK_SWEEP
+#define JST_BENCHMARK_SWEEP(Batch, Size) \
+    for (const auto& [Batch, Size] : Benchmark::SweepPoints())
+#endif  // JST_BENCHMARK_SWEEP
+
+#ifndef JST_BENCHMARK_SWEEP_NAME
+#define JST_BENCHMARK_SWEEP_NAME(Group, Batch, Size) \
+    Benchmark::SweepName(name, Group, Batch, Size)
+#endif  // JST_BENCHMARK_SWEEP_NAME
+
 //
 // Struct serialize/deserialize methods.
 //
@@ -1,13 +1,22 @@
 #ifndef JETSTREAM_MEMORY_BASE_BUFFER_HH
 #define JETSTREAM_MEMORY_BASE_BUFFER_HH
 
+#include <memory>
+#include <vector>
+#include <utility>
+
 #include "jetstream/memory/metadata.hh"
+#include "jetstream/memory/footprint.hh"
 #include "jetstream/backend/base.hh"
 
 namespace Jetstream {
 
 class TensorBufferBase {
  public:
+    ~TensorBufferBase() {
+        untrack_memory();
+    }
+
     constexpr bool allocated() const noexcept {
         return _allocated;
     }
@@ -49,6 +58,31 @@ class TensorBufferBase {
         _external_memory_device = device;
     }
 
+    // Accounts memory owned by this buffer to its storage. Everything tracked
+    // is released when the buffer is destroyed or `untrack_memory` is called.
+    void track_memory(const std::shared_ptr<TensorStorageMetadata>& storage,
+                      const Device& device,
+                      const U64& bytes) {
+        track_memory(storage.get(), device, bytes);
+    }
+
+    void track_memory(const TensorStorageMetadata* storage, const Device& device, const U64& bytes) {
+        _tracked_storage = storage;
+        _tracked_memory.push_back({device, bytes});
+        MemoryFootprint::Get().allocate(storage, device, bytes);
+    }
+
+    void untrack_memory() {
+        for (const auto& [device, bytes] : _tracked_memory) {
+            MemoryFootprint::Get().release(_tracked_storage, device, bytes);
+        }
+        _tracked_memory.clear();
+    }
+
+    const TensorStorageMetadata* tracked_storage() const noexcept {
+        return _tracked_storage;
+    }
+
  private:
     bool _allocated = false;
 
@@ -57,6 +91,9 @@ class TensorBufferBase {
     bool _host_native = false;
 
     Device _external_memory_device = Device::None;
+
+    const TensorStorageMetadata* _tracked_storage = nullptr;
+    std::vector<std::pair<Device, U64>> _tracked_memory;
 };
 
 template<Device D>
@@ -12,7 +12,8 @@ template<>
 class TensorBuffer<Device::CPU> : public TensorBufferBase {
  public:
     explicit TensorBuffer(std::shared_ptr<TensorStorageMetadata>& storage,
-                          const TensorPrototypeMetadata& prototype);
+                          const TensorPrototypeMetadata& prototype,
+                          const bool& zero_fill = true);
 
     explicit TensorBuffer(std::shared_ptr<TensorStorageMetadata>& storage,
                           const TensorPrototypeMetadata& prototype,
@@ -52,8 +53,25 @@ class TensorBuffer<Device::CPU> : public TensorBufferBase {
         return buffer;
     }
 
+    constexpr const U64& size_bytes() const noexcept {
+        return bufferSize;
+    }
+
+    constexpr bool aliased() const noexcept {
+        return _aliased;
+    }
+
+    // Point the buffer to memory owned elsewhere, like an arena shared by
+    // tensors with disjoint lifetimes, and release its own allocation. The
+    // contents aren't preserved. The memory has to outlive the buffer or
+    // the next call to `unalias`, which allocates dedicated memory again.
+    Result alias(void* ptr);
+    Result unalias();
+
  private:
     void* buffer = nullptr;
+    U64 bufferSize = 0;
+    bool _aliased = false;
 
 #ifdef JETSTREAM_BACKEND_VULKAN_AVAILABLE
     VkDeviceMemory vulkan_memory = VK_NULL_HANDLE;
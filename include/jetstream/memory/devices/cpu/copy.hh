@@ -4,20 +4,25 @@
 #include "jetstream/memory/devices/cpu/buffer.hh"
 #include "jetstream/memory/devices/cpu/copy.hh"
 #include "jetstream/memory/devices/cpu/tensor.hh"
+#include "jetstream/memory/devices/cpu/helpers.hh"
 
 namespace Jetstream::Memory {
 
 template<typename T>
 inline Result Copy(Tensor<Device::CPU, T>& dst, const Tensor<Device::CPU, T>& src) {
-    if ((dst.size() == src.size()) &&
-        (dst.shape() == src.shape()) &&
-        (dst.contiguous() && src.contiguous())) {
+    if (dst.shape() != src.shape()) {
+        JST_ERROR("[CPU:COPY] Can't copy tensors with different shapes.");
+        return Result::ERROR;
+    }
+
+    if (dst.contiguous() && src.contiguous()) {
         std::memcpy(dst.data() + dst.offset(), src.data() + src.offset(), dst.size_bytes());
         return Result::SUCCESS;
     }
 
-    JST_ERROR("[CPU:COPY] Copy not implemented for non-contiguous tensors.");
-    return Result::ERROR;
+    CPU::StridedCopy(dst.data() + dst.offset(), dst.stride(), src.data() + src.offset(), src.stride(), dst.shape());
+
+    return Result::SUCCESS;
 }
 
 }  // namespace Jetstream::Memory
@@ -1,8 +1,14 @@
 #ifndef JETSTREAM_MEMORY_CPU_HELPERS_HH
 #define JETSTREAM_MEMORY_CPU_HELPERS_HH
 
+#include <atomic>
+#include <thread>
+#include <vector>
+#include <cstring>
+
 #include "jetstream/types.hh"
 #include "jetstream/memory/types.hh"
+#include "jetstream/compute/worker_pool.hh"
 
 #if defined(__GNUC__) && !defined(__clang__)
 #pragma GCC optimize("unroll-loops")
@@ -10,6 +16,27 @@
 
 namespace Jetstream::Memory::CPU {
 
+// Minimum number of elements handed to each thread by the parallel iterator.
+inline constexpr U64 ParallelIteratorGrain = 1 << 16;
+
+// Check if every tensor is contiguous and has the same number of elements.
+// These can be walked with a single counter.
+template<class... Args>
+inline bool AllContiguous(const U64& size, const Args&... args) {
+    return ((args.contiguous() && args.size() == size) && ...);
+}
+
+// Apply the function over the elements [begin, end) of contiguous tensors. The
+// data pointers are hoisted out of the loop, so the compiler can vectorize it.
+template<class Function, class... Args>
+inline void ContiguousIterator(const Function& function, const U64& begin, const U64& end, Args&... args) {
+    [&](auto*... data) __attribute__((always_inline)) {
+        for (U64 i = begin; i < end; i++) {
+            function(data[i]...);
+        }
+    }((args.data() + args.offset())...);
+}
+
 template<class Function, class... Args>
 inline void AutomaticIterator(const Function& function, Args&... args) {
     const U64 size = std::max({args.size()...});
@@ -40,8 +67,6 @@ inline void AutomaticIterator(const Function& function, Args&... args) {
         }
     };
 
-    // TODO: If the strides and offsets are the same, iterate with a single counter.
-
     // Iterators 1D and Contiguous.
 
     const auto iterator_1d = [](const U64& i, 
@@ -96,17 +121,17 @@ inline void AutomaticIterator(const Function& function, Args&... args) {
         }
     };
 
-    // 1D
+    // Contiguous
 
-    if (rank == 1) {
-        loop(iterator_1d);
+    if (AllContiguous(size, args...)) {
+        ContiguousIterator(function, 0, size, args...);
         return;
     }
 
-    // Contiguous
+    // 1D
 
-    if ((args.contiguous() && ...)) {
-        loop(iterator_contiguous);
+    if (rank == 1) {
+        loop(iterator_1d);
         return;
     }
 
@@ -206,6 +231,161 @@ inline void AutomaticIterator(const Function& function, Args&... args) {
     JST_CHECK_THROW(Result::FATAL);
 }
 
+// Split [0, count) in up to `chunks` ranges and call the function with the
+// bounds of each one on the worker pool. Runs on the caller when the pool is
+// missing or not running. The function has to be safe to call from multiple threads.
+template<class Function>
+inline void ParallelRanges(WorkerPool* pool, const U64& count, U64 chunks, const Function& function) {
+    if (pool && pool->running()) {
+        chunks = std::min({chunks, count, pool->size() + 1});
+    } else {
+        chunks = 1;
+    }
+
+    if (chunks <= 1) {
+        function(U64(0), count);
+        return;
+    }
+
+    const U64 chunkSize = (count + chunks - 1) / chunks;
+    std::atomic<U64> remaining{0};
+
+    for (U64 begin = chunkSize; begin < count; begin += chunkSize) {
+        remaining.fetch_add(1, std::memory_order_relaxed);
+        pool->dispatch([&, begin]{
+            function(begin, std::min(count, begin + chunkSize));
+            remaining.fetch_sub(1, std::memory_order_release);
+        });
+    }
+
+    // The caller computes the first chunk and helps with the others while waiting.
+    // This also works from inside a worker of the same pool.
+
+    function(U64(0), std::min(count, chunkSize));
+
+    while (remaining.load(std::memory_order_acquire) > 0) {
+        if (!pool->runPending()) {
+            std::this_thread::yield();
+        }
+    }
+}
+
+// Same as AutomaticIterator, but large contiguous tensors are split in chunks
+// computed by the worker pool. The function has to be safe to call from
+// multiple threads and must not depend on the order of the elements.
+template<class Function, class... Args>
+inline void ParallelAutomaticIterator(WorkerPool* pool, const Function& function, Args&... args) {
+    const U64 size = std::max({args.size()...});
+
+    if (!pool || !pool->running() || size < 2 * ParallelIteratorGrain || !AllContiguous(size, args...)) {
+        AutomaticIterator(function, args...);
+        return;
+    }
+
+    ParallelRanges(pool, size, size / ParallelIteratorGrain, [&](const U64& begin, const U64& end) {
+        ContiguousIterator(function, begin, end, args...);
+    });
+}
+
+// Merge adjacent dimensions laid out as a single one in both views and drop
+// dimensions with a single element. Both views keep addressing the same elements.
+inline void CollapseDimensions(std::vector<U64>& shape, std::vector<U64>& dstStride, std::vector<U64>& srcStride) {
+    std::vector<U64> collapsedShape, collapsedDstStride, collapsedSrcStride;
+
+    for (U64 i = 0; i < shape.size(); i++) {
+        if (shape[i] == 1) {
+            continue;
+        }
+
+        if (!collapsedShape.empty() &&
+            collapsedDstStride.back() == dstStride[i] * shape[i] &&
+            collapsedSrcStride.back() == srcStride[i] * shape[i]) {
+            collapsedShape.back() *= shape[i];
+            collapsedDstStride.back() = dstStride[i];
+            collapsedSrcStride.back() = srcStride[i];
+            continue;
+        }
+
+        collapsedShape.push_back(shape[i]);
+        collapsedDstStride.push_back(dstStride[i]);
+        collapsedSrcStride.push_back(srcStride[i]);
+    }
+
+    if (collapsedShape.empty()) {
+        collapsedShape = {1};
+        collapsedDstStride = {1};
+        collapsedSrcStride = {1};
+    }
+
+    shape = std::move(collapsedShape);
+    dstStride = std::move(collapsedDstStride);
+    srcStride = std::move(collapsedSrcStride);
+}
+
+// Call the function with the element offsets of every row of two views. The
+// rows are formed by the dimensions starting at `dims`.
+template<class Function>
+inline void ForEachRow(const std::vector<U64>& shape,
+                       const U64& dims,
+                       const std::vector<U64>& dstStride,
+                       const std::vector<U64>& srcStride,
+                       const Function& function) {
+    U64 rows = 1;
+    for (U64 i = 0; i < dims; i++) {
+        rows *= shape[i];
+    }
+
+    std::vector<U64> coords(dims, 0);
+    U64 dstOffset = 0;
+    U64 srcOffset = 0;
+
+    for (U64 r = 0; r < rows; r++) {
+        function(dstOffset, srcOffset);
+
+        for (U64 j = dims; j-- > 0;) {
+            if (++coords[j] < shape[j]) [[likely]] {
+                dstOffset += dstStride[j];
+                srcOffset += srcStride[j];
+                break;
+            }
+
+            coords[j] = 0;
+            dstOffset -= dstStride[j] * (shape[j] - 1);
+            srcOffset -= srcStride[j] * (shape[j] - 1);
+        }
+    }
+}
+
+// Copy between two views with the same shape and arbitrary strides. Rows
+// contiguous in both views are copied with a single memcpy.
+template<typename T>
+inline void StridedCopy(T* dst,
+                        std::vector<U64> dstStride,
+                        const T* src,
+                        std::vector<U64> srcStride,
+                        std::vector<U64> shape) {
+    CollapseDimensions(shape, dstStride, srcStride);
+
+    const U64 inner = shape.size() - 1;
+    const U64 count = shape[inner];
+    const U64 dstStep = dstStride[inner];
+    const U64 srcStep = srcStride[inner];
+
+    ForEachRow(shape, inner, dstStride, srcStride, [&](const U64& dstOffset, const U64& srcOffset) {
+        T* dstRow = dst + dstOffset;
+        const T* srcRow = src + srcOffset;
+
+        if (dstStep == 1 && srcStep == 1) {
+            std::memcpy(dstRow, srcRow, count * sizeof(T));
+            return;
+        }
+
+        for (U64 i = 0; i < count; i++) {
+            dstRow[i * dstStep] = srcRow[i * srcStep];
+        }
+    });
+}
+
 }  // namespace Jetstream::Memory::CPU
 
 #endif
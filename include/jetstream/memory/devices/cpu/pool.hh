@@ -0,0 +1,112 @@
+#ifndef JETSTREAM_MEMORY_CPU_POOL_HH
+#define JETSTREAM_MEMORY_CPU_POOL_HH
+
+#include <map>
+#include <mutex>
+#include <vector>
+#include <unordered_map>
+#include <unordered_set>
+
+#include "jetstream/types.hh"
+
+namespace Jetstream {
+
+// Placement hints for large CPU allocations. Only applied on Linux, other
+// platforms allocate as usual. Pinning applies to every size and platform
+// with CUDA. Set globally with `Instance::Config` or per block with
+// `Instance::setBlockMemoryHints`.
+struct CPUMemoryHints {
+    // Back the memory with transparent huge pages.
+    bool hugePages = false;
+    // Bind the memory to this NUMA node. Negative for the default policy.
+    I32 numaNode = -1;
+    // Spread the memory across all NUMA nodes. Overrides `numaNode`.
+    bool numaInterleave = false;
+    // Register the memory with CUDA, so copies between it and the device are asynchronous.
+    bool pinned = false;
+    // Smaller allocations ignore the placement hints.
+    U64 threshold = 2*1024*1024;
+
+    constexpr bool enabled() const {
+        return hugePages || numaNode >= 0 || numaInterleave;
+    }
+
+    constexpr U64 key() const {
+        return (hugePages ? 1 : 0) | (numaInterleave ? 2 : 0) | (static_cast<U64>(numaNode + 1) << 3);
+    }
+
+    // Key bit of blocks registered with CUDA. Not part of the placement key.
+    static constexpr U64 PinnedKey = 4;
+};
+
+// Process-wide cache of page-aligned CPU allocations. Requests are rounded
+// up to a size class and freed memory is kept around for the next request
+// of the same class, so block reloads and graph rebuilds reuse the pages of
+// the previous graph instead of going back to the system allocator. At most
+// `capacity()` bytes are kept. Anything freed past that is released.
+class CPUMemoryPool {
+ public:
+    static CPUMemoryPool& Get();
+
+    // Allocates at least `size` bytes. The class size actually allocated is
+    // written to `classSize` and has to be passed back to `free`. The memory
+    // isn't zeroed.
+    void* allocate(const U64& size, U64& classSize);
+    void free(void* ptr, const U64& classSize);
+
+    // Registers a block returned by `allocate` with CUDA. The registration
+    // is kept while the block is cached, so reloads don't pay for it again.
+    // Returns false if the block can't be pinned.
+    bool pin(void* ptr, const U64& classSize);
+    bool pinned(void* ptr);
+
+    void setCapacity(const U64& capacity);
+    void setHints(const CPUMemoryHints& hints);
+    void trim();
+
+    // Overrides the global hints for allocations made by the calling
+    // thread while the object is alive. Used around block creation.
+    class ScopedHints {
+     public:
+        explicit ScopedHints(const CPUMemoryHints& hints);
+        ~ScopedHints();
+
+        ScopedHints(const ScopedHints&) = delete;
+        ScopedHints& operator=(const ScopedHints&) = delete;
+
+     private:
+        const CPUMemoryHints* previous;
+        CPUMemoryHints hints;
+    };
+
+    constexpr const U64& capacity() const {
+        return _capacity;
+    }
+
+    U64 cached();
+
+    static U64 SizeClass(const U64& size);
+
+ private:
+    CPUMemoryPool() = default;
+
+    std::mutex mutex;
+    // Free blocks by class size and hints key.
+    std::map<std::pair<U64, U64>, std::vector<void*>> freeLists;
+    // Hints key of every live or cached block allocated with hints.
+    std::unordered_map<void*, U64> hintedBlocks;
+    // Live or cached blocks registered with CUDA.
+    std::unordered_set<void*> pinnedBlocks;
+    CPUMemoryHints globalHints;
+    U64 cachedBytes = 0;
+    U64 _capacity = 256*1024*1024;
+
+    CPUMemoryHints currentHints();
+    void release(const U64& target);
+    void releaseBlock(void* ptr, const U64& classSize, const U64& key);
+    bool pinBlock(void* ptr, const U64& classSize);
+};
+
+}  // namespace Jetstream
+
+#endif
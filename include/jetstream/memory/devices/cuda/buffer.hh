@@ -64,9 +64,34 @@ class TensorBuffer<Device::CUDA> : public TensorBufferBase {
         return alloc_handle;
     } 
 
+    // Host accessible buffers are either managed memory or device memory
+    // with a pinned host mirror. Mirrors are kept in sync explicitly with
+    // `upload` and `download` instead of migrating pages on access.
+    static void SetMirroredMemory(const bool& enabled);
+
+    constexpr bool mirrored() const noexcept {
+        return host_buffer != nullptr;
+    }
+
+    constexpr void* host_data() noexcept {
+        return host_buffer;
+    }
+
+    constexpr const U64& mirror_size_bytes() const noexcept {
+        return size_bytes;
+    }
+
+    // Copy the host mirror to the device.
+    Result upload(const cudaStream_t& stream);
+
+    // Copy the device memory to the host mirror.
+    Result download(const cudaStream_t& stream);
+
  private:
     void* buffer;
+    void* host_buffer = nullptr;
     U64 size_bytes;
+    bool host_registered = false;
 
     CUdeviceptr device_ptr;
     CUmemGenericAllocationHandle alloc_handle;
@@ -4,109 +4,232 @@
 #include "jetstream/memory/devices/cuda/buffer.hh"
 #include "jetstream/memory/devices/cuda/copy.hh"
 #include "jetstream/memory/devices/cuda/tensor.hh"
+#include "jetstream/memory/devices/cpu/helpers.hh"
 
 #include "jetstream/backend/devices/cuda/helpers.hh"
 
-namespace Jetstream::Memory {
+namespace Jetstream::Memory::CUDA {
+
+// Pinned host buffer of the calling thread used to stage strided host copies.
+// Acquiring waits for the last copy that used the buffer to finish.
+JETSTREAM_API Result AcquireStagingBuffer(const U64& size, void** buffer);
+
+// Mark the staging buffer as used by the work enqueued on the stream.
+JETSTREAM_API Result ReleaseStagingBuffer(const cudaStream_t& stream);
+
+inline const char* CopyKindName(const cudaMemcpyKind& kind) {
+    switch (kind) {
+        case cudaMemcpyHostToHost:
+            return "host to host";
+        case cudaMemcpyHostToDevice:
+            return "host to device";
+        case cudaMemcpyDeviceToHost:
+            return "device to host";
+        case cudaMemcpyDeviceToDevice:
+            return "device to device";
+        default:
+            return "unknown";
+    }
+}
 
+// Copy between two views with the same shape and arbitrary strides. Views are
+// collapsed to the least number of dimensions and every plane of the innermost
+// two is moved with a single pitched copy. The default stream copies synchronously.
 template<typename T>
-inline Result Copy(Tensor<Device::CUDA, T>& dst, const Tensor<Device::CUDA, T>& src, const cudaStream_t& stream = 0) {
-    if ((dst.size() == src.size()) &&
-        (dst.shape() == src.shape()) &&
-        (dst.contiguous() && src.contiguous())) {
+inline Result StridedCopy(T* dst,
+                          std::vector<U64> dstStride,
+                          const T* src,
+                          std::vector<U64> srcStride,
+                          std::vector<U64> shape,
+                          const cudaMemcpyKind& kind,
+                          const cudaStream_t& stream) {
+    CPU::CollapseDimensions(shape, dstStride, srcStride);
 
-        if (dst.host_native() && src.host_native()) {
-            if (stream != 0) {
-                JST_CUDA_CHECK(cudaMemcpyAsync(dst.data() + dst.offset(), src.data() + src.offset(), dst.size_bytes(), cudaMemcpyHostToHost, stream), [&]{
-                    JST_ERROR("[CUDA:COPY] Failed to copy host to host: {}", err);
-                });
-            } else {
-                JST_CUDA_CHECK(cudaMemcpy(dst.data() + dst.offset(), src.data() + src.offset(), dst.size_bytes(), cudaMemcpyHostToHost), [&]{
-                    JST_ERROR("[CUDA:COPY] Failed to copy host to host: {}", err);
-                });
-            }
-            return Result::SUCCESS;
-        }
+    const U64 rank = shape.size();
+    const bool unitInner = dstStride[rank - 1] == 1 && srcStride[rank - 1] == 1;
 
-        if (dst.device_native() && src.device_native()) {
-            if (stream != 0) {
-                JST_CUDA_CHECK(cudaMemcpyAsync(dst.data() + dst.offset(), src.data() + src.offset(), dst.size_bytes(), cudaMemcpyDeviceToDevice, stream), [&]{
-                    JST_ERROR("[CUDA:COPY] Failed to copy device to device: {}", err);
-                });
-            } else {
-                JST_CUDA_CHECK(cudaMemcpy(dst.data() + dst.offset(), src.data() + src.offset(), dst.size_bytes(), cudaMemcpyDeviceToDevice), [&]{
-                    JST_ERROR("[CUDA:COPY] Failed to copy device to device: {}", err);
-                });
-            }
-            return Result::SUCCESS;
+    // Contiguous views.
+
+    if (rank == 1 && unitInner) {
+        if (stream != 0) {
+            JST_CUDA_CHECK(cudaMemcpyAsync(dst, src, shape[0] * sizeof(T), kind, stream), [&]{
+                JST_ERROR("[CUDA:COPY] Failed to copy {}: {}", CopyKindName(kind), err);
+            });
+        } else {
+            JST_CUDA_CHECK(cudaMemcpy(dst, src, shape[0] * sizeof(T), kind), [&]{
+                JST_ERROR("[CUDA:COPY] Failed to copy {}: {}", CopyKindName(kind), err);
+            });
         }
+        return Result::SUCCESS;
+    }
 
-        if (dst.host_native() && src.device_native()) {
-            if (stream != 0) {
-                JST_CUDA_CHECK(cudaMemcpyAsync(dst.data() + dst.offset(), src.data() + src.offset(), dst.size_bytes(), cudaMemcpyDeviceToHost, stream), [&]{
-                    JST_ERROR("[CUDA:COPY] Failed to copy device to host: {}", err);
-                });
-            } else {
-                JST_CUDA_CHECK(cudaMemcpy(dst.data() + dst.offset(), src.data() + src.offset(), dst.size_bytes(), cudaMemcpyDeviceToHost), [&]{
-                    JST_ERROR("[CUDA:COPY] Failed to copy device to host: {}", err);
-                });
-            }
-            return Result::SUCCESS;
+    // Planes of contiguous rows or rows of single elements.
+
+    const U64 dims = (unitInner) ? rank - 2 : rank - 1;
+    const U64 width = (unitInner) ? shape[rank - 1] * sizeof(T) : sizeof(T);
+    const U64 height = (unitInner) ? shape[rank - 2] : shape[rank - 1];
+    const U64 dstPitch = dstStride[dims] * sizeof(T);
+    const U64 srcPitch = srcStride[dims] * sizeof(T);
+
+    if (dstPitch < width || srcPitch < width) {
+        JST_ERROR("[CUDA:COPY] Can't copy overlapping or broadcasted views.");
+        return Result::ERROR;
+    }
+
+    Result result = Result::SUCCESS;
+
+    CPU::ForEachRow(shape, dims, dstStride, srcStride, [&](const U64& dstOffset, const U64& srcOffset) {
+        if (result != Result::SUCCESS) {
+            return;
         }
 
-        if (dst.device_native() && src.host_native()) {
+        result = [&]{
             if (stream != 0) {
-                JST_CUDA_CHECK(cudaMemcpyAsync(dst.data() + dst.offset(), src.data() + src.offset(), dst.size_bytes(), cudaMemcpyHostToDevice, stream), [&]{
-                    JST_ERROR("[CUDA:COPY] Failed to copy host to device: {}", err);
+                JST_CUDA_CHECK(cudaMemcpy2DAsync(dst + dstOffset, dstPitch,
+                                                 src + srcOffset, srcPitch,
+                                                 width, height, kind, stream), [&]{
+                    JST_ERROR("[CUDA:COPY] Failed to copy {}: {}", CopyKindName(kind), err);
                 });
             } else {
-                JST_CUDA_CHECK(cudaMemcpy(dst.data() + dst.offset(), src.data() + src.offset(), dst.size_bytes(), cudaMemcpyHostToDevice), [&]{
-                    JST_ERROR("[CUDA:COPY] Failed to copy host to device: {}", err);
+                JST_CUDA_CHECK(cudaMemcpy2D(dst + dstOffset, dstPitch,
+                                            src + srcOffset, srcPitch,
+                                            width, height, kind), [&]{
+                    JST_ERROR("[CUDA:COPY] Failed to copy {}: {}", CopyKindName(kind), err);
                 });
             }
             return Result::SUCCESS;
-        }
+        }();
+    });
+
+    return result;
+}
+
+// Copy between a strided host view and a device view. Host views without
+// contiguous rows are packed in a pinned staging buffer on the CPU, so the
+// transfer happens as a single contiguous copy. Unpacking a device to host
+// copy requires the stream to be synchronized.
+template<typename T>
+inline Result StagedCopy(T* dst,
+                         const std::vector<U64>& dstStride,
+                         const T* src,
+                         const std::vector<U64>& srcStride,
+                         const std::vector<U64>& shape,
+                         const cudaMemcpyKind& kind,
+                         const cudaStream_t& stream) {
+    const bool toDevice = kind == cudaMemcpyHostToDevice;
+    const bool toHost = kind == cudaMemcpyDeviceToHost;
+    const auto& hostStride = (toDevice) ? srcStride : dstStride;
+
+    if ((!toDevice && !toHost) || hostStride.empty() || hostStride.back() == 1) {
+        return StridedCopy(dst, dstStride, src, srcStride, shape, kind, stream);
     }
 
-    JST_ERROR("[CUDA:COPY] Copy not implemented for non-contiguous tensors.");
-    return Result::ERROR;
+    U64 size = 1;
+    for (const auto& dim : shape) {
+        size *= dim;
+    }
+
+    std::vector<U64> packedStride(shape.size(), 1);
+    for (U64 i = shape.size() - 1; i > 0; i--) {
+        packedStride[i - 1] = packedStride[i] * shape[i];
+    }
+
+    void* buffer = nullptr;
+    JST_CHECK(AcquireStagingBuffer(size * sizeof(T), &buffer));
+    T* staging = static_cast<T*>(buffer);
+
+    if (toDevice) {
+        CPU::StridedCopy(staging, packedStride, src, srcStride, shape);
+        JST_CHECK(StridedCopy(dst, dstStride, staging, packedStride, shape, kind, stream));
+        JST_CHECK(ReleaseStagingBuffer(stream));
+        return Result::SUCCESS;
+    }
+
+    JST_CHECK(StridedCopy(staging, packedStride, src, srcStride, shape, kind, stream));
+    JST_CUDA_CHECK(cudaStreamSynchronize(stream), [&]{
+        JST_ERROR("[CUDA:COPY] Failed to synchronize staged copy: {}", err);
+    });
+    CPU::StridedCopy(dst, dstStride, staging, packedStride, shape);
+    JST_CHECK(ReleaseStagingBuffer(stream));
+
+    return Result::SUCCESS;
+}
+
+}  // namespace Jetstream::Memory::CUDA
+
+namespace Jetstream::Memory {
+
+template<typename T>
+inline Result Copy(Tensor<Device::CUDA, T>& dst, const Tensor<Device::CUDA, T>& src, const cudaStream_t& stream = 0) {
+    if (dst.shape() != src.shape()) {
+        JST_ERROR("[CUDA:COPY] Can't copy tensors with different shapes.");
+        return Result::ERROR;
+    }
+
+    cudaMemcpyKind kind;
+
+    if (dst.host_native() && src.host_native()) {
+        kind = cudaMemcpyHostToHost;
+    } else if (dst.device_native() && src.device_native()) {
+        kind = cudaMemcpyDeviceToDevice;
+    } else if (dst.host_native() && src.device_native()) {
+        kind = cudaMemcpyDeviceToHost;
+    } else if (dst.device_native() && src.host_native()) {
+        kind = cudaMemcpyHostToDevice;
+    } else {
+        JST_ERROR("[CUDA:COPY] Tensors are not accessible by the host or the device.");
+        return Result::ERROR;
+    }
+
+    return CUDA::StagedCopy(dst.data() + dst.offset(), dst.stride(),
+                            src.data() + src.offset(), src.stride(),
+                            dst.shape(), kind, stream);
 }
 
 template<typename T>
 inline Result Copy(Tensor<Device::CPU, T>& dst, const Tensor<Device::CUDA, T>& src, const cudaStream_t& stream = 0) {
-    if ((dst.size() == src.size()) &&
-        (dst.shape() == src.shape()) &&
-        (dst.contiguous() && src.contiguous())) {
-        
-        if (src.host_native()) {
-            if (stream != 0) {
-                JST_CUDA_CHECK(cudaMemcpyAsync(dst.data() + dst.offset(), src.data() + src.offset(), dst.size_bytes(), cudaMemcpyHostToHost, stream), [&]{
-                    JST_ERROR("[CUDA:COPY] Failed to copy host to host: {}", err);
-                });
-            } else {
-                JST_CUDA_CHECK(cudaMemcpy(dst.data() + dst.offset(), src.data() + src.offset(), dst.size_bytes(), cudaMemcpyHostToHost), [&]{
-                    JST_ERROR("[CUDA:COPY] Failed to copy host to host: {}", err);
-                });
-            }
-            return Result::SUCCESS;
-        }
+    if (dst.shape() != src.shape()) {
+        JST_ERROR("[CUDA:COPY] Can't copy tensors with different shapes.");
+        return Result::ERROR;
+    }
 
-        if (src.device_native()) {
-            if (stream != 0) {
-                JST_CUDA_CHECK(cudaMemcpyAsync(dst.data() + dst.offset(), src.data() + src.offset(), dst.size_bytes(), cudaMemcpyDeviceToHost, stream), [&]{
-                    JST_ERROR("[CUDA:COPY] Failed to copy device to host: {}", err);
-                });
-            } else {
-                JST_CUDA_CHECK(cudaMemcpy(dst.data() + dst.offset(), src.data() + src.offset(), dst.size_bytes(), cudaMemcpyDeviceToHost), [&]{
-                    JST_ERROR("[CUDA:COPY] Failed to copy device to host: {}", err);
-                });
-            }
-            return Result::SUCCESS;
-        }
+    cudaMemcpyKind kind;
+
+    if (src.host_native()) {
+        kind = cudaMemcpyHostToHost;
+    } else if (src.device_native()) {
+        kind = cudaMemcpyDeviceToHost;
+    } else {
+        JST_ERROR("[CUDA:COPY] Source tensor is not accessible by the host or the device.");
+        return Result::ERROR;
+    }
+
+    return CUDA::StagedCopy(dst.data() + dst.offset(), dst.stride(),
+                            src.data() + src.offset(), src.stride(),
+                            dst.shape(), kind, stream);
+}
+
+template<typename T>
+inline Result Copy(Tensor<Device::CUDA, T>& dst, const Tensor<Device::CPU, T>& src, const cudaStream_t& stream = 0) {
+    if (dst.shape() != src.shape()) {
+        JST_ERROR("[CUDA:COPY] Can't copy tensors with different shapes.");
+        return Result::ERROR;
+    }
+
+    cudaMemcpyKind kind;
+
+    if (dst.host_native()) {
+        kind = cudaMemcpyHostToHost;
+    } else if (dst.device_native()) {
+        kind = cudaMemcpyHostToDevice;
+    } else {
+        JST_ERROR("[CUDA:COPY] Destination tensor is not accessible by the host or the device.");
+        return Result::ERROR;
     }
 
-    JST_ERROR("[CUDA:COPY] Copy not implemented for non-contiguous tensors.");
-    return Result::ERROR;
+    return CUDA::StagedCopy(dst.data() + dst.offset(), dst.stride(),
+                            src.data() + src.offset(), src.stride(),
+                            dst.shape(), kind, stream);
 }
 
 }  // namespace Jetstream::Memory
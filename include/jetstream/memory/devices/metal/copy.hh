@@ -4,17 +4,21 @@
 #include "jetstream/memory/devices/metal/buffer.hh"
 #include "jetstream/memory/devices/metal/copy.hh"
 #include "jetstream/memory/devices/metal/tensor.hh"
+#include "jetstream/memory/devices/cpu/helpers.hh"
 
 namespace Jetstream::Memory {
 
 template<typename T>
 inline Result Copy(Tensor<Device::Metal, T>& dst, Tensor<Device::Metal, T>& src) {
-    if ((dst.size() == src.size()) &&
-        (dst.shape() == src.shape()) &&
-        (dst.contiguous() && src.contiguous())) {
-        T* dst_ptr = static_cast<T*>(dst.data()->contents());
-        const T* src_ptr = static_cast<T*>(src.data()->contents());
+    if (dst.shape() != src.shape()) {
+        JST_ERROR("[METAL:COPY] Can't copy tensors with different shapes.");
+        return Result::ERROR;
+    }
+
+    T* dst_ptr = static_cast<T*>(dst.data()->contents());
+    const T* src_ptr = static_cast<T*>(src.data()->contents());
 
+    if (dst.contiguous() && src.contiguous()) {
         std::memcpy(dst_ptr + dst.offset(), src_ptr + src.offset(), dst.size_bytes());
 
         if (!dst.device_native() && !src.device_native()) {
@@ -23,8 +27,15 @@ inline Result Copy(Tensor<Device::Metal, T>& dst, Tensor<Device::Metal, T>& src)
         return Result::SUCCESS;
     }
 
-    JST_ERROR("[METAL:COPY] Copy not implemented for non-contiguous tensors.");
-    return Result::ERROR;
+    // Buffers are shared with the host, so strided copies run on the CPU.
+
+    CPU::StridedCopy(dst_ptr + dst.offset(), dst.stride(), src_ptr + src.offset(), src.stride(), dst.shape());
+
+    if (!dst.device_native() && !src.device_native()) {
+        dst.data()->didModifyRange(NS::Range(0, dst.data()->length()));
+    }
+
+    return Result::SUCCESS;
 }
 
 template<typename T>
@@ -14,7 +14,8 @@ class TensorBuffer<Device::Vulkan> : public TensorBufferBase {
                           const TensorPrototypeMetadata& prototype,
                           const bool& host_accessible = false,
                           const VkBufferUsageFlags& usage = VK_BUFFER_USAGE_TRANSFER_SRC_BIT |
-                                                            VK_BUFFER_USAGE_TRANSFER_DST_BIT);
+                                                            VK_BUFFER_USAGE_TRANSFER_DST_BIT |
+                                                            VK_BUFFER_USAGE_STORAGE_BUFFER_BIT);
 
 #ifdef JETSTREAM_BACKEND_CPU_AVAILABLE
     explicit TensorBuffer(std::shared_ptr<TensorStorageMetadata>& storage,
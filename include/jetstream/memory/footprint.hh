@@ -0,0 +1,82 @@
+#ifndef JETSTREAM_MEMORY_FOOTPRINT_HH
+#define JETSTREAM_MEMORY_FOOTPRINT_HH
+
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include "jetstream/types.hh"
+
+namespace Jetstream {
+
+struct TensorStorageMetadata;
+
+// Process-wide accounting of the memory owned by tensor buffers. Buffers
+// report what they allocate on each device against their storage. The
+// storage counts towards the block being created when it was allocated, or
+// the block of the first locale given to it. Memory allocated outside both
+// is unattributed (empty block name) until a locale is given.
+class MemoryFootprint {
+ public:
+    struct Usage {
+        U64 current = 0;
+        U64 peak = 0;
+    };
+
+    typedef std::unordered_map<Device, Usage> DeviceUsage;
+    typedef std::unordered_map<std::string, DeviceUsage> BlockUsage;
+
+    static MemoryFootprint& Get();
+
+    void allocate(const TensorStorageMetadata* storage, const Device& device, const U64& bytes);
+    void release(const TensorStorageMetadata* storage, const Device& device, const U64& bytes);
+    void attribute(const TensorStorageMetadata* storage, const std::string& block);
+
+    // Totals per device.
+    DeviceUsage devices() const;
+
+    // Totals per block and device. Blocks stay listed after their memory is
+    // released, so a block that was removed and still holds memory stands out.
+    BlockUsage blocks() const;
+    DeviceUsage block(const std::string& block) const;
+
+    // Incremented on every change. Cheap way for displays to skip redraws.
+    U64 version() const;
+
+    // Sets the peaks to the current usage.
+    void resetPeaks();
+
+    // Attributes allocations made by the calling thread while the object
+    // is alive to a block. Used around block creation.
+    class ScopedBlock {
+     public:
+        explicit ScopedBlock(const std::string& block);
+        ~ScopedBlock();
+
+        ScopedBlock(const ScopedBlock&) = delete;
+        ScopedBlock& operator=(const ScopedBlock&) = delete;
+
+     private:
+        const std::string* previous;
+        std::string block;
+    };
+
+ private:
+    struct Entry {
+        std::string block;
+        std::unordered_map<Device, U64> bytes;
+    };
+
+    mutable std::mutex mutex;
+    std::unordered_map<const TensorStorageMetadata*, Entry> entries;
+    BlockUsage blockUsage;
+    DeviceUsage deviceUsage;
+    U64 _version = 0;
+
+    static void Add(Usage& usage, const U64& bytes);
+    static void Subtract(Usage& usage, const U64& bytes);
+};
+
+}  // namespace Jetstream
+
+#endif
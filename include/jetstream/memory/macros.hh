@@ -32,6 +32,10 @@
 #define JST_MIN(a,b) (((a)<(b))?(a):(b))
 #endif
 
+#ifndef JST_KHZ
+#define JST_KHZ (1000)
+#endif
+
 #ifndef JST_MHZ
 #define JST_MHZ (1000*1000)
 #endif
@@ -30,6 +30,8 @@ struct TensorPrototypeMetadata {
 };
 
 struct TensorStorageMetadata {
+    // Block of the first tensor given a locale. Used for memory accounting.
+    Locale locale;
     Device root_device = Device::None;
     std::unordered_set<Device> compatible_devices;
     std::unordered_map<Device, std::any> clones;
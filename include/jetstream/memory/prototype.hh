@@ -89,6 +89,8 @@ class TensorPrototype {
 
     Result permutation(const std::vector<U64>& permutation);
 
+    // Views of non-contiguous tensors are reshaped without a copy when the
+    // merged or split dimensions are contiguous among themselves.
     Result reshape(const std::vector<U64>& shape);
 
     Result broadcast_to(const std::vector<U64>& shape);
@@ -100,6 +102,12 @@ class TensorPrototype {
 
     void initialize(const std::vector<U64>& shape, const U64& element_size);
     void update_cache();
+
+    static bool IsContiguous(const std::vector<U64>& shape, const std::vector<U64>& stride);
+    static bool ViewStride(const std::vector<U64>& shape,
+                           const std::vector<U64>& stride,
+                           const std::vector<U64>& new_shape,
+                           std::vector<U64>& new_stride);
 };
 
 }  // namespace Jetstream
@@ -10,6 +10,7 @@
 
 #include "jetstream/types.hh"
 #include "jetstream/memory/prototype.hh"
+#include "jetstream/memory/footprint.hh"
 #include "jetstream/memory/devices/base/buffer.hh"
 
 namespace Jetstream {
@@ -20,25 +21,34 @@ class TensorStorage : public TensorPrototype {
     TensorStorage(const TensorStorage& other) {
         storage = other.storage;
         prototype = other.prototype;
+        attribute_storage();
     }
 
     TensorStorage(TensorStorage&& other) noexcept {
         storage = std::move(other.storage);
         prototype = std::move(other.prototype);
+        attribute_storage();
     }
 
     TensorStorage& operator=(const TensorStorage& other) {
         storage = other.storage;
         prototype = other.prototype;
+        attribute_storage();
         return *this;
     }
 
     TensorStorage& operator=(TensorStorage&& other) noexcept {
         storage = std::move(other.storage);
         prototype = std::move(other.prototype);
+        attribute_storage();
         return *this;
     }
 
+    void set_locale(const Locale& locale) noexcept {
+        TensorPrototype::set_locale(locale);
+        attribute_storage();
+    }
+
     const Device& root_device() const noexcept {
         return storage->root_device;
     }
@@ -51,6 +61,10 @@ class TensorStorage : public TensorPrototype {
         return storage.use_count();
     }
 
+    const std::shared_ptr<TensorStorageMetadata>& storage_metadata() const noexcept {
+        return storage;
+    }
+
     const TensorStorageMetadata::AttributeMap& attributes() const noexcept {
         return storage->attributes;
     }
@@ -129,12 +143,23 @@ class TensorStorage : public TensorPrototype {
 
         storage = other.storage;
         prototype = other.prototype;
+        attribute_storage();
 
         // Clone buffer.
         return clone_buffer<TargetDevice, RootDevice>();
     }
 
  private:
+    // The first locale given to a storage owns its memory.
+    void attribute_storage() noexcept {
+        if (!storage || prototype.locale.empty() || !storage->locale.empty()) {
+            return;
+        }
+
+        storage->locale = prototype.locale.block();
+        MemoryFootprint::Get().attribute(storage.get(), storage->locale.blockId);
+    }
+
     template<Device D>
     std::shared_ptr<TensorBuffer<D>> get_buffer() {
         return std::any_cast<std::shared_ptr<TensorBuffer<D>>>(storage->clones.at(D));
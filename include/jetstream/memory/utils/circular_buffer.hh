@@ -2,10 +2,15 @@
 #define JETSTREAM_MEMORY_UTILS_CIRCULAR_BUFFER_H
 
 #include <mutex>
+#include <array>
+#include <deque>
+#include <vector>
+#include <atomic>
 #include <memory>
 #include <condition_variable>
 #include <chrono>
 #include <complex>
+#include <functional>
 
 #include "jetstream/types.hh"
 
@@ -18,10 +23,69 @@ namespace Jetstream::Memory {
  * The CircularBuffer class provides a thread-safe circular buffer that can be used to store elements of type T.
  * It supports operations like getting elements, putting elements, resetting the buffer, and resizing the buffer capacity.
  * It also provides information about the buffer's capacity, occupancy, throughput, and overflows.
+ *
+ * Where the platform allows it, the storage is mapped twice back-to-back in virtual memory. Any window
+ * of up to `capacity` elements starting at any offset is then contiguous and transfers never split in two.
+ *
+ * In the lock-free mode, `put` and `get` never take a lock. Only one producer thread and one consumer
+ * thread are supported.
+ *
+ * A `put` that doesn't fit is handled by the overflow policy. Every dropped element is counted and each
+ * discontinuity is recorded as a gap, so the consumer knows exactly where samples are missing.
+ *
+ * The statistics are kept in atomics updated by the producer and the consumer, `getStatistics` reads
+ * them from any thread without a lock.
  */
 template <class T>
 class CircularBuffer {
 public:
+    /**
+     * @brief Synchronization mode of the buffer.
+     */
+    enum class Mode : U8 {
+        Locked,     ///< Any number of producers and consumers. Every operation takes a lock.
+        LockFree,   ///< Single producer and single consumer. Operations don't take a lock.
+    };
+
+    /**
+     * @brief What a `put` does when the elements don't fit.
+     */
+    enum class OverflowPolicy : U8 {
+        DropOldest, ///< Discard just enough buffered elements. Locked mode only, the lock-free mode drops the newest.
+        DropNewest, ///< Discard the incoming elements.
+        Block,      ///< Wait for the consumer to free space. Drops the newest after a 5 seconds timeout.
+    };
+
+    /**
+     * @brief A discontinuity in the stream of elements.
+     */
+    struct Gap {
+        U64 position;                                    ///< Read position of the first element after the gap.
+        U64 size;                                        ///< Number of elements dropped.
+        std::chrono::steady_clock::time_point timestamp; ///< When the elements were dropped.
+    };
+
+    /**
+     * @brief Number of buckets of the occupancy histogram, each a tenth of the capacity.
+     */
+    static constexpr U64 OccupancyBuckets = 10;
+
+    /**
+     * @brief Counters of the buffer since the last reset.
+     */
+    struct Statistics {
+        U64 capacity = 0;
+        U64 occupancy = 0;
+        U64 overflows = 0;
+        U64 droppedElements = 0;
+        F64 producerRate = 0.0;                                 ///< Elements put per second.
+        F64 consumerRate = 0.0;                                 ///< Elements read per second.
+        F64 lastLatency = 0.0;                                  ///< Seconds the oldest elements of the last read waited.
+        F64 maxLatency = 0.0;                                   ///< Longest wait between a put and the read of its elements.
+        std::array<U64, OccupancyBuckets> occupancyHistogram{}; ///< Puts by occupancy after the put.
+        U64 occupancySum = 0;                                   ///< Sum of the occupancies sampled by the histogram.
+    };
+
     /**
      * @brief Default constructor.
      */
@@ -30,8 +94,9 @@ public:
     /**
      * @brief Constructor that initializes the buffer with a given capacity.
      * @param capacity The initial capacity of the buffer. Element number. Not byte size.
+     * @param mode The synchronization mode of the buffer.
      */
-    CircularBuffer(const U64& capacity);
+    CircularBuffer(const U64& capacity, const Mode& mode = Mode::Locked);
 
     /**
      * @brief Destructor.
@@ -70,19 +135,57 @@ public:
      */
     Result put(const T* data, const U64& size);
 
+    /**
+     * @brief Reserve a contiguous window for the producer to write into.
+     * @note Only available in the lock-free mode. The window is published by `commit`.
+     * @param size The number of elements to reserve.
+     * 
+     * @return Pointer to the window, or nullptr if there isn't enough contiguous free space.
+     */
+    T* reserve(const U64& size);
+
+    /**
+     * @brief Publish elements written into the window returned by `reserve`.
+     * @param size The number of elements written. Not larger than the reserved size.
+     * 
+     * @return Result indicating the success or failure of the operation.
+     */
+    Result commit(const U64& size);
+
+    /**
+     * @brief Get a contiguous window of buffered elements without copying them.
+     * @note Only available in the lock-free mode. The window is released by `consume`.
+     * @param size The number of elements to peek.
+     * 
+     * @return Pointer to the window, or nullptr if there aren't enough contiguous buffered elements.
+     */
+    const T* peek(const U64& size);
+
+    /**
+     * @brief Release elements read from the window returned by `peek`.
+     * @param size The number of elements read. Not larger than the peeked size.
+     * 
+     * @return Result indicating the success or failure of the operation.
+     */
+    Result consume(const U64& size);
+
     /**
      * @brief Reset the buffer.
+     * @note In the lock-free mode, this should be used only while neither side is running.
      * @return Result indicating the success or failure of the operation.
      */
     Result reset();
 
     /**
      * @brief Resize the buffer capacity.
+     * @note In the lock-free mode, this should be used only while neither side is running.
+     * @note A mirrored buffer rounds the capacity up to a whole number of pages.
      * @param capacity The new capacity of the buffer.
+     * @param mode The synchronization mode of the buffer.
      * 
      * @return Result indicating the success or failure of the operation.
      */
-    Result resize(const U64& capacity);
+    Result resize(const U64& capacity, const Mode& mode = Mode::Locked);
 
     /**
      * @brief Wait until the buffer occupancy reaches a specified value.
@@ -93,6 +196,45 @@ public:
      */
     Result waitBufferOccupancy(const U64& occupancy);
 
+    /**
+     * @brief Set what a `put` does when the elements don't fit.
+     * @param policy The overflow policy.
+     */
+    void setOverflowPolicy(const OverflowPolicy& policy);
+
+    /**
+     * @brief Get the gaps recorded since the last call.
+     * @note Only the latest 64 gaps are kept. The dropped element count stays exact.
+     * 
+     * @return The gaps ordered by position.
+     */
+    std::vector<Gap> takeGaps();
+
+    /**
+     * @brief Get the read position of the buffer.
+     * 
+     * @return Number of elements read or discarded from the buffer since the last reset.
+     */
+    U64 getReadPosition() const {
+        return head.load(std::memory_order_acquire);
+    }
+
+    /**
+     * @brief Get the write position of the buffer.
+     *
+     * @return Number of elements written to the buffer since the last reset.
+     */
+    U64 getWritePosition() const {
+        return tail.load(std::memory_order_acquire);
+    }
+
+    /**
+     * @brief Set a function called every time new elements are put into the buffer.
+     * @note The callback runs on the producer thread and should return quickly.
+     * @param callback The function to be called.
+     */
+    void setPutCallback(const std::function<void()>& callback);
+
     /**
      * @brief Get the capacity of the buffer.
      * 
@@ -102,13 +244,35 @@ public:
         return capacity;
     }
 
+    /**
+     * @brief Get the synchronization mode of the buffer.
+     * 
+     * @return The synchronization mode of the buffer.
+     */
+    constexpr Mode getMode() const {
+        return mode;
+    }
+
+    /**
+     * @brief Check if the storage is mirrored in virtual memory.
+     * 
+     * @return True if any window of up to `capacity` elements is contiguous, false otherwise.
+     */
+    constexpr bool isMirrored() const {
+        return mirrored;
+    }
+
     /**
      * @brief Get the current occupancy of the buffer.
      * 
      * @return The current occupancy of the buffer.
      */
-    constexpr U64 getOccupancy() const {
-        return occupancy;
+    U64 getOccupancy() const {
+        // Head first, it can only move towards the tail. Sequentially consistent
+        // so a waiter can't miss the notification of the other side.
+        const U64 h = head.load();
+        const U64 t = tail.load();
+        return JST_MIN(t - h, capacity);
     }
 
     /**
@@ -116,8 +280,8 @@ public:
      * 
      * @return The current throughput of the buffer.
      */
-    constexpr F64 getThroughput() const {
-        return throughput;
+    F64 getThroughput() const {
+        return throughput.load(std::memory_order_relaxed);
     }
 
     /**
@@ -125,26 +289,105 @@ public:
      * 
      * @return The number of overflows.
      */
-    constexpr U64 getOverflows() const {
-        return overflows;
+    U64 getOverflows() const {
+        return overflows.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Get the number of elements dropped by overflows.
+     * 
+     * @return The number of dropped elements.
+     */
+    U64 getDroppedElements() const {
+        return droppedElements.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Get the statistics of the buffer.
+     * @note Safe to call from any thread. The counters are read one by one, not as a snapshot.
+     * 
+     * @return The statistics of the buffer.
+     */
+    Statistics getStatistics() const;
+
+    /**
+     * @brief Clear the occupancy histogram and the maximum latency without resetting the buffer.
+     */
+    void resetStatistics();
+
+    /**
+     * @brief Get the overflow policy of the buffer.
+     * 
+     * @return The overflow policy.
+     */
+    OverflowPolicy getOverflowPolicy() const {
+        return overflowPolicy.load(std::memory_order_relaxed);
     }
 
 private:
+    // Size of a cache line. Keeps the producer and consumer
+    // indices from invalidating each other's cache.
+    static constexpr U64 CacheLineSize = 64;
+
+    // Number of gaps kept until the consumer takes them.
+    static constexpr U64 MaxGaps = 64;
+
+    // Number of puts remembered to measure the latency of the reads.
+    static constexpr U64 MaxMarks = 64;
+
+    // Write position and time of a put. Guarded by a sequence number, odd while being written.
+    struct Mark {
+        std::atomic<U64> sequence{0};
+        U64 position = 0;
+        U64 time = 0;
+    };
+
     std::mutex io_mtx;
     std::mutex sync_mtx;
     std::condition_variable semaphore;
+    std::function<void()> putCallback;
 
-    std::unique_ptr<T[]> buffer{};
+    // Only taken on overflows.
+    std::mutex gap_mtx;
+    std::deque<Gap> gaps;
 
-    U64 transfers;
-    F64 throughput;
-    std::chrono::system_clock::time_point lastGet;
+    T* buffer = nullptr;
+    bool mirrored = false;
 
-    U64 head;
-    U64 tail;
+    Mode mode;
     U64 capacity;
-    U64 occupancy;
-    U64 overflows;
+    std::atomic<U64> waiters;
+    std::atomic<U64> overflows;
+    std::atomic<U64> droppedElements;
+    std::atomic<OverflowPolicy> overflowPolicy;
+    std::atomic<F64> throughput;
+    std::atomic<F64> producerRate;
+    std::atomic<U64> lastLatency;
+    std::atomic<U64> maxLatency;
+    std::atomic<U64> occupancySum;
+    std::array<std::atomic<U64>, OccupancyBuckets> occupancyHistogram{};
+    std::array<Mark, MaxMarks> marks;
+
+    // Owned by the consumer. Total number of elements read.
+    alignas(CacheLineSize) std::atomic<U64> head;
+    U64 transfers;
+    U64 markCursor;
+    std::chrono::steady_clock::time_point lastGet;
+
+    // Owned by the producer. Total number of elements written.
+    alignas(CacheLineSize) std::atomic<U64> tail;
+    std::atomic<U64> markHead;
+    U64 producerTransfers;
+    std::chrono::steady_clock::time_point lastPut;
+
+    void allocate(const U64& capacity);
+    void release();
+    void notifyWaiters();
+    void recordGap(const U64& position, const U64& size);
+    Result waitBufferSpace(const U64& size);
+    void updateThroughput(const U64& size);
+    void recordPut(const U64& position, const U64& size);
+    void recordGet(const U64& position);
 };
 
 }  // namespace Jetstream::Memory
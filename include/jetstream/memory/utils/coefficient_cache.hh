@@ -0,0 +1,76 @@
+#ifndef JETSTREAM_MEMORY_UTILS_COEFFICIENT_CACHE_H
+#define JETSTREAM_MEMORY_UTILS_COEFFICIENT_CACHE_H
+
+#include <mutex>
+#include <memory>
+#include <string>
+#include <vector>
+#include <unordered_map>
+
+#include "jetstream/types.hh"
+
+namespace Jetstream::Memory {
+
+/**
+ * @class CoefficientCache
+ * @brief A process-wide cache of generated coefficients, like windows and filter taps.
+ *
+ * Coefficients are stored on the host and keyed by a string describing their type, size and
+ * parameters. Modules hold the returned pointer for as long as they use the coefficients, so
+ * blocks with the same configuration share one copy, and reloading a block doesn't regenerate
+ * them. Entries are dropped once no module holds them anymore. Safe to use from any thread.
+ *
+ * @tparam T The type of each coefficient.
+ */
+template<typename T>
+class CoefficientCache {
+ public:
+    using Coefficients = std::shared_ptr<const std::vector<T>>;
+
+    /**
+     * @brief Get the coefficients of a key, generating them on a miss.
+     *
+     * @param key A string uniquely describing the coefficients.
+     * @param generator A callable returning the coefficients as a `std::vector<T>`.
+     * @return A shared pointer to the coefficients.
+     */
+    template<typename Generator>
+    static Coefficients Get(const std::string& key, Generator&& generator) {
+        auto& cache = Instance();
+
+        {
+            std::lock_guard<std::mutex> lock(cache.mutex);
+            if (auto it = cache.entries.find(key); it != cache.entries.end()) {
+                if (auto coefficients = it->second.lock()) {
+                    return coefficients;
+                }
+            }
+        }
+
+        // Generate outside of the lock, a race only costs a duplicate.
+
+        Coefficients coefficients = std::make_shared<const std::vector<T>>(generator());
+
+        std::lock_guard<std::mutex> lock(cache.mutex);
+
+        std::erase_if(cache.entries, [](const auto& entry) {
+            return entry.second.expired();
+        });
+        cache.entries[key] = coefficients;
+
+        return coefficients;
+    }
+
+ private:
+    std::mutex mutex;
+    std::unordered_map<std::string, std::weak_ptr<const std::vector<T>>> entries;
+
+    static CoefficientCache& Instance() {
+        static CoefficientCache cache;
+        return cache;
+    }
+};
+
+}  // namespace Jetstream::Memory
+
+#endif
@@ -0,0 +1,194 @@
+#ifndef JETSTREAM_MEMORY_UTILS_FRAME_RING_H
+#define JETSTREAM_MEMORY_UTILS_FRAME_RING_H
+
+#include <atomic>
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+#include "jetstream/types.hh"
+
+namespace Jetstream::Memory {
+
+/**
+ * @class FrameRing
+ * @brief A lock-free queue of frames handed from a producer to a consumer, dropping the oldest when full.
+ *
+ * Like the `TripleBuffer`, the producer writes into its back slot and publishes it, and the consumer
+ * picks up a published slot as its front. Up to `depth` published frames are queued in order. When the
+ * queue is full, publishing takes back the oldest queued frame instead, so the producer never waits.
+ * Only one producer thread and one consumer thread are supported.
+ *
+ * The slots are recycled, no frame is allocated or copied by the queue itself.
+ *
+ * @tparam T The type of the value stored in each slot.
+ */
+template<typename T>
+class FrameRing {
+ public:
+    /**
+     * @brief Constructor that initializes all slots with the same value.
+     * @param depth The number of published frames kept. At least one.
+     * @param value The initial value of every slot.
+     */
+    explicit FrameRing(const U64& depth, const T& value = {})
+         : _depth(std::max<U64>(depth, 1)),
+           // Back, front, and the old front while the consumer swaps it.
+           capacity(_depth + 3),
+           slots(capacity, value),
+           ready(std::make_unique<std::atomic<U64>[]>(_depth)),
+           free(std::make_unique<std::atomic<U64>[]>(capacity)) {
+        for (U64 i = 2; i < capacity; i++) {
+            free[i - 2].store(i, std::memory_order_relaxed);
+        }
+        freeTail.store(capacity - 2, std::memory_order_relaxed);
+    }
+
+    FrameRing(const FrameRing&) = delete;
+    FrameRing& operator=(const FrameRing&) = delete;
+
+    /**
+     * @brief Get the slot owned by the producer.
+     *
+     * @return A reference to the back slot.
+     */
+    T& back() {
+        return slots[backIndex];
+    }
+
+    /**
+     * @brief Queue the back slot for the consumer and take another slot as the new back.
+     *
+     * @return True if the oldest queued frame was dropped to make room, false otherwise.
+     */
+    bool publish() {
+        const U64 tail = readyTail.load(std::memory_order_relaxed);
+        U64 head = readyHead.load(std::memory_order_acquire);
+
+        // Take back the oldest frame if the queue is full, unless the consumer just did.
+
+        bool dropped = false;
+        U64 next = 0;
+
+        if (tail - head == _depth) {
+            const U64 oldest = ready[head % _depth].load(std::memory_order_relaxed);
+            if (readyHead.compare_exchange_strong(head, head + 1, std::memory_order_acq_rel)) {
+                next = oldest;
+                dropped = true;
+                droppedCount.fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+
+        ready[tail % _depth].store(backIndex, std::memory_order_relaxed);
+        readyTail.store(tail + 1, std::memory_order_release);
+
+        // Otherwise there's always a free slot, only the back, the front, and one
+        // slot being returned by the consumer are outside of the two queues.
+
+        if (!dropped) {
+            // Synchronizes with the consumer returning the slot.
+            (void)freeTail.load(std::memory_order_acquire);
+
+            const U64 freeIndex = freeHead.load(std::memory_order_relaxed);
+            next = free[freeIndex % capacity].load(std::memory_order_relaxed);
+            freeHead.store(freeIndex + 1, std::memory_order_release);
+        }
+
+        backIndex = next;
+
+        return dropped;
+    }
+
+    /**
+     * @brief Pick up the oldest queued frame as the new front.
+     *
+     * @return True if a frame was queued, false otherwise.
+     */
+    bool consume() {
+        U64 head = readyHead.load(std::memory_order_acquire);
+        U64 index;
+
+        do {
+            if (head == readyTail.load(std::memory_order_acquire)) {
+                return false;
+            }
+            index = ready[head % _depth].load(std::memory_order_relaxed);
+        } while (!readyHead.compare_exchange_weak(head, head + 1, std::memory_order_acq_rel));
+
+        // Return the previous front to the producer.
+
+        const U64 tail = freeTail.load(std::memory_order_relaxed);
+        free[tail % capacity].store(frontIndex, std::memory_order_relaxed);
+        freeTail.store(tail + 1, std::memory_order_release);
+
+        frontIndex = index;
+        return true;
+    }
+
+    /**
+     * @brief Get the slot owned by the consumer.
+     *
+     * @return A reference to the front slot.
+     */
+    T& front() {
+        return slots[frontIndex];
+    }
+
+    /**
+     * @brief Get the number of queued frames.
+     */
+    U64 occupancy() const {
+        return readyTail.load(std::memory_order_acquire) - readyHead.load(std::memory_order_acquire);
+    }
+
+    /**
+     * @brief Get the number of frames dropped since the construction.
+     */
+    U64 dropped() const {
+        return droppedCount.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Get the number of published frames kept.
+     */
+    const U64& depth() const {
+        return _depth;
+    }
+
+    /**
+     * @brief Apply a function to every slot.
+     * @note Not thread-safe. Should be used only while neither side is running.
+     * @param func The function to be applied.
+     */
+    template<typename F>
+    void forEach(F&& func) {
+        for (auto& slot : slots) {
+            func(slot);
+        }
+    }
+
+ private:
+    const U64 _depth;
+    const U64 capacity;
+
+    std::vector<T> slots;
+
+    U64 backIndex = 0;
+    U64 frontIndex = 1;
+
+    // Published slots, popped by the consumer or dropped by the producer.
+    std::unique_ptr<std::atomic<U64>[]> ready;
+    std::atomic<U64> readyHead{0};
+    std::atomic<U64> readyTail{0};
+
+    // Slots returned by the consumer.
+    std::unique_ptr<std::atomic<U64>[]> free;
+    std::atomic<U64> freeHead{0};
+    std::atomic<U64> freeTail{0};
+
+    std::atomic<U64> droppedCount{0};
+};
+
+}  // namespace Jetstream::Memory
+
+#endif
@@ -0,0 +1,52 @@
+#ifndef JETSTREAM_MEMORY_UTILS_HOT_CONFIG_H
+#define JETSTREAM_MEMORY_UTILS_HOT_CONFIG_H
+
+#include "jetstream/types.hh"
+#include "jetstream/memory/utils/triple_buffer.hh"
+
+namespace Jetstream::Memory {
+
+/**
+ * @class HotConfig
+ * @brief Hands configurations changed at runtime from the control thread to the compute thread.
+ *
+ * The control thread edits its own copy of the configuration and publishes it. The compute thread picks
+ * up the latest published copy between frames, so parameters never change in the middle of a frame and
+ * the graph doesn't have to be locked or rebuilt. Copies published faster than frames are computed are
+ * dropped, only the latest one is applied. Only one control thread and one compute thread are supported.
+ *
+ * @tparam T The type of the configuration.
+ */
+template<typename T>
+class HotConfig {
+ public:
+    /**
+     * @brief Publish a copy of the configuration to the compute thread.
+     * @param value The configuration to be applied from the next frame on.
+     */
+    void publish(const T& value) {
+        buffer.back() = value;
+        buffer.publish();
+    }
+
+    /**
+     * @brief Pick up the latest published configuration.
+     * @param value The configuration to be updated.
+     *
+     * @return True if a configuration was published since the last call, false otherwise.
+     */
+    bool consume(T& value) {
+        if (!buffer.consume()) {
+            return false;
+        }
+        value = buffer.front();
+        return true;
+    }
+
+ private:
+    TripleBuffer<T> buffer;
+};
+
+}  // namespace Jetstream::Memory
+
+#endif
@@ -1,6 +1,7 @@
 #ifndef JETSTREAM_MEMORY_UTILS_JUGGLER_H
 #define JETSTREAM_MEMORY_UTILS_JUGGLER_H
 
+#include <mutex>
 #include <memory>
 #include <vector>
 
@@ -15,7 +16,8 @@ namespace Jetstream::Memory {
  * The Juggler class provides a way to reuse memory by maintaining a pool of shared pointers.
  * It allows objects to be allocated and deallocated efficiently, reducing the overhead of memory allocation.
  * The class provides methods to resize the pool, clear the pool, and retrieve a shared pointer from the pool.
- * Unused pointers are recycled, and unique pointers are added to the used list.
+ * Pointers carry a deleter that returns the object to the pool in constant time when the last reference drops.
+ * References can be dropped from any thread and may outlive the Juggler itself.
  * 
  * @tparam T The type of objects managed by the Juggler.
  */
@@ -25,7 +27,7 @@ class Juggler {
     /**
      * @brief Default constructor.
      */
-    Juggler() = default;
+    Juggler() : state(std::make_shared<State>()) {}
 
     /**
      * @brief Constructor that resizes the pool and initializes objects.
@@ -35,10 +37,20 @@ class Juggler {
      * @param args The arguments to initialize the objects.
      */
     template<typename... Args>
-    Juggler(const U64& size, Args&&... args) {
+    Juggler(const U64& size, Args&&... args) : Juggler() {
         resize(size, std::forward<Args>(args)...);
     }
 
+    /**
+     * @brief Destructor. Objects still in use are deleted when their last reference drops.
+     */
+    ~Juggler() {
+        clear();
+    }
+
+    Juggler(const Juggler&) = delete;
+    Juggler& operator=(const Juggler&) = delete;
+
     /**
      * @brief Resizes the pool and initializes objects.
      * 
@@ -49,19 +61,20 @@ class Juggler {
     template<typename... Args>
     void resize(const U64& size, Args&&... args) {
         clear();
-        pool.reserve(size);
-        used.reserve(size);
+        std::lock_guard<std::mutex> lock(state->mutex);
+        state->pool.reserve(size);
         for (U64 i = 0; i < size; ++i) {
-            pool.push_back(std::make_shared<T>(std::forward<Args>(args)...));
+            state->pool.push_back(std::make_unique<T>(std::forward<Args>(args)...));
         }
     }
 
     /**
-     * @brief Clears the pool and used objects.
+     * @brief Clears the pool. Objects in use aren't returned to the pool anymore.
      */
     void clear() {
-        pool.clear();
-        used.clear();
+        std::lock_guard<std::mutex> lock(state->mutex);
+        state->pool.clear();
+        state->generation += 1;
     }
 
     /**
@@ -70,43 +83,69 @@ class Juggler {
      * @return A shared pointer to the retrieved object, or nullptr if the pool is empty.
      */
     std::shared_ptr<T> get() {
-        // Recycle unused pointers.
-
-        for (auto it = used.begin(); it != used.end();) {
-            if ((*it).unique()) {
-                pool.push_back(*it);
-                it = used.erase(it);
-            } else {
-                ++it;
-            }
-        }
+        std::unique_ptr<T> object;
+        U64 generation;
 
-        // Check if there are any pointers available.
+        {
+            std::lock_guard<std::mutex> lock(state->mutex);
 
-        if (pool.empty()) {
-            return nullptr;
-        }
+            // Check if there are any pointers available.
+
+            if (state->pool.empty()) {
+                state->exhaustions += 1;
+                return nullptr;
+            }
 
-        // Get the pointer from the pool.
+            // Get the pointer from the pool.
 
-        auto ptr = pool.back();
-        pool.pop_back();
+            object = std::move(state->pool.back());
+            state->pool.pop_back();
+            generation = state->generation;
+        }
 
-        // Add the pointer to the used list.
+        // Return the object to the pool once the last reference drops.
 
-        used.push_back(ptr);
+        return std::shared_ptr<T>(object.release(), [state = state, generation](T* ptr) {
+            std::unique_ptr<T> object(ptr);
+            std::lock_guard<std::mutex> lock(state->mutex);
+            if (state->generation == generation) {
+                state->pool.push_back(std::move(object));
+            }
+        });
+    }
 
-        // Return the pointer to caller.
+    /**
+     * @brief Get the number of objects available in the pool.
+     * 
+     * @return The number of available objects.
+     */
+    U64 available() const {
+        std::lock_guard<std::mutex> lock(state->mutex);
+        return state->pool.size();
+    }
 
-        return ptr;
+    /**
+     * @brief Get the number of times `get` found the pool empty.
+     * 
+     * @return The number of exhaustions.
+     */
+    U64 exhaustions() const {
+        std::lock_guard<std::mutex> lock(state->mutex);
+        return state->exhaustions;
     }
 
  private:
-    std::vector<std::shared_ptr<T>> pool;
-    std::vector<std::shared_ptr<T>> used;
+    // Shared with the deleters of objects in use.
+    struct State {
+        mutable std::mutex mutex;
+        std::vector<std::unique_ptr<T>> pool;
+        U64 generation = 0;
+        U64 exhaustions = 0;
+    };
+
+    std::shared_ptr<State> state;
 };
 
 }  // namespace Jetstream::Memory
 
 #endif
-
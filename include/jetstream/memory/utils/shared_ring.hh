@@ -0,0 +1,152 @@
+#ifndef JETSTREAM_MEMORY_UTILS_SHARED_RING_H
+#define JETSTREAM_MEMORY_UTILS_SHARED_RING_H
+
+#include <string>
+#include <chrono>
+
+#include "jetstream/types.hh"
+
+namespace Jetstream::Memory {
+
+/**
+ * @class SharedRing
+ * @brief A byte ring in shared memory exchanging a stream between two local processes.
+ *
+ * The producer creates a named shared memory object holding a control page followed by the storage.
+ * Like the `CircularBuffer`, the storage is mapped twice back-to-back, so any window of up to `capacity`
+ * bytes is contiguous. The producer writes straight into a reserved window and the consumer reads straight
+ * from a peeked one, nothing is copied through the kernel.
+ *
+ * Only one producer and one consumer are supported. Indices are lock-free atomics in the control page. A
+ * consumer waiting for bytes sleeps on a futex, the producer only wakes it when it's flagged as waiting.
+ * Platforms without futexes poll instead.
+ *
+ * The producer never waits for space. Writes that don't fit are dropped and counted in the control page.
+ */
+class SharedRing {
+ public:
+    /**
+     * @brief Default constructor. The ring is closed.
+     */
+    SharedRing();
+
+    /**
+     * @brief Destructor. Closes the ring.
+     */
+    ~SharedRing();
+
+    SharedRing(const SharedRing&) = delete;
+    SharedRing& operator=(const SharedRing&) = delete;
+
+    /**
+     * @brief Check if shared memory rings are supported by the platform.
+     */
+    static bool IsAvailable();
+
+    /**
+     * @brief Create a ring as its producer. A stale ring with the same name is replaced.
+     * @param name The name of the ring. Letters, digits, dashes and underscores only.
+     * @param capacity The minimum capacity in bytes. Rounded up to a whole number of pages.
+     * @param datatype The name of the element type, checked by the consumer.
+     * @return Result::SUCCESS if the ring was created.
+     */
+    Result create(const std::string& name, const U64& capacity, const std::string& datatype);
+
+    /**
+     * @brief Attach to an existing ring as its consumer.
+     * @param name The name of the ring.
+     * @return Result::SUCCESS if attached. Result::ERROR if the ring doesn't exist or isn't ready yet.
+     */
+    Result open(const std::string& name);
+
+    /**
+     * @brief Detach from the ring. The producer marks the ring closed and removes its name.
+     */
+    void close();
+
+    /**
+     * @brief Check if the ring is mapped.
+     */
+    constexpr bool isOpen() const {
+        return header != nullptr;
+    }
+
+    /**
+     * @brief Check if the producer closed the ring or exited.
+     * @note The consumer should close and reopen the ring once this is true.
+     */
+    bool isClosed() const;
+
+    /**
+     * @brief Get the capacity of the ring in bytes.
+     */
+    U64 getCapacity() const;
+
+    /**
+     * @brief Get the number of bytes written but not consumed yet.
+     */
+    U64 getOccupancy() const;
+
+    /**
+     * @brief Get the number of bytes dropped by the producer.
+     */
+    U64 getDropped() const;
+
+    /**
+     * @brief Get the name of the element type given by the producer.
+     */
+    std::string getDatatype() const;
+
+    /**
+     * @brief Get a window of free space to write into. Producer only.
+     * @param size The number of bytes to write.
+     * @return Pointer to the window, or nullptr if the bytes don't fit.
+     */
+    U8* reserve(const U64& size);
+
+    /**
+     * @brief Publish bytes written in the window of `reserve` and wake the consumer. Producer only.
+     * @param size The number of bytes written.
+     */
+    void commit(const U64& size);
+
+    /**
+     * @brief Count bytes that didn't fit as dropped. Producer only.
+     * @param size The number of bytes dropped.
+     */
+    void drop(const U64& size);
+
+    /**
+     * @brief Get a window of written bytes to read from. Consumer only.
+     * @param size The number of bytes to read.
+     * @return Pointer to the window, or nullptr if fewer bytes are available.
+     */
+    const U8* peek(const U64& size) const;
+
+    /**
+     * @brief Release bytes read from the window of `peek`. Consumer only.
+     * @param size The number of bytes read.
+     */
+    void consume(const U64& size);
+
+    /**
+     * @brief Wait until enough bytes are available or the producer closes the ring. Consumer only.
+     * @param size The number of bytes to wait for.
+     * @param timeout How long to wait at most.
+     * @return Result::SUCCESS if the bytes are available, Result::TIMEOUT otherwise.
+     */
+    Result wait(const U64& size, const std::chrono::milliseconds& timeout);
+
+ private:
+    struct Header;
+
+    Header* header = nullptr;
+    U8* storage = nullptr;
+    U64 mappedSize = 0;
+    std::string path;
+    bool producer = false;
+};
+
+}  // namespace Jetstream::Memory
+
+#endif
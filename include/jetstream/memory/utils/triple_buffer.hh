@@ -0,0 +1,101 @@
+#ifndef JETSTREAM_MEMORY_UTILS_TRIPLE_BUFFER_H
+#define JETSTREAM_MEMORY_UTILS_TRIPLE_BUFFER_H
+
+#include <array>
+#include <atomic>
+
+#include "jetstream/types.hh"
+
+namespace Jetstream::Memory {
+
+/**
+ * @class TripleBuffer
+ * @brief A lock-free triple buffer that hands the latest complete value from a producer to a consumer.
+ *
+ * The producer writes into the back slot and publishes it. The consumer picks up the latest published
+ * slot as its front. The third slot sits in between, so neither side ever waits for the other and the
+ * consumer never sees a partially written value. Publications not consumed in time are dropped.
+ * Only one producer thread and one consumer thread are supported.
+ *
+ * @tparam T The type of the value stored in each slot.
+ */
+template<typename T>
+class TripleBuffer {
+ public:
+    /**
+     * @brief Default constructor.
+     */
+    TripleBuffer() = default;
+
+    /**
+     * @brief Constructor that initializes all slots with the same value.
+     * @param value The initial value of every slot.
+     */
+    explicit TripleBuffer(const T& value) {
+        slots.fill(value);
+    }
+
+    /**
+     * @brief Get the slot owned by the producer.
+     *
+     * @return A reference to the back slot.
+     */
+    T& back() {
+        return slots[backIndex];
+    }
+
+    /**
+     * @brief Publish the back slot to the consumer and take a free slot as the new back.
+     */
+    void publish() {
+        backIndex = ready.exchange(backIndex | DirtyFlag, std::memory_order_acq_rel) & IndexMask;
+    }
+
+    /**
+     * @brief Pick up the latest published slot as the new front.
+     *
+     * @return True if a new value was published since the last call, false otherwise.
+     */
+    bool consume() {
+        if ((ready.load(std::memory_order_relaxed) & DirtyFlag) == 0) {
+            return false;
+        }
+        frontIndex = ready.exchange(frontIndex, std::memory_order_acq_rel) & IndexMask;
+        return true;
+    }
+
+    /**
+     * @brief Get the slot owned by the consumer.
+     *
+     * @return A reference to the front slot.
+     */
+    T& front() {
+        return slots[frontIndex];
+    }
+
+    /**
+     * @brief Apply a function to every slot.
+     * @note Not thread-safe. Should be used only while neither side is running.
+     * @param func The function to be applied.
+     */
+    template<typename F>
+    void forEach(F&& func) {
+        for (auto& slot : slots) {
+            func(slot);
+        }
+    }
+
+ private:
+    static constexpr U8 DirtyFlag = 0b100;
+    static constexpr U8 IndexMask = 0b011;
+
+    std::array<T, 3> slots{};
+
+    U8 backIndex = 0;
+    U8 frontIndex = 1;
+    std::atomic<U8> ready{2};
+};
+
+}  // namespace Jetstream::Memory
+
+#endif
@@ -0,0 +1,61 @@
+#ifndef JETSTREAM_METRICS_HH
+#define JETSTREAM_METRICS_HH
+
+#include <memory>
+#include <string>
+
+#include "jetstream/types.hh"
+#include "jetstream/macros.hh"
+#include "jetstream/compute/scheduler.hh"
+
+namespace Jetstream {
+
+/**
+ * @class MetricsServer
+ * @brief HTTP endpoint exposing the scheduler counters in the Prometheus text format.
+ *
+ * Serves `GET /metrics` from a background thread. Every scrape reads the counters at that
+ * moment, nothing is collected between scrapes. Exposes the compute and underrun counters,
+ * the compute time of every graph, the occupancy, rates, latency and overflows of the module
+ * buffers, the memory usage, and the module latency while profiling is enabled.
+ *
+ * Only available on POSIX platforms.
+ */
+class JETSTREAM_API MetricsServer {
+ public:
+    struct Config {
+        std::string address = "0.0.0.0";
+        U64 port = 9464;
+    };
+
+    explicit MetricsServer(Scheduler& scheduler);
+    ~MetricsServer();
+
+    MetricsServer(const MetricsServer&) = delete;
+    MetricsServer& operator=(const MetricsServer&) = delete;
+
+    /**
+     * @brief Start listening.
+     * @param config Address and port to listen on.
+     * @return Result::SUCCESS if the endpoint is listening.
+     */
+    Result start(const Config& config);
+
+    /**
+     * @brief Stop listening and wait for the server thread.
+     */
+    Result stop();
+
+    /**
+     * @brief Render the current metrics in the Prometheus text format.
+     */
+    std::string render() const;
+
+ private:
+    struct Impl;
+    std::unique_ptr<Impl> impl;
+};
+
+}  // namespace Jetstream
+
+#endif
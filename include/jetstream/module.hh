@@ -7,6 +7,8 @@
 #include "jetstream/benchmark.hh"
 #include "jetstream/render/base.hh"
 #include "jetstream/memory/base.hh"
+#include "jetstream/compute/signal.hh"
+#include "jetstream/compute/latency.hh"
 
 namespace Jetstream {
 
@@ -33,6 +35,11 @@ class JETSTREAM_API Module {
         return _locale;
     }
 
+    // GPU the module runs on. Negative uses the device of the backend.
+    constexpr const I32& deviceIndex() const {
+        return _deviceIndex;
+    }
+
  protected:
     template<Device DeviceId, typename DataType>
     static Result InitInput(Tensor<DeviceId, DataType>& buffer, const Taint& taint) {
@@ -86,12 +93,30 @@ class JETSTREAM_API Module {
         return Result::SUCCESS;
     }
 
+    // Modules tainted with `IN_PLACE` write their output over the input.
+    // The output shares the input memory and hash but keeps its own locale.
+    template<Device DeviceId, typename DataType>
+    static Result InitInPlaceOutput(Tensor<DeviceId, DataType>& output,
+                                    const Tensor<DeviceId, DataType>& input) {
+        if (!input.contiguous() || input.offset() != 0) {
+            JST_ERROR("In-place execution requires a contiguous input without offset.");
+            return Result::ERROR;
+        }
+
+        const Locale locale = output.locale();
+        output = input;
+        output.set_locale(locale);
+
+        return Result::SUCCESS;
+    }
+
     void setLocale(const Locale& locale) {
         _locale = locale;
     }
 
  private:
     Locale _locale;
+    I32 _deviceIndex = -1;
 
     friend Instance;
 };
@@ -99,6 +124,7 @@ class JETSTREAM_API Module {
 class CPU;
 class CUDA;
 class Metal;
+class Vulkan;
 
 class JETSTREAM_API Compute {
  public:
@@ -113,6 +139,9 @@ class JETSTREAM_API Compute {
 #endif
 #ifdef JETSTREAM_GRAPH_METAL_AVAILABLE
         Metal* metal;
+#endif
+#ifdef JETSTREAM_GRAPH_VULKAN_AVAILABLE
+        Vulkan* vulkan;
 #endif
     };
 
@@ -122,6 +151,8 @@ class JETSTREAM_API Compute {
     virtual constexpr Result compute(const Context&) {
         return Result::SUCCESS;
     }
+    // Return Result::TIMEOUT while the input isn't available and
+    // call `notifyCompute` once it is. Shouldn't block.
     virtual constexpr Result computeReady() {
         return Result::SUCCESS;
     }
@@ -129,8 +160,152 @@ class JETSTREAM_API Compute {
         return Result::SUCCESS;
     }
 
+    // Return true if `compute` enqueues the same device work on every call,
+    // has no host side effects, and never yields. Runs of such modules
+    // are captured once and replayed by the CUDA graph.
+    virtual constexpr bool computeCapturable() const {
+        return false;
+    }
+
+    // Return the number of elements if `compute` writes every output element
+    // from the input elements at the same index only, or zero otherwise. Runs
+    // of such modules are fused by the CPU graph, which calls `computeSlice`
+    // over cache sized slices instead of `compute` over the whole tensors.
+    virtual constexpr U64 computeElementwise() const {
+        return 0;
+    }
+    virtual constexpr Result computeSlice(const Context&, const U64&, const U64&) {
+        return Result::ERROR;
+    }
+
+    // Return the number of contiguous rows along the outermost axis and the
+    // elements per row if `compute` writes every output row from the input
+    // rows at the same index only, or zero rows otherwise. Such modules can
+    // join a fused run, which then calls `computeRows` over a few rows at a time.
+    struct Rows {
+        U64 count = 0;
+        U64 size = 0;
+    };
+
+    virtual Rows computeRowwise() const {
+        return {};
+    }
+    virtual constexpr Result computeRows(const Context&, const U64&, const U64&) {
+        return Result::ERROR;
+    }
+
+    // Scheduling priority of the module. Independent sub-graphs run from the
+    // highest priority down. While a module reports `computeUrgent`, like an
+    // audio sink about to underrun, sub-graphs with a lower priority are skipped.
+    virtual constexpr U64 computePriority() const {
+        return 0;
+    }
+    virtual constexpr bool computeUrgent() const {
+        return false;
+    }
+
+    // Return true if the module consumes a stream that doesn't wait for it,
+    // like a radio or a socket. Sub-graphs with such modules are never paced
+    // to the display, since skipping a cycle would drop data.
+    virtual constexpr bool computeRealtime() const {
+        return false;
+    }
+
+    // Return true while the output shares the input memory instead of holding
+    // a copy of it. Once either is modified in-place by another module, the
+    // scheduler calls `computeMaterialize` and the module copies from then on.
+    virtual constexpr bool computeForwarding() const {
+        return false;
+    }
+    virtual constexpr Result computeMaterialize() {
+        return Result::SUCCESS;
+    }
+
+    // Return true if the outputs only depend on the configuration and the
+    // inputs, or on state settling on them, like the envelope of an AGC. The
+    // scheduler computes CPU modules of the same type and configuration
+    // reading the same inputs once, and copies the outputs still read.
+    virtual constexpr bool computeShareable() const {
+        return false;
+    }
+
+    // Buffers decoupling a device thread from the graph, exported as metrics.
+    struct BufferStatistics {
+        std::string name;
+        U64 capacity = 0;
+        U64 occupancy = 0;
+        U64 overflows = 0;
+        U64 droppedElements = 0;
+        F64 throughput = 0.0;
+        F64 producerRate = 0.0;
+        F64 lastLatency = 0.0;
+        F64 maxLatency = 0.0;
+        // Puts by occupancy after the put, each bucket an equal share of the capacity.
+        std::vector<U64> occupancyHistogram;
+        U64 occupancySum = 0;
+
+        template<typename Buffer>
+        static BufferStatistics From(const std::string& name, const Buffer& buffer) {
+            const auto statistics = buffer.getStatistics();
+            return {
+                .name = name,
+                .capacity = statistics.capacity,
+                .occupancy = statistics.occupancy,
+                .overflows = statistics.overflows,
+                .droppedElements = statistics.droppedElements,
+                .throughput = statistics.consumerRate,
+                .producerRate = statistics.producerRate,
+                .lastLatency = statistics.lastLatency,
+                .maxLatency = statistics.maxLatency,
+                .occupancyHistogram = {statistics.occupancyHistogram.begin(), statistics.occupancyHistogram.end()},
+                .occupancySum = statistics.occupancySum,
+            };
+        }
+    };
+
+    virtual std::vector<BufferStatistics> computeBuffers() const {
+        return {};
+    }
+
+    void setComputeSignal(ComputeSignal* signal) {
+        computeSignal = signal;
+    }
+
+    // Name of the `compute` spans in the trace. Must outlive the module.
+    void setTraceName(const char* name) {
+        traceName = name;
+    }
+
+    // Duration of the `compute` calls recorded by the graph while
+    // profiling is enabled.
+    const LatencyHistogram& computeLatency() const {
+        return latency;
+    }
+
  protected:
+    // Wake up the scheduler waiting for `computeReady` to succeed.
+    void notifyCompute() {
+        if (auto* signal = computeSignal.load()) {
+            signal->notify();
+        }
+    }
+
+    void notifyComputeAt(const ComputeSignal::TimePoint& deadline) {
+        if (auto* signal = computeSignal.load()) {
+            signal->notifyAt(deadline);
+        }
+    }
+
     friend Instance;
+    friend class Graph;
+    friend class Scheduler;
+
+ private:
+    std::atomic<ComputeSignal*> computeSignal{nullptr};
+    LatencyHistogram latency;
+    const char* traceName = "Compute";
+    // Type and configuration of shareable modules, set by the instance.
+    std::string shareSignature;
 };
 
 class JETSTREAM_API Present {
@@ -147,10 +322,28 @@ class JETSTREAM_API Present {
         return Result::SUCCESS;
     }
 
+    // Return true if `present` only reads compute results from a
+    // published snapshot and can run concurrently with `compute`.
+    virtual constexpr bool presentSnapshot() const {
+        return false;
+    }
+
+    // Set by the instance when the view of the module is hidden. Sub-graphs
+    // only feeding hidden views aren't computed.
+    void setPresentVisible(const bool& visible) {
+        presentVisibleFlag.store(visible, std::memory_order_relaxed);
+    }
+    bool presentVisible() const {
+        return presentVisibleFlag.load(std::memory_order_relaxed);
+    }
+
  protected:
     std::shared_ptr<Render::Window> window;
 
     friend Instance;
+
+ private:
+    std::atomic<bool> presentVisibleFlag{true};
 };
 
 }  // namespace Jetstream
@@ -13,6 +13,14 @@ namespace Jetstream {
     MACRO(AGC, CPU, CF32) \
     MACRO(AGC, CPU, F32)
 
+#define JST_AGC_CUDA(MACRO) \
+    MACRO(AGC, CUDA, CF32) \
+    MACRO(AGC, CUDA, F32)
+
+#define JST_AGC_METAL(MACRO) \
+    MACRO(AGC, Metal, CF32) \
+    MACRO(AGC, Metal, F32)
+
 template<Device D, typename T = CF32>
 class AGC : public Module, public Compute {
  public:
@@ -21,8 +29,17 @@ class AGC : public Module, public Compute {
 
     // Configuration
 
+    // The envelope follows the peak magnitude of every subblock of samples.
+    // Attack and decay are per-sample smoothing factors used when the
+    // envelope rises and falls.
+
     struct Config {
-        JST_SERDES();
+        F32 level = 1.0f;
+        F32 attack = 1e-1f;
+        F32 decay = 1e-3f;
+        F32 maxGain = 1e5f;
+
+        JST_SERDES(level, attack, decay, maxGain);
     };
 
     constexpr const Config& getConfig() const {
@@ -70,8 +87,17 @@ class AGC : public Module, public Compute {
     Result create();
 
  protected:
+    Result createCompute(const Context& ctx) final;
     Result compute(const Context& ctx) final;
 
+    constexpr bool computeShareable() const final {
+        return true;
+    }
+
+    constexpr bool computeCapturable() const final {
+        return D == Device::CUDA;
+    }
+
  private:
     struct Impl;
     std::unique_ptr<Impl> impl;
@@ -82,6 +108,12 @@ class AGC : public Module, public Compute {
 #ifdef JETSTREAM_MODULE_AGC_CPU_AVAILABLE
 JST_AGC_CPU(JST_SPECIALIZATION);
 #endif
+#ifdef JETSTREAM_MODULE_AGC_CUDA_AVAILABLE
+JST_AGC_CUDA(JST_SPECIALIZATION);
+#endif
+#ifdef JETSTREAM_MODULE_AGC_METAL_AVAILABLE
+JST_AGC_METAL(JST_SPECIALIZATION);
+#endif
 
 }  // namespace Jetstream
 
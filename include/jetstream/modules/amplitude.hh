@@ -21,6 +21,10 @@ namespace Jetstream {
     MACRO(Amplitude, CUDA, CF32, F32) \
     MACRO(Amplitude, CUDA, F32, F32)
 
+#define JST_AMPLITUDE_VULKAN(MACRO) \
+    MACRO(Amplitude, Vulkan, CF32, F32) \
+    MACRO(Amplitude, Vulkan, F32, F32)
+
 template<Device D, typename IT = CF32, typename OT = F32>
 class Amplitude : public Module, public Compute {
  public:
@@ -30,7 +34,10 @@ class Amplitude : public Module, public Compute {
     // Configuration
 
     struct Config {
-        JST_SERDES();
+        U64 averages = 1;
+        bool inPlace = false;
+
+        JST_SERDES(averages, inPlace);
     };
 
     constexpr const Config& getConfig() const {
@@ -71,6 +78,13 @@ class Amplitude : public Module, public Compute {
         return D;
     }
 
+    constexpr Taint taint() const {
+        if (config.inPlace) {
+            return Taint::IN_PLACE;
+        }
+        return (D == Device::CPU) ? Taint::DISCONTIGUOUS : Taint::CLEAN;
+    }
+
     void info() const final;
 
     // Constructor
@@ -81,6 +95,19 @@ class Amplitude : public Module, public Compute {
     Result createCompute(const Context& ctx) final;
     Result compute(const Context& ctx) final;
 
+    constexpr bool computeShareable() const final {
+        return true;
+    }
+
+    constexpr bool computeCapturable() const final {
+        return D == Device::CUDA;
+    }
+
+    constexpr U64 computeElementwise() const final {
+        return (D == Device::CPU && input.buffer.contiguous() && config.averages == 1) ? input.buffer.size() : 0;
+    }
+    Result computeSlice(const Context& ctx, const U64& offset, const U64& size) final;
+
  private:
     struct Impl;
     std::unique_ptr<Impl> pimpl;
@@ -97,6 +124,9 @@ JST_AMPLITUDE_CUDA(JST_SPECIALIZATION);
 #ifdef JETSTREAM_MODULE_AMPLITUDE_METAL_AVAILABLE
 JST_AMPLITUDE_METAL(JST_SPECIALIZATION);
 #endif
+#ifdef JETSTREAM_MODULE_AMPLITUDE_VULKAN_AVAILABLE
+JST_AMPLITUDE_VULKAN(JST_SPECIALIZATION);
+#endif
 
 }  // namespace Jetstream
 
@@ -87,6 +87,10 @@ class Arithmetic : public Module, public Compute {
     Result createCompute(const Context& ctx) final;
     Result compute(const Context& ctx) final;
 
+    constexpr bool computeCapturable() const final {
+        return D == Device::CUDA;
+    }
+
  private:
     struct Impl;
     std::unique_ptr<Impl> pimpl;
@@ -82,12 +82,29 @@ class Audio : public Module, public Compute {
 
     const std::string& getDeviceName() const;
 
+    // Callbacks that found fewer samples than the device asked for, and the
+    // samples replaced by silence.
+    U64 getUnderruns() const;
+    U64 getUnderrunSamples() const;
+    // Computes dropped because the device didn't keep up.
+    U64 getOverflows() const;
+    // Seconds between the end of a compute and its samples playing.
+    F64 getLatency() const;
+
     static DeviceList ListAvailableDevices();
 
  protected:
     Result createCompute(const Context& ctx) final;
     Result compute(const Context& ctx) final;
 
+    // Playback can't wait for display sub-graphs.
+    constexpr U64 computePriority() const final {
+        return 1;
+    }
+    bool computeUrgent() const final;
+
+    std::vector<BufferStatistics> computeBuffers() const final;
+
  private:
     struct Impl;
     std::unique_ptr<Impl> pimpl;
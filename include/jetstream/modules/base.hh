@@ -31,6 +31,10 @@
 #include "jetstream/modules/soapy.hh"
 #endif
 
+#ifdef JETSTREAM_MODULE_SOAPY_SINK_AVAILABLE
+#include "jetstream/modules/soapy_sink.hh"
+#endif
+
 #ifdef JETSTREAM_MODULE_AUDIO_AVAILABLE
 #include "jetstream/modules/audio.hh"
 #endif
@@ -123,6 +127,66 @@
 #include "jetstream/modules/add.hh"
 #endif
 
+#ifdef JETSTREAM_MODULE_DECIMATOR_AVAILABLE
+#include "jetstream/modules/decimator.hh"
+#endif
+
+#ifdef JETSTREAM_MODULE_CHANNELIZER_AVAILABLE
+#include "jetstream/modules/channelizer.hh"
+#endif
+
+#ifdef JETSTREAM_MODULE_XLATING_FILTER_AVAILABLE
+#include "jetstream/modules/xlating_filter.hh"
+#endif
+
+#ifdef JETSTREAM_MODULE_RESAMPLER_AVAILABLE
+#include "jetstream/modules/resampler.hh"
+#endif
+
+#ifdef JETSTREAM_MODULE_CIC_DECIMATOR_AVAILABLE
+#include "jetstream/modules/cic_decimator.hh"
+#endif
+
+#ifdef JETSTREAM_MODULE_FRAMER_AVAILABLE
+#include "jetstream/modules/framer.hh"
+#endif
+
+#ifdef JETSTREAM_MODULE_SPECTRUM_MEASURE_AVAILABLE
+#include "jetstream/modules/spectrum_measure.hh"
+#endif
+
+#ifdef JETSTREAM_MODULE_BURST_DETECTOR_AVAILABLE
+#include "jetstream/modules/burst_detector.hh"
+#endif
+
+#ifdef JETSTREAM_MODULE_HISTORY_AVAILABLE
+#include "jetstream/modules/history.hh"
+#endif
+
+#ifdef JETSTREAM_MODULE_NETWORK_SINK_AVAILABLE
+#include "jetstream/modules/network_sink.hh"
+#endif
+
+#ifdef JETSTREAM_MODULE_NETWORK_SOURCE_AVAILABLE
+#include "jetstream/modules/network_source.hh"
+#endif
+
+#ifdef JETSTREAM_MODULE_SHARED_MEMORY_SINK_AVAILABLE
+#include "jetstream/modules/shared_memory_sink.hh"
+#endif
+
+#ifdef JETSTREAM_MODULE_SHARED_MEMORY_SOURCE_AVAILABLE
+#include "jetstream/modules/shared_memory_source.hh"
+#endif
+
+#ifdef JETSTREAM_MODULE_SLIDING_FFT_AVAILABLE
+#include "jetstream/modules/sliding_fft.hh"
+#endif
+
+#ifdef JETSTREAM_MODULE_CORRELATOR_AVAILABLE
+#include "jetstream/modules/correlator.hh"
+#endif
+
 // [NEW MODULE HOOK]
 
 #endif  // JETSTREAM_MODULES_BASE_HH
@@ -0,0 +1,99 @@
+#ifndef JETSTREAM_MODULES_BURST_DETECTOR_HH
+#define JETSTREAM_MODULES_BURST_DETECTOR_HH
+
+#include "jetstream/logger.hh"
+#include "jetstream/module.hh"
+#include "jetstream/types.hh"
+#include "jetstream/memory/base.hh"
+#include "jetstream/compute/graph/base.hh"
+
+namespace Jetstream {
+
+#define JST_BURST_DETECTOR_CPU(MACRO) \
+    MACRO(BurstDetector, CPU, CF32) \
+    MACRO(BurstDetector, CPU, F32)
+
+template<Device D, typename T = CF32>
+class BurstDetector : public Module, public Compute {
+ public:
+    BurstDetector();
+    ~BurstDetector();
+
+    // Configuration
+
+    struct Config {
+        F32 threshold = -60.0f;
+        U64 preTrigger = 4;
+        U64 postTrigger = 16;
+
+        JST_SERDES(threshold, preTrigger, postTrigger);
+    };
+
+    constexpr const Config& getConfig() const {
+        return config;
+    }
+
+    // Input
+
+    struct Input {
+        Tensor<D, T> buffer;
+        Tensor<D, F32> level;
+
+        JST_SERDES_INPUT(buffer, level);
+    };
+
+    constexpr const Input& getInput() const {
+        return input;
+    }
+
+    // Output
+
+    struct Output {
+        Tensor<D, T> buffer;
+
+        JST_SERDES_OUTPUT(buffer);
+    };
+
+    constexpr const Output& getOutput() const {
+        return output;
+    }
+
+    constexpr const Tensor<D, T>& getOutputBuffer() const {
+        return this->output.buffer;
+    }
+
+    // Taint & Housekeeping
+
+    constexpr Device device() const {
+        return D;
+    }
+
+    void info() const final;
+
+    // Constructor
+
+    Result create();
+
+    // Miscellaneous
+
+    bool gate() const;
+    U64 bursts() const;
+
+ protected:
+    Result createCompute(const Context& ctx) final;
+    Result compute(const Context& ctx) final;
+
+ private:
+    struct Impl;
+    std::unique_ptr<Impl> impl;
+
+    JST_DEFINE_IO()
+};
+
+#ifdef JETSTREAM_MODULE_BURST_DETECTOR_CPU_AVAILABLE
+JST_BURST_DETECTOR_CPU(JST_SPECIALIZATION);
+#endif
+
+}  // namespace Jetstream
+
+#endif
@@ -13,7 +13,39 @@ namespace Jetstream {
 
 #define JST_CAST_CPU(MACRO) \
     MACRO(Cast, CPU, CF32, F32) \
-    MACRO(Cast, CPU, CI8, CF32)
+    MACRO(Cast, CPU, CF32, CI16) \
+    MACRO(Cast, CPU, CI8, CF32) \
+    MACRO(Cast, CPU, CI16, CF32) \
+    MACRO(Cast, CPU, CU8, CF32) \
+    MACRO(Cast, CPU, U8, CF32)
+
+#define JST_CAST_CUDA(MACRO) \
+    MACRO(Cast, CUDA, CF32, F32) \
+    MACRO(Cast, CUDA, CF32, CI16) \
+    MACRO(Cast, CUDA, CI8, CF32) \
+    MACRO(Cast, CUDA, CI16, CF32) \
+    MACRO(Cast, CUDA, CU8, CF32) \
+    MACRO(Cast, CUDA, U8, CF32)
+
+#define JST_CAST_METAL(MACRO) \
+    MACRO(Cast, Metal, CF32, F32) \
+    MACRO(Cast, Metal, CF32, CI16) \
+    MACRO(Cast, Metal, CI8, CF32) \
+    MACRO(Cast, Metal, CI16, CF32) \
+    MACRO(Cast, Metal, CU8, CF32) \
+    MACRO(Cast, Metal, U8, CF32)
+
+// Bytes cast to complex floats are packed 12-bit complex samples, three bytes
+// per sample. The real part is in the low 12 bits of the little-endian 24-bit
+// word and the imaginary part in the high ones. The last dimension of the
+// output is a third of the input one.
+template<typename IT, typename OT>
+inline constexpr bool CastIsPacked = std::is_same<IT, U8>::value && std::is_same<OT, CF32>::value;
+
+// Complex floats cast to CI16 are multiplied by the scaler, rounded and
+// saturated. Half the size of CF32 for storage and transport.
+template<typename IT, typename OT>
+inline constexpr bool CastIsQuantized = std::is_same<IT, CF32>::value && std::is_same<OT, CI16>::value;
 
 template<Device D, typename IT = F32, typename OT = I16>
 class Cast : public Module, public Compute {
@@ -23,6 +55,9 @@ class Cast : public Module, public Compute {
 
     // Configuration
 
+    // Integer samples are divided by the scaler. Unsigned ones are centered
+    // first. Quantized samples are multiplied by it. Zero picks the full
+    // scale of the integer format.
     struct Config {
         F32 scaler = 0.0f;
 
@@ -67,6 +102,10 @@ class Cast : public Module, public Compute {
         return D;
     }
 
+    constexpr Taint taint() const {
+        return (D == Device::CPU && !CastIsPacked<IT, OT>) ? Taint::DISCONTIGUOUS : Taint::CLEAN;
+    }
+
     void info() const final;
 
     // Constructor
@@ -77,6 +116,14 @@ class Cast : public Module, public Compute {
     Result createCompute(const Context& ctx) final;
     Result compute(const Context& ctx) final;
 
+    constexpr U64 computeElementwise() const final {
+        if constexpr (CastIsPacked<IT, OT>) {
+            return 0;
+        }
+        return (D == Device::CPU && input.buffer.contiguous()) ? input.buffer.size() : 0;
+    }
+    Result computeSlice(const Context& ctx, const U64& offset, const U64& size) final;
+
  private:
     struct Impl;
     std::unique_ptr<Impl> impl;
@@ -87,6 +134,12 @@ class Cast : public Module, public Compute {
 #ifdef JETSTREAM_MODULE_CAST_CPU_AVAILABLE
 JST_CAST_CPU(JST_SPECIALIZATION);
 #endif
+#ifdef JETSTREAM_MODULE_CAST_CUDA_AVAILABLE
+JST_CAST_CUDA(JST_SPECIALIZATION);
+#endif
+#ifdef JETSTREAM_MODULE_CAST_METAL_AVAILABLE
+JST_CAST_METAL(JST_SPECIALIZATION);
+#endif
 
 }  // namespace Jetstream
 
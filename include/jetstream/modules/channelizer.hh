@@ -0,0 +1,99 @@
+#ifndef JETSTREAM_MODULES_CHANNELIZER_HH
+#define JETSTREAM_MODULES_CHANNELIZER_HH
+
+#include "jetstream/logger.hh"
+#include "jetstream/module.hh"
+#include "jetstream/types.hh"
+#include "jetstream/memory/base.hh"
+#include "jetstream/compute/graph/base.hh"
+
+namespace Jetstream {
+
+#define JST_CHANNELIZER_CPU(MACRO) \
+    MACRO(Channelizer, CPU, CF32)
+
+#define JST_CHANNELIZER_CUDA(MACRO) \
+    MACRO(Channelizer, CUDA, CF32)
+
+template<Device D, typename T = CF32>
+class Channelizer : public Module, public Compute {
+ public:
+    Channelizer();
+    ~Channelizer();
+
+    // Configuration
+
+    struct Config {
+        U64 channels = 8;
+        U64 oversampling = 1;
+        U64 tapsPerChannel = 8;
+
+        JST_SERDES(channels, oversampling, tapsPerChannel);
+    };
+
+    constexpr const Config& getConfig() const {
+        return config;
+    }
+
+    // Input
+
+    struct Input {
+        Tensor<D, T> buffer;
+
+        JST_SERDES_INPUT(buffer);
+    };
+
+    constexpr const Input& getInput() const {
+        return input;
+    }
+
+    // Output
+
+    struct Output {
+        Tensor<D, T> buffer;
+
+        JST_SERDES_OUTPUT(buffer);
+    };
+
+    constexpr const Output& getOutput() const {
+        return output;
+    }
+
+    constexpr const Tensor<D, T>& getOutputBuffer() const {
+        return this->output.buffer;
+    }
+
+    // Taint & Housekeeping
+
+    constexpr Device device() const {
+        return D;
+    }
+
+    void info() const final;
+
+    // Constructor
+
+    Result create();
+
+ protected:
+    Result createCompute(const Context& ctx) final;
+    Result destroyCompute(const Context& ctx) final;
+    Result compute(const Context& ctx) final;
+
+ private:
+    struct Impl;
+    std::unique_ptr<Impl> impl;
+
+    JST_DEFINE_IO()
+};
+
+#ifdef JETSTREAM_MODULE_CHANNELIZER_CPU_AVAILABLE
+JST_CHANNELIZER_CPU(JST_SPECIALIZATION);
+#endif
+#ifdef JETSTREAM_MODULE_CHANNELIZER_CUDA_AVAILABLE
+JST_CHANNELIZER_CUDA(JST_SPECIALIZATION);
+#endif
+
+}  // namespace Jetstream
+
+#endif
@@ -14,6 +14,9 @@ namespace Jetstream {
 #define JST_CONSTELLATION_CPU(MACRO) \
     MACRO(Constellation, CPU, CF32)
 
+#define JST_CONSTELLATION_METAL(MACRO) \
+    MACRO(Constellation, Metal, CF32)
+
 template<Device D, typename T = CF32>
 class Constellation : public Module, public Compute, public Present {
  public:
@@ -23,9 +26,12 @@ class Constellation : public Module, public Compute, public Present {
     // Configuration
 
     struct Config {
+        bool enableDensity = false;
+        U64 resolution = 256;
+        F32 decay = 0.9f;
         Extent2D<U64> viewSize = {512, 512};
 
-        JST_SERDES(viewSize);
+        JST_SERDES(enableDensity, resolution, decay, viewSize);
     };
 
     constexpr const Config& getConfig() const {
@@ -83,6 +89,12 @@ class Constellation : public Module, public Compute, public Present {
     Result present() final;
     Result destroyPresent() final;
 
+    Result createDensityPresent();
+
+    constexpr bool presentSnapshot() const final {
+        return true;
+    }
+
  private:
     struct Impl;
     std::unique_ptr<Impl> pimpl;
@@ -96,6 +108,9 @@ class Constellation : public Module, public Compute, public Present {
 #ifdef JETSTREAM_MODULE_CONSTELLATION_CPU_AVAILABLE
 JST_CONSTELLATION_CPU(JST_SPECIALIZATION);
 #endif
+#ifdef JETSTREAM_MODULE_CONSTELLATION_METAL_AVAILABLE
+JST_CONSTELLATION_METAL(JST_SPECIALIZATION);
+#endif
 
 }  // namespace Jetstream
 
@@ -0,0 +1,104 @@
+#ifndef JETSTREAM_MODULES_CORRELATOR_HH
+#define JETSTREAM_MODULES_CORRELATOR_HH
+
+#include "jetstream/logger.hh"
+#include "jetstream/module.hh"
+#include "jetstream/types.hh"
+#include "jetstream/memory/base.hh"
+#include "jetstream/compute/graph/base.hh"
+
+namespace Jetstream {
+
+#define JST_CORRELATOR_CPU(MACRO) \
+    MACRO(Correlator, CPU, CF32)
+
+#define JST_CORRELATOR_CUDA(MACRO) \
+    MACRO(Correlator, CUDA, CF32)
+
+template<Device D, typename T = CF32>
+class Correlator : public Module, public Compute {
+ public:
+    Correlator();
+    ~Correlator();
+
+    // Configuration
+
+    struct Config {
+        // Number of frequency channels of every spectrum.
+        U64 channels = 1024;
+        // Number of input buffers averaged in every visibility.
+        U64 integration = 1;
+
+        JST_SERDES(channels, integration);
+    };
+
+    constexpr const Config& getConfig() const {
+        return config;
+    }
+
+    // Input
+
+    struct Input {
+        // Samples of every antenna, [antennas, samples].
+        Tensor<D, T> buffer;
+
+        JST_SERDES_INPUT(buffer);
+    };
+
+    constexpr const Input& getInput() const {
+        return input;
+    }
+
+    // Output
+
+    struct Output {
+        // Cross-power spectra of every antenna pair, [baselines, channels].
+        // Pairs (i, j) with i <= j, ordered (0, 0), (0, 1), ..., (1, 1), ...
+        Tensor<D, T> visibilities;
+
+        JST_SERDES_OUTPUT(visibilities);
+    };
+
+    constexpr const Output& getOutput() const {
+        return output;
+    }
+
+    constexpr const Tensor<D, T>& getOutputVisibilities() const {
+        return this->output.visibilities;
+    }
+
+    // Taint & Housekeeping
+
+    constexpr Device device() const {
+        return D;
+    }
+
+    void info() const final;
+
+    // Constructor
+
+    Result create();
+
+ protected:
+    Result createCompute(const Context& ctx) final;
+    Result destroyCompute(const Context& ctx) final;
+    Result compute(const Context& ctx) final;
+
+ private:
+    struct Impl;
+    std::unique_ptr<Impl> impl;
+
+    JST_DEFINE_IO()
+};
+
+#ifdef JETSTREAM_MODULE_CORRELATOR_CPU_AVAILABLE
+JST_CORRELATOR_CPU(JST_SPECIALIZATION);
+#endif
+
+#ifdef JETSTREAM_MODULE_CORRELATOR_CUDA_AVAILABLE
+JST_CORRELATOR_CUDA(JST_SPECIALIZATION);
+#endif
+
+}  // namespace Jetstream
+
+#endif
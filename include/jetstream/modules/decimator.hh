@@ -0,0 +1,104 @@
+#ifndef JETSTREAM_MODULES_DECIMATOR_HH
+#define JETSTREAM_MODULES_DECIMATOR_HH
+
+#include "jetstream/logger.hh"
+#include "jetstream/module.hh"
+#include "jetstream/types.hh"
+#include "jetstream/memory/base.hh"
+#include "jetstream/compute/graph/base.hh"
+
+namespace Jetstream {
+
+#define JST_DECIMATOR_CPU(MACRO) \
+    MACRO(Decimator, CPU, CF32) \
+    MACRO(Decimator, CPU, F32)
+
+#define JST_DECIMATOR_CUDA(MACRO) \
+    MACRO(Decimator, CUDA, CF32) \
+    MACRO(Decimator, CUDA, F32)
+
+template<Device D, typename T = CF32>
+class Decimator : public Module, public Compute {
+ public:
+    Decimator();
+    ~Decimator();
+
+    // Configuration
+
+    struct Config {
+        U64 axis = 1;
+        U64 ratio = 4;
+        U64 tapsPerPhase = 8;
+
+        JST_SERDES(axis, ratio, tapsPerPhase);
+    };
+
+    constexpr const Config& getConfig() const {
+        return config;
+    }
+
+    // Input
+
+    struct Input {
+        Tensor<D, T> buffer;
+
+        JST_SERDES_INPUT(buffer);
+    };
+
+    constexpr const Input& getInput() const {
+        return input;
+    }
+
+    // Output
+
+    struct Output {
+        Tensor<D, T> buffer;
+
+        JST_SERDES_OUTPUT(buffer);
+    };
+
+    constexpr const Output& getOutput() const {
+        return output;
+    }
+
+    constexpr const Tensor<D, T>& getOutputBuffer() const {
+        return this->output.buffer;
+    }
+
+    // Taint & Housekeeping
+
+    constexpr Device device() const {
+        return D;
+    }
+
+    void info() const final;
+
+    // Constructor
+
+    Result create();
+
+ protected:
+    Result createCompute(const Context& ctx) final;
+    Result compute(const Context& ctx) final;
+
+    constexpr bool computeCapturable() const final {
+        return D == Device::CUDA;
+    }
+
+ private:
+    struct Impl;
+    std::unique_ptr<Impl> impl;
+
+    JST_DEFINE_IO()
+};
+
+#ifdef JETSTREAM_MODULE_DECIMATOR_CPU_AVAILABLE
+JST_DECIMATOR_CPU(JST_SPECIALIZATION);
+#endif
+#ifdef JETSTREAM_MODULE_DECIMATOR_CUDA_AVAILABLE
+JST_DECIMATOR_CUDA(JST_SPECIALIZATION);
+#endif
+
+}  // namespace Jetstream
+
+#endif
@@ -27,8 +27,9 @@ class Duplicate : public Module, public Compute {
 
     struct Config {
         bool hostAccessible = true;
+        bool copyOnWrite = false;
 
-        JST_SERDES(hostAccessible);
+        JST_SERDES(hostAccessible, copyOnWrite);
     };
 
     constexpr const Config& getConfig() const {
@@ -83,6 +84,13 @@ class Duplicate : public Module, public Compute {
     Result createCompute(const Context& ctx) final;
     Result compute(const Context& ctx) final;
 
+    constexpr bool computeCapturable() const final {
+        return D == Device::CUDA;
+    }
+
+    bool computeForwarding() const final;
+    Result computeMaterialize() final;
+
  private:
     struct Impl;
     std::unique_ptr<Impl> pimpl;
@@ -12,6 +12,7 @@ namespace Jetstream {
 
 #define JST_FFT_CPU(MACRO) \
     MACRO(FFT, CPU, CF32, CF32) \
+    MACRO(FFT, CPU, CI16, CF32) \
     MACRO(FFT, CPU, F32, CF32) \
     MACRO(FFT, CPU, F32, F32)
 
@@ -21,6 +22,9 @@ namespace Jetstream {
 #define JST_FFT_CUDA(MACRO) \
     MACRO(FFT, CUDA, CF32, CF32)
 
+#define JST_FFT_VULKAN(MACRO) \
+    MACRO(FFT, Vulkan, CF32, CF32)
+
 template<Device D, typename IT = CF32, typename OT = CF32>
 class FFT : public Module, public Compute {
  public:
@@ -32,7 +36,13 @@ class FFT : public Module, public Compute {
     struct Config {
         bool forward = true;
 
-        JST_SERDES(forward);
+        // CPU only. Either "auto", "pocketfft" or "fftw". The automatic choice
+        // is FFTW when available unless the JST_FFT_PROVIDER variable says otherwise.
+        // CI16 inputs are converted to full scale CF32 into the output and
+        // transformed in place with pocketfft.
+        std::string provider = "auto";
+
+        JST_SERDES(forward, provider);
     };
 
     constexpr const Config& getConfig() const {
@@ -84,6 +94,17 @@ class FFT : public Module, public Compute {
     Result destroyCompute(const Context& ctx) final;
     Result compute(const Context& ctx) final;
 
+    constexpr bool computeShareable() const final {
+        return true;
+    }
+
+    constexpr bool computeCapturable() const final {
+        return D == Device::CUDA;
+    }
+
+    Rows computeRowwise() const final;
+    Result computeRows(const Context& ctx, const U64& offset, const U64& count) final;
+
  private:
     struct Impl;
     std::unique_ptr<Impl> pimpl;
@@ -100,6 +121,9 @@ JST_FFT_CUDA(JST_SPECIALIZATION);
 #ifdef JETSTREAM_MODULE_FFT_METAL_AVAILABLE
 JST_FFT_METAL(JST_SPECIALIZATION);
 #endif
+#ifdef JETSTREAM_MODULE_FFT_VULKAN_AVAILABLE
+JST_FFT_VULKAN(JST_SPECIALIZATION);
+#endif
 
 }  // namespace Jetstream
 
@@ -1,13 +1,75 @@
 #ifndef JETSTREAM_MODULES_FILE_HH
 #define JETSTREAM_MODULES_FILE_HH
 
+#include <string>
+#include <filesystem>
+
 #include "jetstream/logger.hh"
 #include "jetstream/module.hh"
 #include "jetstream/types.hh"
 
 namespace Jetstream {
 
-JST_SERDES_ENUM(FileFormatType, Raw);
+JST_SERDES_ENUM(FileFormatType, Raw, SigMF, Compressed);
+
+// SigMF recordings are a pair of files sharing a base name. The path of
+// either file, or the base name itself, selects the recording.
+
+inline std::filesystem::path SigMFBasePath(const std::string& filepath) {
+    std::filesystem::path path(filepath);
+    const auto extension = path.extension();
+    if (extension == ".sigmf-data" || extension == ".sigmf-meta") {
+        path.replace_extension();
+    }
+    return path;
+}
+
+inline std::filesystem::path SigMFDataPath(const std::string& filepath) {
+    return SigMFBasePath(filepath).concat(".sigmf-data");
+}
+
+inline std::filesystem::path SigMFMetaPath(const std::string& filepath) {
+    return SigMFBasePath(filepath).concat(".sigmf-meta");
+}
+
+// SigMF dataset format of a sample type. Only little-endian floats are used.
+template<typename T>
+inline const char* SigMFDatatype() {
+    return std::is_same_v<T, CF32> ? "cf32_le" : "rf32_le";
+}
+
+// Layout of compressed recordings. Samples are split in chunks, quantized
+// to 16-bit integers with a scale per chunk and compressed with zstd. The
+// file starts with a header and ends with the offset of every chunk, so
+// readers can seek without decompressing. A file without the index, like
+// one of an interrupted recording, can still be read by walking the chunks.
+struct CompressedFile {
+    static constexpr U32 Magic = 0x5A54534A;       // "JSTZ"
+    static constexpr U32 IndexMagic = 0x4954534A;  // "JSTI"
+    static constexpr U32 Version = 1;
+    static constexpr U32 ChunkSamples = 1 << 16;
+
+    struct Header {
+        U32 magic;
+        U32 version;
+        U32 complex;
+        U32 chunkSamples;
+    };
+
+    struct ChunkHeader {
+        U32 size;
+        U32 samples;
+        F32 scale;
+        U32 reserved;
+    };
+
+    // Written after the chunk offsets.
+    struct Footer {
+        U64 numberOfChunks;
+        U32 magic;
+        U32 reserved;
+    };
+};
 
 }  // namespace Jetstream
 
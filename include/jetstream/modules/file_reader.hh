@@ -28,8 +28,20 @@ class FileReader : public Module, public Compute {
         bool playing = false;
         bool loop = true;
         std::vector<U64> shape = {8192};
-
-        JST_SERDES(fileFormat, filepath, playing, loop, shape);
+        // Frames of `shape` read by each compute. Larger batches add a leading
+        // dimension to the output, trading latency for throughput.
+        U64 batchSize = 1;
+        // Outputs read ahead by a background thread. Zero reads on the compute
+        // thread instead.
+        U64 readAhead = 0;
+        // Paces the outputs at the sample rate instead of producing them as
+        // fast as the graph consumes them.
+        bool realTime = false;
+        // Samples per second used for pacing and time seeks. Zero uses the
+        // rate of SigMF recordings.
+        F32 sampleRate = 0.0f;
+
+        JST_SERDES(fileFormat, filepath, playing, loop, shape, batchSize, readAhead, realTime, sampleRate);
     };
 
     constexpr const Config& getConfig() const {
@@ -89,11 +101,26 @@ class FileReader : public Module, public Compute {
 
     U64 getFileSize() const;
     U64 getCurrentPosition() const;
+    U64 getReadAheadOccupancy() const;
+
+    // Seeks are applied before the next output. Positions past the end of
+    // the file are clamped.
+    Result seek(const U64& sample);
+    Result seekTime(const F64& seconds);
+    Result seekCapture(const U64& index);
+
+    U64 getCurrentSample() const;
+    U64 getNumberOfSamples() const;
+    U64 getNumberOfCaptures() const;
+    F32 getSampleRate() const;
 
  protected:
     Result createCompute(const Context& ctx) final;
     Result destroyCompute(const Context& ctx) final;
     Result compute(const Context& ctx) final;
+    Result computeReady() final;
+
+    std::vector<BufferStatistics> computeBuffers() const final;
 
  private:
     struct Impl;
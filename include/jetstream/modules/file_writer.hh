@@ -32,8 +32,13 @@ class FileWriter : public Module, public Compute {
         F32 centerFrequency = 0.0f;
         bool overwrite = false;
         bool recording = false;
+        // Bypass the page cache. Falls back to buffered writes where unsupported.
+        bool directIO = false;
+        // Megabytes buffered in memory while the storage catches up.
+        U64 backlog = 64;
 
-        JST_SERDES(fileFormat, filepath, name, description, author, sampleRate, centerFrequency, overwrite, recording);
+        JST_SERDES(fileFormat, filepath, name, description, author, sampleRate, centerFrequency, overwrite, recording,
+                   directIO, backlog);
     };
 
     constexpr const Config& getConfig() const {
@@ -87,6 +92,12 @@ class FileWriter : public Module, public Compute {
         return config.recording;
     }
 
+    U64 getBytesWritten() const;
+    U64 getBytesStored() const;
+    U64 getBacklog() const;
+    U64 getBytesDropped() const;
+    F64 getWriteBandwidth() const;
+
  protected:
     Result createCompute(const Context& ctx) final;
     Result destroyCompute(const Context& ctx) final;
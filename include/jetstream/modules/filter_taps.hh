@@ -95,6 +95,7 @@ class FilterTaps : public Module, public Compute {
     Result taps(U64& taps);
 
  protected:
+    Result createCompute(const Context& ctx) final;
     Result compute(const Context& ctx) final;
 
  private:
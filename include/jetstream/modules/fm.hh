@@ -13,6 +13,12 @@ namespace Jetstream {
 #define JST_FM_CPU(MACRO) \
     MACRO(FM, CPU, CF32, F32)
 
+#define JST_FM_CUDA(MACRO) \
+    MACRO(FM, CUDA, CF32, F32)
+
+#define JST_FM_METAL(MACRO) \
+    MACRO(FM, Metal, CF32, F32)
+
 template<Device D, typename IT = CF32, typename OT = F32>
 class FM : public Module, public Compute {
  public:
@@ -23,8 +29,11 @@ class FM : public Module, public Compute {
 
     struct Config {
         F32 sampleRate = 240e3f;
+        // Axis of the samples. Axes before it index independent channels,
+        // the axis and the ones after it are a continuous stream per channel.
+        U64 axis = 0;
 
-        JST_SERDES(sampleRate);
+        JST_SERDES(sampleRate, axis);
     };
 
     constexpr const Config& getConfig() const {
@@ -75,6 +84,10 @@ class FM : public Module, public Compute {
     Result createCompute(const Context& ctx) final;
     Result compute(const Context& ctx) final;
 
+    constexpr bool computeCapturable() const final {
+        return D == Device::CUDA;
+    }
+
  private:
     struct Impl;
     std::unique_ptr<Impl> impl;
@@ -85,6 +98,12 @@ class FM : public Module, public Compute {
 #ifdef JETSTREAM_MODULE_FM_CPU_AVAILABLE
 JST_FM_CPU(JST_SPECIALIZATION);
 #endif
+#ifdef JETSTREAM_MODULE_FM_CUDA_AVAILABLE
+JST_FM_CUDA(JST_SPECIALIZATION);
+#endif
+#ifdef JETSTREAM_MODULE_FM_METAL_AVAILABLE
+JST_FM_METAL(JST_SPECIALIZATION);
+#endif
 
 }  // namespace Jetstream
 
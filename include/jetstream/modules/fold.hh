@@ -13,6 +13,14 @@ namespace Jetstream {
     MACRO(Fold, CPU, CF32) \
     MACRO(Fold, CPU, F32)
 
+#define JST_FOLD_CUDA(MACRO) \
+    MACRO(Fold, CUDA, CF32) \
+    MACRO(Fold, CUDA, F32)
+
+#define JST_FOLD_METAL(MACRO) \
+    MACRO(Fold, Metal, CF32) \
+    MACRO(Fold, Metal, F32)
+
 template<Device D, typename T = CF32>
 class Fold : public Module, public Compute {
  public:
@@ -74,8 +82,13 @@ class Fold : public Module, public Compute {
     Result create();
 
  protected:
+    Result createCompute(const Context& ctx) final;
     Result compute(const Context& ctx) final;
 
+    constexpr bool computeCapturable() const final {
+        return D == Device::CUDA;
+    }
+
  private:
     struct Impl;
     std::unique_ptr<Impl> impl;
@@ -86,6 +99,12 @@ class Fold : public Module, public Compute {
 #ifdef JETSTREAM_MODULE_FOLD_CPU_AVAILABLE
 JST_FOLD_CPU(JST_SPECIALIZATION);
 #endif
+#ifdef JETSTREAM_MODULE_FOLD_CUDA_AVAILABLE
+JST_FOLD_CUDA(JST_SPECIALIZATION);
+#endif
+#ifdef JETSTREAM_MODULE_FOLD_METAL_AVAILABLE
+JST_FOLD_METAL(JST_SPECIALIZATION);
+#endif
 
 }  // namespace Jetstream
 
@@ -0,0 +1,103 @@
+#ifndef JETSTREAM_MODULES_FRAMER_HH
+#define JETSTREAM_MODULES_FRAMER_HH
+
+#include "jetstream/logger.hh"
+#include "jetstream/module.hh"
+#include "jetstream/types.hh"
+#include "jetstream/memory/base.hh"
+#include "jetstream/compute/graph/base.hh"
+
+namespace Jetstream {
+
+#define JST_FRAMER_CPU(MACRO) \
+    MACRO(Framer, CPU, CF32) \
+    MACRO(Framer, CPU, F32)
+
+#define JST_FRAMER_CUDA(MACRO) \
+    MACRO(Framer, CUDA, CF32) \
+    MACRO(Framer, CUDA, F32)
+
+template<Device D, typename T = CF32>
+class Framer : public Module, public Compute {
+ public:
+    Framer();
+    ~Framer();
+
+    // Configuration
+
+    struct Config {
+        U64 size = 0;
+        U64 hop = 0;
+
+        JST_SERDES(size, hop);
+    };
+
+    constexpr const Config& getConfig() const {
+        return config;
+    }
+
+    // Input
+
+    struct Input {
+        Tensor<D, T> buffer;
+
+        JST_SERDES_INPUT(buffer);
+    };
+
+    constexpr const Input& getInput() const {
+        return input;
+    }
+
+    // Output
+
+    struct Output {
+        Tensor<D, T> buffer;
+
+        JST_SERDES_OUTPUT(buffer);
+    };
+
+    constexpr const Output& getOutput() const {
+        return output;
+    }
+
+    constexpr const Tensor<D, T>& getOutputBuffer() const {
+        return this->output.buffer;
+    }
+
+    // Taint & Housekeeping
+
+    constexpr Device device() const {
+        return D;
+    }
+
+    void info() const final;
+
+    // Constructor
+
+    Result create();
+
+ protected:
+    Result createCompute(const Context& ctx) final;
+    Result compute(const Context& ctx) final;
+
+    constexpr bool computeCapturable() const final {
+        return D == Device::CUDA;
+    }
+
+ private:
+    struct Impl;
+    std::unique_ptr<Impl> impl;
+
+    JST_DEFINE_IO()
+};
+
+#ifdef JETSTREAM_MODULE_FRAMER_CPU_AVAILABLE
+JST_FRAMER_CPU(JST_SPECIALIZATION);
+#endif
+#ifdef JETSTREAM_MODULE_FRAMER_CUDA_AVAILABLE
+JST_FRAMER_CUDA(JST_SPECIALIZATION);
+#endif
+
+}  // namespace Jetstream
+
+#endif
@@ -0,0 +1,110 @@
+#ifndef JETSTREAM_MODULES_HISTORY_HH
+#define JETSTREAM_MODULES_HISTORY_HH
+
+#include "jetstream/logger.hh"
+#include "jetstream/module.hh"
+#include "jetstream/types.hh"
+#include "jetstream/memory/base.hh"
+#include "jetstream/compute/graph/base.hh"
+
+namespace Jetstream {
+
+#define JST_HISTORY_CPU(MACRO) \
+    MACRO(History, CPU, CF32) \
+    MACRO(History, CPU, F32)
+
+template<Device D, typename T = CF32>
+class History : public Module, public Compute {
+ public:
+    History();
+    ~History();
+
+    // Configuration
+
+    struct Config {
+        F32 sampleRate = 1.0e6f;
+        F32 duration = 10.0f;
+        F32 window = 1.0f;
+        F32 delay = 0.0f;
+        bool hugePages = false;
+        bool pinned = false;
+
+        JST_SERDES(sampleRate, duration, window, delay, hugePages, pinned);
+    };
+
+    constexpr const Config& getConfig() const {
+        return config;
+    }
+
+    // Input
+
+    struct Input {
+        Tensor<D, T> buffer;
+
+        JST_SERDES_INPUT(buffer);
+    };
+
+    constexpr const Input& getInput() const {
+        return input;
+    }
+
+    // Output
+
+    struct Output {
+        Tensor<D, T> buffer;
+
+        JST_SERDES_OUTPUT(buffer);
+    };
+
+    constexpr const Output& getOutput() const {
+        return output;
+    }
+
+    constexpr const Tensor<D, T>& getOutputBuffer() const {
+        return this->output.buffer;
+    }
+
+    // Taint & Housekeeping
+
+    constexpr Device device() const {
+        return D;
+    }
+
+    void info() const final;
+
+    // Constructor
+
+    Result create();
+
+    // Miscellaneous
+
+    Result setDelay(F32& delay);
+
+    // Opens the gate of the output for the next frame.
+    void trigger();
+
+    U64 frames() const;
+    U64 capacity() const;
+    U64 triggers() const;
+
+ protected:
+    Result createCompute(const Context& ctx) final;
+    Result compute(const Context& ctx) final;
+
+    bool computeForwarding() const final;
+    Result computeMaterialize() final;
+
+ private:
+    struct Impl;
+    std::unique_ptr<Impl> impl;
+
+    JST_DEFINE_IO()
+};
+
+#ifdef JETSTREAM_MODULE_HISTORY_CPU_AVAILABLE
+JST_HISTORY_CPU(JST_SPECIALIZATION);
+#endif
+
+}  // namespace Jetstream
+
+#endif
@@ -22,7 +22,9 @@ class Invert : public Module, public Compute {
     // Configuration
 
     struct Config {
-        JST_SERDES();
+        bool inPlace = false;
+
+        JST_SERDES(inPlace);
     };
 
     constexpr const Config& getConfig() const {
@@ -63,6 +65,10 @@ class Invert : public Module, public Compute {
         return D;
     }
 
+    constexpr Taint taint() const {
+        return config.inPlace ? Taint::IN_PLACE : Taint::CLEAN;
+    }
+
     void info() const final;
 
     // Constructor
@@ -73,6 +79,15 @@ class Invert : public Module, public Compute {
     Result createCompute(const Context& ctx) final;
     Result compute(const Context& ctx) final;
 
+    constexpr bool computeShareable() const final {
+        return true;
+    }
+
+    constexpr U64 computeElementwise() const final {
+        return (D == Device::CPU) ? input.buffer.size() : 0;
+    }
+    Result computeSlice(const Context& ctx, const U64& offset, const U64& size) final;
+
  private:
     struct Impl;
     std::unique_ptr<Impl> impl;
@@ -22,6 +22,14 @@ namespace Jetstream {
 #define JST_LINEPLOT_CUDA(MACRO) \
     MACRO(Lineplot, CUDA, F32)
 
+#define JST_LINEPLOT_VULKAN(MACRO) \
+    MACRO(Lineplot, Vulkan, F32)
+
+// How the samples of a decimated point are combined. Min and Max keep
+// narrowband peaks and nulls that averaging would hide. PeakHold takes the
+// maximum and holds it, releasing at the averaging rate.
+JST_SERDES_ENUM(LineplotDecimation, Average, Min, Max, PeakHold);
+
 template<Device D, typename T = F32>
 class Lineplot : public Module, public Compute, public Present {
  public:
@@ -33,6 +41,7 @@ class Lineplot : public Module, public Compute, public Present {
     struct Config {
         U64 averaging = 1;
         U64 decimation = 1;
+        LineplotDecimation decimationMode = LineplotDecimation::Average;
         U64 numberOfVerticalLines = 11;
         U64 numberOfHorizontalLines = 5;
         Extent2D<U64> viewSize = {512, 384};
@@ -41,7 +50,7 @@ class Lineplot : public Module, public Compute, public Present {
         F32 thickness = 1.0f;
         F32 scale = 1.0f;
 
-        JST_SERDES(averaging, decimation, numberOfVerticalLines, numberOfHorizontalLines, viewSize, zoom, translation, thickness, scale);
+        JST_SERDES(averaging, decimation, decimationMode, numberOfVerticalLines, numberOfHorizontalLines, viewSize, zoom, translation, thickness, scale);
     };
 
     constexpr const Config& getConfig() const {
@@ -122,6 +131,10 @@ class Lineplot : public Module, public Compute, public Present {
     Result present() final;
     Result destroyPresent() final;
 
+    constexpr bool presentSnapshot() const final {
+        return D == Device::CPU;
+    }
+
  private:
     struct Impl;
     std::unique_ptr<Impl> pimpl;
@@ -143,7 +156,12 @@ JST_LINEPLOT_CUDA(JST_SPECIALIZATION);
 #ifdef JETSTREAM_MODULE_LINEPLOT_METAL_AVAILABLE
 JST_LINEPLOT_METAL(JST_SPECIALIZATION);
 #endif
+#ifdef JETSTREAM_MODULE_LINEPLOT_VULKAN_AVAILABLE
+JST_LINEPLOT_VULKAN(JST_SPECIALIZATION);
+#endif
 
 }  // namespace Jetstream
 
+template <> struct jst::fmt::formatter<Jetstream::LineplotDecimation> : ostream_formatter {};
+
 #endif
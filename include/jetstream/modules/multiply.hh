@@ -14,9 +14,16 @@ namespace Jetstream {
     MACRO(Multiply, CPU, CF32) \
     MACRO(Multiply, CPU, F32)
 
+#define JST_MULTIPLY_CUDA(MACRO) \
+    MACRO(Multiply, CUDA, CF32) \
+    MACRO(Multiply, CUDA, F32)
+
 #define JST_MULTIPLY_METAL(MACRO) \
     MACRO(Multiply, Metal, CF32)
 
+#define JST_MULTIPLY_VULKAN(MACRO) \
+    MACRO(Multiply, Vulkan, CF32)
+
 template<Device D, typename T = CF32>
 class Multiply : public Module, public Compute {
  public:
@@ -87,6 +94,14 @@ class Multiply : public Module, public Compute {
     Result createCompute(const Context& ctx) final;
     Result compute(const Context& ctx) final;
 
+    constexpr bool computeShareable() const final {
+        return true;
+    }
+
+    constexpr bool computeCapturable() const final {
+        return D == Device::CUDA;
+    }
+
  private:
     struct Impl;
     std::unique_ptr<Impl> impl;
@@ -97,9 +112,15 @@ class Multiply : public Module, public Compute {
 #ifdef JETSTREAM_MODULE_MULTIPLY_CPU_AVAILABLE
 JST_MULTIPLY_CPU(JST_SPECIALIZATION);
 #endif
+#ifdef JETSTREAM_MODULE_MULTIPLY_CUDA_AVAILABLE
+JST_MULTIPLY_CUDA(JST_SPECIALIZATION);
+#endif
 #ifdef JETSTREAM_MODULE_MULTIPLY_METAL_AVAILABLE
 JST_MULTIPLY_METAL(JST_SPECIALIZATION);
 #endif
+#ifdef JETSTREAM_MODULE_MULTIPLY_VULKAN_AVAILABLE
+JST_MULTIPLY_VULKAN(JST_SPECIALIZATION);
+#endif
 
 }  // namespace Jetstream
 
@@ -28,8 +28,9 @@ class MultiplyConstant : public Module, public Compute {
 
     struct Config {
         T constant;
+        bool inPlace = false;
 
-        JST_SERDES(constant);
+        JST_SERDES(constant, inPlace);
     };
 
     constexpr const Config& getConfig() const {
@@ -70,6 +71,13 @@ class MultiplyConstant : public Module, public Compute {
         return D;
     }
 
+    constexpr Taint taint() const {
+        if (config.inPlace) {
+            return Taint::IN_PLACE;
+        }
+        return (D == Device::CPU) ? Taint::DISCONTIGUOUS : Taint::CLEAN;
+    }
+
     void info() const final;
 
     // Constructor
@@ -80,6 +88,11 @@ class MultiplyConstant : public Module, public Compute {
     Result createCompute(const Context& ctx) final;
     Result compute(const Context& ctx) final;
 
+    constexpr U64 computeElementwise() const final {
+        return (D == Device::CPU && input.factor.contiguous()) ? input.factor.size() : 0;
+    }
+    Result computeSlice(const Context& ctx, const U64& offset, const U64& size) final;
+
  private:
     struct Impl;
     std::unique_ptr<Impl> impl;
@@ -0,0 +1,83 @@
+#ifndef JETSTREAM_MODULES_NETWORK_HH
+#define JETSTREAM_MODULES_NETWORK_HH
+
+#include "jetstream/logger.hh"
+#include "jetstream/module.hh"
+#include "jetstream/types.hh"
+
+namespace Jetstream {
+
+JST_SERDES_ENUM(NetworkProtocolType, UDP, TCP);
+JST_SERDES_ENUM(NetworkCompressionType, None, Int16, Int8);
+
+// Wire format of the network tensor streams. Every frame, the bytes of one
+// input, is sent as one or more records. A record is a header followed by a
+// slice of the frame. UDP datagrams carry whole records, several of them when
+// small frames are batched. TCP carries the records back to back. Numbers are
+// in host order, both ends are expected to share it.
+//
+// Compressed frames carry floats quantized to 16 or 8-bit integers with their
+// own datatype. Each frame is scaled to its peak, the header keeps the step
+// the receiver multiplies the integers by to restore them.
+struct NetworkStream {
+    static constexpr U32 Magic = 0x4E54534A;  // "JSTN"
+    static constexpr U16 Version = 1;
+
+    struct Header {
+        U32 magic;
+        U16 version;
+        U16 datatype;
+        // Counts records. A gap in the sequence is a loss.
+        U64 sequence;
+        // Counts frames.
+        U64 frame;
+        // Bytes of the whole frame.
+        U32 frameSize;
+        // Position and bytes of the slice carried by the record.
+        U32 offset;
+        U32 size;
+        // Step of one integer of a compressed frame. Zero otherwise.
+        F32 scale;
+    };
+
+    template<typename T>
+    static constexpr U16 Datatype() {
+        if constexpr (std::is_same_v<T, F32>) {
+            return 1;
+        } else if constexpr (std::is_same_v<T, CF32>) {
+            return 2;
+        } else if constexpr (std::is_same_v<T, CI16>) {
+            return 3;
+        } else if constexpr (std::is_same_v<T, CI8>) {
+            return 4;
+        } else if constexpr (std::is_same_v<T, I16>) {
+            return 5;
+        } else if constexpr (std::is_same_v<T, I8>) {
+            return 6;
+        } else {
+            return 0;
+        }
+    }
+
+    // Datatype of the frames of T once compressed.
+    template<typename T>
+    static U16 Datatype(const NetworkCompressionType& compression) {
+        constexpr bool complex = IsComplex<T>::value;
+
+        switch (compression) {
+            case NetworkCompressionType::Int16:
+                return complex ? Datatype<CI16>() : Datatype<I16>();
+            case NetworkCompressionType::Int8:
+                return complex ? Datatype<CI8>() : Datatype<I8>();
+            default:
+                return Datatype<T>();
+        }
+    }
+};
+
+}  // namespace Jetstream
+
+template <> struct jst::fmt::formatter<Jetstream::NetworkProtocolType> : ostream_formatter {};
+template <> struct jst::fmt::formatter<Jetstream::NetworkCompressionType> : ostream_formatter {};
+
+#endif
@@ -0,0 +1,110 @@
+#ifndef JETSTREAM_MODULES_NETWORK_SINK_HH
+#define JETSTREAM_MODULES_NETWORK_SINK_HH
+
+#include "jetstream/logger.hh"
+#include "jetstream/module.hh"
+#include "jetstream/types.hh"
+#include "jetstream/modules/network.hh"
+#include "jetstream/memory/base.hh"
+#include "jetstream/compute/graph/base.hh"
+
+namespace Jetstream {
+
+#define JST_NETWORK_SINK_CPU(MACRO) \
+    MACRO(NetworkSink, CPU, CF32) \
+    MACRO(NetworkSink, CPU, F32)
+
+template<Device D, typename T = CF32>
+class NetworkSink : public Module, public Compute {
+ public:
+    NetworkSink();
+    ~NetworkSink();
+
+    // Configuration
+
+    struct Config {
+        NetworkProtocolType protocol = NetworkProtocolType::UDP;
+        // Destination of UDP datagrams, unicast or multicast. Listening
+        // address of TCP, every connected client gets the stream.
+        std::string address = "127.0.0.1";
+        U64 port = 5000;
+        // Largest datagram in bytes. Frames are split in records fitting it.
+        U64 packetSize = 8192;
+        // Frames gathered before sending. Small frames then share datagrams.
+        U64 batchSize = 1;
+        // Hops of multicast datagrams.
+        U64 multicastTtl = 1;
+        // Integers the samples are quantized to before sending.
+        NetworkCompressionType compression = NetworkCompressionType::None;
+
+        JST_SERDES(protocol, address, port, packetSize, batchSize, multicastTtl, compression);
+    };
+
+    constexpr const Config& getConfig() const {
+        return config;
+    }
+
+    // Input
+
+    struct Input {
+        Tensor<D, T> buffer;
+
+        JST_SERDES_INPUT(buffer);
+    };
+
+    constexpr const Input& getInput() const {
+        return input;
+    }
+
+    // Output
+
+    struct Output {
+        JST_SERDES_OUTPUT();
+    };
+
+    constexpr const Output& getOutput() const {
+        return output;
+    }
+
+    // Taint & Housekeeping
+
+    constexpr Device device() const {
+        return D;
+    }
+
+    constexpr Taint taint() const {
+        return Taint::CLEAN;
+    }
+
+    void info() const final;
+
+    // Constructor
+
+    Result create();
+    Result destroy();
+
+    // Miscellaneous
+
+    U64 getFramesSent() const;
+    U64 getBytesSent() const;
+    U64 getFramesDropped() const;
+    U64 getNumberOfClients() const;
+
+ protected:
+    Result createCompute(const Context& ctx) final;
+    Result compute(const Context& ctx) final;
+
+ private:
+    struct Impl;
+    std::unique_ptr<Impl> impl;
+
+    JST_DEFINE_IO()
+};
+
+#ifdef JETSTREAM_MODULE_NETWORK_SINK_CPU_AVAILABLE
+JST_NETWORK_SINK_CPU(JST_SPECIALIZATION);
+#endif
+
+}  // namespace Jetstream
+
+#endif
@@ -0,0 +1,114 @@
+#ifndef JETSTREAM_MODULES_NETWORK_SOURCE_HH
+#define JETSTREAM_MODULES_NETWORK_SOURCE_HH
+
+#include "jetstream/logger.hh"
+#include "jetstream/module.hh"
+#include "jetstream/types.hh"
+#include "jetstream/modules/network.hh"
+#include "jetstream/memory/base.hh"
+#include "jetstream/memory/utils/circular_buffer.hh"
+#include "jetstream/compute/graph/base.hh"
+
+namespace Jetstream {
+
+#define JST_NETWORK_SOURCE_CPU(MACRO) \
+    MACRO(NetworkSource, CPU, CF32) \
+    MACRO(NetworkSource, CPU, F32)
+
+template<Device D, typename T = CF32>
+class NetworkSource : public Module, public Compute {
+ public:
+    NetworkSource();
+    ~NetworkSource();
+
+    // Configuration
+
+    struct Config {
+        NetworkProtocolType protocol = NetworkProtocolType::UDP;
+        // Listening address of UDP, a multicast group is joined. Address of
+        // the Network Sink to connect to with TCP.
+        std::string address = "0.0.0.0";
+        U64 port = 5000;
+        std::vector<U64> shape = {8192};
+        // Outputs buffered between the network and the graph.
+        U64 bufferMultiplier = 8;
+
+        JST_SERDES(protocol, address, port, shape, bufferMultiplier);
+    };
+
+    constexpr const Config& getConfig() const {
+        return config;
+    }
+
+    // Input
+
+    struct Input {
+        JST_SERDES_INPUT();
+    };
+
+    constexpr const Input& getInput() const {
+        return input;
+    }
+
+    // Output
+
+    struct Output {
+        Tensor<D, T> buffer;
+
+        JST_SERDES_OUTPUT(buffer);
+    };
+
+    constexpr const Output& getOutput() const {
+        return output;
+    }
+
+    constexpr const Tensor<D, T>& getOutputBuffer() const {
+        return this->output.buffer;
+    }
+
+    // Taint & Housekeeping
+
+    constexpr Device device() const {
+        return D;
+    }
+
+    void info() const final;
+
+    // Constructor
+
+    Result create();
+    Result destroy();
+
+    // Miscellaneous
+
+    Memory::CircularBuffer<T>& getCircularBuffer();
+    U64 getFramesReceived() const;
+    U64 getFramesDropped() const;
+    U64 getRecordsLost() const;
+    bool isConnected() const;
+
+ protected:
+    Result createCompute(const Context& ctx) final;
+    Result compute(const Context& ctx) final;
+    Result computeReady() final;
+
+    constexpr bool computeRealtime() const final {
+        return true;
+    }
+
+    std::vector<BufferStatistics> computeBuffers() const final;
+
+ private:
+    struct Impl;
+    std::unique_ptr<Impl> impl;
+
+    JST_DEFINE_IO()
+};
+
+#ifdef JETSTREAM_MODULE_NETWORK_SOURCE_CPU_AVAILABLE
+JST_NETWORK_SOURCE_CPU(JST_SPECIALIZATION);
+#endif
+
+}  // namespace Jetstream
+
+#endif
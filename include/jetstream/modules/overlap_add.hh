@@ -14,6 +14,14 @@ namespace Jetstream {
     MACRO(OverlapAdd, CPU, CF32) \
     MACRO(OverlapAdd, CPU, F32)
 
+#define JST_OVERLAP_ADD_CUDA(MACRO) \
+    MACRO(OverlapAdd, CUDA, CF32) \
+    MACRO(OverlapAdd, CUDA, F32)
+
+#define JST_OVERLAP_ADD_METAL(MACRO) \
+    MACRO(OverlapAdd, Metal, CF32) \
+    MACRO(OverlapAdd, Metal, F32)
+
 template<Device D, typename T = CF32>
 class OverlapAdd : public Module, public Compute {
  public:
@@ -77,16 +85,28 @@ class OverlapAdd : public Module, public Compute {
     Result createCompute(const Context& ctx) final;
     Result compute(const Context& ctx) final;
 
+    constexpr bool computeCapturable() const final {
+        return D == Device::CUDA;
+    }
+
  private:
     struct Impl;
     std::unique_ptr<Impl> impl;
 
+    Result computeContiguous();
+
     JST_DEFINE_IO()
 };
 
 #ifdef JETSTREAM_MODULE_OVERLAP_ADD_CPU_AVAILABLE
 JST_OVERLAP_ADD_CPU(JST_SPECIALIZATION);
 #endif
+#ifdef JETSTREAM_MODULE_OVERLAP_ADD_CUDA_AVAILABLE
+JST_OVERLAP_ADD_CUDA(JST_SPECIALIZATION);
+#endif
+#ifdef JETSTREAM_MODULE_OVERLAP_ADD_METAL_AVAILABLE
+JST_OVERLAP_ADD_METAL(JST_SPECIALIZATION);
+#endif
 
 }  // namespace Jetstream
 
@@ -14,6 +14,14 @@ namespace Jetstream {
     MACRO(Pad, CPU, CF32) \
     MACRO(Pad, CPU, F32)
 
+#define JST_PAD_CUDA(MACRO) \
+    MACRO(Pad, CUDA, CF32) \
+    MACRO(Pad, CUDA, F32)
+
+#define JST_PAD_METAL(MACRO) \
+    MACRO(Pad, Metal, CF32) \
+    MACRO(Pad, Metal, F32)
+
 template<Device D, typename T = CF32>
 class Pad : public Module, public Compute {
  public:
@@ -77,6 +85,10 @@ class Pad : public Module, public Compute {
     Result createCompute(const Context& ctx) final;
     Result compute(const Context& ctx) final;
 
+    constexpr bool computeCapturable() const final {
+        return D == Device::CUDA;
+    }
+
  private:
     struct Impl;
     std::unique_ptr<Impl> impl;
@@ -87,6 +99,12 @@ class Pad : public Module, public Compute {
 #ifdef JETSTREAM_MODULE_PAD_CPU_AVAILABLE
 JST_PAD_CPU(JST_SPECIALIZATION);
 #endif
+#ifdef JETSTREAM_MODULE_PAD_CUDA_AVAILABLE
+JST_PAD_CUDA(JST_SPECIALIZATION);
+#endif
+#ifdef JETSTREAM_MODULE_PAD_METAL_AVAILABLE
+JST_PAD_METAL(JST_SPECIALIZATION);
+#endif
 
 }  // namespace Jetstream
 
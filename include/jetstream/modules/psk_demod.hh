@@ -12,6 +12,9 @@ namespace Jetstream {
 #define JST_PSK_DEMOD_CPU(MACRO) \
     MACRO(PskDemod, CPU, CF32)
 
+#define JST_PSK_DEMOD_CUDA(MACRO) \
+    MACRO(PskDemod, CUDA, CF32)
+
 JST_SERDES_ENUM(PskType, BPSK, QPSK, PSK8);
 
 template<Device D, typename T = CF32>
@@ -31,9 +34,12 @@ class PskDemod : public Module, public Compute {
         F64 dampingFactor = 0.707;
         F64 excessBandwidth = 0.35;
         U64 bufferSize = 8192;
+        // Axis of the samples. Axes before it index independent channels,
+        // the axis and the ones after it are a continuous stream per channel.
+        U64 axis = 0;
 
         JST_SERDES(pskType, sampleRate, symbolRate, frequencyLoopBandwidth,
-                   timingLoopBandwidth, dampingFactor, excessBandwidth, bufferSize);
+                   timingLoopBandwidth, dampingFactor, excessBandwidth, bufferSize, axis);
     };
 
     constexpr const Config& getConfig() const {
@@ -104,6 +110,9 @@ class PskDemod : public Module, public Compute {
 #ifdef JETSTREAM_MODULE_PSK_DEMOD_CPU_AVAILABLE
 JST_PSK_DEMOD_CPU(JST_SPECIALIZATION);
 #endif
+#ifdef JETSTREAM_MODULE_PSK_DEMOD_CUDA_AVAILABLE
+JST_PSK_DEMOD_CUDA(JST_SPECIALIZATION);
+#endif
 
 }  // namespace Jetstream
 
@@ -4,8 +4,8 @@
 #include "jetstream/logger.hh"
 #include "jetstream/module.hh"
 #include "jetstream/types.hh"
-
 #include "jetstream/memory/base.hh"
+#include "jetstream/compute/graph/base.hh"
 
 namespace Jetstream {
 
@@ -13,6 +13,10 @@ namespace Jetstream {
     MACRO(RRCFilter, CPU, CF32) \
     MACRO(RRCFilter, CPU, F32)
 
+#define JST_RRC_FILTER_CUDA(MACRO) \
+    MACRO(RRCFilter, CUDA, CF32) \
+    MACRO(RRCFilter, CUDA, F32)
+
 template<Device D, typename T = CF32>
 class RRCFilter : public Module, public Compute {
  public:
@@ -26,8 +30,10 @@ class RRCFilter : public Module, public Compute {
         F32 sampleRate = 2.0e6f;
         F32 rollOff = 0.35f;
         U64 taps = 101;
+        U64 interpolation = 1;
+        U64 decimation = 1;
 
-        JST_SERDES(symbolRate, sampleRate, rollOff, taps);
+        JST_SERDES(symbolRate, sampleRate, rollOff, taps, interpolation, decimation);
     };
 
     constexpr const Config& getConfig() const {
@@ -83,6 +89,7 @@ class RRCFilter : public Module, public Compute {
     Result setTaps(U64& taps);
 
  protected:
+    Result createCompute(const Context& ctx) final;
     Result compute(const Context& ctx) final;
 
  private:
@@ -95,6 +102,9 @@ class RRCFilter : public Module, public Compute {
 #ifdef JETSTREAM_MODULE_RRC_FILTER_CPU_AVAILABLE
 JST_RRC_FILTER_CPU(JST_SPECIALIZATION);
 #endif
+#ifdef JETSTREAM_MODULE_RRC_FILTER_CUDA_AVAILABLE
+JST_RRC_FILTER_CUDA(JST_SPECIALIZATION);
+#endif
 
 }  // namespace Jetstream
 
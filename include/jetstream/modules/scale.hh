@@ -19,6 +19,9 @@ namespace Jetstream {
 #define JST_SCALE_CUDA(MACRO) \
     MACRO(Scale, CUDA, F32)
 
+#define JST_SCALE_VULKAN(MACRO) \
+    MACRO(Scale, Vulkan, F32)
+
 template<Device D, typename T = F32>
 class Scale : public Module, public Compute {
  public:
@@ -29,8 +32,9 @@ class Scale : public Module, public Compute {
 
     struct Config {
         Range<T> range = {-1.0, +1.0};
+        bool inPlace = false;
 
-        JST_SERDES(range);
+        JST_SERDES(range, inPlace);
     };
 
     constexpr const Config& getConfig() const {
@@ -71,6 +75,13 @@ class Scale : public Module, public Compute {
         return D;
     }
 
+    constexpr Taint taint() const {
+        if (config.inPlace) {
+            return Taint::IN_PLACE;
+        }
+        return (D == Device::CPU) ? Taint::DISCONTIGUOUS : Taint::CLEAN;
+    }
+
     void info() const final;
 
     // Constructor
@@ -89,6 +100,19 @@ class Scale : public Module, public Compute {
     Result createCompute(const Context& ctx) final;
     Result compute(const Context& ctx) final;
 
+    constexpr bool computeShareable() const final {
+        return true;
+    }
+
+    constexpr bool computeCapturable() const final {
+        return D == Device::CUDA;
+    }
+
+    constexpr U64 computeElementwise() const final {
+        return (D == Device::CPU && input.buffer.contiguous()) ? input.buffer.size() : 0;
+    }
+    Result computeSlice(const Context& ctx, const U64& offset, const U64& size) final;
+
  private:
     struct Impl;
     std::unique_ptr<Impl> impl;
@@ -105,6 +129,9 @@ JST_SCALE_CUDA(JST_SPECIALIZATION);
 #ifdef JETSTREAM_MODULE_SCALE_METAL_AVAILABLE
 JST_SCALE_METAL(JST_SPECIALIZATION);
 #endif
+#ifdef JETSTREAM_MODULE_SCALE_VULKAN_AVAILABLE
+JST_SCALE_VULKAN(JST_SPECIALIZATION);
+#endif
 
 }  // namespace Jetstream
 
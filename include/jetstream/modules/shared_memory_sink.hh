@@ -0,0 +1,100 @@
+#ifndef JETSTREAM_MODULES_SHARED_MEMORY_SINK_HH
+#define JETSTREAM_MODULES_SHARED_MEMORY_SINK_HH
+
+#include "jetstream/logger.hh"
+#include "jetstream/module.hh"
+#include "jetstream/types.hh"
+#include "jetstream/memory/base.hh"
+#include "jetstream/compute/graph/base.hh"
+
+namespace Jetstream {
+
+#define JST_SHARED_MEMORY_SINK_CPU(MACRO) \
+    MACRO(SharedMemorySink, CPU, CF32) \
+    MACRO(SharedMemorySink, CPU, F32)
+
+template<Device D, typename T = CF32>
+class SharedMemorySink : public Module, public Compute {
+ public:
+    SharedMemorySink();
+    ~SharedMemorySink();
+
+    // Configuration
+
+    struct Config {
+        // Name of the ring shared with a Shared Memory Source.
+        std::string name = "cyberether";
+        // Inputs buffered between this process and the consumer.
+        U64 bufferMultiplier = 8;
+
+        JST_SERDES(name, bufferMultiplier);
+    };
+
+    constexpr const Config& getConfig() const {
+        return config;
+    }
+
+    // Input
+
+    struct Input {
+        Tensor<D, T> buffer;
+
+        JST_SERDES_INPUT(buffer);
+    };
+
+    constexpr const Input& getInput() const {
+        return input;
+    }
+
+    // Output
+
+    struct Output {
+        JST_SERDES_OUTPUT();
+    };
+
+    constexpr const Output& getOutput() const {
+        return output;
+    }
+
+    // Taint & Housekeeping
+
+    constexpr Device device() const {
+        return D;
+    }
+
+    constexpr Taint taint() const {
+        return Taint::CLEAN;
+    }
+
+    void info() const final;
+
+    // Constructor
+
+    Result create();
+    Result destroy();
+
+    // Miscellaneous
+
+    U64 getFramesSent() const;
+    U64 getFramesDropped() const;
+    U64 getCapacity() const;
+    U64 getOccupancy() const;
+
+ protected:
+    Result createCompute(const Context& ctx) final;
+    Result compute(const Context& ctx) final;
+
+ private:
+    struct Impl;
+    std::unique_ptr<Impl> impl;
+
+    JST_DEFINE_IO()
+};
+
+#ifdef JETSTREAM_MODULE_SHARED_MEMORY_SINK_CPU_AVAILABLE
+JST_SHARED_MEMORY_SINK_CPU(JST_SPECIALIZATION);
+#endif
+
+}  // namespace Jetstream
+
+#endif
@@ -0,0 +1,105 @@
+#ifndef JETSTREAM_MODULES_SHARED_MEMORY_SOURCE_HH
+#define JETSTREAM_MODULES_SHARED_MEMORY_SOURCE_HH
+
+#include "jetstream/logger.hh"
+#include "jetstream/module.hh"
+#include "jetstream/types.hh"
+#include "jetstream/memory/base.hh"
+#include "jetstream/compute/graph/base.hh"
+
+namespace Jetstream {
+
+#define JST_SHARED_MEMORY_SOURCE_CPU(MACRO) \
+    MACRO(SharedMemorySource, CPU, CF32) \
+    MACRO(SharedMemorySource, CPU, F32)
+
+template<Device D, typename T = CF32>
+class SharedMemorySource : public Module, public Compute {
+ public:
+    SharedMemorySource();
+    ~SharedMemorySource();
+
+    // Configuration
+
+    struct Config {
+        // Name of the ring created by a Shared Memory Sink.
+        std::string name = "cyberether";
+        std::vector<U64> shape = {8192};
+
+        JST_SERDES(name, shape);
+    };
+
+    constexpr const Config& getConfig() const {
+        return config;
+    }
+
+    // Input
+
+    struct Input {
+        JST_SERDES_INPUT();
+    };
+
+    constexpr const Input& getInput() const {
+        return input;
+    }
+
+    // Output
+
+    struct Output {
+        Tensor<D, T> buffer;
+
+        JST_SERDES_OUTPUT(buffer);
+    };
+
+    constexpr const Output& getOutput() const {
+        return output;
+    }
+
+    constexpr const Tensor<D, T>& getOutputBuffer() const {
+        return this->output.buffer;
+    }
+
+    // Taint & Housekeeping
+
+    constexpr Device device() const {
+        return D;
+    }
+
+    void info() const final;
+
+    // Constructor
+
+    Result create();
+    Result destroy();
+
+    // Miscellaneous
+
+    U64 getFramesReceived() const;
+    U64 getSamplesDropped() const;
+    U64 getCapacity() const;
+    U64 getOccupancy() const;
+    bool isConnected() const;
+
+ protected:
+    Result createCompute(const Context& ctx) final;
+    Result compute(const Context& ctx) final;
+    Result computeReady() final;
+
+    constexpr bool computeRealtime() const final {
+        return true;
+    }
+
+ private:
+    struct Impl;
+    std::unique_ptr<Impl> impl;
+
+    JST_DEFINE_IO()
+};
+
+#ifdef JETSTREAM_MODULE_SHARED_MEMORY_SOURCE_CPU_AVAILABLE
+JST_SHARED_MEMORY_SOURCE_CPU(JST_SPECIALIZATION);
+#endif
+
+}  // namespace Jetstream
+
+#endif
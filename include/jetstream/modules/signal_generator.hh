@@ -13,6 +13,14 @@ namespace Jetstream {
     MACRO(SignalGenerator, CPU, CF32) \
     MACRO(SignalGenerator, CPU, F32)
 
+#define JST_SIGNAL_GENERATOR_CUDA(MACRO) \
+    MACRO(SignalGenerator, CUDA, CF32) \
+    MACRO(SignalGenerator, CUDA, F32)
+
+#define JST_SIGNAL_GENERATOR_METAL(MACRO) \
+    MACRO(SignalGenerator, Metal, CF32) \
+    MACRO(SignalGenerator, Metal, F32)
+
 JST_SERDES_ENUM(SignalType, Sine, Cosine, Square, Sawtooth, Triangle, Noise, DC, Chirp);
 
 template<Device D, typename T = CF32>
@@ -112,6 +120,12 @@ class SignalGenerator : public Module, public Compute {
 #ifdef JETSTREAM_MODULE_SIGNAL_GENERATOR_CPU_AVAILABLE
 JST_SIGNAL_GENERATOR_CPU(JST_SPECIALIZATION);
 #endif
+#ifdef JETSTREAM_MODULE_SIGNAL_GENERATOR_CUDA_AVAILABLE
+JST_SIGNAL_GENERATOR_CUDA(JST_SPECIALIZATION);
+#endif
+#ifdef JETSTREAM_MODULE_SIGNAL_GENERATOR_METAL_AVAILABLE
+JST_SIGNAL_GENERATOR_METAL(JST_SPECIALIZATION);
+#endif
 
 }  // namespace Jetstream
 
@@ -0,0 +1,99 @@
+#ifndef JETSTREAM_MODULES_SLIDING_FFT_HH
+#define JETSTREAM_MODULES_SLIDING_FFT_HH
+
+#include "jetstream/logger.hh"
+#include "jetstream/module.hh"
+#include "jetstream/types.hh"
+#include "jetstream/memory/base.hh"
+#include "jetstream/compute/graph/base.hh"
+
+namespace Jetstream {
+
+#define JST_SLIDING_FFT_CPU(MACRO) \
+    MACRO(SlidingFFT, CPU, CF32)
+
+template<Device D, typename T = CF32>
+class SlidingFFT : public Module, public Compute {
+ public:
+    SlidingFFT();
+    ~SlidingFFT();
+
+    // Configuration
+
+    struct Config {
+        // Number of bins, also the length of the window transformed.
+        U64 size = 1024;
+        // Samples between spectra. Small hops slide the previous spectrum
+        // one sample at a time instead of transforming the whole window.
+        U64 hop = 8;
+        // Applies a Hann window in the frequency domain.
+        bool window = true;
+        // Moves the zero frequency to the middle of the spectrum.
+        bool center = true;
+
+        JST_SERDES(size, hop, window, center);
+    };
+
+    constexpr const Config& getConfig() const {
+        return config;
+    }
+
+    // Input
+
+    struct Input {
+        Tensor<D, T> buffer;
+
+        JST_SERDES_INPUT(buffer);
+    };
+
+    constexpr const Input& getInput() const {
+        return input;
+    }
+
+    // Output
+
+    struct Output {
+        Tensor<D, T> buffer;
+
+        JST_SERDES_OUTPUT(buffer);
+    };
+
+    constexpr const Output& getOutput() const {
+        return output;
+    }
+
+    constexpr const Tensor<D, T>& getOutputBuffer() const {
+        return this->output.buffer;
+    }
+
+    // Taint & Housekeeping
+
+    constexpr Device device() const {
+        return D;
+    }
+
+    void info() const final;
+
+    // Constructor
+
+    Result create();
+
+ protected:
+    Result createCompute(const Context& ctx) final;
+    Result destroyCompute(const Context& ctx) final;
+    Result compute(const Context& ctx) final;
+
+ private:
+    struct Impl;
+    std::unique_ptr<Impl> impl;
+
+    JST_DEFINE_IO()
+};
+
+#ifdef JETSTREAM_MODULE_SLIDING_FFT_CPU_AVAILABLE
+JST_SLIDING_FFT_CPU(JST_SPECIALIZATION);
+#endif
+
+}  // namespace Jetstream
+
+#endif
@@ -14,7 +14,9 @@
 namespace Jetstream {
 
 #define JST_SOAPY_CPU(MACRO) \
-    MACRO(Soapy, CPU, CF32)
+    MACRO(Soapy, CPU, CF32) \
+    MACRO(Soapy, CPU, CI16) \
+    MACRO(Soapy, CPU, CI8)
 
 template<Device D, typename T = CF32>
 class Soapy : public Module, public Compute {
@@ -45,11 +47,18 @@ class Soapy : public Module, public Compute {
         U64 numberOfBatches = 8;
         U64 numberOfTimeSamples = 8192;
         U64 bufferMultiplier = 4;
+        U64 numberOfChannels = 1;
+        // Grow the buffer depth after overflows and shrink it while it stays
+        // shallow. The depth starts at `bufferMultiplier` frames and never
+        // holds more than `maxLatencyMs` of samples.
+        bool adaptiveBuffer = false;
+        F32 maxLatencyMs = 500.0f;
 
         JST_SERDES(deviceString, streamString,
                    frequency, sampleRate, automaticGain,
                    numberOfBatches, numberOfTimeSamples,
-                   bufferMultiplier);
+                   bufferMultiplier, numberOfChannels,
+                   adaptiveBuffer, maxLatencyMs);
     };
 
     constexpr const Config& getConfig() const {
@@ -97,11 +106,16 @@ class Soapy : public Module, public Compute {
 
     // Miscellaneous
 
-    Memory::CircularBuffer<T>& getCircularBuffer();
+    Memory::CircularBuffer<T>& getCircularBuffer(const U64& channel = 0);
     const std::string& getDeviceName() const;
     const std::string& getDeviceHardwareKey() const;
     const std::string& getDeviceLabel() const;
 
+    // Frames the buffer holds before dropping samples, and the seconds of
+    // samples currently buffered.
+    U64 getBufferDepth() const;
+    F32 getBufferLatency() const;
+
     Result setTunerFrequency(F32& frequency);
     Result setSampleRate(F32& sampleRate);
     Result setAutomaticGain(bool& automaticGain);
@@ -113,6 +127,12 @@ class Soapy : public Module, public Compute {
     Result compute(const Context& ctx) final;
     Result computeReady() final;
 
+    constexpr bool computeRealtime() const final {
+        return true;
+    }
+
+    std::vector<BufferStatistics> computeBuffers() const final;
+
  private:
     struct Impl;
     std::unique_ptr<Impl> impl;
@@ -0,0 +1,139 @@
+#ifndef JETSTREAM_MODULES_SOAPY_SINK_HH
+#define JETSTREAM_MODULES_SOAPY_SINK_HH
+
+#include "jetstream/logger.hh"
+#include "jetstream/module.hh"
+#include "jetstream/types.hh"
+
+#include "jetstream/memory/base.hh"
+#include "jetstream/modules/soapy.hh"
+#include "jetstream/compute/graph/base.hh"
+
+namespace Jetstream {
+
+#define JST_SOAPY_SINK_CPU(MACRO) \
+    MACRO(SoapySink, CPU, CF32) \
+    MACRO(SoapySink, CPU, CI16)
+
+template<Device D, typename T = CF32>
+class SoapySink : public Module, public Compute {
+ public:
+    SoapySink();
+    ~SoapySink();
+
+    // Types
+
+    typedef typename Soapy<D, CF32>::DeviceList DeviceList;
+
+    // Configuration
+
+    struct Config {
+        std::string deviceString = "";
+        std::string streamString = "";
+        F32 frequency = 96.9e6;
+        F32 sampleRate = 2.0e6;
+        F32 gain = 0.0f;
+        U64 bufferMultiplier = 4;
+        // Quantize float samples to the CS16 format of the device in the
+        // graph instead of letting the driver convert them.
+        bool nativeFormat = true;
+
+        JST_SERDES(deviceString, streamString,
+                   frequency, sampleRate, gain,
+                   bufferMultiplier, nativeFormat);
+    };
+
+    constexpr const Config& getConfig() const {
+        return config;
+    }
+
+    // Input
+
+    struct Input {
+        Tensor<D, T> buffer;
+
+        JST_SERDES_INPUT(buffer);
+    };
+
+    constexpr const Input& getInput() const {
+        return input;
+    }
+
+    // Output
+
+    struct Output {
+        JST_SERDES_OUTPUT();
+    };
+
+    constexpr const Output& getOutput() const {
+        return output;
+    }
+
+    // Taint & Housekeeping
+
+    constexpr Device device() const {
+        return D;
+    }
+
+    void info() const final;
+
+    // Constructor
+
+    Result create();
+    Result destroy();
+
+    // Miscellaneous
+
+    const std::string& getDeviceName() const;
+    const std::string& getDeviceHardwareKey() const;
+    const std::string& getDeviceLabel() const;
+    // Stream format sent to the driver.
+    const std::string& getStreamFormat() const;
+
+    // Samples handed to the device.
+    U64 getSamplesSent() const;
+    // Device writes that found fewer samples than the device asked for, and
+    // the samples replaced by zeros.
+    U64 getUnderflows() const;
+    U64 getUnderflowSamples() const;
+    // Underflows reported by the driver itself.
+    U64 getDeviceUnderflows() const;
+    // Seconds of samples waiting to be transmitted.
+    F32 getBufferLatency() const;
+
+    Result setTunerFrequency(F32& frequency);
+    Result setGain(F32& gain);
+
+    static DeviceList ListAvailableDevices(const std::string& filter = "");
+
+ protected:
+    Result createCompute(const Context& ctx) final;
+    Result compute(const Context& ctx) final;
+    Result computeReady() final;
+
+    // Transmission can't wait for display sub-graphs.
+    constexpr U64 computePriority() const final {
+        return 1;
+    }
+    bool computeUrgent() const final;
+
+    constexpr bool computeRealtime() const final {
+        return true;
+    }
+
+    std::vector<BufferStatistics> computeBuffers() const final;
+
+ private:
+    struct Impl;
+    std::unique_ptr<Impl> impl;
+
+    JST_DEFINE_IO()
+};
+
+#ifdef JETSTREAM_MODULE_SOAPY_SINK_CPU_AVAILABLE
+JST_SOAPY_SINK_CPU(JST_SPECIALIZATION);
+#endif
+
+}  // namespace Jetstream
+
+#endif
@@ -86,10 +86,18 @@ class Spectrogram : public Module, public Compute, public Present {
     Result createCompute(const Context& ctx) final;
     Result compute(const Context& ctx) final;
 
+    constexpr bool computeCapturable() const final {
+        return D == Device::CUDA;
+    }
+
     Result createPresent() final;
     Result present() final;
     Result destroyPresent() final;
 
+    constexpr bool presentSnapshot() const final {
+        return D == Device::CPU;
+    }
+
  private:
     struct Impl;
     std::unique_ptr<Impl> pimpl;
@@ -0,0 +1,104 @@
+#ifndef JETSTREAM_MODULES_SPECTRUM_MEASURE_HH
+#define JETSTREAM_MODULES_SPECTRUM_MEASURE_HH
+
+#include "jetstream/logger.hh"
+#include "jetstream/module.hh"
+#include "jetstream/types.hh"
+#include "jetstream/memory/base.hh"
+#include "jetstream/compute/graph/base.hh"
+
+namespace Jetstream {
+
+#define JST_SPECTRUM_MEASURE_CPU(MACRO) \
+    MACRO(SpectrumMeasure, CPU, F32)
+
+template<Device D, typename T = F32>
+class SpectrumMeasure : public Module, public Compute {
+ public:
+    SpectrumMeasure();
+    ~SpectrumMeasure();
+
+    // Configuration
+
+    struct Config {
+        F32 sampleRate = 2.0e6f;
+        U64 numberOfPeaks = 8;
+        F32 threshold = 10.0f;
+        std::vector<F32> center = {0.0e6f};
+        std::vector<F32> bandwidth = {200.0e3f};
+
+        JST_SERDES(sampleRate, numberOfPeaks, threshold, center, bandwidth);
+    };
+
+    constexpr const Config& getConfig() const {
+        return config;
+    }
+
+    // Input
+
+    struct Input {
+        Tensor<D, T> buffer;
+
+        JST_SERDES_INPUT(buffer);
+    };
+
+    constexpr const Input& getInput() const {
+        return input;
+    }
+
+    // Output
+
+    struct Output {
+        Tensor<D, T> peaks;
+        Tensor<D, T> floor;
+        Tensor<D, T> power;
+
+        JST_SERDES_OUTPUT(peaks, floor, power);
+    };
+
+    constexpr const Output& getOutput() const {
+        return output;
+    }
+
+    constexpr const Tensor<D, T>& getOutputPeaks() const {
+        return this->output.peaks;
+    }
+
+    constexpr const Tensor<D, T>& getOutputFloor() const {
+        return this->output.floor;
+    }
+
+    constexpr const Tensor<D, T>& getOutputPower() const {
+        return this->output.power;
+    }
+
+    // Taint & Housekeeping
+
+    constexpr Device device() const {
+        return D;
+    }
+
+    void info() const final;
+
+    // Constructor
+
+    Result create();
+
+ protected:
+    Result createCompute(const Context& ctx) final;
+    Result compute(const Context& ctx) final;
+
+ private:
+    struct Impl;
+    std::unique_ptr<Impl> impl;
+
+    JST_DEFINE_IO()
+};
+
+#ifdef JETSTREAM_MODULE_SPECTRUM_MEASURE_CPU_AVAILABLE
+JST_SPECTRUM_MEASURE_CPU(JST_SPECIALIZATION);
+#endif
+
+}  // namespace Jetstream
+
+#endif
@@ -25,8 +25,11 @@ class Throttle : public Module, public Compute {
 
     struct Config {
         U64 intervalMs = 100;  // Throttle interval in milliseconds
+        // Samples per second. Paces each input by its number of samples
+        // instead of the interval when not zero.
+        F64 sampleRate = 0.0;
 
-        JST_SERDES(intervalMs);
+        JST_SERDES(intervalMs, sampleRate);
     };
 
     constexpr const Config& getConfig() const {
@@ -81,10 +84,24 @@ class Throttle : public Module, public Compute {
 
     const U64& intervalMs(const U64& intervalMs);
 
+    constexpr F64 sampleRate() const {
+        return this->config.sampleRate;
+    }
+
+    const F64& sampleRate(const F64& sampleRate);
+
+    // Measured inputs per second and how far the last one passed behind its deadline.
+    F64 getRate() const;
+    F64 getLateness() const;
+
  protected:
     Result compute(const Context& ctx) final;
     Result computeReady() final;
 
+    constexpr bool computeRealtime() const final {
+        return true;
+    }
+
  private:
     struct Impl;
     std::unique_ptr<Impl> impl;
@@ -14,6 +14,14 @@ namespace Jetstream {
     MACRO(Unpad, CPU, CF32) \
     MACRO(Unpad, CPU, F32)
 
+#define JST_UNPAD_CUDA(MACRO) \
+    MACRO(Unpad, CUDA, CF32) \
+    MACRO(Unpad, CUDA, F32)
+
+#define JST_UNPAD_METAL(MACRO) \
+    MACRO(Unpad, Metal, CF32) \
+    MACRO(Unpad, Metal, F32)
+
 template<Device D, typename T = CF32>
 class Unpad : public Module, public Compute {
  public:
@@ -82,6 +90,10 @@ class Unpad : public Module, public Compute {
     Result createCompute(const Context& ctx) final;
     Result compute(const Context& ctx) final;
 
+    constexpr bool computeCapturable() const final {
+        return D == Device::CUDA;
+    }
+
  private:
     struct Impl;
     std::unique_ptr<Impl> impl;
@@ -92,6 +104,12 @@ class Unpad : public Module, public Compute {
 #ifdef JETSTREAM_MODULE_UNPAD_CPU_AVAILABLE
 JST_UNPAD_CPU(JST_SPECIALIZATION);
 #endif
+#ifdef JETSTREAM_MODULE_UNPAD_CUDA_AVAILABLE
+JST_UNPAD_CUDA(JST_SPECIALIZATION);
+#endif
+#ifdef JETSTREAM_MODULE_UNPAD_METAL_AVAILABLE
+JST_UNPAD_METAL(JST_SPECIALIZATION);
+#endif
 
 }  // namespace Jetstream
 
@@ -12,13 +12,26 @@
 namespace Jetstream {
 
 #define JST_WATERFALL_CPU(MACRO) \
-    MACRO(Waterfall, CPU, F32)
+    MACRO(Waterfall, CPU, F32) \
+    MACRO(Waterfall, CPU, CF32)
 
 #define JST_WATERFALL_METAL(MACRO) \
-    MACRO(Waterfall, Metal, F32)
+    MACRO(Waterfall, Metal, F32) \
+    MACRO(Waterfall, Metal, CF32)
 
 #define JST_WATERFALL_CUDA(MACRO) \
-    MACRO(Waterfall, CUDA, F32)
+    MACRO(Waterfall, CUDA, F32) \
+    MACRO(Waterfall, CUDA, CF32)
+
+#define JST_WATERFALL_VULKAN(MACRO) \
+    MACRO(Waterfall, Vulkan, F32) \
+    MACRO(Waterfall, Vulkan, CF32)
+
+// Type of the waterfall history. Float32 keeps the input as it arrives.
+// Unorm16 and Unorm8 keep each value mapped to [0, 1] as 16 or 8-bit
+// integers, cutting the memory and the uploads of the history by two to
+// eight times.
+JST_SERDES_ENUM(WaterfallStorage, Float32, Unorm16, Unorm8);
 
 template<Device D, typename T = F32>
 class Waterfall : public Module, public Compute, public Present {
@@ -34,8 +47,31 @@ class Waterfall : public Module, public Compute, public Present {
         U64 height = 512;
         bool interpolate = true;
         Extent2D<U64> viewSize = {512, 384};
-
-        JST_SERDES(zoom, offset, height, interpolate, viewSize);
+        // Draws the input in decibels full scale mapped from `range` instead
+        // of as values between zero and one. Real inputs are then linear
+        // power. Complex inputs are the bins of a forward FFT and are always
+        // drawn in decibels. The conversion happens in the shader, so a new
+        // range applies to the whole history.
+        bool decibels = false;
+        Range<F32> range = {-100.0, 0.0};
+        // Compact types quantize each row against the range as it arrives,
+        // so a new range only applies to the next rows.
+        WaterfallStorage storage = WaterfallStorage::Float32;
+        // Memory-mapped file keeping `historyDepth` rows of scrollback,
+        // disabled when empty. CPU only. Each of the `historyLevels` levels
+        // halves the rows and bins of the previous one keeping the peak, so
+        // zoomed-out views stream less from the disk.
+        std::string historyPath = "";
+        U64 historyDepth = 262144;
+        U64 historyLevels = 4;
+        // Rows between the newest row drawn and the newest row written, in
+        // rows of the level drawn. Zero follows the input, other values hold
+        // the view where it was when set.
+        U64 scrollback = 0;
+        U64 historyLevel = 0;
+
+        JST_SERDES(zoom, offset, height, interpolate, viewSize, decibels, range, storage,
+                   historyPath, historyDepth, historyLevels, scrollback, historyLevel);
     };
 
     constexpr const Config& getConfig() const {
@@ -75,6 +111,7 @@ class Waterfall : public Module, public Compute, public Present {
     // Constructor
 
     Result create();
+    Result destroy();
 
     // Miscellaneous
 
@@ -98,6 +135,24 @@ class Waterfall : public Module, public Compute, public Present {
     }
     const I32& offset(const I32& offset);
 
+    constexpr const Range<F32>& range() const {
+        return config.range;
+    }
+    const Range<F32>& range(const Range<F32>& range);
+
+    constexpr const U64& scrollback() const {
+        return config.scrollback;
+    }
+    const U64& scrollback(const U64& scrollback);
+
+    constexpr const U64& historyLevel() const {
+        return config.historyLevel;
+    }
+    const U64& historyLevel(const U64& historyLevel);
+
+    // Rows available for scrollback at the current level.
+    U64 historyRows() const;
+
     Render::Texture& getTexture();
 
  protected:
@@ -108,6 +163,10 @@ class Waterfall : public Module, public Compute, public Present {
     Result present() final;
     Result destroyPresent() final;
 
+    constexpr bool presentSnapshot() const final {
+        return D == Device::CPU;
+    }
+
  private:
     struct Impl;
     std::unique_ptr<Impl> pimpl;
@@ -127,7 +186,12 @@ JST_WATERFALL_CUDA(JST_SPECIALIZATION);
 #ifdef JETSTREAM_MODULE_WATERFALL_METAL_AVAILABLE
 JST_WATERFALL_METAL(JST_SPECIALIZATION);
 #endif
+#ifdef JETSTREAM_MODULE_WATERFALL_VULKAN_AVAILABLE
+JST_WATERFALL_VULKAN(JST_SPECIALIZATION);
+#endif
 
 }  // namespace Jetstream
 
+template <> struct jst::fmt::formatter<Jetstream::WaterfallStorage> : ostream_formatter {};
+
 #endif
@@ -69,8 +69,13 @@ class Window : public Module, public Compute {
     Result create();
 
  protected:
+    Result createCompute(const Context& ctx) final;
     Result compute(const Context& ctx) final;
 
+    constexpr bool computeShareable() const final {
+        return true;
+    }
+
  private:
     struct Impl;
     std::unique_ptr<Impl> impl;
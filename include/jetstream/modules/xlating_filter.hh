@@ -0,0 +1,91 @@
+#ifndef JETSTREAM_MODULES_XLATING_FILTER_HH
+#define JETSTREAM_MODULES_XLATING_FILTER_HH
+
+#include "jetstream/logger.hh"
+#include "jetstream/module.hh"
+#include "jetstream/types.hh"
+#include "jetstream/memory/base.hh"
+#include "jetstream/compute/graph/base.hh"
+
+namespace Jetstream {
+
+#define JST_XLATING_FILTER_CPU(MACRO) \
+    MACRO(XlatingFilter, CPU, CF32)
+
+template<Device D, typename T = CF32>
+class XlatingFilter : public Module, public Compute {
+ public:
+    XlatingFilter();
+    ~XlatingFilter();
+
+    // Configuration
+
+    struct Config {
+        U64 decimation = 4;
+
+        JST_SERDES(decimation);
+    };
+
+    constexpr const Config& getConfig() const {
+        return config;
+    }
+
+    // Input
+
+    struct Input {
+        Tensor<D, T> buffer;
+        Tensor<D, T> filter;
+
+        JST_SERDES_INPUT(buffer, filter);
+    };
+
+    constexpr const Input& getInput() const {
+        return input;
+    }
+
+    // Output
+
+    struct Output {
+        Tensor<D, T> buffer;
+
+        JST_SERDES_OUTPUT(buffer);
+    };
+
+    constexpr const Output& getOutput() const {
+        return output;
+    }
+
+    constexpr const Tensor<D, T>& getOutputBuffer() const {
+        return this->output.buffer;
+    }
+
+    // Taint & Housekeeping
+
+    constexpr Device device() const {
+        return D;
+    }
+
+    void info() const final;
+
+    // Constructor
+
+    Result create();
+
+ protected:
+    Result createCompute(const Context& ctx) final;
+    Result compute(const Context& ctx) final;
+
+ private:
+    struct Impl;
+    std::unique_ptr<Impl> impl;
+
+    JST_DEFINE_IO()
+};
+
+#ifdef JETSTREAM_MODULE_XLATING_FILTER_CPU_AVAILABLE
+JST_XLATING_FILTER_CPU(JST_SPECIALIZATION);
+#endif
+
+}  // namespace Jetstream
+
+#endif
@@ -32,11 +32,13 @@ class Parser {
         Device device = Device::None;
         std::string dataType = "";
         std::vector<U64> shape = {};
+        U64 size_bytes = 0;
         std::map<std::string, std::string> attributes = {};
         bool host_accessible = false;
         bool device_native = false;
         bool host_native = false;
         bool contiguous = false;
+        std::shared_ptr<TensorStorageMetadata> storage = {};
     };
 
     typedef std::unordered_map<std::string, Record> RecordMap;
@@ -75,11 +77,13 @@ class Parser {
             metadata.device = variable.device();
             metadata.dataType = NumericTypeInfo<typename T::DataType>::name;
             metadata.shape = variable.shape();
+            metadata.size_bytes = variable.size_bytes();
             metadata.locale = variable.locale();
             metadata.host_accessible = variable.host_accessible();
             metadata.device_native = variable.device_native();
             metadata.host_native = variable.host_native();
             metadata.contiguous = variable.contiguous();
+            metadata.storage = variable.storage_metadata();
 
             for (const auto& [key, attribute] : variable.attributes()) {
                 JST_CHECK(AnyToString(attribute.get(), metadata.attributes[key], true));
@@ -13,6 +13,17 @@ Result PickFile(std::string& path, const std::vector<std::string>& extensions =
 Result PickFolder(std::string& path);
 Result SaveFile(std::string& path);
 
+// Get the per-user cache folder, creating it if needed. Fails silently on
+// platforms without a persistent cache folder.
+Result CacheFolder(std::string& path);
+
+// Get the thermal pressure of the system, from nominal (0) through fair (1)
+// and serious (2) up to critical (3). Platforms without a reading report zero.
+U64 ThermalState();
+
+// Check whether the system asks applications to save power.
+bool LowPowerMode();
+
 }  // namespace Jetstream::Platform
 
 #endif
\ No newline at end of file
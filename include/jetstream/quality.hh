@@ -0,0 +1,123 @@
+#ifndef JETSTREAM_QUALITY_HH
+#define JETSTREAM_QUALITY_HH
+
+#include <array>
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include "jetstream/types.hh"
+#include "jetstream/macros.hh"
+
+namespace Jetstream {
+
+/**
+ * @class QualityController
+ * @brief Lowers the display work while the platform is hot or frames miss their budget.
+ *
+ * Fed with the duration of every frame drawn by the present thread. About once per second, the frames
+ * recorded since the last evaluation are compared with the frame budget, next to the overflows of the
+ * source buffers, the thermal state of the system and its low power mode. Under pressure, the first knob
+ * of the priority list not yet at its lowest level is lowered one step. Once the pressure is gone for a
+ * while, the last knob lowered is raised one step, so the knobs recover in the reverse order. A critical
+ * thermal state lowers every knob at once. A fair thermal state holds the knobs where they are.
+ *
+ * Only used from the present thread.
+ */
+class JETSTREAM_API QualityController {
+ public:
+    enum class Knob : U8 {
+        // Frames drawn per second, a fraction of the viewport framerate.
+        Framerate = 0,
+        // Computes of the sub-graphs only feeding views, like the FFT and
+        // the waterfall of a spectrum, per presented frame or compute cycle.
+        DisplayRate = 1,
+        // Pixels of the plots per pixel of the window.
+        Resolution = 2,
+    };
+
+    static constexpr U64 KnobCount = 3;
+    static constexpr U64 MaxLevel = 3;
+
+    struct Config {
+        bool enabled = false;
+        // Longest frame, in milliseconds, drawn without pressure.
+        F32 frameBudget = 1000.0f / 30.0f;
+        // Knobs in the order they're lowered. Knobs left out are never lowered.
+        std::vector<Knob> priorities = {
+            Knob::DisplayRate,
+            Knob::Resolution,
+            Knob::Framerate,
+        };
+    };
+
+    Result configure(const Config& config);
+
+    constexpr const Config& getConfig() const {
+        return config;
+    }
+
+    /**
+     * @brief Record a frame drawn by the present thread.
+     * @param frameNs Duration of the frame in nanoseconds.
+     * @return True if the knobs are due for an evaluation.
+     */
+    bool record(const U64& frameNs);
+
+    /**
+     * @brief Adjust the knobs from the frames recorded since the last evaluation.
+     * @param overflows Overflows of every buffer fed by a device so far.
+     * @return True if a knob changed.
+     */
+    bool evaluate(const U64& overflows);
+
+    // Steps below full quality of a knob, from zero to `MaxLevel`.
+    U64 level(const Knob& knob) const {
+        return levels[static_cast<U64>(knob)];
+    }
+
+    // Fraction of the viewport framerate drawn.
+    U64 framerateDivisor() const {
+        return U64(1) << level(Knob::Framerate);
+    }
+
+    // Presented frames or compute cycles per compute of the display sub-graphs.
+    U64 displayDivisor() const {
+        return U64(1) << level(Knob::DisplayRate);
+    }
+
+    // Factor applied to the pixel density of the plots.
+    F32 resolutionScale() const {
+        return 1.0f - 0.2f * static_cast<F32>(level(Knob::Resolution));
+    }
+
+    // Thermal state of the last evaluation, see `Platform::ThermalState`.
+    U64 thermalState() const {
+        return thermal;
+    }
+
+    static Result ParsePriorities(const std::string& list, std::vector<Knob>& priorities);
+    static const char* KnobName(const Knob& knob);
+
+ private:
+    typedef std::chrono::steady_clock Clock;
+
+    Config config;
+
+    std::array<U64, KnobCount> levels = {};
+    U64 thermal = 0;
+
+    Clock::time_point windowStart = {};
+    Clock::time_point lastChange = {};
+    Clock::time_point lastPressure = {};
+    U64 frames = 0;
+    U64 slowFrames = 0;
+    U64 lastOverflows = 0;
+
+    bool lower();
+    bool raise();
+};
+
+}  // namespace Jetstream
+
+#endif
@@ -48,6 +48,12 @@ class Surface : public WindowAttachment {
     }
     virtual const Extent2D<U64>& size(const Extent2D<U64>& size) = 0;
 
+    // Draws the surface in the next frame. Surfaces not updated keep
+    // their last framebuffer.
+    void update() {
+        updated = true;
+    }
+
     template<Device D>
     static std::shared_ptr<Surface> Factory(const Config& config) {
         return std::make_shared<SurfaceImp<D>>(config);
@@ -55,6 +61,7 @@ class Surface : public WindowAttachment {
 
  protected:
     Config config;
+    bool updated = true;
 };
 
 }  // namespace Jetstream::Render
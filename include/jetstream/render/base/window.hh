@@ -1,10 +1,14 @@
 #ifndef JETSTREAM_RENDER_BASE_WINDOW_HH
 #define JETSTREAM_RENDER_BASE_WINDOW_HH
 
+#include <span>
 #include <queue>
 #include <memory>
 #include <thread>
 #include <mutex>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
 
 #include "jetstream/render/base/window_attachment.hh"
 #include "jetstream/types.hh"
@@ -28,8 +32,12 @@ class Window {
  public:
     struct Config {
         F32 scale = 1.0f;
+        // Only draw frames after input, new data or an invalidation.
+        bool renderOnDemand = false;
+        // Frames recorded while the previous ones still execute. Vulkan only.
+        U64 framesInFlight = 2;
 
-        JST_SERDES(scale);
+        JST_SERDES(scale, renderOnDemand, framesInFlight);
     };
 
     struct Stats {
@@ -55,6 +63,13 @@ class Window {
 
     Result synchronize();
 
+    // Requests a new frame when rendering on demand. Thread-safe.
+    void invalidate();
+
+    // Sends a tensor to remote clients when the viewport streams tensors.
+    bool streamsTensors() const;
+    Result pushTensor(const std::string& id, const std::span<const F32>& data, const F32& min, const F32& max);
+
     virtual const Stats& stats() const = 0;
     virtual void drawDebugMessage() const = 0;
 
@@ -107,10 +122,11 @@ class Window {
         return _scalingFactor;
     }
 
+    // Fonts are created the first time they are used.
     bool hasFont(const std::string& name) const;
     Result addFont(const std::string& name, const std::shared_ptr<Components::Font>& font);
     Result removeFont(const std::string& name);
-    const std::shared_ptr<Components::Font>& font(const std::string& name) const;
+    const std::shared_ptr<Components::Font>& font(const std::string& name);
 
  protected:
     Config config;
@@ -126,9 +142,17 @@ class Window {
 
     virtual Result underlyingSynchronize() = 0;
 
+    virtual bool underlyingStreamsTensors() const = 0;
+    virtual Result underlyingPushTensor(const std::string& id,
+                                        const std::span<const F32>& data,
+                                        const F32& min,
+                                        const F32& max) = 0;
+
     // Font.
 
     std::unordered_map<std::string, std::shared_ptr<Components::Font>> fonts;
+    std::unordered_map<std::string, std::shared_ptr<Components::Font>> pendingFonts;
+    mutable std::mutex fontMutex;
 
     // Style scaling.
 
@@ -160,6 +184,23 @@ class Window {
 
     Result processAttachmentQueues();
 
+    // Render On Demand State
+
+    // Frames drawn after an invalidation to let the interface settle.
+    static constexpr U64 SettleFrames = 3;
+    // Longest time without a frame.
+    static constexpr std::chrono::milliseconds IdleFrameInterval{1000};
+    // Longest wait for an invalidation before checking for input again.
+    static constexpr std::chrono::milliseconds IdlePollInterval{10};
+
+    bool frameRequested();
+
+    std::atomic<bool> invalidated{true};
+    std::mutex invalidateMutex;
+    std::condition_variable invalidateCond;
+    U64 settleFrames = 0;
+    std::chrono::steady_clock::time_point lastFrameTime;
+
     std::queue<std::shared_ptr<WindowAttachment>> bindQueue;
     std::queue<std::shared_ptr<WindowAttachment>> unbindQueue;
     std::queue<PendingDestruction> destroyQueue;
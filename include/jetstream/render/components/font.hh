@@ -22,6 +22,9 @@ class Font : public Generic {
     Result create(Window* window);
     Result destroy(Window* window);
 
+    // Upload the glyphs rendered since the last call.
+    Result present();
+
     constexpr const Config& getConfig() const {
         return config;
     }
@@ -37,7 +40,11 @@ class Font : public Generic {
         F32 xAdvance;
     };
 
-    const Glyph& glyph(const I32& code) const;
+    // Printable ASCII glyphs, indexed from the space character.
+    static constexpr I32 GlyphCount = 95;
+
+    // Renders the glyph into the atlas when first used.
+    const Glyph& glyph(const I32& code);
     const Extent2D<I32>& atlasSize() const;
     const std::shared_ptr<Render::Texture>& atlas() const;
 
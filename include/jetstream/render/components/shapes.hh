@@ -10,9 +10,12 @@
 
 namespace Jetstream::Render::Components {
 
-// TODO: Add support for zero-copy buffers.
 // TODO: Implement proper rotation.
 
+// Instance attributes live in host memory mapped zero-copy by the render
+// device when possible. Otherwise, the update methods mark a range of
+// instances and only the marked ranges are uploaded by the next present.
+
 class Shapes : public Generic {
  public:
     enum class Type : uint32_t {
@@ -50,15 +53,19 @@ class Shapes : public Generic {
 
     Result getColors(const std::string& elementId, std::span<ColorRGBA<F32>>& colors) const;
     Result updateColors(const std::string& elementId = {});
+    Result updateColors(const std::string& elementId, const U64& offset, const U64& size);
 
     Result getRotations(const std::string& elementId, std::span<F32>& rotations) const;
     Result updateRotations(const std::string& elementId = {});
+    Result updateRotations(const std::string& elementId, const U64& offset, const U64& size);
 
     Result getPositions(const std::string& elementId, std::span<Extent2D<F32>>& positions) const;
     Result updatePositions(const std::string& elementId = {});
+    Result updatePositions(const std::string& elementId, const U64& offset, const U64& size);
 
     Result getSizes(const std::string& elementId, std::span<Extent2D<F32>>& sizes) const;
     Result updateSizes(const std::string& elementId = {});
+    Result updateSizes(const std::string& elementId, const U64& offset, const U64& size);
 
     Result updatePixelSize(const Extent2D<F32>& pixelSize);
 
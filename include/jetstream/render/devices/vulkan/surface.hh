@@ -19,6 +19,9 @@ class SurfaceImp<Device::Vulkan> : public Surface {
  protected:
     Result encode(VkCommandBuffer& commandBuffer);
 
+    // The frames in flight have to finish before a resize.
+    bool resizeRequested() const;
+
  private:
     std::shared_ptr<TextureImp<Device::Vulkan>> framebufferResolve;
     std::shared_ptr<TextureImp<Device::Vulkan>> framebuffer;
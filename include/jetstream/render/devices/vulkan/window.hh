@@ -33,6 +33,12 @@ class WindowImp<Device::Vulkan> : public Window {
 
     Result underlyingSynchronize() override;
 
+    bool underlyingStreamsTensors() const override;
+    Result underlyingPushTensor(const std::string& id,
+                                const std::span<const F32>& data,
+                                const F32& min,
+                                const F32& max) override;
+
  private:
     Stats statsData;
     ImGuiIO* io = nullptr;
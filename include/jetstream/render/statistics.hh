@@ -0,0 +1,64 @@
+#ifndef JETSTREAM_RENDER_STATISTICS_HH
+#define JETSTREAM_RENDER_STATISTICS_HH
+
+#include <atomic>
+
+#include "jetstream/types.hh"
+#include "jetstream/macros.hh"
+
+namespace Jetstream::Render {
+
+/**
+ * @class Statistics
+ * @brief Process-wide counters of the work submitted by the render backends.
+ *
+ * Counters only grow, readers take the difference between two snapshots.
+ */
+class JETSTREAM_API Statistics {
+ public:
+    struct Snapshot {
+        U64 drawCalls = 0;
+        U64 bufferUploadBytes = 0;
+        U64 textureUploadBytes = 0;
+
+        Snapshot operator-(const Snapshot& other) const {
+            return {
+                drawCalls - other.drawCalls,
+                bufferUploadBytes - other.bufferUploadBytes,
+                textureUploadBytes - other.textureUploadBytes,
+            };
+        }
+    };
+
+    static void CountDraws(const U64& count) {
+        Get().drawCalls.fetch_add(count, std::memory_order_relaxed);
+    }
+
+    static void CountBufferUpload(const U64& bytes) {
+        Get().bufferUploadBytes.fetch_add(bytes, std::memory_order_relaxed);
+    }
+
+    static void CountTextureUpload(const U64& bytes) {
+        Get().textureUploadBytes.fetch_add(bytes, std::memory_order_relaxed);
+    }
+
+    static Snapshot Read() {
+        const auto& s = Get();
+        return {
+            s.drawCalls.load(std::memory_order_relaxed),
+            s.bufferUploadBytes.load(std::memory_order_relaxed),
+            s.textureUploadBytes.load(std::memory_order_relaxed),
+        };
+    }
+
+ private:
+    static Statistics& Get();
+
+    std::atomic<U64> drawCalls{0};
+    std::atomic<U64> bufferUploadBytes{0};
+    std::atomic<U64> textureUploadBytes{0};
+};
+
+}  // namespace Jetstream::Render
+
+#endif
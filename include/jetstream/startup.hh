@@ -0,0 +1,80 @@
+#ifndef JETSTREAM_STARTUP_HH
+#define JETSTREAM_STARTUP_HH
+
+#include <string>
+#include <vector>
+
+#include "jetstream/types.hh"
+#include "jetstream/macros.hh"
+
+namespace Jetstream {
+
+/**
+ * @class StartupProfile
+ * @brief Process-wide record of the time spent in each phase of the startup.
+ *
+ * Phases are recorded from the start of the process until `Finish` is called, later phases
+ * are ignored. Phases can be nested and recorded from any thread. Phases with the same name
+ * are merged in the report, so repeated work like pipeline creation shows up as one line.
+ * Phases are also recorded as spans while the tracer is enabled.
+ */
+class JETSTREAM_API StartupProfile {
+ public:
+    struct Phase {
+        std::string name;
+        // Nesting level in the thread that recorded the phase.
+        U64 depth = 0;
+        // Times in milliseconds since the start of the profile.
+        F64 start = 0.0;
+        F64 duration = 0.0;
+    };
+
+    /**
+     * @class Scope
+     * @brief Record the lifetime of the object as a startup phase.
+     */
+    class JETSTREAM_API Scope {
+     public:
+        explicit Scope(const char* name);
+        ~Scope();
+
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+     private:
+        const char* name;
+        bool active;
+        U64 start;
+    };
+
+    /**
+     * @brief Stop recording. The total startup time is measured up to the first call.
+     */
+    static void Finish();
+
+    /**
+     * @brief Check if phases are still being recorded.
+     */
+    static bool Recording();
+
+    /**
+     * @brief Get the recorded phases in the order they started.
+     */
+    static std::vector<Phase> Phases();
+
+    /**
+     * @brief Get the total startup time in milliseconds.
+     */
+    static F64 Total();
+
+    /**
+     * @brief Format the recorded phases as a table with their count, duration and share.
+     */
+    static std::string Report();
+};
+
+}  // namespace Jetstream
+
+#define JST_STARTUP_PHASE(name) Jetstream::StartupProfile::Scope JST_UNIQUE(_jstStartupPhase)(name)
+
+#endif
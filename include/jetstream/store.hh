@@ -1,6 +1,8 @@
 #ifndef JETSTREAM_STORE_HH
 #define JETSTREAM_STORE_HH
 
+#include <mutex>
+
 #include "jetstream/parser.hh"
 #include "jetstream/instance.hh"
 
@@ -24,6 +26,7 @@ class JETSTREAM_API Store {
     }
 
     static const Block::ConstructorManifest& BlockConstructorList() {
+        GetInstance()._loadBlockManifest();
         return GetInstance().blockConstructorList;
     }
 
@@ -40,21 +43,31 @@ class JETSTREAM_API Store {
  private:
     Store();
 
-    Result _loadBlocks(const BlockLoaderFunc& loader) {
-        JST_CHECK(loader(blockConstructorList, blockMetadataList));
-        blockFilteredMetadataList.clear();
-        return Result::SUCCESS;
-    }
+    // Lowercase text matched by the search of every entry.
+    typedef std::unordered_map<std::string, std::string> SearchIndex;
+
+    // The manifests are only built when first used.
+    std::once_flag blockManifestFlag;
+    std::once_flag flowgraphManifestFlag;
 
     Block::ConstructorManifest blockConstructorList;
     Block::MetadataManifest blockMetadataList;
     Block::MetadataManifest blockFilteredMetadataList;
+    SearchIndex blockSearchIndex;
     std::string lastBlockFilter;
+    bool blockFilterValid = false;
 
     Flowgraph::MetadataManifest flowgraphMetadataList;
     Flowgraph::MetadataManifest filteredFlowgraphMetadataList;
+    SearchIndex flowgraphSearchIndex;
     std::string lastFlowgraphFilter;
+    bool flowgraphFilterValid = false;
+
+    void _loadBlockManifest();
+    void _loadFlowgraphManifest();
+    void _indexBlocks();
 
+    Result _loadBlocks(const BlockLoaderFunc& loader);
     Result _blockList(const std::string& filter);
     Result _flowgraphList(const std::string& filter);
 };
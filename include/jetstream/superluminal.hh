@@ -1,6 +1,8 @@
 #ifndef JETSTREAM_SUPERLUMINAL_HH
 #define JETSTREAM_SUPERLUMINAL_HH
 
+#include <span>
+#include <memory>
 #include <thread>
 #include <variant>
 
@@ -72,6 +74,45 @@ class Superluminal {
         std::string windowTitle = "Superluminal";
         bool remote = false;
         Device preferredDevice = Device::CPU;
+        // Print the time spent in each phase of the startup once started.
+        bool profileStartup = false;
+        // Buffers queued per plot by `Push` before the oldest ones are dropped.
+        U64 pushDepth = 4;
+        // Render headless to this video file or PNG sequence (e.g. `frame-%05d.png`) instead of a window.
+        std::string output;
+    };
+
+    // Feeds the buffer of a running plot from an acquisition thread. Every plot reading
+    // the same buffer is updated. Pushes never rebuild the graph and are queued in a
+    // lock-free ring of `InstanceConfig::pushDepth` buffers. Only one thread should push.
+    // A push dropped by the overflow policy returns `Result::SKIP`.
+    class Sink {
+     public:
+        enum class OverflowPolicy : U8 {
+            DropOldest, ///< Drop the oldest queued buffer.
+            DropNewest, ///< Drop the incoming buffer.
+            Block,      ///< Wait for a compute cycle to free space. Drops the incoming buffer after a 5 seconds timeout.
+        };
+
+        Sink();
+        ~Sink();
+
+        // Copies the elements into a queued buffer. The size has to match the plot buffer, which has to be on the CPU.
+        Result push(const std::span<const F32>& data);
+        Result push(const std::span<const CF32>& data);
+
+        // Queues the tensor without copying and hands back a recycled one, either empty or
+        // with the shape of the plot buffer. The queued tensor shouldn't be written anymore.
+        Result push(VariantBufferType& buffer);
+
+        // Buffers dropped by the overflow policy since the creation.
+        U64 dropped() const;
+
+     private:
+        struct Impl;
+        std::unique_ptr<Impl> impl;
+
+        friend class Superluminal;
     };
 
     static Result Initialize(const InstanceConfig& config = {}) {
@@ -98,6 +139,21 @@ class Superluminal {
         return GetInstance()->update(name);
     }
 
+    static Result Update(const std::string& name, const VariantBufferType& buffer) {
+        return GetInstance()->update(name, buffer);
+    }
+
+    static Result Push(const std::string& name, const VariantBufferType& buffer) {
+        return GetInstance()->push(name, buffer);
+    }
+
+    // The sink is valid until `Stop`, pushing afterwards fails.
+    static Result Stream(const std::string& name,
+                         std::shared_ptr<Sink>& sink,
+                         const Sink::OverflowPolicy& policy = Sink::OverflowPolicy::DropOldest) {
+        return GetInstance()->stream(name, sink, policy);
+    }
+
     static Result Block() {
         return GetInstance()->block();
     }
@@ -192,6 +248,9 @@ class Superluminal {
 
     bool presenting();
     Result update(const std::string& name = {});
+    Result update(const std::string& name, const VariantBufferType& buffer);
+    Result push(const std::string& name, const VariantBufferType& buffer);
+    Result stream(const std::string& name, std::shared_ptr<Sink>& sink, const Sink::OverflowPolicy& policy);
 
     Result block();
     Result pollEvents(const bool& wait = true);
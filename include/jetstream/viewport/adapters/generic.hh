@@ -1,11 +1,14 @@
 #ifndef JETSTREAM_ADAPTER_GENERIC_HH
 #define JETSTREAM_ADAPTER_GENERIC_HH
 
+#include <span>
+
 #include "jetstream/logger.hh"
 #include "jetstream/types.hh"
 #include "jetstream/macros.hh"
 #include "jetstream/parser.hh"
 #include "jetstream/viewport/types.hh"
+#include "jetstream/compute/latency.hh"
 #include "jetstream/render/tools/imgui.h"
 
 namespace Jetstream::Viewport {
@@ -36,7 +39,17 @@ struct Config {
     /// @brief Whether hardware acceleration is enabled.
     bool hardwareAcceleration = true;
 
-    JST_SERDES(vsync, title, size, framerate, broker, codec, autoJoin, hardwareAcceleration);
+    /// @brief Whether the remote viewport lowers its bitrate and framerate when consumers lose packets.
+    bool adaptiveStreaming = true;
+
+    /// @brief Whether the remote viewport sends plotted tensors over the data channel and only a preview video.
+    bool streamTensors = false;
+
+    /// @brief The file the headless viewport records to instead of streaming. Empty to stream.
+    std::string output;
+
+    JST_SERDES(vsync, title, size, framerate, broker, codec, autoJoin, hardwareAcceleration, adaptiveStreaming,
+               streamTensors, output);
 };
 
 class Generic {
@@ -56,6 +69,19 @@ class Generic {
 
     virtual F32 scale(const F32& scale) const = 0;
 
+    // Tensor streaming to remote clients. Only remote viewports implement it.
+    virtual bool streamsTensors() const {
+        return false;
+    }
+    virtual Result pushTensor(const std::string&, const std::span<const F32>&, const F32&, const F32&) {
+        return Result::SUCCESS;
+    }
+
+    // Time spent encoding each frame. Only remote viewports encode frames.
+    virtual const LatencyHistogram* encodeLatency() const {
+        return nullptr;
+    }
+
     virtual Result waitEvents() = 0;
     virtual Result pollEvents() = 0;
     virtual bool keepRunning() = 0;
@@ -0,0 +1,31 @@
+#ifndef JETSTREAM_VIEWPORT_PLATFORM_HEADLESS_RECORDER_HH
+#define JETSTREAM_VIEWPORT_PLATFORM_HEADLESS_RECORDER_HH
+
+#include "jetstream/viewport/adapters/generic.hh"
+
+namespace Jetstream::Viewport {
+
+// Writes the frames of a headless viewport to `Config::output` instead of
+// streaming them. Paths with a frame number pattern (e.g. `frame-%05d.png`)
+// are written as a PNG sequence, any other path as a video encoded with
+// `Config::codec`. Frames are timestamped at `Config::framerate` and never
+// dropped, the renderer waits for the encoder instead.
+class Recorder {
+ public:
+    Recorder();
+    ~Recorder();
+
+    Result create(const Viewport::Config& config);
+    Result destroy();
+
+    // Expects a BGRA frame in host memory. Copied before returning.
+    Result pushNewFrame(const void* data);
+
+ private:
+    struct Impl;
+    std::unique_ptr<Impl> pimpl;
+};
+
+}  // namespace Jetstream::Viewport
+
+#endif
@@ -1,6 +1,8 @@
 #ifndef JETSTREAM_VIEWPORT_PLATFORM_HEADLESS_REMOTE_HH
 #define JETSTREAM_VIEWPORT_PLATFORM_HEADLESS_REMOTE_HH
 
+#include <span>
+
 #include "jetstream/viewport/adapters/generic.hh"
 
 namespace Jetstream::Viewport {
@@ -16,6 +18,17 @@ class Remote {
     const Device& inputMemoryDevice() const;
 
     Result pushNewFrame(const void* data);
+    // Used when the input memory device is Vulkan. The descriptor is
+    // a DMA-BUF holding a linear BGRA frame and is not taken over.
+    Result pushNewFrame(const I32& dmabuf);
+
+    // Sends a tensor quantized to 8 bits between `min` and `max` to every
+    // consumer over the unreliable `tensors` data channel.
+    Result pushTensor(const std::string& id, const std::span<const F32>& data, const F32& min, const F32& max);
+
+    // Framerate the viewport should render at. Lowered while consumers
+    // are congested when adaptive streaming is enabled.
+    U64 framerate() const;
 
  private:
     struct Impl;
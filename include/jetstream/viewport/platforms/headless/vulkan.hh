@@ -1,6 +1,7 @@
 #ifndef JETSTREAM_VIEWPORT_PLATFORM_HEADLESS_VULKAN_HH
 #define JETSTREAM_VIEWPORT_PLATFORM_HEADLESS_VULKAN_HH
 
+#include <atomic>
 #include <chrono>
 #include <queue>
 #include <thread>
@@ -10,12 +11,23 @@
 
 #include "jetstream/viewport/adapters/vulkan.hh"
 #include "jetstream/viewport/platforms/headless/generic.hh"
+#include "jetstream/viewport/platforms/headless/recorder.hh"
 
 namespace Jetstream::Viewport {
 
 template<>
 class Headless<Device::Vulkan> : public Adapter<Device::Vulkan> {
  public:
+    struct Stats {
+        U64 frames;
+        // Time the encoder worker waited for readbacks to finish.
+        F64 readbackTime;
+        // Time the encoder held frames.
+        F64 encodeTime;
+        // Time the renderer waited for a free drawable.
+        F64 stallTime;
+    };
+
     explicit Headless(const Config& config);
     virtual ~Headless();
 
@@ -42,6 +54,9 @@ class Headless<Device::Vulkan> : public Adapter<Device::Vulkan> {
     Result destroyImgui();
     F32 scale(const F32& scale) const;
 
+    bool streamsTensors() const;
+    Result pushTensor(const std::string& id, const std::span<const F32>& data, const F32& min, const F32& max);
+
     Result createSwapchain();
     Result destroySwapchain();
 
@@ -56,11 +71,23 @@ class Headless<Device::Vulkan> : public Adapter<Device::Vulkan> {
     U32 getSwapchainImageViewsCount() const;
     const VkExtent2D& getSwapchainExtent() const;
 
+    Stats stats() const;
+
+    const LatencyHistogram* encodeLatency() const {
+        return &encodeHistogram;
+    }
+
  private:
-    const static U32 MAX_FRAMES_IN_FLIGHT = 2;
+    // One drawable renders while one is read back and one is encoded.
+    const static U32 MAX_FRAMES_IN_FLIGHT = 3;
 
     std::array<Tensor<Device::Vulkan, U8>, MAX_FRAMES_IN_FLIGHT> stagingBuffers;
 
+    // Staging buffers exported as DMA-BUF when the encoder reads Vulkan memory.
+    std::array<VkBuffer, MAX_FRAMES_IN_FLIGHT> dmabufBuffers;
+    std::array<VkDeviceMemory, MAX_FRAMES_IN_FLIGHT> dmabufMemory;
+    std::array<I32, MAX_FRAMES_IN_FLIGHT> dmabufDescriptors;
+
     std::chrono::steady_clock::time_point lastTime;
     std::array<VkImage, MAX_FRAMES_IN_FLIGHT> swapchainImages;
     std::array<VkImageView, MAX_FRAMES_IN_FLIGHT> swapchainImageViews;
@@ -75,6 +102,7 @@ class Headless<Device::Vulkan> : public Adapter<Device::Vulkan> {
     U32 _currentDrawableIndex;
 
     Remote remote;
+    Recorder recorder;
     std::queue<U64> endpointFrameSubmissionQueue;
     std::mutex endpointFrameSubmissionMutex;
     std::condition_variable endpointFrameSubmissionCondition;
@@ -82,7 +110,20 @@ class Headless<Device::Vulkan> : public Adapter<Device::Vulkan> {
     bool endpointFrameSubmissionRunning;
     std::optional<Result> endpointFrameSubmissionResult;
 
+    std::atomic<U64> statsFrames;
+    std::atomic<U64> statsReadbackTime;
+    std::atomic<U64> statsEncodeTime;
+    std::atomic<U64> statsStallTime;
+    LatencyHistogram encodeHistogram;
+    std::chrono::steady_clock::time_point statsLastReport;
+
     void endpointFrameSubmissionLoop();
+
+    bool recording() const;
+    Device inputMemoryDevice() const;
+
+    Result createDmaBufStagingBuffer(const U64& index);
+    void destroyDmaBufStagingBuffer(const U64& index);
 };
 
 }  // namespace Jetstream::Viewport
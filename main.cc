@@ -1,9 +1,13 @@
 #include <thread>
+#include <csignal>
 
 #include "jetstream/base.hh"
 
 using namespace Jetstream;
 
+// Set by SIGINT and SIGTERM. Compute-only instances have no window to close.
+static volatile std::sig_atomic_t interrupted = 0;
+
 #ifdef JST_OS_BROWSER
 extern "C" {
 EMSCRIPTEN_KEEPALIVE
@@ -22,7 +26,30 @@ int main(int argc, char* argv[]) {
     Backend::Config backendConfig;
     Viewport::Config viewportConfig;
     Render::Window::Config renderConfig;
+    Scheduler::Config schedulerConfig;
+    CPUMemoryHints memoryHints;
+    ThreadPolicies threadPolicies;
+    U64 warmBlockVariants = 0;
     std::string flowgraphPath;
+    std::string convertInputPath;
+    std::string convertOutputPath;
+    std::string tracePath;
+    Sampler::Config samplerConfig;
+    bool samplerEnabled = false;
+    MetricsServer::Config metricsConfig;
+    bool metricsEnabled = false;
+    bool profileStartup = false;
+    bool workerEnabled = false;
+    bool computeOnly = false;
+    QualityController::Config qualityConfig;
+    U64 workerPort = 5100;
+    std::string workerAddress = "127.0.0.1";
+    std::string workerToken;
+    Benchmark::FlowgraphConfig flowgraphBenchmark;
+    Benchmark::Options benchmarkOptions;
+    std::string benchmarkOutput;
+    std::string benchmarkBaseline;
+    bool renderBenchmark = false;
     Device prefferedBackend = Device::None;
 
     for (int i = 1; i < argc; i++) {
@@ -30,9 +57,53 @@ int main(int argc, char* argv[]) {
 
         if (arg == "--remote") {
             backendConfig.remote = true;
+            // Only changed frames are worth encoding.
+            renderConfig.renderOnDemand = true;
+
+            continue;
+        }
+
+        if (arg == "--record") {
+            if (i + 1 < argc) {
+                backendConfig.remote = true;
+                viewportConfig.output = argv[++i];
+            }
+
+            continue;
+        }
+
+        if (arg == "--worker") {
+            workerEnabled = true;
+            if (i + 1 < argc && !std::string(argv[i + 1]).starts_with("--")) {
+                workerPort = std::stoul(argv[++i]);
+            }
+
+            continue;
+        }
+
+        if (arg == "--worker-address") {
+            if (i + 1 < argc) {
+                workerAddress = argv[++i];
+            }
+
+            continue;
+        }
+
+        if (arg == "--worker-token") {
+            if (i + 1 < argc) {
+                workerToken = argv[++i];
+            }
+
+            continue;
+        }
+
+#ifndef JST_OS_BROWSER
+        if (arg == "--compute-only") {
+            computeOnly = true;
 
             continue;
         }
+#endif
 
         if (arg == "--broker") {
             if (i + 1 < argc) {
@@ -70,18 +141,132 @@ int main(int argc, char* argv[]) {
             continue;
         }
 
+        if (arg == "--stream-tensors") {
+            viewportConfig.streamTensors = true;
+
+            continue;
+        }
+
+        if (arg == "--no-adaptive-streaming") {
+            viewportConfig.adaptiveStreaming = false;
+
+            continue;
+        }
+
+        if (arg == "--adaptive-quality") {
+            qualityConfig.enabled = true;
+            if (i + 1 < argc && !std::string(argv[i + 1]).starts_with("--")) {
+                JST_CHECK_THROW(QualityController::ParsePriorities(argv[++i], qualityConfig.priorities));
+            }
+
+            continue;
+        }
+
+        if (arg == "--frame-budget") {
+            if (i + 1 < argc) {
+                qualityConfig.frameBudget = std::stof(argv[++i]);
+            }
+
+            continue;
+        }
+
         if (arg == "--benchmark") {
             // TODO: Add check for valid output type.
 
-            std::string outputType = "markdown";
+            benchmarkOutput = "markdown";
+
+            if (i + 1 < argc && !std::string(argv[i + 1]).starts_with("--")) {
+                benchmarkOutput = std::string(argv[++i]);
+            }
+
+            continue;
+        }
 
+        if (arg == "--benchmark-compare") {
             if (i + 1 < argc) {
-                outputType = std::string(argv[++i]);
+                benchmarkBaseline = argv[++i];
             }
 
-            Benchmark::Run(outputType);
+            continue;
+        }
+
+        if (arg == "--benchmark-module") {
+            if (i + 1 < argc) {
+                benchmarkOptions.module = argv[++i];
+            }
 
-            return 0;
+            continue;
+        }
+
+        if (arg == "--benchmark-device") {
+            if (i + 1 < argc) {
+                benchmarkOptions.device = argv[++i];
+            }
+
+            continue;
+        }
+
+        if (arg == "--benchmark-type") {
+            if (i + 1 < argc) {
+                benchmarkOptions.type = argv[++i];
+            }
+
+            continue;
+        }
+
+        if (arg == "--benchmark-name") {
+            if (i + 1 < argc) {
+                benchmarkOptions.name = argv[++i];
+            }
+
+            continue;
+        }
+
+        if (arg == "--benchmark-epochs") {
+            if (i + 1 < argc) {
+                benchmarkOptions.epochs = std::stoul(argv[++i]);
+            }
+
+            continue;
+        }
+
+        if (arg == "--benchmark-min-epoch-time") {
+            if (i + 1 < argc) {
+                benchmarkOptions.minEpochTimeMs = std::stoul(argv[++i]);
+            }
+
+            continue;
+        }
+
+        if (arg == "--benchmark-flowgraph") {
+            if (i + 1 < argc) {
+                flowgraphBenchmark.path = argv[++i];
+            }
+
+            continue;
+        }
+
+        if (arg == "--convert-flowgraph") {
+            if (i + 2 < argc) {
+                convertInputPath = argv[++i];
+                convertOutputPath = argv[++i];
+            }
+
+            continue;
+        }
+
+        if (arg == "--benchmark-render") {
+            renderBenchmark = true;
+
+            continue;
+        }
+
+        if (arg == "--benchmark-frames") {
+            if (i + 1 < argc) {
+                flowgraphBenchmark.frames = std::stoul(argv[++i]);
+            }
+
+            continue;
         }
 
         if (arg == "--framerate") {
@@ -135,6 +320,201 @@ int main(int argc, char* argv[]) {
             continue;
         }
 
+        if (arg == "--memory-pool") {
+            if (i + 1 < argc) {
+                backendConfig.memoryPoolSize = std::stoul(argv[++i])*1024*1024;
+            }
+
+            continue;
+        }
+
+        if (arg == "--mirrored-memory") {
+            backendConfig.mirroredMemory = true;
+
+            continue;
+        }
+
+        if (arg == "--pinned-memory") {
+            memoryHints.pinned = true;
+
+            continue;
+        }
+
+        if (arg == "--huge-pages") {
+            memoryHints.hugePages = true;
+
+            continue;
+        }
+
+        if (arg == "--numa-node") {
+            if (i + 1 < argc) {
+                memoryHints.numaNode = std::stoi(argv[++i]);
+            }
+
+            continue;
+        }
+
+        if (arg == "--numa-interleave") {
+            memoryHints.numaInterleave = true;
+
+            continue;
+        }
+
+        if (arg == "--compute-cores" || arg == "--present-cores" || arg == "--io-cores") {
+            if (i + 1 < argc) {
+                auto& policy = (arg == "--compute-cores") ? threadPolicies.compute :
+                               (arg == "--present-cores") ? threadPolicies.present :
+                                                            threadPolicies.io;
+                JST_CHECK_THROW(ParseCoreList(argv[++i], policy.cores));
+            }
+
+            continue;
+        }
+
+        if (arg == "--realtime-priority") {
+            if (i + 1 < argc) {
+                const U64 priority = std::stoul(argv[++i]);
+                threadPolicies.compute.realtimePriority = priority;
+                threadPolicies.io.realtimePriority = priority;
+                threadPolicies.audio.realtimePriority = priority;
+            }
+
+            continue;
+        }
+
+        if (arg == "--compute-threads") {
+            if (i + 1 < argc) {
+                schedulerConfig.computeThreads = std::stoul(argv[++i]);
+            }
+
+            continue;
+        }
+
+        if (arg == "--graph-threads") {
+            if (i + 1 < argc) {
+                schedulerConfig.graphThreads = std::stoul(argv[++i]);
+            }
+
+            continue;
+        }
+
+        if (arg == "--pipeline-stages") {
+            if (i + 1 < argc) {
+                schedulerConfig.pipelineStages = std::stoul(argv[++i]);
+            }
+
+            continue;
+        }
+
+        if (arg == "--create-threads") {
+            if (i + 1 < argc) {
+                schedulerConfig.createThreads = std::stoul(argv[++i]);
+            }
+
+            continue;
+        }
+
+        if (arg == "--warm-variants") {
+            if (i + 1 < argc) {
+                warmBlockVariants = std::stoul(argv[++i]);
+            }
+
+            continue;
+        }
+
+        if (arg == "--decoupled-present") {
+            schedulerConfig.decoupledPresent = true;
+
+            continue;
+        }
+
+        if (arg == "--no-display-pacing") {
+            schedulerConfig.paceDisplayGraphs = false;
+
+            continue;
+        }
+
+        if (arg == "--no-view-suspend") {
+            schedulerConfig.suspendHiddenViews = false;
+
+            continue;
+        }
+
+        if (arg == "--no-module-sharing") {
+            schedulerConfig.shareModules = false;
+
+            continue;
+        }
+
+        if (arg == "--profile-modules") {
+            schedulerConfig.profileModules = true;
+
+            continue;
+        }
+
+        if (arg == "--metrics") {
+            if (i + 1 < argc) {
+                metricsConfig.port = std::stoul(argv[++i]);
+                metricsEnabled = true;
+            }
+
+            continue;
+        }
+
+        if (arg == "--metrics-address") {
+            if (i + 1 < argc) {
+                metricsConfig.address = argv[++i];
+            }
+
+            continue;
+        }
+
+        if (arg == "--async-logging") {
+            JST_LOG_ASYNC(true);
+
+            continue;
+        }
+
+        if (arg == "--profile-startup") {
+            profileStartup = true;
+
+            continue;
+        }
+
+        if (arg == "--sample-modules") {
+            if (i + 1 < argc) {
+                samplerConfig.interval = std::stoul(argv[++i]);
+                samplerEnabled = true;
+            }
+
+            continue;
+        }
+
+        if (arg == "--sample-threshold") {
+            if (i + 1 < argc) {
+                samplerConfig.threshold = std::stof(argv[++i]);
+            }
+
+            continue;
+        }
+
+        if (arg == "--sample-folder") {
+            if (i + 1 < argc) {
+                samplerConfig.folder = argv[++i];
+            }
+
+            continue;
+        }
+
+        if (arg == "--trace") {
+            if (i + 1 < argc) {
+                tracePath = argv[++i];
+                Tracer::Enable();
+            }
+
+            continue;
+        }
+
         if (arg == "--scale") {
             if (i + 1 < argc) {
                 renderConfig.scale = std::stof(argv[++i]);
@@ -143,10 +523,29 @@ int main(int argc, char* argv[]) {
             continue;
         }
 
+        if (arg == "--frames-in-flight") {
+            if (i + 1 < argc) {
+                renderConfig.framesInFlight = std::stoul(argv[++i]);
+            }
+
+            continue;
+        }
+
+        if (arg == "--render-on-demand") {
+            renderConfig.renderOnDemand = true;
+
+            continue;
+        }
+
         if (arg == "--help" || arg == "-h") {
             std::cout << "Usage: " << argv[0] << " [options] [flowgraph]" << std::endl;
             std::cout << "Options:" << std::endl;
             std::cout << "  --remote                Enable remote viewport mode." << std::endl;
+            std::cout << "  --record [path]         Render headless to a video file or a PNG sequence (e.g. `frame-%05d.png`) at the viewport framerate." << std::endl;
+            std::cout << "  --worker [port]         Run the blocks of distributed flowgraphs assigned to this host. Default: `5100`" << std::endl;
+            std::cout << "  --worker-address [ip]   Set the address the worker listens on. Default: `127.0.0.1`" << std::endl;
+            std::cout << "  --worker-token [token]  Set the token shared by a coordinator and its workers. Default: `JST_WORKER_TOKEN`" << std::endl;
+            std::cout << "  --compute-only          Run the flowgraph without viewport, render, or compositor. Views are ignored." << std::endl;
             std::cout << "  --broker [url]          Set the broker of the remote viewport. Default: `https://api.cyberether.org`" << std::endl;
             std::cout << "  --backend [backend]     Set the preferred backend (`Metal`, `Vulkan`, or `WebGPU`)." << std::endl;
             std::cout << "  --framerate [value]     Set the framerate of the te viewport (FPS). Default: `60`" << std::endl;
@@ -154,11 +553,56 @@ int main(int argc, char* argv[]) {
             std::cout << "  --codec [codec]         Set the video codec of the remote viewport. Default: `H264`" << std::endl;
             std::cout << "  --size [width] [height] Set the initial size of the viewport. Default: `1920 1080`" << std::endl;
             std::cout << "  --scale [scale]         Set the scale of the render window. Default: `1.0`" << std::endl;
-            std::cout << "  --benchmark [type]      Run the benchmark and output the results (`markdown`, `json`, or `csv`). Default: `markdown`" << std::endl;
+            std::cout << "  --benchmark [type]      Run the benchmark and output the results (`markdown`, `json`, `csv`, or `sweep`). Default: `markdown`" << std::endl;
+            std::cout << "  --benchmark-compare [path] Run the benchmark and fail on regressions against a `json` baseline." << std::endl;
+            std::cout << "  --benchmark-module [re] Only benchmark modules matching the expression." << std::endl;
+            std::cout << "  --benchmark-device [re] Only benchmark devices matching the expression (e.g. `CPU|CUDA`)." << std::endl;
+            std::cout << "  --benchmark-type [re]   Only benchmark data types matching the expression (e.g. `CF32`)." << std::endl;
+            std::cout << "  --benchmark-name [re]   Only run cases matching the expression (e.g. `Forward`)." << std::endl;
+            std::cout << "  --benchmark-epochs [n]  Set the number of epochs of every case. Default: nanobench" << std::endl;
+            std::cout << "  --benchmark-min-epoch-time [ms] Set the minimum duration of an epoch. Default: `100`" << std::endl;
+            std::cout << "  --benchmark-flowgraph [path] Run a flowgraph headless with synthetic sources and output the results." << std::endl;
+            std::cout << "  --benchmark-render      Draw the visualization blocks on the selected backend and output the results. Headless with `--remote`." << std::endl;
+            std::cout << "  --benchmark-frames [n]  Set the number of frames measured by `--benchmark-flowgraph` and `--benchmark-render`. Default: `1000`" << std::endl;
+            std::cout << "  --convert-flowgraph [in] [out] Convert a flowgraph to YAML (`.yml` or `.yaml`) or to the binary format (any other extension) and exit." << std::endl;
             std::cout << "  --no-hw-acceleration    Disable hardware acceleration. Enabled otherwise." << std::endl;
+            std::cout << "  --stream-tensors        Send plotted lines to remote clients over the data channel with a preview video. Disabled otherwise." << std::endl;
+            std::cout << "  --no-adaptive-streaming Keep the remote bitrate and framerate fixed under packet loss. Enabled otherwise." << std::endl;
+            std::cout << "  --adaptive-quality [order] Lower the display work while the system is hot or frames are slow, in the given order (e.g. `display,resolution,framerate`). Disabled otherwise." << std::endl;
+            std::cout << "  --frame-budget [ms]     Set the frame time above which `--adaptive-quality` lowers the display work. Default: `33.3`" << std::endl;
             std::cout << "Other Options:" << std::endl;
             std::cout << "  --staging-buffer [size] Set the staging buffer size (MB). Default: `64`" << std::endl;
+            std::cout << "  --memory-pool [size]    Set the size of the CPU memory kept for reuse by reloads (MB). Default: `256`" << std::endl;
+            std::cout << "  --mirrored-memory       Back host accessible CUDA tensors with device memory and a pinned host mirror. Default: managed memory" << std::endl;
+            std::cout << "  --pinned-memory         Register CPU tensors with CUDA when allocated. Default: when first used by CUDA" << std::endl;
+            std::cout << "  --huge-pages            Back large CPU tensors with transparent huge pages. Disabled otherwise." << std::endl;
+            std::cout << "  --numa-node [node]      Bind large CPU tensors to a NUMA node. Default: system policy" << std::endl;
+            std::cout << "  --numa-interleave       Interleave large CPU tensors across NUMA nodes. Disabled otherwise." << std::endl;
+            std::cout << "  --compute-cores [list]  Pin the compute thread to cores (e.g. `0-3,8`). Default: any core" << std::endl;
+            std::cout << "  --present-cores [list]  Pin the present thread to cores. Default: any core" << std::endl;
+            std::cout << "  --io-cores [list]       Pin device I/O threads to cores. Default: any core" << std::endl;
+            std::cout << "  --realtime-priority [n] Run the compute, I/O and audio threads with SCHED_FIFO priority `n`. Disabled otherwise." << std::endl;
             std::cout << "  --device-id [id]        Set the physical device ID. Default: `0`" << std::endl;
+            std::cout << "  --compute-threads [n]   Set the number of threads computing independent graphs (`0` for all cores). Default: `1`" << std::endl;
+            std::cout << "  --graph-threads [n]     Set the number of threads computing independent modules of a CPU graph. Default: `1`" << std::endl;
+            std::cout << "  --pipeline-stages [n]   Split CPU graphs made of a chain in `n` stages computing consecutive frames on the graph threads. Default: `1`" << std::endl;
+            std::cout << "  --create-threads [n]    Set the number of threads creating independent graphs on import (`0` for all cores). Default: `0`" << std::endl;
+            std::cout << "  --warm-variants [n]     Keep `n` variants of each block created after changing its backend or data type. Default: `0`" << std::endl;
+            std::cout << "  --decoupled-present     Present snapshot modules without blocking compute. Disabled otherwise." << std::endl;
+            std::cout << "  --no-display-pacing     Compute graphs only feeding plots as fast as possible. Paced to the display otherwise." << std::endl;
+            std::cout << "  --no-view-suspend       Keep computing plots hidden in the compositor. Suspended otherwise." << std::endl;
+            std::cout << "  --no-module-sharing     Compute duplicated CPU modules with the same inputs, like two spectrum views of one source, separately. Shared otherwise." << std::endl;
+            std::cout << "  --profile-modules       Record the latency of every module. Toggled from the Developer menu otherwise." << std::endl;
+            std::cout << "  --profile-startup       Print the time spent in each phase of the startup." << std::endl;
+            std::cout << "  --async-logging         Write log lines from a background thread, dropping them under bursts. Synchronous otherwise." << std::endl;
+            std::cout << "  --trace [path]          Record scheduler and module spans and write them as a Chrome trace on exit." << std::endl;
+            std::cout << "  --sample-modules [n]    Time the modules of one compute cycle out of `n` into a rolling window. Disabled otherwise." << std::endl;
+            std::cout << "  --sample-threshold [ms] Dump the sampled window when a compute cycle takes longer. Disabled otherwise." << std::endl;
+            std::cout << "  --sample-folder [path]  Set the folder of the sample dumps. Default: `.`" << std::endl;
+            std::cout << "  --metrics [port]        Serve Prometheus metrics on `/metrics`. Disabled otherwise." << std::endl;
+            std::cout << "  --metrics-address [ip]  Set the address of the metrics endpoint. Default: `0.0.0.0`" << std::endl;
+            std::cout << "  --frames-in-flight [n]  Set the number of frames recorded ahead of the GPU (Vulkan). Default: `2`" << std::endl;
+            std::cout << "  --render-on-demand      Only draw frames after input or new data. Enabled by `--remote`, disabled otherwise." << std::endl;
             std::cout << "  --no-validation         Disable Vulkan validation layers. Enabled otherwise." << std::endl;
             std::cout << "  --no-vsync              Disable vsync. Enabled otherwise." << std::endl;
             std::cout << "Other:" << std::endl;
@@ -175,6 +619,55 @@ int main(int argc, char* argv[]) {
         flowgraphPath = arg;
     }
 
+    // Flowgraph conversion.
+
+    if (!convertInputPath.empty()) {
+        return (Flowgraph::ConvertFile(convertInputPath, convertOutputPath) == Result::SUCCESS) ? 0 : 1;
+    }
+
+    // Module benchmarks.
+
+    if (!benchmarkOutput.empty() || !benchmarkBaseline.empty()) {
+        JST_CHECK_THROW(Benchmark::SetOptions(benchmarkOptions));
+
+        if (!benchmarkBaseline.empty()) {
+            return (Benchmark::Compare(benchmarkBaseline) == Result::SUCCESS) ? 0 : 1;
+        }
+
+        Benchmark::Run(benchmarkOutput);
+
+        return 0;
+    }
+
+    // Flowgraph benchmark.
+
+    if (!flowgraphBenchmark.path.empty()) {
+        Instance instance;
+
+        JST_CHECK_THROW(instance.build({
+            .preferredDevice = prefferedBackend,
+            .headless = true,
+            .backendConfig = backendConfig,
+            .schedulerConfig = schedulerConfig,
+            .memoryHints = memoryHints,
+            .threadPolicies = threadPolicies,
+        }));
+
+        const auto res = Benchmark::RunFlowgraph(instance, flowgraphBenchmark);
+
+        instance.destroy();
+        Backend::DestroyAll();
+
+        return (res == Result::SUCCESS) ? 0 : 1;
+    }
+
+    // Frames are drawn back to back while benchmarking the render.
+
+    if (renderBenchmark) {
+        viewportConfig.vsync = false;
+        renderConfig.renderOnDemand = false;
+    }
+
     // Instance creation.
 
     Instance instance;
@@ -183,14 +676,41 @@ int main(int argc, char* argv[]) {
 
     Instance::Config config = {
         .preferredDevice = prefferedBackend,
-        .renderCompositor = true,
+        .renderCompositor = !renderBenchmark,
+        .computeOnly = computeOnly,
         .backendConfig = backendConfig,
         .viewportConfig = viewportConfig,
-        .renderConfig = renderConfig
+        .renderConfig = renderConfig,
+        .schedulerConfig = schedulerConfig,
+        .memoryHints = memoryHints,
+        .threadPolicies = threadPolicies,
+        .qualityConfig = qualityConfig,
+        .warmBlockVariants = warmBlockVariants,
     };
 
     JST_CHECK_THROW(instance.build(config));
 
+    // Render benchmark.
+
+    if (renderBenchmark) {
+        JST_CHECK_THROW(instance.start());
+
+        const auto res = Benchmark::RunRender(instance, {
+            .frames = flowgraphBenchmark.frames,
+        });
+
+        instance.reset();
+        instance.stop();
+        instance.destroy();
+        Backend::DestroyAll();
+
+        return (res == Result::SUCCESS) ? 0 : 1;
+    }
+
+    // Token presented to workers, or expected from coordinators.
+
+    instance.flowgraph().setWorkerToken(workerToken);
+
     // Load flowgraph if provided.
 
     if (!flowgraphPath.empty()) {
@@ -202,15 +722,44 @@ int main(int argc, char* argv[]) {
 
     instance.start();
 
+    // Wait for the parts of distributed flowgraphs.
+
+    if (workerEnabled) {
+        JST_CHECK_THROW(instance.flowgraph().startWorker(workerPort, workerAddress));
+    }
+
+    // Startup is over once the flowgraph is loaded and the instance started.
+
+    StartupProfile::Finish();
+
+    if (profileStartup) {
+        JST_INFO("[STARTUP] Startup profile:\n{}", StartupProfile::Report());
+    }
+
+    // Start metrics endpoint.
+
+    MetricsServer metrics(instance.scheduler());
+    if (metricsEnabled) {
+        metrics.start(metricsConfig);
+    }
+
+    // Start sampler.
+
+    if (samplerEnabled) {
+        Sampler::Enable(samplerConfig);
+    }
+
     // Start compute thread.
 
     auto computeThread = std::thread([&]{
+        ApplyThreadPolicy(ThreadRole::Compute);
+
         while (instance.computing()) {
             JST_CHECK_THROW(instance.compute());
         }
     });
 
-    // Start graphical thread.
+    // Start graphical thread. Compute-only instances have nothing to draw.
 
     auto graphicalThreadLoop = [](void* arg) {
         Instance* instance = reinterpret_cast<Instance*>(arg);
@@ -227,25 +776,42 @@ int main(int argc, char* argv[]) {
 #ifdef JST_OS_BROWSER
     emscripten_set_main_loop_arg(graphicalThreadLoop, &instance, 0, 1);
 #else
-    auto graphicalThread = std::thread([&]{
-        while (instance.presenting()) {
-            graphicalThreadLoop(&instance);
-        }
-    });
+    std::thread graphicalThread;
+
+    if (!computeOnly) {
+        graphicalThread = std::thread([&]{
+            ApplyThreadPolicy(ThreadRole::Present);
+
+            while (instance.presenting()) {
+                graphicalThreadLoop(&instance);
+            }
+        });
+    }
 #endif
 
-    // Start input polling.
+    // Start input polling. Compute-only instances run until interrupted.
 
 #ifdef JST_OS_BROWSER
     emscripten_runtime_keepalive_push();
 #else
-    while (instance.running()) {
-        instance.viewport().waitEvents();
+    if (computeOnly) {
+        std::signal(SIGINT, [](int) { interrupted = 1; });
+        std::signal(SIGTERM, [](int) { interrupted = 1; });
+
+        while (instance.running() && !interrupted) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        }
+    } else {
+        while (instance.running()) {
+            instance.viewport().waitEvents();
+        }
     }
 #endif
 
     // Stop instance and wait for threads.
 
+    JST_CHECK_THROW(instance.flowgraph().stopWorker());
+
     instance.reset();
     instance.stop();
 
@@ -261,6 +827,21 @@ int main(int argc, char* argv[]) {
     }
 #endif
 
+    // Stop metrics endpoint.
+
+    metrics.stop();
+
+    // Stop sampler.
+
+    Sampler::Disable();
+
+    // Write trace.
+
+    if (!tracePath.empty()) {
+        Tracer::Disable();
+        Tracer::Dump(tracePath);
+    }
+
     // Destroy instance.
 
     instance.destroy();
@@ -1,2 +1,2 @@
 from superluminal._internal import *
-from superluminal._module import plot, show, realtime, running, layout, configure, box, text, slider, markdown, image
+from superluminal._module import plot, push, show, realtime, running, layout, configure, box, text, slider, markdown, image
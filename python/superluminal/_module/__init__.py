@@ -7,13 +7,17 @@ import urllib.request
 
 import superluminal._internal as lm
 
-try:
-    import cupy as cp
-except:
-    cp = None
-
 _url_cache = {}
 
+_callback_thread = None
+_use_callback_thread = False
+
+def _is_array(data):
+    # CuPy, PyTorch, and JAX arrays are imported through DLPack without a copy.
+    return isinstance(data, np.ndarray) or \
+           hasattr(data, "__dlpack__") or \
+           hasattr(data, "__cuda_array_interface__")
+
 def plot(data: np.ndarray,
          type: lm.constant,
          label: str = "",
@@ -30,8 +34,8 @@ def plot(data: np.ndarray,
 
     # Check data.
 
-    if not isinstance(data, np.ndarray) and (cp and not isinstance(data, cp.ndarray)):
-        raise TypeError("Data must be a numpy or cupy array.")
+    if not _is_array(data):
+        raise TypeError("Data must be a numpy array or a DLPack or CUDA array interface tensor.")
 
     # Check type.
 
@@ -133,31 +137,71 @@ def plot(data: np.ndarray,
 
     lm.plot(label, mosaic, cfg)
 
+def push(label: str, data: np.ndarray):
+    """
+    Queue new data for a plot without waiting for it to be drawn.
+
+    Args:
+        label: The label of the plot
+        data: An array with the same shape, type, and device as the plotted one. Copied before returning.
+    """
+    if not isinstance(label, str):
+        raise TypeError("Label must be a string.")
+
+    if not _is_array(data):
+        raise TypeError("Data must be a numpy array or a DLPack or CUDA array interface tensor.")
+
+    lm.push(label, data)
+
 def configure(preferred_device: lm.constant = lm.cpu,
               device_id: int = 0,
-              window_title: str = "Superluminal"):
+              window_title: str = "Superluminal",
+              push_depth: int = 4,
+              output: str = "",
+              callback_thread: bool = False):
+    global _use_callback_thread
+    _use_callback_thread = callback_thread
+
     cfg = lm.instance_config()
     cfg.device_id = device_id
     cfg.preferred_device = preferred_device.value
     cfg.window_title = window_title
+    cfg.push_depth = push_depth
+    cfg.output = output
     lm.initialize(cfg)
 
-def show():
+def _start():
+    # Interface callbacks run on a dedicated Python thread instead of the present thread.
+    global _callback_thread
+    if _use_callback_thread and _callback_thread is None:
+        _callback_thread = threading.Thread(target=lm.serve_callbacks, daemon=True)
+        _callback_thread.start()
     lm.start()
+
+def _stop():
+    global _callback_thread
+    lm.stop()
+    if _callback_thread is not None:
+        lm.stop_callbacks()
+        _callback_thread.join()
+        _callback_thread = None
+    lm.terminate()
+
+def show():
+    _start()
     lm.update()
 
     while lm.presenting():
         lm.poll_events(False)
         time.sleep(0.01)
 
-    lm.stop()
-    lm.terminate()
+    _stop()
 
 def running():
     return lm.presenting()
 
 def realtime(callback):
-    lm.start()
+    _start()
 
     t = threading.Thread(target=callback)
     t.start()
@@ -168,8 +212,7 @@ def realtime(callback):
 
     t.join()
 
-    lm.stop()
-    lm.terminate()
+    _stop()
 
 def layout(matrix_height, matrix_width,
            panel_height, panel_width,
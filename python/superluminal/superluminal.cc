@@ -1,3 +1,7 @@
+#include <mutex>
+#include <condition_variable>
+#include <unordered_map>
+
 #include <nanobind/nanobind.h>
 #include <nanobind/ndarray.h>
 #include <nanobind/stl/map.h>
@@ -24,32 +28,176 @@ struct ToNanobind<Device::CUDA> {
     using value_type = nb::device::cuda;
 };
 
+template <typename T>
+struct ToTypestr;
+
+template <>
+struct ToTypestr<F32> {
+    static constexpr const char* value = "<f4";
+};
+
+template <>
+struct ToTypestr<CF32> {
+    static constexpr const char* value = "<c8";
+};
+
+// Arrays are imported through the buffer protocol or DLPack, so NumPy,
+// CuPy, PyTorch, and JAX arrays are accepted without a copy.
+
+template<Device D, typename T>
+using ArrayType = nb::ndarray<T, nb::c_contig, typename ToNanobind<D>::value_type>;
+
+template<Device D, typename T>
+Tensor<D, T> pointer_to_tensor(T* pointer, const std::vector<U64>& shape) {
+    // Create zero-copy tensor.
+
+    auto tensor = Tensor<D, T>(pointer, shape);
+
+    // Set tensor hash.
+
+    tensor.set_hash(static_cast<uint64_t>(reinterpret_cast<uintptr_t>(pointer)));
+
+    return tensor;
+}
+
 template<Device D, typename T>
-Tensor<D, T> numpy_to_tensor(nb::handle handle) {
+Tensor<D, T> array_to_tensor(nb::handle handle) {
     // Cast to array.
 
-    using Type = nb::ndarray<nb::numpy, T, nb::c_contig, typename ToNanobind<D>::value_type>;
-    auto array = nb::cast<Type>(handle);
+    auto array = nb::cast<ArrayType<D, T>>(handle);
 
-    // Extract shape from numpy array
+    // Extract shape from array.
 
     std::vector<U64> shape;
     for (size_t i = 0; i < array.ndim(); ++i) {
         shape.push_back(static_cast<U64>(array.shape(i)));
     }
 
-    // Create zero-copy tensor.
+    return pointer_to_tensor<D, T>(static_cast<T*>(array.data()), shape);
+}
 
-    auto pointer = static_cast<T*>(array.data());
-    auto tensor = Tensor<D, T>(pointer, shape);
+// Fallback for objects only implementing `__cuda_array_interface__`, like Numba arrays.
 
-    // Set tensor hash.
+template<typename T>
+bool cuda_interface_matches(nb::handle handle) {
+    if (!nb::hasattr(handle, "__cuda_array_interface__")) {
+        return false;
+    }
 
-    tensor.set_hash(static_cast<uint64_t>(reinterpret_cast<uintptr_t>(pointer)));
+    auto interface = nb::cast<nb::dict>(handle.attr("__cuda_array_interface__"));
+    return nb::cast<std::string>(interface["typestr"]) == ToTypestr<T>::value;
+}
 
-    return tensor;
+template<typename T>
+Tensor<Device::CUDA, T> cuda_interface_to_tensor(nb::handle handle) {
+    auto interface = nb::cast<nb::dict>(handle.attr("__cuda_array_interface__"));
+
+    // Extract shape.
+
+    std::vector<U64> shape;
+    for (auto dim : nb::cast<nb::tuple>(interface["shape"])) {
+        shape.push_back(nb::cast<U64>(dim));
+    }
+
+    // Only C-contiguous arrays can be imported.
+
+    if (interface.contains("strides") && !interface["strides"].is_none()) {
+        U64 expected = sizeof(T);
+        auto strides = nb::cast<nb::tuple>(interface["strides"]);
+
+        for (I64 i = static_cast<I64>(shape.size()) - 1; i >= 0; i--) {
+            if (shape[i] > 1 && nb::cast<U64>(strides[static_cast<size_t>(i)]) != expected) {
+                throw std::invalid_argument("CUDA array must be C-contiguous");
+            }
+            expected *= shape[i];
+        }
+    }
+
+    auto data = nb::cast<nb::tuple>(interface["data"]);
+    auto pointer = reinterpret_cast<T*>(nb::cast<uintptr_t>(data[0]));
+
+    return pointer_to_tensor<Device::CUDA, T>(pointer, shape);
 }
 
+Superluminal::VariantBufferType array_to_buffer(nb::handle handle) {
+#ifdef JETSTREAM_BACKEND_CPU_AVAILABLE
+    if (nb::isinstance<ArrayType<Device::CPU, CF32>>(handle)) {
+        return array_to_tensor<Device::CPU, CF32>(handle);
+    } else if (nb::isinstance<ArrayType<Device::CPU, F32>>(handle)) {
+        return array_to_tensor<Device::CPU, F32>(handle);
+    }
+#endif
+#ifdef JETSTREAM_BACKEND_CUDA_AVAILABLE
+    if (nb::isinstance<ArrayType<Device::CUDA, CF32>>(handle)) {
+        return array_to_tensor<Device::CUDA, CF32>(handle);
+    } else if (nb::isinstance<ArrayType<Device::CUDA, F32>>(handle)) {
+        return array_to_tensor<Device::CUDA, F32>(handle);
+    } else if (cuda_interface_matches<CF32>(handle)) {
+        return cuda_interface_to_tensor<CF32>(handle);
+    } else if (cuda_interface_matches<F32>(handle)) {
+        return cuda_interface_to_tensor<F32>(handle);
+    }
+#endif
+    throw std::invalid_argument("Unsupported buffer type or device");
+}
+
+// Runs the interface callbacks of the present thread on a Python thread blocked in `serve`.
+// The present thread waits for each callback, so the ImGui calls still happen inside its frame.
+struct CallbackDispatcher {
+    std::mutex mutex;
+    std::condition_variable condition;
+    const nb::object* pending = nullptr;
+    bool serving = false;
+
+    void dispatch(const nb::object& callback) {
+        {
+            std::unique_lock lock(mutex);
+            if (serving) {
+                pending = &callback;
+                condition.notify_all();
+                condition.wait(lock, [&]{ return pending == nullptr || !serving; });
+                pending = nullptr;
+                return;
+            }
+        }
+
+        if (Py_IsInitialized()) {
+            nb::gil_scoped_acquire gil;
+            callback();
+        }
+    }
+
+    void serve() {
+        std::unique_lock lock(mutex);
+        serving = true;
+
+        while (serving) {
+            condition.wait(lock, [&]{ return pending != nullptr || !serving; });
+
+            if (pending) {
+                lock.unlock();
+                {
+                    nb::gil_scoped_acquire gil;
+                    try {
+                        (*pending)();
+                    } catch (nb::python_error& e) {
+                        e.discard_as_unraisable("superluminal interface callback");
+                    }
+                }
+                lock.lock();
+                pending = nullptr;
+                condition.notify_all();
+            }
+        }
+    }
+
+    void stop() {
+        std::lock_guard lock(mutex);
+        serving = false;
+        condition.notify_all();
+    }
+};
+
 NB_MODULE(_impl, m) {
     nb::class_<Superluminal> superluminal(m, "impl");
 
@@ -88,25 +236,7 @@ NB_MODULE(_impl, m) {
         .def_prop_rw("buffer",
             [](Superluminal::PlotConfig &self) { return self.buffer; },
             [](Superluminal::PlotConfig &self, nb::handle input) {
-#ifdef JETSTREAM_BACKEND_CPU_AVAILABLE
-                if (nb::isinstance<nb::ndarray<nb::numpy, CF32, nb::c_contig, nb::device::cpu>>(input)) {
-                    self.buffer = numpy_to_tensor<Device::CPU, CF32>(input);
-                    return;
-                } else if (nb::isinstance<nb::ndarray<nb::numpy, F32, nb::c_contig, nb::device::cpu>>(input)) {
-                    self.buffer = numpy_to_tensor<Device::CPU, F32>(input);
-                    return;
-                }
-#endif
-#ifdef JETSTREAM_BACKEND_CUDA_AVAILABLE
-                if (nb::isinstance<nb::ndarray<nb::numpy, CF32, nb::c_contig, nb::device::cuda>>(input)) {
-                    self.buffer = numpy_to_tensor<Device::CUDA, CF32>(input);
-                    return;
-                } else if (nb::isinstance<nb::ndarray<nb::numpy, F32, nb::c_contig, nb::device::cuda>>(input)) {
-                    self.buffer = numpy_to_tensor<Device::CUDA, F32>(input);
-                    return;
-                }
-#endif
-                throw std::invalid_argument("Unsupported buffer type or device");
+                self.buffer = array_to_buffer(input);
             },
             "Set the buffer")
         .def_rw("type", &Superluminal::PlotConfig::type)
@@ -125,31 +255,70 @@ NB_MODULE(_impl, m) {
         .def_rw("interface_size", &Superluminal::InstanceConfig::interfaceSize)
         .def_rw("window_title", &Superluminal::InstanceConfig::windowTitle)
         .def_rw("remote", &Superluminal::InstanceConfig::remote)
-        .def_rw("preferred_device", &Superluminal::InstanceConfig::preferredDevice);
+        .def_rw("preferred_device", &Superluminal::InstanceConfig::preferredDevice)
+        .def_rw("profile_startup", &Superluminal::InstanceConfig::profileStartup)
+        .def_rw("push_depth", &Superluminal::InstanceConfig::pushDepth)
+        .def_rw("output", &Superluminal::InstanceConfig::output);
+
+    // Blocking calls release the GIL, the present thread acquires it for the interface callbacks.
 
-    m.def("initialize", &Superluminal::Initialize, nb::arg("config") = Superluminal::InstanceConfig());
-    m.def("start", &Superluminal::Start);
-    m.def("stop", &Superluminal::Stop);
+    m.def("initialize", &Superluminal::Initialize, nb::arg("config") = Superluminal::InstanceConfig(),
+          nb::call_guard<nb::gil_scoped_release>());
+    m.def("start", &Superluminal::Start, nb::call_guard<nb::gil_scoped_release>());
+    m.def("stop", &Superluminal::Stop, nb::call_guard<nb::gil_scoped_release>());
+    m.def("block", &Superluminal::Block, nb::call_guard<nb::gil_scoped_release>());
     m.def("presenting", &Superluminal::Presenting);
-    m.def("update", &Superluminal::Update, nb::arg("name") = std::string());
-    m.def("poll_events", &Superluminal::PollEvents, nb::arg("wait") = true);
+    m.def("update", nb::overload_cast<const std::string&>(&Superluminal::Update), nb::arg("name") = std::string(),
+          nb::call_guard<nb::gil_scoped_release>());
+
+    // The array is copied by the next compute cycle, keep it alive until it's replaced.
+    static std::unordered_map<std::string, nb::object> stored_buffers;
+
+    m.def("update", [](const std::string& name, nb::handle buffer) {
+        const auto tensor = array_to_buffer(buffer);
+        const auto result = [&]{
+            nb::gil_scoped_release release;
+            return Superluminal::Update(name, tensor);
+        }();
+        if (result == Result::SUCCESS) {
+            stored_buffers[name] = nb::borrow(buffer);
+        }
+        return result;
+    }, nb::arg("name"), nb::arg("buffer"));
+
+    // The array is copied before returning, the GIL is released meanwhile.
+    m.def("push", [](const std::string& name, nb::handle buffer) {
+        const auto tensor = array_to_buffer(buffer);
+        nb::gil_scoped_release release;
+        return Superluminal::Push(name, tensor);
+    }, nb::arg("name"), nb::arg("buffer"));
+    m.def("poll_events", &Superluminal::PollEvents, nb::arg("wait") = true, nb::call_guard<nb::gil_scoped_release>());
     m.def("plot", &Superluminal::Plot);
 
     static std::vector<std::shared_ptr<nb::object>> stored_callbacks;
+    static CallbackDispatcher dispatcher;
 
     m.def("box", [](const std::string& title, const Superluminal::Mosaic& mosaic, nb::object callback) {
-        stored_callbacks.push_back(std::make_shared<nb::object>(std::move(callback)));
-        return Superluminal::Box(title, mosaic, [&]() {
-            if (Py_IsInitialized()) {
-                nb::gil_scoped_acquire gil;
-                (*stored_callbacks.back())();
-            }
+        auto stored = stored_callbacks.emplace_back(std::make_shared<nb::object>(std::move(callback)));
+        return Superluminal::Box(title, mosaic, [stored]() {
+            dispatcher.dispatch(*stored);
         });
     }, nb::arg("title"), nb::arg("mosaic"), nb::arg("callback"));
 
+    // Blocks the calling thread running interface callbacks until `stop_callbacks`.
+    m.def("serve_callbacks", []() {
+        dispatcher.serve();
+    }, nb::call_guard<nb::gil_scoped_release>());
+    m.def("stop_callbacks", []() {
+        dispatcher.stop();
+    }, nb::call_guard<nb::gil_scoped_release>());
+
     m.def("terminate", []() {
+        {
+            nb::gil_scoped_release release;
+            Superluminal::Terminate();
+        }
         stored_callbacks.clear();
-        Superluminal::Terminate();
     });
 
     m.def("text", [](const std::string& text) {
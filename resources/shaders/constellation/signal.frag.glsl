@@ -12,13 +12,19 @@ layout(set = 0, binding = 0) uniform ShaderUniforms {
     float zoom;
 } uniforms;
 
-layout(set = 0, binding = 1) uniform texture2D dataTex;
-layout(set = 0, binding = 2) uniform sampler dataSam;
+layout(set = 0, binding = 1) readonly buffer DataBuffer {
+    float data[];
+};
 
-layout(set = 0, binding = 3) uniform texture2D lutTex;
-layout(set = 0, binding = 4) uniform sampler lutSam;
+layout(set = 0, binding = 2) uniform texture2D lutTex;
+layout(set = 0, binding = 3) uniform sampler lutSam;
 
 void main() {
-    vec2 color = texture(sampler2D(dataTex, dataSam), inTexcoord).rg;
-    outColor = texture(sampler2D(lutTex, lutSam), color);
+    uint x = min(uint(inTexcoord.x * uniforms.width), uniforms.width - 1);
+    uint y = min(uint(inTexcoord.y * uniforms.height), uniforms.height - 1);
+
+    // The last entry of the LUT is transparent, keep saturated cells off it.
+    float density = min(data[x + y * uniforms.width], 254.0 / 255.0);
+
+    outColor = texture(sampler2D(lutTex, lutSam), vec2(density, 0.0f));
 }
@@ -13,23 +13,67 @@ layout(set = 0, binding = 0) uniform ShaderUniforms {
     float offset;
     float zoom;
     bool interpolate;
+    int scaling;
+    float normalization;
+    float rangeMin;
+    float rangeScale;
+    int storage;
+    int history;
 } uniforms;
 
+// Floats, or 16 and 8-bit values packed in words.
 layout(set = 0, binding = 1) readonly buffer DataBuffer {
-    float data[];
+    uint data[];
 };
 
-layout(set = 0, binding = 2) uniform texture2D lutTex;
-layout(set = 0, binding = 3) uniform sampler lutSam;
+// Rows streamed back from the scrollback, before the range is applied.
+layout(set = 0, binding = 2) readonly buffer HistoryBuffer {
+    float history[];
+};
+
+layout(set = 0, binding = 3) uniform texture2D lutTex;
+layout(set = 0, binding = 4) uniform sampler lutSam;
+
+float valueAt(int idx) {
+    if (uniforms.history == 1) {
+        float value = history[idx];
+        if (uniforms.scaling == 0) {
+            return value;
+        }
+        return clamp((value - uniforms.rangeMin) * uniforms.rangeScale, 0.0, 1.0);
+    }
+
+    // Compact values were mapped from the range on arrival.
+    if (uniforms.storage == 1) {
+        return float((data[idx >> 1] >> ((idx & 1) * 16)) & 0xFFFFu) / 65535.0;
+    }
+    if (uniforms.storage == 2) {
+        return float((data[idx >> 2] >> ((idx & 3) * 8)) & 0xFFu) / 255.0;
+    }
+
+    if (uniforms.scaling == 0) {
+        return uintBitsToFloat(data[idx]);
+    }
+
+    float power = uintBitsToFloat(data[idx]);
+    if (uniforms.scaling == 2) {
+        vec2 bin = vec2(uintBitsToFloat(data[idx * 2]), uintBitsToFloat(data[idx * 2 + 1]));
+        power = dot(bin, bin);
+    }
+
+    // 10 * log10(power), then mapped from the range.
+    float decibels = 3.0102999566 * log2(max(power, 1e-30)) + uniforms.normalization;
+    return clamp((decibels - uniforms.rangeMin) * uniforms.rangeScale, 0.0, 1.0);
+}
 
 float samplerXY(float x, float y) {
     int idx = int(y) * uniforms.width + int(x);
     if (idx < uniforms.maxSize && idx > 0) {
-        return data[idx];
+        return valueAt(idx);
     } else {
         idx += uniforms.maxSize;
         if (idx < uniforms.maxSize && idx > 0) {
-            return data[idx];
+            return valueAt(idx);
         } else {
             return 1.0;
         }
@@ -14,6 +14,12 @@ layout(set = 0, binding = 0) uniform ShaderUniforms {
     float offset;
     float zoom;
     bool interpolate;
+    int scaling;
+    float normalization;
+    float rangeMin;
+    float rangeScale;
+    int storage;
+    int history;
 } uniforms;
 
 void main() {
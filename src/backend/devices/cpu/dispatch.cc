@@ -0,0 +1,116 @@
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+#include <string>
+
+#include "jetstream/backend/devices/cpu/dispatch.hh"
+
+#include "jetstream/logger.hh"
+
+namespace Jetstream::Backend {
+
+static constexpr U8 SimdRank(const SimdLevel& level) {
+    return (level == SimdLevel::NEON || level == SimdLevel::WASM) ? 1 : static_cast<U8>(level);
+}
+
+const char* GetSimdLevelName(const SimdLevel& level) {
+    switch (level) {
+        case SimdLevel::Scalar:
+            return "Scalar";
+        case SimdLevel::SSE4:
+            return "SSE4";
+        case SimdLevel::AVX2:
+            return "AVX2";
+        case SimdLevel::AVX512:
+            return "AVX-512";
+        case SimdLevel::NEON:
+            return "NEON";
+        case SimdLevel::WASM:
+            return "WASM";
+    }
+    return "Unknown";
+}
+
+bool HostSupportsSimdLevel(const SimdLevel& level) {
+    switch (level) {
+        case SimdLevel::Scalar:
+            return true;
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+        case SimdLevel::SSE4:
+            __builtin_cpu_init();
+            return __builtin_cpu_supports("sse4.1");
+        case SimdLevel::AVX2:
+            __builtin_cpu_init();
+            return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+        case SimdLevel::AVX512:
+            __builtin_cpu_init();
+            return __builtin_cpu_supports("avx512f");
+#endif
+#if (defined(__ARM_NEON) || defined(__ARM_NEON__)) && defined(__aarch64__)
+        case SimdLevel::NEON:
+            return true;
+#endif
+#if defined(__wasm_simd128__)
+        case SimdLevel::WASM:
+            return true;
+#endif
+        default:
+            return false;
+    }
+}
+
+static SimdLevel DetectMaxSimdLevel() {
+    SimdLevel host = SimdLevel::Scalar;
+    for (const auto& level : {SimdLevel::SSE4, SimdLevel::AVX2, SimdLevel::AVX512, SimdLevel::NEON, SimdLevel::WASM}) {
+        if (HostSupportsSimdLevel(level) && SimdRank(level) > SimdRank(host)) {
+            host = level;
+        }
+    }
+
+    const char* env = std::getenv("JST_CPU_SIMD");
+    if (!env || !*env) {
+        JST_DEBUG("[CPU] Kernels use up to {}.", GetSimdLevelName(host));
+        return host;
+    }
+
+    std::string value(env);
+    std::transform(value.begin(), value.end(), value.begin(), [](unsigned char c) {
+        return std::tolower(c);
+    });
+    value.erase(std::remove(value.begin(), value.end(), '-'), value.end());
+
+    for (const auto& level : {SimdLevel::Scalar, SimdLevel::SSE4, SimdLevel::AVX2, SimdLevel::AVX512, SimdLevel::NEON, SimdLevel::WASM}) {
+        std::string name = GetSimdLevelName(level);
+        std::transform(name.begin(), name.end(), name.begin(), [](unsigned char c) {
+            return std::tolower(c);
+        });
+        name.erase(std::remove(name.begin(), name.end(), '-'), name.end());
+
+        if (name != value) {
+            continue;
+        }
+
+        if (!HostSupportsSimdLevel(level)) {
+            JST_WARN("[CPU] Host doesn't support {} requested by JST_CPU_SIMD. Using up to {}.",
+                     GetSimdLevelName(level), GetSimdLevelName(host));
+            return host;
+        }
+
+        JST_INFO("[CPU] Kernels limited to {} by JST_CPU_SIMD.", GetSimdLevelName(level));
+        return level;
+    }
+
+    JST_WARN("[CPU] Unknown JST_CPU_SIMD value '{}'. Using up to {}.", env, GetSimdLevelName(host));
+    return host;
+}
+
+SimdLevel MaxSimdLevel() {
+    static const SimdLevel level = DetectMaxSimdLevel();
+    return level;
+}
+
+bool SimdLevelAllowed(const SimdLevel& level) {
+    return HostSupportsSimdLevel(level) && SimdRank(level) <= SimdRank(MaxSimdLevel());
+}
+
+}  // namespace Jetstream::Backend
@@ -22,6 +22,37 @@ CUDA::CUDA(const Config& config) : config(config), cache({}) {
     if (config.deviceId >= static_cast<U64>(deviceCount)) {
        JST_FATAL("[CUDA] Cannot get desired device ID ({}).", config.deviceId);
     }
+    this->deviceCount = deviceCount;
+
+    // Let blocks placed on different GPUs read each other's memory directly.
+
+    peerAccess.assign(deviceCount, std::vector<bool>(deviceCount, false));
+
+    for (I32 i = 0; i < deviceCount; i++) {
+        peerAccess[i][i] = true;
+
+        for (I32 j = 0; j < deviceCount; j++) {
+            if (i == j) {
+                continue;
+            }
+
+            int query = 0;
+            cudaDeviceCanAccessPeer(&query, i, j);
+            if (!query) {
+                continue;
+            }
+
+            cudaSetDevice(i);
+            const auto err = cudaDeviceEnablePeerAccess(j, 0);
+            if (err != cudaSuccess && err != cudaErrorPeerAccessAlreadyEnabled) {
+                JST_WARN("[CUDA] Cannot enable peer access from device {} to device {}.", i, j);
+                continue;
+            }
+            cudaGetLastError();
+
+            peerAccess[i][j] = true;
+        }
+    }
 
     // Setup device.
 
@@ -50,6 +81,7 @@ CUDA::CUDA(const Config& config) : config(config), cache({}) {
         int ccVersionMinor;
         cuDeviceGetAttribute(&ccVersionMinor, CU_DEVICE_ATTRIBUTE_COMPUTE_CAPABILITY_MINOR, device);
         cache.computeCapability = jst::fmt::format("{}.{}", ccVersionMajor, ccVersionMinor);
+        cache.architecture = ccVersionMajor * 10 + ccVersionMinor;
     }
 
     {
@@ -82,6 +114,15 @@ CUDA::CUDA(const Config& config) : config(config), cache({}) {
         cache.physicalMemory = physicalMemory;
     }
 
+    {
+        // Double data rate memory, the clock is in kHz and the bus width in bits.
+        int memoryClockRate = 0;
+        cuDeviceGetAttribute(&memoryClockRate, CU_DEVICE_ATTRIBUTE_MEMORY_CLOCK_RATE, device);
+        int memoryBusWidth = 0;
+        cuDeviceGetAttribute(&memoryBusWidth, CU_DEVICE_ATTRIBUTE_GLOBAL_MEMORY_BUS_WIDTH, device);
+        cache.memoryBandwidth = 2 * static_cast<U64>(memoryClockRate) * 1000 * (memoryBusWidth / 8);
+    }
+
     {
         int query = 0;
 
@@ -114,6 +155,8 @@ CUDA::CUDA(const Config& config) : config(config), cache({}) {
     JST_INFO("Compute Capability: {}", getComputeCapability());
     JST_INFO("Unified Memory:     {}", hasUnifiedMemory() ? "YES" : "NO");
     JST_INFO("Device Memory:      {:.2f} GB", static_cast<F32>(getPhysicalMemory()) / (1024*1024*1024));
+    JST_INFO("Memory Bandwidth:   {:.2f} GB/s", static_cast<F32>(getMemoryBandwidth()) / 1e9);
+    JST_INFO("Device Count:       {}", getDeviceCount());
     JST_INFO("Interoperability:");
     JST_INFO("  - Can Import Device Memory: {}", canImportDeviceMemory() ? "YES" : "NO");
     JST_INFO("  - Can Export Device Memory: {}", canExportDeviceMemory() ? "YES" : "NO");
@@ -143,6 +186,10 @@ std::string CUDA::getComputeCapability() const {
     return cache.computeCapability;
 }
 
+U64 CUDA::getArchitecture() const {
+    return cache.architecture;
+}
+
 PhysicalDeviceType CUDA::getPhysicalDeviceType() const {
     return cache.physicalDeviceType;
 }
@@ -167,4 +214,41 @@ U64 CUDA::getPhysicalMemory() const {
     return cache.physicalMemory;
 }
 
+U64 CUDA::getMemoryBandwidth() const {
+    return cache.memoryBandwidth;
+}
+
+U64 CUDA::getDeviceCount() const {
+    return deviceCount;
+}
+
+bool CUDA::canAccessPeer(const U64& device, const U64& peer) const {
+    if (device >= deviceCount || peer >= deviceCount) {
+        return false;
+    }
+    return peerAccess[device][peer];
+}
+
+CUDA::Placement::Placement(const I32& index) {
+    if (index < 0) {
+        return;
+    }
+
+    // The runtime makes the primary context of the device current, the
+    // context of the backend is restored afterwards.
+
+    cuCtxGetCurrent(&previous);
+    if (cudaSetDevice(index) != cudaSuccess) {
+        JST_ERROR("[CUDA] Cannot place work on device ID ({}).", index);
+        return;
+    }
+    placed = true;
+}
+
+CUDA::Placement::~Placement() {
+    if (placed) {
+        cuCtxSetCurrent(previous);
+    }
+}
+
 }  // namespace Jetstream::Backend
@@ -2,10 +2,13 @@
 #define CA_PRIVATE_IMPLEMENTATION
 #define MTL_PRIVATE_IMPLEMENTATION
 
+#include <filesystem>
+
 #include "jetstream/backend/devices/metal/base.hh"
 
 #include "jetstream/logger.hh"
 #include "jetstream/macros.hh"
+#include "jetstream/platform.hh"
 
 namespace Jetstream::Backend {
 
@@ -20,6 +23,9 @@ Metal::Metal(const Config& config) : config(config) {
     // Import generic information.
     info = NS::ProcessInfo::processInfo();
 
+    // Create pipeline archive.
+    createBinaryArchive();
+
     // Signal device is available.
 
     _isAvailable = true;
@@ -38,10 +44,74 @@ Metal::Metal(const Config& config) : config(config) {
 }
 
 Metal::~Metal() {
+    destroyBinaryArchive();
     info->release();
     device->release();
 }
 
+void Metal::createBinaryArchive() {
+    // The archive is keyed by device and OS version. Compiled pipelines
+    // don't survive either changing.
+
+    std::string cacheFolder;
+    if (Platform::CacheFolder(cacheFolder) == Result::SUCCESS) {
+        const auto key = std::hash<std::string>{}(getDeviceName() + info->operatingSystemVersionString()->utf8String());
+        binaryArchivePath = (std::filesystem::path(cacheFolder) /
+                             jst::fmt::format("metal-pipelines-{:016x}.metallib", key)).string();
+    }
+
+    NS::Error* err = nullptr;
+    auto descriptor = MTL::BinaryArchiveDescriptor::alloc()->init();
+
+    std::error_code ec;
+    if (!binaryArchivePath.empty() && std::filesystem::exists(binaryArchivePath, ec)) {
+        descriptor->setUrl(NS::URL::fileURLWithPath(NS::String::string(binaryArchivePath.c_str(), NS::UTF8StringEncoding)));
+        binaryArchive = device->newBinaryArchive(descriptor, &err);
+
+        if (!binaryArchive) {
+            JST_DEBUG("[METAL] Pipeline archive on disk is stale. Discarding it.");
+            descriptor->setUrl(nullptr);
+        }
+    }
+
+    if (!binaryArchive) {
+        binaryArchive = device->newBinaryArchive(descriptor, &err);
+    }
+
+    if (!binaryArchive) {
+        JST_WARN("[METAL] Can't create pipeline archive. Pipelines won't be cached.");
+    }
+
+    descriptor->release();
+}
+
+void Metal::destroyBinaryArchive() {
+    if (!binaryArchive) {
+        return;
+    }
+
+    // Serialize to a temporary file first because the archive may still map
+    // the file it was loaded from.
+
+    if (!binaryArchivePath.empty()) {
+        const auto temporaryPath = binaryArchivePath + ".tmp";
+        auto url = NS::URL::fileURLWithPath(NS::String::string(temporaryPath.c_str(), NS::UTF8StringEncoding));
+
+        NS::Error* err = nullptr;
+        std::error_code ec;
+        if (binaryArchive->serializeToURL(url, &err)) {
+            std::filesystem::rename(temporaryPath, binaryArchivePath, ec);
+        }
+        if (err || ec) {
+            JST_WARN("[METAL] Failed to save pipeline archive to '{}'.", binaryArchivePath);
+            std::filesystem::remove(temporaryPath, ec);
+        }
+    }
+
+    binaryArchive->release();
+    binaryArchive = nullptr;
+}
+
 bool Metal::isAvailable() const {
     return _isAvailable;
 }
@@ -1,4 +1,10 @@
+#include <cstring>
+#include <fstream>
+#include <algorithm>
+#include <filesystem>
+
 #include "jetstream/logger.hh"
+#include "jetstream/platform.hh"
 
 #include "jetstream/backend/devices/vulkan/base.hh"
 #include "jetstream/backend/devices/vulkan/helpers.hh"
@@ -87,6 +93,10 @@ std::set<std::string> Vulkan::getOptionalDeviceExtensions() {
     extensions.insert(VK_EXT_EXTERNAL_MEMORY_HOST_EXTENSION_NAME);
 #endif
 
+#if defined(VK_EXT_external_memory_dma_buf)
+    extensions.insert(VK_EXT_EXTERNAL_MEMORY_DMA_BUF_EXTENSION_NAME);
+#endif
+
 #if defined(VK_KHR_portability_subset)
     extensions.insert(VK_KHR_PORTABILITY_SUBSET_EXTENSION_NAME);
 #endif
@@ -344,8 +354,8 @@ Vulkan::Vulkan(const Config& _config) : config(_config), cache({}) {
 
     cache.deviceName = properties.deviceName;
     cache.totalProcessorCount = std::thread::hardware_concurrency();
-    cache.getThermalState = 0;  // TODO: Wire implementation.
-    cache.lowPowerStatus = false;  // TODO: Wire implementation.
+    cache.getThermalState = Platform::ThermalState();
+    cache.lowPowerStatus = Platform::LowPowerMode();
 
     {
         uint32_t major = VK_VERSION_MAJOR(properties.apiVersion);
@@ -394,16 +404,24 @@ Vulkan::Vulkan(const Config& _config) : config(_config), cache({}) {
     cache.canImportDeviceMemory = supportedDeviceExtensions.contains(VK_KHR_EXTERNAL_MEMORY_FD_EXTENSION_NAME);
     cache.canExportDeviceMemory = supportedDeviceExtensions.contains(VK_KHR_EXTERNAL_MEMORY_FD_EXTENSION_NAME);
     cache.canImportHostMemory = supportedDeviceExtensions.contains(VK_EXT_EXTERNAL_MEMORY_HOST_EXTENSION_NAME);
+#if defined(VK_EXT_external_memory_dma_buf)
+    cache.canExportDmaBufMemory = cache.canExportDeviceMemory &&
+                                  supportedDeviceExtensions.contains(VK_EXT_EXTERNAL_MEMORY_DMA_BUF_EXTENSION_NAME);
+#else
+    cache.canExportDmaBufMemory = false;
+#endif
 
     // Create logical device.
 
     {
-        QueueFamilyIndices indices = FindQueueFamilies(physicalDevice);
+        queueFamilies = FindQueueFamilies(physicalDevice);
+        const auto& indices = queueFamilies;
 
         std::vector<VkDeviceQueueCreateInfo> queueCreateInfos;
         std::set<uint32_t> uniqueQueueFamilies = {
             indices.graphicFamily.value(),
             indices.computeFamily.value(),
+            indices.transferFamily.value(),
             indices.presentFamily.value(),
         };
 
@@ -452,7 +470,15 @@ Vulkan::Vulkan(const Config& _config) : config(_config), cache({}) {
 
         vkGetDeviceQueue(device, indices.graphicFamily.value(), 0, &graphicsQueue);
         vkGetDeviceQueue(device, indices.computeFamily.value(), 0, &computeQueue);
+        vkGetDeviceQueue(device, indices.transferFamily.value(), 0, &transferQueue);
         vkGetDeviceQueue(device, indices.presentFamily.value(), 0, &presentQueue);
+
+        const std::set<U32> sharedFamilies = {
+            indices.graphicFamily.value(),
+            indices.computeFamily.value(),
+            indices.transferFamily.value(),
+        };
+        sharedQueueFamilies.assign(sharedFamilies.begin(), sharedFamilies.end());
     }
 
     // Validate multisampling level from configuration.
@@ -544,11 +570,9 @@ Vulkan::Vulkan(const Config& _config) : config(_config), cache({}) {
     // Create default command pool.
 
     {
-        Backend::QueueFamilyIndices indices = Backend::FindQueueFamilies(physicalDevice);
-
         VkCommandPoolCreateInfo poolInfo{};
         poolInfo.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
-        poolInfo.queueFamilyIndex = indices.computeFamily.value();
+        poolInfo.queueFamilyIndex = queueFamilies.computeFamily.value();
         poolInfo.flags = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT |
                          VK_COMMAND_POOL_CREATE_TRANSIENT_BIT;
 
@@ -571,6 +595,30 @@ Vulkan::Vulkan(const Config& _config) : config(_config), cache({}) {
         });
     }
 
+    // Create graphics command pool and buffer.
+
+    {
+        VkCommandPoolCreateInfo poolInfo{};
+        poolInfo.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+        poolInfo.queueFamilyIndex = queueFamilies.graphicFamily.value();
+        poolInfo.flags = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT |
+                         VK_COMMAND_POOL_CREATE_TRANSIENT_BIT;
+
+        JST_VK_CHECK_THROW(vkCreateCommandPool(device, &poolInfo, nullptr, &graphicsCommandPool), [&]{
+            JST_FATAL("[VULKAN] Failed to create graphics command pool.");
+        });
+
+        VkCommandBufferAllocateInfo allocInfo{};
+        allocInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+        allocInfo.commandPool = graphicsCommandPool;
+        allocInfo.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+        allocInfo.commandBufferCount = 1;
+
+        JST_VK_CHECK_THROW(vkAllocateCommandBuffers(device, &allocInfo, &graphicsCommandBuffer), [&]{
+            JST_ERROR("[VULKAN] Failed to create graphics command buffer.");
+        });
+    }
+
     // Create default fence.
 
     {
@@ -582,6 +630,99 @@ Vulkan::Vulkan(const Config& _config) : config(_config), cache({}) {
         });
     }
 
+    // Create staging ring.
+
+    {
+        VkBufferCreateInfo bufferInfo{};
+        bufferInfo.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+        bufferInfo.size = StagingRingSlots * StagingRingSlotSize;
+        bufferInfo.usage = VK_BUFFER_USAGE_TRANSFER_SRC_BIT;
+        bufferInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+
+        JST_VK_CHECK_THROW(vkCreateBuffer(device, &bufferInfo, nullptr, &stagingRingBuffer), [&]{
+            JST_FATAL("[VULKAN] Failed to create staging ring buffer.");
+        });
+
+        VkMemoryRequirements memRequirements;
+        vkGetBufferMemoryRequirements(device, stagingRingBuffer, &memRequirements);
+
+        VkMemoryAllocateInfo allocInfo{};
+        allocInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+        allocInfo.allocationSize = memRequirements.size;
+        allocInfo.memoryTypeIndex = Backend::FindMemoryType(physicalDevice,
+                                                            memRequirements.memoryTypeBits,
+                                                            VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT |
+                                                            VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
+
+        JST_VK_CHECK_THROW(vkAllocateMemory(device, &allocInfo, nullptr, &stagingRingMemory), [&]{
+            JST_FATAL("[VULKAN] Failed to allocate staging ring memory.");
+        });
+
+        JST_VK_CHECK_THROW(vkBindBufferMemory(device, stagingRingBuffer, stagingRingMemory, 0), [&]{
+            JST_FATAL("[VULKAN] Failed to bind memory to staging ring.");
+        });
+
+        JST_VK_CHECK_THROW(vkMapMemory(device, stagingRingMemory, 0, bufferInfo.size, 0, &stagingRingMappedMemory), [&]{
+            JST_FATAL("[VULKAN] Failed to map staging ring memory.");
+        });
+
+        // Copies are submitted to the transfer queue before the frame that reads them.
+
+        stagingRingDedicated = queueFamilies.transferFamily != queueFamilies.graphicFamily;
+
+        VkCommandPoolCreateInfo poolInfo{};
+        poolInfo.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+        poolInfo.queueFamilyIndex = queueFamilies.transferFamily.value();
+        poolInfo.flags = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT |
+                         VK_COMMAND_POOL_CREATE_TRANSIENT_BIT;
+
+        JST_VK_CHECK_THROW(vkCreateCommandPool(device, &poolInfo, nullptr, &stagingRingCommandPool), [&]{
+            JST_FATAL("[VULKAN] Failed to create staging ring command pool.");
+        });
+
+        stagingRingSlots.resize(StagingRingSlots);
+
+        for (U64 i = 0; i < StagingRingSlots; i++) {
+            auto& slot = stagingRingSlots[i];
+            slot.offset = i * StagingRingSlotSize;
+
+            VkCommandBufferAllocateInfo commandBufferInfo{};
+            commandBufferInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+            commandBufferInfo.commandPool = stagingRingCommandPool;
+            commandBufferInfo.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+            commandBufferInfo.commandBufferCount = 1;
+
+            JST_VK_CHECK_THROW(vkAllocateCommandBuffers(device, &commandBufferInfo, &slot.commandBuffer), [&]{
+                JST_FATAL("[VULKAN] Failed to create staging ring command buffer.");
+            });
+
+            // Slots start signaled because nothing was submitted yet.
+
+            VkFenceCreateInfo fenceInfo{};
+            fenceInfo.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+            fenceInfo.flags = VK_FENCE_CREATE_SIGNALED_BIT;
+
+            JST_VK_CHECK_THROW(vkCreateFence(device, &fenceInfo, nullptr, &slot.fence), [&]{
+                JST_FATAL("[VULKAN] Failed to create staging ring fence.");
+            });
+
+            if (stagingRingDedicated) {
+                VkSemaphoreCreateInfo semaphoreInfo{};
+                semaphoreInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
+
+                for (auto* semaphore : {&slot.idleSemaphore, &slot.copiedSemaphore}) {
+                    JST_VK_CHECK_THROW(vkCreateSemaphore(device, &semaphoreInfo, nullptr, semaphore), [&]{
+                        JST_FATAL("[VULKAN] Failed to create staging ring semaphore.");
+                    });
+                }
+            }
+        }
+    }
+
+    // Create pipeline cache.
+
+    JST_CHECK_THROW(createPipelineCache());
+
     // Signal device is available.
 
     _isAvailable = true;
@@ -598,17 +739,42 @@ Vulkan::Vulkan(const Config& _config) : config(_config), cache({}) {
     JST_INFO("Processor Count:  {}", getTotalProcessorCount());
     JST_INFO("Device Memory:    {:.2f} GB", static_cast<F32>(getPhysicalMemory()) / (1024*1024*1024));
     JST_INFO("Staging Buffer:   {:.2f} MB", static_cast<F32>(config.stagingBufferSize) / JST_MB);
+    JST_INFO("Staging Ring:     {}x {:.2f} MB", StagingRingSlots, static_cast<F32>(StagingRingSlotSize) / JST_MB);
+    JST_INFO("Queue Families:   Graphics {}, Compute {}, Transfer {}", queueFamilies.graphicFamily.value(),
+                                                                        queueFamilies.computeFamily.value(),
+                                                                        queueFamilies.transferFamily.value());
     JST_INFO("Interoperability:");
     JST_INFO("  - Can Import Device Memory: {}", canImportDeviceMemory() ? "YES" : "NO");
     JST_INFO("  - Can Export Device Memory: {}", canExportDeviceMemory() ? "YES" : "NO");
     JST_INFO("  - Can Export Host Memory:   {}", canImportHostMemory() ? "YES" : "NO");
+    JST_INFO("  - Can Export DMA-BUF:       {}", canExportDmaBufMemory() ? "YES" : "NO");
     JST_INFO("-----------------------------------------------------");
 }
 
 Vulkan::~Vulkan() {
+    synchronizeStagingRing();
+
+    destroyPipelineCache();
+
+    for (auto& slot : stagingRingSlots) {
+        vkDestroyFence(device, slot.fence, nullptr);
+        vkFreeCommandBuffers(device, stagingRingCommandPool, 1, &slot.commandBuffer);
+
+        if (stagingRingDedicated) {
+            vkDestroySemaphore(device, slot.idleSemaphore, nullptr);
+            vkDestroySemaphore(device, slot.copiedSemaphore, nullptr);
+        }
+    }
+    vkDestroyCommandPool(device, stagingRingCommandPool, nullptr);
+    vkUnmapMemory(device, stagingRingMemory);
+    vkDestroyBuffer(device, stagingRingBuffer, nullptr);
+    vkFreeMemory(device, stagingRingMemory, nullptr);
+
     vkDestroyFence(device, defaultFence, nullptr);
     vkFreeCommandBuffers(device, defaultCommandPool, 1, &defaultCommandBuffer);
     vkDestroyCommandPool(device, defaultCommandPool, nullptr);
+    vkFreeCommandBuffers(device, graphicsCommandPool, 1, &graphicsCommandBuffer);
+    vkDestroyCommandPool(device, graphicsCommandPool, nullptr);
     vkUnmapMemory(device, stagingBufferMemory);
     vkDestroyBuffer(device, stagingBuffer, nullptr);
     vkFreeMemory(device, stagingBufferMemory, nullptr);
@@ -625,6 +791,107 @@ Vulkan::~Vulkan() {
     vkDestroyInstance(instance, nullptr);
 }
 
+Result Vulkan::createPipelineCache() {
+    // The cache file is keyed by device and driver. The driver also writes its
+    // own header with the cache UUID, checked below before seeding the cache.
+
+    std::string cacheFolder;
+    if (Platform::CacheFolder(cacheFolder) == Result::SUCCESS) {
+        pipelineCachePath = (std::filesystem::path(cacheFolder) /
+                             jst::fmt::format("vulkan-pipelines-{:08x}-{:08x}-{:08x}.bin",
+                                              properties.vendorID,
+                                              properties.deviceID,
+                                              properties.driverVersion)).string();
+    }
+
+    std::vector<char> data;
+
+    if (!pipelineCachePath.empty()) {
+        std::ifstream file(pipelineCachePath, std::ios::binary);
+        if (file) {
+            data.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+        }
+    }
+
+    if (!data.empty()) {
+        VkPipelineCacheHeaderVersionOne header{};
+
+        if (data.size() < sizeof(header)) {
+            data.clear();
+        } else {
+            std::memcpy(&header, data.data(), sizeof(header));
+
+            if (header.headerVersion != VK_PIPELINE_CACHE_HEADER_VERSION_ONE ||
+                header.vendorID != properties.vendorID ||
+                header.deviceID != properties.deviceID ||
+                std::memcmp(header.pipelineCacheUUID, properties.pipelineCacheUUID, VK_UUID_SIZE) != 0) {
+                JST_DEBUG("[VULKAN] Pipeline cache on disk is stale. Discarding it.");
+                data.clear();
+            }
+        }
+    }
+
+    VkPipelineCacheCreateInfo pipelineCacheInfo{};
+    pipelineCacheInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO;
+    pipelineCacheInfo.initialDataSize = data.size();
+    pipelineCacheInfo.pInitialData = data.empty() ? nullptr : data.data();
+
+    if (vkCreatePipelineCache(device, &pipelineCacheInfo, nullptr, &pipelineCache) != VK_SUCCESS) {
+        // The driver may still reject a cache with a valid header. Start empty.
+
+        pipelineCacheInfo.initialDataSize = 0;
+        pipelineCacheInfo.pInitialData = nullptr;
+
+        JST_VK_CHECK(vkCreatePipelineCache(device, &pipelineCacheInfo, nullptr, &pipelineCache), [&]{
+            JST_ERROR("[VULKAN] Failed to create pipeline cache.");
+        });
+    }
+
+    JST_DEBUG("[VULKAN] Pipeline cache seeded with {} bytes.", pipelineCacheInfo.initialDataSize);
+
+    return Result::SUCCESS;
+}
+
+void Vulkan::destroyPipelineCache() {
+    if (pipelineCache == VK_NULL_HANDLE) {
+        return;
+    }
+
+    if (!pipelineCachePath.empty()) {
+        size_t size = 0;
+        std::vector<char> data;
+
+        if (vkGetPipelineCacheData(device, pipelineCache, &size, nullptr) == VK_SUCCESS && size > 0) {
+            data.resize(size);
+            if (vkGetPipelineCacheData(device, pipelineCache, &size, data.data()) != VK_SUCCESS) {
+                data.clear();
+            }
+        }
+
+        // Write to a temporary file first so a crash never leaves a truncated cache.
+
+        if (!data.empty()) {
+            const auto temporaryPath = pipelineCachePath + ".tmp";
+
+            std::ofstream file(temporaryPath, std::ios::binary | std::ios::trunc);
+            file.write(data.data(), static_cast<std::streamsize>(size));
+            file.close();
+
+            std::error_code ec;
+            if (file) {
+                std::filesystem::rename(temporaryPath, pipelineCachePath, ec);
+            }
+            if (!file || ec) {
+                JST_WARN("[VULKAN] Failed to save pipeline cache to '{}'.", pipelineCachePath);
+                std::filesystem::remove(temporaryPath, ec);
+            }
+        }
+    }
+
+    vkDestroyPipelineCache(device, pipelineCache, nullptr);
+    pipelineCache = VK_NULL_HANDLE;
+}
+
 VkSampleCountFlagBits Vulkan::getMultisampling() const {
     switch (config.multisampling) {
         case  1: return VK_SAMPLE_COUNT_1_BIT;
@@ -670,6 +937,10 @@ bool Vulkan::canImportHostMemory() const {
     return cache.canImportHostMemory;
 }
 
+bool Vulkan::canExportDmaBufMemory() const {
+    return cache.canExportDmaBufMemory;
+}
+
 U64 Vulkan::getPhysicalMemory() const {
     return cache.physicalMemory;
 }
@@ -679,13 +950,197 @@ U64 Vulkan::getTotalProcessorCount() const {
 }
 
 bool Vulkan::getLowPowerStatus() const {
-    // TODO: Pool power status periodically.
-    return cache.lowPowerStatus;
+    return Platform::LowPowerMode();
+}
+
+void Vulkan::setSharingMode(VkBufferCreateInfo& info) const {
+    if (sharedQueueFamilies.size() > 1) {
+        info.sharingMode = VK_SHARING_MODE_CONCURRENT;
+        info.queueFamilyIndexCount = static_cast<U32>(sharedQueueFamilies.size());
+        info.pQueueFamilyIndices = sharedQueueFamilies.data();
+    } else {
+        info.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+        info.queueFamilyIndexCount = 0;
+        info.pQueueFamilyIndices = nullptr;
+    }
 }
 
 U64 Vulkan::getThermalState() const {
-    // TODO: Pool thermal state periodically.
-    return cache.getThermalState;
+    return Platform::ThermalState();
+}
+
+Result Vulkan::stageBufferUpload(const VkBuffer& buffer,
+                                 const U64& offset,
+                                 const void* data,
+                                 const U64& size) {
+    std::lock_guard<std::mutex> lock(stagingRingMutex);
+
+    const U8* hostData = static_cast<const U8*>(data);
+    U8* mappedData = static_cast<U8*>(stagingRingMappedMemory);
+
+    U64 copied = 0;
+    while (copied < size) {
+        auto& slot = stagingRingSlots[stagingRingIndex];
+
+        if (slot.used == StagingRingSlotSize) {
+            JST_CHECK(submitStagingSlot(slot));
+            continue;
+        }
+
+        if (!slot.recording) {
+            JST_CHECK(beginStagingSlot(slot));
+        }
+
+        const U64 chunk = std::min(size - copied, StagingRingSlotSize - slot.used);
+
+        memcpy(mappedData + slot.offset + slot.used, hostData + copied, chunk);
+
+        VkBufferCopy copyRegion{};
+        copyRegion.srcOffset = slot.offset + slot.used;
+        copyRegion.dstOffset = offset + copied;
+        copyRegion.size = chunk;
+        vkCmdCopyBuffer(slot.commandBuffer, stagingRingBuffer, buffer, 1, &copyRegion);
+
+        // Keep the next chunk aligned for the memory copy.
+        slot.used = std::min((slot.used + chunk + 15) & ~static_cast<U64>(15), StagingRingSlotSize);
+        copied += chunk;
+    }
+
+    return Result::SUCCESS;
+}
+
+Result Vulkan::flushStagingRing() {
+    std::lock_guard<std::mutex> lock(stagingRingMutex);
+
+    auto& slot = stagingRingSlots[stagingRingIndex];
+
+    if (slot.recording) {
+        JST_CHECK(submitStagingSlot(slot));
+    }
+
+    return Result::SUCCESS;
+}
+
+Result Vulkan::synchronizeStagingRing() {
+    JST_CHECK(flushStagingRing());
+
+    std::lock_guard<std::mutex> lock(stagingRingMutex);
+
+    for (auto& slot : stagingRingSlots) {
+        vkWaitForFences(device, 1, &slot.fence, VK_TRUE, UINT64_MAX);
+    }
+
+    return Result::SUCCESS;
+}
+
+Result Vulkan::beginStagingSlot(StagingSlot& slot) {
+    // Wait for the last copies of this slot to be executed.
+
+    vkWaitForFences(device, 1, &slot.fence, VK_TRUE, UINT64_MAX);
+
+    JST_VK_CHECK(vkResetCommandBuffer(slot.commandBuffer, 0), [&]{
+        JST_ERROR("[VULKAN] Can't reset staging ring command buffer.");
+    });
+
+    VkCommandBufferBeginInfo beginInfo = {};
+    beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+    beginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+
+    JST_VK_CHECK(vkBeginCommandBuffer(slot.commandBuffer, &beginInfo), [&]{
+        JST_ERROR("[VULKAN] Can't begin staging ring command buffer.");
+    });
+
+    // Frames still in flight might be reading the destination buffers.
+
+    VkMemoryBarrier barrier{};
+    barrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+    barrier.srcAccessMask = 0;
+    barrier.dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+
+    vkCmdPipelineBarrier(slot.commandBuffer,
+                         VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
+                         VK_PIPELINE_STAGE_TRANSFER_BIT,
+                         0, 1, &barrier, 0, nullptr, 0, nullptr);
+
+    slot.used = 0;
+    slot.recording = true;
+
+    return Result::SUCCESS;
+}
+
+Result Vulkan::submitStagingSlot(StagingSlot& slot) {
+    // Make the copies visible to the work submitted after this slot.
+
+    VkMemoryBarrier barrier{};
+    barrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+    barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+    barrier.dstAccessMask = VK_ACCESS_MEMORY_READ_BIT;
+
+    vkCmdPipelineBarrier(slot.commandBuffer,
+                         VK_PIPELINE_STAGE_TRANSFER_BIT,
+                         VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
+                         0, 1, &barrier, 0, nullptr, 0, nullptr);
+
+    JST_VK_CHECK(vkEndCommandBuffer(slot.commandBuffer), [&]{
+        JST_ERROR("[VULKAN] Can't end staging ring command buffer.");
+    });
+
+    vkResetFences(device, 1, &slot.fence);
+
+    VkSubmitInfo submitInfo = {};
+    submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+    submitInfo.commandBufferCount = 1;
+    submitInfo.pCommandBuffers = &slot.commandBuffer;
+
+    if (!stagingRingDedicated) {
+        std::lock_guard<std::mutex> lock(Backend::QueueMutex());
+        JST_VK_CHECK(vkQueueSubmit(transferQueue, 1, &submitInfo, slot.fence), [&]{
+            JST_ERROR("[VULKAN] Can't submit staging ring copies.");
+        });
+    } else {
+        // Frames already submitted might still read the destination buffers. The
+        // copies wait for them, and the graphics work submitted next waits for the
+        // copies. Both are ordered with empty submissions to the graphics queue.
+
+        const VkPipelineStageFlags transferStage = VK_PIPELINE_STAGE_TRANSFER_BIT;
+        const VkPipelineStageFlags readStage = VK_PIPELINE_STAGE_ALL_COMMANDS_BIT;
+
+        VkSubmitInfo idleInfo = {};
+        idleInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+        idleInfo.signalSemaphoreCount = 1;
+        idleInfo.pSignalSemaphores = &slot.idleSemaphore;
+
+        submitInfo.waitSemaphoreCount = 1;
+        submitInfo.pWaitSemaphores = &slot.idleSemaphore;
+        submitInfo.pWaitDstStageMask = &transferStage;
+        submitInfo.signalSemaphoreCount = 1;
+        submitInfo.pSignalSemaphores = &slot.copiedSemaphore;
+
+        VkSubmitInfo copiedInfo = {};
+        copiedInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+        copiedInfo.waitSemaphoreCount = 1;
+        copiedInfo.pWaitSemaphores = &slot.copiedSemaphore;
+        copiedInfo.pWaitDstStageMask = &readStage;
+
+        std::lock_guard<std::mutex> lock(Backend::QueueMutex());
+
+        JST_VK_CHECK(vkQueueSubmit(graphicsQueue, 1, &idleInfo, VK_NULL_HANDLE), [&]{
+            JST_ERROR("[VULKAN] Can't submit staging ring wait.");
+        });
+
+        JST_VK_CHECK(vkQueueSubmit(transferQueue, 1, &submitInfo, VK_NULL_HANDLE), [&]{
+            JST_ERROR("[VULKAN] Can't submit staging ring copies.");
+        });
+
+        JST_VK_CHECK(vkQueueSubmit(graphicsQueue, 1, &copiedInfo, slot.fence), [&]{
+            JST_ERROR("[VULKAN] Can't submit staging ring signal.");
+        });
+    }
+
+    slot.recording = false;
+    stagingRingIndex = (stagingRingIndex + 1) % StagingRingSlots;
+
+    return Result::SUCCESS;
 }
 
 }  // namespace Jetstream::Backend
@@ -1,16 +1,45 @@
 #include <chrono>
+#include <tuple>
+#include <fstream>
+#include <sstream>
+#include <algorithm>
 
 #include "jetstream/benchmark.hh"
+#include "jetstream/instance.hh"
+#include "jetstream/backend/base.hh"
+#include "jetstream/render/statistics.hh"
+
+#include "flowgraph/rapidyaml.hh"
 
 namespace Jetstream {
 
+namespace {
+
+// Peak memory bandwidth of a device in GB/s. Zero if the backend can't tell.
+F64 PeakBandwidth(const Device& device) {
+#ifdef JETSTREAM_BACKEND_CUDA_AVAILABLE
+    if (device == Device::CUDA && Backend::Initialized<Device::CUDA>()) {
+        return Backend::State<Device::CUDA>()->getMemoryBandwidth() / 1e9;
+    }
+#endif
+    (void)device;
+    return 0.0;
+}
+
+}  // namespace
+
 Benchmark& Benchmark::getInstance() {
     static Benchmark instance;
     return instance;
 }
 
 U64 Benchmark::totalCount() {
-    return benchmarks.size();
+    return std::count_if(benchmarks.begin(), benchmarks.end(), [&](const auto& entry) {
+        const auto& [module, cases] = entry;
+        return std::any_of(cases.begin(), cases.end(), [&](const auto& c) {
+            return selected(module, c.first);
+        });
+    });
 }
 
 U64 Benchmark::currentCount() {
@@ -25,6 +54,81 @@ const Benchmark::ResultMapType& Benchmark::getResults() {
     return results;
 }
 
+Result Benchmark::setOptions(const Options& options) {
+    const auto flags = std::regex::ECMAScript | std::regex::icase;
+
+    try {
+        moduleFilter = std::regex(options.module, flags);
+        deviceFilter = std::regex(options.device, flags);
+        typeFilter = std::regex(options.type, flags);
+        nameFilter = std::regex(options.name, flags);
+    } catch (const std::regex_error& e) {
+        JST_ERROR("[BENCHMARK] Invalid filter expression ({}).", e.what());
+        return Result::ERROR;
+    }
+
+    this->options = options;
+
+    return Result::SUCCESS;
+}
+
+bool Benchmark::selected(const std::string& name) {
+    return options.name.empty() || std::regex_search(name, nameFilter);
+}
+
+bool Benchmark::selected(const std::string& module, const std::string& prefix) {
+    // The prefix is "<device> - <type> - ".
+    const auto device = prefix.substr(0, prefix.find(" - "));
+    const auto type = prefix.substr(device.size() + 3, prefix.rfind(" - ") - device.size() - 3);
+
+    return (options.module.empty() || std::regex_search(module, moduleFilter)) &&
+           (options.device.empty() || std::regex_search(device, deviceFilter)) &&
+           (options.type.empty() || std::regex_search(type, typeFilter));
+}
+
+const std::vector<std::pair<U64, U64>>& Benchmark::sweepPoints() {
+    // SDR-typical sizes are mixed with the powers of two to expose
+    // non-radix-2 slow paths. Points above 16M samples are skipped.
+    static const std::vector<std::pair<U64, U64>> points = []{
+        const std::vector<U64> sizes = {
+            256, 1000, 1024, 2000, 2048, 4096, 8000, 8192,
+            16384, 50000, 65536, 100000, 131072, 1000000, 1048576,
+        };
+        const std::vector<U64> batches = {1, 16, 128};
+
+        std::vector<std::pair<U64, U64>> points;
+        for (const auto& batch : batches) {
+            for (const auto& size : sizes) {
+                if (batch * size <= (1 << 24)) {
+                    points.push_back({batch, size});
+                }
+            }
+        }
+        return points;
+    }();
+    static const std::vector<std::pair<U64, U64>> none;
+
+    return sweeping ? points : none;
+}
+
+std::string Benchmark::sweepName(const std::string& name,
+                                 const std::string& group,
+                                 const U64& batch,
+                                 const U64& size) {
+    const auto testName = jst::fmt::format("{} ({}x{})", group, batch, size);
+
+    // The name is "<device> - <type> - ".
+    auto& point = sweeps[name + testName];
+    point.module = currentModule;
+    point.device = name.substr(0, name.find(" - "));
+    point.type = name.substr(point.device.size() + 3, name.rfind(" - ") - point.device.size() - 3);
+    point.group = group;
+    point.batch = batch;
+    point.size = size;
+
+    return testName;
+}
+
 void Benchmark::add(const std::string& module,
                     const std::string& device, 
                     const std::string& type, 
@@ -40,28 +144,50 @@ void Benchmark::run(const std::string& outputType, std::ostream& out) {
     if (outputType != "markdown" && 
         outputType != "csv" && 
         outputType != "json" &&
+        outputType != "sweep" &&
         outputType != "quiet") {
         JST_FATAL("[BENCHMARK] Unknown output type: {}", outputType);
         JST_CHECK_THROW(Result::FATAL);
     }
 
+    sweeping = (outputType == "sweep");
+    sweeps.clear();
+    deviceTimes.clear();
+
     for (auto& [module, benchmark] : benchmarks) {
         using namespace std::chrono_literals;
 
+        if (std::none_of(benchmark.begin(), benchmark.end(), [&](const auto& c) { return selected(module, c.first); })) {
+            continue;
+        }
+
+        currentModule = module;
+
         nanobench::Bench bench;
 
         bench.title(module)
              .output(nullptr)
              .timeUnit(1ms, "ms")
-             .minEpochTime(100ms)
+             .minEpochTime(std::chrono::milliseconds(options.minEpochTimeMs))
              .relative(false);
 
+        if (options.epochs > 0) {
+            bench.epochs(options.epochs);
+        }
+
         if (outputType == "markdown") {
             bench.output(&out);
         }
 
         for (auto& [name, benchmark] : benchmark) {
-            benchmark(bench, name);
+            if (selected(module, name)) {
+                benchmark(bench, name);
+            }
+        }
+
+        // Every case of the module was filtered by name.
+        if (bench.results().empty()) {
+            continue;
         }
 
         if (outputType == "csv") {
@@ -73,15 +199,457 @@ void Benchmark::run(const std::string& outputType, std::ostream& out) {
         for (const auto& result : bench.results()) {
             const auto elapsed = result.median(nanobench::Result::Measure::elapsed);
             const auto error = result.medianAbsolutePercentError(nanobench::Result::Measure::elapsed);
+            const auto opsPerSec = result.config().mBatch / elapsed;
+
+            Throughput throughput;
+            if (throughputs.contains(result.config().mBenchmarkName)) {
+                throughput = throughputs.at(result.config().mBenchmarkName);
+            }
+
+            F64 kernelMs = 0.0;
+            F64 peakGbPerSec = 0.0;
+            if (deviceTimes.contains(result.config().mBenchmarkName)) {
+                const auto& [device, milliseconds] = deviceTimes.at(result.config().mBenchmarkName);
+                kernelMs = milliseconds;
+                peakGbPerSec = PeakBandwidth(device);
+            }
 
             results[module].push_back({
                 .name = result.config().mBenchmarkName,
-                .ops_per_sec = bench.batch() / elapsed,
-                .ms_per_op = elapsed / bench.batch() * 1000.0f,
+                .ops_per_sec = opsPerSec,
+                .ms_per_op = elapsed / result.config().mBatch * 1000.0f,
                 .error = error,
+                .samples_per_sec = throughput.elements * opsPerSec,
+                .gb_per_sec = throughput.bytes * opsPerSec / 1e9,
+                .gflops_per_sec = throughput.flops * opsPerSec / 1e9,
+                .kernel_ms_per_op = kernelMs,
+                .kernel_gb_per_sec = (kernelMs > 0.0) ? throughput.bytes / (kernelMs * 1e6) : 0.0,
+                .peak_gb_per_sec = peakGbPerSec,
             });
         }
+
+        // Nanobench only knows about operations.
+        if (outputType == "markdown") {
+            const auto optional = [](const F64& value, const std::string& unit = "") {
+                return (value > 0.0) ? jst::fmt::format("{:.2f}{}", value, unit) : std::string("-");
+            };
+
+            out << "\n| Msamples/s | GB/s | GFLOP/s | kernel ms/op | kernel GB/s | % of peak | benchmark\n";
+            out << "|-----------:|-----:|--------:|-------------:|------------:|----------:|:----------\n";
+            for (const auto& entry : results[module]) {
+                const F64 peak = (entry.peak_gb_per_sec > 0.0) ? entry.kernel_gb_per_sec / entry.peak_gb_per_sec * 100.0 : 0.0;
+                out << jst::fmt::format("| {:10.2f} | {:4.2f} | {:7} | {:12} | {:11} | {:9} | `{}`\n", entry.samples_per_sec / 1e6,
+                                                                                                  entry.gb_per_sec,
+                                                                                                  optional(entry.gflops_per_sec),
+                                                                                                  optional(entry.kernel_ms_per_op),
+                                                                                                  optional(entry.kernel_gb_per_sec),
+                                                                                                  optional(peak, "%"),
+                                                                                                  entry.name);
+            }
+            out << "\n";
+        }
+    }
+
+    // One row per sweep point, sorted so every series is contiguous.
+    if (sweeping) {
+        std::vector<std::pair<SweepPoint, const ResultEntry*>> rows;
+        for (const auto& [_, entries] : results) {
+            for (const auto& entry : entries) {
+                if (sweeps.contains(entry.name)) {
+                    rows.push_back({sweeps.at(entry.name), &entry});
+                }
+            }
+        }
+
+        std::sort(rows.begin(), rows.end(), [](const auto& a, const auto& b) {
+            return std::tie(a.first.module, a.first.group, a.first.device, a.first.type, a.first.batch, a.first.size) <
+                   std::tie(b.first.module, b.first.group, b.first.device, b.first.type, b.first.batch, b.first.size);
+        });
+
+        out << "module,group,device,type,batch,size,ms_per_op,error,samples_per_sec,gb_per_sec,gflops_per_sec,kernel_ms_per_op,kernel_gb_per_sec\n";
+        for (const auto& [point, entry] : rows) {
+            out << jst::fmt::format("{},{},{},{},{},{},{},{},{},{},{},{},{}\n", point.module,
+                                                                          point.group,
+                                                                          point.device,
+                                                                          point.type,
+                                                                          point.batch,
+                                                                          point.size,
+                                                                          entry->ms_per_op,
+                                                                          entry->error,
+                                                                          entry->samples_per_sec,
+                                                                          entry->gb_per_sec,
+                                                                          entry->gflops_per_sec,
+                                                                          entry->kernel_ms_per_op,
+                                                                          entry->kernel_gb_per_sec);
+        }
+    }
+
+    sweeping = false;
+}
+
+Result Benchmark::runFlowgraph(Instance& instance, const FlowgraphConfig& config, std::ostream& out) {
+    auto& flowgraph = instance.flowgraph();
+    auto& scheduler = instance.scheduler();
+
+    JST_CHECK(flowgraph.create());
+    flowgraph.setSyntheticSources(true);
+    JST_CHECK(flowgraph.importFromFile(config.path));
+
+    // Samples entering the graph every frame, counted at the generators.
+
+    U64 samplesPerFrame = 0;
+    std::vector<std::string> skipped;
+
+    for (const auto& locale : flowgraph.nodesOrder()) {
+        const auto& node = flowgraph.nodes().at(locale);
+
+        if (!node->block->complete()) {
+            skipped.push_back(locale.blockId);
+            continue;
+        }
+
+        if (node->fingerprint.id != "signal_generator") {
+            continue;
+        }
+
+        for (const auto& [_, record] : node->outputMap) {
+            samplesPerFrame += std::accumulate(record.shape.begin(), record.shape.end(), U64{1}, std::multiplies<U64>());
+        }
+    }
+
+    if (samplesPerFrame == 0) {
+        JST_ERROR("[BENCHMARK] Flowgraph '{}' has no source to benchmark.", config.path);
+        return Result::ERROR;
+    }
+
+    // Warm up caches, allocators and device pipelines.
+
+    JST_CHECK(instance.start());
+
+    for (U64 i = 0; i < config.warmupFrames; i++) {
+        JST_CHECK(instance.compute());
     }
+
+    // Measure.
+
+    scheduler.setProfiling(false);
+    scheduler.setProfiling(true);
+
+    const U64 startCycles = scheduler.computeCycles();
+    const U64 startUnderruns = scheduler.graphUnderruns();
+
+    std::vector<F64> frameTimes;
+    frameTimes.reserve(config.frames);
+
+    const auto start = std::chrono::steady_clock::now();
+    for (U64 i = 0; i < config.frames; i++) {
+        const auto frameStart = std::chrono::steady_clock::now();
+        JST_CHECK(instance.compute());
+        frameTimes.push_back(std::chrono::duration<F64, std::milli>(std::chrono::steady_clock::now() - frameStart).count());
+    }
+    const F64 elapsed = std::chrono::duration<F64>(std::chrono::steady_clock::now() - start).count();
+
+    const U64 underruns = scheduler.graphUnderruns() - startUnderruns;
+    const U64 frames = scheduler.computeCycles() - startCycles - underruns;
+    const auto moduleLatency = scheduler.moduleLatency();
+
+    JST_CHECK(instance.reset());
+    JST_CHECK(instance.stop());
+
+    // Report.
+
+    std::sort(frameTimes.begin(), frameTimes.end());
+    const auto percentile = [&](const F64& p) {
+        return frameTimes[std::min<U64>(frameTimes.size() - 1, p * frameTimes.size())];
+    };
+
+    std::vector<std::pair<std::string, LatencyHistogram::Summary>> modules;
+    F64 modulesTotal = 0.0;
+    for (const auto& [locale, summary] : moduleLatency) {
+        modules.push_back({jst::fmt::format("{}", locale), summary});
+        modulesTotal += summary.mean * summary.count;
+    }
+    std::sort(modules.begin(), modules.end(), [](const auto& a, const auto& b) {
+        return a.second.mean * a.second.count > b.second.mean * b.second.count;
+    });
+
+    out << jst::fmt::format("# Flowgraph Benchmark: {}\n\n", config.path);
+    out << "| frames | underruns | samples/frame | Msamples/s | frame p50 (ms) | p90 | p99 | max\n";
+    out << "|-------:|----------:|--------------:|-----------:|---------------:|----:|----:|----:\n";
+    out << jst::fmt::format("| {} | {} | {} | {:.2f} | {:.3f} | {:.3f} | {:.3f} | {:.3f}\n\n", frames,
+                                                                                            underruns,
+                                                                                            samplesPerFrame,
+                                                                                            frames * samplesPerFrame / elapsed / 1e6,
+                                                                                            percentile(0.50),
+                                                                                            percentile(0.90),
+                                                                                            percentile(0.99),
+                                                                                            frameTimes.back());
+
+    out << "| module | p50 (ms) | p99 (ms) | share\n";
+    out << "|:-------|---------:|---------:|------:\n";
+    for (const auto& [name, summary] : modules) {
+        out << jst::fmt::format("| `{}` | {:.3f} | {:.3f} | {:.1f}%\n", name,
+                                                                      summary.p50,
+                                                                      summary.p99,
+                                                                      (modulesTotal > 0.0) ? 100.0 * summary.mean * summary.count / modulesTotal : 0.0);
+    }
+
+    if (!skipped.empty()) {
+        out << "\nSkipped incomplete blocks:";
+        for (const auto& block : skipped) {
+            out << " `" << block << "`";
+        }
+        out << "\n";
+    }
+
+    return Result::SUCCESS;
+}
+
+Result Benchmark::compare(const std::string& baselinePath, std::ostream& out) {
+    // A case regresses when it's slower by more than the minimum change and
+    // by more than the median absolute percent errors of both runs combined.
+    constexpr F64 MinimumChange = 0.05;
+
+    std::ifstream file(baselinePath);
+    if (!file.is_open()) {
+        JST_ERROR("[BENCHMARK] Can't open baseline '{}'.", baselinePath);
+        return Result::ERROR;
+    }
+    std::stringstream buffer;
+    buffer << file.rdbuf();
+    const std::string data = buffer.str();
+
+    // The `json` output writes one document per module.
+
+    struct Baseline {
+        F64 ms_per_op;
+        F64 error;
+    };
+    std::map<std::pair<std::string, std::string>, Baseline> baseline;
+
+    const auto value = [](const ryml::ConstNodeRef& node, const char* key) {
+        const auto val = node[ryml::to_csubstr(key)].val();
+        return std::string(val.str, val.len);
+    };
+
+    U64 depth = 0;
+    U64 begin = 0;
+    bool quoted = false;
+    for (U64 i = 0; i < data.size(); i++) {
+        const char c = data[i];
+
+        if (quoted) {
+            if (c == '\\') {
+                i++;
+            } else if (c == '"') {
+                quoted = false;
+            }
+            continue;
+        }
+
+        if (c == '"') {
+            quoted = true;
+        } else if (c == '{' && depth++ == 0) {
+            begin = i;
+        } else if (c == '}' && depth > 0 && --depth == 0) {
+            const auto document = data.substr(begin, i - begin + 1);
+            const auto tree = ryml::parse_in_arena(ryml::to_csubstr(document));
+            const auto root = tree.rootref();
+
+            if (!root.is_map() || !root.has_child("results")) {
+                continue;
+            }
+
+            for (const auto& result : root["results"].children()) {
+                const F64 batch = std::stod(value(result, "batch"));
+                const F64 elapsed = std::stod(value(result, "median(elapsed)"));
+
+                baseline[{value(result, "title"), value(result, "name")}] = {
+                    .ms_per_op = elapsed / batch * 1000.0,
+                    .error = std::stod(value(result, "medianAbsolutePercentError(elapsed)")),
+                };
+            }
+        }
+    }
+
+    if (baseline.empty()) {
+        JST_ERROR("[BENCHMARK] Baseline '{}' has no results. It should be written by the `json` output.", baselinePath);
+        return Result::ERROR;
+    }
+
+    // Run and compare.
+
+    run("quiet", out);
+
+    U64 regressions = 0;
+    U64 compared = 0;
+
+    out << "| module | benchmark | baseline ms/op | ms/op | change | threshold | status\n";
+    out << "|:-------|:----------|---------------:|------:|-------:|----------:|:------\n";
+
+    for (const auto& [module, entries] : results) {
+        for (const auto& entry : entries) {
+            if (!baseline.contains({module, entry.name})) {
+                continue;
+            }
+            const auto& base = baseline.at({module, entry.name});
+
+            const F64 change = (entry.ms_per_op - base.ms_per_op) / base.ms_per_op;
+            const F64 threshold = std::max(MinimumChange, base.error + entry.error);
+
+            std::string status = "ok";
+            if (change > threshold) {
+                status = "**regression**";
+                regressions++;
+            } else if (change < -threshold) {
+                status = "improvement";
+            }
+            compared++;
+
+            out << jst::fmt::format("| {} | `{}` | {:.4f} | {:.4f} | {:+.1f}% | {:.1f}% | {}\n", module,
+                                                                                            entry.name,
+                                                                                            base.ms_per_op,
+                                                                                            entry.ms_per_op,
+                                                                                            change * 100.0,
+                                                                                            threshold * 100.0,
+                                                                                            status);
+        }
+    }
+
+    out << jst::fmt::format("\nCompared {} of {} baseline cases, {} regressed.\n", compared, baseline.size(), regressions);
+
+    if (regressions > 0) {
+        JST_ERROR("[BENCHMARK] {} case(s) regressed against '{}'.", regressions, baselinePath);
+        return Result::ERROR;
+    }
+
+    return Result::SUCCESS;
+}
+
+Result Benchmark::runRender(Instance& instance, const RenderConfig& config, std::ostream& out) {
+    // Every case is a noise generator feeding one visualization block.
+    // The lineplot also draws its grid and labels with the shapes and text components.
+
+    struct Case {
+        std::string name;
+        std::string block;
+        std::string dataType;
+        U64 size;
+    };
+
+    const std::vector<Case> cases = {
+        {"Lineplot 2048", "lineplot", "F32", 2048},
+        {"Lineplot 65536", "lineplot", "F32", 65536},
+        {"Waterfall 2048", "waterfall", "F32", 2048},
+        {"Waterfall 65536", "waterfall", "F32", 65536},
+        {"Spectrogram 2048", "spectrogram", "F32", 2048},
+        {"Constellation 8192", "constellation", "CF32", 8192},
+    };
+
+    auto& flowgraph = instance.flowgraph();
+    if (!flowgraph.created()) {
+        JST_CHECK(flowgraph.create());
+    }
+
+    out << jst::fmt::format("# Render Benchmark: {}\n\n", GetDeviceName(instance.window().device()));
+    out << "| case | frame p50 (ms) | frame p99 (ms) | present p50 (ms) | draws/frame | buffer MB/s | texture MB/s\n";
+    out << "|:-----|---------------:|---------------:|-----------------:|------------:|------------:|-------------:\n";
+
+    for (const auto& c : cases) {
+        const auto yaml = jst::fmt::format(
+            "---\n"
+            "protocolVersion: 1.0.0\n"
+            "cyberetherVersion: {}\n"
+            "graph:\n"
+            "  src:\n"
+            "    module: signal_generator\n"
+            "    device: cpu\n"
+            "    dataType: {}\n"
+            "    config:\n"
+            "      signalType: Noise\n"
+            "      bufferSize: {}\n"
+            "  view:\n"
+            "    module: {}\n"
+            "    device: cpu\n"
+            "    dataType: {}\n"
+            "    input:\n"
+            "      buffer: ${{graph.src.output.buffer}}\n", JETSTREAM_VERSION_STR, c.dataType, c.size, c.block, c.dataType);
+        const std::vector<char> blob(yaml.begin(), yaml.end());
+
+        JST_CHECK(flowgraph.importFromBlob(blob));
+
+        const auto& view = flowgraph.nodes().at({"view"});
+        if (!view->block->complete()) {
+            out << jst::fmt::format("| {} | - | - | - | - | - | - \n", c.name);
+            JST_CHECK(instance.reset());
+            continue;
+        }
+
+        std::vector<F64> frameTimes;
+        std::vector<F64> presentTimes;
+        frameTimes.reserve(config.frames);
+        presentTimes.reserve(config.frames);
+
+        Render::Statistics::Snapshot before;
+        std::chrono::steady_clock::time_point start;
+
+        for (U64 i = 0; i < config.warmupFrames + config.frames; i++) {
+            if (i == config.warmupFrames) {
+                before = Render::Statistics::Read();
+                start = std::chrono::steady_clock::now();
+            }
+
+            JST_CHECK(instance.viewport().pollEvents());
+            JST_CHECK(instance.compute());
+
+            const auto frameStart = std::chrono::steady_clock::now();
+            const auto res = instance.begin();
+            if (res == Result::SKIP) {
+                continue;
+            }
+            JST_CHECK(res);
+
+            const auto presentStart = std::chrono::steady_clock::now();
+            JST_CHECK(instance.present());
+            const auto presentEnd = std::chrono::steady_clock::now();
+
+            if (instance.end() == Result::SKIP) {
+                continue;
+            }
+
+            if (i >= config.warmupFrames) {
+                const auto frameEnd = std::chrono::steady_clock::now();
+                frameTimes.push_back(std::chrono::duration<F64, std::milli>(frameEnd - frameStart).count());
+                presentTimes.push_back(std::chrono::duration<F64, std::milli>(presentEnd - presentStart).count());
+            }
+        }
+
+        const F64 elapsed = std::chrono::duration<F64>(std::chrono::steady_clock::now() - start).count();
+        const auto work = Render::Statistics::Read() - before;
+
+        JST_CHECK(instance.reset());
+
+        if (frameTimes.empty()) {
+            out << jst::fmt::format("| {} | - | - | - | - | - | - \n", c.name);
+            continue;
+        }
+
+        std::sort(frameTimes.begin(), frameTimes.end());
+        std::sort(presentTimes.begin(), presentTimes.end());
+        const auto percentile = [](const std::vector<F64>& times, const F64& p) {
+            return times[std::min<U64>(times.size() - 1, p * times.size())];
+        };
+
+        out << jst::fmt::format("| {} | {:.3f} | {:.3f} | {:.3f} | {:.1f} | {:.1f} | {:.1f}\n", c.name,
+                                                                                          percentile(frameTimes, 0.50),
+                                                                                          percentile(frameTimes, 0.99),
+                                                                                          percentile(presentTimes, 0.50),
+                                                                                          static_cast<F64>(work.drawCalls) / frameTimes.size(),
+                                                                                          work.bufferUploadBytes / elapsed / 1e6,
+                                                                                          work.textureUploadBytes / elapsed / 1e6);
+    }
+
+    return Result::SUCCESS;
 }
 
-}  // namespace Jetstream
\ No newline at end of file
+}  // namespace Jetstream
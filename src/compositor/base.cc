@@ -1,4 +1,5 @@
 #include <regex>
+#include <chrono>
 
 #include "jetstream/benchmark.hh"
 #include "jetstream/compositor.hh"
@@ -29,6 +30,7 @@ Compositor::Compositor(Instance& instance)
        flowgraphEnabled(true),
        debugDemoEnabled(false),
        debugLatencyEnabled(false),
+       frameBudgetEnabled(false),
        debugViewportEnabled(false),
        fullscreenEnabled(false),
        debugEnableTrace(false),
@@ -225,6 +227,22 @@ Result Compositor::refreshState() {
                 linkLocaleMap[linkId++] = {inputLocale, outputLocale};
             }
         }
+
+        // Measure text again on the next frame.
+        state.layout = {};
+    }
+
+    // Resolve link pins once instead of every frame.
+    linkStates.clear();
+    for (const auto& [linkId, locales] : linkLocaleMap) {
+        const auto& [inputLocale, outputLocale] = locales;
+
+        linkStates.push_back({
+            .id = linkId,
+            .inputPinId = inputLocalePinMap.at(inputLocale),
+            .outputPinId = outputLocalePinMap.at(outputLocale),
+            .outputBlock = nodeStates.at(outputLocale.block()).block,
+        });
     }
 
     return Result::SUCCESS;
@@ -387,6 +405,7 @@ Result Compositor::destroy() {
     moduleStoreEnabled = true;
     debugDemoEnabled = false;
     debugLatencyEnabled = false;
+    frameBudgetEnabled = false;
     debugViewportEnabled = false;
     flowgraphEnabled = true;
     infoPanelEnabled = true;
@@ -398,6 +417,7 @@ Result Compositor::destroy() {
     // Clearing buffers.
 
     linkLocaleMap.clear();
+    linkStates.clear();
     inputLocalePinMap.clear();
     outputLocalePinMap.clear();
     pinLocaleMap.clear();
@@ -453,6 +473,8 @@ Result Compositor::loadImageAsset(const uint8_t* binary_data,
 }
 
 Result Compositor::draw() {
+    const auto start = std::chrono::steady_clock::now();
+
     // Prevent state from refreshing while drawing these methods.
 
     interfaceHalt.wait(true);
@@ -476,6 +498,11 @@ Result Compositor::draw() {
     interfaceHalt.clear();
     interfaceHalt.notify_one();
 
+    // Update interface time.
+
+    const auto elapsed = std::chrono::duration<F32, std::milli>(std::chrono::steady_clock::now() - start).count();
+    drawTime = (drawTime == 0.0f) ? elapsed : (drawTime * 0.95f) + (elapsed * 0.05f);
+
     return Result::SUCCESS;
 }
 
@@ -788,7 +815,67 @@ Result Compositor::drawStatic() {
         if (ImGui::BeginMenu("Developer")) {
             if (ImGui::MenuItem("Show Demo Window", nullptr, &debugDemoEnabled)) { }
             if (ImGui::MenuItem("Show Latency Window", nullptr, &debugLatencyEnabled)) { }
+            if (ImGui::MenuItem("Show Frame Budget", nullptr, &frameBudgetEnabled)) { }
             if (ImGui::MenuItem("Show Viewport Window", nullptr, &debugViewportEnabled)) { }
+            if (ImGui::MenuItem("Profile Modules", nullptr, instance.scheduler().profiling())) {
+                instance.scheduler().setProfiling(!instance.scheduler().profiling());
+            }
+            if (ImGui::MenuItem("Record Trace", nullptr, Tracer::Enabled())) {
+                if (Tracer::Enabled()) {
+                    Tracer::Disable();
+                } else {
+                    Tracer::Enable();
+                }
+            }
+            if (ImGui::MenuItem("Save Trace")) {
+                JST_DISPATCH_ASYNC([&](){
+                    JST_CHECK_NOTIFY([&]{
+                        std::string folder;
+                        if (Platform::CacheFolder(folder) != Result::SUCCESS) {
+                            JST_ERROR("[COMPOSITOR] No folder to save the trace to.");
+                            return Result::ERROR;
+                        }
+
+                        const auto timestamp = std::chrono::duration_cast<std::chrono::seconds>(
+                            std::chrono::system_clock::now().time_since_epoch()).count();
+                        const auto path = (std::filesystem::path(folder) /
+                                           jst::fmt::format("trace-{}.json", timestamp)).string();
+
+                        JST_CHECK(Tracer::Dump(path));
+                        JST_INFO("[COMPOSITOR] Trace saved to '{}'.", path);
+
+                        return Result::SUCCESS;
+                    }());
+                });
+            }
+            if (ImGui::MenuItem("Sample Modules", nullptr, Sampler::Enabled())) {
+                if (Sampler::Enabled()) {
+                    Sampler::Disable();
+                } else {
+                    Sampler::Enable(Sampler::GetConfig());
+                }
+            }
+            if (ImGui::MenuItem("Save Samples")) {
+                JST_DISPATCH_ASYNC([&](){
+                    JST_CHECK_NOTIFY([&]{
+                        std::string folder;
+                        if (Platform::CacheFolder(folder) != Result::SUCCESS) {
+                            JST_ERROR("[COMPOSITOR] No folder to save the samples to.");
+                            return Result::ERROR;
+                        }
+
+                        const auto timestamp = std::chrono::duration_cast<std::chrono::seconds>(
+                            std::chrono::system_clock::now().time_since_epoch()).count();
+                        const auto path = (std::filesystem::path(folder) /
+                                           jst::fmt::format("samples-{}.csv", timestamp)).string();
+
+                        JST_CHECK(Sampler::Dump(path));
+                        JST_INFO("[COMPOSITOR] Samples saved to '{}'.", path);
+
+                        return Result::SUCCESS;
+                    }());
+                });
+            }
             if (ImGui::MenuItem("Enable Trace", nullptr, &debugEnableTrace)) {
                 if (debugEnableTrace) {
                     JST_LOG_SET_DEBUG_LEVEL(4);
@@ -1506,6 +1593,15 @@ Result Compositor::drawStatic() {
         ImGui::SameLine();
         ImGui::TextFormatted("{}", instance.viewport().name());
         instance.window().drawDebugMessage();
+        ImGui::TextFormatted("Interface: {:.2f} ms", drawTime);
+
+        for (const auto& [device, usage] : MemoryFootprint::Get().devices()) {
+            if (usage.current == 0) {
+                continue;
+            }
+            ImGui::TextFormatted("{} Memory: {:.2f} MB", GetDevicePrettyName(device),
+                                                         static_cast<F32>(usage.current) / JST_MB);
+        }
 
         ImGui::End();
     }();
@@ -2286,11 +2382,15 @@ Result Compositor::drawStatic() {
                                                              ImGuiTableFlags_Hideable;
 
                     ImGui::TableNextColumn();
-                    if (ImGui::BeginTable(("benchmark-subtable-" + name).c_str(), 4, nestedTableFlags)) {
-                        ImGui::TableSetupColumn("Name", ImGuiTableColumnFlags_WidthStretch, 0.60f);
-                        ImGui::TableSetupColumn("ms/op", ImGuiTableColumnFlags_WidthStretch, 0.10f);
-                        ImGui::TableSetupColumn("op/s", ImGuiTableColumnFlags_WidthStretch, 0.20f);
-                        ImGui::TableSetupColumn("err%", ImGuiTableColumnFlags_WidthStretch, 0.10f);
+                    if (ImGui::BeginTable(("benchmark-subtable-" + name).c_str(), 8, nestedTableFlags)) {
+                        ImGui::TableSetupColumn("Name", ImGuiTableColumnFlags_WidthStretch, 0.30f);
+                        ImGui::TableSetupColumn("ms/op", ImGuiTableColumnFlags_WidthStretch, 0.08f);
+                        ImGui::TableSetupColumn("op/s", ImGuiTableColumnFlags_WidthStretch, 0.12f);
+                        ImGui::TableSetupColumn("err%", ImGuiTableColumnFlags_WidthStretch, 0.08f);
+                        ImGui::TableSetupColumn("MS/s", ImGuiTableColumnFlags_WidthStretch, 0.12f);
+                        ImGui::TableSetupColumn("GB/s", ImGuiTableColumnFlags_WidthStretch, 0.10f);
+                        ImGui::TableSetupColumn("GFLOP/s", ImGuiTableColumnFlags_WidthStretch, 0.10f);
+                        ImGui::TableSetupColumn("Kernel GB/s", ImGuiTableColumnFlags_WidthStretch, 0.10f);
                         ImGui::TableHeadersRow();
 
                         for (const auto& entry : entries) {
@@ -2303,6 +2403,25 @@ Result Compositor::drawStatic() {
                             ImGui::Text("%.2f", entry.ops_per_sec);
                             ImGui::TableNextColumn();
                             ImGui::Text("%.2f", entry.error);
+                            ImGui::TableNextColumn();
+                            ImGui::Text("%.2f", entry.samples_per_sec / 1e6);
+                            ImGui::TableNextColumn();
+                            ImGui::Text("%.2f", entry.gb_per_sec);
+                            ImGui::TableNextColumn();
+                            if (entry.gflops_per_sec > 0.0) {
+                                ImGui::Text("%.2f", entry.gflops_per_sec);
+                            } else {
+                                ImGui::TextUnformatted("-");
+                            }
+                            ImGui::TableNextColumn();
+                            if (entry.kernel_gb_per_sec > 0.0 && entry.peak_gb_per_sec > 0.0) {
+                                ImGui::Text("%.2f (%.0f%%)", entry.kernel_gb_per_sec,
+                                                             entry.kernel_gb_per_sec / entry.peak_gb_per_sec * 100.0);
+                            } else if (entry.kernel_gb_per_sec > 0.0) {
+                                ImGui::Text("%.2f", entry.kernel_gb_per_sec);
+                            } else {
+                                ImGui::TextUnformatted("-");
+                            }
                         }
 
                         ImGui::EndTable();
@@ -2409,6 +2528,152 @@ Result Compositor::drawStatic() {
         ImGui::End();
     }();
 
+    //
+    // Frame Budget Render
+    //
+
+    [&](){
+        if (!frameBudgetEnabled) {
+            return;
+        }
+
+        updateFrameBudget();
+
+        ImGui::SetNextWindowSize(ImVec2(520.0f * scalingFactor, 480.0f * scalingFactor), ImGuiCond_FirstUseEver);
+        if (!ImGui::Begin("Frame Budget", &frameBudgetEnabled)) {
+            ImGui::End();
+            return;
+        }
+
+        ImGui::SetNextItemWidth(120.0f * scalingFactor);
+        ImGui::InputFloat("Target Rate (FPS)", &frameBudget.targetRate, 1.0f, 10.0f, "%.0f");
+        frameBudget.targetRate = std::clamp(frameBudget.targetRate, 1.0f, 1000.0f);
+        const F32 budget = 1000.0f / frameBudget.targetRate;
+
+        ImGui::TextFormatted("Budget: {:.2f} ms per frame. Percentiles of the last second.", budget);
+
+        // Median of each present thread stage stacked against the budget.
+
+        const std::vector<U32> stageColors = {
+            IM_COL32(76, 175, 80, 255),
+            IM_COL32(33, 150, 243, 255),
+            IM_COL32(255, 193, 7, 255),
+            IM_COL32(156, 39, 176, 255),
+        };
+
+        {
+            const F32 barWidth = ImGui::GetContentRegionAvail().x;
+            const F32 barHeight = 18.0f * scalingFactor;
+            const ImVec2 origin = ImGui::GetCursorScreenPos();
+            ImDrawList* drawList = ImGui::GetWindowDrawList();
+
+            drawList->AddRectFilled(origin, ImVec2(origin.x + barWidth, origin.y + barHeight), IM_COL32(60, 60, 60, 255));
+
+            F32 offset = 0.0f;
+            for (U64 i = 1; i < frameBudget.stages.size(); i++) {
+                const auto& [name, summary] = frameBudget.stages[i];
+                const F32 width = std::min(summary.p50 / budget, 1.0f - offset) * barWidth;
+                if (width <= 0.0f) {
+                    continue;
+                }
+                const ImVec2 start(origin.x + offset * barWidth, origin.y);
+                drawList->AddRectFilled(start, ImVec2(start.x + width, origin.y + barHeight), stageColors[(i - 1) % stageColors.size()]);
+                offset += width / barWidth;
+            }
+
+            ImGui::Dummy(ImVec2(barWidth, barHeight));
+
+            for (U64 i = 1; i < frameBudget.stages.size(); i++) {
+                if (i > 1) {
+                    ImGui::SameLine();
+                }
+                ImGui::PushStyleColor(ImGuiCol_Text, stageColors[(i - 1) % stageColors.size()]);
+                ImGui::TextUnformatted(ICON_FA_SQUARE);
+                ImGui::PopStyleColor();
+                ImGui::SameLine(0.0f, ImGui::GetStyle().ItemInnerSpacing.x);
+                ImGui::TextUnformatted(frameBudget.stages[i].first.c_str());
+            }
+        }
+
+        ImGui::Spacing();
+
+        const auto drawRows = [&](const auto& rows){
+            for (const auto& [name, summary] : rows) {
+                ImGui::TableNextRow();
+                ImGui::TableSetColumnIndex(0);
+                ImGui::TextUnformatted(name.c_str());
+                if (summary.count == 0) {
+                    ImGui::TableSetColumnIndex(1);
+                    ImGui::TextDisabled("N/A");
+                    continue;
+                }
+                ImGui::TableSetColumnIndex(1);
+                ImGui::TextFormatted("{:.2f}", summary.p50);
+                ImGui::TableSetColumnIndex(2);
+                ImGui::TextFormatted("{:.2f}", summary.p90);
+                ImGui::TableSetColumnIndex(3);
+                if (summary.p99 > budget) {
+                    ImGui::PushStyleColor(ImGuiCol_Text, IM_COL32(255, 80, 80, 255));
+                    ImGui::TextFormatted("{:.2f}", summary.p99);
+                    ImGui::PopStyleColor();
+                } else {
+                    ImGui::TextFormatted("{:.2f}", summary.p99);
+                }
+                ImGui::TableSetColumnIndex(4);
+                ImGui::TextFormatted("{:.0f}%", (summary.p50 / budget) * 100.0f);
+            }
+        };
+
+        const auto beginTable = [&](const char* id, const char* label){
+            const ImGuiTableFlags tableFlags = ImGuiTableFlags_PadOuterX | ImGuiTableFlags_Borders;
+            if (!ImGui::BeginTable(id, 5, tableFlags)) {
+                return false;
+            }
+            ImGui::TableSetupColumn(label, ImGuiTableColumnFlags_WidthStretch, 0.40f);
+            ImGui::TableSetupColumn("p50 (ms)", ImGuiTableColumnFlags_WidthStretch, 0.15f);
+            ImGui::TableSetupColumn("p90 (ms)", ImGuiTableColumnFlags_WidthStretch, 0.15f);
+            ImGui::TableSetupColumn("p99 (ms)", ImGuiTableColumnFlags_WidthStretch, 0.15f);
+            ImGui::TableSetupColumn("Budget", ImGuiTableColumnFlags_WidthStretch, 0.15f);
+            ImGui::TableHeadersRow();
+            return true;
+        };
+
+        if (beginTable("##frame-budget-stages", "Present Thread")) {
+            drawRows(frameBudget.stages);
+            ImGui::EndTable();
+        }
+
+        ImGui::Spacing();
+
+        if (beginTable("##frame-budget-graphs", "Compute Graph")) {
+            drawRows(frameBudget.graphs);
+            ImGui::EndTable();
+        }
+
+        ImGui::Spacing();
+        ImGui::TextUnformatted("Slowest Modules");
+
+        if (!instance.scheduler().profiling()) {
+            ImGui::TextDisabled("Module latency is only recorded while profiling.");
+            if (ImGui::Button("Enable Module Profiling")) {
+                instance.scheduler().setProfiling(true);
+            }
+        } else if (frameBudget.slowestModules.empty()) {
+            ImGui::TextDisabled("No module computed in the last second.");
+        } else if (beginTable("##frame-budget-modules", "Module")) {
+            std::vector<std::pair<std::string, LatencyHistogram::Summary>> rows;
+            for (const auto& [locale, summary] : frameBudget.slowestModules) {
+                const auto& node = nodeStates.find(locale.block());
+                const auto& block = (node != nodeStates.end()) ? node->second.title : locale.blockId;
+                rows.push_back({jst::fmt::format("{} ({})", block, locale.moduleId), summary});
+            }
+            drawRows(rows);
+            ImGui::EndTable();
+        }
+
+        ImGui::End();
+    }();
+
     //
     // Debug Viewport Render
     //
@@ -2454,6 +2719,76 @@ Result Compositor::drawStatic() {
     return Result::SUCCESS;
 }
 
+void Compositor::updateFrameBudget() {
+    const auto now = std::chrono::steady_clock::now();
+    if ((now - frameBudget.lastUpdate) < std::chrono::seconds(1)) {
+        return;
+    }
+    frameBudget.lastUpdate = now;
+
+    // Present thread stages.
+
+    const auto frame = instance.frameLatency();
+    const std::vector<std::pair<std::string, LatencyHistogram::Snapshot>> stages = {
+        {"Frame", frame.frame},
+        {"Present", frame.present},
+        {"Interface", frame.interface},
+        {"Render", frame.render},
+        {"Encode", frame.encode},
+    };
+
+    frameBudget.stageSnapshots.resize(stages.size());
+    frameBudget.stages.clear();
+    for (U64 i = 0; i < stages.size(); i++) {
+        const auto& [name, snapshot] = stages[i];
+        frameBudget.stages.push_back({name, LatencyHistogram::Summarize(snapshot, frameBudget.stageSnapshots[i])});
+        frameBudget.stageSnapshots[i] = snapshot;
+    }
+
+    // Compute graphs. The graphs are rebuilt when the flowgraph changes.
+
+    const auto statistics = instance.scheduler().statistics();
+    const auto graphs = instance.scheduler().graphLatencySnapshots();
+
+    if (frameBudget.graphSnapshots.size() != graphs.size()) {
+        frameBudget.graphSnapshots.assign(graphs.size(), {});
+    }
+
+    frameBudget.graphs.clear();
+    for (U64 i = 0; i < graphs.size() && i < statistics.size(); i++) {
+        const auto& graph = statistics[i];
+        frameBudget.graphs.push_back({jst::fmt::format("{} (Cluster {}, {} blocks)", GetDevicePrettyName(graph.device),
+                                                                                    graph.clusterId,
+                                                                                    graph.blockCount),
+                                      LatencyHistogram::Summarize(graphs[i], frameBudget.graphSnapshots[i])});
+    }
+    frameBudget.graphSnapshots = graphs;
+
+    // Slowest modules by tail latency.
+
+    auto modules = instance.scheduler().moduleLatencySnapshots();
+
+    frameBudget.slowestModules.clear();
+    for (const auto& [locale, snapshot] : modules) {
+        const auto& previous = frameBudget.moduleSnapshots.find(locale);
+        const auto summary = (previous != frameBudget.moduleSnapshots.end()) ?
+                                 LatencyHistogram::Summarize(snapshot, previous->second) :
+                                 LatencyHistogram::Summarize(snapshot);
+        if (summary.count == 0) {
+            continue;
+        }
+        frameBudget.slowestModules.push_back({locale, summary});
+    }
+    frameBudget.moduleSnapshots = std::move(modules);
+
+    std::sort(frameBudget.slowestModules.begin(), frameBudget.slowestModules.end(), [](const auto& a, const auto& b) {
+        return a.second.p99 > b.second.p99;
+    });
+    if (frameBudget.slowestModules.size() > 5) {
+        frameBudget.slowestModules.resize(5);
+    }
+}
+
 Result Compositor::drawFlowgraph() {
     // Load local variables.
     const auto& scalingFactor = instance.window().scalingFactor();
@@ -2464,11 +2799,25 @@ Result Compositor::drawFlowgraph() {
     const F32 windowMinWidth = 300.0f * scalingFactor;
     const F32 variableWidth = 100.0f * scalingFactor;
 
+    // Blocks with a view drawn in this frame.
+    visibleBlocks.clear();
+
+    // Module latency grouped by block.
+    blockLatency.clear();
+    if (instance.scheduler().profiling()) {
+        for (const auto& [locale, summary] : instance.scheduler().moduleLatency()) {
+            if (summary.count == 0) {
+                continue;
+            }
+            blockLatency[locale.block()].push_back({locale.moduleId, summary});
+        }
+    }
+
     //
     // View Render
     //
 
-    for (const auto& [_, state] : nodeStates) {
+    for (const auto& [locale, state] : nodeStates) {
         if (!state.block->getState().viewEnabled ||
             !state.block->shouldDrawView() ||
             !state.block->complete() ||
@@ -2485,6 +2834,7 @@ Result Compositor::drawFlowgraph() {
             continue;
         }
         state.block->drawView();
+        visibleBlocks.emplace(locale);
         ImGui::End();
     }
 
@@ -2492,7 +2842,7 @@ Result Compositor::drawFlowgraph() {
     // Fullscreen Render
     //
 
-    for (const auto& [_, state] : nodeStates) {
+    for (const auto& [locale, state] : nodeStates) {
         if (!state.block->getState().fullscreenEnabled ||
             !state.block->shouldDrawFullscreen() ||
             !state.block->complete()) {
@@ -2527,6 +2877,7 @@ Result Compositor::drawFlowgraph() {
             continue;
         }
         state.block->drawView();
+        visibleBlocks.emplace(locale);
         ImGui::End();
         ImGui::PopStyleVar();
         ImGui::PopStyleVar();
@@ -2604,17 +2955,35 @@ Result Compositor::drawFlowgraph() {
         ImNodes::BeginNodeEditor();
         ImNodes::MiniMap(0.075f * scalingFactor, ImNodesMiniMapLocation_TopRight);
 
-        for (const auto& [locale, state] : nodeStates) {
+        for (auto& [locale, state] : nodeStates) {
             const auto& block = state.block;
-            const auto& moduleEntry = Store::BlockMetadataList().at(block->id());
+            auto& layout = state.layout;
+
+            // Measure text only when the node or the scaling changed.
+            if (layout.scalingFactor != scalingFactor) {
+                layout.scalingFactor = scalingFactor;
+                layout.titleWidth = ImGui::CalcTextSize(state.title.c_str()).x +
+                                    ImGui::CalcTextSize(" " ICON_FA_CIRCLE_QUESTION).x;
+                layout.errorIconWidth = ImGui::CalcTextSize(" " ICON_FA_SKULL).x;
+                layout.warningIconWidth = ImGui::CalcTextSize(" " ICON_FA_TRIANGLE_EXCLAMATION).x;
+
+                layout.inputPins.clear();
+                for (const auto& [inputPinId, _] : state.inputs) {
+                    const auto& pinName = pinLocaleMap.at(inputPinId).pinId;
+                    layout.inputPins.push_back({inputPinId, pinName, ImGui::CalcTextSize(pinName.c_str()).x});
+                }
+
+                layout.outputPins.clear();
+                for (const auto& [outputPinId, _] : state.outputs) {
+                    const auto& pinName = pinLocaleMap.at(outputPinId).pinId;
+                    layout.outputPins.push_back({outputPinId, pinName, ImGui::CalcTextSize(pinName.c_str()).x});
+                }
+            }
 
             F32 nodeWidth = block->state.nodeWidth * scalingFactor;
-            const F32 titleWidth = ImGui::CalcTextSize(state.title.c_str()).x +
-                                   ImGui::CalcTextSize(" " ICON_FA_CIRCLE_QUESTION).x +
-                                   ((!block->complete()) ?
-                                        ImGui::CalcTextSize(" " ICON_FA_SKULL).x : 0) +
-                                   ((!block->warning().empty() && block->complete()) ?
-                                        ImGui::CalcTextSize(" " ICON_FA_TRIANGLE_EXCLAMATION).x : 0);
+            const F32 titleWidth = layout.titleWidth +
+                                   ((!block->complete()) ? layout.errorIconWidth : 0) +
+                                   ((!block->warning().empty() && block->complete()) ? layout.warningIconWidth : 0);
             const F32 controlWidth = block->shouldDrawControl() ? windowMinWidth: 0.0f;
             const F32 previewWidth = block->shouldDrawPreview() ? windowMinWidth : 0.0f;
             nodeWidth = std::max({titleWidth, nodeWidth, controlWidth, previewWidth});
@@ -2682,12 +3051,14 @@ Result Compositor::drawFlowgraph() {
             ImGui::PushStyleVar(ImGuiStyleVar_WindowPadding, ImVec2(scalingFactor * 8.0f, scalingFactor * 8.0f));
             ImGui::SetNextWindowSize(ImVec2(600.0f * scalingFactor, 0.0f));
             if (ImGui::BeginPopupContextItem("fixed-block-description")) {
+                const auto& moduleEntry = Store::BlockMetadataList().at(block->id());
                 ImGui::TextWrapped(ICON_FA_BOOK " Description");
                 ImGui::Separator();
                 ImGui::Markdown(moduleEntry.description.c_str(), moduleEntry.description.length(), _markdownConfig);
                 ImGui::EndPopup();
             }
             if (ImGui::IsItemHovered(ImGuiHoveredFlags_DelayShort)) {
+                const auto& moduleEntry = Store::BlockMetadataList().at(block->id());
                 ImGui::OpenPopupOnItemClick("fixed-block-description", ImGuiPopupFlags_MouseButtonLeft);
                 ImGui::SetNextWindowSize(ImVec2(600.0f * scalingFactor, 0.0f));
                 ImGui::BeginTooltip();
@@ -2698,6 +3069,29 @@ Result Compositor::drawFlowgraph() {
                 ImGui::PopStyleColor();
                 ImGui::Separator();
                 ImGui::Markdown(moduleEntry.description.c_str(), moduleEntry.description.length(), _markdownConfig);
+
+                const auto memory = MemoryFootprint::Get().block(locale.blockId);
+                if (!memory.empty()) {
+                    ImGui::Separator();
+                    ImGui::TextWrapped(ICON_FA_MEMORY " Memory");
+                    for (const auto& [device, usage] : memory) {
+                        ImGui::TextFormatted("{}: {:.2f} MB (peak {:.2f} MB)", GetDevicePrettyName(device),
+                                                                               static_cast<F32>(usage.current) / JST_MB,
+                                                                               static_cast<F32>(usage.peak) / JST_MB);
+                    }
+                }
+
+                if (blockLatency.contains(locale)) {
+                    ImGui::Separator();
+                    ImGui::TextWrapped(ICON_FA_STOPWATCH " Latency");
+                    for (const auto& [moduleId, summary] : blockLatency.at(locale)) {
+                        ImGui::TextFormatted("{}: p50 {:.3f} ms / p90 {:.3f} ms / p99 {:.3f} ms", moduleId,
+                                                                                                 summary.p50,
+                                                                                                 summary.p90,
+                                                                                                 summary.p99);
+                    }
+                }
+
                 ImGui::EndTooltip();
             }
             ImGui::PopStyleVar();
@@ -2742,6 +3136,19 @@ Result Compositor::drawFlowgraph() {
             ImGui::PopStyleVar();
             ImGui::PopStyleVar();
 
+            // Draw node latency. Percentiles of the modules are added up.
+            if (blockLatency.contains(locale)) {
+                F32 p50 = 0.0f;
+                F32 p99 = 0.0f;
+                for (const auto& [_, summary] : blockLatency.at(locale)) {
+                    p50 += summary.p50;
+                    p99 += summary.p99;
+                }
+                ImGui::PushStyleColor(ImGuiCol_Text, ImVec4(1.0f, 1.0f, 1.0f, 0.4f));
+                ImGui::TextFormatted(ICON_FA_STOPWATCH " p50 {:.3f} ms / p99 {:.3f} ms", p50, p99);
+                ImGui::PopStyleColor();
+            }
+
             // Draw node info.
             if (block->shouldDrawInfo()) {
                 ImGui::BeginTable("##NodeInfoTable", 2, ImGuiTableFlags_None);
@@ -2767,26 +3174,21 @@ Result Compositor::drawFlowgraph() {
             ImGui::PushStyleVar(ImGuiStyleVar_WindowPadding, ImVec2(0.0f, 0.0f));
 
             // Draw node input and output pins.
-            if (!state.inputs.empty() || !state.outputs.empty()) {
+            if (!layout.inputPins.empty() || !layout.outputPins.empty()) {
                 ImGui::Spacing();
 
                 ImNodes::PushAttributeFlag(ImNodesAttributeFlags_EnableLinkDetachWithDragClick);
-                for (const auto& [inputPinId, _] : state.inputs) {
-                    const auto& pinName = pinLocaleMap.at(inputPinId).pinId;
-
-                    ImNodes::BeginInputAttribute(inputPinId);
-                    ImGui::TextUnformatted(pinName.c_str());
+                for (const auto& pin : layout.inputPins) {
+                    ImNodes::BeginInputAttribute(pin.id);
+                    ImGui::TextUnformatted(pin.name.c_str());
                     ImNodes::EndInputAttribute();
                 }
                 ImNodes::PopAttributeFlag();
 
-                for (const auto& [outputPinId, _] : state.outputs) {
-                    const auto& pinName = pinLocaleMap.at(outputPinId).pinId;
-                    const F32 textWidth = ImGui::CalcTextSize(pinName.c_str()).x;
-
-                    ImNodes::BeginOutputAttribute(outputPinId);
-                    ImGui::Indent(nodeWidth - textWidth);
-                    ImGui::TextUnformatted(pinName.c_str());
+                for (const auto& pin : layout.outputPins) {
+                    ImNodes::BeginOutputAttribute(pin.id);
+                    ImGui::Indent(nodeWidth - pin.width);
+                    ImGui::TextUnformatted(pin.name.c_str());
                     ImNodes::EndOutputAttribute();
                 }
             }
@@ -2796,7 +3198,14 @@ Result Compositor::drawFlowgraph() {
                 block->shouldDrawPreview() &&
                 block->getState().previewEnabled) {
                 ImGui::Spacing();
+                const auto previewMin = ImGui::GetCursorScreenPos();
                 block->drawPreview(nodeWidth);
+
+                // Previews of nodes scrolled out of the editor don't count.
+                const auto previewMax = ImVec2(previewMin.x + nodeWidth, ImGui::GetCursorScreenPos().y);
+                if (ImGui::IsRectVisible(previewMin, previewMax)) {
+                    visibleBlocks.emplace(locale);
+                }
             }
 
             // Ensure minimum width set by the internal state.
@@ -2887,11 +3296,7 @@ Result Compositor::drawFlowgraph() {
         }
 
         // Draw node links.
-        for (const auto& [linkId, locales] : linkLocaleMap) {
-            const auto& [inputLocale, outputLocale] = locales;
-            const auto& inputPinId = inputLocalePinMap.at(inputLocale);
-            const auto& outputPinId = outputLocalePinMap.at(outputLocale);
-            const auto& outputBlock = nodeStates.at(outputLocale.block()).block;
+        for (const auto& [linkId, inputPinId, outputPinId, outputBlock] : linkStates) {
 
             if (outputBlock->complete()) {
                 switch (outputBlock->device()) {
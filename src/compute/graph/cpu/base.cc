@@ -1,7 +1,27 @@
 #include "jetstream/compute/graph/cpu.hh"
+#include "jetstream/memory/devices/cpu/helpers.hh"
 
 namespace Jetstream {
 
+struct CPU::ExecutionState {
+    std::unique_ptr<std::atomic<U64>[]> dependencies;
+    std::unordered_set<U64>* yielded;
+
+    std::mutex mutex;
+    std::condition_variable cond;
+
+    U64 remaining;
+    std::atomic<bool> failed{false};
+    Result result = Result::SUCCESS;
+};
+
+struct CPU::PipelineState {
+    // Set once a stage is done reading the previous one.
+    std::unique_ptr<std::atomic<bool>[]> released;
+    std::vector<Result> results;
+    std::atomic<U64> remaining{0};
+};
+
 CPU::CPU() {
     JST_DEBUG("Creating new CPU compute graph.");
     context = std::make_shared<Compute::Context>();
@@ -13,47 +33,734 @@ CPU::~CPU() {
 }
 
 Result CPU::create() {
+    JST_CHECK(createDependencies());
+    JST_CHECK(createFusedRuns());
+    JST_CHECK(createStages());
+
+    // Buffers have to be placed before the modules see their pointers.
+    JST_CHECK(createMemoryPlan());
+
     for (const auto& computeUnit : computeUnits) {
         JST_CHECK(computeUnit.block->createCompute(*context));
     }
+
     return Result::SUCCESS;
 }
 
-Result CPU::computeReady() {
-    for (const auto& computeUnit : computeUnits) {
-        JST_CHECK(computeUnit.block->computeReady());
+Result CPU::createDependencies() {
+    const U64 unitCount = computeUnits.size();
+
+    dependencyCount.assign(unitCount, 0);
+    dependents.assign(unitCount, {});
+    parallel = false;
+
+    if (!workerPool || !workerPool->running() || unitCount < 2) {
+        return Result::SUCCESS;
+    }
+
+    const auto dependencies = unitDependencies();
+
+    bool chain = true;
+    for (U64 j = 0; j < unitCount; j++) {
+        for (const auto& i : dependencies[j]) {
+            dependents[i].push_back(j);
+            dependencyCount[j] += 1;
+        }
+
+        if (j > 0) {
+            chain &= dependencies[j].size() == 1 && dependencies[j].front() == j - 1;
+        }
+    }
+
+    for (U64 i = 0; i < unitCount; i++) {
+        chain &= dependents[i].size() <= 1;
     }
+
+    // A simple chain has nothing to gain from the worker pool.
+    parallel = !chain;
+
+    JST_DEBUG("[CPU] Graph with {} unit(s) will execute {}.", unitCount, (parallel) ? "in parallel" : "serially");
+
     return Result::SUCCESS;
 }
 
-Result CPU::compute(std::unordered_set<U64>& yielded) {
-    for (const auto& computeUnit : computeUnits) {
-        if (Graph::ShouldYield(yielded, computeUnit.inputSet)) {
-            Graph::YieldCompute(yielded, computeUnit.outputSet);
+Result CPU::createFusedRuns() {
+    const U64 unitCount = computeUnits.size();
+
+    fusedRuns.assign(unitCount, 1);
+    fusedRows.assign(unitCount, 0);
+    fusedTileRows.assign(unitCount, 0);
+    fusedRowSizes.assign(unitCount, 0);
+
+    if (unitCount == 0) {
+        return Result::SUCCESS;
+    }
+
+    const auto dependencies = unitDependencies();
+
+    std::vector<U64> sizes(unitCount);
+    std::vector<Compute::Rows> rows(unitCount);
+    for (U64 i = 0; i < unitCount; i++) {
+        sizes[i] = computeUnits[i].block->computeElementwise();
+        rows[i] = computeUnits[i].block->computeRowwise();
+    }
+
+    // Elementwise units fit any number of rows dividing their number of elements.
+    const auto fitsRows = [&](const U64& i, const U64& count) {
+        return (rows[i].count > 0) ? rows[i].count == count : (sizes[i] > 0 && sizes[i] % count == 0);
+    };
+
+    // A unit joins the run of the previous unit if it only reads tensors produced by
+    // that unit and both are elementwise over the same number of elements. Rowwise units
+    // join a run if every unit of the run can be split in the same number of rows.
+
+    U64 head = 0;
+    fusedRows[0] = rows[0].count;
+
+    for (U64 j = 1; j < unitCount; j++) {
+        const auto& previous = computeUnits[j - 1];
+        const auto& current = computeUnits[j];
+
+        const bool chained = dependencies[j].size() == 1 && dependencies[j].front() == j - 1 &&
+                             std::ranges::all_of(current.inputSet, [&](const U64& input) {
+                                 return previous.outputSet.contains(input) ||
+                                        input == Graph::SuspendHash(current.block.get());
+                             });
+
+        bool fusable = false;
+        if (chained && fusedRows[head] > 0) {
+            fusable = fitsRows(j, fusedRows[head]);
+        } else if (chained && rows[j].count > 0) {
+            fusable = true;
+            for (U64 i = head; i < j; i++) {
+                fusable &= fitsRows(i, rows[j].count);
+            }
+        } else if (chained) {
+            fusable = sizes[j] > 0 && sizes[j] == sizes[head];
+        }
+
+        if (!fusable) {
+            head = j;
+            fusedRows[head] = rows[head].count;
             continue;
         }
 
-        const auto& res = computeUnit.block->compute(*context);
+        fusedRows[head] = std::max(fusedRows[head], rows[j].count);
+        fusedRuns[head] += 1;
+        fusedRuns[j] = 0;
+    }
+
+    // Tiles take as many rows as fit the tile size given the longest row of the run.
 
-        if (res == Result::SUCCESS) {
+    for (U64 i = 0; i < unitCount; i++) {
+        if (fusedRuns[i] < 2) {
+            fusedRows[i] = 0;
             continue;
         }
 
-        if (res == Result::YIELD) {
-            Graph::YieldCompute(yielded, computeUnit.outputSet);
+        if (fusedRows[i] == 0) {
+            JST_DEBUG("[CPU] Fusing {} elementwise unit(s) starting at unit {}.", fusedRuns[i], i);
+            continue;
+        }
+
+        U64 rowSize = 1;
+        for (U64 j = i; j < i + fusedRuns[i]; j++) {
+            fusedRowSizes[j] = (rows[j].count > 0) ? 0 : sizes[j] / fusedRows[i];
+            rowSize = std::max({rowSize, rows[j].size, fusedRowSizes[j]});
+        }
+        fusedTileRows[i] = std::clamp<U64>(FusedTileSize / rowSize, 1, fusedRows[i]);
+
+        JST_DEBUG("[CPU] Fusing {} unit(s) starting at unit {} over tiles of {} row(s) out of {}.",
+                  fusedRuns[i], i, fusedTileRows[i], fusedRows[i]);
+    }
+
+    return Result::SUCCESS;
+}
+
+Result CPU::createStages() {
+    const U64 unitCount = computeUnits.size();
+
+    stageBounds.clear();
+    stageLastReaders.clear();
+    stageHandoffs.clear();
+    stageYielded.clear();
+
+    if (pipelineStages < 2 || parallel || !workerPool || !workerPool->running() || unitCount < 2) {
+        return Result::SUCCESS;
+    }
+
+    // A stage can start at the head of a run if every unit from there on only
+    // reads the unit before it and no earlier unit is read by other graphs.
+    // Tensors crossing graphs are then only written by the last stage.
+
+    U64 firstExternal = unitCount;
+    for (U64 i = 0; i < unitCount && firstExternal == unitCount; i++) {
+        if (std::ranges::any_of(computeUnits[i].outputSet, [&](const U64& output) {
+            return externalOutputs.contains(output);
+        })) {
+            firstExternal = i;
+        }
+    }
+
+    std::vector<U64> candidates;
+    for (U64 j = unitCount - 1; j > 0; j--) {
+        const auto& previous = computeUnits[j - 1];
+        const auto& current = computeUnits[j];
+
+        if (!std::ranges::all_of(current.inputSet, [&](const U64& input) {
+            return previous.outputSet.contains(input) || input == Graph::SuspendHash(current.block.get());
+        })) {
+            break;
+        }
+
+        if (fusedRuns[j] > 0 && j <= firstExternal) {
+            candidates.insert(candidates.begin(), j);
+        }
+    }
+
+    // Without the cost of each unit, stages take about the same number of units.
+
+    const U64 stageCount = std::min({pipelineStages, candidates.size() + 1, workerPool->size() + 1});
+
+    std::vector<U64> bounds = {0};
+    for (U64 k = 1; k < stageCount; k++) {
+        const U64 target = k * unitCount / stageCount;
+        const auto& it = std::ranges::find_if(candidates, [&](const U64& candidate) {
+            return candidate >= target && candidate > bounds.back();
+        });
+        if (it != candidates.end()) {
+            bounds.push_back(*it);
+        }
+    }
+    bounds.push_back(unitCount);
+
+    const auto runHead = [&](U64 index) {
+        while (fusedRuns[index] == 0) {
+            index--;
+        }
+        return index;
+    };
+
+    // Units reading the previous stage also read the memory it forwards or
+    // updates in-place, which keeps the tensor hash of its input.
+    const auto lastReader = [&](const U64& stage) {
+        std::unordered_set<U64> read = computeUnits[bounds[stage] - 1].outputSet;
+        U64 reader = bounds[stage];
+
+        for (U64 i = bounds[stage]; i < bounds[stage + 1]; i++) {
+            const auto& computeUnit = computeUnits[i];
+            if (std::ranges::none_of(computeUnit.inputSet, [&](const U64& input) { return read.contains(input); })) {
+                continue;
+            }
+            reader = i;
+            if (computeUnit.block->computeForwarding()) {
+                read.insert(computeUnit.outputSet.begin(), computeUnit.outputSet.end());
+            }
+        }
+
+        return reader;
+    };
+
+    // A stage writing the next one waits for it to read the last frame first.
+    // Middle stages have to be done reading the previous stage by then, or
+    // stages waiting on each other from the same worker could deadlock.
+
+    for (U64 k = 1; k + 2 < bounds.size();) {
+        if (runHead(lastReader(k)) < runHead(bounds[k + 1] - 1)) {
+            k++;
             continue;
         }
+        bounds.erase(bounds.begin() + k + 1);
+    }
+
+    if (bounds.size() < 3) {
+        return Result::SUCCESS;
+    }
+
+    stageBounds = bounds;
+    for (U64 k = 0; k + 1 < stageBounds.size(); k++) {
+        stageLastReaders.push_back((k > 0) ? lastReader(k) : 0);
+        stageHandoffs.push_back(runHead(stageBounds[k + 1] - 1));
 
-        JST_CHECK(res);
+        // Stages start without a frame from the previous one.
+        stageYielded.push_back(computeUnits[stageBounds[k + 1] - 1].outputSet);
     }
+
+    JST_DEBUG("[CPU] Pipelining {} unit(s) in {} stage(s) starting at units {}.", unitCount,
+              stageBounds.size() - 1, std::vector<U64>(stageBounds.begin(), stageBounds.end() - 1));
+
     return Result::SUCCESS;
 }
 
+Result CPU::createMemoryPlan() {
+    const U64 unitCount = computeUnits.size();
+
+    struct Transient {
+        std::shared_ptr<TensorBuffer<Device::CPU>> buffer;
+        U64 producer;
+        std::vector<U64> users;
+    };
+
+    // Stages of a pipelined chain compute at the same time. Tensors read by
+    // the next stage are kept until its next frame, so they aren't placed.
+
+    std::vector<U64> stage(unitCount, 0);
+    for (U64 k = 1; k + 1 < stageBounds.size(); k++) {
+        std::fill(stage.begin() + stageBounds[k], stage.end(), k);
+    }
+
+    std::vector<Transient> transients;
+    for (U64 i = 0; i < unitCount; i++) {
+        for (const auto& output : computeUnits[i].outputSet) {
+            if (!transientOutputs.contains(output)) {
+                continue;
+            }
+
+            // Only buffers allocated by the CPU and not shared with other devices.
+            const auto& storage = transientOutputs.at(output);
+            if (storage->clones.size() != 1 || !storage->clones.contains(Device::CPU)) {
+                continue;
+            }
+
+            auto buffer = std::any_cast<std::shared_ptr<TensorBuffer<Device::CPU>>>(storage->clones.at(Device::CPU));
+            if (!buffer->allocated() || buffer->aliased() || buffer->external_memory_device() != Device::None) {
+                continue;
+            }
+
+            Transient transient = {
+                .buffer = buffer,
+                .producer = i,
+                .users = {i},
+            };
+            for (U64 j = i + 1; j < unitCount; j++) {
+                if (computeUnits[j].inputSet.contains(output)) {
+                    transient.users.push_back(j);
+                }
+            }
+            if (stage[transient.users.back()] != stage[i]) {
+                continue;
+            }
+            transients.push_back(std::move(transient));
+        }
+    }
+
+    if (transients.size() < 2) {
+        return Result::SUCCESS;
+    }
+
+    // Units of a fused run are computed together by the head of the run.
+
+    std::vector<U64> step(unitCount);
+    for (U64 i = 0; i < unitCount; i++) {
+        step[i] = (fusedRuns[i] > 0) ? i : step[i - 1];
+    }
+
+    // Find which units are guaranteed to finish before others start. Serial
+    // graphs follow the unit order and parallel graphs only their dependencies.
+
+    std::vector<std::vector<bool>> before(unitCount, std::vector<bool>(unitCount, false));
+    if (parallel) {
+        const auto dependencies = unitDependencies();
+        for (U64 j = 0; j < unitCount; j++) {
+            for (const auto& i : dependencies[j]) {
+                before[i][j] = true;
+                for (U64 k = 0; k < i; k++) {
+                    if (before[k][i]) {
+                        before[k][j] = true;
+                    }
+                }
+            }
+        }
+    } else {
+        for (U64 i = 0; i < unitCount; i++) {
+            for (U64 j = i + 1; j < unitCount && stage[j] == stage[i]; j++) {
+                before[i][j] = true;
+            }
+        }
+    }
+
+    const auto finishesBefore = [&](const U64& a, const U64& b) {
+        return step[a] != step[b] && before[step[a]][step[b]];
+    };
+
+    // Place each transient in the smallest slot whose last occupant is no longer
+    // used once the transient is produced, or in a new slot at the end of the arena.
+
+    struct Slot {
+        U64 offset;
+        U64 size;
+        std::vector<U64> users;
+    };
+
+    std::vector<Slot> slots;
+    std::vector<U64> offsets;
+    U64 dedicatedSize = 0;
+    U64 arenaSize = 0;
+
+    for (const auto& transient : transients) {
+        const U64 size = transient.buffer->size_bytes();
+        dedicatedSize += size;
+
+        Slot* best = nullptr;
+        for (auto& slot : slots) {
+            if (slot.size < size || (best && best->size <= slot.size)) {
+                continue;
+            }
+            if (std::ranges::all_of(slot.users, [&](const U64& user) {
+                return finishesBefore(user, transient.producer);
+            })) {
+                best = &slot;
+            }
+        }
+
+        if (!best) {
+            slots.push_back({
+                .offset = arenaSize,
+                .size = size,
+                .users = {},
+            });
+            best = &slots.back();
+            arenaSize += size;
+        }
+
+        best->users = transient.users;
+        offsets.push_back(best->offset);
+    }
+
+    if (arenaSize == dedicatedSize) {
+        JST_DEBUG("[CPU] Transient tensors have overlapping lifetimes. Keeping dedicated memory.");
+        return Result::SUCCESS;
+    }
+
+    arena = Tensor<Device::CPU, U8>({arenaSize});
+
+    for (U64 i = 0; i < transients.size(); i++) {
+        JST_CHECK(transients[i].buffer->alias(arena.data() + offsets[i]));
+        aliasedBuffers.push_back(transients[i].buffer);
+    }
+
+    JST_INFO("[CPU] Placed {} transient tensor(s) in a {:.2f} MB arena instead of {:.2f} MB of dedicated memory.",
+             transients.size(), arenaSize / (1024.0 * 1024.0), dedicatedSize / (1024.0 * 1024.0));
+
+    return Result::SUCCESS;
+}
+
+Result CPU::destroyMemoryPlan() {
+    for (const auto& buffer : aliasedBuffers) {
+        JST_CHECK(buffer->unalias());
+    }
+    aliasedBuffers.clear();
+    arena = Tensor<Device::CPU, U8>();
+
+    return Result::SUCCESS;
+}
+
+Result CPU::computeReady() {
+    for (const auto& computeUnit : computeUnits) {
+        JST_CHECK(computeUnit.block->computeReady());
+    }
+    return Result::SUCCESS;
+}
+
+Result CPU::computeUnit(const U64& index, std::unordered_set<U64>& yielded) {
+    const auto& computeUnit = computeUnits[index];
+
+    // Units of a fused run are computed by the head of the run.
+    if (fusedRuns[index] == 0) {
+        return Result::SUCCESS;
+    }
+
+    // Elementwise units never yield, so the whole run follows its head.
+    if (Graph::ShouldYield(yielded, computeUnit.inputSet)) {
+        for (U64 i = index; i < index + fusedRuns[index]; i++) {
+            Graph::YieldCompute(yielded, computeUnits[i].outputSet);
+        }
+        return Result::SUCCESS;
+    }
+
+    const bool profiling = Graph::Timing();
+    const auto start = (profiling) ? std::chrono::steady_clock::now() : std::chrono::steady_clock::time_point{};
+
+    // Fused runs are timed as a whole on their head.
+    const auto& res = [&]{
+        JST_TRACE_SPAN(TraceName(computeUnit.block), "unit");
+        return (fusedRuns[index] > 1) ? computeFusedRun(index) : computeUnit.block->compute(*context);
+    }();
+
+    if (profiling) {
+        RecordLatency(computeUnit.block, ElapsedNanoseconds(start));
+    }
+
+    if (res == Result::YIELD) {
+        Graph::YieldCompute(yielded, computeUnit.outputSet);
+        return Result::SUCCESS;
+    }
+
+    return res;
+}
+
+Result CPU::computeFusedRun(const U64& index) {
+    if (fusedRows[index] > 0) {
+        return computeTiledRun(index);
+    }
+
+    const U64 size = computeUnits[index].block->computeElementwise();
+
+    // Compute every unit of the run over one slice before moving to the next,
+    // so each intermediate slice is consumed while it's still in cache.
+
+    for (U64 offset = 0; offset < size; offset += FusedSliceSize) {
+        const U64 sliceSize = std::min(FusedSliceSize, size - offset);
+
+        for (U64 i = index; i < index + fusedRuns[index]; i++) {
+            JST_CHECK(computeUnits[i].block->computeSlice(*context, offset, sliceSize));
+        }
+    }
+
+    return Result::SUCCESS;
+}
+
+Result CPU::computeTiledRun(const U64& index) {
+    const U64 rows = fusedRows[index];
+    const U64 tileRows = fusedTileRows[index];
+    const U64 tiles = (rows + tileRows - 1) / tileRows;
+
+    // Same as slices, but over a few rows at a time. Tiles don't depend on
+    // each other, so they are split across the worker pool like the batches
+    // of rowwise modules computed on their own.
+
+    std::atomic<bool> failed{false};
+
+    Memory::CPU::ParallelRanges(workerPool, tiles, tiles, [&](const U64& begin, const U64& end) {
+        for (U64 tile = begin; tile < end && !failed.load(std::memory_order_relaxed); tile++) {
+            const U64 offset = tile * tileRows;
+            const U64 count = std::min(tileRows, rows - offset);
+
+            for (U64 i = index; i < index + fusedRuns[index]; i++) {
+                const auto& block = computeUnits[i].block;
+                const U64& rowSize = fusedRowSizes[i];
+
+                const auto& res = (rowSize > 0) ? block->computeSlice(*context, offset * rowSize, count * rowSize) :
+                                                  block->computeRows(*context, offset, count);
+
+                if (res != Result::SUCCESS) {
+                    JST_ERROR("[CPU] Failed to compute rows {} to {} of unit {}.", offset, offset + count, i);
+                    failed.store(true, std::memory_order_relaxed);
+                    break;
+                }
+            }
+        }
+    });
+
+    return (failed) ? Result::ERROR : Result::SUCCESS;
+}
+
+void CPU::dispatchUnit(const U64& index, ExecutionState& state) {
+    workerPool->dispatch([this, index, &state]{
+        const auto& computeUnit = computeUnits[index];
+
+        // Skip the unit if another one already failed or if it was fused.
+        if (!state.failed && fusedRuns[index] > 0) {
+            bool skip = false;
+
+            {
+                std::lock_guard<std::mutex> lock(state.mutex);
+                if ((skip = Graph::ShouldYield(*state.yielded, computeUnit.inputSet))) {
+                    for (U64 i = index; i < index + fusedRuns[index]; i++) {
+                        Graph::YieldCompute(*state.yielded, computeUnits[i].outputSet);
+                    }
+                }
+            }
+
+            if (!skip) {
+                const bool profiling = Graph::Timing();
+                const auto start = (profiling) ? std::chrono::steady_clock::now() :
+                                                 std::chrono::steady_clock::time_point{};
+
+                const auto& res = [&]{
+                    JST_TRACE_SPAN(TraceName(computeUnit.block), "unit");
+                    return (fusedRuns[index] > 1) ? computeFusedRun(index) : computeUnit.block->compute(*context);
+                }();
+
+                if (profiling) {
+                    RecordLatency(computeUnit.block, ElapsedNanoseconds(start));
+                }
+
+                if (res == Result::YIELD) {
+                    std::lock_guard<std::mutex> lock(state.mutex);
+                    Graph::YieldCompute(*state.yielded, computeUnit.outputSet);
+                } else if (res != Result::SUCCESS && res != Result::RELOAD) {
+                    std::lock_guard<std::mutex> lock(state.mutex);
+                    if (!state.failed.exchange(true)) {
+                        state.result = res;
+                    }
+                }
+            }
+        }
+
+        // Release units waiting for this one.
+        for (const auto& dependent : dependents[index]) {
+            if (--state.dependencies[dependent] == 0) {
+                dispatchUnit(dependent, state);
+            }
+        }
+
+        std::lock_guard<std::mutex> lock(state.mutex);
+        if (--state.remaining == 0) {
+            state.cond.notify_all();
+        }
+    });
+}
+
+Result CPU::computeStage(const U64& stage, std::unordered_set<U64>& yielded, PipelineState& state) {
+    const U64 stageCount = stageBounds.size() - 1;
+
+    const auto release = [&]{
+        if (stage > 0) {
+            state.released[stage].store(true, std::memory_order_release);
+        }
+    };
+
+    Result result = Result::SUCCESS;
+
+    for (U64 i = stageBounds[stage]; i < stageBounds[stage + 1]; i++) {
+        // Wait for the next stage to read the last frame before writing this one.
+        if (i == stageHandoffs[stage] && stage + 1 < stageCount) {
+            while (!state.released[stage + 1].load(std::memory_order_acquire)) {
+                if (!workerPool->runPending()) {
+                    std::this_thread::yield();
+                }
+            }
+        }
+
+        result = computeUnit(i, yielded);
+
+        if (i == stageLastReaders[stage]) {
+            release();
+        }
+
+        if (result != Result::SUCCESS) {
+            break;
+        }
+    }
+
+    release();
+
+    return result;
+}
+
+Result CPU::computePipeline(std::unordered_set<U64>& yielded) {
+    const U64 stageCount = stageBounds.size() - 1;
+
+    // Every stage computes the frame the previous stage computed in the last
+    // call, so it yields what the previous stage yielded back then.
+
+    std::vector<std::unordered_set<U64>> stageSets(stageCount, yielded);
+    for (U64 k = 1; k < stageCount; k++) {
+        stageSets[k].insert(stageYielded[k - 1].begin(), stageYielded[k - 1].end());
+    }
+
+    PipelineState state;
+    state.released = std::make_unique<std::atomic<bool>[]>(stageCount);
+    state.results.assign(stageCount, Result::SUCCESS);
+    state.remaining = stageCount - 1;
+
+    for (U64 k = 1; k < stageCount; k++) {
+        workerPool->dispatch([this, k, &stageSets, &state]{
+            state.results[k] = computeStage(k, stageSets[k], state);
+            state.remaining.fetch_sub(1, std::memory_order_release);
+        });
+    }
+
+    // The caller computes the first stage and helps with the others while waiting.
+
+    state.results[0] = computeStage(0, stageSets[0], state);
+
+    while (state.remaining.load(std::memory_order_acquire) > 0) {
+        if (!workerPool->runPending()) {
+            std::this_thread::yield();
+        }
+    }
+
+    // Only report what each stage yielded in this call.
+
+    for (U64 k = 0; k < stageCount; k++) {
+        for (U64 i = stageBounds[k]; i < stageBounds[k + 1]; i++) {
+            for (const auto& output : computeUnits[i].outputSet) {
+                if (stageSets[k].contains(output)) {
+                    yielded.emplace(output);
+                }
+            }
+        }
+    }
+
+    stageYielded = std::move(stageSets);
+
+    for (const auto& result : state.results) {
+        if (result != Result::SUCCESS) {
+            return result;
+        }
+    }
+
+    return Result::SUCCESS;
+}
+
+Result CPU::compute(std::unordered_set<U64>& yielded) {
+    if (!stageBounds.empty()) {
+        return computePipeline(yielded);
+    }
+
+    if (!parallel) {
+        for (U64 i = 0; i < computeUnits.size(); i++) {
+            JST_CHECK(computeUnit(i, yielded));
+        }
+        return Result::SUCCESS;
+    }
+
+    ExecutionState state;
+    state.yielded = &yielded;
+    state.remaining = computeUnits.size();
+    state.dependencies = std::make_unique<std::atomic<U64>[]>(computeUnits.size());
+
+    for (U64 i = 0; i < computeUnits.size(); i++) {
+        state.dependencies[i] = dependencyCount[i];
+    }
+
+    // Dispatch every unit without pending dependencies.
+    for (U64 i = 0; i < computeUnits.size(); i++) {
+        if (dependencyCount[i] == 0) {
+            dispatchUnit(i, state);
+        }
+    }
+
+    // Help the workers while waiting for the graph to finish.
+    while (workerPool->runPending()) {}
+
+    {
+        std::unique_lock<std::mutex> lock(state.mutex);
+        state.cond.wait(lock, [&]{ return state.remaining == 0; });
+    }
+
+    return state.result;
+}
+
 Result CPU::destroy() {
     for (const auto& computeUnit : computeUnits) {
         JST_CHECK(computeUnit.block->destroyCompute(*context));
     }
+    JST_CHECK(destroyMemoryPlan());
     computeUnits.clear();
+    dependencyCount.clear();
+    dependents.clear();
+    fusedRuns.clear();
+    fusedRows.clear();
+    fusedTileRows.clear();
+    fusedRowSizes.clear();
+    stageBounds.clear();
+    stageLastReaders.clear();
+    stageHandoffs.clear();
+    stageYielded.clear();
+    parallel = false;
     return Result::SUCCESS;
 }
 
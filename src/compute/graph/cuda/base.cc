@@ -1,8 +1,19 @@
 #include "jetstream/compute/graph/cuda.hh"
 #include "jetstream/backend/devices/cuda/helpers.hh"
+#include "jetstream/memory/devices/cuda/buffer.hh"
+#include "jetstream/startup.hh"
+#include "jetstream/platform.hh"
 
 #include <nvrtc.h>
 
+#include <mutex>
+#include <fstream>
+#include <numeric>
+#include <algorithm>
+#include <filesystem>
+#include <unordered_map>
+#include <unordered_set>
+
 namespace Jetstream {
 
 struct CUDA::Impl {
@@ -11,11 +22,83 @@ struct CUDA::Impl {
         CUmodule module;
     };
 
+    // Run of consecutive compute units with the same capture capability.
+    struct Segment {
+        U64 begin;
+        U64 end;
+        bool capturable;
+        bool failed = false;
+        U64 steadyFrames = 0;
+        cudaGraphExec_t exec = nullptr;
+        std::vector<U64> externalDependencies;
+    };
+
     U64 block_in_context;
 
     std::unordered_map<U64, std::unordered_map<std::string, Kernel>> kernels;
+
+    std::vector<Segment> segments;
+
+    // The first stream is the main stream of the graph.
+    std::vector<cudaStream_t> streams;
+    std::vector<cudaEvent_t> joinEvents;
+    cudaEvent_t completionEvent = nullptr;
+    cudaEvent_t uploadEvent = nullptr;
+    bool pending = false;
+
+    // Host mirrors are copied on streams of their own. Inputs of the next frame are
+    // staged in device memory while the previous frame computes, and outputs are
+    // downloaded as soon as the unit writing them is done.
+    struct Upload {
+        std::shared_ptr<TensorBuffer<Device::CUDA>> buffer;
+        void* staging = nullptr;
+    };
+
+    struct Download {
+        std::shared_ptr<TensorBuffer<Device::CUDA>> buffer;
+        cudaEvent_t event = nullptr;
+    };
+
+    cudaStream_t uploadStream = nullptr;
+    cudaStream_t downloadStream = nullptr;
+    std::vector<Upload> uploads;
+    std::vector<std::vector<Download>> unitDownloads;
+    cudaEvent_t stagedEvent = nullptr;
+    cudaEvent_t releasedEvent = nullptr;
+    cudaEvent_t downloadedEvent = nullptr;
+    bool inputsStaged = false;
+
+    U64 migratedBytes = 0;
+
+    std::vector<U64> unitStream;
+    std::vector<std::vector<U64>> dependencies;
+    std::vector<cudaEvent_t> unitEvents;
+    std::vector<bool> crossStream;
+
+    // Events around every unit recorded while profiling.
+    std::vector<std::pair<cudaEvent_t, cudaEvent_t>> timingEvents;
+    std::vector<bool> timed;
+
+    Result createSegments(const CUDA& graph);
+    Result createStreams(CUDA& graph);
+    Result waitDependencies(const std::vector<U64>& units, const U64& stream);
+    Result recordUnit(const U64& unit);
+    Result captureSegment(CUDA& graph, Segment& segment);
+    Result createTransfers(const CUDA& graph);
+    Result stageUploads();
+    Result applyUploads();
+    Result downloadUnit(const U64& unit);
+    Result destroyTransfers();
+    Result destroySegments();
+    Result destroyStreams();
 };
 
+// Number of eager frames without yields before a segment is captured.
+static constexpr U64 CaptureWarmupFrames = 2;
+
+// Maximum number of streams used by independent branches of a graph.
+static constexpr U64 MaxStreams = 4;
+
 CUDA::CUDA() {
     context = std::make_shared<Compute::Context>();
     context->cuda = this;
@@ -31,20 +114,164 @@ CUDA::~CUDA() {
 Result CUDA::create() {
     JST_DEBUG("Creating new CUDA compute graph.");
 
-    // Create CUDA stream.
+    const Backend::CUDA::Placement placement(deviceIndex());
 
-    JST_CUDA_CHECK(cudaStreamCreateWithFlags(&_stream, cudaStreamNonBlocking), [&]{
-        JST_ERROR("[CUDA] Can't create stream: {}", err);
-    });
+    // Group consecutive capturable blocks into segments.
+
+    JST_CHECK(pimpl->createSegments(*this));
+
+    // Create CUDA streams.
+
+    JST_CHECK(pimpl->createStreams(*this));
 
     // Create blocks.
 
     for (U64 i = 0; i < computeUnits.size(); i++) {
         pimpl->block_in_context = i;
+        _currentStream = pimpl->streams[pimpl->unitStream[i]];
 
         JST_CHECK(computeUnits[i].block->createCompute(*context));
     }
 
+    _currentStream = _stream;
+
+    return Result::SUCCESS;
+}
+
+Result CUDA::Impl::createSegments(const CUDA& graph) {
+    const auto& computeUnits = graph.computeUnits;
+
+    segments.clear();
+    for (U64 i = 0; i < computeUnits.size(); i++) {
+        const bool capturable = computeUnits[i].block->computeCapturable();
+
+        if (segments.empty() || segments.back().capturable != capturable) {
+            segments.push_back({
+                .begin = i,
+                .end = i,
+                .capturable = capturable,
+            });
+        }
+
+        segments.back().end = i + 1;
+    }
+
+    return Result::SUCCESS;
+}
+
+Result CUDA::Impl::createStreams(CUDA& graph) {
+    const U64 unitCount = graph.computeUnits.size();
+
+    dependencies = graph.unitDependencies();
+    unitStream.assign(unitCount, 0);
+    crossStream.assign(unitCount, false);
+
+    // Assign streams. A unit continues on the stream of its first dependency
+    // not continued by another unit yet. Otherwise it starts a new branch.
+    // Captured segments are recorded from a single stream.
+
+    U64 streamCount = 1;
+    std::vector<bool> continued(unitCount, false);
+
+    for (const auto& segment : segments) {
+        for (U64 j = segment.begin; j < segment.end; j++) {
+            if (segment.capturable && j != segment.begin) {
+                unitStream[j] = unitStream[segment.begin];
+                continue;
+            }
+
+            bool assigned = (j == 0);
+            for (const auto& d : dependencies[j]) {
+                if (!continued[d]) {
+                    unitStream[j] = unitStream[d];
+                    continued[d] = true;
+                    assigned = true;
+                    break;
+                }
+            }
+
+            if (!assigned) {
+                unitStream[j] = (streamCount < MaxStreams) ? streamCount++ : (j % MaxStreams);
+            }
+        }
+    }
+
+    // Mark units with dependents on other streams.
+
+    for (U64 j = 0; j < unitCount; j++) {
+        for (const auto& d : dependencies[j]) {
+            if (unitStream[d] != unitStream[j]) {
+                crossStream[d] = true;
+            }
+        }
+    }
+
+    for (auto& segment : segments) {
+        segment.externalDependencies.clear();
+
+        for (U64 j = segment.begin; j < segment.end; j++) {
+            for (const auto& d : dependencies[j]) {
+                if (d < segment.begin) {
+                    segment.externalDependencies.push_back(d);
+                }
+            }
+        }
+    }
+
+    JST_DEBUG("[CUDA] Graph with {} block(s) will execute on {} stream(s).", unitCount, streamCount);
+
+    // Create streams and events.
+
+    streams.resize(streamCount);
+    for (auto& stream : streams) {
+        JST_CUDA_CHECK(cudaStreamCreateWithFlags(&stream, cudaStreamNonBlocking), [&]{
+            JST_ERROR("[CUDA] Can't create stream: {}", err);
+        });
+    }
+    graph._stream = streams[0];
+    graph._currentStream = streams[0];
+
+    const auto createEvent = [&](cudaEvent_t& event) {
+        JST_CUDA_CHECK(cudaEventCreateWithFlags(&event, cudaEventDisableTiming), [&]{
+            JST_ERROR("[CUDA] Can't create event: {}", err);
+        });
+        return Result::SUCCESS;
+    };
+
+    unitEvents.assign(unitCount, nullptr);
+    for (U64 i = 0; i < unitCount; i++) {
+        if (crossStream[i]) {
+            JST_CHECK(createEvent(unitEvents[i]));
+        }
+    }
+
+    joinEvents.assign(streamCount, nullptr);
+    for (U64 i = 1; i < streamCount; i++) {
+        JST_CHECK(createEvent(joinEvents[i]));
+    }
+
+    JST_CHECK(createEvent(completionEvent));
+    JST_CHECK(createEvent(uploadEvent));
+    JST_CHECK(createEvent(stagedEvent));
+    JST_CHECK(createEvent(releasedEvent));
+    JST_CHECK(createEvent(downloadedEvent));
+
+    for (auto* stream : {&uploadStream, &downloadStream}) {
+        JST_CUDA_CHECK(cudaStreamCreateWithFlags(stream, cudaStreamNonBlocking), [&]{
+            JST_ERROR("[CUDA] Can't create copy stream: {}", err);
+        });
+    }
+
+    timingEvents.assign(unitCount, {nullptr, nullptr});
+    timed.assign(unitCount, false);
+    for (auto& [start, stop] : timingEvents) {
+        for (auto* event : {&start, &stop}) {
+            JST_CUDA_CHECK(cudaEventCreateWithFlags(event, cudaEventDefault), [&]{
+                JST_ERROR("[CUDA] Can't create timing event: {}", err);
+            });
+        }
+    }
+
     return Result::SUCCESS;
 }
 
@@ -55,53 +282,548 @@ Result CUDA::computeReady() {
     return Result::SUCCESS;
 }
 
+Result CUDA::Impl::waitDependencies(const std::vector<U64>& units, const U64& stream) {
+    for (const auto& unit : units) {
+        if (unitStream[unit] == stream) {
+            continue;
+        }
+
+        JST_CUDA_CHECK(cudaStreamWaitEvent(streams[stream], unitEvents[unit], 0), [&]{
+            JST_ERROR("[CUDA] Can't wait for event: {}", err);
+        });
+    }
+
+    return Result::SUCCESS;
+}
+
+Result CUDA::Impl::recordUnit(const U64& unit) {
+    if (!crossStream[unit]) {
+        return Result::SUCCESS;
+    }
+
+    JST_CUDA_CHECK(cudaEventRecord(unitEvents[unit], streams[unitStream[unit]]), [&]{
+        JST_ERROR("[CUDA] Can't record event: {}", err);
+    });
+
+    return Result::SUCCESS;
+}
+
+Result CUDA::computeUnit(const U64& index, std::unordered_set<U64>& yielded, bool& didYield) {
+    auto& computeUnit = computeUnits[index];
+
+    if (Graph::ShouldYield(yielded, computeUnit.inputSet)) {
+        Graph::YieldCompute(yielded, computeUnit.outputSet);
+        didYield = true;
+        return Result::SUCCESS;
+    }
+
+    pimpl->block_in_context = index;
+    _currentStream = pimpl->streams[pimpl->unitStream[index]];
+
+    // Spans of device graphs cover the enqueue on the host.
+    const auto& res = [&]{
+        JST_TRACE_SPAN(TraceName(computeUnit.block), "unit");
+        return computeUnit.block->compute(*context);
+    }();
+
+    if (res == Result::SUCCESS) {
+        JST_CUDA_CHECK(cudaGetLastError(), [&]{
+            JST_ERROR("[CUDA] Module kernel execution failed: {}", err);
+        });
+
+        return Result::SUCCESS;
+    }
+
+    if (res == Result::YIELD) {
+        Graph::YieldCompute(yielded, computeUnit.outputSet);
+        didYield = true;
+        return Result::SUCCESS;
+    }
+
+    return res;
+}
+
 Result CUDA::compute(std::unordered_set<U64>& yielded) {
+    const Backend::CUDA::Placement placement(deviceIndex());
+
+    // Host mirrors exchanged with other devices changed since the last frame.
+
+    if (mirrorsChanged) {
+        JST_CHECK(synchronize());
+        JST_CHECK(pimpl->createTransfers(*this));
+        mirrorsChanged = false;
+    }
+
+    // Start uploading host mirrors written by other devices. The previous frame
+    // may still be computing, the uploads only wait for its staging memory.
+
+    pimpl->migratedBytes = 0;
+
+    JST_CHECK(pimpl->stageUploads());
+
+    // Previous frame has to finish before reusing the buffers.
+
+    JST_CHECK(synchronize());
+
+    // Move the staged uploads into the device buffers before any stream reads them.
+
+    if (!pimpl->uploads.empty()) {
+        JST_CHECK(pimpl->applyUploads());
+
+        if (pimpl->streams.size() > 1) {
+            JST_CUDA_CHECK(cudaEventRecord(pimpl->uploadEvent, _stream), [&]{
+                JST_ERROR("[CUDA] Can't record event: {}", err);
+            });
+            for (U64 i = 1; i < pimpl->streams.size(); i++) {
+                JST_CUDA_CHECK(cudaStreamWaitEvent(pimpl->streams[i], pimpl->uploadEvent, 0), [&]{
+                    JST_ERROR("[CUDA] Can't wait for event: {}", err);
+                });
+            }
+        }
+    }
+
     // Execute blocks.
 
-    for (U64 i = 0; i < computeUnits.size(); i++) {
-        auto& computeUnit = computeUnits[i];
+    const bool profiling = Graph::Timing();
+
+    for (auto& segment : pimpl->segments) {
+        const bool upstreamYield = std::any_of(computeUnits.begin() + segment.begin,
+                                               computeUnits.begin() + segment.end,
+                                               [&](const auto& computeUnit) {
+            return Graph::ShouldYield(yielded, computeUnit.inputSet);
+        });
+
+        // Captured segments can't be timed per unit, so they run eagerly while profiling.
+        if (segment.capturable && !segment.failed && !upstreamYield && !profiling) {
+            const auto& stream = pimpl->unitStream[segment.begin];
+
+            // Capture the segment after a few steady frames.
+            if (!segment.exec && segment.steadyFrames >= CaptureWarmupFrames) {
+                JST_CHECK(pimpl->waitDependencies(segment.externalDependencies, stream));
+                JST_CHECK(pimpl->captureSegment(*this, segment));
+            }
+
+            // Replay the captured launch sequence.
+            if (segment.exec) {
+                JST_CHECK(pimpl->waitDependencies(segment.externalDependencies, stream));
+
+                JST_CUDA_CHECK(cudaGraphLaunch(segment.exec, pimpl->streams[stream]), [&]{
+                    JST_ERROR("[CUDA] Can't launch captured graph: {}", err);
+                });
+
+                for (U64 i = segment.begin; i < segment.end; i++) {
+                    JST_CHECK(pimpl->recordUnit(i));
+                    JST_CHECK(pimpl->downloadUnit(i));
+                }
+                continue;
+            }
+        }
 
-        if (Graph::ShouldYield(yielded, computeUnit.inputSet)) {
-            Graph::YieldCompute(yielded, computeUnit.outputSet);
-            continue;
+        // Fallback to eager execution.
+
+        bool didYield = false;
+        for (U64 i = segment.begin; i < segment.end; i++) {
+            const auto& stream = pimpl->streams[pimpl->unitStream[i]];
+            const auto& [timingStart, timingStop] = pimpl->timingEvents[i];
+
+            JST_CHECK(pimpl->waitDependencies(pimpl->dependencies[i], pimpl->unitStream[i]));
+
+            if (profiling) {
+                JST_CUDA_CHECK(cudaEventRecord(timingStart, stream), [&]{
+                    JST_ERROR("[CUDA] Can't record timing event: {}", err);
+                });
+            }
+
+            bool unitYield = false;
+            JST_CHECK(computeUnit(i, yielded, unitYield));
+            didYield |= unitYield;
+
+            if (profiling && !unitYield) {
+                JST_CUDA_CHECK(cudaEventRecord(timingStop, stream), [&]{
+                    JST_ERROR("[CUDA] Can't record timing event: {}", err);
+                });
+                pimpl->timed[i] = true;
+            }
+
+            JST_CHECK(pimpl->recordUnit(i));
+            JST_CHECK(pimpl->downloadUnit(i));
         }
 
-        pimpl->block_in_context = i;
+        segment.steadyFrames = (didYield) ? 0 : segment.steadyFrames + 1;
+    }
 
-        const auto& res = computeUnit.block->compute(*context);
+    _currentStream = _stream;
 
-        if (res == Result::SUCCESS) {
-            JST_CUDA_CHECK(cudaGetLastError(), [&]{
-                JST_ERROR("[CUDA] Module kernel execution failed: {}", err);
-            });
+    // Join all streams into the main stream and signal completion.
+
+    for (U64 i = 1; i < pimpl->streams.size(); i++) {
+        JST_CUDA_CHECK(cudaEventRecord(pimpl->joinEvents[i], pimpl->streams[i]), [&]{
+            JST_ERROR("[CUDA] Can't record event: {}", err);
+        });
+        JST_CUDA_CHECK(cudaStreamWaitEvent(_stream, pimpl->joinEvents[i], 0), [&]{
+            JST_ERROR("[CUDA] Can't wait for event: {}", err);
+        });
+    }
+
+    // Wait for the downloads of host mirrors read by other devices before signaling completion.
+
+    JST_CUDA_CHECK(cudaEventRecord(pimpl->downloadedEvent, pimpl->downloadStream), [&]{
+        JST_ERROR("[CUDA] Can't record event: {}", err);
+    });
+    JST_CUDA_CHECK(cudaStreamWaitEvent(_stream, pimpl->downloadedEvent, 0), [&]{
+        JST_ERROR("[CUDA] Can't wait for event: {}", err);
+    });
+
+    JST_CUDA_CHECK(cudaEventRecord(pimpl->completionEvent, _stream), [&]{
+        JST_ERROR("[CUDA] Can't record completion event: {}", err);
+    });
+    pimpl->pending = true;
+
+    return Result::SUCCESS;
+}
+
+U64 CUDA::migratedBytes() const {
+    return pimpl->migratedBytes;
+}
+
+Result CUDA::Impl::createTransfers(const CUDA& graph) {
+    JST_CHECK(destroyTransfers());
+
+    const auto& mirroredBuffer = [](const std::shared_ptr<TensorStorageMetadata>& storage) {
+        std::shared_ptr<TensorBuffer<Device::CUDA>> buffer;
+        if (storage->clones.contains(Device::CUDA)) {
+            buffer = std::any_cast<std::shared_ptr<TensorBuffer<Device::CUDA>>>(storage->clones.at(Device::CUDA));
+        }
+        return (buffer && buffer->mirrored()) ? buffer : nullptr;
+    };
 
+    // Every upload gets a staging buffer, so the next frame can be copied
+    // while the previous one still reads the device buffer.
+
+    std::unordered_set<U64> staged;
+
+    for (const auto& [hash, storage] : graph.mirroredInputs) {
+        const auto& buffer = mirroredBuffer(storage);
+        if (!buffer) {
             continue;
         }
 
-        if (res == Result::YIELD) {
-            Graph::YieldCompute(yielded, computeUnit.outputSet);
+        Upload upload = {.buffer = buffer};
+        JST_CUDA_CHECK(cudaMalloc(&upload.staging, buffer->mirror_size_bytes()), [&]{
+            JST_ERROR("[CUDA] Can't allocate staging memory: {}", err);
+        });
+        uploads.push_back(upload);
+        staged.emplace(hash);
+    }
+
+    // Inputs read directly from the memory of other devices keep their producers waiting.
+
+    inputsStaged = !uploads.empty() && std::ranges::all_of(graph.getExternallyWiredInputs(), [&](const U64& hash) {
+        return staged.contains(hash);
+    });
+
+    // Outputs are downloaded after the last unit writing them.
+
+    unitDownloads.assign(graph.computeUnits.size(), {});
+
+    for (const auto& [hash, storage] : graph.mirroredOutputs) {
+        const auto& buffer = mirroredBuffer(storage);
+        if (!buffer || graph.computeUnits.empty()) {
             continue;
         }
 
-        JST_CHECK(res);
+        U64 unit = graph.computeUnits.size() - 1;
+        for (U64 i = 0; i < graph.computeUnits.size(); i++) {
+            if (graph.computeUnits[i].outputSet.contains(hash)) {
+                unit = i;
+            }
+        }
+
+        Download download = {.buffer = buffer};
+        JST_CUDA_CHECK(cudaEventCreateWithFlags(&download.event, cudaEventDisableTiming), [&]{
+            JST_ERROR("[CUDA] Can't create event: {}", err);
+        });
+        unitDownloads[unit].push_back(download);
     }
 
+    JST_DEBUG("[CUDA] Graph will stage {} upload(s) and overlap {} download(s).", uploads.size(),
+              std::accumulate(unitDownloads.begin(), unitDownloads.end(), U64{0}, [](const U64& sum, const auto& d) {
+                  return sum + d.size();
+              }));
+
+    return Result::SUCCESS;
+}
+
+Result CUDA::Impl::stageUploads() {
+    if (uploads.empty()) {
+        return Result::SUCCESS;
+    }
+
+    // The staging memory is free once the previous frame moved it into the device buffers.
+
+    JST_CUDA_CHECK(cudaStreamWaitEvent(uploadStream, releasedEvent, 0), [&]{
+        JST_ERROR("[CUDA] Can't wait for event: {}", err);
+    });
+
+    for (const auto& upload : uploads) {
+        JST_CUDA_CHECK(cudaMemcpyAsync(upload.staging,
+                                       upload.buffer->host_data(),
+                                       upload.buffer->mirror_size_bytes(),
+                                       cudaMemcpyHostToDevice,
+                                       uploadStream), [&]{
+            JST_ERROR("[CUDA] Can't upload host mirror: {}", err);
+        });
+        migratedBytes += upload.buffer->mirror_size_bytes();
+    }
+
+    JST_CUDA_CHECK(cudaEventRecord(stagedEvent, uploadStream), [&]{
+        JST_ERROR("[CUDA] Can't record event: {}", err);
+    });
+
+    return Result::SUCCESS;
+}
+
+Result CUDA::Impl::applyUploads() {
+    JST_CUDA_CHECK(cudaStreamWaitEvent(streams[0], stagedEvent, 0), [&]{
+        JST_ERROR("[CUDA] Can't wait for event: {}", err);
+    });
+
+    for (const auto& upload : uploads) {
+        JST_CUDA_CHECK(cudaMemcpyAsync(upload.buffer->data(),
+                                       upload.staging,
+                                       upload.buffer->mirror_size_bytes(),
+                                       cudaMemcpyDeviceToDevice,
+                                       streams[0]), [&]{
+            JST_ERROR("[CUDA] Can't copy staged upload: {}", err);
+        });
+    }
+
+    JST_CUDA_CHECK(cudaEventRecord(releasedEvent, streams[0]), [&]{
+        JST_ERROR("[CUDA] Can't record event: {}", err);
+    });
+
+    return Result::SUCCESS;
+}
+
+Result CUDA::Impl::downloadUnit(const U64& unit) {
+    if (unit >= unitDownloads.size()) {
+        return Result::SUCCESS;
+    }
+
+    for (const auto& download : unitDownloads[unit]) {
+        JST_CUDA_CHECK(cudaEventRecord(download.event, streams[unitStream[unit]]), [&]{
+            JST_ERROR("[CUDA] Can't record event: {}", err);
+        });
+        JST_CUDA_CHECK(cudaStreamWaitEvent(downloadStream, download.event, 0), [&]{
+            JST_ERROR("[CUDA] Can't wait for event: {}", err);
+        });
+        JST_CHECK(download.buffer->download(downloadStream));
+        migratedBytes += download.buffer->mirror_size_bytes();
+    }
+
+    return Result::SUCCESS;
+}
+
+Result CUDA::Impl::destroyTransfers() {
+    for (auto* stream : {uploadStream, downloadStream}) {
+        if (stream) {
+            JST_CUDA_CHECK(cudaStreamSynchronize(stream), [&]{
+                JST_ERROR("[CUDA] Can't synchronize copy stream: {}", err);
+            });
+        }
+    }
+
+    for (auto& upload : uploads) {
+        JST_CUDA_CHECK(cudaFree(upload.staging), [&]{
+            JST_ERROR("[CUDA] Can't free staging memory: {}", err);
+        });
+    }
+    uploads.clear();
+
+    for (auto& downloads : unitDownloads) {
+        for (auto& download : downloads) {
+            JST_CUDA_CHECK(cudaEventDestroy(download.event), [&]{
+                JST_ERROR("[CUDA] Can't destroy event: {}", err);
+            });
+        }
+    }
+    unitDownloads.clear();
+
+    inputsStaged = false;
+
+    return Result::SUCCESS;
+}
+
+Result CUDA::synchronize() {
+    if (!pimpl->pending) {
+        return Result::SUCCESS;
+    }
+    pimpl->pending = false;
+
     // Wait for all blocks to finish.
 
-    JST_CUDA_CHECK(cudaStreamSynchronize(_stream), [&]{
-        JST_ERROR("[CUDA] Can't synchronize stream: {}", err);
+    JST_CUDA_CHECK(cudaEventSynchronize(pimpl->completionEvent), [&]{
+        JST_ERROR("[CUDA] Can't synchronize graph: {}", err);
     });
 
+    // Collect the device time of the units timed by the last frame.
+
+    for (U64 i = 0; i < pimpl->timed.size(); i++) {
+        if (!pimpl->timed[i]) {
+            continue;
+        }
+        pimpl->timed[i] = false;
+
+        F32 elapsed = 0.0f;
+        const auto& [timingStart, timingStop] = pimpl->timingEvents[i];
+        JST_CUDA_CHECK(cudaEventElapsedTime(&elapsed, timingStart, timingStop), [&]{
+            JST_ERROR("[CUDA] Can't read timing event: {}", err);
+        });
+        RecordLatency(computeUnits[i].block, static_cast<U64>(elapsed * 1e6f));
+    }
+
+    return Result::SUCCESS;
+}
+
+Result CUDA::synchronizeInputs() {
+    if (!pimpl->pending || !pimpl->inputsStaged) {
+        return synchronize();
+    }
+
+    // Every input written by other graphs is read from staging memory.
+
+    JST_CUDA_CHECK(cudaEventSynchronize(pimpl->stagedEvent), [&]{
+        JST_ERROR("[CUDA] Can't synchronize uploads: {}", err);
+    });
+
+    return Result::SUCCESS;
+}
+
+Result CUDA::Impl::captureSegment(CUDA& graph, Segment& segment) {
+    JST_DEBUG("[CUDA] Capturing {} block(s) into a CUDA graph.", segment.end - segment.begin);
+
+    const auto& stream = streams[unitStream[segment.begin]];
+
+    JST_CUDA_CHECK(cudaStreamBeginCapture(stream, cudaStreamCaptureModeThreadLocal), [&]{
+        JST_ERROR("[CUDA] Can't begin stream capture: {}", err);
+    });
+
+    Result res = Result::SUCCESS;
+    graph._currentStream = stream;
+    for (U64 i = segment.begin; i < segment.end; i++) {
+        block_in_context = i;
+
+        if ((res = graph.computeUnits[i].block->compute(*graph.context)) != Result::SUCCESS) {
+            break;
+        }
+    }
+
+    cudaGraph_t cudaGraph = nullptr;
+    cudaError_t err = cudaStreamEndCapture(stream, &cudaGraph);
+
+    if (res == Result::SUCCESS && err == cudaSuccess) {
+        err = cudaGraphInstantiateWithFlags(&segment.exec, cudaGraph, 0);
+    }
+
+    if (cudaGraph) {
+        cudaGraphDestroy(cudaGraph);
+    }
+
+    // Some operations can't be captured. Keep the segment eager.
+    if (res != Result::SUCCESS || err != cudaSuccess) {
+        JST_WARN("[CUDA] Can't capture graph ({}). Falling back to eager execution.",
+                 (err != cudaSuccess) ? cudaGetErrorString(err) : "module failed");
+        cudaGetLastError();
+        segment.exec = nullptr;
+        segment.failed = true;
+    }
+
+    return Result::SUCCESS;
+}
+
+Result CUDA::Impl::destroySegments() {
+    for (auto& segment : segments) {
+        if (segment.exec) {
+            JST_CUDA_CHECK(cudaGraphExecDestroy(segment.exec), [&]{
+                JST_ERROR("[CUDA] Can't destroy captured graph: {}", err);
+            });
+        }
+    }
+    segments.clear();
+
+    return Result::SUCCESS;
+}
+
+Result CUDA::Impl::destroyStreams() {
+    const auto destroyEvent = [&](cudaEvent_t& event) {
+        if (event) {
+            JST_CUDA_CHECK(cudaEventDestroy(event), [&]{
+                JST_ERROR("[CUDA] Can't destroy event: {}", err);
+            });
+            event = nullptr;
+        }
+        return Result::SUCCESS;
+    };
+
+    for (auto& event : unitEvents) {
+        JST_CHECK(destroyEvent(event));
+    }
+    for (auto& [start, stop] : timingEvents) {
+        JST_CHECK(destroyEvent(start));
+        JST_CHECK(destroyEvent(stop));
+    }
+    for (auto& event : joinEvents) {
+        JST_CHECK(destroyEvent(event));
+    }
+    JST_CHECK(destroyEvent(completionEvent));
+    JST_CHECK(destroyEvent(uploadEvent));
+    JST_CHECK(destroyEvent(stagedEvent));
+    JST_CHECK(destroyEvent(releasedEvent));
+    JST_CHECK(destroyEvent(downloadedEvent));
+
+    for (auto* stream : {&uploadStream, &downloadStream}) {
+        if (*stream) {
+            JST_CUDA_CHECK(cudaStreamDestroy(*stream), [&]{
+                JST_ERROR("[CUDA] Can't destroy copy stream: {}", err);
+            });
+            *stream = nullptr;
+        }
+    }
+
+    for (const auto& stream : streams) {
+        JST_CUDA_CHECK(cudaStreamDestroy(stream), [&]{
+            JST_ERROR("[CUDA] Can't destroy stream: {}", err);
+        });
+    }
+
+    streams.clear();
+    unitEvents.clear();
+    timingEvents.clear();
+    timed.clear();
+    joinEvents.clear();
+    unitStream.clear();
+    dependencies.clear();
+    crossStream.clear();
+
     return Result::SUCCESS;
 }
 
 Result CUDA::destroy() {
+    const Backend::CUDA::Placement placement(deviceIndex());
+
+    // Wait for pending work.
+
+    JST_CHECK(synchronize());
+
+    // Destroy captured graphs.
+
+    JST_CHECK(pimpl->destroySegments());
+
     // Destroy blocks.
 
     for (const auto& computeUnit : computeUnits) {
         JST_CHECK(computeUnit.block->destroyCompute(*context));
     }
-    computeUnits.clear();
 
     // Destroy kernels.
 
@@ -116,23 +838,208 @@ Result CUDA::destroy() {
             JST_CHECK(destroyKernel(name));
         }
     }
+    computeUnits.clear();
 
-    // Destroy CUDA stream.
+    // Destroy staging memory and CUDA streams.
 
-    JST_CUDA_CHECK(cudaStreamDestroy(_stream), [&]{
-        JST_ERROR("[CUDA] Can't destroy stream: {}", err);
-    });
+    JST_CHECK(pimpl->destroyTransfers());
+    JST_CHECK(pimpl->destroyStreams());
+    mirrorsChanged = true;
 
     return Result::SUCCESS;
 }
 
-Result CUDA::createKernel(const std::string& name, 
-                          const std::string& source,
-                          const std::vector<KernelHeader>&) {
-    if (pimpl->kernels[pimpl->block_in_context].contains(name)) {
-        JST_ERROR("[CUDA] Kernel with name '{}' already exists.", name);
+namespace {
+
+// Compiled kernel shared by every graph of the process. The image is a cubin
+// for the device or PTX when NVRTC can't target its architecture.
+struct CompiledKernel {
+    std::string loweredName;
+    std::vector<char> image;
+};
+
+struct KernelTarget {
+    // Architecture name, `sm_86` for a cubin and `compute_80` for PTX.
+    std::string name;
+    std::vector<std::string> options;
+    bool binary;
+};
+
+constexpr U32 KernelCacheMagic = 0x4b54534a;
+constexpr U32 KernelCacheVersion = 1;
+
+std::mutex& KernelCacheMutex() {
+    static std::mutex mutex;
+    return mutex;
+}
+
+std::unordered_map<std::string, CompiledKernel>& KernelCache() {
+    static std::unordered_map<std::string, CompiledKernel> cache;
+    return cache;
+}
+
+// Compile to SASS for the device if NVRTC supports it. Otherwise, target the
+// newest virtual architecture below it and let the driver compile the PTX.
+KernelTarget KernelArchitecture() {
+    const int device = static_cast<int>(Backend::State<Device::CUDA>()->getArchitecture());
+
+    int count = 0;
+    std::vector<int> supported;
+    if (nvrtcGetNumSupportedArchs(&count) == NVRTC_SUCCESS && count > 0) {
+        supported.resize(count);
+        if (nvrtcGetSupportedArchs(supported.data()) != NVRTC_SUCCESS) {
+            supported.clear();
+        }
     }
-    auto& kernel = pimpl->kernels[pimpl->block_in_context][name];
+
+    if (std::find(supported.begin(), supported.end(), device) != supported.end()) {
+        return {
+            .name = jst::fmt::format("sm_{}", device),
+            .options = {jst::fmt::format("--gpu-architecture=sm_{}", device), "--std=c++14"},
+            .binary = true,
+        };
+    }
+
+    int fallback = supported.empty() ? 52 : *std::min_element(supported.begin(), supported.end());
+    for (const auto& arch : supported) {
+        if (arch <= device) {
+            fallback = std::max(fallback, arch);
+        }
+    }
+
+    return {
+        .name = jst::fmt::format("compute_{}", fallback),
+        .options = {jst::fmt::format("--gpu-architecture=compute_{}", fallback), "--std=c++14"},
+        .binary = false,
+    };
+}
+
+// FNV-1a of everything changing the compiled image. Stable across runs.
+U64 HashKernel(const std::string& name, const std::string& source, const KernelTarget& target) {
+    U64 hash = 0xcbf29ce484222325;
+
+    const auto update = [&](const std::string& value) {
+        for (const auto& c : value) {
+            hash = (hash ^ static_cast<U8>(c)) * 0x100000001b3;
+        }
+        hash = (hash ^ 0xff) * 0x100000001b3;
+    };
+
+    int major = 0;
+    int minor = 0;
+    nvrtcVersion(&major, &minor);
+
+    update(name);
+    update(source);
+    for (const auto& option : target.options) {
+        update(option);
+    }
+    update(jst::fmt::format("nvrtc-{}.{}", major, minor));
+
+    return hash;
+}
+
+std::string KernelCachePath(const std::string& key) {
+    std::string folder;
+    if (Platform::CacheFolder(folder) != Result::SUCCESS) {
+        return {};
+    }
+
+    const auto path = std::filesystem::path(folder) / "cuda-kernels";
+
+    std::error_code ec;
+    std::filesystem::create_directories(path, ec);
+    if (ec) {
+        return {};
+    }
+
+    return (path / jst::fmt::format("{}.bin", key)).string();
+}
+
+Result LoadKernel(const std::string& key, CompiledKernel& kernel) {
+    const auto path = KernelCachePath(key);
+    if (path.empty()) {
+        return Result::ERROR;
+    }
+
+    std::ifstream file(path, std::ios::binary);
+    if (!file) {
+        return Result::ERROR;
+    }
+
+    U32 magic = 0;
+    U32 version = 0;
+    U64 nameSize = 0;
+    U64 imageSize = 0;
+
+    file.read(reinterpret_cast<char*>(&magic), sizeof(magic));
+    file.read(reinterpret_cast<char*>(&version), sizeof(version));
+    file.read(reinterpret_cast<char*>(&nameSize), sizeof(nameSize));
+
+    if (!file || magic != KernelCacheMagic || version != KernelCacheVersion || nameSize > 4096) {
+        JST_DEBUG("[CUDA] Kernel cache entry '{}' is stale. Discarding it.", path);
+        return Result::ERROR;
+    }
+
+    kernel.loweredName.resize(nameSize);
+    file.read(kernel.loweredName.data(), nameSize);
+    file.read(reinterpret_cast<char*>(&imageSize), sizeof(imageSize));
+
+    if (!file || imageSize == 0 || imageSize > (U64(1) << 30)) {
+        JST_DEBUG("[CUDA] Kernel cache entry '{}' is truncated. Discarding it.", path);
+        return Result::ERROR;
+    }
+
+    kernel.image.resize(imageSize);
+    file.read(kernel.image.data(), imageSize);
+
+    if (!file) {
+        JST_DEBUG("[CUDA] Kernel cache entry '{}' is truncated. Discarding it.", path);
+        return Result::ERROR;
+    }
+
+    JST_TRACE("[CUDA] Loaded kernel '{}' from the cache.", key);
+
+    return Result::SUCCESS;
+}
+
+void StoreKernel(const std::string& key, const CompiledKernel& kernel) {
+    const auto path = KernelCachePath(key);
+    if (path.empty()) {
+        return;
+    }
+
+    // Write to a temporary file first so a crash never leaves a truncated entry.
+
+    const auto temporaryPath = path + ".tmp";
+
+    const U64 nameSize = kernel.loweredName.size();
+    const U64 imageSize = kernel.image.size();
+
+    std::ofstream file(temporaryPath, std::ios::binary | std::ios::trunc);
+    file.write(reinterpret_cast<const char*>(&KernelCacheMagic), sizeof(KernelCacheMagic));
+    file.write(reinterpret_cast<const char*>(&KernelCacheVersion), sizeof(KernelCacheVersion));
+    file.write(reinterpret_cast<const char*>(&nameSize), sizeof(nameSize));
+    file.write(kernel.loweredName.data(), nameSize);
+    file.write(reinterpret_cast<const char*>(&imageSize), sizeof(imageSize));
+    file.write(kernel.image.data(), imageSize);
+    file.close();
+
+    std::error_code ec;
+    if (file) {
+        std::filesystem::rename(temporaryPath, path, ec);
+    }
+    if (!file || ec) {
+        JST_WARN("[CUDA] Failed to save kernel to '{}'.", path);
+        std::filesystem::remove(temporaryPath, ec);
+    }
+}
+
+Result CompileKernel(const std::string& name,
+                     const std::string& source,
+                     const KernelTarget& target,
+                     CompiledKernel& kernel) {
+    JST_STARTUP_PHASE("NVRTC Compilation");
 
     // Create program.
 
@@ -153,10 +1060,10 @@ Result CUDA::createKernel(const std::string& name,
 
     // Compile program.
 
-    const std::vector<const char*> options = {
-        "--gpu-architecture=compute_86",
-        "--std=c++14"
-    };
+    std::vector<const char*> options;
+    for (const auto& option : target.options) {
+        options.push_back(option.c_str());
+    }
 
     JST_NVRTC_CHECK(nvrtcCompileProgram(program, options.size(), options.data()), [&]{
         size_t logSize;
@@ -166,21 +1073,32 @@ Result CUDA::createKernel(const std::string& name,
         JST_ERROR("[CUDA] Can't compile program:\n{}", log.data());
     });
 
-    // Get PTX.
+    // Get the cubin, or the PTX if the architecture is virtual.
 
-    size_t ptxSize;
-    JST_NVRTC_CHECK(nvrtcGetPTXSize(program, &ptxSize), [&]{
-        JST_ERROR("[CUDA] Can't get PTX size: {}", err);
-    });
+    size_t imageSize;
+    if (target.binary) {
+        JST_NVRTC_CHECK(nvrtcGetCUBINSize(program, &imageSize), [&]{
+            JST_ERROR("[CUDA] Can't get CUBIN size: {}", err);
+        });
 
-    std::vector<char> ptx(ptxSize);
-    JST_NVRTC_CHECK(nvrtcGetPTX(program, ptx.data()), [&]{
-        JST_ERROR("[CUDA] Can't get PTX: {}", err);
-    });
+        kernel.image.resize(imageSize);
+        JST_NVRTC_CHECK(nvrtcGetCUBIN(program, kernel.image.data()), [&]{
+            JST_ERROR("[CUDA] Can't get CUBIN: {}", err);
+        });
+    } else {
+        JST_NVRTC_CHECK(nvrtcGetPTXSize(program, &imageSize), [&]{
+            JST_ERROR("[CUDA] Can't get PTX size: {}", err);
+        });
+
+        kernel.image.resize(imageSize);
+        JST_NVRTC_CHECK(nvrtcGetPTX(program, kernel.image.data()), [&]{
+            JST_ERROR("[CUDA] Can't get PTX: {}", err);
+        });
 
-    // Print PTX.
+        // Print PTX.
 
-    JST_TRACE("[CUDA] Generated kernel PTX ({}):\n{}", name, ptx.data());
+        JST_TRACE("[CUDA] Generated kernel PTX ({}):\n{}", name, kernel.image.data());
+    }
 
     // Get lowered name.
 
@@ -188,25 +1106,97 @@ Result CUDA::createKernel(const std::string& name,
     JST_NVRTC_CHECK(nvrtcGetLoweredName(program, name.c_str(), &loweredName), [&]{
         JST_ERROR("[CUDA] Can't get lowered name: {}", err);
     });
-    
+    kernel.loweredName = loweredName;
+
+    // Destroy program.
+
+    JST_NVRTC_CHECK(nvrtcDestroyProgram(&program), [&]{
+        JST_ERROR("[CUDA] Can't destroy program: {}", err);
+    });
+
+    JST_DEBUG("[CUDA] Compiled kernel '{}' for {}.", name, target.name);
+
+    return Result::SUCCESS;
+}
+
+}  // namespace
+
+CUDA::KernelConstant CUDA::Constant(const std::string& name, const U64& value) {
+    return {name, "unsigned long long", jst::fmt::format("{}ULL", value)};
+}
+
+CUDA::KernelConstant CUDA::Constant(const std::string& name, const I64& value) {
+    return {name, "long long", jst::fmt::format("{}LL", value)};
+}
+
+CUDA::KernelConstant CUDA::Constant(const std::string& name, const F32& value) {
+    // Hexadecimal literal to keep every bit of the value.
+    return {name, "float", jst::fmt::format("{:a}f", value)};
+}
+
+CUDA::KernelConstant CUDA::Constant(const std::string& name, const bool& value) {
+    return {name, "bool", value ? "true" : "false"};
+}
+
+Result CUDA::createKernel(const std::string& name, 
+                          const std::string& kernelSource,
+                          const std::vector<KernelHeader>&,
+                          const std::vector<KernelConstant>& constants) {
+    if (pimpl->kernels[pimpl->block_in_context].contains(name)) {
+        JST_ERROR("[CUDA] Kernel with name '{}' already exists.", name);
+    }
+    auto& kernel = pimpl->kernels[pimpl->block_in_context][name];
+
+    // Declare the constants ahead of the source. They're part of the
+    // hashed source, so every specialization gets its own cache entry.
+
+    std::string source;
+    for (const auto& constant : constants) {
+        source += jst::fmt::format("static constexpr {} {} = {};\n", constant.type, constant.name, constant.value);
+    }
+    source += kernelSource;
+
+    // Compile the kernel unless an identical one was compiled before.
+
+    const CompiledKernel* compiled = [&]() -> const CompiledKernel* {
+        std::lock_guard<std::mutex> lock(KernelCacheMutex());
+        auto& cache = KernelCache();
+
+        const auto target = KernelArchitecture();
+        const auto key = jst::fmt::format("{}-{:016x}", target.name, HashKernel(name, source, target));
+
+        if (auto it = cache.find(key); it != cache.end()) {
+            return &it->second;
+        }
+
+        CompiledKernel entry;
+        if (LoadKernel(key, entry) != Result::SUCCESS) {
+            if (CompileKernel(name, source, target, entry) != Result::SUCCESS) {
+                return nullptr;
+            }
+            StoreKernel(key, entry);
+        }
+
+        return &cache.emplace(key, std::move(entry)).first->second;
+    }();
+
+    if (!compiled) {
+        pimpl->kernels[pimpl->block_in_context].erase(name);
+        return Result::ERROR;
+    }
+
     // Create module.
 
-    JST_CUDA_CHECK(cuModuleLoadData(&kernel.module, ptx.data()), [&]{
+    JST_CUDA_CHECK(cuModuleLoadData(&kernel.module, compiled->image.data()), [&]{
         JST_ERROR("[CUDA] Can't load module: {}", err);
     });
 
     // Get function.
 
-    JST_CUDA_CHECK(cuModuleGetFunction(&kernel.function, kernel.module, loweredName), [&]{
+    JST_CUDA_CHECK(cuModuleGetFunction(&kernel.function, kernel.module, compiled->loweredName.c_str()), [&]{
         JST_ERROR("[CUDA] Can't get function: {}", err);
     });
 
-    // Destroy program.
-
-    JST_NVRTC_CHECK(nvrtcDestroyProgram(&program), [&]{
-        JST_ERROR("[CUDA] Can't destroy program: {}", err);
-    });
-
     return Result::SUCCESS;
 }
 
@@ -231,7 +1221,7 @@ Result CUDA::launchKernel(const std::string& name,
     JST_CUDA_CHECK(cuLaunchKernel(kernel.function, 
                                   grid[0], grid[1], grid[2], 
                                   block[0], block[1], block[2],
-                                  0, _stream, arguments, 0), [&]{
+                                  0, _currentStream, arguments, 0), [&]{
         JST_ERROR("[CUDA] Can't launch kernel: {}", err);
     });
 
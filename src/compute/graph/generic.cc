@@ -12,6 +12,56 @@ Result Graph::setExternallyWiredOutput(const U64& output) {
     return Result::SUCCESS;
 }
 
+Result Graph::setTransientOutput(const U64& output, const std::shared_ptr<TensorStorageMetadata>& storage) {
+    transientOutputs[output] = storage;
+    return Result::SUCCESS;
+}
+
+Result Graph::setExternalOutput(const U64& output) {
+    externalOutputs.emplace(output);
+    return Result::SUCCESS;
+}
+
+Result Graph::setMirroredInput(const U64& input, const std::shared_ptr<TensorStorageMetadata>& storage) {
+    mirroredInputs[input] = storage;
+    mirrorsChanged = true;
+    return Result::SUCCESS;
+}
+
+Result Graph::setMirroredOutput(const U64& output, const std::shared_ptr<TensorStorageMetadata>& storage) {
+    mirroredOutputs[output] = storage;
+    mirrorsChanged = true;
+    return Result::SUCCESS;
+}
+
+Result Graph::clearMirrored() {
+    mirroredInputs.clear();
+    mirroredOutputs.clear();
+    mirrorsChanged = true;
+    return Result::SUCCESS;
+}
+
+Result Graph::setWorkerPool(WorkerPool* pool) {
+    workerPool = pool;
+    return Result::SUCCESS;
+}
+
+Result Graph::setDeviceIndex(const I32& index) {
+    _deviceIndex = index;
+    return Result::SUCCESS;
+}
+
+Result Graph::setPipelineStages(const U64& stages) {
+    pipelineStages = stages;
+    return Result::SUCCESS;
+}
+
+bool Graph::hasModule(const std::shared_ptr<Compute>& block) const {
+    return std::ranges::any_of(computeUnits, [&](const ComputeUnit& computeUnit) {
+        return computeUnit.block == block;
+    });
+}
+
 Result Graph::setModule(const std::shared_ptr<Compute>& block, 
                         const std::unordered_set<U64>& inputSet,
                         const std::unordered_set<U64>& outputSet) {
@@ -32,6 +82,37 @@ Result Graph::setModule(const std::shared_ptr<Compute>& block,
     return Result::SUCCESS;
 }
 
+std::vector<std::vector<U64>> Graph::unitDependencies() const {
+    const U64 unitCount = computeUnits.size();
+
+    std::vector<bool> inplace(unitCount, false);
+    for (U64 i = 0; i < unitCount; i++) {
+        const auto& module = std::dynamic_pointer_cast<Module>(computeUnits[i].block);
+        inplace[i] = module && (module->taint() & Taint::IN_PLACE) == Taint::IN_PLACE;
+    }
+
+    const auto intersects = [](const std::unordered_set<U64>& a, const std::unordered_set<U64>& b) {
+        return std::ranges::any_of(a, [&](const U64& hash) { return b.contains(hash); });
+    };
+
+    // The units are already sorted in dependency order.
+
+    std::vector<std::vector<U64>> dependencies(unitCount);
+    for (U64 j = 1; j < unitCount; j++) {
+        for (U64 i = 0; i < j; i++) {
+            const auto& producer = computeUnits[i];
+            const auto& consumer = computeUnits[j];
+
+            if (intersects(producer.outputSet, consumer.inputSet) ||
+                ((inplace[i] || inplace[j]) && intersects(producer.inputSet, consumer.inputSet))) {
+                dependencies[j].push_back(i);
+            }
+        }
+    }
+
+    return dependencies;
+}
+
 void Graph::YieldCompute(std::unordered_set<U64>& yielded, const std::unordered_set<U64>& outputSet) {
     for (const auto& output : outputSet) {
         yielded.emplace(output);
@@ -48,4 +129,25 @@ bool Graph::ShouldYield(std::unordered_set<U64>& yielded, const std::unordered_s
     });
 }
 
+static std::atomic<bool> profilingEnabled{false};
+
+void Graph::SetProfiling(const bool& enabled) {
+    profilingEnabled.store(enabled, std::memory_order_relaxed);
+}
+
+bool Graph::Profiling() {
+    return profilingEnabled.load(std::memory_order_relaxed);
+}
+
+void Graph::RecordLatency(const std::shared_ptr<Compute>& block, const U64& nanoseconds) {
+    if (Profiling()) {
+        block->latency.record(nanoseconds);
+    }
+    Sampler::Record(block->traceName, nanoseconds);
+}
+
+U64 Graph::SuspendHash(const Compute* block) {
+    return std::hash<const Compute*>{}(block) ^ 0x5d1c0a7e3b9f2468;
+}
+
 }  // namespace Jetstream
\ No newline at end of file
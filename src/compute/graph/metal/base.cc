@@ -1,4 +1,8 @@
+#include <mutex>
+#include <unordered_map>
+
 #include "jetstream/compute/graph/metal.hh"
+#include "jetstream/startup.hh"
 
 namespace Jetstream {
 
@@ -33,39 +37,88 @@ Result Metal::computeReady() {
 }
 
 Result Metal::compute(std::unordered_set<U64>& yielded) {
+    // Wait for a free slot if too many frames are in flight.
+    framesInFlight.acquire();
+
     innerPool = NS::AutoreleasePool::alloc()->init();
 
-    _commandBuffer = _commandQueue->commandBuffer();
+    _commandBuffer = _commandQueue->commandBuffer()->retain();
 
+    const bool profiling = Graph::Timing();
+
+    Result res = Result::SUCCESS;
     for (const auto& computeUnit : computeUnits) {
         if (Graph::ShouldYield(yielded, computeUnit.inputSet)) {
             Graph::YieldCompute(yielded, computeUnit.outputSet);
             continue;
         }
 
-        const auto& res = computeUnit.block->compute(*context);
+        res = [&]{
+            JST_TRACE_SPAN(TraceName(computeUnit.block), "unit");
+            return computeUnit.block->compute(*context);
+        }();
 
         if (res == Result::SUCCESS) {
+            if (profiling) {
+                // Commit every unit in its own command buffer to read its GPU time.
+                _commandBuffer->addCompletedHandler([this, block = computeUnit.block](MTL::CommandBuffer* commandBuffer) {
+                    if (commandBuffer->status() == MTL::CommandBufferStatusError) {
+                        commandBufferFailed = true;
+                    } else {
+                        const F64 elapsed = commandBuffer->GPUEndTime() - commandBuffer->GPUStartTime();
+                        RecordLatency(block, static_cast<U64>(elapsed * 1e9));
+                    }
+                    commandBuffer->release();
+                });
+                _commandBuffer->commit();
+                _commandBuffer = _commandQueue->commandBuffer()->retain();
+            }
             continue;
         }
 
         if (res == Result::YIELD) {
             Graph::YieldCompute(yielded, computeUnit.outputSet);
+            res = Result::SUCCESS;
             continue;
         }
 
-        JST_CHECK(res);
+        break;
     }
 
+    // The slot is released by the GPU when the frame finishes.
+    _commandBuffer->addCompletedHandler([this](MTL::CommandBuffer* commandBuffer) {
+        if (commandBuffer->status() == MTL::CommandBufferStatusError) {
+            JST_ERROR("[METAL] Command buffer failed: {}",
+                      commandBuffer->error()->localizedDescription()->utf8String());
+            commandBufferFailed = true;
+        }
+        commandBuffer->release();
+        framesInFlight.release();
+    });
     _commandBuffer->commit();
-    _commandBuffer->waitUntilCompleted();
 
     innerPool->release();
 
+    return res;
+}
+
+Result Metal::synchronize() {
+    // Wait for every frame in flight to finish.
+    for (U64 i = 0; i < MaxFramesInFlight; i++) {
+        framesInFlight.acquire();
+    }
+    framesInFlight.release(MaxFramesInFlight);
+
+    if (commandBufferFailed.exchange(false)) {
+        return Result::ERROR;
+    }
+
     return Result::SUCCESS;
 }
 
 Result Metal::destroy() {
+    JST_CHECK(synchronize());
+
     for (const auto& computeUnit : computeUnits) {
         JST_CHECK(computeUnit.block->destroyCompute(*context));
     }
@@ -76,21 +129,62 @@ Result Metal::destroy() {
     return Result::SUCCESS;
 }
 
+namespace {
+
+// Libraries and pipeline states shared by every graph of the process. Keyed
+// by device and source, plus the function name for the pipeline states.
+// Entries live as long as the process, so reloading a block or rebuilding a
+// graph never compiles the same kernel twice.
+struct KernelCache {
+    std::mutex mutex;
+    std::unordered_map<std::string, MTL::Library*> libraries;
+    std::unordered_map<std::string, MTL::ComputePipelineState*> pipelines;
+};
+
+KernelCache& GetKernelCache() {
+    static KernelCache cache;
+    return cache;
+}
+
+}  // namespace
+
 Result Metal::CompileKernel(const char* shaderSrc,
                             const char* methodName, 
                             MTL::ComputePipelineState** pipelineState) {
     auto device = Backend::State<Device::Metal>()->getDevice();
 
-    MTL::CompileOptions* opts = MTL::CompileOptions::alloc()->init();
-    opts->setFastMathEnabled(true);
-    opts->setLanguageVersion(MTL::LanguageVersion3_0);
+    auto& cache = GetKernelCache();
+    std::lock_guard<std::mutex> lock(cache.mutex);
+
+    const auto libraryKey = jst::fmt::format("{:x}:{}", device->registryID(), shaderSrc);
+    const auto pipelineKey = jst::fmt::format("{}:{}", methodName, libraryKey);
+
+    if (auto it = cache.pipelines.find(pipelineKey); it != cache.pipelines.end()) {
+        *pipelineState = it->second->retain();
+        return Result::SUCCESS;
+    }
+
+    JST_STARTUP_PHASE("Compute Pipeline Creation");
+
+    // Compile the library once for all the functions of a source.
+
+    auto& library = cache.libraries[libraryKey];
 
-    NS::Error* err = nullptr;
-    NS::String* source = NS::String::string(shaderSrc, NS::UTF8StringEncoding);
-    auto library = device->newLibrary(source, opts, &err);
     if (!library) {
-        JST_ERROR("Error while compiling kernel library:\n{}", err->description()->utf8String());
-        return Result::ERROR;
+        MTL::CompileOptions* opts = MTL::CompileOptions::alloc()->init();
+        opts->setFastMathEnabled(true);
+        opts->setLanguageVersion(MTL::LanguageVersion3_0);
+
+        NS::Error* err = nullptr;
+        NS::String* source = NS::String::string(shaderSrc, NS::UTF8StringEncoding);
+        library = device->newLibrary(source, opts, &err);
+        opts->release();
+
+        if (!library) {
+            cache.libraries.erase(libraryKey);
+            JST_ERROR("Error while compiling kernel library:\n{}", err->description()->utf8String());
+            return Result::ERROR;
+        }
     }
 
     auto functionName = NS::String::string(methodName, NS::UTF8StringEncoding);
@@ -100,12 +194,17 @@ Result Metal::CompileKernel(const char* shaderSrc,
         return Result::ERROR;
     }
 
-    if (*pipelineState = device->newComputePipelineState(kernel, MTL::PipelineOptionNone, 
-                                                        nullptr, nullptr); !*pipelineState) {
+    auto pipeline = device->newComputePipelineState(kernel, MTL::PipelineOptionNone, nullptr, nullptr);
+    kernel->release();
+
+    if (!pipeline) {
         JST_ERROR("Error while creating Metal pipeline state.");
         return Result::ERROR;
     }
 
+    cache.pipelines[pipelineKey] = pipeline;
+    *pipelineState = pipeline->retain();
+
     return Result::SUCCESS;
 }
 
@@ -0,0 +1,476 @@
+#include "jetstream/compute/graph/vulkan.hh"
+#include "jetstream/backend/devices/vulkan/helpers.hh"
+#include "jetstream/startup.hh"
+
+#include <array>
+
+namespace Jetstream {
+
+struct Vulkan::Impl {
+    struct Kernel {
+        VkPipeline pipeline;
+        VkPipelineLayout pipelineLayout;
+        VkDescriptorSetLayout descriptorSetLayout;
+        VkDescriptorSet descriptorSet;
+        U64 constantsSize;
+    };
+
+    U64 block_in_context;
+
+    std::unordered_map<U64, std::unordered_map<std::string, Kernel>> kernels;
+
+    VkCommandPool commandPool;
+    VkFence fence;
+    bool pending = false;
+
+    // Timestamps around every unit written while profiling. The pool is
+    // null if the compute queue can't write timestamps.
+    VkQueryPool queryPool = VK_NULL_HANDLE;
+    F32 timestampPeriod = 0.0f;
+    std::vector<bool> timed;
+
+    static void Barrier(VkCommandBuffer& commandBuffer,
+                        const VkPipelineStageFlags& dstStage,
+                        const VkAccessFlags& dstAccess);
+};
+
+Vulkan::Vulkan() {
+    JST_DEBUG("Creating new Vulkan compute graph.");
+    context = std::make_shared<Compute::Context>();
+    context->vulkan = this;
+
+    pimpl = std::make_unique<Impl>();
+}
+
+Vulkan::~Vulkan() {
+    context.reset();
+    pimpl.reset();
+}
+
+Result Vulkan::create() {
+    auto& backend = Backend::State<Device::Vulkan>();
+    auto& device = backend->getDevice();
+
+    // Create command pool. Command pools can't be shared between threads.
+
+    const auto indices = Backend::FindQueueFamilies(backend->getPhysicalDevice());
+
+    VkCommandPoolCreateInfo poolInfo{};
+    poolInfo.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+    poolInfo.flags = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
+    poolInfo.queueFamilyIndex = indices.computeFamily.value();
+
+    JST_VK_CHECK(vkCreateCommandPool(device, &poolInfo, nullptr, &pimpl->commandPool), [&]{
+        JST_ERROR("[VULKAN] Can't create compute command pool.");
+    });
+
+    // Allocate command buffer.
+
+    VkCommandBufferAllocateInfo allocInfo{};
+    allocInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+    allocInfo.commandPool = pimpl->commandPool;
+    allocInfo.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+    allocInfo.commandBufferCount = 1;
+
+    JST_VK_CHECK(vkAllocateCommandBuffers(device, &allocInfo, &_commandBuffer), [&]{
+        JST_ERROR("[VULKAN] Can't allocate compute command buffer.");
+    });
+
+    // Create completion fence.
+
+    VkFenceCreateInfo fenceInfo{};
+    fenceInfo.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+
+    JST_VK_CHECK(vkCreateFence(device, &fenceInfo, nullptr, &pimpl->fence), [&]{
+        JST_ERROR("[VULKAN] Can't create compute fence.");
+    });
+
+    // Create timestamp query pool.
+
+    {
+        VkPhysicalDeviceProperties properties;
+        vkGetPhysicalDeviceProperties(backend->getPhysicalDevice(), &properties);
+
+        U32 queueFamilyCount = 0;
+        vkGetPhysicalDeviceQueueFamilyProperties(backend->getPhysicalDevice(), &queueFamilyCount, nullptr);
+        std::vector<VkQueueFamilyProperties> queueFamilies(queueFamilyCount);
+        vkGetPhysicalDeviceQueueFamilyProperties(backend->getPhysicalDevice(), &queueFamilyCount, queueFamilies.data());
+
+        const bool timestamps = queueFamilies[indices.computeFamily.value()].timestampValidBits > 0 &&
+                                properties.limits.timestampPeriod > 0.0f;
+
+        if (timestamps && !computeUnits.empty()) {
+            VkQueryPoolCreateInfo queryPoolInfo{};
+            queryPoolInfo.sType = VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO;
+            queryPoolInfo.queryType = VK_QUERY_TYPE_TIMESTAMP;
+            queryPoolInfo.queryCount = computeUnits.size() * 2;
+
+            JST_VK_CHECK(vkCreateQueryPool(device, &queryPoolInfo, nullptr, &pimpl->queryPool), [&]{
+                JST_ERROR("[VULKAN] Can't create timestamp query pool.");
+            });
+
+            pimpl->timestampPeriod = properties.limits.timestampPeriod;
+        }
+
+        pimpl->timed.assign(computeUnits.size(), false);
+    }
+
+    // Create blocks.
+
+    for (U64 i = 0; i < computeUnits.size(); i++) {
+        pimpl->block_in_context = i;
+        JST_CHECK(computeUnits[i].block->createCompute(*context));
+    }
+
+    return Result::SUCCESS;
+}
+
+Result Vulkan::computeReady() {
+    for (const auto& computeUnit : computeUnits) {
+        JST_CHECK(computeUnit.block->computeReady());
+    }
+    return Result::SUCCESS;
+}
+
+void Vulkan::Impl::Barrier(VkCommandBuffer& commandBuffer,
+                           const VkPipelineStageFlags& dstStage,
+                           const VkAccessFlags& dstAccess) {
+    VkMemoryBarrier barrier{};
+    barrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+    barrier.srcAccessMask = VK_ACCESS_SHADER_WRITE_BIT | VK_ACCESS_TRANSFER_WRITE_BIT;
+    barrier.dstAccessMask = dstAccess;
+
+    vkCmdPipelineBarrier(commandBuffer,
+                         VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT | VK_PIPELINE_STAGE_TRANSFER_BIT,
+                         dstStage,
+                         0, 1, &barrier, 0, nullptr, 0, nullptr);
+}
+
+Result Vulkan::compute(std::unordered_set<U64>& yielded) {
+    // Previous frame has to finish before recording again.
+
+    JST_CHECK(synchronize());
+
+    JST_VK_CHECK(vkResetCommandBuffer(_commandBuffer, 0), [&]{
+        JST_ERROR("[VULKAN] Can't reset compute command buffer.");
+    });
+
+    VkCommandBufferBeginInfo beginInfo{};
+    beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+    beginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+
+    JST_VK_CHECK(vkBeginCommandBuffer(_commandBuffer, &beginInfo), [&]{
+        JST_ERROR("[VULKAN] Can't begin compute command buffer.");
+    });
+
+    // Record blocks.
+
+    const bool profiling = Graph::Timing() && pimpl->queryPool != VK_NULL_HANDLE;
+
+    if (profiling) {
+        vkCmdResetQueryPool(_commandBuffer, pimpl->queryPool, 0, computeUnits.size() * 2);
+    }
+
+    for (U64 i = 0; i < computeUnits.size(); i++) {
+        const auto& computeUnit = computeUnits[i];
+
+        if (Graph::ShouldYield(yielded, computeUnit.inputSet)) {
+            Graph::YieldCompute(yielded, computeUnit.outputSet);
+            continue;
+        }
+
+        pimpl->block_in_context = i;
+
+        if (profiling) {
+            vkCmdWriteTimestamp(_commandBuffer, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, pimpl->queryPool, i * 2);
+        }
+
+        const auto& res = [&]{
+            JST_TRACE_SPAN(TraceName(computeUnit.block), "unit");
+            return computeUnit.block->compute(*context);
+        }();
+
+        if (res == Result::YIELD) {
+            Graph::YieldCompute(yielded, computeUnit.outputSet);
+            continue;
+        }
+
+        JST_CHECK(res);
+
+        if (profiling) {
+            vkCmdWriteTimestamp(_commandBuffer, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, pimpl->queryPool, i * 2 + 1);
+            pimpl->timed[i] = true;
+        }
+
+        // Make the results visible to the next block.
+        Impl::Barrier(_commandBuffer,
+                      VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT | VK_PIPELINE_STAGE_TRANSFER_BIT,
+                      VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT |
+                      VK_ACCESS_TRANSFER_READ_BIT | VK_ACCESS_TRANSFER_WRITE_BIT);
+    }
+
+    // Make the results visible to the host.
+
+    Impl::Barrier(_commandBuffer, VK_PIPELINE_STAGE_HOST_BIT, VK_ACCESS_HOST_READ_BIT);
+
+    JST_VK_CHECK(vkEndCommandBuffer(_commandBuffer), [&]{
+        JST_ERROR("[VULKAN] Can't end compute command buffer.");
+    });
+
+    // Submit without waiting for completion.
+
+    VkSubmitInfo submitInfo{};
+    submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+    submitInfo.commandBufferCount = 1;
+    submitInfo.pCommandBuffers = &_commandBuffer;
+
+    {
+        std::lock_guard<std::mutex> lock(Backend::QueueMutex());
+        auto& queue = Backend::State<Device::Vulkan>()->getComputeQueue();
+
+        JST_VK_CHECK(vkQueueSubmit(queue, 1, &submitInfo, pimpl->fence), [&]{
+            JST_ERROR("[VULKAN] Can't submit compute command buffer.");
+        });
+    }
+    pimpl->pending = true;
+
+    return Result::SUCCESS;
+}
+
+Result Vulkan::synchronize() {
+    if (!pimpl->pending) {
+        return Result::SUCCESS;
+    }
+    pimpl->pending = false;
+
+    auto& device = Backend::State<Device::Vulkan>()->getDevice();
+
+    JST_VK_CHECK(vkWaitForFences(device, 1, &pimpl->fence, true, UINT64_MAX), [&]{
+        JST_ERROR("[VULKAN] Can't wait for compute fence.");
+    });
+
+    JST_VK_CHECK(vkResetFences(device, 1, &pimpl->fence), [&]{
+        JST_ERROR("[VULKAN] Can't reset compute fence.");
+    });
+
+    // Collect the device time of the units timed by the last frame.
+
+    for (U64 i = 0; i < pimpl->timed.size(); i++) {
+        if (!pimpl->timed[i]) {
+            continue;
+        }
+        pimpl->timed[i] = false;
+
+        std::array<U64, 2> timestamps;
+        JST_VK_CHECK(vkGetQueryPoolResults(device, pimpl->queryPool, i * 2, 2, sizeof(timestamps),
+                                           timestamps.data(), sizeof(U64), VK_QUERY_RESULT_64_BIT), [&]{
+            JST_ERROR("[VULKAN] Can't read timestamp queries.");
+        });
+
+        const F64 ticks = static_cast<F64>(timestamps[1] - timestamps[0]);
+        RecordLatency(computeUnits[i].block, static_cast<U64>(ticks * pimpl->timestampPeriod));
+    }
+
+    return Result::SUCCESS;
+}
+
+Result Vulkan::destroy() {
+    // Wait for pending work.
+
+    JST_CHECK(synchronize());
+
+    // Destroy blocks.
+
+    for (U64 i = 0; i < computeUnits.size(); i++) {
+        pimpl->block_in_context = i;
+        JST_CHECK(computeUnits[i].block->destroyCompute(*context));
+    }
+
+    // Destroy kernels.
+
+    for (U64 i = 0; i < computeUnits.size(); i++) {
+        pimpl->block_in_context = i;
+
+        std::vector<std::string> kernel_names;
+        for (const auto& [name, _] : pimpl->kernels[i]) {
+            kernel_names.push_back(name);
+        }
+        for (const auto& name : kernel_names) {
+            JST_CHECK(destroyKernel(name));
+        }
+    }
+    computeUnits.clear();
+    pimpl->kernels.clear();
+
+    // Destroy command buffer.
+
+    auto& device = Backend::State<Device::Vulkan>()->getDevice();
+
+    vkFreeCommandBuffers(device, pimpl->commandPool, 1, &_commandBuffer);
+    vkDestroyCommandPool(device, pimpl->commandPool, nullptr);
+    vkDestroyFence(device, pimpl->fence, nullptr);
+    if (pimpl->queryPool != VK_NULL_HANDLE) {
+        vkDestroyQueryPool(device, pimpl->queryPool, nullptr);
+        pimpl->queryPool = VK_NULL_HANDLE;
+    }
+
+    return Result::SUCCESS;
+}
+
+Result Vulkan::createKernel(const std::string& name,
+                            const std::vector<U8>& kernel,
+                            const std::vector<VkBuffer>& buffers,
+                            const U64& constantsSize) {
+    JST_STARTUP_PHASE("Compute Pipeline Creation");
+
+    if (pimpl->kernels[pimpl->block_in_context].contains(name)) {
+        JST_ERROR("[VULKAN] Kernel with name '{}' already exists.", name);
+        return Result::ERROR;
+    }
+    auto& state = pimpl->kernels[pimpl->block_in_context][name];
+    state.constantsSize = constantsSize;
+
+    auto& backend = Backend::State<Device::Vulkan>();
+    auto& device = backend->getDevice();
+
+    // Load kernel.
+
+    VkShaderModule kernelModule = Backend::LoadShader(kernel, device);
+
+    VkPipelineShaderStageCreateInfo kernelStageInfo{};
+    kernelStageInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+    kernelStageInfo.stage = VK_SHADER_STAGE_COMPUTE_BIT;
+    kernelStageInfo.module = kernelModule;
+    kernelStageInfo.pName = "main";
+
+    // Create descriptor set layout. Every buffer is a storage buffer.
+
+    std::vector<VkDescriptorSetLayoutBinding> bindings;
+    for (U64 i = 0; i < buffers.size(); i++) {
+        VkDescriptorSetLayoutBinding binding{};
+        binding.binding = i;
+        binding.descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+        binding.descriptorCount = 1;
+        binding.stageFlags = VK_SHADER_STAGE_COMPUTE_BIT;
+
+        bindings.push_back(binding);
+    }
+
+    VkDescriptorSetLayoutCreateInfo layoutInfo{};
+    layoutInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
+    layoutInfo.bindingCount = static_cast<U32>(bindings.size());
+    layoutInfo.pBindings = bindings.data();
+
+    JST_VK_CHECK(vkCreateDescriptorSetLayout(device, &layoutInfo, nullptr, &state.descriptorSetLayout), [&]{
+        JST_ERROR("[VULKAN] Failed to create descriptor set layout.");
+    });
+
+    // Allocate and update descriptor set.
+
+    VkDescriptorSetAllocateInfo allocInfo{};
+    allocInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
+    allocInfo.descriptorPool = backend->getDescriptorPool();
+    allocInfo.descriptorSetCount = 1;
+    allocInfo.pSetLayouts = &state.descriptorSetLayout;
+
+    JST_VK_CHECK(vkAllocateDescriptorSets(device, &allocInfo, &state.descriptorSet), [&]{
+        JST_ERROR("[VULKAN] Failed to allocate descriptor set.");
+    });
+
+    for (U64 i = 0; i < buffers.size(); i++) {
+        VkDescriptorBufferInfo bufferInfo{};
+        bufferInfo.buffer = buffers[i];
+        bufferInfo.offset = 0;
+        bufferInfo.range = VK_WHOLE_SIZE;
+
+        VkWriteDescriptorSet descriptorWriteBuffer{};
+        descriptorWriteBuffer.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+        descriptorWriteBuffer.dstSet = state.descriptorSet;
+        descriptorWriteBuffer.dstBinding = i;
+        descriptorWriteBuffer.dstArrayElement = 0;
+        descriptorWriteBuffer.descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+        descriptorWriteBuffer.descriptorCount = 1;
+        descriptorWriteBuffer.pBufferInfo = &bufferInfo;
+
+        vkUpdateDescriptorSets(device, 1, &descriptorWriteBuffer, 0, nullptr);
+    }
+
+    // Create pipeline layout. Constants are passed as push constants.
+
+    VkPushConstantRange constantsRange{};
+    constantsRange.stageFlags = VK_SHADER_STAGE_COMPUTE_BIT;
+    constantsRange.offset = 0;
+    constantsRange.size = static_cast<U32>(constantsSize);
+
+    VkPipelineLayoutCreateInfo pipelineLayoutInfo{};
+    pipelineLayoutInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
+    pipelineLayoutInfo.setLayoutCount = 1;
+    pipelineLayoutInfo.pSetLayouts = &state.descriptorSetLayout;
+    if (constantsSize > 0) {
+        pipelineLayoutInfo.pushConstantRangeCount = 1;
+        pipelineLayoutInfo.pPushConstantRanges = &constantsRange;
+    }
+
+    JST_VK_CHECK(vkCreatePipelineLayout(device, &pipelineLayoutInfo, nullptr, &state.pipelineLayout), [&]{
+        JST_ERROR("[VULKAN] Failed to create pipeline layout.");
+    });
+
+    // Create compute pipeline.
+
+    VkComputePipelineCreateInfo pipelineInfo{};
+    pipelineInfo.sType = VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO;
+    pipelineInfo.layout = state.pipelineLayout;
+    pipelineInfo.stage = kernelStageInfo;
+
+    JST_VK_CHECK(vkCreateComputePipelines(device, backend->getPipelineCache(), 1, &pipelineInfo, nullptr, &state.pipeline), [&]{
+        JST_ERROR("[VULKAN] Failed to create compute pipeline.");
+    });
+
+    // Clean up.
+
+    vkDestroyShaderModule(device, kernelModule, nullptr);
+
+    return Result::SUCCESS;
+}
+
+Result Vulkan::dispatchKernel(const std::string& name,
+                              const std::vector<U64>& grid,
+                              const void* constants) {
+    const auto& state = pimpl->kernels.at(pimpl->block_in_context).at(name);
+
+    vkCmdBindPipeline(_commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, state.pipeline);
+    vkCmdBindDescriptorSets(_commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, state.pipelineLayout,
+                            0, 1, &state.descriptorSet, 0, nullptr);
+
+    if (state.constantsSize > 0) {
+        if (!constants) {
+            JST_ERROR("[VULKAN] Kernel '{}' expects constants.", name);
+            return Result::ERROR;
+        }
+
+        vkCmdPushConstants(_commandBuffer, state.pipelineLayout, VK_SHADER_STAGE_COMPUTE_BIT,
+                           0, static_cast<U32>(state.constantsSize), constants);
+    }
+
+    vkCmdDispatch(_commandBuffer, grid[0], grid[1], grid[2]);
+
+    return Result::SUCCESS;
+}
+
+Result Vulkan::destroyKernel(const std::string& name) {
+    auto& device = Backend::State<Device::Vulkan>()->getDevice();
+    auto& descriptorPool = Backend::State<Device::Vulkan>()->getDescriptorPool();
+
+    auto& state = pimpl->kernels[pimpl->block_in_context][name];
+
+    vkFreeDescriptorSets(device, descriptorPool, 1, &state.descriptorSet);
+    vkDestroyDescriptorSetLayout(device, state.descriptorSetLayout, nullptr);
+    vkDestroyPipelineLayout(device, state.pipelineLayout, nullptr);
+    vkDestroyPipeline(device, state.pipeline, nullptr);
+
+    pimpl->kernels[pimpl->block_in_context].erase(name);
+
+    return Result::SUCCESS;
+}
+
+}  // namespace Jetstream
@@ -0,0 +1,104 @@
+#include <bit>
+#include <cmath>
+
+#include "jetstream/compute/latency.hh"
+
+namespace Jetstream {
+
+void LatencyHistogram::record(const U64& nanoseconds) {
+    // Two buckets per power of two. The second half of an octave starts at 1.5x.
+    const U64 octave = std::bit_width(std::max<U64>(nanoseconds, 1)) - 1;
+    const U64 half = (octave > 0) ? (nanoseconds >> (octave - 1)) & 1 : 0;
+    const U64 index = std::min(octave * 2 + half, BucketCount - 1);
+
+    buckets[index].fetch_add(1, std::memory_order_relaxed);
+    total.fetch_add(nanoseconds, std::memory_order_relaxed);
+    last.store(nanoseconds, std::memory_order_relaxed);
+    count.fetch_add(1, std::memory_order_relaxed);
+}
+
+void LatencyHistogram::reset() {
+    for (auto& bucket : buckets) {
+        bucket.store(0, std::memory_order_relaxed);
+    }
+    total.store(0, std::memory_order_relaxed);
+    last.store(0, std::memory_order_relaxed);
+    count.store(0, std::memory_order_relaxed);
+}
+
+LatencyHistogram::Summary LatencyHistogram::summary() const {
+    return Summarize(snapshot());
+}
+
+LatencyHistogram::Snapshot LatencyHistogram::snapshot() const {
+    Snapshot snapshot;
+
+    for (U64 i = 0; i < BucketCount; i++) {
+        snapshot.buckets[i] = buckets[i].load(std::memory_order_relaxed);
+    }
+    snapshot.count = count.load(std::memory_order_relaxed);
+    snapshot.total = total.load(std::memory_order_relaxed);
+    snapshot.last = last.load(std::memory_order_relaxed);
+
+    return snapshot;
+}
+
+LatencyHistogram::Summary LatencyHistogram::Summarize(const Snapshot& current) {
+    return Summarize(current, Snapshot{});
+}
+
+LatencyHistogram::Summary LatencyHistogram::Summarize(const Snapshot& current, const Snapshot& previous) {
+    Summary summary;
+
+    // A reset in between makes the counters go backwards, the current ones are used alone.
+    const bool reset = current.count < previous.count || current.total < previous.total;
+
+    std::array<U64, BucketCount> window;
+    U64 windowCount = 0;
+    for (U64 i = 0; i < BucketCount; i++) {
+        window[i] = (reset || current.buckets[i] < previous.buckets[i]) ? current.buckets[i] :
+                                                                          current.buckets[i] - previous.buckets[i];
+        windowCount += window[i];
+    }
+
+    if (windowCount == 0) {
+        return summary;
+    }
+
+    constexpr F32 NanosecondsPerMillisecond = 1e6f;
+
+    // Geometric center of a bucket. Even buckets start at 2^n and odd ones at 1.5 * 2^n.
+    const auto center = [](const U64& index) {
+        const F32 lower = std::ldexp((index % 2) ? 1.5f : 1.0f, static_cast<int>(index / 2));
+        const F32 upper = std::ldexp((index % 2) ? 1.0f : 1.5f, static_cast<int>(index / 2 + (index % 2)));
+        return std::sqrt(lower * upper) / NanosecondsPerMillisecond;
+    };
+
+    const auto percentile = [&](const F32& p) {
+        const U64 rank = static_cast<U64>(std::ceil(p * static_cast<F32>(windowCount)));
+        U64 accumulated = 0;
+        for (U64 i = 0; i < BucketCount; i++) {
+            accumulated += window[i];
+            if (accumulated >= rank) {
+                return center(i);
+            }
+        }
+        return center(BucketCount - 1);
+    };
+
+    const U64 count = reset ? current.count : current.count - previous.count;
+    const U64 total = reset ? current.total : current.total - previous.total;
+
+    summary.count = windowCount;
+    summary.last = static_cast<F32>(current.last) / NanosecondsPerMillisecond;
+    summary.mean = static_cast<F32>(total) /
+                   static_cast<F32>(std::max<U64>(count, 1)) /
+                   NanosecondsPerMillisecond;
+    summary.p50 = percentile(0.50f);
+    summary.p90 = percentile(0.90f);
+    summary.p99 = percentile(0.99f);
+
+    return summary;
+}
+
+}  // namespace Jetstream
@@ -0,0 +1,246 @@
+#include <mutex>
+#include <thread>
+#include <chrono>
+#include <memory>
+#include <fstream>
+#include <algorithm>
+#include <filesystem>
+
+#include "jetstream/compute/sampler.hh"
+#include "jetstream/logger.hh"
+
+namespace Jetstream {
+
+namespace {
+
+// Minimum time between automatic dumps.
+constexpr U64 DumpIntervalNanoseconds = 10'000'000'000;
+
+// Slots are guarded by a sequence number, odd while being written.
+// Cycle durations have no name.
+struct Entry {
+    std::atomic<U64> sequence{0};
+    const char* name;
+    U64 cycle;
+    U64 time;
+    U64 duration;
+};
+
+struct State {
+    std::atomic<bool> enabled{false};
+    std::atomic<bool> sampling{false};
+    std::atomic<U64> cycle{0};
+    std::atomic<U64> interval{1};
+    std::atomic<U64> threshold{0};
+    std::atomic<U64> head{0};
+    std::unique_ptr<Entry[]> entries;
+    U64 capacity = 0;
+
+    std::atomic<bool> dumping{false};
+    U64 lastDump = 0;
+    std::thread dumper;
+
+    const std::chrono::steady_clock::time_point epoch = std::chrono::steady_clock::now();
+
+    std::mutex mutex;
+    Sampler::Config config;
+
+    ~State() {
+        if (dumper.joinable()) {
+            dumper.join();
+        }
+    }
+};
+
+State& GetState() {
+    static State state;
+    return state;
+}
+
+U64 Now() {
+    const auto elapsed = std::chrono::steady_clock::now() - GetState().epoch;
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count();
+}
+
+void Write(const char* name, const U64& duration) {
+    auto& state = GetState();
+
+    const U64 index = state.head.fetch_add(1, std::memory_order_relaxed);
+    auto& entry = state.entries[index % state.capacity];
+
+    entry.sequence.store(index * 2 + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    entry.name = name;
+    entry.cycle = state.cycle.load(std::memory_order_relaxed);
+    entry.time = Now();
+    entry.duration = duration;
+
+    entry.sequence.store(index * 2 + 2, std::memory_order_release);
+}
+
+}  // namespace
+
+void Sampler::Enable(const Config& config) {
+    auto& state = GetState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+
+    if (state.enabled.load()) {
+        return;
+    }
+
+    // The ring is never freed, writers racing a disable can still use it.
+    if (!state.entries) {
+        state.capacity = std::max<U64>(config.capacity, 1);
+        state.entries = std::make_unique<Entry[]>(state.capacity);
+    }
+
+    for (U64 i = 0; i < state.capacity; i++) {
+        state.entries[i].sequence.store(0, std::memory_order_relaxed);
+    }
+    state.head.store(0, std::memory_order_relaxed);
+
+    state.config = config;
+    state.interval.store(std::max<U64>(config.interval, 1), std::memory_order_relaxed);
+    state.threshold.store(static_cast<U64>(std::max(config.threshold, 0.0f) * 1e6f), std::memory_order_relaxed);
+
+    state.enabled.store(true, std::memory_order_release);
+
+    JST_INFO("[SAMPLER] Sampling one cycle out of {}.", state.interval.load());
+}
+
+void Sampler::Disable() {
+    auto& state = GetState();
+    state.enabled.store(false, std::memory_order_release);
+    state.sampling.store(false, std::memory_order_relaxed);
+}
+
+bool Sampler::Enabled() {
+    return GetState().enabled.load(std::memory_order_acquire);
+}
+
+Sampler::Config Sampler::GetConfig() {
+    auto& state = GetState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    return state.config;
+}
+
+void Sampler::BeginCycle() {
+    auto& state = GetState();
+
+    if (!state.enabled.load(std::memory_order_acquire)) {
+        return;
+    }
+
+    const U64 cycle = state.cycle.fetch_add(1, std::memory_order_relaxed) + 1;
+    state.sampling.store((cycle % state.interval.load(std::memory_order_relaxed)) == 0, std::memory_order_relaxed);
+}
+
+void Sampler::EndCycle(const U64& nanoseconds) {
+    auto& state = GetState();
+
+    if (!state.enabled.load(std::memory_order_acquire)) {
+        return;
+    }
+
+    const U64 threshold = state.threshold.load(std::memory_order_relaxed);
+    const bool slow = threshold > 0 && nanoseconds > threshold;
+
+    if (state.sampling.exchange(false, std::memory_order_relaxed) || slow) {
+        Write(nullptr, nanoseconds);
+    }
+
+    if (!slow) {
+        return;
+    }
+
+    // Dump the ring in the background, at most once per interval.
+
+    const U64 now = Now();
+    if ((state.lastDump != 0 && now - state.lastDump < DumpIntervalNanoseconds) ||
+        state.dumping.load(std::memory_order_acquire)) {
+        return;
+    }
+    state.lastDump = now;
+
+    if (state.dumper.joinable()) {
+        state.dumper.join();
+    }
+
+    const auto timestamp = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+    const auto path = (std::filesystem::path(GetConfig().folder) /
+                       jst::fmt::format("samples-{}.csv", timestamp)).string();
+
+    JST_WARN("[SAMPLER] Cycle took {:.2f} ms, dumping samples to '{}'.", nanoseconds / 1e6, path);
+
+    state.dumping.store(true, std::memory_order_release);
+    state.dumper = std::thread([path]{
+        Dump(path);
+        GetState().dumping.store(false, std::memory_order_release);
+    });
+}
+
+bool Sampler::Sampling() {
+    return GetState().sampling.load(std::memory_order_relaxed);
+}
+
+void Sampler::Record(const char* name, const U64& nanoseconds) {
+    if (!GetState().enabled.load(std::memory_order_acquire)) {
+        return;
+    }
+
+    Write(name, nanoseconds);
+}
+
+Result Sampler::Dump(const std::string& path) {
+    auto& state = GetState();
+
+    std::ofstream file(path, std::ios::trunc);
+    if (!file.is_open()) {
+        JST_ERROR("[SAMPLER] Can't open samples file '{}'.", path);
+        return Result::ERROR;
+    }
+
+    file << "cycle,time_ms,kind,name,duration_ms\n";
+
+    // Skip slots being written or overwritten while copied.
+    U64 count = 0;
+    const U64 head = state.head.load(std::memory_order_acquire);
+    const U64 firstIndex = (head > state.capacity) ? head - state.capacity : 0;
+    for (U64 index = firstIndex; index < head && state.entries; index++) {
+        const auto& entry = state.entries[index % state.capacity];
+
+        if (entry.sequence.load(std::memory_order_acquire) != index * 2 + 2) {
+            continue;
+        }
+        const char* name = entry.name;
+        const U64 cycle = entry.cycle;
+        const U64 time = entry.time;
+        const U64 duration = entry.duration;
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (entry.sequence.load(std::memory_order_relaxed) != index * 2 + 2) {
+            continue;
+        }
+
+        file << jst::fmt::format("{},{:.3f},{},{},{:.3f}\n", cycle,
+                                                           static_cast<F64>(time) / 1e6,
+                                                           (name) ? "module" : "cycle",
+                                                           (name) ? name : "",
+                                                           static_cast<F64>(duration) / 1e6);
+        count++;
+    }
+
+    file.close();
+
+    if (!file) {
+        JST_ERROR("[SAMPLER] Can't write samples file '{}'.", path);
+        return Result::ERROR;
+    }
+
+    JST_INFO("[SAMPLER] Wrote {} samples to '{}'.", count, path);
+
+    return Result::SUCCESS;
+}
+
+}  // namespace Jetstream
@@ -1,6 +1,10 @@
 #include <ranges>
+#include <limits>
+#include <numeric>
+#include <cstring>
 
 #include "jetstream/compute/scheduler.hh"
+#include "jetstream/startup.hh"
 
 namespace Jetstream {
 
@@ -15,17 +19,100 @@ namespace Jetstream {
 //    - Wired: When a Vector is connected within or externally the graph.
 // 8. Calculate and assign Externally Wired Vectors to Graph.
 //    - Externally Wired: When a Vector is connected with another graph.
-// 9. Assert that an In-Place Module is not sharing a branched input Vector.
+// 9. Order modules reading a branched Vector before the In-Place Module modifying it.
+//    - Modules that only alias their input (views) share the memory without copies.
+//    - Branches that can't be ordered still require an explicit copy (Duplicate).
+// 10. Compute CPU modules duplicated with the same configuration and inputs once.
+//    - Duplicates only feeding other duplicates are dropped.
+//    - Duplicates still read copy the outputs of their original.
 
-// TODO: Automatically add copy module if in-place check fails.
 // TODO: Redo PHash logic with locale.
 
+// Stands in for a duplicated module, copying the outputs of its original.
+class Scheduler::SharedCompute : public Module, public Compute {
+ public:
+    struct Copy {
+        const void* src;
+        void* dst;
+        U64 size;
+
+        bool operator==(const Copy&) const = default;
+    };
+
+    SharedCompute(const std::shared_ptr<Compute>& original,
+                  const std::shared_ptr<Compute>& duplicate,
+                  std::vector<Copy>&& copies)
+         : original(original),
+           duplicate(duplicate),
+           copies(std::move(copies)) {}
+
+    bool matches(const std::shared_ptr<Compute>& original,
+                 const std::shared_ptr<Compute>& duplicate,
+                 const std::vector<Copy>& copies) const {
+        return this->original == original &&
+               this->duplicate == duplicate &&
+               this->copies == copies;
+    }
+
+    // In-place duplicates still write over their input memory.
+    Taint taint() const final {
+        const auto& module = std::dynamic_pointer_cast<Module>(duplicate);
+        return (module) ? module->taint() : Taint::CLEAN;
+    }
+
+    void info() const final {}
+
+    constexpr Device device() const final {
+        return Device::CPU;
+    }
+
+ protected:
+    Result compute(const Context&) final {
+        for (const auto& copy : copies) {
+            std::memcpy(copy.dst, copy.src, copy.size);
+        }
+        return Result::SUCCESS;
+    }
+
+ private:
+    std::shared_ptr<Compute> original;
+    std::shared_ptr<Compute> duplicate;
+    std::vector<Copy> copies;
+};
+
 Scheduler::Scheduler() {
     JST_DEBUG("[SCHEDULER] Initializing compute graph.");
 
     yielded.reserve(64);
 }
 
+Result Scheduler::configure(const Config& config) {
+    JST_DEBUG("[SCHEDULER] Configuring scheduler with {} compute thread(s), {} graph thread(s), and {} present.",
+              config.computeThreads, config.graphThreads, (config.decoupledPresent) ? "decoupled" : "locked");
+
+    JST_CHECK(lockState([&]{
+        this->config = config;
+
+        setProfiling(config.profileModules);
+
+        // Restart worker pools with the new size.
+        JST_CHECK(pool.stop());
+        JST_CHECK(graphPool.stop());
+
+        if (config.computeThreads != 1) {
+            JST_CHECK(pool.start(config.computeThreads));
+        }
+
+        if (config.graphThreads != 1) {
+            JST_CHECK(graphPool.start(config.graphThreads));
+        }
+
+        return Result::SUCCESS;
+    }));
+
+    return Result::SUCCESS;
+}
+
 Result Scheduler::addModule(const Locale& locale,
                             const std::shared_ptr<Module>& module,
                             const Parser::RecordMap& inputMap,
@@ -86,11 +173,6 @@ Result Scheduler::addModule(const Locale& locale,
     JST_DEBUG("----------------------------------------------------------------------------------------------------------------------");
 
     JST_CHECK(lockState([&]{
-        // Destroy compute logic from modules.
-        for (const auto& graph : graphs) {
-            JST_CHECK(graph->destroy());
-        }
-
         // Add module to present and/or compute.
         if (present) {
             presentModuleStates[locale.shash()].module = present;
@@ -98,24 +180,18 @@ Result Scheduler::addModule(const Locale& locale,
             presentModuleStates[locale.shash()].outputMap = outputMap;
         }
         if (compute) {
+            compute->setComputeSignal(&signal);
+            compute->setTraceName(Tracer::Intern(jst::fmt::format("{}", locale)));
+            computeModuleStates[locale.shash()].locale = locale;
             computeModuleStates[locale.shash()].module = compute;
             computeModuleStates[locale.shash()].device = module->device();
+            computeModuleStates[locale.shash()].deviceIndex = module->deviceIndex();
             computeModuleStates[locale.shash()].inputMap = inputMap;
             computeModuleStates[locale.shash()].outputMap = outputMap;
         }
 
         // Process modules into graph.
-        JST_CHECK(removeInactive());
-        JST_CHECK(arrangeDependencyOrder());
-        JST_CHECK(checkSequenceValidity());
-        JST_CHECK(createExecutionGraphs());
-
-        // Initialize graphs.
-        for (const auto& graph : graphs) {
-            JST_CHECK(graph->create());
-        }
-
-        return Result::SUCCESS;
+        return updateExecutionGraphs();
     }));
 
     return Result::SUCCESS;
@@ -130,36 +206,89 @@ Result Scheduler::removeModule(const Locale& locale) {
     }
 
     JST_CHECK(lockState([&]{
-        // Destroy compute logic from modules.
-        for (const auto& graph : graphs) {
-            JST_CHECK(graph->destroy());
-        }
-
         // Remove module from present and/or compute.
         if (presentModuleStates.contains(locale.shash())) {
             presentModuleStates.erase(locale.shash());
         }
         if (computeModuleStates.contains(locale.shash())) {
-            computeModuleStates.erase(locale.shash());
+            const auto module = computeModuleStates.extract(locale.shash()).mapped().module;
+
+            // The module is destroyed right after being removed. Inside a transaction,
+            // the graphs running it have to be destroyed now instead of at commit.
+            if (transactionDepth > 0) {
+                JST_CHECK(synchronizeGraphs());
+
+                for (U64 i = 0; i < graphs.size();) {
+                    if (!graphs[i]->hasModule(module)) {
+                        i++;
+                        continue;
+                    }
+
+                    JST_CHECK(graphs[i]->destroy());
+                    graphs.erase(graphs.begin() + i);
+                    graphSignatures.erase(graphSignatures.begin() + i);
+                }
+
+                clusterGraphs.clear();
+                clusterYielded.clear();
+                clusterInFlight.clear();
+                clusterPriority.clear();
+                clusterOrder.clear();
+                deadlineModules.clear();
+            }
         }
 
         // Process modules into graph.
-        JST_CHECK(removeInactive());
-        JST_CHECK(arrangeDependencyOrder());
-        JST_CHECK(checkSequenceValidity());
-        JST_CHECK(createExecutionGraphs());
+        return updateExecutionGraphs();
+    }));
 
-        // Initialize graphs.
-        for (const auto& graph : graphs) {
-            JST_CHECK(graph->create());
-        }
+    return Result::SUCCESS;
+}
 
+Result Scheduler::beginTransaction() {
+    // Nested transactions from the same thread are merged into the outermost one.
+    if (transactionDepth > 0 && transactionOwner == std::this_thread::get_id()) {
+        transactionDepth += 1;
         return Result::SUCCESS;
-    }));
+    }
+
+    acquireState();
+
+    JST_DEBUG("[SCHEDULER] Beginning transaction.");
+
+    transactionOwner = std::this_thread::get_id();
+    transactionDepth = 1;
+    transactionDirty = false;
 
     return Result::SUCCESS;
 }
 
+Result Scheduler::commitTransaction() {
+    if (transactionDepth == 0 || transactionOwner != std::this_thread::get_id()) {
+        JST_ERROR("[SCHEDULER] No transaction to commit.");
+        return Result::ERROR;
+    }
+
+    if (--transactionDepth > 0) {
+        return Result::SUCCESS;
+    }
+
+    JST_DEBUG("[SCHEDULER] Committing transaction.");
+
+    // Process all changes into graph at once.
+    Result res = Result::SUCCESS;
+    if (transactionDirty) {
+        res = updateExecutionGraphs();
+    }
+
+    transactionOwner = {};
+    transactionDirty = false;
+
+    releaseState();
+
+    return res;
+}
+
 Result Scheduler::destroy() {
     JST_DEBUG("[SCHEDULER] Destroying compute graph.");
 
@@ -167,6 +296,9 @@ Result Scheduler::destroy() {
         // Stop execution.
         running = false;
 
+        // Wait for device work in flight.
+        JST_CHECK(synchronizeGraphs());
+
         // Destroy compute logic from modules.
         for (const auto& graph : graphs) {
             JST_CHECK(graph->destroy());
@@ -180,6 +312,21 @@ Result Scheduler::destroy() {
         executionOrder.clear();
         deviceExecutionOrder.clear();
         graphs.clear();
+        graphSignatures.clear();
+        graphTraceNames.clear();
+        clusterGraphs.clear();
+        clusterYielded.clear();
+        clusterInFlight.clear();
+        clusterPriority.clear();
+        clusterOrder.clear();
+        deadlineModules.clear();
+
+        {
+            std::lock_guard<std::mutex> lock(statisticsMutex);
+            graphStatistics.clear();
+            graphLatencies.clear();
+            statisticsModules.clear();
+        }
 
         return Result::SUCCESS;
     }));
@@ -188,9 +335,14 @@ Result Scheduler::destroy() {
 }
 
 Result Scheduler::compute() {
-    // Return early if the compute pipeline is empty.
+    JST_TRACE_SPAN("Scheduler::compute", "scheduler");
+
+    // Read the epoch before checking the state to not miss a notification.
+    U64 epoch = signal.epoch();
+
+    // Wait for new modules if the compute pipeline is empty.
     if (graphs.empty()) {
-        std::this_thread::sleep_for(std::chrono::milliseconds(200));
+        signal.wait(epoch, std::chrono::milliseconds(200));
         return Result::SUCCESS;
     }
 
@@ -205,48 +357,155 @@ Result Scheduler::compute() {
 
     yielded.clear();
 
-    // The state cannot change while we are waiting for
-    // a module to finish computing. This is a workaround
-    // blocking the state from changing while we are waiting.
-    // TODO: Replace with something else can can cancel the wait.
+    // The state cannot change while we are waiting for the sources
+    // to become ready. The wait is interrupted by a state change.
     {
         computeWait.test_and_set();
 
-        wait:
-        for (const auto& graph : graphs) {
-            const auto& res = graph->computeReady();
-            if (res == Result::TIMEOUT) {
-                // Yes, I used a goto. Sue me.
-                goto wait;
+        const Result ready = [&]{
+            JST_TRACE_SPAN("Scheduler::computeReady", "scheduler");
+
+            while (true) {
+                Result res = Result::SUCCESS;
+                for (const auto& graph : graphs) {
+                    if ((res = graph->computeReady()) != Result::SUCCESS) {
+                        break;
+                    }
+                }
+
+                if (res != Result::TIMEOUT || computeHalt.test()) {
+                    return res;
+                }
+
+                // Block until a source has new data.
+                signal.wait(epoch, std::chrono::milliseconds(100));
+                epoch = signal.epoch();
             }
-            JST_CHECK(res);
-        }
+        }();
 
         computeWait.clear();
         computeWait.notify_all();
+
+        if (ready == Result::TIMEOUT) {
+            return Result::SUCCESS;
+        }
+        JST_CHECK(ready);
+    }
+
+    // Skip sub-graphs with a lower priority than a module about to miss its deadline.
+    U64 urgentPriority = 0;
+    for (const auto& [priority, module] : deadlineModules) {
+        if (priority > urgentPriority && module->computeUrgent()) {
+            urgentPriority = priority;
+        }
+    }
+    const auto skipCluster = [&](const U64& i) {
+        if (clusterPriority[i] < urgentPriority) {
+            JST_TRACE("[SCHEDULER] Skipping sub-graph {} to meet a deadline.", i);
+            return true;
+        }
+        return false;
+    };
+
+    // Skip display sub-graphs already computed for the next frames or without a visible view.
+    const U64 presentCycle = presentCycles.load();
+    const U64 divisor = displayDivisor.load(std::memory_order_relaxed);
+    bool paced = false;
+    const auto paceCluster = [&](const U64& i) {
+        if (!config.paceDisplayGraphs || !clusterDisplayOnly[i]) {
+            return false;
+        }
+        const auto& presents = clusterPresents[i];
+        const bool computed = clusterPresentCycle[i] != std::numeric_limits<U64>::max() &&
+                              presentCycle - clusterPresentCycle[i] < divisor;
+        if (computed ||
+            std::none_of(presents.begin(), presents.end(), [](const auto& p) { return p->presentVisible(); })) {
+            paced = true;
+            return true;
+        }
+        clusterPresentCycle[i] = presentCycle;
+        return false;
+    };
+
+    std::vector<U64> activeClusters;
+    for (const auto& i : clusterOrder) {
+        if (!skipCluster(i) && !paceCluster(i)) {
+            activeClusters.push_back(i);
+        }
+    }
+
+    // Wait for the next frame if every sub-graph is paced.
+    if (activeClusters.empty() && paced) {
+        signal.wait(epoch, std::chrono::milliseconds(100));
+        return Result::SUCCESS;
     }
 
+    // Modules only feeding hidden or throttled views yield without computing.
+    updateSuspended();
+    const auto seedSuspended = [&](std::unordered_set<U64>& yieldedSet) {
+        yieldedSet.insert(suspendedHashes.begin(), suspendedHashes.end());
+    };
+
+    Sampler::BeginCycle();
+    const auto cycleStart = std::chrono::steady_clock::now();
+
     Result res = Result::SUCCESS;
     {
-        std::unique_lock<std::mutex> lock(sharedMutex);
-        computeCond.wait(lock, [&] { return !presentSync; });
+        std::unique_lock<std::mutex> lock(sharedMutex, std::defer_lock);
+        {
+            JST_TRACE_SPAN("Scheduler::waitPresent", "scheduler");
+            lock.lock();
+            computeCond.wait(lock, [&] { return !presentSync; });
+        }
         computeSync = true;
 
-        for (const auto& graph : graphs) {
-            if ((res = graph->compute(yielded)) != Result::SUCCESS) {
-                break;
+        if (pool.running() && clusterGraphs.size() > 1) {
+            // Dispatch each independent sub-graph to the worker pool.
+            std::vector<Result> results(clusterGraphs.size(), Result::SUCCESS);
+
+            for (const auto& i : activeClusters) {
+                pool.dispatch([&, i]{
+                    auto& clusterYieldedSet = clusterYielded[i];
+                    clusterYieldedSet.clear();
+                    seedSuspended(clusterYieldedSet);
+
+                    results[i] = computeGraphs(clusterGraphs[i], clusterYieldedSet, clusterInFlight[i]);
+                });
             }
+
+            pool.wait();
+
+            for (const auto& clusterRes : results) {
+                if (clusterRes != Result::SUCCESS) {
+                    res = clusterRes;
+                    break;
+                }
+            }
+        } else {
+            std::vector<U64> indices;
+            for (const auto& i : activeClusters) {
+                indices.insert(indices.end(), clusterGraphs[i].begin(), clusterGraphs[i].end());
+            }
+
+            seedSuspended(yielded);
+            res = computeGraphs(indices, yielded, inFlight);
         }
 
         computeSync = false;
     }
     presentCond.notify_all();
 
+    Sampler::EndCycle(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() -
+                                                                           cycleStart).count());
+
+    cycles.fetch_add(1, std::memory_order_relaxed);
+
     if (res == Result::SUCCESS) {
         return res;
     }
 
     if (res == Result::TIMEOUT) {
+        underruns.fetch_add(1, std::memory_order_relaxed);
         JST_WARN("[SCHEDULER] Graph underrun. Skipping frame.");
         return Result::SUCCESS;
     }
@@ -255,6 +514,196 @@ Result Scheduler::compute() {
     return res;
 }
 
+Result Scheduler::computeGraphs(const std::vector<U64>& indices,
+                                std::unordered_set<U64>& yieldedSet,
+                                std::vector<U64>& pending) {
+    const auto dependsOn = [&](const U64& consumer, const U64& producer) {
+        const auto& inputs = graphs[consumer]->getExternallyWiredInputs();
+        const auto& outputs = graphs[producer]->getExternallyWiredOutputs();
+        return std::any_of(outputs.begin(), outputs.end(), [&](const U64& output) {
+            return inputs.contains(output);
+        });
+    };
+
+    for (const auto& index : indices) {
+        // Wait for graphs still producing the inputs of this graph or still
+        // reading the outputs this graph is about to overwrite. A graph orders
+        // its own frames.
+        for (auto it = pending.begin(); it != pending.end();) {
+            if (*it == index) {
+                it = pending.erase(it);
+                continue;
+            }
+            if (dependsOn(index, *it)) {
+                JST_CHECK(graphs[*it]->synchronize());
+                it = pending.erase(it);
+                continue;
+            }
+            // Graphs copying their inputs ahead keep computing the previous frame
+            // while this graph overwrites them.
+            if (dependsOn(*it, index)) {
+                JST_CHECK(graphs[*it]->synchronizeInputs());
+            }
+            it++;
+        }
+
+        JST_CHECK(computeGraph(index, yieldedSet));
+        pending.push_back(index);
+    }
+
+    return Result::SUCCESS;
+}
+
+Result Scheduler::synchronizeGraphs() {
+    Result res = Result::SUCCESS;
+
+    const auto synchronizeAll = [&](std::vector<U64>& pending) {
+        for (const auto& index : pending) {
+            const auto syncRes = graphs[index]->synchronize();
+            if (res == Result::SUCCESS) {
+                res = syncRes;
+            }
+        }
+        pending.clear();
+    };
+
+    synchronizeAll(inFlight);
+    for (auto& pending : clusterInFlight) {
+        synchronizeAll(pending);
+    }
+
+    return res;
+}
+
+Result Scheduler::computeGraph(const U64& index, std::unordered_set<U64>& yieldedSet) {
+    JST_TRACE_SPAN(graphTraceNames[index], "graph");
+
+    const auto start = std::chrono::steady_clock::now();
+    const auto res = graphs[index]->compute(yieldedSet);
+    const auto elapsed = std::chrono::duration<F32, std::milli>(std::chrono::steady_clock::now() - start);
+
+    {
+        std::lock_guard<std::mutex> lock(statisticsMutex);
+        auto& stats = graphStatistics[index];
+        stats.computeTime = elapsed.count();
+        stats.averageComputeTime = (stats.averageComputeTime == 0.0f) ? elapsed.count() :
+                                   (stats.averageComputeTime * 0.95f) + (elapsed.count() * 0.05f);
+        stats.migratedBytes = graphs[index]->migratedBytes();
+        graphLatencies[index]->record(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+    }
+
+    return res;
+}
+
+void Scheduler::updateSuspended() {
+    suspendedHashes.clear();
+
+    // Throttled views are only fed once every `divisor` compute cycles.
+    const U64 divisor = displayDivisor.load(std::memory_order_relaxed);
+    const bool throttled = divisor > 1 && (cycles.load(std::memory_order_relaxed) % divisor) != 0;
+
+    if (!config.suspendHiddenViews && !throttled) {
+        return;
+    }
+
+    const auto visible = [&](const std::shared_ptr<Present>& view) {
+        return !throttled && (!config.suspendHiddenViews || view->presentVisible());
+    };
+
+    // Consumers come first, so their flags are already up to date.
+    for (U64 i = 0; i < suspendableModules.size(); i++) {
+        const auto& state = suspendableModules[i];
+
+        const bool suspended = !(state.view && visible(state.view)) &&
+                               std::none_of(state.viewers.begin(), state.viewers.end(), visible) &&
+                               std::all_of(state.consumers.begin(), state.consumers.end(), [&](const U64& consumer) {
+                                   return suspendedFlags[consumer];
+                               });
+
+        suspendedFlags[i] = suspended;
+        if (suspended) {
+            suspendedHashes.push_back(state.hash);
+        }
+    }
+}
+
+std::vector<Scheduler::GraphStatistics> Scheduler::statistics() const {
+    std::lock_guard<std::mutex> lock(statisticsMutex);
+    return graphStatistics;
+}
+
+void Scheduler::setProfiling(const bool& enabled) {
+    config.profileModules = enabled;
+
+    if (enabled && !Graph::Profiling()) {
+        std::lock_guard<std::mutex> lock(statisticsMutex);
+        for (const auto& [_, module] : statisticsModules) {
+            module->latency.reset();
+        }
+    }
+
+    Graph::SetProfiling(enabled);
+}
+
+void Scheduler::setDisplayDivisor(const U64& divisor) {
+    displayDivisor.store(std::max<U64>(divisor, 1), std::memory_order_relaxed);
+    signal.notify();
+}
+
+U64 Scheduler::getDisplayDivisor() const {
+    return displayDivisor.load(std::memory_order_relaxed);
+}
+
+bool Scheduler::profiling() const {
+    return Graph::Profiling();
+}
+
+std::unordered_map<Locale, LatencyHistogram::Summary, Locale::Hasher> Scheduler::moduleLatency() const {
+    std::unordered_map<Locale, LatencyHistogram::Summary, Locale::Hasher> summaries;
+
+    std::lock_guard<std::mutex> lock(statisticsMutex);
+    for (const auto& [locale, module] : statisticsModules) {
+        summaries[locale] = module->computeLatency().summary();
+    }
+
+    return summaries;
+}
+
+std::unordered_map<Locale, LatencyHistogram::Snapshot, Locale::Hasher> Scheduler::moduleLatencySnapshots() const {
+    std::unordered_map<Locale, LatencyHistogram::Snapshot, Locale::Hasher> snapshots;
+
+    std::lock_guard<std::mutex> lock(statisticsMutex);
+    for (const auto& [locale, module] : statisticsModules) {
+        snapshots[locale] = module->computeLatency().snapshot();
+    }
+
+    return snapshots;
+}
+
+std::vector<LatencyHistogram::Snapshot> Scheduler::graphLatencySnapshots() const {
+    std::vector<LatencyHistogram::Snapshot> snapshots;
+
+    std::lock_guard<std::mutex> lock(statisticsMutex);
+    for (const auto& latency : graphLatencies) {
+        snapshots.push_back(latency->snapshot());
+    }
+
+    return snapshots;
+}
+
+std::unordered_map<Locale, std::vector<Compute::BufferStatistics>, Locale::Hasher> Scheduler::moduleBuffers() const {
+    std::unordered_map<Locale, std::vector<Compute::BufferStatistics>, Locale::Hasher> buffers;
+
+    std::lock_guard<std::mutex> lock(statisticsMutex);
+    for (const auto& [locale, module] : statisticsModules) {
+        if (auto statistics = module->computeBuffers(); !statistics.empty()) {
+            buffers[locale] = std::move(statistics);
+        }
+    }
+
+    return buffers;
+}
+
 Result Scheduler::present() {
     // Return early if the graphical pipeline is empty.
     if (validPresentModuleStates.empty()) {
@@ -265,25 +714,73 @@ Result Scheduler::present() {
         return Result::SUCCESS;
     }
 
+    JST_TRACE_SPAN("Scheduler::present", "scheduler");
+
+    // The state cannot change while presenting.
+    std::lock_guard<std::mutex> presentLock(presentMutex);
+
+    // Hidden views are presented again once visible.
+    const auto hidden = [&](const PresentModuleState& state) {
+        return config.suspendHiddenViews && !state.module->presentVisible();
+    };
+
+    // Modules presenting from a snapshot don't block compute.
+    bool locked = false;
+    for (const auto& [_, state] : validPresentModuleStates) {
+        if (hidden(state)) {
+            continue;
+        }
+        if (config.decoupledPresent && state.module->presentSnapshot()) {
+            JST_CHECK(state.module->present());
+        } else {
+            locked = true;
+        }
+    }
+
+    if (!locked) {
+        presentCycles.fetch_add(1);
+        signal.notify();
+        return Result::SUCCESS;
+    }
+
     {
         // Present thread has priority over compute thread.
         presentSync = true;
 
-        std::unique_lock<std::mutex> lock(sharedMutex);
-        presentCond.wait(lock, [&] { return !computeSync; });
+        std::unique_lock<std::mutex> lock(sharedMutex, std::defer_lock);
+        {
+            JST_TRACE_SPAN("Scheduler::waitCompute", "scheduler");
+            lock.lock();
+            presentCond.wait(lock, [&] { return !computeSync; });
+        }
+
+        // Device work of the last frame has to finish before it is drawn.
+        {
+            JST_TRACE_SPAN("Scheduler::synchronizeGraphs", "scheduler");
+            JST_CHECK(synchronizeGraphs());
+        }
 
         for (const auto& [_, state] : validPresentModuleStates) {
-            JST_CHECK(state.module->present());
+            if (hidden(state)) {
+                continue;
+            }
+            if (!config.decoupledPresent || !state.module->presentSnapshot()) {
+                JST_CHECK(state.module->present());
+            }
         }
 
         presentSync = false;
     }
     computeCond.notify_all();
 
+    // Display sub-graphs can compute the next frame.
+    presentCycles.fetch_add(1);
+    signal.notify();
+
     return Result::SUCCESS;
 }
 
-Result Scheduler::lockState(const std::function<Result()>& func) {
+void Scheduler::acquireState() {
     // Send halt signal.
     computeHalt.test_and_set();
     presentHalt.test_and_set();
@@ -291,18 +788,22 @@ Result Scheduler::lockState(const std::function<Result()>& func) {
     // Wait for compute to clear.
     computeWait.wait(true);
 
+    // Interrupt compute waiting for the sources.
+    signal.notify();
+
     // Acquire compute/present lock.
+    presentMutex.lock();
     sharedMutex.lock();
     presentSync = true;
     computeSync = true;
+}
 
-    // Run function.
-    Result res = func();
-
+void Scheduler::releaseState() {
     // Release compute/present lock.
     computeSync = false;
     presentSync = false;
     sharedMutex.unlock();
+    presentMutex.unlock();
     computeCond.notify_all();
     presentCond.notify_all();
 
@@ -312,15 +813,54 @@ Result Scheduler::lockState(const std::function<Result()>& func) {
     presentHalt.clear();
     presentHalt.notify_all();
 
+    // Wake up compute waiting for new modules.
+    signal.notify();
+}
+
+Result Scheduler::lockState(const std::function<Result()>& func) {
+    JST_TRACE_SPAN("Scheduler::lockState", "scheduler");
+
+    // State is already locked by the open transaction.
+    if (transactionDepth > 0 && transactionOwner == std::this_thread::get_id()) {
+        return func();
+    }
+
+    {
+        JST_TRACE_SPAN("Scheduler::acquireState", "scheduler");
+        acquireState();
+    }
+
+    // Run function.
+    Result res = func();
+
+    releaseState();
+
     return res;
 }
 
+Result Scheduler::updateExecutionGraphs() {
+    // Defer until the transaction is committed.
+    if (transactionDepth > 0) {
+        transactionDirty = true;
+        return Result::SUCCESS;
+    }
+
+    JST_CHECK(removeInactive());
+    JST_CHECK(shareDuplicates());
+    JST_CHECK(arrangeDependencyOrder());
+    JST_CHECK(checkSequenceValidity());
+    JST_CHECK(createExecutionGraphs());
+
+    return Result::SUCCESS;
+}
+
 Result Scheduler::removeInactive() {
     validComputeModuleStates.clear();
     validPresentModuleStates.clear();
 
     JST_DEBUG("[SCHEDULER] Removing inactive I/O.");
     std::unordered_map<U64, U64> valid;
+    valid.reserve(2 * computeModuleStates.size());
     for (const auto& [name, state] : computeModuleStates) {
         for (const auto& [_, meta] : state.inputMap) {
             if (meta.hash) {
@@ -334,18 +874,26 @@ Result Scheduler::removeInactive() {
         }
     }
 
+    const auto& active = [&](const U64& hash) {
+        const auto& it = valid.find(hash);
+        return it != valid.end() && it->second > 1;
+    };
+
     JST_DEBUG("[SCHEDULER] Generating I/O map for each module.");
     for (auto& [name, state] : computeModuleStates) {
+        state.activeInputs.clear();
+        state.activeOutputs.clear();
+
         for (const auto& [inputName, meta] : state.inputMap) {
-            if (valid[meta.hash] > 1) {
-                state.activeInputs[inputName] = &meta;
+            if (active(meta.hash)) {
+                state.activeInputs.push_back({inputName, &meta});
             } else {
                 JST_TRACE("Nulling '{}' input from '{}' module ({:#016x}).", inputName, name, meta.hash);
             }
         }
         for (const auto& [outputName, meta] : state.outputMap) {
-            if (valid[meta.hash] > 1) {
-                state.activeOutputs[outputName] = &meta;
+            if (active(meta.hash)) {
+                state.activeOutputs.push_back({outputName, &meta});
             } else {
                 JST_TRACE("Nulling '{}' output from '{}' module ({:#016x}).", outputName, name, meta.hash);
             }
@@ -353,20 +901,21 @@ Result Scheduler::removeInactive() {
     }
 
     JST_DEBUG("[SCHEDULER] Removing stale modules.");
-    std::unordered_set<std::string> staleModules;
-    for (const auto& [name, state] : computeModuleStates) {
-        if ((state.activeInputs.empty() && state.activeOutputs.empty())) {
-            JST_TRACE("Removing stale module '{}'.", name);
-            staleModules.insert(name);
-        }
-    }
+    const auto& stale = [&](const std::string& name) {
+        const auto& it = computeModuleStates.find(name);
+        return it != computeModuleStates.end() &&
+               it->second.activeInputs.empty() &&
+               it->second.activeOutputs.empty();
+    };
     for (const auto& [name, state] : computeModuleStates) {
-        if (!staleModules.contains(name)) {
+        if (!stale(name)) {
             validComputeModuleStates[name] = state;
+        } else {
+            JST_TRACE("Removing stale module '{}'.", name);
         }
     }
     for (const auto& [name, state] : presentModuleStates) {
-        if (!staleModules.contains(name)) {
+        if (!stale(name)) {
             validPresentModuleStates[name] = state;
         }
     }
@@ -374,143 +923,509 @@ Result Scheduler::removeInactive() {
     return Result::SUCCESS;
 }
 
-Result Scheduler::arrangeDependencyOrder() {
-    executionOrder.clear();
-    deviceExecutionOrder.clear();
+Result Scheduler::shareDuplicates() {
+    sharedOutputs.clear();
 
-    JST_DEBUG("[SCHEDULER] Calculating module degrees.");
-    std::unordered_set<std::string> queue;
-    std::unordered_map<std::string, U64> degrees;
-    for (const auto& [name, state] : validComputeModuleStates) {
-        degrees[name] = state.activeInputs.size();
-        if (state.activeInputs.size() == 0) {
-            queue.emplace(name);
-        }
+    if (!config.shareModules) {
+        sharedModules.clear();
+        return Result::SUCCESS;
     }
-    JST_TRACE("Block degrees: {}", degrees);
-    JST_TRACE("Initial sorting queue: {}", queue);
 
-    JST_DEBUG("[SCHEDULER] Creating module cache.");
-    std::unordered_map<std::string, std::unordered_set<std::string>> moduleEdgesCache;
-    std::unordered_map<U64, std::vector<std::string>> moduleInputCache;
-    std::unordered_map<U64, std::string> moduleOutputCache;
+    JST_DEBUG("[SCHEDULER] Finding duplicated modules.");
 
-    for (const auto& [name, state] : validComputeModuleStates) {
-        for (const auto& [_, inputMeta] : state.activeInputs) {
-            moduleInputCache[inputMeta->locale.hash()].push_back(name);
+    // Visited in name order, so the same module stays the original across updates.
+    std::vector<std::string> names;
+    names.reserve(validComputeModuleStates.size());
+    for (const auto& [name, _] : validComputeModuleStates) {
+        names.push_back(name);
+    }
+    std::ranges::sort(names);
+
+    // Tensors are identified by their locale, except outputs of duplicates, identified by
+    // the output of their original, and views of an input, identified by the input.
+    std::unordered_map<U64, U64> identities;
+    const auto identity = [&](const Parser::Record& meta) {
+        const auto& it = identities.find(meta.locale.hash());
+        return (it != identities.end()) ? it->second : meta.locale.hash();
+    };
+
+    const auto inplace = [](const ComputeModuleState& state) {
+        const auto& module = std::dynamic_pointer_cast<Module>(state.module);
+        return module && (module->taint() & Taint::IN_PLACE) == Taint::IN_PLACE;
+    };
+
+    const auto view = [&](const ComputeModuleState& state) -> std::pair<const Parser::Record*, const Parser::Record*> {
+        if (state.inputMap.size() != 1 || state.outputMap.size() != 1 ||
+            inplace(state) || state.module->computeForwarding()) {
+            return {};
         }
-        for (const auto& [_, outputMeta] : state.activeOutputs) {
-            moduleOutputCache[outputMeta->locale.hash()] = name;
+        const auto& input = state.inputMap.begin()->second;
+        const auto& output = state.outputMap.begin()->second;
+        if (input.data != output.data || input.shape != output.shape || input.dataType != output.dataType) {
+            return {};
         }
-    }
-
+        return {&input, &output};
+    };
+
+    const auto shareable = [&](const std::string& name, const ComputeModuleState& state) {
+        return state.device == Device::CPU &&
+               !state.module->shareSignature.empty() &&
+               !state.module->computeRealtime() &&
+               !state.activeOutputs.empty() &&
+               !validPresentModuleStates.contains(name);
+    };
+
+    // Outputs of a duplicate have to match the active outputs of the original.
+    const auto copyable = [&](const ComputeModuleState& state, const ComputeModuleState& original) {
+        return std::ranges::all_of(state.outputMap, [&](const auto& output) {
+            const auto& [pin, meta] = output;
+            const auto& match = std::ranges::find_if(original.activeOutputs, [&](const auto& active) {
+                return active.first == pin;
+            });
+            return match != original.activeOutputs.end() &&
+                   match->second->size_bytes == meta.size_bytes &&
+                   match->second->host_accessible && meta.host_accessible &&
+                   match->second->contiguous && meta.contiguous;
+        });
+    };
+
+    // Each duplicate found makes the readers of its outputs comparable, so repeat until none is found.
+    std::unordered_map<std::string, std::string> originals;
+    bool changed = true;
+    while (changed) {
+        changed = false;
+
+        std::unordered_map<std::string, std::string> keys;
+        for (const auto& name : names) {
+            if (originals.contains(name)) {
+                continue;
+            }
+
+            const auto& state = validComputeModuleStates.at(name);
+
+            if (const auto& [input, output] = view(state); input) {
+                const auto& id = identity(*input);
+                if (identity(*output) != id) {
+                    identities[output->locale.hash()] = id;
+                    changed = true;
+                }
+                continue;
+            }
+
+            if (!shareable(name, state)) {
+                continue;
+            }
+
+            std::map<std::string, U64> inputs;
+            for (const auto& [pin, meta] : state.inputMap) {
+                inputs[pin] = (meta.device != Device::None) ? identity(meta) : 0;
+            }
+
+            std::string key = state.module->shareSignature;
+            for (const auto& [pin, id] : inputs) {
+                key += jst::fmt::format("|{}:{:016X}", pin, id);
+            }
+
+            const auto& [match, inserted] = keys.try_emplace(key, name);
+            if (inserted) {
+                continue;
+            }
+
+            const auto& original = validComputeModuleStates.at(match->second);
+            if (!copyable(state, original)) {
+                continue;
+            }
+
+            JST_TRACE("[SCHEDULER] Module '{}' duplicates module '{}'.", name, match->second);
+
+            originals[name] = match->second;
+            for (const auto& [pin, meta] : state.outputMap) {
+                identities[meta.locale.hash()] = identity(original.outputMap.at(pin));
+            }
+            changed = true;
+        }
+    }
+
+    // Duplicates read by anything else than duplicates copy the outputs of their original.
+    std::unordered_set<U64> read;
     for (const auto& [name, state] : validComputeModuleStates) {
-        auto& edges = moduleEdgesCache[name];
+        if (originals.contains(name)) {
+            continue;
+        }
+        for (const auto& [_, meta] : state.activeInputs) {
+            read.emplace(meta->locale.hash());
+        }
+    }
+    for (const auto& [name, state] : validPresentModuleStates) {
+        for (const auto& [_, meta] : state.inputMap) {
+            read.emplace(meta.locale.hash());
+        }
+    }
 
-        for (const auto& [_, inputMeta] : state.activeInputs) {
-            edges.insert(moduleOutputCache.at(inputMeta->locale.hash()));
+    std::unordered_set<std::string> copying;
+    for (const auto& [name, _] : originals) {
+        const auto& state = validComputeModuleStates.at(name);
+        if (std::ranges::any_of(state.activeOutputs, [&](const auto& output) {
+            return read.contains(output.second->locale.hash());
+        })) {
+            copying.insert(name);
         }
-        for (const auto& [_, outputMeta] : state.activeOutputs) {
+    }
+
+    // Tensors still produced once the duplicates not copying are dropped.
+    std::unordered_set<U64> produced;
+    for (const auto& [name, state] : validComputeModuleStates) {
+        if (originals.contains(name) && !copying.contains(name)) {
+            continue;
+        }
+        for (const auto& [_, meta] : state.activeOutputs) {
+            produced.emplace(meta->locale.hash());
+        }
+    }
+
+    std::unordered_map<std::string, std::shared_ptr<SharedCompute>> shared;
+    for (const auto& [name, originalName] : originals) {
+        if (!copying.contains(name)) {
+            JST_TRACE("[SCHEDULER] Dropping duplicated module '{}'.", name);
+            validComputeModuleStates.erase(name);
+            continue;
+        }
+
+        auto& state = validComputeModuleStates.at(name);
+        const auto& original = validComputeModuleStates.at(originalName);
+
+        // Wait for the original and for inputs still produced, which an in-place duplicate writes over.
+        std::vector<std::pair<std::string, const Parser::Record*>> inputs;
+        std::vector<SharedCompute::Copy> copies;
+
+        for (const auto& [pin, meta] : state.activeInputs) {
+            if (produced.contains(meta->locale.hash())) {
+                inputs.push_back({pin, meta});
+            }
+        }
+        for (const auto& [pin, meta] : state.activeOutputs) {
+            const auto& source = std::ranges::find_if(original.activeOutputs, [&](const auto& active) {
+                return active.first == pin;
+            })->second;
+
+            inputs.push_back({jst::fmt::format("shared_{}", pin), source});
+            copies.push_back({source->data, meta->data, meta->size_bytes});
+            sharedOutputs.emplace(source->locale.hash());
+        }
+
+        // Keep the stand-in while nothing changed, so its graph is reused.
+        auto module = sharedModules[name];
+        if (!module || !module->matches(original.module, state.module, copies)) {
+            module = std::make_shared<SharedCompute>(original.module, state.module, std::move(copies));
+            module->setComputeSignal(&signal);
+            module->setTraceName(Tracer::Intern(jst::fmt::format("{}", state.locale)));
+        }
+
+        JST_TRACE("[SCHEDULER] Copying the outputs of '{}' into '{}'.", originalName, name);
+
+        state.module = module;
+        state.activeInputs = std::move(inputs);
+        shared[name] = std::move(module);
+    }
+    sharedModules = std::move(shared);
+
+    if (!originals.empty()) {
+        JST_DEBUG("[SCHEDULER] Sharing {} duplicated module(s), {} copying.", originals.size(), copying.size());
+    }
+
+    return Result::SUCCESS;
+}
+
+Result Scheduler::arrangeDependencyOrder() {
+    executionOrder.clear();
+    deviceExecutionOrder.clear();
+    inplaceOrder.clear();
+
+    JST_DEBUG("[SCHEDULER] Assigning module indices.");
+    // Modules are referred by their index in the arrays below instead of their name.
+    const U64 count = validComputeModuleStates.size();
+    std::vector<std::string> names;
+    std::vector<ComputeModuleState*> states;
+    names.reserve(count);
+    states.reserve(count);
+    for (auto& [name, state] : validComputeModuleStates) {
+        names.push_back(name);
+        states.push_back(&state);
+    }
+
+    JST_DEBUG("[SCHEDULER] Creating module cache.");
+    std::unordered_map<U64, std::vector<U64>> moduleInputCache;
+    std::unordered_map<U64, U64> moduleOutputCache;
+    moduleInputCache.reserve(2 * count);
+    moduleOutputCache.reserve(2 * count);
+
+    for (U64 id = 0; id < count; id++) {
+        for (const auto& [_, inputMeta] : states[id]->activeInputs) {
+            moduleInputCache[inputMeta->locale.hash()].push_back(id);
+        }
+        for (const auto& [_, outputMeta] : states[id]->activeOutputs) {
+            moduleOutputCache[outputMeta->locale.hash()] = id;
+        }
+    }
+
+    // Consumers are listed once per input wired to the module.
+    std::vector<std::vector<U64>> consumers(count);
+    std::vector<std::vector<U64>> neighbors(count);
+
+    for (U64 id = 0; id < count; id++) {
+        for (const auto& [_, inputMeta] : states[id]->activeInputs) {
+            neighbors[id].push_back(moduleOutputCache.at(inputMeta->locale.hash()));
+        }
+        for (const auto& [_, outputMeta] : states[id]->activeOutputs) {
             // TODO: Temporary fix for Slice block crash.
-            if (!moduleInputCache.contains(outputMeta->locale.hash())) {
+            const auto& matches = moduleInputCache.find(outputMeta->locale.hash());
+            if (matches == moduleInputCache.end()) {
                 continue;
             }
-            const auto& matches = moduleInputCache.at(outputMeta->locale.hash());
-            edges.insert(matches.begin(), matches.end());
+            consumers[id].insert(consumers[id].end(), matches->second.begin(), matches->second.end());
+            neighbors[id].insert(neighbors[id].end(), matches->second.begin(), matches->second.end());
         }
     }
 
-    JST_TRACE("Module edges cache: {}", moduleEdgesCache);
-    JST_TRACE("Module input cache: {}", moduleInputCache);
+    JST_DEBUG("[SCHEDULER] Ordering readers of memory modified in-place.");
 
-    JST_DEBUG("[SCHEDULER] Calculating primitive execution order.");
-    Device lastDevice = Device::None;
-    while (!queue.empty()) {
-        std::string nextName;
-        for (const auto& name : queue) {
-            JST_TRACE("Queue: {} | Last Device: {}", queue, lastDevice);
-            const auto& device = validComputeModuleStates[name].device;
-            if (lastDevice == Device::None) {
-                lastDevice = device;
-                JST_TRACE("  Padding with {}.", lastDevice);
-            }
-            if (device == lastDevice) {
-                lastDevice = device;
-                nextName = name;
-                JST_TRACE("  Exiting with {}.", nextName);
-                break;
-            }
-        }
-        if (nextName.empty()) {
-            lastDevice = Device::None;
-            JST_TRACE("Next empty. Resetting device.");
+    // Memory hashes each in-place module writes to.
+    std::vector<std::vector<U64>> inplaceWrites(count);
+    std::vector<U64> writers;
+    std::unordered_set<U64> modifiedHashes;
+    for (U64 id = 0; id < count; id++) {
+        const auto& module = std::dynamic_pointer_cast<Module>(states[id]->module);
+        if (!module || (module->taint() & Taint::IN_PLACE) != Taint::IN_PLACE) {
             continue;
         }
-        JST_ASSERT(!nextName.empty(), "Unexpected empty `nextName`.");
-        queue.erase(queue.find(nextName));
-        executionOrder.push_back(nextName);
 
-        for (const auto& [nextOutputName, nextOutputMeta] : validComputeModuleStates[nextName].activeOutputs) {
-            JST_TRACE("Next active output: {}", nextOutputName);
-            for (const auto& inputModuleName : moduleInputCache[nextOutputMeta->locale.hash()]) {
-                JST_TRACE("  Input module name: {} | Degrees: {}", inputModuleName, degrees[inputModuleName]);
-                if (--degrees[inputModuleName] == 0) {
-                    queue.emplace(inputModuleName);
+        for (const auto& [_, inputMeta] : states[id]->activeInputs) {
+            for (const auto& [_, outputMeta] : states[id]->activeOutputs) {
+                if (inputMeta->hash == outputMeta->hash) {
+                    inplaceWrites[id].push_back(inputMeta->hash);
+                    modifiedHashes.emplace(inputMeta->hash);
                 }
             }
         }
+
+        if (!inplaceWrites[id].empty()) {
+            writers.push_back(id);
+        }
+    }
+
+    const auto& writes = [&](const U64& id, const U64& hash) {
+        return std::ranges::find(inplaceWrites[id], hash) != inplaceWrites[id].end();
+    };
+
+    // Modules sharing their input memory with their output copy it once either is modified.
+    const auto modified = [&](const auto& records) {
+        return std::ranges::any_of(records, [&](const auto& record) {
+            return modifiedHashes.contains(record.second->hash);
+        });
+    };
+
+    for (U64 id = 0; id < count; id++) {
+        const auto& state = *states[id];
+        if (state.module->computeForwarding() && (modified(state.activeInputs) || modified(state.activeOutputs))) {
+            JST_TRACE("Materializing the output of '{}' before it's modified in-place.", names[id]);
+            JST_CHECK(state.module->computeMaterialize());
+        }
+    }
+
+    // In-place modules each module has to run before.
+    std::vector<std::vector<U64>> inplaceBefore(count);
+    std::vector<bool> downstream(count);
+
+    for (const auto& writer : writers) {
+        // Modules after the writer are expected to see the modified memory.
+        std::fill(downstream.begin(), downstream.end(), false);
+        std::vector<U64> stack = {writer};
+        while (!stack.empty()) {
+            const auto current = stack.back();
+            stack.pop_back();
+
+            for (const auto& consumer : consumers[current]) {
+                if (!downstream[consumer]) {
+                    downstream[consumer] = true;
+                    stack.push_back(consumer);
+                }
+            }
+        }
+
+        // Every other module reading the memory before the write has to run first.
+        // Read-only branches are ordered instead of copied.
+        for (U64 reader = 0; reader < count; reader++) {
+            if (reader == writer) {
+                continue;
+            }
+
+            for (const auto& [_, inputMeta] : states[reader]->activeInputs) {
+                const auto& producer = moduleOutputCache.at(inputMeta->locale.hash());
+
+                if (!writes(writer, inputMeta->hash) || producer == writer || downstream[producer]) {
+                    continue;
+                }
+
+                if (downstream[reader] || writes(reader, inputMeta->hash)) {
+                    JST_ERROR("[SCHEDULER] Module '{}' reads memory that module '{}' modifies in-place and "
+                              "can't run before it. Add a Duplicate block before '{}'.", names[reader],
+                                                                                         names[writer],
+                                                                                         names[writer]);
+                    return Result::ERROR;
+                }
+
+                if (std::ranges::find(inplaceBefore[reader], writer) == inplaceBefore[reader].end()) {
+                    JST_TRACE("Ordering '{}' before in-place module '{}'.", names[reader], names[writer]);
+                    inplaceBefore[reader].push_back(writer);
+                }
+            }
+        }
+
+        // Views without a compute step read the memory after the graph ran.
+        for (const auto& [viewer, state] : validPresentModuleStates) {
+            if (validComputeModuleStates.contains(viewer)) {
+                continue;
+            }
+
+            for (const auto& [_, meta] : state.inputMap) {
+                const auto& producer = moduleOutputCache.find(meta.locale.hash());
+                if (!writes(writer, meta.hash) || producer == moduleOutputCache.end()) {
+                    continue;
+                }
+
+                if (producer->second == writer || downstream[producer->second]) {
+                    continue;
+                }
+
+                JST_ERROR("[SCHEDULER] Module '{}' displays memory that module '{}' modifies in-place. "
+                          "Add a Duplicate block before '{}'.", viewer, names[writer], names[writer]);
+                return Result::ERROR;
+            }
+        }
+    }
+
+    for (U64 reader = 0; reader < count; reader++) {
+        for (const auto& writer : inplaceBefore[reader]) {
+            inplaceOrder[names[reader]].emplace(names[writer]);
+        }
+    }
+
+    JST_DEBUG("[SCHEDULER] Calculating module degrees.");
+    std::vector<U64> degrees(count, 0);
+    for (U64 id = 0; id < count; id++) {
+        degrees[id] += states[id]->activeInputs.size();
+        for (const auto& writer : inplaceBefore[id]) {
+            degrees[writer] += 1;
+        }
+    }
+    JST_TRACE("Block degrees: {}", degrees);
+
+    // Modules ready to run grouped by device. Modules of the last device are
+    // picked first to keep them in the same graph.
+    std::vector<std::pair<Device, std::vector<U64>>> ready;
+    const auto& push = [&](const U64& id) {
+        const auto& device = states[id]->device;
+        auto it = std::ranges::find_if(ready, [&](const auto& entry) { return entry.first == device; });
+        if (it == ready.end()) {
+            ready.push_back({device, {}});
+            it = ready.end() - 1;
+        }
+        it->second.push_back(id);
+    };
+    for (U64 id = 0; id < count; id++) {
+        if (degrees[id] == 0) {
+            push(id);
+        }
+    }
+
+    JST_DEBUG("[SCHEDULER] Calculating primitive execution order.");
+    std::vector<U64> order;
+    order.reserve(count);
+    Device lastDevice = Device::None;
+    while (true) {
+        auto it = std::ranges::find_if(ready, [&](const auto& entry) {
+            return entry.first == lastDevice && !entry.second.empty();
+        });
+        if (it == ready.end()) {
+            it = std::ranges::find_if(ready, [](const auto& entry) { return !entry.second.empty(); });
+        }
+        if (it == ready.end()) {
+            break;
+        }
+
+        lastDevice = it->first;
+        const U64 next = it->second.back();
+        it->second.pop_back();
+
+        order.push_back(next);
+        executionOrder.push_back(names[next]);
+
+        for (const auto& consumer : consumers[next]) {
+            if (--degrees[consumer] == 0) {
+                push(consumer);
+            }
+        }
+        for (const auto& writer : inplaceBefore[next]) {
+            if (--degrees[writer] == 0) {
+                push(writer);
+            }
+        }
     }
     JST_TRACE("Primitive execution order: {}", executionOrder);
-    if (executionOrder.size() != validComputeModuleStates.size()) {
+    if (executionOrder.size() != count) {
         JST_FATAL("[SCHEDULER] Dependency cycle detected. Expected ({}) and actual "
-                  "({}) execution order size mismatch.", validComputeModuleStates.size(), executionOrder.size());
+                  "({}) execution order size mismatch.", count, executionOrder.size());
         return Result::FATAL;
     }
 
     JST_DEBUG("[SCHEDULER] Spliting graph into sub-graphs.");
     U64 clusterCount = 0;
-    std::unordered_set<std::string> visited;
-    for (const auto& [name, state] : validComputeModuleStates) {
-        if (!visited.contains(name)) {
-            std::stack<std::string> stack;
-            stack.push(name);
+    std::vector<bool> visited(count, false);
+    for (U64 id = 0; id < count; id++) {
+        if (visited[id]) {
+            continue;
+        }
 
-            while (!stack.empty()) {
-                std::string current = stack.top();
-                stack.pop();
+        std::vector<U64> stack = {id};
+        visited[id] = true;
 
-                for (const auto& neighbor : moduleEdgesCache[current]) {
-                    if (!visited.contains(neighbor)) {
-                        stack.push(neighbor);
-                    }
-                }
+        while (!stack.empty()) {
+            const U64 current = stack.back();
+            stack.pop_back();
+            states[current]->clusterId = clusterCount;
 
-                if (!visited.contains(current)) {
-                    visited.insert(current);
-                    validComputeModuleStates[current].clusterId = clusterCount;
+            for (const auto& neighbor : neighbors[current]) {
+                if (!visited[neighbor]) {
+                    visited[neighbor] = true;
+                    stack.push_back(neighbor);
                 }
             }
-
-            clusterCount += 1;
         }
+
+        clusterCount += 1;
     }
 
     JST_DEBUG("[SCHEDULER] Calculating graph execution order.");
     lastDevice = Device::None;
     U64 lastCluster = 0;
-    for (const auto& name : executionOrder) {
-        const auto& state = validComputeModuleStates[name];
+    I32 lastDeviceIndex = -1;
+    for (const auto& id : order) {
+        const auto& state = *states[id];
         const auto& currentCluster = state.clusterId;
         const auto& currentDevice = state.device;
+        const auto& currentDeviceIndex = state.deviceIndex;
 
+        // Blocks placed on different GPUs run in different graphs.
         if ((currentDevice & lastDevice) != lastDevice ||
-            currentCluster != lastCluster) {
+            currentCluster != lastCluster ||
+            currentDeviceIndex != lastDeviceIndex) {
             deviceExecutionOrder.push_back({currentDevice, {}});
         }
 
         lastCluster = currentCluster;
         lastDevice = currentDevice;
-        deviceExecutionOrder.back().second.push_back(name);
+        lastDeviceIndex = currentDeviceIndex;
+        deviceExecutionOrder.back().second.push_back(names[id]);
     }
 
     JST_DEBUG("---------------------------------------------------");
@@ -526,73 +1441,271 @@ Result Scheduler::arrangeDependencyOrder() {
 }
 
 Result Scheduler::checkSequenceValidity() {
-    JST_DEBUG("[SCHEDULER] Gathering modules with inplace operations.");
-    std::unordered_map<U64, std::vector<std::string>> inplaceVectorsMap;
-    for (const auto& name : executionOrder) {
-        auto& state = validComputeModuleStates[name];
+    JST_DEBUG("[SCHEDULER] Asserting that readers run before the in-place modules modifying their memory.");
+    std::unordered_map<std::string, U64> position;
+    for (U64 i = 0; i < executionOrder.size(); i++) {
+        position[executionOrder[i]] = i;
+    }
 
-        std::unordered_set<U64> inputs;
-        for (const auto& [_, inputMeta] : state.activeInputs) {
-            inputs.emplace(inputMeta->hash);
+    for (const auto& [reader, writers] : inplaceOrder) {
+        for (const auto& writer : writers) {
+            if (position.at(reader) > position.at(writer)) {
+                JST_ERROR("[SCHEDULER] Module '{}' was scheduled after in-place module '{}'.", reader, writer);
+                return Result::ERROR;
+            }
         }
+    }
 
-        std::unordered_set<U64> outputs;
-        for (const auto& [_, outputMeta] : state.activeOutputs) {
-            outputs.emplace(outputMeta->hash);
-        }
+    return Result::SUCCESS;
+}
+
+Result Scheduler::createExecutionGraphs() {
+    // Graphs with the exact same modules and wiring are kept alive
+    // instead of being destroyed and created again.
+    std::unordered_map<U64, std::shared_ptr<Graph>> previousGraphs;
+    for (U64 i = 0; i < graphs.size(); i++) {
+        previousGraphs[graphSignatures[i]] = graphs[i];
+    }
+
+    // Graph indices are about to change.
+    JST_CHECK(synchronizeGraphs());
 
-        std::vector<U64> inplaceVectors;
-        std::ranges::set_intersection(inputs, outputs, std::back_inserter(inplaceVectors));
+    graphs.clear();
+    graphSignatures.clear();
+    graphTraceNames.clear();
+    clusterGraphs.clear();
+    clusterYielded.clear();
+    clusterInFlight.clear();
+
+    std::vector<GraphStatistics> newStatistics;
+    std::vector<std::unique_ptr<LatencyHistogram>> newLatencies;
+    std::unordered_map<U64, U64> clusterIndex;
+    std::vector<std::shared_ptr<Graph>> newGraphs;
+
+    JST_DEBUG("[SCHEDULER] Finding readers of every tensor.");
+    std::unordered_map<U64, std::unordered_set<U64>> graphReaders;
+    std::unordered_map<TensorStorageMetadata*, std::unordered_set<U64>> storageLocales;
+    std::unordered_set<U64> presentReaders;
 
-        for (const auto& inplaceVector : inplaceVectors) {
-            inplaceVectorsMap[inplaceVector].push_back(name);
+    for (U64 i = 0; i < deviceExecutionOrder.size(); i++) {
+        for (const auto& blockName : deviceExecutionOrder[i].second) {
+            for (const auto& [_, inputMeta] : validComputeModuleStates[blockName].activeInputs) {
+                graphReaders[inputMeta->locale.hash()].emplace(i);
+            }
         }
     }
-    JST_TRACE("In-place module map: {}", inplaceVectorsMap)
-
-    JST_DEBUG("[SCHEDULER] Gathering positional memory layout.");
-    std::map<std::pair<U64, U64>, std::vector<std::string>> pMap;
-    for (const auto& name : executionOrder) {
-        for (const auto& [_, inputMeta] : validComputeModuleStates[name].activeInputs) {
-            pMap[{inputMeta->hash, inputMeta->locale.hash()}].push_back(name);
+    for (const auto& [_, state] : validComputeModuleStates) {
+        for (const auto& map : {&state.inputMap, &state.outputMap}) {
+            for (const auto& [_, meta] : *map) {
+                if (meta.storage) {
+                    storageLocales[meta.storage.get()].emplace(meta.locale.hash());
+                }
+            }
+        }
+    }
+    for (const auto& [_, state] : validPresentModuleStates) {
+        for (const auto& [_, meta] : state.inputMap) {
+            presentReaders.emplace(meta.locale.hash());
         }
     }
-    JST_TRACE("In-place vector map: {}", pMap)
 
-    JST_DEBUG("[SCHEDULER] Asserting that positional memory layout meets in-place requirements.");
-    for (const auto& [hashes, blocks] : pMap) {
-        const auto& [hash, phash] = hashes;
+    // Memory forwarded as another output is read by the consumers of that output too.
+    std::unordered_set<U64> forwardedInputs;
+    for (const auto& [_, state] : validComputeModuleStates) {
+        if (!state.module->computeForwarding()) {
+            continue;
+        }
+        for (const auto& [_, inputMeta] : state.activeInputs) {
+            forwardedInputs.emplace(inputMeta->locale.hash());
+        }
+    }
 
-        if (blocks.size() <= 1) {
+    // Outputs of elementwise modules are rewritten on every compute. If they're only
+    // read by modules of the same graph, nothing needs them after the graph is done.
+    const auto isTransient = [&](const U64& graphIndex, const ComputeModuleState& state, const Parser::Record& meta) {
+        const auto& locale = meta.locale.hash();
+
+        return meta.storage &&
+               meta.device == Device::CPU &&
+               state.module->computeElementwise() > 0 &&
+               storageLocales[meta.storage.get()].size() == 1 &&
+               graphReaders[locale] == std::unordered_set<U64>{graphIndex} &&
+               !presentReaders.contains(locale) &&
+               !forwardedInputs.contains(locale) &&
+               !sharedOutputs.contains(locale);
+    };
+
+    JST_DEBUG("[SCHEDULER] Finding modules only feeding views.");
+    std::unordered_map<U64, std::vector<std::string>> computeConsumers;
+    std::unordered_map<U64, std::vector<std::shared_ptr<Present>>> presentConsumers;
+    for (const auto& [name, state] : validComputeModuleStates) {
+        for (const auto& [_, inputMeta] : state.activeInputs) {
+            computeConsumers[inputMeta->locale.hash()].push_back(name);
+        }
+    }
+    for (const auto& [name, state] : validPresentModuleStates) {
+        if (validComputeModuleStates.contains(name)) {
             continue;
         }
+        for (const auto& [_, meta] : state.inputMap) {
+            presentConsumers[meta.locale.hash()].push_back(state.module);
+        }
+    }
+
+    suspendableModules.clear();
+    std::unordered_map<std::string, U64> suspendableIndex;
+    for (const auto& name : executionOrder | std::views::reverse) {
+        const auto& state = validComputeModuleStates[name];
+        const auto& module = std::dynamic_pointer_cast<Module>(state.module);
+        const bool hasView = validPresentModuleStates.contains(name);
+
+        // Modules with side effects, without readers or writing in-place are never suspended.
+        bool suspendable = !state.module->computeRealtime() &&
+                           !(module && (module->taint() & Taint::IN_PLACE) == Taint::IN_PLACE) &&
+                           (hasView || !state.activeOutputs.empty());
+
+        SuspendableModuleState suspendableState = {
+            .hash = Graph::SuspendHash(state.module.get()),
+            .view = hasView ? validPresentModuleStates[name].module : nullptr,
+            .consumers = {},
+            .viewers = {},
+        };
 
-        if (inplaceVectorsMap.count(hash) > 0) {
-            std::vector<std::string> inplaceModules;
-            std::ranges::set_intersection(blocks,
-                                          inplaceVectorsMap[hash],
-                                          std::back_inserter(inplaceModules));
-            if (inplaceModules.size() > 0) {
-                JST_WARN("[SCHEDULER] Vector is being shared by at least two modules after a branch "
-                          "and at least one of them is an in-place module.");
-                JST_WARN("    Hash: 0x{:016x} | Pos: {} | Modules: {}", hash,
-                                                                        phash - hash,
-                                                                        blocks);
-                //return Result::ERROR;
-                // TODO: Implement copy module.
+        for (const auto& [_, outputMeta] : state.activeOutputs) {
+            const auto& hash = outputMeta->locale.hash();
+            const auto& consumers = computeConsumers.find(hash);
+            const auto& viewers = presentConsumers.find(hash);
+
+            if (consumers != computeConsumers.end()) {
+                for (const auto& consumer : consumers->second) {
+                    if (!suspendableIndex.contains(consumer)) {
+                        suspendable = false;
+                        break;
+                    }
+                    suspendableState.consumers.push_back(suspendableIndex[consumer]);
+                }
+            }
+            if (viewers != presentConsumers.end()) {
+                suspendableState.viewers.insert(suspendableState.viewers.end(), viewers->second.begin(),
+                                                                                viewers->second.end());
+            }
+            if (!hasView && consumers == computeConsumers.end() && viewers == presentConsumers.end()) {
+                suspendable = false;
             }
         }
+
+        if (suspendable) {
+            suspendableIndex[name] = suspendableModules.size();
+            suspendableModules.push_back(std::move(suspendableState));
+        }
     }
+    suspendedFlags.assign(suspendableModules.size(), false);
 
-    return Result::SUCCESS;
-}
+    JST_DEBUG("[SCHEDULER] Instantiating compute graphs and adding wired Vectors.");
+    for (U64 graphIndex = 0; graphIndex < deviceExecutionOrder.size(); graphIndex++) {
+        const auto& [device, blocksNames] = deviceExecutionOrder[graphIndex];
 
-Result Scheduler::createExecutionGraphs() {
-    graphs.clear();
+        std::vector<std::pair<U64, std::shared_ptr<TensorStorageMetadata>>> transientOutputs;
+        std::vector<U64> externalOutputs;
+        for (const auto& blockName : blocksNames) {
+            const auto& state = validComputeModuleStates[blockName];
 
-    JST_DEBUG("[SCHEDULER] Instantiating compute graphs and adding wired Vectors.");
-    for (const auto& [device, blocksNames] : deviceExecutionOrder) {
-        auto graph = NewGraph(device);
+            for (const auto& [_, outputMeta] : state.activeOutputs) {
+                if (device == Device::CPU && isTransient(graphIndex, state, *outputMeta)) {
+                    transientOutputs.push_back({outputMeta->locale.hash(), outputMeta->storage});
+                }
+
+                const auto& readers = graphReaders[outputMeta->locale.hash()];
+                if (std::ranges::any_of(readers, [&](const U64& reader) { return reader != graphIndex; })) {
+                    externalOutputs.push_back(outputMeta->locale.hash());
+                }
+            }
+        }
+        std::ranges::sort(externalOutputs);
+
+        const auto& deviceIndex = validComputeModuleStates[blocksNames.front()].deviceIndex;
+
+        // Calculate graph signature.
+        U64 signature = std::hash<U64>{}(static_cast<U64>(device));
+        const auto combine = [&](const U64& value) {
+            signature ^= std::hash<U64>{}(value) + 0x9e3779b97f4a7c15 + (signature << 6) + (signature >> 2);
+        };
+
+        combine(static_cast<U64>(deviceIndex + 1));
+
+        for (const auto& blockName : blocksNames) {
+            const auto& state = validComputeModuleStates[blockName];
+
+            combine(reinterpret_cast<uintptr_t>(state.module.get()));
+
+            std::vector<U64> hashes;
+            for (const auto& [_, inputMeta] : state.activeInputs) {
+                hashes.push_back(inputMeta->locale.hash());
+            }
+            std::ranges::sort(hashes);
+            hashes.push_back(0);
+            for (const auto& [_, outputMeta] : state.activeOutputs) {
+                hashes.push_back(outputMeta->locale.hash());
+            }
+            std::ranges::sort(hashes.begin() + hashes.size() - state.activeOutputs.size(), hashes.end());
+
+            for (const auto& hash : hashes) {
+                combine(hash);
+            }
+
+            combine(suspendableIndex.contains(blockName));
+        }
+
+        // Changing the readers of a transient output invalidates the memory plan.
+        std::vector<U64> transientHashes;
+        for (const auto& [hash, _] : transientOutputs) {
+            transientHashes.push_back(hash);
+        }
+        std::ranges::sort(transientHashes);
+        combine(transientHashes.size());
+        for (const auto& hash : transientHashes) {
+            combine(hash);
+        }
+
+        // So does changing which outputs are read by other graphs for the pipeline stages.
+        combine(externalOutputs.size());
+        for (const auto& hash : externalOutputs) {
+            combine(hash);
+        }
+
+        // Group graphs of the same sub-graph while keeping the execution order.
+        const auto& clusterId = validComputeModuleStates[blocksNames.front()].clusterId;
+        if (!clusterIndex.contains(clusterId)) {
+            clusterIndex[clusterId] = clusterGraphs.size();
+            clusterGraphs.push_back({});
+        }
+        clusterGraphs[clusterIndex[clusterId]].push_back(graphs.size());
+
+        graphTraceNames.push_back(Tracer::Intern(jst::fmt::format("{} Graph {}", GetDevicePrettyName(device),
+                                                                                  graphs.size())));
+
+        newStatistics.push_back({
+            .device = device,
+            .deviceIndex = deviceIndex,
+            .clusterId = clusterId,
+            .blockCount = blocksNames.size(),
+            .computeTime = 0.0f,
+            .averageComputeTime = 0.0f,
+            .migratedBytes = 0,
+        });
+        newLatencies.push_back(std::make_unique<LatencyHistogram>());
+
+        if (previousGraphs.contains(signature)) {
+            JST_TRACE("[SCHEDULER] Reusing unchanged graph {}.", blocksNames);
+            graphs.push_back(previousGraphs.extract(signature).mapped());
+            graphSignatures.push_back(signature);
+            continue;
+        }
+
+        std::shared_ptr<Graph> graph = NewGraph(device);
+        JST_CHECK(graph->setWorkerPool(&graphPool));
+        JST_CHECK(graph->setDeviceIndex(deviceIndex));
+        JST_CHECK(graph->setPipelineStages(config.pipelineStages));
 
         for (const auto& blockName : blocksNames) {
             auto& state = validComputeModuleStates[blockName];
@@ -604,6 +1717,10 @@ Result Scheduler::createExecutionGraphs() {
                 inputSet.emplace(inputMeta->locale.hash());
             }
 
+            if (suspendableIndex.contains(blockName)) {
+                inputSet.emplace(Graph::SuspendHash(state.module.get()));
+            }
+
             for (const auto& [_, outputMeta] : state.activeOutputs) {
                 outputSet.emplace(outputMeta->locale.hash());
             }
@@ -611,9 +1728,140 @@ Result Scheduler::createExecutionGraphs() {
             graph->setModule(state.module, inputSet, outputSet);
         }
 
+        for (const auto& [hash, storage] : transientOutputs) {
+            JST_CHECK(graph->setTransientOutput(hash, storage));
+        }
+
+        for (const auto& hash : externalOutputs) {
+            JST_CHECK(graph->setExternalOutput(hash));
+        }
+
+        newGraphs.push_back(graph);
         graphs.push_back(std::move(graph));
+        graphSignatures.push_back(signature);
+    }
+
+    clusterYielded.resize(clusterGraphs.size());
+    clusterInFlight.resize(clusterGraphs.size());
+
+    JST_DEBUG("[SCHEDULER] Sorting sub-graphs by priority.");
+    clusterPriority.assign(clusterGraphs.size(), 0);
+    deadlineModules.clear();
+    for (const auto& [_, blocksNames] : deviceExecutionOrder) {
+        for (const auto& blockName : blocksNames) {
+            const auto& state = validComputeModuleStates[blockName];
+            const auto& priority = state.module->computePriority();
+            auto& clusterPriorityValue = clusterPriority[clusterIndex[state.clusterId]];
+
+            clusterPriorityValue = std::max(clusterPriorityValue, priority);
+            if (priority > 0) {
+                deadlineModules.push_back({priority, state.module});
+            }
+        }
+    }
+
+    JST_DEBUG("[SCHEDULER] Finding sub-graphs only feeding the display.");
+    std::unordered_set<U64> computeReaders;
+    for (const auto& [_, state] : validComputeModuleStates) {
+        for (const auto& [_, inputMeta] : state.activeInputs) {
+            computeReaders.emplace(inputMeta->locale.hash());
+        }
+    }
+    clusterDisplayOnly.assign(clusterGraphs.size(), true);
+    clusterPresents.assign(clusterGraphs.size(), {});
+    clusterPresentCycle.assign(clusterGraphs.size(), std::numeric_limits<U64>::max());
+    for (const auto& [blockName, state] : validComputeModuleStates) {
+        const auto& i = clusterIndex[state.clusterId];
+
+        // Modules without a view have to be read by another module. Anything
+        // else is a sink with side effects, like a file or audio output.
+        const bool read = !state.activeOutputs.empty() &&
+                          std::all_of(state.activeOutputs.begin(), state.activeOutputs.end(), [&](const auto& output) {
+                              const auto& hash = output.second->locale.hash();
+                              return computeReaders.contains(hash) || presentReaders.contains(hash);
+                          });
+
+        if (validPresentModuleStates.contains(blockName)) {
+            clusterPresents[i].push_back(validPresentModuleStates.at(blockName).module);
+        } else if (!read) {
+            clusterDisplayOnly[i] = false;
+        }
+
+        if (state.module->computeRealtime()) {
+            clusterDisplayOnly[i] = false;
+        }
+    }
+    for (U64 i = 0; i < clusterGraphs.size(); i++) {
+        clusterDisplayOnly[i] = clusterDisplayOnly[i] && !clusterPresents[i].empty();
+    }
+
+    clusterOrder.resize(clusterGraphs.size());
+    std::iota(clusterOrder.begin(), clusterOrder.end(), 0);
+    std::ranges::stable_sort(clusterOrder, [&](const U64& a, const U64& b) {
+        return clusterPriority[a] > clusterPriority[b];
+    });
+
+    JST_DEBUG("[SCHEDULER] Destroying {} stale graph(s) and creating {} new graph(s).", previousGraphs.size(),
+                                                                                         newGraphs.size());
+
+    // Destroy graphs that changed before creating their replacements.
+    for (const auto& [_, graph] : previousGraphs) {
+        JST_CHECK(graph->destroy());
+    }
+
+    // Create independent graphs in parallel. Module creation plans FFTs and
+    // compiles kernels, which dominates the import of large flowgraphs. CUDA
+    // and Metal graphs keep per-thread state and are created on this thread.
+
+    const auto parallel = [](const std::shared_ptr<Graph>& graph) {
+        return graph->device() == Device::CPU || graph->device() == Device::Vulkan;
+    };
+
+    WorkerPool createPool;
+    if (config.createThreads != 1 && std::ranges::count_if(newGraphs, parallel) > 1) {
+        JST_CHECK(createPool.start(config.createThreads));
     }
 
+    std::vector<Result> createResults(newGraphs.size(), Result::SUCCESS);
+    for (U64 i = 0; i < newGraphs.size(); i++) {
+        const auto create = [&, i]{
+            JST_STARTUP_PHASE("Graph Creation");
+            try {
+                createResults[i] = newGraphs[i]->create();
+            } catch (const Result& res) {
+                createResults[i] = res;
+            }
+        };
+
+        if (createPool.running() && parallel(newGraphs[i])) {
+            createPool.dispatch(create);
+        } else {
+            create();
+        }
+    }
+
+    if (createPool.running()) {
+        createPool.wait();
+        JST_CHECK(createPool.stop());
+    }
+
+    for (const auto& res : createResults) {
+        JST_CHECK(res);
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(statisticsMutex);
+        graphStatistics = std::move(newStatistics);
+        graphLatencies = std::move(newLatencies);
+
+        statisticsModules.clear();
+        for (const auto& [_, state] : validComputeModuleStates) {
+            statisticsModules.push_back({state.locale, state.module});
+        }
+    }
+
+    JST_DEBUG("[SCHEDULER] Created {} graph(s) in {} independent sub-graph(s).", graphs.size(), clusterGraphs.size());
+
     JST_DEBUG("[SCHEDULER] Creating dependency list between graphs.");
     std::shared_ptr<Graph> previousGraph;
     for (auto& currentGraph : graphs) {
@@ -633,6 +1881,82 @@ Result Scheduler::createExecutionGraphs() {
         }
     }
 
+    JST_CHECK(createMirrors());
+
+    return Result::SUCCESS;
+}
+
+Result Scheduler::createMirrors() {
+    JST_DEBUG("[SCHEDULER] Marking tensors crossing between CUDA and other devices.");
+
+    std::unordered_map<U64, std::shared_ptr<TensorStorageMetadata>> storages;
+    for (const auto& [name, state] : validComputeModuleStates) {
+        for (const auto& [_, outputMeta] : state.activeOutputs) {
+            storages[outputMeta->locale.hash()] = outputMeta->storage;
+        }
+    }
+
+    for (const auto& graph : graphs) {
+        JST_CHECK(graph->clearMirrored());
+    }
+
+    // Outputs of a CUDA graph read by a graph of another device are downloaded
+    // after the producer computes. The opposite direction is uploaded before the
+    // consumer computes.
+
+    for (U64 i = 0; i < graphs.size(); i++) {
+        for (U64 j = i + 1; j < graphs.size(); j++) {
+            const auto& producer = graphs[i];
+            const auto& consumer = graphs[j];
+
+            const bool download = producer->device() == Device::CUDA && consumer->device() != Device::CUDA;
+            const bool upload = producer->device() != Device::CUDA && consumer->device() == Device::CUDA;
+            const bool peer = producer->device() == Device::CUDA && consumer->device() == Device::CUDA &&
+                              producer->deviceIndex() != consumer->deviceIndex();
+
+            if (!download && !upload && !peer) {
+                continue;
+            }
+
+            std::vector<U64> commonItems;
+            std::ranges::set_intersection(producer->getWiredOutputs(),
+                                          consumer->getWiredInputs(),
+                                          std::back_inserter(commonItems));
+
+            // Graphs on different GPUs read each other's memory directly.
+
+            if (peer) {
+#ifdef JETSTREAM_BACKEND_CUDA_AVAILABLE
+                const auto& backend = Backend::State<Device::CUDA>();
+                const auto resolve = [&](const I32& index) {
+                    return (index < 0) ? backend->getDeviceId() : static_cast<U64>(index);
+                };
+                const auto producerIndex = resolve(producer->deviceIndex());
+                const auto consumerIndex = resolve(consumer->deviceIndex());
+
+                if (!commonItems.empty() && !backend->canAccessPeer(consumerIndex, producerIndex)) {
+                    JST_ERROR("[SCHEDULER] Device {} can't read the memory of device {}. "
+                              "Place connected blocks on GPUs with peer access.", consumerIndex, producerIndex);
+                    return Result::ERROR;
+                }
+#endif
+                continue;
+            }
+
+            for (const auto& item : commonItems) {
+                if (!storages.contains(item)) {
+                    continue;
+                }
+
+                if (download) {
+                    JST_CHECK(producer->setMirroredOutput(item, storages.at(item)));
+                } else {
+                    JST_CHECK(consumer->setMirroredInput(item, storages.at(item)));
+                }
+            }
+        }
+    }
+
     return Result::SUCCESS;
 }
 
@@ -668,13 +1992,31 @@ void Scheduler::drawDebugMessage() const {
     ImGui::TableSetColumnIndex(1);
     ImGui::TextUnformatted("");
 
+    ImGui::TableNextRow();
+    ImGui::TableSetColumnIndex(0);
+    ImGui::TextUnformatted("Threads:");
+    ImGui::TableSetColumnIndex(1);
+    ImGui::TextFormatted("{}", (pool.running()) ? pool.size() : 1);
+
     U64 count = 0;
-    for (const auto& [device, blocks] : deviceExecutionOrder) {
+    for (const auto& stats : statistics()) {
         ImGui::TableNextRow();
         ImGui::TableSetColumnIndex(0);
         ImGui::TextUnformatted("");
         ImGui::TableSetColumnIndex(1);
-        ImGui::TextFormatted("[{}] {}: {} blocks", count, GetDevicePrettyName(device), blocks.size());
+        ImGui::TextFormatted("[{}] {}: {} blocks (C{}) {:.2f} ms", count++,
+                                                                   GetDevicePrettyName(stats.device),
+                                                                   stats.blockCount,
+                                                                   stats.clusterId,
+                                                                   stats.averageComputeTime);
+
+        if (stats.migratedBytes > 0) {
+            ImGui::TableNextRow();
+            ImGui::TableSetColumnIndex(0);
+            ImGui::TextUnformatted("");
+            ImGui::TableSetColumnIndex(1);
+            ImGui::TextFormatted("    Migrated: {:.2f} MB/frame", static_cast<F32>(stats.migratedBytes) / (1024 * 1024));
+        }
     }
 }
 
@@ -0,0 +1,46 @@
+#include "jetstream/compute/signal.hh"
+
+namespace Jetstream {
+
+void ComputeSignal::notify() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        counter += 1;
+    }
+    cond.notify_all();
+}
+
+void ComputeSignal::notifyAt(const TimePoint& time) {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        deadline = std::min(deadline, time);
+    }
+    cond.notify_all();
+}
+
+Result ComputeSignal::wait(const U64& epoch, const std::chrono::milliseconds& timeout) {
+    std::unique_lock<std::mutex> lock(mutex);
+
+    const auto limit = std::chrono::steady_clock::now() + timeout;
+
+    while (counter == epoch) {
+        const auto now = std::chrono::steady_clock::now();
+
+        // Scheduled notification expired.
+        if (deadline <= now) {
+            deadline = TimePoint::max();
+            counter += 1;
+            break;
+        }
+
+        if (limit <= now) {
+            return Result::TIMEOUT;
+        }
+
+        cond.wait_until(lock, std::min(deadline, limit));
+    }
+
+    return Result::SUCCESS;
+}
+
+}  // namespace Jetstream
@@ -0,0 +1,170 @@
+#include <algorithm>
+#include <mutex>
+#include <fstream>
+#include <sstream>
+
+#include "jetstream/compute/thread.hh"
+#include "jetstream/compute/tracer.hh"
+#include "jetstream/logger.hh"
+
+#if defined(JST_OS_LINUX) || defined(JST_OS_ANDROID) || defined(JST_OS_MAC) || defined(JST_OS_IOS)
+#define JST_THREAD_POSIX
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace Jetstream {
+
+namespace {
+
+std::mutex policiesMutex;
+ThreadPolicies policies;
+
+}  // namespace
+
+const ThreadPolicy& ThreadPolicies::get(const ThreadRole& role) const {
+    switch (role) {
+        case ThreadRole::Compute:
+            return compute;
+        case ThreadRole::Present:
+            return present;
+        case ThreadRole::Worker:
+            return worker;
+        case ThreadRole::IO:
+            return io;
+        case ThreadRole::Audio:
+            return audio;
+    }
+    return compute;
+}
+
+void SetThreadPolicies(const ThreadPolicies& value) {
+    std::lock_guard<std::mutex> lock(policiesMutex);
+    policies = value;
+}
+
+Result ApplyThreadPolicy(const ThreadRole& role) {
+    switch (role) {
+        case ThreadRole::Compute:
+            Tracer::SetThreadName("Compute");
+            break;
+        case ThreadRole::Present:
+            Tracer::SetThreadName("Present");
+            break;
+        case ThreadRole::Worker:
+            Tracer::SetThreadName("Worker");
+            break;
+        case ThreadRole::IO:
+            Tracer::SetThreadName("IO");
+            break;
+        case ThreadRole::Audio:
+            Tracer::SetThreadName("Audio");
+            break;
+    }
+
+    ThreadPolicy policy;
+
+    {
+        std::lock_guard<std::mutex> lock(policiesMutex);
+        policy = policies.get(role);
+    }
+
+    return ApplyThreadPolicy(policy);
+}
+
+Result ParseCoreList(const std::string& list, std::vector<U64>& cores) {
+    cores.clear();
+
+    std::stringstream ss(list);
+    std::string item;
+
+    while (std::getline(ss, item, ',')) {
+        if (item.empty()) {
+            continue;
+        }
+
+        try {
+            const auto dash = item.find('-');
+            const U64 first = std::stoull(item.substr(0, dash));
+            const U64 last = (dash == std::string::npos) ? first : std::stoull(item.substr(dash + 1));
+
+            for (U64 core = first; core <= last; core++) {
+                cores.push_back(core);
+            }
+        } catch (...) {
+            JST_ERROR("[THREAD] Invalid core list '{}'.", list);
+            return Result::ERROR;
+        }
+    }
+
+    return Result::SUCCESS;
+}
+
+Result ApplyThreadPolicy(const ThreadPolicy& policy) {
+    if (!policy.enabled()) {
+        return Result::SUCCESS;
+    }
+
+    Result result = Result::SUCCESS;
+
+    // Resolve the cores of the NUMA node.
+
+    std::vector<U64> cores = policy.cores;
+
+#ifdef JST_OS_LINUX
+    if (cores.empty() && policy.numaNode >= 0) {
+        std::ifstream file(jst::fmt::format("/sys/devices/system/node/node{}/cpulist", policy.numaNode));
+        std::string list;
+
+        if (!file || !std::getline(file, list) || ParseCoreList(list, cores) != Result::SUCCESS) {
+            JST_WARN("[THREAD] Can't read the cores of NUMA node {}.", policy.numaNode);
+            cores.clear();
+            result = Result::WARNING;
+        }
+    }
+#endif
+
+    // Pin to the cores.
+
+    if (!cores.empty()) {
+#ifdef JST_OS_LINUX
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        for (const auto& core : cores) {
+            if (core < CPU_SETSIZE) {
+                CPU_SET(core, &set);
+            }
+        }
+
+        if (pthread_setaffinity_np(pthread_self(), sizeof(set), &set) != 0) {
+            JST_WARN("[THREAD] Can't pin the thread to cores {}.", cores);
+            result = Result::WARNING;
+        }
+#else
+        JST_DEBUG("[THREAD] Thread pinning isn't supported on this platform.");
+#endif
+    }
+
+    // Request a real-time priority.
+
+    if (policy.realtimePriority > 0) {
+#ifdef JST_THREAD_POSIX
+        sched_param param{};
+        param.sched_priority = static_cast<int>(std::clamp<U64>(policy.realtimePriority,
+                                                                sched_get_priority_min(SCHED_FIFO),
+                                                                sched_get_priority_max(SCHED_FIFO)));
+
+        if (pthread_setschedparam(pthread_self(), SCHED_FIFO, &param) != 0) {
+            JST_WARN("[THREAD] Can't set the real-time priority {}. Check the process permissions.",
+                     policy.realtimePriority);
+            result = Result::WARNING;
+        }
+#else
+        JST_DEBUG("[THREAD] Real-time priorities aren't supported on this platform.");
+#endif
+    }
+
+    return result;
+}
+
+}  // namespace Jetstream
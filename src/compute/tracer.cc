@@ -0,0 +1,226 @@
+#include <mutex>
+#include <deque>
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include <fstream>
+#include <unordered_map>
+
+#include "jetstream/compute/tracer.hh"
+#include "jetstream/logger.hh"
+
+namespace Jetstream {
+
+namespace {
+
+// Slots are guarded by a sequence number, odd while being written.
+struct Event {
+    std::atomic<U64> sequence{0};
+    const char* name;
+    const char* category;
+    U64 thread;
+    U64 start;
+    U64 end;
+};
+
+struct State {
+    std::atomic<bool> enabled{false};
+    std::atomic<U64> head{0};
+    std::unique_ptr<Event[]> events;
+    U64 capacity = 0;
+
+    const std::chrono::steady_clock::time_point epoch = std::chrono::steady_clock::now();
+
+    std::mutex mutex;
+    std::deque<std::string> strings;
+    std::unordered_map<std::string, const char*> interned;
+    std::unordered_map<U64, std::string> threadNames;
+};
+
+State& GetState() {
+    static State state;
+    return state;
+}
+
+U64 ThreadId() {
+    static std::atomic<U64> next{1};
+    thread_local const U64 id = next.fetch_add(1, std::memory_order_relaxed);
+    return id;
+}
+
+std::string Escape(const char* value) {
+    std::string escaped;
+    for (const char* c = value; *c; c++) {
+        switch (*c) {
+            case '"':
+                escaped += "\\\"";
+                break;
+            case '\\':
+                escaped += "\\\\";
+                break;
+            default:
+                if (static_cast<unsigned char>(*c) < 0x20) {
+                    escaped += ' ';
+                } else {
+                    escaped += *c;
+                }
+        }
+    }
+    return escaped;
+}
+
+}  // namespace
+
+void Tracer::Enable(const U64& capacity) {
+    auto& state = GetState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+
+    if (state.enabled.load()) {
+        return;
+    }
+
+    // The ring is never freed, writers racing a disable can still use it.
+    if (!state.events) {
+        state.capacity = std::max<U64>(capacity, 1);
+        state.events = std::make_unique<Event[]>(state.capacity);
+    }
+
+    for (U64 i = 0; i < state.capacity; i++) {
+        state.events[i].sequence.store(0, std::memory_order_relaxed);
+    }
+    state.head.store(0, std::memory_order_relaxed);
+
+    state.enabled.store(true, std::memory_order_release);
+
+    JST_INFO("[TRACER] Recording up to {} spans.", state.capacity);
+}
+
+void Tracer::Disable() {
+    GetState().enabled.store(false, std::memory_order_release);
+}
+
+bool Tracer::Enabled() {
+    return GetState().enabled.load(std::memory_order_acquire);
+}
+
+U64 Tracer::Now() {
+    const auto elapsed = std::chrono::steady_clock::now() - GetState().epoch;
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count();
+}
+
+void Tracer::Record(const char* name, const char* category, const U64& start, const U64& end) {
+    auto& state = GetState();
+
+    if (!state.enabled.load(std::memory_order_acquire)) {
+        return;
+    }
+
+    const U64 index = state.head.fetch_add(1, std::memory_order_relaxed);
+    auto& event = state.events[index % state.capacity];
+
+    event.sequence.store(index * 2 + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    event.name = name;
+    event.category = category;
+    event.thread = ThreadId();
+    event.start = start;
+    event.end = end;
+
+    event.sequence.store(index * 2 + 2, std::memory_order_release);
+}
+
+const char* Tracer::Intern(const std::string& name) {
+    auto& state = GetState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+
+    if (auto it = state.interned.find(name); it != state.interned.end()) {
+        return it->second;
+    }
+
+    const char* copy = state.strings.emplace_back(name).c_str();
+    state.interned[name] = copy;
+    return copy;
+}
+
+void Tracer::SetThreadName(const std::string& name) {
+    auto& state = GetState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    state.threadNames[ThreadId()] = name;
+}
+
+Result Tracer::Dump(const std::string& path) {
+    auto& state = GetState();
+
+    std::unordered_map<U64, std::string> threadNames;
+    {
+        std::lock_guard<std::mutex> lock(state.mutex);
+        threadNames = state.threadNames;
+    }
+
+    std::ofstream file(path, std::ios::trunc);
+    if (!file.is_open()) {
+        JST_ERROR("[TRACER] Can't open trace file '{}'.", path);
+        return Result::ERROR;
+    }
+
+    file << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+
+    bool first = true;
+    const auto separator = [&]{
+        if (!first) {
+            file << ",\n";
+        }
+        first = false;
+    };
+
+    for (const auto& [thread, name] : threadNames) {
+        separator();
+        file << jst::fmt::format("{{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":{},"
+                                 "\"args\":{{\"name\":\"{}\"}}}}", thread, Escape(name.c_str()));
+    }
+
+    // Skip slots being written or overwritten while copied.
+    U64 count = 0;
+    const U64 head = state.head.load(std::memory_order_acquire);
+    const U64 firstIndex = (head > state.capacity) ? head - state.capacity : 0;
+    for (U64 index = firstIndex; index < head && state.events; index++) {
+        const auto& event = state.events[index % state.capacity];
+
+        if (event.sequence.load(std::memory_order_acquire) != index * 2 + 2) {
+            continue;
+        }
+        const char* name = event.name;
+        const char* category = event.category;
+        const U64 thread = event.thread;
+        const U64 start = event.start;
+        const U64 end = event.end;
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (event.sequence.load(std::memory_order_relaxed) != index * 2 + 2) {
+            continue;
+        }
+
+        separator();
+        file << jst::fmt::format("{{\"name\":\"{}\",\"cat\":\"{}\",\"ph\":\"X\",\"pid\":1,\"tid\":{},"
+                                 "\"ts\":{:.3f},\"dur\":{:.3f}}}", Escape(name),
+                                                                   Escape(category),
+                                                                   thread,
+                                                                   static_cast<F64>(start) / 1e3,
+                                                                   static_cast<F64>(end - start) / 1e3);
+        count++;
+    }
+
+    file << "]}\n";
+    file.close();
+
+    if (!file) {
+        JST_ERROR("[TRACER] Can't write trace file '{}'.", path);
+        return Result::ERROR;
+    }
+
+    JST_INFO("[TRACER] Wrote {} spans to '{}'.", count, path);
+
+    return Result::SUCCESS;
+}
+
+}  // namespace Jetstream
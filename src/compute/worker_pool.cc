@@ -0,0 +1,192 @@
+#include "jetstream/compute/worker_pool.hh"
+#include "jetstream/compute/thread.hh"
+#include "jetstream/logger.hh"
+
+namespace Jetstream {
+
+namespace {
+
+// Pool and queue index of the calling thread when it is a worker.
+thread_local const WorkerPool* currentPool = nullptr;
+thread_local U64 currentIndex = 0;
+
+}  // namespace
+
+WorkerPool::~WorkerPool() {
+    stop();
+}
+
+Result WorkerPool::start(const U64& count) {
+    if (!workers.empty()) {
+        JST_ERROR("[WORKER_POOL] Pool is already running.");
+        return Result::ERROR;
+    }
+
+    const U64 threadCount = (count == 0) ? std::max(1u, std::thread::hardware_concurrency()) : count;
+
+    JST_DEBUG("[WORKER_POOL] Starting {} worker thread(s).", threadCount);
+
+    halt = false;
+    for (U64 i = 0; i < threadCount; i++) {
+        queues.push_back(std::make_unique<Queue>());
+    }
+    for (U64 i = 0; i < threadCount; i++) {
+        workers.emplace_back(&WorkerPool::workerLoop, this, i);
+    }
+
+    return Result::SUCCESS;
+}
+
+Result WorkerPool::stop() {
+    if (workers.empty()) {
+        return Result::SUCCESS;
+    }
+
+    JST_DEBUG("[WORKER_POOL] Stopping worker threads.");
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        halt = true;
+    }
+    taskCond.notify_all();
+
+    for (auto& worker : workers) {
+        if (worker.joinable()) {
+            worker.join();
+        }
+    }
+    workers.clear();
+    queues.clear();
+
+    return Result::SUCCESS;
+}
+
+void WorkerPool::dispatch(Task&& task) {
+    // Run inline if the pool wasn't started.
+    if (queues.empty()) {
+        task();
+        return;
+    }
+
+    // Workers push to their own queue to keep data hot in cache.
+    const U64 index = (currentPool == this) ? currentIndex : (roundRobin++ % queues.size());
+
+    pending += 1;
+    queued += 1;
+
+    {
+        auto& queue = *queues[index];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        if (currentPool == this) {
+            queue.tasks.push_front(std::move(task));
+        } else {
+            queue.tasks.push_back(std::move(task));
+        }
+    }
+
+    {
+        // Synchronize with sleeping workers to avoid a lost wakeup.
+        std::lock_guard<std::mutex> lock(mutex);
+    }
+    taskCond.notify_one();
+}
+
+void WorkerPool::wait() {
+    // Help with the work if called from a worker to avoid deadlocks.
+    if (currentPool == this) {
+        while (pending > 0) {
+            if (!runPending()) {
+                std::this_thread::yield();
+            }
+        }
+        return;
+    }
+
+    std::unique_lock<std::mutex> lock(mutex);
+    doneCond.wait(lock, [&]{ return pending == 0; });
+}
+
+bool WorkerPool::runPending() {
+    if (queues.empty()) {
+        return false;
+    }
+
+    Task task;
+    const U64 index = (currentPool == this) ? currentIndex : 0;
+
+    if (!pop(index, task) && !steal(index, task)) {
+        return false;
+    }
+
+    task();
+    finish();
+
+    return true;
+}
+
+bool WorkerPool::pop(const U64& index, Task& task) {
+    auto& queue = *queues[index];
+    std::lock_guard<std::mutex> lock(queue.mutex);
+
+    if (queue.tasks.empty()) {
+        return false;
+    }
+
+    task = std::move(queue.tasks.front());
+    queue.tasks.pop_front();
+    queued -= 1;
+
+    return true;
+}
+
+bool WorkerPool::steal(const U64& index, Task& task) {
+    for (U64 i = 1; i < queues.size(); i++) {
+        auto& queue = *queues[(index + i) % queues.size()];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+
+        if (queue.tasks.empty()) {
+            continue;
+        }
+
+        task = std::move(queue.tasks.back());
+        queue.tasks.pop_back();
+        queued -= 1;
+
+        return true;
+    }
+
+    return false;
+}
+
+void WorkerPool::finish() {
+    if (--pending == 0) {
+        std::lock_guard<std::mutex> lock(mutex);
+        doneCond.notify_all();
+    }
+}
+
+void WorkerPool::workerLoop(const U64 index) {
+    currentPool = this;
+    currentIndex = index;
+
+    ApplyThreadPolicy(ThreadRole::Worker);
+
+    while (true) {
+        Task task;
+
+        if (pop(index, task) || steal(index, task)) {
+            task();
+            finish();
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(mutex);
+        taskCond.wait(lock, [&]{ return halt || queued > 0; });
+
+        if (halt && queued == 0) {
+            return;
+        }
+    }
+}
+
+}  // namespace Jetstream
@@ -3,8 +3,10 @@
 #include "jetstream/flowgraph.hh"
 #include "jetstream/instance.hh"
 #include "jetstream/store.hh"
+#include "jetstream/startup.hh"
 
 #include "yaml.hh"
+#include "partition.hh"
 
 namespace Jetstream {
 
@@ -13,6 +15,8 @@ Flowgraph::Flowgraph(Instance& instance) : _instance(instance) {
 }
 
 Flowgraph::~Flowgraph() {
+    stopWorker();
+    _partition.reset();
     _yaml.reset();
 }
 
@@ -50,6 +54,9 @@ Result Flowgraph::destroy() {
     _nodes.clear();
     _nodesOrder.clear();
 
+    // Workers drop their parts once the coordinator disconnects.
+    _partition.reset();
+
     _created = false;
 
     return Result::SUCCESS;
@@ -254,106 +261,298 @@ Result Flowgraph::importFromFile(const std::string& path) {
 }
 
 Result Flowgraph::importFromBlob(const std::vector<char>& blob) {
-    _yaml->data = ryml::parse({blob.data(), blob.size()});
+    JST_STARTUP_PHASE("Flowgraph Import");
 
-    if (_yaml->data.rootref().empty()) {
-        return Result::SUCCESS;
-    }
+    Snapshot snapshot;
 
-    auto root = _yaml->data.rootref()[0];
-    auto configValues = YamlImpl::GatherNodes(root, root, {"protocolVersion",
-                                                           "cyberetherVersion"});
+    if (Snapshot::IsBinary(blob)) {
+        JST_DEBUG("[FLOWGRAPH] Importing binary flowgraph.");
+        _yaml->data.clear();
+        JST_CHECK(Snapshot::FromBinary(blob, snapshot));
+    } else {
+        _yaml->data = ryml::parse({blob.data(), blob.size()});
 
-    _protocolVersion = YamlImpl::ResolveReadable(configValues["protocolVersion"]);
-    _cyberetherVersion = YamlImpl::ResolveReadable(configValues["cyberetherVersion"]);
+        if (_yaml->data.rootref().empty()) {
+            return Result::SUCCESS;
+        }
+
+        JST_CHECK(YamlImpl::ToSnapshot(_yaml->data.rootref()[0], snapshot));
+    }
 
-    if (_protocolVersion != "1.0.0") {
-        JST_ERROR("[FLOWGRAPH] Invalid protocol version '{}'.", _protocolVersion);
+    if (snapshot.protocolVersion != "1.0.0") {
+        JST_ERROR("[FLOWGRAPH] Invalid protocol version '{}'.", snapshot.protocolVersion);
         return Result::ERROR;
     }
 
-    if (_cyberetherVersion != JETSTREAM_VERSION_STR) {
-        JST_WARN("[FLOWGRAPH] Flowgraph was created with a different version of CyberEther ({}).", _cyberetherVersion);
+    if (snapshot.cyberetherVersion != JETSTREAM_VERSION_STR) {
+        JST_WARN("[FLOWGRAPH] Flowgraph was created with a different version of CyberEther ({}).", snapshot.cyberetherVersion);
     }
 
-    auto optConfigValues = YamlImpl::GatherNodes(root, root, {"title",
-                                                              "summary",
-                                                              "author",
-                                                              "license",
-                                                              "description"}, true);
+    _protocolVersion = snapshot.protocolVersion;
+    _cyberetherVersion = snapshot.cyberetherVersion;
 
-    if (optConfigValues.contains("title")) {
-        _title = YamlImpl::ResolveReadable(optConfigValues["title"]);
+    if (!snapshot.title.empty()) {
+        _title = snapshot.title;
     }
-    if (optConfigValues.contains("summary")) {
-        _summary = YamlImpl::ResolveReadable(optConfigValues["summary"]);
+    if (!snapshot.summary.empty()) {
+        _summary = snapshot.summary;
     }
-    if (optConfigValues.contains("author")) {
-        _author = YamlImpl::ResolveReadable(optConfigValues["author"]);
+    if (!snapshot.author.empty()) {
+        _author = snapshot.author;
     }
-    if (optConfigValues.contains("license")) {
-        _license = YamlImpl::ResolveReadable(optConfigValues["license"]);
+    if (!snapshot.license.empty()) {
+        _license = snapshot.license;
     }
-    if (optConfigValues.contains("description")) {
-        _description = YamlImpl::ResolveReadable(optConfigValues["description"]);
+    if (!snapshot.description.empty()) {
+        _description = snapshot.description;
     }
 
-    if (!YamlImpl::HasNode(root, root, "graph")) {
+    if (snapshot.nodes.empty()) {
         return Result::SUCCESS;
     }
-    
-    for (const auto& node : YamlImpl::GetNode(root, root, "graph")) {
-        const auto nodeKey = YamlImpl::ResolveReadableKey(node);
-        JST_DEBUG("[FLOWGRAPH] Processing '{}' module.", nodeKey);
 
-        Block::Fingerprint fingerprint;
-        Parser::RecordMap inputMap;
-        Parser::RecordMap configMap;
-        Parser::RecordMap stateMap;
+    return importSnapshot(snapshot);
+}
 
-        // Populate fingerprint.
+Result Flowgraph::importSnapshot(const Snapshot& snapshot) {
+    if (Partition::IsDistributed(snapshot)) {
+        return importDistributed(snapshot);
+    }
 
-        auto values = YamlImpl::GatherNodes(root, node, {"module", "device", "dataType", "inputDataType", "outputDataType"}, true);
-        fingerprint.id = YamlImpl::ResolveReadable(values["module"]);
-        fingerprint.device = YamlImpl::ResolveReadable(values["device"]);
-        if (values.contains("dataType")) {
-            fingerprint.inputDataType = YamlImpl::ResolveReadable(values["dataType"]);
-        } else if (values.contains("inputDataType") && values.contains("outputDataType")) {
-            fingerprint.inputDataType = YamlImpl::ResolveReadable(values["inputDataType"]);
-            fingerprint.outputDataType = YamlImpl::ResolveReadable(values["outputDataType"]);
+    // References are resolved against the blocks created so far.
+    const auto resolve = [&](const Snapshot::Entry& entry, Parser::Record& record) {
+        if (entry.kind == Snapshot::Entry::Kind::Value) {
+            record = {entry.value};
+            return Result::SUCCESS;
         }
 
-        // Populate data.
+        const Locale locale = {entry.blockKey, entry.moduleKey};
 
-        if (YamlImpl::HasNode(root, node, "config")) {
-            for (const auto& element : YamlImpl::GetNode(root, node, "config")) {
-                auto localPlaceholder = YamlImpl::SolvePlaceholder(root, element);
-                configMap[YamlImpl::ResolveReadableKey(element)] = _yaml->solveLocalPlaceholder(_nodes, localPlaceholder);
-            }
+        if (!_nodes.contains(locale)) {
+            JST_ERROR("[PARSER] Module from the variable '{}' not found.", entry.reference());
+            return Result::ERROR;
         }
 
-        if (YamlImpl::HasNode(root, node, "input")) {
-            for (const auto& element : YamlImpl::GetNode(root, node, "input")) {
-                auto localPlaceholder = YamlImpl::SolvePlaceholder(root, element);
-                inputMap[YamlImpl::ResolveReadableKey(element)] = _yaml->solveLocalPlaceholder(_nodes, localPlaceholder);
-            }
+        const auto& node = _nodes.at(locale);
+        const auto& map = (entry.arrayKey == "input")  ? node->inputMap :
+                          (entry.arrayKey == "output") ? node->outputMap :
+                                                         node->stateMap;
+
+        if (!map.contains(entry.elementKey)) {
+            JST_ERROR("[PARSER] Element from the variable '{}' not found.", entry.reference());
+            return Result::ERROR;
         }
 
-        if (YamlImpl::HasNode(root, node, "interface")) {
-            for (const auto& element : YamlImpl::GetNode(root, node, "interface")) {
-                auto localPlaceholder = YamlImpl::SolvePlaceholder(root, element);
-                stateMap[YamlImpl::ResolveReadableKey(element)] = _yaml->solveLocalPlaceholder(_nodes, localPlaceholder);
+        record = map.at(entry.elementKey);
+        return Result::SUCCESS;
+    };
+
+    const auto populate = [&](const std::vector<Snapshot::Entry>& entries, Parser::RecordMap& map) {
+        for (const auto& entry : entries) {
+            JST_CHECK(resolve(entry, map[entry.key]));
+        }
+        return Result::SUCCESS;
+    };
+
+    // Create all blocks before building the compute graphs.
+    return _instance.transaction([&]{
+        for (const auto& node : snapshot.nodes) {
+            JST_DEBUG("[FLOWGRAPH] Processing '{}' module.", node.key);
+
+            const auto& fingerprint = node.fingerprint;
+            Parser::RecordMap inputMap;
+            Parser::RecordMap configMap;
+            Parser::RecordMap stateMap;
+
+            JST_CHECK(populate(node.config, configMap));
+            JST_CHECK(populate(node.input, inputMap));
+            JST_CHECK(populate(node.interface, stateMap));
+
+            if (_syntheticSources && (fingerprint.id == "soapy" ||
+                                      fingerprint.id == "file-reader" ||
+                                      fingerprint.id == "network-source" ||
+                                      fingerprint.id == "shared-memory-source")) {
+                JST_CHECK(addSyntheticSource(node.key, fingerprint, configMap));
+                continue;
+            }
+
+            if (!Store::BlockConstructorList().contains(fingerprint)) {
+                JST_ERROR("[FLOWGRAPH] Can't find module with such a signature ({}).", fingerprint);
+                return Result::ERROR;
             }
+
+            JST_CHECK(Store::BlockConstructorList().at(fingerprint)(_instance, node.key, configMap, inputMap, stateMap));
         }
 
-        if (!Store::BlockConstructorList().contains(fingerprint)) {
-            JST_ERROR("[FLOWGRAPH] Can't find module with such a signature ({}).", fingerprint);
-            return Result::ERROR;
+        return Result::SUCCESS;
+    });
+}
+
+Result Flowgraph::exportToSnapshot(std::vector<char>& blob) {
+    JST_DEBUG("[FLOWGRAPH] Exporting flowgraph to binary blob.");
+
+    // Values are written as YAML text, read them back like a file would.
+    std::vector<char> yaml = {'-', '-', '-', '\n'};
+    std::vector<char> data;
+    JST_CHECK(exportToBlob(data));
+    yaml.insert(yaml.end(), data.begin(), data.end());
+
+    JST_CHECK(ConvertToSnapshot(yaml, blob));
+
+    return Result::SUCCESS;
+}
+
+bool Flowgraph::IsSnapshot(const std::vector<char>& blob) {
+    return Snapshot::IsBinary(blob);
+}
+
+Result Flowgraph::ConvertToSnapshot(const std::vector<char>& yaml, std::vector<char>& snapshot) {
+    if (Snapshot::IsBinary(yaml)) {
+        snapshot = yaml;
+        return Result::SUCCESS;
+    }
+
+    const auto tree = ryml::parse_in_arena(ryml::csubstr(yaml.data(), yaml.size()));
+
+    if (tree.rootref().empty()) {
+        JST_ERROR("[FLOWGRAPH] Flowgraph is empty.");
+        return Result::ERROR;
+    }
+
+    Snapshot data;
+    JST_CHECK(YamlImpl::ToSnapshot(tree.rootref()[0], data));
+    JST_CHECK(Snapshot::ToBinary(data, snapshot));
+
+    return Result::SUCCESS;
+}
+
+Result Flowgraph::ConvertToYaml(const std::vector<char>& snapshot, std::vector<char>& yaml) {
+    if (!Snapshot::IsBinary(snapshot)) {
+        yaml = snapshot;
+        return Result::SUCCESS;
+    }
+
+    Snapshot data;
+    JST_CHECK(Snapshot::FromBinary(snapshot, data));
+    JST_CHECK(YamlImpl::FromSnapshot(data, yaml));
+
+    return Result::SUCCESS;
+}
+
+Result Flowgraph::ConvertFile(const std::string& inputPath, const std::string& outputPath) {
+    if (!std::filesystem::exists(inputPath)) {
+        JST_ERROR("[FLOWGRAPH] Flowgraph file '{}' doesn't exist.", inputPath);
+        return Result::ERROR;
+    }
+
+    std::fstream input(inputPath, std::ios::in | std::ios::binary);
+    if (!input) {
+        JST_ERROR("[FLOWGRAPH] Can't open flowgraph file '{}'.", inputPath);
+        return Result::ERROR;
+    }
+
+    std::vector<char> blob(std::filesystem::file_size(inputPath), 0);
+    input.read(blob.data(), blob.size());
+    input.close();
+
+    const auto extension = std::filesystem::path(outputPath).extension().string();
+    const bool yaml = (extension == ".yml" || extension == ".yaml");
+
+    std::vector<char> converted;
+    if (yaml) {
+        JST_CHECK(ConvertToYaml(blob, converted));
+    } else {
+        JST_CHECK(ConvertToSnapshot(blob, converted));
+    }
+
+    std::fstream output(outputPath, std::ios::out | std::ios::binary | std::ios::trunc);
+    if (!output) {
+        JST_ERROR("[FLOWGRAPH] Can't open flowgraph file '{}'.", outputPath);
+        return Result::ERROR;
+    }
+    output.write(converted.data(), converted.size());
+    output.close();
+
+    JST_INFO("[FLOWGRAPH] Converted '{}' to {} flowgraph '{}' ({} bytes).", inputPath,
+                                                                           (yaml) ? "YAML" : "binary",
+                                                                           outputPath,
+                                                                           converted.size());
+
+    return Result::SUCCESS;
+}
+
+Result Flowgraph::addSyntheticSource(const std::string& nodeKey,
+                                     const Block::Fingerprint& fingerprint,
+                                     Parser::RecordMap& configMap) {
+    const auto value = [&](const std::string& key, const std::string& fallback) -> std::string {
+        if (!configMap.contains(key)) {
+            return fallback;
         }
+        return std::any_cast<std::string>(configMap.at(key).object);
+    };
+
+    // Output shape of the source. Defaults match the block configuration.
+
+    std::string shape;
+
+    if (fingerprint.id == "soapy") {
+        const auto channels = std::stoull(value("numberOfChannels", "1"));
+        shape = jst::fmt::format("[{}, {}]", value("numberOfBatches", "8"), value("numberOfTimeSamples", "8192"));
+        if (channels > 1) {
+            shape = jst::fmt::format("[{}, {}", channels, shape.substr(1));
+        }
+    } else if (fingerprint.id == "file-reader") {
+        const auto batchSize = std::stoull(value("batchSize", "1"));
+        shape = value("shape", "[8192]");
+        if (batchSize > 1) {
+            shape = jst::fmt::format("[{}, {}", batchSize, shape.substr(1));
+        }
+    } else {
+        shape = value("shape", "[8192]");
+    }
 
-        JST_CHECK(Store::BlockConstructorList().at(fingerprint)(_instance, nodeKey, configMap, inputMap, stateMap));
+    U64 size = 1;
+    std::regex re(R"(\d+)");
+    for (std::sregex_iterator it(shape.begin(), shape.end(), re), end; it != end; it++) {
+        size *= std::stoull(it->str());
     }
 
+    JST_INFO("[FLOWGRAPH] Replacing source '{}' with synthetic noise of shape {}.", nodeKey, shape);
+
+    // Noise generator feeding a reshape named after the source.
+
+    const auto generatorKey = jst::fmt::format("{}_synthetic", nodeKey);
+
+    Block::Fingerprint generator = fingerprint;
+    generator.id = "signal_generator";
+
+    Parser::RecordMap generatorConfig;
+    generatorConfig["signalType"] = {std::string("Noise")};
+    generatorConfig["bufferSize"] = {std::to_string(size)};
+    if (configMap.contains("sampleRate")) {
+        generatorConfig["sampleRate"] = configMap.at("sampleRate");
+    }
+
+    Block::Fingerprint reshape = fingerprint;
+    reshape.id = "reshape";
+
+    Parser::RecordMap reshapeConfig;
+    reshapeConfig["shape"] = {shape};
+
+    for (const auto& substitute : {generator, reshape}) {
+        if (!Store::BlockConstructorList().contains(substitute)) {
+            JST_ERROR("[FLOWGRAPH] Can't find module with such a signature ({}).", substitute);
+            return Result::ERROR;
+        }
+    }
+
+    Parser::RecordMap emptyInput, emptyState;
+    JST_CHECK(Store::BlockConstructorList().at(generator)(_instance, generatorKey, generatorConfig, emptyInput, emptyState));
+
+    Parser::RecordMap reshapeInput, reshapeState;
+    reshapeInput["buffer"] = _nodes.at({generatorKey})->outputMap.at("buffer");
+    JST_CHECK(Store::BlockConstructorList().at(reshape)(_instance, nodeKey, reshapeConfig, reshapeInput, reshapeState));
+
     return Result::SUCCESS;
 }
 
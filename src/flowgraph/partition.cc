@@ -0,0 +1,669 @@
+#include <map>
+#include <set>
+#include <sstream>
+#include <algorithm>
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+
+#include <netdb.h>
+#include <unistd.h>
+#include <sys/time.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <arpa/inet.h>
+
+#include "jetstream/flowgraph.hh"
+#include "jetstream/instance.hh"
+
+#include "partition.hh"
+
+namespace Jetstream {
+
+namespace {
+
+// Header of the messages exchanged between a coordinator and a worker. The
+// coordinator first sends the shared token of the worker, then a binary
+// flowgraph. The worker answers each with a status, and the flowgraph with
+// the streams of its part, one `key dataType shape` line each.
+struct Message {
+    static constexpr U32 Magic = 0x5054534A;  // "JSTP"
+    // Larger payloads are rejected before allocating them.
+    static constexpr U64 MaxSize = U64(256) << 20;
+
+    U32 magic;
+    U32 status;
+    U64 size;
+};
+
+// Seconds a coordinator has to present its token.
+constexpr time_t AuthTimeout = 10;
+
+bool SendAll(const int& fd, const void* data, const U64& size) {
+    const auto* bytes = static_cast<const char*>(data);
+    for (U64 offset = 0; offset < size;) {
+        const ssize_t count = send(fd, bytes + offset, size - offset, MSG_NOSIGNAL);
+        if (count <= 0) {
+            if (count < 0 && errno == EINTR) {
+                continue;
+            }
+            return false;
+        }
+        offset += count;
+    }
+    return true;
+}
+
+bool ReceiveAll(const int& fd, void* data, const U64& size) {
+    auto* bytes = static_cast<char*>(data);
+    for (U64 offset = 0; offset < size;) {
+        const ssize_t count = recv(fd, bytes + offset, size - offset, 0);
+        if (count <= 0) {
+            if (count < 0 && errno == EINTR) {
+                continue;
+            }
+            return false;
+        }
+        offset += count;
+    }
+    return true;
+}
+
+bool SendMessage(const int& fd, const U32& status, const std::string& payload) {
+    const Message message = {Message::Magic, status, payload.size()};
+    return SendAll(fd, &message, sizeof(message)) &&
+           SendAll(fd, payload.data(), payload.size());
+}
+
+bool ReceiveMessage(const int& fd, U32& status, std::vector<char>& payload) {
+    Message message;
+    if (!ReceiveAll(fd, &message, sizeof(message)) || message.magic != Message::Magic) {
+        return false;
+    }
+    if (message.size > Message::MaxSize) {
+        JST_ERROR("[FLOWGRAPH] Message of {} bytes is larger than the limit ({} bytes).", message.size, Message::MaxSize);
+        return false;
+    }
+    status = message.status;
+    payload.resize(message.size);
+    return ReceiveAll(fd, payload.data(), payload.size());
+}
+
+// Compares without leaking the length of the matching prefix.
+bool TokenMatches(const std::vector<char>& received, const std::string& token) {
+    if (received.size() != token.size()) {
+        return false;
+    }
+    U8 difference = 0;
+    for (U64 i = 0; i < token.size(); i++) {
+        difference |= static_cast<U8>(received[i] ^ token[i]);
+    }
+    return difference == 0;
+}
+
+void SetReceiveTimeout(const int& fd, const time_t& seconds) {
+    timeval timeout = {};
+    timeout.tv_sec = seconds;
+    setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+}
+
+}  // namespace
+
+Flowgraph::Partition::~Partition() {
+    for (const auto& [_, fd] : workers) {
+        close(fd);
+    }
+}
+
+bool Flowgraph::Partition::IsDistributed(const Snapshot& snapshot) {
+    return std::ranges::any_of(snapshot.nodes, [](const Snapshot::Node& node) {
+        return !HostOf(node).empty();
+    });
+}
+
+std::string Flowgraph::Partition::HostOf(const Snapshot::Node& node) {
+    for (const auto& entry : node.interface) {
+        if (entry.key == "host" && entry.kind == Snapshot::Entry::Kind::Value) {
+            return entry.value;
+        }
+    }
+    return "";
+}
+
+std::pair<std::string, U64> Flowgraph::Partition::SplitHost(const std::string& host) {
+    const auto colon = host.rfind(':');
+    if (colon == std::string::npos) {
+        return {host, WorkerPort};
+    }
+    return {host.substr(0, colon), std::stoull(host.substr(colon + 1))};
+}
+
+Result Flowgraph::Partition::plan(const Snapshot& snapshot) {
+    std::unordered_map<std::string, const Snapshot::Node*> nodes;
+    std::unordered_map<std::string, std::string> nodeHosts;
+
+    for (const auto& node : snapshot.nodes) {
+        nodes[node.key] = &node;
+        nodeHosts[node.key] = HostOf(node);
+
+        if (std::ranges::find(hosts, nodeHosts[node.key]) == hosts.end()) {
+            hosts.push_back(nodeHosts[node.key]);
+        }
+    }
+
+    // Find the tensors crossing hosts. Consumers on the same host share a stream.
+
+    std::map<std::pair<std::string, std::string>, U64> streams;
+    std::map<std::string, std::set<std::string>> dependencies;
+
+    for (const auto& node : snapshot.nodes) {
+        const auto& consumerHost = nodeHosts[node.key];
+
+        for (const auto& entry : node.input) {
+            if (entry.kind != Snapshot::Entry::Kind::Reference) {
+                continue;
+            }
+
+            if (!nodes.contains(entry.blockKey)) {
+                JST_ERROR("[FLOWGRAPH] Block from the variable '{}' not found.", entry.reference());
+                return Result::ERROR;
+            }
+
+            const auto& producerHost = nodeHosts[entry.blockKey];
+
+            if (producerHost == consumerHost) {
+                continue;
+            }
+
+            const auto stream = std::make_pair(entry.reference(), consumerHost);
+            if (streams.contains(stream)) {
+                continue;
+            }
+            streams[stream] = cuts.size();
+
+            // The sink is created before the producer runs, its type comes
+            // from the signature of the producer.
+            const auto& fingerprint = nodes.at(entry.blockKey)->fingerprint;
+
+            auto& cut = cuts.emplace_back();
+            cut.producerHost = producerHost;
+            cut.consumerHost = consumerHost;
+            cut.reference = entry;
+            cut.producerDataType = fingerprint.outputDataType.empty() ? fingerprint.inputDataType :
+                                                                        fingerprint.outputDataType;
+            cut.sinkKey = jst::fmt::format("cut{}_sink", streams[stream]);
+            cut.sourceKey = jst::fmt::format("cut{}_source", streams[stream]);
+            cut.port = StreamPort + streams[stream];
+
+            dependencies[consumerHost].insert(producerHost);
+        }
+    }
+
+    // Order hosts so every producer part starts before its consumers.
+
+    std::vector<std::string> ordered;
+    std::set<std::string> started;
+
+    while (ordered.size() < hosts.size()) {
+        const auto next = std::ranges::find_if(hosts, [&](const std::string& host) {
+            return !started.contains(host) && std::ranges::all_of(dependencies[host], [&](const std::string& producer) {
+                return started.contains(producer);
+            });
+        });
+
+        if (next == hosts.end()) {
+            JST_ERROR("[FLOWGRAPH] Hosts of the distributed flowgraph depend on each other. "
+                      "Streams between hosts have to flow in one direction.");
+            return Result::ERROR;
+        }
+
+        started.insert(*next);
+        ordered.push_back(*next);
+    }
+
+    hosts = ordered;
+
+    JST_INFO("[FLOWGRAPH] Distributing flowgraph across {} hosts with {} streams.", hosts.size(), cuts.size());
+
+    return Result::SUCCESS;
+}
+
+Result Flowgraph::Partition::build(const Snapshot& snapshot, const std::string& host, Snapshot& part) const {
+    part.protocolVersion = snapshot.protocolVersion;
+    part.cyberetherVersion = snapshot.cyberetherVersion;
+    part.title = snapshot.title;
+    part.summary = snapshot.summary;
+    part.author = snapshot.author;
+    part.license = snapshot.license;
+    part.description = snapshot.description;
+
+    const auto value = [](const std::string& key, const std::string& value) {
+        Snapshot::Entry entry;
+        entry.key = key;
+        entry.value = value;
+        return entry;
+    };
+
+    // Sources receiving the tensors produced by other hosts.
+
+    for (const auto& cut : cuts) {
+        if (cut.consumerHost != host) {
+            continue;
+        }
+
+        if (cut.shape.empty()) {
+            JST_ERROR("[FLOWGRAPH] Stream '{}' has no shape. Its producer part didn't start.", cut.reference.reference());
+            return Result::ERROR;
+        }
+
+        auto& node = part.nodes.emplace_back();
+        node.key = cut.sourceKey;
+        node.fingerprint = {"network-source", "cpu", cut.dataType, ""};
+        node.config = {
+            value("protocol", "TCP"),
+            value("address", streamAddress(cut.producerHost, cut.consumerHost)),
+            value("port", std::to_string(cut.port)),
+            value("shape", cut.shape),
+        };
+    }
+
+    // Blocks of the host, reading streams instead of remote blocks.
+
+    for (const auto& node : snapshot.nodes) {
+        if (HostOf(node) != host) {
+            continue;
+        }
+
+        auto& local = part.nodes.emplace_back(node);
+
+        std::erase_if(local.interface, [](const Snapshot::Entry& entry) {
+            return entry.key == "host";
+        });
+
+        for (auto& entry : local.input) {
+            if (entry.kind != Snapshot::Entry::Kind::Reference) {
+                continue;
+            }
+
+            const auto cut = std::ranges::find_if(cuts, [&](const Cut& cut) {
+                return cut.consumerHost == host && cut.reference.reference() == entry.reference();
+            });
+
+            if (cut == cuts.end()) {
+                continue;
+            }
+
+            entry.blockKey = cut->sourceKey;
+            entry.moduleKey = "";
+            entry.arrayKey = "output";
+            entry.elementKey = "buffer";
+        }
+    }
+
+    // Sinks streaming the tensors read by other hosts.
+
+    for (const auto& cut : cuts) {
+        if (cut.producerHost != host) {
+            continue;
+        }
+
+        auto& node = part.nodes.emplace_back();
+        node.key = cut.sinkKey;
+        node.fingerprint = {"network-sink", "cpu", cut.producerDataType, ""};
+        node.config = {
+            value("protocol", "TCP"),
+            value("address", "0.0.0.0"),
+            value("port", std::to_string(cut.port)),
+        };
+        node.input = {cut.reference};
+        node.input.front().key = "buffer";
+    }
+
+    return Result::SUCCESS;
+}
+
+std::string Flowgraph::Partition::streamAddress(const std::string& producerHost,
+                                                const std::string& consumerHost) const {
+    if (!producerHost.empty()) {
+        return SplitHost(producerHost).first;
+    }
+
+    // The coordinator is reached at the address its worker connection uses.
+
+    if (!workers.contains(consumerHost)) {
+        return "127.0.0.1";
+    }
+
+    sockaddr_in local = {};
+    socklen_t length = sizeof(local);
+    if (getsockname(workers.at(consumerHost), reinterpret_cast<sockaddr*>(&local), &length) != 0) {
+        return "127.0.0.1";
+    }
+
+    char address[INET_ADDRSTRLEN];
+    inet_ntop(AF_INET, &local.sin_addr, address, sizeof(address));
+    return address;
+}
+
+Result Flowgraph::Partition::connect(const std::string& host) {
+    if (workers.contains(host)) {
+        return Result::SUCCESS;
+    }
+
+    const auto [address, port] = SplitHost(host);
+
+    addrinfo hints = {};
+    hints.ai_family = AF_INET;
+    hints.ai_socktype = SOCK_STREAM;
+
+    addrinfo* result = nullptr;
+    if (getaddrinfo(address.c_str(), std::to_string(port).c_str(), &hints, &result) != 0 || !result) {
+        JST_ERROR("[FLOWGRAPH] Failed to resolve worker '{}'.", host);
+        return Result::ERROR;
+    }
+
+    const int fd = socket(AF_INET, SOCK_STREAM, 0);
+    if (fd < 0) {
+        freeaddrinfo(result);
+        JST_ERROR("[FLOWGRAPH] Failed to create socket ({}).", std::strerror(errno));
+        return Result::ERROR;
+    }
+
+    if (::connect(fd, result->ai_addr, result->ai_addrlen) != 0) {
+        freeaddrinfo(result);
+        close(fd);
+        JST_ERROR("[FLOWGRAPH] Failed to connect to worker '{}' ({}).", host, std::strerror(errno));
+        return Result::ERROR;
+    }
+    freeaddrinfo(result);
+
+    const int noDelay = 1;
+    setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &noDelay, sizeof(noDelay));
+
+    // Present the shared token before sending anything else.
+
+    U32 status;
+    std::vector<char> reply;
+
+    if (!SendMessage(fd, 0, token) || !ReceiveMessage(fd, status, reply) || status != 0) {
+        close(fd);
+        JST_ERROR("[FLOWGRAPH] Worker '{}' rejected the token.", host);
+        return Result::ERROR;
+    }
+
+    workers[host] = fd;
+
+    return Result::SUCCESS;
+}
+
+Result Flowgraph::Partition::deploy(const std::string& host, const Snapshot& part) {
+    JST_INFO("[FLOWGRAPH] Starting {} blocks on worker '{}'.", part.nodes.size(), host);
+
+    std::vector<char> blob;
+    JST_CHECK(Snapshot::ToBinary(part, blob));
+
+    const auto& fd = workers.at(host);
+
+    U32 status;
+    std::vector<char> reply;
+
+    if (!SendMessage(fd, 0, std::string(blob.begin(), blob.end())) || !ReceiveMessage(fd, status, reply)) {
+        JST_ERROR("[FLOWGRAPH] Lost connection to worker '{}'.", host);
+        return Result::ERROR;
+    }
+
+    if (status != 0) {
+        JST_ERROR("[FLOWGRAPH] Worker '{}' failed to start its part: {}", host, std::string(reply.begin(), reply.end()));
+        return Result::ERROR;
+    }
+
+    // Streams produced by the worker.
+
+    std::istringstream lines(std::string(reply.begin(), reply.end()));
+    std::string line;
+
+    while (std::getline(lines, line)) {
+        std::istringstream fields(line);
+        std::string key;
+        std::string dataType;
+        fields >> key >> dataType;
+
+        std::string shape;
+        std::getline(fields >> std::ws, shape);
+
+        for (auto& cut : cuts) {
+            if (cut.sinkKey == key) {
+                cut.dataType = dataType;
+                cut.shape = shape;
+            }
+        }
+    }
+
+    return Result::SUCCESS;
+}
+
+Result Flowgraph::importDistributed(const Snapshot& snapshot) {
+    auto partition = std::make_unique<Partition>();
+    partition->token = WorkerToken(_workerToken);
+    JST_CHECK(partition->plan(snapshot));
+
+    if (partition->token.empty()) {
+        JST_ERROR("[FLOWGRAPH] Distributed flowgraphs need the token of the workers. "
+                  "Set it with `--worker-token` or `JST_WORKER_TOKEN`.");
+        return Result::ERROR;
+    }
+
+    for (const auto& host : partition->hosts) {
+        if (!host.empty()) {
+            JST_CHECK(partition->connect(host));
+        }
+
+        Snapshot part;
+        JST_CHECK(partition->build(snapshot, host, part));
+
+        if (!host.empty()) {
+            JST_CHECK(partition->deploy(host, part));
+            continue;
+        }
+
+        JST_CHECK(importSnapshot(part));
+
+        // Streams produced here.
+
+        for (auto& cut : partition->cuts) {
+            if (cut.producerHost != host || !_nodes.contains({cut.sinkKey})) {
+                continue;
+            }
+
+            const auto& input = _nodes.at({cut.sinkKey})->inputMap;
+            if (!input.contains("buffer")) {
+                continue;
+            }
+
+            cut.dataType = input.at("buffer").dataType;
+            cut.shape = jst::fmt::format("{}", input.at("buffer").shape);
+        }
+    }
+
+    _partition = std::move(partition);
+
+    return Result::SUCCESS;
+}
+
+std::string Flowgraph::WorkerToken(const std::string& token) {
+    if (!token.empty()) {
+        return token;
+    }
+    if (const char* env = std::getenv("JST_WORKER_TOKEN")) {
+        return env;
+    }
+    return "";
+}
+
+Result Flowgraph::startWorker(const U64& port, const std::string& host) {
+    if (_worker) {
+        JST_ERROR("[FLOWGRAPH] Worker is already running.");
+        return Result::ERROR;
+    }
+
+    auto worker = std::make_unique<Worker>();
+    worker->token = WorkerToken(_workerToken);
+
+    // Anyone reaching the worker can run blocks on this host, like file
+    // writers and transmitters, so a token is always required.
+
+    if (worker->token.empty()) {
+        JST_ERROR("[FLOWGRAPH] The worker needs a token shared with its coordinators. "
+                  "Set it with `--worker-token` or `JST_WORKER_TOKEN`.");
+        return Result::ERROR;
+    }
+
+    sockaddr_in address = {};
+    address.sin_family = AF_INET;
+    address.sin_port = htons(static_cast<U16>(port));
+
+    if (inet_pton(AF_INET, host.c_str(), &address.sin_addr) != 1) {
+        JST_ERROR("[FLOWGRAPH] Invalid worker address '{}'. Expected an IPv4 address.", host);
+        return Result::ERROR;
+    }
+
+    worker->fd = socket(AF_INET, SOCK_STREAM, 0);
+    if (worker->fd < 0) {
+        JST_ERROR("[FLOWGRAPH] Failed to create socket ({}).", std::strerror(errno));
+        return Result::ERROR;
+    }
+
+    const int reuse = 1;
+    setsockopt(worker->fd, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+
+    if (bind(worker->fd, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0 ||
+        listen(worker->fd, 1) != 0) {
+        JST_ERROR("[FLOWGRAPH] Failed to listen on {}:{} ({}).", host, port, std::strerror(errno));
+        close(worker->fd);
+        return Result::ERROR;
+    }
+
+    JST_INFO("[FLOWGRAPH] Worker waiting for a coordinator on {}:{}.", host, port);
+
+    worker->running = true;
+    worker->thread = std::thread([&, worker = worker.get()]{
+        while (worker->running) {
+            const int client = accept(worker->fd, nullptr, nullptr);
+            if (client < 0) {
+                continue;
+            }
+
+            worker->client = client;
+            if (worker->serve(*this, client) != Result::SUCCESS) {
+                JST_ERROR("[FLOWGRAPH] Worker failed to serve the coordinator.");
+            }
+            worker->client = -1;
+            close(client);
+        }
+    });
+
+    _worker = std::move(worker);
+
+    return Result::SUCCESS;
+}
+
+Result Flowgraph::stopWorker() {
+    if (!_worker) {
+        return Result::SUCCESS;
+    }
+
+    _worker->running = false;
+
+    // Unblock the accept and the coordinator connection.
+
+    shutdown(_worker->fd, SHUT_RDWR);
+    const int client = _worker->client;
+    if (client >= 0) {
+        shutdown(client, SHUT_RDWR);
+    }
+
+    if (_worker->thread.joinable()) {
+        _worker->thread.join();
+    }
+
+    close(_worker->fd);
+    _worker.reset();
+
+    return Result::SUCCESS;
+}
+
+Result Flowgraph::Worker::serve(Flowgraph& flowgraph, const int& client) {
+    U32 status;
+    std::vector<char> blob;
+
+    // Check the token of the coordinator before accepting a graph.
+
+    SetReceiveTimeout(client, AuthTimeout);
+
+    if (!ReceiveMessage(client, status, blob) || !TokenMatches(blob, token)) {
+        SendMessage(client, 1, "Invalid token.");
+        JST_ERROR("[FLOWGRAPH] Coordinator presented an invalid token.");
+        return Result::ERROR;
+    }
+
+    SetReceiveTimeout(client, 0);
+
+    if (!SendMessage(client, 0, "")) {
+        JST_ERROR("[FLOWGRAPH] Lost connection to coordinator.");
+        return Result::ERROR;
+    }
+
+    if (!ReceiveMessage(client, status, blob)) {
+        JST_ERROR("[FLOWGRAPH] Invalid message from coordinator.");
+        return Result::ERROR;
+    }
+
+    // Replace the running flowgraph by the part.
+
+    const auto res = [&]{
+        JST_CHECK(flowgraph._instance.reset());
+        JST_CHECK(flowgraph.destroy());
+        JST_CHECK(flowgraph.create());
+        JST_CHECK(flowgraph.importFromBlob(blob));
+        return Result::SUCCESS;
+    }();
+
+    if (res != Result::SUCCESS) {
+        SendMessage(client, 1, JST_LOG_LAST_ERROR());
+        return flowgraph._instance.reset();
+    }
+
+    // Report the streams of the part.
+
+    std::string reply;
+
+    for (const auto& [locale, node] : flowgraph._nodes) {
+        if (!node->block || node->fingerprint.id != "network-sink" || !node->inputMap.contains("buffer")) {
+            continue;
+        }
+
+        const auto& input = node->inputMap.at("buffer");
+        reply += jst::fmt::format("{} {} {}\n", locale.blockId, input.dataType, input.shape);
+    }
+
+    if (!SendMessage(client, 0, reply)) {
+        JST_ERROR("[FLOWGRAPH] Lost connection to coordinator.");
+    } else {
+        JST_INFO("[FLOWGRAPH] Running part with {} blocks.", flowgraph._nodes.size());
+
+        // Run until the coordinator disconnects.
+
+        char byte;
+        while (recv(client, &byte, 1, 0) > 0) {}
+    }
+
+    JST_INFO("[FLOWGRAPH] Coordinator disconnected. Stopping part.");
+
+    JST_CHECK(flowgraph._instance.reset());
+    JST_CHECK(flowgraph.destroy());
+
+    return Result::SUCCESS;
+}
+
+}  // namespace Jetstream
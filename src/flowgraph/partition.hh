@@ -0,0 +1,83 @@
+#ifndef JETSTREAM_FLOWGRAPH_PARTITION_HH
+#define JETSTREAM_FLOWGRAPH_PARTITION_HH
+
+#include <atomic>
+#include <thread>
+#include <unordered_map>
+
+#include "snapshot.hh"
+
+namespace Jetstream {
+
+// Flowgraph split across hosts. Blocks with a `host` in their interface run on
+// the worker listening at that address, the others run on the coordinator
+// importing the flowgraph. Every tensor crossing hosts is streamed over TCP by
+// a Network Sink on the producer host and a Network Source on the consumer
+// host. Parts are started in dependency order, so the shape of each stream is
+// known before its source is created.
+
+struct Flowgraph::Partition {
+    static constexpr U64 WorkerPort = 5100;
+    static constexpr U64 StreamPort = 5200;
+
+    // Tensor streamed from one host to another.
+    struct Cut {
+        std::string producerHost;
+        std::string consumerHost;
+        Snapshot::Entry reference;
+        std::string producerDataType;
+
+        std::string sinkKey;
+        std::string sourceKey;
+        U64 port;
+
+        // Filled once the producer part is running.
+        std::string dataType;
+        std::string shape;
+    };
+
+    // Hosts in dependency order. The coordinator is the empty host.
+    std::vector<std::string> hosts;
+    std::vector<Cut> cuts;
+
+    // Control connections of the workers running remote parts. Closing
+    // one makes the worker drop its part.
+    std::unordered_map<std::string, int> workers;
+
+    // Shared token presented to the workers.
+    std::string token;
+
+    ~Partition();
+
+    static bool IsDistributed(const Snapshot& snapshot);
+    static std::string HostOf(const Snapshot::Node& node);
+
+    Result plan(const Snapshot& snapshot);
+    Result build(const Snapshot& snapshot, const std::string& host, Snapshot& part) const;
+
+    Result connect(const std::string& host);
+    Result deploy(const std::string& host, const Snapshot& part);
+
+    // Address the consumer host uses to reach the producer host.
+    std::string streamAddress(const std::string& producerHost, const std::string& consumerHost) const;
+
+    static std::pair<std::string, U64> SplitHost(const std::string& host);
+};
+
+// Listener running the parts sent by coordinators, one at a time.
+
+struct Flowgraph::Worker {
+    int fd = -1;
+    std::atomic<int> client = -1;
+    std::atomic<bool> running = false;
+    std::thread thread;
+
+    // Shared token coordinators present before sending a part.
+    std::string token;
+
+    Result serve(Flowgraph& flowgraph, const int& client);
+};
+
+}  // namespace Jetstream
+
+#endif
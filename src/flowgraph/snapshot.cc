@@ -0,0 +1,285 @@
+#include <cstring>
+
+#include "snapshot.hh"
+
+namespace Jetstream {
+
+namespace {
+
+// Header of a binary flowgraph, followed by the version of the format.
+constexpr char Magic[4] = {'J', 'S', 'T', 'F'};
+constexpr U32 Version = 1;
+
+class Writer {
+ public:
+    explicit Writer(std::vector<char>& blob) : blob(blob) {}
+
+    void bytes(const void* data, const U64& size) {
+        const auto* begin = static_cast<const char*>(data);
+        blob.insert(blob.end(), begin, begin + size);
+    }
+
+    void u8(const U8& value) {
+        bytes(&value, sizeof(value));
+    }
+
+    void u32(const U32& value) {
+        bytes(&value, sizeof(value));
+    }
+
+    void string(const std::string& value) {
+        u32(static_cast<U32>(value.size()));
+        bytes(value.data(), value.size());
+    }
+
+ private:
+    std::vector<char>& blob;
+};
+
+class Reader {
+ public:
+    explicit Reader(const std::vector<char>& blob) : blob(blob) {}
+
+    Result bytes(void* data, const U64& size) {
+        if (offset + size > blob.size()) {
+            JST_ERROR("[FLOWGRAPH] Binary flowgraph is truncated.");
+            return Result::ERROR;
+        }
+        std::memcpy(data, blob.data() + offset, size);
+        offset += size;
+        return Result::SUCCESS;
+    }
+
+    Result u8(U8& value) {
+        return bytes(&value, sizeof(value));
+    }
+
+    Result u32(U32& value) {
+        return bytes(&value, sizeof(value));
+    }
+
+    Result string(std::string& value) {
+        U32 size;
+        JST_CHECK(u32(size));
+        if (offset + size > blob.size()) {
+            JST_ERROR("[FLOWGRAPH] Binary flowgraph is truncated.");
+            return Result::ERROR;
+        }
+        value.assign(blob.data() + offset, size);
+        offset += size;
+        return Result::SUCCESS;
+    }
+
+    // Reads a number of elements, each taking at least `minSize` bytes. Counts
+    // the remaining bytes can't hold are rejected before anything is reserved.
+    Result count(U32& value, const U64& minSize) {
+        JST_CHECK(u32(value));
+        if (value * minSize > blob.size() - offset) {
+            JST_ERROR("[FLOWGRAPH] Binary flowgraph is truncated.");
+            return Result::ERROR;
+        }
+        return Result::SUCCESS;
+    }
+
+    bool done() const {
+        return offset == blob.size();
+    }
+
+ private:
+    const std::vector<char>& blob;
+    U64 offset = 0;
+};
+
+void WriteEntries(Writer& writer, const std::vector<Flowgraph::Snapshot::Entry>& entries) {
+    writer.u32(static_cast<U32>(entries.size()));
+
+    for (const auto& entry : entries) {
+        writer.string(entry.key);
+        writer.u8(static_cast<U8>(entry.kind));
+
+        if (entry.kind == Flowgraph::Snapshot::Entry::Kind::Value) {
+            writer.string(entry.value);
+        } else {
+            writer.string(entry.blockKey);
+            writer.string(entry.moduleKey);
+            writer.string(entry.arrayKey);
+            writer.string(entry.elementKey);
+        }
+    }
+}
+
+Result ReadEntries(Reader& reader, std::vector<Flowgraph::Snapshot::Entry>& entries) {
+    using Kind = Flowgraph::Snapshot::Entry::Kind;
+
+    // Key, kind and value of the smallest entry.
+    U32 count;
+    JST_CHECK(reader.count(count, 4 + 1 + 4));
+
+    entries.clear();
+    entries.reserve(count);
+
+    for (U32 i = 0; i < count; i++) {
+        auto& entry = entries.emplace_back();
+
+        U8 kind;
+        JST_CHECK(reader.string(entry.key));
+        JST_CHECK(reader.u8(kind));
+
+        if (kind == static_cast<U8>(Kind::Value)) {
+            entry.kind = Kind::Value;
+            JST_CHECK(reader.string(entry.value));
+        } else if (kind == static_cast<U8>(Kind::Reference)) {
+            entry.kind = Kind::Reference;
+            JST_CHECK(reader.string(entry.blockKey));
+            JST_CHECK(reader.string(entry.moduleKey));
+            JST_CHECK(reader.string(entry.arrayKey));
+            JST_CHECK(reader.string(entry.elementKey));
+        } else {
+            JST_ERROR("[FLOWGRAPH] Invalid entry kind ({}) in binary flowgraph.", kind);
+            return Result::ERROR;
+        }
+    }
+
+    return Result::SUCCESS;
+}
+
+}  // namespace
+
+std::string Flowgraph::Snapshot::Entry::reference() const {
+    if (moduleKey.empty()) {
+        return jst::fmt::format("${{graph.{}.{}.{}}}", blockKey, arrayKey, elementKey);
+    }
+    return jst::fmt::format("${{graph.{}-{}.{}.{}}}", blockKey, moduleKey, arrayKey, elementKey);
+}
+
+bool Flowgraph::Snapshot::IsBinary(const std::vector<char>& blob) {
+    return blob.size() >= sizeof(Magic) && std::memcmp(blob.data(), Magic, sizeof(Magic)) == 0;
+}
+
+Result Flowgraph::Snapshot::ToBinary(const Snapshot& snapshot, std::vector<char>& blob) {
+    blob.clear();
+    Writer writer(blob);
+
+    writer.bytes(Magic, sizeof(Magic));
+    writer.u32(Version);
+
+    writer.string(snapshot.protocolVersion);
+    writer.string(snapshot.cyberetherVersion);
+    writer.string(snapshot.title);
+    writer.string(snapshot.summary);
+    writer.string(snapshot.author);
+    writer.string(snapshot.license);
+    writer.string(snapshot.description);
+
+    writer.u32(static_cast<U32>(snapshot.nodes.size()));
+
+    for (const auto& node : snapshot.nodes) {
+        writer.string(node.key);
+        writer.string(node.fingerprint.id);
+        writer.string(node.fingerprint.device);
+        writer.string(node.fingerprint.inputDataType);
+        writer.string(node.fingerprint.outputDataType);
+
+        WriteEntries(writer, node.config);
+        WriteEntries(writer, node.input);
+        WriteEntries(writer, node.interface);
+    }
+
+    return Result::SUCCESS;
+}
+
+Result Flowgraph::Snapshot::FromBinary(const std::vector<char>& blob, Snapshot& snapshot) {
+    if (!IsBinary(blob)) {
+        JST_ERROR("[FLOWGRAPH] Blob isn't a binary flowgraph.");
+        return Result::ERROR;
+    }
+
+    Reader reader(blob);
+
+    char magic[sizeof(Magic)];
+    U32 version;
+    JST_CHECK(reader.bytes(magic, sizeof(magic)));
+    JST_CHECK(reader.u32(version));
+
+    if (version != Version) {
+        JST_ERROR("[FLOWGRAPH] Unsupported binary flowgraph version ({}). Expected version {}.", version, Version);
+        return Result::ERROR;
+    }
+
+    JST_CHECK(reader.string(snapshot.protocolVersion));
+    JST_CHECK(reader.string(snapshot.cyberetherVersion));
+    JST_CHECK(reader.string(snapshot.title));
+    JST_CHECK(reader.string(snapshot.summary));
+    JST_CHECK(reader.string(snapshot.author));
+    JST_CHECK(reader.string(snapshot.license));
+    JST_CHECK(reader.string(snapshot.description));
+
+    // Strings and entry counts of the smallest node.
+    U32 count;
+    JST_CHECK(reader.count(count, 5 * 4 + 3 * 4));
+
+    snapshot.nodes.clear();
+    snapshot.nodes.reserve(count);
+
+    for (U32 i = 0; i < count; i++) {
+        auto& node = snapshot.nodes.emplace_back();
+
+        JST_CHECK(reader.string(node.key));
+        JST_CHECK(reader.string(node.fingerprint.id));
+        JST_CHECK(reader.string(node.fingerprint.device));
+        JST_CHECK(reader.string(node.fingerprint.inputDataType));
+        JST_CHECK(reader.string(node.fingerprint.outputDataType));
+
+        JST_CHECK(ReadEntries(reader, node.config));
+        JST_CHECK(ReadEntries(reader, node.input));
+        JST_CHECK(ReadEntries(reader, node.interface));
+    }
+
+    if (!reader.done()) {
+        JST_ERROR("[FLOWGRAPH] Binary flowgraph has trailing data.");
+        return Result::ERROR;
+    }
+
+    return Result::SUCCESS;
+}
+
+Result Flowgraph::Snapshot::ParseReference(const std::string& variable, Entry& entry) {
+    const auto begin = variable.find("${");
+    const auto end = variable.find('}', begin);
+
+    if (begin == std::string::npos || end == std::string::npos) {
+        JST_ERROR("[PARSER] Variable '{}' not found.", variable);
+        return Result::ERROR;
+    }
+
+    const auto patternNodes = Parser::SplitString(variable.substr(begin + 2, end - begin - 2), ".");
+
+    if (patternNodes.size() != 4) {
+        JST_ERROR("[PARSER] Variable '{}' not found.", variable);
+        return Result::ERROR;
+    }
+
+    if (patternNodes[0].compare("graph")) {
+        JST_ERROR("[PARSER] Invalid variable '{}'.", variable);
+        return Result::ERROR;
+    }
+
+    const auto locale = Parser::SplitString(patternNodes[1], "-");
+
+    entry.kind = Entry::Kind::Reference;
+    entry.blockKey = locale[0];
+    entry.moduleKey = (locale.size() > 1) ? locale[1] : "";
+    entry.arrayKey = patternNodes[2];
+    entry.elementKey = patternNodes[3];
+
+    if (entry.arrayKey != "input" &&
+        entry.arrayKey != "output" &&
+        entry.arrayKey != "interface") {
+        JST_ERROR("[PARSER] Invalid module array '{}'. It should be 'input', 'output', or 'interface'.", variable);
+        return Result::ERROR;
+    }
+
+    return Result::SUCCESS;
+}
+
+}  // namespace Jetstream
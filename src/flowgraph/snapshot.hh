@@ -0,0 +1,62 @@
+#ifndef JETSTREAM_FLOWGRAPH_SNAPSHOT_HH
+#define JETSTREAM_FLOWGRAPH_SNAPSHOT_HH
+
+#include "jetstream/flowgraph.hh"
+
+namespace Jetstream {
+
+// Flowgraph decoded from YAML or from the binary format. Values are stored as
+// the strings read from the file and references to other blocks are already
+// split into their parts, so loading it doesn't parse any text.
+
+struct Flowgraph::Snapshot {
+    struct Entry {
+        enum class Kind : U8 {
+            Value     = 0,
+            Reference = 1,
+        };
+
+        std::string key;
+        Kind kind = Kind::Value;
+
+        // Value.
+        std::string value;
+
+        // Reference in the form `${graph.block-module.array.element}`.
+        std::string blockKey;
+        std::string moduleKey;
+        std::string arrayKey;
+        std::string elementKey;
+
+        std::string reference() const;
+    };
+
+    struct Node {
+        std::string key;
+        Block::Fingerprint fingerprint;
+
+        std::vector<Entry> config;
+        std::vector<Entry> input;
+        std::vector<Entry> interface;
+    };
+
+    std::string protocolVersion;
+    std::string cyberetherVersion;
+    std::string title;
+    std::string summary;
+    std::string author;
+    std::string license;
+    std::string description;
+
+    std::vector<Node> nodes;
+
+    static bool IsBinary(const std::vector<char>& blob);
+    static Result FromBinary(const std::vector<char>& blob, Snapshot& snapshot);
+    static Result ToBinary(const Snapshot& snapshot, std::vector<char>& blob);
+
+    static Result ParseReference(const std::string& variable, Entry& entry);
+};
+
+}  // namespace Jetstream
+
+#endif
@@ -5,73 +5,181 @@
 
 namespace Jetstream {
 
-Parser::Record Flowgraph::YamlImpl::solveLocalPlaceholder(const Nodes& nodes, const ryml::ConstNodeRef& node) {
-    if (!node.has_val()) {
-        return {ResolveReadable(node)};
-    }
+Result Flowgraph::YamlImpl::ToSnapshot(const ryml::ConstNodeRef& root, Snapshot& snapshot) {
+    auto configValues = GatherNodes(root, root, {"protocolVersion",
+                                                 "cyberetherVersion"});
 
-    std::string key = std::string(node.val().str, node.val().len);
+    snapshot.protocolVersion = ResolveReadable(configValues["protocolVersion"]);
+    snapshot.cyberetherVersion = ResolveReadable(configValues["cyberetherVersion"]);
 
-    std::regex placeholderPattern(R"(\$\{.*\})");
-    if (!std::regex_match(key, placeholderPattern)) {
-        return {ResolveReadable(node)};
+    auto optConfigValues = GatherNodes(root, root, {"title",
+                                                    "summary",
+                                                    "author",
+                                                    "license",
+                                                    "description"}, true);
+
+    if (optConfigValues.contains("title")) {
+        snapshot.title = ResolveReadable(optConfigValues["title"]);
+    }
+    if (optConfigValues.contains("summary")) {
+        snapshot.summary = ResolveReadable(optConfigValues["summary"]);
+    }
+    if (optConfigValues.contains("author")) {
+        snapshot.author = ResolveReadable(optConfigValues["author"]);
+    }
+    if (optConfigValues.contains("license")) {
+        snapshot.license = ResolveReadable(optConfigValues["license"]);
+    }
+    if (optConfigValues.contains("description")) {
+        snapshot.description = ResolveReadable(optConfigValues["description"]);
     }
 
-    std::vector<std::string> patternNodes = GetParameterNodes(GetParameterContents(key));
+    if (!HasNode(root, root, "graph")) {
+        return Result::SUCCESS;
+    }
 
-    if (patternNodes.size() != 4) {
-        JST_ERROR("[PARSER] Variable '{}' not found.", key);
-        JST_CHECK_THROW(Result::ERROR);
+    for (const auto& element : GetNode(root, root, "graph")) {
+        auto& node = snapshot.nodes.emplace_back();
+        node.key = ResolveReadableKey(element);
+
+        auto values = GatherNodes(root, element, {"module", "device", "dataType", "inputDataType", "outputDataType"}, true);
+        node.fingerprint.id = ResolveReadable(values["module"]);
+        node.fingerprint.device = ResolveReadable(values["device"]);
+        if (values.contains("dataType")) {
+            node.fingerprint.inputDataType = ResolveReadable(values["dataType"]);
+        } else if (values.contains("inputDataType") && values.contains("outputDataType")) {
+            node.fingerprint.inputDataType = ResolveReadable(values["inputDataType"]);
+            node.fingerprint.outputDataType = ResolveReadable(values["outputDataType"]);
+        }
+
+        JST_CHECK(ReadEntries(root, element, "config", node.config));
+        JST_CHECK(ReadEntries(root, element, "input", node.input));
+        JST_CHECK(ReadEntries(root, element, "interface", node.interface));
     }
 
-    const auto& graphKey = patternNodes[0];
+    return Result::SUCCESS;
+}
+
+Result Flowgraph::YamlImpl::FromSnapshot(const Snapshot& snapshot, std::vector<char>& blob) {
+    ryml::Tree tree;
+    ryml::NodeRef root = tree.rootref();
+    root |= ryml::MAP;
 
-    auto locale = Parser::SplitString(patternNodes[1], "-");
-    const auto blockKey = locale[0];
-    const auto moduleKey = (locale.size() > 1) ? locale[1] : "";
-    
-    const auto& arrayKey = patternNodes[2];
-    const auto& elementKey = patternNodes[3];
+    root["protocolVersion"] << snapshot.protocolVersion;
+    root["cyberetherVersion"] << snapshot.cyberetherVersion;
 
-    if (graphKey.compare("graph")) {
-        JST_ERROR("[PARSER] Invalid variable '{}'.", key);
-        JST_CHECK_THROW(Result::ERROR);
+    if (!snapshot.title.empty()) {
+        root["title"] << snapshot.title;
     }
 
-    if (!nodes.contains({blockKey, moduleKey})) {
-        JST_ERROR("[PARSER] Module from the variable '{}' not found.", key);
-        JST_CHECK_THROW(Result::ERROR);
+    if (!snapshot.summary.empty()) {
+        root["summary"] << snapshot.summary;
     }
 
-    if (!arrayKey.compare("input")) {
-        auto& map = nodes.at({blockKey, moduleKey})->inputMap;
-        if (!map.contains(elementKey)) {
-            JST_ERROR("[PARSER] Input element from the variable '{}' not found.", key);
-            JST_CHECK_THROW(Result::ERROR);
+    if (!snapshot.author.empty()) {
+        root["author"] << snapshot.author;
+    }
+
+    if (!snapshot.license.empty()) {
+        root["license"] << snapshot.license;
+    }
+
+    if (!snapshot.description.empty()) {
+        root["description"] << snapshot.description;
+        if (std::count(snapshot.description.begin(), snapshot.description.end(), '\n')) {
+            root["description"] |= ryml::_WIP_VAL_LITERAL;
         }
-        return map[elementKey];
     }
 
-    if (!arrayKey.compare("output")) {
-        auto& map = nodes.at({blockKey, moduleKey})->outputMap;
-        if (!map.contains(elementKey)) {
-            JST_ERROR("[PARSER] Output element from the variable '{}' not found.", key);
-            JST_CHECK_THROW(Result::ERROR);
+    ryml::NodeRef graph;
+    if (!snapshot.nodes.empty()) {
+        graph = root["graph"];
+        graph |= ryml::MAP;
+    }
+
+    for (const auto& node : snapshot.nodes) {
+        const auto& fingerprint = node.fingerprint;
+
+        ryml::NodeRef block = graph[ryml::to_csubstr(node.key)];
+        block |= ryml::MAP;
+
+        block["module"] << fingerprint.id;
+        block["device"] << fingerprint.device;
+
+        if (!fingerprint.inputDataType.empty() &&
+            fingerprint.outputDataType.empty()) {
+            block["dataType"] << fingerprint.inputDataType;
+        } else if (!fingerprint.inputDataType.empty() &&
+                   !fingerprint.outputDataType.empty()) {
+            block["inputDataType"] << fingerprint.inputDataType;
+            block["outputDataType"] << fingerprint.outputDataType;
         }
-        return map[elementKey];
+
+        WriteEntries(block, "config", node.config);
+        WriteEntries(block, "input", node.input);
+        WriteEntries(block, "interface", node.interface);
     }
 
-    if (!arrayKey.compare("interface")) {
-        auto& map = nodes.at({blockKey, moduleKey})->stateMap;
-        if (!map.contains(elementKey)) {
-            JST_ERROR("[PARSER] Interface state element from the variable '{}' not found.", key);
-            JST_CHECK_THROW(Result::ERROR);
+    blob = {'-', '-', '-', '\n'};
+    const auto yaml = ryml::emitrs_yaml<std::vector<char>>(tree);
+    blob.insert(blob.end(), yaml.begin(), yaml.end());
+
+    return Result::SUCCESS;
+}
+
+Result Flowgraph::YamlImpl::ReadEntries(const ryml::ConstNodeRef& root,
+                                        const ryml::ConstNodeRef& node,
+                                        const std::string& key,
+                                        std::vector<Snapshot::Entry>& entries) {
+    if (!HasNode(root, node, key)) {
+        return Result::SUCCESS;
+    }
+
+    const std::regex placeholderPattern(R"(\$\{.*\})");
+
+    for (const auto& element : GetNode(root, node, key)) {
+        auto& entry = entries.emplace_back();
+        entry.key = ResolveReadableKey(element);
+
+        // Placeholders pointing inside the file are replaced by their value.
+        const auto value = SolvePlaceholder(root, element);
+
+        if (value.has_val()) {
+            const std::string variable(value.val().str, value.val().len);
+            if (std::regex_match(variable, placeholderPattern)) {
+                JST_CHECK(Snapshot::ParseReference(variable, entry));
+                continue;
+            }
         }
-        return map[elementKey];
+
+        entry.value = ResolveReadable(value);
     }
 
-    JST_ERROR("[PARSER] Invalid module array '{}'. It should be 'input', 'output', or 'interface'.", key);
-    throw Result::ERROR;
+    return Result::SUCCESS;
+}
+
+void Flowgraph::YamlImpl::WriteEntries(ryml::NodeRef block, const char* key, const std::vector<Snapshot::Entry>& entries) {
+    if (entries.empty()) {
+        return;
+    }
+
+    ryml::NodeRef map = block[ryml::to_csubstr(key)];
+    map |= ryml::MAP;
+
+    for (const auto& entry : entries) {
+        const auto& k = ryml::to_csubstr(entry.key);
+
+        if (entry.kind == Snapshot::Entry::Kind::Reference) {
+            map[k] << entry.reference();
+            map[k] |= ryml::_WIP_VAL_PLAIN;
+            continue;
+        }
+
+        map[k] << entry.value;
+        if (std::count(entry.value.begin(), entry.value.end(), '\n')) {
+            map[k] |= ryml::_WIP_VAL_LITERAL;
+        }
+    }
 }
 
 std::vector<std::string> Flowgraph::YamlImpl::GetMissingKeys(const std::unordered_map<std::string, ryml::ConstNodeRef>& m,
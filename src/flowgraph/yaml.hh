@@ -1,13 +1,22 @@
 #include "jetstream/flowgraph.hh"
 
 #include "rapidyaml.hh"
+#include "snapshot.hh"
 
 namespace Jetstream {
 
 struct Flowgraph::YamlImpl {
     ryml::Tree data;
 
-    Parser::Record solveLocalPlaceholder(const Nodes& nodes, const ryml::ConstNodeRef& node);
+    // Snapshot Conversion
+
+    static Result ToSnapshot(const ryml::ConstNodeRef& root, Snapshot& snapshot);
+    static Result FromSnapshot(const Snapshot& snapshot, std::vector<char>& blob);
+    static Result ReadEntries(const ryml::ConstNodeRef& root,
+                              const ryml::ConstNodeRef& node,
+                              const std::string& key,
+                              std::vector<Snapshot::Entry>& entries);
+    static void WriteEntries(ryml::NodeRef block, const char* key, const std::vector<Snapshot::Entry>& entries);
 
     // Helper Methods
 
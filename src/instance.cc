@@ -1,19 +1,26 @@
+#include <thread>
 #include <ranges>
 
 #include "jetstream/render/components/font.hh"
 #include "jetstream/instance.hh"
 #include "jetstream/store.hh"
+#include "jetstream/startup.hh"
 
 #include "resources/fonts/compressed_jbmm.hh"
 
 namespace Jetstream {
 
+static U64 ElapsedNanoseconds(const std::chrono::steady_clock::time_point& start) {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+}
+
 Instance::Instance() : _scheduler(), _flowgraph(*this) {
     JST_DEBUG("[INSTANCE] Creating instance.");
 }
 
 Result Instance::build(const Config& config) {
     JST_DEBUG("[INSTANCE] Building interface");
+    JST_STARTUP_PHASE("Instance Build");
 
     if (_viewport || _window) {
         JST_ERROR("[INSTANCE] Viewport or render already built.");
@@ -22,6 +29,39 @@ Result Instance::build(const Config& config) {
 
     this->config = config;
 
+    JST_CHECK(_scheduler.configure(config.schedulerConfig));
+    JST_CHECK(_quality.configure(config.qualityConfig));
+
+#ifdef JETSTREAM_BACKEND_CPU_AVAILABLE
+    CPUMemoryPool::Get().setCapacity(config.backendConfig.memoryPoolSize);
+    CPUMemoryPool::Get().setHints(config.memoryHints);
+#endif
+
+#ifdef JETSTREAM_BACKEND_CUDA_AVAILABLE
+    TensorBuffer<Device::CUDA>::SetMirroredMemory(config.backendConfig.mirroredMemory);
+#endif
+
+    // Keep threads next to their memory unless placed explicitly.
+
+    ThreadPolicies threadPolicies = config.threadPolicies;
+
+    if (config.memoryHints.numaNode >= 0 && !config.memoryHints.numaInterleave) {
+        for (auto* policy : {&threadPolicies.compute, &threadPolicies.worker, &threadPolicies.io}) {
+            if (policy->cores.empty() && policy->numaNode < 0) {
+                policy->numaNode = config.memoryHints.numaNode;
+            }
+        }
+    }
+
+    SetThreadPolicies(threadPolicies);
+
+    if (config.headless || config.computeOnly) {
+#ifdef JETSTREAM_BACKEND_CPU_AVAILABLE
+        JST_CHECK(this->buildBackend<Device::CPU>(config.backendConfig));
+#endif
+        return Result::SUCCESS;
+    }
+
     std::vector<Device> devicePriority = {
         config.preferredDevice,
         Device::Metal,
@@ -35,7 +75,7 @@ Result Instance::build(const Config& config) {
 #ifdef JETSTREAM_VIEWPORT_HEADLESS_AVAILABLE
 #if   defined(JETSTREAM_BACKEND_VULKAN_AVAILABLE)
                 case Device::Vulkan:
-                    JST_CHECK(Backend::Initialize<Device::Vulkan>(config.backendConfig));
+                    JST_CHECK(this->buildBackend<Device::Vulkan>(config.backendConfig));
                     JST_CHECK(this->buildViewport<Viewport::Headless<Device::Vulkan>>(config.viewportConfig));
                     JST_CHECK(this->buildRender<Device::Vulkan>(config.renderConfig));
                     JST_CHECK(this->buildCompositor());
@@ -55,7 +95,7 @@ Result Instance::build(const Config& config) {
 #ifdef JETSTREAM_VIEWPORT_GLFW_AVAILABLE
 #ifdef JETSTREAM_BACKEND_METAL_AVAILABLE
                 case Device::Metal:
-                    JST_CHECK(Backend::Initialize<Device::Metal>(config.backendConfig));
+                    JST_CHECK(this->buildBackend<Device::Metal>(config.backendConfig));
                     JST_CHECK(this->buildViewport<Viewport::GLFW<Device::Metal>>(config.viewportConfig));
                     JST_CHECK(this->buildRender<Device::Metal>(config.renderConfig));
                     JST_CHECK(this->buildCompositor());
@@ -63,7 +103,7 @@ Result Instance::build(const Config& config) {
 #endif
 #ifdef JETSTREAM_BACKEND_VULKAN_AVAILABLE
                 case Device::Vulkan:
-                    JST_CHECK(Backend::Initialize<Device::Vulkan>(config.backendConfig));
+                    JST_CHECK(this->buildBackend<Device::Vulkan>(config.backendConfig));
                     JST_CHECK(this->buildViewport<Viewport::GLFW<Device::Vulkan>>(config.viewportConfig));
                     JST_CHECK(this->buildRender<Device::Vulkan>(config.renderConfig));
                     JST_CHECK(this->buildCompositor());
@@ -71,7 +111,7 @@ Result Instance::build(const Config& config) {
 #endif
 #ifdef JETSTREAM_BACKEND_WEBGPU_AVAILABLE
                 case Device::WebGPU:
-                    JST_CHECK(Backend::Initialize<Device::WebGPU>(config.backendConfig));
+                    JST_CHECK(this->buildBackend<Device::WebGPU>(config.backendConfig));
                     JST_CHECK(this->buildViewport<Viewport::GLFW<Device::WebGPU>>(config.viewportConfig));
                     JST_CHECK(this->buildRender<Device::WebGPU>(config.renderConfig));
                     JST_CHECK(this->buildCompositor());
@@ -137,8 +177,9 @@ Result Instance::removeBlock(Locale locale) {
         JST_CHECK(unlinkBlocks(inputLocale.pin(), outputLocale.pin()));
     }
 
-    // Delete block.
+    // Delete block and its warm variants.
     JST_CHECK(eraseBlock(locale.block()));
+    JST_CHECK(evictWarmVariants(locale.blockId));
 
     return Result::SUCCESS;
 }
@@ -237,13 +278,15 @@ Result Instance::changeBlockBackend(Locale input, Device device) {
         return Result::ERROR;
     }
 
-    // Update module.
+    // Update module. The variants being replaced are kept warm if enabled.
 
-    JST_CHECK(blockUpdater(input.block(), [&](std::shared_ptr<Flowgraph::Node>& node) {
-        // Change backend.
-        node->fingerprint.device = GetDeviceName(device);
+    JST_CHECK(transaction([&]{
+        return blockUpdater(input.block(), [&](std::shared_ptr<Flowgraph::Node>& node) {
+            // Change backend.
+            node->fingerprint.device = GetDeviceName(device);
 
-        return Result::SUCCESS;
+            return Result::SUCCESS;
+        }, config.warmBlockVariants > 0);
     }));
 
     return Result::SUCCESS;
@@ -259,20 +302,28 @@ Result Instance::changeBlockDataType(Locale input, std::tuple<std::string, std::
         return Result::ERROR;
     }
 
-    // Update module.
+    // Update module. The variants being replaced are kept warm if enabled.
 
-    JST_CHECK(blockUpdater(input.block(), [&](std::shared_ptr<Flowgraph::Node>& node) {
-        // Change data type.
-        const auto& [inputDataType, outputDataType] = type;
-        node->fingerprint.inputDataType = inputDataType;
-        node->fingerprint.outputDataType = outputDataType;
+    JST_CHECK(transaction([&]{
+        return blockUpdater(input.block(), [&](std::shared_ptr<Flowgraph::Node>& node) {
+            // Change data type.
+            const auto& [inputDataType, outputDataType] = type;
+            node->fingerprint.inputDataType = inputDataType;
+            node->fingerprint.outputDataType = outputDataType;
 
-        return Result::SUCCESS;
+            return Result::SUCCESS;
+        }, config.warmBlockVariants > 0);
     }));
 
     return Result::SUCCESS;
 }
 
+Result Instance::setBlockMemoryHints(Locale locale, const CPUMemoryHints& hints) {
+    JST_DEBUG("[INSTANCE] Setting memory hints of block '{}'.", locale.blockId);
+    blockMemoryHints[locale.blockId] = hints;
+    return Result::SUCCESS;
+}
+
 Result Instance::renameBlock(Locale input, const std::string& id) {
     JST_DEBUG("[INSTANCE] Renaming block '{}' to '{}'.", input.blockId, id);
 
@@ -283,6 +334,10 @@ Result Instance::renameBlock(Locale input, const std::string& id) {
         return Result::ERROR;
     }
 
+    // Warm variants are kept under the old ID.
+
+    JST_CHECK(evictWarmVariants(input.blockId));
+
     // Update block.
 
     JST_CHECK(blockUpdater(input.block(), [&](std::shared_ptr<Flowgraph::Node>& node) {
@@ -296,7 +351,8 @@ Result Instance::renameBlock(Locale input, const std::string& id) {
 }
 
 Result Instance::blockUpdater(Locale locale,
-                              const std::function<Result(std::shared_ptr<Flowgraph::Node>&)>& updater) {
+                              const std::function<Result(std::shared_ptr<Flowgraph::Node>&)>& updater,
+                              const bool& warm) {
     // List all dependencies.
 
     std::vector<Locale> dependencyTree;
@@ -315,8 +371,8 @@ Result Instance::blockUpdater(Locale locale,
         // Copy dependency block records.
         dependencyRecords.push_back(record);
 
-        // Delete dependency block.
-        JST_CHECK(eraseBlock(dependencyLocale));
+        // Delete or park dependency block.
+        JST_CHECK(warm ? parkBlock(dependencyLocale) : eraseBlock(dependencyLocale));
     }
 
     // Copy input block record.
@@ -325,8 +381,8 @@ Result Instance::blockUpdater(Locale locale,
     // Update input block records.
     JST_CHECK(record->updateMaps());
 
-    // Delete input block.
-    JST_CHECK(eraseBlock(locale.block()));
+    // Delete or park input block.
+    JST_CHECK(warm ? parkBlock(locale.block()) : eraseBlock(locale.block()));
 
     // Backup original record.
     Flowgraph::Node recordBackup = *record;
@@ -342,11 +398,7 @@ Result Instance::blockUpdater(Locale locale,
         JST_ERROR("[INSTANCE] Module fingerprint doesn't exist: '{}'.", record->fingerprint);
         return Result::ERROR;
     } else {
-        res = Store::BlockConstructorList().at(record->fingerprint)(*this,
-                                                                    record->id,
-                                                                    record->configMap,
-                                                                    record->inputMap,
-                                                                    record->stateMap);
+        res = createBlock(*record, warm);
     }
 
     // Create new input block using saved records.
@@ -355,11 +407,7 @@ Result Instance::blockUpdater(Locale locale,
     // If recreation fails, rewind the module state.
     if (res != Result::SUCCESS) {
         JST_TRACE("[INSTANCE] Module recreation failed. Rewinding state.");
-        JST_CHECK(Store::BlockConstructorList().at(recordBackup.fingerprint)(*this,
-                                                                             recordBackup.id,
-                                                                             recordBackup.configMap,
-                                                                             recordBackup.inputMap,
-                                                                             recordBackup.stateMap));
+        JST_CHECK(createBlock(recordBackup, warm));
     }
 
     // Create new dependency block using saved records.
@@ -382,11 +430,7 @@ Result Instance::blockUpdater(Locale locale,
         }
 
         // Create new dependency block with updated inputs.
-        dependencyRes = Store::BlockConstructorList().at(dependencyRecord->fingerprint)(*this,
-                                                                                        dependencyRecord->id,
-                                                                                        dependencyRecord->configMap,
-                                                                                        dependencyRecord->inputMap,
-                                                                                        dependencyRecord->stateMap);
+        dependencyRes = createBlock(*dependencyRecord, warm);
 
         if (dependencyRes != Result::SUCCESS) {
             errorCodeBackup = JST_LOG_LAST_ERROR();
@@ -402,20 +446,16 @@ Result Instance::blockUpdater(Locale locale,
         // Remove block dependencies.
 
         for (const auto& dependencyLocale : dependencyEraseList) {
-            JST_CHECK(eraseBlock(dependencyLocale));
+            JST_CHECK(warm ? parkBlock(dependencyLocale) : eraseBlock(dependencyLocale));
         }
 
         // Remove block.
 
-        JST_CHECK(eraseBlock(locale.block()));
+        JST_CHECK(warm ? parkBlock(locale.block()) : eraseBlock(locale.block()));
 
         // Rewind the block state.
 
-        JST_CHECK(Store::BlockConstructorList().at(recordBackup.fingerprint)(*this,
-                                                                             recordBackup.id,
-                                                                             recordBackup.configMap,
-                                                                             recordBackup.inputMap,
-                                                                             recordBackup.stateMap));
+        JST_CHECK(createBlock(recordBackup, warm));
 
         // Rewind the dependency block state.
 
@@ -435,11 +475,7 @@ Result Instance::blockUpdater(Locale locale,
             }
 
             // Create new dependency block with updated inputs.
-            JST_CHECK(Store::BlockConstructorList().at(dependencyRecord->fingerprint)(*this,
-                                                                                      dependencyRecord->id,
-                                                                                      dependencyRecord->configMap,
-                                                                                      dependencyRecord->inputMap,
-                                                                                      dependencyRecord->stateMap));
+            JST_CHECK(createBlock(*dependencyRecord, warm));
         }
 
         JST_LOG_LAST_ERROR() = errorCodeBackup;
@@ -469,8 +505,11 @@ Result Instance::eraseModule(Locale locale) {
         JST_CHECK(state->present->destroyPresent());
     }
 
-    // Destroy the module or bundle.
-    JST_CHECK(state->module->destroy());
+    // Destroy the module or bundle. Views kept as sinks by compute-only
+    // instances were never created and have neither taint registered.
+    if (state->compute || state->present) {
+        JST_CHECK(state->module->destroy());
+    }
 
     // Remove module from order.
     _flowgraph.nodesOrder().erase(std::find(_flowgraph.nodesOrder().begin(), _flowgraph.nodesOrder().end(), locale));
@@ -502,6 +541,25 @@ Result Instance::eraseBlock(Locale locale) {
     return Result::SUCCESS;
 }
 
+Result Instance::beginTransaction() {
+    return _scheduler.beginTransaction();
+}
+
+Result Instance::commitTransaction() {
+    return _scheduler.commitTransaction();
+}
+
+Result Instance::transaction(const std::function<Result()>& func) {
+    JST_CHECK(beginTransaction());
+
+    // Commit even on failure to release the scheduler.
+    const Result res = func();
+
+    JST_CHECK(commitTransaction());
+
+    return res;
+}
+
 Result Instance::reset() {
     JST_DEBUG("[INSTANCE] Reseting instance.");
 
@@ -545,9 +603,204 @@ Result Instance::reset() {
         JST_CHECK(eraseModule(locale));
     }
 
+    // Destroying warm variants.
+
+    for (auto& [_, variants] : warmVariants) {
+        for (auto& variant : variants) {
+            JST_CHECK(destroyWarmVariant(variant));
+        }
+    }
+    warmVariants.clear();
+
+    return Result::SUCCESS;
+}
+
+Result Instance::createBlock(Flowgraph::Node& record, const bool& warm) {
+    if (warm) {
+        bool restored = false;
+        JST_CHECK(restoreBlock(record, restored));
+
+        if (restored) {
+            return Result::SUCCESS;
+        }
+    }
+
+    return Store::BlockConstructorList().at(record.fingerprint)(*this,
+                                                                record.id,
+                                                                record.configMap,
+                                                                record.inputMap,
+                                                                record.stateMap);
+}
+
+Result Instance::parkBlock(Locale locale) {
+    const auto& node = _flowgraph.nodes().at(locale);
+
+    // Incomplete blocks and blocks that can't be told apart are not worth keeping.
+
+    WarmVariant variant;
+
+    if (!node->block->complete() || !VariantSignature(*node, variant.signature)) {
+        return eraseBlock(locale);
+    }
+
+    JST_DEBUG("[INSTANCE] Keeping block '{}' warm.", locale);
+
+    // Remove block from compositor.
+    if (_compositor) {
+        JST_CHECK(_compositor->removeBlock(locale));
+    }
+
+    // Take the block and its modules out of the flowgraph in creation order.
+    // The modules leave the schedule but keep their memory and kernels.
+
+    const auto order = _flowgraph.nodesOrder();
+
+    for (const auto& nodeLocale : order) {
+        if (nodeLocale.blockId != locale.blockId) {
+            continue;
+        }
+
+        if (!nodeLocale.isBlock()) {
+            JST_CHECK(_scheduler.removeModule(nodeLocale));
+        }
+
+        variant.nodes.push_back({nodeLocale, _flowgraph.nodes().extract(nodeLocale).mapped()});
+        _flowgraph.nodesOrder().erase(std::find(_flowgraph.nodesOrder().begin(), _flowgraph.nodesOrder().end(), nodeLocale));
+    }
+
+    // Keep the most recent variants.
+
+    auto& variants = warmVariants[locale.blockId];
+    variants.push_front(std::move(variant));
+
+    while (variants.size() > config.warmBlockVariants) {
+        JST_CHECK(destroyWarmVariant(variants.back()));
+        variants.pop_back();
+    }
+
     return Result::SUCCESS;
 }
 
+Result Instance::restoreBlock(const Flowgraph::Node& record, bool& restored) {
+    restored = false;
+
+    if (!warmVariants.contains(record.id)) {
+        return Result::SUCCESS;
+    }
+
+    std::string signature;
+    if (!VariantSignature(record, signature)) {
+        return Result::SUCCESS;
+    }
+
+    auto& variants = warmVariants.at(record.id);
+    auto it = std::find_if(variants.begin(), variants.end(), [&](const auto& variant) {
+        return variant.signature == signature;
+    });
+
+    if (it == variants.end()) {
+        return Result::SUCCESS;
+    }
+
+    JST_DEBUG("[INSTANCE] Restoring warm block '{}'.", record.id);
+
+    WarmVariant variant = std::move(*it);
+    variants.erase(it);
+
+    // Put the block and its modules back in creation order.
+
+    for (auto& [nodeLocale, node] : variant.nodes) {
+        if (!nodeLocale.isBlock()) {
+            JST_CHECK(_scheduler.addModule(nodeLocale,
+                                           node->module,
+                                           node->inputMap,
+                                           node->outputMap,
+                                           node->compute,
+                                           node->present));
+        }
+
+        _flowgraph.nodes()[nodeLocale] = node;
+        _flowgraph.nodesOrder().push_back(nodeLocale);
+    }
+
+    // Add block to the compositor.
+
+    const Locale locale = {record.id};
+    const auto& node = _flowgraph.nodes().at(locale);
+
+    if (_compositor) {
+        JST_CHECK(_compositor->addBlock(locale,
+                                        node->block,
+                                        node->inputMap,
+                                        node->outputMap,
+                                        node->stateMap,
+                                        node->fingerprint));
+    }
+
+    restored = true;
+
+    return Result::SUCCESS;
+}
+
+Result Instance::evictWarmVariants(const std::string& blockId) {
+    if (!warmVariants.contains(blockId)) {
+        return Result::SUCCESS;
+    }
+
+    for (auto& variant : warmVariants.at(blockId)) {
+        JST_CHECK(destroyWarmVariant(variant));
+    }
+    warmVariants.erase(blockId);
+
+    return Result::SUCCESS;
+}
+
+Result Instance::destroyWarmVariant(WarmVariant& variant) {
+    // The modules are destroyed directly in reverse creation order. Destroying the
+    // block itself would erase the modules of the active variant sharing its locales.
+
+    for (auto& [_, node] : variant.nodes | std::ranges::views::reverse) {
+        if (node->present) {
+            JST_CHECK(node->present->destroyPresent());
+        }
+
+        if (node->module) {
+            JST_CHECK(node->module->destroy());
+        }
+    }
+    variant.nodes.clear();
+
+    return Result::SUCCESS;
+}
+
+bool Instance::VariantSignature(const Flowgraph::Node& record, std::string& signature) {
+    // A variant is reused only if it was created with the same
+    // fingerprint, configuration, and input tensors.
+
+    std::vector<std::string> entries;
+
+    for (const auto& [name, entry] : record.configMap) {
+        std::string value;
+        if (Parser::AnyToString(entry.object, value, true) != Result::SUCCESS || value.empty()) {
+            return false;
+        }
+        entries.push_back(jst::fmt::format("config.{}={}", name, value));
+    }
+
+    for (const auto& [name, entry] : record.inputMap) {
+        entries.push_back(jst::fmt::format("input.{}={:016X}", name, entry.hash));
+    }
+
+    std::sort(entries.begin(), entries.end());
+
+    signature = jst::fmt::format("{}", record.fingerprint);
+    for (const auto& entry : entries) {
+        signature += jst::fmt::format(";{}", entry);
+    }
+
+    return true;
+}
+
 Result Instance::fetchDependencyTree(Locale locale, std::vector<Locale>& storage) {
     std::stack<Locale> stack;
     std::unordered_set<Locale, Locale::Hasher> seenLocales;
@@ -580,6 +833,8 @@ Result Instance::fetchDependencyTree(Locale locale, std::vector<Locale>& storage
 }
 
 Result Instance::loadDefaultFonts() {
+    // Fonts are only rendered by the window when first used.
+
     std::shared_ptr<Render::Components::Font> font;
 
     // Default Mono
@@ -657,16 +912,49 @@ Result Instance::destroy() {
         _viewport = nullptr;
     }
 
+    // Release backends.
+
+    for (const auto& device : _backends) {
+        JST_CHECK(Backend::Release(device));
+    }
+    _backends.clear();
+
     return Result::SUCCESS;
 }
 
 Result Instance::compute() {
+    const U64 cycles = _scheduler.computeCycles();
+
     // Update the modules compute logic.
     JST_CHECK(_scheduler.compute());
 
+    // Draw the new data when rendering on demand.
+
+    if (_window && _scheduler.computeCycles() != cycles) {
+        _window->invalidate();
+    }
+
     return Result::SUCCESS;
 }
 
+Instance::FrameLatency Instance::frameLatency() const {
+    FrameLatency latency = {
+        .frame = frameHistogram.snapshot(),
+        .present = presentHistogram.snapshot(),
+        .interface = interfaceHistogram.snapshot(),
+        .render = renderHistogram.snapshot(),
+        .encode = {},
+    };
+
+    if (_viewport) {
+        if (const auto* encode = _viewport->encodeLatency()) {
+            latency.encode = encode->snapshot();
+        }
+    }
+
+    return latency;
+}
+
 bool Instance::computing() {
     return computeRunning;
 }
@@ -676,10 +964,22 @@ bool Instance::presenting() {
 }
 
 bool Instance::running() {
+    if (!_viewport) {
+        return computing();
+    }
     return computing() && presenting() && _viewport->keepRunning();
 }
 
 Result Instance::begin() {
+    // Cap the framerate while the quality controller lowers it.
+    if (const U64 divisor = _quality.framerateDivisor(); divisor > 1 && config.viewportConfig.framerate > 0) {
+        const auto interval = std::chrono::nanoseconds(1'000'000'000 * divisor / config.viewportConfig.framerate);
+        std::this_thread::sleep_until(lastFrameStart + interval);
+    }
+
+    frameStart = std::chrono::steady_clock::now();
+    lastFrameStart = frameStart;
+
     // Create new render frame.
     const auto& res = _window->begin();
 
@@ -693,9 +993,13 @@ Result Instance::begin() {
 }
 
 Result Instance::present() {
+    const auto start = std::chrono::steady_clock::now();
+
     // Update the modules present logic.
     JST_CHECK(_scheduler.present());
 
+    presentHistogram.record(ElapsedNanoseconds(start));
+
     return Result::SUCCESS;
 }
 
@@ -703,10 +1007,24 @@ Result Instance::end() {
     // Draw the main interface.
 
     if (_compositor && config.renderCompositor) {
+        const auto start = std::chrono::steady_clock::now();
+
         JST_CHECK(_compositor->draw());
+
+        // Tell the scheduler which views weren't drawn. Modules outside
+        // of a block are always visible.
+
+        for (const auto& [locale, node] : _flowgraph.nodes()) {
+            if (node->present && _flowgraph.nodes().contains(locale.block())) {
+                node->present->setPresentVisible(_compositor->isBlockVisible(locale.block()));
+            }
+        }
+
+        interfaceHistogram.record(ElapsedNanoseconds(start));
     }
 
     // Finish the render frame.
+    const auto renderStart = std::chrono::steady_clock::now();
     const auto& res = _window->end();
 
     if (res != Result::SUCCESS &&
@@ -715,6 +1033,26 @@ Result Instance::end() {
         return res;
     }
 
+    if (res == Result::SUCCESS) {
+        const U64 frameNs = ElapsedNanoseconds(frameStart);
+        renderHistogram.record(ElapsedNanoseconds(renderStart));
+        frameHistogram.record(frameNs);
+
+        // Shed display work under thermal or frame time pressure.
+        if (_quality.record(frameNs)) {
+            U64 overflows = 0;
+            for (const auto& [_, buffers] : _scheduler.moduleBuffers()) {
+                for (const auto& buffer : buffers) {
+                    overflows += buffer.overflows;
+                }
+            }
+
+            if (_quality.evaluate(overflows)) {
+                _scheduler.setDisplayDivisor(_quality.displayDivisor());
+            }
+        }
+    }
+
     // Process interactions after finishing frame.
 
     if (_compositor && config.renderCompositor) {
@@ -1,10 +1,15 @@
 // jetstream/logger.cc
 #include <atomic>
+#include <chrono>
 #include <cstdlib>
+#include <cstring>
 #include <iostream>
+#include <memory>
 #include <mutex>
 #include <ostream>
 #include <string>
+#include <string_view>
+#include <thread>
 
 #include "jetstream/logger.hh"
 #include "fmt/color.h"
@@ -70,3 +75,261 @@ jst::fmt::text_style JST_LOG_STYLE(const jst::fmt::text_style& ts) {
     }
     return jst::fmt::text_style();
 }
+
+namespace {
+
+//
+// Repeated lines.
+//
+// Guarded by the log mutex.
+//
+
+constexpr auto RepeatWindow = std::chrono::seconds(1);
+
+struct Repeat {
+    size_t hash = 0;
+    std::chrono::steady_clock::time_point printed;
+    uint64_t count = 0;
+};
+
+Repeat g_repeat;
+
+void WriteNote(std::ostream& sink, const char* tag, const std::string& message) {
+    sink << jst::fmt::format(JST_LOG_STYLE(_JST_LOG_BOLD), "JETSTREAM {}| ", tag) << message << '\n';
+}
+
+void FlushRepeats(std::ostream& sink) {
+    if (g_repeat.count == 0) {
+        return;
+    }
+    WriteNote(sink, _JST_LOG_INFO, jst::fmt::format("Last message repeated {} more times.", g_repeat.count));
+    g_repeat.count = 0;
+}
+
+void EmitLine(const char* line, const size_t& size, const bool& flush) {
+    auto& sink = JST_LOG_SINK();
+    const auto hash = std::hash<std::string_view>{}(std::string_view(line, size));
+    const auto now = std::chrono::steady_clock::now();
+
+    if (hash == g_repeat.hash && (now - g_repeat.printed) < RepeatWindow) {
+        g_repeat.count += 1;
+        return;
+    }
+
+    FlushRepeats(sink);
+
+    sink.write(line, size);
+    sink.put('\n');
+    if (flush) {
+        sink.flush();
+    }
+
+    g_repeat = {hash, now, 0};
+}
+
+//
+// Asynchronous mode.
+//
+// Bounded multi-producer queue of formatted lines. Producers claim a record
+// with a single compare-and-swap and never block, the writer thread is the
+// only consumer. Every record has a sequence number telling whether it's
+// free for the push of that position or ready for its pop.
+//
+
+constexpr size_t RecordSize = 480;
+constexpr size_t RecordCount = 4096;
+
+struct Record {
+    std::atomic<uint64_t> sequence;
+    uint32_t size;
+    char data[RecordSize];
+};
+
+struct AsyncLog {
+    std::unique_ptr<Record[]> records;
+    std::atomic<uint64_t> head{0};
+    uint64_t tail = 0;
+
+    std::atomic<bool> enabled{false};
+    std::atomic<bool> stopping{false};
+    std::atomic<uint64_t> inflight{0};
+    std::atomic<uint64_t> queued{0};
+    std::atomic<uint64_t> written{0};
+    std::atomic<uint64_t> dropped{0};
+
+    std::mutex control;
+    std::thread writer;
+
+    bool push(const char* line, const size_t& size) {
+        uint64_t position = head.load(std::memory_order_relaxed);
+
+        while (true) {
+            Record& record = records[position % RecordCount];
+            const uint64_t sequence = record.sequence.load(std::memory_order_acquire);
+            const int64_t distance = static_cast<int64_t>(sequence - position);
+
+            if (distance < 0) {
+                return false;
+            }
+
+            if (distance > 0) {
+                position = head.load(std::memory_order_relaxed);
+                continue;
+            }
+
+            if (head.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                // Long lines are truncated. Styled ones keep their reset sequence.
+                if (size > RecordSize) {
+                    const std::string_view suffix = std::memchr(line, '\x1b', size) ? "...\x1b[0m" : "...";
+                    std::memcpy(record.data, line, RecordSize - suffix.size());
+                    std::memcpy(record.data + RecordSize - suffix.size(), suffix.data(), suffix.size());
+                    record.size = RecordSize;
+                } else {
+                    std::memcpy(record.data, line, size);
+                    record.size = static_cast<uint32_t>(size);
+                }
+                record.sequence.store(position + 1, std::memory_order_release);
+                return true;
+            }
+        }
+    }
+
+    template<typename Callback>
+    bool pop(const Callback& callback) {
+        Record& record = records[tail % RecordCount];
+
+        if (record.sequence.load(std::memory_order_acquire) != tail + 1) {
+            return false;
+        }
+
+        callback(record.data, record.size);
+
+        record.sequence.store(tail + RecordCount, std::memory_order_release);
+        tail += 1;
+
+        return true;
+    }
+
+    void write() {
+        while (true) {
+            bool idle = true;
+
+            {
+                std::lock_guard<std::mutex> lock(_JST_LOG_MUTEX());
+                auto& sink = JST_LOG_SINK();
+
+                for (size_t i = 0; i < RecordCount && pop([](const char* line, const size_t& size) {
+                    EmitLine(line, size, false);
+                }); i++) {
+                    written.fetch_add(1, std::memory_order_release);
+                    idle = false;
+                }
+
+                if (const auto count = dropped.exchange(0, std::memory_order_relaxed); count > 0) {
+                    FlushRepeats(sink);
+                    WriteNote(sink, _JST_LOG_WARN, jst::fmt::format("Dropped {} log messages.", count));
+                    idle = false;
+                }
+
+                // Report repeats once they stop instead of waiting for the next line.
+                if (idle && g_repeat.count > 0 &&
+                    (std::chrono::steady_clock::now() - g_repeat.printed) >= RepeatWindow) {
+                    FlushRepeats(sink);
+                    idle = false;
+                }
+
+                if (!idle) {
+                    sink.flush();
+                }
+            }
+
+            if (idle) {
+                if (stopping.load(std::memory_order_acquire)) {
+                    break;
+                }
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+        }
+    }
+};
+
+AsyncLog g_async;
+
+}  // namespace
+
+void JST_LOG_ASYNC(bool enable) {
+    std::lock_guard<std::mutex> guard(g_async.control);
+
+    if (enable == g_async.writer.joinable()) {
+        return;
+    }
+
+    if (enable) {
+        if (!g_async.records) {
+            g_async.records = std::make_unique<Record[]>(RecordCount);
+            for (size_t i = 0; i < RecordCount; i++) {
+                g_async.records[i].sequence.store(i, std::memory_order_relaxed);
+            }
+
+            // Drain the queue on exit, before the log mutex is destroyed.
+            _JST_LOG_MUTEX();
+            std::atexit([]{
+                JST_LOG_ASYNC(false);
+            });
+        }
+        g_async.stopping.store(false, std::memory_order_release);
+        g_async.writer = std::thread([]{
+            g_async.write();
+        });
+        g_async.enabled.store(true, std::memory_order_release);
+        return;
+    }
+
+    // Wait for the lines being queued, then let the writer drain the queue.
+
+    g_async.enabled.store(false);
+    while (g_async.inflight.load() != 0) {
+        std::this_thread::yield();
+    }
+    g_async.stopping.store(true, std::memory_order_release);
+    g_async.writer.join();
+}
+
+void JST_LOG_FLUSH() {
+    const uint64_t target = g_async.queued.load(std::memory_order_acquire);
+    while (g_async.enabled.load(std::memory_order_acquire) &&
+           g_async.written.load(std::memory_order_acquire) < target) {
+        std::this_thread::sleep_for(std::chrono::microseconds(100));
+    }
+
+    std::lock_guard<std::mutex> lock(_JST_LOG_MUTEX());
+    JST_LOG_SINK().flush();
+}
+
+void _JST_LOG_WRITE(int level, const char* line, size_t size) {
+    if (g_async.enabled.load(std::memory_order_acquire)) {
+        g_async.inflight.fetch_add(1);
+        const bool enabled = g_async.enabled.load();
+        const bool queued = enabled && g_async.push(line, size);
+        if (queued) {
+            g_async.queued.fetch_add(1, std::memory_order_release);
+        }
+        g_async.inflight.fetch_sub(1, std::memory_order_release);
+
+        if (queued) {
+            if (level < 0) {
+                JST_LOG_FLUSH();
+            }
+            return;
+        }
+
+        // Errors are written right away when the queue is full.
+        if (enabled && level > 0) {
+            g_async.dropped.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(_JST_LOG_MUTEX());
+    EmitLine(line, size, true);
+}
@@ -1,4 +1,5 @@
 #include "jetstream/memory/devices/cpu/buffer.hh"
+#include "jetstream/memory/devices/cpu/pool.hh"
 
 #ifdef JETSTREAM_BACKEND_VULKAN_AVAILABLE
 #include "jetstream/memory/devices/vulkan/buffer.hh"
@@ -14,19 +15,13 @@
 #include "jetstream/memory/devices/metal/buffer.hh"
 #endif
 
-#ifdef JST_OS_WINDOWS
-#define WIN32_LEAN_AND_MEAN
-#include <windows.h>
-#undef ERROR
-#undef FATAL
-#endif
-
 namespace Jetstream {
 
 using Implementation = TensorBuffer<Device::CPU>;
 
 Implementation::TensorBuffer(std::shared_ptr<TensorStorageMetadata>& storage,
-                             const TensorPrototypeMetadata& prototype) {
+                             const TensorPrototypeMetadata& prototype,
+                             const bool& zero_fill) {
     JST_TRACE("[CPU:BUFFER] Allocating new buffer.");
 
     // Initialize storage.
@@ -39,30 +34,23 @@ Implementation::TensorBuffer(std::shared_ptr<TensorStorageMetadata>& storage,
     // Allocate memory.
 
     if (prototype.size_bytes > 0) {
-        void* memoryAddr = nullptr;
-        const auto pageSize = JST_PAGESIZE();
-        const auto alignedSizeBytes = JST_PAGE_ALIGNED_SIZE(prototype.size_bytes);
-#ifdef JST_OS_WINDOWS
-        buffer = VirtualAlloc(nullptr, alignedSizeBytes, MEM_COMMIT | MEM_RESERVE, PAGE_READWRITE);
-        if (buffer == nullptr) {
-            JST_ERROR("[CPU:BUFFER] Failed to allocate CPU memory.");
-            JST_CHECK_THROW(Result::ERROR);
-        }
-#else
-        const auto result = posix_memalign(&memoryAddr, pageSize, alignedSizeBytes);
-        if (result < 0 || (buffer = static_cast<void*>(memoryAddr)) == nullptr) {
+        if ((buffer = CPUMemoryPool::Get().allocate(prototype.size_bytes, bufferSize)) == nullptr) {
             JST_ERROR("[CPU:BUFFER] Failed to allocate CPU memory.");
             JST_CHECK_THROW(Result::ERROR);
         }
-#endif
+
+        track_memory(storage, Device::CPU, bufferSize);
+
         // Set buffer flags.
 
         set_allocated();
         set_host_accessible();
 
-        // Null out array.
+        // Null out array. Skipped for buffers fully written before being read.
 
-        memset(buffer, 0, prototype.size_bytes);
+        if (zero_fill) {
+            memset(buffer, 0, prototype.size_bytes);
+        }
     }
 
     // Add compatible devices.
@@ -243,9 +231,9 @@ Implementation::TensorBuffer(std::shared_ptr<TensorStorageMetadata>&,
         return;
     }
 
-    // Initialize buffer.
+    // Initialize buffer. Mirrored buffers are read through the host mirror.
 
-    buffer = root_buffer->data();
+    buffer = (root_buffer->mirrored()) ? root_buffer->host_data() : root_buffer->data();
 
     // Set buffer flags.
 
@@ -287,13 +275,47 @@ Implementation::~TensorBuffer() {
 
     // Free memory.
 
-    if (allocated()) {
-#ifdef JST_OS_WINDOWS
-        VirtualFree(buffer, 0, MEM_RELEASE);
-#else
-        free(buffer);
-#endif
+    if (allocated() && !aliased()) {
+        CPUMemoryPool::Get().free(buffer, bufferSize);
     }
 }
 
+Result Implementation::alias(void* ptr) {
+    JST_TRACE("[CPU:BUFFER] Aliasing buffer at {} to {}.", jst::fmt::ptr(buffer), jst::fmt::ptr(ptr));
+
+    if (!allocated() || external_memory_device() != Device::None) {
+        JST_ERROR("[CPU:BUFFER] Only buffers allocated by the CPU can be aliased.");
+        return Result::ERROR;
+    }
+
+    if (!aliased()) {
+        CPUMemoryPool::Get().free(buffer, bufferSize);
+        untrack_memory();
+    }
+
+    buffer = ptr;
+    _aliased = true;
+
+    return Result::SUCCESS;
+}
+
+Result Implementation::unalias() {
+    if (!aliased()) {
+        return Result::SUCCESS;
+    }
+
+    JST_TRACE("[CPU:BUFFER] Restoring dedicated memory of aliased buffer at {}.", jst::fmt::ptr(buffer));
+
+    if ((buffer = CPUMemoryPool::Get().allocate(bufferSize, bufferSize)) == nullptr) {
+        JST_ERROR("[CPU:BUFFER] Failed to allocate CPU memory.");
+        return Result::ERROR;
+    }
+    memset(buffer, 0, bufferSize);
+    track_memory(tracked_storage(), Device::CPU, bufferSize);
+
+    _aliased = false;
+
+    return Result::SUCCESS;
+}
+
 }  // namespace Jetstream
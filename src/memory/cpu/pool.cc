@@ -0,0 +1,318 @@
+#include "jetstream/memory/devices/cpu/pool.hh"
+#include "jetstream/memory/macros.hh"
+#include "jetstream/logger.hh"
+
+#ifdef JST_OS_WINDOWS
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#undef ERROR
+#undef FATAL
+#endif
+
+#ifdef JST_OS_LINUX
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#endif
+
+#ifdef JETSTREAM_BACKEND_CUDA_AVAILABLE
+#include "jetstream/backend/devices/cuda/helpers.hh"
+#endif
+
+namespace Jetstream {
+
+static void* AllocateSystemMemory(const U64& size) {
+    void* memoryAddr = nullptr;
+#ifdef JST_OS_WINDOWS
+    memoryAddr = VirtualAlloc(nullptr, size, MEM_COMMIT | MEM_RESERVE, PAGE_READWRITE);
+#else
+    if (posix_memalign(&memoryAddr, JST_PAGESIZE(), size) != 0) {
+        memoryAddr = nullptr;
+    }
+#endif
+    return memoryAddr;
+}
+
+static void FreeSystemMemory(void* ptr) {
+#ifdef JST_OS_WINDOWS
+    VirtualFree(ptr, 0, MEM_RELEASE);
+#else
+    ::free(ptr);
+#endif
+}
+
+#ifdef JST_OS_LINUX
+
+// Size of a transparent huge page on x86-64 and most AArch64 kernels.
+static constexpr U64 HugePageSize = 2*1024*1024;
+
+// From <numaif.h>. Called through syscall to avoid depending on libnuma.
+static constexpr int MPOL_BIND_MODE = 2;
+static constexpr int MPOL_INTERLEAVE_MODE = 3;
+
+static void* AllocateHintedMemory(const U64& size, const CPUMemoryHints& hints) {
+    const U64 alignment = hints.hugePages ? HugePageSize : JST_PAGESIZE();
+
+    // Over-allocate and trim so the block starts on a huge page boundary.
+    const U64 mappedSize = size + alignment;
+    auto* base = static_cast<U8*>(mmap(nullptr, mappedSize, PROT_READ | PROT_WRITE,
+                                       MAP_PRIVATE | MAP_ANONYMOUS, -1, 0));
+    if (base == MAP_FAILED) {
+        return nullptr;
+    }
+
+    const uintptr_t start = reinterpret_cast<uintptr_t>(base);
+    auto* ptr = reinterpret_cast<U8*>(((start + alignment - 1) / alignment) * alignment);
+
+    if (ptr != base) {
+        munmap(base, ptr - base);
+    }
+    if ((base + mappedSize) != (ptr + size)) {
+        munmap(ptr + size, (base + mappedSize) - (ptr + size));
+    }
+
+    // The pages aren't touched yet, so the policies apply to all of them.
+
+    if (hints.hugePages && madvise(ptr, size, MADV_HUGEPAGE) != 0) {
+        JST_DEBUG("[CPU:POOL] Transparent huge pages aren't available.");
+    }
+
+    if (hints.numaInterleave || hints.numaNode >= 0) {
+        // The kernel masks out nodes that don't exist.
+        const unsigned long nodemask = hints.numaInterleave ? ~0UL : (1UL << (hints.numaNode % 64));
+        const int mode = hints.numaInterleave ? MPOL_INTERLEAVE_MODE : MPOL_BIND_MODE;
+
+        if (syscall(SYS_mbind, ptr, size, mode, &nodemask, sizeof(nodemask) * 8, 0) != 0) {
+            JST_DEBUG("[CPU:POOL] Can't apply the NUMA policy.");
+        }
+    }
+
+    return ptr;
+}
+
+static void FreeHintedMemory(void* ptr, const U64& size) {
+    munmap(ptr, size);
+}
+
+#endif
+
+static thread_local const CPUMemoryHints* ScopedHintsOverride = nullptr;
+
+CPUMemoryPool::ScopedHints::ScopedHints(const CPUMemoryHints& hints)
+     : previous(ScopedHintsOverride),
+       hints(hints) {
+    ScopedHintsOverride = &this->hints;
+}
+
+CPUMemoryPool::ScopedHints::~ScopedHints() {
+    ScopedHintsOverride = previous;
+}
+
+CPUMemoryPool& CPUMemoryPool::Get() {
+    // Never destroyed. Buffers held by other static objects
+    // can still be freed into it during the program exit.
+    static auto* pool = new CPUMemoryPool();
+    return *pool;
+}
+
+U64 CPUMemoryPool::SizeClass(const U64& size) {
+    const U64 pageSize = JST_PAGESIZE();
+    U64 pages = (size + pageSize - 1) / pageSize;
+
+    // Small allocations get one class per page. Larger ones get four
+    // classes per power of two, wasting at most a quarter of the size.
+    if (pages > 16) {
+        U64 msb = 0;
+        while ((pages >> (msb + 1)) != 0) {
+            msb += 1;
+        }
+        const U64 step = U64(1) << (msb - 2);
+        pages = ((pages + step - 1) / step) * step;
+    }
+
+    return pages * pageSize;
+}
+
+CPUMemoryHints CPUMemoryPool::currentHints() {
+    if (ScopedHintsOverride) {
+        return *ScopedHintsOverride;
+    }
+    return globalHints;
+}
+
+void* CPUMemoryPool::allocate(const U64& size, U64& classSize) {
+    classSize = SizeClass(size);
+
+    std::lock_guard<std::mutex> lock(mutex);
+
+    auto hints = currentHints();
+    const bool pinned = hints.pinned;
+    if (classSize < hints.threshold) {
+        hints = {};
+    }
+#ifndef JST_OS_LINUX
+    hints = {};
+#endif
+
+    const U64 placementKey = hints.enabled() ? hints.key() : 0;
+    const U64 key = placementKey | (pinned ? CPUMemoryHints::PinnedKey : 0);
+
+    // Pinned blocks serve plain requests as well. A tensor reloaded
+    // before being used by CUDA again gets its registration back.
+    auto it = freeLists.find({classSize, key | CPUMemoryHints::PinnedKey});
+    if (it == freeLists.end() || it->second.empty()) {
+        it = freeLists.find({classSize, key});
+    }
+    if (it != freeLists.end() && !it->second.empty()) {
+        void* ptr = it->second.back();
+        it->second.pop_back();
+        cachedBytes -= classSize;
+
+        JST_TRACE("[CPU:POOL] Reusing {} bytes at {}.", classSize, jst::fmt::ptr(ptr));
+        return ptr;
+    }
+
+    void* ptr = nullptr;
+
+#ifdef JST_OS_LINUX
+    if (placementKey != 0) {
+        if ((ptr = AllocateHintedMemory(classSize, hints))) {
+            hintedBlocks[ptr] = placementKey;
+        } else {
+            JST_DEBUG("[CPU:POOL] Can't map {} bytes with hints. Using the default allocator.", classSize);
+        }
+    }
+#endif
+
+    if (!ptr) {
+        ptr = AllocateSystemMemory(classSize);
+    }
+
+    if (ptr && pinned) {
+        pinBlock(ptr, classSize);
+    }
+
+    return ptr;
+}
+
+void CPUMemoryPool::free(void* ptr, const U64& classSize) {
+    if (!ptr) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex);
+
+    const auto it = hintedBlocks.find(ptr);
+    U64 key = (it != hintedBlocks.end()) ? it->second : 0;
+
+    // Pinned blocks are only handed out again to requests for pinned memory.
+    if (pinnedBlocks.contains(ptr)) {
+        key |= CPUMemoryHints::PinnedKey;
+    }
+
+    if ((cachedBytes + classSize) <= _capacity) {
+        freeLists[{classSize, key}].push_back(ptr);
+        cachedBytes += classSize;
+        return;
+    }
+
+    releaseBlock(ptr, classSize, key);
+}
+
+bool CPUMemoryPool::pin(void* ptr, const U64& classSize) {
+    if (!ptr) {
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex);
+
+    if (pinnedBlocks.contains(ptr)) {
+        return true;
+    }
+
+    return pinBlock(ptr, classSize);
+}
+
+bool CPUMemoryPool::pinned(void* ptr) {
+    std::lock_guard<std::mutex> lock(mutex);
+    return pinnedBlocks.contains(ptr);
+}
+
+bool CPUMemoryPool::pinBlock(void* ptr, const U64& classSize) {
+#ifdef JETSTREAM_BACKEND_CUDA_AVAILABLE
+    if (cudaHostRegister(ptr, classSize, cudaHostRegisterPortable) != cudaSuccess) {
+        // Clear the error so it isn't reported by the next CUDA call.
+        cudaGetLastError();
+
+        JST_DEBUG("[CPU:POOL] Can't pin {} bytes at {}.", classSize, jst::fmt::ptr(ptr));
+        return false;
+    }
+
+    JST_TRACE("[CPU:POOL] Pinned {} bytes at {}.", classSize, jst::fmt::ptr(ptr));
+    pinnedBlocks.insert(ptr);
+    return true;
+#else
+    (void)ptr;
+    (void)classSize;
+    return false;
+#endif
+}
+
+void CPUMemoryPool::setCapacity(const U64& capacity) {
+    std::lock_guard<std::mutex> lock(mutex);
+    _capacity = capacity;
+    release(_capacity);
+}
+
+void CPUMemoryPool::setHints(const CPUMemoryHints& hints) {
+    std::lock_guard<std::mutex> lock(mutex);
+    globalHints = hints;
+}
+
+void CPUMemoryPool::trim() {
+    std::lock_guard<std::mutex> lock(mutex);
+    release(0);
+}
+
+U64 CPUMemoryPool::cached() {
+    std::lock_guard<std::mutex> lock(mutex);
+    return cachedBytes;
+}
+
+void CPUMemoryPool::release(const U64& target) {
+    for (auto it = freeLists.begin(); it != freeLists.end() && cachedBytes > target;) {
+        auto& [bucket, ptrs] = *it;
+        const auto& [classSize, key] = bucket;
+
+        while (!ptrs.empty() && cachedBytes > target) {
+            releaseBlock(ptrs.back(), classSize, key);
+            ptrs.pop_back();
+            cachedBytes -= classSize;
+        }
+
+        it = ptrs.empty() ? freeLists.erase(it) : std::next(it);
+    }
+}
+
+void CPUMemoryPool::releaseBlock(void* ptr, const U64& classSize, const U64& key) {
+#ifdef JETSTREAM_BACKEND_CUDA_AVAILABLE
+    if ((key & CPUMemoryHints::PinnedKey) != 0) {
+        cudaHostUnregister(ptr);
+        pinnedBlocks.erase(ptr);
+    }
+#endif
+
+#ifdef JST_OS_LINUX
+    if ((key & ~CPUMemoryHints::PinnedKey) != 0) {
+        hintedBlocks.erase(ptr);
+        FreeHintedMemory(ptr, classSize);
+        return;
+    }
+#else
+    (void)classSize;
+    (void)key;
+#endif
+
+    FreeSystemMemory(ptr);
+}
+
+}  // namespace Jetstream
@@ -1,3 +1,6 @@
+#include <atomic>
+#include <cstring>
+
 #include "jetstream/memory/devices/cuda/buffer.hh"
 #include "jetstream/backend/devices/cuda/helpers.hh"
 
@@ -8,6 +11,7 @@
 
 #ifdef JETSTREAM_BACKEND_CPU_AVAILABLE
 #include "jetstream/memory/devices/cpu/buffer.hh"
+#include "jetstream/memory/devices/cpu/pool.hh"
 #endif
 
 #ifdef JETSTREAM_BACKEND_METAL_AVAILABLE
@@ -18,6 +22,12 @@ namespace Jetstream {
 
 using Implementation = TensorBuffer<Device::CUDA>;
 
+static std::atomic<bool> mirroredMemory{false};
+
+void Implementation::SetMirroredMemory(const bool& enabled) {
+    mirroredMemory = enabled;
+}
+
 Implementation::TensorBuffer(std::shared_ptr<TensorStorageMetadata>& storage,
                              const TensorPrototypeMetadata& prototype,
                              const bool& host_accessible) {
@@ -40,7 +50,28 @@ Implementation::TensorBuffer(std::shared_ptr<TensorStorageMetadata>& storage,
     // Allocate memory.
 
     if (prototype.size_bytes > 0) {
-        if (host_accessible) {
+        // Integrated devices share the memory, so managed memory doesn't migrate.
+        const bool mirror = host_accessible && mirroredMemory && !Backend::State<Device::CUDA>()->hasUnifiedMemory();
+
+        if (mirror) {
+            size_bytes = JST_PAGE_ALIGNED_SIZE(prototype.size_bytes);
+
+            JST_CUDA_CHECK_THROW(cudaMalloc(&buffer, size_bytes), [&]{
+                JST_FATAL("[CUDA:BUFFER] Failed to allocate CUDA memory: {}", err);
+            });
+
+            JST_CUDA_CHECK_THROW(cudaMallocHost(&host_buffer, size_bytes), [&]{
+                JST_FATAL("[CUDA:BUFFER] Failed to allocate pinned host mirror: {}", err);
+            });
+
+            std::memset(host_buffer, 0, size_bytes);
+
+            // Set buffer flags.
+
+            set_allocated();
+            set_device_native();
+            set_host_accessible();
+        } else if (host_accessible) {
             size_bytes = JST_PAGE_ALIGNED_SIZE(prototype.size_bytes);
 
             JST_CUDA_CHECK_THROW(cudaMallocManaged(&buffer, size_bytes), [&]{
@@ -103,6 +134,11 @@ Implementation::TensorBuffer(std::shared_ptr<TensorStorageMetadata>& storage,
             set_device_native();
         }
 
+        track_memory(storage, Device::CUDA, size_bytes);
+        if (mirror) {
+            track_memory(storage, Device::CPU, size_bytes);
+        }
+
         // Null out array.
 
         JST_CUDA_CHECK_THROW(cudaMemset(buffer, 0, size_bytes), [&]{
@@ -300,11 +336,19 @@ Implementation::TensorBuffer(std::shared_ptr<TensorStorageMetadata>&,
         JST_FATAL("[CUDA:BUFFER] Failed to get CPU buffer attributes: {}", err);
     });
 
-    if (attributes.type == cudaMemoryTypeUnregistered && JST_IS_ALIGNED(root_buffer->data())) {
+    // Blocks of the CPU memory pool stay pinned while cached, so reloads only
+    // pay for the registration once. Other buffers are pinned by this clone.
+
+    const bool pooled = root_buffer->allocated() && !root_buffer->aliased();
+
+    if (attributes.type == cudaMemoryTypeUnregistered &&
+        !(pooled && CPUMemoryPool::Get().pin(root_buffer->data(), root_buffer->size_bytes())) &&
+        JST_IS_ALIGNED(root_buffer->data())) {
         const auto size_bytes = JST_PAGE_ALIGNED_SIZE(prototype.size_bytes);
         JST_CUDA_CHECK_THROW(cudaHostRegister(root_buffer->data(), size_bytes, cudaHostRegisterPortable), [&]{
             JST_FATAL("[CUDA:BUFFER] Failed to pin CPU buffer: {}", err);
         });
+        host_registered = true;
     }
 
     // Initialize storage.
@@ -388,7 +432,7 @@ Implementation::~TensorBuffer() {
     // Unregister CPU buffer from CUDA.
 
 #ifdef JETSTREAM_BACKEND_CUDA_AVAILABLE
-    if (external_memory_device() == Device::CPU) {
+    if (external_memory_device() == Device::CPU && host_registered) {
         [&]{
             JST_CUDA_CHECK(cudaHostUnregister(buffer), [&]{
                 JST_WARN("[CPU:BUFFER] Failed to unregister buffer from CUDA: {}", err);
@@ -408,7 +452,35 @@ Implementation::~TensorBuffer() {
         } else {
             cudaFree(buffer);
         }
+
+        if (host_buffer) {
+            cudaFreeHost(host_buffer);
+        }
+    }
+}
+
+Result Implementation::upload(const cudaStream_t& stream) {
+    if (!host_buffer) {
+        return Result::SUCCESS;
+    }
+
+    JST_CUDA_CHECK(cudaMemcpyAsync(buffer, host_buffer, size_bytes, cudaMemcpyHostToDevice, stream), [&]{
+        JST_ERROR("[CUDA:BUFFER] Failed to upload host mirror: {}", err);
+    });
+
+    return Result::SUCCESS;
+}
+
+Result Implementation::download(const cudaStream_t& stream) {
+    if (!host_buffer) {
+        return Result::SUCCESS;
     }
+
+    JST_CUDA_CHECK(cudaMemcpyAsync(host_buffer, buffer, size_bytes, cudaMemcpyDeviceToHost, stream), [&]{
+        JST_ERROR("[CUDA:BUFFER] Failed to download host mirror: {}", err);
+    });
+
+    return Result::SUCCESS;
 }
 
 }  // namespace Jetstream
\ No newline at end of file
@@ -0,0 +1,77 @@
+#include "jetstream/memory/devices/cuda/copy.hh"
+
+namespace Jetstream::Memory::CUDA {
+
+namespace {
+
+struct StagingBuffer {
+    void* buffer = nullptr;
+    U64 size = 0;
+    cudaEvent_t event = nullptr;
+    bool pending = false;
+
+    ~StagingBuffer() {
+        if (event) {
+            cudaEventSynchronize(event);
+            cudaEventDestroy(event);
+        }
+        if (buffer) {
+            cudaFreeHost(buffer);
+        }
+    }
+};
+
+thread_local StagingBuffer staging;
+
+}  // namespace
+
+Result AcquireStagingBuffer(const U64& size, void** buffer) {
+    // Wait for the previous copy to read or write the buffer.
+
+    if (staging.pending) {
+        JST_CUDA_CHECK(cudaEventSynchronize(staging.event), [&]{
+            JST_ERROR("[CUDA:COPY] Failed to wait for staging buffer: {}", err);
+        });
+        staging.pending = false;
+    }
+
+    if (!staging.event) {
+        JST_CUDA_CHECK(cudaEventCreateWithFlags(&staging.event, cudaEventDisableTiming), [&]{
+            JST_ERROR("[CUDA:COPY] Failed to create staging event: {}", err);
+        });
+    }
+
+    if (staging.size < size) {
+        if (staging.buffer) {
+            JST_CUDA_CHECK(cudaFreeHost(staging.buffer), [&]{
+                JST_ERROR("[CUDA:COPY] Failed to free staging buffer: {}", err);
+            });
+            staging.buffer = nullptr;
+            staging.size = 0;
+        }
+
+        const U64 stagingSize = JST_PAGE_ALIGNED_SIZE(size);
+
+        JST_CUDA_CHECK(cudaMallocHost(&staging.buffer, stagingSize), [&]{
+            JST_ERROR("[CUDA:COPY] Failed to allocate {} bytes of pinned staging memory: {}", stagingSize, err);
+        });
+        staging.size = stagingSize;
+
+        JST_TRACE("[CUDA:COPY] Grew staging buffer to {} bytes.", stagingSize);
+    }
+
+    *buffer = staging.buffer;
+
+    return Result::SUCCESS;
+}
+
+Result ReleaseStagingBuffer(const cudaStream_t& stream) {
+    JST_CUDA_CHECK(cudaEventRecord(staging.event, stream), [&]{
+        JST_ERROR("[CUDA:COPY] Failed to record staging event: {}", err);
+    });
+    staging.pending = true;
+
+    return Result::SUCCESS;
+}
+
+}  // namespace Jetstream::Memory::CUDA
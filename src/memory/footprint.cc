@@ -0,0 +1,151 @@
+#include <algorithm>
+
+#include "jetstream/memory/footprint.hh"
+#include "jetstream/memory/metadata.hh"
+#include "jetstream/logger.hh"
+
+namespace Jetstream {
+
+static thread_local const std::string* ScopedBlockOverride = nullptr;
+
+MemoryFootprint::ScopedBlock::ScopedBlock(const std::string& block)
+     : previous(ScopedBlockOverride),
+       block(block) {
+    ScopedBlockOverride = &this->block;
+}
+
+MemoryFootprint::ScopedBlock::~ScopedBlock() {
+    ScopedBlockOverride = previous;
+}
+
+MemoryFootprint& MemoryFootprint::Get() {
+    // Never destroyed. Buffers held by other static objects
+    // can still be released during the program exit.
+    static auto* footprint = new MemoryFootprint();
+    return *footprint;
+}
+
+void MemoryFootprint::Add(Usage& usage, const U64& bytes) {
+    usage.current += bytes;
+    usage.peak = std::max(usage.peak, usage.current);
+}
+
+void MemoryFootprint::Subtract(Usage& usage, const U64& bytes) {
+    usage.current -= std::min(usage.current, bytes);
+}
+
+void MemoryFootprint::allocate(const TensorStorageMetadata* storage, const Device& device, const U64& bytes) {
+    if (!storage || bytes == 0) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex);
+
+    auto [it, created] = entries.try_emplace(storage);
+    auto& entry = it->second;
+
+    if (created) {
+        if (!storage->locale.empty()) {
+            entry.block = storage->locale.blockId;
+        } else if (ScopedBlockOverride) {
+            entry.block = *ScopedBlockOverride;
+        }
+    }
+
+    entry.bytes[device] += bytes;
+
+    Add(blockUsage[entry.block][device], bytes);
+    Add(deviceUsage[device], bytes);
+    _version++;
+
+    JST_TRACE("[MEMORY:FOOTPRINT] Allocated {} bytes on {} for '{}'.", bytes, GetDevicePrettyName(device), entry.block);
+}
+
+void MemoryFootprint::release(const TensorStorageMetadata* storage, const Device& device, const U64& bytes) {
+    if (!storage || bytes == 0) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex);
+
+    auto it = entries.find(storage);
+    if (it == entries.end()) {
+        return;
+    }
+    auto& entry = it->second;
+
+    const U64 released = std::min(entry.bytes[device], bytes);
+    entry.bytes[device] -= released;
+
+    Subtract(blockUsage[entry.block][device], released);
+    Subtract(deviceUsage[device], released);
+    _version++;
+
+    // The storage pointer is a key only. It might already be gone here.
+
+    bool empty = true;
+    for (const auto& [_, remaining] : entry.bytes) {
+        empty &= remaining == 0;
+    }
+    if (empty) {
+        entries.erase(it);
+    }
+}
+
+void MemoryFootprint::attribute(const TensorStorageMetadata* storage, const std::string& block) {
+    std::lock_guard<std::mutex> lock(mutex);
+
+    auto it = entries.find(storage);
+    if (it == entries.end() || it->second.block == block) {
+        return;
+    }
+    auto& entry = it->second;
+
+    for (const auto& [device, bytes] : entry.bytes) {
+        Subtract(blockUsage[entry.block][device], bytes);
+        Add(blockUsage[block][device], bytes);
+    }
+    entry.block = block;
+    _version++;
+}
+
+MemoryFootprint::DeviceUsage MemoryFootprint::devices() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return deviceUsage;
+}
+
+MemoryFootprint::BlockUsage MemoryFootprint::blocks() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return blockUsage;
+}
+
+MemoryFootprint::DeviceUsage MemoryFootprint::block(const std::string& block) const {
+    std::lock_guard<std::mutex> lock(mutex);
+
+    auto it = blockUsage.find(block);
+    if (it == blockUsage.end()) {
+        return {};
+    }
+    return it->second;
+}
+
+U64 MemoryFootprint::version() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return _version;
+}
+
+void MemoryFootprint::resetPeaks() {
+    std::lock_guard<std::mutex> lock(mutex);
+
+    for (auto& [_, usage] : deviceUsage) {
+        usage.peak = usage.current;
+    }
+    for (auto& [_, devices] : blockUsage) {
+        for (auto& [_, usage] : devices) {
+            usage.peak = usage.current;
+        }
+    }
+    _version++;
+}
+
+}  // namespace Jetstream
@@ -45,6 +45,8 @@ Implementation::TensorBuffer(std::shared_ptr<TensorStorageMetadata>& storage,
             JST_CHECK_THROW(Result::ERROR);
         }
 
+        track_memory(storage, Device::Metal, alignedSizeBytes);
+
         // Set buffer flags.
 
         set_allocated();
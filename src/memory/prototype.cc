@@ -4,6 +4,76 @@
 
 namespace Jetstream {
 
+bool TensorPrototype::IsContiguous(const std::vector<U64>& shape, const std::vector<U64>& stride) {
+    U64 expected_stride = 1;
+    for (int64_t i = shape.size() - 1; i >= 0; i--) {
+        if (stride[i] != expected_stride) {
+            return false;
+        }
+        expected_stride *= shape[i];
+    }
+    return true;
+}
+
+bool TensorPrototype::ViewStride(const std::vector<U64>& shape,
+                                 const std::vector<U64>& stride,
+                                 const std::vector<U64>& new_shape,
+                                 std::vector<U64>& new_stride) {
+    // Dimensions of size one can be dropped without changing the layout.
+
+    std::vector<U64> old_shape;
+    std::vector<U64> old_stride;
+    for (U64 i = 0; i < shape.size(); i++) {
+        if (shape[i] != 1) {
+            old_shape.push_back(shape[i]);
+            old_stride.push_back(stride[i]);
+        }
+    }
+
+    new_stride.assign(new_shape.size(), 1);
+
+    // Match groups of old and new dimensions with the same number of elements.
+    // The old group must be contiguous in itself to be merged or split.
+
+    U64 oi = 0, oj = 1;
+    U64 ni = 0, nj = 1;
+
+    while (ni < new_shape.size() && oi < old_shape.size()) {
+        U64 np = new_shape[ni];
+        U64 op = old_shape[oi];
+
+        while (np != op) {
+            if (np < op) {
+                np *= new_shape[nj++];
+            } else {
+                op *= old_shape[oj++];
+            }
+        }
+
+        for (U64 ok = oi; ok + 1 < oj; ok++) {
+            if (old_stride[ok] != old_shape[ok + 1] * old_stride[ok + 1]) {
+                return false;
+            }
+        }
+
+        new_stride[nj - 1] = old_stride[oj - 1];
+        for (U64 nk = nj - 1; nk > ni; nk--) {
+            new_stride[nk - 1] = new_stride[nk] * new_shape[nk];
+        }
+
+        ni = nj++;
+        oi = oj++;
+    }
+
+    // Trailing dimensions of size one.
+
+    for (U64 i = ni; i < new_shape.size(); i++) {
+        new_stride[i] = (i > 0) ? new_stride[i - 1] : 1;
+    }
+
+    return true;
+}
+
 void TensorPrototype::initialize(const std::vector<U64>& shape, const U64& element_size) {
     prototype.element_size = element_size;
 
@@ -117,12 +187,6 @@ Result TensorPrototype::reshape(const std::vector<U64>& shape) {
         return Result::ERROR;
     }
 
-    if (!prototype.contiguous) {
-        // TODO: Implement reshape for non-contiguous tensors.
-        JST_ERROR("[MEMORY] Cannot reshape non-contiguous tensor.");
-        return Result::ERROR;
-    }
-
     const U64& og_size = prototype.size;
 
     U64 new_size = 1;
@@ -139,16 +203,28 @@ Result TensorPrototype::reshape(const std::vector<U64>& shape) {
         return Result::ERROR;
     }
 
-    prototype.shape = shape;
+    std::vector<U64> stride(shape.size());
 
-    prototype.stride.resize(prototype.shape.size());
-    for (U64 i = 0; i < prototype.shape.size(); i++) {
-        prototype.stride[i] = 1;
-        for (U64 j = i + 1; j < prototype.shape.size(); j++) {
-            prototype.stride[i] *= prototype.shape[j];
+    if (prototype.contiguous) {
+        for (U64 i = 0; i < shape.size(); i++) {
+            stride[i] = 1;
+            for (U64 j = i + 1; j < shape.size(); j++) {
+                stride[i] *= shape[j];
+            }
         }
+    } else if (!ViewStride(prototype.shape, prototype.stride, shape, stride)) {
+        JST_ERROR("[MEMORY] Cannot reshape non-contiguous tensor from {} to {} without a copy.",
+                  prototype.shape, shape);
+        return Result::ERROR;
     }
 
+    JST_TRACE("[MEMORY] Reshape shape: {} -> {}.", prototype.shape, shape);
+    JST_TRACE("[MEMORY] Reshape stride: {} -> {}.", prototype.stride, stride);
+
+    prototype.shape = shape;
+    prototype.stride = stride;
+    prototype.contiguous = IsContiguous(shape, stride);
+
     update_cache();
 
     return Result::SUCCESS;
@@ -292,17 +368,7 @@ Result TensorPrototype::slice(const std::vector<Token>& slice) {
     JST_TRACE("[MEMORY] Slice stride: {} -> {}.", prototype.stride, stride);
     JST_TRACE("[MEMORY] Slice offset: {}.", offset);
 
-    prototype.contiguous = true;
-    if (!shape.empty()) {
-        U64 expected_stride = 1;
-        for (int64_t i = shape.size() - 1; i >= 0; i--) {
-            if (stride[i] != expected_stride) {
-                prototype.contiguous = false;
-                break;
-            }
-            expected_stride *= shape[i];
-        }
-    }
+    prototype.contiguous = IsContiguous(shape, stride);
 
     prototype.shape = shape;
     prototype.stride = stride;
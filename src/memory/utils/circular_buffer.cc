@@ -3,45 +3,364 @@
 #include <compare>
 
 #include "jetstream/memory/utils/circular_buffer.hh"
+#include "jetstream/memory/macros.hh"
+#include "jetstream/logger.hh"
+
+#if defined(JST_OS_LINUX) || defined(JST_OS_ANDROID) || defined(JST_OS_MAC) || defined(JST_OS_IOS)
+#define JST_CIRCULAR_BUFFER_MIRRORED
+#include <fcntl.h>
+#include <sys/mman.h>
+#endif
 
 using namespace std::chrono_literals;
 
 namespace Jetstream::Memory {
 
+#ifdef JST_CIRCULAR_BUFFER_MIRRORED
+
+// Maps the same pages twice back-to-back. Returns nullptr on failure.
+static void* MapMirrored(const U64& size) {
+#if defined(JST_OS_LINUX) || defined(JST_OS_ANDROID)
+    const int fd = memfd_create("jst-circular-buffer", MFD_CLOEXEC);
+#else
+    const std::string name = jst::fmt::format("/jst-circular-buffer-{}-{}", getpid(), reinterpret_cast<uintptr_t>(&size));
+    const int fd = shm_open(name.c_str(), O_RDWR | O_CREAT | O_EXCL, 0600);
+    shm_unlink(name.c_str());
+#endif
+    if (fd < 0) {
+        return nullptr;
+    }
+
+    if (ftruncate(fd, size) != 0) {
+        close(fd);
+        return nullptr;
+    }
+
+    // Reserve both halves at once so nothing else lands in between.
+    auto* base = static_cast<U8*>(mmap(nullptr, 2 * size, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0));
+    if (base == MAP_FAILED) {
+        close(fd);
+        return nullptr;
+    }
+
+    for (U64 i = 0; i < 2; i++) {
+        if (mmap(base + i * size, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, 0) == MAP_FAILED) {
+            munmap(base, 2 * size);
+            close(fd);
+            return nullptr;
+        }
+    }
+
+    close(fd);
+    return base;
+}
+
+#endif
+
+static U64 Now() {
+    const auto elapsed = std::chrono::steady_clock::now().time_since_epoch();
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count();
+}
+
+template<class T>
+void CircularBuffer<T>::allocate(const U64& capacity) {
+    release();
+
+    this->capacity = capacity;
+
+    if (capacity == 0) {
+        return;
+    }
+
+#ifdef JST_CIRCULAR_BUFFER_MIRRORED
+    const U64 size = JST_PAGE_ALIGNED_SIZE(capacity * sizeof(T));
+    if (size % sizeof(T) == 0) {
+        if (void* ptr = MapMirrored(size)) {
+            this->buffer = static_cast<T*>(ptr);
+            this->capacity = size / sizeof(T);
+            this->mirrored = true;
+            return;
+        }
+        JST_DEBUG("[CIRCULAR_BUFFER] Can't mirror the storage. Falling back to split transfers.");
+    }
+#endif
+
+    this->buffer = new T[capacity];
+}
+
+template<class T>
+void CircularBuffer<T>::release() {
+    if (!buffer) {
+        return;
+    }
+
+#ifdef JST_CIRCULAR_BUFFER_MIRRORED
+    if (mirrored) {
+        munmap(buffer, 2 * capacity * sizeof(T));
+    }
+#endif
+
+    if (!mirrored) {
+        delete[] buffer;
+    }
+
+    buffer = nullptr;
+    mirrored = false;
+}
+
 template<class T>
 CircularBuffer<T>::CircularBuffer()
-     : transfers(0),
-       throughput(0.0),
+     : mode(Mode::Locked),
        capacity(0),
-       overflows(0) {
+       waiters(0),
+       overflows(0),
+       droppedElements(0),
+       overflowPolicy(OverflowPolicy::DropOldest),
+       throughput(0.0),
+       producerRate(0.0),
+       lastLatency(0),
+       maxLatency(0),
+       occupancySum(0),
+       head(0),
+       transfers(0),
+       markCursor(0),
+       tail(0),
+       markHead(0),
+       producerTransfers(0) {
     this->reset();
 }
 
 template<class T>
-CircularBuffer<T>::CircularBuffer(const U64& capacity)
-     : transfers(0),
-       throughput(0.0),
+CircularBuffer<T>::CircularBuffer(const U64& capacity, const Mode& mode)
+     : mode(mode),
        capacity(capacity),
-       overflows(0) {
+       waiters(0),
+       overflows(0),
+       droppedElements(0),
+       overflowPolicy(OverflowPolicy::DropOldest),
+       throughput(0.0),
+       producerRate(0.0),
+       lastLatency(0),
+       maxLatency(0),
+       occupancySum(0),
+       head(0),
+       transfers(0),
+       markCursor(0),
+       tail(0),
+       markHead(0),
+       producerTransfers(0) {
     this->reset();
-    this->buffer = std::unique_ptr<T[]>(new T[getCapacity()]);
+    this->allocate(capacity);
 }
 
 template<class T>
 CircularBuffer<T>::~CircularBuffer() {
     semaphore.notify_all();
     io_mtx.lock();
-    buffer.reset();
+    release();
+    io_mtx.unlock();
 }
 
 template<class T>
 Result CircularBuffer<T>::waitBufferOccupancy(const U64& size) {
+    if (getOccupancy() >= size) {
+        return Result::SUCCESS;
+    }
+
     std::unique_lock<std::mutex> sync(sync_mtx);
+    waiters.fetch_add(1);
+    Result res = Result::SUCCESS;
     while (getOccupancy() < size) {
-        if (semaphore.wait_for(sync, 5s) == std::cv_status::timeout)
-            return Result::TIMEOUT;
+        if (semaphore.wait_for(sync, 5s) == std::cv_status::timeout) {
+            res = Result::TIMEOUT;
+            break;
+        }
     }
-    return Result::SUCCESS;
+    waiters.fetch_sub(1);
+    return res;
+}
+
+template<class T>
+Result CircularBuffer<T>::waitBufferSpace(const U64& size) {
+    if ((getCapacity() - getOccupancy()) >= size) {
+        return Result::SUCCESS;
+    }
+
+    std::unique_lock<std::mutex> sync(sync_mtx);
+    waiters.fetch_add(1);
+    Result res = Result::SUCCESS;
+    while ((getCapacity() - getOccupancy()) < size) {
+        if (semaphore.wait_for(sync, 5s) == std::cv_status::timeout) {
+            res = Result::TIMEOUT;
+            break;
+        }
+    }
+    waiters.fetch_sub(1);
+    return res;
+}
+
+template<class T>
+void CircularBuffer<T>::recordGap(const U64& position, const U64& size) {
+    overflows.fetch_add(1, std::memory_order_relaxed);
+    droppedElements.fetch_add(size, std::memory_order_relaxed);
+
+    const std::lock_guard<std::mutex> lock(gap_mtx);
+    gaps.push_back({position, size, std::chrono::steady_clock::now()});
+    if (gaps.size() > MaxGaps) {
+        gaps.pop_front();
+    }
+}
+
+template<class T>
+std::vector<typename CircularBuffer<T>::Gap> CircularBuffer<T>::takeGaps() {
+    const std::lock_guard<std::mutex> lock(gap_mtx);
+    std::vector<Gap> taken(gaps.begin(), gaps.end());
+    gaps.clear();
+    return taken;
+}
+
+template<class T>
+void CircularBuffer<T>::setOverflowPolicy(const OverflowPolicy& policy) {
+    overflowPolicy.store(policy, std::memory_order_relaxed);
+}
+
+template<class T>
+void CircularBuffer<T>::notifyWaiters() {
+    // The index stores and this load are all sequentially consistent. Either the
+    // waiter sees the new occupancy or the notifier sees the waiter.
+    if (waiters.load() == 0) {
+        return;
+    }
+
+    {
+        const std::lock_guard<std::mutex> sync(sync_mtx);
+    }
+    semaphore.notify_all();
+}
+
+template<class T>
+void CircularBuffer<T>::updateThroughput(const U64& size) {
+    const auto now = std::chrono::steady_clock::now();
+    const std::chrono::duration<double> elapsed = now - lastGet;
+
+    if (elapsed.count() > 0.5) {
+        throughput.store(static_cast<F64>(transfers) / elapsed.count(), std::memory_order_relaxed);
+        transfers = 0;
+        lastGet = now;
+    }
+
+    transfers += size;
+}
+
+template<class T>
+void CircularBuffer<T>::recordPut(const U64& position, const U64& size) {
+    // Remember when the elements before this position were put.
+    const U64 index = markHead.load(std::memory_order_relaxed);
+    auto& mark = marks[index % MaxMarks];
+
+    mark.sequence.store(index * 2 + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    mark.position = position;
+    mark.time = Now();
+    mark.sequence.store(index * 2 + 2, std::memory_order_release);
+
+    markHead.store(index + 1, std::memory_order_release);
+
+    // Sample the occupancy.
+    const U64 occupancy = getOccupancy();
+    const U64 bucket = JST_MIN(occupancy * OccupancyBuckets / std::max<U64>(getCapacity(), 1), OccupancyBuckets - 1);
+    occupancyHistogram[bucket].fetch_add(1, std::memory_order_relaxed);
+    occupancySum.fetch_add(occupancy, std::memory_order_relaxed);
+
+    // Producer rate.
+    const auto now = std::chrono::steady_clock::now();
+    const std::chrono::duration<double> elapsed = now - lastPut;
+
+    if (elapsed.count() > 0.5) {
+        producerRate.store(static_cast<F64>(producerTransfers) / elapsed.count(), std::memory_order_relaxed);
+        producerTransfers = 0;
+        lastPut = now;
+    }
+
+    producerTransfers += size;
+}
+
+template<class T>
+void CircularBuffer<T>::recordGet(const U64& position) {
+    const U64 now = Now();
+    const U64 published = markHead.load(std::memory_order_acquire);
+
+    // Marks overwritten before being read are skipped.
+    if (published - markCursor > MaxMarks) {
+        markCursor = published - MaxMarks;
+    }
+
+    U64 latency = 0;
+    bool measured = false;
+
+    while (markCursor < published) {
+        const auto& mark = marks[markCursor % MaxMarks];
+
+        const U64 sequence = markCursor * 2 + 2;
+        if (mark.sequence.load(std::memory_order_acquire) != sequence) {
+            markCursor++;
+            continue;
+        }
+        const U64 markPosition = mark.position;
+        const U64 markTime = mark.time;
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (mark.sequence.load(std::memory_order_relaxed) != sequence) {
+            markCursor++;
+            continue;
+        }
+
+        // The elements of this put weren't all read yet.
+        if (markPosition > position) {
+            break;
+        }
+
+        latency = std::max(latency, now - JST_MIN(markTime, now));
+        measured = true;
+        markCursor++;
+    }
+
+    if (!measured) {
+        return;
+    }
+
+    lastLatency.store(latency, std::memory_order_relaxed);
+    if (latency > maxLatency.load(std::memory_order_relaxed)) {
+        maxLatency.store(latency, std::memory_order_relaxed);
+    }
+}
+
+template<class T>
+typename CircularBuffer<T>::Statistics CircularBuffer<T>::getStatistics() const {
+    Statistics statistics;
+
+    statistics.capacity = getCapacity();
+    statistics.occupancy = getOccupancy();
+    statistics.overflows = getOverflows();
+    statistics.droppedElements = getDroppedElements();
+    statistics.producerRate = producerRate.load(std::memory_order_relaxed);
+    statistics.consumerRate = getThroughput();
+    statistics.lastLatency = static_cast<F64>(lastLatency.load(std::memory_order_relaxed)) / 1e9;
+    statistics.maxLatency = static_cast<F64>(maxLatency.load(std::memory_order_relaxed)) / 1e9;
+    for (U64 i = 0; i < OccupancyBuckets; i++) {
+        statistics.occupancyHistogram[i] = occupancyHistogram[i].load(std::memory_order_relaxed);
+    }
+    statistics.occupancySum = occupancySum.load(std::memory_order_relaxed);
+
+    return statistics;
+}
+
+template<class T>
+void CircularBuffer<T>::resetStatistics() {
+    for (auto& bucket : occupancyHistogram) {
+        bucket.store(0, std::memory_order_relaxed);
+    }
+    occupancySum.store(0, std::memory_order_relaxed);
+    maxLatency.store(0, std::memory_order_relaxed);
 }
 
 template<class T>
@@ -51,38 +370,36 @@ Result CircularBuffer<T>::get(T* buf, const U64& size) {
     }
 
     Result res = waitBufferOccupancy(size);
-    if (res != Result::SUCCESS)
-        goto exception;
+    if (res != Result::SUCCESS) {
+        return res;
+    }
 
     {
-        const std::lock_guard<std::mutex> lock(io_mtx);
+        std::unique_lock<std::mutex> lock(io_mtx, std::defer_lock);
+        if (mode == Mode::Locked) {
+            lock.lock();
+        }
 
-        U64 stage_a = JST_MIN(size, getCapacity() - head);
+        const U64 h = head.load(std::memory_order_relaxed);
+        const U64 offset = h % getCapacity();
+        const U64 stage_a = mirrored ? size : JST_MIN(size, getCapacity() - offset);
 
-        std::copy_n(buffer.get() + head, stage_a, buf);
+        std::copy_n(buffer + offset, stage_a, buf);
 
         if (stage_a < size) {
-            std::copy_n(buffer.get(), size - stage_a, buf + stage_a);
+            std::copy_n(buffer, size - stage_a, buf + stage_a);
         }
 
-        head = (head + size) % getCapacity();
-        occupancy -= size;
-
-        // Throughput Calculator
-        auto now = std::chrono::system_clock::now();
-        std::chrono::duration<double> elapsed = now - lastGet;
+        // Release the slots only after they were copied out.
+        head.store(h + size);
 
-        if (elapsed.count() > 0.5) {
-            throughput = static_cast<F32>(transfers) / elapsed.count();
-            transfers = 0.0;
-            lastGet = std::chrono::system_clock::now();
-        }
-
-        transfers += size;
+        recordGet(h + size);
     }
 
-exception:
-    return res;
+    notifyWaiters();
+    updateThroughput(size);
+
+    return Result::SUCCESS;
 }
 
 template<class T>
@@ -91,40 +408,158 @@ Result CircularBuffer<T>::put(const T* buf, const U64& size) {
         return Result::ERROR;
     }
 
+    auto policy = getOverflowPolicy();
+
+    // The producer can't move the head of a lock-free buffer.
+    if (mode == Mode::LockFree && policy == OverflowPolicy::DropOldest) {
+        policy = OverflowPolicy::DropNewest;
+    }
+
+    if (policy == OverflowPolicy::Block) {
+        waitBufferSpace(size);
+    }
+
     {
-        const std::lock_guard<std::mutex> lock(io_mtx);
+        std::unique_lock<std::mutex> lock(io_mtx, std::defer_lock);
+        if (mode == Mode::Locked) {
+            lock.lock();
+        }
+
+        const U64 t = tail.load(std::memory_order_relaxed);
 
         if (getCapacity() < (getOccupancy() + size)) {
-            overflows += 1;
-            occupancy = 0;
-            head = tail;
+            if (policy != OverflowPolicy::DropOldest) {
+                recordGap(t, size);
+                return Result::SUCCESS;
+            }
+
+            // Discard just enough of the oldest elements to fit.
+            const U64 excess = getOccupancy() + size - getCapacity();
+            const U64 h = head.load(std::memory_order_relaxed) + excess;
+            head.store(h, std::memory_order_relaxed);
+            recordGap(h, excess);
         }
 
-        U64 stage_a = JST_MIN(size, getCapacity() - tail);
-        std::copy_n(buf, stage_a, buffer.get() + tail);
+        const U64 offset = t % getCapacity();
+        const U64 stage_a = mirrored ? size : JST_MIN(size, getCapacity() - offset);
+
+        std::copy_n(buf, stage_a, buffer + offset);
 
         if (stage_a < size) {
-            std::copy_n(buf + stage_a, size - stage_a, buffer.get());
+            std::copy_n(buf + stage_a, size - stage_a, buffer);
         }
 
-        tail = (tail + size) % getCapacity();
-        occupancy += size;
+        // Publish the elements only after they were copied in.
+        tail.store(t + size);
+
+        recordPut(t + size, size);
+
+        if (putCallback) {
+            putCallback();
+        }
     }
 
-    semaphore.notify_all();
+    notifyWaiters();
     return Result::SUCCESS;
 }
 
+template<class T>
+T* CircularBuffer<T>::reserve(const U64& size) {
+    if (mode != Mode::LockFree || getCapacity() < (getOccupancy() + size)) {
+        return nullptr;
+    }
+
+    const U64 offset = tail.load(std::memory_order_relaxed) % getCapacity();
+    if (!mirrored && (offset + size) > getCapacity()) {
+        return nullptr;
+    }
+
+    return buffer + offset;
+}
+
+template<class T>
+Result CircularBuffer<T>::commit(const U64& size) {
+    if (mode != Mode::LockFree) {
+        return Result::ERROR;
+    }
+
+    const U64 t = tail.load(std::memory_order_relaxed) + size;
+    tail.store(t);
+
+    recordPut(t, size);
+
+    if (putCallback) {
+        putCallback();
+    }
+
+    notifyWaiters();
+    return Result::SUCCESS;
+}
+
+template<class T>
+const T* CircularBuffer<T>::peek(const U64& size) {
+    if (mode != Mode::LockFree || getOccupancy() < size) {
+        return nullptr;
+    }
+
+    const U64 offset = head.load(std::memory_order_relaxed) % getCapacity();
+    if (!mirrored && (offset + size) > getCapacity()) {
+        return nullptr;
+    }
+
+    return buffer + offset;
+}
+
+template<class T>
+Result CircularBuffer<T>::consume(const U64& size) {
+    if (mode != Mode::LockFree) {
+        return Result::ERROR;
+    }
+
+    const U64 h = head.load(std::memory_order_relaxed) + size;
+    head.store(h);
+
+    recordGet(h);
+    notifyWaiters();
+    updateThroughput(size);
+
+    return Result::SUCCESS;
+}
+
+template<class T>
+void CircularBuffer<T>::setPutCallback(const std::function<void()>& callback) {
+    const std::lock_guard<std::mutex> lock(io_mtx);
+    putCallback = callback;
+}
+
 template<class T>
 Result CircularBuffer<T>::reset() {
     {
         const std::lock_guard<std::mutex> lock(io_mtx);
-        this->head = 0;
-        this->tail = 0;
-        this->occupancy = 0;
+        this->head.store(0);
+        this->tail.store(0);
         this->transfers = 0;
-        this->throughput = 0;
-        this->overflows = 0;
+        this->throughput.store(0.0);
+        this->overflows.store(0);
+        this->droppedElements.store(0);
+        this->lastGet = std::chrono::steady_clock::now();
+
+        this->producerRate.store(0.0);
+        this->producerTransfers = 0;
+        this->lastPut = this->lastGet;
+        this->lastLatency.store(0);
+        this->markHead.store(0);
+        this->markCursor = 0;
+        for (auto& mark : this->marks) {
+            mark.sequence.store(0);
+        }
+    }
+
+    resetStatistics();
+
+    {
+        const std::lock_guard<std::mutex> lock(gap_mtx);
+        this->gaps.clear();
     }
 
     semaphore.notify_all();
@@ -132,10 +567,10 @@ Result CircularBuffer<T>::reset() {
 }
 
 template<class T>
-Result CircularBuffer<T>::resize(const U64& capacity) {
+Result CircularBuffer<T>::resize(const U64& capacity, const Mode& mode) {
     this->reset();
-    this->capacity = capacity;
-    this->buffer = std::unique_ptr<T[]>(new T[getCapacity()]);
+    this->mode = mode;
+    this->allocate(capacity);
     return Result::SUCCESS;
 }
 
@@ -151,6 +586,7 @@ bool CircularBuffer<T>::isFull() const {
 
 template class CircularBuffer<I8>;
 template class CircularBuffer<CI8>;
+template class CircularBuffer<CI16>;
 template class CircularBuffer<F32>;
 template class CircularBuffer<CF32>;
 template class CircularBuffer<F64>;
@@ -0,0 +1,410 @@
+#include <new>
+#include <atomic>
+#include <thread>
+#include <cctype>
+#include <cerrno>
+#include <cstring>
+#include <algorithm>
+
+#include "jetstream/memory/utils/shared_ring.hh"
+#include "jetstream/memory/macros.hh"
+#include "jetstream/logger.hh"
+
+#if defined(JST_OS_LINUX) || defined(JST_OS_ANDROID) || defined(JST_OS_MAC) || defined(JST_OS_IOS)
+#define JST_SHARED_RING_AVAILABLE
+#include <fcntl.h>
+#include <signal.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+#if defined(JST_OS_LINUX) || defined(JST_OS_ANDROID)
+#define JST_SHARED_RING_FUTEX
+#include <climits>
+#include <ctime>
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#endif
+
+using namespace std::chrono_literals;
+
+namespace Jetstream::Memory {
+
+// Lives in the first page of the shared object. Indices are free running
+// byte counts. The producer owns the tail and the consumer owns the head,
+// each on its own cache line.
+struct SharedRing::Header {
+    static constexpr U32 Magic = 0x5253534A;  // "JSSR"
+    static constexpr U32 Version = 1;
+
+    // Stored last by the producer, the rest of the page is valid once set.
+    std::atomic<U32> magic;
+    U32 version;
+    U64 capacity;
+    I64 pid;
+    char datatype[32];
+
+    alignas(64) std::atomic<U64> tail;
+    std::atomic<U64> dropped;
+    // Futex word bumped on every commit. The consumer flags itself as
+    // waiting so commits don't make a syscall when nobody sleeps.
+    std::atomic<U32> sequence;
+    std::atomic<U32> waiting;
+
+    alignas(64) std::atomic<U64> head;
+
+    alignas(64) std::atomic<U32> closed;
+};
+
+static_assert(std::atomic<U64>::is_always_lock_free && std::atomic<U32>::is_always_lock_free,
+              "Shared memory indices have to be lock-free to be shared between processes.");
+static_assert(sizeof(std::atomic<U32>) == sizeof(U32), "Futex words have to be plain integers.");
+
+#ifdef JST_SHARED_RING_AVAILABLE
+
+static void FutexWait(std::atomic<U32>& word, const U32& expected, const std::chrono::milliseconds& timeout) {
+#ifdef JST_SHARED_RING_FUTEX
+    const timespec ts = {
+        .tv_sec = static_cast<time_t>(timeout.count() / 1000),
+        .tv_nsec = static_cast<long>((timeout.count() % 1000) * 1000000),
+    };
+    // Not private, the word is shared between processes.
+    syscall(SYS_futex, reinterpret_cast<U32*>(&word), FUTEX_WAIT, expected, &ts, nullptr, 0);
+#else
+    if (word.load() == expected) {
+        std::this_thread::sleep_for(std::min(timeout, std::chrono::milliseconds(1)));
+    }
+#endif
+}
+
+static void FutexWake(std::atomic<U32>& word) {
+#ifdef JST_SHARED_RING_FUTEX
+    syscall(SYS_futex, reinterpret_cast<U32*>(&word), FUTEX_WAKE, INT_MAX, nullptr, nullptr, 0);
+#else
+    (void)word;
+#endif
+}
+
+// Maps the control page followed by the storage twice back-to-back.
+static U8* MapShared(const int& fd, const U64& headerSize, const U64& capacity) {
+    const U64 size = headerSize + 2 * capacity;
+
+    // Reserve everything at once so nothing else lands in between.
+    auto* base = static_cast<U8*>(mmap(nullptr, size, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0));
+    if (base == MAP_FAILED) {
+        return nullptr;
+    }
+
+    bool mapped = mmap(base, headerSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, 0) != MAP_FAILED;
+    for (U64 i = 0; mapped && i < 2; i++) {
+        U8* half = base + headerSize + i * capacity;
+        mapped = mmap(half, capacity, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, headerSize) != MAP_FAILED;
+    }
+
+    if (!mapped) {
+        munmap(base, size);
+        return nullptr;
+    }
+
+    return base;
+}
+
+#endif
+
+static bool ValidName(const std::string& name) {
+    return !name.empty() && name.size() <= 24 && std::all_of(name.begin(), name.end(), [](const char& c) {
+        return std::isalnum(static_cast<unsigned char>(c)) || c == '-' || c == '_';
+    });
+}
+
+SharedRing::SharedRing() = default;
+
+SharedRing::~SharedRing() {
+    close();
+}
+
+bool SharedRing::IsAvailable() {
+#ifdef JST_SHARED_RING_AVAILABLE
+    return true;
+#else
+    return false;
+#endif
+}
+
+Result SharedRing::create(const std::string& name, const U64& capacity, const std::string& datatype) {
+    close();
+
+#ifdef JST_SHARED_RING_AVAILABLE
+    if (!ValidName(name)) {
+        JST_ERROR("[SHARED_RING] Name '{}' is invalid. Use up to 24 letters, digits, dashes or underscores.", name);
+        return Result::ERROR;
+    }
+
+    if (capacity == 0) {
+        JST_ERROR("[SHARED_RING] Capacity is zero.");
+        return Result::ERROR;
+    }
+
+    const U64 headerSize = JST_PAGE_ALIGNED_SIZE(sizeof(Header));
+    const U64 storageSize = JST_PAGE_ALIGNED_SIZE(capacity);
+
+    // A producer that crashed leaves its ring behind. Attached consumers
+    // keep their mapping until they notice it's closed.
+    path = jst::fmt::format("/jst-{}", name);
+    shm_unlink(path.c_str());
+
+    const int fd = shm_open(path.c_str(), O_RDWR | O_CREAT | O_EXCL, 0600);
+    if (fd < 0) {
+        JST_ERROR("[SHARED_RING] Can't create shared memory '{}': {}.", path, std::strerror(errno));
+        return Result::ERROR;
+    }
+
+    if (ftruncate(fd, headerSize + storageSize) != 0) {
+        JST_ERROR("[SHARED_RING] Can't size shared memory '{}': {}.", path, std::strerror(errno));
+        ::close(fd);
+        shm_unlink(path.c_str());
+        return Result::ERROR;
+    }
+
+    U8* base = MapShared(fd, headerSize, storageSize);
+    ::close(fd);
+
+    if (!base) {
+        JST_ERROR("[SHARED_RING] Can't map shared memory '{}'.", path);
+        shm_unlink(path.c_str());
+        return Result::ERROR;
+    }
+
+    header = new (base) Header();
+    header->version = Header::Version;
+    header->capacity = storageSize;
+    header->pid = getpid();
+    std::strncpy(header->datatype, datatype.c_str(), sizeof(header->datatype) - 1);
+    header->tail.store(0);
+    header->dropped.store(0);
+    header->sequence.store(0);
+    header->waiting.store(0);
+    header->head.store(0);
+    header->closed.store(0);
+    header->magic.store(Header::Magic, std::memory_order_release);
+
+    storage = base + headerSize;
+    mappedSize = headerSize + 2 * storageSize;
+    producer = true;
+
+    return Result::SUCCESS;
+#else
+    (void)name;
+    (void)capacity;
+    (void)datatype;
+    JST_ERROR("[SHARED_RING] Shared memory isn't supported on this platform.");
+    return Result::ERROR;
+#endif
+}
+
+Result SharedRing::open(const std::string& name) {
+    close();
+
+#ifdef JST_SHARED_RING_AVAILABLE
+    if (!ValidName(name)) {
+        JST_ERROR("[SHARED_RING] Name '{}' is invalid. Use up to 24 letters, digits, dashes or underscores.", name);
+        return Result::ERROR;
+    }
+
+    path = jst::fmt::format("/jst-{}", name);
+
+    const int fd = shm_open(path.c_str(), O_RDWR, 0600);
+    if (fd < 0) {
+        return Result::ERROR;
+    }
+
+    const U64 headerSize = JST_PAGE_ALIGNED_SIZE(sizeof(Header));
+
+    // The producer may still be sizing or initializing the object.
+    struct stat st;
+    if (fstat(fd, &st) != 0 || static_cast<U64>(st.st_size) <= headerSize) {
+        ::close(fd);
+        return Result::ERROR;
+    }
+
+    void* probe = mmap(nullptr, headerSize, PROT_READ, MAP_SHARED, fd, 0);
+    if (probe == MAP_FAILED) {
+        ::close(fd);
+        return Result::ERROR;
+    }
+
+    const auto* probed = static_cast<const Header*>(probe);
+    const bool ready = probed->magic.load(std::memory_order_acquire) == Header::Magic &&
+                       probed->version == Header::Version &&
+                       (headerSize + probed->capacity) == static_cast<U64>(st.st_size);
+    const U64 capacity = probed->capacity;
+    munmap(probe, headerSize);
+
+    if (!ready) {
+        ::close(fd);
+        return Result::ERROR;
+    }
+
+    U8* base = MapShared(fd, headerSize, capacity);
+    ::close(fd);
+
+    if (!base) {
+        JST_ERROR("[SHARED_RING] Can't map shared memory '{}'.", path);
+        return Result::ERROR;
+    }
+
+    header = reinterpret_cast<Header*>(base);
+    storage = base + headerSize;
+    mappedSize = headerSize + 2 * capacity;
+    producer = false;
+
+    return Result::SUCCESS;
+#else
+    (void)name;
+    return Result::ERROR;
+#endif
+}
+
+void SharedRing::close() {
+    if (!header) {
+        return;
+    }
+
+#ifdef JST_SHARED_RING_AVAILABLE
+    if (producer) {
+        header->closed.store(1);
+        header->sequence.fetch_add(1);
+        FutexWake(header->sequence);
+        shm_unlink(path.c_str());
+    }
+
+    munmap(header, mappedSize);
+#endif
+
+    header = nullptr;
+    storage = nullptr;
+    mappedSize = 0;
+    producer = false;
+}
+
+bool SharedRing::isClosed() const {
+    if (!header) {
+        return true;
+    }
+
+    if (header->closed.load() != 0) {
+        return true;
+    }
+
+#ifdef JST_SHARED_RING_AVAILABLE
+    // A producer that crashed never marks the ring closed.
+    if (!producer && kill(static_cast<pid_t>(header->pid), 0) != 0 && errno == ESRCH) {
+        return true;
+    }
+#endif
+
+    return false;
+}
+
+U64 SharedRing::getCapacity() const {
+    return header ? header->capacity : 0;
+}
+
+U64 SharedRing::getOccupancy() const {
+    if (!header) {
+        return 0;
+    }
+
+    // Load the head first, the tail only grows after it.
+    const U64 h = header->head.load();
+    return header->tail.load() - h;
+}
+
+U64 SharedRing::getDropped() const {
+    return header ? header->dropped.load(std::memory_order_relaxed) : 0;
+}
+
+std::string SharedRing::getDatatype() const {
+    return header ? std::string(header->datatype, strnlen(header->datatype, sizeof(header->datatype))) : "";
+}
+
+U8* SharedRing::reserve(const U64& size) {
+    if (!header || (header->capacity - getOccupancy()) < size) {
+        return nullptr;
+    }
+
+    return storage + (header->tail.load(std::memory_order_relaxed) % header->capacity);
+}
+
+void SharedRing::commit(const U64& size) {
+    if (!header) {
+        return;
+    }
+
+    // The tail store, the sequence bump and the waiting load are sequentially
+    // consistent. Either the consumer sees the new tail before sleeping, or
+    // the producer sees it waiting and wakes it.
+    header->tail.store(header->tail.load(std::memory_order_relaxed) + size);
+    header->sequence.fetch_add(1);
+
+#ifdef JST_SHARED_RING_AVAILABLE
+    if (header->waiting.load() != 0) {
+        FutexWake(header->sequence);
+    }
+#endif
+}
+
+void SharedRing::drop(const U64& size) {
+    if (header) {
+        header->dropped.fetch_add(size, std::memory_order_relaxed);
+    }
+}
+
+const U8* SharedRing::peek(const U64& size) const {
+    if (!header || getOccupancy() < size) {
+        return nullptr;
+    }
+
+    return storage + (header->head.load(std::memory_order_relaxed) % header->capacity);
+}
+
+void SharedRing::consume(const U64& size) {
+    if (header) {
+        header->head.store(header->head.load(std::memory_order_relaxed) + size);
+    }
+}
+
+Result SharedRing::wait(const U64& size, const std::chrono::milliseconds& timeout) {
+    if (!header) {
+        return Result::TIMEOUT;
+    }
+
+#ifdef JST_SHARED_RING_AVAILABLE
+    const auto deadline = std::chrono::steady_clock::now() + timeout;
+
+    while (getOccupancy() < size && header->closed.load() == 0) {
+        const auto remaining = std::chrono::duration_cast<std::chrono::milliseconds>(deadline - std::chrono::steady_clock::now());
+        if (remaining <= 0ms) {
+            return Result::TIMEOUT;
+        }
+
+        const U32 sequence = header->sequence.load();
+        header->waiting.store(1);
+
+        // A commit after the sequence was loaded makes the wait return at once.
+        if (getOccupancy() < size && header->closed.load() == 0) {
+            FutexWait(header->sequence, sequence, remaining);
+        }
+
+        header->waiting.store(0);
+    }
+
+    return (getOccupancy() >= size) ? Result::SUCCESS : Result::TIMEOUT;
+#else
+    (void)size;
+    (void)timeout;
+    return Result::TIMEOUT;
+#endif
+}
+
+}  // namespace Jetstream::Memory
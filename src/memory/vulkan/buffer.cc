@@ -63,7 +63,7 @@ Implementation::TensorBuffer(std::shared_ptr<TensorStorageMetadata>& storage,
         bufferInfo.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
         bufferInfo.size = JST_PAGE_ALIGNED_SIZE(prototype.size_bytes);
         bufferInfo.usage = usage;
-        bufferInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+        backend->setSharingMode(bufferInfo);
         bufferInfo.pNext = (canExport) ? &extImageCreateInfo : nullptr;
 
         JST_VK_CHECK_THROW(vkCreateBuffer(device, &bufferInfo, nullptr, &_buffer), [&]{
@@ -134,6 +134,8 @@ Implementation::TensorBuffer(std::shared_ptr<TensorStorageMetadata>& storage,
             JST_ERROR("[VULKAN:BUFFER] Failed to bind memory to the buffer.");
         });
 
+        track_memory(storage, Device::Vulkan, memoryAllocateInfo.allocationSize);
+
         // Null out array.
 
         JST_CHECK_THROW(Backend::ExecuteOnce(device, queue, fence, commandBuffer, [&](VkCommandBuffer& commandBuffer){
@@ -165,14 +167,151 @@ Implementation::TensorBuffer(std::shared_ptr<TensorStorageMetadata>& storage,
 
 #ifdef JETSTREAM_BACKEND_CPU_AVAILABLE
 Implementation::TensorBuffer(std::shared_ptr<TensorStorageMetadata>&,
-                             const TensorPrototypeMetadata&,
-                             const std::shared_ptr<TensorBuffer<Device::CPU>>&) {
-    throw std::runtime_error("Exporting CPU memory to Vulkan not implemented.");
-    // TODO: Add CPU -> Vulkan.
+                             const TensorPrototypeMetadata& prototype,
+                             const std::shared_ptr<TensorBuffer<Device::CPU>>& root_buffer) {
+    JST_TRACE("[VULKAN:BUFFER] Importing CPU buffer.");
+
+    // Check if Vulkan is available.
+
+    if (!Backend::State<Device::Vulkan>()->isAvailable()) {
+        JST_TRACE("[VULKAN:BUFFER] Vulkan is not available.");
+        JST_CHECK_THROW(Result::ERROR);
+    }
+
+    // Check if root buffer can be imported.
+
+    if (!TensorBuffer<Device::Vulkan>::CanImport(*root_buffer)) {
+        JST_TRACE("[VULKAN:BUFFER] CPU buffer can't be imported.");
+        JST_CHECK_THROW(Result::ERROR);
+    }
+
+    // Check size.
+
+    if (prototype.size_bytes == 0) {
+        return;
+    }
+
+    // Get device types.
+
+    auto& device = Backend::State<Device::Vulkan>()->getDevice();
+    auto& physicalDevice = Backend::State<Device::Vulkan>()->getPhysicalDevice();
+
+    // Create buffer object.
+
+    VkExternalMemoryBufferCreateInfo extBufferCreateInfo = {};
+    extBufferCreateInfo.sType = VK_STRUCTURE_TYPE_EXTERNAL_MEMORY_BUFFER_CREATE_INFO;
+    extBufferCreateInfo.handleTypes = VK_EXTERNAL_MEMORY_HANDLE_TYPE_HOST_ALLOCATION_BIT_EXT;
+
+    VkBufferCreateInfo bufferInfo = {};
+    bufferInfo.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+    bufferInfo.size = JST_PAGE_ALIGNED_SIZE(prototype.size_bytes);
+    // TODO: Add a global way to specify usage.
+    bufferInfo.usage =  VK_BUFFER_USAGE_TRANSFER_SRC_BIT |
+                        VK_BUFFER_USAGE_TRANSFER_DST_BIT |
+                        VK_BUFFER_USAGE_VERTEX_BUFFER_BIT |
+                        VK_BUFFER_USAGE_STORAGE_BUFFER_BIT;
+    Backend::State<Device::Vulkan>()->setSharingMode(bufferInfo);
+    bufferInfo.pNext = &extBufferCreateInfo;
+
+    JST_VK_CHECK_THROW(vkCreateBuffer(device, &bufferInfo, nullptr, &_buffer), [&]{
+        JST_ERROR("[VULKAN] Can't create memory buffer.");
+    });
+
+    // Query which memory types can hold the host allocation.
+
+    auto vkGetMemoryHostPointerPropertiesEXT = reinterpret_cast<PFN_vkGetMemoryHostPointerPropertiesEXT>(
+        vkGetDeviceProcAddr(device, "vkGetMemoryHostPointerPropertiesEXT"));
+
+    VkMemoryHostPointerPropertiesEXT hostPointerProperties = {};
+    hostPointerProperties.sType = VK_STRUCTURE_TYPE_MEMORY_HOST_POINTER_PROPERTIES_EXT;
+
+    JST_VK_CHECK_THROW(vkGetMemoryHostPointerPropertiesEXT(device,
+                                                           VK_EXTERNAL_MEMORY_HANDLE_TYPE_HOST_ALLOCATION_BIT_EXT,
+                                                           root_buffer->data(),
+                                                           &hostPointerProperties), [&]{
+        vkDestroyBuffer(device, _buffer, nullptr);
+        JST_ERROR("[VULKAN:BUFFER] Failed to query host pointer properties.");
+    });
+
+    VkMemoryRequirements memoryRequirements;
+    vkGetBufferMemoryRequirements(device, _buffer, &memoryRequirements);
+
+    const VkMemoryPropertyFlags memoryProperties = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT |
+                                                   VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
+
+    // Import host allocation.
+
+    VkImportMemoryHostPointerInfoEXT importInfo = {};
+    importInfo.sType = VK_STRUCTURE_TYPE_IMPORT_MEMORY_HOST_POINTER_INFO_EXT;
+    importInfo.pNext = nullptr;
+    importInfo.handleType = VK_EXTERNAL_MEMORY_HANDLE_TYPE_HOST_ALLOCATION_BIT_EXT;
+    importInfo.pHostPointer = root_buffer->data();
+
+    VkMemoryAllocateInfo memoryAllocateInfo = {};
+    memoryAllocateInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+    memoryAllocateInfo.allocationSize = bufferInfo.size;
+    memoryAllocateInfo.memoryTypeIndex = Backend::FindMemoryType(physicalDevice,
+                                                                 memoryRequirements.memoryTypeBits &
+                                                                 hostPointerProperties.memoryTypeBits,
+                                                                 memoryProperties);
+    memoryAllocateInfo.pNext = &importInfo;
+
+    JST_VK_CHECK_THROW(vkAllocateMemory(device, &memoryAllocateInfo, nullptr, &_memory), [&]{
+        vkDestroyBuffer(device, _buffer, nullptr);
+        JST_ERROR("[VULKAN:BUFFER] Failed to import host memory.");
+    });
+
+    JST_VK_CHECK_THROW(vkBindBufferMemory(device, _buffer, _memory, 0), [&]{
+        vkFreeMemory(device, _memory, nullptr);
+        vkDestroyBuffer(device, _buffer, nullptr);
+        JST_ERROR("[VULKAN:BUFFER] Failed to bind memory to the buffer.");
+    });
+
+    // Set buffer flags.
+
+    set_host_accessible();
+    set_host_native();
+    set_external_memory_device(Device::CPU);
 }
 
-bool Implementation::CanImport(const TensorBuffer<Device::CPU>&) noexcept {
-    return false;
+bool Implementation::CanImport(const TensorBuffer<Device::CPU>& root_buffer) noexcept {
+    JST_TRACE("[VULKAN:BUFFER] Checking if CPU buffer can be imported.");
+
+    // Allow importing empty buffers.
+
+    if (!root_buffer.allocated()) {
+        return true;
+    }
+
+    // Check if Vulkan is available.
+
+    if (!Backend::State<Device::Vulkan>()->isAvailable()) {
+        JST_TRACE("[VULKAN:BUFFER] Vulkan is not available.");
+        return false;
+    }
+
+    // Check if Vulkan can import host memory.
+
+    if (!Backend::State<Device::Vulkan>()->canImportHostMemory()) {
+        JST_TRACE("[VULKAN:BUFFER] Vulkan can't import host memory.");
+        return false;
+    }
+
+    // Check if CPU buffer is owned by the CPU.
+
+    if (root_buffer.external_memory_device() != Device::None) {
+        JST_TRACE("[VULKAN:BUFFER] CPU buffer is backed by another device.");
+        return false;
+    }
+
+    // Check if CPU buffer is page aligned.
+
+    if (reinterpret_cast<uintptr_t>(root_buffer.data()) % JST_PAGESIZE() != 0) {
+        JST_TRACE("[VULKAN:BUFFER] CPU buffer is not page aligned.");
+        return false;
+    }
+
+    return true;
 }
 #endif
 
@@ -243,7 +382,7 @@ Implementation::TensorBuffer(std::shared_ptr<TensorStorageMetadata>&,
                         VK_BUFFER_USAGE_TRANSFER_DST_BIT | 
                         VK_BUFFER_USAGE_VERTEX_BUFFER_BIT |
                         VK_BUFFER_USAGE_STORAGE_BUFFER_BIT;
-    bufferInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+    Backend::State<Device::Vulkan>()->setSharingMode(bufferInfo);
     bufferInfo.pNext = &extImageCreateInfo;
 
     JST_VK_CHECK_THROW(vkCreateBuffer(device, &bufferInfo, nullptr, &_buffer), [&]{
@@ -369,7 +508,16 @@ bool Implementation::CanImport(const TensorBuffer<Device::CUDA>& root_buffer) no
 Implementation::~TensorBuffer() {
     JST_TRACE("[VULKAN:BUFFER] Releasing buffer {}.", jst::fmt::ptr(_buffer));
 
-    // Release imported CUDA memory.
+    // Release imported memory.
+
+#ifdef JETSTREAM_BACKEND_CPU_AVAILABLE
+    if (external_memory_device() == Device::CPU) {
+        auto& device = Backend::State<Device::Vulkan>()->getDevice();
+
+        vkFreeMemory(device, _memory, nullptr);
+        vkDestroyBuffer(device, _buffer, nullptr);
+    }
+#endif
 
 #ifdef JETSTREAM_BACKEND_CUDA_AVAILABLE
     if (external_memory_device() == Device::CUDA) {
@@ -0,0 +1,352 @@
+#include <thread>
+#include <atomic>
+#include <cerrno>
+#include <cstring>
+#include <sstream>
+
+#include "jetstream/metrics.hh"
+#include "jetstream/memory/footprint.hh"
+#include "jetstream/compute/thread.hh"
+
+#if !defined(JST_OS_WINDOWS) && !defined(JST_OS_BROWSER)
+#define JST_METRICS_POSIX
+#include <poll.h>
+#include <unistd.h>
+#include <sys/time.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+#endif
+
+namespace Jetstream {
+
+namespace {
+
+std::string EscapeLabel(const std::string& value) {
+    std::string escaped;
+    for (const auto& c : value) {
+        switch (c) {
+            case '\\':
+                escaped += "\\\\";
+                break;
+            case '"':
+                escaped += "\\\"";
+                break;
+            case '\n':
+                escaped += "\\n";
+                break;
+            default:
+                escaped += c;
+        }
+    }
+    return escaped;
+}
+
+// Writes a metric family header once and its samples.
+class Writer {
+ public:
+    void family(const std::string& name, const std::string& type, const std::string& help) {
+        out << "# HELP " << name << " " << help << "\n";
+        out << "# TYPE " << name << " " << type << "\n";
+    }
+
+    template<typename V>
+    void sample(const std::string& name, const std::string& labels, const V& value) {
+        out << name;
+        if (!labels.empty()) {
+            out << "{" << labels << "}";
+        }
+        out << " " << jst::fmt::format("{}", value) << "\n";
+    }
+
+    std::string str() const {
+        return out.str();
+    }
+
+ private:
+    std::ostringstream out;
+};
+
+}  // namespace
+
+struct MetricsServer::Impl {
+    Scheduler& scheduler;
+
+#ifdef JST_METRICS_POSIX
+    int fd = -1;
+#endif
+    std::thread server;
+    std::atomic<bool> serving = false;
+
+    explicit Impl(Scheduler& scheduler) : scheduler(scheduler) {}
+
+    void serveLoop(const MetricsServer& metrics);
+};
+
+MetricsServer::MetricsServer(Scheduler& scheduler) {
+    impl = std::make_unique<Impl>(scheduler);
+}
+
+MetricsServer::~MetricsServer() {
+    stop();
+}
+
+std::string MetricsServer::render() const {
+    auto& scheduler = impl->scheduler;
+    Writer w;
+
+    // Scheduler.
+
+    w.family("cyberether_compute_cycles_total", "counter", "Compute cycles run by the scheduler.");
+    w.sample("cyberether_compute_cycles_total", "", scheduler.computeCycles());
+
+    w.family("cyberether_graph_underruns_total", "counter", "Frames skipped because a graph ran out of input.");
+    w.sample("cyberether_graph_underruns_total", "", scheduler.graphUnderruns());
+
+    // Graphs.
+
+    const auto graphs = scheduler.statistics();
+
+    w.family("cyberether_graph_compute_seconds", "gauge", "Average duration of a graph compute.");
+    for (U64 i = 0; i < graphs.size(); i++) {
+        const auto labels = jst::fmt::format("graph=\"{}\",device=\"{}\",cluster=\"{}\"", i,
+                                             GetDeviceName(graphs[i].device), graphs[i].clusterId);
+        w.sample("cyberether_graph_compute_seconds", labels, graphs[i].averageComputeTime / 1e3);
+    }
+
+    w.family("cyberether_graph_migrated_bytes", "gauge", "Bytes copied between host and device by the last graph compute.");
+    for (U64 i = 0; i < graphs.size(); i++) {
+        const auto labels = jst::fmt::format("graph=\"{}\",device=\"{}\",cluster=\"{}\"", i,
+                                             GetDeviceName(graphs[i].device), graphs[i].clusterId);
+        w.sample("cyberether_graph_migrated_bytes", labels, graphs[i].migratedBytes);
+    }
+
+    // Buffers.
+
+    const auto buffers = scheduler.moduleBuffers();
+
+    const auto bufferFamily = [&](const std::string& name,
+                                  const std::string& type,
+                                  const std::string& help,
+                                  const auto& value) {
+        w.family(name, type, help);
+        for (const auto& [locale, statistics] : buffers) {
+            for (const auto& buffer : statistics) {
+                const auto labels = jst::fmt::format("module=\"{}\",buffer=\"{}\"",
+                                                     EscapeLabel(jst::fmt::format("{}", locale)),
+                                                     EscapeLabel(buffer.name));
+                w.sample(name, labels, value(buffer));
+            }
+        }
+    };
+
+    bufferFamily("cyberether_buffer_capacity_samples", "gauge", "Capacity of a module buffer.",
+                 [](const auto& b) { return b.capacity; });
+    bufferFamily("cyberether_buffer_occupancy_samples", "gauge", "Samples waiting in a module buffer.",
+                 [](const auto& b) { return b.occupancy; });
+    bufferFamily("cyberether_buffer_overflows_total", "counter", "Overflows of a module buffer.",
+                 [](const auto& b) { return b.overflows; });
+    bufferFamily("cyberether_buffer_dropped_samples_total", "counter", "Samples dropped by a module buffer.",
+                 [](const auto& b) { return b.droppedElements; });
+    bufferFamily("cyberether_buffer_throughput_samples_per_second", "gauge", "Samples read per second from a module buffer.",
+                 [](const auto& b) { return b.throughput; });
+    bufferFamily("cyberether_buffer_producer_samples_per_second", "gauge", "Samples written per second to a module buffer.",
+                 [](const auto& b) { return b.producerRate; });
+    bufferFamily("cyberether_buffer_latency_seconds", "gauge", "Time the oldest samples of the last read waited in a module buffer.",
+                 [](const auto& b) { return b.lastLatency; });
+    bufferFamily("cyberether_buffer_max_latency_seconds", "gauge", "Longest time samples waited in a module buffer.",
+                 [](const auto& b) { return b.maxLatency; });
+
+    // Occupancy as a fraction of the capacity, sampled at every write.
+    w.family("cyberether_buffer_occupancy_ratio", "histogram", "Occupancy of a module buffer after each write.");
+    for (const auto& [locale, statistics] : buffers) {
+        for (const auto& buffer : statistics) {
+            const auto labels = jst::fmt::format("module=\"{}\",buffer=\"{}\"",
+                                                 EscapeLabel(jst::fmt::format("{}", locale)),
+                                                 EscapeLabel(buffer.name));
+            const U64 buckets = buffer.occupancyHistogram.size();
+
+            U64 count = 0;
+            for (U64 i = 0; i < buckets; i++) {
+                count += buffer.occupancyHistogram[i];
+                const auto bound = static_cast<F64>(i + 1) / buckets;
+                w.sample("cyberether_buffer_occupancy_ratio_bucket", jst::fmt::format("{},le=\"{}\"", labels, bound), count);
+            }
+            w.sample("cyberether_buffer_occupancy_ratio_bucket", jst::fmt::format("{},le=\"+Inf\"", labels), count);
+            const F64 sum = (buffer.capacity > 0) ? static_cast<F64>(buffer.occupancySum) / buffer.capacity : 0.0;
+            w.sample("cyberether_buffer_occupancy_ratio_sum", labels, sum);
+            w.sample("cyberether_buffer_occupancy_ratio_count", labels, count);
+        }
+    }
+
+    // Module latency.
+
+    if (scheduler.profiling()) {
+        w.family("cyberether_module_latency_seconds", "summary", "Duration of a module compute.");
+        for (const auto& [locale, summary] : scheduler.moduleLatency()) {
+            const auto module = EscapeLabel(jst::fmt::format("{}", locale));
+            w.sample("cyberether_module_latency_seconds", jst::fmt::format("module=\"{}\",quantile=\"0.5\"", module), summary.p50 / 1e3);
+            w.sample("cyberether_module_latency_seconds", jst::fmt::format("module=\"{}\",quantile=\"0.9\"", module), summary.p90 / 1e3);
+            w.sample("cyberether_module_latency_seconds", jst::fmt::format("module=\"{}\",quantile=\"0.99\"", module), summary.p99 / 1e3);
+            w.sample("cyberether_module_latency_seconds_count", jst::fmt::format("module=\"{}\"", module), summary.count);
+        }
+    }
+
+    // Memory.
+
+    auto& footprint = MemoryFootprint::Get();
+
+    w.family("cyberether_memory_bytes", "gauge", "Memory allocated on a device.");
+    for (const auto& [device, usage] : footprint.devices()) {
+        w.sample("cyberether_memory_bytes", jst::fmt::format("device=\"{}\"", GetDeviceName(device)), usage.current);
+    }
+
+    w.family("cyberether_block_memory_bytes", "gauge", "Memory allocated by a block on a device.");
+    for (const auto& [block, devices] : footprint.blocks()) {
+        for (const auto& [device, usage] : devices) {
+            w.sample("cyberether_block_memory_bytes", jst::fmt::format("block=\"{}\",device=\"{}\"",
+                                                                       EscapeLabel(block),
+                                                                       GetDeviceName(device)), usage.current);
+        }
+    }
+
+    return w.str();
+}
+
+#ifdef JST_METRICS_POSIX
+
+Result MetricsServer::start(const Config& config) {
+    JST_CHECK(stop());
+
+    sockaddr_in address = {};
+    address.sin_family = AF_INET;
+    address.sin_port = htons(config.port);
+    if (inet_pton(AF_INET, config.address.c_str(), &address.sin_addr) != 1) {
+        JST_ERROR("[METRICS] Invalid address '{}'.", config.address);
+        return Result::ERROR;
+    }
+
+    impl->fd = socket(AF_INET, SOCK_STREAM, 0);
+    if (impl->fd < 0) {
+        JST_ERROR("[METRICS] Failed to create socket ({}).", std::strerror(errno));
+        return Result::ERROR;
+    }
+
+    const int reuse = 1;
+    setsockopt(impl->fd, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+
+    if (bind(impl->fd, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) != 0 ||
+        listen(impl->fd, 8) != 0) {
+        JST_ERROR("[METRICS] Failed to listen on '{}:{}' ({}).", config.address, config.port, std::strerror(errno));
+        close(impl->fd);
+        impl->fd = -1;
+        return Result::ERROR;
+    }
+
+    impl->serving = true;
+    impl->server = std::thread([&]{
+        ApplyThreadPolicy(ThreadRole::IO);
+        impl->serveLoop(*this);
+    });
+
+    JST_INFO("[METRICS] Serving metrics on 'http://{}:{}/metrics'.", config.address, config.port);
+
+    return Result::SUCCESS;
+}
+
+Result MetricsServer::stop() {
+    impl->serving = false;
+
+    if (impl->server.joinable()) {
+        impl->server.join();
+    }
+
+    if (impl->fd >= 0) {
+        close(impl->fd);
+        impl->fd = -1;
+    }
+
+    return Result::SUCCESS;
+}
+
+void MetricsServer::Impl::serveLoop(const MetricsServer& metrics) {
+    while (serving) {
+        pollfd descriptor = {fd, POLLIN, 0};
+        if (poll(&descriptor, 1, 100) <= 0 || !(descriptor.revents & POLLIN)) {
+            continue;
+        }
+
+        const int client = accept(fd, nullptr, nullptr);
+        if (client < 0) {
+            continue;
+        }
+
+        // A stuck scraper can't hold the server.
+        timeval timeout = {1, 0};
+        setsockopt(client, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+        setsockopt(client, SOL_SOCKET, SO_SNDTIMEO, &timeout, sizeof(timeout));
+#ifdef SO_NOSIGPIPE
+        const int noSigPipe = 1;
+        setsockopt(client, SOL_SOCKET, SO_NOSIGPIPE, &noSigPipe, sizeof(noSigPipe));
+#endif
+
+        // Only the request line matters.
+        std::string request;
+        char chunk[1024];
+        while (request.find("\r\n") == std::string::npos && request.size() < 8192) {
+            const auto received = recv(client, chunk, sizeof(chunk), 0);
+            if (received <= 0) {
+                break;
+            }
+            request.append(chunk, received);
+        }
+
+        std::string status = "200 OK";
+        std::string body;
+        if (request.starts_with("GET /metrics ") || request.starts_with("GET /metrics?")) {
+            body = metrics.render();
+        } else {
+            status = "404 Not Found";
+            body = "Not found.\n";
+        }
+
+        const auto response = jst::fmt::format("HTTP/1.1 {}\r\n"
+                                               "Content-Type: text/plain; version=0.0.4; charset=utf-8\r\n"
+                                               "Content-Length: {}\r\n"
+                                               "Connection: close\r\n"
+                                               "\r\n"
+                                               "{}", status, body.size(), body);
+
+        U64 sent = 0;
+        while (sent < response.size()) {
+#ifdef MSG_NOSIGNAL
+            const auto res = send(client, response.data() + sent, response.size() - sent, MSG_NOSIGNAL);
+#else
+            const auto res = send(client, response.data() + sent, response.size() - sent, 0);
+#endif
+            if (res <= 0) {
+                break;
+            }
+            sent += res;
+        }
+
+        close(client);
+    }
+}
+
+#else
+
+Result MetricsServer::start(const Config&) {
+    JST_ERROR("[METRICS] Metrics endpoint isn't supported on this platform.");
+    return Result::ERROR;
+}
+
+Result MetricsServer::stop() {
+    return Result::SUCCESS;
+}
+
+void MetricsServer::Impl::serveLoop(const MetricsServer&) {}
+
+#endif
+
+}  // namespace Jetstream
@@ -28,8 +28,8 @@ Result Add<D, T>::createCompute(const Context&) {
 }
 
 template<Device D, typename T>
-Result Add<D, T>::compute(const Context&) {
-    Memory::CPU::AutomaticIterator([](const auto& a, const auto& b, auto& c) {
+Result Add<D, T>::compute(const Context& ctx) {
+    Memory::CPU::ParallelAutomaticIterator(ctx.cpu->pool(), [](const auto& a, const auto& b, auto& c) {
         c = a + b;
     }, impl->a, impl->b, impl->c);
 
@@ -1,11 +1,19 @@
 #include "../generic.cc"
 
-#include "jetstream/backend/devices/cpu/helpers.hh"
+#include "jetstream/backend/devices/cpu/simd.hh"
 
 namespace Jetstream {
 
 template<Device D, typename T>
-struct AGC<D, T>::Impl {};
+struct AGC<D, T>::Impl {
+    F32 attackCoeff = 0.0f;
+    F32 decayCoeff = 0.0f;
+
+    // Carried between buffers.
+    F32 envelope = 0.0f;
+    F32 gain = 0.0f;
+    bool primed = false;
+};
 
 template<Device D, typename T>
 AGC<D, T>::AGC() {
@@ -17,21 +25,55 @@ AGC<D, T>::~AGC() {
     impl.reset();
 }
 
+template<Device D, typename T>
+Result AGC<D, T>::createCompute(const Context&) {
+    JST_TRACE("Create AGC compute core using CPU backend.");
+
+    impl->envelope = 0.0f;
+    impl->gain = 0.0f;
+    impl->primed = false;
+
+    return Result::SUCCESS;
+}
+
 template<Device D, typename T>
 Result AGC<D, T>::compute(const Context&) {
-    const F32 desiredLevel = 1.0f;
+    constexpr U64 width = std::is_same_v<T, CF32> ? 2 : 1;
 
-    // TODO: This is a dog shit implementation. Improve.
+    const F32* in = reinterpret_cast<const F32*>(input.buffer.data());
+    F32* out = reinterpret_cast<F32*>(output.buffer.data());
+    const U64 size = input.buffer.size();
 
-    F32 currentMax = 0.0f;
-    for (U64 i = 0; i < input.buffer.size(); i++) {
-        currentMax = std::max(currentMax, std::abs(input.buffer[i]));
-    }
+    const auto& peakPower = Backend::PeakPower().kernel();
+    const auto& gainRamp = Backend::GainRamp().kernel();
+
+    // Every subblock is read for its peak and scaled while it's still in cache.
+
+    for (U64 begin = 0; begin < size; begin += AgcSubblockSize) {
+        const U64 count = std::min(AgcSubblockSize, size - begin);
+        const F32* src = in + begin * width;
+        F32* dst = out + begin * width;
+
+        const F32 peak = std::sqrt(peakPower(src, count * width, width));
+
+        if (!impl->primed) {
+            impl->envelope = peak;
+        } else {
+            const F32 coeff = (peak > impl->envelope) ? impl->attackCoeff : impl->decayCoeff;
+            impl->envelope += coeff * (peak - impl->envelope);
+        }
+
+        const F32 target = (impl->envelope * config.maxGain > config.level) ? config.level / impl->envelope :
+                                                                               config.maxGain;
 
-    const F32 gain = (currentMax != 0) ? (desiredLevel / currentMax) : 1.0f;
+        if (!impl->primed) {
+            impl->gain = target;
+            impl->primed = true;
+        }
 
-    for (U64 i = 0; i < output.buffer.size(); i++) {
-        output.buffer[i] = input.buffer[i] * gain;
+        const F32 step = (target - impl->gain) / static_cast<F32>(count);
+        gainRamp(src, dst, count * width, width, impl->gain, step);
+        impl->gain = target;
     }
 
     return Result::SUCCESS;
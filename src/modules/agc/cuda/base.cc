@@ -0,0 +1,244 @@
+#include "../generic.cc"
+
+#include "jetstream/memory/devices/cuda/copy.hh"
+
+namespace Jetstream {
+
+template<Device D, typename T>
+struct AGC<D, T>::Impl {
+    F32 attackCoeff = 0.0f;
+    F32 decayCoeff = 0.0f;
+
+    std::vector<U64> grid;
+    std::vector<U64> block;
+    std::vector<U64> single;
+
+    std::vector<void*> peakArguments;
+    std::vector<void*> envelopeArguments;
+    std::vector<void*> applyArguments;
+
+    Tensor<Device::CUDA, T> input;
+
+    // Peak magnitude, start gain and gain step of every subblock.
+    Tensor<Device::CUDA, F32> peaks;
+    Tensor<Device::CUDA, F32> gains;
+    Tensor<Device::CUDA, F32> steps;
+
+    // Envelope, gain and primed flag carried between buffers.
+    Tensor<Device::CUDA, F32> state;
+
+    U64 numberOfElements = 0;
+    U64 numberOfSubblocks = 0;
+};
+
+template<Device D, typename T>
+AGC<D, T>::AGC() {
+    impl = std::make_unique<Impl>();
+}
+
+template<Device D, typename T>
+AGC<D, T>::~AGC() {
+    impl.reset();
+}
+
+template<Device D, typename T>
+Result AGC<D, T>::createCompute(const Context& ctx) {
+    JST_TRACE("Create AGC compute core using CUDA backend.");
+
+    // Create CUDA kernels.
+    //
+    // Peaks are reduced per subblock in parallel, the envelope is a short
+    // sequential pass over the subblocks, and the gain ramp is applied per
+    // sample. Only the envelope recursion runs on a single thread.
+
+    std::string header = "#define SUBBLOCK " + std::to_string(AgcSubblockSize) + "\n";
+
+    if constexpr (std::is_same_v<T, CF32>) {
+        header += R"""(
+            typedef float2 sample_t;
+
+            __device__ inline float power(const sample_t& x) {
+                return x.x * x.x + x.y * x.y;
+            }
+
+            __device__ inline sample_t scale(const sample_t& x, const float g) {
+                return make_float2(x.x * g, x.y * g);
+            }
+        )""";
+    } else {
+        header += R"""(
+            typedef float sample_t;
+
+            __device__ inline float power(const sample_t& x) {
+                return x * x;
+            }
+
+            __device__ inline sample_t scale(const sample_t& x, const float g) {
+                return x * g;
+            }
+        )""";
+    }
+
+    ctx.cuda->createKernel("agc_peak", header + R"""(
+        __global__ void agc_peak(const sample_t* input, float* peaks, size_t size) {
+            __shared__ float reduction[SUBBLOCK];
+
+            const size_t id = blockIdx.x * SUBBLOCK + threadIdx.x;
+            reduction[threadIdx.x] = (id < size) ? power(input[id]) : 0.0f;
+            __syncthreads();
+
+            for (unsigned int stride = SUBBLOCK / 2; stride > 0; stride >>= 1) {
+                if (threadIdx.x < stride) {
+                    reduction[threadIdx.x] = fmaxf(reduction[threadIdx.x], reduction[threadIdx.x + stride]);
+                }
+                __syncthreads();
+            }
+
+            if (threadIdx.x == 0) {
+                peaks[blockIdx.x] = sqrtf(reduction[0]);
+            }
+        }
+    )""");
+
+    ctx.cuda->createKernel("agc_envelope", header + R"""(
+        __global__ void agc_envelope(const float* peaks,
+                                     float* gains,
+                                     float* steps,
+                                     float* state,
+                                     float level,
+                                     float maxGain,
+                                     float attackCoeff,
+                                     float decayCoeff,
+                                     size_t subblocks,
+                                     size_t size) {
+            float envelope = state[0];
+            float gain = state[1];
+            bool primed = state[2] != 0.0f;
+
+            for (size_t b = 0; b < subblocks; b++) {
+                const float peak = peaks[b];
+
+                if (!primed) {
+                    envelope = peak;
+                } else {
+                    envelope += ((peak > envelope) ? attackCoeff : decayCoeff) * (peak - envelope);
+                }
+
+                const float target = (envelope * maxGain > level) ? level / envelope : maxGain;
+
+                if (!primed) {
+                    gain = target;
+                    primed = true;
+                }
+
+                const size_t count = min((size_t)SUBBLOCK, size - b * SUBBLOCK);
+                gains[b] = gain;
+                steps[b] = (target - gain) / (float)count;
+                gain = target;
+            }
+
+            state[0] = envelope;
+            state[1] = gain;
+            state[2] = primed ? 1.0f : 0.0f;
+        }
+    )""");
+
+    ctx.cuda->createKernel("agc_apply", header + R"""(
+        __global__ void agc_apply(const sample_t* input,
+                                  sample_t* output,
+                                  const float* gains,
+                                  const float* steps,
+                                  size_t size) {
+            const size_t id = blockIdx.x * blockDim.x + threadIdx.x;
+            if (id < size) {
+                const size_t b = id / SUBBLOCK;
+                const float g = gains[b] + (float)(id % SUBBLOCK + 1) * steps[b];
+                output[id] = scale(input[id], g);
+            }
+        }
+    )""");
+
+    // Allocate subblock buffers and state. Zero-filled by the allocator.
+
+    impl->numberOfElements = input.buffer.size();
+    impl->numberOfSubblocks = std::max<U64>((impl->numberOfElements + AgcSubblockSize - 1) / AgcSubblockSize, 1);
+
+    impl->peaks = Tensor<Device::CUDA, F32>({impl->numberOfSubblocks});
+    impl->gains = Tensor<Device::CUDA, F32>({impl->numberOfSubblocks});
+    impl->steps = Tensor<Device::CUDA, F32>({impl->numberOfSubblocks});
+    impl->state = Tensor<Device::CUDA, F32>({3});
+
+    // Initialize kernel size.
+
+    impl->grid = { impl->numberOfSubblocks, 1, 1 };
+    impl->block = { AgcSubblockSize, 1, 1 };
+    impl->single = { 1, 1, 1 };
+
+    // Initialize kernel input.
+
+    if (!input.buffer.device_native() && input.buffer.contiguous()) {
+        impl->input = Tensor<Device::CUDA, T>(input.buffer.shape());
+    } else {
+        impl->input = input.buffer;
+    }
+
+    // Initialize kernel arguments.
+
+    impl->peakArguments = {
+        impl->input.data_ptr(),
+        impl->peaks.data_ptr(),
+        &impl->numberOfElements,
+    };
+
+    impl->envelopeArguments = {
+        impl->peaks.data_ptr(),
+        impl->gains.data_ptr(),
+        impl->steps.data_ptr(),
+        impl->state.data_ptr(),
+        &config.level,
+        &config.maxGain,
+        &impl->attackCoeff,
+        &impl->decayCoeff,
+        &impl->numberOfSubblocks,
+        &impl->numberOfElements,
+    };
+
+    impl->applyArguments = {
+        impl->input.data_ptr(),
+        output.buffer.data_ptr(),
+        impl->gains.data_ptr(),
+        impl->steps.data_ptr(),
+        &impl->numberOfElements,
+    };
+
+    return Result::SUCCESS;
+}
+
+template<Device D, typename T>
+Result AGC<D, T>::compute(const Context& ctx) {
+    if (!input.buffer.device_native() && input.buffer.contiguous()) {
+        JST_CHECK(Memory::Copy(impl->input, input.buffer, ctx.cuda->stream()));
+    }
+
+    JST_CHECK(ctx.cuda->launchKernel("agc_peak",
+                                     impl->grid,
+                                     impl->block,
+                                     impl->peakArguments.data()));
+
+    JST_CHECK(ctx.cuda->launchKernel("agc_envelope",
+                                     impl->single,
+                                     impl->single,
+                                     impl->envelopeArguments.data()));
+
+    JST_CHECK(ctx.cuda->launchKernel("agc_apply",
+                                     impl->grid,
+                                     impl->block,
+                                     impl->applyArguments.data()));
+
+    return Result::SUCCESS;
+}
+
+JST_AGC_CUDA(JST_INSTANTIATION)
+JST_AGC_CUDA(JST_BENCHMARK)
+
+}  // namespace Jetstream
@@ -4,11 +4,39 @@
 
 namespace Jetstream {
 
+// Samples sharing one envelope update. The gain ramps linearly between updates.
+inline constexpr U64 AgcSubblockSize = 256;
+
 template<Device D, typename T>
 Result AGC<D, T>::create() {
     JST_DEBUG("Initializing AGC module.");
     JST_INIT_IO();
 
+    // Check parameters.
+
+    if (config.level <= 0.0f) {
+        JST_ERROR("Invalid AGC level: {}. Level should be positive.", config.level);
+        return Result::ERROR;
+    }
+
+    if (config.attack <= 0.0f || config.attack > 1.0f ||
+        config.decay <= 0.0f || config.decay > 1.0f) {
+        JST_ERROR("Invalid AGC attack ({}) or decay ({}). They should be in (0, 1].",
+                  config.attack, config.decay);
+        return Result::ERROR;
+    }
+
+    if (config.maxGain <= 0.0f) {
+        JST_ERROR("Invalid AGC maximum gain: {}. Maximum gain should be positive.", config.maxGain);
+        return Result::ERROR;
+    }
+
+    // Calculate parameters.
+
+    const F64 subblock = static_cast<F64>(AgcSubblockSize);
+    impl->attackCoeff = static_cast<F32>(1.0 - std::pow(1.0 - config.attack, subblock));
+    impl->decayCoeff = static_cast<F32>(1.0 - std::pow(1.0 - config.decay, subblock));
+
     // Allocate output.
 
     output.buffer = Tensor<D, T>(input.buffer.shape());
@@ -18,7 +46,10 @@ Result AGC<D, T>::create() {
 
 template<Device D, typename T>
 void AGC<D, T>::info() const {
-    JST_DEBUG("  None");
+    JST_DEBUG("  Level:    {}", config.level);
+    JST_DEBUG("  Attack:   {}", config.attack);
+    JST_DEBUG("  Decay:    {}", config.decay);
+    JST_DEBUG("  Max Gain: {}", config.maxGain);
 }
 
 }  // namespace Jetstream
@@ -0,0 +1,235 @@
+#include "../generic.cc"
+
+namespace Jetstream {
+
+// Peaks are reduced per subblock in parallel, the envelope is a short
+// sequential pass over the subblocks, and the gain ramp is applied per
+// sample. Only the envelope recursion runs on a single thread.
+
+static const char shadersSrc[] = R"""(
+    struct Constants {
+        ulong subblocks;
+        ulong size;
+        float level;
+        float maxGain;
+        float attackCoeff;
+        float decayCoeff;
+    };
+
+    kernel void agc_peak(constant Constants& constants [[ buffer(0) ]],
+                         constant const sample_t *input [[ buffer(1) ]],
+                         device float *peaks [[ buffer(2) ]],
+                         uint group [[ threadgroup_position_in_grid ]],
+                         uint lane [[ thread_position_in_threadgroup ]]) {
+        threadgroup float reduction[SUBBLOCK];
+
+        const ulong id = (ulong)group * SUBBLOCK + lane;
+        reduction[lane] = (id < constants.size) ? power(input[id]) : 0.0f;
+        threadgroup_barrier(mem_flags::mem_threadgroup);
+
+        for (uint stride = SUBBLOCK / 2; stride > 0; stride >>= 1) {
+            if (lane < stride) {
+                reduction[lane] = max(reduction[lane], reduction[lane + stride]);
+            }
+            threadgroup_barrier(mem_flags::mem_threadgroup);
+        }
+
+        if (lane == 0) {
+            peaks[group] = sqrt(reduction[0]);
+        }
+    }
+
+    kernel void agc_envelope(constant Constants& constants [[ buffer(0) ]],
+                             device const float *peaks [[ buffer(1) ]],
+                             device float *gains [[ buffer(2) ]],
+                             device float *steps [[ buffer(3) ]],
+                             device float *state [[ buffer(4) ]],
+                             uint id [[ thread_position_in_grid ]]) {
+        float envelope = state[0];
+        float gain = state[1];
+        bool primed = state[2] != 0.0f;
+
+        for (ulong b = 0; b < constants.subblocks; b++) {
+            const float peak = peaks[b];
+
+            if (!primed) {
+                envelope = peak;
+            } else {
+                envelope += ((peak > envelope) ? constants.attackCoeff : constants.decayCoeff) * (peak - envelope);
+            }
+
+            const float target = (envelope * constants.maxGain > constants.level) ? constants.level / envelope :
+                                                                                    constants.maxGain;
+
+            if (!primed) {
+                gain = target;
+                primed = true;
+            }
+
+            const ulong count = min((ulong)SUBBLOCK, constants.size - b * SUBBLOCK);
+            gains[b] = gain;
+            steps[b] = (target - gain) / (float)count;
+            gain = target;
+        }
+
+        state[0] = envelope;
+        state[1] = gain;
+        state[2] = primed ? 1.0f : 0.0f;
+    }
+
+    kernel void agc_apply(constant Constants& constants [[ buffer(0) ]],
+                          constant const sample_t *input [[ buffer(1) ]],
+                          device sample_t *output [[ buffer(2) ]],
+                          device const float *gains [[ buffer(3) ]],
+                          device const float *steps [[ buffer(4) ]],
+                          uint id [[ thread_position_in_grid ]]) {
+        if (id < constants.size) {
+            const ulong b = id / SUBBLOCK;
+            const float g = gains[b] + (float)(id % SUBBLOCK + 1) * steps[b];
+            output[id] = input[id] * g;
+        }
+    }
+)""";
+
+template<Device D, typename T>
+struct AGC<D, T>::Impl {
+    F32 attackCoeff = 0.0f;
+    F32 decayCoeff = 0.0f;
+
+    struct Constants {
+        U64 subblocks;
+        U64 size;
+        F32 level;
+        F32 maxGain;
+        F32 attackCoeff;
+        F32 decayCoeff;
+    };
+
+    MTL::ComputePipelineState* peakState;
+    MTL::ComputePipelineState* envelopeState;
+    MTL::ComputePipelineState* applyState;
+    Tensor<Device::Metal, U8> constants;
+
+    // Peak magnitude, start gain and gain step of every subblock.
+    Tensor<Device::Metal, F32> peaks;
+    Tensor<Device::Metal, F32> gains;
+    Tensor<Device::Metal, F32> steps;
+
+    // Envelope, gain and primed flag carried between buffers.
+    Tensor<Device::Metal, F32> state;
+
+    U64 numberOfSubblocks = 0;
+};
+
+template<Device D, typename T>
+AGC<D, T>::AGC() {
+    impl = std::make_unique<Impl>();
+}
+
+template<Device D, typename T>
+AGC<D, T>::~AGC() {
+    impl.reset();
+}
+
+template<Device D, typename T>
+Result AGC<D, T>::createCompute(const Context&) {
+    JST_TRACE("Create AGC compute core using Metal backend.");
+
+    // Compile shaders.
+
+    std::string header = "#include <metal_stdlib>\nusing namespace metal;\n";
+    header += "#define SUBBLOCK " + std::to_string(AgcSubblockSize) + "\n";
+
+    if constexpr (std::is_same_v<T, CF32>) {
+        header += R"""(
+            typedef float2 sample_t;
+
+            inline float power(const sample_t x) {
+                return x.x * x.x + x.y * x.y;
+            }
+        )""";
+    } else {
+        header += R"""(
+            typedef float sample_t;
+
+            inline float power(const sample_t x) {
+                return x * x;
+            }
+        )""";
+    }
+
+    const std::string source = header + shadersSrc;
+    JST_CHECK(Metal::CompileKernel(source.c_str(), "agc_peak", &impl->peakState));
+    JST_CHECK(Metal::CompileKernel(source.c_str(), "agc_envelope", &impl->envelopeState));
+    JST_CHECK(Metal::CompileKernel(source.c_str(), "agc_apply", &impl->applyState));
+
+    // Allocate subblock buffers and state. Zero-filled by the allocator.
+
+    const U64 size = input.buffer.size();
+    impl->numberOfSubblocks = std::max<U64>((size + AgcSubblockSize - 1) / AgcSubblockSize, 1);
+
+    impl->peaks = Tensor<Device::Metal, F32>({impl->numberOfSubblocks});
+    impl->gains = Tensor<Device::Metal, F32>({impl->numberOfSubblocks});
+    impl->steps = Tensor<Device::Metal, F32>({impl->numberOfSubblocks});
+    impl->state = Tensor<Device::Metal, F32>({3});
+
+    // Create constants buffer.
+
+    auto* constants = Metal::CreateConstants<typename Impl::Constants>(*impl);
+    constants->subblocks = impl->numberOfSubblocks;
+    constants->size = size;
+    constants->attackCoeff = impl->attackCoeff;
+    constants->decayCoeff = impl->decayCoeff;
+
+    return Result::SUCCESS;
+}
+
+template<Device D, typename T>
+Result AGC<D, T>::compute(const Context& ctx) {
+    auto* constants = Metal::Constants<typename Impl::Constants>(*impl);
+    constants->level = config.level;
+    constants->maxGain = config.maxGain;
+
+    {
+        auto cmdEncoder = ctx.metal->commandBuffer()->computeCommandEncoder();
+        cmdEncoder->setComputePipelineState(impl->peakState);
+        cmdEncoder->setBuffer(impl->constants.data(), 0, 0);
+        cmdEncoder->setBuffer(input.buffer.data(), 0, 1);
+        cmdEncoder->setBuffer(impl->peaks.data(), 0, 2);
+        cmdEncoder->dispatchThreadgroups(MTL::Size(impl->numberOfSubblocks, 1, 1),
+                                         MTL::Size(AgcSubblockSize, 1, 1));
+        cmdEncoder->endEncoding();
+    }
+
+    {
+        auto cmdEncoder = ctx.metal->commandBuffer()->computeCommandEncoder();
+        cmdEncoder->setComputePipelineState(impl->envelopeState);
+        cmdEncoder->setBuffer(impl->constants.data(), 0, 0);
+        cmdEncoder->setBuffer(impl->peaks.data(), 0, 1);
+        cmdEncoder->setBuffer(impl->gains.data(), 0, 2);
+        cmdEncoder->setBuffer(impl->steps.data(), 0, 3);
+        cmdEncoder->setBuffer(impl->state.data(), 0, 4);
+        cmdEncoder->dispatchThreads(MTL::Size(1, 1, 1), MTL::Size(1, 1, 1));
+        cmdEncoder->endEncoding();
+    }
+
+    {
+        auto cmdEncoder = ctx.metal->commandBuffer()->computeCommandEncoder();
+        cmdEncoder->setComputePipelineState(impl->applyState);
+        cmdEncoder->setBuffer(impl->constants.data(), 0, 0);
+        cmdEncoder->setBuffer(input.buffer.data(), 0, 1);
+        cmdEncoder->setBuffer(output.buffer.data(), 0, 2);
+        cmdEncoder->setBuffer(impl->gains.data(), 0, 3);
+        cmdEncoder->setBuffer(impl->steps.data(), 0, 4);
+        cmdEncoder->dispatchThreads(MTL::Size(input.buffer.size(), 1, 1),
+                                    MTL::Size(impl->applyState->maxTotalThreadsPerThreadgroup(), 1, 1));
+        cmdEncoder->endEncoding();
+    }
+
+    return Result::SUCCESS;
+}
+
+JST_AGC_METAL(JST_INSTANTIATION)
+JST_AGC_METAL(JST_BENCHMARK)
+
+}  // namespace Jetstream
@@ -1,12 +1,66 @@
 #include "jetstream/modules/amplitude.hh"
+#include "jetstream/backend/devices/cpu/simd.hh"
+#include "jetstream/backend/devices/cpu/dispatch.hh"
 
 namespace Jetstream {
 
+// Runs every CPU kernel supported by the host on the same buffers.
+template<typename IT, typename Kernel>
+void benchmarkKernels(ankerl::nanobench::Bench& bench,
+                      const std::string& name,
+                      const std::vector<std::pair<Backend::SimdLevel, Kernel>>& kernels) {
+    const U64 size = 128 * 8000;
+    std::vector<IT> input(size, IT(1.0f));
+    std::vector<F32> output(size);
+
+    for (const auto& [level, kernel] : kernels) {
+        if (!Backend::HostSupportsSimdLevel(level)) {
+            continue;
+        }
+        bench.run(name + "128x8000 (" + Backend::GetSimdLevelName(level) + ")", [&] {
+            kernel(input.data(), output.data(), size, 0.0f);
+            ankerl::nanobench::doNotOptimizeAway(output.data());
+        });
+    }
+}
+
 template<template<Device, typename...> class Module, Device D, typename IT, typename OT>
 void benchmark(ankerl::nanobench::Bench& bench, std::string name) {
     JST_BENCHMARK_RUN("128x8000", {}, {
         .buffer = Tensor<D COMMA IT>({128 COMMA 8000}) COMMA
     }, IT, OT);
+
+    if constexpr (D == Device::CPU && std::is_same<IT, CF32>::value) {
+        benchmarkKernels<CF32, Backend::ComplexDecibelsKernel>(bench, name, {
+            {Backend::SimdLevel::Scalar, Backend::ComplexDecibelsScalar},
+#ifdef JST_SIMD_X86
+            {Backend::SimdLevel::AVX2, Backend::ComplexDecibelsAVX2},
+            {Backend::SimdLevel::AVX512, Backend::ComplexDecibelsAVX512},
+#endif
+#ifdef JST_SIMD_NEON
+            {Backend::SimdLevel::NEON, Backend::ComplexDecibelsNEON},
+#endif
+#ifdef JST_SIMD_WASM
+            {Backend::SimdLevel::WASM, Backend::ComplexDecibelsWASM},
+#endif
+        });
+    }
+
+    if constexpr (D == Device::CPU && std::is_same<IT, F32>::value) {
+        benchmarkKernels<F32, Backend::RealDecibelsKernel>(bench, name, {
+            {Backend::SimdLevel::Scalar, Backend::RealDecibelsScalar},
+#ifdef JST_SIMD_X86
+            {Backend::SimdLevel::AVX2, Backend::RealDecibelsAVX2},
+            {Backend::SimdLevel::AVX512, Backend::RealDecibelsAVX512},
+#endif
+#ifdef JST_SIMD_NEON
+            {Backend::SimdLevel::NEON, Backend::RealDecibelsNEON},
+#endif
+#ifdef JST_SIMD_WASM
+            {Backend::SimdLevel::WASM, Backend::RealDecibelsWASM},
+#endif
+        });
+    }
 }
 
-}  // namespace Jetstream
\ No newline at end of file
+}  // namespace Jetstream
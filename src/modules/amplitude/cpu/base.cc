@@ -1,6 +1,8 @@
 #include "../generic.cc"
 
 #include "jetstream/backend/devices/cpu/helpers.hh"
+#include "jetstream/backend/devices/cpu/simd.hh"
+#include "jetstream/memory/devices/cpu/helpers.hh"
 
 namespace Jetstream {
 
@@ -8,11 +10,19 @@ template<Device D, typename IT, typename OT>
 struct Amplitude<D, IT, OT>::Impl {
     F32 scalingCoeff = 0.0f;
     U64 numberOfElements = 0;
+
+    Backend::ComplexDecibelsKernel complexKernel;
+    Backend::RealDecibelsKernel realKernel;
+    const char* kernelName;
 };
 
 template<Device D, typename IT, typename OT>
 Amplitude<D, IT, OT>::Amplitude() {
     pimpl = std::make_unique<Impl>();
+
+    pimpl->complexKernel = Backend::ComplexDecibels().kernel();
+    pimpl->realKernel = Backend::RealDecibels().kernel();
+    pimpl->kernelName = (std::is_same<IT, CF32>::value) ? Backend::ComplexDecibels().name() : Backend::RealDecibels().name();
 }
 
 template<Device D, typename IT, typename OT>
@@ -20,6 +30,19 @@ Amplitude<D, IT, OT>::~Amplitude() {
     pimpl.reset();
 }
 
+// 20 * log10(|x|) is computed as 10 * log10(|x|^2) to skip the square root.
+
+static inline F32 AmplitudeOf(const CF32& number, const F32& scalingCoeff) {
+    const auto& real = number.real();
+    const auto& imag = number.imag();
+
+    return Backend::ApproxPowerToDecibels((real * real) + (imag * imag), scalingCoeff);
+}
+
+static inline F32 AmplitudeOf(const F32& number, const F32& scalingCoeff) {
+    return Backend::ApproxPowerToDecibels(number * number, scalingCoeff);
+}
+
 template<Device D, typename IT, typename OT>
 Result Amplitude<D, IT, OT>::createCompute(const Context&) {
     JST_TRACE("Create Amplitude compute core using CPU backend.");
@@ -27,27 +50,74 @@ Result Amplitude<D, IT, OT>::createCompute(const Context&) {
 }
 
 template<>
-Result Amplitude<Device::CPU, CF32, F32>::compute(const Context&) {
-    for (U64 i = 0; i < input.buffer.size(); i++) {
-        const auto& number = input.buffer[i];
-        const auto& real = number.real();
-        const auto& imag = number.imag();
+Result Amplitude<Device::CPU, CF32, F32>::computeSlice(const Context&, const U64& offset, const U64& size) {
+    pimpl->complexKernel(input.buffer.data() + offset, output.buffer.data() + offset, size, pimpl->scalingCoeff);
+    return Result::SUCCESS;
+}
 
-        const auto& pwr = sqrtf((real * real) + (imag * imag));
+template<>
+Result Amplitude<Device::CPU, F32, F32>::computeSlice(const Context&, const U64& offset, const U64& size) {
+    pimpl->realKernel(input.buffer.data() + offset, output.buffer.data() + offset, size, pimpl->scalingCoeff);
+    return Result::SUCCESS;
+}
 
-        output.buffer[i] = 20.0f * Backend::ApproxLog10(pwr) + pimpl->scalingCoeff;
-    }
+static inline F32 PowerOf(const CF32& number) {
+    return (number.real() * number.real()) + (number.imag() * number.imag());
+}
 
-    return Result::SUCCESS;
+static inline F32 PowerOf(const F32& number) {
+    return number * number;
 }
 
-template<>
-Result Amplitude<Device::CPU, F32, F32>::compute(const Context&) {
-    for (U64 i = 0; i < input.buffer.size(); i++) {
-        const auto& pwr = fabs(input.buffer[i]);
-        output.buffer[i] = 20.0f * Backend::ApproxLog10(pwr) + pimpl->scalingCoeff;
+template<Device D, typename IT, typename OT>
+Result Amplitude<D, IT, OT>::compute(const Context& ctx) {
+    if (config.averages > 1) {
+        // Power of every group is summed in a row-sized accumulator, then
+        // converted to decibels once.
+
+        const U64 averages = config.averages;
+        const U64 rowSize = output.buffer.size() / output.buffer.shape()[0];
+        const U64 rows = output.buffer.shape()[0];
+        const F32 scalingCoeff = pimpl->scalingCoeff;
+
+        const IT* in = input.buffer.data() + input.buffer.offset();
+        OT* out = output.buffer.data();
+
+        const U64 chunks = input.buffer.size() / Memory::CPU::ParallelIteratorGrain;
+
+        Memory::CPU::ParallelRanges(ctx.cpu->pool(), rows, chunks, [&](const U64& begin, const U64& end) {
+            std::vector<F32> power(rowSize);
+
+            for (U64 r = begin; r < end; r++) {
+                const IT* group = in + r * averages * rowSize;
+                std::fill(power.begin(), power.end(), 0.0f);
+
+                for (U64 a = 0; a < averages; a++) {
+                    for (U64 j = 0; j < rowSize; j++) {
+                        power[j] += PowerOf(group[a * rowSize + j]);
+                    }
+                }
+
+                for (U64 j = 0; j < rowSize; j++) {
+                    out[r * rowSize + j] = Backend::ApproxPowerToDecibels(power[j], scalingCoeff);
+                }
+            }
+        });
+
+        return Result::SUCCESS;
     }
 
+    if (input.buffer.contiguous()) {
+        return computeSlice(ctx, 0, input.buffer.size());
+    }
+
+    // Views are read through their strides instead of being copied first.
+
+    const F32 scalingCoeff = pimpl->scalingCoeff;
+    Memory::CPU::AutomaticIterator([&](const auto& in, auto& out) {
+        out = AmplitudeOf(in, scalingCoeff);
+    }, input.buffer, output.buffer);
+
     return Result::SUCCESS;
 }
 
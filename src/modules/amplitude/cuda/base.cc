@@ -15,6 +15,7 @@ struct Amplitude<D, IT, OT>::Impl {
 
     F32 scalingCoeff = 0.0f;
     U64 numberOfElements = 0;
+    U64 rowSize = 0;
 };
 
 template<Device D, typename IT, typename OT>
@@ -31,40 +32,93 @@ template<Device D, typename IT, typename OT>
 Result Amplitude<D, IT, OT>::createCompute(const Context& ctx) {
     JST_TRACE("Create Amplitude compute core using CUDA backend.");
 
+    // Initialize kernel size.
+
+    U64 threadsPerBlock = 512;
+    U64 blocksPerGrid = (pimpl->numberOfElements + threadsPerBlock - 1) / threadsPerBlock;
+
+    pimpl->grid = { blocksPerGrid, 1, 1 };
+    pimpl->block = { threadsPerBlock, 1, 1 };
+
+    pimpl->rowSize = output.buffer.size() / output.buffer.shape()[0];
+
+    // Shapes are fixed once created, so the kernels are specialized for them.
+    // The bounds check folds away when the size is a multiple of the block.
+
+    const std::vector<CUDA::KernelConstant> constants = {
+        CUDA::Constant("SIZE", pimpl->numberOfElements),
+        CUDA::Constant("ROW_SIZE", pimpl->rowSize),
+        CUDA::Constant("AVERAGES", config.averages),
+        CUDA::Constant("BLOCK_SIZE", threadsPerBlock),
+    };
+
     // Create CUDA kernel.
 
     if constexpr (std::is_same_v<IT, CF32> && std::is_same_v<OT, F32>) {
-        ctx.cuda->createKernel("amplitude", R"""(
-            __global__ void amplitude(const float2* input, float* output, float scalingCoeff, size_t size) {
+        JST_CHECK(ctx.cuda->createKernel("amplitude", R"""(
+            __global__ void amplitude(const float2* input, float* output, float scalingCoeff) {
                 size_t id = blockIdx.x * blockDim.x + threadIdx.x;
-                if (id < size) {
-                    float2 number = input[id];
-                    float real = number.x;
-                    float imag = number.y;
-                    float pwr = fmaxf(sqrtf((real * real) + (imag * imag)), 1e-20f);
-                    output[id] = 20.0f * log10f(pwr) + scalingCoeff;
+                if ((SIZE % BLOCK_SIZE) != 0 && id >= SIZE) {
+                    return;
                 }
+                float2 number = input[id];
+                float real = number.x;
+                float imag = number.y;
+                float pwr = fmaxf(sqrtf((real * real) + (imag * imag)), 1e-20f);
+                output[id] = 20.0f * log10f(pwr) + scalingCoeff;
             }
-        )""");
+        )""", {}, constants));
     } else if constexpr (std::is_same_v<IT, F32> && std::is_same_v<OT, F32>) {
-        ctx.cuda->createKernel("amplitude", R"""(
-            __global__ void amplitude(const float* input, float* output, float scalingCoeff, size_t size) {
+        JST_CHECK(ctx.cuda->createKernel("amplitude", R"""(
+            __global__ void amplitude(const float* input, float* output, float scalingCoeff) {
                 size_t id = blockIdx.x * blockDim.x + threadIdx.x;
-                if (id < size) {
-                    float pwr = fmaxf(fabs(input[id]), 1e-20f);
-                    output[id] = 20.0f * log10f(pwr) + scalingCoeff;
+                if ((SIZE % BLOCK_SIZE) != 0 && id >= SIZE) {
+                    return;
                 }
+                float pwr = fmaxf(fabs(input[id]), 1e-20f);
+                output[id] = 20.0f * log10f(pwr) + scalingCoeff;
             }
-        )""");
+        )""", {}, constants));
     }
 
-    // Initialize kernel size.
-
-    U64 threadsPerBlock = 512;
-    U64 blocksPerGrid = (pimpl->numberOfElements + threadsPerBlock - 1) / threadsPerBlock;
+    // Averaging kernels sum the power of a group of rows, one thread per
+    // averaged output.
 
-    pimpl->grid = { blocksPerGrid, 1, 1 };
-    pimpl->block = { threadsPerBlock, 1, 1 };
+    if constexpr (std::is_same_v<IT, CF32> && std::is_same_v<OT, F32>) {
+        JST_CHECK(ctx.cuda->createKernel("amplitude_average", R"""(
+            __global__ void amplitude_average(const float2* input, float* output, float scalingCoeff) {
+                size_t id = blockIdx.x * blockDim.x + threadIdx.x;
+                if ((SIZE % BLOCK_SIZE) != 0 && id >= SIZE) {
+                    return;
+                }
+                const float2* group = input + (id / ROW_SIZE) * AVERAGES * ROW_SIZE + (id % ROW_SIZE);
+                float power = 0.0f;
+                #pragma unroll
+                for (size_t a = 0; a < AVERAGES; a++) {
+                    float2 number = group[a * ROW_SIZE];
+                    power += (number.x * number.x) + (number.y * number.y);
+                }
+                output[id] = 10.0f * log10f(fmaxf(power, 1e-40f)) + scalingCoeff;
+            }
+        )""", {}, constants));
+    } else if constexpr (std::is_same_v<IT, F32> && std::is_same_v<OT, F32>) {
+        JST_CHECK(ctx.cuda->createKernel("amplitude_average", R"""(
+            __global__ void amplitude_average(const float* input, float* output, float scalingCoeff) {
+                size_t id = blockIdx.x * blockDim.x + threadIdx.x;
+                if ((SIZE % BLOCK_SIZE) != 0 && id >= SIZE) {
+                    return;
+                }
+                const float* group = input + (id / ROW_SIZE) * AVERAGES * ROW_SIZE + (id % ROW_SIZE);
+                float power = 0.0f;
+                #pragma unroll
+                for (size_t a = 0; a < AVERAGES; a++) {
+                    float number = group[a * ROW_SIZE];
+                    power += number * number;
+                }
+                output[id] = 10.0f * log10f(fmaxf(power, 1e-40f)) + scalingCoeff;
+            }
+        )""", {}, constants));
+    }
 
     // Initialize kernel input.
 
@@ -80,7 +134,6 @@ Result Amplitude<D, IT, OT>::createCompute(const Context& ctx) {
         pimpl->input.data_ptr(),
         output.buffer.data_ptr(),
         &pimpl->scalingCoeff,
-        &pimpl->numberOfElements,
     };
 
     return Result::SUCCESS;
@@ -92,7 +145,9 @@ Result Amplitude<D, IT, OT>::compute(const Context& ctx) {
         JST_CHECK(Memory::Copy(pimpl->input, input.buffer, ctx.cuda->stream()));
     }
 
-    JST_CHECK(ctx.cuda->launchKernel("amplitude",
+    const char* kernel = (config.averages > 1) ? "amplitude_average" : "amplitude";
+
+    JST_CHECK(ctx.cuda->launchKernel(kernel,
                                      pimpl->grid,
                                      pimpl->block,
                                      pimpl->arguments.data()));
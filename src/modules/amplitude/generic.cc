@@ -9,22 +9,88 @@ Result Amplitude<D, IT, OT>::create() {
     JST_DEBUG("Initializing Amplitude module.");
     JST_INIT_IO();
 
+    // Check parameters.
+
+    if (config.averages == 0) {
+        JST_ERROR("Number of averages should be positive.");
+        return Result::ERROR;
+    }
+
+    if (config.averages > 1) {
+        if constexpr (D != Device::CPU && D != Device::CUDA) {
+            JST_ERROR("Amplitude can't average on the {} backend.", D);
+            return Result::ERROR;
+        }
+
+        if (!input.buffer.contiguous()) {
+            JST_ERROR("Amplitude can only average contiguous inputs.");
+            return Result::ERROR;
+        }
+
+        if ((input.buffer.shape()[0] % config.averages) != 0) {
+            JST_ERROR("First axis size ({}) should be a multiple of the number of averages ({}).",
+                      input.buffer.shape()[0], config.averages);
+            return Result::ERROR;
+        }
+    }
+
     // Calculate parameters.
+    //
+    // Averaging happens in linear power over groups of consecutive entries of
+    // the first axis, so the logarithm is taken once per averaged output. The
+    // division by the number of averages is folded into the offset.
 
     const U64 last_axis = input.buffer.rank() - 1;
-    pimpl->scalingCoeff = 20.0f * log10f(1.0f / input.buffer.shape()[last_axis]);
-    pimpl->numberOfElements = input.buffer.size();
+    pimpl->scalingCoeff = 20.0f * log10f(1.0f / input.buffer.shape()[last_axis]) -
+                          10.0f * log10f(static_cast<F32>(config.averages));
+
+    auto outputShape = input.buffer.shape();
+    outputShape[0] /= config.averages;
 
     // Allocate output.
 
-    output.buffer = Tensor<D, OT>(input.buffer.shape());
+    if (config.inPlace) {
+        if constexpr (D != Device::CPU) {
+            JST_ERROR("Amplitude can't run in-place on the {} backend.", D);
+            return Result::ERROR;
+        }
+
+        if constexpr (!std::is_same_v<IT, OT>) {
+            JST_ERROR("Amplitude can only run in-place when the input and output types match.");
+            return Result::ERROR;
+        } else {
+            if (config.averages > 1) {
+                JST_ERROR("Amplitude can't average in-place.");
+                return Result::ERROR;
+            }
+
+            JST_CHECK(Module::InitInPlaceOutput(output.buffer, input.buffer));
+        }
+    } else if constexpr (D == Device::CPU) {
+        // Skip zero-filling CPU memory fully written by the first compute.
+        output.buffer = Tensor<D, OT>(outputShape, false);
+    } else {
+        output.buffer = Tensor<D, OT>(outputShape);
+    }
+
+    pimpl->numberOfElements = output.buffer.size();
 
     return Result::SUCCESS;
 }
 
 template<Device D, typename IT, typename OT>
 void Amplitude<D, IT, OT>::info() const {
-    JST_DEBUG("  None");
+    JST_DEBUG("  Averages: {}", config.averages);
+    JST_DEBUG("  In-Place: {}", config.inPlace);
+    if constexpr (D == Device::CPU) {
+        JST_DEBUG("  Kernel:   {}", pimpl->kernelName);
+    }
+}
+
+template<Device D, typename IT, typename OT>
+Result Amplitude<D, IT, OT>::computeSlice(const Context&, const U64&, const U64&) {
+    JST_ERROR("Amplitude can't compute slices on the {} backend.", D);
+    return Result::ERROR;
 }
 
 }  // namespace Jetstream
@@ -0,0 +1,63 @@
+#include "../generic.cc"
+
+#include "resources/shaders/amplitude_shaders.hh"
+
+namespace Jetstream {
+
+template<Device D, typename IT, typename OT>
+struct Amplitude<D, IT, OT>::Impl {
+    struct Constants {
+        F32 scalingCoeff;
+        U32 numberOfElements;
+    };
+
+    Constants constants;
+    std::vector<U64> grid;
+
+    F32 scalingCoeff = 0.0f;
+    U64 numberOfElements = 0;
+};
+
+template<Device D, typename IT, typename OT>
+Amplitude<D, IT, OT>::Amplitude() {
+    pimpl = std::make_unique<Impl>();
+}
+
+template<Device D, typename IT, typename OT>
+Amplitude<D, IT, OT>::~Amplitude() {
+    pimpl.reset();
+}
+
+template<Device D, typename IT, typename OT>
+Result Amplitude<D, IT, OT>::createCompute(const Context& ctx) {
+    JST_TRACE("Create Amplitude compute core using Vulkan backend.");
+
+    pimpl->constants.scalingCoeff = pimpl->scalingCoeff;
+    pimpl->constants.numberOfElements = pimpl->numberOfElements;
+    pimpl->grid = { (pimpl->numberOfElements + 255) / 256, 1, 1 };
+
+    const auto& kernel = (std::is_same_v<IT, CF32>) ? KernelsPackage["complex"][Device::Vulkan][0] :
+                                                      KernelsPackage["real"][Device::Vulkan][0];
+
+    JST_CHECK(ctx.vulkan->createKernel("amplitude",
+                                       kernel,
+                                       {
+                                           input.buffer.data(),
+                                           output.buffer.data(),
+                                       },
+                                       sizeof(typename Impl::Constants)));
+
+    return Result::SUCCESS;
+}
+
+template<Device D, typename IT, typename OT>
+Result Amplitude<D, IT, OT>::compute(const Context& ctx) {
+    JST_CHECK(ctx.vulkan->dispatchKernel("amplitude", pimpl->grid, &pimpl->constants));
+
+    return Result::SUCCESS;
+}
+
+JST_AMPLITUDE_VULKAN(JST_INSTANTIATION)
+JST_AMPLITUDE_VULKAN(JST_BENCHMARK)
+
+}  // namespace Jetstream
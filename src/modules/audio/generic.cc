@@ -1,5 +1,8 @@
 #include "jetstream/memory/utils/circular_buffer.hh"
 #include "jetstream/modules/audio.hh"
+#include "jetstream/compute/thread.hh"
+
+#include <atomic>
 
 #include "miniaudio.h"
 
@@ -24,8 +27,20 @@ struct Audio<D, T>::Impl {
     ma_resampler_config resamplerConfig;
     ma_resampler resamplerCtx;
 
+    // Handoff to the callback. Lock-free, the graph is the only producer and
+    // the callback the only consumer. Resampling stays on the graph side, the
+    // callback only copies samples out.
     Memory::CircularBuffer<F32> buffer;
 
+    // Underruns only count once playback started, the device asks for
+    // samples before the first compute.
+    std::atomic<bool> primed = false;
+    std::atomic<U64> underruns = 0;
+    std::atomic<U64> underrunSamples = 0;
+
+    // Samples queued inside the device after the callback.
+    F64 deviceLatency = 0.0;
+
     static void callback(ma_device* pDevice, void* pOutput, const void* pInput, ma_uint32 frameCount);
     static std::vector<std::pair<ma_device_id, std::string>> GetAvailableDevice();
     static void GenerateUniqueName(std::string& name, const ma_device_id& id);
@@ -202,6 +217,13 @@ Result Audio<D, T>::create() {
 
     pimpl->deviceName = pimpl->deviceCtx.playback.name;
 
+    const auto& playback = pimpl->deviceCtx.playback;
+    if (playback.internalSampleRate > 0) {
+        pimpl->deviceLatency = static_cast<F64>(playback.internalPeriodSizeInFrames) *
+                               static_cast<F64>(playback.internalPeriods) /
+                               static_cast<F64>(playback.internalSampleRate);
+    }
+
     if (ma_device_start(&pimpl->deviceCtx) != MA_SUCCESS) {
         JST_ERROR("Failed to start playback device.");
         ma_device_uninit(&pimpl->deviceCtx);
@@ -215,7 +237,10 @@ Result Audio<D, T>::create() {
 
     // Initialize circular buffer.
 
-    pimpl->buffer.resize(input.buffer.shape()[1]*20);
+    pimpl->buffer.resize(input.buffer.size() * 20, Memory::CircularBuffer<F32>::Mode::LockFree);
+    pimpl->primed = false;
+    pimpl->underruns = 0;
+    pimpl->underrunSamples = 0;
 
     return Result::SUCCESS;
 }
@@ -241,8 +266,36 @@ template<Device D, typename T>
 void Audio<D, T>::Impl::callback(ma_device* pDevice, void* pOutput, const void*, ma_uint32 frameCount) {
     auto* audio = reinterpret_cast<Audio<D, T>::Impl*>(pDevice->pUserData);
 
-    if (frameCount < audio->buffer.getOccupancy()) {
-        audio->buffer.get(reinterpret_cast<F32*>(pOutput), frameCount);
+    // The thread is owned by the audio backend. Apply the policy on its first callback.
+    static thread_local bool policyApplied = false;
+    if (!policyApplied) {
+        ApplyThreadPolicy(ThreadRole::Audio);
+        policyApplied = true;
+    }
+
+    // Play whatever is buffered in one batch and pad the rest with silence.
+    // Nothing here waits or takes a lock.
+    auto* samples = reinterpret_cast<F32*>(pOutput);
+    const U64 available = std::min<U64>(frameCount, audio->buffer.getOccupancy());
+
+    if (available > 0) {
+        // Non-mirrored buffers can't peek across the wraparound.
+        if (const F32* buffered = audio->buffer.peek(available)) {
+            std::copy_n(buffered, available, samples);
+            audio->buffer.consume(available);
+        } else {
+            audio->buffer.get(samples, available);
+        }
+        audio->primed = true;
+    }
+
+    if (available < frameCount) {
+        std::fill_n(samples + available, frameCount - available, 0.0f);
+
+        if (audio->primed) {
+            audio->underruns += 1;
+            audio->underrunSamples += frameCount - available;
+        }
     }
 }
 
@@ -254,10 +307,18 @@ Result Audio<D, T>::createCompute(const Context&) {
 
 template<Device D, typename T>
 Result Audio<D, T>::compute(const Context&) {
+    // Rates matched upstream, e.g. by the Resampler module, skip the
+    // resampler and pass the samples through.
+
+    if (config.inSampleRate == config.outSampleRate) {
+        std::copy_n(input.buffer.data(), input.buffer.size(), output.buffer.data());
+        pimpl->buffer.put(output.buffer.data(), output.buffer.size());
+        return Result::SUCCESS;
+    }
+
     ma_uint64 frameCountIn  = input.buffer.size();
     ma_uint64 frameCountOut = output.buffer.size();
 
-    // TODO: Create standalone resampler module.
     ma_result result = ma_resampler_process_pcm_frames(&pimpl->resamplerCtx, input.buffer.data(), &frameCountIn, output.buffer.data(), &frameCountOut);
     if (result != MA_SUCCESS) {
         JST_ERROR("Failed to resample signal.");
@@ -271,11 +332,45 @@ Result Audio<D, T>::compute(const Context&) {
     return Result::SUCCESS;
 }
 
+template<Device D, typename T>
+bool Audio<D, T>::computeUrgent() const {
+    // Less than two compute calls worth of samples left for the device.
+    return pimpl->buffer.getOccupancy() < 2 * output.buffer.size();
+}
+
+template<Device D, typename T>
+std::vector<Compute::BufferStatistics> Audio<D, T>::computeBuffers() const {
+    return {BufferStatistics::From("playback", pimpl->buffer)};
+}
+
 template<Device D, typename T>
 const std::string& Audio<D, T>::getDeviceName() const {
     return pimpl->deviceName;
 }
 
+template<Device D, typename T>
+U64 Audio<D, T>::getUnderruns() const {
+    return pimpl->underruns;
+}
+
+template<Device D, typename T>
+U64 Audio<D, T>::getUnderrunSamples() const {
+    return pimpl->underrunSamples;
+}
+
+template<Device D, typename T>
+U64 Audio<D, T>::getOverflows() const {
+    return pimpl->buffer.getOverflows();
+}
+
+template<Device D, typename T>
+F64 Audio<D, T>::getLatency() const {
+    // From the end of a compute to the speaker: the queued samples play out
+    // before the new ones, after the buffering of the device itself.
+    const F64 queued = static_cast<F64>(pimpl->buffer.getOccupancy()) / config.outSampleRate;
+    return queued + pimpl->deviceLatency;
+}
+
 JST_AUDIO_CPU(JST_INSTANTIATION)
 
 }  // namespace Jetstream
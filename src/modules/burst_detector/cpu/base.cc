@@ -0,0 +1,97 @@
+#include "../generic.cc"
+
+namespace Jetstream {
+
+template<Device D, typename T>
+struct BurstDetector<D, T>::Impl {
+    U64 frameSize = 0;
+    U64 delay = 0;
+    U64 span = 0;
+
+    // Last delay + 1 frames, indexed by frame number modulo their count.
+    std::vector<T> ring;
+
+    U64 frame = 0;
+    U64 lastTrigger = 0;
+    bool triggered = false;
+    bool gate = false;
+    U64 bursts = 0;
+};
+
+template<Device D, typename T>
+BurstDetector<D, T>::BurstDetector() {
+    impl = std::make_unique<Impl>();
+}
+
+template<Device D, typename T>
+BurstDetector<D, T>::~BurstDetector() {
+    impl.reset();
+}
+
+template<Device D, typename T>
+Result BurstDetector<D, T>::createCompute(const Context&) {
+    JST_TRACE("Create Burst Detector compute core using CPU backend.");
+
+    impl->ring.assign((impl->delay + 1) * impl->frameSize, T{});
+    impl->frame = 0;
+    impl->lastTrigger = 0;
+    impl->triggered = false;
+    impl->gate = false;
+    impl->bursts = 0;
+
+    return Result::SUCCESS;
+}
+
+template<Device D, typename T>
+Result BurstDetector<D, T>::compute(const Context&) {
+    const U64 frameSize = impl->frameSize;
+    const U64 slots = impl->delay + 1;
+    const U64 frame = impl->frame;
+
+    // Store the newest frame.
+
+    std::copy_n(input.buffer.data() + input.buffer.offset(), frameSize,
+                impl->ring.data() + (frame % slots) * frameSize);
+
+    // Trigger on the loudest level of the newest frame.
+
+    const F32* level = input.level.data() + input.level.offset();
+    const F32 peak = *std::max_element(level, level + input.level.size());
+
+    if (peak >= config.threshold) {
+        if (!impl->triggered || (frame - impl->lastTrigger) > impl->span) {
+            impl->bursts += 1;
+        }
+        impl->lastTrigger = frame;
+        impl->triggered = true;
+    }
+
+    // The output frame is delay frames old. It's kept if a trigger happened
+    // up to postTrigger frames before it or preTrigger frames after it, that
+    // is within span frames of the newest one.
+
+    const bool warm = frame >= impl->delay;
+    impl->gate = warm && impl->triggered && (frame - impl->lastTrigger) <= impl->span;
+
+    std::copy_n(impl->ring.data() + ((frame + 1) % slots) * frameSize, frameSize, output.buffer.data());
+    output.buffer.attribute("gate").set(impl->gate);
+
+    impl->frame += 1;
+
+    return Result::SUCCESS;
+}
+
+template<Device D, typename T>
+bool BurstDetector<D, T>::gate() const {
+    return impl->gate;
+}
+
+template<Device D, typename T>
+U64 BurstDetector<D, T>::bursts() const {
+    return impl->bursts;
+}
+
+JST_BURST_DETECTOR_CPU(JST_INSTANTIATION)
+JST_BURST_DETECTOR_CPU(JST_BENCHMARK)
+
+}  // namespace Jetstream
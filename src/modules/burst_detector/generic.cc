@@ -0,0 +1,40 @@
+#include "jetstream/modules/burst_detector.hh"
+
+#include "benchmark.cc"
+
+namespace Jetstream {
+
+template<Device D, typename T>
+Result BurstDetector<D, T>::create() {
+    JST_DEBUG("Initializing Burst Detector module.");
+    JST_INIT_IO();
+
+    // Calculate parameters.
+    //
+    // Every compute is one frame. The output is the input delayed by the
+    // pre-trigger frames, so a trigger can open the gate over frames that
+    // came before it.
+
+    impl->frameSize = input.buffer.size();
+    impl->delay = config.preTrigger;
+    impl->span = config.preTrigger + config.postTrigger;
+
+    // Allocate output.
+    //
+    // The gate travels with the output as an attribute. Consumers like the
+    // File Writer skip frames while it's closed.
+
+    output.buffer = Tensor<D, T>(input.buffer.shape());
+    output.buffer.attribute("gate").set(false);
+
+    return Result::SUCCESS;
+}
+
+template<Device D, typename T>
+void BurstDetector<D, T>::info() const {
+    JST_DEBUG("  Threshold:    {:.1f} dB", config.threshold);
+    JST_DEBUG("  Pre-Trigger:  {} frames", config.preTrigger);
+    JST_DEBUG("  Post-Trigger: {} frames", config.postTrigger);
+}
+
+}  // namespace Jetstream
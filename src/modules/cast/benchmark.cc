@@ -4,11 +4,20 @@ namespace Jetstream {
 
 template<template<Device, typename...> class Module, Device D, typename IT, typename OT>
 void benchmark(ankerl::nanobench::Bench& bench, std::string name) {
-    JST_BENCHMARK_RUN("128x8000", {
-        .scaler = 32768.0f
-    }, {
-        .buffer = Tensor<D COMMA IT>({128 COMMA 8000}) COMMA
-    }, IT, OT);
+    // Packed inputs hold three bytes per sample.
+    if constexpr (CastIsPacked<IT, OT>) {
+        JST_BENCHMARK_RUN("128x8000", {
+            .scaler = 2048.0f
+        }, {
+            .buffer = Tensor<D COMMA IT>({128 COMMA 24000}) COMMA
+        }, IT, OT);
+    } else {
+        JST_BENCHMARK_RUN("128x8000", {
+            .scaler = 32768.0f
+        }, {
+            .buffer = Tensor<D COMMA IT>({128 COMMA 8000}) COMMA
+        }, IT, OT);
+    }
 }
 
 }  // namespace Jetstream
\ No newline at end of file
@@ -1,11 +1,15 @@
 #include "../generic.cc"
 
 #include "jetstream/backend/devices/cpu/helpers.hh"
+#include "jetstream/memory/devices/cpu/helpers.hh"
+#include "jetstream/backend/devices/cpu/simd.hh"
 
 namespace Jetstream {
 
 template<Device D, typename IT, typename OT>
-struct Cast<D, IT, OT>::Impl {};
+struct Cast<D, IT, OT>::Impl {
+    F32 scale = 1.0f;
+};
 
 template<Device D, typename IT, typename OT>
 Cast<D, IT, OT>::Cast() {
@@ -17,38 +21,117 @@ Cast<D, IT, OT>::~Cast() {
     impl.reset();
 }
 
+template<typename IT, typename OT>
+static inline OT CastOf(const IT& in, const F32& scale) {
+    // CF32 to F32: Take real part and discard imaginary.
+
+    if constexpr (std::is_same<IT, CF32>::value && std::is_same<OT, F32>::value) {
+        return in.real();
+    }
+
+    // CF32 to CI16: Scale, round and saturate.
+
+    if constexpr (CastIsQuantized<IT, OT>) {
+        CI16 out;
+        Backend::QuantizeI16Scalar(reinterpret_cast<const F32*>(&in), reinterpret_cast<I16*>(&out), 2, scale);
+        return out;
+    }
+
+    // CU8 to CF32: Center offset binary samples before scaling.
+
+    if constexpr (std::is_same<IT, CU8>::value && std::is_same<OT, CF32>::value) {
+        return CF32((static_cast<F32>(in.real()) - Backend::UnsignedByteMidpoint) * scale,
+                    (static_cast<F32>(in.imag()) - Backend::UnsignedByteMidpoint) * scale);
+    }
+
+    // CI8 and CI16 to CF32: Convert integer complex to float complex.
+
+    if constexpr ((std::is_same<IT, CI8>::value || std::is_same<IT, CI16>::value) && std::is_same<OT, CF32>::value) {
+        return CF32(static_cast<F32>(in.real()) * scale, static_cast<F32>(in.imag()) * scale);
+    }
+}
+
 template<Device D, typename IT, typename OT>
 Result Cast<D, IT, OT>::createCompute(const Context&) {
     JST_TRACE("Create Cast compute core using CPU backend.");
+
+    // Samples are multiplied by the reciprocal instead of divided.
+    if constexpr (CastIsQuantized<IT, OT>) {
+        impl->scale = config.scaler;
+    } else {
+        impl->scale = (std::is_same<IT, CF32>::value) ? 1.0f : 1.0f / config.scaler;
+    }
+
     return Result::SUCCESS;
 }
 
 template<Device D, typename IT, typename OT>
-Result Cast<D, IT, OT>::compute(const Context&) {
-    for (U64 i = 0; i < input.buffer.size(); i++) {
-        // CF32 to F32: Take real part and discard imaginary.
-
-        if constexpr (std::is_same<IT, CF32>::value && std::is_same<OT, F32>::value) {
-            output.buffer[i] = input.buffer[i].real();
-        }
-
-        // CI8 to CF32: Convert integer complex to float complex.
-
-        if constexpr (std::is_same<IT, CI8>::value && std::is_same<OT, CF32>::value) {
-
-            F32 realPart = static_cast<F32>(input.buffer[i].real());
-            F32 imagPart = static_cast<F32>(input.buffer[i].imag());
-            if (config.scaler != 0.0f) {
-                realPart /= config.scaler;
-                imagPart /= config.scaler;
-            }
-            output.buffer[i] = CF32(realPart, imagPart);
-        }
+Result Cast<D, IT, OT>::compute(const Context& ctx) {
+    if (input.buffer.contiguous()) {
+        return computeSlice(ctx, 0, input.buffer.size());
+    }
+
+    // Views are read through their strides instead of being copied first.
+
+    if constexpr (!CastIsPacked<IT, OT>) {
+        const F32 scale = impl->scale;
+        Memory::CPU::AutomaticIterator([&](const auto& in, auto& out) {
+            out = CastOf<IT, OT>(in, scale);
+        }, input.buffer, output.buffer);
     }
 
     return Result::SUCCESS;
 }
 
+// Complex integers are converted as interleaved scalars.
+
+template<>
+Result Cast<Device::CPU, CF32, F32>::computeSlice(const Context&, const U64& offset, const U64& size) {
+    Backend::RealPart().kernel()(input.buffer.data() + offset, output.buffer.data() + offset, size);
+    return Result::SUCCESS;
+}
+
+template<>
+Result Cast<Device::CPU, CF32, CI16>::computeSlice(const Context&, const U64& offset, const U64& size) {
+    Backend::QuantizeI16().kernel()(reinterpret_cast<const F32*>(input.buffer.data() + offset),
+                                    reinterpret_cast<I16*>(output.buffer.data() + offset),
+                                    2 * size, impl->scale);
+    return Result::SUCCESS;
+}
+
+template<>
+Result Cast<Device::CPU, CI8, CF32>::computeSlice(const Context&, const U64& offset, const U64& size) {
+    Backend::ConvertI8().kernel()(reinterpret_cast<const I8*>(input.buffer.data() + offset),
+                                  reinterpret_cast<F32*>(output.buffer.data() + offset),
+                                  2 * size, impl->scale);
+    return Result::SUCCESS;
+}
+
+template<>
+Result Cast<Device::CPU, CI16, CF32>::computeSlice(const Context&, const U64& offset, const U64& size) {
+    Backend::ConvertI16().kernel()(reinterpret_cast<const I16*>(input.buffer.data() + offset),
+                                   reinterpret_cast<F32*>(output.buffer.data() + offset),
+                                   2 * size, impl->scale);
+    return Result::SUCCESS;
+}
+
+template<>
+Result Cast<Device::CPU, CU8, CF32>::computeSlice(const Context&, const U64& offset, const U64& size) {
+    Backend::ConvertU8().kernel()(reinterpret_cast<const U8*>(input.buffer.data() + offset),
+                                  reinterpret_cast<F32*>(output.buffer.data() + offset),
+                                  2 * size, impl->scale);
+    return Result::SUCCESS;
+}
+
+// Offsets and sizes count input bytes, three per output sample.
+template<>
+Result Cast<Device::CPU, U8, CF32>::computeSlice(const Context&, const U64& offset, const U64& size) {
+    Backend::ConvertI12().kernel()(input.buffer.data() + offset,
+                                   reinterpret_cast<F32*>(output.buffer.data() + offset / 3),
+                                   size / 3, impl->scale);
+    return Result::SUCCESS;
+}
+
 JST_CAST_CPU(JST_INSTANTIATION)
 JST_CAST_CPU(JST_BENCHMARK)
 
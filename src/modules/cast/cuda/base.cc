@@ -0,0 +1,171 @@
+#include "../generic.cc"
+
+#include "jetstream/memory/devices/cuda/copy.hh"
+
+namespace Jetstream {
+
+template<Device D, typename IT, typename OT>
+struct Cast<D, IT, OT>::Impl {
+    std::vector<U64> grid;
+    std::vector<U64> block;
+
+    std::vector<void*> arguments;
+
+    Tensor<Device::CUDA, IT> input;
+
+    F32 scale = 1.0f;
+    U64 numberOfElements = 0;
+};
+
+template<Device D, typename IT, typename OT>
+Cast<D, IT, OT>::Cast() {
+    impl = std::make_unique<Impl>();
+}
+
+template<Device D, typename IT, typename OT>
+Cast<D, IT, OT>::~Cast() {
+    impl.reset();
+}
+
+template<Device D, typename IT, typename OT>
+Result Cast<D, IT, OT>::createCompute(const Context& ctx) {
+    JST_TRACE("Create Cast compute core using CUDA backend.");
+
+    // Create CUDA kernel.
+    //
+    // Every thread converts one output sample. Samples are multiplied by the
+    // reciprocal of the scaler instead of divided.
+
+    std::string header;
+
+    if constexpr (CastIsQuantized<IT, OT>) {
+        header = R"""(
+            typedef float2 input_t;
+            typedef short2 output_t;
+
+            __device__ inline short quantize(float x, float scale) {
+                return (short)__float2int_rn(fminf(fmaxf(x * scale, -32768.0f), 32767.0f));
+            }
+
+            __device__ inline output_t convert(const input_t* input, size_t id, float scale) {
+                const input_t x = input[id];
+                return make_short2(quantize(x.x, scale), quantize(x.y, scale));
+            }
+        )""";
+    } else if constexpr (std::is_same_v<IT, CF32>) {
+        header = R"""(
+            typedef float2 input_t;
+            typedef float output_t;
+
+            __device__ inline output_t convert(const input_t* input, size_t id, float) {
+                return input[id].x;
+            }
+        )""";
+    } else if constexpr (std::is_same_v<IT, CI8>) {
+        header = R"""(
+            typedef char2 input_t;
+            typedef float2 output_t;
+
+            __device__ inline output_t convert(const input_t* input, size_t id, float scale) {
+                const input_t x = input[id];
+                return make_float2((float)x.x * scale, (float)x.y * scale);
+            }
+        )""";
+    } else if constexpr (std::is_same_v<IT, CI16>) {
+        header = R"""(
+            typedef short2 input_t;
+            typedef float2 output_t;
+
+            __device__ inline output_t convert(const input_t* input, size_t id, float scale) {
+                const input_t x = input[id];
+                return make_float2((float)x.x * scale, (float)x.y * scale);
+            }
+        )""";
+    } else if constexpr (std::is_same_v<IT, CU8>) {
+        header = R"""(
+            typedef uchar2 input_t;
+            typedef float2 output_t;
+
+            __device__ inline output_t convert(const input_t* input, size_t id, float scale) {
+                const input_t x = input[id];
+                return make_float2(((float)x.x - 127.5f) * scale, ((float)x.y - 127.5f) * scale);
+            }
+        )""";
+    } else if constexpr (CastIsPacked<IT, OT>) {
+        header = R"""(
+            typedef unsigned char input_t;
+            typedef float2 output_t;
+
+            __device__ inline output_t convert(const input_t* input, size_t id, float scale) {
+                const unsigned int word = (unsigned int)input[3 * id] |
+                                          ((unsigned int)input[3 * id + 1] << 8) |
+                                          ((unsigned int)input[3 * id + 2] << 16);
+                const int real = (int)(word << 20) >> 20;
+                const int imag = (int)(word << 8) >> 20;
+                return make_float2((float)real * scale, (float)imag * scale);
+            }
+        )""";
+    }
+
+    ctx.cuda->createKernel("cast", header + R"""(
+        __global__ void cast(const input_t* input, output_t* output, float scale, size_t size) {
+            const size_t id = blockIdx.x * blockDim.x + threadIdx.x;
+            if (id < size) {
+                output[id] = convert(input, id, scale);
+            }
+        }
+    )""");
+
+    // Initialize kernel size.
+
+    if constexpr (CastIsQuantized<IT, OT>) {
+        impl->scale = config.scaler;
+    } else {
+        impl->scale = (std::is_same_v<IT, CF32>) ? 1.0f : 1.0f / config.scaler;
+    }
+    impl->numberOfElements = output.buffer.size();
+
+    U64 threadsPerBlock = 512;
+    U64 blocksPerGrid = (impl->numberOfElements + threadsPerBlock - 1) / threadsPerBlock;
+
+    impl->grid = { blocksPerGrid, 1, 1 };
+    impl->block = { threadsPerBlock, 1, 1 };
+
+    // Initialize kernel input.
+
+    if (!input.buffer.device_native() && input.buffer.contiguous()) {
+        impl->input = Tensor<Device::CUDA, IT>(input.buffer.shape());
+    } else {
+        impl->input = input.buffer;
+    }
+
+    // Initialize kernel arguments.
+
+    impl->arguments = {
+        impl->input.data_ptr(),
+        output.buffer.data_ptr(),
+        &impl->scale,
+        &impl->numberOfElements,
+    };
+
+    return Result::SUCCESS;
+}
+
+template<Device D, typename IT, typename OT>
+Result Cast<D, IT, OT>::compute(const Context& ctx) {
+    if (!input.buffer.device_native() && input.buffer.contiguous()) {
+        JST_CHECK(Memory::Copy(impl->input, input.buffer, ctx.cuda->stream()));
+    }
+
+    JST_CHECK(ctx.cuda->launchKernel("cast",
+                                     impl->grid,
+                                     impl->block,
+                                     impl->arguments.data()));
+
+    return Result::SUCCESS;
+}
+
+JST_CAST_CUDA(JST_INSTANTIATION)
+JST_CAST_CUDA(JST_BENCHMARK)
+
+}  // namespace Jetstream
@@ -14,6 +14,14 @@ Result Cast<D, IT, OT>::create() {
     if (config.scaler == 0.0f) {
         if constexpr (std::is_same<IT, CI8>::value && std::is_same<OT, CF32>::value) {
             config.scaler = 128.0f;
+        } else if constexpr (std::is_same<IT, CI16>::value && std::is_same<OT, CF32>::value) {
+            config.scaler = 32768.0f;
+        } else if constexpr (std::is_same<IT, CU8>::value && std::is_same<OT, CF32>::value) {
+            config.scaler = 128.0f;
+        } else if constexpr (CastIsPacked<IT, OT>) {
+            config.scaler = 2048.0f;
+        } else if constexpr (CastIsQuantized<IT, OT>) {
+            config.scaler = 32768.0f;
         } else if constexpr (std::is_same<IT, CF32>::value && std::is_same<OT, F32>::value) {
             config.scaler = 1.0f;
         } else {
@@ -22,9 +30,26 @@ Result Cast<D, IT, OT>::create() {
         }
     }
 
+    // Packed samples take three bytes each.
+
+    auto shape = input.buffer.shape();
+
+    if constexpr (CastIsPacked<IT, OT>) {
+        if (shape.empty() || (shape.back() % 3) != 0) {
+            JST_ERROR("[CAST] Packed 12-bit samples need a last dimension multiple of three ({}).", shape);
+            return Result::ERROR;
+        }
+        shape.back() /= 3;
+    }
+
     // Allocate output.
 
-    output.buffer = Tensor<D, OT>(input.buffer.shape());
+    // Skip zero-filling CPU memory fully written by the first compute.
+    if constexpr (D == Device::CPU) {
+        output.buffer = Tensor<D, OT>(shape, false);
+    } else {
+        output.buffer = Tensor<D, OT>(shape);
+    }
 
     return Result::SUCCESS;
 }
@@ -32,7 +57,17 @@ Result Cast<D, IT, OT>::create() {
 template<Device D, typename IT, typename OT>
 void Cast<D, IT, OT>::info() const {
     JST_DEBUG("  Scaler:         {}", config.scaler);
-    JST_DEBUG("  Cast Operation: {} -> {}", NumericTypeInfo<IT>::name, NumericTypeInfo<OT>::name);
+    if constexpr (CastIsPacked<IT, OT>) {
+        JST_DEBUG("  Cast Operation: CI12 (packed) -> {}", NumericTypeInfo<OT>::name);
+    } else {
+        JST_DEBUG("  Cast Operation: {} -> {}", NumericTypeInfo<IT>::name, NumericTypeInfo<OT>::name);
+    }
+}
+
+template<Device D, typename IT, typename OT>
+Result Cast<D, IT, OT>::computeSlice(const Context&, const U64&, const U64&) {
+    JST_ERROR("Cast can't compute slices on the {} backend.", D);
+    return Result::ERROR;
 }
 
 }  // namespace Jetstream
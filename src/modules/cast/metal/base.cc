@@ -0,0 +1,146 @@
+#include "../generic.cc"
+
+namespace Jetstream {
+
+// Every thread converts one output sample. Samples are multiplied by the
+// reciprocal of the scaler instead of divided.
+
+static const char shadersSrc[] = R"""(
+    struct Constants {
+        ulong size;
+        float scale;
+    };
+
+    kernel void cast(constant Constants& constants [[ buffer(0) ]],
+                     constant const input_t *input [[ buffer(1) ]],
+                     device output_t *output [[ buffer(2) ]],
+                     uint id[[ thread_position_in_grid ]]) {
+        if (id < constants.size) {
+            output[id] = convert(input, id, constants.scale);
+        }
+    }
+)""";
+
+template<Device D, typename IT, typename OT>
+struct Cast<D, IT, OT>::Impl {
+    struct Constants {
+        U64 size;
+        F32 scale;
+    };
+
+    MTL::ComputePipelineState* state;
+    Tensor<Device::Metal, U8> constants;
+};
+
+template<Device D, typename IT, typename OT>
+Cast<D, IT, OT>::Cast() {
+    impl = std::make_unique<Impl>();
+}
+
+template<Device D, typename IT, typename OT>
+Cast<D, IT, OT>::~Cast() {
+    impl.reset();
+}
+
+template<Device D, typename IT, typename OT>
+Result Cast<D, IT, OT>::createCompute(const Context&) {
+    JST_TRACE("Create Cast compute core using Metal backend.");
+
+    // Compile shaders.
+
+    std::string header = "#include <metal_stdlib>\nusing namespace metal;\n";
+
+    if constexpr (CastIsQuantized<IT, OT>) {
+        header += R"""(
+            typedef float2 input_t;
+            typedef short2 output_t;
+
+            inline output_t convert(constant const input_t* input, ulong id, float scale) {
+                return short2(rint(clamp(input[id] * scale, -32768.0f, 32767.0f)));
+            }
+        )""";
+    } else if constexpr (std::is_same_v<IT, CF32>) {
+        header += R"""(
+            typedef float2 input_t;
+            typedef float output_t;
+
+            inline output_t convert(constant const input_t* input, ulong id, float) {
+                return input[id].x;
+            }
+        )""";
+    } else if constexpr (std::is_same_v<IT, CI8>) {
+        header += R"""(
+            typedef char2 input_t;
+            typedef float2 output_t;
+
+            inline output_t convert(constant const input_t* input, ulong id, float scale) {
+                return float2(input[id]) * scale;
+            }
+        )""";
+    } else if constexpr (std::is_same_v<IT, CI16>) {
+        header += R"""(
+            typedef short2 input_t;
+            typedef float2 output_t;
+
+            inline output_t convert(constant const input_t* input, ulong id, float scale) {
+                return float2(input[id]) * scale;
+            }
+        )""";
+    } else if constexpr (std::is_same_v<IT, CU8>) {
+        header += R"""(
+            typedef uchar2 input_t;
+            typedef float2 output_t;
+
+            inline output_t convert(constant const input_t* input, ulong id, float scale) {
+                return (float2(input[id]) - 127.5f) * scale;
+            }
+        )""";
+    } else if constexpr (CastIsPacked<IT, OT>) {
+        header += R"""(
+            typedef uchar input_t;
+            typedef float2 output_t;
+
+            inline output_t convert(constant const input_t* input, ulong id, float scale) {
+                const uint word = (uint)input[3 * id] |
+                                  ((uint)input[3 * id + 1] << 8) |
+                                  ((uint)input[3 * id + 2] << 16);
+                const int real = (int)(word << 20) >> 20;
+                const int imag = (int)(word << 8) >> 20;
+                return float2((float)real, (float)imag) * scale;
+            }
+        )""";
+    }
+
+    JST_CHECK(Metal::CompileKernel((header + shadersSrc).c_str(), "cast", &impl->state));
+
+    // Create constants buffer.
+
+    auto* constants = Metal::CreateConstants<typename Impl::Constants>(*impl);
+    constants->size = output.buffer.size();
+    if constexpr (CastIsQuantized<IT, OT>) {
+        constants->scale = config.scaler;
+    } else {
+        constants->scale = (std::is_same_v<IT, CF32>) ? 1.0f : 1.0f / config.scaler;
+    }
+
+    return Result::SUCCESS;
+}
+
+template<Device D, typename IT, typename OT>
+Result Cast<D, IT, OT>::compute(const Context& ctx) {
+    auto cmdEncoder = ctx.metal->commandBuffer()->computeCommandEncoder();
+    cmdEncoder->setComputePipelineState(impl->state);
+    cmdEncoder->setBuffer(impl->constants.data(), 0, 0);
+    cmdEncoder->setBuffer(input.buffer.data(), 0, 1);
+    cmdEncoder->setBuffer(output.buffer.data(), 0, 2);
+    cmdEncoder->dispatchThreads(MTL::Size(output.buffer.size(), 1, 1),
+                                MTL::Size(impl->state->maxTotalThreadsPerThreadgroup(), 1, 1));
+    cmdEncoder->endEncoding();
+
+    return Result::SUCCESS;
+}
+
+JST_CAST_METAL(JST_INSTANTIATION)
+JST_CAST_METAL(JST_BENCHMARK)
+
+}  // namespace Jetstream
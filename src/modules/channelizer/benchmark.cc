@@ -0,0 +1,19 @@
+#include "jetstream/modules/channelizer.hh"
+
+namespace Jetstream {
+
+template<template<Device, typename...> class Module, Device D, typename T>
+void benchmark(ankerl::nanobench::Bench& bench, std::string name) {
+    JST_BENCHMARK_RUN("65536 (8 channels)", {}, {
+        .buffer = Tensor<D COMMA T>({65536}) COMMA
+    }, T);
+
+    JST_BENCHMARK_RUN("65536 (64 channels, 2x)", {
+        .channels = 64 COMMA
+        .oversampling = 2 COMMA
+    }, {
+        .buffer = Tensor<D COMMA T>({65536}) COMMA
+    }, T);
+}
+
+}  // namespace Jetstream
@@ -0,0 +1,133 @@
+#include "../generic.cc"
+
+#include "jetstream/memory/devices/cpu/helpers.hh"
+#include "jetstream/backend/devices/cpu/simd.hh"
+
+// Same configuration as the FFT module, batches go to the CPU graph pool.
+#define POCKETFFT_NO_MULTITHREADING
+#include "../../fft/cpu/pocketfft.hh"
+
+namespace Jetstream {
+
+template<Device D, typename T>
+struct Channelizer<D, T>::Impl {
+    U64 decimation = 0;
+    U64 inputSize = 0;
+    U64 outputSize = 0;
+
+    std::vector<F32> taps;
+
+    // Prototype taps reversed and duplicated for both parts of a sample.
+    std::vector<F32> weights;
+
+    // Last taps - 1 samples followed by the current buffer, oldest first.
+    std::vector<CF32> samples;
+
+    // Absolute position of the buffer start modulo the number of channels.
+    // Keeps the channel phases continuous when buffers aren't a multiple of it.
+    U64 phase = 0;
+
+    std::shared_ptr<pocketfft::detail::pocketfft_c<F32>> plan;
+};
+
+template<Device D, typename T>
+Channelizer<D, T>::Channelizer() {
+    impl = std::make_unique<Impl>();
+}
+
+template<Device D, typename T>
+Channelizer<D, T>::~Channelizer() {
+    impl.reset();
+}
+
+template<Device D, typename T>
+Result Channelizer<D, T>::createCompute(const Context&) {
+    JST_TRACE("Create Channelizer compute core using CPU backend.");
+
+    const U64 numberOfTaps = impl->taps.size();
+
+    impl->weights.resize(2 * numberOfTaps);
+    for (U64 j = 0; j < numberOfTaps; j++) {
+        impl->weights[2 * j + 0] = impl->taps[numberOfTaps - 1 - j];
+        impl->weights[2 * j + 1] = impl->taps[numberOfTaps - 1 - j];
+    }
+
+    impl->samples.assign(numberOfTaps - 1 + impl->inputSize, CF32(0.0f, 0.0f));
+    impl->plan = pocketfft::detail::get_plan<pocketfft::detail::pocketfft_c<F32>>(config.channels);
+
+    JST_TRACE("[CHANNELIZER] Taps: {}; Kernel: {};", numberOfTaps, Backend::RealMultiplyAdd().name());
+
+    return Result::SUCCESS;
+}
+
+template<Device D, typename T>
+Result Channelizer<D, T>::destroyCompute(const Context&) {
+    JST_TRACE("Destroy Channelizer compute core using CPU backend.");
+
+    impl->plan.reset();
+    impl->samples.clear();
+
+    return Result::SUCCESS;
+}
+
+template<Device D, typename T>
+Result Channelizer<D, T>::compute(const Context& ctx) {
+    const U64 channels = config.channels;
+    const U64 tapsPerChannel = config.tapsPerChannel;
+    const U64 decimation = impl->decimation;
+    const U64 outputSize = impl->outputSize;
+    const U64 historySize = impl->taps.size() - 1;
+
+    CF32* samples = impl->samples.data();
+    std::copy_n(input.buffer.data() + input.buffer.offset(), impl->inputSize, samples + historySize);
+
+    T* out = output.buffer.data();
+    const auto multiplyAdd = Backend::RealMultiplyAdd().kernel();
+
+    // Each output step folds the weighted window into one sum per branch,
+    // rotates the branches to the absolute sample position and runs a single
+    // inverse transform that yields every channel at once. The branch sums
+    // come out reversed, the rotation undoes it.
+
+    const U64 chunks = (output.buffer.size() * tapsPerChannel) / Memory::CPU::ParallelIteratorGrain;
+
+    Memory::CPU::ParallelRanges(ctx.cpu->pool(), outputSize, chunks, [&](const U64& begin, const U64& end) {
+        std::vector<CF32> branches(channels);
+        std::vector<CF32> rotated(channels);
+
+        for (U64 m = begin; m < end; m++) {
+            const CF32* window = samples + m * decimation + decimation - 1;
+
+            std::fill(branches.begin(), branches.end(), CF32(0.0f, 0.0f));
+            for (U64 p = 0; p < tapsPerChannel; p++) {
+                multiplyAdd(impl->weights.data() + 2 * p * channels,
+                            reinterpret_cast<const F32*>(window + p * channels),
+                            reinterpret_cast<F32*>(branches.data()),
+                            2 * channels);
+            }
+
+            const U64 shift = (impl->phase + (m + 1) * decimation - 1) % channels;
+            for (U64 i = 0; i < channels; i++) {
+                rotated[(2 * channels - 1 - i - shift) % channels] = branches[i];
+            }
+
+            impl->plan->exec(reinterpret_cast<pocketfft::detail::cmplx<F32>*>(rotated.data()), 1.0f, false);
+
+            for (U64 k = 0; k < channels; k++) {
+                out[k * outputSize + m] = rotated[k];
+            }
+        }
+    });
+
+    // Keep the tail as the history of the next buffer.
+
+    std::copy(samples + impl->inputSize, samples + impl->inputSize + historySize, samples);
+    impl->phase = (impl->phase + impl->inputSize) % channels;
+
+    return Result::SUCCESS;
+}
+
+JST_CHANNELIZER_CPU(JST_INSTANTIATION)
+JST_CHANNELIZER_CPU(JST_BENCHMARK)
+
+}  // namespace Jetstream
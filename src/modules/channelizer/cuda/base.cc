@@ -0,0 +1,256 @@
+#include "../generic.cc"
+
+#include <cufft.h>
+
+#include "jetstream/memory/devices/cuda/copy.hh"
+
+namespace Jetstream {
+
+template<Device D, typename T>
+struct Channelizer<D, T>::Impl {
+    U64 decimation = 0;
+    U64 inputSize = 0;
+    U64 outputSize = 0;
+
+    std::vector<F32> taps;
+
+    // Absolute position of the buffer start modulo the number of channels.
+    U64 phase = 0;
+
+    cufftHandle plan;
+
+    std::vector<U64> grid;
+    std::vector<U64> block;
+    std::vector<U64> historyGrid;
+
+    std::vector<void*> arguments;
+    std::vector<void*> historyArguments;
+
+    Tensor<Device::CUDA, T> input;
+    Tensor<Device::CUDA, F32> deviceTaps;
+
+    // Rotated branch sums, one row of channels per output step.
+    Tensor<Device::CUDA, T> branches;
+
+    // Last taps - 1 samples, oldest first. The next history is written
+    // apart and copied back, so buffers shorter than the history don't race.
+    Tensor<Device::CUDA, T> history;
+    Tensor<Device::CUDA, T> nextHistory;
+
+    U64 numberOfTaps = 0;
+    U64 historySize = 0;
+    U64 numberOfElements = 0;
+};
+
+template<Device D, typename T>
+Channelizer<D, T>::Channelizer() {
+    impl = std::make_unique<Impl>();
+}
+
+template<Device D, typename T>
+Channelizer<D, T>::~Channelizer() {
+    impl.reset();
+}
+
+template<Device D, typename T>
+Result Channelizer<D, T>::createCompute(const Context& ctx) {
+    JST_TRACE("Create Channelizer compute core using CUDA backend.");
+
+    // Create CUDA kernels.
+    //
+    // Each thread folds one branch of one output step over the window of
+    // [history | input] and stores it at its rotated position. Neighbouring
+    // threads read neighbouring samples.
+
+    ctx.cuda->createKernel("channelizer", R"""(
+        __global__ void channelizer(const float2* input,
+                                    const float2* history,
+                                    const float* taps,
+                                    float2* branches,
+                                    size_t channels,
+                                    size_t tapsPerChannel,
+                                    size_t decimation,
+                                    size_t historySize,
+                                    size_t phase,
+                                    size_t size) {
+            size_t id = blockIdx.x * blockDim.x + threadIdx.x;
+            if (id >= size) {
+                return;
+            }
+
+            const size_t i = id % channels;
+            const size_t m = id / channels;
+            const size_t start = m * decimation + decimation - 1;
+
+            float2 acc = make_float2(0.0f, 0.0f);
+
+            for (size_t p = 0; p < tapsPerChannel; p++) {
+                const size_t n = start + p * channels + i;
+                const float tap = taps[p * channels + i];
+                const float2 x = (n < historySize) ? history[n] : input[n - historySize];
+                acc.x = fmaf(tap, x.x, acc.x);
+                acc.y = fmaf(tap, x.y, acc.y);
+            }
+
+            const size_t shift = (phase + (m + 1) * decimation - 1) % channels;
+            branches[m * channels + (2 * channels - 1 - i - shift) % channels] = acc;
+        }
+    )""");
+
+    ctx.cuda->createKernel("channelizer_history", R"""(
+        __global__ void channelizer_history(const float2* input,
+                                            const float2* history,
+                                            float2* nextHistory,
+                                            size_t inputSize,
+                                            size_t historySize) {
+            size_t id = blockIdx.x * blockDim.x + threadIdx.x;
+            if (id >= historySize) {
+                return;
+            }
+
+            const size_t n = inputSize + id;
+            nextHistory[id] = (n < historySize) ? history[n] : input[n - historySize];
+        }
+    )""");
+
+    // Upload the taps reversed, oldest sample first.
+
+    impl->numberOfTaps = impl->taps.size();
+    impl->historySize = impl->numberOfTaps - 1;
+
+    Tensor<Device::CPU, F32> hostTaps({impl->numberOfTaps});
+    for (U64 j = 0; j < impl->numberOfTaps; j++) {
+        hostTaps[j] = impl->taps[impl->numberOfTaps - 1 - j];
+    }
+    impl->deviceTaps = Tensor<Device::CUDA, F32>({impl->numberOfTaps});
+    JST_CHECK(Memory::Copy(impl->deviceTaps, hostTaps));
+
+    // Allocate scratch and history. Zero-filled by the allocator.
+
+    impl->branches = Tensor<Device::CUDA, T>({impl->outputSize, config.channels});
+    impl->history = Tensor<Device::CUDA, T>({impl->historySize});
+    impl->nextHistory = Tensor<Device::CUDA, T>({impl->historySize});
+
+    // Initialize kernel size.
+
+    impl->numberOfElements = impl->outputSize * config.channels;
+
+    U64 threadsPerBlock = 256;
+
+    impl->grid = { (impl->numberOfElements + threadsPerBlock - 1) / threadsPerBlock, 1, 1 };
+    impl->historyGrid = { (impl->historySize + threadsPerBlock - 1) / threadsPerBlock, 1, 1 };
+    impl->block = { threadsPerBlock, 1, 1 };
+
+    // Initialize kernel input.
+
+    if (!input.buffer.device_native() && input.buffer.contiguous()) {
+        impl->input = Tensor<Device::CUDA, T>(input.buffer.shape());
+    } else {
+        impl->input = input.buffer;
+    }
+
+    // Initialize kernel arguments.
+
+    impl->arguments = {
+        impl->input.data_ptr(),
+        impl->history.data_ptr(),
+        impl->deviceTaps.data_ptr(),
+        impl->branches.data_ptr(),
+        &config.channels,
+        &config.tapsPerChannel,
+        &impl->decimation,
+        &impl->historySize,
+        &impl->phase,
+        &impl->numberOfElements,
+    };
+
+    impl->historyArguments = {
+        impl->input.data_ptr(),
+        impl->history.data_ptr(),
+        impl->nextHistory.data_ptr(),
+        &impl->inputSize,
+        &impl->historySize,
+    };
+
+    // Create the channel transform.
+    //
+    // One inverse transform per output step. Each transform reads a row of
+    // branches and writes a column of the output, so the channels come out
+    // as rows without a transpose.
+
+    JST_CUFFT_CHECK(cufftCreate(&impl->plan), [&](){
+        JST_FATAL("Failed to create cuFFT instance: {}", err);
+    });
+
+    int n[] = { static_cast<int>(config.channels) };
+    int inembed[] = { 0 };
+    int onembed[] = { 0 };
+
+    JST_CUFFT_CHECK(cufftPlanMany(&impl->plan,
+                                  1,
+                                  n,
+                                  inembed,
+                                  1,
+                                  static_cast<int>(config.channels),
+                                  onembed,
+                                  static_cast<int>(impl->outputSize),
+                                  1,
+                                  CUFFT_C2C,
+                                  static_cast<int>(impl->outputSize)), [&]{
+        JST_ERROR("Failed to create channelizer FFT plan: {}.", err);
+    });
+
+    JST_CUFFT_CHECK(cufftSetStream(impl->plan, ctx.cuda->stream()), [&](){
+        JST_FATAL("Failed to set cuFFT stream: {}", err);
+    });
+
+    return Result::SUCCESS;
+}
+
+template<Device D, typename T>
+Result Channelizer<D, T>::destroyCompute(const Context&) {
+    JST_TRACE("Destroy Channelizer compute core using CUDA backend.");
+
+    JST_CUFFT_CHECK(cufftDestroy(impl->plan), [&](){
+        JST_ERROR("Failed to destroy channelizer FFT plan: {}.", err);
+    });
+
+    return Result::SUCCESS;
+}
+
+template<Device D, typename T>
+Result Channelizer<D, T>::compute(const Context& ctx) {
+    if (!input.buffer.device_native() && input.buffer.contiguous()) {
+        JST_CHECK(Memory::Copy(impl->input, input.buffer, ctx.cuda->stream()));
+    }
+
+    JST_CHECK(ctx.cuda->launchKernel("channelizer",
+                                     impl->grid,
+                                     impl->block,
+                                     impl->arguments.data()));
+
+    const auto branches = reinterpret_cast<cufftComplex*>(impl->branches.data());
+    const auto channels = reinterpret_cast<cufftComplex*>(output.buffer.data());
+
+    JST_CUFFT_CHECK(cufftExecC2C(impl->plan, branches, channels, CUFFT_INVERSE), [&](){
+        JST_ERROR("Failed to execute channelizer FFT: {}.", err);
+    });
+
+    JST_CHECK(ctx.cuda->launchKernel("channelizer_history",
+                                     impl->historyGrid,
+                                     impl->block,
+                                     impl->historyArguments.data()));
+
+    JST_CHECK(Memory::Copy(impl->history, impl->nextHistory, ctx.cuda->stream()));
+
+    // The phase is passed by value at launch, so the graph isn't capturable.
+
+    impl->phase = (impl->phase + impl->inputSize) % config.channels;
+
+    return Result::SUCCESS;
+}
+
+JST_CHANNELIZER_CUDA(JST_INSTANTIATION)
+JST_CHANNELIZER_CUDA(JST_BENCHMARK)
+
+}  // namespace Jetstream
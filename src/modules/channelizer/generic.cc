@@ -0,0 +1,86 @@
+#include "jetstream/modules/channelizer.hh"
+
+#include "benchmark.cc"
+
+namespace Jetstream {
+
+// Blackman windowed sinc prototype with the cutoff at half the channel
+// spacing and unity gain at DC. Adjacent channels cross at -6 dB.
+inline std::vector<F32> ChannelizerTaps(const U64& channels, const U64& tapsPerChannel) {
+    const U64 size = channels * tapsPerChannel;
+    const F64 cutoff = 0.5 / static_cast<F64>(channels);
+    const F64 center = static_cast<F64>(size - 1) / 2.0;
+
+    std::vector<F64> window(size);
+    F64 sum = 0.0;
+
+    for (U64 i = 0; i < size; i++) {
+        const F64 x = 2.0 * cutoff * (static_cast<F64>(i) - center);
+        const F64 sinc = (x == 0.0) ? 1.0 : sin(JST_PI * x) / (JST_PI * x);
+        window[i] = sinc * (0.42 - 0.50 * cos(2.0 * JST_PI * i / (size - 1)) +
+                            0.08 * cos(4.0 * JST_PI * i / (size - 1)));
+        sum += window[i];
+    }
+
+    std::vector<F32> taps(size);
+    for (U64 i = 0; i < size; i++) {
+        taps[i] = static_cast<F32>(window[i] / sum);
+    }
+    return taps;
+}
+
+template<Device D, typename T>
+Result Channelizer<D, T>::create() {
+    JST_DEBUG("Initializing Channelizer module.");
+    JST_INIT_IO();
+
+    // Check parameters.
+
+    if (config.channels < 2) {
+        JST_ERROR("Number of channels ({}) should be at least 2.", config.channels);
+        return Result::ERROR;
+    }
+
+    if (config.oversampling == 0 || (config.channels % config.oversampling) != 0) {
+        JST_ERROR("Number of channels ({}) should be a multiple of the oversampling ({}).",
+                  config.channels, config.oversampling);
+        return Result::ERROR;
+    }
+
+    if (config.tapsPerChannel == 0) {
+        JST_ERROR("Number of taps per channel should be positive.");
+        return Result::ERROR;
+    }
+
+    const U64 decimation = config.channels / config.oversampling;
+
+    if (input.buffer.size() == 0 || (input.buffer.size() % decimation) != 0) {
+        JST_ERROR("Input size ({}) should be a multiple of the channel decimation ({}).",
+                  input.buffer.size(), decimation);
+        return Result::ERROR;
+    }
+
+    // Calculate parameters.
+
+    impl->decimation = decimation;
+    impl->inputSize = input.buffer.size();
+    impl->outputSize = impl->inputSize / decimation;
+    impl->taps = ChannelizerTaps(config.channels, config.tapsPerChannel);
+    impl->phase = 0;
+
+    // Allocate output.
+
+    output.buffer = Tensor<D, T>({config.channels, impl->outputSize});
+
+    return Result::SUCCESS;
+}
+
+template<Device D, typename T>
+void Channelizer<D, T>::info() const {
+    JST_DEBUG("  Channels:         {}", config.channels);
+    JST_DEBUG("  Oversampling:     {}", config.oversampling);
+    JST_DEBUG("  Taps Per Channel: {}", config.tapsPerChannel);
+    JST_DEBUG("  Decimation:       {}", impl->decimation);
+}
+
+}  // namespace Jetstream
@@ -0,0 +1,18 @@
+#include "jetstream/modules/cic_decimator.hh"
+
+namespace Jetstream {
+
+template<template<Device, typename...> class Module, Device D, typename T>
+void benchmark(ankerl::nanobench::Bench& bench, std::string name) {
+    JST_BENCHMARK_RUN("8x65536 (1/64)", {}, {
+        .buffer = Tensor<D COMMA T>({8 COMMA 65536}) COMMA
+    }, T);
+
+    JST_BENCHMARK_RUN("8x65536 (1/1024)", {
+        .ratio = 1024 COMMA
+    }, {
+        .buffer = Tensor<D COMMA T>({8 COMMA 65536}) COMMA
+    }, T);
+}
+
+}  // namespace Jetstream
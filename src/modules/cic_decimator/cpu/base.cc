@@ -0,0 +1,154 @@
+#include "../generic.cc"
+
+#include "jetstream/memory/devices/cpu/helpers.hh"
+#include "jetstream/backend/devices/cpu/fir.hh"
+
+namespace Jetstream {
+
+template<Device D, typename T>
+struct CicDecimator<D, T>::Impl {
+    U64 outer = 1;
+    U64 inner = 1;
+    U64 axisSize = 0;
+    U64 outputSize = 0;
+    U64 fractionBits = 0;
+
+    std::vector<F32> compensator;
+
+    // Integrator and comb state of every lane, stage and sample part. Kept
+    // unsigned so the integrators wrap instead of overflowing.
+    std::vector<U64> integrators;
+    std::vector<U64> combs;
+
+    // One compensator per lane at the output rate.
+    std::vector<Backend::PolyphaseFir<T>> filters;
+};
+
+template<Device D, typename T>
+CicDecimator<D, T>::CicDecimator() {
+    impl = std::make_unique<Impl>();
+}
+
+template<Device D, typename T>
+CicDecimator<D, T>::~CicDecimator() {
+    impl.reset();
+}
+
+// Real and imaginary parts run through the same recursion.
+static constexpr U64 CicParts(const bool& complex) {
+    return complex ? 2 : 1;
+}
+
+template<Device D, typename T>
+Result CicDecimator<D, T>::createCompute(const Context&) {
+    JST_TRACE("Create CIC Decimator compute core using CPU backend.");
+
+    const U64 lanes = impl->outer * impl->inner;
+    const U64 state = lanes * config.stages * CicParts(std::is_same_v<T, CF32>);
+
+    impl->integrators.assign(state, 0);
+    impl->combs.assign(state, 0);
+
+    impl->filters.clear();
+    if (!impl->compensator.empty()) {
+        impl->filters.resize(lanes);
+        for (auto& filter : impl->filters) {
+            JST_CHECK(filter.configure(impl->compensator.data(), impl->compensator.size(), 1, 1));
+        }
+    }
+
+    JST_TRACE("[CIC_DECIMATOR] Lanes: {}; Fraction Bits: {};", lanes, impl->fractionBits);
+
+    return Result::SUCCESS;
+}
+
+template<Device D, typename T>
+Result CicDecimator<D, T>::compute(const Context& ctx) {
+    constexpr U64 parts = CicParts(std::is_same_v<T, CF32>);
+
+    const F32* in = reinterpret_cast<const F32*>(input.buffer.data() + input.buffer.offset());
+    F32* out = reinterpret_cast<F32*>(output.buffer.data());
+
+    const U64 inner = impl->inner;
+    const U64 axisSize = impl->axisSize;
+    const U64 outputSize = impl->outputSize;
+    const U64 stages = config.stages;
+    const U64 ratio = config.ratio;
+
+    // Samples are converted to fixed point once, then only added and
+    // subtracted. The output scale folds the fixed point scale and the
+    // ratio^stages gain of the filter.
+
+    const F64 inputScale = static_cast<F64>(U64{1} << impl->fractionBits);
+    const F64 outputScale = 1.0 / (std::pow(static_cast<F64>(ratio), static_cast<F64>(stages)) * inputScale);
+
+    const U64 lanes = impl->outer * inner;
+    const U64 chunks = (input.buffer.size() * stages) / Memory::CPU::ParallelIteratorGrain;
+
+    Memory::CPU::ParallelRanges(ctx.cpu->pool(), lanes, chunks, [&](const U64& begin, const U64& end) {
+        std::vector<T> decimated;
+        std::vector<T> compensated;
+
+        for (U64 l = begin; l < end; l++) {
+            const U64 o = l / inner;
+            const U64 i = l % inner;
+
+            const F32* src = in + (o * axisSize * inner + i) * parts;
+            F32* dst = out + (o * outputSize * inner + i) * parts;
+
+            for (U64 p = 0; p < parts; p++) {
+                U64* integrators = impl->integrators.data() + (l * parts + p) * stages;
+                U64* combs = impl->combs.data() + (l * parts + p) * stages;
+
+                for (U64 n = 0, m = 0; n < axisSize; n++) {
+                    U64 value = static_cast<U64>(std::llrint(src[n * inner * parts + p] * inputScale));
+                    for (U64 s = 0; s < stages; s++) {
+                        integrators[s] += value;
+                        value = integrators[s];
+                    }
+
+                    if (((n + 1) % ratio) != 0) {
+                        continue;
+                    }
+
+                    for (U64 s = 0; s < stages; s++) {
+                        const U64 delayed = combs[s];
+                        combs[s] = value;
+                        value -= delayed;
+                    }
+
+                    dst[(m++) * inner * parts + p] = static_cast<F32>(static_cast<I64>(value) * outputScale);
+                }
+            }
+
+            if (impl->filters.empty()) {
+                continue;
+            }
+
+            // Compensate at the output rate. Strided lanes are gathered so
+            // the dot products stay contiguous.
+
+            T* lane = reinterpret_cast<T*>(dst);
+
+            decimated.resize(outputSize);
+            compensated.resize(outputSize);
+
+            for (U64 m = 0; m < outputSize; m++) {
+                decimated[m] = lane[m * inner];
+            }
+
+            impl->filters[l].process(decimated.data(), outputSize, compensated.data());
+
+            for (U64 m = 0; m < outputSize; m++) {
+                lane[m * inner] = compensated[m];
+            }
+        }
+    });
+
+    return Result::SUCCESS;
+}
+
+JST_CIC_DECIMATOR_CPU(JST_INSTANTIATION)
+JST_CIC_DECIMATOR_CPU(JST_BENCHMARK)
+
+}  // namespace Jetstream
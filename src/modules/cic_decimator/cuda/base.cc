@@ -0,0 +1,265 @@
+#include "../generic.cc"
+
+#include "jetstream/memory/devices/cuda/copy.hh"
+
+namespace Jetstream {
+
+template<Device D, typename T>
+struct CicDecimator<D, T>::Impl {
+    U64 outer = 1;
+    U64 inner = 1;
+    U64 axisSize = 0;
+    U64 outputSize = 0;
+    U64 fractionBits = 0;
+
+    std::vector<F32> compensator;
+
+    std::vector<U64> grid;
+    std::vector<U64> block;
+    std::vector<U64> historyGrid;
+
+    std::vector<void*> arguments;
+    std::vector<void*> historyArguments;
+
+    Tensor<Device::CUDA, T> input;
+    Tensor<Device::CUDA, F32> deviceTaps;
+
+    // Last samples of every lane, oldest first. The next history is written
+    // apart and copied back, so blocks shorter than the history don't race.
+    Tensor<Device::CUDA, T> history;
+    Tensor<Device::CUDA, T> nextHistory;
+
+    U64 numberOfTaps = 0;
+    U64 historySize = 0;
+    U64 numberOfElements = 0;
+    U64 numberOfHistoryElements = 0;
+};
+
+template<Device D, typename T>
+CicDecimator<D, T>::CicDecimator() {
+    impl = std::make_unique<Impl>();
+}
+
+template<Device D, typename T>
+CicDecimator<D, T>::~CicDecimator() {
+    impl.reset();
+}
+
+template<Device D, typename T>
+Result CicDecimator<D, T>::createCompute(const Context& ctx) {
+    JST_TRACE("Create CicDecimator compute core using CUDA backend.");
+
+    // Create CUDA kernels.
+    //
+    // The integrators are a recursion over the whole stream, which doesn't
+    // split across threads. The CIC is evaluated as its equivalent FIR
+    // instead, the stages-fold convolution of a ratio long boxcar, merged
+    // with the compensator spread to the input rate. Each thread computes
+    // one kept output as a dot product over a window of [history | input]
+    // ending at its last input sample.
+
+    std::string header;
+
+    if constexpr (std::is_same_v<T, CF32>) {
+        header = R"""(
+            typedef float2 sample_t;
+
+            __device__ inline void madd(sample_t& acc, const float tap, const sample_t& x) {
+                acc.x = fmaf(tap, x.x, acc.x);
+                acc.y = fmaf(tap, x.y, acc.y);
+            }
+
+            __device__ inline sample_t zero() {
+                return make_float2(0.0f, 0.0f);
+            }
+        )""";
+    } else {
+        header = R"""(
+            typedef float sample_t;
+
+            __device__ inline void madd(sample_t& acc, const float tap, const sample_t& x) {
+                acc = fmaf(tap, x, acc);
+            }
+
+            __device__ inline sample_t zero() {
+                return 0.0f;
+            }
+        )""";
+    }
+
+    ctx.cuda->createKernel("cic_decimator", header + R"""(
+        __global__ void cic_decimator(const sample_t* input,
+                                  const sample_t* history,
+                                  const float* taps,
+                                  sample_t* output,
+                                  size_t axisSize,
+                                  size_t inner,
+                                  size_t outputSize,
+                                  size_t numberOfTaps,
+                                  size_t historySize,
+                                  size_t ratio,
+                                  size_t size) {
+            size_t id = blockIdx.x * blockDim.x + threadIdx.x;
+            if (id >= size) {
+                return;
+            }
+
+            const size_t i = id % inner;
+            const size_t m = (id / inner) % outputSize;
+            const size_t o = id / (inner * outputSize);
+
+            const sample_t* x = input + o * axisSize * inner + i;
+            const sample_t* h = history + o * historySize * inner + i;
+
+            sample_t acc = zero();
+            const size_t start = m * ratio + ratio - 1;
+
+            for (size_t j = 0; j < numberOfTaps; j++) {
+                const size_t n = start + j;
+                madd(acc, taps[j], (n < historySize) ? h[n * inner] : x[(n - historySize) * inner]);
+            }
+
+            output[id] = acc;
+        }
+    )""");
+
+    ctx.cuda->createKernel("cic_decimator_history", header + R"""(
+        __global__ void cic_decimator_history(const sample_t* input,
+                                          const sample_t* history,
+                                          sample_t* nextHistory,
+                                          size_t axisSize,
+                                          size_t inner,
+                                          size_t historySize,
+                                          size_t size) {
+            size_t id = blockIdx.x * blockDim.x + threadIdx.x;
+            if (id >= size) {
+                return;
+            }
+
+            const size_t i = id % inner;
+            const size_t t = (id / inner) % historySize;
+            const size_t o = id / (inner * historySize);
+
+            const size_t n = axisSize + t;
+            nextHistory[id] = (n < historySize) ? history[(o * historySize + n) * inner + i] :
+                                                  input[(o * axisSize + n - historySize) * inner + i];
+        }
+    )""");
+
+    // Build the equivalent taps.
+
+    std::vector<F64> boxcar = {1.0};
+    for (U64 s = 0; s < config.stages; s++) {
+        std::vector<F64> next(boxcar.size() + config.ratio - 1, 0.0);
+        for (U64 k = 0; k < boxcar.size(); k++) {
+            for (U64 r = 0; r < config.ratio; r++) {
+                next[k + r] += boxcar[k] / config.ratio;
+            }
+        }
+        boxcar = std::move(next);
+    }
+
+    std::vector<F32> taps(boxcar.begin(), boxcar.end());
+
+    if (!impl->compensator.empty()) {
+        taps.assign(boxcar.size() + (impl->compensator.size() - 1) * config.ratio, 0.0f);
+        for (U64 j = 0; j < impl->compensator.size(); j++) {
+            for (U64 k = 0; k < boxcar.size(); k++) {
+                taps[j * config.ratio + k] += static_cast<F32>(impl->compensator[j] * boxcar[k]);
+            }
+        }
+    }
+
+    // Upload the taps reversed, oldest sample first.
+
+    impl->numberOfTaps = taps.size();
+    impl->historySize = impl->numberOfTaps - 1;
+
+    Tensor<Device::CPU, F32> hostTaps({impl->numberOfTaps});
+    for (U64 j = 0; j < impl->numberOfTaps; j++) {
+        hostTaps[j] = taps[impl->numberOfTaps - 1 - j];
+    }
+    impl->deviceTaps = Tensor<Device::CUDA, F32>({impl->numberOfTaps});
+    JST_CHECK(Memory::Copy(impl->deviceTaps, hostTaps));
+
+    // Allocate history. Zero-filled by the allocator.
+
+    const U64 historyLength = std::max<U64>(impl->historySize, 1);
+    impl->history = Tensor<Device::CUDA, T>({impl->outer, historyLength, impl->inner});
+    impl->nextHistory = Tensor<Device::CUDA, T>({impl->outer, historyLength, impl->inner});
+
+    // Initialize kernel size.
+
+    impl->numberOfElements = output.buffer.size();
+    impl->numberOfHistoryElements = impl->outer * impl->historySize * impl->inner;
+
+    U64 threadsPerBlock = 256;
+
+    impl->grid = { (impl->numberOfElements + threadsPerBlock - 1) / threadsPerBlock, 1, 1 };
+    impl->historyGrid = { (impl->numberOfHistoryElements + threadsPerBlock - 1) / threadsPerBlock, 1, 1 };
+    impl->block = { threadsPerBlock, 1, 1 };
+
+    // Initialize kernel input.
+
+    if (!input.buffer.device_native() && input.buffer.contiguous()) {
+        impl->input = Tensor<Device::CUDA, T>(input.buffer.shape());
+    } else {
+        impl->input = input.buffer;
+    }
+
+    // Initialize kernel arguments.
+
+    impl->arguments = {
+        impl->input.data_ptr(),
+        impl->history.data_ptr(),
+        impl->deviceTaps.data_ptr(),
+        output.buffer.data_ptr(),
+        &impl->axisSize,
+        &impl->inner,
+        &impl->outputSize,
+        &impl->numberOfTaps,
+        &impl->historySize,
+        &config.ratio,
+        &impl->numberOfElements,
+    };
+
+    impl->historyArguments = {
+        impl->input.data_ptr(),
+        impl->history.data_ptr(),
+        impl->nextHistory.data_ptr(),
+        &impl->axisSize,
+        &impl->inner,
+        &impl->historySize,
+        &impl->numberOfHistoryElements,
+    };
+
+    return Result::SUCCESS;
+}
+
+template<Device D, typename T>
+Result CicDecimator<D, T>::compute(const Context& ctx) {
+    if (!input.buffer.device_native() && input.buffer.contiguous()) {
+        JST_CHECK(Memory::Copy(impl->input, input.buffer, ctx.cuda->stream()));
+    }
+
+    JST_CHECK(ctx.cuda->launchKernel("cic_decimator",
+                                     impl->grid,
+                                     impl->block,
+                                     impl->arguments.data()));
+
+    if (impl->historySize > 0) {
+        JST_CHECK(ctx.cuda->launchKernel("cic_decimator_history",
+                                         impl->historyGrid,
+                                         impl->block,
+                                         impl->historyArguments.data()));
+
+        JST_CHECK(Memory::Copy(impl->history, impl->nextHistory, ctx.cuda->stream()));
+    }
+
+    return Result::SUCCESS;
+}
+
+JST_CIC_DECIMATOR_CUDA(JST_INSTANTIATION)
+JST_CIC_DECIMATOR_CUDA(JST_BENCHMARK)
+
+}  // namespace Jetstream
@@ -0,0 +1,133 @@
+#include "jetstream/modules/cic_decimator.hh"
+
+#include <bit>
+
+#include "benchmark.cc"
+
+namespace Jetstream {
+
+// Frequency sampled FIR at the output rate undoing the sinc^N droop of the
+// CIC up to a quarter of the output rate and rejecting above it, Blackman
+// windowed, with unity gain at DC.
+inline std::vector<F32> CicCompensatorTaps(const U64& ratio, const U64& stages, const U64& size) {
+    const U64 half = (size - 1) / 2;
+    const F64 passband = 0.25;
+
+    std::vector<F64> response(half + 1, 0.0);
+    for (U64 k = 0; k <= half; k++) {
+        const F64 f = static_cast<F64>(k) / static_cast<F64>(size);
+        if (k == 0) {
+            response[k] = 1.0;
+        } else if (f <= passband) {
+            const F64 droop = sin(JST_PI * f) / (ratio * sin(JST_PI * f / ratio));
+            response[k] = 1.0 / std::pow(droop, static_cast<F64>(stages));
+        }
+    }
+
+    std::vector<F64> window(size);
+    F64 sum = 0.0;
+
+    for (U64 i = 0; i < size; i++) {
+        const F64 n = static_cast<F64>(i) - static_cast<F64>(half);
+        F64 value = response[0];
+        for (U64 k = 1; k <= half; k++) {
+            value += 2.0 * response[k] * cos(2.0 * JST_PI * k * n / size);
+        }
+        window[i] = value * (0.42 - 0.50 * cos(2.0 * JST_PI * i / (size - 1)) +
+                             0.08 * cos(4.0 * JST_PI * i / (size - 1)));
+        sum += window[i];
+    }
+
+    std::vector<F32> taps(size);
+    for (U64 i = 0; i < size; i++) {
+        taps[i] = static_cast<F32>(window[i] / sum);
+    }
+    return taps;
+}
+
+template<Device D, typename T>
+Result CicDecimator<D, T>::create() {
+    JST_DEBUG("Initializing CIC Decimator module.");
+    JST_INIT_IO();
+
+    // Check parameters.
+
+    if (config.axis >= input.buffer.rank()) {
+        JST_ERROR("Decimation axis ({}) is out of range for a tensor of rank {}.",
+                  config.axis, input.buffer.rank());
+        return Result::ERROR;
+    }
+
+    if (config.ratio < 2) {
+        JST_ERROR("Decimation ratio ({}) should be at least 2.", config.ratio);
+        return Result::ERROR;
+    }
+
+    if (config.stages == 0) {
+        JST_ERROR("Number of stages should be positive.");
+        return Result::ERROR;
+    }
+
+    if (config.compensationTaps != 0 && ((config.compensationTaps % 2) == 0 || config.compensationTaps < 3)) {
+        JST_ERROR("Number of compensation taps ({}) should be odd and at least 3, or zero to disable it.",
+                  config.compensationTaps);
+        return Result::ERROR;
+    }
+
+    // The integrators wrap in 64 bits and the combs undo it, as long as the
+    // output fits. Each stage grows the signal by the ratio, what's left
+    // holds the input fraction with a few integer bits of headroom.
+
+    const U64 growth = config.stages * std::bit_width(config.ratio - 1);
+    if (growth + 4 + 8 > 63) {
+        JST_ERROR("Too many stages ({}) for a ratio of {}. The integrators would overflow.",
+                  config.stages, config.ratio);
+        return Result::ERROR;
+    }
+    impl->fractionBits = std::min<U64>(24, 63 - 4 - growth);
+
+    const auto& shape = input.buffer.shape();
+
+    if ((shape[config.axis] % config.ratio) != 0) {
+        JST_ERROR("Axis size ({}) should be a multiple of the decimation ratio ({}).",
+                  shape[config.axis], config.ratio);
+        return Result::ERROR;
+    }
+
+    // Calculate parameters.
+
+    impl->outer = 1;
+    impl->inner = 1;
+    for (U64 i = 0; i < config.axis; i++) {
+        impl->outer *= shape[i];
+    }
+    for (U64 i = config.axis + 1; i < shape.size(); i++) {
+        impl->inner *= shape[i];
+    }
+    impl->axisSize = shape[config.axis];
+    impl->outputSize = impl->axisSize / config.ratio;
+
+    impl->compensator.clear();
+    if (config.compensationTaps > 0) {
+        impl->compensator = CicCompensatorTaps(config.ratio, config.stages, config.compensationTaps);
+    }
+
+    // Allocate output.
+
+    auto outputShape = shape;
+    outputShape[config.axis] = impl->outputSize;
+    output.buffer = Tensor<D, T>(outputShape);
+
+    return Result::SUCCESS;
+}
+
+template<Device D, typename T>
+void CicDecimator<D, T>::info() const {
+    JST_DEBUG("  Axis:              {}", config.axis);
+    JST_DEBUG("  Ratio:             {}", config.ratio);
+    JST_DEBUG("  Stages:            {}", config.stages);
+    JST_DEBUG("  Compensation Taps: {}", config.compensationTaps);
+    JST_DEBUG("  Fraction Bits:     {}", impl->fractionBits);
+}
+
+}  // namespace Jetstream
@@ -1,5 +1,6 @@
 #include "../generic.cc"
 
+#include "jetstream/backend/devices/cpu/simd.hh"
 #include "jetstream/memory/devices/cpu/helpers.hh"
 #include "jetstream/types.hh"
 
@@ -7,6 +8,9 @@ namespace Jetstream {
 
 template<Device D, typename T>
 struct Constellation<D, T>::Impl {
+    Tensor<Device::CPU, F32> densityBins;
+
+    Backend::CopyDecayKernel copyDecay = nullptr;
 };
 
 template<Device D, typename T>
@@ -30,14 +34,65 @@ Result Constellation<D, T>::createCompute(const Context&) {
         return Result::ERROR;
     }
 
+    if (config.enableDensity) {
+        pimpl->copyDecay = Backend::CopyDecay().kernel();
+
+        // Accumulate privately and publish a copy to present, decaying the
+        // accumulator on the way like the Spectrogram.
+
+        pimpl->densityBins = Tensor<Device::CPU, F32>(gimpl->densityBins.shape());
+
+        gimpl->densityBinsSnapshot.forEach([&](auto& snapshot) {
+            snapshot = Tensor<Device::CPU, F32>(gimpl->densityBins.shape());
+        });
+
+        return Result::SUCCESS;
+    }
+
+    gimpl->positionsSnapshot.forEach([&](auto& snapshot) {
+        snapshot.resize(input.buffer.size());
+    });
+
     return Result::SUCCESS;
 }
 
 template<Device D, typename T>
-Result Constellation<D, T>::compute(const Context&) {
-    // Get position buffer from components.
-    std::span<Extent2D<F32>> positions;
-    JST_CHECK(gimpl->shapes->getPositions("constellation_points", positions));
+Result Constellation<D, T>::compute(const Context& ctx) {
+    if (config.enableDensity) {
+        const U64 resolution = config.resolution;
+        const F32 scale = static_cast<F32>(resolution) / 2.0f;
+        const F32 weight = gimpl->hitWeight;
+        const T* points = input.buffer.data() + input.buffer.offset();
+        F32* bins = pimpl->densityBins.data();
+
+        // Raise the cell hit by every point inside the [-1, 1] square.
+
+        for (U64 i = 0; i < gimpl->numberOfPoints; i++) {
+            const F32 x = (points[i].real() + 1.0f) * scale;
+            const F32 y = (points[i].imag() + 1.0f) * scale;
+
+            if (x >= 0.0f && x < resolution && y >= 0.0f && y < resolution) {
+                F32& val = bins[static_cast<U64>(x) + static_cast<U64>(y) * resolution];
+                val = std::min(val + weight, 1.0f);
+            }
+        }
+
+        // Publish and decay in a single pass.
+
+        const U64 size = pimpl->densityBins.size();
+        const U64 chunks = size / Memory::CPU::ParallelIteratorGrain;
+        F32* snapshot = gimpl->densityBinsSnapshot.back().data();
+
+        Memory::CPU::ParallelRanges(ctx.cpu->pool(), size, chunks, [&](const U64& begin, const U64& end) {
+            pimpl->copyDecay(bins + begin, snapshot + begin, end - begin, config.decay);
+        });
+
+        gimpl->densityBinsSnapshot.publish();
+
+        return Result::SUCCESS;
+    }
+
+    auto& positions = gimpl->positionsSnapshot.back();
 
     // Update positions buffer.
     for (U64 i = 0; i < input.buffer.size(); i++) {
@@ -45,8 +100,8 @@ Result Constellation<D, T>::compute(const Context&) {
         positions[i] = { complexValue.real(), complexValue.imag() };
     }
 
-    // Commit changes to the positions buffer.
-    JST_CHECK(gimpl->shapes->updatePositions());
+    // Hand the positions over to present.
+    gimpl->positionsSnapshot.publish();
 
     return Result::SUCCESS;
 }
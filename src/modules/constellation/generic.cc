@@ -2,6 +2,9 @@
 
 #include "jetstream/render/components/shapes.hh"
 #include "jetstream/render/utils.hh"
+#include "jetstream/memory/utils/triple_buffer.hh"
+
+#include "resources/shaders/constellation_shaders.hh"
 #include "jetstream/constants.hh"
 
 #include "benchmark.cc"
@@ -17,6 +20,35 @@ struct Constellation<D, T>::GImpl {
 
     U64 numberOfPoints;
 
+    Memory::TripleBuffer<std::vector<Extent2D<F32>>> positionsSnapshot;
+
+    // Density mode.
+
+    struct {
+        U32 width;
+        U32 height;
+        F32 offset;
+        F32 zoom;
+    } signalUniforms;
+
+    Tensor<D, F32> densityBins;
+    Memory::TripleBuffer<Tensor<Device::CPU, F32>> densityBinsSnapshot;
+
+    std::shared_ptr<Render::Buffer> fillScreenVerticesBuffer;
+    std::shared_ptr<Render::Buffer> fillScreenTextureVerticesBuffer;
+    std::shared_ptr<Render::Buffer> fillScreenIndicesBuffer;
+    std::shared_ptr<Render::Buffer> signalBuffer;
+    std::shared_ptr<Render::Buffer> signalUniformBuffer;
+
+    std::shared_ptr<Render::Texture> lutTexture;
+
+    std::shared_ptr<Render::Program> signalProgram;
+
+    std::shared_ptr<Render::Vertex> vertex;
+
+    std::shared_ptr<Render::Draw> drawVertex;
+
+    F32 hitWeight = 0.0f;
 };
 
 template<Device D, typename T>
@@ -38,16 +70,53 @@ Result Constellation<D, T>::create() {
 
     gimpl->numberOfPoints = input.buffer.size();
 
+    if (!config.enableDensity) {
+        return Result::SUCCESS;
+    }
+
+    if (!input.buffer.contiguous()) {
+        JST_ERROR("Density mode requires a contiguous input buffer.");
+        return Result::ERROR;
+    }
+
+    if (config.resolution < 16 || config.resolution > 4096) {
+        JST_ERROR("Density resolution ({}) should be between 16 and 4096.", config.resolution);
+        return Result::ERROR;
+    }
+
+    if (config.decay < 0.0f || config.decay >= 1.0f) {
+        JST_ERROR("Density decay ({}) should be in the range [0, 1).", config.decay);
+        return Result::ERROR;
+    }
+
+    // Points are binned instead of drawn, so the display cost depends on the
+    // resolution and not on the number of points. Each hit is weighted so a
+    // cell catching 1/64 of the points of every frame settles at full scale,
+    // whatever the number of points.
+
+    gimpl->hitWeight = 64.0f * (1.0f - config.decay) / static_cast<F32>(gimpl->numberOfPoints);
+
+    gimpl->densityBins = Tensor<D, F32>({config.resolution, config.resolution});
+
     return Result::SUCCESS;
 }
 
 template<Device D, typename T>
 void Constellation<D, T>::info() const {
     JST_DEBUG("  Window Size: [{}, {}]", config.viewSize.x, config.viewSize.y);
+    JST_DEBUG("  Density:     {}", config.enableDensity ? "YES" : "NO");
+    if (config.enableDensity) {
+        JST_DEBUG("  Resolution:  {}", config.resolution);
+        JST_DEBUG("  Decay:       {}", config.decay);
+    }
 }
 
 template<Device D, typename T>
 Result Constellation<D, T>::createPresent() {
+    if (config.enableDensity) {
+        return createDensityPresent();
+    }
+
     // Create shapes component.
     {
         Render::Components::Shapes::Config cfg;
@@ -82,8 +151,156 @@ Result Constellation<D, T>::createPresent() {
     return Result::SUCCESS;
 }
 
+template<Device D, typename T>
+Result Constellation<D, T>::createDensityPresent() {
+    {
+        Render::Buffer::Config cfg;
+        cfg.buffer = &FillScreenVertices;
+        cfg.elementByteSize = sizeof(float);
+        cfg.size = 12;
+        cfg.target = Render::Buffer::Target::VERTEX;
+        JST_CHECK(window->build(gimpl->fillScreenVerticesBuffer, cfg));
+        JST_CHECK(window->bind(gimpl->fillScreenVerticesBuffer));
+    }
+
+    {
+        Render::Buffer::Config cfg;
+        cfg.buffer = &FillScreenTextureVertices;
+        cfg.elementByteSize = sizeof(float);
+        cfg.size = 8;
+        cfg.target = Render::Buffer::Target::VERTEX;
+        JST_CHECK(window->build(gimpl->fillScreenTextureVerticesBuffer, cfg));
+        JST_CHECK(window->bind(gimpl->fillScreenTextureVerticesBuffer));
+    }
+
+    {
+        Render::Buffer::Config cfg;
+        cfg.buffer = &FillScreenIndices;
+        cfg.elementByteSize = sizeof(uint32_t);
+        cfg.size = 6;
+        cfg.target = Render::Buffer::Target::VERTEX_INDICES;
+        JST_CHECK(window->build(gimpl->fillScreenIndicesBuffer, cfg));
+        JST_CHECK(window->bind(gimpl->fillScreenIndicesBuffer));
+    }
+
+    {
+        Render::Vertex::Config cfg;
+        cfg.vertices = {
+            {gimpl->fillScreenVerticesBuffer, 3},
+            {gimpl->fillScreenTextureVerticesBuffer, 2},
+        };
+        cfg.indices = gimpl->fillScreenIndicesBuffer;
+        JST_CHECK(window->build(gimpl->vertex, cfg));
+    }
+
+    {
+        Render::Draw::Config cfg;
+        cfg.buffer = gimpl->vertex;
+        cfg.mode = Render::Draw::Mode::TRIANGLES;
+        JST_CHECK(window->build(gimpl->drawVertex, cfg));
+    }
+
+    {
+        auto [buffer, enableZeroCopy] = ConvertToOptimalStorage(window, gimpl->densityBins);
+
+        Render::Buffer::Config cfg;
+        cfg.buffer = buffer;
+        cfg.size = gimpl->densityBins.size();
+        cfg.elementByteSize = sizeof(F32);
+        cfg.target = Render::Buffer::Target::STORAGE;
+        cfg.enableZeroCopy = enableZeroCopy;
+        JST_CHECK(window->build(gimpl->signalBuffer, cfg));
+        JST_CHECK(window->bind(gimpl->signalBuffer));
+    }
+
+    {
+        Render::Texture::Config cfg;
+        cfg.size = {256, 1};
+        cfg.buffer = (uint8_t*)TurboLutBytes;
+        JST_CHECK(window->build(gimpl->lutTexture, cfg));
+        JST_CHECK(window->bind(gimpl->lutTexture));
+    }
+
+    {
+        Render::Buffer::Config cfg;
+        cfg.buffer = &gimpl->signalUniforms;
+        cfg.elementByteSize = sizeof(gimpl->signalUniforms);
+        cfg.size = 1;
+        cfg.target = Render::Buffer::Target::UNIFORM;
+        JST_CHECK(window->build(gimpl->signalUniformBuffer, cfg));
+        JST_CHECK(window->bind(gimpl->signalUniformBuffer));
+    }
+
+    {
+        Render::Program::Config cfg;
+        cfg.shaders = ShadersPackage["signal"];
+        cfg.draws = {
+            gimpl->drawVertex,
+        };
+        cfg.textures = {gimpl->lutTexture};
+        cfg.buffers = {
+            {gimpl->signalUniformBuffer, Render::Program::Target::VERTEX |
+                                         Render::Program::Target::FRAGMENT},
+            {gimpl->signalBuffer, Render::Program::Target::FRAGMENT},
+        };
+        JST_CHECK(window->build(gimpl->signalProgram, cfg));
+    }
+
+    {
+        Render::Texture::Config cfg;
+        cfg.size = config.viewSize;
+        JST_CHECK(window->build(gimpl->framebufferTexture, cfg));
+    }
+
+    {
+        Render::Surface::Config cfg;
+        cfg.framebuffer = gimpl->framebufferTexture;
+        cfg.programs = {gimpl->signalProgram};
+        cfg.clearColor = {0.1f, 0.1f, 0.1f, 1.0f};
+        JST_CHECK(window->build(gimpl->surface, cfg));
+        JST_CHECK(window->bind(gimpl->surface));
+    }
+
+    return Result::SUCCESS;
+}
+
 template<Device D, typename T>
 Result Constellation<D, T>::present() {
+    if (config.enableDensity) {
+        // Pick up the latest histogram published by compute. Draw only when there is one.
+        if constexpr (D == Device::CPU) {
+            if (!gimpl->densityBinsSnapshot.consume()) {
+                return Result::SUCCESS;
+            }
+            JST_CHECK(Memory::Copy(gimpl->densityBins, gimpl->densityBinsSnapshot.front()));
+        }
+
+        gimpl->signalBuffer->update();
+
+        gimpl->signalUniforms.width = config.resolution;
+        gimpl->signalUniforms.height = config.resolution;
+        gimpl->signalUniforms.zoom = 1.0;
+        gimpl->signalUniforms.offset = 0.0;
+
+        gimpl->signalUniformBuffer->update();
+        gimpl->surface->update();
+
+        return Result::SUCCESS;
+    }
+
+    // Pick up the latest points published by compute.
+    if (gimpl->positionsSnapshot.consume()) {
+        std::span<Extent2D<F32>> positions;
+        JST_CHECK(gimpl->shapes->getPositions("constellation_points", positions));
+
+        const auto& snapshot = gimpl->positionsSnapshot.front();
+        std::copy(snapshot.begin(), snapshot.end(), positions.begin());
+
+        JST_CHECK(gimpl->shapes->updatePositions());
+
+        gimpl->surface->update();
+    }
+
     // Update pixel size in case view size changed.
     gimpl->shapes->updatePixelSize({2.0f / config.viewSize.x, 2.0f / config.viewSize.y});
 
@@ -96,6 +313,18 @@ Result Constellation<D, T>::present() {
 template<Device D, typename T>
 Result Constellation<D, T>::destroyPresent() {
     JST_CHECK(window->unbind(gimpl->surface));
+
+    if (config.enableDensity) {
+        JST_CHECK(window->unbind(gimpl->lutTexture));
+        JST_CHECK(window->unbind(gimpl->fillScreenVerticesBuffer));
+        JST_CHECK(window->unbind(gimpl->fillScreenTextureVerticesBuffer));
+        JST_CHECK(window->unbind(gimpl->fillScreenIndicesBuffer));
+        JST_CHECK(window->unbind(gimpl->signalBuffer));
+        JST_CHECK(window->unbind(gimpl->signalUniformBuffer));
+
+        return Result::SUCCESS;
+    }
+
     JST_CHECK(window->unbind(gimpl->shapes));
 
     return Result::SUCCESS;
@@ -111,6 +340,9 @@ const Extent2D<U64>& Constellation<D, T>::viewSize(const Extent2D<U64>& viewSize
                 viewSize.y);
 
         config.viewSize = gimpl->surface->size();
+
+        // Points are sized in pixels.
+        gimpl->surface->update();
     }
     return this->viewSize();
 }
@@ -0,0 +1,162 @@
+#include "../generic.cc"
+
+namespace Jetstream {
+
+static const char shadersSrc[] = R"""(
+    #include <metal_stdlib>
+    #include <metal_compute>
+
+    using namespace metal;
+
+    struct Constants {
+        uint resolution;
+        uint numberOfPoints;
+        float decayFactor;
+        float hitWeight;
+    };
+
+    kernel void decay(constant Constants& constants [[ buffer(0) ]],
+                      device float *bins [[ buffer(1) ]],
+                      uint id[[ thread_position_in_grid ]]) {
+        bins[id] *= constants.decayFactor;
+    }
+
+    kernel void activate(constant Constants& constants [[ buffer(0) ]],
+                         constant const float2 *input [[ buffer(1) ]],
+                         device atomic_float *bins [[ buffer(2) ]],
+                         uint id[[ thread_position_in_grid ]]) {
+        const float scale = constants.resolution / 2.0f;
+        const float2 position = (input[id] + 1.0f) * scale;
+
+        if (position.x >= 0.0f && position.x < constants.resolution &&
+            position.y >= 0.0f && position.y < constants.resolution) {
+            const uint cell = uint(position.x) + uint(position.y) * constants.resolution;
+            atomic_fetch_add_explicit(&bins[cell], constants.hitWeight, memory_order_relaxed);
+        }
+    }
+)""";
+
+template<Device D, typename T>
+struct Constellation<D, T>::Impl {
+    struct Constants {
+        U32 resolution;
+        U32 numberOfPoints;
+        F32 decayFactor;
+        F32 hitWeight;
+    };
+
+    // Points of the frame, copied away from the input so upstream blocks
+    // can reuse it while the frame is read back.
+    Tensor<Device::Metal, T> points;
+
+    MTL::ComputePipelineState* stateDecay;
+    MTL::ComputePipelineState* stateActivate;
+    Tensor<Device::Metal, U8> constants;
+};
+
+template<Device D, typename T>
+Constellation<D, T>::Constellation() {
+    pimpl = std::make_unique<Impl>();
+    gimpl = std::make_unique<GImpl>();
+}
+
+template<Device D, typename T>
+Constellation<D, T>::~Constellation() {
+    pimpl.reset();
+    gimpl.reset();
+}
+
+template<Device D, typename T>
+Result Constellation<D, T>::createCompute(const Context&) {
+    JST_TRACE("Create Constellation compute core using Metal backend.");
+
+    if (input.buffer.size() == 0) {
+        JST_ERROR("Input buffer is empty in createCompute.");
+        return Result::ERROR;
+    }
+
+    if (config.enableDensity) {
+        JST_CHECK(Metal::CompileKernel(shadersSrc, "decay", &pimpl->stateDecay));
+        JST_CHECK(Metal::CompileKernel(shadersSrc, "activate", &pimpl->stateActivate));
+
+        auto* constants = Metal::CreateConstants<typename Impl::Constants>(*pimpl);
+        constants->resolution = config.resolution;
+        constants->numberOfPoints = gimpl->numberOfPoints;
+        constants->decayFactor = config.decay;
+        constants->hitWeight = gimpl->hitWeight;
+
+        return Result::SUCCESS;
+    }
+
+    pimpl->points = Tensor<Device::Metal, T>({input.buffer.size()});
+
+    gimpl->positionsSnapshot.forEach([&](auto& snapshot) {
+        snapshot.resize(input.buffer.size());
+    });
+
+    return Result::SUCCESS;
+}
+
+template<Device D, typename T>
+Result Constellation<D, T>::compute(const Context& ctx) {
+    if (config.enableDensity) {
+        // The histogram lives in unified memory and is read by present
+        // directly, so only the points are binned here.
+
+        {
+            auto cmdEncoder = ctx.metal->commandBuffer()->computeCommandEncoder();
+            cmdEncoder->setComputePipelineState(pimpl->stateDecay);
+            cmdEncoder->setBuffer(pimpl->constants.data(), 0, 0);
+            cmdEncoder->setBuffer(gimpl->densityBins.data(), 0, 1);
+
+            auto threadsPerThreadgroup = MTL::Size(pimpl->stateDecay->maxTotalThreadsPerThreadgroup(), 1, 1);
+            auto threadsPerGrid = MTL::Size(gimpl->densityBins.size(), 1, 1);
+            cmdEncoder->dispatchThreads(threadsPerGrid, threadsPerThreadgroup);
+
+            cmdEncoder->endEncoding();
+        }
+
+        {
+            auto cmdEncoder = ctx.metal->commandBuffer()->computeCommandEncoder();
+            cmdEncoder->setComputePipelineState(pimpl->stateActivate);
+            cmdEncoder->setBuffer(pimpl->constants.data(), 0, 0);
+            cmdEncoder->setBuffer(input.buffer.data(), input.buffer.offset_bytes(), 1);
+            cmdEncoder->setBuffer(gimpl->densityBins.data(), 0, 2);
+
+            auto threadsPerThreadgroup = MTL::Size(pimpl->stateActivate->maxTotalThreadsPerThreadgroup(), 1, 1);
+            auto threadsPerGrid = MTL::Size(gimpl->numberOfPoints, 1, 1);
+            cmdEncoder->dispatchThreads(threadsPerGrid, threadsPerThreadgroup);
+
+            cmdEncoder->endEncoding();
+        }
+
+        return Result::SUCCESS;
+    }
+
+    auto blitEncoder = ctx.metal->commandBuffer()->blitCommandEncoder();
+    blitEncoder->copyFromBuffer(input.buffer.data(), input.buffer.offset_bytes(),
+                                pimpl->points.data(), 0, input.buffer.size_bytes());
+    blitEncoder->endEncoding();
+
+    // Memory is unified, so the points are handed over to present as soon
+    // as the frame finishes without a copy back. Completion handlers of a
+    // queue run one at a time, so they stay the only producer.
+
+    ctx.metal->commandBuffer()->addCompletedHandler([this](MTL::CommandBuffer*) {
+        const auto& points = MapOn<Device::CPU>(pimpl->points);
+        auto& positions = gimpl->positionsSnapshot.back();
+
+        for (U64 i = 0; i < positions.size(); i++) {
+            positions[i] = { points[i].real(), points[i].imag() };
+        }
+
+        gimpl->positionsSnapshot.publish();
+    });
+
+    return Result::SUCCESS;
+}
+
+JST_CONSTELLATION_METAL(JST_INSTANTIATION)
+JST_CONSTELLATION_METAL(JST_BENCHMARK)
+
+}  // namespace Jetstream
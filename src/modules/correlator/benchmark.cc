@@ -0,0 +1,20 @@
+#include "jetstream/modules/correlator.hh"
+
+namespace Jetstream {
+
+template<template<Device, typename...> class Module, Device D, typename T>
+void benchmark(ankerl::nanobench::Bench& bench, std::string name) {
+    JST_BENCHMARK_RUN("4x8192", {
+        .channels = 1024 COMMA
+    }, {
+        .buffer = Tensor<D COMMA T>({4 COMMA 8192}) COMMA
+    }, T);
+
+    JST_BENCHMARK_RUN("16x8192", {
+        .channels = 1024 COMMA
+    }, {
+        .buffer = Tensor<D COMMA T>({16 COMMA 8192}) COMMA
+    }, T);
+}
+
+}  // namespace Jetstream
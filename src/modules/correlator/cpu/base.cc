@@ -0,0 +1,133 @@
+#include "../generic.cc"
+
+#include "jetstream/memory/devices/cpu/helpers.hh"
+#include "jetstream/backend/devices/cpu/simd.hh"
+
+// Same configuration as the FFT module, batches go to the CPU graph pool.
+#define POCKETFFT_NO_MULTITHREADING
+#include "../../fft/cpu/pocketfft.hh"
+
+namespace Jetstream {
+
+template<Device D, typename T>
+struct Correlator<D, T>::Impl {
+    U64 antennas = 0;
+    U64 frames = 0;
+    U64 baselines = 0;
+    U64 integrated = 0;
+
+    // Antennas of every baseline.
+    std::vector<std::pair<U64, U64>> pairs;
+
+    // Spectra of every frame, [antennas, frames, channels].
+    std::vector<CF32> spectra;
+    // Sums of the current integration, [baselines, channels].
+    std::vector<CF32> sums;
+
+    std::shared_ptr<pocketfft::detail::pocketfft_c<F32>> plan;
+};
+
+template<Device D, typename T>
+Correlator<D, T>::Correlator() {
+    impl = std::make_unique<Impl>();
+}
+
+template<Device D, typename T>
+Correlator<D, T>::~Correlator() {
+    impl.reset();
+}
+
+template<Device D, typename T>
+Result Correlator<D, T>::createCompute(const Context&) {
+    JST_TRACE("Create Correlator compute core using CPU backend.");
+
+    impl->pairs.clear();
+    for (U64 i = 0; i < impl->antennas; i++) {
+        for (U64 j = i; j < impl->antennas; j++) {
+            impl->pairs.push_back({i, j});
+        }
+    }
+
+    impl->spectra.resize(impl->antennas * impl->frames * config.channels);
+    impl->sums.assign(impl->baselines * config.channels, CF32(0.0f, 0.0f));
+    impl->plan = pocketfft::detail::get_plan<pocketfft::detail::pocketfft_c<F32>>(config.channels);
+
+    JST_TRACE("[CORRELATOR] Baselines: {}; Kernel: {};", impl->baselines, Backend::ComplexConjugateMultiplyAdd().name());
+
+    return Result::SUCCESS;
+}
+
+template<Device D, typename T>
+Result Correlator<D, T>::destroyCompute(const Context&) {
+    JST_TRACE("Destroy Correlator compute core using CPU backend.");
+
+    impl->plan.reset();
+    impl->spectra.clear();
+    impl->sums.clear();
+
+    return Result::SUCCESS;
+}
+
+template<Device D, typename T>
+Result Correlator<D, T>::compute(const Context& ctx) {
+    const U64 channels = config.channels;
+    const U64 frames = impl->frames;
+    const U64 frameCount = impl->antennas * frames;
+
+    const T* in = input.buffer.data() + input.buffer.offset();
+    CF32* spectra = impl->spectra.data();
+    CF32* sums = impl->sums.data();
+
+    const U64 chunks = input.buffer.size() / Memory::CPU::ParallelIteratorGrain;
+
+    // F stage, every frame of every antenna is transformed on its own.
+
+    Memory::CPU::ParallelRanges(ctx.cpu->pool(), frameCount, chunks, [&](const U64& begin, const U64& end) {
+        for (U64 f = begin; f < end; f++) {
+            CF32* spectrum = spectra + f * channels;
+            std::copy_n(in + f * channels, channels, spectrum);
+            impl->plan->exec(reinterpret_cast<pocketfft::detail::cmplx<F32>*>(spectrum), 1.0f, true);
+        }
+    });
+
+    // X stage, the spectra of every pair are cross multiplied and summed
+    // over the frames. Baselines are independent, so they're split across
+    // the pool.
+
+    if (impl->integrated == 0) {
+        std::fill(impl->sums.begin(), impl->sums.end(), CF32(0.0f, 0.0f));
+    }
+
+    const auto correlate = Backend::ComplexConjugateMultiplyAdd().kernel();
+    const U64 pairChunks = (impl->baselines * frames * channels) / Memory::CPU::ParallelIteratorGrain;
+
+    Memory::CPU::ParallelRanges(ctx.cpu->pool(), impl->baselines, pairChunks, [&](const U64& begin, const U64& end) {
+        for (U64 b = begin; b < end; b++) {
+            const auto& [i, j] = impl->pairs[b];
+            const CF32* x = spectra + i * frames * channels;
+            const CF32* y = spectra + j * frames * channels;
+
+            for (U64 f = 0; f < frames; f++) {
+                correlate(x + f * channels, y + f * channels, sums + b * channels, channels);
+            }
+        }
+    });
+
+    // Publish the average once the integration is complete. Consumers
+    // are skipped until then.
+
+    if (++impl->integrated < config.integration) {
+        return Result::YIELD;
+    }
+    impl->integrated = 0;
+
+    const CF32 scale(1.0f / static_cast<F32>(config.integration * frames), 0.0f);
+    Backend::ComplexScale().kernel()(sums, scale, output.visibilities.data(), impl->sums.size());
+
+    return Result::SUCCESS;
+}
+
+JST_CORRELATOR_CPU(JST_INSTANTIATION)
+JST_CORRELATOR_CPU(JST_BENCHMARK)
+
+}  // namespace Jetstream
@@ -0,0 +1,239 @@
+#include "../generic.cc"
+
+#include "jetstream/memory/devices/cuda/copy.hh"
+
+#include <cufft.h>
+
+namespace Jetstream {
+
+template<Device D, typename T>
+struct Correlator<D, T>::Impl {
+    U64 antennas = 0;
+    U64 frames = 0;
+    U64 baselines = 0;
+    U64 integrated = 0;
+
+    cufftHandle plan;
+
+    Tensor<Device::CUDA, T> input;
+    bool stage = false;
+
+    // Spectra of every frame, [antennas, frames, channels].
+    Tensor<Device::CUDA, T> spectra;
+    // Sums of the current integration, [baselines, channels].
+    Tensor<Device::CUDA, T> sums;
+
+    std::vector<U64> grid;
+    std::vector<U64> block;
+
+    struct Meta {
+        void* spectra;
+        void* sums;
+        void* visibilities;
+        size_t antennas;
+        size_t frames;
+        size_t channels;
+        size_t size;
+    };
+
+    Meta meta;
+    int first = 0;
+    int last = 0;
+    F32 scale = 0.0f;
+
+    std::vector<void*> arguments;
+};
+
+template<Device D, typename T>
+Correlator<D, T>::Correlator() {
+    impl = std::make_unique<Impl>();
+}
+
+template<Device D, typename T>
+Correlator<D, T>::~Correlator() {
+    impl.reset();
+}
+
+template<Device D, typename T>
+Result Correlator<D, T>::createCompute(const Context& ctx) {
+    JST_TRACE("Create Correlator compute core using CUDA backend.");
+
+    // Create CUDA kernel.
+    //
+    // Every thread sums one channel of one baseline over the frames. The
+    // antennas of the baseline are recovered from its index, rows of the
+    // upper triangle are walked until the index falls in one.
+
+    ctx.cuda->createKernel("correlate", R"""(
+        struct Meta {
+            void* spectra;
+            void* sums;
+            void* visibilities;
+            size_t antennas;
+            size_t frames;
+            size_t channels;
+            size_t size;
+        };
+
+        __global__ void correlate(Meta meta, int first, int last, float scale) {
+            const size_t id = blockIdx.x * blockDim.x + threadIdx.x;
+            if (id >= meta.size) {
+                return;
+            }
+
+            const size_t k = id % meta.channels;
+            size_t j = id / meta.channels;
+            size_t i = 0;
+
+            while (j >= meta.antennas - i) {
+                j -= meta.antennas - i;
+                i += 1;
+            }
+            j += i;
+
+            const float2* spectra = reinterpret_cast<const float2*>(meta.spectra);
+            const float2* x = spectra + i * meta.frames * meta.channels + k;
+            const float2* y = spectra + j * meta.frames * meta.channels + k;
+
+            float2 sum = first ? make_float2(0.0f, 0.0f) : reinterpret_cast<float2*>(meta.sums)[id];
+
+            for (size_t f = 0; f < meta.frames; f++) {
+                const float2 a = x[f * meta.channels];
+                const float2 b = y[f * meta.channels];
+                sum.x += a.x * b.x + a.y * b.y;
+                sum.y += a.y * b.x - a.x * b.y;
+            }
+
+            reinterpret_cast<float2*>(meta.sums)[id] = sum;
+
+            if (last) {
+                reinterpret_cast<float2*>(meta.visibilities)[id] = make_float2(sum.x * scale, sum.y * scale);
+            }
+        }
+    )""");
+
+    // Initialize kernel input.
+
+    impl->stage = !input.buffer.device_native();
+
+    if (impl->stage) {
+        impl->input = Tensor<Device::CUDA, T>(input.buffer.shape());
+    } else {
+        impl->input = input.buffer;
+    }
+
+    impl->spectra = Tensor<Device::CUDA, T>({impl->antennas, impl->frames, config.channels});
+    impl->sums = Tensor<Device::CUDA, T>({impl->baselines, config.channels});
+
+    // Create FFT plan, one transform per frame of every antenna.
+
+    JST_CUFFT_CHECK(cufftCreate(&impl->plan), [&](){
+        JST_FATAL("Failed to create cuFFT instance: {}", err);
+    });
+
+    int n[] = { static_cast<int>(config.channels) };
+    int inembed[] = { 0 };
+    int onembed[] = { 0 };
+    const int distance = static_cast<int>(config.channels);
+
+    JST_CUFFT_CHECK(cufftPlanMany(&impl->plan,
+                                  1,
+                                  n,
+                                  inembed,
+                                  1,
+                                  distance,
+                                  onembed,
+                                  1,
+                                  distance,
+                                  CUFFT_C2C,
+                                  impl->antennas * impl->frames), [&]{
+        JST_ERROR("Failed to create FFT plan: {}.", err);
+    });
+
+    JST_CUFFT_CHECK(cufftSetStream(impl->plan, ctx.cuda->stream()), [&](){
+        JST_FATAL("Failed to set cuFFT stream: {}", err);
+    });
+
+    // Initialize kernel size.
+
+    const U64 size = impl->baselines * config.channels;
+
+    impl->meta = {
+        impl->spectra.data(),
+        impl->sums.data(),
+        output.visibilities.data(),
+        impl->antennas,
+        impl->frames,
+        config.channels,
+        size,
+    };
+
+    U64 threadsPerBlock = 256;
+    U64 blocksPerGrid = (size + threadsPerBlock - 1) / threadsPerBlock;
+
+    impl->grid = { blocksPerGrid, 1, 1 };
+    impl->block = { threadsPerBlock, 1, 1 };
+
+    // Initialize kernel arguments.
+
+    impl->scale = 1.0f / static_cast<F32>(config.integration * impl->frames);
+
+    impl->arguments = {
+        &impl->meta,
+        &impl->first,
+        &impl->last,
+        &impl->scale,
+    };
+
+    return Result::SUCCESS;
+}
+
+template<Device D, typename T>
+Result Correlator<D, T>::destroyCompute(const Context&) {
+    JST_TRACE("Destroy Correlator compute core using CUDA backend.");
+
+    JST_CUFFT_CHECK(cufftDestroy(impl->plan), [&](){
+        JST_ERROR("Failed to destroy FFT plan: {}.", err);
+    });
+
+    return Result::SUCCESS;
+}
+
+template<Device D, typename T>
+Result Correlator<D, T>::compute(const Context& ctx) {
+    if (impl->stage) {
+        JST_CHECK(Memory::Copy(impl->input, input.buffer, ctx.cuda->stream()));
+    }
+
+    // F stage.
+
+    const auto samples = reinterpret_cast<cufftComplex*>(impl->input.data());
+    const auto spectra = reinterpret_cast<cufftComplex*>(impl->spectra.data());
+
+    JST_CUFFT_CHECK(cufftExecC2C(impl->plan, samples, spectra, CUFFT_FORWARD), [&](){
+        JST_ERROR("Failed to execute FFT: {}.", err);
+    });
+
+    // X stage. The last buffer of the integration writes the average and
+    // consumers are skipped until then.
+
+    impl->first = (impl->integrated == 0);
+    impl->last = (impl->integrated + 1 == config.integration);
+
+    JST_CHECK(ctx.cuda->launchKernel("correlate",
+                                     impl->grid,
+                                     impl->block,
+                                     impl->arguments.data()));
+
+    if (++impl->integrated < config.integration) {
+        return Result::YIELD;
+    }
+    impl->integrated = 0;
+
+    return Result::SUCCESS;
+}
+
+JST_CORRELATOR_CUDA(JST_INSTANTIATION)
+JST_CORRELATOR_CUDA(JST_BENCHMARK)
+
+}  // namespace Jetstream
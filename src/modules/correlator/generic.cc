@@ -0,0 +1,66 @@
+#include "jetstream/modules/correlator.hh"
+
+#include "benchmark.cc"
+
+namespace Jetstream {
+
+template<Device D, typename T>
+Result Correlator<D, T>::create() {
+    JST_DEBUG("Initializing Correlator module.");
+    JST_INIT_IO();
+
+    // Check parameters.
+
+    if (input.buffer.rank() != 2) {
+        JST_ERROR("Input should have the shape [antennas, samples].");
+        return Result::ERROR;
+    }
+
+    if (!input.buffer.contiguous()) {
+        JST_ERROR("Input buffer should be contiguous.");
+        return Result::ERROR;
+    }
+
+    if (config.channels < 2) {
+        JST_ERROR("Number of channels ({}) should be at least 2.", config.channels);
+        return Result::ERROR;
+    }
+
+    if ((input.buffer.shape()[1] % config.channels) != 0) {
+        JST_ERROR("Number of samples ({}) should be a multiple of the number of channels ({}).",
+                  input.buffer.shape()[1], config.channels);
+        return Result::ERROR;
+    }
+
+    if (config.integration == 0) {
+        JST_ERROR("Integration should be at least one buffer.");
+        return Result::ERROR;
+    }
+
+    // Calculate parameters.
+    //
+    // Every antenna is split in frames of one spectrum each. The pairs are
+    // correlated frame by frame and summed over all frames of the
+    // integration.
+
+    impl->antennas = input.buffer.shape()[0];
+    impl->frames = input.buffer.shape()[1] / config.channels;
+    impl->baselines = impl->antennas * (impl->antennas + 1) / 2;
+    impl->integrated = 0;
+
+    // Allocate output.
+
+    output.visibilities = Tensor<D, T>({impl->baselines, config.channels});
+
+    return Result::SUCCESS;
+}
+
+template<Device D, typename T>
+void Correlator<D, T>::info() const {
+    JST_DEBUG("  Channels:    {}", config.channels);
+    JST_DEBUG("  Integration: {}", config.integration);
+    JST_DEBUG("  Antennas:    {}", impl->antennas);
+    JST_DEBUG("  Baselines:   {}", impl->baselines);
+}
+
+}  // namespace Jetstream
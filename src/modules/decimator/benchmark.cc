@@ -0,0 +1,18 @@
+#include "jetstream/modules/decimator.hh"
+
+namespace Jetstream {
+
+template<template<Device, typename...> class Module, Device D, typename T>
+void benchmark(ankerl::nanobench::Bench& bench, std::string name) {
+    JST_BENCHMARK_RUN("8x8192 (1/4)", {}, {
+        .buffer = Tensor<D COMMA T>({8 COMMA 8192}) COMMA
+    }, T);
+
+    JST_BENCHMARK_RUN("8x8192 (1/16)", {
+        .ratio = 16 COMMA
+    }, {
+        .buffer = Tensor<D COMMA T>({8 COMMA 8192}) COMMA
+    }, T);
+}
+
+}  // namespace Jetstream
@@ -0,0 +1,96 @@
+#include "../generic.cc"
+
+#include "jetstream/memory/devices/cpu/helpers.hh"
+#include "jetstream/backend/devices/cpu/fir.hh"
+
+namespace Jetstream {
+
+template<Device D, typename T>
+struct Decimator<D, T>::Impl {
+    U64 outer = 1;
+    U64 inner = 1;
+    U64 axisSize = 0;
+    U64 outputSize = 0;
+
+    std::vector<F32> taps;
+
+    // One filter per lane along the axis, each keeping its own history.
+    std::vector<Backend::PolyphaseFir<T>> filters;
+};
+
+template<Device D, typename T>
+Decimator<D, T>::Decimator() {
+    impl = std::make_unique<Impl>();
+}
+
+template<Device D, typename T>
+Decimator<D, T>::~Decimator() {
+    impl.reset();
+}
+
+template<Device D, typename T>
+Result Decimator<D, T>::createCompute(const Context&) {
+    JST_TRACE("Create Decimator compute core using CPU backend.");
+
+    impl->filters.resize(impl->outer * impl->inner);
+    for (auto& filter : impl->filters) {
+        JST_CHECK(filter.configure(impl->taps.data(), impl->taps.size(), 1, config.ratio));
+    }
+
+    JST_TRACE("[DECIMATOR] Lanes: {}; Kernel: {};", impl->filters.size(), impl->filters.front().kernelName());
+
+    return Result::SUCCESS;
+}
+
+template<Device D, typename T>
+Result Decimator<D, T>::compute(const Context& ctx) {
+    const T* in = input.buffer.data() + input.buffer.offset();
+    T* out = output.buffer.data();
+
+    const U64 inner = impl->inner;
+    const U64 axisSize = impl->axisSize;
+    const U64 outputSize = impl->outputSize;
+
+    // Lanes are independent, only the kept outputs are computed. Lanes strided
+    // by inner dimensions are gathered first so the dot products stay contiguous.
+
+    const U64 chunks = (output.buffer.size() * impl->taps.size()) / Memory::CPU::ParallelIteratorGrain;
+
+    Memory::CPU::ParallelRanges(ctx.cpu->pool(), impl->filters.size(), chunks, [&](const U64& begin, const U64& end) {
+        std::vector<T> lane;
+        std::vector<T> decimated;
+
+        for (U64 l = begin; l < end; l++) {
+            const U64 o = l / inner;
+            const U64 i = l % inner;
+
+            const T* src = in + o * axisSize * inner + i;
+            T* dst = out + o * outputSize * inner + i;
+
+            if (inner == 1) {
+                impl->filters[l].process(src, axisSize, dst);
+                continue;
+            }
+
+            lane.resize(axisSize);
+            decimated.resize(outputSize);
+
+            for (U64 n = 0; n < axisSize; n++) {
+                lane[n] = src[n * inner];
+            }
+
+            impl->filters[l].process(lane.data(), axisSize, decimated.data());
+
+            for (U64 m = 0; m < outputSize; m++) {
+                dst[m * inner] = decimated[m];
+            }
+        }
+    });
+
+    return Result::SUCCESS;
+}
+
+JST_DECIMATOR_CPU(JST_INSTANTIATION)
+JST_DECIMATOR_CPU(JST_BENCHMARK)
+
+}  // namespace Jetstream
@@ -0,0 +1,98 @@
+#include "jetstream/modules/decimator.hh"
+
+#include "benchmark.cc"
+
+namespace Jetstream {
+
+// Blackman windowed sinc with the cutoff at the output Nyquist frequency and
+// unity gain at DC.
+inline std::vector<F32> DecimatorTaps(const U64& ratio, const U64& tapsPerPhase) {
+    if (ratio == 1) {
+        return {1.0f};
+    }
+
+    const U64 size = ratio * tapsPerPhase + 1;
+    const F64 cutoff = 0.5 / static_cast<F64>(ratio);
+    const F64 center = static_cast<F64>(size - 1) / 2.0;
+
+    std::vector<F64> window(size);
+    F64 sum = 0.0;
+
+    for (U64 i = 0; i < size; i++) {
+        const F64 x = 2.0 * cutoff * (static_cast<F64>(i) - center);
+        const F64 sinc = (x == 0.0) ? 1.0 : sin(JST_PI * x) / (JST_PI * x);
+        window[i] = sinc * (0.42 - 0.50 * cos(2.0 * JST_PI * i / (size - 1)) +
+                            0.08 * cos(4.0 * JST_PI * i / (size - 1)));
+        sum += window[i];
+    }
+
+    std::vector<F32> taps(size);
+    for (U64 i = 0; i < size; i++) {
+        taps[i] = static_cast<F32>(window[i] / sum);
+    }
+    return taps;
+}
+
+template<Device D, typename T>
+Result Decimator<D, T>::create() {
+    JST_DEBUG("Initializing Decimator module.");
+    JST_INIT_IO();
+
+    // Check parameters.
+
+    if (config.axis >= input.buffer.rank()) {
+        JST_ERROR("Decimation axis ({}) is out of range for a tensor of rank {}.",
+                  config.axis, input.buffer.rank());
+        return Result::ERROR;
+    }
+
+    if (config.ratio == 0) {
+        JST_ERROR("Decimation ratio should be positive.");
+        return Result::ERROR;
+    }
+
+    if (config.tapsPerPhase == 0) {
+        JST_ERROR("Number of taps per phase should be positive.");
+        return Result::ERROR;
+    }
+
+    const auto& shape = input.buffer.shape();
+
+    if ((shape[config.axis] % config.ratio) != 0) {
+        JST_ERROR("Axis size ({}) should be a multiple of the decimation ratio ({}).",
+                  shape[config.axis], config.ratio);
+        return Result::ERROR;
+    }
+
+    // Calculate parameters.
+
+    impl->outer = 1;
+    impl->inner = 1;
+    for (U64 i = 0; i < config.axis; i++) {
+        impl->outer *= shape[i];
+    }
+    for (U64 i = config.axis + 1; i < shape.size(); i++) {
+        impl->inner *= shape[i];
+    }
+    impl->axisSize = shape[config.axis];
+    impl->outputSize = impl->axisSize / config.ratio;
+    impl->taps = DecimatorTaps(config.ratio, config.tapsPerPhase);
+
+    // Allocate output.
+
+    auto outputShape = shape;
+    outputShape[config.axis] = impl->outputSize;
+    output.buffer = Tensor<D, T>(outputShape);
+
+    return Result::SUCCESS;
+}
+
+template<Device D, typename T>
+void Decimator<D, T>::info() const {
+    JST_DEBUG("  Axis:           {}", config.axis);
+    JST_DEBUG("  Ratio:          {}", config.ratio);
+    JST_DEBUG("  Taps Per Phase: {}", config.tapsPerPhase);
+    JST_DEBUG("  Taps:           {}", impl->taps.size());
+}
+
+}  // namespace Jetstream
@@ -9,6 +9,13 @@ void benchmark(ankerl::nanobench::Bench& bench, std::string name) {
         .buffer = Tensor<D COMMA IT>({128 COMMA 8000}) COMMA
     }, IT);
 
+    // Contiguous (Copy-on-Write)
+    JST_BENCHMARK_RUN("128x8000 (CoW)", {
+        .copyOnWrite = true COMMA
+    }, {
+        .buffer = Tensor<D COMMA IT>({128 COMMA 8000}) COMMA
+    }, IT);
+
     // Non-Contiguous
     {
         Tensor<D, IT> buffer({128, 16000});
@@ -1,11 +1,11 @@
 #include "../generic.cc"
 
-#include "jetstream/memory/devices/cpu/helpers.hh"
-
 namespace Jetstream {
 
 template<Device D, typename T>
 struct Duplicate<D, T>::Impl {
+    // Output buffer while it aliases the input memory.
+    std::shared_ptr<TensorBuffer<Device::CPU>> forwarded;
 };
 
 template<Device D, typename T>
@@ -26,18 +26,38 @@ Result Duplicate<D, T>::createCompute(const Context&) {
 }
 
 template<Device D, typename T>
-Result Duplicate<D, T>::compute(const Context&) {
-    if (input.buffer.contiguous()) {
-        Memory::Copy(output.buffer, input.buffer);
-    } else {
-        Memory::CPU::AutomaticIterator([](const auto& in, auto& out) {
-            out = in;
-        }, input.buffer, output.buffer);
+bool Duplicate<D, T>::computeForwarding() const {
+    return pimpl->forwarded != nullptr;
+}
+
+template<Device D, typename T>
+Result Duplicate<D, T>::computeMaterialize() {
+    if (!pimpl->forwarded) {
+        return Result::SUCCESS;
     }
 
+    JST_DEBUG("[DUPLICATE] Output is modified in-place. Copying the input from now on.");
+
+    JST_CHECK(pimpl->forwarded->unalias());
+    pimpl->forwarded.reset();
+
     return Result::SUCCESS;
 }
 
+template<Device D, typename T>
+Result Duplicate<D, T>::compute(const Context&) {
+    if (pimpl->forwarded) {
+        // Follow the input if its memory moved, like when an upstream copy is materialized.
+        T* source = input.buffer.data() + input.buffer.offset();
+        if (pimpl->forwarded->data() != source) {
+            JST_CHECK(pimpl->forwarded->alias(source));
+        }
+        return Result::SUCCESS;
+    }
+
+    return Memory::Copy(output.buffer, input.buffer);
+}
+
 JST_DUPLICATE_CPU(JST_INSTANTIATION)
 JST_DUPLICATE_CPU(JST_BENCHMARK)
 
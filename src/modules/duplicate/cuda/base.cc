@@ -164,6 +164,18 @@ Result Duplicate<D, T>::compute(const Context& ctx) {
     return Result::SUCCESS;
 }
 
+// Device memory is always copied, copy-on-write is only available on the CPU.
+
+template<Device D, typename T>
+bool Duplicate<D, T>::computeForwarding() const {
+    return false;
+}
+
+template<Device D, typename T>
+Result Duplicate<D, T>::computeMaterialize() {
+    return Result::SUCCESS;
+}
+
 JST_DUPLICATE_CUDA(JST_INSTANTIATION)
 JST_DUPLICATE_CUDA(JST_BENCHMARK)
 
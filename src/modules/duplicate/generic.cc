@@ -17,12 +17,23 @@ Result Duplicate<D, T>::create() {
         output.buffer = Tensor<D, T>(input.buffer.shape());
     }
 
+    // Share the input memory until it's modified in-place.
+
+    if constexpr (D == Device::CPU) {
+        if (config.copyOnWrite && input.buffer.contiguous()) {
+            const auto& clones = output.buffer.storage_metadata()->clones;
+            pimpl->forwarded = std::any_cast<std::shared_ptr<TensorBuffer<Device::CPU>>>(clones.at(Device::CPU));
+            JST_CHECK(pimpl->forwarded->alias(input.buffer.data() + input.buffer.offset()));
+        }
+    }
+
     return Result::SUCCESS;
 }
 
 template<Device D, typename T>
 void Duplicate<D, T>::info() const {
     JST_DEBUG("  Host Accessible: {}", config.hostAccessible);
+    JST_DEBUG("  Copy-on-Write: {}", config.copyOnWrite);
 }
 
 }  // namespace Jetstream
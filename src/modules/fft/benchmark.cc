@@ -1,20 +1,51 @@
+#include <cmath>
+
 #include "jetstream/modules/fft.hh"
 
 namespace Jetstream {
 
 template<template<Device, typename...> class Module, Device D, typename IT, typename OT>
 void benchmark(ankerl::nanobench::Bench& bench, std::string name) {
-    JST_BENCHMARK_RUN("128x8000 Forward", {
+    // Conventional radix-2 estimate of 5 N log2(N) per transform.
+    const F64 flops = 5.0 * std::log2(8000.0);
+
+    JST_BENCHMARK_RUN_FLOPS("128x8000 Forward", flops, {
         .forward = true COMMA
     }, {
         .buffer = Tensor<D COMMA IT>({128 COMMA 8000}) COMMA
     }, IT, OT);
 
-    JST_BENCHMARK_RUN("128x8000 Backward", {
+    JST_BENCHMARK_RUN_FLOPS("128x8000 Backward", flops, {
         .forward = false COMMA
     }, {
         .buffer = Tensor<D COMMA IT>({128 COMMA 8000}) COMMA
     }, IT, OT);
+
+    if constexpr (D == Device::CPU) {
+        JST_BENCHMARK_RUN_FLOPS("128x8000 Forward (pocketfft)", flops, {
+            .forward = true COMMA
+            .provider = "pocketfft" COMMA
+        }, {
+            .buffer = Tensor<D COMMA IT>({128 COMMA 8000}) COMMA
+        }, IT, OT);
+
+#ifdef JETSTREAM_LOADER_FFTW_AVAILABLE
+        JST_BENCHMARK_RUN_FLOPS("128x8000 Forward (FFTW)", flops, {
+            .forward = true COMMA
+            .provider = "fftw" COMMA
+        }, {
+            .buffer = Tensor<D COMMA IT>({128 COMMA 8000}) COMMA
+        }, IT, OT);
+#endif
+    }
+
+    JST_BENCHMARK_SWEEP(batch, size) {
+        JST_BENCHMARK_RUN_FLOPS(JST_BENCHMARK_SWEEP_NAME("Forward", batch, size), 5.0 * std::log2(size), {
+            .forward = true COMMA
+        }, {
+            .buffer = Tensor<D COMMA IT>({batch COMMA size}) COMMA
+        }, IT, OT);
+    }
 }
 
-}  // namespace Jetstream
\ No newline at end of file
+}  // namespace Jetstream
@@ -1,9 +1,18 @@
 #include "../generic.cc"
 
+#include "jetstream/memory/devices/cpu/helpers.hh"
+#include "jetstream/backend/devices/cpu/simd.hh"
+
 // Looks like Windows static build crashes if multitheading is enabled.
+// The pocketfft thread pool stays disabled and batches are split across
+// the worker pool of the CPU graph instead.
 #define POCKETFFT_NO_MULTITHREADING
 #include "pocketfft.hh"
 
+#ifdef JETSTREAM_LOADER_FFTW_AVAILABLE
+#include "fftw.hh"
+#endif
+
 namespace Jetstream {
 
 template<Device D, typename IT, typename OT>
@@ -13,6 +22,20 @@ struct FFT<D, IT, OT>::Impl {
     pocketfft::stride_t o_stride;
     pocketfft::shape_t axes;
 
+    // Batches are split along the outermost axis with more than one transform.
+    U64 splitAxis = 0;
+    U64 splitSize = 1;
+
+    // Plans are looked up once here and shared with other modules of the same
+    // length through the pocketfft cache. Holding them keeps recreated modules
+    // from planning again.
+    std::shared_ptr<pocketfft::detail::pocketfft_c<F32>> complexPlan;
+    std::shared_ptr<pocketfft::detail::pocketfft_r<F32>> realPlan;
+
+#ifdef JETSTREAM_LOADER_FFTW_AVAILABLE
+    fftwf_plan fftwPlan = nullptr;
+#endif
+
     U64 numberOfOperations = 0;
     U64 numberOfElements = 0;
     U64 elementStride = 0;
@@ -28,17 +51,204 @@ FFT<D, IT, OT>::~FFT() {
     pimpl.reset();
 }
 
+// Minimum number of elements per task when splitting a batch.
+static constexpr U64 ParallelGrain = 1 << 15;
+
+// CI16 inputs are scaled like the Cast module does by default.
+static constexpr F32 InputScaleI16 = 1.0f / 32768.0f;
+
+#ifdef JETSTREAM_LOADER_FFTW_AVAILABLE
+
+// Plans the batched transform over temporary buffers, so measuring doesn't
+// overwrite the tensors. Plans are executed later with the tensor pointers.
+template<typename IT, typename OT>
+static fftwf_plan CreateFftwPlan(const Tensor<Device::CPU, IT>& input,
+                                 const Tensor<Device::CPU, OT>& output,
+                                 const bool& forward) {
+    const U64 last_axis = input.rank() - 1;
+
+    const fftwf_iodim dim = {
+        static_cast<int>(input.shape()[last_axis]),
+        static_cast<int>(input.stride()[last_axis]),
+        static_cast<int>(output.stride()[last_axis]),
+    };
+
+    std::vector<fftwf_iodim> batch;
+    for (U64 i = 0; i < last_axis; i++) {
+        if (input.shape()[i] > 1) {
+            batch.push_back({
+                static_cast<int>(input.shape()[i]),
+                static_cast<int>(input.stride()[i]),
+                static_cast<int>(output.stride()[i]),
+            });
+        }
+    }
+
+    unsigned flags = FFTW_MEASURE;
+    if (fftwf_alignment_of(reinterpret_cast<F32*>(const_cast<IT*>(input.data()))) != 0 ||
+        fftwf_alignment_of(reinterpret_cast<F32*>(const_cast<OT*>(output.data()))) != 0) {
+        flags |= FFTW_UNALIGNED;
+    }
+
+    std::lock_guard<std::mutex> lock(FFTW::PlannerMutex());
+    FFTW::LoadWisdom();
+
+    IT* in = static_cast<IT*>(fftwf_malloc(input.size_bytes()));
+    OT* out = static_cast<OT*>(fftwf_malloc(output.size_bytes()));
+
+    fftwf_plan plan = nullptr;
+
+    if constexpr (std::is_same<IT, CF32>::value) {
+        plan = fftwf_plan_guru_dft(1, &dim, static_cast<int>(batch.size()), batch.data(),
+                                   reinterpret_cast<fftwf_complex*>(in),
+                                   reinterpret_cast<fftwf_complex*>(out),
+                                   (forward) ? FFTW_FORWARD : FFTW_BACKWARD, flags);
+    } else {
+        plan = fftwf_plan_guru_dft_r2c(1, &dim, static_cast<int>(batch.size()), batch.data(),
+                                       in, reinterpret_cast<fftwf_complex*>(out), flags);
+    }
+
+    fftwf_free(in);
+    fftwf_free(out);
+
+    if (plan) {
+        FFTW::SaveWisdom();
+    }
+
+    return plan;
+}
+
+#endif
+
+// FFTW real transforms are forward only and use another packing for real outputs.
+// Converted CI16 inputs are transformed in place, which is planned apart.
+template<typename IT, typename OT>
+static bool FftwSupported(const bool& forward) {
+    return std::is_same<IT, CF32>::value ||
+           (std::is_same<IT, F32>::value && std::is_same<OT, CF32>::value && forward);
+}
+
+// Provider requested by the configuration or the environment.
+static std::string RequestedProvider(const std::string& requested) {
+    if (requested == "auto") {
+        const char* env = std::getenv("JST_FFT_PROVIDER");
+        return (env && *env) ? env : "fftw";
+    }
+    return requested;
+}
+
+// Resolves the provider requested by the configuration or the environment.
+static std::string ResolveProvider(const std::string& requested, const bool& fftwSupported) {
+    const std::string provider = RequestedProvider(requested);
+
+    if (provider == "fftw") {
+#ifdef JETSTREAM_LOADER_FFTW_AVAILABLE
+        if (fftwSupported) {
+            return provider;
+        }
+        JST_DEBUG("[FFT] FFTW doesn't implement this transform. Using pocketfft.");
+#else
+        (void)fftwSupported;
+        if (requested == "fftw") {
+            JST_WARN("[FFT] Built without FFTW. Using pocketfft.");
+        }
+#endif
+        return "pocketfft";
+    }
+
+    if (provider != "pocketfft") {
+        JST_WARN("[FFT] Unknown FFT provider '{}'. Using pocketfft.", provider);
+    }
+
+    return "pocketfft";
+}
+
+// Rows are the transforms along the outermost axis with more than one, the
+// same split used for batches. FFTW plans the whole batch at once, so only
+// pocketfft transforms can be computed a few rows at a time.
+template<typename IT, typename OT>
+static Compute::Rows RowwiseBatch(const Tensor<Device::CPU, IT>& input,
+                                  const Tensor<Device::CPU, OT>& output,
+                                  const std::string& provider,
+                                  const bool& forward) {
+#ifdef JETSTREAM_LOADER_FFTW_AVAILABLE
+    if (FftwSupported<IT, OT>(forward) && RequestedProvider(provider) == "fftw") {
+        return {};
+    }
+#else
+    (void)provider;
+    (void)forward;
+#endif
+
+    if (input.rank() < 2 || !input.contiguous() || !output.contiguous()) {
+        return {};
+    }
+
+    for (U64 i = 0; i < input.rank() - 1; i++) {
+        if (input.shape()[i] > 1) {
+            return {
+                .count = input.shape()[i],
+                .size = input.size() / input.shape()[i],
+            };
+        }
+    }
+
+    return {};
+}
+
 template<Device D, typename IT, typename OT>
 Result FFT<D, IT, OT>::createCompute(const Context&) {
     JST_TRACE("Create FFT compute core using CPU backend.");
 
+    const auto provider = ResolveProvider(config.provider, FftwSupported<IT, OT>(config.forward));
+
+#ifdef JETSTREAM_LOADER_FFTW_AVAILABLE
+    if constexpr (std::is_same<OT, CF32>::value && !std::is_same<IT, CI16>::value) {
+        if (provider == "fftw") {
+            pimpl->fftwPlan = CreateFftwPlan(input.buffer, output.buffer, config.forward);
+
+            if (pimpl->fftwPlan) {
+                JST_DEBUG("[FFT] Using FFTW provider.");
+                return Result::SUCCESS;
+            }
+
+            JST_WARN("[FFT] FFTW can't plan this transform. Using pocketfft.");
+        }
+    }
+#endif
+
+    JST_DEBUG("[FFT] Using pocketfft provider.");
+
     for (U64 i = 0; i < input.buffer.rank(); ++i) {
         pimpl->shape.push_back(static_cast<U32>(input.buffer.shape()[i]));
         pimpl->i_stride.push_back(static_cast<U32>(input.buffer.stride()[i]) * sizeof(IT));
-        pimpl->o_stride.push_back(static_cast<U32>(input.buffer.stride()[i]) * sizeof(OT));
+        pimpl->o_stride.push_back(static_cast<U32>(output.buffer.stride()[i]) * sizeof(OT));
     }
 
-    pimpl->axes.push_back(output.buffer.rank() - 1);
+    // Converted inputs are read back from the output.
+    if constexpr (std::is_same<IT, CI16>::value) {
+        pimpl->i_stride = pimpl->o_stride;
+    }
+
+    const U64 last_axis = output.buffer.rank() - 1;
+    pimpl->axes.push_back(last_axis);
+
+    pimpl->splitAxis = 0;
+    pimpl->splitSize = 1;
+    for (U64 i = 0; i < last_axis; i++) {
+        if (pimpl->shape[i] > 1) {
+            pimpl->splitAxis = i;
+            pimpl->splitSize = pimpl->shape[i];
+            break;
+        }
+    }
+
+    const U64 length = pimpl->shape[last_axis];
+    if constexpr (std::is_same<IT, CF32>::value || std::is_same<IT, CI16>::value) {
+        pimpl->complexPlan = pocketfft::detail::get_plan<pocketfft::detail::pocketfft_c<F32>>(length);
+    } else {
+        pimpl->realPlan = pocketfft::detail::get_plan<pocketfft::detail::pocketfft_r<F32>>(length);
+    }
 
     return Result::SUCCESS;
 }
@@ -52,52 +262,198 @@ Result FFT<D, IT, OT>::destroyCompute(const Context&) {
     pimpl->o_stride.clear();
     pimpl->axes.clear();
 
+    pimpl->complexPlan.reset();
+    pimpl->realPlan.reset();
+
+#ifdef JETSTREAM_LOADER_FFTW_AVAILABLE
+    if (pimpl->fftwPlan) {
+        std::lock_guard<std::mutex> lock(FFTW::PlannerMutex());
+        fftwf_destroy_plan(pimpl->fftwPlan);
+        pimpl->fftwPlan = nullptr;
+    }
+#endif
+
+    return Result::SUCCESS;
+}
+
+// Batches are split across the worker pool and every task transforms its rows.
+
+template<>
+Result FFT<Device::CPU, CF32, CF32>::computeRows(const Context&, const U64& offset, const U64& count) {
+    auto shape = pimpl->shape;
+    if (count != pimpl->splitSize) {
+        shape[pimpl->splitAxis] = count;
+    }
+
+    pocketfft::c2c(shape,
+                   pimpl->i_stride,
+                   pimpl->o_stride,
+                   pimpl->axes,
+                   config.forward,
+                   input.buffer.data() + offset * input.buffer.stride()[pimpl->splitAxis],
+                   output.buffer.data() + offset * output.buffer.stride()[pimpl->splitAxis],
+                   1.0f);
+
     return Result::SUCCESS;
 }
 
 template<>
-Result FFT<Device::CPU, CF32, CF32>::compute(const Context&) {
-    pocketfft::c2c(pimpl->shape,
+Result FFT<Device::CPU, CF32, CF32>::compute(const Context& ctx) {
+#ifdef JETSTREAM_LOADER_FFTW_AVAILABLE
+    if (pimpl->fftwPlan) {
+        fftwf_execute_dft(pimpl->fftwPlan,
+                          reinterpret_cast<fftwf_complex*>(input.buffer.data()),
+                          reinterpret_cast<fftwf_complex*>(output.buffer.data()));
+        return Result::SUCCESS;
+    }
+#endif
+
+    const U64 chunks = input.buffer.size() / ParallelGrain;
+
+    Memory::CPU::ParallelRanges(ctx.cpu->pool(), pimpl->splitSize, chunks, [&](const U64& begin, const U64& end) {
+        computeRows(ctx, begin, end - begin);
+    });
+
+    return Result::SUCCESS;
+}
+
+// Every task converts its rows into the output and transforms them in
+// place while they're still in cache. No CF32 copy of the input is kept.
+template<>
+Result FFT<Device::CPU, CI16, CF32>::computeRows(const Context&, const U64& offset, const U64& count) {
+    auto shape = pimpl->shape;
+    if (count != pimpl->splitSize) {
+        shape[pimpl->splitAxis] = count;
+    }
+
+    const U64 span = output.buffer.size() / pimpl->splitSize;
+    CF32* data = output.buffer.data() + offset * span;
+
+    // Non-contiguous inputs are converted by `compute` beforehand.
+    if (input.buffer.contiguous()) {
+        const I16* in = reinterpret_cast<const I16*>(input.buffer.data() + input.buffer.offset());
+        Backend::ConvertI16().kernel()(in + 2 * offset * span, reinterpret_cast<F32*>(data), 2 * count * span, InputScaleI16);
+    }
+
+    pocketfft::c2c(shape,
                    pimpl->i_stride,
                    pimpl->o_stride,
                    pimpl->axes,
                    config.forward,
-                   input.buffer.data(),
-                   output.buffer.data(),
+                   data,
+                   data,
                    1.0f);
 
     return Result::SUCCESS;
 }
 
 template<>
-Result FFT<Device::CPU, F32, CF32>::compute(const Context&) {
-    pocketfft::r2c(pimpl->shape,
+Result FFT<Device::CPU, CI16, CF32>::compute(const Context& ctx) {
+    if (!input.buffer.contiguous()) {
+        Memory::CPU::AutomaticIterator([&](const auto& in, auto& out) {
+            out = CF32(in.real() * InputScaleI16, in.imag() * InputScaleI16);
+        }, input.buffer, output.buffer);
+    }
+
+    const U64 chunks = input.buffer.size() / ParallelGrain;
+
+    Memory::CPU::ParallelRanges(ctx.cpu->pool(), pimpl->splitSize, chunks, [&](const U64& begin, const U64& end) {
+        computeRows(ctx, begin, end - begin);
+    });
+
+    return Result::SUCCESS;
+}
+
+template<>
+Result FFT<Device::CPU, F32, CF32>::computeRows(const Context&, const U64& offset, const U64& count) {
+    auto shape = pimpl->shape;
+    if (count != pimpl->splitSize) {
+        shape[pimpl->splitAxis] = count;
+    }
+
+    pocketfft::r2c(shape,
                    pimpl->i_stride,
                    pimpl->o_stride,
                    pimpl->axes,
                    config.forward,
-                   input.buffer.data(),
-                   output.buffer.data(),
+                   input.buffer.data() + offset * input.buffer.stride()[pimpl->splitAxis],
+                   output.buffer.data() + offset * output.buffer.stride()[pimpl->splitAxis],
                    1.0f);
 
     return Result::SUCCESS;
 }
 
 template<>
-Result FFT<Device::CPU, F32, F32>::compute(const Context&) {
-    pocketfft::r2r_fftpack(pimpl->shape,
+Result FFT<Device::CPU, F32, CF32>::compute(const Context& ctx) {
+#ifdef JETSTREAM_LOADER_FFTW_AVAILABLE
+    if (pimpl->fftwPlan) {
+        fftwf_execute_dft_r2c(pimpl->fftwPlan,
+                              input.buffer.data(),
+                              reinterpret_cast<fftwf_complex*>(output.buffer.data()));
+        return Result::SUCCESS;
+    }
+#endif
+
+    const U64 chunks = input.buffer.size() / ParallelGrain;
+
+    Memory::CPU::ParallelRanges(ctx.cpu->pool(), pimpl->splitSize, chunks, [&](const U64& begin, const U64& end) {
+        computeRows(ctx, begin, end - begin);
+    });
+
+    return Result::SUCCESS;
+}
+
+template<>
+Result FFT<Device::CPU, F32, F32>::computeRows(const Context&, const U64& offset, const U64& count) {
+    auto shape = pimpl->shape;
+    if (count != pimpl->splitSize) {
+        shape[pimpl->splitAxis] = count;
+    }
+
+    pocketfft::r2r_fftpack(shape,
                            pimpl->i_stride,
                            pimpl->o_stride,
                            pimpl->axes,
                            true,  // real2hermitian
                            config.forward,
-                           input.buffer.data(),
-                           output.buffer.data(),
+                           input.buffer.data() + offset * input.buffer.stride()[pimpl->splitAxis],
+                           output.buffer.data() + offset * output.buffer.stride()[pimpl->splitAxis],
                            1.0f);
 
     return Result::SUCCESS;
 }
 
+template<>
+Result FFT<Device::CPU, F32, F32>::compute(const Context& ctx) {
+    const U64 chunks = input.buffer.size() / ParallelGrain;
+
+    Memory::CPU::ParallelRanges(ctx.cpu->pool(), pimpl->splitSize, chunks, [&](const U64& begin, const U64& end) {
+        computeRows(ctx, begin, end - begin);
+    });
+
+    return Result::SUCCESS;
+}
+
+template<>
+Compute::Rows FFT<Device::CPU, CF32, CF32>::computeRowwise() const {
+    return RowwiseBatch(input.buffer, output.buffer, config.provider, config.forward);
+}
+
+template<>
+Compute::Rows FFT<Device::CPU, CI16, CF32>::computeRowwise() const {
+    return RowwiseBatch(input.buffer, output.buffer, config.provider, config.forward);
+}
+
+template<>
+Compute::Rows FFT<Device::CPU, F32, CF32>::computeRowwise() const {
+    return RowwiseBatch(input.buffer, output.buffer, config.provider, config.forward);
+}
+
+template<>
+Compute::Rows FFT<Device::CPU, F32, F32>::computeRowwise() const {
+    return RowwiseBatch(input.buffer, output.buffer, config.provider, config.forward);
+}
+
 JST_FFT_CPU(JST_INSTANTIATION)
 JST_FFT_CPU(JST_BENCHMARK)
 
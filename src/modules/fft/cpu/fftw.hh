@@ -0,0 +1,87 @@
+#ifndef JETSTREAM_MODULES_FFT_CPU_FFTW_HH
+#define JETSTREAM_MODULES_FFT_CPU_FFTW_HH
+
+#include <mutex>
+#include <string>
+#include <cstdlib>
+#include <filesystem>
+
+#include <fftw3.h>
+
+#include "jetstream/logger.hh"
+#include "jetstream/types.hh"
+
+namespace Jetstream::FFTW {
+
+// The FFTW planner and wisdom aren't thread-safe. Executing plans is.
+inline std::mutex& PlannerMutex() {
+    static std::mutex mutex;
+    return mutex;
+}
+
+// Wisdom is kept in the user cache directory unless JST_FFTW_WISDOM says
+// otherwise. An empty variable disables persistence.
+inline std::string WisdomPath() {
+    if (const char* path = std::getenv("JST_FFTW_WISDOM")) {
+        return path;
+    }
+
+#if defined(JST_OS_WINDOWS)
+    if (const char* base = std::getenv("LOCALAPPDATA")) {
+        return (std::filesystem::path(base) / "CyberEther" / "fftw_wisdom").string();
+    }
+#elif defined(JST_OS_MAC) || defined(JST_OS_IOS)
+    if (const char* home = std::getenv("HOME")) {
+        return (std::filesystem::path(home) / "Library" / "Caches" / "CyberEther" / "fftw_wisdom").string();
+    }
+#else
+    if (const char* base = std::getenv("XDG_CACHE_HOME"); base && *base) {
+        return (std::filesystem::path(base) / "cyberether" / "fftw_wisdom").string();
+    }
+    if (const char* home = std::getenv("HOME")) {
+        return (std::filesystem::path(home) / ".cache" / "cyberether" / "fftw_wisdom").string();
+    }
+#endif
+
+    return "";
+}
+
+// Expects the planner mutex to be held.
+inline void LoadWisdom() {
+    static bool loaded = false;
+    if (loaded) {
+        return;
+    }
+    loaded = true;
+
+    const auto path = WisdomPath();
+    if (path.empty() || !std::filesystem::exists(path)) {
+        return;
+    }
+
+    if (fftwf_import_wisdom_from_filename(path.c_str()) == 0) {
+        JST_WARN("[FFT] Ignoring unreadable FFTW wisdom at '{}'.", path);
+        return;
+    }
+
+    JST_DEBUG("[FFT] Loaded FFTW wisdom from '{}'.", path);
+}
+
+// Expects the planner mutex to be held.
+inline void SaveWisdom() {
+    const auto path = WisdomPath();
+    if (path.empty()) {
+        return;
+    }
+
+    std::error_code ec;
+    std::filesystem::create_directories(std::filesystem::path(path).parent_path(), ec);
+
+    if (fftwf_export_wisdom_to_filename(path.c_str()) == 0) {
+        JST_WARN("[FFT] Can't store FFTW wisdom at '{}'.", path);
+    }
+}
+
+}  // namespace Jetstream::FFTW
+
+#endif
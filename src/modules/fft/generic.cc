@@ -30,7 +30,12 @@ Result FFT<D, IT, OT>::create() {
 
     // Allocate output.
 
-    output.buffer = Tensor<D, OT>(input.buffer.shape());
+    // Skip zero-filling CPU memory fully written by the first compute.
+    if constexpr (D == Device::CPU) {
+        output.buffer = Tensor<D, OT>(input.buffer.shape(), false);
+    } else {
+        output.buffer = Tensor<D, OT>(input.buffer.shape());
+    }
 
     return Result::SUCCESS;
 }
@@ -38,6 +43,20 @@ Result FFT<D, IT, OT>::create() {
 template<Device D, typename IT, typename OT>
 void FFT<D, IT, OT>::info() const {
     JST_DEBUG("  Forward: {}", config.forward ? "YES" : "NO");
+    if constexpr (D == Device::CPU) {
+        JST_DEBUG("  Provider: {}", config.provider);
+    }
+}
+
+template<Device D, typename IT, typename OT>
+Compute::Rows FFT<D, IT, OT>::computeRowwise() const {
+    return {};
+}
+
+template<Device D, typename IT, typename OT>
+Result FFT<D, IT, OT>::computeRows(const Context&, const U64&, const U64&) {
+    JST_ERROR("FFT can't compute rows on the {} backend.", D);
+    return Result::ERROR;
 }
 
 }  // namespace Jetstream
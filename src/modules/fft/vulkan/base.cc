@@ -0,0 +1,127 @@
+#include "../generic.cc"
+
+#include "jetstream/backend/devices/vulkan/helpers.hh"
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-but-set-variable"
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#define VKFFT_BACKEND 0
+#include "../metal/vkFFT.h"
+#pragma GCC diagnostic pop
+
+namespace Jetstream {
+
+template<Device D, typename IT, typename OT>
+struct FFT<D, IT, OT>::Impl {
+    VkFFTApplication* app = nullptr;
+    VkFFTConfiguration* configuration = nullptr;
+
+    VkBuffer input;
+    VkBuffer output;
+    U64 inputSize;
+    U64 outputSize;
+
+    U64 numberOfOperations = 0;
+    U64 numberOfElements = 0;
+    U64 elementStride = 0;
+};
+
+template<Device D, typename IT, typename OT>
+FFT<D, IT, OT>::FFT() {
+    pimpl = std::make_unique<Impl>();
+}
+
+template<Device D, typename IT, typename OT>
+FFT<D, IT, OT>::~FFT() {
+    pimpl.reset();
+}
+
+template<Device D, typename IT, typename OT>
+Result FFT<D, IT, OT>::createCompute(const Context&) {
+    JST_TRACE("Create FFT compute core using Vulkan backend.");
+
+    auto& backend = Backend::State<Device::Vulkan>();
+
+    // Assign buffers to module assets.
+
+    pimpl->input = input.buffer.data();
+    pimpl->output = output.buffer.data();
+    pimpl->inputSize = input.buffer.size_bytes();
+    pimpl->outputSize = output.buffer.size_bytes();
+
+    // Create VkFFT instance.
+
+    pimpl->app = new VkFFTApplication({});
+    pimpl->configuration = new VkFFTConfiguration({});
+
+    pimpl->configuration->FFTdim = 1;
+    pimpl->configuration->size[0] = pimpl->numberOfElements;
+    pimpl->configuration->device = &backend->getDevice();
+    pimpl->configuration->physicalDevice = &backend->getPhysicalDevice();
+    pimpl->configuration->queue = &backend->getComputeQueue();
+    pimpl->configuration->commandPool = &backend->getDefaultCommandPool();
+    pimpl->configuration->fence = &backend->getDefaultFence();
+    pimpl->configuration->doublePrecision = false;
+    pimpl->configuration->numberBatches = pimpl->numberOfOperations;
+    pimpl->configuration->isInputFormatted = 1;
+    pimpl->configuration->inputBufferSize = &pimpl->inputSize;
+    pimpl->configuration->inputBuffer = &pimpl->input;
+    pimpl->configuration->bufferSize = &pimpl->outputSize;
+    pimpl->configuration->buffer = &pimpl->output;
+
+    // Plan initialization submits work with the default command pool and fence.
+
+    VkFFTResult res;
+    {
+        std::lock_guard<std::mutex> lock(Backend::QueueMutex());
+        res = initializeVkFFT(pimpl->app, *pimpl->configuration);
+    }
+
+    if (res != VKFFT_SUCCESS) {
+        JST_ERROR("Failed to initialize VkFFT: {}", static_cast<int>(res));
+        return Result::ERROR;
+    }
+
+    return Result::SUCCESS;
+}
+
+template<Device D, typename IT, typename OT>
+Result FFT<D, IT, OT>::destroyCompute(const Context&) {
+    JST_TRACE("Destroy FFT compute core using Vulkan backend.");
+
+    if (!pimpl->app) {
+        return Result::SUCCESS;
+    }
+
+    deleteVkFFT(pimpl->app);
+    delete pimpl->configuration;
+    delete pimpl->app;
+
+    pimpl->app = nullptr;
+    pimpl->configuration = nullptr;
+
+    return Result::SUCCESS;
+}
+
+template<Device D, typename IT, typename OT>
+Result FFT<D, IT, OT>::compute(const Context& ctx) {
+    VkFFTLaunchParams launchParams = {};
+    launchParams.commandBuffer = &ctx.vulkan->commandBuffer();
+
+    const int inverse = static_cast<int>(!config.forward);
+
+    if (auto res = VkFFTAppend(pimpl->app, inverse, &launchParams); res != VKFFT_SUCCESS) {
+        JST_ERROR("Failed to append to VkFFT: {}", static_cast<int>(res));
+        return Result::ERROR;
+    }
+
+    return Result::SUCCESS;
+}
+
+JST_FFT_VULKAN(JST_INSTANTIATION)
+JST_FFT_VULKAN(JST_BENCHMARK)
+
+}  // namespace Jetstream
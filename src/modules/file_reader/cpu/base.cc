@@ -35,23 +35,77 @@ Result FileReader<D, T>::destroyCompute(const Context&) {
 template<Device D, typename T>
 Result FileReader<D, T>::compute(const Context&) {
     if (config.playing) {
+        if (const U64 sample = gimpl->pendingSeek.exchange(GImpl::NoSeek); sample != GImpl::NoSeek) {
+            JST_CHECK(gimpl->applySeek(*this, sample));
+        }
+
+        if (gimpl->pacing && std::chrono::steady_clock::now() < gimpl->deadline()) {
+            return Result::YIELD;
+        }
+
         const U64 bytesToRead = output.buffer.size_bytes();
-        const U64 remainingBytes = gimpl->fileSize - gimpl->currentPosition;
+        auto* data = reinterpret_cast<char*>(output.buffer.data());
 
-        if (remainingBytes == 0) {
-            if (config.loop) {
-                gimpl->dataFile.seekg(0, std::ios::beg);
-                gimpl->currentPosition = 0;
-            } else {
+        U64 bytesRead = 0;
+
+        if (gimpl->prefetching()) {
+            // Take the next output from the read-ahead ring. Only the last
+            // one of a file that isn't looping can be partial.
+            const U64 available = std::min(gimpl->prefetch.getOccupancy(), output.buffer.size());
+
+            if (available == 0 || (available < output.buffer.size() && !gimpl->finished)) {
                 return Result::YIELD;
             }
+
+            gimpl->prefetch.get(output.buffer.data(), available);
+            gimpl->readerCondition.notify_one();
+
+            bytesRead = available * sizeof(T);
+        } else {
+            if (gimpl->fileSize == gimpl->currentPosition && !config.loop) {
+                return Result::YIELD;
+            }
+
+            // Fill every frame of the batch, wrapping around when looping.
+            bytesRead = gimpl->fill(data, bytesToRead, config.loop);
+        }
+
+        // Don't hand stale frames of a partial batch downstream.
+        if (bytesRead < bytesToRead && config.batchSize > 1) {
+            std::fill(data + bytesRead, data + bytesToRead, 0);
         }
 
-        const U64 actualBytesToRead = std::min(bytesToRead, remainingBytes);
+        if (config.fileFormat == FileFormatType::SigMF) {
+            gimpl->tag(output.buffer);
+        }
+
+        gimpl->advance(bytesRead / sizeof(T));
+    }
+
+    return Result::SUCCESS;
+}
+
+template<Device D, typename T>
+Result FileReader<D, T>::computeReady() {
+    // Seeks are applied by the compute.
+    if (gimpl->pendingSeek != GImpl::NoSeek) {
+        return Result::SUCCESS;
+    }
+
+    // Real-time outputs wait for their deadline.
+    if (gimpl->pacing) {
+        const auto deadline = gimpl->deadline();
+        if (std::chrono::steady_clock::now() < deadline) {
+            notifyComputeAt(deadline);
+            return Result::TIMEOUT;
+        }
+    }
 
-        // Read data from file
-        gimpl->dataFile.read(reinterpret_cast<char*>(output.buffer.data()), actualBytesToRead);
-        gimpl->currentPosition += gimpl->dataFile.gcount();
+    // The reader notifies the scheduler once a whole output is buffered.
+    if (gimpl->prefetching() &&
+        !gimpl->finished &&
+        gimpl->prefetch.getOccupancy() < output.buffer.size()) {
+        return Result::TIMEOUT;
     }
 
     return Result::SUCCESS;
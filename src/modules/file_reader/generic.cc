@@ -1,8 +1,31 @@
+#include <algorithm>
 #include <regex>
+#include <thread>
+#include <atomic>
 #include <filesystem>
+#include <chrono>
+#include <limits>
 #include <fstream>
+#include <condition_variable>
 
 #include "jetstream/modules/file_reader.hh"
+#include "jetstream/compute/thread.hh"
+#include "jetstream/memory/utils/circular_buffer.hh"
+
+#if defined(JST_OS_LINUX) || defined(JST_OS_ANDROID) || defined(JST_OS_MAC) || defined(JST_OS_IOS)
+#define JST_FILE_READER_MAPPED
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#endif
+
+#ifdef JETSTREAM_LOADER_JSON_AVAILABLE
+#include <nlohmann/json.hpp>
+#endif
+
+#ifdef JETSTREAM_LOADER_ZSTD_AVAILABLE
+#include <zstd.h>
+#endif
 
 // TODO: Correctly separate Device implementations.
 
@@ -13,11 +36,101 @@ struct FileReader<D, T>::GImpl {
     std::ifstream dataFile;
     std::filesystem::path filePath;
     U64 fileSize;
-    U64 currentPosition;
+    // Size of the file on disk, larger than the samples of compressed files.
+    U64 storedSize;
+    std::atomic<U64> currentPosition;
+
+    // Read-only mapping of the whole file when the platform supports it.
+    // Frames are copied from the page cache without a read call, and the
+    // kernel is asked to read ahead of the playback position.
+    const char* mapping = nullptr;
 
     Result startPlaying(FileReader<D, T>& m);
     Result stopPlaying();
 
+    Result mapFile();
+    void unmapFile();
+
+    // Reads up to `size` bytes at the current position.
+    U64 read(char* data, const U64& size);
+    // Reads up to `size` bytes of the file on disk at `offset`.
+    U64 readStored(char* data, const U64& offset, const U64& size);
+    void rewind();
+
+    // Reads up to `size` bytes, wrapping around the end when looping.
+    U64 fill(char* data, const U64& size, const bool& loop);
+
+    // Outputs read ahead by a background thread, so the compute thread
+    // doesn't wait on the storage.
+    Memory::CircularBuffer<T> prefetch;
+    std::thread reader;
+    std::atomic<bool> reading = false;
+    std::atomic<bool> finished = false;
+    std::mutex readerMutex;
+    std::condition_variable readerCondition;
+
+    Result startReader(FileReader<D, T>& m);
+    void stopReader();
+
+    // Description of SigMF recordings. Outputs are tagged with the sample
+    // rate and the frequency of the capture they were read from.
+    struct Capture {
+        U64 sampleStart;
+        F32 frequency;
+    };
+
+    F32 sampleRate = 0.0f;
+    std::vector<Capture> captures;
+
+    Result readMeta(const std::string& filepath);
+
+    // Compressed recordings are decompressed a chunk at a time. Positions and
+    // sizes are those of the decompressed samples, so seeking and looping
+    // work like with raw files. Every chunk but the last is full, so the
+    // index only needs the offset of each one.
+    static constexpr U64 NoChunk = std::numeric_limits<U64>::max();
+    bool compressed = false;
+    std::vector<U64> chunkOffsets;
+    U64 cachedChunk = NoChunk;
+    std::vector<T> cache;
+    std::vector<U8> packed;
+    std::vector<I16> quantized;
+#ifdef JETSTREAM_LOADER_ZSTD_AVAILABLE
+    ZSTD_DCtx* decompressor = nullptr;
+#endif
+
+    Result readIndex();
+    Result loadChunk(const U64& index);
+    U64 readCompressed(char* data, const U64& size);
+    void tag(Tensor<D, T>& buffer);
+
+    // Index of the first sample of the next output. The reader thread may be
+    // ahead of it, so it's tracked apart from the file position.
+    std::atomic<U64> playbackSample = 0;
+    void advance(const U64& samples);
+
+    // Seeks come from the interface and are applied on the compute thread,
+    // which owns the file position and the read-ahead ring.
+    static constexpr U64 NoSeek = std::numeric_limits<U64>::max();
+    std::atomic<U64> pendingSeek = NoSeek;
+    Result applySeek(FileReader<D, T>& m, const U64& sample);
+
+    // Real-time pacing. Outputs are due once the samples before them would
+    // have been received at the sample rate.
+    F32 playbackRate = 0.0f;
+    bool pacing = false;
+    std::chrono::steady_clock::time_point paceOrigin;
+    U64 pacedSamples = 0;
+
+    std::chrono::steady_clock::time_point deadline() const {
+        const std::chrono::duration<F64> offset(static_cast<F64>(pacedSamples) / playbackRate);
+        return paceOrigin + std::chrono::duration_cast<std::chrono::steady_clock::duration>(offset);
+    }
+
+    bool prefetching() const {
+        return reader.joinable();
+    }
+
     Result underlyingStartPlaying();
     Result underlyingStopPlaying();
 };
@@ -84,21 +197,111 @@ U64 FileReader<D, T>::getCurrentPosition() const {
     return gimpl->currentPosition;
 }
 
+template<Device D, typename T>
+Result FileReader<D, T>::seek(const U64& sample) {
+    if (!config.playing) {
+        JST_ERROR("Can't seek while not playing.");
+        return Result::ERROR;
+    }
+
+    gimpl->pendingSeek = std::min(sample, getNumberOfSamples());
+    notifyCompute();
+
+    return Result::SUCCESS;
+}
+
+template<Device D, typename T>
+Result FileReader<D, T>::seekTime(const F64& seconds) {
+    if (gimpl->playbackRate <= 0.0f) {
+        JST_ERROR("Can't seek by time without a sample rate.");
+        return Result::ERROR;
+    }
+
+    return seek(static_cast<U64>(std::max(0.0, seconds) * gimpl->playbackRate));
+}
+
+template<Device D, typename T>
+Result FileReader<D, T>::seekCapture(const U64& index) {
+    if (index >= gimpl->captures.size()) {
+        JST_ERROR("Capture {} doesn't exist. The recording has {} captures.", index, gimpl->captures.size());
+        return Result::ERROR;
+    }
+
+    return seek(gimpl->captures[index].sampleStart);
+}
+
+template<Device D, typename T>
+U64 FileReader<D, T>::getCurrentSample() const {
+    return gimpl->playbackSample;
+}
+
+template<Device D, typename T>
+U64 FileReader<D, T>::getNumberOfSamples() const {
+    return gimpl->fileSize / sizeof(T);
+}
+
+template<Device D, typename T>
+U64 FileReader<D, T>::getNumberOfCaptures() const {
+    return gimpl->captures.size();
+}
+
+template<Device D, typename T>
+F32 FileReader<D, T>::getSampleRate() const {
+    return gimpl->playbackRate;
+}
+
+template<Device D, typename T>
+U64 FileReader<D, T>::getReadAheadOccupancy() const {
+    if (!gimpl->prefetching() || output.buffer.size() == 0) {
+        return 0;
+    }
+    return gimpl->prefetch.getOccupancy() / output.buffer.size();
+}
+
+template<Device D, typename T>
+std::vector<Compute::BufferStatistics> FileReader<D, T>::computeBuffers() const {
+    if (!gimpl->prefetching()) {
+        return {};
+    }
+    return {BufferStatistics::From("prefetch", gimpl->prefetch)};
+}
+
 template<Device D, typename T>
 Result FileReader<D, T>::GImpl::startPlaying(FileReader<D, T>& m) {
     // Initialize output buffer
-    m.output.buffer = Tensor<D, T>(m.config.shape);
+    if (m.config.batchSize == 0) {
+        JST_ERROR("Batch size is zero.");
+        return Result::ERROR;
+    }
+
+    std::vector<U64> shape = m.config.shape;
+    if (m.config.batchSize > 1) {
+        shape.insert(shape.begin(), m.config.batchSize);
+    }
+
+    m.output.buffer = Tensor<D, T>(shape);
     if (m.output.buffer.size() == 0) {
         JST_ERROR("Buffer shape is zero.");
         return Result::ERROR;
     }
 
     // Check file format type.
-    if (m.config.fileFormat != FileFormatType::Raw) {
+    if (m.config.fileFormat != FileFormatType::Raw &&
+        m.config.fileFormat != FileFormatType::SigMF &&
+        m.config.fileFormat != FileFormatType::Compressed) {
         JST_ERROR("File format '{}' is not supported.", m.config.fileFormat);
         return Result::ERROR;
     }
 
+#ifndef JETSTREAM_LOADER_ZSTD_AVAILABLE
+    if (m.config.fileFormat == FileFormatType::Compressed) {
+        JST_ERROR("Compressed recordings need zstd, which isn't available in this build.");
+        return Result::ERROR;
+    }
+#endif
+
+    compressed = m.config.fileFormat == FileFormatType::Compressed;
+
     // Check if the provided filepath is valid.
     if (m.config.filepath.empty()) {
         JST_ERROR("File path is empty.");
@@ -110,7 +313,16 @@ Result FileReader<D, T>::GImpl::startPlaying(FileReader<D, T>& m) {
         return Result::ERROR;
     }
 
-    filePath = std::filesystem::path(m.config.filepath);
+    sampleRate = 0.0f;
+    captures.clear();
+    playbackSample = 0;
+
+    if (m.config.fileFormat == FileFormatType::SigMF) {
+        JST_CHECK(readMeta(m.config.filepath));
+        filePath = SigMFDataPath(m.config.filepath);
+    } else {
+        filePath = std::filesystem::path(m.config.filepath);
+    }
 
     // Check if file exists
     if (!std::filesystem::exists(filePath)) {
@@ -125,18 +337,39 @@ Result FileReader<D, T>::GImpl::startPlaying(FileReader<D, T>& m) {
         JST_ERROR("Failed to get file size for '{}'.", filePath.string());
         return Result::ERROR;
     }
+    storedSize = fileSize;
+
+    // Map the raw data file, or open it as a stream if that fails.
+    if (mapFile() != Result::SUCCESS) {
+        dataFile.open(filePath, std::ios::in | std::ios::binary);
+        if (!dataFile.is_open()) {
+            JST_ERROR("Failed to open file '{}' for reading.", filePath.string());
+            return Result::ERROR;
+        }
+    }
 
-    // Open the raw data file.
-    dataFile.open(filePath, std::ios::in | std::ios::binary);
-    if (!dataFile.is_open()) {
-        JST_ERROR("Failed to open file '{}' for reading.", filePath.string());
-        return Result::ERROR;
+    if (compressed) {
+        JST_CHECK(readIndex());
     }
 
     // Start underlying recording.
     JST_CHECK(underlyingStartPlaying());
 
     currentPosition = 0;
+    pendingSeek = NoSeek;
+
+    playbackRate = (m.config.sampleRate > 0.0f) ? m.config.sampleRate : sampleRate;
+    pacing = m.config.realTime && playbackRate > 0.0f;
+    paceOrigin = std::chrono::steady_clock::now();
+    pacedSamples = 0;
+
+    if (m.config.realTime && !pacing) {
+        JST_WARN("Real-time playback needs a sample rate. Playing as fast as possible.");
+    }
+
+    if (m.config.readAhead > 0) {
+        JST_CHECK(startReader(m));
+    }
 
     JST_INFO("Opened file '{}' for reading. Size: {} bytes.", filePath.string(), fileSize);
 
@@ -148,23 +381,496 @@ Result FileReader<D, T>::GImpl::stopPlaying() {
     // Stop Playing.
     JST_INFO("Stopping playing.");
 
+    stopReader();
+
     if (dataFile.is_open()) {
         dataFile.close();
     }
 
+    unmapFile();
+
+#ifdef JETSTREAM_LOADER_ZSTD_AVAILABLE
+    ZSTD_freeDCtx(decompressor);
+    decompressor = nullptr;
+#endif
+    chunkOffsets.clear();
+    cachedChunk = NoChunk;
+
     // Stop underlying playback.
     JST_CHECK(underlyingStopPlaying());
 
     return Result::SUCCESS;
 }
 
+template<Device D, typename T>
+Result FileReader<D, T>::GImpl::mapFile() {
+#ifdef JST_FILE_READER_MAPPED
+    if (storedSize == 0) {
+        return Result::ERROR;
+    }
+
+    const int fd = open(filePath.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        return Result::ERROR;
+    }
+
+    // The mapping stays valid after the descriptor is closed.
+    void* address = mmap(nullptr, storedSize, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+
+    if (address == MAP_FAILED) {
+        JST_DEBUG("[FILE_READER] Failed to map file. Falling back to stream reads.");
+        return Result::ERROR;
+    }
+
+    madvise(address, storedSize, MADV_SEQUENTIAL);
+    mapping = static_cast<const char*>(address);
+
+    JST_DEBUG("[FILE_READER] Mapped {} bytes.", storedSize);
+
+    return Result::SUCCESS;
+#else
+    return Result::ERROR;
+#endif
+}
+
+template<Device D, typename T>
+void FileReader<D, T>::GImpl::unmapFile() {
+#ifdef JST_FILE_READER_MAPPED
+    if (mapping) {
+        munmap(const_cast<char*>(mapping), storedSize);
+        mapping = nullptr;
+    }
+#endif
+}
+
+template<Device D, typename T>
+U64 FileReader<D, T>::GImpl::read(char* data, const U64& size) {
+    if (compressed) {
+        return readCompressed(data, size);
+    }
+
+    const U64 count = std::min(size, fileSize - currentPosition);
+
+#ifdef JST_FILE_READER_MAPPED
+    if (mapping) {
+        std::copy_n(mapping + currentPosition, count, data);
+        currentPosition += count;
+
+        // Ask for the next pages while the graph works on this frame.
+        const U64 pageSize = static_cast<U64>(sysconf(_SC_PAGESIZE));
+        const U64 ahead = currentPosition - (currentPosition % pageSize);
+        const U64 aheadSize = std::min(2 * size, fileSize - ahead);
+        if (aheadSize > 0) {
+            madvise(const_cast<char*>(mapping) + ahead, aheadSize, MADV_WILLNEED);
+        }
+
+        return count;
+    }
+#endif
+
+    dataFile.read(data, count);
+    const U64 bytesRead = dataFile.gcount();
+    currentPosition += bytesRead;
+    return bytesRead;
+}
+
+template<Device D, typename T>
+U64 FileReader<D, T>::GImpl::readStored(char* data, const U64& offset, const U64& size) {
+    if (offset >= storedSize) {
+        return 0;
+    }
+    const U64 count = std::min(size, storedSize - offset);
+
+#ifdef JST_FILE_READER_MAPPED
+    if (mapping) {
+        std::copy_n(mapping + offset, count, data);
+        return count;
+    }
+#endif
+
+    dataFile.clear();
+    dataFile.seekg(offset, std::ios::beg);
+    dataFile.read(data, count);
+    return dataFile.gcount();
+}
+
+template<Device D, typename T>
+Result FileReader<D, T>::GImpl::readIndex() {
+#ifdef JETSTREAM_LOADER_ZSTD_AVAILABLE
+    CompressedFile::Header header;
+    if (readStored(reinterpret_cast<char*>(&header), 0, sizeof(header)) != sizeof(header) ||
+        header.magic != CompressedFile::Magic) {
+        JST_ERROR("File '{}' isn't a compressed recording.", filePath.string());
+        return Result::ERROR;
+    }
+
+    if (header.version != CompressedFile::Version || header.chunkSamples != CompressedFile::ChunkSamples) {
+        JST_ERROR("Compressed recording version {} isn't supported.", header.version);
+        return Result::ERROR;
+    }
+
+    if (header.complex != std::is_same_v<T, CF32>) {
+        JST_ERROR("Compressed recording type doesn't match the output type.");
+        return Result::ERROR;
+    }
+
+    chunkOffsets.clear();
+
+    // Use the index closing the file when there's one.
+
+    CompressedFile::Footer footer;
+    const U64 footerOffset = storedSize - std::min<U64>(storedSize, sizeof(footer));
+    if (readStored(reinterpret_cast<char*>(&footer), footerOffset, sizeof(footer)) == sizeof(footer) &&
+        footer.magic == CompressedFile::IndexMagic &&
+        footerOffset >= sizeof(header) &&
+        footer.numberOfChunks * sizeof(U64) <= footerOffset - sizeof(header)) {
+        chunkOffsets.resize(footer.numberOfChunks);
+        const U64 indexSize = footer.numberOfChunks * sizeof(U64);
+        readStored(reinterpret_cast<char*>(chunkOffsets.data()), footerOffset - indexSize, indexSize);
+    }
+
+    // Otherwise walk the chunk headers, dropping a truncated last chunk.
+
+    if (chunkOffsets.empty()) {
+        JST_WARN("Compressed recording '{}' has no index. Walking the chunks.", filePath.string());
+
+        U64 offset = sizeof(header);
+        CompressedFile::ChunkHeader chunk;
+        while (readStored(reinterpret_cast<char*>(&chunk), offset, sizeof(chunk)) == sizeof(chunk) &&
+               offset + sizeof(chunk) + chunk.size <= storedSize) {
+            chunkOffsets.push_back(offset);
+            offset += sizeof(chunk) + chunk.size;
+        }
+    }
+
+    if (chunkOffsets.empty()) {
+        JST_ERROR("Compressed recording '{}' has no samples.", filePath.string());
+        return Result::ERROR;
+    }
+
+    // Only the last chunk can be partial.
+
+    CompressedFile::ChunkHeader last;
+    readStored(reinterpret_cast<char*>(&last), chunkOffsets.back(), sizeof(last));
+    const U64 samples = (chunkOffsets.size() - 1) * CompressedFile::ChunkSamples + last.samples;
+    fileSize = samples * sizeof(T);
+
+    decompressor = ZSTD_createDCtx();
+    cachedChunk = NoChunk;
+
+    JST_DEBUG("[FILE_READER] Compressed recording with {} chunks and {} samples ({:.1f}x).",
+              chunkOffsets.size(), samples, static_cast<F64>(fileSize) / static_cast<F64>(storedSize));
+
+    return Result::SUCCESS;
+#else
+    return Result::ERROR;
+#endif
+}
+
+template<Device D, typename T>
+Result FileReader<D, T>::GImpl::loadChunk(const U64& index) {
+#ifdef JETSTREAM_LOADER_ZSTD_AVAILABLE
+    if (cachedChunk == index) {
+        return Result::SUCCESS;
+    }
+    cachedChunk = NoChunk;
+
+    constexpr U64 parts = std::is_same_v<T, CF32> ? 2 : 1;
+
+    CompressedFile::ChunkHeader header;
+    const U64 offset = chunkOffsets[index];
+    if (readStored(reinterpret_cast<char*>(&header), offset, sizeof(header)) != sizeof(header) ||
+        header.samples > CompressedFile::ChunkSamples) {
+        JST_ERROR("Chunk {} of '{}' is malformed.", index, filePath.string());
+        return Result::ERROR;
+    }
+
+    packed.resize(header.size);
+    if (readStored(reinterpret_cast<char*>(packed.data()), offset + sizeof(header), header.size) != header.size) {
+        JST_ERROR("Chunk {} of '{}' is truncated.", index, filePath.string());
+        return Result::ERROR;
+    }
+
+    const U64 values = header.samples * parts;
+    quantized.resize(values);
+
+    const U64 size = ZSTD_decompressDCtx(decompressor, quantized.data(), values * sizeof(I16), packed.data(), packed.size());
+    if (ZSTD_isError(size) || size != values * sizeof(I16)) {
+        JST_ERROR("Failed to decompress chunk {} of '{}'.", index, filePath.string());
+        return Result::ERROR;
+    }
+
+    cache.resize(header.samples);
+    F32* samples = reinterpret_cast<F32*>(cache.data());
+    for (U64 i = 0; i < values; i++) {
+        samples[i] = static_cast<F32>(quantized[i]) * header.scale;
+    }
+
+    cachedChunk = index;
+
+    return Result::SUCCESS;
+#else
+    (void)index;
+    return Result::ERROR;
+#endif
+}
+
+template<Device D, typename T>
+U64 FileReader<D, T>::GImpl::readCompressed(char* data, const U64& size) {
+    constexpr U64 chunkBytes = CompressedFile::ChunkSamples * sizeof(T);
+
+    U64 bytesRead = 0;
+    while (bytesRead < size && currentPosition < fileSize) {
+        const U64 index = currentPosition / chunkBytes;
+        if (loadChunk(index) != Result::SUCCESS) {
+            break;
+        }
+
+        const U64 offset = currentPosition - index * chunkBytes;
+        if (offset >= cache.size() * sizeof(T)) {
+            break;
+        }
+
+        const U64 count = std::min(size - bytesRead, cache.size() * sizeof(T) - offset);
+        std::copy_n(reinterpret_cast<const char*>(cache.data()) + offset, count, data + bytesRead);
+
+        bytesRead += count;
+        currentPosition += count;
+    }
+    return bytesRead;
+}
+
+template<Device D, typename T>
+U64 FileReader<D, T>::GImpl::fill(char* data, const U64& size, const bool& loop) {
+    U64 bytesRead = 0;
+    while (bytesRead < size) {
+        if (fileSize == currentPosition) {
+            if (!loop) {
+                break;
+            }
+            rewind();
+        }
+
+        const U64 count = read(data + bytesRead, size - bytesRead);
+        bytesRead += count;
+
+        if (count == 0) {
+            break;
+        }
+    }
+    return bytesRead;
+}
+
+template<Device D, typename T>
+Result FileReader<D, T>::GImpl::startReader(FileReader<D, T>& m) {
+    FileReader<D, T>* module = &m;
+    const U64 frameSize = m.output.buffer.size();
+    const bool loop = m.config.loop;
+
+    prefetch.resize(frameSize * m.config.readAhead, Memory::CircularBuffer<T>::Mode::LockFree);
+    prefetch.setPutCallback([module]{
+        module->notifyCompute();
+    });
+
+    reading = true;
+    finished = false;
+
+    reader = std::thread([&, module, frameSize, loop]{
+        ApplyThreadPolicy(ThreadRole::IO);
+
+        const U64 frameBytes = frameSize * sizeof(T);
+        std::vector<T> scratch(frameSize);
+
+        while (reading) {
+            // Wait for a whole output of free space.
+            {
+                std::unique_lock<std::mutex> lock(readerMutex);
+                readerCondition.wait_for(lock, std::chrono::milliseconds(100), [&]{
+                    return !reading || (prefetch.getCapacity() - prefetch.getOccupancy()) >= frameSize;
+                });
+            }
+
+            if (!reading || (prefetch.getCapacity() - prefetch.getOccupancy()) < frameSize) {
+                continue;
+            }
+
+            // Read straight into the ring when it hands out a contiguous window.
+            T* window = prefetch.reserve(frameSize);
+            T* target = window ? window : scratch.data();
+
+            const U64 bytesRead = fill(reinterpret_cast<char*>(target), frameBytes, loop);
+            const U64 count = bytesRead / sizeof(T);
+
+            if (count > 0) {
+                if (window) {
+                    prefetch.commit(count);
+                } else {
+                    prefetch.put(scratch.data(), count);
+                }
+            }
+
+            if (bytesRead < frameBytes) {
+                finished = true;
+                module->notifyCompute();
+                break;
+            }
+        }
+    });
+
+    JST_DEBUG("[FILE_READER] Reading {} outputs ahead.", m.config.readAhead);
+
+    return Result::SUCCESS;
+}
+
+template<Device D, typename T>
+void FileReader<D, T>::GImpl::stopReader() {
+    {
+        std::lock_guard<std::mutex> lock(readerMutex);
+        reading = false;
+    }
+    readerCondition.notify_all();
+
+    if (reader.joinable()) {
+        reader.join();
+    }
+
+    prefetch.setPutCallback({});
+}
+
+template<Device D, typename T>
+Result FileReader<D, T>::GImpl::readMeta(const std::string& filepath) {
+#ifdef JETSTREAM_LOADER_JSON_AVAILABLE
+    const auto metaPath = SigMFMetaPath(filepath);
+
+    std::ifstream metaFile(metaPath);
+    if (!metaFile.is_open()) {
+        JST_ERROR("Failed to open SigMF metadata '{}'.", metaPath.string());
+        return Result::ERROR;
+    }
+
+    const auto meta = nlohmann::json::parse(metaFile, nullptr, false);
+    if (meta.is_discarded() || !meta.contains("global")) {
+        JST_ERROR("SigMF metadata '{}' is malformed.", metaPath.string());
+        return Result::ERROR;
+    }
+
+    const auto& global = meta["global"];
+
+    const auto datatype = global.value("core:datatype", std::string());
+    if (datatype != SigMFDatatype<T>()) {
+        JST_ERROR("SigMF datatype '{}' doesn't match the output type '{}'.", datatype, SigMFDatatype<T>());
+        return Result::ERROR;
+    }
+
+    sampleRate = global.value("core:sample_rate", 0.0f);
+
+    for (const auto& capture : meta.value("captures", nlohmann::json::array())) {
+        captures.push_back({
+            capture.value("core:sample_start", U64{0}),
+            capture.value("core:frequency", 0.0f),
+        });
+    }
+
+    std::sort(captures.begin(), captures.end(), [](const auto& a, const auto& b) {
+        return a.sampleStart < b.sampleStart;
+    });
+
+    JST_DEBUG("[FILE_READER] SigMF recording with {} captures at {:.2f} MHz.", captures.size(), sampleRate / JST_MHZ);
+
+    return Result::SUCCESS;
+#else
+    (void)filepath;
+    JST_ERROR("SigMF recordings need JSON support, which isn't available in this build.");
+    return Result::ERROR;
+#endif
+}
+
+template<Device D, typename T>
+void FileReader<D, T>::GImpl::tag(Tensor<D, T>& buffer) {
+    if (sampleRate > 0.0f) {
+        buffer.attribute("sample_rate").set(sampleRate);
+    }
+
+    if (!captures.empty()) {
+        auto capture = std::upper_bound(captures.begin(), captures.end(), playbackSample.load(), [](const U64& sample, const auto& c) {
+            return sample < c.sampleStart;
+        });
+        if (capture != captures.begin()) {
+            --capture;
+        }
+        buffer.attribute("frequency").set(capture->frequency);
+    }
+}
+
+template<Device D, typename T>
+void FileReader<D, T>::GImpl::advance(const U64& samples) {
+    const U64 fileSamples = fileSize / sizeof(T);
+    playbackSample = (fileSamples > 0) ? (playbackSample + samples) % fileSamples : 0;
+
+    if (!pacing) {
+        return;
+    }
+
+    pacedSamples += samples;
+
+    // Don't rush to catch up after a stall, restart the clock instead.
+    const auto now = std::chrono::steady_clock::now();
+    if (now - deadline() > std::chrono::seconds(1)) {
+        paceOrigin = now;
+        pacedSamples = 0;
+    }
+}
+
+template<Device D, typename T>
+Result FileReader<D, T>::GImpl::applySeek(FileReader<D, T>& m, const U64& sample) {
+    // The read-ahead ring holds samples of the old position. The reader is
+    // stopped while the position moves and started again on an empty ring.
+
+    const bool restart = prefetching();
+    if (restart) {
+        stopReader();
+    }
+
+    currentPosition = std::min(sample * sizeof(T), fileSize);
+    if (dataFile.is_open() && !compressed) {
+        dataFile.clear();
+        dataFile.seekg(currentPosition.load(), std::ios::beg);
+    }
+
+    playbackSample = currentPosition / sizeof(T);
+
+    paceOrigin = std::chrono::steady_clock::now();
+    pacedSamples = 0;
+
+    if (restart) {
+        JST_CHECK(startReader(m));
+    }
+
+    JST_DEBUG("[FILE_READER] Seeked to sample {}.", playbackSample.load());
+
+    return Result::SUCCESS;
+}
+
+template<Device D, typename T>
+void FileReader<D, T>::GImpl::rewind() {
+    if (dataFile.is_open()) {
+        dataFile.clear();
+        dataFile.seekg(0, std::ios::beg);
+    }
+    currentPosition = 0;
+}
+
 template<Device D, typename T>
 void FileReader<D, T>::info() const {
-    JST_DEBUG("  File Format: Raw Binary");
+    JST_DEBUG("  File Format: {}", config.fileFormat);
     JST_DEBUG("  Filepath: {}", config.filepath);
     JST_DEBUG("  Playing: {}", config.playing);
     JST_DEBUG("  Loop: {}", config.loop);
     JST_DEBUG("  Shape: {}", config.shape);
+    JST_DEBUG("  Batch Size: {}", config.batchSize);
+    JST_DEBUG("  Real Time: {}", config.realTime);
+    JST_DEBUG("  Sample Rate: {:.2f} MHz", config.sampleRate / JST_MHZ);
 }
 
 }  // namespace Jetstream
@@ -35,11 +35,28 @@ Result FileWriter<D, T>::destroyCompute(const Context&) {
 
 template<Device D, typename T>
 Result FileWriter<D, T>::compute(const Context&) {
-    if (config.recording) {
-        gimpl->dataFile.write(reinterpret_cast<const char*>(input.buffer.data()), input.buffer.size_bytes());
+    if (!config.recording) {
+        return Result::SUCCESS;
     }
 
-    return Result::SUCCESS;
+    // Gated inputs, like the output of a Burst Detector, are only written
+    // while the gate is open.
+
+    const auto& attributes = input.buffer.attributes();
+    const auto gate = attributes.find("gate");
+    const bool gated = gate != attributes.end() && !gate->second.template get<bool>();
+
+    // SigMF recordings mark every burst and retune in the metadata.
+
+    if (gimpl->sigmf) {
+        gimpl->describe(input.buffer, gated);
+    }
+
+    if (gated) {
+        return Result::SUCCESS;
+    }
+
+    return gimpl->enqueue(reinterpret_cast<const U8*>(input.buffer.data()), input.buffer.size_bytes());
 }
 
 template<Device D, typename T>
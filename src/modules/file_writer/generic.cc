@@ -1,8 +1,35 @@
 #include <regex>
+#include <deque>
+#include <mutex>
+#include <atomic>
+#include <thread>
+#include <chrono>
+#include <ctime>
+#include <cmath>
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
 #include <filesystem>
 #include <fstream>
+#include <limits>
+#include <condition_variable>
 
 #include "jetstream/modules/file_writer.hh"
+#include "jetstream/compute/thread.hh"
+
+#if defined(JST_OS_LINUX) || defined(JST_OS_ANDROID) || defined(JST_OS_MAC) || defined(JST_OS_IOS)
+#define JST_FILE_WRITER_POSIX
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+#ifdef JETSTREAM_LOADER_JSON_AVAILABLE
+#include <nlohmann/json.hpp>
+#endif
+
+#ifdef JETSTREAM_LOADER_ZSTD_AVAILABLE
+#include <zstd.h>
+#endif
 
 // TODO: Correctly separate Device implementations.
 
@@ -13,9 +40,94 @@ struct FileWriter<D, T>::GImpl {
     std::fstream dataFile;
     std::filesystem::path filePath;
 
+    // Inputs are gathered into large page-aligned blocks written by a
+    // background thread, so the compute thread never waits on the storage.
+    // When every block is waiting for the disk, inputs are dropped and
+    // counted instead of stalling the graph.
+    static constexpr U64 BlockSize = 4 << 20;
+    static constexpr U64 BlockAlignment = 4096;
+
+    struct Block {
+        U8* data = nullptr;
+        U64 size = 0;
+    };
+
+    int fd = -1;
+    bool direct = false;
+
+    std::vector<U8*> storage;
+    std::vector<U8*> available;
+    std::deque<Block> pending;
+    Block current;
+
+    std::thread writer;
+    bool writing = false;
+    std::mutex blockMutex;
+    std::condition_variable blockCondition;
+
+    std::atomic<U64> bytesWritten = 0;
+    std::atomic<U64> bytesPending = 0;
+    std::atomic<U64> bytesDropped = 0;
+    std::atomic<F64> bandwidth = 0.0;
+
+    // Bytes in the file, smaller than the input for compressed recordings.
+    std::atomic<U64> bytesStored = 0;
+
+    // Compressed recordings quantize and compress every block on the writer
+    // thread. The offset of every chunk is kept for the index closing the file.
+    bool compressed = false;
+    std::vector<U64> chunkOffsets;
+    std::vector<I16> quantized;
+    std::vector<U8> packed;
+#ifdef JETSTREAM_LOADER_ZSTD_AVAILABLE
+    ZSTD_CCtx* compressor = nullptr;
+#endif
+
+    // SigMF recordings also keep a metadata file next to the data. The
+    // compute thread only appends captures and annotations to short lists,
+    // the writer thread rewrites the metadata after a block when they changed.
+    struct Capture {
+        U64 sampleStart;
+        F64 frequency;
+    };
+
+    struct Annotation {
+        U64 sampleStart;
+        U64 sampleCount;
+    };
+
+    bool sigmf = false;
+    std::filesystem::path metaPath;
+    std::string metaGlobal;
+    std::string metaDatetime;
+
+    std::mutex metaMutex;
+    std::vector<Capture> captures;
+    std::vector<Annotation> annotations;
+    bool metaDirty = false;
+
+    // Samples accepted by the writer, the index of the next one in the file.
+    U64 samplesQueued = 0;
+    F32 lastFrequency = std::numeric_limits<F32>::quiet_NaN();
+    bool burstOpen = false;
+    U64 burstStart = 0;
+
     Result startRecording(FileWriter<D, T>& m);
     Result stopRecording();
 
+    Result openFile(const bool& directIO);
+    void closeFile();
+
+    Result enqueue(const U8* data, const U64& size);
+    void describe(const Tensor<D, T>& buffer, const bool& gated);
+    void closeBurst();
+    Result writeMeta();
+    Result writeBlock(Block& block);
+    Result writeBytes(const U8* data, const U64& size);
+    Result compressBlock(const Block& block);
+    Result writeIndex();
+    void writerLoop();
+
     Result underlyingStartRecording();
     Result underlyingStopRecording();
 };
@@ -72,11 +184,30 @@ template<Device D, typename T>
 Result FileWriter<D, T>::GImpl::startRecording(FileWriter<D, T>& m) {
     // Check file format type.
 
-    if (m.config.fileFormat != FileFormatType::Raw) {
+    if (m.config.fileFormat != FileFormatType::Raw &&
+        m.config.fileFormat != FileFormatType::SigMF &&
+        m.config.fileFormat != FileFormatType::Compressed) {
         JST_ERROR("File format '{}' is not supported.", m.config.fileFormat);
         return Result::ERROR;
     }
 
+#ifndef JETSTREAM_LOADER_JSON_AVAILABLE
+    if (m.config.fileFormat == FileFormatType::SigMF) {
+        JST_ERROR("SigMF recordings need JSON support, which isn't available in this build.");
+        return Result::ERROR;
+    }
+#endif
+
+#ifndef JETSTREAM_LOADER_ZSTD_AVAILABLE
+    if (m.config.fileFormat == FileFormatType::Compressed) {
+        JST_ERROR("Compressed recordings need zstd, which isn't available in this build.");
+        return Result::ERROR;
+    }
+#endif
+
+    sigmf = m.config.fileFormat == FileFormatType::SigMF;
+    compressed = m.config.fileFormat == FileFormatType::Compressed;
+
     // Check if the provided filepath is valid.
 
     if (m.config.filepath.empty()) {
@@ -89,7 +220,7 @@ Result FileWriter<D, T>::GImpl::startRecording(FileWriter<D, T>& m) {
         return Result::ERROR;
     }
 
-    filePath = std::filesystem::path(m.config.filepath);
+    filePath = sigmf ? SigMFDataPath(m.config.filepath) : std::filesystem::path(m.config.filepath);
 
     // Check if parent directory exists
     auto parentPath = filePath.parent_path();
@@ -104,18 +235,107 @@ Result FileWriter<D, T>::GImpl::startRecording(FileWriter<D, T>& m) {
         return Result::ERROR;
     }
 
-    // Open the raw data file.
-    dataFile.open(filePath, std::ios::out | std::ios::binary);
-    if (!dataFile.is_open()) {
-        JST_ERROR("Failed to open file '{}' for writing.", filePath.string());
-        return Result::ERROR;
+    if (sigmf) {
+        metaPath = SigMFMetaPath(m.config.filepath);
+
+        if (std::filesystem::exists(metaPath) && !m.config.overwrite) {
+            JST_ERROR("File '{}' already exists.", metaPath.string());
+            return Result::ERROR;
+        }
+    }
+
+    // Open the data file. Compressed chunks have arbitrary sizes, which
+    // direct writes can't take.
+    if (compressed && m.config.directIO) {
+        JST_WARN("Direct IO isn't supported for compressed recordings. Using buffered writes.");
+    }
+    JST_CHECK(openFile(m.config.directIO && !compressed));
+
+    // Allocate the blocks and start the writer.
+    const U64 numberOfBlocks = std::max<U64>(2, (m.config.backlog * JST_MB) / BlockSize);
+    for (U64 i = 0; i < numberOfBlocks; i++) {
+        auto* block = static_cast<U8*>(std::aligned_alloc(BlockAlignment, BlockSize));
+        if (!block) {
+            JST_ERROR("Failed to allocate the write blocks.");
+            closeFile();
+            return Result::ERROR;
+        }
+        storage.push_back(block);
+        available.push_back(block);
+    }
+
+    bytesWritten = 0;
+    bytesPending = 0;
+    bytesDropped = 0;
+    bytesStored = 0;
+    bandwidth = 0.0;
+    current = {};
+    writing = true;
+
+    if (compressed) {
+#ifdef JETSTREAM_LOADER_ZSTD_AVAILABLE
+        compressor = ZSTD_createCCtx();
+        ZSTD_CCtx_setParameter(compressor, ZSTD_c_compressionLevel, 1);
+#endif
+        chunkOffsets.clear();
+
+        const CompressedFile::Header header = {
+            .magic = CompressedFile::Magic,
+            .version = CompressedFile::Version,
+            .complex = std::is_same_v<T, CF32>,
+            .chunkSamples = CompressedFile::ChunkSamples,
+        };
+        if (writeBytes(reinterpret_cast<const U8*>(&header), sizeof(header)) != Result::SUCCESS) {
+            closeFile();
+            return Result::ERROR;
+        }
     }
 
+    samplesQueued = 0;
+    lastFrequency = std::numeric_limits<F32>::quiet_NaN();
+    burstOpen = false;
+    captures.clear();
+    annotations.clear();
+
+    // The global section and the first capture are known upfront, so a
+    // valid metadata file exists from the start of the recording.
+    if (sigmf) {
+#ifdef JETSTREAM_LOADER_JSON_AVAILABLE
+        const auto now = std::chrono::system_clock::now();
+        const auto seconds = std::chrono::system_clock::to_time_t(now);
+        char datetime[32];
+        std::strftime(datetime, sizeof(datetime), "%Y-%m-%dT%H:%M:%SZ", std::gmtime(&seconds));
+
+        nlohmann::json global = {
+            {"core:datatype", SigMFDatatype<T>()},
+            {"core:version", "1.0.0"},
+            {"core:recorder", "CyberEther"},
+            {"core:author", m.config.author},
+            {"core:description", m.config.description.empty() ? m.config.name : m.config.description},
+        };
+        if (m.config.sampleRate > 0.0f) {
+            global["core:sample_rate"] = m.config.sampleRate;
+        }
+        metaGlobal = global.dump();
+        metaDatetime = datetime;
+
+        captures.push_back({0, m.config.centerFrequency});
+        metaDirty = false;
+
+        JST_CHECK(writeMeta());
+#endif
+    }
+
+    writer = std::thread([&]{
+        ApplyThreadPolicy(ThreadRole::IO);
+        writerLoop();
+    });
+
     // Start underlying recording.
     JST_CHECK(underlyingStartRecording());
 
     // Start Recording.
-    JST_INFO("Starting raw binary recording to '{}'.", filePath.string());
+    JST_INFO("Starting {} recording to '{}'.", m.config.fileFormat, filePath.string());
 
     return Result::SUCCESS;
 }
@@ -125,10 +345,41 @@ Result FileWriter<D, T>::GImpl::stopRecording() {
     // Stop Recording.
     JST_INFO("Stopping recording.");
 
+    // Hand the partial block to the writer and wait until it drained.
+    if (writer.joinable()) {
+        {
+            std::lock_guard<std::mutex> lock(blockMutex);
+            if (current.size > 0) {
+                pending.push_back(current);
+            }
+            current = {};
+            writing = false;
+        }
+        blockCondition.notify_all();
+        writer.join();
+    }
+
+    if (bytesDropped > 0) {
+        JST_WARN("Dropped {} bytes because the storage couldn't keep up.", bytesDropped.load());
+    }
+
+    // The writer is gone, so the final metadata is written from here.
+    if (sigmf) {
+        closeBurst();
+        if (writeMeta() != Result::SUCCESS) {
+            JST_WARN("Failed to write the final SigMF metadata.");
+        }
+    }
+
     // Close the data file.
-    if (dataFile.is_open()) {
-        dataFile.close();
+    closeFile();
+
+    for (auto* block : storage) {
+        std::free(block);
     }
+    storage.clear();
+    available.clear();
+    pending.clear();
 
     // Stop underlying recording.
     JST_CHECK(underlyingStopRecording());
@@ -136,9 +387,456 @@ Result FileWriter<D, T>::GImpl::stopRecording() {
     return Result::SUCCESS;
 }
 
+template<Device D, typename T>
+Result FileWriter<D, T>::GImpl::openFile(const bool& directIO) {
+#ifdef JST_FILE_WRITER_POSIX
+    const int flags = O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC;
+
+    direct = false;
+    if (directIO) {
+#if defined(O_DIRECT)
+        fd = open(filePath.c_str(), flags | O_DIRECT, 0644);
+        direct = fd >= 0;
+#elif defined(F_NOCACHE)
+        fd = open(filePath.c_str(), flags, 0644);
+        direct = fd >= 0 && fcntl(fd, F_NOCACHE, 1) == 0;
+#endif
+        if (!direct) {
+            JST_WARN("Direct IO isn't supported for '{}'. Using buffered writes.", filePath.string());
+        }
+    }
+
+    if (fd < 0) {
+        fd = open(filePath.c_str(), flags, 0644);
+    }
+
+    if (fd < 0) {
+        JST_ERROR("Failed to open file '{}' for writing.", filePath.string());
+        return Result::ERROR;
+    }
+#else
+    if (directIO) {
+        JST_WARN("Direct IO isn't supported on this platform. Using buffered writes.");
+    }
+
+    dataFile.open(filePath, std::ios::out | std::ios::binary);
+    if (!dataFile.is_open()) {
+        JST_ERROR("Failed to open file '{}' for writing.", filePath.string());
+        return Result::ERROR;
+    }
+#endif
+
+    return Result::SUCCESS;
+}
+
+template<Device D, typename T>
+void FileWriter<D, T>::GImpl::closeFile() {
+    if (compressed) {
+        if (writeIndex() != Result::SUCCESS) {
+            JST_WARN("Failed to write the chunk index of '{}'.", filePath.string());
+        }
+
+#ifdef JETSTREAM_LOADER_ZSTD_AVAILABLE
+        ZSTD_freeCCtx(compressor);
+        compressor = nullptr;
+#endif
+        compressed = false;
+    }
+
+#ifdef JST_FILE_WRITER_POSIX
+    if (fd >= 0) {
+        // Direct writes are padded to the alignment, trim the tail.
+        if (direct && ftruncate(fd, bytesStored.load()) != 0) {
+            JST_WARN("Failed to trim the padding of '{}'.", filePath.string());
+        }
+        close(fd);
+        fd = -1;
+    }
+#endif
+
+    if (dataFile.is_open()) {
+        dataFile.close();
+    }
+}
+
+template<Device D, typename T>
+Result FileWriter<D, T>::GImpl::enqueue(const U8* data, const U64& size) {
+    // Only the writer returns blocks, so the space can only grow after this.
+    {
+        std::lock_guard<std::mutex> lock(blockMutex);
+        const U64 space = available.size() * BlockSize + (current.data ? BlockSize - current.size : 0);
+        if (space < size) {
+            bytesDropped += size;
+            return Result::SUCCESS;
+        }
+    }
+
+    samplesQueued += size / sizeof(T);
+
+    U64 offset = 0;
+    while (offset < size) {
+        if (!current.data) {
+            std::lock_guard<std::mutex> lock(blockMutex);
+            current = {available.back(), 0};
+            available.pop_back();
+        }
+
+        const U64 count = std::min(size - offset, BlockSize - current.size);
+        std::memcpy(current.data + current.size, data + offset, count);
+        current.size += count;
+        offset += count;
+
+        if (current.size == BlockSize) {
+            {
+                std::lock_guard<std::mutex> lock(blockMutex);
+                pending.push_back(current);
+            }
+            blockCondition.notify_one();
+            current = {};
+        }
+    }
+
+    bytesPending += size;
+
+    return Result::SUCCESS;
+}
+
+template<Device D, typename T>
+Result FileWriter<D, T>::GImpl::writeBlock(Block& block) {
+    if (compressed) {
+        return compressBlock(block);
+    }
+
+    // Direct writes need whole aligned sectors. Only the last block can be
+    // partial, its padding is trimmed when the file is closed.
+    U64 size = block.size;
+    if (direct && (size % BlockAlignment) != 0) {
+        const U64 padded = ((size + BlockAlignment - 1) / BlockAlignment) * BlockAlignment;
+        std::memset(block.data + size, 0, padded - size);
+        size = padded;
+    }
+
+    JST_CHECK(writeBytes(block.data, size));
+
+    // The padding isn't part of the recording.
+    bytesStored -= size - block.size;
+
+    return Result::SUCCESS;
+}
+
+template<Device D, typename T>
+Result FileWriter<D, T>::GImpl::writeBytes(const U8* data, const U64& size) {
+#ifdef JST_FILE_WRITER_POSIX
+    U64 offset = 0;
+    while (offset < size) {
+        const ssize_t count = write(fd, data + offset, size - offset);
+        if (count < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            JST_ERROR("Failed to write to '{}' ({}).", filePath.string(), std::strerror(errno));
+            return Result::ERROR;
+        }
+        offset += static_cast<U64>(count);
+    }
+#else
+    dataFile.write(reinterpret_cast<const char*>(data), size);
+    if (!dataFile) {
+        JST_ERROR("Failed to write to '{}'.", filePath.string());
+        return Result::ERROR;
+    }
+#endif
+
+    bytesStored += size;
+
+    return Result::SUCCESS;
+}
+
+template<Device D, typename T>
+Result FileWriter<D, T>::GImpl::compressBlock(const Block& block) {
+#ifdef JETSTREAM_LOADER_ZSTD_AVAILABLE
+    constexpr U64 parts = std::is_same_v<T, CF32> ? 2 : 1;
+
+    const F32* samples = reinterpret_cast<const F32*>(block.data);
+    const U64 numberOfSamples = block.size / sizeof(T);
+
+    for (U64 start = 0; start < numberOfSamples; start += CompressedFile::ChunkSamples) {
+        const U64 count = std::min<U64>(CompressedFile::ChunkSamples, numberOfSamples - start);
+        const U64 values = count * parts;
+        const F32* chunk = samples + start * parts;
+
+        // The scale maps the peak of the chunk to the full integer range.
+
+        F32 peak = 0.0f;
+        for (U64 i = 0; i < values; i++) {
+            peak = std::max(peak, std::abs(chunk[i]));
+        }
+        const F32 scale = (peak > 0.0f) ? peak / 32767.0f : 1.0f;
+        const F32 inverse = 1.0f / scale;
+
+        quantized.resize(values);
+        for (U64 i = 0; i < values; i++) {
+            quantized[i] = static_cast<I16>(std::lrint(chunk[i] * inverse));
+        }
+
+        const U64 sourceSize = values * sizeof(I16);
+        packed.resize(sizeof(CompressedFile::ChunkHeader) + ZSTD_compressBound(sourceSize));
+
+        const U64 size = ZSTD_compress2(compressor,
+                                        packed.data() + sizeof(CompressedFile::ChunkHeader),
+                                        packed.size() - sizeof(CompressedFile::ChunkHeader),
+                                        quantized.data(),
+                                        sourceSize);
+        if (ZSTD_isError(size)) {
+            JST_ERROR("Failed to compress a chunk of '{}' ({}).", filePath.string(), ZSTD_getErrorName(size));
+            return Result::ERROR;
+        }
+
+        const CompressedFile::ChunkHeader header = {
+            .size = static_cast<U32>(size),
+            .samples = static_cast<U32>(count),
+            .scale = scale,
+            .reserved = 0,
+        };
+        std::memcpy(packed.data(), &header, sizeof(header));
+
+        chunkOffsets.push_back(bytesStored);
+        JST_CHECK(writeBytes(packed.data(), sizeof(header) + size));
+    }
+
+    return Result::SUCCESS;
+#else
+    (void)block;
+    return Result::ERROR;
+#endif
+}
+
+template<Device D, typename T>
+Result FileWriter<D, T>::GImpl::writeIndex() {
+#ifdef JST_FILE_WRITER_POSIX
+    if (fd < 0) {
+        return Result::SUCCESS;
+    }
+#else
+    if (!dataFile.is_open()) {
+        return Result::SUCCESS;
+    }
+#endif
+
+    const CompressedFile::Footer footer = {
+        .numberOfChunks = chunkOffsets.size(),
+        .magic = CompressedFile::IndexMagic,
+        .reserved = 0,
+    };
+
+    JST_CHECK(writeBytes(reinterpret_cast<const U8*>(chunkOffsets.data()), chunkOffsets.size() * sizeof(U64)));
+    JST_CHECK(writeBytes(reinterpret_cast<const U8*>(&footer), sizeof(footer)));
+
+    return Result::SUCCESS;
+}
+
+template<Device D, typename T>
+void FileWriter<D, T>::GImpl::writerLoop() {
+    bool failed = false;
+
+    while (true) {
+        Block block;
+
+        {
+            std::unique_lock<std::mutex> lock(blockMutex);
+            blockCondition.wait(lock, [&]{
+                return !pending.empty() || !writing;
+            });
+
+            if (pending.empty()) {
+                break;
+            }
+
+            block = pending.front();
+            pending.pop_front();
+        }
+
+        // After a failure the blocks are only recycled.
+        if (!failed) {
+            const auto start = std::chrono::steady_clock::now();
+            failed = writeBlock(block) != Result::SUCCESS;
+            const std::chrono::duration<F64> elapsed = std::chrono::steady_clock::now() - start;
+
+            if (!failed) {
+                bytesWritten += block.size;
+                if (elapsed.count() > 0.0) {
+                    const F64 rate = static_cast<F64>(block.size) / elapsed.count();
+                    bandwidth = (bandwidth.load() == 0.0) ? rate : 0.8 * bandwidth.load() + 0.2 * rate;
+                }
+            } else {
+                bytesDropped += block.size;
+            }
+        } else {
+            bytesDropped += block.size;
+        }
+
+        bytesPending -= block.size;
+
+        {
+            std::lock_guard<std::mutex> lock(blockMutex);
+            available.push_back(block.data);
+        }
+
+        if (sigmf && !failed) {
+            bool dirty = false;
+            {
+                std::lock_guard<std::mutex> lock(metaMutex);
+                std::swap(dirty, metaDirty);
+            }
+            if (dirty && writeMeta() != Result::SUCCESS) {
+                JST_WARN("Failed to update the SigMF metadata.");
+            }
+        }
+    }
+}
+
+template<Device D, typename T>
+void FileWriter<D, T>::GImpl::describe(const Tensor<D, T>& buffer, const bool& gated) {
+    // Called on the compute thread before the input is queued, so the
+    // current sample index is the one of its first sample.
+
+    const auto& attributes = buffer.attributes();
+
+    if (const auto gate = attributes.find("gate"); gate != attributes.end()) {
+        if (gated) {
+            closeBurst();
+        } else if (!burstOpen) {
+            burstOpen = true;
+            burstStart = samplesQueued;
+        }
+    }
+
+    if (gated) {
+        return;
+    }
+
+    // Retuning sources, like a Soapy block, start a new capture.
+
+    if (const auto frequency = attributes.find("frequency"); frequency != attributes.end()) {
+        const auto& value = frequency->second.get();
+        if (value.type() == typeid(F32) && std::any_cast<F32>(value) != lastFrequency) {
+            lastFrequency = std::any_cast<F32>(value);
+
+            std::lock_guard<std::mutex> lock(metaMutex);
+            if (captures.back().sampleStart == samplesQueued) {
+                captures.back().frequency = lastFrequency;
+            } else {
+                captures.push_back({samplesQueued, lastFrequency});
+            }
+            metaDirty = true;
+        }
+    }
+}
+
+template<Device D, typename T>
+void FileWriter<D, T>::GImpl::closeBurst() {
+    if (!burstOpen) {
+        return;
+    }
+    burstOpen = false;
+
+    if (samplesQueued == burstStart) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(metaMutex);
+    annotations.push_back({burstStart, samplesQueued - burstStart});
+    metaDirty = true;
+}
+
+template<Device D, typename T>
+Result FileWriter<D, T>::GImpl::writeMeta() {
+#ifdef JETSTREAM_LOADER_JSON_AVAILABLE
+    nlohmann::json meta;
+    meta["global"] = nlohmann::json::parse(metaGlobal);
+    meta["captures"] = nlohmann::json::array();
+    meta["annotations"] = nlohmann::json::array();
+
+    {
+        std::lock_guard<std::mutex> lock(metaMutex);
+
+        for (const auto& capture : captures) {
+            nlohmann::json entry = {
+                {"core:sample_start", capture.sampleStart},
+                {"core:frequency", capture.frequency},
+            };
+            if (capture.sampleStart == 0) {
+                entry["core:datetime"] = metaDatetime;
+            }
+            meta["captures"].push_back(entry);
+        }
+
+        for (const auto& annotation : annotations) {
+            meta["annotations"].push_back({
+                {"core:sample_start", annotation.sampleStart},
+                {"core:sample_count", annotation.sampleCount},
+                {"core:label", "burst"},
+            });
+        }
+    }
+
+    // Written aside and renamed, so readers never see a partial file.
+
+    auto temporaryPath = metaPath;
+    temporaryPath += ".tmp";
+
+    {
+        std::ofstream metaFile(temporaryPath, std::ios::out | std::ios::trunc);
+        if (!metaFile.is_open()) {
+            JST_ERROR("Failed to open file '{}' for writing.", temporaryPath.string());
+            return Result::ERROR;
+        }
+        metaFile << meta.dump(4);
+        if (!metaFile) {
+            JST_ERROR("Failed to write to '{}'.", temporaryPath.string());
+            return Result::ERROR;
+        }
+    }
+
+    std::error_code ec;
+    std::filesystem::rename(temporaryPath, metaPath, ec);
+    if (ec) {
+        JST_ERROR("Failed to move '{}' to '{}'.", temporaryPath.string(), metaPath.string());
+        return Result::ERROR;
+    }
+#endif
+
+    return Result::SUCCESS;
+}
+
+template<Device D, typename T>
+U64 FileWriter<D, T>::getBytesWritten() const {
+    return gimpl->bytesWritten;
+}
+
+template<Device D, typename T>
+U64 FileWriter<D, T>::getBytesStored() const {
+    return gimpl->bytesStored;
+}
+
+template<Device D, typename T>
+U64 FileWriter<D, T>::getBacklog() const {
+    return gimpl->bytesPending;
+}
+
+template<Device D, typename T>
+U64 FileWriter<D, T>::getBytesDropped() const {
+    return gimpl->bytesDropped;
+}
+
+template<Device D, typename T>
+F64 FileWriter<D, T>::getWriteBandwidth() const {
+    return gimpl->bandwidth;
+}
+
 template<Device D, typename T>
 void FileWriter<D, T>::info() const {
-    JST_DEBUG("  File Format: Raw Binary");
+    JST_DEBUG("  File Format: {}", config.fileFormat);
     JST_DEBUG("  Filepath: {}", config.filepath);
     JST_DEBUG("  Name: {}", config.name);
     JST_DEBUG("  Description: {}", config.description);
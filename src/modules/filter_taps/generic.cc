@@ -1,4 +1,6 @@
 #include "jetstream/modules/filter_taps.hh"
+#include "jetstream/memory/utils/coefficient_cache.hh"
+#include "jetstream/memory/utils/hot_config.hh"
 
 namespace Jetstream {
 
@@ -10,24 +12,43 @@ inline F64 n(U64 len, U64 index) {
     return static_cast<F64>(index - static_cast<F64>(len - 1) / 2.0);
 }
 
+// Windowed sinc low-pass shifted to a center frequency. Rows are shared
+// through the coefficient cache, so blocks with the same filter and reloads
+// don't regenerate them.
+template<typename T>
+inline std::vector<T> FilterTapsRow(const F32& sampleRate, const F32& bandwidth, const F32& center, const U64& taps) {
+    using V = typename T::value_type;
+
+    const F64 filterWidth = (bandwidth / sampleRate) / 2.0;
+    const F64 filterOffset = (center / (sampleRate / 2.0)) / 2.0;
+    const std::complex<F64> j(0.0, 1.0);
+
+    std::vector<T> row(taps);
+
+    for (U64 i = 0; i < taps; i++) {
+        const V sincCoeff = sinc(2.0 * filterWidth * (i - (taps - 1) / 2.0));
+        const V windowCoeff = 0.42 - 0.50 * cos(2.0 * JST_PI * i / (taps - 1)) +
+                              0.08 * cos(4.0 * JST_PI * i / (taps - 1));
+        const T upconvertCoeff(std::exp(j * 2.0 * JST_PI * n(taps, i) * filterOffset));
+
+        row[i] = sincCoeff * windowCoeff * upconvertCoeff;
+    }
+
+    return row;
+}
+
 template<Device D, typename T>
 struct FilterTaps<D, T>::Impl {
-    struct {
-        U32 width;
-        U32 height;
-        F32 offset;
-        F32 zoom;
-    } signalUniforms;
+    std::vector<typename Memory::CoefficientCache<T>::Coefficients> rows;
 
-    Tensor<D, typename T::value_type> sincCoeffs;
-    Tensor<D, typename T::value_type> windowCoeffs;
-    Tensor<D, T> upconvertCoeffs;
+    // Configuration the taps are baked from, updated between frames
+    // with the one published by the runtime setters.
+    Config active;
+    Memory::HotConfig<Config> hotConfig;
 
     bool baked = false;
 
-    Result generateSincFunction(FilterTaps<D, T>& m);
-    Result generateWindow(FilterTaps<D, T>& m);
-    Result generateUpconvert(FilterTaps<D, T>& m);
+    Result bake(FilterTaps<D, T>& m);
 };
 
 template<Device D, typename T>
@@ -39,39 +60,33 @@ template<Device D, typename T>
 FilterTaps<D, T>::~FilterTaps() {
     impl.reset();
 }
-template<Device D, typename T>
-Result FilterTaps<D, T>::Impl::generateSincFunction(FilterTaps<D, T>& m) {
-    const F64 filterWidth = (m.config.bandwidth / m.config.sampleRate) / 2.0;
-
-    for (U64 i = 0; i < m.config.taps; i++) {
-        sincCoeffs[i] = sinc(2.0 * filterWidth * (i - (m.config.taps - 1) / 2.0));
-    }
-
-    return Result::SUCCESS;
-}
 
 template<Device D, typename T>
-Result FilterTaps<D, T>::Impl::generateWindow(FilterTaps<D, T>& m) {
-    for (U64 i = 0; i < m.config.taps; i++) {
-        windowCoeffs[i] = 0.42 - 0.50 * cos(2.0 * JST_PI * i / (m.config.taps - 1)) +
-                          0.08 * cos(4.0 * JST_PI * i / (m.config.taps - 1));
-    }
+Result FilterTaps<D, T>::Impl::bake(FilterTaps<D, T>& m) {
+    const auto& config = active;
 
-    return Result::SUCCESS;
-}
-
-template<Device D, typename T>
-Result FilterTaps<D, T>::Impl::generateUpconvert(FilterTaps<D, T>& m) {
-    const std::complex<F64> j(0.0, 1.0);
+    rows.resize(config.center.size());
 
-    for (U64 c = 0; c < m.config.center.size(); c++) {
-        const F64 filterOffset = (m.config.center[c] / (m.config.sampleRate / 2.0)) / 2.0;
+    for (U64 c = 0; c < config.center.size(); c++) {
+        const auto key = jst::fmt::format("filter_taps:{}:{}:{}:{}", config.taps,
+                                                                     config.sampleRate,
+                                                                     config.bandwidth,
+                                                                     config.center[c]);
+        rows[c] = Memory::CoefficientCache<T>::Get(key, [&]{
+            return FilterTapsRow<T>(config.sampleRate, config.bandwidth, config.center[c], config.taps);
+        });
 
-        for (U64 i = 0; i < m.config.taps; i++) {
-            upconvertCoeffs[{c, i}] = std::exp(j * 2.0 * JST_PI * n(m.config.taps, i) * filterOffset);
+        for (U64 i = 0; i < config.taps; i++) {
+            m.output.coeffs[{c, i}] = (*rows[c])[i];
         }
     }
 
+    m.output.coeffs.attribute("sample_rate").set(config.sampleRate);
+    m.output.coeffs.attribute("bandwidth").set(config.bandwidth);
+    m.output.coeffs.attribute("center").set(config.center);
+
+    baked = true;
+
     return Result::SUCCESS;
 }
 
@@ -84,8 +99,7 @@ Result FilterTaps<D, T>::sampleRate(F32& sampleRate) {
         return Result::ERROR;
     }
     config.sampleRate = sampleRate;
-    output.coeffs.attribute("sample_rate").set(config.sampleRate);
-    impl->baked = false;
+    impl->hotConfig.publish(config);
     return Result::SUCCESS;
 }
 
@@ -99,8 +113,7 @@ Result FilterTaps<D, T>::bandwidth(F32& bandwith) {
         return Result::ERROR;
     }
     config.bandwidth = bandwith;
-    output.coeffs.attribute("bandwidth").set(config.bandwidth);
-    impl->baked = false;
+    impl->hotConfig.publish(config);
     return Result::SUCCESS;
 }
 
@@ -116,8 +129,7 @@ Result FilterTaps<D, T>::center(const U64& idx, F32& center) {
         return Result::ERROR;
     }
     config.center[idx] = center;
-    output.coeffs.attribute("center").set(config.center);
-    impl->baked = false;
+    impl->hotConfig.publish(config);
     return Result::SUCCESS;
 }
 
@@ -129,34 +141,26 @@ Result FilterTaps<D, T>::taps(U64& taps) {
         return Result::ERROR;
     }
     config.taps = taps;
-    impl->baked = false;
     return Result::RELOAD;
 }
 
+template<Device D, typename T>
+Result FilterTaps<D, T>::createCompute(const Context&) {
+    // Generate eagerly so the first frame doesn't pay for it.
+    return impl->bake(*this);
+}
+
 template<Device D, typename T>
 Result FilterTaps<D, T>::compute(const Context&) {
-    if (impl->baked) {
-        return Result::SUCCESS;
+    // Parameters changed at runtime take effect from this frame on.
+    if (impl->hotConfig.consume(impl->active)) {
+        impl->baked = false;
     }
 
-    // Generate all coefficients.
-
-    JST_CHECK(impl->generateSincFunction(*this));
-    JST_CHECK(impl->generateWindow(*this));
-    JST_CHECK(impl->generateUpconvert(*this));
-
-    // Merge all coefficients.
-
-    for (U64 c = 0; c < config.center.size(); c++) {
-        for (U64 i = 0; i < config.taps; i++) {
-            output.coeffs[{c, i}] = impl->sincCoeffs[{i}] *
-                                    impl->windowCoeffs[{i}] *
-                                    impl->upconvertCoeffs[{c, i}];
-        }
+    if (!impl->baked) {
+        JST_CHECK(impl->bake(*this));
     }
 
-    impl->baked = true;
-
     return Result::SUCCESS;
 }
 
@@ -165,12 +169,6 @@ Result FilterTaps<D, T>::create() {
     JST_DEBUG("Initializing Filter Taps module.");
     JST_INIT_IO();
 
-    // Allocate internal data.
-
-    impl->sincCoeffs = Tensor<D, typename T::value_type>({config.taps});
-    impl->windowCoeffs = Tensor<D, typename T::value_type>({config.taps});
-    impl->upconvertCoeffs = Tensor<D, T>({config.center.size(), config.taps});
-
     // Allocate output.
 
     output.coeffs = Tensor<D, T>({config.center.size(), config.taps});
@@ -190,6 +188,10 @@ Result FilterTaps<D, T>::create() {
         JST_CHECK(this->center(i, config.center[i]));
     }
 
+    // The compute starts from the loaded parameters.
+
+    impl->hotConfig.consume(impl->active);
+
     return Result::SUCCESS;
 }
 
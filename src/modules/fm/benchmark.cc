@@ -0,0 +1,48 @@
+#include "jetstream/modules/fm.hh"
+#include "jetstream/backend/devices/cpu/simd.hh"
+#include "jetstream/backend/devices/cpu/dispatch.hh"
+
+namespace Jetstream {
+
+template<template<Device, typename...> class Module, Device D, typename IT, typename OT>
+void benchmark(ankerl::nanobench::Bench& bench, std::string name) {
+    JST_BENCHMARK_RUN("128x8000", {}, {
+        .buffer = Tensor<D COMMA IT>({128 COMMA 8000}) COMMA
+    }, IT, OT);
+
+    JST_BENCHMARK_RUN("128x8000 (128 channels)", {
+        .axis = 1 COMMA
+    }, {
+        .buffer = Tensor<D COMMA IT>({128 COMMA 8000}) COMMA
+    }, IT, OT);
+
+    // Runs every CPU kernel supported by the host on the same buffers.
+    if constexpr (D == Device::CPU) {
+        const U64 size = 128 * 8000;
+        std::vector<IT> input(size, IT(1.0f, 0.5f));
+        std::vector<OT> output(size);
+
+        const std::vector<std::pair<Backend::SimdLevel, Backend::FmDemodulateKernel>> kernels = {
+            {Backend::SimdLevel::Scalar, Backend::FmDemodulateScalar},
+#ifdef JST_SIMD_X86
+            {Backend::SimdLevel::AVX2, Backend::FmDemodulateAVX2},
+            {Backend::SimdLevel::AVX512, Backend::FmDemodulateAVX512},
+#endif
+#ifdef JST_SIMD_NEON
+            {Backend::SimdLevel::NEON, Backend::FmDemodulateNEON},
+#endif
+        };
+
+        for (const auto& [level, kernel] : kernels) {
+            if (!Backend::HostSupportsSimdLevel(level)) {
+                continue;
+            }
+            bench.run(name + "128x8000 (" + Backend::GetSimdLevelName(level) + ")", [&] {
+                kernel(input.data(), IT{}, output.data(), size, 1.0f);
+                ankerl::nanobench::doNotOptimizeAway(output.data());
+            });
+        }
+    }
+}
+
+}  // namespace Jetstream
@@ -1,6 +1,7 @@
 #include "../generic.cc"
 
-#include "jetstream/backend/devices/cpu/helpers.hh"
+#include "jetstream/memory/devices/cpu/helpers.hh"
+#include "jetstream/backend/devices/cpu/simd.hh"
 
 namespace Jetstream {
 
@@ -8,11 +9,23 @@ template<Device D, typename IT, typename OT>
 struct FM<D, IT, OT>::Impl {
     F32 kf;
     F32 ref;
+
+    U64 numberOfChannels = 1;
+    U64 channelSize = 0;
+
+    // Last sample of the previous buffer of every channel.
+    std::vector<IT> previous;
+
+    Backend::FmDemodulateKernel kernel = nullptr;
+    const char* kernelName = "";
 };
 
 template<Device D, typename IT, typename OT>
 FM<D, IT, OT>::FM() {
     impl = std::make_unique<Impl>();
+
+    impl->kernel = Backend::FmDemodulate().kernel();
+    impl->kernelName = Backend::FmDemodulate().name();
 }
 
 template<Device D, typename IT, typename OT>
@@ -23,18 +36,38 @@ FM<D, IT, OT>::~FM() {
 template<Device D, typename IT, typename OT>
 Result FM<D, IT, OT>::createCompute(const Context&) {
     JST_TRACE("Create FM compute core.");
+
+    impl->previous.assign(impl->numberOfChannels, IT{});
+
     return Result::SUCCESS;
 }
 
 template<Device D, typename IT, typename OT>
-Result FM<D, IT, OT>::compute(const Context&) {
-    for (size_t n = 1; n < input.buffer.size(); n++) {
-        output.buffer[n] = std::arg(std::conj(input.buffer[n - 1]) * input.buffer[n]) * impl->ref;
+Result FM<D, IT, OT>::compute(const Context& ctx) {
+    const U64 size = impl->channelSize;
+    if (size == 0) {
+        return Result::SUCCESS;
     }
 
+    const IT* in = input.buffer.data();
+    OT* out = output.buffer.data();
+
+    // Channels are independent, so they're split across the pool.
+
+    const U64 chunks = input.buffer.size() / Memory::CPU::ParallelIteratorGrain;
+
+    Memory::CPU::ParallelRanges(ctx.cpu->pool(), impl->numberOfChannels, chunks, [&](const U64& begin, const U64& end) {
+        for (U64 c = begin; c < end; c++) {
+            const IT* samples = in + c * size;
+            impl->kernel(samples, impl->previous[c], out + c * size, size, impl->ref);
+            impl->previous[c] = samples[size - 1];
+        }
+    });
+
     return Result::SUCCESS;
 }
 
 JST_FM_CPU(JST_INSTANTIATION)
+JST_FM_CPU(JST_BENCHMARK)
 
 }  // namespace Jetstream
@@ -0,0 +1,148 @@
+#include "../generic.cc"
+
+#include "jetstream/memory/devices/cuda/copy.hh"
+
+namespace Jetstream {
+
+template<Device D, typename IT, typename OT>
+struct FM<D, IT, OT>::Impl {
+    F32 kf;
+    F32 ref;
+
+    U64 numberOfChannels = 1;
+    U64 channelSize = 0;
+
+    std::vector<U64> grid;
+    std::vector<U64> block;
+    std::vector<U64> carryGrid;
+    std::vector<U64> carryBlock;
+
+    std::vector<void*> arguments;
+    std::vector<void*> carryArguments;
+
+    Tensor<Device::CUDA, IT> input;
+
+    // Last sample of the previous buffer of every channel.
+    Tensor<Device::CUDA, IT> previous;
+
+    U64 numberOfElements = 0;
+};
+
+template<Device D, typename IT, typename OT>
+FM<D, IT, OT>::FM() {
+    impl = std::make_unique<Impl>();
+}
+
+template<Device D, typename IT, typename OT>
+FM<D, IT, OT>::~FM() {
+    impl.reset();
+}
+
+template<Device D, typename IT, typename OT>
+Result FM<D, IT, OT>::createCompute(const Context& ctx) {
+    JST_TRACE("Create FM compute core using CUDA backend.");
+
+    // Create CUDA kernels.
+    //
+    // Every thread demodulates one sample against the one before it. The
+    // first sample of every channel reads the last sample of its previous
+    // buffer, which is saved by a second kernel once all threads are done.
+
+    ctx.cuda->createKernel("fm", R"""(
+        __global__ void fm(const float2* input, const float2* previous, float* output, float ref, size_t size, size_t channelSize) {
+            size_t id = blockIdx.x * blockDim.x + threadIdx.x;
+            if (id < size) {
+                const float2 c = input[id];
+                const float2 p = ((id % channelSize) == 0) ? previous[id / channelSize] : input[id - 1];
+                const float re = p.x * c.x + p.y * c.y;
+                const float im = p.x * c.y - p.y * c.x;
+                output[id] = atan2f(im, re) * ref;
+            }
+        }
+    )""");
+
+    ctx.cuda->createKernel("fm_carry", R"""(
+        __global__ void fm_carry(const float2* input, float2* previous, size_t channels, size_t channelSize) {
+            size_t id = blockIdx.x * blockDim.x + threadIdx.x;
+            if (id < channels) {
+                previous[id] = input[id * channelSize + channelSize - 1];
+            }
+        }
+    )""");
+
+    // Allocate carried samples. Zero-filled by the allocator.
+
+    impl->previous = Tensor<Device::CUDA, IT>({impl->numberOfChannels});
+
+    // Initialize kernel size.
+
+    impl->numberOfElements = input.buffer.size();
+
+    U64 threadsPerBlock = 512;
+    U64 blocksPerGrid = (impl->numberOfElements + threadsPerBlock - 1) / threadsPerBlock;
+
+    impl->grid = { blocksPerGrid, 1, 1 };
+    impl->block = { threadsPerBlock, 1, 1 };
+
+    U64 carryThreadsPerBlock = std::clamp<U64>(impl->numberOfChannels, 1, 256);
+    U64 carryBlocksPerGrid = (impl->numberOfChannels + carryThreadsPerBlock - 1) / carryThreadsPerBlock;
+
+    impl->carryGrid = { carryBlocksPerGrid, 1, 1 };
+    impl->carryBlock = { carryThreadsPerBlock, 1, 1 };
+
+    // Initialize kernel input.
+
+    if (!input.buffer.device_native() && input.buffer.contiguous()) {
+        impl->input = Tensor<Device::CUDA, IT>(input.buffer.shape());
+    } else {
+        impl->input = input.buffer;
+    }
+
+    // Initialize kernel arguments.
+
+    impl->arguments = {
+        impl->input.data_ptr(),
+        impl->previous.data_ptr(),
+        output.buffer.data_ptr(),
+        &impl->ref,
+        &impl->numberOfElements,
+        &impl->channelSize,
+    };
+
+    impl->carryArguments = {
+        impl->input.data_ptr(),
+        impl->previous.data_ptr(),
+        &impl->numberOfChannels,
+        &impl->channelSize,
+    };
+
+    return Result::SUCCESS;
+}
+
+template<Device D, typename IT, typename OT>
+Result FM<D, IT, OT>::compute(const Context& ctx) {
+    if (impl->numberOfElements == 0) {
+        return Result::SUCCESS;
+    }
+
+    if (!input.buffer.device_native() && input.buffer.contiguous()) {
+        JST_CHECK(Memory::Copy(impl->input, input.buffer, ctx.cuda->stream()));
+    }
+
+    JST_CHECK(ctx.cuda->launchKernel("fm",
+                                     impl->grid,
+                                     impl->block,
+                                     impl->arguments.data()));
+
+    JST_CHECK(ctx.cuda->launchKernel("fm_carry",
+                                     impl->carryGrid,
+                                     impl->carryBlock,
+                                     impl->carryArguments.data()));
+
+    return Result::SUCCESS;
+}
+
+JST_FM_CUDA(JST_INSTANTIATION)
+JST_FM_CUDA(JST_BENCHMARK)
+
+}  // namespace Jetstream
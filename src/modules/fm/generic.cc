@@ -1,5 +1,7 @@
 #include "jetstream/modules/fm.hh"
 
+#include "benchmark.cc"
+
 namespace Jetstream {
 
 template<Device D, typename IT, typename OT>
@@ -7,6 +9,24 @@ Result FM<D, IT, OT>::create() {
     JST_DEBUG("Initializing FM module.");
     JST_INIT_IO();
 
+    // Check parameters.
+
+    if (input.buffer.rank() > 0 && config.axis >= input.buffer.rank()) {
+        JST_ERROR("Sample axis ({}) is out of range for a tensor of rank {}.",
+                  config.axis, input.buffer.rank());
+        return Result::ERROR;
+    }
+
+    // Calculate parameters.
+    //
+    // Every channel keeps the last sample of its previous buffer.
+
+    impl->numberOfChannels = 1;
+    for (U64 i = 0; i < config.axis; i++) {
+        impl->numberOfChannels *= input.buffer.shape()[i];
+    }
+    impl->channelSize = (impl->numberOfChannels > 0) ? input.buffer.size() / impl->numberOfChannels : 0;
+
     // Initialize constant coefficients.
 
     impl->kf = 100e3f / config.sampleRate;
@@ -22,6 +42,10 @@ Result FM<D, IT, OT>::create() {
 template<Device D, typename IT, typename OT>
 void FM<D, IT, OT>::info() const {
     JST_DEBUG("  Sample Rate: {:.2f} MHz", config.sampleRate / JST_MHZ);
+    JST_DEBUG("  Channels:    {}", impl->numberOfChannels);
+    if constexpr (D == Device::CPU) {
+        JST_DEBUG("  Kernel:      {}", impl->kernelName);
+    }
 }
 
 }  // namespace Jetstream
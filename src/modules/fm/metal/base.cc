@@ -0,0 +1,137 @@
+#include "../generic.cc"
+
+namespace Jetstream {
+
+// Every thread demodulates one sample against the one before it. The first
+// sample of every channel reads the last sample of its previous buffer,
+// which is saved by a second pass once all threads are done.
+
+static const char shadersSrc[] = R"""(
+    #include <metal_stdlib>
+    #include <metal_math>
+
+    using namespace metal;
+
+    struct Constants {
+        ulong size;
+        ulong channels;
+        ulong channelSize;
+        float ref;
+    };
+
+    kernel void fm(constant Constants& constants [[ buffer(0) ]],
+                   constant const float2 *input [[ buffer(1) ]],
+                   device const float2 *previous [[ buffer(2) ]],
+                   device float *output [[ buffer(3) ]],
+                   uint id[[ thread_position_in_grid ]]) {
+        if (id >= constants.size) {
+            return;
+        }
+
+        const float2 c = input[id];
+        const float2 p = ((id % constants.channelSize) == 0) ? previous[id / constants.channelSize] : input[id - 1];
+        const float re = p.x * c.x + p.y * c.y;
+        const float im = p.x * c.y - p.y * c.x;
+        output[id] = precise::atan2(im, re) * constants.ref;
+    }
+
+    kernel void fm_carry(constant Constants& constants [[ buffer(0) ]],
+                         constant const float2 *input [[ buffer(1) ]],
+                         device float2 *previous [[ buffer(2) ]],
+                         uint id[[ thread_position_in_grid ]]) {
+        if (id >= constants.channels) {
+            return;
+        }
+
+        previous[id] = input[id * constants.channelSize + constants.channelSize - 1];
+    }
+)""";
+
+template<Device D, typename IT, typename OT>
+struct FM<D, IT, OT>::Impl {
+    F32 kf;
+    F32 ref;
+
+    U64 numberOfChannels = 1;
+    U64 channelSize = 0;
+
+    struct Constants {
+        U64 size;
+        U64 channels;
+        U64 channelSize;
+        F32 ref;
+    };
+
+    MTL::ComputePipelineState* state;
+    MTL::ComputePipelineState* carryState;
+    Tensor<Device::Metal, U8> constants;
+
+    // Last sample of the previous buffer of every channel.
+    Tensor<Device::Metal, IT> previous;
+};
+
+template<Device D, typename IT, typename OT>
+FM<D, IT, OT>::FM() {
+    impl = std::make_unique<Impl>();
+}
+
+template<Device D, typename IT, typename OT>
+FM<D, IT, OT>::~FM() {
+    impl.reset();
+}
+
+template<Device D, typename IT, typename OT>
+Result FM<D, IT, OT>::createCompute(const Context&) {
+    JST_TRACE("Create FM compute core using Metal backend.");
+
+    JST_CHECK(Metal::CompileKernel(shadersSrc, "fm", &impl->state));
+    JST_CHECK(Metal::CompileKernel(shadersSrc, "fm_carry", &impl->carryState));
+
+    auto* constants = Metal::CreateConstants<typename Impl::Constants>(*impl);
+    constants->size = input.buffer.size();
+    constants->channels = impl->numberOfChannels;
+    constants->channelSize = impl->channelSize;
+    constants->ref = impl->ref;
+
+    // Zero-filled by the allocator.
+    impl->previous = Tensor<Device::Metal, IT>({impl->numberOfChannels});
+
+    return Result::SUCCESS;
+}
+
+template<Device D, typename IT, typename OT>
+Result FM<D, IT, OT>::compute(const Context& ctx) {
+    if (input.buffer.size() == 0) {
+        return Result::SUCCESS;
+    }
+
+    {
+        auto cmdEncoder = ctx.metal->commandBuffer()->computeCommandEncoder();
+        cmdEncoder->setComputePipelineState(impl->state);
+        cmdEncoder->setBuffer(impl->constants.data(), 0, 0);
+        cmdEncoder->setBuffer(input.buffer.data(), 0, 1);
+        cmdEncoder->setBuffer(impl->previous.data(), 0, 2);
+        cmdEncoder->setBuffer(output.buffer.data(), 0, 3);
+        cmdEncoder->dispatchThreads(MTL::Size(input.buffer.size(), 1, 1),
+                                    MTL::Size(impl->state->maxTotalThreadsPerThreadgroup(), 1, 1));
+        cmdEncoder->endEncoding();
+    }
+
+    {
+        auto cmdEncoder = ctx.metal->commandBuffer()->computeCommandEncoder();
+        cmdEncoder->setComputePipelineState(impl->carryState);
+        cmdEncoder->setBuffer(impl->constants.data(), 0, 0);
+        cmdEncoder->setBuffer(input.buffer.data(), 0, 1);
+        cmdEncoder->setBuffer(impl->previous.data(), 0, 2);
+        cmdEncoder->dispatchThreads(MTL::Size(impl->numberOfChannels, 1, 1),
+                                    MTL::Size(std::min<U64>(impl->numberOfChannels, impl->carryState->maxTotalThreadsPerThreadgroup()), 1, 1));
+        cmdEncoder->endEncoding();
+    }
+
+    return Result::SUCCESS;
+}
+
+JST_FM_METAL(JST_INSTANTIATION)
+JST_FM_METAL(JST_BENCHMARK)
+
+}  // namespace Jetstream
@@ -1,12 +1,18 @@
 #include "../generic.cc"
 
 #include "jetstream/backend/devices/cpu/helpers.hh"
+#include "jetstream/memory/devices/cpu/helpers.hh"
+#include "jetstream/backend/devices/cpu/simd.hh"
 
 namespace Jetstream {
 
 template<Device D, typename T>
 struct Fold<D, T>::Impl {
     U64 decimationFactor;
+
+    // Contiguous layout around the axis.
+    U64 outer = 1;
+    U64 inner = 1;
 };
 
 template<Device D, typename T>
@@ -20,11 +26,69 @@ Fold<D, T>::~Fold() {
 }
 
 template<Device D, typename T>
-Result Fold<D, T>::compute(const Context&) {
+Result Fold<D, T>::createCompute(const Context&) {
+    JST_TRACE("Create Fold compute core using CPU backend.");
+
+    const auto& shape = input.buffer.shape();
+
+    impl->outer = 1;
+    impl->inner = 1;
+    for (U64 i = 0; i < config.axis; i++) {
+        impl->outer *= shape[i];
+    }
+    for (U64 i = config.axis + 1; i < shape.size(); i++) {
+        impl->inner *= shape[i];
+    }
+
+    JST_TRACE("[FOLD] Outer: {}; Inner: {}; Kernel: {};", impl->outer, impl->inner, Backend::RealAdd().name());
+
+    return Result::SUCCESS;
+}
+
+template<Device D, typename T>
+Result Fold<D, T>::compute(const Context& ctx) {
     // Zero-out output buffer.
 
-    for (U64 i = 0; i < output.buffer.size(); i++) {
-        output.buffer[i] = 0.0f;
+    std::fill_n(output.buffer.data(), output.buffer.size(), T(0.0f));
+
+    if (input.buffer.contiguous()) {
+        // Every block of the axis is added to the output as two contiguous
+        // segments, split where the offset wraps around.
+
+        constexpr U64 parts = std::is_same_v<T, CF32> ? 2 : 1;
+
+        const F32* in = reinterpret_cast<const F32*>(input.buffer.data() + input.buffer.offset());
+        F32* out = reinterpret_cast<F32*>(output.buffer.data());
+
+        const U64 size = config.size;
+        const U64 factor = impl->decimationFactor;
+        const U64 rotation = config.offset % size;
+        const U64 stride = impl->inner * parts;
+        const F32 scale = 1.0f / static_cast<F32>(factor);
+
+        const auto add = Backend::RealAdd().kernel();
+        const U64 chunks = input.buffer.size() / Memory::CPU::ParallelIteratorGrain;
+
+        Memory::CPU::ParallelRanges(ctx.cpu->pool(), impl->outer, chunks, [&](const U64& begin, const U64& end) {
+            for (U64 o = begin; o < end; o++) {
+                const F32* src = in + o * factor * size * stride;
+                F32* dst = out + o * size * stride;
+
+                for (U64 j = 0; j < factor; j++) {
+                    const F32* block = src + j * size * stride;
+                    add(dst + rotation * stride, block, dst + rotation * stride, (size - rotation) * stride);
+                    add(dst, block + (size - rotation) * stride, dst, rotation * stride);
+                }
+
+                // Average output buffer.
+
+                for (U64 i = 0; i < size * stride; i++) {
+                    dst[i] *= scale;
+                }
+            }
+        });
+
+        return Result::SUCCESS;
     }
 
     // Fold input buffer.
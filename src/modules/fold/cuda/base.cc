@@ -0,0 +1,171 @@
+#include "../generic.cc"
+
+#include "jetstream/memory/devices/cuda/copy.hh"
+
+namespace Jetstream {
+
+template<Device D, typename T>
+struct Fold<D, T>::Impl {
+    U64 decimationFactor;
+
+    std::vector<U64> grid;
+    std::vector<U64> block;
+
+    std::vector<void*> arguments;
+
+    Tensor<Device::CUDA, T> input;
+
+    U64 inner = 1;
+    U64 axisSize = 0;
+    U64 numberOfElements = 0;
+    F32 scale = 1.0f;
+};
+
+template<Device D, typename T>
+Fold<D, T>::Fold() {
+    impl = std::make_unique<Impl>();
+}
+
+template<Device D, typename T>
+Fold<D, T>::~Fold() {
+    impl.reset();
+}
+
+template<Device D, typename T>
+Result Fold<D, T>::createCompute(const Context& ctx) {
+    JST_TRACE("Create Fold compute core using CUDA backend.");
+
+    // Create CUDA kernel.
+    //
+    // Every thread owns one output sample and averages the input samples
+    // that fold onto it, so no atomics are needed. Output index f gathers
+    // the inputs at (f + k * size - offset) mod axisSize.
+
+    std::string header;
+
+    if constexpr (std::is_same_v<T, CF32>) {
+        header = R"""(
+            typedef float2 sample_t;
+
+            __device__ inline void accumulate(sample_t& acc, const sample_t& x) {
+                acc.x += x.x;
+                acc.y += x.y;
+            }
+
+            __device__ inline sample_t scaled(const sample_t& x, const float k) {
+                return make_float2(x.x * k, x.y * k);
+            }
+
+            __device__ inline sample_t zero() {
+                return make_float2(0.0f, 0.0f);
+            }
+        )""";
+    } else {
+        header = R"""(
+            typedef float sample_t;
+
+            __device__ inline void accumulate(sample_t& acc, const sample_t& x) {
+                acc += x;
+            }
+
+            __device__ inline sample_t scaled(const sample_t& x, const float k) {
+                return x * k;
+            }
+
+            __device__ inline sample_t zero() {
+                return 0.0f;
+            }
+        )""";
+    }
+
+    ctx.cuda->createKernel("fold", header + R"""(
+        __global__ void fold(const sample_t* input,
+                             sample_t* output,
+                             size_t inner,
+                             size_t axisSize,
+                             size_t foldSize,
+                             size_t offset,
+                             float scale,
+                             size_t size) {
+            size_t id = blockIdx.x * blockDim.x + threadIdx.x;
+            if (id >= size) {
+                return;
+            }
+
+            const size_t i = id % inner;
+            const size_t f = (id / inner) % foldSize;
+            const size_t o = id / (inner * foldSize);
+
+            const sample_t* x = input + o * axisSize * inner + i;
+
+            sample_t acc = zero();
+            for (size_t k = f; k < axisSize; k += foldSize) {
+                const size_t a = (k + axisSize - offset) % axisSize;
+                accumulate(acc, x[a * inner]);
+            }
+
+            output[id] = scaled(acc, scale);
+        }
+    )""");
+
+    // Calculate parameters.
+
+    const auto& shape = input.buffer.shape();
+
+    impl->inner = 1;
+    for (U64 i = config.axis + 1; i < shape.size(); i++) {
+        impl->inner *= shape[i];
+    }
+    impl->axisSize = shape[config.axis];
+    impl->numberOfElements = output.buffer.size();
+    impl->scale = 1.0f / static_cast<F32>(impl->decimationFactor);
+
+    // Initialize kernel size.
+
+    U64 threadsPerBlock = 512;
+    U64 blocksPerGrid = (impl->numberOfElements + threadsPerBlock - 1) / threadsPerBlock;
+
+    impl->grid = { blocksPerGrid, 1, 1 };
+    impl->block = { threadsPerBlock, 1, 1 };
+
+    // Initialize kernel input.
+
+    if (!input.buffer.device_native() && input.buffer.contiguous()) {
+        impl->input = Tensor<Device::CUDA, T>(input.buffer.shape());
+    } else {
+        impl->input = input.buffer;
+    }
+
+    // Initialize kernel arguments.
+
+    impl->arguments = {
+        impl->input.data_ptr(),
+        output.buffer.data_ptr(),
+        &impl->inner,
+        &impl->axisSize,
+        &config.size,
+        &config.offset,
+        &impl->scale,
+        &impl->numberOfElements,
+    };
+
+    return Result::SUCCESS;
+}
+
+template<Device D, typename T>
+Result Fold<D, T>::compute(const Context& ctx) {
+    if (!input.buffer.device_native() && input.buffer.contiguous()) {
+        JST_CHECK(Memory::Copy(impl->input, input.buffer, ctx.cuda->stream()));
+    }
+
+    JST_CHECK(ctx.cuda->launchKernel("fold",
+                                     impl->grid,
+                                     impl->block,
+                                     impl->arguments.data()));
+
+    return Result::SUCCESS;
+}
+
+JST_FOLD_CUDA(JST_INSTANTIATION)
+
+}  // namespace Jetstream
@@ -0,0 +1,110 @@
+#include "../generic.cc"
+
+namespace Jetstream {
+
+// Every thread owns one output sample and averages the input samples that
+// fold onto it, so no atomics are needed. Output index f gathers the inputs
+// at (f + k * size - offset) mod axisSize.
+
+static const char shadersSrc[] = R"""(
+    struct Constants {
+        ulong inner;
+        ulong axisSize;
+        ulong foldSize;
+        ulong offset;
+        ulong size;
+        float scale;
+    };
+
+    kernel void fold(constant Constants& constants [[ buffer(0) ]],
+                     constant const sample_t *input [[ buffer(1) ]],
+                     device sample_t *output [[ buffer(2) ]],
+                     uint id[[ thread_position_in_grid ]]) {
+        if (id >= constants.size) {
+            return;
+        }
+
+        const ulong i = id % constants.inner;
+        const ulong f = (id / constants.inner) % constants.foldSize;
+        const ulong o = id / (constants.inner * constants.foldSize);
+
+        constant const sample_t* x = input + o * constants.axisSize * constants.inner + i;
+
+        sample_t acc = sample_t(0.0f);
+        for (ulong k = f; k < constants.axisSize; k += constants.foldSize) {
+            const ulong a = (k + constants.axisSize - constants.offset) % constants.axisSize;
+            acc += x[a * constants.inner];
+        }
+
+        output[id] = acc * constants.scale;
+    }
+)""";
+
+template<Device D, typename T>
+struct Fold<D, T>::Impl {
+    U64 decimationFactor;
+
+    struct Constants {
+        U64 inner;
+        U64 axisSize;
+        U64 foldSize;
+        U64 offset;
+        U64 size;
+        F32 scale;
+    };
+
+    MTL::ComputePipelineState* state;
+    Tensor<Device::Metal, U8> constants;
+};
+
+template<Device D, typename T>
+Fold<D, T>::Fold() {
+    impl = std::make_unique<Impl>();
+}
+
+template<Device D, typename T>
+Fold<D, T>::~Fold() {
+    impl.reset();
+}
+
+template<Device D, typename T>
+Result Fold<D, T>::createCompute(const Context&) {
+    JST_TRACE("Create Fold compute core using Metal backend.");
+
+    std::string header = "#include <metal_stdlib>\nusing namespace metal;\n";
+    header += std::is_same_v<T, CF32> ? "typedef float2 sample_t;\n" : "typedef float sample_t;\n";
+    JST_CHECK(Metal::CompileKernel((header + shadersSrc).c_str(), "fold", &impl->state));
+
+    const auto& shape = input.buffer.shape();
+
+    auto* constants = Metal::CreateConstants<typename Impl::Constants>(*impl);
+    constants->inner = 1;
+    for (U64 i = config.axis + 1; i < shape.size(); i++) {
+        constants->inner *= shape[i];
+    }
+    constants->axisSize = shape[config.axis];
+    constants->foldSize = config.size;
+    constants->offset = config.offset;
+    constants->size = output.buffer.size();
+    constants->scale = 1.0f / static_cast<F32>(impl->decimationFactor);
+
+    return Result::SUCCESS;
+}
+
+template<Device D, typename T>
+Result Fold<D, T>::compute(const Context& ctx) {
+    auto cmdEncoder = ctx.metal->commandBuffer()->computeCommandEncoder();
+    cmdEncoder->setComputePipelineState(impl->state);
+    cmdEncoder->setBuffer(impl->constants.data(), 0, 0);
+    cmdEncoder->setBuffer(input.buffer.data(), 0, 1);
+    cmdEncoder->setBuffer(output.buffer.data(), 0, 2);
+    cmdEncoder->dispatchThreads(MTL::Size(output.buffer.size(), 1, 1),
+                                MTL::Size(impl->state->maxTotalThreadsPerThreadgroup(), 1, 1));
+    cmdEncoder->endEncoding();
+
+    return Result::SUCCESS;
+}
+
+JST_FOLD_METAL(JST_INSTANTIATION)
+
+}  // namespace Jetstream
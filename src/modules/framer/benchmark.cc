@@ -0,0 +1,20 @@
+#include "jetstream/modules/framer.hh"
+
+namespace Jetstream {
+
+template<template<Device, typename...> class Module, Device D, typename T>
+void benchmark(ankerl::nanobench::Bench& bench, std::string name) {
+    JST_BENCHMARK_RUN("8x8192 (1/2)", {
+        .hop = 4096 COMMA
+    }, {
+        .buffer = Tensor<D COMMA T>({8 COMMA 8192}) COMMA
+    }, T);
+
+    JST_BENCHMARK_RUN("8x8192 (3/4)", {
+        .hop = 2048 COMMA
+    }, {
+        .buffer = Tensor<D COMMA T>({8 COMMA 8192}) COMMA
+    }, T);
+}
+
+}  // namespace Jetstream
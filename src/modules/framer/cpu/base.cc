@@ -0,0 +1,68 @@
+#include "../generic.cc"
+
+#include "jetstream/memory/devices/cpu/helpers.hh"
+
+namespace Jetstream {
+
+template<Device D, typename T>
+struct Framer<D, T>::Impl {
+    U64 frameSize = 0;
+    U64 hop = 0;
+    U64 inputSize = 0;
+    U64 historySize = 0;
+    U64 numberOfFrames = 0;
+
+    // Last frameSize - hop samples followed by the current buffer, oldest
+    // first.
+    std::vector<T> samples;
+};
+
+template<Device D, typename T>
+Framer<D, T>::Framer() {
+    impl = std::make_unique<Impl>();
+}
+
+template<Device D, typename T>
+Framer<D, T>::~Framer() {
+    impl.reset();
+}
+
+template<Device D, typename T>
+Result Framer<D, T>::createCompute(const Context&) {
+    JST_TRACE("Create Framer compute core using CPU backend.");
+
+    impl->samples.assign(impl->historySize + impl->inputSize, T{});
+
+    return Result::SUCCESS;
+}
+
+template<Device D, typename T>
+Result Framer<D, T>::compute(const Context& ctx) {
+    const U64 frameSize = impl->frameSize;
+    const U64 hop = impl->hop;
+    const U64 historySize = impl->historySize;
+
+    T* samples = impl->samples.data();
+    std::copy_n(input.buffer.data() + input.buffer.offset(), impl->inputSize, samples + historySize);
+
+    T* out = output.buffer.data();
+
+    const U64 chunks = output.buffer.size() / Memory::CPU::ParallelIteratorGrain;
+
+    Memory::CPU::ParallelRanges(ctx.cpu->pool(), impl->numberOfFrames, chunks, [&](const U64& begin, const U64& end) {
+        for (U64 f = begin; f < end; f++) {
+            std::copy_n(samples + f * hop, frameSize, out + f * frameSize);
+        }
+    });
+
+    // Keep the tail as the history of the next buffer.
+
+    std::copy(samples + impl->inputSize, samples + impl->inputSize + historySize, samples);
+
+    return Result::SUCCESS;
+}
+
+JST_FRAMER_CPU(JST_INSTANTIATION)
+JST_FRAMER_CPU(JST_BENCHMARK)
+
+}  // namespace Jetstream
@@ -0,0 +1,169 @@
+#include "../generic.cc"
+
+#include "jetstream/memory/devices/cuda/copy.hh"
+
+namespace Jetstream {
+
+template<Device D, typename T>
+struct Framer<D, T>::Impl {
+    U64 frameSize = 0;
+    U64 hop = 0;
+    U64 inputSize = 0;
+    U64 historySize = 0;
+    U64 numberOfFrames = 0;
+
+    std::vector<U64> grid;
+    std::vector<U64> block;
+    std::vector<U64> historyGrid;
+
+    std::vector<void*> arguments;
+    std::vector<void*> historyArguments;
+
+    Tensor<Device::CUDA, T> input;
+
+    // Last frameSize - hop samples, oldest first. The next history is written
+    // apart and copied back, so buffers shorter than the history don't race.
+    Tensor<Device::CUDA, T> history;
+    Tensor<Device::CUDA, T> nextHistory;
+
+    U64 numberOfElements = 0;
+};
+
+template<Device D, typename T>
+Framer<D, T>::Framer() {
+    impl = std::make_unique<Impl>();
+}
+
+template<Device D, typename T>
+Framer<D, T>::~Framer() {
+    impl.reset();
+}
+
+template<Device D, typename T>
+Result Framer<D, T>::createCompute(const Context& ctx) {
+    JST_TRACE("Create Framer compute core using CUDA backend.");
+
+    // Create CUDA kernels.
+    //
+    // Each thread copies one sample of one frame from [history | input].
+
+    std::string header;
+
+    if constexpr (std::is_same_v<T, CF32>) {
+        header = R"""(
+            typedef float2 sample_t;
+        )""";
+    } else {
+        header = R"""(
+            typedef float sample_t;
+        )""";
+    }
+
+    ctx.cuda->createKernel("framer", header + R"""(
+        __global__ void framer(const sample_t* input,
+                               const sample_t* history,
+                               sample_t* output,
+                               size_t frameSize,
+                               size_t hop,
+                               size_t historySize,
+                               size_t size) {
+            size_t id = blockIdx.x * blockDim.x + threadIdx.x;
+            if (id >= size) {
+                return;
+            }
+
+            const size_t n = (id / frameSize) * hop + (id % frameSize);
+            output[id] = (n < historySize) ? history[n] : input[n - historySize];
+        }
+    )""");
+
+    ctx.cuda->createKernel("framer_history", header + R"""(
+        __global__ void framer_history(const sample_t* input,
+                                       const sample_t* history,
+                                       sample_t* nextHistory,
+                                       size_t inputSize,
+                                       size_t historySize) {
+            size_t id = blockIdx.x * blockDim.x + threadIdx.x;
+            if (id >= historySize) {
+                return;
+            }
+
+            const size_t n = inputSize + id;
+            nextHistory[id] = (n < historySize) ? history[n] : input[n - historySize];
+        }
+    )""");
+
+    // Allocate history. Zero-filled by the allocator.
+
+    const U64 historyLength = std::max<U64>(impl->historySize, 1);
+    impl->history = Tensor<Device::CUDA, T>({historyLength});
+    impl->nextHistory = Tensor<Device::CUDA, T>({historyLength});
+
+    // Initialize kernel size.
+
+    impl->numberOfElements = output.buffer.size();
+
+    U64 threadsPerBlock = 256;
+
+    impl->grid = { (impl->numberOfElements + threadsPerBlock - 1) / threadsPerBlock, 1, 1 };
+    impl->historyGrid = { (impl->historySize + threadsPerBlock - 1) / threadsPerBlock, 1, 1 };
+    impl->block = { threadsPerBlock, 1, 1 };
+
+    // Initialize kernel input.
+
+    if (!input.buffer.device_native() && input.buffer.contiguous()) {
+        impl->input = Tensor<Device::CUDA, T>(input.buffer.shape());
+    } else {
+        impl->input = input.buffer;
+    }
+
+    // Initialize kernel arguments.
+
+    impl->arguments = {
+        impl->input.data_ptr(),
+        impl->history.data_ptr(),
+        output.buffer.data_ptr(),
+        &impl->frameSize,
+        &impl->hop,
+        &impl->historySize,
+        &impl->numberOfElements,
+    };
+
+    impl->historyArguments = {
+        impl->input.data_ptr(),
+        impl->history.data_ptr(),
+        impl->nextHistory.data_ptr(),
+        &impl->inputSize,
+        &impl->historySize,
+    };
+
+    return Result::SUCCESS;
+}
+
+template<Device D, typename T>
+Result Framer<D, T>::compute(const Context& ctx) {
+    if (!input.buffer.device_native() && input.buffer.contiguous()) {
+        JST_CHECK(Memory::Copy(impl->input, input.buffer, ctx.cuda->stream()));
+    }
+
+    JST_CHECK(ctx.cuda->launchKernel("framer",
+                                     impl->grid,
+                                     impl->block,
+                                     impl->arguments.data()));
+
+    if (impl->historySize > 0) {
+        JST_CHECK(ctx.cuda->launchKernel("framer_history",
+                                         impl->historyGrid,
+                                         impl->block,
+                                         impl->historyArguments.data()));
+
+        JST_CHECK(Memory::Copy(impl->history, impl->nextHistory, ctx.cuda->stream()));
+    }
+
+    return Result::SUCCESS;
+}
+
+JST_FRAMER_CUDA(JST_INSTANTIATION)
+JST_FRAMER_CUDA(JST_BENCHMARK)
+
+}  // namespace Jetstream
@@ -0,0 +1,54 @@
+#include "jetstream/modules/framer.hh"
+
+#include "benchmark.cc"
+
+namespace Jetstream {
+
+template<Device D, typename T>
+Result Framer<D, T>::create() {
+    JST_DEBUG("Initializing Framer module.");
+    JST_INIT_IO();
+
+    // Calculate parameters.
+    //
+    // The input is read as a stream of samples, row after row. Each frame is
+    // as long as the last axis unless set, and starts a hop after the
+    // previous one. Frames longer than the input slide over past buffers.
+
+    impl->frameSize = (config.size == 0) ? input.buffer.shape().back() : config.size;
+    impl->hop = (config.hop == 0) ? impl->frameSize : config.hop;
+    impl->inputSize = input.buffer.size();
+
+    // Check parameters.
+
+    if (impl->hop > impl->frameSize) {
+        JST_ERROR("Hop ({}) should not be larger than the frame size ({}).", impl->hop, impl->frameSize);
+        return Result::ERROR;
+    }
+
+    if ((impl->inputSize % impl->hop) != 0) {
+        JST_ERROR("Input size ({}) should be a multiple of the hop ({}).", impl->inputSize, impl->hop);
+        return Result::ERROR;
+    }
+
+    // The overlap of the first frame comes from the previous buffer, so every
+    // hop of the input ends exactly one frame.
+
+    impl->historySize = impl->frameSize - impl->hop;
+    impl->numberOfFrames = impl->inputSize / impl->hop;
+
+    // Allocate output.
+
+    output.buffer = Tensor<D, T>({impl->numberOfFrames, impl->frameSize});
+
+    return Result::SUCCESS;
+}
+
+template<Device D, typename T>
+void Framer<D, T>::info() const {
+    JST_DEBUG("  Frame Size: {}", impl->frameSize);
+    JST_DEBUG("  Hop:        {}", impl->hop);
+    JST_DEBUG("  Frames:     {}", impl->numberOfFrames);
+}
+
+}  // namespace Jetstream
@@ -0,0 +1,12 @@
+#include "jetstream/modules/history.hh"
+
+namespace Jetstream {
+
+template<template<Device, typename...> class Module, Device D, typename T>
+void benchmark(ankerl::nanobench::Bench& bench, std::string name) {
+    JST_BENCHMARK_RUN("8x8192", {}, {
+        .buffer = Tensor<D COMMA T>({8 COMMA 8192}) COMMA
+    }, T);
+}
+
+}  // namespace Jetstream
@@ -0,0 +1,129 @@
+#include "../generic.cc"
+
+#include <optional>
+
+#include "jetstream/memory/devices/cpu/pool.hh"
+
+namespace Jetstream {
+
+template<Device D, typename T>
+struct History<D, T>::Impl {
+    U64 frameSize = 0;
+    U64 capacity = 0;
+    U64 span = 0;
+    std::atomic<U64> delay = 0;
+
+    // Last capacity frames, indexed by frame number modulo their count. The
+    // first span - 1 slots are repeated past the end, so every window of
+    // span frames is contiguous even when it wraps around.
+    Tensor<Device::CPU, T> ring;
+
+    // Output buffer while it points into the ring.
+    std::shared_ptr<TensorBuffer<Device::CPU>> window;
+
+    U64 frame = 0;
+    std::atomic<bool> trigger = false;
+    U64 triggers = 0;
+};
+
+template<Device D, typename T>
+History<D, T>::History() {
+    impl = std::make_unique<Impl>();
+}
+
+template<Device D, typename T>
+History<D, T>::~History() {
+    impl.reset();
+}
+
+template<Device D, typename T>
+Result History<D, T>::createCompute(const Context&) {
+    JST_TRACE("Create History compute core using CPU backend.");
+
+    // The ring can be large and lives as long as the graph. Huge pages cut
+    // the TLB misses of walking it and pinning lets CUDA copy windows out of
+    // it asynchronously.
+
+    std::optional<CPUMemoryPool::ScopedHints> memoryHints;
+    if (config.hugePages || config.pinned) {
+        memoryHints.emplace(CPUMemoryHints{
+            .hugePages = config.hugePages,
+            .pinned = config.pinned,
+        });
+    }
+
+    impl->ring = Tensor<Device::CPU, T>({(impl->capacity + impl->span - 1) * impl->frameSize});
+
+    impl->frame = 0;
+    impl->trigger = false;
+    impl->triggers = 0;
+
+    return Result::SUCCESS;
+}
+
+template<Device D, typename T>
+bool History<D, T>::computeForwarding() const {
+    return impl->window != nullptr;
+}
+
+template<Device D, typename T>
+Result History<D, T>::computeMaterialize() {
+    if (!impl->window) {
+        return Result::SUCCESS;
+    }
+
+    JST_DEBUG("[HISTORY] Output is modified in-place. Copying the window from now on.");
+
+    JST_CHECK(impl->window->unalias());
+    impl->window.reset();
+
+    return Result::SUCCESS;
+}
+
+template<Device D, typename T>
+Result History<D, T>::compute(const Context&) {
+    const U64 frameSize = impl->frameSize;
+    const U64 capacity = impl->capacity;
+    const U64 span = impl->span;
+    T* ring = impl->ring.data();
+
+    // Store the newest frame.
+
+    const T* frame = input.buffer.data() + input.buffer.offset();
+    const U64 slot = impl->frame % capacity;
+
+    std::copy_n(frame, frameSize, ring + slot * frameSize);
+    if (slot + 1 < span) {
+        std::copy_n(frame, frameSize, ring + (capacity + slot) * frameSize);
+    }
+
+    impl->frame += 1;
+
+    // Move the window. Frames older than the ring hold zeros until it fills up.
+
+    const U64 delay = impl->delay.load(std::memory_order_relaxed);
+    const T* window = ring + ((impl->frame + capacity - delay - span) % capacity) * frameSize;
+
+    if (impl->window) {
+        if (impl->window->data() != window) {
+            JST_CHECK(impl->window->alias(const_cast<T*>(window)));
+        }
+    } else {
+        std::copy_n(window, span * frameSize, output.buffer.data());
+    }
+
+    // Open the gate for one frame after a trigger.
+
+    const bool gate = impl->trigger.exchange(false, std::memory_order_relaxed);
+    if (gate) {
+        impl->triggers += 1;
+    }
+    output.buffer.attribute("gate").set(gate);
+
+    return Result::SUCCESS;
+}
+
+JST_HISTORY_CPU(JST_INSTANTIATION)
+JST_HISTORY_CPU(JST_BENCHMARK)
+
+}  // namespace Jetstream
@@ -0,0 +1,107 @@
+#include "jetstream/modules/history.hh"
+
+#include "benchmark.cc"
+
+namespace Jetstream {
+
+template<Device D, typename T>
+Result History<D, T>::create() {
+    JST_DEBUG("Initializing History module.");
+    JST_INIT_IO();
+
+    // Check parameters.
+
+    if (config.sampleRate <= 0.0f) {
+        JST_ERROR("Invalid sample rate: {}. Sample rate should be positive.", config.sampleRate);
+        return Result::ERROR;
+    }
+
+    if (config.duration <= 0.0f || config.window <= 0.0f) {
+        JST_ERROR("Invalid duration ({} s) or window ({} s). Both should be positive.",
+                  config.duration, config.window);
+        return Result::ERROR;
+    }
+
+    // Calculate parameters.
+    //
+    // Every compute is one frame. The ring holds the frames of the last
+    // duration seconds and the output is a window of them, ending delay
+    // seconds before the newest frame.
+
+    const F64 framesPerSecond = config.sampleRate / static_cast<F64>(input.buffer.size());
+
+    impl->frameSize = input.buffer.size();
+    impl->capacity = std::max<U64>(1, std::ceil(config.duration * framesPerSecond));
+    impl->span = std::clamp<U64>(std::ceil(config.window * framesPerSecond), 1, impl->capacity);
+    impl->delay = std::min<U64>(std::round(std::max(config.delay, 0.0f) * framesPerSecond),
+                                impl->capacity - impl->span);
+
+    // Allocate output.
+    //
+    // The output holds the window frames back to back. On the CPU it points
+    // into the ring instead, so moving the window is a pointer advance. The
+    // gate travels with the output as an attribute, consumers like the File
+    // Writer only take the window while it's open.
+
+    auto shape = input.buffer.shape();
+    shape[0] *= impl->span;
+    output.buffer = Tensor<D, T>(shape);
+    output.buffer.attribute("gate").set(false);
+
+    if constexpr (D == Device::CPU) {
+        const auto& clones = output.buffer.storage_metadata()->clones;
+        impl->window = std::any_cast<std::shared_ptr<TensorBuffer<Device::CPU>>>(clones.at(Device::CPU));
+    }
+
+    return Result::SUCCESS;
+}
+
+template<Device D, typename T>
+void History<D, T>::info() const {
+    JST_DEBUG("  Sample Rate: {:.2f} MHz", config.sampleRate / JST_MHZ);
+    JST_DEBUG("  Duration:    {:.3f} s ({} frames)", config.duration, impl->capacity);
+    JST_DEBUG("  Window:      {:.3f} s ({} frames)", config.window, impl->span);
+    JST_DEBUG("  Delay:       {:.3f} s ({} frames)", config.delay, impl->delay.load());
+    JST_DEBUG("  Huge Pages:  {}", config.hugePages);
+    JST_DEBUG("  Pinned:      {}", config.pinned);
+}
+
+template<Device D, typename T>
+Result History<D, T>::setDelay(F32& delay) {
+    const F64 framesPerSecond = config.sampleRate / static_cast<F64>(impl->frameSize);
+    const F64 frames = std::round(delay * framesPerSecond);
+
+    if (delay < 0.0f || frames > static_cast<F64>(impl->capacity - impl->span)) {
+        JST_WARN("Invalid delay: {} s. Delay should be between 0 and {:.3f} s.",
+                 delay, (impl->capacity - impl->span) / framesPerSecond);
+        delay = config.delay;
+        return Result::WARNING;
+    }
+
+    config.delay = delay;
+    impl->delay.store(static_cast<U64>(frames), std::memory_order_relaxed);
+
+    return Result::SUCCESS;
+}
+
+template<Device D, typename T>
+void History<D, T>::trigger() {
+    impl->trigger.store(true, std::memory_order_relaxed);
+}
+
+template<Device D, typename T>
+U64 History<D, T>::frames() const {
+    return std::min(impl->frame, impl->capacity);
+}
+
+template<Device D, typename T>
+U64 History<D, T>::capacity() const {
+    return impl->capacity;
+}
+
+template<Device D, typename T>
+U64 History<D, T>::triggers() const {
+    return impl->triggers;
+}
+
+}  // namespace Jetstream
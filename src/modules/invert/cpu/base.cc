@@ -24,11 +24,18 @@ Result Invert<D, T>::createCompute(const Context&) {
 }
 
 template<Device D, typename T>
-Result Invert<D, T>::compute(const Context&) {
+Result Invert<D, T>::compute(const Context& ctx) {
+    return computeSlice(ctx, 0, input.buffer.size());
+}
+
+template<Device D, typename T>
+Result Invert<D, T>::computeSlice(const Context&, const U64& offset, const U64& size) {
     const auto* in = reinterpret_cast<std::pair<T, T>*>(input.buffer.data());
     auto* out = reinterpret_cast<std::pair<T, T>*>(output.buffer.data());
 
-    for (U64 i = 0; i < input.buffer.size() / 2; i++) {
+    // Slices start at even elements because samples are inverted in pairs.
+
+    for (U64 i = offset / 2; i < (offset + size) / 2; i++) {
         const auto& [in_even, in_odd] = in[i];
         auto& [out_even, out_odd] = out[i];
 
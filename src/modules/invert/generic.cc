@@ -11,14 +11,26 @@ Result Invert<D, T>::create() {
 
     // Allocate output.
 
-    output.buffer = Tensor<D, T>(input.buffer.shape());
+    if (config.inPlace) {
+        if constexpr (D != Device::CPU) {
+            JST_ERROR("Invert can't run in-place on the {} backend.", D);
+            return Result::ERROR;
+        }
+
+        JST_CHECK(Module::InitInPlaceOutput(output.buffer, input.buffer));
+    } else if constexpr (D == Device::CPU) {
+        // Skip zero-filling CPU memory fully written by the first compute.
+        output.buffer = Tensor<D, T>(input.buffer.shape(), false);
+    } else {
+        output.buffer = Tensor<D, T>(input.buffer.shape());
+    }
 
     return Result::SUCCESS;
 }
 
 template<Device D, typename T>
 void Invert<D, T>::info() const {
-    JST_DEBUG("  None");
+    JST_DEBUG("  In-Place: {}", config.inPlace);
 }
 
 }  // namespace Jetstream
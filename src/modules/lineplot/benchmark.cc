@@ -11,6 +11,20 @@ void benchmark(ankerl::nanobench::Bench& bench, std::string name) {
     JST_BENCHMARK_RUN("128x8000", {}, {
         .buffer = Tensor<D COMMA T>({128 COMMA 8000}) COMMA
     }, T);
+
+    JST_BENCHMARK_RUN("1x1048576 Average", {
+        .decimation = 512 COMMA
+        .decimationMode = LineplotDecimation::Average COMMA
+    }, {
+        .buffer = Tensor<D COMMA T>({1 COMMA 1048576}) COMMA
+    }, T);
+
+    JST_BENCHMARK_RUN("1x1048576 Max", {
+        .decimation = 512 COMMA
+        .decimationMode = LineplotDecimation::Max COMMA
+    }, {
+        .buffer = Tensor<D COMMA T>({1 COMMA 1048576}) COMMA
+    }, T);
 }
 
 }  // namespace Jetstream
\ No newline at end of file
@@ -1,6 +1,8 @@
 #include "../generic.cc"
 
 #include "jetstream/backend/devices/cpu/helpers.hh"
+#include "jetstream/backend/devices/cpu/simd.hh"
+#include "jetstream/memory/devices/cpu/helpers.hh"
 
 namespace Jetstream {
 
@@ -9,6 +11,8 @@ struct Lineplot<D, T>::Impl {
     Tensor<Device::CPU, F32> sums;
     Tensor<Device::CPU, F32> averaging;
     Tensor<Device::CPU, F32> line;
+
+    Backend::BinReduceKernel reduce = nullptr;
 };
 
 template<Device D, typename T>
@@ -25,7 +29,20 @@ Lineplot<D, T>::~Lineplot() {
 
 template<Device D, typename T>
 Result Lineplot<D, T>::createCompute(const Context&) {
-    JST_TRACE("Create Multiply compute core using CPU backend.");
+    JST_TRACE("Create Lineplot compute core using CPU backend.");
+
+    switch (config.decimationMode) {
+        case LineplotDecimation::Min:
+            pimpl->reduce = Backend::BinMin().kernel();
+            break;
+        case LineplotDecimation::Max:
+        case LineplotDecimation::PeakHold:
+            pimpl->reduce = Backend::BinMax().kernel();
+            break;
+        default:
+            pimpl->reduce = Backend::BinSum().kernel();
+            break;
+    }
 
     pimpl->sums = Tensor<Device::CPU, F32>({gimpl->numberOfElements});
     pimpl->averaging = Tensor<Device::CPU, F32>({gimpl->numberOfElements});
@@ -35,34 +52,55 @@ Result Lineplot<D, T>::createCompute(const Context&) {
         gimpl->signalPoints[(i * 2) + 1] = 0.0f;
     }
 
+    gimpl->signalSnapshot.forEach([&](auto& snapshot) {
+        snapshot = Tensor<Device::CPU, F32>({gimpl->numberOfElements});
+    });
+
     return Result::SUCCESS;
 }
 
 template<Device D, typename T>
-Result Lineplot<D, T>::compute(const Context&) {
-    for (U64 i = 0; i < gimpl->numberOfElements; i++) {
-        pimpl->sums[i] = 0.0f;
-    }
+Result Lineplot<D, T>::compute(const Context& ctx) {
+    const U64 bins = gimpl->numberOfElements;
+    const F32* in = input.buffer.data();
+    F32* sums = pimpl->sums.data();
+    F32* averaging = pimpl->averaging.data();
+    F32* line = gimpl->signalSnapshot.back().data();
+
+    const bool peakHold = config.decimationMode == LineplotDecimation::PeakHold;
+    const F32 factor = gimpl->normalizationFactor;
+    const F32 rate = 1.0f / static_cast<F32>(config.averaging);
+    const Backend::BinReduceKernel reduce = pimpl->reduce;
+
+    // Ranges of points are reduced over every batch independently.
 
-    for (U64 b = 0; b < gimpl->numberOfBatches; b++) {
-        for (U64 i = 0; i < gimpl->numberOfElements; i++) {
-            pimpl->sums[i] += input.buffer[(i * config.decimation) + b * gimpl->numberOfElements];
+    const U64 chunks = input.buffer.size() / Memory::CPU::ParallelIteratorGrain;
+
+    Memory::CPU::ParallelRanges(ctx.cpu->pool(), bins, chunks, [&](const U64& begin, const U64& end) {
+        std::fill(sums + begin, sums + end, 0.0f);
+
+        for (U64 b = 0; b < gimpl->numberOfBatches; b++) {
+            reduce(in + b * gimpl->rowSize + begin * config.decimation, sums + begin, end - begin, config.decimation);
         }
-    }
 
-    for (U64 i = 0; i < gimpl->numberOfElements; i++) {
-        // Get amplitude
-        const auto& amplitude = (pimpl->sums[i] * gimpl->normalizationFactor) - 1.0f;
+        for (U64 i = begin; i < end; i++) {
+            // Get amplitude
+            const F32 amplitude = (sums[i] * factor) - 1.0f;
 
-        // Calculate moving average
-        auto& average = pimpl->averaging[i];
-        average -= average / config.averaging;
-        average += amplitude / config.averaging;
+            // Calculate moving average or peak hold
+            F32& average = averaging[i];
+            if (peakHold && amplitude > average) {
+                average = amplitude;
+            } else {
+                average += (amplitude - average) * rate;
+            }
 
-        gimpl->signalPoints[(i * 2) + 1] = average;
-    }
+            line[i] = average;
+        }
+    });
 
-    gimpl->updateSignalPointsFlag = true;
+    // Hand the line over to present.
+    gimpl->signalSnapshot.publish();
 
     return Result::SUCCESS;
 }
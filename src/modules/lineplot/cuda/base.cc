@@ -12,6 +12,8 @@ struct Lineplot<D, T>::Impl {
     std::vector<void*> argumentsLineplot;
 
     Tensor<Device::CUDA, T> input;
+
+    U32 mode = 0;
 };
 
 template<Device D, typename T>
@@ -32,21 +34,44 @@ Result Lineplot<D, T>::createCompute(const Context& ctx) {
 
     // Create CUDA kernel.
 
-    ctx.cuda->createKernel("lineplot", R"""(
-        __global__ void lineplot(const float* input, float2* output, float normalizationFactor, size_t numberOfBatches, size_t numberOfElements, size_t averaging, size_t decimation) {
+    std::string header;
+    header += "#define MIN " + std::to_string(static_cast<U32>(LineplotDecimation::Min)) + "\n";
+    header += "#define MAX " + std::to_string(static_cast<U32>(LineplotDecimation::Max)) + "\n";
+    header += "#define PEAK_HOLD " + std::to_string(static_cast<U32>(LineplotDecimation::PeakHold)) + "\n";
+
+    ctx.cuda->createKernel("lineplot", header + R"""(
+        __device__ inline float combine(unsigned int mode, float a, float b) {
+            if (mode == MIN) {
+                return fminf(a, b);
+            }
+            if (mode == MAX || mode == PEAK_HOLD) {
+                return fmaxf(a, b);
+            }
+            return a + b;
+        }
+
+        __global__ void lineplot(const float* input, float2* output, float normalizationFactor, size_t numberOfBatches, size_t numberOfElements, size_t averaging, size_t decimation, size_t rowSize, unsigned int mode) {
             size_t id = blockIdx.x * blockDim.x + threadIdx.x;
             if (id < numberOfElements) {
-                // Compute average amplitude within a batch.
+                // Reduce the decimated samples of every batch.
                 float amplitude = 0.0f;
                 for (size_t i = 0; i < numberOfBatches; ++i) {
-                    amplitude += input[(id * decimation) + (i * numberOfElements)];
+                    const float* samples = input + (i * rowSize) + (id * decimation);
+                    float value = samples[0];
+                    for (size_t k = 1; k < decimation; ++k) {
+                        value = combine(mode, value, samples[k]);
+                    }
+                    amplitude += value;
                 }
                 amplitude = (amplitude * normalizationFactor) - 1.0f;
 
-                // Calculate moving average.
+                // Calculate moving average or peak hold.
                 float average = output[id].y;
-                average -= average / averaging;
-                average += amplitude / averaging;
+                if (mode == PEAK_HOLD && amplitude > average) {
+                    average = amplitude;
+                } else {
+                    average += (amplitude - average) / averaging;
+                }
 
                 // Store result.
                 output[id].x = id * 2.0f / (numberOfElements - 1) - 1.0f;
@@ -73,6 +98,8 @@ Result Lineplot<D, T>::createCompute(const Context& ctx) {
 
     // Initialize kernel arguments.
 
+    pimpl->mode = static_cast<U32>(config.decimationMode);
+
     pimpl->argumentsLineplot = {
         pimpl->input.data_ptr(),
         gimpl->signalPoints.data_ptr(),
@@ -81,6 +108,8 @@ Result Lineplot<D, T>::createCompute(const Context& ctx) {
         &gimpl->numberOfElements,
         &config.averaging,
         &config.decimation,
+        &gimpl->rowSize,
+        &pimpl->mode,
     };
 
     return Result::SUCCESS;
@@ -4,6 +4,7 @@
 #include "jetstream/backend/devices/cpu/helpers.hh"
 #include "jetstream/modules/lineplot.hh"
 #include "jetstream/render/utils.hh"
+#include "jetstream/memory/utils/triple_buffer.hh"
 
 #include "resources/shaders/lineplot_shaders.hh"
 #include "resources/shaders/global_shaders.hh"
@@ -33,16 +34,38 @@ struct Lineplot<D, T>::GImpl {
         glm::mat4 transform;
     } cursorUniforms;
 
+    struct {
+        U32 numberOfElements;
+        U32 numberOfColumns;
+        U32 first;
+        U32 count;
+        U32 paddedElements;
+        U32 numberOfLevels;
+    } decimationUniforms;
+
+    struct {
+        U32 numberOfElements;
+        U32 paddedElements;
+        U32 numberOfLevels;
+    } pyramidUniforms;
+
     Extent2D<F32> pixelSize;
     Extent2D<F32> paddingScale;
 
     Tensor<D, F32> signalPoints;
+    Tensor<D, F32> decimatedPoints;
+    Tensor<D, U32> pyramidNodes;
     Tensor<D, F32> signalVertices;
+    Memory::TripleBuffer<Tensor<Device::CPU, F32>> signalSnapshot;
     Tensor<Device::CPU, F32> gridPoints;
     Tensor<Device::CPU, F32> cursorSignalPoint;
     Tensor<D, F32> gridVertices;
 
     std::shared_ptr<Render::Buffer> signalPointsBuffer;
+    std::shared_ptr<Render::Buffer> decimatedPointsBuffer;
+    std::shared_ptr<Render::Buffer> decimationUniformBuffer;
+    std::shared_ptr<Render::Buffer> pyramidNodesBuffer;
+    std::shared_ptr<Render::Buffer> pyramidUniformBuffer;
     std::shared_ptr<Render::Buffer> signalVerticesBuffer;
     std::shared_ptr<Render::Buffer> signalUniformBuffer;
     std::shared_ptr<Render::Buffer> gridPointsBuffer;
@@ -57,6 +80,8 @@ struct Lineplot<D, T>::GImpl {
 
     std::shared_ptr<Render::Kernel> gridKernel;
     std::shared_ptr<Render::Kernel> signalKernel;
+    std::shared_ptr<Render::Kernel> decimationKernel;
+    std::shared_ptr<Render::Kernel> pyramidKernel;
 
     std::shared_ptr<Render::Program> signalProgram;
     std::shared_ptr<Render::Program> gridProgram;
@@ -76,14 +101,36 @@ struct Lineplot<D, T>::GImpl {
 
     U64 numberOfElements = 0;
     U64 numberOfBatches = 0;
+    U64 rowSize = 0;
     F32 normalizationFactor = 0.0f;
 
+    // Lines with many more points than pixels are reduced on the render
+    // device to the minimum and maximum of every column of the visible
+    // range, so the vertices drawn don't depend on the number of points.
+    static constexpr U64 MaxNumberOfColumns = 2048;
+    U64 numberOfColumns = 0;
+    U64 numberOfLinePoints = 0;
+
+    // Columns read the extremes of the visible range from a min/max pyramid
+    // over the points, rebuilt once per new line. Panning and zooming then
+    // read a few nodes per column instead of every visible point. The top
+    // level is capped so the rebuild keeps enough invocations.
+    static constexpr U64 MaxNumberOfLevels = 8;
+    U64 numberOfLevels = 0;
+    U64 paddedElements = 0;
+
+    // Lines streamed to remote clients are reduced to the maximum of
+    // every bucket, peaks matter more than valleys in a spectrum.
+    static constexpr U64 MaxStreamedPoints = 1024;
+    std::vector<F32> streamedLine;
+
     Extent2D<F32> cursorPos = {0.0f, 0.0f};
 
     bool updateGridPointsFlag = false;
     bool updateSignalPointsFlag = false;
     bool updateCursorUniformBufferFlag = false;
     bool updateSignalUniformBufferFlag = false;
+    bool updateDecimationUniformBufferFlag = false;
     bool updateGridUniformBufferFlag = false;
 
     void updateState(Lineplot<D, T>& m);
@@ -103,13 +150,27 @@ Result Lineplot<D, T>::create() {
         return Result::ERROR;
     }
 
+    if (config.decimation == 0) {
+        JST_ERROR("Invalid decimation ({}). It should be at least '1'.", config.decimation);
+        return Result::ERROR;
+    }
+
     // Calculate parameters.
+    //
+    // Every point reduces `decimation` samples of each batch and the batches
+    // are averaged. Sums of the average mode are divided here, so every mode
+    // shares the same normalization.
 
     const U64 last_axis = input.buffer.rank() - 1;
-    gimpl->numberOfElements = input.buffer.shape()[last_axis] / config.decimation;
+    gimpl->rowSize = input.buffer.shape()[last_axis];
+    gimpl->numberOfElements = gimpl->rowSize / config.decimation;
     gimpl->numberOfBatches = (input.buffer.rank() == 2) ? input.buffer.shape()[0] : 1;
     gimpl->normalizationFactor = 1.0f / (0.5f * gimpl->numberOfBatches);
 
+    if (config.decimationMode == LineplotDecimation::Average) {
+        gimpl->normalizationFactor /= static_cast<F32>(config.decimation);
+    }
+
     // Check shape.
 
     if (gimpl->numberOfElements < 2) {
@@ -119,8 +180,27 @@ Result Lineplot<D, T>::create() {
 
     // Allocate internal buffers.
 
+    gimpl->numberOfColumns = (gimpl->numberOfElements > 2 * GImpl::MaxNumberOfColumns) ? GImpl::MaxNumberOfColumns : 0;
+    gimpl->numberOfLinePoints = (gimpl->numberOfColumns > 0) ? gimpl->numberOfColumns * 2 : gimpl->numberOfElements;
+
     gimpl->signalPoints = Tensor<D, F32>({gimpl->numberOfElements, 2});
-    gimpl->signalVertices = Tensor<D, F32>({gimpl->numberOfElements - 1, 4, 4});
+    gimpl->signalVertices = Tensor<D, F32>({gimpl->numberOfLinePoints - 1, 4, 4});
+
+    if (gimpl->numberOfColumns > 0) {
+        gimpl->decimatedPoints = Tensor<D, F32>({gimpl->numberOfLinePoints, 2});
+
+        // Levels up to the points of a column at full view, padded so every
+        // node of the top level is whole.
+        while (gimpl->numberOfLevels < GImpl::MaxNumberOfLevels &&
+               (gimpl->numberOfElements >> (gimpl->numberOfLevels + 1)) >= gimpl->numberOfColumns) {
+            gimpl->numberOfLevels += 1;
+        }
+
+        const U64 topSize = 1ULL << gimpl->numberOfLevels;
+        gimpl->paddedElements = ((gimpl->numberOfElements + topSize - 1) / topSize) * topSize;
+
+        gimpl->pyramidNodes = Tensor<D, U32>({gimpl->paddedElements - (gimpl->paddedElements >> gimpl->numberOfLevels), 2});
+    }
 
     gimpl->gridPoints = Tensor<Device::CPU, F32>({config.numberOfVerticalLines + config.numberOfHorizontalLines, 2, 2});
     gimpl->gridVertices = Tensor<D, F32>({config.numberOfVerticalLines + config.numberOfHorizontalLines, 6, 4});
@@ -133,7 +213,7 @@ Result Lineplot<D, T>::create() {
 template<Device D, typename T>
 void Lineplot<D, T>::info() const {
     JST_DEBUG("  Averaging: {}", config.averaging);
-    JST_DEBUG("  Decimation: {}", config.decimation);
+    JST_DEBUG("  Decimation: {} ({})", config.decimation, config.decimationMode);
     JST_DEBUG("  Number of Vertical Lines: {}", config.numberOfVerticalLines);
     JST_DEBUG("  Number of Horizontal Lines: {}", config.numberOfHorizontalLines);
     JST_DEBUG("  Size: [{}, {}]", config.viewSize.x, config.viewSize.y);
@@ -141,6 +221,7 @@ void Lineplot<D, T>::info() const {
     JST_DEBUG("  Translation: {}", config.translation);
     JST_DEBUG("  Scale: {}", config.scale);
     JST_DEBUG("  Thickness: {}", config.thickness);
+    JST_DEBUG("  Render Decimation: {}", (gimpl->numberOfColumns > 0) ? jst::fmt::format("{} columns, {} levels", gimpl->numberOfColumns, gimpl->numberOfLevels) : "NO");
 }
 
 template<Device D, typename T>
@@ -309,6 +390,83 @@ Result Lineplot<D, T>::createPresent() {
         JST_CHECK(window->bind(gimpl->signalPointsBuffer));
     }
 
+    if (gimpl->numberOfColumns > 0) {
+        {
+            Render::Buffer::Config cfg;
+            cfg.buffer = &gimpl->decimationUniforms;
+            cfg.elementByteSize = sizeof(gimpl->decimationUniforms);
+            cfg.size = 1;
+            cfg.target = Render::Buffer::Target::UNIFORM;
+            JST_CHECK(window->build(gimpl->decimationUniformBuffer, cfg));
+            JST_CHECK(window->bind(gimpl->decimationUniformBuffer));
+        }
+
+        {
+            auto [buffer, enableZeroCopy] = ConvertToOptimalStorage(window, gimpl->decimatedPoints);
+
+            Render::Buffer::Config cfg;
+            cfg.buffer = buffer;
+            cfg.elementByteSize = sizeof(F32);
+            cfg.size = gimpl->decimatedPoints.size();
+            cfg.target = Render::Buffer::Target::STORAGE;
+            cfg.enableZeroCopy = enableZeroCopy;
+            JST_CHECK(window->build(gimpl->decimatedPointsBuffer, cfg));
+            JST_CHECK(window->bind(gimpl->decimatedPointsBuffer));
+        }
+
+        {
+            gimpl->pyramidUniforms.numberOfElements = gimpl->numberOfElements;
+            gimpl->pyramidUniforms.paddedElements = gimpl->paddedElements;
+            gimpl->pyramidUniforms.numberOfLevels = gimpl->numberOfLevels;
+
+            Render::Buffer::Config cfg;
+            cfg.buffer = &gimpl->pyramidUniforms;
+            cfg.elementByteSize = sizeof(gimpl->pyramidUniforms);
+            cfg.size = 1;
+            cfg.target = Render::Buffer::Target::UNIFORM;
+            JST_CHECK(window->build(gimpl->pyramidUniformBuffer, cfg));
+            JST_CHECK(window->bind(gimpl->pyramidUniformBuffer));
+        }
+
+        {
+            auto [buffer, enableZeroCopy] = ConvertToOptimalStorage(window, gimpl->pyramidNodes);
+
+            Render::Buffer::Config cfg;
+            cfg.buffer = buffer;
+            cfg.elementByteSize = sizeof(U32);
+            cfg.size = gimpl->pyramidNodes.size();
+            cfg.target = Render::Buffer::Target::STORAGE;
+            cfg.enableZeroCopy = enableZeroCopy;
+            JST_CHECK(window->build(gimpl->pyramidNodesBuffer, cfg));
+            JST_CHECK(window->bind(gimpl->pyramidNodesBuffer));
+        }
+
+        {
+            Render::Kernel::Config cfg;
+            cfg.gridSize = {gimpl->paddedElements >> gimpl->numberOfLevels, 1, 1};
+            cfg.kernels = KernelsPackage["pyramid"];
+            cfg.buffers = {
+                {gimpl->pyramidUniformBuffer, Render::Kernel::AccessMode::READ},
+                {gimpl->signalPointsBuffer, Render::Kernel::AccessMode::READ},
+                {gimpl->pyramidNodesBuffer, Render::Kernel::AccessMode::WRITE},
+            };
+            JST_CHECK(window->build(gimpl->pyramidKernel, cfg));
+        }
+
+        {
+            Render::Kernel::Config cfg;
+            cfg.gridSize = {gimpl->numberOfColumns, 1, 1};
+            cfg.kernels = KernelsPackage["decimate"];
+            cfg.buffers = {
+                {gimpl->decimationUniformBuffer, Render::Kernel::AccessMode::READ},
+                {gimpl->signalPointsBuffer, Render::Kernel::AccessMode::READ},
+                {gimpl->decimatedPointsBuffer, Render::Kernel::AccessMode::WRITE},
+                {gimpl->pyramidNodesBuffer, Render::Kernel::AccessMode::READ},
+            };
+            JST_CHECK(window->build(gimpl->decimationKernel, cfg));
+        }
+    }
+
     {
         auto [buffer, enableZeroCopy] = ConvertToOptimalStorage(window, gimpl->signalVertices);
 
@@ -324,11 +482,12 @@ Result Lineplot<D, T>::createPresent() {
 
     {
         Render::Kernel::Config cfg;
-        cfg.gridSize = {gimpl->numberOfElements - 1, 1, 1};
+        cfg.gridSize = {gimpl->numberOfLinePoints - 1, 1, 1};
         cfg.kernels = GlobalKernelsPackage["thicklinestrip"];
         cfg.buffers = {
             {gimpl->signalUniformBuffer, Render::Kernel::AccessMode::READ},
-            {gimpl->signalPointsBuffer, Render::Kernel::AccessMode::READ},
+            {(gimpl->numberOfColumns > 0) ? gimpl->decimatedPointsBuffer : gimpl->signalPointsBuffer,
+             Render::Kernel::AccessMode::READ},
             {gimpl->signalVerticesBuffer, Render::Kernel::AccessMode::WRITE},
         };
         JST_CHECK(window->build(gimpl->signalKernel, cfg));
@@ -407,10 +566,12 @@ Result Lineplot<D, T>::createPresent() {
     {
         Render::Surface::Config cfg;
         cfg.framebuffer = gimpl->framebufferTexture;
-        cfg.kernels = {
-            gimpl->gridKernel,
-            gimpl->signalKernel
-        };
+        cfg.kernels = {gimpl->gridKernel};
+        if (gimpl->numberOfColumns > 0) {
+            cfg.kernels.push_back(gimpl->pyramidKernel);
+            cfg.kernels.push_back(gimpl->decimationKernel);
+        }
+        cfg.kernels.push_back(gimpl->signalKernel);
         cfg.programs = {
             gimpl->gridProgram,
             gimpl->signalProgram,
@@ -440,6 +601,12 @@ Result Lineplot<D, T>::destroyPresent() {
     JST_CHECK(window->unbind(gimpl->text));
     JST_CHECK(window->unbind(gimpl->lutTexture));
     JST_CHECK(window->unbind(gimpl->signalPointsBuffer));
+    if (gimpl->numberOfColumns > 0) {
+        JST_CHECK(window->unbind(gimpl->decimatedPointsBuffer));
+        JST_CHECK(window->unbind(gimpl->decimationUniformBuffer));
+        JST_CHECK(window->unbind(gimpl->pyramidNodesBuffer));
+        JST_CHECK(window->unbind(gimpl->pyramidUniformBuffer));
+    }
     JST_CHECK(window->unbind(gimpl->signalVerticesBuffer));
     JST_CHECK(window->unbind(gimpl->signalUniformBuffer));
     JST_CHECK(window->unbind(gimpl->gridPointsBuffer));
@@ -454,39 +621,92 @@ Result Lineplot<D, T>::destroyPresent() {
 
 template<Device D, typename T>
 Result Lineplot<D, T>::present() {
+    bool updated = false;
+
+    // Pick up the latest line published by compute.
+    if constexpr (D == Device::CPU) {
+        if (gimpl->signalSnapshot.consume()) {
+            const auto& snapshot = gimpl->signalSnapshot.front();
+
+            for (U64 i = 0; i < gimpl->numberOfElements; i++) {
+                gimpl->signalPoints[(i * 2) + 1] = snapshot[i];
+            }
+
+            gimpl->updateSignalPointsFlag = true;
+
+            // Stream the line to remote clients.
+            if (window->streamsTensors()) {
+                const U64 points = std::min(gimpl->numberOfElements, GImpl::MaxStreamedPoints);
+                gimpl->streamedLine.assign(points, -1.0f);
+
+                for (U64 i = 0; i < gimpl->numberOfElements; i++) {
+                    auto& point = gimpl->streamedLine[i * points / gimpl->numberOfElements];
+                    point = std::max(point, snapshot[i]);
+                }
+
+                JST_CHECK(window->pushTensor(this->locale().blockId, gimpl->streamedLine, -1.0f, 1.0f));
+            }
+        }
+    }
+
     if (gimpl->updateGridPointsFlag) {
         gimpl->gridPointsBuffer->update();
         gimpl->gridKernel->update();
         gimpl->updateCursorState(*this);
         gimpl->updateGridPointsFlag = false;
+        updated = true;
+    }
+
+    if (gimpl->updateDecimationUniformBufferFlag) {
+        if (gimpl->numberOfColumns > 0) {
+            gimpl->decimationUniformBuffer->update();
+            gimpl->decimationKernel->update();
+            gimpl->signalKernel->update();
+        }
+        gimpl->updateDecimationUniformBufferFlag = false;
+        updated = true;
     }
 
     if (gimpl->updateSignalPointsFlag) {
         gimpl->signalPointsBuffer->update();
+        if (gimpl->numberOfColumns > 0) {
+            gimpl->pyramidKernel->update();
+            gimpl->decimationKernel->update();
+        }
         gimpl->signalKernel->update();
         gimpl->updateCursorState(*this);
         gimpl->updateSignalPointsFlag = false;
+        updated = true;
     }
 
     if (gimpl->updateGridUniformBufferFlag) {
         gimpl->gridUniformBuffer->update();
         gimpl->gridKernel->update();
         gimpl->updateGridUniformBufferFlag = false;
+        updated = true;
     }
 
     if (gimpl->updateSignalUniformBufferFlag) {
         gimpl->signalUniformBuffer->update();
         gimpl->signalKernel->update();
         gimpl->updateSignalUniformBufferFlag = false;
+        updated = true;
     }
 
     if (gimpl->updateCursorUniformBufferFlag) {
         gimpl->cursorUniformBuffer->update();
         gimpl->updateCursorUniformBufferFlag = false;
+        updated = true;
     }
 
     JST_CHECK(gimpl->text->present());
 
+    // Draw only when something changed.
+
+    if (updated) {
+        gimpl->surface->update();
+    }
+
     return Result::SUCCESS;
 }
 
@@ -600,7 +820,7 @@ void Lineplot<D, T>::GImpl::updateState(Lineplot<D, T>& m) {
     signalUniforms.thickness[0] = pixelSize.x * m.config.thickness * 3.0f;
     signalUniforms.thickness[1] = pixelSize.y * m.config.thickness * 3.0f;
     signalUniforms.zoom = m.config.zoom;
-    signalUniforms.numberOfPoints = numberOfElements;
+    signalUniforms.numberOfPoints = numberOfLinePoints;
 
     gridUniforms.transform = gridTransform;
     gridUniforms.thickness[0] = pixelSize.x * m.config.thickness * 3.0f;
@@ -608,6 +828,30 @@ void Lineplot<D, T>::GImpl::updateState(Lineplot<D, T>& m) {
     gridUniforms.zoom = 1.0f;
     gridUniforms.numberOfLines = m.config.numberOfVerticalLines + m.config.numberOfHorizontalLines;
 
+    // Update the range of points reduced to columns. A point at `x` is drawn
+    // at `(translation + paddingScale * x) * zoom`, the range covers the points
+    // drawn inside the view plus one on each side.
+
+    if (numberOfColumns > 0) {
+        const F32 scaleX = paddingScale.x * m.config.zoom;
+        const F32 shiftX = m.config.translation * m.config.zoom;
+        const F32 lastIndex = numberOfElements - 1.0f;
+
+        const auto toIndex = [&](const F32& x) {
+            return std::clamp(((x - shiftX) / scaleX + 1.0f) * 0.5f * lastIndex, 0.0f, lastIndex);
+        };
+
+        const U64 first = static_cast<U64>(std::max(std::floor(toIndex(-1.0f)) - 1.0f, 0.0f));
+        const U64 last = static_cast<U64>(std::min(std::ceil(toIndex(+1.0f)) + 1.0f, lastIndex));
+
+        decimationUniforms.numberOfElements = numberOfElements;
+        decimationUniforms.numberOfColumns = numberOfColumns;
+        decimationUniforms.first = first;
+        decimationUniforms.count = last - first + 1;
+        decimationUniforms.paddedElements = paddedElements;
+        decimationUniforms.numberOfLevels = numberOfLevels;
+    }
+
     // Update the cursor.
 
     updateCursorState(m);
@@ -616,6 +860,7 @@ void Lineplot<D, T>::GImpl::updateState(Lineplot<D, T>& m) {
 
     updateGridUniformBufferFlag = true;
     updateSignalUniformBufferFlag = true;
+    updateDecimationUniformBufferFlag = true;
 }
 
 template<Device D, typename T>
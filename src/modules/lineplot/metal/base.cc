@@ -9,14 +9,31 @@ static const char shadersSrc[] = R"""(
 
     using namespace metal;
 
+    // Matches the order of LineplotDecimation.
+    constant uint MIN = 1;
+    constant uint MAX = 2;
+    constant uint PEAK_HOLD = 3;
+
     struct Constants {
         ushort batchSize;
         ushort gridSize;
         float normalizationFactor;
         size_t average;
         size_t decimation;
+        size_t rowSize;
+        uint mode;
     };
 
+    inline float combine(uint mode, float a, float b) {
+        if (mode == MIN) {
+            return min(a, b);
+        }
+        if (mode == MAX || mode == PEAK_HOLD) {
+            return max(a, b);
+        }
+        return a + b;
+    }
+
     // TODO: This can be ported to use shared memory and other tricks.
     //       Good enough for now.
     kernel void lineplot(constant Constants& constants [[ buffer(0) ]],
@@ -27,17 +44,25 @@ static const char shadersSrc[] = R"""(
             return;
         }
 
-        // Compute average amplitude within a batch.
+        // Reduce the decimated samples of every batch.
         float amplitude = 0.0f;
         for (uint i = 0; i < constants.batchSize; ++i) {
-            amplitude += input[(id * constants.decimation) + (i * constants.gridSize)];
+            constant const float* samples = input + (i * constants.rowSize) + (id * constants.decimation);
+            float value = samples[0];
+            for (uint k = 1; k < constants.decimation; ++k) {
+                value = combine(constants.mode, value, samples[k]);
+            }
+            amplitude += value;
         }
         amplitude = (amplitude * constants.normalizationFactor) - 1.0f;
 
-        // Calculate moving average.
+        // Calculate moving average or peak hold.
         float average = bins[id].y;
-        average -= average / constants.average;
-        average += amplitude / constants.average;
+        if (constants.mode == PEAK_HOLD && amplitude > average) {
+            average = amplitude;
+        } else {
+            average += (amplitude - average) / constants.average;
+        }
 
         // Store result.
         bins[id].x = id * 2.0f / (constants.gridSize - 1) - 1.0f;
@@ -53,6 +78,8 @@ struct Lineplot<D, T>::Impl {
         F32 normalizationFactor;
         U64 average;
         U64 decimation;
+        U64 rowSize;
+        U32 mode;
     };
 
     MTL::ComputePipelineState* lineplotState;
@@ -73,7 +100,7 @@ Lineplot<D, T>::~Lineplot() {
 
 template<Device D, typename T>
 Result Lineplot<D, T>::createCompute(const Context&) {
-    JST_TRACE("Create Multiply compute core using Metal backend.");
+    JST_TRACE("Create Lineplot compute core using Metal backend.");
 
     // Compile shaders.
 
@@ -94,6 +121,8 @@ Result Lineplot<D, T>::compute(const Context& ctx) {
     constants->normalizationFactor = gimpl->normalizationFactor;
     constants->average = config.averaging;
     constants->decimation = config.decimation;
+    constants->rowSize = gimpl->rowSize;
+    constants->mode = static_cast<U32>(config.decimationMode);
 
     {
         auto cmdEncoder = ctx.metal->commandBuffer()->computeCommandEncoder();
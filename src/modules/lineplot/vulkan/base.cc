@@ -0,0 +1,71 @@
+#include "../generic.cc"
+
+namespace Jetstream {
+
+template<Device D, typename T>
+struct Lineplot<D, T>::Impl {
+    struct Constants {
+        U32 batchSize;
+        U32 gridSize;
+        F32 normalizationFactor;
+        U32 average;
+        U32 decimation;
+        U32 rowSize;
+        U32 mode;
+    };
+
+    Constants constants;
+    std::vector<U64> grid;
+};
+
+template<Device D, typename T>
+Lineplot<D, T>::Lineplot() {
+    pimpl = std::make_unique<Impl>();
+    gimpl = std::make_unique<GImpl>();
+}
+
+template<Device D, typename T>
+Lineplot<D, T>::~Lineplot() {
+    pimpl.reset();
+    gimpl.reset();
+}
+
+template<Device D, typename T>
+Result Lineplot<D, T>::createCompute(const Context& ctx) {
+    JST_TRACE("Create Lineplot compute core using Vulkan backend.");
+
+    pimpl->grid = { (gimpl->numberOfElements + 255) / 256, 1, 1 };
+
+    JST_CHECK(ctx.vulkan->createKernel("lineplot",
+                                       KernelsPackage["average"][Device::Vulkan][0],
+                                       {
+                                           input.buffer.data(),
+                                           gimpl->signalPoints.data(),
+                                       },
+                                       sizeof(typename Impl::Constants)));
+
+    return Result::SUCCESS;
+}
+
+template<Device D, typename T>
+Result Lineplot<D, T>::compute(const Context& ctx) {
+    auto& constants = pimpl->constants;
+    constants.batchSize = gimpl->numberOfBatches;
+    constants.gridSize = gimpl->numberOfElements;
+    constants.normalizationFactor = gimpl->normalizationFactor;
+    constants.average = config.averaging;
+    constants.decimation = config.decimation;
+    constants.rowSize = gimpl->rowSize;
+    constants.mode = static_cast<U32>(config.decimationMode);
+
+    JST_CHECK(ctx.vulkan->dispatchKernel("lineplot", pimpl->grid, &constants));
+
+    gimpl->updateSignalPointsFlag = true;
+
+    return Result::SUCCESS;
+}
+
+JST_LINEPLOT_VULKAN(JST_INSTANTIATION)
+JST_LINEPLOT_VULKAN(JST_BENCHMARK)
+
+}  // namespace Jetstream
@@ -4,14 +4,17 @@ namespace Jetstream {
 
 template<template<Device, typename...> class Module, Device D, typename T>
 void benchmark(ankerl::nanobench::Bench& bench, std::string name) {
+    // A complex multiplication is four real multiplications and two additions.
+    const F64 flops = IsComplex<T>::value ? 6.0 : 1.0;
+
     // 1D Alike
-    JST_BENCHMARK_RUN("1024000 * 1024000 (1D-C/C) AL", {}, {
+    JST_BENCHMARK_RUN_FLOPS("1024000 * 1024000 (1D-C/C) AL", flops, {}, {
         .factorA = Tensor<D COMMA T>({1024000}) COMMA
         .factorB = Tensor<D COMMA T>({1024000}) COMMA
     }, T);
 
     // 2D (Contiguous/Contiguous) Alike
-    JST_BENCHMARK_RUN("128x8000 * 128x8000 (2D-C/C) AL", {}, {
+    JST_BENCHMARK_RUN_FLOPS("128x8000 * 128x8000 (2D-C/C) AL", flops, {}, {
         .factorA = Tensor<D COMMA T>({128 COMMA 8000}) COMMA
         .factorB = Tensor<D COMMA T>({128 COMMA 8000}) COMMA
     }, T);
@@ -24,14 +27,14 @@ void benchmark(ankerl::nanobench::Bench& bench, std::string name) {
         factorA.slice({{}, 0, {}});
         factorB.slice({{}, 0, {}});
 
-        JST_BENCHMARK_RUN("128x8000 * 128x8000 (2D-NC/NC) AL", {}, {
+        JST_BENCHMARK_RUN_FLOPS("128x8000 * 128x8000 (2D-NC/NC) AL", flops, {}, {
             .factorA = factorA COMMA
             .factorB = factorB COMMA
         }, T);
     }
 
     // Broadcast 2D (Contiguous/Non-Contiguous) 
-    JST_BENCHMARK_RUN("128x8000 * 1x8000 (B-2D-C/NC)", {}, {
+    JST_BENCHMARK_RUN_FLOPS("128x8000 * 1x8000 (B-2D-C/NC)", flops, {}, {
         .factorA = Tensor<D COMMA T>({128 COMMA 8000}) COMMA
         .factorB = Tensor<D COMMA T>({1 COMMA 8000}) COMMA
     }, T);
@@ -43,14 +46,14 @@ void benchmark(ankerl::nanobench::Bench& bench, std::string name) {
 
         factorA.slice({{}, 0, {}});
 
-        JST_BENCHMARK_RUN("128x8000 * 1x8000 (B-2D-NC/NC)", {}, {
+        JST_BENCHMARK_RUN_FLOPS("128x8000 * 1x8000 (B-2D-NC/NC)", flops, {}, {
             .factorA = factorA COMMA
             .factorB = factorB COMMA
         }, T);
     }
 
     // 3D (Contiguous/Contiguous) Alike
-    JST_BENCHMARK_RUN("2x64x8000 * 2x64x8000 (3D-C/C) AL", {}, {
+    JST_BENCHMARK_RUN_FLOPS("2x64x8000 * 2x64x8000 (3D-C/C) AL", flops, {}, {
         .factorA = Tensor<D COMMA T>({2 COMMA 64 COMMA 8000}) COMMA
         .factorB = Tensor<D COMMA T>({2 COMMA 64 COMMA 8000}) COMMA
     }, T);
@@ -63,17 +66,35 @@ void benchmark(ankerl::nanobench::Bench& bench, std::string name) {
         factorA.slice({{}, 0, {}, {}});
         factorB.slice({{}, 0, {}, {}});
 
-        JST_BENCHMARK_RUN("2x64x8000 * 2x64x8000 (3D-NC/NC) AL", {}, {
+        JST_BENCHMARK_RUN_FLOPS("2x64x8000 * 2x64x8000 (3D-NC/NC) AL", flops, {}, {
             .factorA = factorA COMMA
             .factorB = factorB COMMA
         }, T);
     }
 
     // Broadcast 3D (Contiguous/Non-Contiguous)
-    JST_BENCHMARK_RUN("2x64x8000 * 2x1x8000 (B-3D-C/NC)", {}, {
+    JST_BENCHMARK_RUN_FLOPS("2x64x8000 * 2x1x8000 (B-3D-C/NC)", flops, {}, {
         .factorA = Tensor<D COMMA T>({2 COMMA 64 COMMA 8000}) COMMA
         .factorB = Tensor<D COMMA T>({2 COMMA 1 COMMA 8000}) COMMA
     }, T);
+
+    // Broadcast Filter Bank (Contiguous/Contiguous)
+    JST_BENCHMARK_RUN_FLOPS("128x8000 * 4x1x8000 (B-FB-C/C)", flops, {}, {
+        .factorA = Tensor<D COMMA T>({128 COMMA 8000}) COMMA
+        .factorB = Tensor<D COMMA T>({4 COMMA 1 COMMA 8000}) COMMA
+    }, T);
+
+    JST_BENCHMARK_SWEEP(batch, size) {
+        JST_BENCHMARK_RUN_FLOPS(JST_BENCHMARK_SWEEP_NAME("Alike", batch, size), flops, {}, {
+            .factorA = Tensor<D COMMA T>({batch COMMA size}) COMMA
+            .factorB = Tensor<D COMMA T>({batch COMMA size}) COMMA
+        }, T);
+
+        JST_BENCHMARK_RUN_FLOPS(JST_BENCHMARK_SWEEP_NAME("Broadcast", batch, size), flops, {}, {
+            .factorA = Tensor<D COMMA T>({batch COMMA size}) COMMA
+            .factorB = Tensor<D COMMA T>({1 COMMA size}) COMMA
+        }, T);
+    }
 }
 
 }  // namespace Jetstream
\ No newline at end of file
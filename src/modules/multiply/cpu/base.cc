@@ -1,6 +1,7 @@
 #include "../generic.cc"
 
 #include "jetstream/memory/devices/cpu/helpers.hh"
+#include "jetstream/backend/devices/cpu/simd.hh"
 
 namespace Jetstream {
 
@@ -9,8 +10,39 @@ struct Multiply<D, T>::Impl {
     Tensor<D, T> a;
     Tensor<D, T> b;
     Tensor<D, T> c;
+
+    // Broadcasted views collapsed to the least number of dimensions. The
+    // innermost one is walked by the row kernels when it's contiguous in the
+    // output and either contiguous or broadcasted in the inputs.
+    std::vector<U64> shape;
+    std::vector<U64> strideA;
+    std::vector<U64> strideB;
+    std::vector<U64> strideC;
+    bool rowKernels = false;
 };
 
+template<typename T>
+static inline void MultiplyRow(const T* a, const U64& strideA,
+                               const T* b, const U64& strideB,
+                               T* c, const U64& size) {
+    if constexpr (std::is_same_v<T, CF32>) {
+        if (strideA == 1 && strideB == 1) {
+            Backend::ComplexMultiply().kernel()(a, b, c, size);
+        } else if (strideA == 1) {
+            Backend::ComplexScale().kernel()(a, b[0], c, size);
+        } else if (strideB == 1) {
+            Backend::ComplexScale().kernel()(b, a[0], c, size);
+        } else {
+            Backend::ComplexScaleScalar(a, b[0], c, 1);
+            std::fill(c + 1, c + size, c[0]);
+        }
+    } else {
+        for (U64 i = 0; i < size; i++) {
+            c[i] = a[i * strideA] * b[i * strideB];
+        }
+    }
+}
+
 template<Device D, typename T>
 Multiply<D, T>::Multiply() {
     impl = std::make_unique<Impl>();
@@ -24,19 +56,108 @@ Multiply<D, T>::~Multiply() {
 template<Device D, typename T>
 Result Multiply<D, T>::createCompute(const Context&) {
     JST_TRACE("Create Multiply compute core using CPU backend.");
+
+    // Merge dimensions laid out as a single one in every view. Broadcasted
+    // dimensions merge with each other because their strides are zero.
+
+    impl->shape.clear();
+    impl->strideA.clear();
+    impl->strideB.clear();
+    impl->strideC.clear();
+
+    for (U64 i = 0; i < impl->c.rank(); i++) {
+        const U64 dim = impl->c.shape()[i];
+        const U64 sa = impl->a.stride()[i];
+        const U64 sb = impl->b.stride()[i];
+        const U64 sc = impl->c.stride()[i];
+
+        if (dim == 1) {
+            continue;
+        }
+
+        if (!impl->shape.empty() &&
+            impl->strideA.back() == sa * dim &&
+            impl->strideB.back() == sb * dim &&
+            impl->strideC.back() == sc * dim) {
+            impl->shape.back() *= dim;
+            impl->strideA.back() = sa;
+            impl->strideB.back() = sb;
+            impl->strideC.back() = sc;
+            continue;
+        }
+
+        impl->shape.push_back(dim);
+        impl->strideA.push_back(sa);
+        impl->strideB.push_back(sb);
+        impl->strideC.push_back(sc);
+    }
+
+    if (impl->shape.empty()) {
+        impl->shape = {1};
+        impl->strideA = {1};
+        impl->strideB = {1};
+        impl->strideC = {1};
+    }
+
+    const U64 sa = impl->strideA.back();
+    const U64 sb = impl->strideB.back();
+    impl->rowKernels = impl->strideC.back() == 1 && sa <= 1 && sb <= 1;
+
+    JST_TRACE("[MULTIPLY] Collapsed shape {}; Row kernels: {};", impl->shape, impl->rowKernels ? "YES" : "NO");
+
     return Result::SUCCESS;
 }
 
 template<Device D, typename T>
-Result Multiply<D, T>::compute(const Context&) {
-    Memory::CPU::AutomaticIterator([](const auto& a, const auto& b, auto& c) {
-        if constexpr (std::is_same_v<T, CF32>) {
-            c = std::complex<F32>(a.real() * b.real() - a.imag() * b.imag(),
-                                  a.real() * b.imag() + a.imag() * b.real());
-        } else {
-            c = a * b;
+Result Multiply<D, T>::compute(const Context& ctx) {
+    if (!impl->rowKernels) {
+        Memory::CPU::ParallelAutomaticIterator(ctx.cpu->pool(), [](const auto& a, const auto& b, auto& c) {
+            if constexpr (std::is_same_v<T, CF32>) {
+                c = std::complex<F32>(a.real() * b.real() - a.imag() * b.imag(),
+                                      a.real() * b.imag() + a.imag() * b.real());
+            } else {
+                c = a * b;
+            }
+        }, impl->a, impl->b, impl->c);
+
+        return Result::SUCCESS;
+    }
+
+    const U64 outer = impl->shape.size() - 1;
+    const U64 rowSize = impl->shape[outer];
+    const U64 rows = impl->c.size() / rowSize;
+
+    const T* a = impl->a.data() + impl->a.offset();
+    const T* b = impl->b.data() + impl->b.offset();
+    T* c = impl->c.data() + impl->c.offset();
+
+    // Each range of rows finds its own starting offsets, so rows don't depend
+    // on each other. This also covers batched filter banks expanded from a
+    // single filter, where one of the inputs repeats the same row.
+
+    const U64 chunks = impl->c.size() / Memory::CPU::ParallelIteratorGrain;
+
+    Memory::CPU::ParallelRanges(ctx.cpu->pool(), rows, chunks, [&](const U64& begin, const U64& end) {
+        for (U64 row = begin; row < end; row++) {
+            U64 offsetA = 0;
+            U64 offsetB = 0;
+            U64 offsetC = 0;
+
+            U64 index = row;
+            for (U64 i = outer; i-- > 0;) {
+                const U64 coord = index % impl->shape[i];
+                index /= impl->shape[i];
+
+                offsetA += coord * impl->strideA[i];
+                offsetB += coord * impl->strideB[i];
+                offsetC += coord * impl->strideC[i];
+            }
+
+            MultiplyRow(a + offsetA, impl->strideA[outer],
+                        b + offsetB, impl->strideB[outer],
+                        c + offsetC, rowSize);
         }
-    }, impl->a, impl->b, impl->c);
+    });
 
     return Result::SUCCESS;
 }
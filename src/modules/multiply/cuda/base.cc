@@ -0,0 +1,233 @@
+#include "../generic.cc"
+
+#include "jetstream/memory/devices/cuda/copy.hh"
+
+namespace Jetstream {
+
+template<Device D, typename T>
+struct Multiply<D, T>::Impl {
+    Tensor<D, T> a;
+    Tensor<D, T> b;
+    Tensor<D, T> c;
+
+    std::vector<U64> grid;
+    std::vector<U64> block;
+
+    struct Meta {
+        void* a;
+        void* b;
+        void* c;
+        size_t rank;
+        size_t shape[8];
+        size_t strideA[8];
+        size_t strideB[8];
+        size_t strideC[8];
+    };
+
+    Meta meta;
+    U64 size;
+
+    std::vector<void*> arguments;
+
+    // Device copies of host factors, broadcasted like the originals.
+    Tensor<Device::CUDA, T> factorA;
+    Tensor<Device::CUDA, T> factorB;
+    bool stageA = false;
+    bool stageB = false;
+};
+
+template<Device D, typename T>
+Multiply<D, T>::Multiply() {
+    impl = std::make_unique<Impl>();
+}
+
+template<Device D, typename T>
+Multiply<D, T>::~Multiply() {
+    impl.reset();
+}
+
+template<Device D, typename T>
+Result Multiply<D, T>::createCompute(const Context& ctx) {
+    JST_TRACE("Create Multiply compute core using CUDA backend.");
+
+    // Create CUDA kernel.
+    //
+    // Every thread computes one output element. Its coordinate is recovered
+    // from the innermost dimension outwards, so consecutive threads read
+    // consecutive samples of contiguous and broadcasted factors alike.
+
+    std::string header;
+
+    if constexpr (std::is_same_v<T, CF32>) {
+        header = R"""(
+            typedef float2 sample_t;
+
+            __device__ inline sample_t mul(const sample_t& a, const sample_t& b) {
+                return make_float2(a.x * b.x - a.y * b.y, a.x * b.y + a.y * b.x);
+            }
+        )""";
+    } else {
+        header = R"""(
+            typedef float sample_t;
+
+            __device__ inline sample_t mul(const sample_t& a, const sample_t& b) {
+                return a * b;
+            }
+        )""";
+    }
+
+    ctx.cuda->createKernel("multiply", header + R"""(
+        struct Meta {
+            void* a;
+            void* b;
+            void* c;
+            size_t rank;
+            size_t shape[8];
+            size_t strideA[8];
+            size_t strideB[8];
+            size_t strideC[8];
+        };
+
+        __global__ void multiply(Meta meta, size_t size) {
+            size_t id = blockIdx.x * blockDim.x + threadIdx.x;
+            if (id >= size) {
+                return;
+            }
+
+            size_t offsetA = 0;
+            size_t offsetB = 0;
+            size_t offsetC = 0;
+
+            for (size_t i = meta.rank; i-- > 0;) {
+                const size_t coord = id % meta.shape[i];
+                id /= meta.shape[i];
+
+                offsetA += coord * meta.strideA[i];
+                offsetB += coord * meta.strideB[i];
+                offsetC += coord * meta.strideC[i];
+            }
+
+            const sample_t* a = reinterpret_cast<const sample_t*>(meta.a);
+            const sample_t* b = reinterpret_cast<const sample_t*>(meta.b);
+            sample_t* c = reinterpret_cast<sample_t*>(meta.c);
+
+            c[offsetC] = mul(a[offsetA], b[offsetB]);
+        }
+    )""");
+
+    // Initialize kernel input.
+
+    impl->stageA = !input.factorA.device_native() && input.factorA.contiguous();
+    impl->stageB = !input.factorB.device_native() && input.factorB.contiguous();
+
+    Tensor<Device::CUDA, T> a = impl->a;
+    Tensor<Device::CUDA, T> b = impl->b;
+
+    if (impl->stageA) {
+        impl->factorA = Tensor<Device::CUDA, T>(input.factorA.shape());
+        a = impl->factorA;
+        JST_CHECK(a.broadcast_to(impl->c.shape()));
+    }
+
+    if (impl->stageB) {
+        impl->factorB = Tensor<Device::CUDA, T>(input.factorB.shape());
+        b = impl->factorB;
+        JST_CHECK(b.broadcast_to(impl->c.shape()));
+    }
+
+    // Merge dimensions laid out as a single one in every view, like the CPU
+    // backend does. This keeps the coordinate loop short.
+
+    impl->meta = {
+        reinterpret_cast<uint8_t*>(a.data()) + a.offset_bytes(),
+        reinterpret_cast<uint8_t*>(b.data()) + b.offset_bytes(),
+        reinterpret_cast<uint8_t*>(impl->c.data()) + impl->c.offset_bytes(),
+        0,
+        {},
+        {},
+        {},
+        {},
+    };
+
+    auto& meta = impl->meta;
+
+    for (U64 i = 0; i < impl->c.rank(); i++) {
+        const U64 dim = impl->c.shape()[i];
+        const U64 sa = a.stride()[i];
+        const U64 sb = b.stride()[i];
+        const U64 sc = impl->c.stride()[i];
+
+        if (dim == 1) {
+            continue;
+        }
+
+        if (meta.rank > 0 &&
+            meta.strideA[meta.rank - 1] == sa * dim &&
+            meta.strideB[meta.rank - 1] == sb * dim &&
+            meta.strideC[meta.rank - 1] == sc * dim) {
+            meta.shape[meta.rank - 1] *= dim;
+            meta.strideA[meta.rank - 1] = sa;
+            meta.strideB[meta.rank - 1] = sb;
+            meta.strideC[meta.rank - 1] = sc;
+            continue;
+        }
+
+        meta.shape[meta.rank] = dim;
+        meta.strideA[meta.rank] = sa;
+        meta.strideB[meta.rank] = sb;
+        meta.strideC[meta.rank] = sc;
+        meta.rank += 1;
+    }
+
+    if (meta.rank == 0) {
+        meta.rank = 1;
+        meta.shape[0] = 1;
+        meta.strideA[0] = 1;
+        meta.strideB[0] = 1;
+        meta.strideC[0] = 1;
+    }
+
+    JST_TRACE("[MULTIPLY] Collapsed rank {}.", meta.rank);
+
+    // Initialize kernel size.
+
+    impl->size = impl->c.size();
+
+    U64 threadsPerBlock = 512;
+    U64 blocksPerGrid = (impl->size + threadsPerBlock - 1) / threadsPerBlock;
+
+    impl->grid = { blocksPerGrid, 1, 1 };
+    impl->block = { threadsPerBlock, 1, 1 };
+
+    // Initialize kernel arguments.
+
+    impl->arguments = {
+        &impl->meta,
+        &impl->size,
+    };
+
+    return Result::SUCCESS;
+}
+
+template<Device D, typename T>
+Result Multiply<D, T>::compute(const Context& ctx) {
+    if (impl->stageA) {
+        JST_CHECK(Memory::Copy(impl->factorA, input.factorA, ctx.cuda->stream()));
+    }
+
+    if (impl->stageB) {
+        JST_CHECK(Memory::Copy(impl->factorB, input.factorB, ctx.cuda->stream()));
+    }
+
+    JST_CHECK(ctx.cuda->launchKernel("multiply",
+                                     impl->grid,
+                                     impl->block,
+                                     impl->arguments.data()));
+
+    return Result::SUCCESS;
+}
+
+JST_MULTIPLY_CUDA(JST_INSTANTIATION)
+JST_MULTIPLY_CUDA(JST_BENCHMARK)
+
+}  // namespace Jetstream
@@ -0,0 +1,128 @@
+#include "../generic.cc"
+
+#include "resources/shaders/multiply_shaders.hh"
+
+namespace Jetstream {
+
+template<Device D, typename T>
+struct Multiply<D, T>::Impl {
+    // Matches the push constants of the shader. Dimensions laid out as a
+    // single one in every view are merged, so most graphs fit in four.
+    static constexpr U64 MaxRank = 4;
+
+    struct Constants {
+        U32 shape[MaxRank];
+        U32 strideA[MaxRank];
+        U32 strideB[MaxRank];
+        U32 strideC[MaxRank];
+        U32 numberOfElements;
+        U32 rank;
+        U32 offsetA;
+        U32 offsetB;
+        U32 offsetC;
+    };
+
+    Tensor<D, T> a;
+    Tensor<D, T> b;
+    Tensor<D, T> c;
+
+    Constants constants;
+    std::vector<U64> grid;
+};
+
+template<Device D, typename T>
+Multiply<D, T>::Multiply() {
+    impl = std::make_unique<Impl>();
+}
+
+template<Device D, typename T>
+Multiply<D, T>::~Multiply() {
+    impl.reset();
+}
+
+template<Device D, typename T>
+Result Multiply<D, T>::createCompute(const Context& ctx) {
+    JST_TRACE("Create Multiply compute core using Vulkan backend.");
+
+    // Merge dimensions laid out as a single one in every view, like the CPU
+    // and CUDA backends do. Broadcasted dimensions have a zero stride.
+
+    auto& constants = impl->constants;
+    constants = {};
+
+    for (U64 i = 0; i < impl->c.rank(); i++) {
+        const U64 dim = impl->c.shape()[i];
+        const U64 sa = impl->a.stride()[i];
+        const U64 sb = impl->b.stride()[i];
+        const U64 sc = impl->c.stride()[i];
+
+        if (dim == 1) {
+            continue;
+        }
+
+        if (constants.rank > 0 &&
+            constants.strideA[constants.rank - 1] == sa * dim &&
+            constants.strideB[constants.rank - 1] == sb * dim &&
+            constants.strideC[constants.rank - 1] == sc * dim) {
+            constants.shape[constants.rank - 1] *= dim;
+            constants.strideA[constants.rank - 1] = sa;
+            constants.strideB[constants.rank - 1] = sb;
+            constants.strideC[constants.rank - 1] = sc;
+            continue;
+        }
+
+        if (constants.rank == Impl::MaxRank) {
+            JST_ERROR("[MULTIPLY] Shapes {} and {} need more than {} dimensions after merging, "
+                      "which is the limit of the Vulkan backend.", input.factorA.shape(),
+                                                                   input.factorB.shape(),
+                                                                   Impl::MaxRank);
+            return Result::ERROR;
+        }
+
+        constants.shape[constants.rank] = dim;
+        constants.strideA[constants.rank] = sa;
+        constants.strideB[constants.rank] = sb;
+        constants.strideC[constants.rank] = sc;
+        constants.rank += 1;
+    }
+
+    if (constants.rank == 0) {
+        constants.rank = 1;
+        constants.shape[0] = 1;
+        constants.strideA[0] = 1;
+        constants.strideB[0] = 1;
+        constants.strideC[0] = 1;
+    }
+
+    constants.numberOfElements = output.product.size();
+    constants.offsetA = impl->a.offset();
+    constants.offsetB = impl->b.offset();
+    constants.offsetC = impl->c.offset();
+
+    JST_TRACE("[MULTIPLY] Collapsed rank {}.", constants.rank);
+
+    impl->grid = { (output.product.size() + 255) / 256, 1, 1 };
+
+    JST_CHECK(ctx.vulkan->createKernel("multiply",
+                                       KernelsPackage["multiply"][Device::Vulkan][0],
+                                       {
+                                           input.factorA.data(),
+                                           input.factorB.data(),
+                                           output.product.data(),
+                                       },
+                                       sizeof(typename Impl::Constants)));
+
+    return Result::SUCCESS;
+}
+
+template<Device D, typename T>
+Result Multiply<D, T>::compute(const Context& ctx) {
+    JST_CHECK(ctx.vulkan->dispatchKernel("multiply", impl->grid, &impl->constants));
+
+    return Result::SUCCESS;
+}
+
+JST_MULTIPLY_VULKAN(JST_INSTANTIATION)
+JST_MULTIPLY_VULKAN(JST_BENCHMARK)
+
+}  // namespace Jetstream
@@ -1,5 +1,8 @@
 #include "../generic.cc"
 
+#include "jetstream/memory/devices/cpu/helpers.hh"
+#include "jetstream/backend/devices/cpu/simd.hh"
+
 namespace Jetstream {
 
 template<Device D, typename T>
@@ -21,15 +24,37 @@ Result MultiplyConstant<D, T>::createCompute(const Context&) {
     return Result::SUCCESS;
 }
 
-template<Device D, typename T>
-Result MultiplyConstant<D, T>::compute(const Context&) {
-    for (U64 i = 0; i < input.factor.size(); i++) {
+template<>
+Result MultiplyConstant<Device::CPU, CF32>::computeSlice(const Context&, const U64& offset, const U64& size) {
+    Backend::ComplexScale().kernel()(input.factor.data() + offset, config.constant, output.product.data() + offset, size);
+    return Result::SUCCESS;
+}
+
+template<>
+Result MultiplyConstant<Device::CPU, F32>::computeSlice(const Context&, const U64& offset, const U64& size) {
+    for (U64 i = offset; i < offset + size; i++) {
         output.product[i] = input.factor[i] * config.constant;
     }
 
     return Result::SUCCESS;
 }
 
+template<Device D, typename T>
+Result MultiplyConstant<D, T>::compute(const Context& ctx) {
+    if (input.factor.contiguous()) {
+        return computeSlice(ctx, 0, input.factor.size());
+    }
+
+    // Views are read through their strides instead of being copied first.
+
+    const auto constant = config.constant;
+    Memory::CPU::AutomaticIterator([&](const auto& factor, auto& product) {
+        product = factor * constant;
+    }, input.factor, output.product);
+
+    return Result::SUCCESS;
+}
+
 JST_MULTIPLY_CONSTANT_CPU(JST_INSTANTIATION)
 JST_MULTIPLY_CONSTANT_CPU(JST_BENCHMARK)
 
@@ -11,7 +11,16 @@ Result MultiplyConstant<D, T>::create() {
 
     // Allocate output.
 
-    output.product = Tensor<D, T>(input.factor.shape());
+    if (config.inPlace) {
+        if constexpr (D != Device::CPU) {
+            JST_ERROR("Multiply Constant can't run in-place on the {} backend.", D);
+            return Result::ERROR;
+        }
+
+        JST_CHECK(Module::InitInPlaceOutput(output.product, input.factor));
+    } else {
+        output.product = Tensor<D, T>(input.factor.shape());
+    }
 
     return Result::SUCCESS;
 }
@@ -24,6 +33,13 @@ void MultiplyConstant<D, T>::info() const {
     } else {
         JST_DEBUG("  Constant: {}", config.constant);
     }
+    JST_DEBUG("  In-Place: {}", config.inPlace);
+}
+
+template<Device D, typename T>
+Result MultiplyConstant<D, T>::computeSlice(const Context&, const U64&, const U64&) {
+    JST_ERROR("Multiply Constant can't compute slices on the {} backend.", D);
+    return Result::ERROR;
 }
 
 }  // namespace Jetstream
@@ -0,0 +1,579 @@
+#include "jetstream/modules/network_sink.hh"
+#include "jetstream/compute/thread.hh"
+#include "jetstream/backend/devices/cpu/simd.hh"
+
+#include <mutex>
+#include <atomic>
+#include <thread>
+#include <cerrno>
+#include <limits>
+#include <climits>
+#include <cmath>
+#include <cstring>
+
+#include <fcntl.h>
+#include <netdb.h>
+#include <poll.h>
+#include <unistd.h>
+#include <sys/uio.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <arpa/inet.h>
+
+namespace Jetstream {
+
+template<Device D, typename T>
+struct NetworkSink<D, T>::Impl {
+    typedef NetworkStream::Header Header;
+
+    int fd = -1;
+    sockaddr_in address = {};
+
+    // Connected TCP clients. Bytes of a record the socket didn't take are
+    // kept and sent first next time, so records are never cut. A client
+    // with leftovers skips new frames until it catches up.
+    struct Client {
+        int fd;
+        std::vector<U8> pending;
+    };
+
+    std::thread acceptor;
+    std::atomic<bool> accepting = false;
+    std::mutex clientsMutex;
+    std::vector<Client> clients;
+
+    // Records of the frames being sent. The payloads point straight into the
+    // input, into the compressed frame, or into the batch when frames are
+    // gathered first.
+    struct Record {
+        Header header;
+        const U8* payload;
+    };
+
+    std::vector<Record> records;
+    std::vector<iovec> vectors;
+    std::vector<U8> batch;
+    std::vector<U64> batchFrames;
+    std::vector<F32> batchScales;
+    std::vector<U8> compressed;
+    U16 datatype = 0;
+    U64 sequence = 0;
+    U64 frame = 0;
+
+    std::atomic<U64> framesSent = 0;
+    std::atomic<U64> bytesSent = 0;
+    std::atomic<U64> framesDropped = 0;
+
+    Result resolve(const std::string& host, const U64& port);
+    Result openUdp(const Config& config);
+    Result openTcp(const Config& config);
+    void acceptLoop();
+
+    F32 compress(const F32* data, const U64& size, const NetworkCompressionType& compression);
+    void slice(const U8* data, const U64& size, const U64& packetSize, const F32& scale);
+    void sendUdp(const U64& packetSize, const U64& frames);
+    void sendTcp(const U64& frames);
+};
+
+template<Device D, typename T>
+NetworkSink<D, T>::NetworkSink() {
+    impl = std::make_unique<Impl>();
+}
+
+template<Device D, typename T>
+NetworkSink<D, T>::~NetworkSink() {
+    impl.reset();
+}
+
+template<Device D, typename T>
+Result NetworkSink<D, T>::create() {
+    JST_DEBUG("Initializing Network Sink module.");
+    JST_INIT_IO();
+
+    // Check parameters.
+
+    if (config.port == 0 || config.port > 65535) {
+        JST_ERROR("Port {} is invalid.", config.port);
+        return Result::ERROR;
+    }
+
+    if (config.packetSize <= sizeof(typename Impl::Header) || config.packetSize > 65507) {
+        JST_ERROR("Packet size should be between {} and 65507 bytes.", sizeof(typename Impl::Header) + 1);
+        return Result::ERROR;
+    }
+
+    if (config.batchSize == 0) {
+        JST_ERROR("Batch size is zero.");
+        return Result::ERROR;
+    }
+
+    if (input.buffer.size_bytes() > std::numeric_limits<U32>::max()) {
+        JST_ERROR("Input is too large to be sent as one frame.");
+        return Result::ERROR;
+    }
+
+    // Reset state.
+
+    impl->sequence = 0;
+    impl->frame = 0;
+    impl->batch.clear();
+    impl->batchFrames.clear();
+    impl->batchScales.clear();
+    impl->datatype = NetworkStream::Datatype<T>(config.compression);
+    impl->framesSent = 0;
+    impl->bytesSent = 0;
+    impl->framesDropped = 0;
+
+    JST_CHECK(impl->resolve(config.address, config.port));
+
+    if (config.protocol == NetworkProtocolType::UDP) {
+        JST_CHECK(impl->openUdp(config));
+    } else {
+        JST_CHECK(impl->openTcp(config));
+    }
+
+    return Result::SUCCESS;
+}
+
+template<Device D, typename T>
+Result NetworkSink<D, T>::destroy() {
+    JST_DEBUG("Destroying Network Sink module.");
+
+    impl->accepting = false;
+    if (impl->fd >= 0) {
+        shutdown(impl->fd, SHUT_RDWR);
+    }
+
+    if (impl->acceptor.joinable()) {
+        impl->acceptor.join();
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(impl->clientsMutex);
+        for (const auto& client : impl->clients) {
+            close(client.fd);
+        }
+        impl->clients.clear();
+    }
+
+    if (impl->fd >= 0) {
+        close(impl->fd);
+        impl->fd = -1;
+    }
+
+    return Result::SUCCESS;
+}
+
+template<Device D, typename T>
+Result NetworkSink<D, T>::Impl::resolve(const std::string& host, const U64& port) {
+    addrinfo hints = {};
+    hints.ai_family = AF_INET;
+
+    addrinfo* result = nullptr;
+    if (getaddrinfo(host.c_str(), nullptr, &hints, &result) != 0 || !result) {
+        JST_ERROR("Failed to resolve address '{}'.", host);
+        return Result::ERROR;
+    }
+
+    address = *reinterpret_cast<sockaddr_in*>(result->ai_addr);
+    address.sin_port = htons(static_cast<U16>(port));
+    freeaddrinfo(result);
+
+    return Result::SUCCESS;
+}
+
+template<Device D, typename T>
+Result NetworkSink<D, T>::Impl::openUdp(const Config& config) {
+    fd = socket(AF_INET, SOCK_DGRAM, 0);
+    if (fd < 0) {
+        JST_ERROR("Failed to create socket ({}).", std::strerror(errno));
+        return Result::ERROR;
+    }
+
+    const int sendBuffer = 8 << 20;
+    setsockopt(fd, SOL_SOCKET, SO_SNDBUF, &sendBuffer, sizeof(sendBuffer));
+
+    if (IN_MULTICAST(ntohl(address.sin_addr.s_addr))) {
+        const U8 ttl = static_cast<U8>(std::min<U64>(config.multicastTtl, 255));
+        const U8 loop = 1;
+        setsockopt(fd, IPPROTO_IP, IP_MULTICAST_TTL, &ttl, sizeof(ttl));
+        setsockopt(fd, IPPROTO_IP, IP_MULTICAST_LOOP, &loop, sizeof(loop));
+    }
+
+    // A connected datagram socket skips the route lookup of every send.
+    if (connect(fd, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) != 0) {
+        JST_ERROR("Failed to connect to '{}:{}' ({}).", config.address, config.port, std::strerror(errno));
+        close(fd);
+        fd = -1;
+        return Result::ERROR;
+    }
+
+    JST_INFO("[NETWORK_SINK] Sending UDP to '{}:{}'.", config.address, config.port);
+
+    return Result::SUCCESS;
+}
+
+template<Device D, typename T>
+Result NetworkSink<D, T>::Impl::openTcp(const Config& config) {
+    fd = socket(AF_INET, SOCK_STREAM, 0);
+    if (fd < 0) {
+        JST_ERROR("Failed to create socket ({}).", std::strerror(errno));
+        return Result::ERROR;
+    }
+
+    const int reuse = 1;
+    setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+
+    if (bind(fd, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) != 0 || listen(fd, 8) != 0) {
+        JST_ERROR("Failed to listen on '{}:{}' ({}).", config.address, config.port, std::strerror(errno));
+        close(fd);
+        fd = -1;
+        return Result::ERROR;
+    }
+
+    accepting = true;
+    acceptor = std::thread([&]{
+        ApplyThreadPolicy(ThreadRole::IO);
+        acceptLoop();
+    });
+
+    JST_INFO("[NETWORK_SINK] Listening for TCP clients on '{}:{}'.", config.address, config.port);
+
+    return Result::SUCCESS;
+}
+
+template<Device D, typename T>
+void NetworkSink<D, T>::Impl::acceptLoop() {
+    while (accepting) {
+        pollfd descriptor = {fd, POLLIN, 0};
+        if (poll(&descriptor, 1, 100) <= 0 || !(descriptor.revents & POLLIN)) {
+            continue;
+        }
+
+        const int client = accept(fd, nullptr, nullptr);
+        if (client < 0) {
+            continue;
+        }
+
+        // Sends never wait on a slow client.
+        fcntl(client, F_SETFL, fcntl(client, F_GETFL) | O_NONBLOCK);
+
+        const int noDelay = 1;
+        const int sendBuffer = 8 << 20;
+        setsockopt(client, IPPROTO_TCP, TCP_NODELAY, &noDelay, sizeof(noDelay));
+        setsockopt(client, SOL_SOCKET, SO_SNDBUF, &sendBuffer, sizeof(sendBuffer));
+#ifdef SO_NOSIGPIPE
+        const int noSigPipe = 1;
+        setsockopt(client, SOL_SOCKET, SO_NOSIGPIPE, &noSigPipe, sizeof(noSigPipe));
+#endif
+
+        std::lock_guard<std::mutex> lock(clientsMutex);
+        clients.push_back({client, {}});
+
+        JST_DEBUG("[NETWORK_SINK] Client connected.");
+    }
+}
+
+template<Device D, typename T>
+F32 NetworkSink<D, T>::Impl::compress(const F32* data, const U64& size, const NetworkCompressionType& compression) {
+    // The loudest sample of the frame maps to the largest integer. A silent
+    // or broken frame keeps a unit step.
+
+    const F32 range = (compression == NetworkCompressionType::Int16) ? 32767.0f : 127.0f;
+    const F32 peak = Backend::AbsMax().kernel()(data, size);
+    const F32 scale = (peak > 0.0f && std::isfinite(peak)) ? (peak / range) : 1.0f;
+
+    if (compression == NetworkCompressionType::Int16) {
+        compressed.resize(size * sizeof(I16));
+        Backend::QuantizeI16().kernel()(data, reinterpret_cast<I16*>(compressed.data()), size, 1.0f / scale);
+    } else {
+        compressed.resize(size * sizeof(I8));
+        Backend::QuantizeI8().kernel()(data, reinterpret_cast<I8*>(compressed.data()), size, 1.0f / scale);
+    }
+
+    return scale;
+}
+
+template<Device D, typename T>
+void NetworkSink<D, T>::Impl::slice(const U8* data, const U64& size, const U64& packetSize, const F32& scale) {
+    const U64 sliceSize = packetSize - sizeof(Header);
+
+    for (U64 offset = 0; offset < size; offset += sliceSize) {
+        Record record;
+        record.header = {
+            .magic = NetworkStream::Magic,
+            .version = NetworkStream::Version,
+            .datatype = datatype,
+            .sequence = sequence++,
+            .frame = frame,
+            .frameSize = static_cast<U32>(size),
+            .offset = static_cast<U32>(offset),
+            .size = static_cast<U32>(std::min(sliceSize, size - offset)),
+            .scale = scale,
+        };
+        record.payload = data + offset;
+        records.push_back(record);
+    }
+
+    frame += 1;
+}
+
+template<Device D, typename T>
+void NetworkSink<D, T>::Impl::sendUdp(const U64& packetSize, const U64& frames) {
+    // Records are packed in datagrams of up to `packetSize` bytes. The
+    // headers and payloads are gathered by the kernel, nothing is copied.
+
+    vectors.clear();
+    vectors.reserve(records.size() * 2);
+
+    std::vector<msghdr> messages;
+    U64 bytes = 0;
+
+    for (U64 r = 0; r < records.size();) {
+        msghdr message = {};
+        message.msg_iov = vectors.data() + vectors.size();
+
+        U64 datagram = 0;
+        while (r < records.size()) {
+            const U64 recordSize = sizeof(Header) + records[r].header.size;
+            if (datagram > 0 && datagram + recordSize > packetSize) {
+                break;
+            }
+            vectors.push_back({&records[r].header, sizeof(Header)});
+            vectors.push_back({const_cast<U8*>(records[r].payload), records[r].header.size});
+            message.msg_iovlen += 2;
+            datagram += recordSize;
+            r += 1;
+        }
+
+        messages.push_back(message);
+        bytes += datagram;
+    }
+
+    // A full socket buffer drops the rest of the frames, waiting would stall
+    // the graph.
+
+    bool dropped = false;
+
+#if defined(JST_OS_LINUX) || defined(JST_OS_ANDROID)
+    std::vector<mmsghdr> batched(messages.size());
+    for (U64 m = 0; m < messages.size(); m++) {
+        batched[m].msg_hdr = messages[m];
+    }
+
+    for (U64 m = 0; m < batched.size();) {
+        const int count = sendmmsg(fd, batched.data() + m, batched.size() - m, MSG_DONTWAIT);
+        if (count <= 0) {
+            if (count < 0 && errno == EINTR) {
+                continue;
+            }
+            dropped = true;
+            break;
+        }
+        m += static_cast<U64>(count);
+    }
+#else
+    for (const auto& message : messages) {
+        if (sendmsg(fd, &message, MSG_DONTWAIT) < 0) {
+            dropped = true;
+            break;
+        }
+    }
+#endif
+
+    if (dropped) {
+        framesDropped += frames;
+        return;
+    }
+
+    framesSent += frames;
+    bytesSent += bytes;
+}
+
+template<Device D, typename T>
+void NetworkSink<D, T>::Impl::sendTcp(const U64& frames) {
+    vectors.clear();
+    vectors.reserve(records.size() * 2);
+
+    U64 bytes = 0;
+    for (auto& record : records) {
+        vectors.push_back({&record.header, sizeof(Header)});
+        vectors.push_back({const_cast<U8*>(record.payload), record.header.size});
+        bytes += sizeof(Header) + record.header.size;
+    }
+
+#ifdef MSG_NOSIGNAL
+    constexpr int flags = MSG_NOSIGNAL;
+#else
+    constexpr int flags = 0;
+#endif
+
+    std::lock_guard<std::mutex> lock(clientsMutex);
+
+    std::erase_if(clients, [&](Client& client) {
+        // Finish the records of a previous send first.
+        if (!client.pending.empty()) {
+            const ssize_t count = send(client.fd, client.pending.data(), client.pending.size(), flags);
+            if (count < 0 && errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR) {
+                close(client.fd);
+                JST_DEBUG("[NETWORK_SINK] Client disconnected.");
+                return true;
+            }
+            if (count > 0) {
+                client.pending.erase(client.pending.begin(), client.pending.begin() + count);
+            }
+            if (!client.pending.empty()) {
+                framesDropped += frames;
+                return false;
+            }
+        }
+
+        // Sending in chunks keeps the vector count under the system limit.
+        U64 sent = 0;
+        for (U64 v = 0; v < vectors.size();) {
+            msghdr message = {};
+            message.msg_iov = vectors.data() + v;
+            message.msg_iovlen = std::min<U64>(vectors.size() - v, IOV_MAX);
+
+            U64 chunk = 0;
+            for (U64 i = 0; i < static_cast<U64>(message.msg_iovlen); i++) {
+                chunk += vectors[v + i].iov_len;
+            }
+
+            const ssize_t written = sendmsg(client.fd, &message, flags);
+            if (written < 0) {
+                if (errno == EINTR) {
+                    continue;
+                }
+                if (errno != EAGAIN && errno != EWOULDBLOCK) {
+                    close(client.fd);
+                    JST_DEBUG("[NETWORK_SINK] Client disconnected.");
+                    return true;
+                }
+                break;
+            }
+
+            sent += static_cast<U64>(written);
+            if (static_cast<U64>(written) < chunk) {
+                break;
+            }
+            v += message.msg_iovlen;
+        }
+
+        if (sent == 0) {
+            framesDropped += frames;
+            return false;
+        }
+
+        // Keep the rest of the records so the stream stays parseable.
+        if (sent < bytes) {
+            client.pending.reserve(bytes - sent);
+            U64 skip = sent;
+            for (const auto& vector : vectors) {
+                const auto* base = static_cast<const U8*>(vector.iov_base);
+                if (skip >= vector.iov_len) {
+                    skip -= vector.iov_len;
+                    continue;
+                }
+                client.pending.insert(client.pending.end(), base + skip, base + vector.iov_len);
+                skip = 0;
+            }
+        }
+
+        return false;
+    });
+
+    if (!clients.empty()) {
+        framesSent += frames;
+        bytesSent += bytes;
+    }
+}
+
+template<Device D, typename T>
+void NetworkSink<D, T>::info() const {
+    JST_DEBUG("  Protocol: {}", config.protocol);
+    JST_DEBUG("  Address: {}:{}", config.address, config.port);
+    JST_DEBUG("  Packet Size: {} bytes", config.packetSize);
+    JST_DEBUG("  Batch Size: {}", config.batchSize);
+    JST_DEBUG("  Compression: {}", config.compression);
+}
+
+template<Device D, typename T>
+Result NetworkSink<D, T>::createCompute(const Context&) {
+    JST_TRACE("Create Network Sink compute core.");
+    return Result::SUCCESS;
+}
+
+template<Device D, typename T>
+Result NetworkSink<D, T>::compute(const Context&) {
+    const U8* data = reinterpret_cast<const U8*>(input.buffer.data());
+    U64 size = input.buffer.size_bytes();
+    F32 scale = 0.0f;
+
+    if (config.compression != NetworkCompressionType::None) {
+        const U64 scalars = size / sizeof(F32);
+        scale = impl->compress(reinterpret_cast<const F32*>(data), scalars, config.compression);
+        data = impl->compressed.data();
+        size = impl->compressed.size();
+    }
+
+    // Batched frames are copied, the input is reused by the next compute.
+
+    U64 frames = 1;
+    impl->records.clear();
+
+    if (config.batchSize > 1) {
+        impl->batchFrames.push_back(impl->batch.size());
+        impl->batchScales.push_back(scale);
+        impl->batch.insert(impl->batch.end(), data, data + size);
+
+        if (impl->batchFrames.size() < config.batchSize) {
+            return Result::SUCCESS;
+        }
+
+        frames = impl->batchFrames.size();
+        for (U64 f = 0; f < frames; f++) {
+            impl->slice(impl->batch.data() + impl->batchFrames[f], size, config.packetSize, impl->batchScales[f]);
+        }
+    } else {
+        impl->slice(data, size, config.packetSize, scale);
+    }
+
+    if (config.protocol == NetworkProtocolType::UDP) {
+        impl->sendUdp(config.packetSize, frames);
+    } else {
+        impl->sendTcp(frames);
+    }
+
+    impl->batch.clear();
+    impl->batchFrames.clear();
+    impl->batchScales.clear();
+
+    return Result::SUCCESS;
+}
+
+template<Device D, typename T>
+U64 NetworkSink<D, T>::getFramesSent() const {
+    return impl->framesSent;
+}
+
+template<Device D, typename T>
+U64 NetworkSink<D, T>::getBytesSent() const {
+    return impl->bytesSent;
+}
+
+template<Device D, typename T>
+U64 NetworkSink<D, T>::getFramesDropped() const {
+    return impl->framesDropped;
+}
+
+template<Device D, typename T>
+U64 NetworkSink<D, T>::getNumberOfClients() const {
+    std::lock_guard<std::mutex> lock(impl->clientsMutex);
+    return impl->clients.size();
+}
+
+JST_NETWORK_SINK_CPU(JST_INSTANTIATION)
+
+}  // namespace Jetstream
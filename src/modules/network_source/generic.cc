@@ -0,0 +1,613 @@
+#include "jetstream/modules/network_source.hh"
+#include "jetstream/compute/thread.hh"
+#include "jetstream/backend/devices/cpu/simd.hh"
+
+#include <atomic>
+#include <thread>
+#include <chrono>
+#include <cerrno>
+#include <cstring>
+
+#include <fcntl.h>
+#include <netdb.h>
+#include <poll.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+
+namespace Jetstream {
+
+template<Device D, typename T>
+struct NetworkSource<D, T>::Impl {
+    typedef NetworkStream::Header Header;
+
+    static constexpr U64 MaxDatagramSize = 65536;
+    static constexpr U64 DatagramBatch = 32;
+
+    // Floats per sample.
+    static constexpr U64 Scalars = sizeof(T) / sizeof(F32);
+
+    int fd = -1;
+    sockaddr_in address = {};
+
+    std::thread receiver;
+    std::atomic<bool> receiving = false;
+    std::atomic<bool> connected = false;
+
+    Memory::CircularBuffer<T> buffer;
+
+    // Frames are assembled in place, straight in a window of the ring when
+    // it has a contiguous one. A frame missing a record is dropped whole, so
+    // the outputs stay aligned to the frames of the sender.
+    bool assembling = false;
+    U64 frame = 0;
+    U64 frameSize = 0;
+    U64 received = 0;
+    T* window = nullptr;
+    std::vector<T> scratch;
+
+    // Compressed frames are assembled in `wire` and restored to floats once
+    // complete. The sink picks the compression, each frame says which one.
+    U16 frameDatatype = 0;
+    F32 frameScale = 0.0f;
+    U64 frameElements = 0;
+    std::vector<U8> wire;
+
+    bool synchronized = false;
+    U64 expectedSequence = 0;
+    bool warned = false;
+
+    std::atomic<U64> framesReceived = 0;
+    std::atomic<U64> framesDropped = 0;
+    std::atomic<U64> recordsLost = 0;
+
+    Result resolve(const std::string& host, const U64& port);
+    Result openUdp(const Config& config);
+    Result connectTcp();
+
+    void udpLoop();
+    void tcpLoop();
+    bool readExact(U8* data, const U64& size);
+
+    // Bytes of one float of the samples sent with a datatype. Zero if the
+    // datatype doesn't carry T.
+    static U64 ScalarSize(const U16& datatype);
+
+    // Returns where the payload of a record goes, or nullptr to skip it.
+    U8* begin(const Header& header);
+    void end(const Header& header);
+    void abort();
+};
+
+template<Device D, typename T>
+NetworkSource<D, T>::NetworkSource() {
+    impl = std::make_unique<Impl>();
+}
+
+template<Device D, typename T>
+NetworkSource<D, T>::~NetworkSource() {
+    impl.reset();
+}
+
+template<Device D, typename T>
+Result NetworkSource<D, T>::create() {
+    JST_DEBUG("Initializing Network Source module.");
+    JST_INIT_IO();
+
+    // Check parameters.
+
+    if (config.port == 0 || config.port > 65535) {
+        JST_ERROR("Port {} is invalid.", config.port);
+        return Result::ERROR;
+    }
+
+    if (config.bufferMultiplier == 0) {
+        JST_ERROR("Buffer multiplier is zero.");
+        return Result::ERROR;
+    }
+
+    // Allocate output.
+
+    output.buffer = Tensor<D, T>(config.shape);
+    if (output.buffer.size() == 0) {
+        JST_ERROR("Output shape is zero.");
+        return Result::ERROR;
+    }
+
+    // Allocate circular buffer.
+
+    impl->buffer.resize(output.buffer.size() * config.bufferMultiplier, Memory::CircularBuffer<T>::Mode::LockFree);
+    impl->buffer.setPutCallback([&]{
+        notifyCompute();
+    });
+
+    // Reset state.
+
+    impl->assembling = false;
+    impl->synchronized = false;
+    impl->warned = false;
+    impl->framesReceived = 0;
+    impl->framesDropped = 0;
+    impl->recordsLost = 0;
+
+    JST_CHECK(impl->resolve(config.address, config.port));
+
+    if (config.protocol == NetworkProtocolType::UDP) {
+        JST_CHECK(impl->openUdp(config));
+    }
+
+    // Initialize thread for ingest.
+
+    impl->receiving = true;
+    impl->receiver = std::thread([&]{
+        ApplyThreadPolicy(ThreadRole::IO);
+
+        if (config.protocol == NetworkProtocolType::UDP) {
+            impl->udpLoop();
+        } else {
+            impl->tcpLoop();
+        }
+    });
+
+    return Result::SUCCESS;
+}
+
+template<Device D, typename T>
+Result NetworkSource<D, T>::destroy() {
+    JST_DEBUG("Destroying Network Source module.");
+
+    impl->receiving = false;
+
+    if (impl->receiver.joinable()) {
+        impl->receiver.join();
+    }
+
+    impl->buffer.setPutCallback({});
+
+    if (impl->fd >= 0) {
+        close(impl->fd);
+        impl->fd = -1;
+    }
+
+    return Result::SUCCESS;
+}
+
+template<Device D, typename T>
+Result NetworkSource<D, T>::Impl::resolve(const std::string& host, const U64& port) {
+    addrinfo hints = {};
+    hints.ai_family = AF_INET;
+
+    addrinfo* result = nullptr;
+    if (getaddrinfo(host.c_str(), nullptr, &hints, &result) != 0 || !result) {
+        JST_ERROR("Failed to resolve address '{}'.", host);
+        return Result::ERROR;
+    }
+
+    address = *reinterpret_cast<sockaddr_in*>(result->ai_addr);
+    address.sin_port = htons(static_cast<U16>(port));
+    freeaddrinfo(result);
+
+    return Result::SUCCESS;
+}
+
+template<Device D, typename T>
+Result NetworkSource<D, T>::Impl::openUdp(const Config& config) {
+    fd = socket(AF_INET, SOCK_DGRAM, 0);
+    if (fd < 0) {
+        JST_ERROR("Failed to create socket ({}).", std::strerror(errno));
+        return Result::ERROR;
+    }
+
+    const int reuse = 1;
+    const int receiveBuffer = 16 << 20;
+    const timeval timeout = {0, 100000};
+    setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+    setsockopt(fd, SOL_SOCKET, SO_RCVBUF, &receiveBuffer, sizeof(receiveBuffer));
+    setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+
+    // Multicast groups are joined on every interface, and the port is bound
+    // on the wildcard address so other listeners of the group can share it.
+    const bool multicast = IN_MULTICAST(ntohl(address.sin_addr.s_addr));
+
+    sockaddr_in local = address;
+    if (multicast) {
+        local.sin_addr.s_addr = htonl(INADDR_ANY);
+    }
+
+    if (bind(fd, reinterpret_cast<const sockaddr*>(&local), sizeof(local)) != 0) {
+        JST_ERROR("Failed to bind '{}:{}' ({}).", config.address, config.port, std::strerror(errno));
+        close(fd);
+        fd = -1;
+        return Result::ERROR;
+    }
+
+    if (multicast) {
+        ip_mreq request = {};
+        request.imr_multiaddr = address.sin_addr;
+        request.imr_interface.s_addr = htonl(INADDR_ANY);
+
+        if (setsockopt(fd, IPPROTO_IP, IP_ADD_MEMBERSHIP, &request, sizeof(request)) != 0) {
+            JST_ERROR("Failed to join multicast group '{}' ({}).", config.address, std::strerror(errno));
+            close(fd);
+            fd = -1;
+            return Result::ERROR;
+        }
+    }
+
+    connected = true;
+
+    JST_INFO("[NETWORK_SOURCE] Receiving UDP on '{}:{}'.", config.address, config.port);
+
+    return Result::SUCCESS;
+}
+
+template<Device D, typename T>
+Result NetworkSource<D, T>::Impl::connectTcp() {
+    fd = socket(AF_INET, SOCK_STREAM, 0);
+    if (fd < 0) {
+        return Result::ERROR;
+    }
+
+    // Connect without blocking, so a missing sink doesn't hold the thread.
+
+    fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+
+    if (connect(fd, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) != 0 && errno != EINPROGRESS) {
+        close(fd);
+        fd = -1;
+        return Result::ERROR;
+    }
+
+    pollfd descriptor = {fd, POLLOUT, 0};
+    int error = 0;
+    socklen_t length = sizeof(error);
+    if (poll(&descriptor, 1, 1000) <= 0 ||
+        getsockopt(fd, SOL_SOCKET, SO_ERROR, &error, &length) != 0 ||
+        error != 0) {
+        close(fd);
+        fd = -1;
+        return Result::ERROR;
+    }
+
+    fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) & ~O_NONBLOCK);
+
+    const int receiveBuffer = 16 << 20;
+    const timeval timeout = {0, 100000};
+    setsockopt(fd, SOL_SOCKET, SO_RCVBUF, &receiveBuffer, sizeof(receiveBuffer));
+    setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+
+    return Result::SUCCESS;
+}
+
+template<Device D, typename T>
+void NetworkSource<D, T>::Impl::udpLoop() {
+    std::vector<U8> datagrams(MaxDatagramSize * DatagramBatch);
+
+    auto parse = [&](const U8* datagram, const U64& size) {
+        U64 offset = 0;
+        while (offset + sizeof(Header) <= size) {
+            Header header;
+            std::memcpy(&header, datagram + offset, sizeof(Header));
+            offset += sizeof(Header);
+
+            if (offset + header.size > size) {
+                break;
+            }
+
+            if (U8* target = begin(header)) {
+                std::memcpy(target, datagram + offset, header.size);
+                end(header);
+            }
+
+            offset += header.size;
+        }
+    };
+
+#if defined(JST_OS_LINUX) || defined(JST_OS_ANDROID)
+    // Several datagrams per system call.
+
+    std::vector<iovec> vectors(DatagramBatch);
+    std::vector<mmsghdr> messages(DatagramBatch);
+    for (U64 i = 0; i < DatagramBatch; i++) {
+        vectors[i] = {datagrams.data() + i * MaxDatagramSize, MaxDatagramSize};
+        messages[i] = {};
+        messages[i].msg_hdr.msg_iov = &vectors[i];
+        messages[i].msg_hdr.msg_iovlen = 1;
+    }
+
+    while (receiving) {
+        const int count = recvmmsg(fd, messages.data(), DatagramBatch, MSG_WAITFORONE, nullptr);
+        for (int i = 0; i < count; i++) {
+            parse(datagrams.data() + i * MaxDatagramSize, messages[i].msg_len);
+        }
+    }
+#else
+    while (receiving) {
+        const ssize_t size = recv(fd, datagrams.data(), MaxDatagramSize, 0);
+        if (size > 0) {
+            parse(datagrams.data(), static_cast<U64>(size));
+        }
+    }
+#endif
+}
+
+template<Device D, typename T>
+void NetworkSource<D, T>::Impl::tcpLoop() {
+    std::vector<U8> discard(MaxDatagramSize);
+
+    while (receiving) {
+        if (connectTcp() != Result::SUCCESS) {
+            // Try again in a second.
+            for (U64 i = 0; i < 10 && receiving; i++) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(100));
+            }
+            continue;
+        }
+
+        JST_INFO("[NETWORK_SOURCE] Connected to the sink.");
+
+        connected = true;
+        synchronized = false;
+        assembling = false;
+
+        // The payload is read straight into the frame.
+
+        while (receiving) {
+            Header header;
+            if (!readExact(reinterpret_cast<U8*>(&header), sizeof(Header))) {
+                break;
+            }
+
+            // Records can't be found again in a corrupted stream.
+            if (header.magic != NetworkStream::Magic) {
+                JST_ERROR("[NETWORK_SOURCE] Stream is corrupted. Reconnecting.");
+                break;
+            }
+
+            if (U8* target = begin(header)) {
+                if (!readExact(target, header.size)) {
+                    abort();
+                    break;
+                }
+                end(header);
+                continue;
+            }
+
+            bool skipped = true;
+            for (U64 remaining = header.size; remaining > 0 && skipped;) {
+                const U64 size = std::min<U64>(remaining, discard.size());
+                skipped = readExact(discard.data(), size);
+                remaining -= size;
+            }
+            if (!skipped) {
+                break;
+            }
+        }
+
+        connected = false;
+        close(fd);
+        fd = -1;
+
+        if (receiving) {
+            JST_WARN("[NETWORK_SOURCE] Disconnected from the sink.");
+        }
+    }
+}
+
+template<Device D, typename T>
+bool NetworkSource<D, T>::Impl::readExact(U8* data, const U64& size) {
+    U64 offset = 0;
+    while (offset < size) {
+        const ssize_t count = recv(fd, data + offset, size - offset, 0);
+        if (count > 0) {
+            offset += static_cast<U64>(count);
+            continue;
+        }
+        if (count < 0 && (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR) && receiving) {
+            continue;
+        }
+        return false;
+    }
+    return true;
+}
+
+template<Device D, typename T>
+U64 NetworkSource<D, T>::Impl::ScalarSize(const U16& datatype) {
+    if (datatype == NetworkStream::Datatype<T>()) {
+        return sizeof(F32);
+    }
+    if (datatype == NetworkStream::Datatype<T>(NetworkCompressionType::Int16)) {
+        return sizeof(I16);
+    }
+    if (datatype == NetworkStream::Datatype<T>(NetworkCompressionType::Int8)) {
+        return sizeof(I8);
+    }
+    return 0;
+}
+
+template<Device D, typename T>
+U8* NetworkSource<D, T>::Impl::begin(const Header& header) {
+    const U64 elementSize = ScalarSize(header.datatype) * Scalars;
+
+    if (header.magic != NetworkStream::Magic ||
+        header.version != NetworkStream::Version ||
+        elementSize == 0 ||
+        header.frameSize == 0 ||
+        (header.frameSize % elementSize) != 0 ||
+        static_cast<U64>(header.offset) + header.size > header.frameSize) {
+        if (!warned) {
+            JST_WARN("[NETWORK_SOURCE] Ignoring records of a different type or version.");
+            warned = true;
+        }
+        return nullptr;
+    }
+
+    // A gap in the sequence counts lost records. A sequence going back is a
+    // restarted sink.
+
+    if (synchronized && header.sequence > expectedSequence) {
+        recordsLost += header.sequence - expectedSequence;
+    }
+    synchronized = true;
+    expectedSequence = header.sequence + 1;
+
+    if (header.offset == 0) {
+        if (assembling) {
+            abort();
+        }
+
+        const U64 elements = header.frameSize / elementSize;
+
+        if ((buffer.getCapacity() - buffer.getOccupancy()) < elements) {
+            if (elements > buffer.getCapacity() && !warned) {
+                JST_WARN("[NETWORK_SOURCE] Frames of {} samples don't fit the buffer. Increase the buffer multiplier.", elements);
+                warned = true;
+            }
+            framesDropped += 1;
+            return nullptr;
+        }
+
+        window = buffer.reserve(elements);
+        if (!window) {
+            scratch.resize(elements);
+        }
+
+        assembling = true;
+        frame = header.frame;
+        frameSize = header.frameSize;
+        frameDatatype = header.datatype;
+        frameScale = header.scale;
+        frameElements = elements;
+        received = 0;
+
+        if (frameDatatype != NetworkStream::Datatype<T>()) {
+            wire.resize(frameSize);
+        }
+    } else if (!assembling ||
+               header.frame != frame ||
+               header.offset != received ||
+               header.datatype != frameDatatype) {
+        if (assembling) {
+            abort();
+        }
+        return nullptr;
+    }
+
+    if (frameDatatype != NetworkStream::Datatype<T>()) {
+        return wire.data() + header.offset;
+    }
+
+    return reinterpret_cast<U8*>(window ? window : scratch.data()) + header.offset;
+}
+
+template<Device D, typename T>
+void NetworkSource<D, T>::Impl::end(const Header& header) {
+    received += header.size;
+
+    if (received < frameSize) {
+        return;
+    }
+
+    T* samples = window ? window : scratch.data();
+    F32* scalars = reinterpret_cast<F32*>(samples);
+    const U64 count = frameElements * Scalars;
+
+    if (frameDatatype == NetworkStream::Datatype<T>(NetworkCompressionType::Int16)) {
+        Backend::ConvertI16().kernel()(reinterpret_cast<const I16*>(wire.data()), scalars, count, frameScale);
+    } else if (frameDatatype == NetworkStream::Datatype<T>(NetworkCompressionType::Int8)) {
+        Backend::ConvertI8().kernel()(reinterpret_cast<const I8*>(wire.data()), scalars, count, frameScale);
+    }
+
+    if (window) {
+        buffer.commit(frameElements);
+    } else {
+        buffer.put(samples, frameElements);
+    }
+
+    framesReceived += 1;
+    assembling = false;
+}
+
+template<Device D, typename T>
+void NetworkSource<D, T>::Impl::abort() {
+    framesDropped += 1;
+    assembling = false;
+}
+
+template<Device D, typename T>
+void NetworkSource<D, T>::info() const {
+    JST_DEBUG("  Protocol: {}", config.protocol);
+    JST_DEBUG("  Address: {}:{}", config.address, config.port);
+    JST_DEBUG("  Shape: {}", config.shape);
+    JST_DEBUG("  Buffer Multiplier: {}", config.bufferMultiplier);
+}
+
+template<Device D, typename T>
+Result NetworkSource<D, T>::createCompute(const Context&) {
+    JST_TRACE("Create Network Source compute core.");
+    return Result::SUCCESS;
+}
+
+template<Device D, typename T>
+Result NetworkSource<D, T>::computeReady() {
+    // The buffer notifies the scheduler once it has enough samples.
+    if (impl->buffer.getOccupancy() < output.buffer.size()) {
+        return Result::TIMEOUT;
+    }
+
+    return Result::SUCCESS;
+}
+
+template<Device D, typename T>
+Result NetworkSource<D, T>::compute(const Context&) {
+    const U64 size = output.buffer.size();
+
+    if (impl->buffer.getOccupancy() < size) {
+        return Result::YIELD;
+    }
+
+    // Non-mirrored buffers can't peek across the wraparound.
+    if (const T* samples = impl->buffer.peek(size)) {
+        std::copy_n(samples, size, output.buffer.data());
+        impl->buffer.consume(size);
+    } else {
+        impl->buffer.get(output.buffer.data(), size);
+    }
+
+    return Result::SUCCESS;
+}
+
+template<Device D, typename T>
+Memory::CircularBuffer<T>& NetworkSource<D, T>::getCircularBuffer() {
+    return impl->buffer;
+}
+
+template<Device D, typename T>
+std::vector<Compute::BufferStatistics> NetworkSource<D, T>::computeBuffers() const {
+    return {BufferStatistics::From("network", impl->buffer)};
+}
+
+template<Device D, typename T>
+U64 NetworkSource<D, T>::getFramesReceived() const {
+    return impl->framesReceived;
+}
+
+template<Device D, typename T>
+U64 NetworkSource<D, T>::getFramesDropped() const {
+    return impl->framesDropped;
+}
+
+template<Device D, typename T>
+U64 NetworkSource<D, T>::getRecordsLost() const {
+    return impl->recordsLost;
+}
+
+template<Device D, typename T>
+bool NetworkSource<D, T>::isConnected() const {
+    return impl->connected;
+}
+
+JST_NETWORK_SOURCE_CPU(JST_INSTANTIATION)
+
+}  // namespace Jetstream
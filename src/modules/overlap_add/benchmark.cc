@@ -0,0 +1,13 @@
+#include "jetstream/modules/overlap_add.hh"
+
+namespace Jetstream {
+
+template<template<Device, typename...> class Module, Device D, typename T>
+void benchmark(ankerl::nanobench::Bench& bench, std::string name) {
+    JST_BENCHMARK_RUN("8x8192 (1024 overlap)", {}, {
+        .buffer = Tensor<D COMMA T>({8 COMMA 8192}) COMMA
+        .overlap = Tensor<D COMMA T>({8 COMMA 1024}) COMMA
+    }, T);
+}
+
+}  // namespace Jetstream
@@ -0,0 +1,189 @@
+#include "../generic.cc"
+
+#include "jetstream/memory/devices/cuda/copy.hh"
+
+namespace Jetstream {
+
+template<Device D, typename T>
+struct OverlapAdd<D, T>::Impl {
+    Tensor<D, T> previousOverlap;
+
+    std::vector<U64> grid;
+    std::vector<U64> block;
+    std::vector<U64> carryGrid;
+
+    std::vector<void*> arguments;
+    std::vector<void*> carryArguments;
+
+    Tensor<Device::CUDA, T> input;
+    Tensor<Device::CUDA, T> overlap;
+
+    U64 batches = 0;
+    U64 rowSize = 0;
+    U64 overlapSize = 0;
+    U64 numberOfElements = 0;
+};
+
+template<Device D, typename T>
+OverlapAdd<D, T>::OverlapAdd() {
+    impl = std::make_unique<Impl>();
+}
+
+template<Device D, typename T>
+OverlapAdd<D, T>::~OverlapAdd() {
+    impl.reset();
+}
+
+template<Device D, typename T>
+Result OverlapAdd<D, T>::createCompute(const Context& ctx) {
+    JST_TRACE("Create Overlap Add compute core using CUDA backend.");
+
+    // Check parameters.
+
+    if (input.buffer.rank() != 2 || config.axis != 1) {
+        JST_ERROR("CUDA backend only supports batched rank 2 buffers along axis 1.");
+        return Result::ERROR;
+    }
+
+    // Create CUDA kernels.
+    //
+    // Every thread writes one output sample. The head of each row adds the
+    // overlap of the row before it, and the first row adds the last overlap
+    // of the previous buffer. That one is saved by a second kernel once all
+    // threads are done.
+
+    std::string header;
+
+    if constexpr (std::is_same_v<T, CF32>) {
+        header = R"""(
+            typedef float2 sample_t;
+
+            __device__ inline sample_t add(const sample_t& a, const sample_t& b) {
+                return make_float2(a.x + b.x, a.y + b.y);
+            }
+        )""";
+    } else {
+        header = R"""(
+            typedef float sample_t;
+
+            __device__ inline sample_t add(const sample_t& a, const sample_t& b) {
+                return a + b;
+            }
+        )""";
+    }
+
+    ctx.cuda->createKernel("overlap_add", header + R"""(
+        __global__ void overlap_add(const sample_t* input,
+                                    const sample_t* overlap,
+                                    const sample_t* previous,
+                                    sample_t* output,
+                                    size_t rowSize,
+                                    size_t overlapSize,
+                                    size_t size) {
+            size_t id = blockIdx.x * blockDim.x + threadIdx.x;
+            if (id >= size) {
+                return;
+            }
+
+            const size_t j = id % rowSize;
+            const size_t b = id / rowSize;
+
+            if (j < overlapSize) {
+                const sample_t head = (b == 0) ? previous[j] : overlap[(b - 1) * overlapSize + j];
+                output[id] = add(input[id], head);
+            } else {
+                output[id] = input[id];
+            }
+        }
+    )""");
+
+    ctx.cuda->createKernel("overlap_add_carry", header + R"""(
+        __global__ void overlap_add_carry(const sample_t* overlap,
+                                          sample_t* previous,
+                                          size_t batches,
+                                          size_t overlapSize) {
+            size_t id = blockIdx.x * blockDim.x + threadIdx.x;
+            if (id < overlapSize) {
+                previous[id] = overlap[(batches - 1) * overlapSize + id];
+            }
+        }
+    )""");
+
+    // Calculate parameters.
+
+    impl->batches = input.buffer.shape()[0];
+    impl->rowSize = input.buffer.shape()[1];
+    impl->overlapSize = input.overlap.shape()[1];
+    impl->numberOfElements = output.buffer.size();
+
+    // Initialize kernel size.
+
+    U64 threadsPerBlock = 512;
+
+    impl->grid = { (impl->numberOfElements + threadsPerBlock - 1) / threadsPerBlock, 1, 1 };
+    impl->carryGrid = { (impl->overlapSize + threadsPerBlock - 1) / threadsPerBlock, 1, 1 };
+    impl->block = { threadsPerBlock, 1, 1 };
+
+    // Initialize kernel input.
+
+    if (!input.buffer.device_native() && input.buffer.contiguous()) {
+        impl->input = Tensor<Device::CUDA, T>(input.buffer.shape());
+    } else {
+        impl->input = input.buffer;
+    }
+
+    if (!input.overlap.device_native() && input.overlap.contiguous()) {
+        impl->overlap = Tensor<Device::CUDA, T>(input.overlap.shape());
+    } else {
+        impl->overlap = input.overlap;
+    }
+
+    // Initialize kernel arguments.
+
+    impl->arguments = {
+        impl->input.data_ptr(),
+        impl->overlap.data_ptr(),
+        impl->previousOverlap.data_ptr(),
+        output.buffer.data_ptr(),
+        &impl->rowSize,
+        &impl->overlapSize,
+        &impl->numberOfElements,
+    };
+
+    impl->carryArguments = {
+        impl->overlap.data_ptr(),
+        impl->previousOverlap.data_ptr(),
+        &impl->batches,
+        &impl->overlapSize,
+    };
+
+    return Result::SUCCESS;
+}
+
+template<Device D, typename T>
+Result OverlapAdd<D, T>::compute(const Context& ctx) {
+    if (!input.buffer.device_native() && input.buffer.contiguous()) {
+        JST_CHECK(Memory::Copy(impl->input, input.buffer, ctx.cuda->stream()));
+    }
+
+    if (!input.overlap.device_native() && input.overlap.contiguous()) {
+        JST_CHECK(Memory::Copy(impl->overlap, input.overlap, ctx.cuda->stream()));
+    }
+
+    JST_CHECK(ctx.cuda->launchKernel("overlap_add",
+                                     impl->grid,
+                                     impl->block,
+                                     impl->arguments.data()));
+
+    JST_CHECK(ctx.cuda->launchKernel("overlap_add_carry",
+                                     impl->carryGrid,
+                                     impl->block,
+                                     impl->carryArguments.data()));
+
+    return Result::SUCCESS;
+}
+
+JST_OVERLAP_ADD_CUDA(JST_INSTANTIATION)
+JST_OVERLAP_ADD_CUDA(JST_BENCHMARK)
+
+}  // namespace Jetstream
@@ -0,0 +1,138 @@
+#include "../generic.cc"
+
+namespace Jetstream {
+
+// Every thread writes one output sample. The head of each row adds the
+// overlap of the row before it, and the first row adds the last overlap of
+// the previous buffer. That one is saved by a second pass once all threads
+// are done.
+
+static const char shadersSrc[] = R"""(
+    struct Constants {
+        ulong batches;
+        ulong rowSize;
+        ulong overlapSize;
+        ulong size;
+    };
+
+    kernel void overlap_add(constant Constants& constants [[ buffer(0) ]],
+                            constant const sample_t *input [[ buffer(1) ]],
+                            constant const sample_t *overlap [[ buffer(2) ]],
+                            device const sample_t *previous [[ buffer(3) ]],
+                            device sample_t *output [[ buffer(4) ]],
+                            uint id[[ thread_position_in_grid ]]) {
+        if (id >= constants.size) {
+            return;
+        }
+
+        const ulong j = id % constants.rowSize;
+        const ulong b = id / constants.rowSize;
+
+        if (j < constants.overlapSize) {
+            const sample_t head = (b == 0) ? previous[j] : overlap[(b - 1) * constants.overlapSize + j];
+            output[id] = input[id] + head;
+        } else {
+            output[id] = input[id];
+        }
+    }
+
+    kernel void overlap_add_carry(constant Constants& constants [[ buffer(0) ]],
+                                  constant const sample_t *overlap [[ buffer(1) ]],
+                                  device sample_t *previous [[ buffer(2) ]],
+                                  uint id[[ thread_position_in_grid ]]) {
+        if (id < constants.overlapSize) {
+            previous[id] = overlap[(constants.batches - 1) * constants.overlapSize + id];
+        }
+    }
+)""";
+
+template<Device D, typename T>
+struct OverlapAdd<D, T>::Impl {
+    Tensor<D, T> previousOverlap;
+
+    struct Constants {
+        U64 batches;
+        U64 rowSize;
+        U64 overlapSize;
+        U64 size;
+    };
+
+    MTL::ComputePipelineState* state;
+    MTL::ComputePipelineState* carryState;
+    Tensor<Device::Metal, U8> constants;
+};
+
+template<Device D, typename T>
+OverlapAdd<D, T>::OverlapAdd() {
+    impl = std::make_unique<Impl>();
+}
+
+template<Device D, typename T>
+OverlapAdd<D, T>::~OverlapAdd() {
+    impl.reset();
+}
+
+template<Device D, typename T>
+Result OverlapAdd<D, T>::createCompute(const Context&) {
+    JST_TRACE("Create Overlap Add compute core using Metal backend.");
+
+    // Check parameters.
+
+    if (input.buffer.rank() != 2 || config.axis != 1) {
+        JST_ERROR("Metal backend only supports batched rank 2 buffers along axis 1.");
+        return Result::ERROR;
+    }
+
+    // Compile shaders.
+
+    std::string header = "#include <metal_stdlib>\nusing namespace metal;\n";
+    header += std::is_same_v<T, CF32> ? "typedef float2 sample_t;\n" : "typedef float sample_t;\n";
+
+    const std::string source = header + shadersSrc;
+    JST_CHECK(Metal::CompileKernel(source.c_str(), "overlap_add", &impl->state));
+    JST_CHECK(Metal::CompileKernel(source.c_str(), "overlap_add_carry", &impl->carryState));
+
+    // Create constants buffer.
+
+    auto* constants = Metal::CreateConstants<typename Impl::Constants>(*impl);
+    constants->batches = input.buffer.shape()[0];
+    constants->rowSize = input.buffer.shape()[1];
+    constants->overlapSize = input.overlap.shape()[1];
+    constants->size = output.buffer.size();
+
+    return Result::SUCCESS;
+}
+
+template<Device D, typename T>
+Result OverlapAdd<D, T>::compute(const Context& ctx) {
+    {
+        auto cmdEncoder = ctx.metal->commandBuffer()->computeCommandEncoder();
+        cmdEncoder->setComputePipelineState(impl->state);
+        cmdEncoder->setBuffer(impl->constants.data(), 0, 0);
+        cmdEncoder->setBuffer(input.buffer.data(), 0, 1);
+        cmdEncoder->setBuffer(input.overlap.data(), 0, 2);
+        cmdEncoder->setBuffer(impl->previousOverlap.data(), 0, 3);
+        cmdEncoder->setBuffer(output.buffer.data(), 0, 4);
+        cmdEncoder->dispatchThreads(MTL::Size(output.buffer.size(), 1, 1),
+                                    MTL::Size(impl->state->maxTotalThreadsPerThreadgroup(), 1, 1));
+        cmdEncoder->endEncoding();
+    }
+
+    {
+        auto cmdEncoder = ctx.metal->commandBuffer()->computeCommandEncoder();
+        cmdEncoder->setComputePipelineState(impl->carryState);
+        cmdEncoder->setBuffer(impl->constants.data(), 0, 0);
+        cmdEncoder->setBuffer(input.overlap.data(), 0, 1);
+        cmdEncoder->setBuffer(impl->previousOverlap.data(), 0, 2);
+        cmdEncoder->dispatchThreads(MTL::Size(input.overlap.shape()[1], 1, 1),
+                                    MTL::Size(impl->carryState->maxTotalThreadsPerThreadgroup(), 1, 1));
+        cmdEncoder->endEncoding();
+    }
+
+    return Result::SUCCESS;
+}
+
+JST_OVERLAP_ADD_METAL(JST_INSTANTIATION)
+JST_OVERLAP_ADD_METAL(JST_BENCHMARK)
+
+}  // namespace Jetstream
@@ -0,0 +1,124 @@
+#include "../generic.cc"
+
+#include "jetstream/memory/devices/cuda/copy.hh"
+
+namespace Jetstream {
+
+template<Device D, typename T>
+struct Pad<D, T>::Impl {
+    std::vector<U64> grid;
+    std::vector<U64> block;
+
+    std::vector<void*> arguments;
+
+    Tensor<Device::CUDA, T> input;
+
+    U64 inner = 1;
+    U64 axisSize = 0;
+    U64 paddedAxisSize = 0;
+    U64 numberOfElements = 0;
+};
+
+template<Device D, typename T>
+Pad<D, T>::Pad() {
+    impl = std::make_unique<Impl>();
+}
+
+template<Device D, typename T>
+Pad<D, T>::~Pad() {
+    impl.reset();
+}
+
+template<Device D, typename T>
+Result Pad<D, T>::createCompute(const Context& ctx) {
+    JST_TRACE("Create Pad compute core using CUDA backend.");
+
+    // Create CUDA kernel.
+    //
+    // Every thread moves one sample to its place in the padded buffer. The
+    // padding is never written and keeps the zeros of the allocator.
+
+    std::string header;
+
+    if constexpr (std::is_same_v<T, CF32>) {
+        header = "typedef float2 sample_t;\n";
+    } else {
+        header = "typedef float sample_t;\n";
+    }
+
+    ctx.cuda->createKernel("pad", header + R"""(
+        __global__ void pad(const sample_t* unpadded,
+                            sample_t* padded,
+                            size_t inner,
+                            size_t axisSize,
+                            size_t paddedAxisSize,
+                            size_t size) {
+            size_t id = blockIdx.x * blockDim.x + threadIdx.x;
+            if (id < size) {
+                const size_t i = id % inner;
+                const size_t a = (id / inner) % axisSize;
+                const size_t o = id / (inner * axisSize);
+                padded[(o * paddedAxisSize + a) * inner + i] = unpadded[id];
+            }
+        }
+    )""");
+
+    // Calculate parameters.
+
+    const auto& shape = input.unpadded.shape();
+
+    impl->inner = 1;
+    for (U64 i = config.axis + 1; i < shape.size(); i++) {
+        impl->inner *= shape[i];
+    }
+    impl->axisSize = shape[config.axis];
+    impl->paddedAxisSize = output.padded.shape()[config.axis];
+    impl->numberOfElements = input.unpadded.size();
+
+    // Initialize kernel size.
+
+    U64 threadsPerBlock = 512;
+    U64 blocksPerGrid = (impl->numberOfElements + threadsPerBlock - 1) / threadsPerBlock;
+
+    impl->grid = { blocksPerGrid, 1, 1 };
+    impl->block = { threadsPerBlock, 1, 1 };
+
+    // Initialize kernel input.
+
+    if (!input.unpadded.device_native() && input.unpadded.contiguous()) {
+        impl->input = Tensor<Device::CUDA, T>(input.unpadded.shape());
+    } else {
+        impl->input = input.unpadded;
+    }
+
+    // Initialize kernel arguments.
+
+    impl->arguments = {
+        impl->input.data_ptr(),
+        output.padded.data_ptr(),
+        &impl->inner,
+        &impl->axisSize,
+        &impl->paddedAxisSize,
+        &impl->numberOfElements,
+    };
+
+    return Result::SUCCESS;
+}
+
+template<Device D, typename T>
+Result Pad<D, T>::compute(const Context& ctx) {
+    if (!input.unpadded.device_native() && input.unpadded.contiguous()) {
+        JST_CHECK(Memory::Copy(impl->input, input.unpadded, ctx.cuda->stream()));
+    }
+
+    JST_CHECK(ctx.cuda->launchKernel("pad",
+                                     impl->grid,
+                                     impl->block,
+                                     impl->arguments.data()));
+
+    return Result::SUCCESS;
+}
+
+JST_PAD_CUDA(JST_INSTANTIATION)
+
+}  // namespace Jetstream
@@ -0,0 +1,92 @@
+#include "../generic.cc"
+
+namespace Jetstream {
+
+// Every thread moves one sample to its place in the padded buffer. The
+// padding is never written and keeps the zeros of the allocator.
+
+static const char shadersSrc[] = R"""(
+    struct Constants {
+        ulong inner;
+        ulong axisSize;
+        ulong paddedAxisSize;
+        ulong size;
+    };
+
+    kernel void pad(constant Constants& constants [[ buffer(0) ]],
+                    constant const sample_t *unpadded [[ buffer(1) ]],
+                    device sample_t *padded [[ buffer(2) ]],
+                    uint id[[ thread_position_in_grid ]]) {
+        if (id >= constants.size) {
+            return;
+        }
+
+        const ulong i = id % constants.inner;
+        const ulong a = (id / constants.inner) % constants.axisSize;
+        const ulong o = id / (constants.inner * constants.axisSize);
+        padded[(o * constants.paddedAxisSize + a) * constants.inner + i] = unpadded[id];
+    }
+)""";
+
+template<Device D, typename T>
+struct Pad<D, T>::Impl {
+    struct Constants {
+        U64 inner;
+        U64 axisSize;
+        U64 paddedAxisSize;
+        U64 size;
+    };
+
+    MTL::ComputePipelineState* state;
+    Tensor<Device::Metal, U8> constants;
+};
+
+template<Device D, typename T>
+Pad<D, T>::Pad() {
+    impl = std::make_unique<Impl>();
+}
+
+template<Device D, typename T>
+Pad<D, T>::~Pad() {
+    impl.reset();
+}
+
+template<Device D, typename T>
+Result Pad<D, T>::createCompute(const Context&) {
+    JST_TRACE("Create Pad compute core using Metal backend.");
+
+    std::string header = "#include <metal_stdlib>\nusing namespace metal;\n";
+    header += std::is_same_v<T, CF32> ? "typedef float2 sample_t;\n" : "typedef float sample_t;\n";
+    JST_CHECK(Metal::CompileKernel((header + shadersSrc).c_str(), "pad", &impl->state));
+
+    const auto& shape = input.unpadded.shape();
+
+    auto* constants = Metal::CreateConstants<typename Impl::Constants>(*impl);
+    constants->inner = 1;
+    for (U64 i = config.axis + 1; i < shape.size(); i++) {
+        constants->inner *= shape[i];
+    }
+    constants->axisSize = shape[config.axis];
+    constants->paddedAxisSize = output.padded.shape()[config.axis];
+    constants->size = input.unpadded.size();
+
+    return Result::SUCCESS;
+}
+
+template<Device D, typename T>
+Result Pad<D, T>::compute(const Context& ctx) {
+    auto cmdEncoder = ctx.metal->commandBuffer()->computeCommandEncoder();
+    cmdEncoder->setComputePipelineState(impl->state);
+    cmdEncoder->setBuffer(impl->constants.data(), 0, 0);
+    cmdEncoder->setBuffer(input.unpadded.data(), 0, 1);
+    cmdEncoder->setBuffer(output.padded.data(), 0, 2);
+    cmdEncoder->dispatchThreads(MTL::Size(input.unpadded.size(), 1, 1),
+                                MTL::Size(impl->state->maxTotalThreadsPerThreadgroup(), 1, 1));
+    cmdEncoder->endEncoding();
+
+    return Result::SUCCESS;
+}
+
+JST_PAD_METAL(JST_INSTANTIATION)
+
+}  // namespace Jetstream
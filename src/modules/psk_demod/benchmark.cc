@@ -0,0 +1,50 @@
+#include "jetstream/modules/psk_demod.hh"
+
+namespace Jetstream {
+
+// Throughput is reported in symbols per second. Each run produces one
+// symbol per eight input samples.
+
+template<template<Device, typename...> class Module, Device D, typename T>
+void benchmark(ankerl::nanobench::Bench& bench, std::string name) {
+    bench.batch(8192 / 8).unit("symbol");
+
+    JST_BENCHMARK_RUN("8192 BPSK", {
+        .pskType = PskType::BPSK COMMA
+        .sampleRate = 8e6 COMMA
+        .symbolRate = 1e6 COMMA
+    }, {
+        .buffer = Tensor<D COMMA T>({8192}) COMMA
+    }, T);
+
+    JST_BENCHMARK_RUN("8192 QPSK", {
+        .pskType = PskType::QPSK COMMA
+        .sampleRate = 8e6 COMMA
+        .symbolRate = 1e6 COMMA
+    }, {
+        .buffer = Tensor<D COMMA T>({8192}) COMMA
+    }, T);
+
+    JST_BENCHMARK_RUN("8192 8-PSK", {
+        .pskType = PskType::PSK8 COMMA
+        .sampleRate = 8e6 COMMA
+        .symbolRate = 1e6 COMMA
+    }, {
+        .buffer = Tensor<D COMMA T>({8192}) COMMA
+    }, T);
+
+    bench.batch(32 * 8192 / 8).unit("symbol");
+
+    JST_BENCHMARK_RUN("32x8192 QPSK (32 channels)", {
+        .pskType = PskType::QPSK COMMA
+        .sampleRate = 8e6 COMMA
+        .symbolRate = 1e6 COMMA
+        .axis = 1 COMMA
+    }, {
+        .buffer = Tensor<D COMMA T>({32 COMMA 8192}) COMMA
+    }, T);
+
+    bench.batch(1).unit("op");
+}
+
+}  // namespace Jetstream
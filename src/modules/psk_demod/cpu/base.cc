@@ -1,5 +1,7 @@
 #include "../generic.cc"
 
+#include "jetstream/memory/devices/cpu/helpers.hh"
+
 #include <cmath>
 #include <complex>
 #include <algorithm>
@@ -20,59 +22,56 @@ template<Device D, typename T>
 Result PskDemod<D, T>::createCompute(const Context&) {
     JST_TRACE("Create PSK Demod compute core using CPU backend.");
 
-    // Initialize all parameters
+    // Initialize the state and sample history of every channel
     pimpl->initializeParameters();
 
-    // Reset raw sample history used for interpolation across buffers
-    pimpl->sampleHistory.clear();
-
     return Result::SUCCESS;
 }
 
 template<Device D, typename T>
 void PskDemod<D, T>::Impl::initializeParameters() {
     // Initialize state variables to zero
-    phaseAccumulator = 0.0;
-    frequencyError = 0.0;
-    timingMu = 0.0;
-    timingOmega = timingOmegaNominal;
-    timingIndex = 0;
-    hasLastSymbol = false;
-    lastSymbol = T{0};
-    lastDecision = T{0};
-    sampleHistory.clear();
+    Channel initial;
+    initial.timingOmega = timingOmegaNominal;
+    channels.assign(numberOfChannels, initial);
 }
 
 template<Device D, typename T>
-T PskDemod<D, T>::Impl::interpolate(const T& a, const T& b, F64 mu) const {
-    mu = std::clamp(mu, 0.0, 1.0);
-    F32 frac = static_cast<F32>(mu);
-    F32 inv = 1.0f - frac;
-    return a * inv + b * frac;
+T PskDemod<D, T>::Impl::interpolate(const T& a, const T& b, F32 mu) const {
+    const F32 frac = std::clamp(mu, 0.0f, 1.0f);
+    const F32 inv = 1.0f - frac;
+    return T(a.real() * inv + b.real() * frac,
+             a.imag() * inv + b.imag() * frac);
 }
 
+// Decisions are selects on signs and magnitudes. 8-PSK picks the nearest
+// point from the octant boundaries at tan(pi/8) instead of the phase.
+
 template<Device D, typename T>
 T PskDemod<D, T>::Impl::decision(const T& sample) const {
     constexpr F32 INV_SQRT2 = 0.7071067811865475f;
-    constexpr F32 PI_F = 3.14159265358979323846f;
-    constexpr F32 STEP_8PSK = PI_F / 4.0f;
+    constexpr F32 TAN_PI_8 = 0.4142135623730950f;
 
-    std::complex<F32> s = sample;
+    const F32 re = sample.real();
+    const F32 im = sample.imag();
+    const F32 reSign = (re >= 0.0f) ? 1.0f : -1.0f;
+    const F32 imSign = (im >= 0.0f) ? 1.0f : -1.0f;
 
     switch (constellationOrder) {
         case 2: {  // BPSK maps to the real axis
-            F32 sign = s.real() >= 0.0f ? 1.0f : -1.0f;
-            return T(sign, 0.0f);
+            return T(reSign, 0.0f);
         }
         case 4: {  // QPSK aligns to the quadrants
-            F32 re = s.real() >= 0.0f ? INV_SQRT2 : -INV_SQRT2;
-            F32 im = s.imag() >= 0.0f ? INV_SQRT2 : -INV_SQRT2;
-            return T(re, im);
+            return T(reSign * INV_SQRT2, imSign * INV_SQRT2);
         }
         case 8: {  // 8-PSK selects the nearest constellation point
-            F32 phase = std::arg(s);
-            F32 decision_phase = std::round(phase / STEP_8PSK) * STEP_8PSK;
-            return T(std::polar(1.0f, decision_phase));
+            const F32 a = std::abs(re);
+            const F32 b = std::abs(im);
+            const bool onRealAxis = b <= TAN_PI_8 * a;
+            const bool onImagAxis = a < TAN_PI_8 * b;
+            const F32 dr = onImagAxis ? 0.0f : (onRealAxis ? 1.0f : INV_SQRT2);
+            const F32 di = onRealAxis ? 0.0f : (onImagAxis ? 1.0f : INV_SQRT2);
+            return T(reSign * dr, imSign * di);
         }
         default:
             return sample;
@@ -82,103 +81,106 @@ T PskDemod<D, T>::Impl::decision(const T& sample) const {
 template<Device D, typename T>
 F64 PskDemod<D, T>::Impl::muellerMullerError(const T& prevSymbol, const T& prevDecision,
                                              const T& currentSymbol, const T& currentDecision) const {
-    std::complex<F32> prev_s = prevSymbol;
-    std::complex<F32> prev_d = prevDecision;
-    std::complex<F32> curr_s = currentSymbol;
-    std::complex<F32> curr_d = currentDecision;
-
-    std::complex<F32> term1 = prev_d * std::conj(curr_s);
-    std::complex<F32> term2 = prev_s * std::conj(curr_d);
-
-    return static_cast<F64>(std::real(term1 - term2));
+    // Re(prevDecision * conj(currentSymbol) - prevSymbol * conj(currentDecision))
+    const F32 term1 = prevDecision.real() * currentSymbol.real() + prevDecision.imag() * currentSymbol.imag();
+    const F32 term2 = prevSymbol.real() * currentDecision.real() + prevSymbol.imag() * currentDecision.imag();
+    return static_cast<F64>(term1 - term2);
 }
 
 template<Device D, typename T>
 F64 PskDemod<D, T>::Impl::costasLoopError(const T& sample) const {
-    std::complex<F32> s = sample;
+    const F32 re = sample.real();
+    const F32 im = sample.imag();
 
-    F64 error = 0.0;
+    F32 error = 0.0f;
     switch (constellationOrder) {
         case 2: // BPSK
-            error = std::imag(s) * (s.real() > 0 ? 1.0f : -1.0f);
+            error = im * ((re > 0.0f) ? 1.0f : -1.0f);
             break;
 
         case 4: // QPSK
             {
-                F32 re = s.real();
-                F32 im = s.imag();
-                F32 re_sign = re > 0 ? 1.0f : -1.0f;
-                F32 im_sign = im > 0 ? 1.0f : -1.0f;
-                std::complex<F32> decision(re_sign, im_sign);
-                error = std::imag(s * std::conj(decision));
+                // Im(s * conj(d)) with d on the unit-less quadrant corners.
+                const F32 reSign = (re > 0.0f) ? 1.0f : -1.0f;
+                const F32 imSign = (im > 0.0f) ? 1.0f : -1.0f;
+                error = im * reSign - re * imSign;
             }
             break;
 
         case 8: // 8-PSK
             {
-                F32 phase = std::arg(s);
-                F32 decision_phase = std::round(phase * 4.0f / M_PI) * M_PI / 4.0f;
-                error = std::sin(phase - decision_phase);
+                // Sine of the angle to the decision, Im(s * conj(d)) / |s|.
+                const T d = decision(sample);
+                const F32 power = re * re + im * im;
+                error = (power > 0.0f) ? (im * d.real() - re * d.imag()) / std::sqrt(power) : 0.0f;
             }
             break;
 
         default:
-            error = 0.0;
+            error = 0.0f;
             break;
     }
 
     // Clamp frequency error to reasonable bounds
-    return std::max(MIN_FREQUENCY_ERROR, std::min(error, MAX_FREQUENCY_ERROR));
+    return std::clamp(static_cast<F64>(error), MIN_FREQUENCY_ERROR, MAX_FREQUENCY_ERROR);
 }
 
 template<Device D, typename T>
-T PskDemod<D, T>::Impl::correctFrequency(const T& sample, F64 phase) const {
-    std::complex<F32> correction = std::polar(1.0f, static_cast<F32>(-phase));
-    return sample * correction;
+T PskDemod<D, T>::Impl::correctFrequency(const T& sample, F32 phase) const {
+    const F32 c = std::cos(phase);
+    const F32 s = std::sin(phase);
+    return T(sample.real() * c + sample.imag() * s,
+             sample.imag() * c - sample.real() * s);
 }
 
 template<Device D, typename T>
-Result PskDemod<D, T>::compute(const Context&) {
-    const U64 inputSize = input.buffer.size();
-    const U64 outputSize = output.buffer.size();
-
-    // Early return for empty output buffers
-    if (outputSize == 0) {
-        return Result::SUCCESS;
-    }
+void PskDemod<D, T>::Impl::demodulate(Channel& channel,
+                                      const Tensor<D, T>& input,
+                                      const U64& offset,
+                                      T* out) const {
+    const U64 inputSize = channelSize;
+    const U64 outputSize = symbolsPerChannel;
 
-    auto& impl = *pimpl;
+    auto& history = channel.sampleHistory;
 
     // Append newly received samples to the interpolation history
-    for (U64 i = 0; i < inputSize; ++i) {
-        impl.sampleHistory.push_back(input.buffer[i]);
+    const U64 carried = history.size();
+    history.resize(carried + inputSize);
+    if (input.contiguous()) {
+        std::copy_n(input.data() + offset, inputSize, history.data() + carried);
+    } else {
+        for (U64 i = 0; i < inputSize; ++i) {
+            history[carried + i] = input[offset + i];
+        }
     }
 
+    const T* samples = history.data();
+    const U64 historySize = history.size();
+
     U64 outputIndex = 0;
 
     // Local copies of the loop state for better cache behaviour
-    F64 mu = impl.timingMu;
-    F64 omega = impl.timingOmega;
-    U64 index = impl.timingIndex;
-    F64 phase = impl.phaseAccumulator;
-    F64 freqAcc = impl.frequencyError;
-    bool hasPrevSymbol = impl.hasLastSymbol;
-    T prevSymbol = impl.lastSymbol;
-    T prevDecision = impl.lastDecision;
+    F64 mu = channel.timingMu;
+    F64 omega = channel.timingOmega;
+    U64 index = channel.timingIndex;
+    F64 phase = channel.phaseAccumulator;
+    F64 freqAcc = channel.frequencyError;
+    bool hasPrevSymbol = channel.hasLastSymbol;
+    T prevSymbol = channel.lastSymbol;
+    T prevDecision = channel.lastDecision;
 
     // Safety counter prevents infinite loops if configuration is pathological
     U64 iterations = 0;
-    const U64 maxIterations = outputSize * (impl.samplesPerSymbol + 4);
+    const U64 maxIterations = outputSize * (samplesPerSymbol + 4);
 
     while (outputIndex < outputSize && iterations < maxIterations) {
         iterations++;
 
-        const U64 historySize = static_cast<U64>(impl.sampleHistory.size());
-
         // Bring mu back into [0, 1) while staying within the available history
-        while (mu >= 1.0 && index + 1 < historySize) {
-            mu -= 1.0;
-            ++index;
+        if (mu >= 1.0) {
+            const U64 step = std::min(static_cast<U64>(mu), historySize - 1 - std::min(index, historySize - 1));
+            mu -= static_cast<F64>(step);
+            index += step;
         }
         while (mu < 0.0 && index > 0) {
             mu += 1.0;
@@ -193,31 +195,34 @@ Result PskDemod<D, T>::compute(const Context&) {
             break;
         }
 
-        const T& earlySample = impl.sampleHistory[index];
-        const T& lateSample = impl.sampleHistory[index + 1];
-        T interpolated = impl.interpolate(earlySample, lateSample, mu);
-        T corrected = impl.correctFrequency(interpolated, phase);
-        T decision = impl.decision(corrected);
+        const T interpolated = interpolate(samples[index], samples[index + 1], static_cast<F32>(mu));
+        const T corrected = correctFrequency(interpolated, static_cast<F32>(phase));
+        const T decided = decision(corrected);
 
-        F64 timingErr = 0.0;
         if (hasPrevSymbol) {
-            timingErr = impl.muellerMullerError(prevSymbol, prevDecision, corrected, decision);
-            timingErr = std::clamp(timingErr, Impl::MIN_TIMING_ERROR, Impl::MAX_TIMING_ERROR);
-            omega += impl.timingBeta * timingErr;
-            omega = std::clamp(omega, impl.timingOmegaMin, impl.timingOmegaMax);
-            mu += impl.timingAlpha * timingErr;
+            F64 timingErr = muellerMullerError(prevSymbol, prevDecision, corrected, decided);
+            timingErr = std::clamp(timingErr, MIN_TIMING_ERROR, MAX_TIMING_ERROR);
+            omega += timingBeta * timingErr;
+            omega = std::clamp(omega, timingOmegaMin, timingOmegaMax);
+            mu += timingAlpha * timingErr;
         }
 
-        F64 freqErrSample = impl.costasLoopError(corrected);
-        freqAcc += impl.freqAlpha * freqErrSample;
+        const F64 freqErrSample = costasLoopError(corrected);
+        freqAcc += freqAlpha * freqErrSample;
         freqAcc = std::clamp(freqAcc, -M_PI, M_PI);
-        phase += freqAcc + impl.freqBeta * freqErrSample;
-        phase = std::remainder(phase, 2.0 * M_PI);
+        phase += freqAcc + freqBeta * freqErrSample;
+
+        // The step is bounded by pi + freqBeta, so a single wrap is enough.
+        if (phase > M_PI) {
+            phase -= 2.0 * M_PI;
+        } else if (phase < -M_PI) {
+            phase += 2.0 * M_PI;
+        }
 
-        output.buffer[outputIndex++] = corrected;
+        out[outputIndex++] = corrected;
 
         prevSymbol = corrected;
-        prevDecision = decision;
+        prevDecision = decided;
         hasPrevSymbol = true;
 
         mu += omega;
@@ -228,35 +233,49 @@ Result PskDemod<D, T>::compute(const Context&) {
     }
 
     // Discard the samples that are no longer needed while keeping one look-back sample
-    std::size_t historySize = impl.sampleHistory.size();
-    std::size_t pruneCount = 0;
     if (historySize > 1) {
-        pruneCount = std::min<std::size_t>(static_cast<std::size_t>(index), historySize - 1);
-        for (std::size_t i = 0; i < pruneCount; ++i) {
-            impl.sampleHistory.pop_front();
-        }
-    }
-    if (pruneCount > 0) {
-        index -= static_cast<U64>(pruneCount);
+        const U64 pruneCount = std::min<U64>(index, historySize - 1);
+        history.erase(history.begin(), history.begin() + pruneCount);
+        index -= pruneCount;
     }
 
-    impl.timingMu = mu;
-    impl.timingOmega = omega;
-    impl.timingIndex = index;
-    impl.phaseAccumulator = phase;
-    impl.frequencyError = freqAcc;
-    impl.hasLastSymbol = hasPrevSymbol;
-    impl.lastSymbol = prevSymbol;
-    impl.lastDecision = prevDecision;
+    channel.timingMu = mu;
+    channel.timingOmega = omega;
+    channel.timingIndex = index;
+    channel.phaseAccumulator = phase;
+    channel.frequencyError = freqAcc;
+    channel.hasLastSymbol = hasPrevSymbol;
+    channel.lastSymbol = prevSymbol;
+    channel.lastDecision = prevDecision;
 
     // Zero-fill any remaining output slots to preserve deterministic output sizes
-    while (outputIndex < outputSize) {
-        output.buffer[outputIndex++] = T{0};
+    std::fill(out + outputIndex, out + outputSize, T{0});
+}
+
+template<Device D, typename T>
+Result PskDemod<D, T>::compute(const Context& ctx) {
+    // Early return for empty output buffers
+    if (output.buffer.size() == 0) {
+        return Result::SUCCESS;
     }
 
+    auto& impl = *pimpl;
+    T* out = output.buffer.data();
+
+    // Every channel runs its own recovery loops, so they're split across the pool.
+
+    const U64 chunks = input.buffer.size() / Memory::CPU::ParallelIteratorGrain;
+
+    Memory::CPU::ParallelRanges(ctx.cpu->pool(), impl.numberOfChannels, chunks, [&](const U64& begin, const U64& end) {
+        for (U64 c = begin; c < end; c++) {
+            impl.demodulate(impl.channels[c], input.buffer, c * impl.channelSize, out + c * impl.symbolsPerChannel);
+        }
+    });
+
     return Result::SUCCESS;
 }
 
 JST_PSK_DEMOD_CPU(JST_INSTANTIATION)
+JST_PSK_DEMOD_CPU(JST_BENCHMARK)
 
 }  // namespace Jetstream
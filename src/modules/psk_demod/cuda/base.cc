@@ -0,0 +1,351 @@
+#include "../generic.cc"
+
+#include "jetstream/memory/devices/cuda/copy.hh"
+
+namespace Jetstream {
+
+template<Device D, typename T>
+PskDemod<D, T>::PskDemod() {
+    pimpl = std::make_unique<Impl>();
+}
+
+template<Device D, typename T>
+PskDemod<D, T>::~PskDemod() {
+    pimpl.reset();
+}
+
+template<Device D, typename T>
+Result PskDemod<D, T>::createCompute(const Context& ctx) {
+    JST_TRACE("Create PSK Demod compute core using CUDA backend.");
+
+    // Create CUDA kernels.
+    //
+    // Every symbol depends on the decisions before it, so the recovery loop
+    // of each channel runs on a single thread with the same math as the CPU
+    // backend. Channels run in parallel, each with its own state and
+    // history. It stays next to the samples, which avoids moving the buffer
+    // to the host and back. Appending new samples to the history is done in
+    // parallel.
+
+    const std::string header = R"""(
+        #define PI 3.14159265358979323846
+
+        enum State {
+            Mu = 0,
+            Omega,
+            Phase,
+            FrequencyAccumulator,
+            Carried,
+            Index,
+            HasLastSymbol,
+            LastSymbolReal,
+            LastSymbolImag,
+            LastDecisionReal,
+            LastDecisionImag,
+            StateSize,
+        };
+
+        __device__ inline float2 decide(const float2& s, const size_t order) {
+            const float INV_SQRT2 = 0.7071067811865475f;
+            const float TAN_PI_8 = 0.4142135623730950f;
+
+            const float reSign = (s.x >= 0.0f) ? 1.0f : -1.0f;
+            const float imSign = (s.y >= 0.0f) ? 1.0f : -1.0f;
+
+            if (order == 2) {
+                return make_float2(reSign, 0.0f);
+            }
+
+            if (order == 4) {
+                return make_float2(reSign * INV_SQRT2, imSign * INV_SQRT2);
+            }
+
+            if (order == 8) {
+                const float a = fabsf(s.x);
+                const float b = fabsf(s.y);
+                const bool onRealAxis = b <= TAN_PI_8 * a;
+                const bool onImagAxis = a < TAN_PI_8 * b;
+                const float dr = onImagAxis ? 0.0f : (onRealAxis ? 1.0f : INV_SQRT2);
+                const float di = onRealAxis ? 0.0f : (onImagAxis ? 1.0f : INV_SQRT2);
+                return make_float2(reSign * dr, imSign * di);
+            }
+
+            return s;
+        }
+
+        __device__ inline double costas(const float2& s, const float2& d, const size_t order) {
+            float error = 0.0f;
+
+            if (order == 2) {
+                error = s.y * ((s.x > 0.0f) ? 1.0f : -1.0f);
+            } else if (order == 4) {
+                const float reSign = (s.x > 0.0f) ? 1.0f : -1.0f;
+                const float imSign = (s.y > 0.0f) ? 1.0f : -1.0f;
+                error = s.y * reSign - s.x * imSign;
+            } else if (order == 8) {
+                const float power = s.x * s.x + s.y * s.y;
+                error = (power > 0.0f) ? (s.y * d.x - s.x * d.y) / sqrtf(power) : 0.0f;
+            }
+
+            return fmin(fmax((double)error, -1.0), 1.0);
+        }
+    )""";
+
+    ctx.cuda->createKernel("psk_demod_append", header + R"""(
+        __global__ void psk_demod_append(const float2* input,
+                                         float2* history,
+                                         const double* state,
+                                         size_t channels,
+                                         size_t inputSize,
+                                         size_t historyCapacity) {
+            size_t id = blockIdx.x * blockDim.x + threadIdx.x;
+            if (id >= channels * inputSize) {
+                return;
+            }
+
+            const size_t channel = id / inputSize;
+            const size_t carried = (size_t)state[channel * StateSize + Carried];
+
+            history[channel * historyCapacity + carried + id % inputSize] = input[id];
+        }
+    )""");
+
+    ctx.cuda->createKernel("psk_demod", header + R"""(
+        __global__ void psk_demod(float2* history,
+                                  double* state,
+                                  float2* output,
+                                  double freqAlpha,
+                                  double freqBeta,
+                                  double timingAlpha,
+                                  double timingBeta,
+                                  double omegaMin,
+                                  double omegaMax,
+                                  size_t order,
+                                  size_t channels,
+                                  size_t inputSize,
+                                  size_t outputSize,
+                                  size_t historyCapacity,
+                                  size_t maxIterations) {
+            const size_t channel = blockIdx.x * blockDim.x + threadIdx.x;
+            if (channel >= channels) {
+                return;
+            }
+
+            history += channel * historyCapacity;
+            state += channel * StateSize;
+            output += channel * outputSize;
+
+            const size_t historySize = (size_t)state[Carried] + inputSize;
+
+            double mu = state[Mu];
+            double omega = state[Omega];
+            double phase = state[Phase];
+            double freqAcc = state[FrequencyAccumulator];
+            size_t index = (size_t)state[Index];
+            bool hasPrevSymbol = state[HasLastSymbol] != 0.0;
+            float2 prevSymbol = make_float2(state[LastSymbolReal], state[LastSymbolImag]);
+            float2 prevDecision = make_float2(state[LastDecisionReal], state[LastDecisionImag]);
+
+            size_t outputIndex = 0;
+            size_t iterations = 0;
+
+            while (outputIndex < outputSize && iterations < maxIterations) {
+                iterations++;
+
+                if (mu >= 1.0) {
+                    const size_t limit = historySize - 1 - min(index, historySize - 1);
+                    const size_t step = min((size_t)mu, limit);
+                    mu -= (double)step;
+                    index += step;
+                }
+                while (mu < 0.0 && index > 0) {
+                    mu += 1.0;
+                    --index;
+                }
+                if (mu < 0.0) {
+                    mu = 0.0;
+                }
+
+                if (index + 1 >= historySize) {
+                    break;
+                }
+
+                // Interpolate, then correct the frequency.
+
+                const float frac = fminf(fmaxf((float)mu, 0.0f), 1.0f);
+                const float inv = 1.0f - frac;
+                const float2 a = history[index];
+                const float2 b = history[index + 1];
+                const float2 interpolated = make_float2(a.x * inv + b.x * frac, a.y * inv + b.y * frac);
+
+                float s;
+                float c;
+                sincosf((float)phase, &s, &c);
+                const float2 corrected = make_float2(interpolated.x * c + interpolated.y * s,
+                                                     interpolated.y * c - interpolated.x * s);
+                const float2 decision = decide(corrected, order);
+
+                if (hasPrevSymbol) {
+                    const float term1 = prevDecision.x * corrected.x + prevDecision.y * corrected.y;
+                    const float term2 = prevSymbol.x * decision.x + prevSymbol.y * decision.y;
+                    const double timingErr = fmin(fmax((double)(term1 - term2), -1.0), 1.0);
+                    omega = fmin(fmax(omega + timingBeta * timingErr, omegaMin), omegaMax);
+                    mu += timingAlpha * timingErr;
+                }
+
+                const double freqErrSample = costas(corrected, decision, order);
+                freqAcc = fmin(fmax(freqAcc + freqAlpha * freqErrSample, -PI), PI);
+                phase += freqAcc + freqBeta * freqErrSample;
+
+                if (phase > PI) {
+                    phase -= 2.0 * PI;
+                } else if (phase < -PI) {
+                    phase += 2.0 * PI;
+                }
+
+                output[outputIndex++] = corrected;
+
+                prevSymbol = corrected;
+                prevDecision = decision;
+                hasPrevSymbol = true;
+
+                mu += omega;
+            }
+
+            for (size_t i = outputIndex; i < outputSize; i++) {
+                output[i] = make_float2(0.0f, 0.0f);
+            }
+
+            // Keep one look-back sample. The history has a fixed capacity, so
+            // when recovery falls behind, the oldest unread samples are dropped.
+
+            size_t prune = (historySize > 1) ? min(index, historySize - 1) : 0;
+            size_t remaining = historySize - prune;
+            const size_t limit = historyCapacity - inputSize;
+            if (remaining > limit) {
+                prune += remaining - limit;
+                remaining = limit;
+            }
+            index = (index > prune) ? index - prune : 0;
+
+            for (size_t i = 0; i < remaining; i++) {
+                history[i] = history[prune + i];
+            }
+
+            state[Mu] = mu;
+            state[Omega] = omega;
+            state[Phase] = phase;
+            state[FrequencyAccumulator] = freqAcc;
+            state[Carried] = (double)remaining;
+            state[Index] = (double)index;
+            state[HasLastSymbol] = hasPrevSymbol ? 1.0 : 0.0;
+            state[LastSymbolReal] = prevSymbol.x;
+            state[LastSymbolImag] = prevSymbol.y;
+            state[LastDecisionReal] = prevDecision.x;
+            state[LastDecisionImag] = prevDecision.y;
+        }
+    )""");
+
+    // Calculate parameters.
+
+    pimpl->inputSize = pimpl->channelSize;
+    pimpl->outputSize = pimpl->symbolsPerChannel;
+    pimpl->historyCapacity = 4 * pimpl->inputSize;
+    pimpl->maxIterations = pimpl->outputSize * (pimpl->samplesPerSymbol + 4);
+
+    // Upload the initial loop state of every channel. Everything but the
+    // symbol period starts at zero, like the history, which is zero-filled
+    // by the allocator.
+
+    // Laid out like the State enum of the kernels.
+    constexpr U64 stateSize = 11;
+    constexpr U64 omegaIndex = 1;
+
+    const U64 channels = pimpl->numberOfChannels;
+
+    Tensor<Device::CPU, F64> hostState({channels, stateSize});
+    for (U64 c = 0; c < channels; c++) {
+        hostState[{c, omegaIndex}] = pimpl->timingOmegaNominal;
+    }
+
+    pimpl->deviceState = Tensor<Device::CUDA, F64>({channels, stateSize});
+    JST_CHECK(Memory::Copy(pimpl->deviceState, hostState));
+
+    pimpl->deviceHistory = Tensor<Device::CUDA, T>({channels, pimpl->historyCapacity});
+
+    // Initialize kernel size.
+
+    U64 threadsPerBlock = 512;
+
+    pimpl->grid = { (channels * pimpl->inputSize + threadsPerBlock - 1) / threadsPerBlock, 1, 1 };
+    pimpl->block = { threadsPerBlock, 1, 1 };
+
+    U64 loopThreadsPerBlock = std::clamp<U64>(channels, 1, 64);
+
+    pimpl->loopGrid = { (channels + loopThreadsPerBlock - 1) / loopThreadsPerBlock, 1, 1 };
+    pimpl->loopBlock = { loopThreadsPerBlock, 1, 1 };
+
+    // Initialize kernel input.
+
+    if (!input.buffer.device_native() && input.buffer.contiguous()) {
+        pimpl->deviceInput = Tensor<Device::CUDA, T>(input.buffer.shape());
+    } else {
+        pimpl->deviceInput = input.buffer;
+    }
+
+    // Initialize kernel arguments. Loop gains are read at every launch, so
+    // runtime changes apply to the next buffer.
+
+    pimpl->appendArguments = {
+        pimpl->deviceInput.data_ptr(),
+        pimpl->deviceHistory.data_ptr(),
+        pimpl->deviceState.data_ptr(),
+        &pimpl->numberOfChannels,
+        &pimpl->inputSize,
+        &pimpl->historyCapacity,
+    };
+
+    pimpl->arguments = {
+        pimpl->deviceHistory.data_ptr(),
+        pimpl->deviceState.data_ptr(),
+        output.buffer.data_ptr(),
+        &pimpl->freqAlpha,
+        &pimpl->freqBeta,
+        &pimpl->timingAlpha,
+        &pimpl->timingBeta,
+        &pimpl->timingOmegaMin,
+        &pimpl->timingOmegaMax,
+        &pimpl->constellationOrder,
+        &pimpl->numberOfChannels,
+        &pimpl->inputSize,
+        &pimpl->outputSize,
+        &pimpl->historyCapacity,
+        &pimpl->maxIterations,
+    };
+
+    return Result::SUCCESS;
+}
+
+template<Device D, typename T>
+Result PskDemod<D, T>::compute(const Context& ctx) {
+    if (!input.buffer.device_native() && input.buffer.contiguous()) {
+        JST_CHECK(Memory::Copy(pimpl->deviceInput, input.buffer, ctx.cuda->stream()));
+    }
+
+    JST_CHECK(ctx.cuda->launchKernel("psk_demod_append",
+                                     pimpl->grid,
+                                     pimpl->block,
+                                     pimpl->appendArguments.data()));
+
+    JST_CHECK(ctx.cuda->launchKernel("psk_demod",
+                                     pimpl->loopGrid,
+                                     pimpl->loopBlock,
+                                     pimpl->arguments.data()));
+
+    return Result::SUCCESS;
+}
+
+JST_PSK_DEMOD_CUDA(JST_INSTANTIATION)
+JST_PSK_DEMOD_CUDA(JST_BENCHMARK)
+
+}  // namespace Jetstream
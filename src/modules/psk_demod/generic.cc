@@ -1,7 +1,9 @@
 #include "jetstream/modules/psk_demod.hh"
 
+#include "benchmark.cc"
+
+#include <vector>
 #include <algorithm>
-#include <deque>
 
 namespace Jetstream {
 
@@ -10,30 +12,57 @@ struct PskDemod<D, T>::Impl {
     // Configuration derived values
     U64 samplesPerSymbol;
     U64 constellationOrder;
+    U64 numberOfChannels;
+    U64 channelSize;
+    U64 symbolsPerChannel;
 
-    // PLL state for frequency/phase recovery
-    F64 phaseAccumulator;
-    F64 frequencyError;
+    // Loop gains, shared by every channel
     F64 freqAlpha;
     F64 freqBeta;
-
-    // Timing recovery state
     F64 timingAlpha;
     F64 timingBeta;
-    F64 timingMu;
-    F64 timingOmega;
     F64 timingOmegaNominal;
     F64 timingOmegaMin;
     F64 timingOmegaMax;
-    U64 timingIndex;
-
-    // Symbol history for MM detector
-    bool hasLastSymbol;
-    T lastSymbol;
-    T lastDecision;
 
-    // Raw sample history for interpolation across buffers
-    std::deque<T> sampleHistory;
+    // Recovery state of one channel
+    struct Channel {
+        // PLL state for frequency/phase recovery
+        F64 phaseAccumulator = 0.0;
+        F64 frequencyError = 0.0;
+
+        // Timing recovery state
+        F64 timingMu = 0.0;
+        F64 timingOmega = 0.0;
+        U64 timingIndex = 0;
+
+        // Symbol history for MM detector
+        bool hasLastSymbol = false;
+        T lastSymbol{};
+        T lastDecision{};
+
+        // Raw sample history for interpolation across buffers. Contiguous,
+        // so new buffers are appended with a block copy.
+        std::vector<T> sampleHistory;
+    };
+
+    std::vector<Channel> channels;
+
+    // Device copies of the history and loop state, for backends that run
+    // the loop where the samples are.
+    Tensor<D, T> deviceInput;
+    Tensor<D, T> deviceHistory;
+    Tensor<D, F64> deviceState;
+    U64 inputSize;
+    U64 outputSize;
+    U64 historyCapacity;
+    U64 maxIterations;
+    std::vector<U64> grid;
+    std::vector<U64> block;
+    std::vector<U64> loopGrid;
+    std::vector<U64> loopBlock;
+    std::vector<void*> appendArguments;
+    std::vector<void*> arguments;
 
     // Safety parameters
     static constexpr F64 MAX_TIMING_ERROR = 1.0;
@@ -42,12 +71,13 @@ struct PskDemod<D, T>::Impl {
     static constexpr F64 MIN_FREQUENCY_ERROR = -1.0;
 
     // Helper methods
-    T interpolate(const T& a, const T& b, F64 mu) const;
+    T interpolate(const T& a, const T& b, F32 mu) const;
     T decision(const T& sample) const;
     F64 muellerMullerError(const T& prevSymbol, const T& prevDecision,
                            const T& currentSymbol, const T& currentDecision) const;
     F64 costasLoopError(const T& sample) const;
-    T correctFrequency(const T& sample, F64 phase) const;
+    T correctFrequency(const T& sample, F32 phase) const;
+    void demodulate(Channel& channel, const Tensor<D, T>& input, const U64& offset, T* out) const;
     void initializeParameters();
     Result refresh_values(const Config& config);
 };
@@ -99,6 +129,12 @@ Result PskDemod<D, T>::create() {
         return Result::ERROR;
     }
 
+    if (config.axis >= input.buffer.rank()) {
+        JST_ERROR("Sample axis ({}) is out of range for a tensor of rank {}.",
+                  config.axis, input.buffer.rank());
+        return Result::ERROR;
+    }
+
     if (config.bufferSize == 0) {
         JST_ERROR("Buffer size must be positive.");
         return Result::ERROR;
@@ -111,36 +147,32 @@ Result PskDemod<D, T>::create() {
         return Result::ERROR;
     }
 
-    // Calculate number of output symbols
-    U64 inputSamples = input.buffer.size();
-    U64 outputSymbols = inputSamples / pimpl->samplesPerSymbol;
-    if (outputSymbols == 0) {
+    // Every channel is the flattened axes from the sample axis onwards
+    pimpl->numberOfChannels = 1;
+    for (U64 i = 0; i < config.axis; i++) {
+        pimpl->numberOfChannels *= input.buffer.shape()[i];
+    }
+    pimpl->channelSize = input.buffer.size() / std::max<U64>(pimpl->numberOfChannels, 1);
+
+    // Calculate number of output symbols per channel
+    pimpl->symbolsPerChannel = pimpl->channelSize / pimpl->samplesPerSymbol;
+    if (pimpl->symbolsPerChannel == 0) {
         JST_ERROR("Input buffer too small to produce any symbols.");
         return Result::ERROR;
     }
 
-    // Set up output buffer shape - same as input but potentially different size
-    std::vector<U64> output_shape = input.buffer.shape();
-    output_shape[output_shape.size() - 1] = outputSymbols;  // Last dimension is the sample dimension
+    // The output keeps the channel axes, followed by the symbols of each
+    std::vector<U64> output_shape(input.buffer.shape().begin(), input.buffer.shape().begin() + config.axis);
+    output_shape.push_back(pimpl->symbolsPerChannel);
 
     // Allocate output buffer
     output.buffer = Tensor<D, T>(output_shape);
 
     // Initialize PSK demod state
-    pimpl->phaseAccumulator = 0.0;
-    pimpl->frequencyError = 0.0;
-
     F64 nominalOmega = config.sampleRate / config.symbolRate;
     pimpl->timingOmegaNominal = nominalOmega;
-    pimpl->timingOmega = nominalOmega;
-    pimpl->timingMu = 0.0;
-    pimpl->timingIndex = 0;
     pimpl->timingOmegaMin = std::max(0.5, nominalOmega * 0.5);
     pimpl->timingOmegaMax = std::max(pimpl->timingOmegaMin + 1e-6, nominalOmega * 1.5);
-    pimpl->sampleHistory.clear();
-    pimpl->hasLastSymbol = false;
-    pimpl->lastSymbol = T{0};
-    pimpl->lastDecision = T{0};
 
     JST_CHECK(pimpl->refresh_values(config));
 
@@ -169,6 +201,7 @@ void PskDemod<D, T>::info() const {
     JST_DEBUG("  Sample Rate: {} Hz", config.sampleRate);
     JST_DEBUG("  Symbol Rate: {} Hz", config.symbolRate);
     JST_DEBUG("  Samples per Symbol: {}", pimpl->samplesPerSymbol);
+    JST_DEBUG("  Channels: {}", pimpl->numberOfChannels);
     JST_DEBUG("  Frequency Loop BW: {}", config.frequencyLoopBandwidth);
     JST_DEBUG("  Timing Loop BW: {}", config.timingLoopBandwidth);
     JST_DEBUG("  Damping Factor: {}", config.dampingFactor);
@@ -0,0 +1,21 @@
+#include "jetstream/modules/resampler.hh"
+
+namespace Jetstream {
+
+template<template<Device, typename...> class Module, Device D, typename T>
+void benchmark(ankerl::nanobench::Bench& bench, std::string name) {
+    JST_BENCHMARK_RUN("8x7680 (1/5)", {
+        .decimation = 5 COMMA
+    }, {
+        .buffer = Tensor<D COMMA T>({8 COMMA 7680}) COMMA
+    }, T);
+
+    JST_BENCHMARK_RUN("8x7680 (147/160)", {
+        .interpolation = 147 COMMA
+        .decimation = 160 COMMA
+    }, {
+        .buffer = Tensor<D COMMA T>({8 COMMA 7680}) COMMA
+    }, T);
+}
+
+}  // namespace Jetstream
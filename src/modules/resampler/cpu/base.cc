@@ -0,0 +1,98 @@
+#include "../generic.cc"
+
+#include "jetstream/memory/devices/cpu/helpers.hh"
+#include "jetstream/backend/devices/cpu/fir.hh"
+
+namespace Jetstream {
+
+template<Device D, typename T>
+struct Resampler<D, T>::Impl {
+    U64 outer = 1;
+    U64 inner = 1;
+    U64 axisSize = 0;
+    U64 outputSize = 0;
+    U64 interpolation = 1;
+    U64 decimation = 1;
+
+    std::vector<F32> taps;
+
+    // One filter per lane along the axis, each keeping its own history.
+    std::vector<Backend::PolyphaseFir<T>> filters;
+};
+
+template<Device D, typename T>
+Resampler<D, T>::Resampler() {
+    impl = std::make_unique<Impl>();
+}
+
+template<Device D, typename T>
+Resampler<D, T>::~Resampler() {
+    impl.reset();
+}
+
+template<Device D, typename T>
+Result Resampler<D, T>::createCompute(const Context&) {
+    JST_TRACE("Create Resampler compute core using CPU backend.");
+
+    impl->filters.resize(impl->outer * impl->inner);
+    for (auto& filter : impl->filters) {
+        JST_CHECK(filter.configure(impl->taps.data(), impl->taps.size(), impl->interpolation, impl->decimation));
+    }
+
+    JST_TRACE("[RESAMPLER] Lanes: {}; Kernel: {};", impl->filters.size(), impl->filters.front().kernelName());
+
+    return Result::SUCCESS;
+}
+
+template<Device D, typename T>
+Result Resampler<D, T>::compute(const Context& ctx) {
+    const T* in = input.buffer.data() + input.buffer.offset();
+    T* out = output.buffer.data();
+
+    const U64 inner = impl->inner;
+    const U64 axisSize = impl->axisSize;
+    const U64 outputSize = impl->outputSize;
+
+    // Lanes are independent, only the kept outputs are computed. Lanes strided
+    // by inner dimensions are gathered first so the dot products stay contiguous.
+
+    const U64 chunks = (output.buffer.size() * impl->filters.front().phaseTaps()) / Memory::CPU::ParallelIteratorGrain;
+
+    Memory::CPU::ParallelRanges(ctx.cpu->pool(), impl->filters.size(), chunks, [&](const U64& begin, const U64& end) {
+        std::vector<T> lane;
+        std::vector<T> resampled;
+
+        for (U64 l = begin; l < end; l++) {
+            const U64 o = l / inner;
+            const U64 i = l % inner;
+
+            const T* src = in + o * axisSize * inner + i;
+            T* dst = out + o * outputSize * inner + i;
+
+            if (inner == 1) {
+                impl->filters[l].process(src, axisSize, dst);
+                continue;
+            }
+
+            lane.resize(axisSize);
+            resampled.resize(outputSize);
+
+            for (U64 n = 0; n < axisSize; n++) {
+                lane[n] = src[n * inner];
+            }
+
+            impl->filters[l].process(lane.data(), axisSize, resampled.data());
+
+            for (U64 m = 0; m < outputSize; m++) {
+                dst[m * inner] = resampled[m];
+            }
+        }
+    });
+
+    return Result::SUCCESS;
+}
+
+JST_RESAMPLER_CPU(JST_INSTANTIATION)
+JST_RESAMPLER_CPU(JST_BENCHMARK)
+
+}  // namespace Jetstream
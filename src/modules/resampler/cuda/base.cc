@@ -0,0 +1,250 @@
+#include "../generic.cc"
+
+#include "jetstream/memory/devices/cuda/copy.hh"
+
+namespace Jetstream {
+
+template<Device D, typename T>
+struct Resampler<D, T>::Impl {
+    U64 outer = 1;
+    U64 inner = 1;
+    U64 axisSize = 0;
+    U64 outputSize = 0;
+    U64 interpolation = 1;
+    U64 decimation = 1;
+
+    std::vector<F32> taps;
+
+    std::vector<U64> grid;
+    std::vector<U64> block;
+    std::vector<U64> historyGrid;
+
+    std::vector<void*> arguments;
+    std::vector<void*> historyArguments;
+
+    Tensor<Device::CUDA, T> input;
+
+    // Polyphase bank with the taps of every phase reversed, like the CPU
+    // filter.
+    Tensor<Device::CUDA, F32> bank;
+
+    // Last samples of every lane, oldest first. The next history is written
+    // apart and copied back, so blocks shorter than the history don't race.
+    Tensor<Device::CUDA, T> history;
+    Tensor<Device::CUDA, T> nextHistory;
+
+    U64 phaseTaps = 0;
+    U64 historySize = 0;
+    U64 numberOfElements = 0;
+    U64 numberOfHistoryElements = 0;
+};
+
+template<Device D, typename T>
+Resampler<D, T>::Resampler() {
+    impl = std::make_unique<Impl>();
+}
+
+template<Device D, typename T>
+Resampler<D, T>::~Resampler() {
+    impl.reset();
+}
+
+template<Device D, typename T>
+Result Resampler<D, T>::createCompute(const Context& ctx) {
+    JST_TRACE("Create Resampler compute core using CUDA backend.");
+
+    // Create CUDA kernels.
+    //
+    // Each thread computes one kept output as a dot product between the bank
+    // of its phase and a window of [history | input]. The zeros of the
+    // upsampled signal are never read.
+
+    std::string header;
+
+    if constexpr (std::is_same_v<T, CF32>) {
+        header = R"""(
+            typedef float2 sample_t;
+
+            __device__ inline void madd(sample_t& acc, const float tap, const sample_t& x) {
+                acc.x = fmaf(tap, x.x, acc.x);
+                acc.y = fmaf(tap, x.y, acc.y);
+            }
+
+            __device__ inline sample_t zero() {
+                return make_float2(0.0f, 0.0f);
+            }
+        )""";
+    } else {
+        header = R"""(
+            typedef float sample_t;
+
+            __device__ inline void madd(sample_t& acc, const float tap, const sample_t& x) {
+                acc = fmaf(tap, x, acc);
+            }
+
+            __device__ inline sample_t zero() {
+                return 0.0f;
+            }
+        )""";
+    }
+
+    ctx.cuda->createKernel("resampler", header + R"""(
+        __global__ void resampler(const sample_t* input,
+                                  const sample_t* history,
+                                  const float* bank,
+                                  sample_t* output,
+                                  size_t axisSize,
+                                  size_t inner,
+                                  size_t outputSize,
+                                  size_t phaseTaps,
+                                  size_t historySize,
+                                  size_t interpolation,
+                                  size_t decimation,
+                                  size_t size) {
+            size_t id = blockIdx.x * blockDim.x + threadIdx.x;
+            if (id >= size) {
+                return;
+            }
+
+            const size_t i = id % inner;
+            const size_t m = (id / inner) % outputSize;
+            const size_t o = id / (inner * outputSize);
+
+            const sample_t* x = input + o * axisSize * inner + i;
+            const sample_t* h = history + o * historySize * inner + i;
+
+            const size_t u = m * decimation;
+            const size_t start = u / interpolation;
+            const float* taps = bank + (u % interpolation) * phaseTaps;
+
+            sample_t acc = zero();
+
+            for (size_t j = 0; j < phaseTaps; j++) {
+                const size_t n = start + j;
+                madd(acc, taps[j], (n < historySize) ? h[n * inner] : x[(n - historySize) * inner]);
+            }
+
+            output[id] = acc;
+        }
+    )""");
+
+    ctx.cuda->createKernel("resampler_history", header + R"""(
+        __global__ void resampler_history(const sample_t* input,
+                                          const sample_t* history,
+                                          sample_t* nextHistory,
+                                          size_t axisSize,
+                                          size_t inner,
+                                          size_t historySize,
+                                          size_t size) {
+            size_t id = blockIdx.x * blockDim.x + threadIdx.x;
+            if (id >= size) {
+                return;
+            }
+
+            const size_t i = id % inner;
+            const size_t t = (id / inner) % historySize;
+            const size_t o = id / (inner * historySize);
+
+            const size_t n = axisSize + t;
+            nextHistory[id] = (n < historySize) ? history[(o * historySize + n) * inner + i] :
+                                                  input[(o * axisSize + n - historySize) * inner + i];
+        }
+    )""");
+
+    // Upload the bank.
+
+    impl->phaseTaps = (impl->taps.size() + impl->interpolation - 1) / impl->interpolation;
+    impl->historySize = impl->phaseTaps - 1;
+
+    Tensor<Device::CPU, F32> hostBank({impl->interpolation * impl->phaseTaps});
+    for (U64 p = 0; p < impl->interpolation; p++) {
+        for (U64 j = 0; j < impl->phaseTaps; j++) {
+            const U64 k = p + (impl->phaseTaps - 1 - j) * impl->interpolation;
+            hostBank[p * impl->phaseTaps + j] = (k < impl->taps.size()) ? impl->taps[k] : 0.0f;
+        }
+    }
+    impl->bank = Tensor<Device::CUDA, F32>({impl->interpolation * impl->phaseTaps});
+    JST_CHECK(Memory::Copy(impl->bank, hostBank));
+
+    // Allocate history. Zero-filled by the allocator.
+
+    const U64 historyLength = std::max<U64>(impl->historySize, 1);
+    impl->history = Tensor<Device::CUDA, T>({impl->outer, historyLength, impl->inner});
+    impl->nextHistory = Tensor<Device::CUDA, T>({impl->outer, historyLength, impl->inner});
+
+    // Initialize kernel size.
+
+    impl->numberOfElements = output.buffer.size();
+    impl->numberOfHistoryElements = impl->outer * impl->historySize * impl->inner;
+
+    U64 threadsPerBlock = 256;
+
+    impl->grid = { (impl->numberOfElements + threadsPerBlock - 1) / threadsPerBlock, 1, 1 };
+    impl->historyGrid = { (impl->numberOfHistoryElements + threadsPerBlock - 1) / threadsPerBlock, 1, 1 };
+    impl->block = { threadsPerBlock, 1, 1 };
+
+    // Initialize kernel input.
+
+    if (!input.buffer.device_native() && input.buffer.contiguous()) {
+        impl->input = Tensor<Device::CUDA, T>(input.buffer.shape());
+    } else {
+        impl->input = input.buffer;
+    }
+
+    // Initialize kernel arguments.
+
+    impl->arguments = {
+        impl->input.data_ptr(),
+        impl->history.data_ptr(),
+        impl->bank.data_ptr(),
+        output.buffer.data_ptr(),
+        &impl->axisSize,
+        &impl->inner,
+        &impl->outputSize,
+        &impl->phaseTaps,
+        &impl->historySize,
+        &impl->interpolation,
+        &impl->decimation,
+        &impl->numberOfElements,
+    };
+
+    impl->historyArguments = {
+        impl->input.data_ptr(),
+        impl->history.data_ptr(),
+        impl->nextHistory.data_ptr(),
+        &impl->axisSize,
+        &impl->inner,
+        &impl->historySize,
+        &impl->numberOfHistoryElements,
+    };
+
+    return Result::SUCCESS;
+}
+
+template<Device D, typename T>
+Result Resampler<D, T>::compute(const Context& ctx) {
+    if (!input.buffer.device_native() && input.buffer.contiguous()) {
+        JST_CHECK(Memory::Copy(impl->input, input.buffer, ctx.cuda->stream()));
+    }
+
+    JST_CHECK(ctx.cuda->launchKernel("resampler",
+                                     impl->grid,
+                                     impl->block,
+                                     impl->arguments.data()));
+
+    if (impl->historySize > 0) {
+        JST_CHECK(ctx.cuda->launchKernel("resampler_history",
+                                         impl->historyGrid,
+                                         impl->block,
+                                         impl->historyArguments.data()));
+
+        JST_CHECK(Memory::Copy(impl->history, impl->nextHistory, ctx.cuda->stream()));
+    }
+
+    return Result::SUCCESS;
+}
+
+JST_RESAMPLER_CUDA(JST_INSTANTIATION)
+JST_RESAMPLER_CUDA(JST_BENCHMARK)
+
+}  // namespace Jetstream
@@ -0,0 +1,110 @@
+#include "jetstream/modules/resampler.hh"
+
+#include <numeric>
+
+#include "benchmark.cc"
+
+namespace Jetstream {
+
+// Blackman windowed sinc at the interpolated rate with the cutoff at the
+// lower of the input and output Nyquist frequencies. Zero stuffing divides
+// the signal by the interpolation, which the taps give back.
+inline std::vector<F32> ResamplerTaps(const U64& interpolation, const U64& decimation, const U64& tapsPerPhase) {
+    if (interpolation == 1 && decimation == 1) {
+        return {1.0f};
+    }
+
+    const U64 ratio = std::max(interpolation, decimation);
+    const U64 size = ratio * tapsPerPhase + 1;
+    const F64 cutoff = 0.5 / static_cast<F64>(ratio);
+    const F64 center = static_cast<F64>(size - 1) / 2.0;
+
+    std::vector<F64> window(size);
+    F64 sum = 0.0;
+
+    for (U64 i = 0; i < size; i++) {
+        const F64 x = 2.0 * cutoff * (static_cast<F64>(i) - center);
+        const F64 sinc = (x == 0.0) ? 1.0 : sin(JST_PI * x) / (JST_PI * x);
+        window[i] = sinc * (0.42 - 0.50 * cos(2.0 * JST_PI * i / (size - 1)) +
+                            0.08 * cos(4.0 * JST_PI * i / (size - 1)));
+        sum += window[i];
+    }
+
+    std::vector<F32> taps(size);
+    for (U64 i = 0; i < size; i++) {
+        taps[i] = static_cast<F32>(interpolation * window[i] / sum);
+    }
+    return taps;
+}
+
+template<Device D, typename T>
+Result Resampler<D, T>::create() {
+    JST_DEBUG("Initializing Resampler module.");
+    JST_INIT_IO();
+
+    // Check parameters.
+
+    if (config.axis >= input.buffer.rank()) {
+        JST_ERROR("Resampling axis ({}) is out of range for a tensor of rank {}.",
+                  config.axis, input.buffer.rank());
+        return Result::ERROR;
+    }
+
+    if (config.interpolation == 0 || config.decimation == 0) {
+        JST_ERROR("Invalid resampling ratio: {}/{}. Interpolation and decimation should be positive.",
+                  config.interpolation, config.decimation);
+        return Result::ERROR;
+    }
+
+    if (config.tapsPerPhase == 0) {
+        JST_ERROR("Number of taps per phase should be positive.");
+        return Result::ERROR;
+    }
+
+    // Reduce the ratio, so every buffer starts at the same phase with the
+    // smallest possible buffer size.
+
+    const U64 divisor = std::gcd(config.interpolation, config.decimation);
+    impl->interpolation = config.interpolation / divisor;
+    impl->decimation = config.decimation / divisor;
+
+    const auto& shape = input.buffer.shape();
+
+    if ((shape[config.axis] % impl->decimation) != 0) {
+        JST_ERROR("Axis size ({}) should be a multiple of the reduced decimation ({}).",
+                  shape[config.axis], impl->decimation);
+        return Result::ERROR;
+    }
+
+    // Calculate parameters.
+
+    impl->outer = 1;
+    impl->inner = 1;
+    for (U64 i = 0; i < config.axis; i++) {
+        impl->outer *= shape[i];
+    }
+    for (U64 i = config.axis + 1; i < shape.size(); i++) {
+        impl->inner *= shape[i];
+    }
+    impl->axisSize = shape[config.axis];
+    impl->outputSize = (impl->axisSize * impl->interpolation) / impl->decimation;
+    impl->taps = ResamplerTaps(impl->interpolation, impl->decimation, config.tapsPerPhase);
+
+    // Allocate output.
+
+    auto outputShape = shape;
+    outputShape[config.axis] = impl->outputSize;
+    output.buffer = Tensor<D, T>(outputShape);
+
+    return Result::SUCCESS;
+}
+
+template<Device D, typename T>
+void Resampler<D, T>::info() const {
+    JST_DEBUG("  Axis:           {}", config.axis);
+    JST_DEBUG("  Resampling:     {}/{}", impl->interpolation, impl->decimation);
+    JST_DEBUG("  Taps Per Phase: {}", config.tapsPerPhase);
+    JST_DEBUG("  Taps:           {}", impl->taps.size());
+}
+
+}  // namespace Jetstream
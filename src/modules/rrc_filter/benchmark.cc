@@ -0,0 +1,28 @@
+#include "jetstream/modules/rrc_filter.hh"
+
+namespace Jetstream {
+
+template<template<Device, typename...> class Module, Device D, typename T>
+void benchmark(ankerl::nanobench::Bench& bench, std::string name) {
+    JST_BENCHMARK_RUN("8192 (101 Taps)", {}, {
+        .buffer = Tensor<D COMMA T>({8192}) COMMA
+    }, T);
+
+    // Matched filter at symbol rate.
+    JST_BENCHMARK_RUN("8192 (101 Taps, 1/4)", {
+        .sampleRate = 4.0e6f COMMA
+        .decimation = 4 COMMA
+    }, {
+        .buffer = Tensor<D COMMA T>({8192}) COMMA
+    }, T);
+
+    // Pulse shaping from symbol rate.
+    JST_BENCHMARK_RUN("8192 (101 Taps, 4/1)", {
+        .sampleRate = 1.0e6f COMMA
+        .interpolation = 4 COMMA
+    }, {
+        .buffer = Tensor<D COMMA T>({8192}) COMMA
+    }, T);
+}
+
+}  // namespace Jetstream
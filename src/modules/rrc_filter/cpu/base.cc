@@ -1,7 +1,19 @@
 #include "../generic.cc"
 
+#include "jetstream/backend/devices/cpu/fir.hh"
+
 namespace Jetstream {
 
+template<Device D, typename T>
+struct RRCFilter<D, T>::Impl {
+    Memory::CoefficientCache<F32>::Coefficients taps;
+    Backend::PolyphaseFir<T> fir;
+    bool baked = false;
+
+    // Configuration published by the runtime setters.
+    Memory::HotConfig<Config> hotConfig;
+};
+
 template<Device D, typename T>
 RRCFilter<D, T>::RRCFilter() {
     impl = std::make_unique<Impl>();
@@ -13,41 +25,35 @@ RRCFilter<D, T>::~RRCFilter() {
 }
 
 template<Device D, typename T>
-Result RRCFilter<D, T>::compute(const Context&) {
-    if (!impl->baked) {
-        JST_CHECK(impl->generateRRCCoeffs(*this));
-        impl->baked = true;
-    }
-
-    const U64 inputSize = input.buffer.size();
-    const U64 numTaps = config.taps;
-
-    for (U64 n = 0; n < inputSize; n++) {
-        // Add current input sample to history
-        impl->history[impl->historyIndex] = input.buffer[n];
+Result RRCFilter<D, T>::createCompute(const Context&) {
+    JST_TRACE("Create RRC Filter compute core using CPU backend.");
 
-        // Compute filter output using convolution
-        T outputSample{};
+    JST_CHECK(impl->fir.configure(impl->taps->data(), impl->taps->size(), config.interpolation, config.decimation));
+    impl->baked = true;
 
-        for (U64 k = 0; k < numTaps; k++) {
-            const U64 histIdx = (impl->historyIndex + numTaps - k) % numTaps;
-
-            if constexpr (std::is_same_v<T, CF32>) {
-                outputSample += impl->history[histIdx] * std::complex<F32>(impl->coeffs[k], 0.0f);
-            } else {
-                outputSample += impl->history[histIdx] * impl->coeffs[k];
-            }
-        }
+    return Result::SUCCESS;
+}
 
-        output.buffer[n] = outputSample;
+template<Device D, typename T>
+Result RRCFilter<D, T>::compute(const Context&) {
+    // Parameters changed at runtime take effect from this block on.
+    Config changed;
+    if (impl->hotConfig.consume(changed)) {
+        impl->taps = RRCFilterCachedTaps(changed);
+        impl->baked = false;
+    }
 
-        // Update history index (circular buffer)
-        impl->historyIndex = (impl->historyIndex + 1) % numTaps;
+    if (!impl->baked) {
+        JST_CHECK(impl->fir.configure(impl->taps->data(), impl->taps->size(), config.interpolation, config.decimation));
+        impl->baked = true;
     }
 
+    impl->fir.process(input.buffer.data(), input.buffer.size(), output.buffer.data());
+
     return Result::SUCCESS;
 }
 
 JST_RRC_FILTER_CPU(JST_INSTANTIATION)
+JST_RRC_FILTER_CPU(JST_BENCHMARK)
 
 }  // namespace Jetstream
@@ -0,0 +1,261 @@
+#include "../generic.cc"
+
+#include "jetstream/memory/devices/cuda/copy.hh"
+
+namespace Jetstream {
+
+template<Device D, typename T>
+struct RRCFilter<D, T>::Impl {
+    Memory::CoefficientCache<F32>::Coefficients taps;
+    bool baked = false;
+
+    // Configuration published by the runtime setters.
+    Memory::HotConfig<Config> hotConfig;
+
+    std::vector<U64> grid;
+    std::vector<U64> block;
+    std::vector<U64> historyGrid;
+
+    std::vector<void*> arguments;
+    std::vector<void*> historyArguments;
+
+    Tensor<Device::CUDA, T> input;
+    Tensor<Device::CUDA, T> output;
+
+    // Polyphase bank with the taps of every phase reversed, like the CPU
+    // filter. The host copy is kept alive until the upload is done.
+    Tensor<Device::CPU, F32> hostBank;
+    Tensor<Device::CUDA, F32> bank;
+
+    // Last input samples, oldest first. The next history is written apart
+    // and copied back, so blocks shorter than the history don't race.
+    Tensor<Device::CUDA, T> history;
+    Tensor<Device::CUDA, T> nextHistory;
+
+    U64 interpolation = 1;
+    U64 decimation = 1;
+    U64 phaseTaps = 0;
+    U64 historySize = 0;
+    U64 inputSize = 0;
+    U64 numberOfElements = 0;
+
+    Result bake(const cudaStream_t& stream);
+};
+
+template<Device D, typename T>
+Result RRCFilter<D, T>::Impl::bake(const cudaStream_t& stream) {
+    const U64 phaseTaps = (taps->size() + interpolation - 1) / interpolation;
+
+    // The history is kept unless the number of taps per phase changed.
+
+    if (phaseTaps != this->phaseTaps) {
+        this->phaseTaps = phaseTaps;
+        historySize = phaseTaps - 1;
+
+        const U64 historyLength = std::max<U64>(historySize, 1);
+        history = Tensor<Device::CUDA, T>({historyLength});
+        nextHistory = Tensor<Device::CUDA, T>({historyLength});
+        bank = Tensor<Device::CUDA, F32>({interpolation * phaseTaps});
+        hostBank = Tensor<Device::CPU, F32>({interpolation * phaseTaps});
+
+        const U64 threadsPerBlock = 512;
+        historyGrid = { (historySize + threadsPerBlock - 1) / threadsPerBlock, 1, 1 };
+
+        arguments = {
+            input.data_ptr(),
+            history.data_ptr(),
+            bank.data_ptr(),
+            output.data_ptr(),
+            &this->phaseTaps,
+            &historySize,
+            &interpolation,
+            &decimation,
+            &numberOfElements,
+        };
+
+        historyArguments = {
+            input.data_ptr(),
+            history.data_ptr(),
+            nextHistory.data_ptr(),
+            &inputSize,
+            &historySize,
+        };
+    }
+
+    for (U64 p = 0; p < interpolation; p++) {
+        for (U64 j = 0; j < phaseTaps; j++) {
+            const U64 k = p + (phaseTaps - 1 - j) * interpolation;
+            hostBank[p * phaseTaps + j] = (k < taps->size()) ? (*taps)[k] : 0.0f;
+        }
+    }
+    JST_CHECK(Memory::Copy(bank, hostBank, stream));
+
+    baked = true;
+
+    return Result::SUCCESS;
+}
+
+template<Device D, typename T>
+RRCFilter<D, T>::RRCFilter() {
+    impl = std::make_unique<Impl>();
+}
+
+template<Device D, typename T>
+RRCFilter<D, T>::~RRCFilter() {
+    impl.reset();
+}
+
+template<Device D, typename T>
+Result RRCFilter<D, T>::createCompute(const Context& ctx) {
+    JST_TRACE("Create RRC Filter compute core using CUDA backend.");
+
+    // Create CUDA kernels.
+    //
+    // Each thread computes one kept output as a dot product between the bank
+    // of its phase and a window of [history | input]. The zeros of the
+    // upsampled signal are never read.
+
+    std::string header;
+
+    if constexpr (std::is_same_v<T, CF32>) {
+        header = R"""(
+            typedef float2 sample_t;
+
+            __device__ inline void madd(sample_t& acc, const float tap, const sample_t& x) {
+                acc.x = fmaf(tap, x.x, acc.x);
+                acc.y = fmaf(tap, x.y, acc.y);
+            }
+
+            __device__ inline sample_t zero() {
+                return make_float2(0.0f, 0.0f);
+            }
+        )""";
+    } else {
+        header = R"""(
+            typedef float sample_t;
+
+            __device__ inline void madd(sample_t& acc, const float tap, const sample_t& x) {
+                acc = fmaf(tap, x, acc);
+            }
+
+            __device__ inline sample_t zero() {
+                return 0.0f;
+            }
+        )""";
+    }
+
+    ctx.cuda->createKernel("rrc_filter", header + R"""(
+        __global__ void rrc_filter(const sample_t* input,
+                                   const sample_t* history,
+                                   const float* bank,
+                                   sample_t* output,
+                                   size_t phaseTaps,
+                                   size_t historySize,
+                                   size_t interpolation,
+                                   size_t decimation,
+                                   size_t size) {
+            size_t id = blockIdx.x * blockDim.x + threadIdx.x;
+            if (id >= size) {
+                return;
+            }
+
+            const size_t u = id * decimation;
+            const size_t start = u / interpolation;
+            const float* taps = bank + (u % interpolation) * phaseTaps;
+
+            sample_t acc = zero();
+
+            for (size_t j = 0; j < phaseTaps; j++) {
+                const size_t n = start + j;
+                madd(acc, taps[j], (n < historySize) ? history[n] : input[n - historySize]);
+            }
+
+            output[id] = acc;
+        }
+    )""");
+
+    ctx.cuda->createKernel("rrc_filter_history", header + R"""(
+        __global__ void rrc_filter_history(const sample_t* input,
+                                           const sample_t* history,
+                                           sample_t* nextHistory,
+                                           size_t inputSize,
+                                           size_t historySize) {
+            size_t id = blockIdx.x * blockDim.x + threadIdx.x;
+            if (id >= historySize) {
+                return;
+            }
+
+            const size_t n = inputSize + id;
+            nextHistory[id] = (n < historySize) ? history[n] : input[n - historySize];
+        }
+    )""");
+
+    // Calculate parameters.
+
+    impl->interpolation = config.interpolation;
+    impl->decimation = config.decimation;
+    impl->inputSize = input.buffer.size();
+    impl->numberOfElements = output.buffer.size();
+
+    // Initialize kernel size.
+
+    U64 threadsPerBlock = 512;
+
+    impl->grid = { (impl->numberOfElements + threadsPerBlock - 1) / threadsPerBlock, 1, 1 };
+    impl->block = { threadsPerBlock, 1, 1 };
+
+    // Initialize kernel input.
+
+    if (!input.buffer.device_native() && input.buffer.contiguous()) {
+        impl->input = Tensor<Device::CUDA, T>(input.buffer.shape());
+    } else {
+        impl->input = input.buffer;
+    }
+    impl->output = output.buffer;
+
+    // Upload the bank and allocate history. Zero-filled by the allocator.
+
+    impl->phaseTaps = 0;
+    JST_CHECK(impl->bake(ctx.cuda->stream()));
+
+    return Result::SUCCESS;
+}
+
+template<Device D, typename T>
+Result RRCFilter<D, T>::compute(const Context& ctx) {
+    // Parameters changed at runtime take effect from this block on.
+    Config changed;
+    if (impl->hotConfig.consume(changed)) {
+        impl->taps = RRCFilterCachedTaps(changed);
+        impl->baked = false;
+    }
+
+    if (!impl->baked) {
+        JST_CHECK(impl->bake(ctx.cuda->stream()));
+    }
+
+    if (!input.buffer.device_native() && input.buffer.contiguous()) {
+        JST_CHECK(Memory::Copy(impl->input, input.buffer, ctx.cuda->stream()));
+    }
+
+    JST_CHECK(ctx.cuda->launchKernel("rrc_filter",
+                                     impl->grid,
+                                     impl->block,
+                                     impl->arguments.data()));
+
+    if (impl->historySize > 0) {
+        JST_CHECK(ctx.cuda->launchKernel("rrc_filter_history",
+                                         impl->historyGrid,
+                                         impl->block,
+                                         impl->historyArguments.data()));
+
+        JST_CHECK(Memory::Copy(impl->history, impl->nextHistory, ctx.cuda->stream()));
+    }
+
+    return Result::SUCCESS;
+}
+
+JST_RRC_FILTER_CUDA(JST_INSTANTIATION)
+JST_RRC_FILTER_CUDA(JST_BENCHMARK)
+
+}  // namespace Jetstream
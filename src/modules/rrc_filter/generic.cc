@@ -1,27 +1,24 @@
 #include "jetstream/modules/rrc_filter.hh"
+#include "jetstream/memory/utils/coefficient_cache.hh"
+#include "jetstream/memory/utils/hot_config.hh"
 
-namespace Jetstream {
+#include "benchmark.cc"
 
-template<Device D, typename T>
-struct RRCFilter<D, T>::Impl {
-    using CoeffType = typename std::conditional_t<std::is_same_v<T, CF32>, F32, T>;
-    Tensor<D, CoeffType> coeffs;
-    Tensor<D, T> history;
-    U64 historyIndex = 0;
-    bool baked = false;
+namespace Jetstream {
 
-    Result generateRRCCoeffs(RRCFilter<D, T>& m);
-    Result refreshCoefficients(RRCFilter<D, T>& m);
-};
+// Root raised cosine taps. The filter runs at the interpolated rate. Zero
+// stuffing divides the signal by the interpolation factor, which the taps
+// give back.
+template<typename C>
+inline std::vector<F32> RRCFilterTaps(const C& config) {
+    const F64 samplesPerSymbol = (config.sampleRate * config.interpolation) / config.symbolRate;
+    const F64 beta = config.rollOff;
+    const F64 normFactor = sqrt(1.0 / samplesPerSymbol) * config.interpolation;
 
-template<Device D, typename T>
-Result RRCFilter<D, T>::Impl::generateRRCCoeffs(RRCFilter<D, T>& m) {
-    const F64 samplesPerSymbol = m.config.sampleRate / m.config.symbolRate;
-    const F64 beta = m.config.rollOff;
-    const F64 normFactor = sqrt(1.0 / samplesPerSymbol);
+    std::vector<F32> taps(config.taps);
 
-    for (U64 i = 0; i < m.config.taps; i++) {
-        const F64 t = (static_cast<F64>(i) - static_cast<F64>(m.config.taps - 1) / 2.0) / samplesPerSymbol;
+    for (U64 i = 0; i < config.taps; i++) {
+        const F64 t = (static_cast<F64>(i) - static_cast<F64>(config.taps - 1) / 2.0) / samplesPerSymbol;
 
         F64 rrcValue;
 
@@ -45,10 +42,23 @@ Result RRCFilter<D, T>::Impl::generateRRCCoeffs(RRCFilter<D, T>& m) {
                                    (piT * denominator);
         }
 
-        coeffs[i] = static_cast<CoeffType>(rrcValue);
+        taps[i] = static_cast<F32>(rrcValue);
     }
 
-    return Result::SUCCESS;
+    return taps;
+}
+
+// Taps shared with every RRC filter of the same design.
+template<typename C>
+inline Memory::CoefficientCache<F32>::Coefficients RRCFilterCachedTaps(const C& config) {
+    const auto key = jst::fmt::format("rrc_filter:{}:{}:{}:{}:{}", config.taps,
+                                                                   config.sampleRate,
+                                                                   config.symbolRate,
+                                                                   config.rollOff,
+                                                                   config.interpolation);
+    return Memory::CoefficientCache<F32>::Get(key, [&]{
+        return RRCFilterTaps(config);
+    });
 }
 
 template<Device D, typename T>
@@ -60,7 +70,8 @@ Result RRCFilter<D, T>::setSymbolRate(F32& symbolRate) {
         return Result::WARNING;
     }
     config.symbolRate = symbolRate;
-    return impl->refreshCoefficients(*this);
+    impl->hotConfig.publish(config);
+    return Result::SUCCESS;
 }
 
 template<Device D, typename T>
@@ -78,7 +89,8 @@ Result RRCFilter<D, T>::setSampleRate(F32& sampleRate) {
         return Result::WARNING;
     }
     config.sampleRate = sampleRate;
-    return impl->refreshCoefficients(*this);
+    impl->hotConfig.publish(config);
+    return Result::SUCCESS;
 }
 
 template<Device D, typename T>
@@ -90,7 +102,8 @@ Result RRCFilter<D, T>::setRollOff(F32& rollOff) {
         return Result::WARNING;
     }
     config.rollOff = rollOff;
-    return impl->refreshCoefficients(*this);
+    impl->hotConfig.publish(config);
+    return Result::SUCCESS;
 }
 
 template<Device D, typename T>
@@ -106,53 +119,20 @@ Result RRCFilter<D, T>::setTaps(U64& taps) {
         return Result::WARNING;
     }
 
-    // If taps changed, we need to reallocate buffers
+    // The backend rebuilds its bank before the next block.
     if (taps != config.taps) {
         config.taps = taps;
-
-        // Reallocate coefficient buffer
-        impl->coeffs = Tensor<D, typename Impl::CoeffType>({config.taps});
-
-        // Reallocate and reset history buffer
-        impl->history = Tensor<D, T>({config.taps});
-        impl->historyIndex = 0;
-        for (U64 i = 0; i < config.taps; i++) {
-            impl->history[i] = T{};
-        }
-
-        return impl->refreshCoefficients(*this);
+        impl->hotConfig.publish(config);
     }
 
     return Result::SUCCESS;
 }
 
-template<Device D, typename T>
-Result RRCFilter<D, T>::Impl::refreshCoefficients(RRCFilter<D, T>& m) {
-    JST_CHECK(generateRRCCoeffs(m));
-    baked = true;
-    return Result::SUCCESS;
-}
-
 template<Device D, typename T>
 Result RRCFilter<D, T>::create() {
     JST_DEBUG("Initializing RRC Filter module.");
     JST_INIT_IO();
 
-    // Allocate filter coefficients
-    impl->coeffs = Tensor<D, typename Impl::CoeffType>({config.taps});
-
-    // Allocate history buffer (circular buffer for filter states)
-    impl->history = Tensor<D, T>({config.taps});
-    impl->historyIndex = 0;
-
-    // Initialize history to zero
-    for (U64 i = 0; i < config.taps; i++) {
-        impl->history[i] = T{};
-    }
-
-    // Allocate output buffer to match input size
-    output.buffer = Tensor<D, T>({input.buffer.size()});
-
     // Validate parameters
     if (config.symbolRate <= 0) {
         JST_ERROR("Invalid symbol rate: {} MHz. Symbol rate should be positive.",
@@ -182,10 +162,23 @@ Result RRCFilter<D, T>::create() {
         JST_ERROR("Invalid number of taps: '{}'. Number of taps should be at least 3.", config.taps);
         return Result::ERROR;
     }
+    if (config.interpolation == 0 || config.decimation == 0) {
+        JST_ERROR("Invalid resampling ratio: {}/{}. Interpolation and decimation should be positive.",
+                  config.interpolation, config.decimation);
+        return Result::ERROR;
+    }
+    if (((input.buffer.size() * config.interpolation) % config.decimation) != 0) {
+        JST_ERROR("Input size ({}) times the interpolation ({}) should be a multiple of the decimation ({}).",
+                  input.buffer.size(), config.interpolation, config.decimation);
+        return Result::ERROR;
+    }
+
+    // Allocate output buffer at the resampled size
+    output.buffer = Tensor<D, T>({(input.buffer.size() * config.interpolation) / config.decimation});
 
     // Generate initial coefficients
-    JST_CHECK(impl->generateRRCCoeffs(*this));
-    impl->baked = true;
+    impl->taps = RRCFilterCachedTaps(config);
+    impl->baked = false;
 
     return Result::SUCCESS;
 }
@@ -202,6 +195,11 @@ void RRCFilter<D, T>::info() const {
     JST_DEBUG("  Roll-off:      {}", config.rollOff);
     JST_DEBUG("  Taps:          {}", config.taps);
     JST_DEBUG("  Oversampling:  {:.1f}", config.sampleRate / config.symbolRate);
+    JST_DEBUG("  Resampling:    {}/{}", config.interpolation, config.decimation);
+    JST_DEBUG("  Phase Taps:    {}", (config.taps + config.interpolation - 1) / config.interpolation);
+    if constexpr (D == Device::CPU) {
+        JST_DEBUG("  Kernel:        {}", impl->fir.kernelName());
+    }
 }
 
 }  // namespace Jetstream
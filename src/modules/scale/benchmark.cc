@@ -7,6 +7,14 @@ void benchmark(ankerl::nanobench::Bench& bench, std::string name) {
     JST_BENCHMARK_RUN("128x8000", {}, {
         .buffer = Tensor<D COMMA IT>({128 COMMA 8000}) COMMA
     }, IT);
+
+    if constexpr (D == Device::CPU) {
+        JST_BENCHMARK_RUN("128x8000 (In-Place)", {
+            .inPlace = true COMMA
+        }, {
+            .buffer = Tensor<D COMMA IT>({128 COMMA 8000}) COMMA
+        }, IT);
+    }
 }
 
 }  // namespace Jetstream
\ No newline at end of file
@@ -1,5 +1,7 @@
 #include "../generic.cc"
 
+#include "jetstream/memory/devices/cpu/helpers.hh"
+
 namespace Jetstream {
 
 template<Device D, typename T>
@@ -26,15 +28,32 @@ Result Scale<D, T>::createCompute(const Context&) {
     return Result::SUCCESS;
 }
 
-template<Device D, typename T>
-Result Scale<D, T>::compute(const Context&) {
-    for (U64 i = 0; i < input.buffer.size(); i++) {
+template<>
+Result Scale<Device::CPU, F32>::computeSlice(const Context&, const U64& offset, const U64& size) {
+    for (U64 i = offset; i < offset + size; i++) {
         output.buffer[i] = input.buffer[i] * impl->scalingCoeff + impl->offsetCoeff;
     }
 
     return Result::SUCCESS;
 }
 
+template<Device D, typename T>
+Result Scale<D, T>::compute(const Context& ctx) {
+    if (input.buffer.contiguous()) {
+        return computeSlice(ctx, 0, input.buffer.size());
+    }
+
+    // Views are read through their strides instead of being copied first.
+
+    const F32 scalingCoeff = impl->scalingCoeff;
+    const F32 offsetCoeff = impl->offsetCoeff;
+    Memory::CPU::AutomaticIterator([&](const auto& in, auto& out) {
+        out = in * scalingCoeff + offsetCoeff;
+    }, input.buffer, output.buffer);
+
+    return Result::SUCCESS;
+}
+
 JST_SCALE_CPU(JST_INSTANTIATION)
 JST_SCALE_CPU(JST_BENCHMARK)
 
@@ -32,17 +32,6 @@ template<Device D, typename T>
 Result Scale<D, T>::createCompute(const Context& ctx) {
     JST_TRACE("Create Scale compute core using CUDA backend.");
 
-    // Create CUDA kernel.
-
-    ctx.cuda->createKernel("scale", R"""(
-        __global__ void scale(const float* input, float* output, float scalingCoeff, float offsetCoeff, size_t size) {
-            size_t id = blockIdx.x * blockDim.x + threadIdx.x;
-            if (id < size) {
-                output[id] = input[id] * scalingCoeff + offsetCoeff;
-            }
-        }
-    )""");
-
     // Initialize kernel size.
 
     U64 threadsPerBlock = 512;
@@ -51,6 +40,21 @@ Result Scale<D, T>::createCompute(const Context& ctx) {
     impl->grid = { blocksPerGrid, 1, 1 };
     impl->block = { threadsPerBlock, 1, 1 };
 
+    // Create CUDA kernel specialized for the size of the input.
+
+    JST_CHECK(ctx.cuda->createKernel("scale", R"""(
+        __global__ void scale(const float* input, float* output, float scalingCoeff, float offsetCoeff) {
+            size_t id = blockIdx.x * blockDim.x + threadIdx.x;
+            if ((SIZE % BLOCK_SIZE) != 0 && id >= SIZE) {
+                return;
+            }
+            output[id] = input[id] * scalingCoeff + offsetCoeff;
+        }
+    )""", {}, {
+        CUDA::Constant("SIZE", impl->numberOfElements),
+        CUDA::Constant("BLOCK_SIZE", threadsPerBlock),
+    }));
+
     // Initialize kernel input.
 
     if (!input.buffer.device_native() && input.buffer.contiguous()) {
@@ -66,7 +70,6 @@ Result Scale<D, T>::createCompute(const Context& ctx) {
         output.buffer.data_ptr(),
         &impl->scalingCoeff,
         &impl->offsetCoeff,
-        &impl->numberOfElements,
     };
 
     return Result::SUCCESS;
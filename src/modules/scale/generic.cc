@@ -19,7 +19,19 @@ Result Scale<D, T>::create() {
 
     // Allocate output.
 
-    output.buffer = Tensor<D, T>(input.buffer.shape());
+    if (config.inPlace) {
+        if constexpr (D != Device::CPU) {
+            JST_ERROR("Scale can't run in-place on the {} backend.", D);
+            return Result::ERROR;
+        }
+
+        JST_CHECK(Module::InitInPlaceOutput(output.buffer, input.buffer));
+    } else if constexpr (D == Device::CPU) {
+        // Skip zero-filling CPU memory fully written by the first compute.
+        output.buffer = Tensor<D, T>(input.buffer.shape(), false);
+    } else {
+        output.buffer = Tensor<D, T>(input.buffer.shape());
+    }
 
     return Result::SUCCESS;
 }
@@ -41,6 +53,13 @@ const Range<T>& Scale<D, T>::range(const Range<T>& range) {
 template<Device D, typename T>
 void Scale<D, T>::info() const {
     JST_DEBUG("  Amplitude (min, max): ({}, {})", config.range.min, config.range.max);
+    JST_DEBUG("  In-Place:             {}", config.inPlace);
+}
+
+template<Device D, typename T>
+Result Scale<D, T>::computeSlice(const Context&, const U64&, const U64&) {
+    JST_ERROR("Scale can't compute slices on the {} backend.", D);
+    return Result::ERROR;
 }
 
 }  // namespace Jetstream
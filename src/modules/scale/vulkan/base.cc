@@ -0,0 +1,65 @@
+#include "../generic.cc"
+
+#include "resources/shaders/scale_shaders.hh"
+
+namespace Jetstream {
+
+template<Device D, typename T>
+struct Scale<D, T>::Impl {
+    struct Constants {
+        F32 scalingCoeff;
+        F32 offsetCoeff;
+        U32 numberOfElements;
+    };
+
+    Constants constants;
+    std::vector<U64> grid;
+
+    F32 scalingCoeff;
+    F32 offsetCoeff;
+    U64 numberOfElements;
+};
+
+template<Device D, typename T>
+Scale<D, T>::Scale() {
+    impl = std::make_unique<Impl>();
+}
+
+template<Device D, typename T>
+Scale<D, T>::~Scale() {
+    impl.reset();
+}
+
+template<Device D, typename T>
+Result Scale<D, T>::createCompute(const Context& ctx) {
+    JST_TRACE("Create Scale compute core using Vulkan backend.");
+
+    impl->grid = { (impl->numberOfElements + 255) / 256, 1, 1 };
+
+    JST_CHECK(ctx.vulkan->createKernel("scale",
+                                       KernelsPackage["scale"][Device::Vulkan][0],
+                                       {
+                                           input.buffer.data(),
+                                           output.buffer.data(),
+                                       },
+                                       sizeof(typename Impl::Constants)));
+
+    return Result::SUCCESS;
+}
+
+template<Device D, typename T>
+Result Scale<D, T>::compute(const Context& ctx) {
+    // Coefficients can change between frames.
+    impl->constants.scalingCoeff = impl->scalingCoeff;
+    impl->constants.offsetCoeff = impl->offsetCoeff;
+    impl->constants.numberOfElements = impl->numberOfElements;
+
+    JST_CHECK(ctx.vulkan->dispatchKernel("scale", impl->grid, &impl->constants));
+
+    return Result::SUCCESS;
+}
+
+JST_SCALE_VULKAN(JST_INSTANTIATION)
+JST_SCALE_VULKAN(JST_BENCHMARK)
+
+}  // namespace Jetstream
@@ -0,0 +1,115 @@
+#include "jetstream/modules/shared_memory_sink.hh"
+#include "jetstream/memory/utils/shared_ring.hh"
+
+#include <atomic>
+#include <cstring>
+
+namespace Jetstream {
+
+template<Device D, typename T>
+struct SharedMemorySink<D, T>::Impl {
+    Memory::SharedRing ring;
+
+    std::atomic<U64> framesSent = 0;
+    std::atomic<U64> framesDropped = 0;
+};
+
+template<Device D, typename T>
+SharedMemorySink<D, T>::SharedMemorySink() {
+    impl = std::make_unique<Impl>();
+}
+
+template<Device D, typename T>
+SharedMemorySink<D, T>::~SharedMemorySink() {
+    impl.reset();
+}
+
+template<Device D, typename T>
+Result SharedMemorySink<D, T>::create() {
+    JST_DEBUG("Initializing Shared Memory Sink module.");
+    JST_INIT_IO();
+
+    // Check parameters.
+
+    if (config.bufferMultiplier == 0) {
+        JST_ERROR("Buffer multiplier is zero.");
+        return Result::ERROR;
+    }
+
+    // Reset state.
+
+    impl->framesSent = 0;
+    impl->framesDropped = 0;
+
+    // Create ring. Any consumer attached to a previous ring reattaches.
+
+    const U64 capacity = input.buffer.size_bytes() * config.bufferMultiplier;
+    JST_CHECK(impl->ring.create(config.name, capacity, NumericTypeInfo<T>::name));
+
+    return Result::SUCCESS;
+}
+
+template<Device D, typename T>
+Result SharedMemorySink<D, T>::destroy() {
+    JST_DEBUG("Destroying Shared Memory Sink module.");
+
+    impl->ring.close();
+
+    return Result::SUCCESS;
+}
+
+template<Device D, typename T>
+void SharedMemorySink<D, T>::info() const {
+    JST_DEBUG("  Name: {}", config.name);
+    JST_DEBUG("  Buffer Multiplier: {}", config.bufferMultiplier);
+}
+
+template<Device D, typename T>
+Result SharedMemorySink<D, T>::createCompute(const Context&) {
+    JST_TRACE("Create Shared Memory Sink compute core.");
+    return Result::SUCCESS;
+}
+
+template<Device D, typename T>
+Result SharedMemorySink<D, T>::compute(const Context&) {
+    const U64 size = input.buffer.size_bytes();
+
+    // The graph never waits for the consumer. Frames that don't fit are
+    // dropped whole and counted in the ring for the consumer to see.
+    U8* window = impl->ring.reserve(size);
+    if (!window) {
+        impl->ring.drop(size);
+        impl->framesDropped += 1;
+        return Result::SUCCESS;
+    }
+
+    std::memcpy(window, input.buffer.data(), size);
+    impl->ring.commit(size);
+    impl->framesSent += 1;
+
+    return Result::SUCCESS;
+}
+
+template<Device D, typename T>
+U64 SharedMemorySink<D, T>::getFramesSent() const {
+    return impl->framesSent;
+}
+
+template<Device D, typename T>
+U64 SharedMemorySink<D, T>::getFramesDropped() const {
+    return impl->framesDropped;
+}
+
+template<Device D, typename T>
+U64 SharedMemorySink<D, T>::getCapacity() const {
+    return impl->ring.getCapacity();
+}
+
+template<Device D, typename T>
+U64 SharedMemorySink<D, T>::getOccupancy() const {
+    return impl->ring.getOccupancy();
+}
+
+JST_SHARED_MEMORY_SINK_CPU(JST_INSTANTIATION)
+
+}  // namespace Jetstream
@@ -0,0 +1,233 @@
+#include "jetstream/modules/shared_memory_source.hh"
+#include "jetstream/memory/utils/shared_ring.hh"
+#include "jetstream/compute/thread.hh"
+
+#include <mutex>
+#include <atomic>
+#include <thread>
+#include <chrono>
+#include <cstring>
+
+using namespace std::chrono_literals;
+
+namespace Jetstream {
+
+template<Device D, typename T>
+struct SharedMemorySource<D, T>::Impl {
+    // The waiter thread attaches and detaches the ring, the compute reads
+    // from it. The lock is only contended while attaching.
+    std::mutex ringMutex;
+    Memory::SharedRing ring;
+
+    std::thread waiter;
+    std::atomic<bool> running = false;
+    std::atomic<bool> connected = false;
+    // Set by `computeReady` when the graph is waiting for a frame.
+    std::atomic<bool> wanted = false;
+    bool warned = false;
+
+    std::atomic<U64> framesReceived = 0;
+
+    Result attach(const std::string& name, const U64& size);
+    void detach();
+};
+
+template<Device D, typename T>
+SharedMemorySource<D, T>::SharedMemorySource() {
+    impl = std::make_unique<Impl>();
+}
+
+template<Device D, typename T>
+SharedMemorySource<D, T>::~SharedMemorySource() {
+    impl.reset();
+}
+
+template<Device D, typename T>
+Result SharedMemorySource<D, T>::create() {
+    JST_DEBUG("Initializing Shared Memory Source module.");
+    JST_INIT_IO();
+
+    // Check parameters.
+
+    if (!Memory::SharedRing::IsAvailable()) {
+        JST_ERROR("Shared memory isn't supported on this platform.");
+        return Result::ERROR;
+    }
+
+    // Allocate output.
+
+    output.buffer = Tensor<D, T>(config.shape);
+    if (output.buffer.size() == 0) {
+        JST_ERROR("Output shape is zero.");
+        return Result::ERROR;
+    }
+
+    // Reset state.
+
+    impl->connected = false;
+    impl->wanted = false;
+    impl->warned = false;
+    impl->framesReceived = 0;
+
+    // Initialize thread for wake-ups. The ring is attached once the sink
+    // creates it and reattached whenever the sink is recreated.
+
+    impl->running = true;
+    impl->waiter = std::thread([&]{
+        ApplyThreadPolicy(ThreadRole::IO);
+
+        const U64 size = output.buffer.size_bytes();
+
+        while (impl->running) {
+            if (!impl->connected && impl->attach(config.name, size) != Result::SUCCESS) {
+                std::this_thread::sleep_for(100ms);
+                continue;
+            }
+
+            impl->wanted.wait(false);
+            if (!impl->running) {
+                break;
+            }
+
+            if (impl->ring.wait(size, 100ms) == Result::SUCCESS) {
+                impl->wanted = false;
+                notifyCompute();
+                continue;
+            }
+
+            if (impl->ring.isClosed()) {
+                JST_INFO("[SHARED_MEMORY_SOURCE] Ring '{}' was closed by the sink.", config.name);
+                impl->detach();
+            }
+        }
+    });
+
+    return Result::SUCCESS;
+}
+
+template<Device D, typename T>
+Result SharedMemorySource<D, T>::destroy() {
+    JST_DEBUG("Destroying Shared Memory Source module.");
+
+    impl->running = false;
+    impl->wanted = true;
+    impl->wanted.notify_one();
+
+    if (impl->waiter.joinable()) {
+        impl->waiter.join();
+    }
+
+    impl->detach();
+
+    return Result::SUCCESS;
+}
+
+template<Device D, typename T>
+Result SharedMemorySource<D, T>::Impl::attach(const std::string& name, const U64& size) {
+    std::lock_guard<std::mutex> lock(ringMutex);
+
+    if (ring.open(name) != Result::SUCCESS) {
+        return Result::ERROR;
+    }
+
+    // Retried until the sink is recreated with a matching stream.
+    const std::string datatype = ring.getDatatype();
+    if (datatype != NumericTypeInfo<T>::name || ring.getCapacity() < size) {
+        if (!warned) {
+            JST_WARN("[SHARED_MEMORY_SOURCE] Ring '{}' carries {} with {} bytes of capacity. Expected {} with at "
+                     "least {} bytes.", name, datatype, ring.getCapacity(), NumericTypeInfo<T>::name, size);
+            warned = true;
+        }
+        ring.close();
+        return Result::ERROR;
+    }
+
+    JST_INFO("[SHARED_MEMORY_SOURCE] Attached to ring '{}'.", name);
+    warned = false;
+    connected = true;
+
+    return Result::SUCCESS;
+}
+
+template<Device D, typename T>
+void SharedMemorySource<D, T>::Impl::detach() {
+    std::lock_guard<std::mutex> lock(ringMutex);
+    ring.close();
+    connected = false;
+}
+
+template<Device D, typename T>
+void SharedMemorySource<D, T>::info() const {
+    JST_DEBUG("  Name: {}", config.name);
+    JST_DEBUG("  Shape: {}", config.shape);
+}
+
+template<Device D, typename T>
+Result SharedMemorySource<D, T>::createCompute(const Context&) {
+    JST_TRACE("Create Shared Memory Source compute core.");
+    return Result::SUCCESS;
+}
+
+template<Device D, typename T>
+Result SharedMemorySource<D, T>::computeReady() {
+    if (getOccupancy() >= output.buffer.size_bytes()) {
+        return Result::SUCCESS;
+    }
+
+    // The waiter thread notifies the scheduler once the frame arrives.
+    impl->wanted = true;
+    impl->wanted.notify_one();
+
+    return Result::TIMEOUT;
+}
+
+template<Device D, typename T>
+Result SharedMemorySource<D, T>::compute(const Context&) {
+    const U64 size = output.buffer.size_bytes();
+
+    std::lock_guard<std::mutex> lock(impl->ringMutex);
+
+    // The ring is mirrored, any frame is contiguous.
+    const U8* window = impl->ring.peek(size);
+    if (!window) {
+        return Result::YIELD;
+    }
+
+    std::memcpy(output.buffer.data(), window, size);
+    impl->ring.consume(size);
+    impl->framesReceived += 1;
+
+    return Result::SUCCESS;
+}
+
+template<Device D, typename T>
+U64 SharedMemorySource<D, T>::getFramesReceived() const {
+    return impl->framesReceived;
+}
+
+template<Device D, typename T>
+U64 SharedMemorySource<D, T>::getSamplesDropped() const {
+    std::lock_guard<std::mutex> lock(impl->ringMutex);
+    return impl->ring.getDropped() / sizeof(T);
+}
+
+template<Device D, typename T>
+U64 SharedMemorySource<D, T>::getCapacity() const {
+    std::lock_guard<std::mutex> lock(impl->ringMutex);
+    return impl->ring.getCapacity();
+}
+
+template<Device D, typename T>
+U64 SharedMemorySource<D, T>::getOccupancy() const {
+    std::lock_guard<std::mutex> lock(impl->ringMutex);
+    return impl->ring.getOccupancy();
+}
+
+template<Device D, typename T>
+bool SharedMemorySource<D, T>::isConnected() const {
+    return impl->connected;
+}
+
+JST_SHARED_MEMORY_SOURCE_CPU(JST_INSTANTIATION)
+
+}  // namespace Jetstream
@@ -1,4 +1,6 @@
 #include "jetstream/modules/signal_generator.hh"
+#include "jetstream/backend/devices/cpu/simd.hh"
+#include "jetstream/backend/devices/cpu/dispatch.hh"
 
 namespace Jetstream {
 
@@ -31,14 +33,32 @@ void benchmark(ankerl::nanobench::Bench& bench, std::string name) {
         .bufferSize = 65536
     }, {}, IT);
 
+    // Analytic oscillator
+    JST_BENCHMARK_RUN("Cosine 65536", {
+        .signalType = SignalType::Cosine COMMA
+        .sampleRate = 1000000.0 COMMA
+        .frequency = 1000.0 COMMA
+        .amplitude = 1.0 COMMA
+        .bufferSize = 65536
+    }, {}, IT);
+
+    // Periodic waveform from the phase accumulator
+    JST_BENCHMARK_RUN("Triangle 65536", {
+        .signalType = SignalType::Triangle COMMA
+        .sampleRate = 1000000.0 COMMA
+        .frequency = 1000.0 COMMA
+        .amplitude = 1.0 COMMA
+        .bufferSize = 65536
+    }, {}, IT);
+
     // Complex waveforms
     JST_BENCHMARK_RUN("Chirp 8192", {
         .signalType = SignalType::Chirp COMMA
         .sampleRate = 1000000.0 COMMA
+        .amplitude = 1.0 COMMA
         .chirpStartFreq = 1000.0 COMMA
         .chirpEndFreq = 10000.0 COMMA
         .chirpDuration = 1.0 COMMA
-        .amplitude = 1.0 COMMA
         .bufferSize = 8192
     }, {}, IT);
 
@@ -50,6 +70,65 @@ void benchmark(ankerl::nanobench::Bench& bench, std::string name) {
         .noiseVariance = 1.0 COMMA
         .bufferSize = 8192
     }, {}, IT);
+
+    JST_BENCHMARK_RUN("Noise 65536", {
+        .signalType = SignalType::Noise COMMA
+        .sampleRate = 1000000.0 COMMA
+        .amplitude = 1.0 COMMA
+        .noiseVariance = 1.0 COMMA
+        .bufferSize = 65536
+    }, {}, IT);
+
+    // Runs every CPU oscillator and noise kernel supported by the host on the same buffer.
+    if constexpr (D == Device::CPU) {
+        const U64 size = 65536;
+        const U64 width = std::is_same_v<IT, CF32> ? 2 : 1;
+        std::vector<F32> output(size * width);
+
+        const std::vector<std::pair<Backend::SimdLevel, Backend::NcoKernel>> kernels = {
+            {Backend::SimdLevel::Scalar, Backend::NcoScalar},
+#ifdef JST_SIMD_X86
+            {Backend::SimdLevel::AVX2, Backend::NcoAVX2},
+            {Backend::SimdLevel::AVX512, Backend::NcoAVX512},
+#endif
+#ifdef JST_SIMD_NEON
+            {Backend::SimdLevel::NEON, Backend::NcoNEON},
+#endif
+        };
+
+        for (const auto& [level, kernel] : kernels) {
+            if (!Backend::HostSupportsSimdLevel(level)) {
+                continue;
+            }
+            bench.run(name + "NCO 65536 (" + Backend::GetSimdLevelName(level) + ")", [&] {
+                kernel(output.data(), size, width, 0.0, 1e-2, 1.0f);
+                ankerl::nanobench::doNotOptimizeAway(output.data());
+            });
+        }
+
+        const std::vector<std::pair<Backend::SimdLevel, Backend::GaussianNoiseKernel>> noiseKernels = {
+            {Backend::SimdLevel::Scalar, Backend::GaussianNoiseScalar},
+#ifdef JST_SIMD_X86
+            {Backend::SimdLevel::AVX2, Backend::GaussianNoiseAVX2},
+            {Backend::SimdLevel::AVX512, Backend::GaussianNoiseAVX512},
+#endif
+#ifdef JST_SIMD_NEON
+            {Backend::SimdLevel::NEON, Backend::GaussianNoiseNEON},
+#endif
+        };
+
+        U32 counter = 0;
+        for (const auto& [level, kernel] : noiseKernels) {
+            if (!Backend::HostSupportsSimdLevel(level)) {
+                continue;
+            }
+            bench.run(name + "Gaussian Noise 65536 (" + Backend::GetSimdLevelName(level) + ")", [&] {
+                kernel(output.data(), size, width, 1, counter, 1.0f);
+                counter += size;
+                ankerl::nanobench::doNotOptimizeAway(output.data());
+            });
+        }
+    }
 }
 
 }  // namespace Jetstream
\ No newline at end of file
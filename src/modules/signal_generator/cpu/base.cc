@@ -2,22 +2,19 @@
 
 #include "jetstream/macros.hh"
 #include "jetstream/memory/devices/cpu/helpers.hh"
+#include "jetstream/backend/devices/cpu/simd.hh"
 #include <random>
-#include <cmath>
-
-#ifndef M_PI
-#define M_PI 3.14159265358979323846
-#endif
 
 namespace Jetstream {
 
 template<Device D, typename T>
 struct SignalGenerator<D, T>::Impl {
     U64 sampleIndex = 0;
-    std::mt19937 rng;
-    std::normal_distribution<F64> normalDist;
+    F64 cycle = 0.0;
+    U32 seed = std::random_device{}();
 
-    Impl() : rng(std::random_device{}()), normalDist(0.0, 1.0) {}
+    Backend::NcoKernel nco = nullptr;
+    Backend::GaussianNoiseKernel noise = nullptr;
 };
 
 template<Device D, typename T>
@@ -36,113 +33,109 @@ Result SignalGenerator<D, T>::createCompute(const Context&) {
 
     // Reset state
     pimpl->sampleIndex = 0;
-    pimpl->normalDist = std::normal_distribution<F64>(0.0, std::sqrt(config.noiseVariance));
+    pimpl->cycle = 0.0;
+
+    pimpl->nco = Backend::Nco().kernel();
+    JST_TRACE("[SIGNAL_GENERATOR] NCO kernel: {}", Backend::Nco().name());
+
+    pimpl->noise = Backend::GaussianNoise().kernel();
+    JST_TRACE("[SIGNAL_GENERATOR] Noise kernel: {}", Backend::GaussianNoise().name());
 
     return Result::SUCCESS;
 }
 
 template<Device D, typename T>
-Result SignalGenerator<D, T>::compute(const Context&) {
+Result SignalGenerator<D, T>::compute(const Context& ctx) {
     const F64 dt = 1.0 / config.sampleRate;
     const U64 bufferSize = config.bufferSize;
 
+    // Periodic waveforms are evaluated from the phase accumulator, in cycles,
+    // instead of the absolute time. Buffers are split in ranges of samples
+    // that start from their own phase and don't depend on each other.
+
+    constexpr U64 width = std::is_same_v<T, CF32> ? 2 : 1;
+    T* samples = output.buffer.data();
+    const F64 step = config.frequency * dt;
+    const F64 start = pimpl->cycle + config.phase / (2.0 * M_PI);
+    const U64 chunks = bufferSize / Memory::CPU::ParallelIteratorGrain;
+
+    const auto periodic = [&](const auto& waveform) {
+        Memory::CPU::ParallelRanges(ctx.cpu->pool(), bufferSize, chunks, [&](const U64& begin, const U64& end) {
+            for (U64 i = begin; i < end; i++) {
+                const F64 value = config.amplitude * waveform(SignalGeneratorWrapCycle(start + i * step)) + config.dcOffset;
+                samples[i] = T(static_cast<F32>(value));
+            }
+        });
+    };
+
     // Switch once per buffer, not per sample
     switch (config.signalType) {
-        case SignalType::Sine: {
-            U64 idx = 0;
-            Memory::CPU::AutomaticIterator([&](auto& out) {
-                const F64 t = (pimpl->sampleIndex + idx) * dt;
-                const F64 iValue = config.amplitude * std::sin(2.0 * M_PI * config.frequency * t + config.phase) + config.dcOffset;
-
-                if constexpr (std::is_same_v<T, CF32>) {
-                    out = CF32(static_cast<F32>(iValue), 0.0f);
-                } else {
-                    out = static_cast<T>(iValue);
-                }
-                ++idx;
-            }, output.buffer);
-            break;
-        }
-
+        case SignalType::Sine:
         case SignalType::Cosine: {
-            U64 idx = 0;
-            Memory::CPU::AutomaticIterator([&](auto& out) {
-                const F64 t = (pimpl->sampleIndex + idx) * dt;
-                const F64 iValue = config.amplitude * std::cos(2.0 * M_PI * config.frequency * t + config.phase) + config.dcOffset;
-                const F64 qValue = config.amplitude * std::sin(2.0 * M_PI * config.frequency * t + config.phase);
+            // The complex cosine is the analytic signal. The sine is the real
+            // part of the same oscillator delayed by a quarter cycle.
+            const bool sine = config.signalType == SignalType::Sine;
+            const F64 phase = 2.0 * M_PI * (start - (sine ? 0.25 : 0.0));
+            const F64 increment = 2.0 * M_PI * step;
+            const F32 amplitude = static_cast<F32>(config.amplitude);
+            const F32 dcOffset = static_cast<F32>(config.dcOffset);
+
+            Memory::CPU::ParallelRanges(ctx.cpu->pool(), bufferSize, chunks, [&](const U64& begin, const U64& end) {
+                F32* out = reinterpret_cast<F32*>(samples + begin);
+                const U64 size = end - begin;
+
+                pimpl->nco(out, size, width, phase + begin * increment, increment, amplitude);
+
+                if (width == 2 && sine) {
+                    for (U64 i = 0; i < size; i++) {
+                        out[i * width + 1] = 0.0f;
+                    }
+                }
 
-                if constexpr (std::is_same_v<T, CF32>) {
-                    out = CF32(static_cast<F32>(iValue), static_cast<F32>(qValue));
-                } else {
-                    out = static_cast<T>(iValue);
+                if (dcOffset != 0.0f) {
+                    for (U64 i = 0; i < size; i++) {
+                        out[i * width] += dcOffset;
+                    }
                 }
-                ++idx;
-            }, output.buffer);
+            });
             break;
         }
 
         case SignalType::Square: {
-            U64 idx = 0;
-            Memory::CPU::AutomaticIterator([&](auto& out) {
-                const F64 t = (pimpl->sampleIndex + idx) * dt;
-                const F64 phase = std::fmod(2.0 * M_PI * config.frequency * t + config.phase, 2.0 * M_PI);
-                const F64 iValue = config.amplitude * ((phase < M_PI) ? 1.0 : -1.0) + config.dcOffset;
-
-                if constexpr (std::is_same_v<T, CF32>) {
-                    out = CF32(static_cast<F32>(iValue), 0.0f);
-                } else {
-                    out = static_cast<T>(iValue);
-                }
-                ++idx;
-            }, output.buffer);
+            periodic([](const F64& u) { return (u < 0.5) ? 1.0 : -1.0; });
             break;
         }
 
         case SignalType::Sawtooth: {
-            U64 idx = 0;
-            Memory::CPU::AutomaticIterator([&](auto& out) {
-                const F64 t = (pimpl->sampleIndex + idx) * dt;
-                const F64 phase = std::fmod(config.frequency * t + config.phase / (2.0 * M_PI), 1.0);
-                const F64 iValue = config.amplitude * (2.0 * phase - 1.0) + config.dcOffset;
-
-                if constexpr (std::is_same_v<T, CF32>) {
-                    out = CF32(static_cast<F32>(iValue), 0.0f);
-                } else {
-                    out = static_cast<T>(iValue);
-                }
-                ++idx;
-            }, output.buffer);
+            periodic([](const F64& u) { return 2.0 * u - 1.0; });
             break;
         }
 
         case SignalType::Triangle: {
-            U64 idx = 0;
-            Memory::CPU::AutomaticIterator([&](auto& out) {
-                const F64 t = (pimpl->sampleIndex + idx) * dt;
-                const F64 phase = std::fmod(config.frequency * t + config.phase / (2.0 * M_PI), 1.0);
-                const F64 iValue = config.amplitude * ((phase < 0.5) ? (4.0 * phase - 1.0) : (3.0 - 4.0 * phase)) + config.dcOffset;
-
-                if constexpr (std::is_same_v<T, CF32>) {
-                    out = CF32(static_cast<F32>(iValue), 0.0f);
-                } else {
-                    out = static_cast<T>(iValue);
-                }
-                ++idx;
-            }, output.buffer);
+            periodic([](const F64& u) { return (u < 0.5) ? (4.0 * u - 1.0) : (3.0 - 4.0 * u); });
             break;
         }
 
         case SignalType::Noise: {
-            Memory::CPU::AutomaticIterator([&](auto& out) {
-                const F64 iValue = config.amplitude * pimpl->normalDist(pimpl->rng) + config.dcOffset;
-
-                if constexpr (std::is_same_v<T, CF32>) {
-                    const F64 qValue = config.amplitude * pimpl->normalDist(pimpl->rng);
-                    out = CF32(static_cast<F32>(iValue), static_cast<F32>(qValue));
-                } else {
-                    out = static_cast<T>(iValue);
+            // Samples are hashed from their absolute index, so ranges don't
+            // share a generator. The seed moves every 2^32 samples like on GPUs.
+            const U32 seed = pimpl->seed + static_cast<U32>(pimpl->sampleIndex >> 32) * 0x9E3779B9u;
+            const U32 counter = static_cast<U32>(pimpl->sampleIndex);
+            const F32 sigma = static_cast<F32>(config.amplitude * std::sqrt(config.noiseVariance));
+            const F32 dcOffset = static_cast<F32>(config.dcOffset);
+
+            Memory::CPU::ParallelRanges(ctx.cpu->pool(), bufferSize, chunks, [&](const U64& begin, const U64& end) {
+                F32* out = reinterpret_cast<F32*>(samples + begin);
+                const U64 size = end - begin;
+
+                pimpl->noise(out, size, width, seed, counter + static_cast<U32>(begin), sigma);
+
+                if (dcOffset != 0.0f) {
+                    for (U64 i = 0; i < size; i++) {
+                        out[i * width] += dcOffset;
+                    }
                 }
-            }, output.buffer);
+            });
             break;
         }
 
@@ -179,8 +172,9 @@ Result SignalGenerator<D, T>::compute(const Context&) {
         }
     }
 
-    // Update sample index
+    // Update sample index and oscillator phase
     pimpl->sampleIndex += bufferSize;
+    pimpl->cycle = SignalGeneratorAdvanceCycle(pimpl->cycle, config.frequency, config.sampleRate, bufferSize);
 
     return Result::SUCCESS;
 }
@@ -0,0 +1,238 @@
+#include "../generic.cc"
+
+#include <random>
+
+namespace Jetstream {
+
+template<Device D, typename T>
+struct SignalGenerator<D, T>::Impl {
+    // Kernel parameters, refreshed before every buffer. Mirrors the struct
+    // declared in the kernel source.
+    struct Params {
+        F64 chirpTime;
+        F64 chirpDuration;
+        F64 chirpStartFreq;
+        F64 chirpRate;
+        F64 timeStep;
+        F64 phase;
+        U64 size;
+        U32 type;
+        U32 start;
+        U32 step;
+        U32 seed;
+        U32 counter;
+        F32 amplitude;
+        F32 dcOffset;
+        F32 sigma;
+    };
+
+    Params params;
+
+    std::vector<U64> grid;
+    std::vector<U64> block;
+
+    std::vector<void*> arguments;
+
+    U64 sampleIndex = 0;
+    F64 cycle = 0.0;
+    U32 seed = 0;
+};
+
+template<Device D, typename T>
+SignalGenerator<D, T>::SignalGenerator() {
+    pimpl = std::make_unique<Impl>();
+}
+
+template<Device D, typename T>
+SignalGenerator<D, T>::~SignalGenerator() {
+    pimpl.reset();
+}
+
+template<Device D, typename T>
+Result SignalGenerator<D, T>::createCompute(const Context& ctx) {
+    JST_TRACE("Create SignalGenerator compute core using CUDA backend.");
+
+    // Create CUDA kernel.
+    //
+    // Every thread computes one sample. Periodic waveforms read a 32-bit
+    // phase accumulator, so the phase of a sample is exact integer arithmetic
+    // and half a turn is a single bit. Noise is drawn from a counter-based
+    // hash, so samples don't share any generator state.
+
+    std::string header;
+    header += "#define SINE " + std::to_string(static_cast<U32>(SignalType::Sine)) + "\n";
+    header += "#define COSINE " + std::to_string(static_cast<U32>(SignalType::Cosine)) + "\n";
+    header += "#define SQUARE " + std::to_string(static_cast<U32>(SignalType::Square)) + "\n";
+    header += "#define SAWTOOTH " + std::to_string(static_cast<U32>(SignalType::Sawtooth)) + "\n";
+    header += "#define TRIANGLE " + std::to_string(static_cast<U32>(SignalType::Triangle)) + "\n";
+    header += "#define NOISE " + std::to_string(static_cast<U32>(SignalType::Noise)) + "\n";
+    header += "#define DC " + std::to_string(static_cast<U32>(SignalType::DC)) + "\n";
+    header += "#define CHIRP " + std::to_string(static_cast<U32>(SignalType::Chirp)) + "\n";
+
+    if constexpr (std::is_same_v<T, CF32>) {
+        header += R"""(
+            typedef float2 sample_t;
+
+            __device__ inline sample_t store(const float2& x) {
+                return x;
+            }
+        )""";
+    } else {
+        header += R"""(
+            typedef float sample_t;
+
+            __device__ inline sample_t store(const float2& x) {
+                return x.x;
+            }
+        )""";
+    }
+
+    ctx.cuda->createKernel("signal_generator", header + R"""(
+        struct Params {
+            double chirpTime;
+            double chirpDuration;
+            double chirpStartFreq;
+            double chirpRate;
+            double timeStep;
+            double phase;
+            size_t size;
+            unsigned int type;
+            unsigned int start;
+            unsigned int step;
+            unsigned int seed;
+            unsigned int counter;
+            float amplitude;
+            float dcOffset;
+            float sigma;
+        };
+
+        __device__ inline unsigned int hash(unsigned int x) {
+            x ^= x >> 16;
+            x *= 0x7feb352du;
+            x ^= x >> 15;
+            x *= 0x846ca68bu;
+            x ^= x >> 16;
+            return x;
+        }
+
+        __global__ void signal_generator(sample_t* output, Params params) {
+            const size_t id = blockIdx.x * blockDim.x + threadIdx.x;
+            if (id >= params.size) {
+                return;
+            }
+
+            const unsigned int accumulator = params.start + (unsigned int)id * params.step;
+            const float cycle = (float)accumulator * 2.3283064365386963e-10f;
+
+            float2 value = make_float2(0.0f, 0.0f);
+
+            switch (params.type) {
+                case SINE:
+                    value.x = params.amplitude * sinpif(2.0f * cycle);
+                    break;
+                case COSINE:
+                    sincospif(2.0f * cycle, &value.y, &value.x);
+                    value.x *= params.amplitude;
+                    value.y *= params.amplitude;
+                    break;
+                case SQUARE:
+                    value.x = (accumulator & 0x80000000u) ? -params.amplitude : params.amplitude;
+                    break;
+                case SAWTOOTH:
+                    value.x = params.amplitude * (2.0f * cycle - 1.0f);
+                    break;
+                case TRIANGLE:
+                    value.x = params.amplitude * ((cycle < 0.5f) ? (4.0f * cycle - 1.0f) : (3.0f - 4.0f * cycle));
+                    break;
+                case NOISE: {
+                    const unsigned int key = hash(params.seed ^ hash(params.counter + (unsigned int)id));
+                    const float u1 = (float)((hash(key) >> 8) + 1) * 5.9604644775390625e-8f;
+                    const float u2 = (float)(hash(key + 1) >> 8) * 5.9604644775390625e-8f;
+                    const float r = params.sigma * sqrtf(-2.0f * logf(u1));
+                    sincospif(2.0f * u2, &value.y, &value.x);
+                    value.x *= r;
+                    value.y *= r;
+                    break;
+                }
+                case DC:
+                    value.x = params.amplitude;
+                    break;
+                case CHIRP: {
+                    // Quadratic phase needs double precision over long sweeps.
+                    const double t = fmod(params.chirpTime + (double)id * params.timeStep, params.chirpDuration);
+                    const double turns = params.chirpStartFreq * t + 0.5 * params.chirpRate * t * t;
+                    const double phase = 2.0 * (turns - floor(turns)) + params.phase / 3.141592653589793;
+                    sincospif((float)phase, &value.y, &value.x);
+                    value.x *= params.amplitude;
+                    value.y *= params.amplitude;
+                    break;
+                }
+            }
+
+            value.x += params.dcOffset;
+            output[id] = store(value);
+        }
+    )""");
+
+    // Reset state.
+
+    pimpl->sampleIndex = 0;
+    pimpl->cycle = 0.0;
+    pimpl->seed = std::random_device{}();
+
+    // Initialize kernel size.
+
+    U64 threadsPerBlock = 512;
+    U64 blocksPerGrid = (config.bufferSize + threadsPerBlock - 1) / threadsPerBlock;
+
+    pimpl->grid = { blocksPerGrid, 1, 1 };
+    pimpl->block = { threadsPerBlock, 1, 1 };
+
+    // Initialize kernel arguments.
+
+    pimpl->arguments = {
+        output.buffer.data_ptr(),
+        &pimpl->params,
+    };
+
+    return Result::SUCCESS;
+}
+
+template<Device D, typename T>
+Result SignalGenerator<D, T>::compute(const Context& ctx) {
+    const F64 dt = 1.0 / config.sampleRate;
+    const F64 start = SignalGeneratorWrapCycle(pimpl->cycle + config.phase / (2.0 * M_PI));
+    const F64 step = SignalGeneratorWrapCycle(config.frequency * dt);
+
+    auto& params = pimpl->params;
+    params.chirpTime = std::fmod(static_cast<F64>(pimpl->sampleIndex) * dt, config.chirpDuration);
+    params.chirpDuration = config.chirpDuration;
+    params.chirpStartFreq = config.chirpStartFreq;
+    params.chirpRate = (config.chirpEndFreq - config.chirpStartFreq) / config.chirpDuration;
+    params.timeStep = dt;
+    params.phase = config.phase;
+    params.size = config.bufferSize;
+    params.type = static_cast<U32>(config.signalType);
+    params.start = static_cast<U32>(static_cast<U64>(std::llround(start * 4294967296.0)));
+    params.step = static_cast<U32>(static_cast<U64>(std::llround(step * 4294967296.0)));
+    params.seed = pimpl->seed + static_cast<U32>(pimpl->sampleIndex >> 32) * 0x9E3779B9u;
+    params.counter = static_cast<U32>(pimpl->sampleIndex);
+    params.amplitude = static_cast<F32>(config.amplitude);
+    params.dcOffset = static_cast<F32>(config.dcOffset);
+    params.sigma = static_cast<F32>(config.amplitude * std::sqrt(config.noiseVariance));
+
+    JST_CHECK(ctx.cuda->launchKernel("signal_generator",
+                                     pimpl->grid,
+                                     pimpl->block,
+                                     pimpl->arguments.data()));
+
+    pimpl->sampleIndex += config.bufferSize;
+    pimpl->cycle = SignalGeneratorAdvanceCycle(pimpl->cycle, config.frequency, config.sampleRate, config.bufferSize);
+
+    return Result::SUCCESS;
+}
+
+JST_SIGNAL_GENERATOR_CUDA(JST_INSTANTIATION)
+JST_SIGNAL_GENERATOR_CUDA(JST_BENCHMARK)
+
+}  // namespace Jetstream
@@ -1,10 +1,29 @@
 #include "jetstream/modules/signal_generator.hh"
 #include "jetstream/render/macros.hh"
 
+#include <cmath>
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
 #include "benchmark.cc"
 
 namespace Jetstream {
 
+// Wraps a phase in cycles to [0, 1).
+inline F64 SignalGeneratorWrapCycle(const F64& cycle) {
+    return cycle - std::floor(cycle);
+}
+
+// Oscillator phase in cycles at the start of the buffer following one with
+// the given size. Carried across buffers by every backend, so the waveform
+// stays continuous and frequency changes don't produce phase jumps.
+inline F64 SignalGeneratorAdvanceCycle(const F64& cycle, const F64& frequency,
+                                       const F64& sampleRate, const U64& size) {
+    return SignalGeneratorWrapCycle(cycle + (frequency / sampleRate) * static_cast<F64>(size));
+}
+
 template<Device D, typename T>
 Result SignalGenerator<D, T>::create() {
     JST_DEBUG("Initializing SignalGenerator module.");
@@ -0,0 +1,208 @@
+#include "../generic.cc"
+
+#include <random>
+
+namespace Jetstream {
+
+static const char shadersSrc[] = R"""(
+    #include <metal_stdlib>
+    #include <metal_math>
+
+    using namespace metal;
+
+    struct Constants {
+        uint size;
+        uint type;
+        uint start;
+        uint step;
+        uint seed;
+        uint counter;
+        float amplitude;
+        float dcOffset;
+        float sigma;
+        float phase;
+        float chirpTime;
+        float chirpDuration;
+        float chirpStartFreq;
+        float chirpRate;
+        float timeStep;
+    };
+
+    inline uint hash(uint x) {
+        x ^= x >> 16;
+        x *= 0x7feb352du;
+        x ^= x >> 15;
+        x *= 0x846ca68bu;
+        x ^= x >> 16;
+        return x;
+    }
+
+    inline float2 generate(constant Constants& constants, uint id) {
+        const uint accumulator = constants.start + id * constants.step;
+        const float cycle = float(accumulator) * 2.3283064365386963e-10f;
+        const float amplitude = constants.amplitude;
+
+        switch (constants.type) {
+            case SINE:
+                return float2(amplitude * sinpi(2.0f * cycle), 0.0f);
+            case COSINE:
+                return amplitude * float2(cospi(2.0f * cycle), sinpi(2.0f * cycle));
+            case SQUARE:
+                return float2((accumulator & 0x80000000u) ? -amplitude : amplitude, 0.0f);
+            case SAWTOOTH:
+                return float2(amplitude * (2.0f * cycle - 1.0f), 0.0f);
+            case TRIANGLE:
+                return float2(amplitude * ((cycle < 0.5f) ? (4.0f * cycle - 1.0f) : (3.0f - 4.0f * cycle)), 0.0f);
+            case NOISE: {
+                const uint key = hash(constants.seed ^ hash(constants.counter + id));
+                const float u1 = float((hash(key) >> 8) + 1) * 5.9604644775390625e-8f;
+                const float u2 = float(hash(key + 1) >> 8) * 5.9604644775390625e-8f;
+                const float r = constants.sigma * sqrt(-2.0f * log(u1));
+                return r * float2(cospi(2.0f * u2), sinpi(2.0f * u2));
+            }
+            case DC:
+                return float2(amplitude, 0.0f);
+            case CHIRP: {
+                const float t = fmod(constants.chirpTime + float(id) * constants.timeStep, constants.chirpDuration);
+                const float turns = fract(constants.chirpStartFreq * t + 0.5f * constants.chirpRate * t * t);
+                const float phase = 2.0f * turns + constants.phase;
+                return amplitude * float2(cospi(phase), sinpi(phase));
+            }
+        }
+
+        return float2(0.0f);
+    }
+
+    kernel void signal_generator_complex(constant Constants& constants [[ buffer(0) ]],
+                                         device float2 *output [[ buffer(1) ]],
+                                         uint id[[ thread_position_in_grid ]]) {
+        if (id < constants.size) {
+            output[id] = generate(constants, id) + float2(constants.dcOffset, 0.0f);
+        }
+    }
+
+    kernel void signal_generator_real(constant Constants& constants [[ buffer(0) ]],
+                                      device float *output [[ buffer(1) ]],
+                                      uint id[[ thread_position_in_grid ]]) {
+        if (id < constants.size) {
+            output[id] = generate(constants, id).x + constants.dcOffset;
+        }
+    }
+)""";
+
+template<Device D, typename T>
+struct SignalGenerator<D, T>::Impl {
+    // Refreshed before every buffer. The phase is in half turns.
+    struct Constants {
+        U32 size;
+        U32 type;
+        U32 start;
+        U32 step;
+        U32 seed;
+        U32 counter;
+        F32 amplitude;
+        F32 dcOffset;
+        F32 sigma;
+        F32 phase;
+        F32 chirpTime;
+        F32 chirpDuration;
+        F32 chirpStartFreq;
+        F32 chirpRate;
+        F32 timeStep;
+    };
+
+    MTL::ComputePipelineState* state;
+    Tensor<Device::Metal, U8> constants;
+
+    U64 sampleIndex = 0;
+    F64 cycle = 0.0;
+    U32 seed = 0;
+};
+
+template<Device D, typename T>
+SignalGenerator<D, T>::SignalGenerator() {
+    pimpl = std::make_unique<Impl>();
+}
+
+template<Device D, typename T>
+SignalGenerator<D, T>::~SignalGenerator() {
+    pimpl.reset();
+}
+
+template<Device D, typename T>
+Result SignalGenerator<D, T>::createCompute(const Context&) {
+    JST_TRACE("Create SignalGenerator compute core using Metal backend.");
+
+    // Every thread computes one sample from a 32-bit phase accumulator, the
+    // same as the CUDA kernel. Metal has no double precision, so long chirps
+    // lose some phase resolution.
+
+    std::string source;
+    source += "#define SINE " + std::to_string(static_cast<U32>(SignalType::Sine)) + "\n";
+    source += "#define COSINE " + std::to_string(static_cast<U32>(SignalType::Cosine)) + "\n";
+    source += "#define SQUARE " + std::to_string(static_cast<U32>(SignalType::Square)) + "\n";
+    source += "#define SAWTOOTH " + std::to_string(static_cast<U32>(SignalType::Sawtooth)) + "\n";
+    source += "#define TRIANGLE " + std::to_string(static_cast<U32>(SignalType::Triangle)) + "\n";
+    source += "#define NOISE " + std::to_string(static_cast<U32>(SignalType::Noise)) + "\n";
+    source += "#define DC " + std::to_string(static_cast<U32>(SignalType::DC)) + "\n";
+    source += "#define CHIRP " + std::to_string(static_cast<U32>(SignalType::Chirp)) + "\n";
+    source += shadersSrc;
+
+    if constexpr (std::is_same_v<T, CF32>) {
+        JST_CHECK(Metal::CompileKernel(source.c_str(), "signal_generator_complex", &pimpl->state));
+    } else {
+        JST_CHECK(Metal::CompileKernel(source.c_str(), "signal_generator_real", &pimpl->state));
+    }
+
+    Metal::CreateConstants<typename Impl::Constants>(*pimpl);
+
+    // Reset state.
+
+    pimpl->sampleIndex = 0;
+    pimpl->cycle = 0.0;
+    pimpl->seed = std::random_device{}();
+
+    return Result::SUCCESS;
+}
+
+template<Device D, typename T>
+Result SignalGenerator<D, T>::compute(const Context& ctx) {
+    const F64 dt = 1.0 / config.sampleRate;
+    const F64 start = SignalGeneratorWrapCycle(pimpl->cycle + config.phase / (2.0 * M_PI));
+    const F64 step = SignalGeneratorWrapCycle(config.frequency * dt);
+
+    auto* constants = Metal::Constants<typename Impl::Constants>(*pimpl);
+    constants->size = static_cast<U32>(config.bufferSize);
+    constants->type = static_cast<U32>(config.signalType);
+    constants->start = static_cast<U32>(static_cast<U64>(std::llround(start * 4294967296.0)));
+    constants->step = static_cast<U32>(static_cast<U64>(std::llround(step * 4294967296.0)));
+    constants->seed = pimpl->seed + static_cast<U32>(pimpl->sampleIndex >> 32) * 0x9E3779B9u;
+    constants->counter = static_cast<U32>(pimpl->sampleIndex);
+    constants->amplitude = static_cast<F32>(config.amplitude);
+    constants->dcOffset = static_cast<F32>(config.dcOffset);
+    constants->sigma = static_cast<F32>(config.amplitude * std::sqrt(config.noiseVariance));
+    constants->phase = static_cast<F32>(config.phase / M_PI);
+    constants->chirpTime = static_cast<F32>(std::fmod(static_cast<F64>(pimpl->sampleIndex) * dt, config.chirpDuration));
+    constants->chirpDuration = static_cast<F32>(config.chirpDuration);
+    constants->chirpStartFreq = static_cast<F32>(config.chirpStartFreq);
+    constants->chirpRate = static_cast<F32>((config.chirpEndFreq - config.chirpStartFreq) / config.chirpDuration);
+    constants->timeStep = static_cast<F32>(dt);
+
+    auto cmdEncoder = ctx.metal->commandBuffer()->computeCommandEncoder();
+    cmdEncoder->setComputePipelineState(pimpl->state);
+    cmdEncoder->setBuffer(pimpl->constants.data(), 0, 0);
+    cmdEncoder->setBuffer(output.buffer.data(), 0, 1);
+    cmdEncoder->dispatchThreads(MTL::Size(output.buffer.size(), 1, 1),
+                                MTL::Size(pimpl->state->maxTotalThreadsPerThreadgroup(), 1, 1));
+    cmdEncoder->endEncoding();
+
+    pimpl->sampleIndex += config.bufferSize;
+    pimpl->cycle = SignalGeneratorAdvanceCycle(pimpl->cycle, config.frequency, config.sampleRate, config.bufferSize);
+
+    return Result::SUCCESS;
+}
+
+JST_SIGNAL_GENERATOR_METAL(JST_INSTANTIATION)
+JST_SIGNAL_GENERATOR_METAL(JST_BENCHMARK)
+
+}  // namespace Jetstream
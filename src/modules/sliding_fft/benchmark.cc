@@ -0,0 +1,22 @@
+#include "jetstream/modules/sliding_fft.hh"
+
+namespace Jetstream {
+
+template<template<Device, typename...> class Module, Device D, typename T>
+void benchmark(ankerl::nanobench::Bench& bench, std::string name) {
+    JST_BENCHMARK_RUN("1024 (hop 4)", {
+        .size = 1024 COMMA
+        .hop = 4 COMMA
+    }, {
+        .buffer = Tensor<D COMMA T>({8192}) COMMA
+    }, T);
+
+    JST_BENCHMARK_RUN("1024 (hop 64)", {
+        .size = 1024 COMMA
+        .hop = 64 COMMA
+    }, {
+        .buffer = Tensor<D COMMA T>({8192}) COMMA
+    }, T);
+}
+
+}  // namespace Jetstream
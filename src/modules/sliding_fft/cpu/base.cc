@@ -0,0 +1,158 @@
+#include "../generic.cc"
+
+#include "jetstream/backend/devices/cpu/simd.hh"
+
+// Same configuration as the FFT module, a single window is transformed at a time.
+#define POCKETFFT_NO_MULTITHREADING
+#include "../../fft/cpu/pocketfft.hh"
+
+namespace Jetstream {
+
+template<Device D, typename T>
+struct SlidingFFT<D, T>::Impl {
+    U64 spectra = 0;
+    bool sliding = false;
+
+    // Last window of samples. The oldest is at the head.
+    std::vector<CF32> ring;
+    U64 head = 0;
+
+    // Spectrum of the last window and the twiddles sliding it by one sample.
+    std::vector<CF32> state;
+    std::vector<CF32> twiddles;
+    U64 sinceSync = 0;
+
+    std::shared_ptr<pocketfft::detail::pocketfft_c<F32>> plan;
+
+    void transform();
+    void emit(CF32* out, const bool& window, const bool& center) const;
+};
+
+template<Device D, typename T>
+SlidingFFT<D, T>::SlidingFFT() {
+    impl = std::make_unique<Impl>();
+}
+
+template<Device D, typename T>
+SlidingFFT<D, T>::~SlidingFFT() {
+    impl.reset();
+}
+
+template<Device D, typename T>
+void SlidingFFT<D, T>::Impl::transform() {
+    const U64 size = ring.size();
+
+    std::copy(ring.begin() + head, ring.end(), state.begin());
+    std::copy(ring.begin(), ring.begin() + head, state.begin() + (size - head));
+    plan->exec(reinterpret_cast<pocketfft::detail::cmplx<F32>*>(state.data()), 1.0f, true);
+
+    sinceSync = 0;
+}
+
+template<Device D, typename T>
+void SlidingFFT<D, T>::Impl::emit(CF32* out, const bool& window, const bool& center) const {
+    const U64 size = state.size();
+    const U64 shift = center ? size / 2 : 0;
+
+    for (U64 k = 0; k < size; k++) {
+        CF32 value = state[k];
+
+        // A Hann window is a three tap convolution of the spectrum.
+
+        if (window) {
+            const CF32& previous = state[(k + size - 1) % size];
+            const CF32& next = state[(k + 1) % size];
+            value = 0.5f * value - 0.25f * (previous + next);
+        }
+
+        out[(k + shift) % size] = value;
+    }
+}
+
+template<Device D, typename T>
+Result SlidingFFT<D, T>::createCompute(const Context&) {
+    JST_TRACE("Create Sliding FFT compute core using CPU backend.");
+
+    const U64 size = config.size;
+
+    impl->ring.assign(size, CF32(0.0f, 0.0f));
+    impl->state.assign(size, CF32(0.0f, 0.0f));
+    impl->head = 0;
+    impl->sinceSync = 0;
+
+    impl->twiddles.resize(size);
+    for (U64 k = 0; k < size; k++) {
+        const F64 angle = 2.0 * JST_PI * static_cast<F64>(k) / static_cast<F64>(size);
+        impl->twiddles[k] = CF32(std::cos(angle), std::sin(angle));
+    }
+
+    impl->plan = pocketfft::detail::get_plan<pocketfft::detail::pocketfft_c<F32>>(size);
+
+    JST_TRACE("[SLIDING_FFT] Spectra: {}; Kernel: {};", impl->spectra, Backend::ComplexSlide().name());
+
+    return Result::SUCCESS;
+}
+
+template<Device D, typename T>
+Result SlidingFFT<D, T>::destroyCompute(const Context&) {
+    JST_TRACE("Destroy Sliding FFT compute core using CPU backend.");
+
+    impl->plan.reset();
+    impl->ring.clear();
+    impl->state.clear();
+    impl->twiddles.clear();
+
+    return Result::SUCCESS;
+}
+
+template<Device D, typename T>
+Result SlidingFFT<D, T>::compute(const Context&) {
+    const U64 size = config.size;
+    const U64 hop = config.hop;
+
+    const T* in = input.buffer.data() + input.buffer.offset();
+    T* out = output.buffer.data();
+
+    const auto slide = Backend::ComplexSlide().kernel();
+
+    for (U64 s = 0; s < impl->spectra; s++) {
+        const T* samples = in + s * hop;
+
+        if (impl->sliding) {
+            // Every sample replaces the oldest one of the window, the
+            // spectrum follows with one multiply per bin. Rounding errors
+            // accumulate, so the spectrum is transformed again once per
+            // window.
+
+            for (U64 i = 0; i < hop; i++) {
+                const CF32 delta = samples[i] - impl->ring[impl->head];
+                impl->ring[impl->head] = samples[i];
+                impl->head = (impl->head + 1) % size;
+
+                slide(impl->state.data(), impl->twiddles.data(), delta, size);
+            }
+
+            impl->sinceSync += hop;
+
+            if (impl->sinceSync >= size) {
+                impl->transform();
+            }
+        } else {
+            for (U64 i = 0; i < hop; i++) {
+                impl->ring[impl->head] = samples[i];
+                impl->head = (impl->head + 1) % size;
+            }
+
+            impl->transform();
+        }
+
+        impl->emit(out + s * size, config.window, config.center);
+    }
+
+    return Result::SUCCESS;
+}
+
+JST_SLIDING_FFT_CPU(JST_INSTANTIATION)
+JST_SLIDING_FFT_CPU(JST_BENCHMARK)
+
+}  // namespace Jetstream
@@ -0,0 +1,57 @@
+#include "jetstream/modules/sliding_fft.hh"
+
+#include "benchmark.cc"
+
+namespace Jetstream {
+
+template<Device D, typename T>
+Result SlidingFFT<D, T>::create() {
+    JST_DEBUG("Initializing Sliding FFT module.");
+    JST_INIT_IO();
+
+    // Check parameters.
+
+    if (config.size < 2) {
+        JST_ERROR("Size ({}) should be at least 2.", config.size);
+        return Result::ERROR;
+    }
+
+    if (config.hop == 0) {
+        JST_ERROR("Hop should be positive.");
+        return Result::ERROR;
+    }
+
+    if ((input.buffer.size() % config.hop) != 0) {
+        JST_ERROR("Input size ({}) should be a multiple of the hop ({}).", input.buffer.size(), config.hop);
+        return Result::ERROR;
+    }
+
+    // Calculate parameters.
+    //
+    // Sliding a spectrum by one sample costs about one complex multiply per
+    // bin, a transform about the log of the size. Hops shorter than that are
+    // cheaper to slide, longer ones are transformed from the last window.
+
+    impl->spectra = input.buffer.size() / config.hop;
+    impl->sliding = config.hop < static_cast<U64>(std::log2(config.size));
+
+    // Allocate output.
+    //
+    // One spectrum per hop, each of the window ending at the last sample of
+    // that hop.
+
+    output.buffer = Tensor<D, T>({impl->spectra, config.size});
+
+    return Result::SUCCESS;
+}
+
+template<Device D, typename T>
+void SlidingFFT<D, T>::info() const {
+    JST_DEBUG("  Size:   {}", config.size);
+    JST_DEBUG("  Hop:    {}", config.hop);
+    JST_DEBUG("  Window: {}", config.window ? "Hann" : "None");
+    JST_DEBUG("  Center: {}", config.center ? "YES" : "NO");
+    JST_DEBUG("  Update: {}", impl->sliding ? "Sliding" : "Transform");
+}
+
+}  // namespace Jetstream
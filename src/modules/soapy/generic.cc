@@ -1,4 +1,13 @@
 #include "jetstream/modules/soapy.hh"
+#include "jetstream/compute/thread.hh"
+#include "jetstream/compute/tracer.hh"
+
+#include <cmath>
+#include <deque>
+#include <mutex>
+#include <atomic>
+#include <chrono>
+#include <numeric>
 
 #include <SoapySDR/Device.hpp>
 #include <SoapySDR/Types.hpp>
@@ -19,6 +28,9 @@ struct Soapy<D, T>::Impl {
 
     SoapySDR::Device* soapyDevice;
     SoapySDR::Stream* soapyStream;
+    // Direct access buffers are in the native format of the driver, so
+    // they're only read when it matches the stream format.
+    bool nativeStreamFormat = false;
 
     std::thread producer;
     bool errored = false;
@@ -26,17 +38,76 @@ struct Soapy<D, T>::Impl {
     std::string deviceLabel;
     std::string deviceName;
     std::string deviceHardwareKey;
-    Memory::CircularBuffer<T> buffer;
     Tensor<Device::CPU, T> hostOutputBuffer;
 
+    // One ring per channel. Every read writes the same number of samples to
+    // each ring, so frames stay aligned across channels.
+    U64 channels = 1;
+    std::vector<std::unique_ptr<Memory::CircularBuffer<T>>> buffers;
+
+    U64 getOccupancy() const;
+
+    // Depth of the rings in frames. The rings are allocated for the deepest
+    // one and the consumer keeps the occupancy within the current depth, so
+    // adapting never reallocates under the producer thread.
+    U64 frameSize = 0;
+    U64 minDepth = 0;
+    U64 maxDepth = 0;
+    std::atomic<U64> depth = 0;
+
+    // Overflow history of the adaptive depth. It doubles on pressure and
+    // steps down after a quiet period with a shallow peak occupancy.
+    static constexpr std::chrono::seconds QuietPeriod{10};
+    static constexpr std::chrono::seconds ShrinkInterval{2};
+    U64 lastOverflows = 0;
+    U64 peakOccupancy = 0;
+    std::chrono::steady_clock::time_point lastPressure;
+    std::chrono::steady_clock::time_point windowStart;
+
+    void adapt();
+
+    // Stream state at the ring position of every read, oldest first. A read
+    // dropped by an overflow is replaced by the next one at the same position.
+    struct Stamp {
+        U64 position;
+        I64 timeNs;
+        F32 frequency;
+        F32 sampleRate;
+    };
+
+    std::mutex stampMutex;
+    std::deque<Stamp> stamps;
+    std::atomic<F32> frequency;
+    std::atomic<F32> sampleRate;
+
+    // Samples dropped before the current read position.
+    U64 droppedSamples = 0;
+    std::vector<typename Memory::CircularBuffer<T>::Gap> pendingGaps;
+
+    void stamp(const U64& position, const int& flags, const long long& timeNs);
+    void tag(Tensor<D, T>& frame);
+
     Result soapyThreadLoop();
 
     static bool CheckValidRange(const std::vector<SoapySDR::Range>& ranges, const F32& val);
+
+    // Stream format matching the output type. Integer streams are passed to
+    // the graph as they come from the driver.
+    static constexpr const char* StreamFormat() {
+        if constexpr (std::is_same_v<T, CI16>) {
+            return SOAPY_SDR_CS16;
+        } else if constexpr (std::is_same_v<T, CI8>) {
+            return SOAPY_SDR_CS8;
+        } else {
+            return SOAPY_SDR_CF32;
+        }
+    }
 };
 
 template<Device D, typename T>
 Soapy<D, T>::Soapy() {
     impl = std::make_unique<Impl>();
+    impl->buffers.push_back(std::make_unique<Memory::CircularBuffer<T>>());
 }
 
 template<Device D, typename T>
@@ -50,7 +121,13 @@ Result Soapy<D, T>::create() {
     JST_INIT_IO();
 
     impl->errored = false;
+    impl->nativeStreamFormat = false;
     impl->streaming = false;
+    impl->stamps.clear();
+    impl->droppedSamples = 0;
+    impl->pendingGaps.clear();
+    impl->frequency = config.frequency;
+    impl->sampleRate = config.sampleRate;
     impl->deviceName = "None";
     impl->deviceHardwareKey = "None";
 
@@ -118,11 +195,25 @@ Result Soapy<D, T>::create() {
         return Result::ERROR;
     }
 
+    const U64 availableChannels = impl->soapyDevice->getNumChannels(SOAPY_SDR_RX);
+    if (config.numberOfChannels == 0 || config.numberOfChannels > availableChannels) {
+        JST_ERROR("Number of channels requested ({}) is not supported by the device ({} available).",
+                  config.numberOfChannels, availableChannels);
+        SoapySDR::Device::unmake(impl->soapyDevice);
+        return Result::ERROR;
+    }
+    impl->channels = config.numberOfChannels;
+
+    std::vector<size_t> channelList(impl->channels);
+    std::iota(channelList.begin(), channelList.end(), 0);
+
     // Apply requested configuration.
 
     try {
         try {
-            impl->soapyDevice->setSampleRate(SOAPY_SDR_RX, 0, config.sampleRate);
+            for (const auto& channel : channelList) {
+                impl->soapyDevice->setSampleRate(SOAPY_SDR_RX, channel, config.sampleRate);
+            }
         } catch(const std::exception& e) {
             JST_ERROR("Failed to set sample rate ({}).", e.what());
             return Result::ERROR;
@@ -131,7 +222,9 @@ Result Soapy<D, T>::create() {
             return Result::ERROR;
         }
         try {
-            impl->soapyDevice->setFrequency(SOAPY_SDR_RX, 0, config.frequency);
+            for (const auto& channel : channelList) {
+                impl->soapyDevice->setFrequency(SOAPY_SDR_RX, channel, config.frequency);
+            }
         } catch(const std::exception& e) {
             JST_ERROR("Failed to set frequency ({}).", e.what());
             return Result::ERROR;
@@ -140,7 +233,9 @@ Result Soapy<D, T>::create() {
             return Result::ERROR;
         }
         try {
-            impl->soapyDevice->setGainMode(SOAPY_SDR_RX, 0, config.automaticGain);
+            for (const auto& channel : channelList) {
+                impl->soapyDevice->setGainMode(SOAPY_SDR_RX, channel, config.automaticGain);
+            }
         } catch(const std::exception& e) {
             JST_ERROR("Failed to set gain mode ({}).", e.what());
             return Result::ERROR;
@@ -149,7 +244,12 @@ Result Soapy<D, T>::create() {
             return Result::ERROR;
         }
 
-        impl->soapyStream = impl->soapyDevice->setupStream(SOAPY_SDR_RX, SOAPY_SDR_CF32, {0}, streamArgs);
+        double fullScale = 0.0;
+        const auto nativeFormat = impl->soapyDevice->getNativeStreamFormat(SOAPY_SDR_RX, 0, fullScale);
+        JST_DEBUG("[SOAPY] Native stream format: {}; Requested: {};", nativeFormat, Impl::StreamFormat());
+        impl->nativeStreamFormat = (nativeFormat == Impl::StreamFormat());
+
+        impl->soapyStream = impl->soapyDevice->setupStream(SOAPY_SDR_RX, Impl::StreamFormat(), channelList, streamArgs);
         if (impl->soapyStream == nullptr) {
             JST_ERROR("Failed to setup SoapySDR stream.");
             SoapySDR::Device::unmake(impl->soapyDevice);
@@ -178,18 +278,55 @@ Result Soapy<D, T>::create() {
     // Calculate shape.
 
     std::vector<U64> outputShape = { config.numberOfBatches, config.numberOfTimeSamples };
+    if (impl->channels > 1) {
+        outputShape.insert(outputShape.begin(), impl->channels);
+    }
 
     // Allocate output.
 
     output.buffer = Tensor<D, T>(outputShape);
 
-    // Allocate circular buffer.
+    // Size buffer depth.
 
-    impl->buffer.resize(output.buffer.size() * config.bufferMultiplier);
+    impl->frameSize = config.numberOfBatches * config.numberOfTimeSamples;
+    impl->maxDepth = std::max<U64>(config.bufferMultiplier, 1);
+    impl->minDepth = impl->maxDepth;
+
+    if (config.adaptiveBuffer) {
+        const F64 latencySamples = static_cast<F64>(config.maxLatencyMs) * 1e-3 * config.sampleRate;
+        impl->maxDepth = std::max(impl->maxDepth, static_cast<U64>(std::ceil(latencySamples / impl->frameSize)));
+        impl->minDepth = std::min<U64>(impl->maxDepth, 2);
+    }
+
+    impl->depth = std::clamp<U64>(config.bufferMultiplier, impl->minDepth, impl->maxDepth);
+    impl->lastOverflows = 0;
+    impl->peakOccupancy = 0;
+    impl->lastPressure = std::chrono::steady_clock::now();
+    impl->windowStart = impl->lastPressure;
+
+    // Allocate circular buffers.
+
+    impl->buffers.resize(impl->channels);
+    for (auto& buffer : impl->buffers) {
+        if (!buffer) {
+            buffer = std::make_unique<Memory::CircularBuffer<T>>();
+        }
+        buffer->resize(impl->frameSize * impl->maxDepth, Memory::CircularBuffer<T>::Mode::LockFree);
+    }
+
+    // Wake up the scheduler when new samples arrive. The last ring is
+    // written last, so every channel has the samples by then.
+
+    impl->buffers.back()->setPutCallback([&]{
+        notifyCompute();
+    });
 
     // Initialize thread for ingest.
 
     impl->producer = std::thread([&]{
+        ApplyThreadPolicy(ThreadRole::IO);
+        Tracer::SetThreadName("Soapy Producer");
+
         try {
             JST_CHECK_THROW(impl->soapyThreadLoop());
         } catch(...) {
@@ -209,6 +346,8 @@ Result Soapy<D, T>::destroy() {
         impl->producer.join();
     }
 
+    impl->buffers.back()->setPutCallback({});
+
     try {
         impl->soapyDevice->deactivateStream(impl->soapyStream, 0, 0);
         impl->soapyDevice->closeStream(impl->soapyStream);
@@ -231,18 +370,78 @@ Result Soapy<D, T>::destroy() {
 
 template<Device D, typename T>
 Result Soapy<D, T>::Impl::soapyThreadLoop() {
+    constexpr U64 ReadSize = 8192;
+
     int flags;
     long long timeNs;
-    CF32 tmp[8192];
-    void *tmp_buffers[] = { tmp };
 
-    // TODO: Replace with zero-copy Soapy API.
+    std::vector<T> scratch(channels * ReadSize);
+    std::vector<T*> windows(channels);
+    std::vector<void*> targets(channels);
+    std::vector<const void*> sources(channels);
+
+    // Drivers with direct buffer access hand out their own buffers, which are
+    // copied once into the ring. Otherwise the driver reads into the ring,
+    // converting from its native format when it differs from ours.
+
+    bool directAccess = false;
+    try {
+        directAccess = nativeStreamFormat && soapyDevice->getNumDirectAccessBuffers(soapyStream) > 0;
+    } catch(...) {
+        directAccess = false;
+    }
+
+    JST_TRACE("[SOAPY] Direct buffer access: {}.", directAccess ? "YES" : "NO");
+
     streaming = true;
     while (streaming) {
         try {
-            int ret = soapyDevice->readStream(soapyStream, tmp_buffers, 8192, flags, timeNs, 1e5);
+            if (directAccess) {
+                size_t handle;
+
+                JST_TRACE_SPAN("Soapy::acquireReadBuffer", "soapy");
+
+                int ret = soapyDevice->acquireReadBuffer(soapyStream, handle, sources.data(), flags, timeNs, 1e5);
+                if (ret > 0) {
+                    if (streaming && !errored) {
+                        stamp(buffers.front()->getWritePosition(), flags, timeNs);
+                        for (U64 c = 0; c < channels; c++) {
+                            buffers[c]->put(static_cast<const T*>(sources[c]), ret);
+                        }
+                    }
+                    soapyDevice->releaseReadBuffer(soapyStream, handle);
+                }
+
+                continue;
+            }
+
+            // Read straight into the rings. The scratch buffer is only used when a ring
+            // can't hand out a contiguous window, the put below handles the overflow.
+            // All channels take the same path so they stay aligned.
+            bool reserved = true;
+            for (U64 c = 0; c < channels; c++) {
+                windows[c] = buffers[c]->reserve(ReadSize);
+                reserved &= windows[c] != nullptr;
+            }
+
+            for (U64 c = 0; c < channels; c++) {
+                targets[c] = reserved ? windows[c] : scratch.data() + c * ReadSize;
+            }
+
+            const U64 position = buffers.front()->getWritePosition();
+
+            JST_TRACE_SPAN("Soapy::readStream", "soapy");
+
+            int ret = soapyDevice->readStream(soapyStream, targets.data(), ReadSize, flags, timeNs, 1e5);
             if (ret > 0 && streaming && !errored) {
-                buffer.put(tmp, ret);
+                stamp(position, flags, timeNs);
+                for (U64 c = 0; c < channels; c++) {
+                    if (reserved) {
+                        buffers[c]->commit(ret);
+                    } else {
+                        buffers[c]->put(scratch.data() + c * ReadSize, ret);
+                    }
+                }
             }
         } catch(const std::exception& e) {
             JST_ERROR("Failed to read stream ({}).", e.what());
@@ -268,6 +467,10 @@ void Soapy<D, T>::info() const {
     JST_DEBUG("  Automatic Gain:         {}", config.automaticGain ? "YES" : "NO");
     JST_DEBUG("  Number of Batches:      {}", config.numberOfBatches);
     JST_DEBUG("  Number of Time Samples: {}", config.numberOfTimeSamples);
+    JST_DEBUG("  Buffer Multiplier:      {}", config.bufferMultiplier);
+    if (config.adaptiveBuffer) {
+        JST_DEBUG("  Adaptive Buffer:        {}-{} frames (max {:.0f} ms)", impl->minDepth, impl->maxDepth, config.maxLatencyMs);
+    }
 }
 
 template<Device D, typename T>
@@ -279,13 +482,16 @@ Result Soapy<D, T>::setTunerFrequency(F32& frequency) {
     }
 
     config.frequency = frequency;
+    impl->frequency = frequency;
 
     if (!impl->streaming) {
         return Result::RELOAD;
     }
 
     try {
-        impl->soapyDevice->setFrequency(SOAPY_SDR_RX, 0, config.frequency);
+        for (U64 channel = 0; channel < impl->channels; channel++) {
+            impl->soapyDevice->setFrequency(SOAPY_SDR_RX, channel, config.frequency);
+        }
     } catch(const std::exception& e) {
         JST_ERROR("Failed to set frequency ({}).", e.what());
         return Result::ERROR;
@@ -306,13 +512,16 @@ Result Soapy<D, T>::setSampleRate(F32& sampleRate) {
     }
 
     config.sampleRate = sampleRate;
+    impl->sampleRate = sampleRate;
 
     if (!impl->streaming) {
         return Result::RELOAD;
     }
 
     try {
-        impl->soapyDevice->setSampleRate(SOAPY_SDR_RX, 0, config.sampleRate);
+        for (U64 channel = 0; channel < impl->channels; channel++) {
+            impl->soapyDevice->setSampleRate(SOAPY_SDR_RX, channel, config.sampleRate);
+        }
     } catch(const std::exception& e) {
         JST_ERROR("Failed to set sample rate ({}).", e.what());
         return Result::ERROR;
@@ -333,7 +542,9 @@ Result Soapy<D, T>::setAutomaticGain(bool& automaticGain) {
     }
 
     try {
-        impl->soapyDevice->setGainMode(SOAPY_SDR_RX, 0, config.automaticGain);
+        for (U64 channel = 0; channel < impl->channels; channel++) {
+            impl->soapyDevice->setGainMode(SOAPY_SDR_RX, channel, config.automaticGain);
+        }
     } catch(const std::exception& e) {
         JST_ERROR("Failed to set gain mode ({}).", e.what());
         return Result::ERROR;
@@ -353,8 +564,9 @@ Result Soapy<D, T>::createCompute(const Context&) {
 
 template<Device D, typename T>
 Result Soapy<D, T>::computeReady() {
-    if (impl->buffer.getOccupancy() < output.buffer.size()) {
-        return impl->buffer.waitBufferOccupancy(output.buffer.size());
+    // The buffer notifies the scheduler once it has enough samples.
+    if (!impl->errored && impl->getOccupancy() < output.buffer.size() / impl->channels) {
+        return Result::TIMEOUT;
     }
 
     return Result::SUCCESS;
@@ -366,11 +578,31 @@ Result Soapy<D, T>::compute(const Context&) {
         return Result::ERROR;
     }
 
-    if (impl->buffer.getOccupancy() < output.buffer.size()) {
+    const U64 frameSize = output.buffer.size() / impl->channels;
+
+    if (impl->getOccupancy() < frameSize) {
         return Result::YIELD;
     }
 
-    impl->buffer.get(output.buffer.data(), output.buffer.size());
+    if (config.adaptiveBuffer) {
+        impl->adapt();
+    }
+
+    impl->tag(output.buffer);
+
+    // Each channel fills its own row of the output.
+    for (U64 c = 0; c < impl->channels; c++) {
+        auto& buffer = *impl->buffers[c];
+        T* frame = output.buffer.data() + c * frameSize;
+
+        // Non-mirrored buffers can't peek across the wraparound.
+        if (const T* samples = buffer.peek(frameSize)) {
+            std::copy_n(samples, frameSize, frame);
+            buffer.consume(frameSize);
+        } else {
+            buffer.get(frame, frameSize);
+        }
+    }
 
     return Result::SUCCESS;
 }
@@ -401,6 +633,123 @@ typename Soapy<D, T>::DeviceList Soapy<D, T>::ListAvailableDevices(const std::st
     return deviceMap;
 }
 
+template<Device D, typename T>
+U64 Soapy<D, T>::Impl::getOccupancy() const {
+    U64 occupancy = buffers.front()->getOccupancy();
+    for (const auto& buffer : buffers) {
+        occupancy = std::min(occupancy, buffer->getOccupancy());
+    }
+    return occupancy;
+}
+
+template<Device D, typename T>
+void Soapy<D, T>::Impl::adapt() {
+    const auto now = std::chrono::steady_clock::now();
+    const U64 occupancy = getOccupancy();
+    const U64 overflows = buffers.front()->getOverflows();
+
+    // The producer filled the deepest ring, or the consumer fell behind the
+    // current depth. Either way a ring of the current depth would overflow.
+    const bool overflowed = overflows != lastOverflows;
+    lastOverflows = overflows;
+
+    if (overflowed || occupancy > depth * frameSize) {
+        depth = std::min(depth * 2, maxDepth);
+
+        // Past the bound, keep the newest samples. The skipped samples move
+        // the read position, so sample indices and stamps stay exact.
+        const U64 limit = depth * frameSize;
+        if (occupancy > limit) {
+            for (auto& buffer : buffers) {
+                buffer->consume(occupancy - limit);
+            }
+        }
+
+        lastPressure = now;
+        windowStart = now;
+        peakOccupancy = 0;
+        return;
+    }
+
+    peakOccupancy = std::max(peakOccupancy, occupancy);
+
+    if ((now - windowStart) < ShrinkInterval) {
+        return;
+    }
+
+    // Shrink one frame at a time while the peak leaves two frames unused.
+    if ((now - lastPressure) >= QuietPeriod &&
+        depth > minDepth &&
+        (peakOccupancy + 2 * frameSize) <= depth * frameSize) {
+        depth -= 1;
+    }
+
+    windowStart = now;
+    peakOccupancy = 0;
+}
+
+template<Device D, typename T>
+void Soapy<D, T>::Impl::stamp(const U64& position, const int& flags, const long long& timeNs) {
+    const Stamp entry = {
+        .position = position,
+        .timeNs = (flags & SOAPY_SDR_HAS_TIME) ? static_cast<I64>(timeNs) : -1,
+        .frequency = frequency.load(),
+        .sampleRate = sampleRate.load(),
+    };
+
+    std::lock_guard<std::mutex> lock(stampMutex);
+    if (!stamps.empty() && stamps.back().position == position) {
+        stamps.back() = entry;
+    } else {
+        stamps.push_back(entry);
+    }
+}
+
+template<Device D, typename T>
+void Soapy<D, T>::Impl::tag(Tensor<D, T>& frame) {
+    const U64 start = buffers.front()->getReadPosition();
+
+    // Count the samples dropped before the frame. A gap at the start of the
+    // frame happened right before its first sample.
+
+    auto gaps = buffers.front()->takeGaps();
+    pendingGaps.insert(pendingGaps.end(), gaps.begin(), gaps.end());
+    std::erase_if(pendingGaps, [&](const auto& gap) {
+        if (gap.position > start) {
+            return false;
+        }
+        droppedSamples += gap.size;
+        return true;
+    });
+
+    frame.attribute("sample_index").set(start + droppedSamples);
+
+    // Every read starts a stamp and there's no gap inside a read, so the
+    // latest stamp before the frame extrapolates exactly to its first sample.
+
+    Stamp current;
+    {
+        std::lock_guard<std::mutex> lock(stampMutex);
+        while (stamps.size() > 1 && stamps[1].position <= start) {
+            stamps.pop_front();
+        }
+        if (stamps.empty() || stamps.front().position > start) {
+            return;
+        }
+        current = stamps.front();
+    }
+
+    I64 timeNs = -1;
+    if (current.timeNs >= 0) {
+        const F64 offset = static_cast<F64>(start - current.position) * 1e9 / current.sampleRate;
+        timeNs = current.timeNs + static_cast<I64>(std::llround(offset));
+    }
+
+    frame.attribute("time_ns").set(timeNs);
+    frame.attribute("frequency").set(current.frequency);
+    frame.attribute("sample_rate").set(current.sampleRate);
+}
+
 template<Device D, typename T>
 bool Soapy<D, T>::Impl::CheckValidRange(const std::vector<SoapySDR::Range>& ranges, const F32& val) {
     bool isSampleRateSupported = false;
@@ -415,8 +764,17 @@ bool Soapy<D, T>::Impl::CheckValidRange(const std::vector<SoapySDR::Range>& rang
     return isSampleRateSupported;
 }
 template<Device D, typename T>
-Memory::CircularBuffer<T>& Soapy<D, T>::getCircularBuffer() {
-    return impl->buffer;
+Memory::CircularBuffer<T>& Soapy<D, T>::getCircularBuffer(const U64& channel) {
+    return *impl->buffers.at(channel);
+}
+
+template<Device D, typename T>
+std::vector<Compute::BufferStatistics> Soapy<D, T>::computeBuffers() const {
+    std::vector<BufferStatistics> statistics;
+    for (U64 c = 0; c < impl->buffers.size(); c++) {
+        statistics.push_back(BufferStatistics::From(jst::fmt::format("channel{}", c), *impl->buffers[c]));
+    }
+    return statistics;
 }
 
 template<Device D, typename T>
@@ -434,6 +792,16 @@ const std::string& Soapy<D, T>::getDeviceLabel() const {
     return impl->deviceLabel;
 }
 
+template<Device D, typename T>
+U64 Soapy<D, T>::getBufferDepth() const {
+    return impl->depth;
+}
+
+template<Device D, typename T>
+F32 Soapy<D, T>::getBufferLatency() const {
+    return static_cast<F32>(impl->getOccupancy()) / impl->sampleRate.load();
+}
+
 JST_SOAPY_CPU(JST_INSTANTIATION)
 
 }  // namespace Jetstream
@@ -0,0 +1,658 @@
+#include "jetstream/modules/soapy_sink.hh"
+#include "jetstream/compute/thread.hh"
+#include "jetstream/compute/tracer.hh"
+#include "jetstream/memory/utils/circular_buffer.hh"
+#include "jetstream/backend/devices/cpu/simd.hh"
+
+#include <atomic>
+#include <thread>
+#include <functional>
+
+#include <SoapySDR/Device.hpp>
+#include <SoapySDR/Types.hpp>
+#include <SoapySDR/Formats.hpp>
+#include <SoapySDR/Errors.hpp>
+
+namespace Jetstream {
+
+template<Device D, typename T>
+struct SoapySink<D, T>::Impl {
+    SoapySDR::RangeList sampleRateRanges;
+    SoapySDR::RangeList frequencyRanges;
+    SoapySDR::Range gainRange;
+
+    SoapySDR::Device* soapyDevice = nullptr;
+    SoapySDR::Stream* soapyStream = nullptr;
+
+    std::thread consumer;
+    std::atomic<bool> errored = false;
+    std::atomic<bool> streaming = false;
+    std::string deviceLabel;
+    std::string deviceName;
+    std::string deviceHardwareKey;
+    std::string streamFormat;
+    // Direct access buffers are in the native format of the driver, so
+    // they're only filled when it matches the stream format.
+    bool nativeStreamFormat = false;
+
+    // Handoff to the device thread. Lock-free, the graph is the only producer
+    // and the device thread the only consumer. Float inputs are quantized by
+    // the graph straight into the CS16 ring when the device streams CS16, so
+    // the driver copies samples out without converting them.
+    bool quantize = false;
+    F32 scale = 1.0f;
+    Memory::CircularBuffer<CI16> nativeBuffer;
+    Memory::CircularBuffer<CF32> floatBuffer;
+    std::vector<CI16> scratch;
+
+    // Wakes up the scheduler waiting for space in the ring.
+    std::function<void()> notify;
+
+    // Underflows only count once transmission started, the device asks for
+    // samples before the first compute.
+    std::atomic<bool> primed = false;
+    std::atomic<U64> samplesSent = 0;
+    std::atomic<U64> underflows = 0;
+    std::atomic<U64> underflowSamples = 0;
+    std::atomic<U64> deviceUnderflows = 0;
+    bool statusSupported = true;
+
+    bool native() const;
+    U64 getOccupancy() const;
+    U64 getCapacity() const;
+
+    template<typename S>
+    U64 fill(Memory::CircularBuffer<S>& buffer, S* target, const U64& size);
+
+    template<typename S>
+    Result soapyThreadLoop(Memory::CircularBuffer<S>& buffer);
+
+    void pollStatus();
+
+    static bool CheckValidRange(const std::vector<SoapySDR::Range>& ranges, const F32& val);
+};
+
+template<Device D, typename T>
+SoapySink<D, T>::SoapySink() {
+    impl = std::make_unique<Impl>();
+}
+
+template<Device D, typename T>
+SoapySink<D, T>::~SoapySink() {
+    impl.reset();
+}
+
+template<Device D, typename T>
+Result SoapySink<D, T>::create() {
+    JST_DEBUG("Initializing Soapy Sink module.");
+    JST_INIT_IO();
+
+    impl->errored = false;
+    impl->nativeStreamFormat = false;
+    impl->streaming = false;
+    impl->primed = false;
+    impl->samplesSent = 0;
+    impl->underflows = 0;
+    impl->underflowSamples = 0;
+    impl->deviceUnderflows = 0;
+    impl->statusSupported = true;
+    impl->quantize = false;
+    impl->soapyStream = nullptr;
+    impl->deviceName = "None";
+    impl->deviceHardwareKey = "None";
+
+    // Convert requested device and stream strings into arguments.
+
+    SoapySDR::Kwargs args = SoapySDR::KwargsFromString(config.deviceString);
+    SoapySDR::Kwargs streamArgs = SoapySDR::KwargsFromString(config.streamString);
+
+    // Try opening device.
+
+    try {
+        const auto devices = SoapySDR::Device::enumerate(args);
+        impl->deviceLabel = devices.at(0).at("label");
+        impl->soapyDevice = SoapySDR::Device::make(devices.at(0));
+    } catch(const std::exception& e) {
+        JST_ERROR("Failed to open device. Reason: {}", e.what());
+        return Result::ERROR;
+    } catch(...) {
+        JST_ERROR("Failed to open device.");
+        return Result::ERROR;
+    }
+
+    if (impl->soapyDevice == nullptr) {
+        JST_ERROR("Can't open SoapySDR device.");
+        return Result::ERROR;
+    }
+
+    if (impl->soapyDevice->getNumChannels(SOAPY_SDR_TX) == 0) {
+        JST_ERROR("Device '{}' can't transmit.", impl->deviceLabel);
+        SoapySDR::Device::unmake(impl->soapyDevice);
+        return Result::ERROR;
+    }
+
+    // Gather device ranges.
+
+    try {
+        impl->sampleRateRanges = impl->soapyDevice->getSampleRateRange(SOAPY_SDR_TX, 0);
+        impl->frequencyRanges = impl->soapyDevice->getFrequencyRange(SOAPY_SDR_TX, 0);
+        impl->gainRange = impl->soapyDevice->getGainRange(SOAPY_SDR_TX, 0);
+    } catch(const std::exception& e) {
+        JST_ERROR("Failed to get device ranges.");
+        JST_TRACE("SoapySDR Error: {}", e.what());
+        SoapySDR::Device::unmake(impl->soapyDevice);
+        return Result::ERROR;
+    } catch(...) {
+        JST_ERROR("Failed to get device ranges.");
+        SoapySDR::Device::unmake(impl->soapyDevice);
+        return Result::ERROR;
+    }
+
+    // Check if requested configuration is supported.
+
+    if (!Impl::CheckValidRange(impl->sampleRateRanges, config.sampleRate)) {
+        JST_ERROR("Sample rate requested ({:.2f} MHz) is not supported by the device.", config.sampleRate / JST_MHZ);
+        SoapySDR::Device::unmake(impl->soapyDevice);
+        return Result::ERROR;
+    }
+
+    if (!Impl::CheckValidRange(impl->frequencyRanges, config.frequency)) {
+        JST_ERROR("Frequency requested ({:.2f} MHz) is not supported by the device.", config.frequency / JST_MHZ);
+        SoapySDR::Device::unmake(impl->soapyDevice);
+        return Result::ERROR;
+    }
+
+    if (!Impl::CheckValidRange({impl->gainRange}, config.gain)) {
+        JST_ERROR("Gain requested ({:.1f} dB) is not supported by the device.", config.gain);
+        SoapySDR::Device::unmake(impl->soapyDevice);
+        return Result::ERROR;
+    }
+
+    // Apply requested configuration.
+
+    try {
+        impl->soapyDevice->setSampleRate(SOAPY_SDR_TX, 0, config.sampleRate);
+        impl->soapyDevice->setFrequency(SOAPY_SDR_TX, 0, config.frequency);
+        impl->soapyDevice->setGain(SOAPY_SDR_TX, 0, config.gain);
+
+        // Pick the stream format. Integer inputs are sent as they are, float
+        // inputs are quantized by the graph if the device streams CS16.
+
+        double fullScale = 0.0;
+        const auto nativeFormat = impl->soapyDevice->getNativeStreamFormat(SOAPY_SDR_TX, 0, fullScale);
+
+        if constexpr (std::is_same_v<T, CF32>) {
+            impl->quantize = config.nativeFormat && nativeFormat == SOAPY_SDR_CS16;
+        }
+        impl->scale = (fullScale > 0.0) ? static_cast<F32>(fullScale) : 32767.0f;
+        impl->streamFormat = impl->native() ? SOAPY_SDR_CS16 : SOAPY_SDR_CF32;
+        impl->nativeStreamFormat = (nativeFormat == impl->streamFormat);
+
+        JST_DEBUG("[SOAPY_SINK] Native stream format: {}; Sent: {};", nativeFormat, impl->streamFormat);
+
+        impl->soapyStream = impl->soapyDevice->setupStream(SOAPY_SDR_TX, impl->streamFormat, {0}, streamArgs);
+        if (impl->soapyStream == nullptr) {
+            JST_ERROR("Failed to setup SoapySDR stream.");
+            SoapySDR::Device::unmake(impl->soapyDevice);
+            return Result::ERROR;
+        }
+        impl->soapyDevice->activateStream(impl->soapyStream, 0, 0, 0);
+
+        impl->deviceName = impl->soapyDevice->getDriverKey();
+        impl->deviceHardwareKey = impl->soapyDevice->getHardwareKey();
+    } catch(const std::exception& e) {
+        JST_ERROR("Failed to configure device or setup stream ({}).", e.what());
+        if (impl->soapyStream) {
+            try { impl->soapyDevice->closeStream(impl->soapyStream); } catch(...) {}
+        }
+        SoapySDR::Device::unmake(impl->soapyDevice);
+        return Result::ERROR;
+    } catch(...) {
+        JST_ERROR("Failed to configure device or setup stream.");
+        if (impl->soapyStream) {
+            try { impl->soapyDevice->closeStream(impl->soapyStream); } catch(...) {}
+        }
+        SoapySDR::Device::unmake(impl->soapyDevice);
+        return Result::ERROR;
+    }
+
+    // Allocate circular buffer.
+
+    const U64 capacity = input.buffer.size() * std::max<U64>(config.bufferMultiplier, 2);
+
+    if (impl->native()) {
+        impl->nativeBuffer.resize(capacity, Memory::CircularBuffer<CI16>::Mode::LockFree);
+    } else {
+        impl->floatBuffer.resize(capacity, Memory::CircularBuffer<CF32>::Mode::LockFree);
+    }
+
+    if (impl->quantize) {
+        impl->scratch.resize(input.buffer.size());
+    }
+
+    impl->notify = [&]{
+        notifyCompute();
+    };
+
+    // Initialize thread for transmission.
+
+    impl->streaming = true;
+    impl->consumer = std::thread([&]{
+        ApplyThreadPolicy(ThreadRole::IO);
+        Tracer::SetThreadName("Soapy Consumer");
+
+        try {
+            if (impl->native()) {
+                JST_CHECK_THROW(impl->soapyThreadLoop(impl->nativeBuffer));
+            } else {
+                JST_CHECK_THROW(impl->soapyThreadLoop(impl->floatBuffer));
+            }
+        } catch(...) {
+            impl->errored = true;
+            JST_FATAL("[SOAPY_SINK] Device thread crashed.");
+        }
+
+        // Release the graph waiting for space.
+        impl->notify();
+    });
+
+    return Result::SUCCESS;
+}
+
+template<Device D, typename T>
+Result SoapySink<D, T>::destroy() {
+    impl->streaming = false;
+
+    if (impl->consumer.joinable()) {
+        impl->consumer.join();
+    }
+
+    try {
+        impl->soapyDevice->deactivateStream(impl->soapyStream, 0, 0);
+        impl->soapyDevice->closeStream(impl->soapyStream);
+    } catch(const std::exception& e) {
+        JST_ERROR("Failed to deactivate/close stream ({}).", e.what());
+    } catch(...) {
+        JST_ERROR("Failed to deactivate/close stream.");
+    }
+
+    try {
+        SoapySDR::Device::unmake(impl->soapyDevice);
+    } catch(const std::exception& e) {
+        JST_ERROR("Failed to unmake device ({}).", e.what());
+    } catch(...) {
+        JST_ERROR("Failed to unmake device.");
+    }
+
+    return Result::SUCCESS;
+}
+
+template<Device D, typename T>
+bool SoapySink<D, T>::Impl::native() const {
+    return std::is_same_v<T, CI16> || quantize;
+}
+
+template<Device D, typename T>
+U64 SoapySink<D, T>::Impl::getOccupancy() const {
+    return native() ? nativeBuffer.getOccupancy() : floatBuffer.getOccupancy();
+}
+
+template<Device D, typename T>
+U64 SoapySink<D, T>::Impl::getCapacity() const {
+    return native() ? nativeBuffer.getCapacity() : floatBuffer.getCapacity();
+}
+
+template<Device D, typename T>
+template<typename S>
+U64 SoapySink<D, T>::Impl::fill(Memory::CircularBuffer<S>& buffer, S* target, const U64& size) {
+    // Copy whatever is buffered and pad the rest with zeros. Nothing here
+    // waits for the graph, the device keeps its own pace.
+
+    const U64 available = std::min<U64>(size, buffer.getOccupancy());
+
+    if (available > 0) {
+        // Non-mirrored buffers can't peek across the wraparound.
+        if (const S* buffered = buffer.peek(available)) {
+            std::copy_n(buffered, available, target);
+            buffer.consume(available);
+        } else {
+            buffer.get(target, available);
+        }
+        primed = true;
+        notify();
+    }
+
+    if (available < size) {
+        std::fill_n(target + available, size - available, S{});
+
+        if (primed) {
+            underflows += 1;
+            underflowSamples += size - available;
+        }
+    }
+
+    return available;
+}
+
+template<Device D, typename T>
+template<typename S>
+Result SoapySink<D, T>::Impl::soapyThreadLoop(Memory::CircularBuffer<S>& buffer) {
+    int flags;
+    size_t handle;
+    void* targets[1];
+    const void* sources[1];
+
+    // Drivers with direct buffer access hand out their own buffers, which are
+    // filled once from the ring. Otherwise the driver writes from the ring,
+    // converting to its native format when it differs from ours.
+
+    bool directAccess = false;
+    try {
+        directAccess = nativeStreamFormat && soapyDevice->getNumDirectAccessBuffers(soapyStream) > 0;
+    } catch(...) {
+        directAccess = false;
+    }
+
+    const U64 mtu = std::max<U64>(soapyDevice->getStreamMTU(soapyStream), 1);
+    std::vector<S> staging(mtu);
+
+    JST_TRACE("[SOAPY_SINK] Direct buffer access: {}; MTU: {}.", directAccess ? "YES" : "NO", mtu);
+
+    while (streaming) {
+        try {
+            if (directAccess) {
+                JST_TRACE_SPAN("SoapySink::acquireWriteBuffer", "soapy");
+
+                int ret = soapyDevice->acquireWriteBuffer(soapyStream, handle, targets, 1e5);
+                if (ret > 0) {
+                    fill(buffer, static_cast<S*>(targets[0]), ret);
+
+                    flags = 0;
+                    soapyDevice->releaseWriteBuffer(soapyStream, handle, ret, flags);
+                    samplesSent += ret;
+                } else if (ret == SOAPY_SDR_UNDERFLOW) {
+                    deviceUnderflows += 1;
+                }
+
+                pollStatus();
+                continue;
+            }
+
+            // Write straight from the ring. The staging buffer is only used when the
+            // ring can't hand out a contiguous window or ran dry.
+            U64 size = std::min<U64>(mtu, buffer.getOccupancy());
+            const S* window = (size > 0) ? buffer.peek(size) : nullptr;
+
+            if (window) {
+                primed = true;
+            } else {
+                size = (size > 0) ? size : mtu;
+                fill(buffer, staging.data(), size);
+            }
+
+            // A staged write can't be taken back, so it's written until the end.
+            const S* samples = window ? window : staging.data();
+            U64 written = 0;
+
+            while (written < size && streaming) {
+                JST_TRACE_SPAN("SoapySink::writeStream", "soapy");
+
+                sources[0] = samples + written;
+                flags = 0;
+
+                int ret = soapyDevice->writeStream(soapyStream, sources, size - written, flags, 0, 1e5);
+                if (ret > 0) {
+                    written += ret;
+                    samplesSent += ret;
+
+                    if (window) {
+                        buffer.consume(ret);
+                        notify();
+                        break;
+                    }
+                } else if (ret == SOAPY_SDR_UNDERFLOW) {
+                    deviceUnderflows += 1;
+                } else if (ret != SOAPY_SDR_TIMEOUT) {
+                    JST_ERROR("Failed to write stream ({}).", SoapySDR::errToStr(ret));
+                    errored = true;
+                    return Result::SUCCESS;
+                }
+            }
+
+            pollStatus();
+        } catch(const std::exception& e) {
+            JST_ERROR("Failed to write stream ({}).", e.what());
+            errored = true;
+            break;
+        } catch(...) {
+            JST_ERROR("Failed to write stream.");
+            errored = true;
+            break;
+        }
+    }
+
+    JST_TRACE("SDR Sink Thread Safed");
+    return Result::SUCCESS;
+}
+
+template<Device D, typename T>
+void SoapySink<D, T>::Impl::pollStatus() {
+    // Drivers report underflows of their own buffers as stream events.
+    // Not every driver has them, polling stops at the first refusal.
+
+    if (!statusSupported) {
+        return;
+    }
+
+    size_t channelMask;
+    int flags;
+    long long timeNs;
+
+    const int ret = soapyDevice->readStreamStatus(soapyStream, channelMask, flags, timeNs, 0);
+
+    if (ret == SOAPY_SDR_UNDERFLOW) {
+        deviceUnderflows += 1;
+    } else if (ret == SOAPY_SDR_NOT_SUPPORTED) {
+        statusSupported = false;
+    }
+}
+
+template<Device D, typename T>
+void SoapySink<D, T>::info() const {
+    JST_DEBUG("  Device String:          {}", config.deviceString);
+    JST_DEBUG("  Stream String:          {}", config.streamString);
+    JST_DEBUG("  Frequency:              {:.2f} MHz", config.frequency / JST_MHZ);
+    JST_DEBUG("  Sample Rate:            {:.2f} MHz", config.sampleRate / JST_MHZ);
+    JST_DEBUG("  Gain:                   {:.1f} dB", config.gain);
+    JST_DEBUG("  Buffer Multiplier:      {}", config.bufferMultiplier);
+    JST_DEBUG("  Stream Format:          {}", impl->streamFormat);
+}
+
+template<Device D, typename T>
+Result SoapySink<D, T>::setTunerFrequency(F32& frequency) {
+    if (!Impl::CheckValidRange(impl->frequencyRanges, frequency)) {
+        JST_WARN("Frequency requested ({:.2f} MHz) is not supported by the device.", frequency / JST_MHZ);
+        frequency = config.frequency;
+        return Result::WARNING;
+    }
+
+    config.frequency = frequency;
+
+    if (!impl->streaming) {
+        return Result::RELOAD;
+    }
+
+    try {
+        impl->soapyDevice->setFrequency(SOAPY_SDR_TX, 0, config.frequency);
+    } catch(const std::exception& e) {
+        JST_ERROR("Failed to set frequency ({}).", e.what());
+        return Result::ERROR;
+    } catch(...) {
+        JST_ERROR("Failed to set frequency.");
+        return Result::ERROR;
+    }
+
+    return Result::SUCCESS;
+}
+
+template<Device D, typename T>
+Result SoapySink<D, T>::setGain(F32& gain) {
+    if (!Impl::CheckValidRange({impl->gainRange}, gain)) {
+        JST_WARN("Gain requested ({:.1f} dB) is not supported by the device.", gain);
+        gain = config.gain;
+        return Result::WARNING;
+    }
+
+    config.gain = gain;
+
+    if (!impl->streaming) {
+        return Result::RELOAD;
+    }
+
+    try {
+        impl->soapyDevice->setGain(SOAPY_SDR_TX, 0, config.gain);
+    } catch(const std::exception& e) {
+        JST_ERROR("Failed to set gain ({}).", e.what());
+        return Result::ERROR;
+    } catch(...) {
+        JST_ERROR("Failed to set gain.");
+        return Result::ERROR;
+    }
+
+    return Result::SUCCESS;
+}
+
+template<Device D, typename T>
+Result SoapySink<D, T>::createCompute(const Context&) {
+    JST_TRACE("Create SoapySDR Sink compute core.");
+    return Result::SUCCESS;
+}
+
+template<Device D, typename T>
+Result SoapySink<D, T>::computeReady() {
+    // The device thread notifies the scheduler once it frees enough space.
+    if (!impl->errored && (impl->getCapacity() - impl->getOccupancy()) < input.buffer.size()) {
+        return Result::TIMEOUT;
+    }
+
+    return Result::SUCCESS;
+}
+
+template<Device D, typename T>
+Result SoapySink<D, T>::compute(const Context&) {
+    if (impl->errored) {
+        return Result::ERROR;
+    }
+
+    const U64 size = input.buffer.size();
+
+    if ((impl->getCapacity() - impl->getOccupancy()) < size) {
+        return Result::YIELD;
+    }
+
+    if constexpr (std::is_same_v<T, CF32>) {
+        if (!impl->quantize) {
+            impl->floatBuffer.put(input.buffer.data(), size);
+            return Result::SUCCESS;
+        }
+
+        // Quantize into the ring, or into the scratch buffer across the wraparound.
+
+        auto& buffer = impl->nativeBuffer;
+        CI16* window = buffer.reserve(size);
+        CI16* target = window ? window : impl->scratch.data();
+
+        Backend::QuantizeI16().kernel()(reinterpret_cast<const F32*>(input.buffer.data()),
+                                        reinterpret_cast<I16*>(target),
+                                        2 * size, impl->scale);
+
+        if (window) {
+            buffer.commit(size);
+        } else {
+            buffer.put(target, size);
+        }
+    } else {
+        impl->nativeBuffer.put(input.buffer.data(), size);
+    }
+
+    return Result::SUCCESS;
+}
+
+template<Device D, typename T>
+bool SoapySink<D, T>::computeUrgent() const {
+    // Less than two compute calls worth of samples left for the device.
+    return impl->primed && impl->getOccupancy() < 2 * input.buffer.size();
+}
+
+template<Device D, typename T>
+std::vector<Compute::BufferStatistics> SoapySink<D, T>::computeBuffers() const {
+    if (impl->native()) {
+        return {BufferStatistics::From("transmit", impl->nativeBuffer)};
+    }
+    return {BufferStatistics::From("transmit", impl->floatBuffer)};
+}
+
+template<Device D, typename T>
+typename SoapySink<D, T>::DeviceList SoapySink<D, T>::ListAvailableDevices(const std::string& filter) {
+    return Soapy<D, CF32>::ListAvailableDevices(filter);
+}
+
+template<Device D, typename T>
+bool SoapySink<D, T>::Impl::CheckValidRange(const std::vector<SoapySDR::Range>& ranges, const F32& val) {
+    for (const auto& range : ranges) {
+        if (val >= range.minimum() and val <= range.maximum()) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+template<Device D, typename T>
+const std::string& SoapySink<D, T>::getDeviceName() const {
+    return impl->deviceName;
+}
+
+template<Device D, typename T>
+const std::string& SoapySink<D, T>::getDeviceHardwareKey() const {
+    return impl->deviceHardwareKey;
+}
+
+template<Device D, typename T>
+const std::string& SoapySink<D, T>::getDeviceLabel() const {
+    return impl->deviceLabel;
+}
+
+template<Device D, typename T>
+const std::string& SoapySink<D, T>::getStreamFormat() const {
+    return impl->streamFormat;
+}
+
+template<Device D, typename T>
+U64 SoapySink<D, T>::getSamplesSent() const {
+    return impl->samplesSent;
+}
+
+template<Device D, typename T>
+U64 SoapySink<D, T>::getUnderflows() const {
+    return impl->underflows;
+}
+
+template<Device D, typename T>
+U64 SoapySink<D, T>::getUnderflowSamples() const {
+    return impl->underflowSamples;
+}
+
+template<Device D, typename T>
+U64 SoapySink<D, T>::getDeviceUnderflows() const {
+    return impl->deviceUnderflows;
+}
+
+template<Device D, typename T>
+F32 SoapySink<D, T>::getBufferLatency() const {
+    return static_cast<F32>(impl->getOccupancy()) / config.sampleRate;
+}
+
+JST_SOAPY_SINK_CPU(JST_INSTANTIATION)
+
+}  // namespace Jetstream
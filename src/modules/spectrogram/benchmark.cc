@@ -7,6 +7,12 @@ void benchmark(ankerl::nanobench::Bench& bench, std::string name) {
     JST_BENCHMARK_RUN("128x8000", {}, {
         .buffer = Tensor<D COMMA T>({128 COMMA 8000}) COMMA
     }, T);
+
+    JST_BENCHMARK_RUN("8x8192 (1024 rows)", {
+        .height = 1024 COMMA
+    }, {
+        .buffer = Tensor<D COMMA T>({8 COMMA 8192}) COMMA
+    }, T);
 }
 
 }  // namespace Jetstream
\ No newline at end of file
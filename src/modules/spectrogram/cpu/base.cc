@@ -1,9 +1,16 @@
 #include "../generic.cc"
 
+#include "jetstream/backend/devices/cpu/simd.hh"
+#include "jetstream/memory/devices/cpu/helpers.hh"
+
 namespace Jetstream {
 
 template<Device D, typename T>
-struct Spectrogram<D, T>::Impl {};
+struct Spectrogram<D, T>::Impl {
+    Tensor<Device::CPU, F32> frequencyBins;
+
+    Backend::CopyDecayKernel copyDecay = nullptr;
+};
 
 template<Device D, typename T>
 Spectrogram<D, T>::Spectrogram() {
@@ -21,28 +28,52 @@ template<Device D, typename T>
 Result Spectrogram<D, T>::createCompute(const Context&) {
     JST_TRACE("Create Spectrogram compute core using CPU backend.");
 
+    pimpl->copyDecay = Backend::CopyDecay().kernel();
+
+    // Accumulate privately and publish a copy to present. The accumulator
+    // is decayed while it's copied, so it always holds the next frame's
+    // starting point.
+
+    pimpl->frequencyBins = Tensor<Device::CPU, F32>(gimpl->frequencyBins.shape());
+
+    gimpl->frequencyBinsSnapshot.forEach([&](auto& snapshot) {
+        snapshot = Tensor<Device::CPU, F32>(gimpl->frequencyBins.shape());
+    });
+
     return Result::SUCCESS;
 }
 
 template<Device D, typename T>
-Result Spectrogram<D, T>::compute(const Context&) {
-    const U64& size = gimpl->frequencyBins.size();
-    const F32 factor = gimpl->decayFactor;
-    for (U64 x = 0; x < size; ++x) {
-        gimpl->frequencyBins[x] *= factor;
-    }
+Result Spectrogram<D, T>::compute(const Context& ctx) {
+    const U64 width = gimpl->numberOfElements;
+    const F32 height = static_cast<F32>(config.height);
+    F32* bins = pimpl->frequencyBins.data();
+
+    // Raise the cell hit by every sample of every batch.
 
     for (U64 b = 0; b < gimpl->numberOfBatches; b++) {
-        for (U64 x = 0; x < gimpl->numberOfElements; x++) {
-            const U16 index = input.buffer[{b, x}] * config.height;
+        for (U64 x = 0; x < width; x++) {
+            const F32 position = input.buffer[{b, x}] * height;
 
-            if (index < config.height && index > 0) {
-                auto& val = gimpl->frequencyBins[x + (index * gimpl->numberOfElements)];
-                val = std::min(val + 0.02, 1.0);
+            if (position >= 1.0f && position < height) {
+                F32& val = bins[x + static_cast<U64>(position) * width];
+                val = std::min(val + 0.02f, 1.0f);
             }
         }
     }
 
+    // Publish and decay in a single pass.
+
+    const U64 size = pimpl->frequencyBins.size();
+    const U64 chunks = size / Memory::CPU::ParallelIteratorGrain;
+    F32* snapshot = gimpl->frequencyBinsSnapshot.back().data();
+
+    Memory::CPU::ParallelRanges(ctx.cpu->pool(), size, chunks, [&](const U64& begin, const U64& end) {
+        pimpl->copyDecay(bins + begin, snapshot + begin, end - begin, gimpl->decayFactor);
+    });
+
+    gimpl->frequencyBinsSnapshot.publish();
+
     return Result::SUCCESS;
 }
 
@@ -98,7 +98,7 @@ Result Spectrogram<D, T>::createCompute(const Context& ctx) {
     };
 
     pimpl->riseArguments = {
-        input.buffer.data_ptr(),
+        pimpl->input.data_ptr(),
         gimpl->frequencyBins.data_ptr(),
         &gimpl->numberOfElements,
         &gimpl->numberOfBatches,
@@ -1,5 +1,6 @@
 #include "jetstream/modules/spectrogram.hh"
 #include "jetstream/render/utils.hh"
+#include "jetstream/memory/utils/triple_buffer.hh"
 
 #include "resources/shaders/spectrogram_shaders.hh"
 #include "jetstream/constants.hh"
@@ -18,6 +19,7 @@ struct Spectrogram<D, T>::GImpl {
     } signalUniforms;
 
     Tensor<D, F32> frequencyBins;
+    Memory::TripleBuffer<Tensor<Device::CPU, F32>> frequencyBinsSnapshot;
 
     std::shared_ptr<Render::Buffer> fillScreenVerticesBuffer;
     std::shared_ptr<Render::Buffer> fillScreenTextureVerticesBuffer;
@@ -60,7 +62,7 @@ Result Spectrogram<D, T>::create() {
     gimpl->numberOfElements = input.buffer.shape()[last_axis];
     gimpl->numberOfBatches = (input.buffer.rank() == 2) ? input.buffer.shape()[0] : 1;
     gimpl->totalFrequencyBins = gimpl->numberOfElements * config.height;
-    gimpl->decayFactor = pow(0.999, gimpl->numberOfBatches);
+    gimpl->decayFactor = std::pow(0.999f, static_cast<F32>(gimpl->numberOfBatches));
 
     // Allocate internal buffers.
 
@@ -208,6 +210,14 @@ Result Spectrogram<D, T>::destroyPresent() {
 
 template<Device D, typename T>
 Result Spectrogram<D, T>::present() {
+    // Pick up the latest frame published by compute. Draw only when there is one.
+    if constexpr (D == Device::CPU) {
+        if (!gimpl->frequencyBinsSnapshot.consume()) {
+            return Result::SUCCESS;
+        }
+        JST_CHECK(Memory::Copy(gimpl->frequencyBins, gimpl->frequencyBinsSnapshot.front()));
+    }
+
     gimpl->signalBuffer->update();
 
     gimpl->signalUniforms.width = gimpl->numberOfElements;
@@ -216,6 +226,7 @@ Result Spectrogram<D, T>::present() {
     gimpl->signalUniforms.offset = 0.0;
 
     gimpl->signalUniformBuffer->update();
+    gimpl->surface->update();
 
     return Result::SUCCESS;
 }
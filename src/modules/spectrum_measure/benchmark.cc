@@ -0,0 +1,19 @@
+#include "jetstream/modules/spectrum_measure.hh"
+
+namespace Jetstream {
+
+template<template<Device, typename...> class Module, Device D, typename T>
+void benchmark(ankerl::nanobench::Bench& bench, std::string name) {
+    JST_BENCHMARK_RUN("8x8192", {}, {
+        .buffer = Tensor<D COMMA T>({8 COMMA 8192}) COMMA
+    }, T);
+
+    JST_BENCHMARK_RUN("8x8192 (4 bands)", {
+        .center = {-500.0e3f COMMA -100.0e3f COMMA 100.0e3f COMMA 500.0e3f} COMMA
+        .bandwidth = {200.0e3f COMMA 200.0e3f COMMA 200.0e3f COMMA 200.0e3f} COMMA
+    }, {
+        .buffer = Tensor<D COMMA T>({8 COMMA 8192}) COMMA
+    }, T);
+}
+
+}  // namespace Jetstream
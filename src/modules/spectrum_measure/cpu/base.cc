@@ -0,0 +1,120 @@
+#include "../generic.cc"
+
+#include "jetstream/memory/devices/cpu/helpers.hh"
+#include "jetstream/backend/devices/cpu/simd.hh"
+
+namespace Jetstream {
+
+template<Device D, typename T>
+struct SpectrumMeasure<D, T>::Impl {
+    U64 size = 0;
+    U64 rows = 1;
+
+    // Bins of every band, end exclusive.
+    std::vector<U64> bandBegin;
+    std::vector<U64> bandEnd;
+};
+
+template<Device D, typename T>
+SpectrumMeasure<D, T>::SpectrumMeasure() {
+    impl = std::make_unique<Impl>();
+}
+
+template<Device D, typename T>
+SpectrumMeasure<D, T>::~SpectrumMeasure() {
+    impl.reset();
+}
+
+template<Device D, typename T>
+Result SpectrumMeasure<D, T>::createCompute(const Context&) {
+    JST_TRACE("Create Spectrum Measure compute core using CPU backend.");
+
+    JST_TRACE("[SPECTRUM_MEASURE] Rows: {}; Kernel: {};", impl->rows, Backend::DecibelsPowerSum().name());
+
+    return Result::SUCCESS;
+}
+
+template<Device D, typename T>
+Result SpectrumMeasure<D, T>::compute(const Context& ctx) {
+    const U64 size = impl->size;
+    const U64 bands = impl->bandBegin.size();
+    const U64 numberOfPeaks = config.numberOfPeaks;
+    const F32 binWidth = config.sampleRate / static_cast<F32>(size);
+    const F32 threshold = config.threshold;
+
+    const T* in = input.buffer.data() + input.buffer.offset();
+    T* peaks = output.peaks.data();
+    T* floor = output.floor.data();
+    T* power = output.power.data();
+
+    const auto powerSum = Backend::DecibelsPowerSum().kernel();
+
+    const U64 chunks = input.buffer.size() / Memory::CPU::ParallelIteratorGrain;
+
+    Memory::CPU::ParallelRanges(ctx.cpu->pool(), impl->rows, chunks, [&](const U64& begin, const U64& end) {
+        std::vector<F32> scratch(size);
+        std::vector<std::pair<F32, U64>> candidates;
+
+        for (U64 r = begin; r < end; r++) {
+            const T* row = in + r * size;
+
+            // The median bin is a noise floor estimate robust to a few
+            // strong carriers.
+
+            std::copy_n(row, size, scratch.data());
+            std::nth_element(scratch.begin(), scratch.begin() + size / 2, scratch.end());
+            floor[r] = scratch[size / 2];
+
+            // Integrated power of every band, summed in linear units.
+
+            for (U64 b = 0; b < bands; b++) {
+                const U64 bandBegin = impl->bandBegin[b];
+                const U64 bandSize = impl->bandEnd[b] - bandBegin;
+                power[r * bands + b] = 10.0f * std::log10(powerSum(row + bandBegin, bandSize));
+            }
+
+            // Local maxima above the floor, strongest first. The position and
+            // level are refined with a parabola through the neighbours.
+
+            candidates.clear();
+            const F32 minimum = floor[r] + threshold;
+            for (U64 j = 1; j + 1 < size; j++) {
+                if (row[j] >= minimum && row[j] > row[j - 1] && row[j] >= row[j + 1]) {
+                    candidates.emplace_back(row[j], j);
+                }
+            }
+
+            const U64 found = std::min<U64>(numberOfPeaks, candidates.size());
+            std::partial_sort(candidates.begin(), candidates.begin() + found, candidates.end(),
+                              [](const auto& a, const auto& b) { return a.first > b.first; });
+
+            T* rowPeaks = peaks + r * numberOfPeaks * 2;
+
+            for (U64 k = 0; k < found; k++) {
+                const U64 j = candidates[k].second;
+                const F32 a = row[j - 1];
+                const F32 b = row[j];
+                const F32 c = row[j + 1];
+                const F32 curvature = a - 2.0f * b + c;
+                const F32 delta = (curvature != 0.0f) ? 0.5f * (a - c) / curvature : 0.0f;
+
+                rowPeaks[2 * k + 0] = (static_cast<F32>(j) + delta - static_cast<F32>(size / 2)) * binWidth;
+                rowPeaks[2 * k + 1] = b - 0.25f * (a - c) * delta;
+            }
+
+            // Unused slots are marked so consumers can tell them apart.
+
+            for (U64 k = found; k < numberOfPeaks; k++) {
+                rowPeaks[2 * k + 0] = std::numeric_limits<F32>::quiet_NaN();
+                rowPeaks[2 * k + 1] = std::numeric_limits<F32>::quiet_NaN();
+            }
+        }
+    });
+
+    return Result::SUCCESS;
+}
+
+JST_SPECTRUM_MEASURE_CPU(JST_INSTANTIATION)
+JST_SPECTRUM_MEASURE_CPU(JST_BENCHMARK)
+
+}  // namespace Jetstream
@@ -0,0 +1,92 @@
+#include "jetstream/modules/spectrum_measure.hh"
+
+#include "benchmark.cc"
+
+namespace Jetstream {
+
+template<Device D, typename T>
+Result SpectrumMeasure<D, T>::create() {
+    JST_DEBUG("Initializing Spectrum Measure module.");
+    JST_INIT_IO();
+
+    // Check parameters.
+
+    if (input.buffer.shape().back() < 3) {
+        JST_ERROR("Spectrum size ({}) should be at least 3.", input.buffer.shape().back());
+        return Result::ERROR;
+    }
+
+    if (config.sampleRate <= 0.0f) {
+        JST_ERROR("Sample rate ({}) should be positive.", config.sampleRate);
+        return Result::ERROR;
+    }
+
+    if (config.numberOfPeaks == 0) {
+        JST_ERROR("Number of peaks should be positive.");
+        return Result::ERROR;
+    }
+
+    if (config.center.empty()) {
+        JST_ERROR("At least one band should be measured.");
+        return Result::ERROR;
+    }
+
+    if (config.center.size() != config.bandwidth.size()) {
+        JST_ERROR("Number of band centers ({}) and bandwidths ({}) should match.",
+                  config.center.size(), config.bandwidth.size());
+        return Result::ERROR;
+    }
+
+    // Calculate parameters.
+    //
+    // Every row of the last axis is a centered spectrum in decibels, the
+    // first bin sitting at minus half the sample rate.
+
+    impl->size = input.buffer.shape().back();
+    impl->rows = input.buffer.size() / impl->size;
+
+    impl->bandBegin.resize(config.center.size());
+    impl->bandEnd.resize(config.center.size());
+
+    const auto toBin = [&](const F32& frequency) {
+        const F64 bin = std::round((frequency / config.sampleRate + 0.5) * impl->size);
+        return static_cast<U64>(std::clamp<F64>(bin, 0.0, static_cast<F64>(impl->size)));
+    };
+
+    for (U64 b = 0; b < config.center.size(); b++) {
+        if (config.bandwidth[b] <= 0.0f) {
+            JST_ERROR("Bandwidth of band #{} ({}) should be positive.", b, config.bandwidth[b]);
+            return Result::ERROR;
+        }
+
+        impl->bandBegin[b] = toBin(config.center[b] - config.bandwidth[b] / 2.0f);
+        impl->bandEnd[b] = std::max(toBin(config.center[b] + config.bandwidth[b] / 2.0f), impl->bandBegin[b] + 1);
+
+        if (impl->bandBegin[b] >= impl->size) {
+            JST_ERROR("Band #{} is outside of the spectrum.", b);
+            return Result::ERROR;
+        }
+        impl->bandEnd[b] = std::min(impl->bandEnd[b], impl->size);
+    }
+
+    // Allocate output.
+    //
+    // Each peak is a frequency relative to the center and a level. Rows are
+    // kept apart so batched spectra are measured independently.
+
+    output.peaks = Tensor<D, T>({impl->rows, config.numberOfPeaks, 2});
+    output.floor = Tensor<D, T>({impl->rows});
+    output.power = Tensor<D, T>({impl->rows, config.center.size()});
+
+    return Result::SUCCESS;
+}
+
+template<Device D, typename T>
+void SpectrumMeasure<D, T>::info() const {
+    JST_DEBUG("  Sample Rate:     {:.2f} MHz", config.sampleRate / JST_MHZ);
+    JST_DEBUG("  Number of Peaks: {}", config.numberOfPeaks);
+    JST_DEBUG("  Threshold:       {:.1f} dB", config.threshold);
+    JST_DEBUG("  Bands:           {}", config.center.size());
+}
+
+}  // namespace Jetstream
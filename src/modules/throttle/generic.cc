@@ -4,7 +4,26 @@ namespace Jetstream {
 
 template<Device D, typename T>
 struct Throttle<D, T>::Impl {
-    std::chrono::steady_clock::time_point lastExecutionTime;
+    typedef std::chrono::steady_clock Clock;
+
+    // Deadlines are computed from the origin and the number of passes, not
+    // from the previous pass. Late wake-ups and execution time don't add up.
+    Clock::time_point origin;
+    Clock::time_point deadline;
+    F64 period = 0.0;
+    U64 passes = 0;
+
+    F64 rate = 0.0;
+    F64 lateness = 0.0;
+    Clock::time_point rateStart;
+    U64 ratePasses = 0;
+
+    // Falling further behind than this restarts the schedule instead of
+    // bursting through the backlog.
+    static constexpr F64 MaxLag = 0.25;
+
+    void reset(const F64& period);
+    Clock::time_point schedule(const U64& pass) const;
 };
 
 template<Device D, typename T>
@@ -22,9 +41,16 @@ Result Throttle<D, T>::create() {
     JST_DEBUG("Initializing Throttle module.");
     JST_INIT_IO();
 
+    // Check parameters.
+
+    if (config.sampleRate < 0.0) {
+        JST_ERROR("Sample rate ({}) can't be negative.", config.sampleRate);
+        return Result::ERROR;
+    }
+
     // Initialize timing.
 
-    intervalMs(config.intervalMs);
+    sampleRate(config.sampleRate);
 
     // Install bypass.
 
@@ -33,34 +59,86 @@ Result Throttle<D, T>::create() {
     return Result::SUCCESS;
 }
 
+template<Device D, typename T>
+void Throttle<D, T>::Impl::reset(const F64& period) {
+    this->period = period;
+
+    // Allow an immediate first pass.
+    origin = Clock::now();
+    deadline = origin;
+    passes = 0;
+
+    rate = 0.0;
+    lateness = 0.0;
+    rateStart = origin;
+    ratePasses = 0;
+}
+
+template<Device D, typename T>
+typename Throttle<D, T>::Impl::Clock::time_point Throttle<D, T>::Impl::schedule(const U64& pass) const {
+    const std::chrono::duration<F64> offset(static_cast<F64>(pass) * period);
+    return origin + std::chrono::duration_cast<Clock::duration>(offset);
+}
+
 template<Device D, typename T>
 const U64& Throttle<D, T>::intervalMs(const U64& intervalMs) {
     // Update configuration.
 
     config.intervalMs = intervalMs;
 
-    // Reset timing to allow immediate first pass.
+    // Reset timing.
 
-    impl->lastExecutionTime = std::chrono::steady_clock::now() -
-                              std::chrono::milliseconds(config.intervalMs);
+    if (config.sampleRate <= 0.0) {
+        impl->reset(static_cast<F64>(config.intervalMs) / 1e3);
+    }
 
     return config.intervalMs;
 }
 
+template<Device D, typename T>
+const F64& Throttle<D, T>::sampleRate(const F64& sampleRate) {
+    // Update configuration.
+
+    config.sampleRate = std::max(sampleRate, 0.0);
+
+    // Reset timing. The period of an input is the time its samples span.
+
+    if (config.sampleRate > 0.0) {
+        impl->reset(static_cast<F64>(input.buffer.size()) / config.sampleRate);
+    } else {
+        impl->reset(static_cast<F64>(config.intervalMs) / 1e3);
+    }
+
+    return config.sampleRate;
+}
+
+template<Device D, typename T>
+F64 Throttle<D, T>::getRate() const {
+    return impl->rate;
+}
+
+template<Device D, typename T>
+F64 Throttle<D, T>::getLateness() const {
+    return impl->lateness;
+}
+
 template<Device D, typename T>
 void Throttle<D, T>::info() const {
-    JST_DEBUG("  Throttle interval: {} ms", config.intervalMs);
+    if (config.sampleRate > 0.0) {
+        JST_DEBUG("  Sample Rate: {:.3f} MHz", config.sampleRate / JST_MHZ);
+        JST_DEBUG("  Period: {:.3f} ms", impl->period * 1e3);
+    } else {
+        JST_DEBUG("  Throttle interval: {} ms", config.intervalMs);
+    }
 }
 
 template<Device D, typename T>
 Result Throttle<D, T>::computeReady() {
-    auto now = std::chrono::steady_clock::now();
-    auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
-        now - impl->lastExecutionTime);
-
-    // Sleep until the configured interval has elapsed.
-    if (elapsed < std::chrono::milliseconds(config.intervalMs)) {
-        std::this_thread::sleep_for(std::chrono::milliseconds(config.intervalMs) - elapsed);
+    // Ask the scheduler to check again at the deadline. It waits on the
+    // steady clock, so the wake-up isn't rounded to milliseconds.
+    if (Impl::Clock::now() < impl->deadline) {
+        notifyComputeAt(impl->deadline);
+        return Result::TIMEOUT;
     }
 
     return Result::SUCCESS;
@@ -68,16 +146,32 @@ Result Throttle<D, T>::computeReady() {
 
 template<Device D, typename T>
 Result Throttle<D, T>::compute(const Context&) {
-    auto now = std::chrono::steady_clock::now();
-    auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
-        now - impl->lastExecutionTime);
+    const auto now = Impl::Clock::now();
 
-    if (elapsed < std::chrono::milliseconds(config.intervalMs)) {
+    if (now < impl->deadline) {
         return Result::YIELD;
     }
 
-    // Update the timestamp for the next delay interval.
-    impl->lastExecutionTime = now;
+    const F64 lateness = std::chrono::duration<F64>(now - impl->deadline).count();
+    impl->lateness = lateness;
+
+    if (lateness > std::max(Impl::MaxLag, 4.0 * impl->period)) {
+        // Stalled upstream or suspended. Restart the schedule from now.
+        impl->origin = now;
+        impl->passes = 0;
+    }
+
+    impl->passes += 1;
+    impl->deadline = impl->schedule(impl->passes);
+
+    // Measure the rate over half a second windows.
+    impl->ratePasses += 1;
+    const F64 elapsed = std::chrono::duration<F64>(now - impl->rateStart).count();
+    if (elapsed >= 0.5) {
+        impl->rate = static_cast<F64>(impl->ratePasses) / elapsed;
+        impl->rateStart = now;
+        impl->ratePasses = 0;
+    }
 
     return Result::SUCCESS;
 }
@@ -1,9 +1,15 @@
 #include "../generic.cc"
 
+#include "jetstream/memory/devices/cpu/helpers.hh"
+
 namespace Jetstream {
 
 template<Device D, typename T>
-struct Unpad<D, T>::Impl {};
+struct Unpad<D, T>::Impl {
+    // Contiguous layout around the axis.
+    U64 outer = 1;
+    U64 inner = 1;
+};
 
 template<Device D, typename T>
 Unpad<D, T>::Unpad() {
@@ -18,11 +24,46 @@ Unpad<D, T>::~Unpad() {
 template<Device D, typename T>
 Result Unpad<D, T>::createCompute(const Context&) {
     JST_TRACE("Create Unpad compute core using CPU backend.");
+
+    const auto& shape = input.padded.shape();
+
+    impl->outer = 1;
+    impl->inner = 1;
+    for (U64 i = 0; i < config.axis; i++) {
+        impl->outer *= shape[i];
+    }
+    for (U64 i = config.axis + 1; i < shape.size(); i++) {
+        impl->inner *= shape[i];
+    }
+
     return Result::SUCCESS;
 }
 
 template<Device D, typename T>
-Result Unpad<D, T>::compute(const Context&) {
+Result Unpad<D, T>::compute(const Context& ctx) {
+    if (input.padded.contiguous()) {
+        // Every row is split in two contiguous copies.
+
+        const T* in = input.padded.data() + input.padded.offset();
+        T* unpadded = output.unpadded.data();
+        T* pad = output.pad.data();
+
+        const U64 padSize = config.size * impl->inner;
+        const U64 unpaddedSize = output.unpadded.shape()[config.axis] * impl->inner;
+        const U64 rowSize = unpaddedSize + padSize;
+        const U64 chunks = input.padded.size() / Memory::CPU::ParallelIteratorGrain;
+
+        Memory::CPU::ParallelRanges(ctx.cpu->pool(), impl->outer, chunks, [&](const U64& begin, const U64& end) {
+            for (U64 o = begin; o < end; o++) {
+                const T* row = in + o * rowSize;
+                std::copy_n(row, unpaddedSize, unpadded + o * unpaddedSize);
+                std::copy_n(row + unpaddedSize, padSize, pad + o * padSize);
+            }
+        });
+
+        return Result::SUCCESS;
+    }
+
     std::vector<U64> shape = input.padded.shape();
     const U64 pad_offset = shape[config.axis] - config.size;
 
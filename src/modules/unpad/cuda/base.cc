@@ -0,0 +1,132 @@
+#include "../generic.cc"
+
+#include "jetstream/memory/devices/cuda/copy.hh"
+
+namespace Jetstream {
+
+template<Device D, typename T>
+struct Unpad<D, T>::Impl {
+    std::vector<U64> grid;
+    std::vector<U64> block;
+
+    std::vector<void*> arguments;
+
+    Tensor<Device::CUDA, T> input;
+
+    U64 inner = 1;
+    U64 paddedAxisSize = 0;
+    U64 unpaddedAxisSize = 0;
+    U64 numberOfElements = 0;
+};
+
+template<Device D, typename T>
+Unpad<D, T>::Unpad() {
+    impl = std::make_unique<Impl>();
+}
+
+template<Device D, typename T>
+Unpad<D, T>::~Unpad() {
+    impl.reset();
+}
+
+template<Device D, typename T>
+Result Unpad<D, T>::createCompute(const Context& ctx) {
+    JST_TRACE("Create Unpad compute core using CUDA backend.");
+
+    // Create CUDA kernel.
+    //
+    // Every thread moves one padded sample either to the unpadded buffer or,
+    // past the unpadded length, to the pad buffer.
+
+    std::string header;
+
+    if constexpr (std::is_same_v<T, CF32>) {
+        header = "typedef float2 sample_t;\n";
+    } else {
+        header = "typedef float sample_t;\n";
+    }
+
+    ctx.cuda->createKernel("unpad", header + R"""(
+        __global__ void unpad(const sample_t* padded,
+                              sample_t* unpadded,
+                              sample_t* pad,
+                              size_t inner,
+                              size_t paddedAxisSize,
+                              size_t unpaddedAxisSize,
+                              size_t size) {
+            size_t id = blockIdx.x * blockDim.x + threadIdx.x;
+            if (id < size) {
+                const size_t i = id % inner;
+                const size_t a = (id / inner) % paddedAxisSize;
+                const size_t o = id / (inner * paddedAxisSize);
+
+                if (a >= unpaddedAxisSize) {
+                    const size_t padAxisSize = paddedAxisSize - unpaddedAxisSize;
+                    pad[(o * padAxisSize + (a - unpaddedAxisSize)) * inner + i] = padded[id];
+                } else {
+                    unpadded[(o * unpaddedAxisSize + a) * inner + i] = padded[id];
+                }
+            }
+        }
+    )""");
+
+    // Calculate parameters.
+
+    const auto& shape = input.padded.shape();
+
+    impl->inner = 1;
+    for (U64 i = config.axis + 1; i < shape.size(); i++) {
+        impl->inner *= shape[i];
+    }
+    impl->paddedAxisSize = shape[config.axis];
+    impl->unpaddedAxisSize = shape[config.axis] - config.size;
+    impl->numberOfElements = input.padded.size();
+
+    // Initialize kernel size.
+
+    U64 threadsPerBlock = 512;
+    U64 blocksPerGrid = (impl->numberOfElements + threadsPerBlock - 1) / threadsPerBlock;
+
+    impl->grid = { blocksPerGrid, 1, 1 };
+    impl->block = { threadsPerBlock, 1, 1 };
+
+    // Initialize kernel input.
+
+    if (!input.padded.device_native() && input.padded.contiguous()) {
+        impl->input = Tensor<Device::CUDA, T>(input.padded.shape());
+    } else {
+        impl->input = input.padded;
+    }
+
+    // Initialize kernel arguments.
+
+    impl->arguments = {
+        impl->input.data_ptr(),
+        output.unpadded.data_ptr(),
+        output.pad.data_ptr(),
+        &impl->inner,
+        &impl->paddedAxisSize,
+        &impl->unpaddedAxisSize,
+        &impl->numberOfElements,
+    };
+
+    return Result::SUCCESS;
+}
+
+template<Device D, typename T>
+Result Unpad<D, T>::compute(const Context& ctx) {
+    if (!input.padded.device_native() && input.padded.contiguous()) {
+        JST_CHECK(Memory::Copy(impl->input, input.padded, ctx.cuda->stream()));
+    }
+
+    JST_CHECK(ctx.cuda->launchKernel("unpad",
+                                     impl->grid,
+                                     impl->block,
+                                     impl->arguments.data()));
+
+    return Result::SUCCESS;
+}
+
+JST_UNPAD_CUDA(JST_INSTANTIATION)
+
+}  // namespace Jetstream
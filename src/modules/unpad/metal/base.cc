@@ -0,0 +1,100 @@
+#include "../generic.cc"
+
+namespace Jetstream {
+
+// Every thread moves one padded sample either to the unpadded buffer or,
+// past the unpadded length, to the pad buffer.
+
+static const char shadersSrc[] = R"""(
+    struct Constants {
+        ulong inner;
+        ulong paddedAxisSize;
+        ulong unpaddedAxisSize;
+        ulong size;
+    };
+
+    kernel void unpad(constant Constants& constants [[ buffer(0) ]],
+                      constant const sample_t *padded [[ buffer(1) ]],
+                      device sample_t *unpadded [[ buffer(2) ]],
+                      device sample_t *pad [[ buffer(3) ]],
+                      uint id[[ thread_position_in_grid ]]) {
+        if (id >= constants.size) {
+            return;
+        }
+
+        const ulong i = id % constants.inner;
+        const ulong a = (id / constants.inner) % constants.paddedAxisSize;
+        const ulong o = id / (constants.inner * constants.paddedAxisSize);
+
+        if (a >= constants.unpaddedAxisSize) {
+            const ulong padAxisSize = constants.paddedAxisSize - constants.unpaddedAxisSize;
+            pad[(o * padAxisSize + (a - constants.unpaddedAxisSize)) * constants.inner + i] = padded[id];
+        } else {
+            unpadded[(o * constants.unpaddedAxisSize + a) * constants.inner + i] = padded[id];
+        }
+    }
+)""";
+
+template<Device D, typename T>
+struct Unpad<D, T>::Impl {
+    struct Constants {
+        U64 inner;
+        U64 paddedAxisSize;
+        U64 unpaddedAxisSize;
+        U64 size;
+    };
+
+    MTL::ComputePipelineState* state;
+    Tensor<Device::Metal, U8> constants;
+};
+
+template<Device D, typename T>
+Unpad<D, T>::Unpad() {
+    impl = std::make_unique<Impl>();
+}
+
+template<Device D, typename T>
+Unpad<D, T>::~Unpad() {
+    impl.reset();
+}
+
+template<Device D, typename T>
+Result Unpad<D, T>::createCompute(const Context&) {
+    JST_TRACE("Create Unpad compute core using Metal backend.");
+
+    std::string header = "#include <metal_stdlib>\nusing namespace metal;\n";
+    header += std::is_same_v<T, CF32> ? "typedef float2 sample_t;\n" : "typedef float sample_t;\n";
+    JST_CHECK(Metal::CompileKernel((header + shadersSrc).c_str(), "unpad", &impl->state));
+
+    const auto& shape = input.padded.shape();
+
+    auto* constants = Metal::CreateConstants<typename Impl::Constants>(*impl);
+    constants->inner = 1;
+    for (U64 i = config.axis + 1; i < shape.size(); i++) {
+        constants->inner *= shape[i];
+    }
+    constants->paddedAxisSize = shape[config.axis];
+    constants->unpaddedAxisSize = shape[config.axis] - config.size;
+    constants->size = input.padded.size();
+
+    return Result::SUCCESS;
+}
+
+template<Device D, typename T>
+Result Unpad<D, T>::compute(const Context& ctx) {
+    auto cmdEncoder = ctx.metal->commandBuffer()->computeCommandEncoder();
+    cmdEncoder->setComputePipelineState(impl->state);
+    cmdEncoder->setBuffer(impl->constants.data(), 0, 0);
+    cmdEncoder->setBuffer(input.padded.data(), 0, 1);
+    cmdEncoder->setBuffer(output.unpadded.data(), 0, 2);
+    cmdEncoder->setBuffer(output.pad.data(), 0, 3);
+    cmdEncoder->dispatchThreads(MTL::Size(input.padded.size(), 1, 1),
+                                MTL::Size(impl->state->maxTotalThreadsPerThreadgroup(), 1, 1));
+    cmdEncoder->endEncoding();
+
+    return Result::SUCCESS;
+}
+
+JST_UNPAD_METAL(JST_INSTANTIATION)
+
+}  // namespace Jetstream
@@ -3,7 +3,9 @@
 namespace Jetstream {
 
 template<Device D, typename T>
-struct Waterfall<D, T>::Impl {};
+struct Waterfall<D, T>::Impl {
+    std::vector<F32> row;
+};
 
 template<Device D, typename T>
 Waterfall<D, T>::Waterfall() {
@@ -17,8 +19,41 @@ Waterfall<D, T>::~Waterfall() {
     gimpl.reset();
 }
 
+template<Device D, typename T>
+Result Waterfall<D, T>::GImpl::underlyingCreateCompute(Waterfall<D, T>& m, const Context&) {
+    m.pimpl->row.resize(numberOfElements);
+
+    return Result::SUCCESS;
+}
+
 template<Device D, typename T>
 Result Waterfall<D, T>::GImpl::underlyingCompute(Waterfall<D, T>& m, const Context&) {
+    if (m.config.storage != WaterfallStorage::Float32) {
+        const F32 levels = (storageBytes == sizeof(U16)) ? 65535.0f : 255.0f;
+        const F32 rangeMin = m.config.range.min;
+        const F32 rangeScale = 1.0f / (m.config.range.max - m.config.range.min);
+        F32* values = m.pimpl->row.data();
+
+        for (U64 b = 0; b < numberOfBatches; b++) {
+            const T* in = m.input.buffer.data() + b * numberOfElements;
+            const U64 offset = ((inc + b) % m.config.height) * numberOfElements;
+
+            drawnValues(in, values);
+
+            for (U64 i = 0; i < numberOfElements; i++) {
+                const F32 value = std::clamp((values[i] - rangeMin) * rangeScale, 0.0f, 1.0f) * levels + 0.5f;
+
+                if (storageBytes == sizeof(U16)) {
+                    reinterpret_cast<U16*>(quantizedBins.data())[offset + i] = static_cast<U16>(value);
+                } else {
+                    quantizedBins.data()[offset + i] = static_cast<U8>(value);
+                }
+            }
+        }
+
+        return Result::SUCCESS;
+    }
+
     const auto totalSize = m.input.buffer.size();
     const auto fftSize = numberOfElements;
     const auto offset = inc * fftSize;
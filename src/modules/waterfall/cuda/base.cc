@@ -1,9 +1,27 @@
 #include "../generic.cc"
 
+#include "jetstream/memory/devices/cuda/copy.hh"
+
 namespace Jetstream {
 
 template<Device D, typename T>
-struct Waterfall<D, T>::Impl {};
+struct Waterfall<D, T>::Impl {
+    std::vector<U64> grid;
+    std::vector<U64> block;
+
+    std::vector<void*> arguments;
+
+    Tensor<Device::CUDA, T> input;
+
+    int scaling;
+    int bits;
+    F32 normalization;
+    F32 rangeMin;
+    F32 rangeScale;
+    U64 offset;
+    U64 total;
+    U64 size;
+};
 
 template<Device D, typename T>
 Waterfall<D, T>::Waterfall() {
@@ -17,8 +35,104 @@ Waterfall<D, T>::~Waterfall() {
     gimpl.reset();
 }
 
+template<Device D, typename T>
+Result Waterfall<D, T>::GImpl::underlyingCreateCompute(Waterfall<D, T>& m, const Context& ctx) {
+    if (m.config.storage == WaterfallStorage::Float32) {
+        return Result::SUCCESS;
+    }
+
+    auto& impl = m.pimpl;
+
+    // Create CUDA kernel.
+
+    ctx.cuda->createKernel("quantize", R"""(
+        __global__ void quantize(const float* input, unsigned char* output, int scaling, int bits,
+                                 float normalization, float rangeMin, float rangeScale,
+                                 size_t offset, size_t total, size_t size) {
+            size_t id = blockIdx.x * blockDim.x + threadIdx.x;
+            if (id < size) {
+                float value = input[id];
+                if (scaling == 2) {
+                    float re = input[id * 2];
+                    float im = input[id * 2 + 1];
+                    value = 10.0f * log10f(fmaxf(re * re + im * im, 1e-30f)) + normalization;
+                } else if (scaling == 1) {
+                    value = 10.0f * log10f(fmaxf(value, 1e-30f)) + normalization;
+                }
+                value = fminf(fmaxf((value - rangeMin) * rangeScale, 0.0f), 1.0f);
+
+                size_t index = (offset + id) % total;
+                if (bits == 16) {
+                    reinterpret_cast<unsigned short*>(output)[index] = (unsigned short)(value * 65535.0f + 0.5f);
+                } else {
+                    output[index] = (unsigned char)(value * 255.0f + 0.5f);
+                }
+            }
+        }
+    )""");
+
+    // Initialize kernel size.
+
+    impl->size = numberOfElements * numberOfBatches;
+    impl->total = numberOfElements * m.config.height;
+
+    U64 threadsPerBlock = 512;
+    U64 blocksPerGrid = (impl->size + threadsPerBlock - 1) / threadsPerBlock;
+
+    impl->grid = { blocksPerGrid, 1, 1 };
+    impl->block = { threadsPerBlock, 1, 1 };
+
+    // Initialize kernel input.
+
+    if (!m.input.buffer.device_native() && m.input.buffer.contiguous()) {
+        impl->input = Tensor<Device::CUDA, T>(m.input.buffer.shape());
+    } else {
+        impl->input = m.input.buffer;
+    }
+
+    // Initialize kernel arguments.
+
+    impl->scaling = scaling;
+    impl->bits = (storageBytes == sizeof(U16)) ? 16 : 8;
+    impl->normalization = normalization;
+
+    impl->arguments = {
+        impl->input.data_ptr(),
+        quantizedBins.data_ptr(),
+        &impl->scaling,
+        &impl->bits,
+        &impl->normalization,
+        &impl->rangeMin,
+        &impl->rangeScale,
+        &impl->offset,
+        &impl->total,
+        &impl->size,
+    };
+
+    return Result::SUCCESS;
+}
+
 template<Device D, typename T>
 Result Waterfall<D, T>::GImpl::underlyingCompute(Waterfall<D, T>& m, const Context& ctx) {
+    if (m.config.storage != WaterfallStorage::Float32) {
+        auto& impl = m.pimpl;
+
+        if (!m.input.buffer.device_native() && m.input.buffer.contiguous()) {
+            JST_CHECK(Memory::Copy(impl->input, m.input.buffer, ctx.cuda->stream()));
+        }
+
+        impl->rangeMin = m.config.range.min;
+        impl->rangeScale = 1.0f / (m.config.range.max - m.config.range.min);
+        impl->offset = inc * numberOfElements;
+
+        JST_CHECK(ctx.cuda->launchKernel("quantize",
+                                         impl->grid,
+                                         impl->block,
+                                         impl->arguments.data()));
+
+        return Result::SUCCESS;
+    }
+
     const auto totalSize = m.input.buffer.size_bytes();
     const auto fftSize = numberOfElements * sizeof(T);
     const auto offset = inc * fftSize;
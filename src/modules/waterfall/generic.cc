@@ -1,11 +1,20 @@
 #include "jetstream/modules/waterfall.hh"
 #include "jetstream/render/utils.hh"
 
+#include "jetstream/backend/devices/cpu/simd.hh"
+
 #include "resources/shaders/waterfall_shaders.hh"
 #include "jetstream/constants.hh"
 
 #include "benchmark.cc"
 
+#if defined(JST_OS_LINUX) || defined(JST_OS_ANDROID) || defined(JST_OS_MAC) || defined(JST_OS_IOS)
+#define JST_WATERFALL_HISTORY_MAPPED
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#endif
+
 namespace Jetstream {
 
 template<Device D, typename T>
@@ -18,9 +27,26 @@ struct Waterfall<D, T>::GImpl {
         float offset;
         float zoom;
         bool interpolate;
+        int scaling;
+        float normalization;
+        float rangeMin;
+        float rangeScale;
+        // Zero for floats, one for 16-bit and two for 8-bit values.
+        int storage;
+        // One draws the rows streamed back from the history.
+        int history;
     } signalUniforms;
 
-    Tensor<D, F32> frequencyBins;
+    Tensor<D, T> frequencyBins;
+
+    // Compact history. Rows are quantized on arrival and packed in bytes.
+    Tensor<D, U8> quantizedBins;
+    U64 storageBytes = 0;
+
+    // Zero keeps the values as they are, one converts real power and two
+    // converts complex bins to decibels, normalized as in Amplitude.
+    int scaling = 0;
+    F32 normalization = 0.0f;
 
     std::shared_ptr<Render::Buffer> fillScreenVerticesBuffer;
     std::shared_ptr<Render::Buffer> fillScreenTextureVerticesBuffer;
@@ -41,8 +67,46 @@ struct Waterfall<D, T>::GImpl {
 
     U64 numberOfElements = 0;
     U64 numberOfBatches = 0;
-    int inc = 0, last = 0, ymax = 0;
-
+    int inc = 0, ymax = 0;
+
+    // Rows ever written by compute and uploaded by present. Only the rows in
+    // between are uploaded, the shader scrolls the ring with `index`.
+    U64 written = 0;
+    U64 uploaded = 0;
+
+    // Rows written count published by compute after the rows were written.
+    std::atomic<U64> published{0};
+
+    bool updateSignalUniformBufferFlag = true;
+
+    // Scrollback in a memory-mapped file. Level zero keeps every row as
+    // drawn, in decibels when converted. Each next level keeps the peak of
+    // two rows and two bins of the previous one. Levels are rings of rows
+    // laid one after the other.
+    F32* historyMapping = nullptr;
+    U64 historyMappingSize = 0;
+    std::vector<U64> historyOffsets;
+    std::vector<U64> historyCapacity;
+    std::vector<std::vector<F32>> historyPeaks;
+    std::vector<F32> historyRow;
+    U64 historySpilled = 0;
+    std::atomic<U64> historyPublished{0};
+
+    // Rows streamed back for present, oldest first.
+    std::vector<F32> historyView;
+    std::shared_ptr<Render::Buffer> historyBuffer;
+    U64 historyEnd = 0;
+    bool historyDirty = false;
+
+    // Converts a row to the values drawn, before the range is applied.
+    void drawnValues(const T* input, F32* output) const;
+
+    Result openHistory(const Config& config);
+    void closeHistory();
+    void spillHistory(const T* row);
+    void loadHistory(const Config& config);
+
+    Result underlyingCreateCompute(Waterfall<D, T>& m, const Context& ctx);
     Result underlyingCompute(Waterfall<D, T>& m, const Context& ctx);
 };
 
@@ -64,19 +128,224 @@ Result Waterfall<D, T>::create() {
     gimpl->numberOfElements = input.buffer.shape()[last_axis];
     gimpl->numberOfBatches = (input.buffer.rank() == 2) ? input.buffer.shape()[0] : 1;
 
+    if (gimpl->numberOfBatches > config.height) {
+        JST_ERROR("Input batch size ({}) is larger than the waterfall height ({}).",
+                  gimpl->numberOfBatches, config.height);
+        return Result::ERROR;
+    }
+
+    gimpl->scaling = IsComplex<T>::value ? 2 : (config.decibels ? 1 : 0);
+    gimpl->normalization = 20.0f * log10f(1.0f / gimpl->numberOfElements);
+
     // Allocate internal buffers.
 
-    gimpl->frequencyBins = Tensor<D, F32>({gimpl->numberOfElements, config.height});
+    if (config.storage == WaterfallStorage::Float32) {
+        gimpl->storageBytes = sizeof(T);
+        gimpl->frequencyBins = Tensor<D, T>({gimpl->numberOfElements, config.height});
+    } else {
+        // Rows are written in whole 32-bit words.
+        if ((gimpl->numberOfElements % 4) != 0) {
+            JST_ERROR("Compact waterfall storage needs a multiple of four elements per row ({}).",
+                      gimpl->numberOfElements);
+            return Result::ERROR;
+        }
+
+        gimpl->storageBytes = (config.storage == WaterfallStorage::Unorm16) ? sizeof(U16) : sizeof(U8);
+        gimpl->quantizedBins = Tensor<D, U8>({gimpl->numberOfElements * config.height * gimpl->storageBytes});
+    }
+
+    if (!config.historyPath.empty()) {
+        JST_CHECK(gimpl->openHistory(config));
+    }
+
+    // The history starts empty, there's nothing to scroll back to yet.
+    config.scrollback = 0;
+    config.historyLevel = std::min<U64>(config.historyLevel, std::max<U64>(config.historyLevels, 1) - 1);
 
     return Result::SUCCESS;
 }
 
+template<Device D, typename T>
+Result Waterfall<D, T>::destroy() {
+    JST_DEBUG("Destroying Waterfall module.");
+
+    gimpl->closeHistory();
+
+    return Result::SUCCESS;
+}
+
+template<Device D, typename T>
+void Waterfall<D, T>::GImpl::drawnValues(const T* input, F32* output) const {
+    if constexpr (IsComplex<T>::value) {
+        Backend::ComplexDecibels().kernel()(input, output, numberOfElements, normalization);
+    } else if (scaling == 1) {
+        for (U64 i = 0; i < numberOfElements; i++) {
+            output[i] = Backend::ApproxPowerToDecibels(input[i], normalization);
+        }
+    } else {
+        std::copy(input, input + numberOfElements, output);
+    }
+}
+
+template<Device D, typename T>
+Result Waterfall<D, T>::GImpl::openHistory(const Config& config) {
+    // Rows are read from the input as they arrive, only host memory can be
+    // spilled without waiting for the device.
+    if constexpr (D != Device::CPU) {
+        JST_ERROR("Waterfall history is only available on the CPU.");
+        return Result::ERROR;
+    }
+
+    if (config.historyLevels == 0 || config.historyLevels > 16) {
+        JST_ERROR("Waterfall history needs between 1 and 16 levels ({}).", config.historyLevels);
+        return Result::ERROR;
+    }
+
+    if (config.historyDepth < config.height) {
+        JST_ERROR("Waterfall history depth ({}) is smaller than the height ({}).",
+                  config.historyDepth, config.height);
+        return Result::ERROR;
+    }
+
+    if ((numberOfElements % (1ULL << (config.historyLevels - 1))) != 0) {
+        JST_ERROR("Waterfall history with {} levels needs a multiple of {} elements per row ({}).",
+                  config.historyLevels, 1ULL << (config.historyLevels - 1), numberOfElements);
+        return Result::ERROR;
+    }
+
+    // Lay out the levels.
+
+    U64 size = 0;
+    for (U64 level = 0; level < config.historyLevels; level++) {
+        const U64 width = numberOfElements >> level;
+
+        historyOffsets.push_back(size);
+        historyCapacity.push_back(std::max<U64>(config.historyDepth >> level, 1));
+        historyPeaks.emplace_back(width, std::numeric_limits<F32>::lowest());
+
+        size += historyCapacity.back() * width;
+    }
+    historyRow.resize(numberOfElements);
+
+#ifdef JST_WATERFALL_HISTORY_MAPPED
+    const int fd = open(config.historyPath.c_str(), O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if (fd < 0) {
+        JST_ERROR("Failed to open waterfall history '{}'.", config.historyPath);
+        return Result::ERROR;
+    }
+
+    // The file is sparse, pages are only allocated as rows are spilled.
+    historyMappingSize = size * sizeof(F32);
+    if (ftruncate(fd, historyMappingSize) != 0) {
+        close(fd);
+        JST_ERROR("Failed to resize waterfall history '{}' to {} bytes.", config.historyPath, historyMappingSize);
+        return Result::ERROR;
+    }
+
+    void* address = mmap(nullptr, historyMappingSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+
+    if (address == MAP_FAILED) {
+        JST_ERROR("Failed to map waterfall history '{}'.", config.historyPath);
+        return Result::ERROR;
+    }
+
+    historyMapping = static_cast<F32*>(address);
+
+    JST_DEBUG("Mapped {} bytes of waterfall history to '{}'.", historyMappingSize, config.historyPath);
+
+    return Result::SUCCESS;
+#else
+    JST_ERROR("Waterfall history isn't supported on this platform.");
+    return Result::ERROR;
+#endif
+}
+
+template<Device D, typename T>
+void Waterfall<D, T>::GImpl::closeHistory() {
+#ifdef JST_WATERFALL_HISTORY_MAPPED
+    if (historyMapping) {
+        munmap(historyMapping, historyMappingSize);
+        historyMapping = nullptr;
+    }
+#endif
+}
+
+template<Device D, typename T>
+void Waterfall<D, T>::GImpl::spillHistory(const T* row) {
+    drawnValues(row, historyRow.data());
+
+    const U64 rows = historySpilled + 1;
+
+    for (U64 level = 0; level < historyPeaks.size(); level++) {
+        const U64 factor = 1ULL << level;
+        auto& peaks = historyPeaks[level];
+
+        for (U64 i = 0; i < peaks.size(); i++) {
+            const F32* bins = historyRow.data() + i * factor;
+            peaks[i] = std::max(peaks[i], *std::max_element(bins, bins + factor));
+        }
+
+        // Write the row of the level once all of its rows arrived.
+
+        if ((rows % factor) != 0) {
+            continue;
+        }
+
+        const U64 slot = ((rows >> level) - 1) % historyCapacity[level];
+        std::copy(peaks.begin(), peaks.end(), historyMapping + historyOffsets[level] + slot * peaks.size());
+        std::fill(peaks.begin(), peaks.end(), std::numeric_limits<F32>::lowest());
+    }
+
+    historySpilled = rows;
+}
+
+template<Device D, typename T>
+void Waterfall<D, T>::GImpl::loadHistory(const Config& config) {
+    const U64 level = config.historyLevel;
+    const U64 width = numberOfElements >> level;
+    const U64 capacity = historyCapacity[level];
+    const U64 available = historyPublished.load(std::memory_order_acquire) >> level;
+
+    // The oldest rows are skipped, compute may be overwriting them.
+    const U64 first = (available > capacity) ? available - capacity + (capacity >> 4) : 0;
+    const F32 empty = (scaling == 0) ? 0.0f : std::numeric_limits<F32>::lowest();
+
+    const U64 height = config.height;
+    const U64 start = (historyEnd > height) ? historyEnd - height : 0;
+    const U64 padding = height - (historyEnd - start);
+
+    F32* view = historyView.data();
+    std::fill(view, view + padding * width, empty);
+
+    for (U64 row = start; row < historyEnd; row++) {
+        F32* line = view + (padding + row - start) * width;
+
+        if (row < first || row >= available) {
+            std::fill(line, line + width, empty);
+            continue;
+        }
+
+        const F32* stored = historyMapping + historyOffsets[level] + (row % capacity) * width;
+        std::copy(stored, stored + width, line);
+    }
+
+    historyBuffer->update(0, height * width);
+}
+
 template<Device D, typename T>
 void Waterfall<D, T>::info() const {
     JST_DEBUG("  Offset:       {}", config.offset);
     JST_DEBUG("  Zoom:         {}", config.zoom);
     JST_DEBUG("  Interpolate:  {}", config.interpolate ? "YES" : "NO");
     JST_DEBUG("  Height:       {}", config.height);
+    JST_DEBUG("  Decibels:     {}", (config.decibels || IsComplex<T>::value) ? "YES" : "NO");
+    JST_DEBUG("  Range:        [{}, {}] dBFS", config.range.min, config.range.max);
+    JST_DEBUG("  Storage:      {}", config.storage);
+    if (!config.historyPath.empty()) {
+        JST_DEBUG("  History:      '{}' ({} rows, {} levels)", config.historyPath,
+                  config.historyDepth, config.historyLevels);
+    }
     JST_DEBUG("  Window Size:  [{}, {}]", config.viewSize.x, config.viewSize.y);
 }
 
@@ -132,18 +401,33 @@ Result Waterfall<D, T>::createPresent() {
     }
 
     {
-        auto [buffer, enableZeroCopy] = ConvertToOptimalStorage(window, gimpl->frequencyBins);
+        auto [buffer, enableZeroCopy] = (config.storage == WaterfallStorage::Float32) ?
+                                            ConvertToOptimalStorage(window, gimpl->frequencyBins) :
+                                            ConvertToOptimalStorage(window, gimpl->quantizedBins);
 
         Render::Buffer::Config cfg;
         cfg.buffer = buffer;
-        cfg.size = gimpl->frequencyBins.size();
-        cfg.elementByteSize = sizeof(F32);
+        cfg.size = gimpl->numberOfElements * config.height;
+        cfg.elementByteSize = gimpl->storageBytes;
         cfg.target = Render::Buffer::Target::STORAGE;
         cfg.enableZeroCopy = enableZeroCopy;
         JST_CHECK(window->build(gimpl->signalBuffer, cfg));
         JST_CHECK(window->bind(gimpl->signalBuffer));
     }
 
+    {
+        // Unused without history, but the program always binds it.
+        gimpl->historyView.resize(gimpl->historyMapping ? gimpl->numberOfElements * config.height : 1);
+
+        Render::Buffer::Config cfg;
+        cfg.buffer = gimpl->historyView.data();
+        cfg.size = gimpl->historyView.size();
+        cfg.elementByteSize = sizeof(F32);
+        cfg.target = Render::Buffer::Target::STORAGE;
+        JST_CHECK(window->build(gimpl->historyBuffer, cfg));
+        JST_CHECK(window->bind(gimpl->historyBuffer));
+    }
+
     {
         Render::Texture::Config cfg;
         cfg.size = {256, 1};
@@ -173,6 +457,7 @@ Result Waterfall<D, T>::createPresent() {
             {gimpl->signalUniformBuffer, Render::Program::Target::VERTEX |
                             Render::Program::Target::FRAGMENT},
             {gimpl->signalBuffer, Render::Program::Target::FRAGMENT},
+            {gimpl->historyBuffer, Render::Program::Target::FRAGMENT},
         };
         JST_CHECK(window->build(gimpl->signalProgram, cfg));
     }
@@ -205,6 +490,7 @@ Result Waterfall<D, T>::destroyPresent() {
     JST_CHECK(window->unbind(gimpl->fillScreenTextureVerticesBuffer));
     JST_CHECK(window->unbind(gimpl->fillScreenIndicesBuffer));
     JST_CHECK(window->unbind(gimpl->signalBuffer));
+    JST_CHECK(window->unbind(gimpl->historyBuffer));
     JST_CHECK(window->unbind(gimpl->signalUniformBuffer));
 
     return Result::SUCCESS;
@@ -212,50 +498,102 @@ Result Waterfall<D, T>::destroyPresent() {
 
 template<Device D, typename T>
 Result Waterfall<D, T>::present() {
-    int start = gimpl->last;
-    int blocks = (gimpl->inc - gimpl->last);
+    const U64 written = gimpl->published.load(std::memory_order_acquire);
+    const U64 height = config.height;
+    const U64 head = written % height;
 
-    // TODO: Fix this horrible thing.
-    if (blocks < 0) {
-        blocks = config.height - gimpl->last;
+    // Upload only the rows written since the last frame. Rows overwritten
+    // before being presented are skipped. Zero-copy buffers ignore updates.
 
-        gimpl->signalBuffer->update(start * gimpl->numberOfElements, blocks * gimpl->numberOfElements);
+    const U64 pending = std::min(written - gimpl->uploaded, height);
 
-        start = 0;
-        blocks = gimpl->inc;
+    if (pending > 0) {
+        const U64 start = (written - pending) % height;
+        const U64 rows = std::min(pending, height - start);
+
+        JST_CHECK(gimpl->signalBuffer->update(start * gimpl->numberOfElements, rows * gimpl->numberOfElements));
+
+        if (rows < pending) {
+            JST_CHECK(gimpl->signalBuffer->update(0, (pending - rows) * gimpl->numberOfElements));
+        }
     }
 
-    gimpl->signalBuffer->update(start * gimpl->numberOfElements, blocks * gimpl->numberOfElements);
-    gimpl->last = gimpl->inc;
+    gimpl->uploaded = written;
+
+    // Stream the rows of the scrollback back once per change. The live rows
+    // keep being uploaded meanwhile, so returning to them is immediate.
+
+    const bool scrolled = gimpl->historyMapping && config.scrollback > 0;
+
+    if (gimpl->historyDirty) {
+        gimpl->historyDirty = false;
+
+        if (scrolled) {
+            const U64 available = gimpl->historyPublished.load(std::memory_order_acquire) >> config.historyLevel;
+            gimpl->historyEnd = available - std::min(config.scrollback, available);
+            gimpl->loadHistory(config);
+        }
+
+        gimpl->updateSignalUniformBufferFlag = true;
+    }
+
+    // Draw only when rows or settings changed.
+
+    if ((pending == 0 || scrolled) && !gimpl->updateSignalUniformBufferFlag) {
+        return Result::SUCCESS;
+    }
+    gimpl->updateSignalUniformBufferFlag = false;
 
     gimpl->signalUniforms.zoom = config.zoom;
-    gimpl->signalUniforms.width = gimpl->numberOfElements;
+    gimpl->signalUniforms.width = scrolled ? (gimpl->numberOfElements >> config.historyLevel) : gimpl->numberOfElements;
     gimpl->signalUniforms.height = config.height;
     gimpl->signalUniforms.interpolate = config.interpolate;
-    gimpl->signalUniforms.index = gimpl->inc / (float)gimpl->signalUniforms.height;
+    gimpl->signalUniforms.index = scrolled ? 0.0f : head / (float)gimpl->signalUniforms.height;
     gimpl->signalUniforms.offset = config.offset / (float)config.viewSize.x;
     gimpl->signalUniforms.maxSize = gimpl->signalUniforms.width * gimpl->signalUniforms.height;
 
+    gimpl->signalUniforms.scaling = gimpl->scaling;
+    gimpl->signalUniforms.normalization = gimpl->normalization;
+    gimpl->signalUniforms.rangeMin = config.range.min;
+    gimpl->signalUniforms.rangeScale = 1.0f / (config.range.max - config.range.min);
+    gimpl->signalUniforms.storage = (config.storage == WaterfallStorage::Unorm16) ? 1 :
+                                    (config.storage == WaterfallStorage::Unorm8) ? 2 : 0;
+    gimpl->signalUniforms.history = scrolled ? 1 : 0;
+
     gimpl->signalUniformBuffer->update();
+    gimpl->surface->update();
 
     return Result::SUCCESS;
 }
 
 template<Device D, typename T>
-Result Waterfall<D, T>::createCompute(const Context&) {
-    return Result::SUCCESS;
+Result Waterfall<D, T>::createCompute(const Context& ctx) {
+    return gimpl->underlyingCreateCompute(*this, ctx);
 }
 
 template<Device D, typename T>
 Result Waterfall<D, T>::compute(const Context& ctx) {
     auto res = gimpl->underlyingCompute(*this, ctx);
+
+    if constexpr (D == Device::CPU) {
+        if (gimpl->historyMapping) {
+            for (U64 b = 0; b < gimpl->numberOfBatches; b++) {
+                gimpl->spillHistory(input.buffer.data() + b * gimpl->numberOfElements);
+            }
+            gimpl->historyPublished.store(gimpl->historySpilled, std::memory_order_release);
+        }
+    }
+
     gimpl->inc = (gimpl->inc + gimpl->numberOfBatches) % config.height;
+    gimpl->written += gimpl->numberOfBatches;
+    gimpl->published.store(gimpl->written, std::memory_order_release);
     return res;
 }
 
 template<Device D, typename T>
 const bool& Waterfall<D, T>::interpolate(const bool& val) {
     config.interpolate = val;
+    gimpl->updateSignalUniformBufferFlag = true;
     return interpolate();
 }
 
@@ -270,9 +608,41 @@ template<Device D, typename T>
 const I32& Waterfall<D, T>::offset(const I32& offset) {
     config.offset = std::clamp(offset, 0,
             (I32)(config.viewSize.x - (config.viewSize.x / config.zoom)));
+    gimpl->updateSignalUniformBufferFlag = true;
     return config.offset;
 }
 
+template<Device D, typename T>
+const Range<F32>& Waterfall<D, T>::range(const Range<F32>& range) {
+    config.range = range;
+    gimpl->updateSignalUniformBufferFlag = true;
+    return config.range;
+}
+
+template<Device D, typename T>
+const U64& Waterfall<D, T>::scrollback(const U64& scrollback) {
+    config.scrollback = std::min(scrollback, historyRows());
+    gimpl->historyDirty = true;
+    return config.scrollback;
+}
+
+template<Device D, typename T>
+const U64& Waterfall<D, T>::historyLevel(const U64& historyLevel) {
+    config.historyLevel = std::min<U64>(historyLevel, std::max<U64>(gimpl->historyCapacity.size(), 1) - 1);
+    gimpl->historyDirty = true;
+    return config.historyLevel;
+}
+
+template<Device D, typename T>
+U64 Waterfall<D, T>::historyRows() const {
+    if (!gimpl->historyMapping) {
+        return 0;
+    }
+
+    const U64 available = gimpl->historyPublished.load(std::memory_order_acquire) >> config.historyLevel;
+    return std::min(available, gimpl->historyCapacity[config.historyLevel]);
+}
+
 template<Device D, typename T>
 const Extent2D<U64>& Waterfall<D, T>::viewSize(const Extent2D<U64>& viewSize) {
     if (gimpl->surface->size(viewSize) != this->viewSize()) {
@@ -283,6 +653,7 @@ const Extent2D<U64>& Waterfall<D, T>::viewSize(const Extent2D<U64>& viewSize) {
                 viewSize.y);
 
         config.viewSize = gimpl->surface->size();
+        gimpl->updateSignalUniformBufferFlag = true;
     }
     return this->viewSize();
 }
@@ -2,8 +2,59 @@
 
 namespace Jetstream {
 
+static const char shadersSrc[] = R"""(
+    #include <metal_stdlib>
+    #include <metal_math>
+
+    using namespace metal;
+
+    struct Constants {
+        int scaling;
+        int bits;
+        float normalization;
+        float rangeMin;
+        float rangeScale;
+        uint offset;
+        uint total;
+    };
+
+    kernel void quantize(constant Constants& constants [[ buffer(0) ]],
+                         constant const float *input [[ buffer(1) ]],
+                         device uchar *output [[ buffer(2) ]],
+                         uint id[[ thread_position_in_grid ]]) {
+        float value = input[id];
+        if (constants.scaling == 2) {
+            float2 bin = float2(input[id * 2], input[id * 2 + 1]);
+            value = 10.0 * log10(max(dot(bin, bin), 1e-30)) + constants.normalization;
+        } else if (constants.scaling == 1) {
+            value = 10.0 * log10(max(value, 1e-30)) + constants.normalization;
+        }
+        value = clamp((value - constants.rangeMin) * constants.rangeScale, 0.0, 1.0);
+
+        uint index = (constants.offset + id) % constants.total;
+        if (constants.bits == 16) {
+            reinterpret_cast<device ushort*>(output)[index] = ushort(value * 65535.0 + 0.5);
+        } else {
+            output[index] = uchar(value * 255.0 + 0.5);
+        }
+    }
+)""";
+
 template<Device D, typename T>
-struct Waterfall<D, T>::Impl {};
+struct Waterfall<D, T>::Impl {
+    struct Constants {
+        I32 scaling;
+        I32 bits;
+        F32 normalization;
+        F32 rangeMin;
+        F32 rangeScale;
+        U32 offset;
+        U32 total;
+    };
+
+    MTL::ComputePipelineState* state;
+    Tensor<Device::Metal, U8> constants;
+};
 
 template<Device D, typename T>
 Waterfall<D, T>::Waterfall() {
@@ -17,8 +68,43 @@ Waterfall<D, T>::~Waterfall() {
     gimpl.reset();
 }
 
+template<Device D, typename T>
+Result Waterfall<D, T>::GImpl::underlyingCreateCompute(Waterfall<D, T>& m, const Context&) {
+    if (m.config.storage == WaterfallStorage::Float32) {
+        return Result::SUCCESS;
+    }
+
+    JST_CHECK(Metal::CompileKernel(shadersSrc, "quantize", &m.pimpl->state));
+
+    auto* constants = Metal::CreateConstants<typename Impl::Constants>(*m.pimpl);
+    constants->scaling = scaling;
+    constants->bits = (storageBytes == sizeof(U16)) ? 16 : 8;
+    constants->normalization = normalization;
+    constants->total = numberOfElements * m.config.height;
+
+    return Result::SUCCESS;
+}
+
 template<Device D, typename T>
 Result Waterfall<D, T>::GImpl::underlyingCompute(Waterfall<D, T>& m, const Context& ctx) {
+    if (m.config.storage != WaterfallStorage::Float32) {
+        auto* constants = Metal::Constants<typename Impl::Constants>(*m.pimpl);
+        constants->rangeMin = m.config.range.min;
+        constants->rangeScale = 1.0f / (m.config.range.max - m.config.range.min);
+        constants->offset = inc * numberOfElements;
+
+        auto cmdEncoder = ctx.metal->commandBuffer()->computeCommandEncoder();
+        cmdEncoder->setComputePipelineState(m.pimpl->state);
+        cmdEncoder->setBuffer(m.pimpl->constants.data(), 0, 0);
+        cmdEncoder->setBuffer(m.input.buffer.data(), 0, 1);
+        cmdEncoder->setBuffer(quantizedBins.data(), 0, 2);
+        cmdEncoder->dispatchThreads(MTL::Size(numberOfElements * numberOfBatches, 1, 1),
+                                    MTL::Size(m.pimpl->state->maxTotalThreadsPerThreadgroup(), 1, 1));
+        cmdEncoder->endEncoding();
+
+        return Result::SUCCESS;
+    }
+
     auto blitEncoder = ctx.metal->commandBuffer()->blitCommandEncoder();
 
     auto batchByteSize = m.input.buffer.size_bytes();
@@ -0,0 +1,107 @@
+#include "../generic.cc"
+
+namespace Jetstream {
+
+template<Device D, typename T>
+struct Waterfall<D, T>::Impl {
+    struct Constants {
+        I32 scaling;
+        I32 bits;
+        F32 normalization;
+        F32 rangeMin;
+        F32 rangeScale;
+        U32 offset;
+        U32 total;
+        U32 numberOfWords;
+    };
+
+    Constants constants;
+    std::vector<U64> grid;
+};
+
+template<Device D, typename T>
+Waterfall<D, T>::Waterfall() {
+    pimpl = std::make_unique<Impl>();
+    gimpl = std::make_unique<GImpl>();
+}
+
+template<Device D, typename T>
+Waterfall<D, T>::~Waterfall() {
+    pimpl.reset();
+    gimpl.reset();
+}
+
+template<Device D, typename T>
+Result Waterfall<D, T>::GImpl::underlyingCreateCompute(Waterfall<D, T>& m, const Context& ctx) {
+    if (m.config.storage == WaterfallStorage::Float32) {
+        return Result::SUCCESS;
+    }
+
+    // Offsets are counted in words, each row fills a whole number of them.
+
+    auto& constants = m.pimpl->constants;
+    constants.scaling = scaling;
+    constants.bits = (storageBytes == sizeof(U16)) ? 16 : 8;
+    constants.normalization = normalization;
+    constants.total = (numberOfElements * m.config.height * storageBytes) / sizeof(U32);
+    constants.numberOfWords = (numberOfElements * numberOfBatches * storageBytes) / sizeof(U32);
+    m.pimpl->grid = { (constants.numberOfWords + 255) / 256, 1, 1 };
+
+    JST_CHECK(ctx.vulkan->createKernel("quantize",
+                                       KernelsPackage["quantize"][Device::Vulkan][0],
+                                       {
+                                           m.input.buffer.data(),
+                                           quantizedBins.data(),
+                                       },
+                                       sizeof(typename Impl::Constants)));
+
+    return Result::SUCCESS;
+}
+
+template<Device D, typename T>
+Result Waterfall<D, T>::GImpl::underlyingCompute(Waterfall<D, T>& m, const Context& ctx) {
+    if (m.config.storage != WaterfallStorage::Float32) {
+        auto& constants = m.pimpl->constants;
+        constants.rangeMin = m.config.range.min;
+        constants.rangeScale = 1.0f / (m.config.range.max - m.config.range.min);
+        constants.offset = (inc * numberOfElements * storageBytes) / sizeof(U32);
+
+        JST_CHECK(ctx.vulkan->dispatchKernel("quantize", m.pimpl->grid, &constants));
+
+        return Result::SUCCESS;
+    }
+
+    const auto totalSize = m.input.buffer.size_bytes();
+    const auto fftSize = numberOfElements * sizeof(T);
+    const auto offset = inc * fftSize;
+    const auto size = JST_MIN(totalSize, (m.config.height - inc) * fftSize);
+
+    std::vector<VkBufferCopy> regions;
+
+    VkBufferCopy head{};
+    head.srcOffset = 0;
+    head.dstOffset = offset;
+    head.size = size;
+    regions.push_back(head);
+
+    if (size < totalSize) {
+        VkBufferCopy tail{};
+        tail.srcOffset = size;
+        tail.dstOffset = 0;
+        tail.size = totalSize - size;
+        regions.push_back(tail);
+    }
+
+    vkCmdCopyBuffer(ctx.vulkan->commandBuffer(),
+                    m.input.buffer.data(),
+                    frequencyBins.data(),
+                    regions.size(),
+                    regions.data());
+
+    return Result::SUCCESS;
+}
+
+JST_WATERFALL_VULKAN(JST_INSTANTIATION)
+JST_WATERFALL_VULKAN(JST_BENCHMARK)
+
+}  // namespace Jetstream
@@ -1,10 +1,11 @@
 #include "jetstream/modules/window.hh"
+#include "jetstream/memory/utils/coefficient_cache.hh"
 
 namespace Jetstream {
 
 template<Device D, typename T>
 struct Window<D, T>::Impl {
-    bool baked = false;
+    typename Memory::CoefficientCache<T>::Coefficients coeffs;
 };
 
 template<Device D, typename T>
@@ -25,30 +26,34 @@ Result Window<D, T>::create() {
     // Allocate output.
     output.window = Tensor<D, T>({config.size});
 
-    // Configure initial state.
-    impl->baked = false;
+    // Generate FFT window, or pick it up from another block of the same size.
+
+    const U64 size = config.size;
+    impl->coeffs = Memory::CoefficientCache<T>::Get(jst::fmt::format("window:blackman:{}", size), [&]{
+        std::vector<T> window(size);
+        for (U64 i = 0; i < size; i++) {
+            F64 tap = 0.42 - 0.50 * std::cos(2.0 * JST_PI * i / (size - 1)) + \
+                      0.08 * std::cos(4.0 * JST_PI * i / (size - 1));
+            window[i] = T(tap, 0.0);
+        }
+        return window;
+    });
 
     return Result::SUCCESS;
 }
 
 template<Device D, typename T>
-Result Window<D, T>::compute(const Context&) {
-    if (impl->baked) {
-        return Result::SUCCESS;
-    }
-
-    // Generate FFT window.
+Result Window<D, T>::createCompute(const Context&) {
+    // The window is constant, so it's written once before the first frame.
 
     auto& window = MapOn<Device::CPU>(output.window);
+    std::copy(impl->coeffs->begin(), impl->coeffs->end(), window.data());
 
-    for (U64 i = 0; i < output.window.size(); i++) {
-        F64 tap = 0.42 - 0.50 * std::cos(2.0 * JST_PI * i / (output.window.size() - 1)) + \
-                  0.08 * std::cos(4.0 * JST_PI * i / (output.window.size() - 1));
-        window[i] = T(tap, 0.0);
-    }
-
-    impl->baked = true;
+    return Result::SUCCESS;
+}
 
+template<Device D, typename T>
+Result Window<D, T>::compute(const Context&) {
     return Result::SUCCESS;
 }
 
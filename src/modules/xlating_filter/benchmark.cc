@@ -0,0 +1,20 @@
+#include "jetstream/modules/xlating_filter.hh"
+
+namespace Jetstream {
+
+template<template<Device, typename...> class Module, Device D, typename T>
+void benchmark(ankerl::nanobench::Bench& bench, std::string name) {
+    JST_BENCHMARK_RUN("65536 (101 taps, 1/4)", {}, {
+        .buffer = Tensor<D COMMA T>({65536}) COMMA
+        .filter = Tensor<D COMMA T>({1 COMMA 101}) COMMA
+    }, T);
+
+    JST_BENCHMARK_RUN("65536 (4x101 taps, 1/16)", {
+        .decimation = 16 COMMA
+    }, {
+        .buffer = Tensor<D COMMA T>({65536}) COMMA
+        .filter = Tensor<D COMMA T>({4 COMMA 101}) COMMA
+    }, T);
+}
+
+}  // namespace Jetstream
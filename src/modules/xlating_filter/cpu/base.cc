@@ -0,0 +1,119 @@
+#include "../generic.cc"
+
+#include "jetstream/memory/devices/cpu/helpers.hh"
+#include "jetstream/backend/devices/cpu/simd.hh"
+
+namespace Jetstream {
+
+template<Device D, typename T>
+struct XlatingFilter<D, T>::Impl {
+    U64 heads = 1;
+    U64 numberOfTaps = 0;
+    U64 inputSize = 0;
+    U64 outputSize = 0;
+
+    // Rotation of each head in radians per sample and its phase at the start
+    // of the buffer.
+    std::vector<F64> frequencies;
+    std::vector<F64> phases;
+
+    // Real and imaginary parts of the taps of every head, reversed and
+    // duplicated for both parts of a sample. A complex tap dot product is
+    // then two real tap dot products.
+    std::vector<F32> realWeights;
+    std::vector<F32> imagWeights;
+
+    // Last taps - 1 samples followed by the current buffer, oldest first.
+    std::vector<CF32> samples;
+};
+
+template<Device D, typename T>
+XlatingFilter<D, T>::XlatingFilter() {
+    impl = std::make_unique<Impl>();
+}
+
+template<Device D, typename T>
+XlatingFilter<D, T>::~XlatingFilter() {
+    impl.reset();
+}
+
+template<Device D, typename T>
+Result XlatingFilter<D, T>::createCompute(const Context&) {
+    JST_TRACE("Create Xlating Filter compute core using CPU backend.");
+
+    impl->realWeights.resize(impl->heads * 2 * impl->numberOfTaps);
+    impl->imagWeights.resize(impl->heads * 2 * impl->numberOfTaps);
+    impl->samples.assign(impl->numberOfTaps - 1 + impl->inputSize, CF32(0.0f, 0.0f));
+
+    JST_TRACE("[XLATING_FILTER] Heads: {}; Kernel: {};", impl->heads, Backend::ComplexFirDot().name());
+
+    return Result::SUCCESS;
+}
+
+template<Device D, typename T>
+Result XlatingFilter<D, T>::compute(const Context& ctx) {
+    const U64 heads = impl->heads;
+    const U64 numberOfTaps = impl->numberOfTaps;
+    const U64 decimation = config.decimation;
+    const U64 outputSize = impl->outputSize;
+    const U64 historySize = numberOfTaps - 1;
+
+    // Taps are produced upstream and may change between buffers.
+
+    const T* filter = input.filter.data() + input.filter.offset();
+    for (U64 c = 0; c < heads; c++) {
+        F32* re = impl->realWeights.data() + c * 2 * numberOfTaps;
+        F32* im = impl->imagWeights.data() + c * 2 * numberOfTaps;
+
+        for (U64 j = 0; j < numberOfTaps; j++) {
+            const T& tap = filter[c * numberOfTaps + numberOfTaps - 1 - j];
+            re[2 * j + 0] = re[2 * j + 1] = tap.real();
+            im[2 * j + 0] = im[2 * j + 1] = tap.imag();
+        }
+    }
+
+    CF32* samples = impl->samples.data();
+    std::copy_n(input.buffer.data() + input.buffer.offset(), impl->inputSize, samples + historySize);
+
+    T* out = output.buffer.data();
+    const auto dot = Backend::ComplexFirDot().kernel();
+
+    // Only the kept outputs are filtered, then each is rotated back to
+    // baseband by its absolute sample position.
+
+    const U64 chunks = (output.buffer.size() * numberOfTaps) / Memory::CPU::ParallelIteratorGrain;
+
+    Memory::CPU::ParallelRanges(ctx.cpu->pool(), outputSize, chunks, [&](const U64& begin, const U64& end) {
+        for (U64 m = begin; m < end; m++) {
+            const CF32* window = samples + m * decimation + decimation - 1;
+            const F64 position = static_cast<F64>(m * decimation + decimation - 1);
+
+            for (U64 c = 0; c < heads; c++) {
+                const CF32 a = dot(impl->realWeights.data() + c * 2 * numberOfTaps, window, numberOfTaps);
+                const CF32 b = dot(impl->imagWeights.data() + c * 2 * numberOfTaps, window, numberOfTaps);
+                const CF32 y(a.real() - b.imag(), a.imag() + b.real());
+
+                const F64 phase = impl->phases[c] - impl->frequencies[c] * position;
+                const CF32 rotation(std::cos(phase), std::sin(phase));
+
+                out[c * outputSize + m] = y * rotation;
+            }
+        }
+    });
+
+    // Keep the tail as the history of the next buffer.
+
+    std::copy(samples + impl->inputSize, samples + impl->inputSize + historySize, samples);
+
+    for (U64 c = 0; c < heads; c++) {
+        const F64 phase = impl->phases[c] - impl->frequencies[c] * static_cast<F64>(impl->inputSize);
+        impl->phases[c] = std::fmod(phase, 2.0 * JST_PI);
+    }
+
+    return Result::SUCCESS;
+}
+
+JST_XLATING_FILTER_CPU(JST_INSTANTIATION)
+JST_XLATING_FILTER_CPU(JST_BENCHMARK)
+
+}  // namespace Jetstream
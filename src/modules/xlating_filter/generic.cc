@@ -0,0 +1,80 @@
+#include "jetstream/modules/xlating_filter.hh"
+
+#include "benchmark.cc"
+
+namespace Jetstream {
+
+template<Device D, typename T>
+Result XlatingFilter<D, T>::create() {
+    JST_DEBUG("Initializing Xlating Filter module.");
+    JST_INIT_IO();
+
+    // Check parameters.
+
+    if (config.decimation == 0) {
+        JST_ERROR("Decimation should be positive.");
+        return Result::ERROR;
+    }
+
+    if (input.buffer.size() == 0 || (input.buffer.size() % config.decimation) != 0) {
+        JST_ERROR("Input size ({}) should be a multiple of the decimation ({}).",
+                  input.buffer.size(), config.decimation);
+        return Result::ERROR;
+    }
+
+    if (input.filter.rank() != 1 && input.filter.rank() != 2) {
+        JST_ERROR("Filter should have one or two dimensions, got {}.", input.filter.rank());
+        return Result::ERROR;
+    }
+
+    if (input.filter.shape()[input.filter.rank() - 1] == 0) {
+        JST_ERROR("Filter should have at least one tap.");
+        return Result::ERROR;
+    }
+
+    // Calculate parameters.
+
+    impl->heads = (input.filter.rank() == 2) ? input.filter.shape()[0] : 1;
+    impl->numberOfTaps = input.filter.shape()[input.filter.rank() - 1];
+    impl->inputSize = input.buffer.size();
+    impl->outputSize = impl->inputSize / config.decimation;
+
+    // The taps are band-pass filters centered on each head. The matching
+    // rotation back to baseband comes from the attributes set by Filter Taps.
+
+    impl->frequencies.assign(impl->heads, 0.0);
+    impl->phases.assign(impl->heads, 0.0);
+
+    const auto& attributes = input.filter.attributes();
+
+    if (attributes.contains("center") && attributes.contains("sample_rate")) {
+        const auto& center = input.filter.attribute("center").template get<std::vector<F32>>();
+        const auto& sampleRate = input.filter.attribute("sample_rate").template get<F32>();
+
+        if (center.size() != impl->heads) {
+            JST_ERROR("Filter has {} heads but {} center frequencies.", impl->heads, center.size());
+            return Result::ERROR;
+        }
+
+        for (U64 c = 0; c < impl->heads; c++) {
+            impl->frequencies[c] = 2.0 * JST_PI * center[c] / sampleRate;
+        }
+    } else {
+        JST_WARN("Filter is not passing center frequencies. Output won't be translated.");
+    }
+
+    // Allocate output.
+
+    output.buffer = Tensor<D, T>({impl->heads, impl->outputSize});
+
+    return Result::SUCCESS;
+}
+
+template<Device D, typename T>
+void XlatingFilter<D, T>::info() const {
+    JST_DEBUG("  Decimation: {}", config.decimation);
+    JST_DEBUG("  Heads:      {}", impl->heads);
+    JST_DEBUG("  Taps:       {}", impl->numberOfTaps);
+}
+
+}  // namespace Jetstream
@@ -13,6 +13,8 @@ Result OpenUrl(const std::string& url);
 Result PickFile(std::string& path, const std::vector<std::string>& extensions);
 Result PickFolder(std::string& path);
 Result SaveFile(std::string& path);
+U64 ThermalState();
+bool LowPowerMode();
 
 }  // namespace Jetstream::Platform
 
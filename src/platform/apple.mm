@@ -140,4 +140,25 @@ Result SaveFile(std::string& path) {
     return result;
 }
 
+U64 ThermalState() {
+    switch ([[NSProcessInfo processInfo] thermalState]) {
+        case NSProcessInfoThermalStateNominal:
+            return 0;
+        case NSProcessInfoThermalStateFair:
+            return 1;
+        case NSProcessInfoThermalStateSerious:
+            return 2;
+        case NSProcessInfoThermalStateCritical:
+            return 3;
+    }
+    return 0;
+}
+
+bool LowPowerMode() {
+    if (@available(macOS 12.0, iOS 9.0, *)) {
+        return [[NSProcessInfo processInfo] isLowPowerModeEnabled];
+    }
+    return false;
+}
+
 }  // namespace Jetstream::Platform
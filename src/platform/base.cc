@@ -1,3 +1,7 @@
+#include <cstdlib>
+#include <fstream>
+#include <filesystem>
+
 #include "jetstream/platform.hh"
 
 #if defined(JST_OS_IOS) || defined(JST_OS_MAC)
@@ -496,4 +500,169 @@ Result SaveFile(std::string& path) {
 
 #endif
 
+//
+// Cache Folder
+//
+
+#if defined(JST_OS_BROWSER) || defined(JST_OS_IOS)
+
+Result CacheFolder(std::string&) {
+    return Result::ERROR;
+}
+
+#else
+
+Result CacheFolder(std::string& path) {
+    std::filesystem::path base;
+
+#if defined(JST_OS_WINDOWS)
+    if (const char* localAppData = std::getenv("LOCALAPPDATA")) {
+        base = std::filesystem::path(localAppData) / "CyberEther";
+    }
+#elif defined(JST_OS_MAC)
+    if (const char* home = std::getenv("HOME")) {
+        base = std::filesystem::path(home) / "Library" / "Caches" / "CyberEther";
+    }
+#else
+    if (const char* xdgCache = std::getenv("XDG_CACHE_HOME"); xdgCache && *xdgCache) {
+        base = std::filesystem::path(xdgCache) / "cyberether";
+    } else if (const char* home = std::getenv("HOME")) {
+        base = std::filesystem::path(home) / ".cache" / "cyberether";
+    }
+#endif
+
+    if (base.empty()) {
+        JST_DEBUG("Can't find the user cache folder.");
+        return Result::ERROR;
+    }
+
+    std::error_code ec;
+    std::filesystem::create_directories(base, ec);
+    if (ec) {
+        JST_DEBUG("Can't create the cache folder '{}': {}", base.string(), ec.message());
+        return Result::ERROR;
+    }
+
+    path = base.string();
+
+    return Result::SUCCESS;
+}
+
+#endif
+
+//
+// Thermal State
+//
+
+#if defined(JST_OS_MAC) || defined(JST_OS_IOS)
+
+// Defined on apple.mm.
+
+#elif defined(JST_OS_LINUX)
+
+namespace {
+
+bool ReadSysfs(const std::filesystem::path& path, std::string& value) {
+    std::ifstream file(path);
+    return static_cast<bool>(file >> value);
+}
+
+}  // namespace
+
+U64 ThermalState() {
+    // Compare every thermal zone with its trip points. Zones start being
+    // throttled at the passive trip and the system shuts down at the critical one.
+    std::error_code ec;
+    std::filesystem::directory_iterator zones("/sys/class/thermal", ec);
+    if (ec) {
+        return 0;
+    }
+
+    U64 state = 0;
+
+    for (const auto& zone : zones) {
+        if (zone.path().filename().string().rfind("thermal_zone", 0) != 0) {
+            continue;
+        }
+
+        std::string value;
+        if (!ReadSysfs(zone.path() / "temp", value)) {
+            continue;
+        }
+        const F64 temperature = std::strtod(value.c_str(), nullptr);
+
+        F64 passive = 0.0;
+        F64 critical = 0.0;
+        for (U64 i = 0; ReadSysfs(zone.path() / jst::fmt::format("trip_point_{}_type", i), value); i++) {
+            std::string trip;
+            if (!ReadSysfs(zone.path() / jst::fmt::format("trip_point_{}_temp", i), trip)) {
+                continue;
+            }
+            const F64 limit = std::strtod(trip.c_str(), nullptr);
+
+            if (value == "critical" || value == "hot") {
+                critical = (critical == 0.0) ? limit : std::min(critical, limit);
+            } else if (value == "passive") {
+                passive = (passive == 0.0) ? limit : std::min(passive, limit);
+            }
+        }
+
+        if (critical == 0.0 && passive == 0.0) {
+            continue;
+        }
+        if (passive == 0.0) {
+            passive = critical - 20000.0;
+        }
+        if (critical == 0.0) {
+            critical = passive + 20000.0;
+        }
+
+        // Temperatures are in millidegrees Celsius.
+        if (temperature >= critical - 5000.0) {
+            state = std::max<U64>(state, 3);
+        } else if (temperature >= passive) {
+            state = std::max<U64>(state, 2);
+        } else if (temperature >= passive - 10000.0) {
+            state = std::max<U64>(state, 1);
+        }
+    }
+
+    return state;
+}
+
+bool LowPowerMode() {
+    std::string profile;
+    if (ReadSysfs("/sys/firmware/acpi/platform_profile", profile)) {
+        return profile == "low-power" || profile == "quiet";
+    }
+    return false;
+}
+
+#elif defined(JST_OS_WINDOWS)
+
+U64 ThermalState() {
+    return 0;
+}
+
+bool LowPowerMode() {
+    SYSTEM_POWER_STATUS status;
+    if (!GetSystemPowerStatus(&status)) {
+        return false;
+    }
+    // Battery saver is on.
+    return status.SystemStatusFlag == 1;
+}
+
+#else
+
+U64 ThermalState() {
+    return 0;
+}
+
+bool LowPowerMode() {
+    return false;
+}
+
+#endif
+
 }  // namespace Jetstream::Platform
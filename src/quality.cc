@@ -0,0 +1,190 @@
+#include <sstream>
+#include <algorithm>
+
+#include "jetstream/quality.hh"
+#include "jetstream/logger.hh"
+#include "jetstream/platform.hh"
+
+namespace Jetstream {
+
+// Frames recorded between evaluations.
+static constexpr auto EvaluationInterval = std::chrono::seconds(1);
+// Time for a lowered knob to take effect before lowering the next one.
+static constexpr auto LowerInterval = std::chrono::seconds(2);
+// Time without pressure before raising a knob, and between raises.
+static constexpr auto RecoveryPeriod = std::chrono::seconds(10);
+static constexpr auto RaiseInterval = std::chrono::seconds(5);
+
+Result QualityController::configure(const Config& config) {
+    if (config.frameBudget <= 0.0f) {
+        JST_ERROR("[QUALITY] Invalid frame budget ({} ms). It should be positive.", config.frameBudget);
+        return Result::ERROR;
+    }
+
+    for (U64 i = 0; i < config.priorities.size(); i++) {
+        if (std::count(config.priorities.begin(), config.priorities.end(), config.priorities[i]) > 1) {
+            JST_ERROR("[QUALITY] Knob '{}' is listed more than once.", KnobName(config.priorities[i]));
+            return Result::ERROR;
+        }
+    }
+
+    this->config = config;
+
+    levels.fill(0);
+    thermal = 0;
+    frames = 0;
+    slowFrames = 0;
+    lastOverflows = 0;
+
+    const auto now = Clock::now();
+    windowStart = now;
+    lastChange = now;
+    lastPressure = now;
+
+    return Result::SUCCESS;
+}
+
+bool QualityController::record(const U64& frameNs) {
+    if (!config.enabled) {
+        return false;
+    }
+
+    frames += 1;
+    if (static_cast<F32>(frameNs) > config.frameBudget * 1e6f) {
+        slowFrames += 1;
+    }
+
+    return (Clock::now() - windowStart) >= EvaluationInterval;
+}
+
+bool QualityController::evaluate(const U64& overflows) {
+    if (!config.enabled) {
+        return false;
+    }
+
+    const auto now = Clock::now();
+
+    thermal = Platform::ThermalState();
+    const bool lowPower = Platform::LowPowerMode();
+
+    // More than a quarter of the frames over budget, or samples dropped by a source.
+    const bool slow = frames > 0 && (slowFrames * 4) > frames;
+    const bool overflowed = overflows > lastOverflows;
+
+    windowStart = now;
+    frames = 0;
+    slowFrames = 0;
+    lastOverflows = overflows;
+
+    // Critical thermal state, drop everything right away.
+    if (thermal >= 3) {
+        bool changed = false;
+        for (const auto& knob : config.priorities) {
+            auto& level = levels[static_cast<U64>(knob)];
+            if (level < MaxLevel) {
+                level = MaxLevel;
+                changed = true;
+            }
+        }
+
+        if (changed) {
+            JST_WARN("[QUALITY] The system is critically hot. Lowering the display quality.");
+            lastChange = now;
+        }
+        lastPressure = now;
+
+        return changed;
+    }
+
+    // Low power mode keeps at least one knob lowered.
+    const bool lowered = std::any_of(levels.begin(), levels.end(), [](const U64& level) {
+        return level > 0;
+    });
+    const bool pressure = thermal >= 2 || slow || overflowed || (lowPower && !lowered);
+
+    if (pressure) {
+        lastPressure = now;
+
+        if ((now - lastChange) >= LowerInterval && lower()) {
+            JST_DEBUG("[QUALITY] Pressure (thermal: {}, low power: {}, slow: {}, overflowed: {}).",
+                      thermal, lowPower, slow, overflowed);
+            lastChange = now;
+            return true;
+        }
+
+        return false;
+    }
+
+    // Fair thermal state and low power mode hold the knobs where they are.
+    if (thermal >= 1 || lowPower) {
+        return false;
+    }
+
+    if ((now - lastPressure) >= RecoveryPeriod &&
+        (now - lastChange) >= RaiseInterval && raise()) {
+        lastChange = now;
+        return true;
+    }
+
+    return false;
+}
+
+bool QualityController::lower() {
+    for (const auto& knob : config.priorities) {
+        auto& level = levels[static_cast<U64>(knob)];
+        if (level < MaxLevel) {
+            level += 1;
+            JST_DEBUG("[QUALITY] Lowering {} to level {}.", KnobName(knob), level);
+            return true;
+        }
+    }
+    return false;
+}
+
+bool QualityController::raise() {
+    for (auto it = config.priorities.rbegin(); it != config.priorities.rend(); it++) {
+        auto& level = levels[static_cast<U64>(*it)];
+        if (level > 0) {
+            level -= 1;
+            JST_DEBUG("[QUALITY] Raising {} to level {}.", KnobName(*it), level);
+            return true;
+        }
+    }
+    return false;
+}
+
+Result QualityController::ParsePriorities(const std::string& list, std::vector<Knob>& priorities) {
+    priorities.clear();
+
+    std::stringstream stream(list);
+    std::string name;
+
+    while (std::getline(stream, name, ',')) {
+        if (name == KnobName(Knob::Framerate)) {
+            priorities.push_back(Knob::Framerate);
+        } else if (name == KnobName(Knob::DisplayRate)) {
+            priorities.push_back(Knob::DisplayRate);
+        } else if (name == KnobName(Knob::Resolution)) {
+            priorities.push_back(Knob::Resolution);
+        } else {
+            JST_ERROR("[QUALITY] Unknown knob '{}'. Expected `framerate`, `display` or `resolution`.", name);
+            return Result::ERROR;
+        }
+    }
+
+    return Result::SUCCESS;
+}
+
+const char* QualityController::KnobName(const Knob& knob) {
+    switch (knob) {
+        case Knob::Framerate:
+            return "framerate";
+        case Knob::DisplayRate:
+            return "display";
+        case Knob::Resolution:
+            return "resolution";
+    }
+    return "unknown";
+}
+
+}  // namespace Jetstream
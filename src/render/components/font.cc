@@ -16,6 +16,8 @@
 #pragma GCC diagnostic pop
 #endif
 
+#include <mutex>
+
 #include "jetstream/render/base.hh"
 #include "jetstream/render/components/font.hh"
 
@@ -35,16 +37,29 @@ struct Font::Impl {
 
     // Font.
 
+    std::vector<U8> data;
     stbtt_fontinfo font;
+    F32 scale;
 
     // Font atlas.
 
     I32 atlasPadding = 4;
     U8  atlasOneEdgeValue = 128;
     F32 atlasPixelDistScale = 16.0f;
-    Extent2D<I32> atlasSize = {512, 512};
+    Extent2D<I32> atlasSize = {256, 256};
     I32 ascent, descent;
 
+    std::vector<U8> atlas;
+    bool atlasDirty = false;
+
+    // Packing cursor of the next glyph.
+
+    I32 cursorX = 0;
+    I32 cursorY = 0;
+    I32 rowHeight = 0;
+
+    std::mutex mutex;
+
     // Texture.
 
     std::shared_ptr<Render::Texture> fontAtlasTexture;
@@ -57,91 +72,53 @@ Result Font::create(Window* window) {
 
     pimpl->window = window;
 
-    // Decompress font.
+    // Decompress font. Kept around to render glyphs when first used.
 
     const U8* compressedData = static_cast<const uint8_t*>(config.data);
     const U32 decompressedSize = stb_decompress_length(compressedData);
-    std::vector<uint8_t> decompressedData(decompressedSize);
-    stb_decompress(decompressedData.data(), compressedData, decompressedSize);
+    pimpl->data.resize(decompressedSize);
+    stb_decompress(pimpl->data.data(), compressedData, decompressedSize);
 
     // Load font.
 
-    const auto fontOffset = stbtt_GetFontOffsetForIndex(decompressedData.data(), 0);
-    if (!stbtt_InitFont(&pimpl->font, decompressedData.data(), fontOffset)) {
+    const auto fontOffset = stbtt_GetFontOffsetForIndex(pimpl->data.data(), 0);
+    if (!stbtt_InitFont(&pimpl->font, pimpl->data.data(), fontOffset)) {
         JST_ERROR("[FONT] Failed to load font.");
         return Result::ERROR;
     }
 
     JST_DEBUG("[FONT] Loaded new font.");
-    decompressedData.clear();
 
     // Calculate ascent and descent.
 
     stbtt_GetFontVMetrics(&pimpl->font, &pimpl->ascent, &pimpl->descent, nullptr);
-    const auto scale = stbtt_ScaleForPixelHeight(&pimpl->font, config.size);
-    pimpl->ascent = roundf(pimpl->ascent * scale);
-    pimpl->descent = roundf(pimpl->descent * scale);
-
-    // Create font atlas.
-
-    std::vector<uint8_t> atlas(pimpl->atlasSize.x * pimpl->atlasSize.y);
-
-    int x = 0;
-    int y = 0;
-    int maxHeight = 0;
-
-    for (int ch = 32; ch < 128; ch++) {
-        uint8_t* sdf;
-        int width, height, xoffset, yoffset;
-
-        if (!(sdf = stbtt_GetCodepointSDF(&pimpl->font,
-                                          scale,
-                                          ch,
-                                          pimpl->atlasPadding,
-                                          pimpl->atlasOneEdgeValue,
-                                          pimpl->atlasPixelDistScale,
-                                          &width,
-                                          &height,
-                                          &xoffset,
-                                          &yoffset))) {
-            continue;
-        }
-
-        if (x + width >= pimpl->atlasSize.x) {
-            x = 0;
-            y += maxHeight + 1;
-            maxHeight = 0;
-        }
-
-        if (y + height >= pimpl->atlasSize.y) {
-            break;
-        }
-
-        for (int j = 0; j < height; ++j) {
-            for (int i = 0; i < width; ++i) {
-                atlas[(y + j) * pimpl->atlasSize.x + (x + i)] = sdf[j * width + i];
-            }
+    pimpl->scale = stbtt_ScaleForPixelHeight(&pimpl->font, config.size);
+    pimpl->ascent = roundf(pimpl->ascent * pimpl->scale);
+    pimpl->descent = roundf(pimpl->descent * pimpl->scale);
+
+    // Size the atlas for every printable glyph with the font bounding box.
+    // Glyphs are only rendered when first used.
+
+    I32 x0, y0, x1, y1;
+    stbtt_GetFontBoundingBox(&pimpl->font, &x0, &y0, &x1, &y1);
+    const I32 cellWidth = std::ceil((x1 - x0) * pimpl->scale) + 2 * pimpl->atlasPadding + 1;
+    const I32 cellHeight = std::ceil((y1 - y0) * pimpl->scale) + 2 * pimpl->atlasPadding + 1;
+
+    const auto fits = [&](const Extent2D<I32>& size) {
+        return (size.x / cellWidth) * (size.y / cellHeight) >= GlyphCount;
+    };
+
+    while (!fits(pimpl->atlasSize)) {
+        if (pimpl->atlasSize.x <= pimpl->atlasSize.y) {
+            pimpl->atlasSize.x *= 2;
+        } else {
+            pimpl->atlasSize.y *= 2;
         }
-
-        glyphs[ch - 32] = {
-            .x0 = x,
-            .y0 = y,
-            .x1 = x + width,
-            .y1 = y + height,
-            .xOffset = static_cast<F32>(xoffset),
-            .yOffset = static_cast<F32>(yoffset),
-            .xAdvance = static_cast<F32>(width)
-        };
-
-        x += width + 1;
-        if (height > maxHeight) {
-            maxHeight = height;
-        }
-
-        stbtt_FreeSDF(sdf, nullptr);
     }
 
-    JST_DEBUG("[FONT] Created font atlas.");
+    pimpl->atlas.resize(pimpl->atlasSize.x * pimpl->atlasSize.y, 0);
+
+    JST_DEBUG("[FONT] Created font atlas ({}x{}).", pimpl->atlasSize.x, pimpl->atlasSize.y);
 
     // Create texture.
 
@@ -151,7 +128,7 @@ Result Font::create(Window* window) {
             static_cast<U64>(pimpl->atlasSize.x),
             static_cast<U64>(pimpl->atlasSize.y),
         };
-        cfg.buffer = atlas.data();
+        cfg.buffer = pimpl->atlas.data();
         cfg.dfmt = Render::Texture::DataFormat::UI8;
         cfg.pfmt = Render::Texture::PixelFormat::RED;
         cfg.ptype = Render::Texture::PixelType::UI8;
@@ -172,8 +149,85 @@ Result Font::destroy(Window* window) {
     return Result::SUCCESS;
 }
 
-const Font::Glyph& Font::glyph(const I32& code) const {
-    return glyphs.at(code);
+Result Font::present() {
+    std::lock_guard<std::mutex> lock(pimpl->mutex);
+
+    if (!pimpl->atlasDirty) {
+        return Result::SUCCESS;
+    }
+
+    JST_CHECK(pimpl->fontAtlasTexture->fill());
+    pimpl->atlasDirty = false;
+
+    return Result::SUCCESS;
+}
+
+const Font::Glyph& Font::glyph(const I32& code) {
+    std::lock_guard<std::mutex> lock(pimpl->mutex);
+
+    if (const auto it = glyphs.find(code); it != glyphs.end()) {
+        return it->second;
+    }
+
+    // Render the glyph and pack it after the previous one.
+
+    auto& glyph = glyphs[code];
+    glyph = {};
+
+    int width, height, xoffset, yoffset;
+    uint8_t* sdf = stbtt_GetCodepointSDF(&pimpl->font,
+                                         pimpl->scale,
+                                         code + 32,
+                                         pimpl->atlasPadding,
+                                         pimpl->atlasOneEdgeValue,
+                                         pimpl->atlasPixelDistScale,
+                                         &width,
+                                         &height,
+                                         &xoffset,
+                                         &yoffset);
+
+    if (!sdf) {
+        return glyph;
+    }
+
+    if (pimpl->cursorX + width >= pimpl->atlasSize.x) {
+        pimpl->cursorX = 0;
+        pimpl->cursorY += pimpl->rowHeight + 1;
+        pimpl->rowHeight = 0;
+    }
+
+    if (width >= pimpl->atlasSize.x || pimpl->cursorY + height >= pimpl->atlasSize.y) {
+        JST_ERROR("[FONT] Font atlas is full.");
+        stbtt_FreeSDF(sdf, nullptr);
+        return glyph;
+    }
+
+    const I32 x = pimpl->cursorX;
+    const I32 y = pimpl->cursorY;
+
+    for (int j = 0; j < height; ++j) {
+        for (int i = 0; i < width; ++i) {
+            pimpl->atlas[(y + j) * pimpl->atlasSize.x + (x + i)] = sdf[j * width + i];
+        }
+    }
+
+    stbtt_FreeSDF(sdf, nullptr);
+
+    glyph = {
+        .x0 = x,
+        .y0 = y,
+        .x1 = x + width,
+        .y1 = y + height,
+        .xOffset = static_cast<F32>(xoffset),
+        .yOffset = static_cast<F32>(yoffset),
+        .xAdvance = static_cast<F32>(width)
+    };
+
+    pimpl->cursorX += width + 1;
+    pimpl->rowHeight = std::max(pimpl->rowHeight, height);
+    pimpl->atlasDirty = true;
+
+    return glyph;
 }
 
 const std::shared_ptr<Render::Texture>& Font::atlas() const {
@@ -44,12 +44,37 @@ struct Shapes::Impl {
 
     struct Element {
         const ElementConfig& config;
+        U64 offset;
         std::span<ColorRGBA<F32>> instanceColorsBuffer;
         std::span<F32> instanceRotationsBuffer;
         std::span<Extent2D<F32>> instancePositionsBuffer;
         std::span<Extent2D<F32>> instanceSizesBuffer;
     };
 
+    // Range of instances modified since the last upload.
+
+    struct DirtyRange {
+        U64 begin = 0;
+        U64 end = 0;
+
+        bool empty() const {
+            return begin == end;
+        }
+
+        void mark(const U64& offset, const U64& size) {
+            if (size == 0) {
+                return;
+            }
+            begin = empty() ? offset : std::min(begin, offset);
+            end = std::max(end, offset + size);
+        }
+
+        void upload(const std::shared_ptr<Render::Buffer>& buffer) {
+            buffer->update(begin, end - begin);
+            begin = end = 0;
+        }
+    };
+
     // Variables.
 
     const Config& config;
@@ -67,10 +92,10 @@ struct Shapes::Impl {
     bool updateIndicesBufferFlag = false;
 
     bool updatePropertiesBufferFlag = false;
-    bool updateColorBufferFlag = false;
-    bool updateRotationBufferFlag = false;
-    bool updateSizeBufferFlag = false;
-    bool updatePositionBufferFlag = false;
+    DirtyRange colorRange;
+    DirtyRange rotationRange;
+    DirtyRange sizeRange;
+    DirtyRange positionRange;
 
     bool computeInstanceBufferFlag = false;
 
@@ -112,6 +137,12 @@ struct Shapes::Impl {
     Result generateElementsProperties();
     Result generateElementsVertices();
 
+    Result markRange(DirtyRange& range,
+                     const std::string& elementId,
+                     const U64& offset,
+                     const U64& size,
+                     const char* attribute);
+
     // Constructor.
 
     Impl(const Config& config) : config(config) {}
@@ -313,6 +344,7 @@ Result Shapes::create(Window* window) {
 
         const auto& element = Impl::Element{
             .config = elementConfig,
+            .offset = currentInstanceOffset,
             .instanceColorsBuffer = std::span<ColorRGBA<F32>>({pimpl->instanceColors.data(), pimpl->instanceColors.size()}).subspan(currentInstanceOffset, instanceCount),
             .instanceRotationsBuffer = std::span<F32>({pimpl->instanceRotations.data(), pimpl->instanceRotations.size()}).subspan(currentInstanceOffset, instanceCount),
             .instancePositionsBuffer = std::span<Extent2D<F32>>({pimpl->instancePositions.data(), pimpl->instancePositions.size()}).subspan(currentInstanceOffset, instanceCount),
@@ -322,22 +354,22 @@ Result Shapes::create(Window* window) {
         for (U64 i = 0; i < instanceCount; ++i) {
             element.instanceColorsBuffer[i] = elementConfig.color;
         }
-        pimpl->updateColorBufferFlag = true;
+        pimpl->colorRange.mark(currentInstanceOffset, instanceCount);
 
         for (U64 i = 0; i < instanceCount; ++i) {
             element.instanceRotationsBuffer[i] = elementConfig.rotation;
         }
-        pimpl->updateRotationBufferFlag = true;
+        pimpl->rotationRange.mark(currentInstanceOffset, instanceCount);
 
         for (U64 i = 0; i < instanceCount; ++i) {
             element.instancePositionsBuffer[i] = elementConfig.position;
         }
-        pimpl->updatePositionBufferFlag = true;
+        pimpl->positionRange.mark(currentInstanceOffset, instanceCount);
 
         for (U64 i = 0; i < instanceCount; ++i) {
             element.instanceSizesBuffer[i] = elementConfig.size;
         }
-        pimpl->updateSizeBufferFlag = true;
+        pimpl->sizeRange.mark(currentInstanceOffset, instanceCount);
 
         pimpl->elementIndex[id] = pimpl->elements.size();
         pimpl->elements.push_back(element);
@@ -444,10 +476,15 @@ Result Shapes::getColors(const std::string& elementId, std::span<ColorRGBA<F32>>
     return Result::SUCCESS;
 }
 
-Result Shapes::updateColors(const std::string&) {
-    // TODO: Implement element specific update.
-    pimpl->updateColorBufferFlag = true;
-    return Result::SUCCESS;
+Result Shapes::updateColors(const std::string& elementId) {
+    return pimpl->markRange(pimpl->colorRange, elementId, 0, 0, "color");
+}
+
+Result Shapes::updateColors(const std::string& elementId, const U64& offset, const U64& size) {
+    if (size == 0) {
+        return Result::SUCCESS;
+    }
+    return pimpl->markRange(pimpl->colorRange, elementId, offset, size, "color");
 }
 
 Result Shapes::getRotations(const std::string& elementId, std::span<F32>& rotations) const {
@@ -459,10 +496,15 @@ Result Shapes::getRotations(const std::string& elementId, std::span<F32>& rotati
     return Result::SUCCESS;
 }
 
-Result Shapes::updateRotations(const std::string&) {
-    // TODO: Implement element specific update.
-    pimpl->updateRotationBufferFlag = true;
-    return Result::SUCCESS;
+Result Shapes::updateRotations(const std::string& elementId) {
+    return pimpl->markRange(pimpl->rotationRange, elementId, 0, 0, "rotation");
+}
+
+Result Shapes::updateRotations(const std::string& elementId, const U64& offset, const U64& size) {
+    if (size == 0) {
+        return Result::SUCCESS;
+    }
+    return pimpl->markRange(pimpl->rotationRange, elementId, offset, size, "rotation");
 }
 
 Result Shapes::getPositions(const std::string& elementId, std::span<Extent2D<F32>>& positions) const {
@@ -474,10 +516,15 @@ Result Shapes::getPositions(const std::string& elementId, std::span<Extent2D<F32
     return Result::SUCCESS;
 }
 
-Result Shapes::updatePositions(const std::string&) {
-    // TODO: Implement element specific update.
-    pimpl->updatePositionBufferFlag = true;
-    return Result::SUCCESS;
+Result Shapes::updatePositions(const std::string& elementId) {
+    return pimpl->markRange(pimpl->positionRange, elementId, 0, 0, "position");
+}
+
+Result Shapes::updatePositions(const std::string& elementId, const U64& offset, const U64& size) {
+    if (size == 0) {
+        return Result::SUCCESS;
+    }
+    return pimpl->markRange(pimpl->positionRange, elementId, offset, size, "position");
 }
 
 Result Shapes::getSizes(const std::string& elementId, std::span<Extent2D<F32>>& sizes) const {
@@ -489,9 +536,47 @@ Result Shapes::getSizes(const std::string& elementId, std::span<Extent2D<F32>>&
     return Result::SUCCESS;
 }
 
-Result Shapes::updateSizes(const std::string&) {
-    // TODO: Implement element specific update.
-    pimpl->updateSizeBufferFlag = true;
+Result Shapes::updateSizes(const std::string& elementId) {
+    return pimpl->markRange(pimpl->sizeRange, elementId, 0, 0, "size");
+}
+
+Result Shapes::updateSizes(const std::string& elementId, const U64& offset, const U64& size) {
+    if (size == 0) {
+        return Result::SUCCESS;
+    }
+    return pimpl->markRange(pimpl->sizeRange, elementId, offset, size, "size");
+}
+
+Result Shapes::Impl::markRange(DirtyRange& range,
+                                const std::string& elementId,
+                                const U64& offset,
+                                const U64& size,
+                                const char* attribute) {
+    // Mark every instance without an element.
+
+    if (elementId.empty()) {
+        range.mark(0, totalNumberOfInstances);
+        return Result::SUCCESS;
+    }
+
+    if (!elementIndex.contains(elementId)) {
+        JST_ERROR("[SHAPES] Element not found ({}).", attribute);
+        return Result::ERROR;
+    }
+    const auto& element = elements.at(elementIndex.at(elementId));
+
+    // Mark the whole element without a size.
+
+    const U64 count = (size == 0) ? element.config.numberOfInstances : size;
+
+    if (offset + count > element.config.numberOfInstances) {
+        JST_ERROR("[SHAPES] Range [{}, {}) is out of bounds of element with {} instances ({}).",
+                  offset, offset + count, element.config.numberOfInstances, attribute);
+        return Result::ERROR;
+    }
+
+    range.mark(element.offset + offset, count);
+
     return Result::SUCCESS;
 }
 
@@ -561,29 +646,17 @@ Result Shapes::present() {
         pimpl->computeInstanceBufferFlag = true;
     }
 
-    if (pimpl->updateColorBufferFlag) {
-        pimpl->colorsBuffer->update();
-        pimpl->updateColorBufferFlag = false;
-        pimpl->computeInstanceBufferFlag = true;
-    }
-
-    if (pimpl->updateRotationBufferFlag) {
-        pimpl->rotationsBuffer->update();
-        pimpl->updateRotationBufferFlag = false;
-        pimpl->computeInstanceBufferFlag = true;
-    }
-
-    if (pimpl->updatePositionBufferFlag) {
-        pimpl->positionsBuffer->update();
-        pimpl->updatePositionBufferFlag = false;
-        pimpl->computeInstanceBufferFlag = true;
-    }
+    const auto uploadRange = [&](Impl::DirtyRange& range, const std::shared_ptr<Render::Buffer>& buffer) {
+        if (!range.empty()) {
+            range.upload(buffer);
+            pimpl->computeInstanceBufferFlag = true;
+        }
+    };
 
-    if (pimpl->updateSizeBufferFlag) {
-        pimpl->sizesBuffer->update();
-        pimpl->updateSizeBufferFlag = false;
-        pimpl->computeInstanceBufferFlag = true;
-    }
+    uploadRange(pimpl->colorRange, pimpl->colorsBuffer);
+    uploadRange(pimpl->rotationRange, pimpl->rotationsBuffer);
+    uploadRange(pimpl->positionRange, pimpl->positionsBuffer);
+    uploadRange(pimpl->sizeRange, pimpl->sizesBuffer);
 
     // Compute instance buffer.
 
@@ -25,13 +25,17 @@ struct Text::Impl {
         F32 sharpness;
     };
 
+    // Elements are transformed on the host, so every element of the
+    // component is drawn by a single indexed draw.
+
     struct Element {
         const ElementConfig& config;
 
         Extent2D<I32> bounds;
+        glm::mat4 transform;
+        std::span<glm::vec2> glyphVertices;
         std::span<glm::vec2> posVertices;
         std::span<glm::vec2> fillVertices;
-        std::span<glm::mat4> instances;
     };
 
     // Variables.
@@ -48,6 +52,7 @@ struct Text::Impl {
     bool updateFontInstanceBufferFlag = false;
     bool updateFontIndicesBufferFlag = false;
 
+    std::vector<glm::vec2> glyphVertices;
     std::vector<glm::vec2> posVertices;
     std::vector<glm::vec2> fillVertices;
     std::vector<glm::mat4> instances;
@@ -97,18 +102,19 @@ Result Text::create(Window* window) {
 
     // Calculate constants.
     const U64 numberOfVertices = config.maxCharacters * 4;
-    const U64 numberOfInstances = config.elements.size();
-    const U64 numberOfIndices = config.maxCharacters * 6;
+    const U64 numberOfElements = config.elements.size();
+    const U64 numberOfIndices = config.maxCharacters * 6 * numberOfElements;
 
     // Reserve memory.
-    pimpl->posVertices.resize(numberOfVertices * numberOfInstances);
-    pimpl->fillVertices.resize(numberOfVertices * numberOfInstances);
-    pimpl->instances.resize(numberOfInstances);
+    pimpl->glyphVertices.resize(numberOfVertices * numberOfElements);
+    pimpl->posVertices.resize(numberOfVertices * numberOfElements);
+    pimpl->fillVertices.resize(numberOfVertices * numberOfElements);
+    pimpl->instances.resize(1, glm::mat4(1.0f));
     pimpl->indices.resize(numberOfIndices);
 
     // Debug information.
-    JST_DEBUG("[TEXT] Number of vertices: {}", numberOfVertices);
-    JST_DEBUG("[TEXT] Number of instances: {}", numberOfInstances);
+    JST_DEBUG("[TEXT] Number of vertices: {}", numberOfVertices * numberOfElements);
+    JST_DEBUG("[TEXT] Number of elements: {}", numberOfElements);
     JST_DEBUG("[TEXT] Number of indices: {}", numberOfIndices);
 
     // Create render surface.
@@ -178,7 +184,7 @@ Result Text::create(Window* window) {
 
     {
         Render::Draw::Config cfg;
-        cfg.numberOfDraws = numberOfInstances;
+        cfg.numberOfDraws = 1;
         cfg.numberOfInstances = 1;
         cfg.buffer = pimpl->fontVertex;
         cfg.mode = Render::Draw::Mode::TRIANGLES;
@@ -209,10 +215,12 @@ Result Text::create(Window* window) {
         pimpl->elements.emplace(id, Text::Impl::Element{
             .config = config.elements[id],
             .bounds = {0, 0},
+            .transform = glm::mat4(1.0f),
+            .glyphVertices = std::span{pimpl->glyphVertices}.subspan(numberOfVertices * i, numberOfVertices),
             .posVertices = std::span{pimpl->posVertices}.subspan(numberOfVertices * i, numberOfVertices),
             .fillVertices = std::span{pimpl->fillVertices}.subspan(numberOfVertices * i, numberOfVertices),
-            .instances = std::span{pimpl->instances}.subspan(i++, 1),
         });
+        i++;
     }
 
     // Load static state.
@@ -279,8 +287,7 @@ Result Text::update(const std::string& elementId, const ElementConfig& elementCo
     if (shouldUpdateVertices) {
         JST_CHECK(pimpl->updateElementVertex(element));
 
-        // Set flag to update buffers.
-        pimpl->updateFontPosVerticesBufferFlag = true;
+        // Set flag to update buffer.
         pimpl->updateFontFillVerticesBufferFlag = true;
     }
 
@@ -288,7 +295,7 @@ Result Text::update(const std::string& elementId, const ElementConfig& elementCo
     JST_CHECK(pimpl->updateElementInstance(element));
 
     // Set flag to update buffer.
-    pimpl->updateFontInstanceBufferFlag = true;
+    pimpl->updateFontPosVerticesBufferFlag = true;
 
     return Result::SUCCESS;
 }
@@ -326,28 +333,28 @@ Result Text::Impl::updateVertices() {
         JST_CHECK(updateElementVertex(element));
     }
 
-    // Set flag to update buffers.
-    updateFontPosVerticesBufferFlag = true;
+    // Set flag to update buffer.
     updateFontFillVerticesBufferFlag = true;
 
     return Result::SUCCESS;
 }
 
 Result Text::Impl::updateInstances() {
-    // Update elements instane.
+    // Update elements instance.
     for (auto& [_, element] : elements) {
         JST_CHECK(updateElementInstance(element));
     }
 
-    // Set flag to update buffer.
+    // Set flags to update buffers.
+    updateFontPosVerticesBufferFlag = true;
     updateFontInstanceBufferFlag = true;
 
     return Result::SUCCESS;
 }
 
 Result Text::Impl::updateIndices() {
-    // Populate indices.
-    for (U64 i = 0; i < config.maxCharacters; i++) {
+    // Populate indices of every character of every element.
+    for (U64 i = 0; i < config.maxCharacters * elements.size(); i++) {
         indices[(i * 6) + 0] = (i * 4);
         indices[(i * 6) + 1] = (i * 4) + 1;
         indices[(i * 6) + 2] = (i * 4) + 2;
@@ -364,7 +371,7 @@ Result Text::Impl::updateIndices() {
 
 Result Text::Impl::updateElementInstance(Element& element) {
     // Reference transform.
-    auto& transform = element.instances[0];
+    auto& transform = element.transform;
 
     // Reset transform.
     transform = glm::mat4(1.0f);
@@ -401,25 +408,39 @@ Result Text::Impl::updateElementInstance(Element& element) {
         }
     }
 
+    // Transform positions. Unused characters stay degenerate.
+    for (U64 i = 0; i < element.glyphVertices.size(); i += 4) {
+        if (element.glyphVertices[i] == element.glyphVertices[i + 2]) {
+            std::fill_n(element.posVertices.begin() + i, 4, glm::vec2(0.0f));
+            continue;
+        }
+
+        for (U64 j = i; j < i + 4; j++) {
+            const auto position = transform * glm::vec4(element.glyphVertices[j], 1.0f, 1.0f);
+            element.posVertices[j] = glm::vec2(position.x, position.y);
+        }
+    }
+
     return Result::SUCCESS;
 }
 
 Result Text::Impl::updateElementVertex(Element& element) {
     // Check config.
 
-    if (element.config.fill.empty()) {
-        return Result::SUCCESS;
-    }
-
     if (element.config.fill.size() > config.maxCharacters) {
         JST_ERROR("[TEXT] Text too long ({} characters). Increase the max size.", element.config.fill.size());
         return Result::ERROR;
     }
 
     // Clear buffers.
-    std::fill(element.posVertices.begin(), element.posVertices.end(), glm::vec2(0.0f));
+    std::fill(element.glyphVertices.begin(), element.glyphVertices.end(), glm::vec2(0.0f));
     std::fill(element.fillVertices.begin(), element.fillVertices.end(), glm::vec2(0.0f));
 
+    if (element.config.fill.empty()) {
+        element.bounds = {0, 0};
+        return Result::SUCCESS;
+    }
+
     // Recalculate vertex buffer.
 
     F32 x = 0.0f;
@@ -461,10 +482,10 @@ Result Text::Impl::updateElementVertex(Element& element) {
 
             // Add positions.
 
-            element.posVertices[(i * 4) + 0] = glm::vec2(x0, y0);
-            element.posVertices[(i * 4) + 1] = glm::vec2(x1, y0);
-            element.posVertices[(i * 4) + 2] = glm::vec2(x1, y1);
-            element.posVertices[(i * 4) + 3] = glm::vec2(x0, y1);
+            element.glyphVertices[(i * 4) + 0] = glm::vec2(x0, y0);
+            element.glyphVertices[(i * 4) + 1] = glm::vec2(x1, y0);
+            element.glyphVertices[(i * 4) + 2] = glm::vec2(x1, y1);
+            element.glyphVertices[(i * 4) + 3] = glm::vec2(x0, y1);
 
             // Normalize texture coordinates.
 
@@ -496,6 +517,8 @@ Result Text::Impl::updateElementVertex(Element& element) {
 }
 
 Result Text::present() {
+    JST_CHECK(config.font->present());
+
     if (pimpl->updateFontFillVerticesBufferFlag) {
         pimpl->fontFillVerticesBuffer->update();
         pimpl->updateFontFillVerticesBufferFlag = false;
@@ -1,4 +1,5 @@
 #include "jetstream/render/devices/metal/buffer.hh"
+#include "jetstream/render/statistics.hh"
 
 namespace Jetstream::Render {
 
@@ -50,6 +51,8 @@ Result Implementation::update(const U64& offset, const U64& size) {
     const auto& byteOffset = offset * config.elementByteSize;
     const auto& byteSize = size * config.elementByteSize;
 
+    Statistics::CountBufferUpload(byteSize);
+
 
     uint8_t* ptr = static_cast<uint8_t*>(buffer->contents());
     memcpy(ptr + byteOffset, (uint8_t*)config.buffer + byteOffset, byteSize);
@@ -1,6 +1,7 @@
 #include "jetstream/render/devices/metal/vertex.hh"
 #include "jetstream/render/devices/metal/draw.hh"
 #include "jetstream/render/devices/metal/buffer.hh"
+#include "jetstream/render/statistics.hh"
 
 namespace Jetstream::Render {
 
@@ -111,6 +112,8 @@ Result Implementation::encode(MTL::RenderCommandEncoder* encoder) {
 
     JST_CHECK(buffer->encode(encoder));
 
+    Statistics::CountDraws(config.numberOfDraws);
+
     for (U64 i = 0; i < config.numberOfDraws; i++) {
         if (buffer->isBuffered()) {
             encoder->drawIndexedPrimitives(mode,
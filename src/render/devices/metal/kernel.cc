@@ -1,5 +1,6 @@
 #include "jetstream/render/devices/metal/buffer.hh"
 #include "jetstream/render/devices/metal/kernel.hh"
+#include "jetstream/startup.hh"
 
 namespace Jetstream::Render {
 
@@ -14,6 +15,8 @@ Implementation::KernelImp(const Config& config) : Kernel(config) {
 }
 
 Result Implementation::create() {
+    JST_STARTUP_PHASE("Compute Pipeline Creation");
+
     JST_DEBUG("[METAL] Creating kernel.");
 
     if (config.kernels.contains(Device::Metal) == 0) {
@@ -43,12 +46,26 @@ Result Implementation::create() {
     );
     JST_ASSERT(func, "Failed to create function.");
 
-    pipelineState = device->newComputePipelineState(func, &err);
+    auto pipelineDescriptor = MTL::ComputePipelineDescriptor::alloc()->init();
+    pipelineDescriptor->setComputeFunction(func);
+
+    auto binaryArchive = Backend::State<Device::Metal>()->getBinaryArchive();
+    if (binaryArchive) {
+        pipelineDescriptor->setBinaryArchives(NS::Array::array(binaryArchive));
+    }
+
+    pipelineState = device->newComputePipelineState(pipelineDescriptor, MTL::PipelineOptionNone, nullptr, &err);
     if (!pipelineState) {
         JST_ERROR("Failed to create pipeline state:\n{}", err->description()->utf8String());
         return Result::ERROR;
     }
 
+    if (binaryArchive && !binaryArchive->addComputePipelineFunctions(pipelineDescriptor, &err)) {
+        JST_DEBUG("[METAL] Can't add compute pipeline to archive.");
+    }
+
+    pipelineDescriptor->release();
+
     // Set update flag.
 
     this->updated = true;
@@ -2,6 +2,7 @@
 #include "jetstream/render/devices/metal/draw.hh"
 #include "jetstream/render/devices/metal/texture.hh"
 #include "jetstream/render/devices/metal/program.hh"
+#include "jetstream/startup.hh"
 
 namespace Jetstream::Render {
 
@@ -28,6 +29,8 @@ Implementation::ProgramImp(const Config& config) : Program(config) {
 }
 
 Result Implementation::create(const std::shared_ptr<TextureImp<Device::Metal>>& framebuffer) {
+    JST_STARTUP_PHASE("Render Pipeline Creation");
+
     JST_DEBUG("[METAL] Creating program.");
 
     if (config.shaders.contains(Device::Metal) == 0) {
@@ -100,12 +103,24 @@ Result Implementation::create(const std::shared_ptr<TextureImp<Device::Metal>>&
         colorAttachment->setAlphaBlendOperation(MTL::BlendOperationAdd);
     }
 
+    auto binaryArchive = Backend::State<Device::Metal>()->getBinaryArchive();
+    if (binaryArchive) {
+        renderPipelineDescriptor->setBinaryArchives(NS::Array::array(binaryArchive));
+    }
+
     renderPipelineState = device->newRenderPipelineState(renderPipelineDescriptor, &err);
     if (!renderPipelineState) {
         JST_ERROR("Failed to create pipeline state:\n{}", err->description()->utf8String());
         return Result::ERROR;
     }
 
+    // Record the pipeline in the archive for the next run. A pipeline already
+    // in the archive is skipped.
+
+    if (binaryArchive && !binaryArchive->addRenderPipelineFunctions(renderPipelineDescriptor, &err)) {
+        JST_DEBUG("[METAL] Can't add render pipeline to archive.");
+    }
+
     renderPipelineDescriptor->release();
 
     return Result::SUCCESS;
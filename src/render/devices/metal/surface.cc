@@ -123,7 +123,16 @@ Result Implementation::draw(MTL::CommandBuffer* commandBuffer) {
 
         JST_CHECK(destroyFramebuffer());
         JST_CHECK(createFramebuffer());
+
+        updated = true;
+    }
+
+    // Keep the last frame if nothing changed.
+
+    if (!updated) {
+        return Result::SUCCESS;
     }
+    updated = false;
 
     // Encode kernels.
 
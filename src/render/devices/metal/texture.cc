@@ -1,4 +1,5 @@
 #include "jetstream/render/devices/metal/texture.hh"
+#include "jetstream/render/statistics.hh"
 
 namespace Jetstream::Render {
 
@@ -77,6 +78,7 @@ Result Implementation::fillRow(const U64& y, const U64& height) {
     auto region = MTL::Region::Make2D(0, y, config.size.x, height);
     auto rowByteSize = config.size.x * GetPixelByteSize(texture->pixelFormat());
     auto bufferByteOffset = rowByteSize * y;
+    Statistics::CountTextureUpload(rowByteSize * height);
     texture->replaceRegion(region, 0, config.buffer + bufferByteOffset, rowByteSize);
 
     return Result::SUCCESS;
@@ -160,6 +160,17 @@ Result Implementation::underlyingSynchronize() {
     return Result::SUCCESS;
 }
 
+bool Implementation::underlyingStreamsTensors() const {
+    return viewport->streamsTensors();
+}
+
+Result Implementation::underlyingPushTensor(const std::string& id,
+                                            const std::span<const F32>& data,
+                                            const F32& min,
+                                            const F32& max) {
+    return viewport->pushTensor(id, data, min, max);
+}
+
 void Implementation::drawDebugMessage() const {
     auto& backend = Backend::State<Device::Metal>();
 
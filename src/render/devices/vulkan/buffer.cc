@@ -1,5 +1,6 @@
 #include "jetstream/render/devices/vulkan/buffer.hh"
 #include "jetstream/backend/devices/vulkan/helpers.hh"
+#include "jetstream/render/statistics.hh"
 
 namespace Jetstream::Render {
 
@@ -57,7 +58,7 @@ Result Implementation::create() {
         bufferInfo.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
         bufferInfo.size = byteSize();
         bufferInfo.usage = bufferUsageFlag;
-        bufferInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+        Backend::State<Device::Vulkan>()->setSharingMode(bufferInfo);
 
         JST_VK_CHECK(vkCreateBuffer(device, &bufferInfo, nullptr, &buffer), [&]{
             JST_ERROR("[VULKAN] Can't create memory buffer.");
@@ -97,6 +98,9 @@ Result Implementation::destroy() {
     JST_DEBUG("[VULKAN] Destroying buffer.");
 
     if (!config.enableZeroCopy) {
+        // Pending copies might still target this buffer.
+        JST_CHECK(Backend::State<Device::Vulkan>()->synchronizeStagingRing());
+
         auto& device = Backend::State<Device::Vulkan>()->getDevice();
         vkDestroyBuffer(device, buffer, nullptr);
         vkFreeMemory(device, memory, nullptr);
@@ -114,33 +118,17 @@ Result Implementation::update(const U64& offset, const U64& size) {
         return Result::SUCCESS;
     }
 
-    auto& backend = Backend::State<Device::Vulkan>();
-
-    uint8_t* mappedData = static_cast<uint8_t*>(backend->getStagingBufferMappedMemory());
     const uint8_t* hostData = static_cast<const uint8_t*>(config.buffer);
     const auto& byteOffset = offset * config.elementByteSize;
     const auto& byteSize = size * config.elementByteSize;
 
-    if (byteSize >= backend->getStagingBufferSize()) {
-        JST_ERROR("[VULKAN] Memory copy is larger than the staging buffer.");
-        return Result::ERROR;
-    }
+    Statistics::CountBufferUpload(byteSize);
 
-    memcpy(mappedData, hostData + byteOffset, byteSize);
-
-    JST_CHECK(Backend::ExecuteOnce(backend->getDevice(),
-                                   backend->getComputeQueue(),
-                                   backend->getDefaultFence(),
-                                   backend->getDefaultCommandBuffer(),
-        [&](VkCommandBuffer& commandBuffer){
-            VkBufferCopy copyRegion{};
-            copyRegion.srcOffset = 0;
-            copyRegion.dstOffset = byteOffset;
-            copyRegion.size = byteSize;
-            vkCmdCopyBuffer(commandBuffer, backend->getStagingBuffer(), buffer, 1, &copyRegion);
-            return Result::SUCCESS;
-        }
-    ));
+    // Recorded in the staging ring and submitted before the next frame.
+    JST_CHECK(Backend::State<Device::Vulkan>()->stageBufferUpload(buffer,
+                                                                  byteOffset,
+                                                                  hostData + byteOffset,
+                                                                  byteSize));
 
     return Result::SUCCESS;
 }
@@ -2,6 +2,7 @@
 #include "jetstream/render/devices/vulkan/draw.hh"
 #include "jetstream/render/devices/vulkan/buffer.hh"
 #include "jetstream/backend/devices/vulkan/helpers.hh"
+#include "jetstream/render/statistics.hh"
 
 namespace Jetstream::Render {
 
@@ -118,6 +119,8 @@ Result Implementation::destroy() {
 Result Implementation::encode(VkCommandBuffer& commandBuffer) {
     JST_CHECK(buffer->encode(commandBuffer));
 
+    Statistics::CountDraws(buffer->isBuffered() ? indexedDrawCommands.size() : drawCommands.size());
+
     if (buffer->isBuffered()) {
         vkCmdDrawIndexedIndirect(commandBuffer, indexedIndirectBuffer->getHandle(), 0,
                                  indexedDrawCommands.size(), sizeof(VkDrawIndexedIndirectCommand));
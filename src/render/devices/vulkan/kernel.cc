@@ -1,6 +1,7 @@
 #include "jetstream/render/devices/vulkan/buffer.hh"
 #include "jetstream/render/devices/vulkan/kernel.hh"
 #include "jetstream/backend/devices/vulkan/helpers.hh"
+#include "jetstream/startup.hh"
 
 namespace Jetstream::Render {
 
@@ -15,6 +16,8 @@ Implementation::KernelImp(const Config& config) : Kernel(config) {
 }
 
 Result Implementation::create() {
+    JST_STARTUP_PHASE("Compute Pipeline Creation");
+
     JST_DEBUG("[VULKAN] Creating kernel.");
 
     auto& backend = Backend::State<Device::Vulkan>();
@@ -115,7 +118,7 @@ Result Implementation::create() {
     pipelineInfo.layout = pipelineLayout;
     pipelineInfo.stage = kernelStageInfo;
 
-    JST_VK_CHECK(vkCreateComputePipelines(device, VK_NULL_HANDLE, 1, &pipelineInfo, nullptr, &pipeline), [&]{
+    JST_VK_CHECK(vkCreateComputePipelines(device, backend->getPipelineCache(), 1, &pipelineInfo, nullptr, &pipeline), [&]{
         JST_ERROR("[VULKAN] Failed to create compute pipeline.");
     });
 
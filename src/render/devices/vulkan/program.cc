@@ -3,6 +3,7 @@
 #include "jetstream/render/devices/vulkan/texture.hh"
 #include "jetstream/render/devices/vulkan/program.hh"
 #include "jetstream/backend/devices/vulkan/helpers.hh"
+#include "jetstream/startup.hh"
 
 namespace Jetstream::Render {
 
@@ -30,6 +31,8 @@ Implementation::ProgramImp(const Config& config) : Program(config) {
 
 Result Implementation::create(VkRenderPass& renderPass,
                               const std::shared_ptr<TextureImp<Device::Vulkan>>& framebuffer) {
+    JST_STARTUP_PHASE("Render Pipeline Creation");
+
     JST_DEBUG("[VULKAN] Creating program.");
 
     auto& backend = Backend::State<Device::Vulkan>();
@@ -297,7 +300,7 @@ Result Implementation::create(VkRenderPass& renderPass,
     pipelineInfo.subpass = 0;
     pipelineInfo.basePipelineHandle = VK_NULL_HANDLE;
 
-    JST_VK_CHECK(vkCreateGraphicsPipelines(device, nullptr, 1, &pipelineInfo, nullptr, &graphicsPipeline), [&]{
+    JST_VK_CHECK(vkCreateGraphicsPipelines(device, backend->getPipelineCache(), 1, &pipelineInfo, nullptr, &graphicsPipeline), [&]{
         JST_ERROR("[VULKAN] Can't create graphics pipeline.");
     });
 
@@ -162,24 +162,51 @@ Result Implementation::destroy() {
     return Result::SUCCESS;
 }
 
+bool Implementation::resizeRequested() const {
+    return framebufferResolve->size() != requestedSize;
+}
+
 Result Implementation::encode(VkCommandBuffer& commandBuffer) {
-    if (framebufferResolve->size(requestedSize)) {
-        JST_VK_CHECK(vkQueueWaitIdle(Backend::State<Device::Vulkan>()->getGraphicsQueue()), [&]{
-            JST_ERROR("[VULKAN] Can't wait for graphics queue to finish for surface destruction.");
-        });
+    // The window already waited for the frames using the old framebuffer.
 
+    if (framebufferResolve->size(requestedSize)) {
         if (config.multisampled) {
             framebuffer->size(requestedSize);
         }
 
         JST_CHECK(destroy());
         JST_CHECK(create());
+
+        updated = true;
     }
 
+    // Keep the last frame if nothing changed.
+
+    if (!updated) {
+        return Result::SUCCESS;
+    }
+    updated = false;
+
     // Encode kernels.
 
-    for (auto& kernel : kernels) {
-        JST_CHECK(kernel->encode(commandBuffer));
+    for (U64 i = 0; i < kernels.size(); i++) {
+        // Kernels might read what the previous one wrote.
+
+        if (i > 0) {
+            VkMemoryBarrier memoryBarrier{};
+            memoryBarrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+            memoryBarrier.srcAccessMask = VK_ACCESS_SHADER_WRITE_BIT;
+            memoryBarrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT;
+            vkCmdPipelineBarrier(commandBuffer,
+                                 VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+                                 VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+                                 0,
+                                 1, &memoryBarrier,
+                                 0, nullptr,
+                                 0, nullptr);
+        }
+
+        JST_CHECK(kernels[i]->encode(commandBuffer));
     }
 
     // Ensure compute writes are visible to graphics.
@@ -1,5 +1,6 @@
 #include "jetstream/render/devices/vulkan/texture.hh"
 #include "jetstream/backend/devices/vulkan/helpers.hh"
+#include "jetstream/render/statistics.hh"
 
 namespace Jetstream::Render {
 
@@ -231,6 +232,7 @@ Result Implementation::fillRow(const U64& y, const U64& height) {
     const auto rowByteSize = config.size.x * GetPixelByteSize(pixelFormat);
     const auto bufferByteOffset = rowByteSize * y;
     const auto bufferByteSize = rowByteSize * height;
+    Statistics::CountTextureUpload(bufferByteSize);
 
     if (bufferByteSize >= backend->getStagingBufferSize()) {
         JST_ERROR("[VULKAN] Memory copy is larger than the staging buffer.");
@@ -240,9 +242,9 @@ Result Implementation::fillRow(const U64& y, const U64& height) {
     memcpy(mappedData, hostData + bufferByteOffset, bufferByteSize);
 
     JST_CHECK(Backend::ExecuteOnce(backend->getDevice(),
-                                   backend->getComputeQueue(),
+                                   backend->getGraphicsQueue(),
                                    backend->getDefaultFence(),
-                                   backend->getDefaultCommandBuffer(),
+                                   backend->getGraphicsCommandBuffer(),
         [&](VkCommandBuffer& commandBuffer){
             JST_CHECK(Backend::TransitionImageLayout(commandBuffer, 
                                                      texture, 
@@ -6,8 +6,6 @@
 
 #include "tools/imgui_impl_vulkan.h"
 
-const size_t MAX_FRAMES_IN_FLIGHT = 2;
-
 namespace Jetstream::Render {
 
 using Implementation = WindowImp<Device::Vulkan>;
@@ -32,6 +30,12 @@ Result Implementation::unbindSurface(const std::shared_ptr<Surface>& surface) {
 Result Implementation::underlyingCreate() {
     JST_DEBUG("[VULKAN] Creating window.");
 
+    if (config.framesInFlight < 1 || config.framesInFlight > 8) {
+        JST_ERROR("[VULKAN] Invalid number of frames in flight ({}). It should be between 1 and 8.",
+                  config.framesInFlight);
+        return Result::ERROR;
+    }
+
     auto& device = Backend::State<Device::Vulkan>()->getDevice();
     auto& headless = Backend::State<Device::Vulkan>()->headless();
     auto& physicalDevice = Backend::State<Device::Vulkan>()->getPhysicalDevice();
@@ -99,7 +103,7 @@ Result Implementation::underlyingCreate() {
 
     // Create command buffers.
 
-    commandBuffers.resize(viewport->getSwapchainImageViewsCount());
+    commandBuffers.resize(config.framesInFlight);
 
     VkCommandBufferAllocateInfo allocInfo{};
     allocInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
@@ -216,7 +220,8 @@ Result Implementation::createImgui() {
         .DescriptorPool = backend->getDescriptorPool(),
         .RenderPass = renderPass,
         .MinImageCount = static_cast<U32>(viewport->getSwapchainImageViewsCount()),
-        .ImageCount = static_cast<U32>(viewport->getSwapchainImageViewsCount()),
+        // ImGui cycles its vertex buffers over this count, so it covers every frame in flight.
+        .ImageCount = static_cast<U32>(std::max<U64>(viewport->getSwapchainImageViewsCount(), config.framesInFlight)),
         .MSAASamples = VK_SAMPLE_COUNT_1_BIT,
         .UseDynamicRendering = false,
         .CheckVkResultFn = nullptr,
@@ -261,6 +266,15 @@ Result Implementation::underlyingBegin() {
 
     vkWaitForFences(device, 1, &inFlightFences[currentFrame], VK_TRUE, UINT64_MAX);
 
+    // Surfaces can only be resized once no frame in flight samples them.
+
+    for (const auto& surface : surfaces) {
+        if (surface->resizeRequested()) {
+            vkWaitForFences(device, inFlightFences.size(), inFlightFences.data(), VK_TRUE, UINT64_MAX);
+            break;
+        }
+    }
+
     // Get next viewport framebuffer.
 
     const Result& result = viewport->nextDrawable(imageAvailableSemaphores[currentFrame]);
@@ -353,10 +367,16 @@ Result Implementation::underlyingEnd() {
     submitInfo.pSignalSemaphores = signalSemaphores.data();
     submitInfo.signalSemaphoreCount = signalSemaphores.size();
 
+    // Buffer updates of this frame have to execute before it.
+    JST_CHECK(Backend::State<Device::Vulkan>()->flushStagingRing());
+
     auto& graphicsQueue = Backend::State<Device::Vulkan>()->getGraphicsQueue();
-    if (vkQueueSubmit(graphicsQueue, 1, &submitInfo, inFlightFences[currentFrame]) != VK_SUCCESS) {
-        JST_ERROR("[VULKAN] Failed to submit draw command buffer.");
-        return Result::ERROR;
+    {
+        std::lock_guard<std::mutex> lock(Backend::QueueMutex());
+        if (vkQueueSubmit(graphicsQueue, 1, &submitInfo, inFlightFences[currentFrame]) != VK_SUCCESS) {
+            JST_ERROR("[VULKAN] Failed to submit draw command buffer.");
+            return Result::ERROR;
+        }
     }
 
     // Commit framebuffer to viewport.
@@ -375,7 +395,7 @@ Result Implementation::underlyingEnd() {
 
     // Increment frame counter.
 
-    currentFrame = (currentFrame + 1) % MAX_FRAMES_IN_FLIGHT;
+    currentFrame = (currentFrame + 1) % config.framesInFlight;
 
     return Result::SUCCESS;
 }
@@ -388,13 +408,24 @@ Result Implementation::underlyingSynchronize() {
     return Result::SUCCESS;
 }
 
+bool Implementation::underlyingStreamsTensors() const {
+    return viewport->streamsTensors();
+}
+
+Result Implementation::underlyingPushTensor(const std::string& id,
+                                            const std::span<const F32>& data,
+                                            const F32& min,
+                                            const F32& max) {
+    return viewport->pushTensor(id, data, min, max);
+}
+
 Result Implementation::createSynchronizationObjects() {
     auto& device = Backend::State<Device::Vulkan>()->getDevice();
 
     currentFrame = 0;
-    imageAvailableSemaphores.resize(MAX_FRAMES_IN_FLIGHT);
-    renderFinishedSemaphores.resize(MAX_FRAMES_IN_FLIGHT);
-    inFlightFences.resize(MAX_FRAMES_IN_FLIGHT);
+    imageAvailableSemaphores.resize(config.framesInFlight);
+    renderFinishedSemaphores.resize(config.framesInFlight);
+    inFlightFences.resize(config.framesInFlight);
 
     VkSemaphoreCreateInfo semaphoreInfo{};
     semaphoreInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
@@ -403,7 +434,7 @@ Result Implementation::createSynchronizationObjects() {
     fenceInfo.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
     fenceInfo.flags = VK_FENCE_CREATE_SIGNALED_BIT;
 
-    for (size_t i = 0; i < MAX_FRAMES_IN_FLIGHT; i++) {
+    for (size_t i = 0; i < config.framesInFlight; i++) {
         if (vkCreateSemaphore(device, &semaphoreInfo, nullptr, &imageAvailableSemaphores[i]) != VK_SUCCESS ||
             vkCreateSemaphore(device, &semaphoreInfo, nullptr, &renderFinishedSemaphores[i]) != VK_SUCCESS ||
             vkCreateFence(device, &fenceInfo, nullptr, &inFlightFences[i]) != VK_SUCCESS) {
@@ -418,7 +449,7 @@ Result Implementation::createSynchronizationObjects() {
 Result Implementation::destroySynchronizationObjects() {
     auto& device = Backend::State<Device::Vulkan>()->getDevice();
 
-    for (size_t i = 0; i < MAX_FRAMES_IN_FLIGHT; i++) {
+    for (size_t i = 0; i < config.framesInFlight; i++) {
         vkDestroySemaphore(device, renderFinishedSemaphores[i], nullptr);
         vkDestroySemaphore(device, imageAvailableSemaphores[i], nullptr);
         vkDestroyFence(device, inFlightFences[i], nullptr);
@@ -1,4 +1,5 @@
 #include "jetstream/render/devices/webgpu/buffer.hh"
+#include "jetstream/render/statistics.hh"
 
 namespace Jetstream::Render {
 
@@ -80,6 +81,8 @@ Result Implementation::update(const U64& offset, const U64& size) {
     const auto& byteOffset = offset * config.elementByteSize;
     const auto& byteSize = size * config.elementByteSize;
 
+    Statistics::CountBufferUpload(byteSize);
+
     WGPUQueue queue = wgpuDeviceGetQueue(device);
     wgpuQueueWriteBuffer(queue, buffer, byteOffset, (uint8_t*)config.buffer + byteOffset, byteSize);
 
@@ -1,6 +1,7 @@
 #include "jetstream/render/devices/webgpu/vertex.hh"
 #include "jetstream/render/devices/webgpu/draw.hh"
 #include "jetstream/render/devices/webgpu/buffer.hh"
+#include "jetstream/render/statistics.hh"
 
 namespace Jetstream::Render {
 
@@ -119,6 +120,8 @@ Result Implementation::destroy() {
 Result Implementation::encode(WGPURenderPassEncoder& renderPassEncoder) {
     JST_CHECK(buffer->encode(renderPassEncoder));
 
+    Statistics::CountDraws(config.numberOfDraws);
+
     // WebGPU doesn't support multi-draw. So we need to call multiple times.
     for (U64 i = 0; i < config.numberOfDraws; i++) {
         if (buffer->isBuffered()) {
@@ -1,6 +1,7 @@
 #include "jetstream/render/devices/webgpu/buffer.hh"
 #include "jetstream/render/devices/webgpu/kernel.hh"
 #include "jetstream/backend/devices/webgpu/helpers.hh"
+#include "jetstream/startup.hh"
 
 namespace Jetstream::Render {
 
@@ -15,6 +16,8 @@ Implementation::KernelImp(const Config& config) : Kernel(config) {
 }
 
 Result Implementation::create() {
+    JST_STARTUP_PHASE("Compute Pipeline Creation");
+
     JST_DEBUG("[WebGPU] Creating kernel.");
 
     // Load kernel from memory.
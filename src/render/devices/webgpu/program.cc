@@ -3,6 +3,7 @@
 #include "jetstream/render/devices/webgpu/texture.hh"
 #include "jetstream/render/devices/webgpu/program.hh"
 #include "jetstream/backend/devices/webgpu/helpers.hh"
+#include "jetstream/startup.hh"
 
 namespace Jetstream::Render {
 
@@ -29,6 +30,8 @@ Implementation::ProgramImp(const Config& config) : Program(config) {
 }
 
 Result Implementation::create(const WGPUTextureFormat& pixelFormat) {
+    JST_STARTUP_PHASE("Render Pipeline Creation");
+
     JST_DEBUG("[WebGPU] Creating program.");
 
     // Load shaders from memory.
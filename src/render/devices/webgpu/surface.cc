@@ -75,7 +75,16 @@ Result Implementation::draw(WGPUCommandEncoder& commandEncoder) {
     if (framebuffer->size(requestedSize)) {
         JST_CHECK(destroyFramebuffer());
         JST_CHECK(createFramebuffer());
+
+        updated = true;
+    }
+
+    // Keep the last frame if nothing changed.
+
+    if (!updated) {
+        return Result::SUCCESS;
     }
+    updated = false;
 
     // Encode kernels.
 
@@ -1,4 +1,5 @@
 #include "jetstream/render/devices/webgpu/texture.hh"
+#include "jetstream/render/statistics.hh"
 
 
 namespace Jetstream::Render {
@@ -95,6 +96,8 @@ Result Implementation::fillRow(const U64& y, const U64& height) {
     extent.height = static_cast<uint32_t>(height);
     extent.depthOrArrayLayers = 1u;
 
+    Statistics::CountTextureUpload(layout.bytesPerRow * height);
+
     WGPUTexelCopyTextureInfo copyTexture = WGPU_TEXEL_COPY_TEXTURE_INFO_INIT;
     copyTexture.texture = texture;
     copyTexture.mipLevel = 0;
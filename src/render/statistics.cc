@@ -0,0 +1,10 @@
+#include "jetstream/render/statistics.hh"
+
+namespace Jetstream::Render {
+
+Statistics& Statistics::Get() {
+    static Statistics statistics;
+    return statistics;
+}
+
+}  // namespace Jetstream::Render
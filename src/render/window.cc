@@ -74,6 +74,12 @@ Result Window::begin() {
     // Process attachment queues.
     JST_CHECK(processAttachmentQueues());
 
+    // Skip the frame if there is nothing new to draw.
+
+    if (config.renderOnDemand && !frameRequested()) {
+        return Result::SKIP;
+    }
+
     // Lock the frame queue.
     newFrameQueueMutex.lock();
 
@@ -143,6 +149,54 @@ Result Window::synchronize() {
     return res;
 }
 
+void Window::invalidate() {
+    if (!invalidated.exchange(true)) {
+        std::lock_guard<std::mutex> lock(invalidateMutex);
+        invalidateCond.notify_one();
+    }
+}
+
+bool Window::streamsTensors() const {
+    return underlyingStreamsTensors();
+}
+
+Result Window::pushTensor(const std::string& id, const std::span<const F32>& data, const F32& min, const F32& max) {
+    return underlyingPushTensor(id, data, min, max);
+}
+
+bool Window::frameRequested() {
+    // Input queued by the viewport is consumed by the next frame.
+
+    auto* context = ImGui::GetCurrentContext();
+    if (context && !context->InputEventsQueue.empty()) {
+        invalidate();
+    }
+
+    // Wait briefly for an invalidation. Input isn't signaled, so the
+    // wait is bounded and the caller polls again.
+
+    if (settleFrames == 0) {
+        std::unique_lock<std::mutex> lock(invalidateMutex);
+        invalidateCond.wait_for(lock, IdlePollInterval, [&]{
+            return invalidated.load();
+        });
+    }
+
+    if (invalidated.exchange(false)) {
+        settleFrames = SettleFrames;
+    }
+
+    const auto now = std::chrono::steady_clock::now();
+
+    if (settleFrames > 0 || (now - lastFrameTime) >= IdleFrameInterval) {
+        settleFrames -= (settleFrames > 0) ? 1 : 0;
+        lastFrameTime = now;
+        return true;
+    }
+
+    return false;
+}
+
 Result Window::bind(const std::shared_ptr<WindowAttachment>& attachment) {
     // Add attachment to bind queue.
     bindQueue.push(attachment);
@@ -186,6 +240,12 @@ Result Window::unbind(const std::shared_ptr<WindowAttachment>& attachment) {
 Result Window::processAttachmentQueues() {
     std::lock_guard<std::mutex> lock(newFrameQueueMutex);
 
+    // Draw new or removed attachments.
+
+    if (!bindQueue.empty() || !unbindQueue.empty()) {
+        invalidate();
+    }
+
     // Allocate space for belated attachments.
 
     std::vector<std::shared_ptr<WindowAttachment>> belated;
@@ -273,7 +333,8 @@ Result Window::unbind(const std::shared_ptr<Components::Generic>& component) {
 }
 
 bool Window::hasFont(const std::string& name) const {
-    return fonts.contains(name);
+    std::lock_guard<std::mutex> lock(fontMutex);
+    return fonts.contains(name) || pendingFonts.contains(name);
 }
 
 Result Window::addFont(const std::string& name, const std::shared_ptr<Components::Font>& font) {
@@ -284,21 +345,26 @@ Result Window::addFont(const std::string& name, const std::shared_ptr<Components
         return Result::ERROR;
     }
 
-    // Bind to window.
-
-    JST_CHECK(this->bind(font));
+    // Bound to the window when first used.
 
-    // Add to list.
-
-    fonts[name] = font;
+    std::lock_guard<std::mutex> lock(fontMutex);
+    pendingFonts[name] = font;
 
     return Result::SUCCESS;
 }
 
 Result Window::removeFont(const std::string& name) {
+    std::lock_guard<std::mutex> lock(fontMutex);
+
+    // Fonts never used were never bound.
+
+    if (pendingFonts.erase(name)) {
+        return Result::SUCCESS;
+    }
+
     // Check if font exists.
 
-    if (!hasFont(name)) {
+    if (!fonts.contains(name)) {
         JST_ERROR("[WINDOW] Font '{}' does not exist.", name);
         return Result::ERROR;
     }
@@ -315,8 +381,29 @@ Result Window::removeFont(const std::string& name) {
     return Result::SUCCESS;
 }
 
-const std::shared_ptr<Components::Font>& Window::font(const std::string& name) const {
-    return fonts.at(name);
+const std::shared_ptr<Components::Font>& Window::font(const std::string& name) {
+    static const std::shared_ptr<Components::Font> empty;
+
+    std::lock_guard<std::mutex> lock(fontMutex);
+
+    if (fonts.contains(name)) {
+        return fonts.at(name);
+    }
+
+    if (!pendingFonts.contains(name)) {
+        JST_ERROR("[WINDOW] Font '{}' does not exist.", name);
+        return empty;
+    }
+
+    // Bind to window.
+
+    auto font = pendingFonts.extract(name);
+    if (this->bind(font.mapped()) != Result::SUCCESS) {
+        JST_ERROR("[WINDOW] Failed to load font '{}'.", name);
+        return empty;
+    }
+
+    return fonts.insert(std::move(font)).position->second;
 }
 
 }  // namespace Jetstream::Render
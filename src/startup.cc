@@ -0,0 +1,139 @@
+#include <mutex>
+#include <chrono>
+#include <atomic>
+#include <algorithm>
+#include <unordered_map>
+
+#include "jetstream/startup.hh"
+#include "jetstream/compute/tracer.hh"
+#include "jetstream/logger.hh"
+
+namespace Jetstream {
+
+namespace {
+
+struct State {
+    // Initialized with the library, as close to the start of the process as it gets.
+    const std::chrono::steady_clock::time_point epoch = std::chrono::steady_clock::now();
+
+    std::atomic<bool> recording{true};
+    std::mutex mutex;
+    std::vector<StartupProfile::Phase> phases;
+    F64 total = 0.0;
+};
+
+State state;
+
+thread_local U64 depth = 0;
+
+U64 Now() {
+    const auto elapsed = std::chrono::steady_clock::now() - state.epoch;
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count();
+}
+
+}  // namespace
+
+StartupProfile::Scope::Scope(const char* name)
+     : name(name),
+       active(StartupProfile::Recording()),
+       start(active ? Now() : 0) {
+    if (active) {
+        depth++;
+    }
+}
+
+StartupProfile::Scope::~Scope() {
+    if (!active) {
+        return;
+    }
+    depth--;
+
+    const U64 end = Now();
+
+    if (Tracer::Enabled()) {
+        const U64 traceEnd = Tracer::Now();
+        Tracer::Record(name, "startup", traceEnd - (end - start), traceEnd);
+    }
+
+    std::lock_guard<std::mutex> lock(state.mutex);
+    state.phases.push_back({
+        .name = name,
+        .depth = depth,
+        .start = static_cast<F64>(start) / 1e6,
+        .duration = static_cast<F64>(end - start) / 1e6,
+    });
+}
+
+void StartupProfile::Finish() {
+    if (!state.recording.exchange(false)) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(state.mutex);
+    state.total = static_cast<F64>(Now()) / 1e6;
+}
+
+bool StartupProfile::Recording() {
+    return state.recording.load(std::memory_order_relaxed);
+}
+
+std::vector<StartupProfile::Phase> StartupProfile::Phases() {
+    std::lock_guard<std::mutex> lock(state.mutex);
+
+    auto phases = state.phases;
+    std::ranges::stable_sort(phases, [](const auto& a, const auto& b) {
+        return a.start < b.start;
+    });
+
+    return phases;
+}
+
+F64 StartupProfile::Total() {
+    if (Recording()) {
+        return static_cast<F64>(Now()) / 1e6;
+    }
+
+    std::lock_guard<std::mutex> lock(state.mutex);
+    return state.total;
+}
+
+std::string StartupProfile::Report() {
+    const auto phases = Phases();
+    const F64 total = Total();
+
+    // Merge phases with the same name and depth, in order of first appearance.
+    struct Row {
+        std::string name;
+        U64 depth;
+        U64 count;
+        F64 duration;
+    };
+    std::vector<Row> rows;
+    std::unordered_map<std::string, U64> index;
+
+    for (const auto& phase : phases) {
+        const auto key = jst::fmt::format("{}:{}", phase.depth, phase.name);
+        if (!index.contains(key)) {
+            index[key] = rows.size();
+            rows.push_back({phase.name, phase.depth, 0, 0.0});
+        }
+        auto& row = rows[index.at(key)];
+        row.count += 1;
+        row.duration += phase.duration;
+    }
+
+    std::string report;
+    report += jst::fmt::format("Startup took {:.1f} ms.\n", total);
+    report += jst::fmt::format("{:<40} {:>6} {:>12} {:>7}\n", "Phase", "Count", "Time (ms)", "Share");
+    for (const auto& row : rows) {
+        const auto name = std::string(row.depth * 2, ' ') + row.name;
+        report += jst::fmt::format("{:<40} {:>6} {:>12.1f} {:>6.1f}%\n", name,
+                                                                      row.count,
+                                                                      row.duration,
+                                                                      (total > 0.0) ? row.duration / total * 100.0 : 0.0);
+    }
+
+    return report;
+}
+
+}  // namespace Jetstream
@@ -5,6 +5,7 @@
 #include "jetstream/render/base.hh"
 #include "jetstream/viewport/base.hh"
 #include "jetstream/backend/base.hh"
+#include "jetstream/startup.hh"
 
 #include "flowgraph_manifest.hh"
 #include "jetstream/blocks/manifest.hh"
@@ -16,74 +17,122 @@ Store& Store::GetInstance() {
     return store;
 }
 
-Store::Store() {
-    Blocks::GetDefaultManifest(blockConstructorList, blockMetadataList);
-    Flowgraphs::GetDefaultManifest(flowgraphMetadataList);
+namespace {
+
+std::string Lower(const std::string& string) {
+    std::string lower = string;
+    std::transform(lower.begin(), lower.end(), lower.begin(), ::tolower);
+    return lower;
 }
 
-Result Store::_blockList(const std::string& filter) {
-    // Return if the filter is the same as last time.
-    if (filter == lastBlockFilter &&
-        !blockFilteredMetadataList.empty()) {
-        return Result::SUCCESS;
+// Fields are separated by a newline, a filter typed in the search box never spans two of them.
+template<typename... Fields>
+std::string IndexEntry(const Fields&... fields) {
+    std::string entry;
+    ((entry += Lower(fields), entry += '\n'), ...);
+    return entry;
+}
+
+// Entries matching a longer filter are a subset of the ones matching a shorter one. The
+// previous result is narrowed while the filter is being typed, and rebuilt otherwise.
+template<typename Manifest>
+void ApplyFilter(const Manifest& manifest,
+                 const std::unordered_map<std::string, std::string>& index,
+                 const std::string& filter,
+                 Manifest& filtered,
+                 std::string& lastFilter,
+                 bool& valid) {
+    const std::string filterLower = Lower(filter);
+
+    if (valid && filterLower == lastFilter) {
+        return;
+    }
+
+    const auto matches = [&](const std::string& key) {
+        return index.at(key).find(filterLower) != std::string::npos;
+    };
+
+    if (valid && filterLower.find(lastFilter) != std::string::npos) {
+        std::erase_if(filtered, [&](const auto& entry) {
+            return !matches(entry.first);
+        });
+    } else {
+        filtered.clear();
+        for (const auto& [key, value] : manifest) {
+            if (matches(key)) {
+                filtered.emplace_hint(filtered.end(), key, value);
+            }
+        }
     }
-    lastBlockFilter = filter;
 
-    // Apply filter logic.
-    blockFilteredMetadataList.clear();
+    lastFilter = filterLower;
+    valid = true;
+}
 
-    std::string filterLower = filter;
-    std::transform(filterLower.begin(), filterLower.end(), filterLower.begin(), ::tolower);
+}  // namespace
 
-    for (const auto& [key, value] : blockMetadataList) {
-        std::string titleLower = value.title;
-        std::transform(titleLower.begin(), titleLower.end(), titleLower.begin(), ::tolower);
+Store::Store() {}
 
-        std::string smallLower = value.summary;
-        std::transform(smallLower.begin(), smallLower.end(), smallLower.begin(), ::tolower);
+void Store::_loadBlockManifest() {
+    std::call_once(blockManifestFlag, [&]{
+        JST_STARTUP_PHASE("Block Manifest");
+
+        Blocks::GetDefaultManifest(blockConstructorList, blockMetadataList);
+        _indexBlocks();
+    });
+}
 
-        std::string detailedLower = value.description;
-        std::transform(detailedLower.begin(), detailedLower.end(), detailedLower.begin(), ::tolower);
+void Store::_loadFlowgraphManifest() {
+    std::call_once(flowgraphManifestFlag, [&]{
+        Flowgraphs::GetDefaultManifest(flowgraphMetadataList);
 
-        // Case-insensitive search.
-        if (titleLower.find(filterLower) != std::string::npos ||
-            smallLower.find(filterLower) != std::string::npos ||
-            detailedLower.find(filterLower) != std::string::npos ||
-            filter.empty()) {
-            blockFilteredMetadataList[key] = value;
+        for (const auto& [key, value] : flowgraphMetadataList) {
+            flowgraphSearchIndex[key] = IndexEntry(value.title, value.description);
         }
+    });
+}
+
+void Store::_indexBlocks() {
+    blockSearchIndex.clear();
+
+    for (const auto& [key, value] : blockMetadataList) {
+        blockSearchIndex[key] = IndexEntry(value.title, value.summary, value.description);
     }
 
-    return Result::SUCCESS;
+    blockFilterValid = false;
 }
 
-Result Store::_flowgraphList(const std::string& filter) {
-    // Return if the filter is the same as last time.
-    if (filter == lastFlowgraphFilter &&
-        !filteredFlowgraphMetadataList.empty()) {
-        return Result::SUCCESS;
-    }
-    lastFlowgraphFilter = filter;
+Result Store::_loadBlocks(const BlockLoaderFunc& loader) {
+    _loadBlockManifest();
 
-    // Apply filter logic.
-    filteredFlowgraphMetadataList.clear();
+    JST_CHECK(loader(blockConstructorList, blockMetadataList));
+    _indexBlocks();
 
-    std::string filterLower = filter;
-    std::transform(filterLower.begin(), filterLower.end(), filterLower.begin(), ::tolower);
+    return Result::SUCCESS;
+}
 
-    for (const auto& [key, value] : flowgraphMetadataList) {
-        std::string titleLower = value.title;
-        std::transform(titleLower.begin(), titleLower.end(), titleLower.begin(), ::tolower);
+Result Store::_blockList(const std::string& filter) {
+    _loadBlockManifest();
 
-        std::string descriptionLower = value.description;
-        std::transform(descriptionLower.begin(), descriptionLower.end(), descriptionLower.begin(), ::tolower);
+    ApplyFilter(blockMetadataList,
+                blockSearchIndex,
+                filter,
+                blockFilteredMetadataList,
+                lastBlockFilter,
+                blockFilterValid);
 
-        // Case-insensitive search.
-        if (titleLower.find(filterLower) != std::string::npos ||
-            descriptionLower.find(filterLower) != std::string::npos) {
-            filteredFlowgraphMetadataList[key] = value;
-        }
-    }
+    return Result::SUCCESS;
+}
+
+Result Store::_flowgraphList(const std::string& filter) {
+    _loadFlowgraphManifest();
+
+    ApplyFilter(flowgraphMetadataList,
+                flowgraphSearchIndex,
+                filter,
+                filteredFlowgraphMetadataList,
+                lastFlowgraphFilter,
+                flowgraphFilterValid);
 
     return Result::SUCCESS;
 }
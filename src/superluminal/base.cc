@@ -1,4 +1,5 @@
 #include <regex>
+#include <chrono>
 #include <unordered_map>
 #include <unordered_set>
 #include <vector>
@@ -41,10 +42,28 @@ struct Superluminal::Impl {
         std::shared_ptr<Jetstream::Block> block;
         std::function<void()> callback;
         bool active = false;
+        U64 importHash = 0;
     };
 
     std::unordered_map<std::string, PlotState> plots;
 
+    // Imported buffers by hash. Plots sharing a buffer share its import.
+
+    struct ImportState {
+        std::function<void()> request;
+        std::function<Result(const VariantBufferType&)> swap;
+        std::function<Result(const VariantBufferType&)> push;
+        std::function<Result(VariantBufferType&)> exchange;
+        std::function<bool()> queued;
+        std::function<bool()> full;
+        std::function<U64()> dropped;
+    };
+
+    std::unordered_map<U64, ImportState> imports;
+
+    // Sinks handed out by `Stream`, closed when the graph is destroyed.
+    std::vector<std::shared_ptr<Sink>> sinks;
+
     // Image cache for loaded textures
     struct ImageData {
         std::shared_ptr<Render::Texture> texture;
@@ -55,6 +74,7 @@ struct Superluminal::Impl {
     std::unordered_set<std::string> failedImagePaths;
 
     Result createGraph();
+    Result importGraph();
     Result destroyGraph();
 
     Result validateBounds();
@@ -65,6 +85,8 @@ struct Superluminal::Impl {
 
     Result buildLinePlotGraph(PlotState& state);
     Result buildWaterfallPlotGraph(PlotState& state);
+    Result buildHeatPlotGraph(PlotState& state);
+    Result buildScatterPlotGraph(PlotState& state);
 
     Result loadImageFromFile(const std::string& filepath, ImageData& imageData);
 
@@ -78,10 +100,38 @@ struct Superluminal::Impl {
 
     typedef std::vector<std::tuple<std::string, GraphNode>> Graph;
 
+    // Output ports of the sub-graphs shared by the plots, by the key of the
+    // sub-graph. Plots reading the same port with the same transforms reuse them.
+
+    std::unordered_map<std::string, std::string> sharedPorts;
+
+    Result buildSharedGraph(const std::string& key, const Graph& graph, const std::string& output, std::string& port);
+    Result buildSliceGraph(const PlotState& state, std::string& port);
+    Result buildScaleGraph(const PlotState& state, std::string& port);
+
     static std::string ParseLinkDomain(const std::string& value, const std::string& domain);
     static std::vector<char> GraphToYaml(const Graph& graph, std::string domain = {});
 };
 
+struct Superluminal::Sink::Impl {
+    Superluminal::Impl::ImportState import;
+    OverflowPolicy policy = OverflowPolicy::DropOldest;
+    std::vector<U64> shape;
+    std::function<void()> wake;
+
+    std::atomic<bool> closed{false};
+    std::atomic<U64> dropped{0};
+
+    Result admit();
+
+    template<typename T>
+    Result push(const std::span<const T>& data);
+};
+
+Superluminal::Sink::Sink() : impl(std::make_unique<Impl>()) {}
+
+Superluminal::Sink::~Sink() = default;
+
 Superluminal::Superluminal() : impl(std::make_unique<Impl>()) {
     impl->initialized = false;
     impl->running = false;
@@ -109,13 +159,14 @@ Result Superluminal::initialize(const InstanceConfig& config) {
 
     Backend::Config backendConfig {
         .deviceId = impl->config.deviceId,
-        .remote = impl->config.remote,
+        .remote = impl->config.remote || !impl->config.output.empty(),
     };
 
     Viewport::Config viewportConfig {
         .title = impl->config.windowTitle,
         .size = impl->config.interfaceSize,
         .codec = Viewport::VideoCodec::H264,
+        .output = impl->config.output,
     };
 
     Render::Window::Config renderConfig {
@@ -172,14 +223,10 @@ Result Superluminal::terminate() {
     impl->imageCache.clear();
     impl->failedImagePaths.clear();
 
-    // Destroy instance.
+    // Destroy instance. Its backends are released, other instances might still use them.
 
     impl->instance.destroy();
 
-    // Destroy backend.
-
-    Backend::DestroyAll();
-
     // Update the state.
 
     impl->initialized = false;
@@ -220,19 +267,34 @@ Result Superluminal::start() {
     // Start the compute, present, and input threads.
 
     impl->computeThread = std::thread([&]{
+        ApplyThreadPolicy(ThreadRole::Compute);
+
         while (impl->instance.computing()) {
             impl->computeSync.wait(true);
 
-            JST_CHECK_THROW(impl->instance.compute());
+            // Consume the request before computing, so updates made
+            // while computing are picked up by the next cycle.
 
             impl->computeSync.test_and_set();
-            impl->computeSync.notify_all();
+
+            JST_CHECK_THROW(impl->instance.compute());
+
+            // Keep computing while pushed buffers are queued.
+
+            for (const auto& [_, import] : impl->imports) {
+                if (import.queued()) {
+                    impl->computeSync.clear();
+                    break;
+                }
+            }
         }
 
         JST_DEBUG("[SUPERLUMINAL] Compute thread safed.");
     });
 
     impl->presentThread = std::thread([&]{
+        ApplyThreadPolicy(ThreadRole::Present);
+
         while (impl->instance.presenting()) {
             if (impl->instance.begin() == Result::SKIP) {
                 continue;
@@ -286,6 +348,12 @@ Result Superluminal::start() {
 
     impl->running = true;
 
+    StartupProfile::Finish();
+
+    if (impl->config.profileStartup) {
+        JST_INFO("[SUPERLUMINAL] Startup profile:\n{}", StartupProfile::Report());
+    }
+
     JST_INFO("[SUPERLUMINAL] Instance started successfully.");
     return Result::SUCCESS;
 }
@@ -334,8 +402,51 @@ Result Superluminal::stop() {
     return Result::SUCCESS;
 }
 
-Result Superluminal::update(const std::string&) {
-    // TODO: Implement plot level update logic.
+Result Superluminal::update(const std::string& name) {
+    // Mark the changed buffers. The imports of the other
+    // buffers yield, skipping the modules reading them.
+
+    if (name.empty()) {
+        for (auto& [_, import] : impl->imports) {
+            import.request();
+        }
+    } else {
+        if (!impl->plots.contains(name)) {
+            JST_ERROR("[SUPERLUMINAL] Can't update because the plot '{}' doesn't exist.", name);
+            return Result::ERROR;
+        }
+
+        const auto& plot = impl->plots.at(name);
+
+        if (impl->imports.contains(plot.importHash)) {
+            impl->imports.at(plot.importHash).request();
+        }
+    }
+
+    impl->computeSync.clear();
+    impl->computeSync.notify_all();
+
+    return Result::SUCCESS;
+}
+
+Result Superluminal::update(const std::string& name, const VariantBufferType& buffer) {
+    // Check boundaries.
+
+    if (!impl->plots.contains(name)) {
+        JST_ERROR("[SUPERLUMINAL] Can't update because the plot '{}' doesn't exist.", name);
+        return Result::ERROR;
+    }
+
+    const auto& plot = impl->plots.at(name);
+
+    if (!impl->imports.contains(plot.importHash)) {
+        JST_ERROR("[SUPERLUMINAL] Can't swap the buffer of plot '{}' because it isn't running.", name);
+        return Result::ERROR;
+    }
+
+    // Queue the copy into the imported buffer, the graph isn't rebuilt.
+
+    JST_CHECK(impl->imports.at(plot.importHash).swap(buffer));
 
     impl->computeSync.clear();
     impl->computeSync.notify_all();
@@ -343,6 +454,158 @@ Result Superluminal::update(const std::string&) {
     return Result::SUCCESS;
 }
 
+Result Superluminal::push(const std::string& name, const VariantBufferType& buffer) {
+    // Check boundaries.
+
+    if (!impl->plots.contains(name)) {
+        JST_ERROR("[SUPERLUMINAL] Can't push because the plot '{}' doesn't exist.", name);
+        return Result::ERROR;
+    }
+
+    const auto& plot = impl->plots.at(name);
+
+    if (!impl->imports.contains(plot.importHash)) {
+        JST_ERROR("[SUPERLUMINAL] Can't push to plot '{}' because it isn't running.", name);
+        return Result::ERROR;
+    }
+
+    // Queue a copy of the buffer and wake up the compute thread without waiting for it.
+
+    JST_CHECK(impl->imports.at(plot.importHash).push(buffer));
+
+    impl->computeSync.clear();
+    impl->computeSync.notify_all();
+
+    return Result::SUCCESS;
+}
+
+Result Superluminal::stream(const std::string& name, std::shared_ptr<Sink>& sink, const Sink::OverflowPolicy& policy) {
+    // Check boundaries.
+
+    if (!impl->plots.contains(name)) {
+        JST_ERROR("[SUPERLUMINAL] Can't stream because the plot '{}' doesn't exist.", name);
+        return Result::ERROR;
+    }
+
+    const auto& plot = impl->plots.at(name);
+
+    if (!impl->imports.contains(plot.importHash)) {
+        JST_ERROR("[SUPERLUMINAL] Can't stream to plot '{}' because it isn't running.", name);
+        return Result::ERROR;
+    }
+
+    // Create sink.
+
+    sink = std::make_shared<Sink>();
+
+    sink->impl->import = impl->imports.at(plot.importHash);
+    sink->impl->policy = policy;
+    sink->impl->shape = std::visit([](const auto& buffer) {
+        return buffer.shape();
+    }, plot.config.buffer);
+    sink->impl->wake = [this]{
+        impl->computeSync.clear();
+        impl->computeSync.notify_all();
+    };
+
+    impl->sinks.push_back(sink);
+
+    return Result::SUCCESS;
+}
+
+Result Superluminal::Sink::Impl::admit() {
+    if (closed) {
+        JST_ERROR("[SUPERLUMINAL] Can't push because the plot isn't running anymore.");
+        return Result::ERROR;
+    }
+
+    // The ring drops the oldest buffer by itself.
+
+    if (policy == OverflowPolicy::DropOldest || !import.full()) {
+        return Result::SUCCESS;
+    }
+
+    if (policy == OverflowPolicy::DropNewest) {
+        dropped += 1;
+        return Result::SKIP;
+    }
+
+    // Keep the compute thread awake until it frees a slot.
+
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+
+    while (import.full()) {
+        if (closed || std::chrono::steady_clock::now() > deadline) {
+            JST_TRACE("[SUPERLUMINAL] Timed out waiting for space, dropping the pushed buffer.");
+            dropped += 1;
+            return Result::SKIP;
+        }
+
+        wake();
+        std::this_thread::sleep_for(std::chrono::microseconds(100));
+    }
+
+    return Result::SUCCESS;
+}
+
+template<typename T>
+Result Superluminal::Sink::Impl::push(const std::span<const T>& data) {
+#ifdef JETSTREAM_BACKEND_CPU_AVAILABLE
+    U64 size = 1;
+    for (const auto& dim : shape) {
+        size *= dim;
+    }
+
+    if (data.size() != size) {
+        JST_ERROR("[SUPERLUMINAL] Can't push {} elements into a buffer of {} elements.", data.size(), size);
+        return Result::ERROR;
+    }
+
+    const auto result = admit();
+    if (result != Result::SUCCESS) {
+        return result;
+    }
+
+    // The import copies from the span before returning.
+
+    const VariantBufferType buffer = Tensor<Device::CPU, T>(const_cast<T*>(data.data()), shape);
+    JST_CHECK(import.push(buffer));
+
+    wake();
+
+    return Result::SUCCESS;
+#else
+    (void)data;
+    JST_ERROR("[SUPERLUMINAL] Can't push elements without the CPU backend.");
+    return Result::ERROR;
+#endif
+}
+
+Result Superluminal::Sink::push(const std::span<const F32>& data) {
+    return impl->push(data);
+}
+
+Result Superluminal::Sink::push(const std::span<const CF32>& data) {
+    return impl->push(data);
+}
+
+Result Superluminal::Sink::push(VariantBufferType& buffer) {
+    const auto result = impl->admit();
+    if (result != Result::SUCCESS) {
+        return result;
+    }
+
+    JST_CHECK(impl->import.exchange(buffer));
+
+    impl->wake();
+
+    return Result::SUCCESS;
+}
+
+U64 Superluminal::Sink::dropped() const {
+    return impl->dropped + (impl->import.dropped ? impl->import.dropped() : 0);
+}
+
 bool Superluminal::presenting() {
     return impl->instance.running();
 }
@@ -584,6 +847,16 @@ Result Superluminal::Impl::createGraph() {
 
     JST_CHECK(instance.flowgraph().create());
 
+    // Build the compute graphs only once after all blocks are added.
+
+    JST_CHECK(instance.transaction([&]{
+        return importGraph();
+    }));
+
+    return Result::SUCCESS;
+}
+
+Result Superluminal::Impl::importGraph() {
     // Import memory buffers.
 
     struct InputMemoryRecipe {
@@ -594,6 +867,8 @@ Result Superluminal::Impl::createGraph() {
 
     std::unordered_map<U64, InputMemoryRecipe> buffer_map;
 
+    sharedPorts.clear();
+
     for (auto& [_, state] : plots) {
         if (state.config.type == Type::Interface) {
             continue;
@@ -602,6 +877,7 @@ Result Superluminal::Impl::createGraph() {
         auto& prototype = std::visit(VariantBufferTypeVisitor{}, state.config.buffer);
 
         auto& recipe = buffer_map[prototype.hash()];
+        state.importHash = prototype.hash();
 
         recipe.buffer = state.config.buffer;
         recipe.source = state.config.source;
@@ -621,9 +897,46 @@ Result Superluminal::Impl::createGraph() {
                 JST_CHECK(instance.addBlock(
                     import, jst::fmt::format("data_{}_{}_{}", GetDeviceName(D), sourceDomain, hash), {
                         .buffer = std::get<Tensor<D, T>>(recipe.buffer),
+                        .depth = config.pushDepth,
                     }, {}, {}
                 ));
 
+                imports[hash] = {
+                    .request = [import]{
+                        import->request();
+                    },
+                    .swap = [import](const VariantBufferType& buffer) {
+                        if (!std::holds_alternative<Tensor<D, T>>(buffer)) {
+                            JST_ERROR("[SUPERLUMINAL] Can't swap buffer with a different device or data type.");
+                            return Result::ERROR;
+                        }
+                        return import->swap(std::get<Tensor<D, T>>(buffer));
+                    },
+                    .push = [import](const VariantBufferType& buffer) {
+                        if (!std::holds_alternative<Tensor<D, T>>(buffer)) {
+                            JST_ERROR("[SUPERLUMINAL] Can't push buffer with a different device or data type.");
+                            return Result::ERROR;
+                        }
+                        return import->push(std::get<Tensor<D, T>>(buffer));
+                    },
+                    .exchange = [import](VariantBufferType& buffer) {
+                        if (!std::holds_alternative<Tensor<D, T>>(buffer)) {
+                            JST_ERROR("[SUPERLUMINAL] Can't push buffer with a different device or data type.");
+                            return Result::ERROR;
+                        }
+                        return import->exchange(std::get<Tensor<D, T>>(buffer));
+                    },
+                    .queued = [import]{
+                        return import->queued();
+                    },
+                    .full = [import]{
+                        return import->full();
+                    },
+                    .dropped = [import]{
+                        return import->dropped();
+                    },
+                };
+
                 if (D != config.preferredDevice) {
                     std::string deviceNameStr;
 
@@ -732,11 +1045,13 @@ Result Superluminal::Impl::createGraph() {
             case Type::Waterfall:
                 buildWaterfallPlotGraph(state);
                 break;
-            case Type::Interface:
-                break;
             case Type::Heat:
+                buildHeatPlotGraph(state);
+                break;
             case Type::Scatter:
-                JST_FATAL("[SUPERLUMINAL] Plot type for '{}' not implemented yet.", name);
+                buildScatterPlotGraph(state);
+                break;
+            case Type::Interface:
                 break;
         }
     }
@@ -753,6 +1068,14 @@ Result Superluminal::Impl::destroyGraph() {
         state.block = {};
     }
 
+    for (auto& sink : sinks) {
+        sink->impl->closed = true;
+    }
+    sinks.clear();
+
+    imports.clear();
+    sharedPorts.clear();
+
     // Destroy flowgraph.
 
     JST_CHECK(instance.flowgraph().destroy());
@@ -760,6 +1083,97 @@ Result Superluminal::Impl::destroyGraph() {
     return Result::SUCCESS;
 }
 
+Result Superluminal::Impl::buildSharedGraph(const std::string& key,
+                                            const Graph& graph,
+                                            const std::string& output,
+                                            std::string& port) {
+    if (sharedPorts.contains(key)) {
+        JST_DEBUG("[SUPERLUMINAL] Reusing shared graph '{}'.", key);
+        port = sharedPorts.at(key);
+        return Result::SUCCESS;
+    }
+
+    const auto domain = jst::fmt::format("shared{}", sharedPorts.size());
+    JST_CHECK(instance.flowgraph().importFromBlob(GraphToYaml(graph, domain)));
+
+    port = ParseLinkDomain(output, domain + "_");
+    sharedPorts[key] = port;
+
+    return Result::SUCCESS;
+}
+
+Result Superluminal::Impl::buildSliceGraph(const PlotState& state, std::string& port) {
+    auto& prototype = std::visit(VariantBufferTypeVisitor{}, state.config.buffer);
+
+    U64 axis = state.config.channelAxis;
+    U64 index = state.config.channelIndex;
+
+    // Parse slice string.
+
+    std::string slice;
+    for (U64 i = 0; i < prototype.rank(); i++) {
+        if (i == axis) {
+            slice += jst::fmt::format("{}", index);
+        } else {
+            slice += jst::fmt::format(":");
+        }
+        if (i != prototype.rank() - 1) {
+            slice += ",";
+        }
+    }
+    slice = jst::fmt::format("'[{}]'", slice);
+
+    // Create slice module.
+
+    const Graph graph = {
+        {"slice",
+            {"slice", GetDeviceName(config.preferredDevice), {"CF32"},
+                {{"slice", slice}},
+                {{"buffer", port}}}},
+        {"duplicate",
+            {"duplicate", GetDeviceName(config.preferredDevice), {"CF32"}, {},
+                {{"buffer", "${domain.slice.output.buffer}"}}}},
+    };
+
+    return buildSharedGraph(jst::fmt::format("slice:{}:{}", port, slice), graph,
+                            "${domain.duplicate.output.buffer}", port);
+}
+
+Result Superluminal::Impl::buildScaleGraph(const PlotState& state, std::string& port) {
+    // Check if the source buffer is real (F32) or complex (CF32)
+    BufferTypeDetectorVisitor<F32> realDetector;
+    std::visit(realDetector, state.config.buffer);
+    bool isRealBuffer = realDetector.matches;
+
+    // For real signals in time domain, skip amplitude conversion
+    if (isRealBuffer && state.config.display == Domain::Time) {
+        const Graph graph = {
+            {"scl",
+                {"scale", GetDeviceName(config.preferredDevice), {"F32"},
+                    {{"range", "[-1, 1]"}},  // Real signals typically have different scale range
+                    {{"buffer", port}}}},
+        };
+
+        return buildSharedGraph(jst::fmt::format("scale:{}", port), graph,
+                                "${domain.scl.output.buffer}", port);
+    }
+
+    std::string inputType = isRealBuffer ? "F32" : "CF32";
+
+    const Graph graph = {
+        {"amp",
+            {"amplitude", GetDeviceName(config.preferredDevice), {inputType, "F32"}, {},
+                {{"buffer", port}}}},
+        {"scl",
+            {"scale", GetDeviceName(config.preferredDevice), {"F32"},
+                {{"range", "[-100, 0]"}},
+                {{"buffer", "${domain.amp.output.buffer}"}}}},
+    };
+
+    return buildSharedGraph(jst::fmt::format("amplitude:{}", port), graph,
+                            "${domain.scl.output.buffer}", port);
+}
+
 Result Superluminal::Impl::buildLinePlotGraph(PlotState& state) {
     JST_DEBUG("[SUPERLUMINAL] Building line plot graph named '{}'.", state.name);
 
@@ -793,44 +1207,18 @@ Result Superluminal::Impl::buildLinePlotGraph(PlotState& state) {
     auto hash = std::to_string(prototype.hash());
     auto port = jst::fmt::format("${{graph.data_{}_{}_{}.output.buffer}}", GetDeviceName(config.preferredDevice), domain, hash);
 
-    // Check if the source buffer is real (F32) or complex (CF32)
-    BufferTypeDetectorVisitor<F32> realDetector;
-    std::visit(realDetector, state.config.buffer);
-    bool isRealBuffer = realDetector.matches;
+    // The amplitude and scale are shared with the other plots of the same buffer.
 
-    // For real signals in time domain, we don't need amplitude conversion
-    if (isRealBuffer && state.config.display == Domain::Time) {
-        auto blob = GraphToYaml({
-            {"scl",
-                {"scale", GetDeviceName(config.preferredDevice), {"F32"},
-                    {{"range", "[-1, 1]"}},  // Real signals typically have different scale range
-                    {{"buffer", port}}}},
-            {"lineplot",
-                {"lineplot", GetDeviceName(config.preferredDevice), {"F32"},
-                    {{"averaging", averagingRate},
-                     {"decimation", decimationRate}},
-                    {{"buffer", "${domain.scl.output.buffer}"}}}},
-        }, state.name);
-        instance.flowgraph().importFromBlob(blob);
-    } else {
-        std::string inputType = isRealBuffer ? "F32" : "CF32";
+    JST_CHECK(buildScaleGraph(state, port));
 
-        auto blob = GraphToYaml({
-            {"amp",
-                {"amplitude", GetDeviceName(config.preferredDevice), {inputType, "F32"}, {},
-                    {{"buffer", port}}}},
-            {"scl",
-                {"scale", GetDeviceName(config.preferredDevice), {"F32"},
-                    {{"range", "[-100, 0]"}},
-                    {{"buffer", "${domain.amp.output.buffer}"}}}},
-            {"lineplot",
-                {"lineplot", GetDeviceName(config.preferredDevice), {"F32"},
-                    {{"averaging", averagingRate},
-                     {"decimation", decimationRate}},
-                    {{"buffer", "${domain.scl.output.buffer}"}}}},
-        }, state.name);
-        instance.flowgraph().importFromBlob(blob);
-    }
+    auto blob = GraphToYaml({
+        {"lineplot",
+            {"lineplot", GetDeviceName(config.preferredDevice), {"F32"},
+                {{"averaging", averagingRate},
+                 {"decimation", decimationRate}},
+                {{"buffer", port}}}},
+    }, state.name);
+    instance.flowgraph().importFromBlob(blob);
 
     // Update plot state.
 
@@ -858,90 +1246,142 @@ Result Superluminal::Impl::buildWaterfallPlotGraph(PlotState& state) {
 
     // Build graph.
 
-    auto graph = Graph{};
     auto hash = std::to_string(prototype.hash());
     auto domain = (state.config.display == Domain::Time) ? "time" : "freq";
     auto port = jst::fmt::format("${{graph.data_{}_{}_{}.output.buffer}}", GetDeviceName(config.preferredDevice), domain, hash);
 
+    // The slice, amplitude, and scale are shared with the other plots of the same buffer.
+
     if (state.config.channelAxis != -1 && state.config.channelIndex != -1) {
-        U64 axis = state.config.channelAxis;
-        U64 index = state.config.channelIndex;
+        JST_CHECK(buildSliceGraph(state, port));
+    }
 
-        // Parse slice string.
+    JST_CHECK(buildScaleGraph(state, port));
 
-        std::string slice;
-        for (U64 i = 0; i < prototype.rank(); i++) {
-            if (i == axis) {
-                slice += jst::fmt::format("{}", index);
-            } else {
-                slice += jst::fmt::format(":");
-            }
-            if (i != prototype.rank() - 1) {
-                slice += ",";
-            }
-        }
-        slice = jst::fmt::format("'[{}]'", slice);
+    auto blob = GraphToYaml({
+        {"waterfall",
+            {"waterfall", GetDeviceName(config.preferredDevice), {"F32"},
+                {{"height", height}},
+                {{"buffer", port}}}},
+    }, state.name);
+    instance.flowgraph().importFromBlob(blob);
+
+    // Update plot state.
 
-        // Create slice module.
+    state.block = instance.flowgraph().nodes()[{state.name + "_waterfall"}]->block;
 
-        graph.push_back({
-            "slice",
-            {"slice", GetDeviceName(config.preferredDevice), {"CF32"},
-                {{"slice", slice}},
-                {{"buffer", port}}},
-        });
+    return Result::SUCCESS;
+}
 
-        graph.push_back({
-            "duplicate",
-            {"duplicate", GetDeviceName(config.preferredDevice), {"CF32"}, {},
-                {{"buffer", "${domain.slice.output.buffer}"}}},
-        });
+Result Superluminal::Impl::buildHeatPlotGraph(PlotState& state) {
+    JST_DEBUG("[SUPERLUMINAL] Building heat plot graph named '{}'.", state.name);
 
-        port = jst::fmt::format("${{domain.duplicate.output.buffer}}");
+    // Access buffer metadata.
+
+    auto& prototype = std::visit(VariantBufferTypeVisitor{}, state.config.buffer);
+
+    // Poll options.
+
+    std::string height = "256";
+
+    if (state.config.options.contains("height")) {
+        auto h = std::get<I32>(state.config.options["height"]);
+        JST_DEBUG("[SUPERLUMINAL] Height set to {}.", h);
+        height = std::to_string(h);
     }
 
-    // Check if the source buffer is real (F32) or complex (CF32)
-    BufferTypeDetectorVisitor<F32> realDetector;
-    std::visit(realDetector, state.config.buffer);
-    bool isRealBuffer = realDetector.matches;
+    // Build graph.
 
-    // For real signals in time domain, skip amplitude conversion
-    if (isRealBuffer && state.config.display == Domain::Time) {
-        graph.push_back({
-            "scl",
-            {"scale", GetDeviceName(config.preferredDevice), {"F32"},
-                {{"range", "[-1, 1]"}},  // Real signals typically have different scale range
-                {{"buffer", port}}},
-        });
-    } else {
-        std::string inputType = isRealBuffer ? "F32" : "CF32";
+    auto hash = std::to_string(prototype.hash());
+    auto domain = (state.config.display == Domain::Time) ? "time" : "freq";
+    auto port = jst::fmt::format("${{graph.data_{}_{}_{}.output.buffer}}", GetDeviceName(config.preferredDevice), domain, hash);
 
-        graph.push_back({
-            "amp",
-            {"amplitude", GetDeviceName(config.preferredDevice), {inputType, "F32"}, {},
-                {{"buffer", port}}},
-        });
+    // The slice, amplitude, and scale are shared with the other plots of the same buffer.
 
-        graph.push_back({
-            "scl",
-            {"scale", GetDeviceName(config.preferredDevice), {"F32"},
-                {{"range", "[-100, 0]"}},
-                {{"buffer", "${domain.amp.output.buffer}"}}},
-        });
+    if (state.config.channelAxis != -1 && state.config.channelIndex != -1) {
+        JST_CHECK(buildSliceGraph(state, port));
     }
 
-    graph.push_back({
-        "waterfall",
-        {"waterfall", GetDeviceName(config.preferredDevice), {"F32"},
-            {{"height", height}},
-            {{"buffer", "${domain.scl.output.buffer}"}}},
-    });
+    JST_CHECK(buildScaleGraph(state, port));
 
-    instance.flowgraph().importFromBlob(GraphToYaml(graph, state.name));
+    // Every row is accumulated into a decaying texture on the device.
+
+    auto blob = GraphToYaml({
+        {"spectrogram",
+            {"spectrogram", GetDeviceName(config.preferredDevice), {"F32"},
+                {{"height", height}},
+                {{"buffer", port}}}},
+    }, state.name);
+    instance.flowgraph().importFromBlob(blob);
 
     // Update plot state.
 
-    state.block = instance.flowgraph().nodes()[{state.name + "_waterfall"}]->block;
+    state.block = instance.flowgraph().nodes()[{state.name + "_spectrogram"}]->block;
+
+    return Result::SUCCESS;
+}
+
+Result Superluminal::Impl::buildScatterPlotGraph(PlotState& state) {
+    JST_DEBUG("[SUPERLUMINAL] Building scatter plot graph named '{}'.", state.name);
+
+    // Access buffer metadata.
+
+    auto& prototype = std::visit(VariantBufferTypeVisitor{}, state.config.buffer);
+
+    // Points are read as `x + iy`.
+
+    BufferTypeDetectorVisitor<CF32> complexDetector;
+    std::visit(complexDetector, state.config.buffer);
+
+    if (!complexDetector.matches) {
+        JST_ERROR("[SUPERLUMINAL] Scatter plot '{}' needs a complex buffer with the points as `x + iy`.", state.name);
+        return Result::ERROR;
+    }
+
+    // Poll options.
+
+    std::string density = "false";
+
+    if (state.config.options.contains("density")) {
+        auto d = std::get<I32>(state.config.options["density"]);
+        JST_DEBUG("[SUPERLUMINAL] Density set to {}.", d);
+        density = (d != 0) ? "true" : "false";
+    }
+
+    std::string resolution = "256";
+
+    if (state.config.options.contains("resolution")) {
+        auto r = std::get<I32>(state.config.options["resolution"]);
+        JST_DEBUG("[SUPERLUMINAL] Resolution set to {}.", r);
+        resolution = std::to_string(r);
+    }
+
+    // Build graph.
+
+    auto hash = std::to_string(prototype.hash());
+    auto domain = (state.config.display == Domain::Time) ? "time" : "freq";
+    auto port = jst::fmt::format("${{graph.data_{}_{}_{}.output.buffer}}", GetDeviceName(config.preferredDevice), domain, hash);
+
+    // The slice is shared with the other plots of the same buffer.
+
+    if (state.config.channelAxis != -1 && state.config.channelIndex != -1) {
+        JST_CHECK(buildSliceGraph(state, port));
+    }
+
+    // Points are drawn as instanced shapes, or binned into a histogram in density mode.
+
+    auto blob = GraphToYaml({
+        {"constellation",
+            {"constellation", GetDeviceName(config.preferredDevice), {"CF32"},
+                {{"enableDensity", density},
+                 {"resolution", resolution}},
+                {{"buffer", port}}}},
+    }, state.name);
+    instance.flowgraph().importFromBlob(blob);
+
+    // Update plot state.
+
+    state.block = instance.flowgraph().nodes()[{state.name + "_constellation"}]->block;
 
     return Result::SUCCESS;
 }
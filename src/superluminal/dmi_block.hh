@@ -15,8 +15,9 @@ class DynamicMemoryImport : public Block {
 
     struct Config {
         Tensor<D, OT> buffer;
+        U64 depth = 4;
 
-        JST_SERDES(buffer);
+        JST_SERDES(buffer, depth);
     };
 
     // Input
@@ -62,6 +63,7 @@ class DynamicMemoryImport : public Block {
         JST_CHECK(instance().addModule(
             dynamicMemoryImport, "source", {
                 .buffer = config.buffer,
+                .depth = config.depth,
             }, {},
             locale()
         ));
@@ -76,6 +78,40 @@ class DynamicMemoryImport : public Block {
         return Result::SUCCESS;
     }
 
+    // Update
+
+    void request() {
+        dynamicMemoryImport->request();
+    }
+
+    bool requested() const {
+        return dynamicMemoryImport->requested();
+    }
+
+    Result swap(const Tensor<D, OT>& buffer) {
+        return dynamicMemoryImport->swap(buffer);
+    }
+
+    Result push(const Tensor<D, OT>& buffer) {
+        return dynamicMemoryImport->push(buffer);
+    }
+
+    Result exchange(Tensor<D, OT>& buffer) {
+        return dynamicMemoryImport->exchange(buffer);
+    }
+
+    bool queued() const {
+        return dynamicMemoryImport->queued();
+    }
+
+    bool full() const {
+        return dynamicMemoryImport->full();
+    }
+
+    U64 dropped() const {
+        return dynamicMemoryImport->dropped();
+    }
+
     // Interface
 
     constexpr bool shouldDrawInfo() const {
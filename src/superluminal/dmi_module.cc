@@ -1,7 +1,41 @@
+#include <mutex>
+#include <atomic>
+#include <utility>
+
 #include "dmi_module.hh"
 
+#include "jetstream/compute/graph/base.hh"
+#include "jetstream/memory/utils/frame_ring.hh"
+
+#ifdef JETSTREAM_BACKEND_CUDA_AVAILABLE
+#include "jetstream/backend/devices/cuda/helpers.hh"
+#endif
+
 namespace Jetstream {
 
+template<Device D, typename T>
+struct DynamicMemoryImport<D, T>::Impl {
+    // The first cycle always reads the buffer.
+    std::atomic<bool> pending{true};
+
+    std::mutex mutex;
+    bool swapping = false;
+    Tensor<D, T> replacement;
+
+    // Tensors pushed by the producer, allocated on first use.
+    std::unique_ptr<Memory::FrameRing<Tensor<D, T>>> ring;
+};
+
+template<Device D, typename T>
+DynamicMemoryImport<D, T>::DynamicMemoryImport() {
+    impl = std::make_unique<Impl>();
+}
+
+template<Device D, typename T>
+DynamicMemoryImport<D, T>::~DynamicMemoryImport() {
+    impl.reset();
+}
+
 template<Device D, typename T>
 void DynamicMemoryImport<D, T>::info() const {
     JST_DEBUG("  None");
@@ -14,6 +48,148 @@ Result DynamicMemoryImport<D, T>::create() {
 
     output.buffer = config.buffer;
 
+    impl->ring = std::make_unique<Memory::FrameRing<Tensor<D, T>>>(config.depth);
+
+    return Result::SUCCESS;
+}
+
+template<Device D, typename T>
+void DynamicMemoryImport<D, T>::request() {
+    impl->pending.store(true, std::memory_order_release);
+}
+
+template<Device D, typename T>
+bool DynamicMemoryImport<D, T>::requested() const {
+    return impl->pending.load(std::memory_order_acquire);
+}
+
+template<Device D, typename T>
+Result DynamicMemoryImport<D, T>::swap(const Tensor<D, T>& buffer) {
+    if (buffer.shape() != output.buffer.shape()) {
+        JST_ERROR("[SUPERLUMINAL] Can't swap buffer with shape {} into buffer with shape {}.",
+                  buffer.shape(), output.buffer.shape());
+        return Result::ERROR;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(impl->mutex);
+        impl->replacement = buffer;
+        impl->swapping = true;
+    }
+
+    request();
+
+    return Result::SUCCESS;
+}
+
+template<Device D, typename T>
+Result DynamicMemoryImport<D, T>::push(const Tensor<D, T>& buffer) {
+    if (buffer.shape() != output.buffer.shape()) {
+        JST_ERROR("[SUPERLUMINAL] Can't push buffer with shape {} into buffer with shape {}.",
+                  buffer.shape(), output.buffer.shape());
+        return Result::ERROR;
+    }
+
+    auto& slot = impl->ring->back();
+
+    if (slot.shape() != buffer.shape()) {
+        slot = Tensor<D, T>(buffer.shape());
+    }
+
+    if constexpr (D == Device::CPU) {
+        JST_CHECK(Memory::Copy(slot, buffer));
+    }
+
+#ifdef JETSTREAM_BACKEND_CUDA_AVAILABLE
+    if constexpr (D == Device::CUDA) {
+        JST_CHECK(Memory::Copy(slot, buffer));
+        JST_CUDA_CHECK(cudaStreamSynchronize(0), [&]{
+            JST_ERROR("[SUPERLUMINAL] Failed to copy pushed buffer: {}", err);
+        });
+    }
+#endif
+
+    if (impl->ring->publish()) {
+        JST_TRACE("[SUPERLUMINAL] Dropped the oldest pushed buffer.");
+    }
+
+    return Result::SUCCESS;
+}
+
+template<Device D, typename T>
+Result DynamicMemoryImport<D, T>::exchange(Tensor<D, T>& buffer) {
+    if (buffer.shape() != output.buffer.shape()) {
+        JST_ERROR("[SUPERLUMINAL] Can't exchange buffer with shape {} into buffer with shape {}.",
+                  buffer.shape(), output.buffer.shape());
+        return Result::ERROR;
+    }
+
+    std::swap(impl->ring->back(), buffer);
+
+    if (impl->ring->publish()) {
+        JST_TRACE("[SUPERLUMINAL] Dropped the oldest pushed buffer.");
+    }
+
+    return Result::SUCCESS;
+}
+
+template<Device D, typename T>
+bool DynamicMemoryImport<D, T>::queued() const {
+    return impl->ring && impl->ring->occupancy() > 0;
+}
+
+template<Device D, typename T>
+bool DynamicMemoryImport<D, T>::full() const {
+    return impl->ring && impl->ring->occupancy() >= impl->ring->depth();
+}
+
+template<Device D, typename T>
+U64 DynamicMemoryImport<D, T>::dropped() const {
+    return impl->ring ? impl->ring->dropped() : 0;
+}
+
+template<Device D, typename T>
+Result DynamicMemoryImport<D, T>::compute(const Context& ctx) {
+    const bool pushed = impl->ring->consume();
+    const bool requested = impl->pending.exchange(false, std::memory_order_acq_rel);
+
+    // Skip the modules reading the buffer if it didn't change.
+
+    if (!pushed && !requested) {
+        return Result::YIELD;
+    }
+
+    (void)ctx;
+
+    const auto& copy = [&](const Tensor<D, T>& source) {
+        if constexpr (D == Device::CPU) {
+            return Memory::Copy(output.buffer, source);
+        }
+#ifdef JETSTREAM_GRAPH_CUDA_AVAILABLE
+        if constexpr (D == Device::CUDA) {
+            return Memory::Copy(output.buffer, source, ctx.cuda->stream());
+        }
+#endif
+        return Result::ERROR;
+    };
+
+    {
+        std::lock_guard<std::mutex> lock(impl->mutex);
+
+        if (impl->swapping) {
+            JST_CHECK(copy(impl->replacement));
+
+            impl->replacement = Tensor<D, T>();
+            impl->swapping = false;
+        }
+    }
+
+    // The pushed tensor is newer than the replacement.
+
+    if (pushed) {
+        JST_CHECK(copy(impl->ring->front()));
+    }
+
     return Result::SUCCESS;
 }
 
@@ -1,6 +1,7 @@
 #ifndef JETSTREAM_SUPERLUMINAL_DMI_MODULE_HH
 #define JETSTREAM_SUPERLUMINAL_DMI_MODULE_HH
 
+#include <memory>
 #include <string>
 
 #include "jetstream/module.hh"
@@ -24,8 +25,9 @@ class DynamicMemoryImport : public Module, public Compute {
 
     struct Config {
         Tensor<D, T> buffer;
+        U64 depth = 4;
 
-        JST_SERDES(buffer);
+        JST_SERDES(buffer, depth);
     };
 
     constexpr const Config& getConfig() const {
@@ -68,9 +70,79 @@ class DynamicMemoryImport : public Module, public Compute {
 
     // Constructor
 
+    DynamicMemoryImport();
+    ~DynamicMemoryImport();
+
     Result create();
 
+    // Update
+
+    /**
+     * @brief Mark the buffer as changed, so the next compute cycle runs the modules reading it.
+     */
+    void request();
+
+    /**
+     * @brief Check if the buffer changed since the last compute cycle.
+     */
+    bool requested() const;
+
+    /**
+     * @brief Replace the contents of the buffer by another tensor with the same shape.
+     *
+     * The tensor is copied into the buffer by the next compute cycle, the modules reading
+     * the buffer keep using the same memory. It has to stay valid until then.
+     *
+     * @param buffer The tensor to copy from.
+     * @return Result::SUCCESS if the replacement was queued.
+     */
+    Result swap(const Tensor<D, T>& buffer);
+
+    /**
+     * @brief Queue a copy of a tensor with the same shape as the buffer. Never waits.
+     *
+     * Each compute cycle copies the oldest queued tensor into the buffer. Once `depth`
+     * tensors are queued, the oldest one is dropped. Only one thread should push.
+     *
+     * @param buffer The tensor to copy from. Can be released once this returns.
+     * @return Result::SUCCESS if the tensor was queued.
+     */
+    Result push(const Tensor<D, T>& buffer);
+
+    /**
+     * @brief Queue a tensor with the same shape as the buffer without copying it. Never waits.
+     *
+     * Same as `push`, but the tensor itself is queued and a recycled one is handed back in its
+     * place. The recycled tensor is either empty or has the shape of the buffer, and can be
+     * filled for the next exchange. The queued tensor shouldn't be written anymore.
+     *
+     * @param buffer The tensor to queue. Replaced by a recycled tensor.
+     * @return Result::SUCCESS if the tensor was queued.
+     */
+    Result exchange(Tensor<D, T>& buffer);
+
+    /**
+     * @brief Check if pushed tensors are waiting for a compute cycle.
+     */
+    bool queued() const;
+
+    /**
+     * @brief Check if the next push drops the oldest queued tensor.
+     */
+    bool full() const;
+
+    /**
+     * @brief Get the number of pushed tensors dropped since the creation.
+     */
+    U64 dropped() const;
+
+ protected:
+    Result compute(const Context& ctx) final;
+
  private:
+    struct Impl;
+    std::unique_ptr<Impl> impl;
+
     JST_DEFINE_IO()
 };
 
@@ -143,8 +143,7 @@ Result Implementation::createSwapchain() {
     Backend::QueueFamilyIndices indices = Backend::FindQueueFamilies(physicalDevice);
     uint32_t queueFamilyIndices[] = {indices.graphicFamily.value(), indices.presentFamily.value()};
 
-    if (indices.graphicFamily != indices.presentFamily ||
-        indices.graphicFamily != indices.computeFamily) {
+    if (indices.graphicFamily != indices.presentFamily) {
         createInfo.imageSharingMode = VK_SHARING_MODE_CONCURRENT;
         createInfo.queueFamilyIndexCount = 2;
         createInfo.pQueueFamilyIndices = queueFamilyIndices;
@@ -302,7 +301,7 @@ Result Implementation::commitDrawable(std::vector<VkSemaphore>& semaphores) {
     auto& presentQueue = Backend::State<Device::Vulkan>()->getPresentQueue();
 
     {
-        std::scoped_lock lock(frameScopeMutex);
+        std::scoped_lock lock(frameScopeMutex, Backend::QueueMutex());
         result = vkQueuePresentKHR(presentQueue, &presentInfo);
     }
 
@@ -0,0 +1,285 @@
+#include "jetstream/viewport/platforms/headless/recorder.hh"
+#include "jetstream/logger.hh"
+#include "jetstream/types.hh"
+
+#include <map>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <filesystem>
+
+#include <gst/gst.h>
+#include <gst/app/gstappsrc.h>
+
+namespace Jetstream::Viewport {
+
+struct Recorder::Impl {
+    Config config;
+
+    GstElement* pipeline = nullptr;
+    GstElement* source = nullptr;
+
+    U64 frameSize = 0;
+    U64 frameCount = 0;
+    bool recording = false;
+
+    Result startPipeline();
+    Result stopPipeline();
+
+    static bool IsSequence(const std::string& path);
+    static std::string MuxerName(const std::string& path);
+};
+
+Recorder::Recorder() {
+    pimpl = std::make_unique<Impl>();
+}
+
+Recorder::~Recorder() {
+    pimpl.reset();
+}
+
+Result Recorder::create(const Viewport::Config& config) {
+    JST_DEBUG("[RECORDER] Initializing plugin.");
+
+    pimpl->config = config;
+    pimpl->frameSize = config.size.x * config.size.y * 4;
+    pimpl->frameCount = 0;
+
+    // Validate configuration.
+
+    if (pimpl->config.output.empty()) {
+        JST_ERROR("[RECORDER] Missing output path.");
+        return Result::ERROR;
+    }
+
+    if (pimpl->config.framerate == 0) {
+        JST_ERROR("[RECORDER] Framerate can't be zero.");
+        return Result::ERROR;
+    }
+
+    if (!gst_is_initialized()) {
+        gst_init(nullptr, nullptr);
+    }
+
+    JST_CHECK(pimpl->startPipeline());
+
+    JST_INFO("[RECORDER] Recording frames to '{}'.", pimpl->config.output);
+
+    return Result::SUCCESS;
+}
+
+Result Recorder::destroy() {
+    JST_DEBUG("[RECORDER] Destroying.");
+
+    JST_CHECK(pimpl->stopPipeline());
+
+    JST_INFO("[RECORDER] Recorded {} frames to '{}'.", pimpl->frameCount, pimpl->config.output);
+
+    return Result::SUCCESS;
+}
+
+bool Recorder::Impl::IsSequence(const std::string& path) {
+    return path.find('%') != std::string::npos;
+}
+
+std::string Recorder::Impl::MuxerName(const std::string& path) {
+    auto extension = std::filesystem::path(path).extension().string();
+    std::transform(extension.begin(), extension.end(), extension.begin(), ::tolower);
+
+    if (extension == ".mp4" || extension == ".mov") {
+        return "mp4mux";
+    }
+
+    if (extension == ".webm") {
+        return "webmmux";
+    }
+
+    return "matroskamux";
+}
+
+Result Recorder::Impl::startPipeline() {
+    // Create pipeline.
+
+    pipeline = gst_pipeline_new("headless-recorder-pipeline");
+
+    if (!pipeline) {
+        JST_ERROR("[RECORDER] Failed to create gstreamer pipeline.");
+        return Result::ERROR;
+    }
+
+    // Create elements.
+
+    std::map<std::string, GstElement*> elements;
+    std::vector<std::string> elementOrder;
+
+    const auto& add = [&](const std::string& name, const std::string& factory) {
+        elements[name] = gst_element_factory_make(factory.c_str(), name.c_str());
+        elementOrder.push_back(name);
+    };
+
+    add("source", "appsrc");
+    add("caps", "capsfilter");
+    add("convert", "videoconvert");
+
+    if (IsSequence(config.output)) {
+        add("encoder", "pngenc");
+        add("sink", "multifilesink");
+    } else {
+        switch (config.codec) {
+            case VideoCodec::H264:
+                add("encoder", "x264enc");
+                add("parser", "h264parse");
+                break;
+            case VideoCodec::VP8:
+                add("encoder", "vp8enc");
+                break;
+            case VideoCodec::VP9:
+                add("encoder", "vp9enc");
+                break;
+            case VideoCodec::AV1:
+                add("encoder", "rav1enc");
+                break;
+            case VideoCodec::FFV1:
+                add("encoder", "avenc_ffv1");
+                break;
+        }
+
+        add("muxer", MuxerName(config.output));
+        add("sink", "filesink");
+    }
+
+    for (const auto& [name, element] : elements) {
+        if (!element) {
+            JST_ERROR("[RECORDER] Failed to create gstreamer element '{}'. Check if its plugin is installed.", name);
+            gst_object_unref(pipeline);
+            return Result::ERROR;
+        }
+    }
+
+    // Configure elements. Frames are never dropped, the source blocks the renderer instead.
+
+    source = elements["source"];
+
+    g_object_set(elements["source"], "block", true, nullptr);
+    g_object_set(elements["source"], "format", 3, nullptr);
+    g_object_set(elements["source"], "is-live", false, nullptr);
+    g_object_set(elements["source"], "max-bytes", 4 * frameSize, nullptr);
+
+    GstCaps* caps = gst_caps_new_simple("video/x-raw",
+                                        "format", G_TYPE_STRING, "BGRA",
+                                        "width", G_TYPE_INT, config.size.x,
+                                        "height", G_TYPE_INT, config.size.y,
+                                        "framerate", GST_TYPE_FRACTION, config.framerate, 1,
+                                        "interlace-mode", G_TYPE_STRING, "progressive",
+                                        nullptr);
+    g_object_set(elements["caps"], "caps", caps, nullptr);
+    gst_caps_unref(caps);
+
+    if (!IsSequence(config.output) && config.codec == VideoCodec::H264) {
+        g_object_set(elements["encoder"], "speed-preset", 1, nullptr);
+    }
+
+    g_object_set(elements["sink"], "location", config.output.c_str(), nullptr);
+
+    // Add elements to pipeline.
+
+    for (const auto& [name, element] : elements) {
+        if (!gst_bin_add(GST_BIN(pipeline), element)) {
+            JST_ERROR("[RECORDER] Failed to add gstreamer element '{}' to pipeline.", name);
+            gst_object_unref(pipeline);
+            return Result::ERROR;
+        }
+    }
+
+    // Link elements.
+
+    for (U64 i = 1; i < elementOrder.size(); i++) {
+        const auto& last = elementOrder[i - 1];
+        const auto& name = elementOrder[i];
+
+        if (!gst_element_link(elements[last], elements[name])) {
+            JST_ERROR("[RECORDER] Failed to link gstreamer element '{}' -> '{}'.", last, name);
+            gst_object_unref(pipeline);
+            return Result::ERROR;
+        }
+    }
+
+    // Start pipeline.
+
+    if (gst_element_set_state(pipeline, GST_STATE_PLAYING) == GST_STATE_CHANGE_FAILURE) {
+        JST_ERROR("[RECORDER] Failed to start gstreamer pipeline.");
+        gst_object_unref(pipeline);
+        return Result::ERROR;
+    }
+
+    recording = true;
+
+    return Result::SUCCESS;
+}
+
+Result Recorder::Impl::stopPipeline() {
+    if (!recording) {
+        return Result::SUCCESS;
+    }
+
+    recording = false;
+
+    // Wait for the queued frames to be written, the muxer finalizes the file on EOS.
+
+    gst_app_src_end_of_stream(GST_APP_SRC(source));
+
+    GstBus* bus = gst_element_get_bus(pipeline);
+    GstMessage* msg = gst_bus_timed_pop_filtered(bus,
+                                                 GST_CLOCK_TIME_NONE,
+                                                 static_cast<GstMessageType>(GST_MESSAGE_EOS | GST_MESSAGE_ERROR));
+
+    Result result = Result::SUCCESS;
+
+    if (msg) {
+        if (GST_MESSAGE_TYPE(msg) == GST_MESSAGE_ERROR) {
+            GError* error = nullptr;
+            gst_message_parse_error(msg, &error, nullptr);
+            JST_ERROR("[RECORDER] Failed to write '{}': {}", config.output, error->message);
+            g_error_free(error);
+            result = Result::ERROR;
+        }
+        gst_message_unref(msg);
+    }
+    gst_object_unref(bus);
+
+    gst_element_set_state(pipeline, GST_STATE_NULL);
+    gst_object_unref(pipeline);
+
+    pipeline = nullptr;
+    source = nullptr;
+
+    return result;
+}
+
+Result Recorder::pushNewFrame(const void* data) {
+    if (!pimpl->recording) {
+        return Result::SUCCESS;
+    }
+
+    // Copy frame, the drawable is reused as soon as this returns.
+
+    GstBuffer* buffer = gst_buffer_new_allocate(nullptr, pimpl->frameSize, nullptr);
+    gst_buffer_fill(buffer, 0, data, pimpl->frameSize);
+
+    // Timestamp frames at the configured framerate, they are rendered as fast as possible.
+
+    const U64 framerate = pimpl->config.framerate;
+    GST_BUFFER_PTS(buffer) = gst_util_uint64_scale(pimpl->frameCount, GST_SECOND, framerate);
+    GST_BUFFER_DURATION(buffer) = gst_util_uint64_scale(1, GST_SECOND, framerate);
+
+    if (gst_app_src_push_buffer(GST_APP_SRC(pimpl->source), buffer) != GST_FLOW_OK) {
+        JST_ERROR("[RECORDER] Failed to push buffer to gstreamer pipeline.");
+        return Result::ERROR;
+    }
+
+    pimpl->frameCount += 1;
+
+    return Result::SUCCESS;
+}
+
+}  // namespace Jetstream::Viewport
@@ -1,14 +1,21 @@
 #include "jetstream/viewport/platforms/headless/remote.hh"
 #include "jetstream/logger.hh"
 #include "jetstream/types.hh"
+#include "jetstream/memory/macros.hh"
+#include "jetstream/memory/footprint.hh"
 
+#include <map>
+#include <limits>
 #include <memory>
+#include <atomic>
+#include <algorithm>
 #include <sys/stat.h>
 #include <fcntl.h>
 #include <unistd.h>
 
 #include <gst/webrtc/webrtc.h>
 #include <gst/app/gstappsrc.h>
+#include <gst/allocators/gstdmabuf.h>
 #include <gst/video/video-event.h>
 #include <gst/gststructure.h>
 
@@ -38,6 +45,7 @@ struct Remote::Impl {
         None,
         Software,
         HardwareNVENC,
+        HardwareVAAPI,
         HardwareV4L2,
     };
 
@@ -91,6 +99,51 @@ struct Remote::Impl {
     static void onMessageCallback(GstWebRTCDataChannel* self, gchar* data, gpointer user_data);
     static void onChannelCallback(GstElement* self, GstWebRTCDataChannel* channel, gpointer user_data);
     static void rtcReadyCallback(GstElement* self, gchararray peer_id, GstElement* webrtcbin, gpointer udata);
+    static void consumerRemovedCallback(GstElement* self, gchararray peer_id, GstElement* webrtcbin, gpointer udata);
+
+    // Adaptation
+
+    // All consumers share one encoder, so the stream follows the worst one.
+    // The encoded stream is fanned out by the WebRTC sink, the encoder load
+    // doesn't grow with the number of consumers.
+
+    static constexpr U64 MinBitrate = 1024;
+    static constexpr U64 MaxBitrate = 25*1024;
+    static constexpr U64 MinFramerate = 10;
+    static constexpr F64 CongestedFractionLost = 0.10;
+    static constexpr F64 ClearFractionLost = 0.02;
+
+    struct Consumer {
+        GstElement* webrtcbin;
+        GstWebRTCDataChannel* tensors = nullptr;
+        F64 fractionLost = 0.0;
+
+        // Bytes of media sent to the consumer and their rate in kbps.
+        U64 bytesSent = 0;
+        F64 bandwidth = 0.0;
+        std::chrono::time_point<std::chrono::steady_clock> lastStatsTime;
+    };
+
+    struct StatsRequest {
+        Impl* impl;
+        std::string peerId;
+    };
+
+    struct StatsReport {
+        F64 fractionLost = 0.0;
+        U64 bytesSent = 0;
+    };
+
+    std::mutex consumersMutex;
+    std::map<std::string, Consumer> consumers;
+
+    U64 bitrate = MaxBitrate;
+    std::atomic<U64> framerate;
+    std::chrono::time_point<std::chrono::steady_clock> lastAdaptationTime;
+
+    void adaptStream();
+    void applyBitrate();
+    static void onStatsCallback(GstPromise* promise, gpointer user_data);
 
     // Main Loop
 
@@ -98,11 +151,26 @@ struct Remote::Impl {
     std::condition_variable bufferCond;
     bool bufferProcessed = false;
 
-    bool forceKeyframe = false;
+    std::atomic<bool> forceKeyframe = false;
     std::chrono::time_point<std::chrono::steady_clock> initialFrameTime;
-    std::chrono::time_point<std::chrono::steady_clock> lastKeyframeTime;
+    U64 framesSinceKeyframe = 0;
+
+    GstAllocator* dmabufAllocator = nullptr;
+
+    Result pushBuffer(GstBuffer* buffer);
+
+    // Tensor Streaming
+
+    // Video is only a preview of the interface while tensors are streamed.
+    static constexpr std::chrono::milliseconds PreviewFrameInterval{1000};
+
+    std::chrono::time_point<std::chrono::steady_clock> lastFrameTime;
+    std::vector<U8> tensorMessage;
+
+    bool skipFrame();
 
     static void OnBufferReleaseCallback(gpointer user_data);
+    static void OnDmaBufReleaseCallback(gpointer user_data, GstMiniObject* object);
 };
 
 Remote::Remote() {
@@ -120,6 +188,7 @@ Result Remote::create(const Viewport::Config& _config, const Device& _viewport_d
 
     pimpl->config = _config;
     pimpl->viewportDevice = _viewport_device;
+    pimpl->framerate = pimpl->config.framerate;
 
     // Validate configuration.
 
@@ -427,9 +496,55 @@ Result Remote::Impl::createBroker() {
                 }
             }
 
+            {
+                std::lock_guard<std::mutex> lock(consumersMutex);
+                for (const auto& [peerId, consumer] : consumers) {
+                    lines.push_back(ftxui::text(jst::fmt::format("  {}: {:.0f} kbps, {:.1f}% loss", peerId,
+                                                                                                consumer.bandwidth,
+                                                                                                consumer.fractionLost * 100.0)) | ftxui::dim);
+                }
+            }
+
             return ftxui::window(ftxui::text(" Clients "), ftxui::vbox(std::move(lines))) | ftxui::yflex_grow;
         });
 
+        auto memory_panel = ftxui::Renderer([&] {
+            const auto& footprint = MemoryFootprint::Get();
+            const auto toMB = [](const U64& bytes) { return static_cast<F32>(bytes) / JST_MB; };
+
+            std::vector<ftxui::Element> lines;
+            for (const auto& [device, usage] : footprint.devices()) {
+                lines.push_back(ftxui::text(jst::fmt::format("{}: {:.2f} MB (peak {:.2f} MB)", GetDevicePrettyName(device),
+                                                                                                 toMB(usage.current),
+                                                                                                 toMB(usage.peak))));
+            }
+
+            // Blocks holding the most memory right now.
+
+            std::vector<std::pair<U64, std::string>> blocks;
+            for (const auto& [block, devices] : footprint.blocks()) {
+                U64 total = 0;
+                for (const auto& [_, usage] : devices) {
+                    total += usage.current;
+                }
+                if (total > 0) {
+                    blocks.push_back({total, (block.empty()) ? "(unattributed)" : block});
+                }
+            }
+            std::sort(blocks.rbegin(), blocks.rend());
+
+            for (U64 i = 0; i < std::min<U64>(blocks.size(), 5); i++) {
+                lines.push_back(ftxui::text(jst::fmt::format("  {}: {:.2f} MB", blocks[i].second,
+                                                                                toMB(blocks[i].first))) | ftxui::dim);
+            }
+
+            if (lines.empty()) {
+                lines.push_back(ftxui::text("No tensors allocated yet.") | ftxui::dim | ftxui::bold);
+            }
+
+            return ftxui::window(ftxui::text(" Memory "), ftxui::vbox(std::move(lines)));
+        });
+
         auto auth_container = ftxui::Container::Vertical({ input_field });
 
         auto auth_panel = ftxui::Renderer(auth_container, [&] {
@@ -447,6 +562,7 @@ Result Remote::Impl::createBroker() {
             return ftxui::vbox({
                 auth_panel->Render(),
                 room_panel->Render(),
+                memory_panel->Render(),
                 clients_panel->Render() | ftxui::yflex_grow,
             }) | ftxui::yflex_grow;
         });
@@ -494,11 +610,14 @@ Result Remote::Impl::createBroker() {
         std::thread update_thread([&] {
             using namespace std::chrono_literals;
             uint64_t last_version = log_history.version();
+            uint64_t last_memory_version = MemoryFootprint::Get().version();
 
             while (brokerRunning) {
                 const auto current_version = log_history.version();
-                if (current_version != last_version) {
+                const auto current_memory_version = MemoryFootprint::Get().version();
+                if (current_version != last_version || current_memory_version != last_memory_version) {
                     last_version = current_version;
+                    last_memory_version = current_memory_version;
                     screen.Post(ftxui::Event::Custom);
                 }
                 std::this_thread::sleep_for(50ms);
@@ -572,6 +691,13 @@ Result Remote::Impl::createStream() {
         }
 #endif
 
+#ifdef JETSTREAM_BACKEND_VULKAN_AVAILABLE
+        if (viewportDevice == Device::Vulkan && Backend::State<Device::Vulkan>()->canExportDmaBufMemory()) {
+            combinations.push_back({Device::Vulkan, Strategy::HardwareVAAPI, {"vaapi"}});
+            GST_DEBUG("[REMOTE] Checking for VAAPI strategy support for h264.");
+        }
+#endif
+
         if (checkGstreamerPlugins({"video4linux2"}, true) == Result::SUCCESS) {
             GstElementFactory* factory = gst_element_factory_find("v4l2h264enc");
             if (factory) {
@@ -620,6 +746,11 @@ Result Remote::Impl::createStream() {
 Result Remote::Impl::destroyStream() {
     JST_DEBUG("[REMOTE] Destroying stream.");
 
+    if (dmabufAllocator) {
+        gst_object_unref(dmabufAllocator);
+        dmabufAllocator = nullptr;
+    }
+
     encodingStrategy = Strategy::None;
     inputMemoryDevice = Device::None;
 
@@ -890,6 +1021,10 @@ void Remote::Impl::rtcReadyCallback(GstElement* self, gchararray peer_id, GstEle
 
     JST_INFO("[REMOTE] New consumer ({}) connected.", peer_id);
 
+    // Start the new consumer with a keyframe.
+
+    reinterpret_cast<Remote::Impl*>(udata)->forceKeyframe = true;
+
     // Install consumer created data channels callback.
 
     g_signal_connect(G_OBJECT(webrtcbin), "on-data-channel", G_CALLBACK(onChannelCallback), udata);
@@ -903,6 +1038,50 @@ void Remote::Impl::rtcReadyCallback(GstElement* self, gchararray peer_id, GstEle
         return;
     }
     g_signal_connect(G_OBJECT(channel), "on-message-string", G_CALLBACK(onMessageCallback), udata);
+
+    // Create data channel for tensors. Late tensors are useless, so
+    // messages are neither ordered nor retransmitted.
+
+    auto* that = reinterpret_cast<Remote::Impl*>(udata);
+
+    GstWebRTCDataChannel* tensors = nullptr;
+    if (that->config.streamTensors) {
+        GstStructure* options = gst_structure_new("options",
+                                                  "ordered", G_TYPE_BOOLEAN, FALSE,
+                                                  "max-retransmits", G_TYPE_INT, 0,
+                                                  nullptr);
+        g_signal_emit_by_name(G_OBJECT(webrtcbin), "create-data-channel", "tensors", options, &tensors);
+        gst_structure_free(options);
+
+        if (!tensors) {
+            JST_ERROR("[REMOTE] Failed to create tensors data channel.");
+        }
+    }
+
+    // Track consumer.
+
+    std::lock_guard<std::mutex> lock(that->consumersMutex);
+    that->consumers[peer_id] = {
+        .webrtcbin = GST_ELEMENT(gst_object_ref(webrtcbin)),
+        .tensors = tensors,
+    };
+}
+
+void Remote::Impl::consumerRemovedCallback(GstElement* self, gchararray peer_id, GstElement* webrtcbin, gpointer udata) {
+    (void)self;
+    (void)webrtcbin;
+
+    JST_INFO("[REMOTE] Consumer ({}) disconnected.", peer_id);
+
+    auto* that = reinterpret_cast<Remote::Impl*>(udata);
+    std::lock_guard<std::mutex> lock(that->consumersMutex);
+    if (auto it = that->consumers.find(peer_id); it != that->consumers.end()) {
+        if (it->second.tensors) {
+            g_object_unref(it->second.tensors);
+        }
+        gst_object_unref(it->second.webrtcbin);
+        that->consumers.erase(it);
+    }
 }
 
 Result Remote::Impl::startStream() {
@@ -942,6 +1121,14 @@ Result Remote::Impl::startStream() {
             elementOrder.push_back("encoder");
         }
 
+        if (encodingStrategy == Strategy::HardwareVAAPI) {
+            elements["postproc"] = gst_element_factory_make("vaapipostproc", "postproc");
+            elementOrder.push_back("postproc");
+
+            elements["encoder"] = encoder = gst_element_factory_make("vaapih264enc", "encoder");
+            elementOrder.push_back("encoder");
+        }
+
         if (encodingStrategy == Strategy::HardwareV4L2) {
             elements["encoder"] = encoder = gst_element_factory_make("v4l2h264enc", "encoder");
             elementOrder.push_back("encoder");
@@ -1007,6 +1194,11 @@ Result Remote::Impl::startStream() {
         gst_caps_set_features(caps, 0, features);
     }
 
+    if (encodingStrategy == Strategy::HardwareVAAPI && inputMemoryDevice == Device::Vulkan) {
+        GstCapsFeatures *features = gst_caps_features_new(GST_CAPS_FEATURE_MEMORY_DMABUF, nullptr);
+        gst_caps_set_features(caps, 0, features);
+    }
+
     g_object_set(elements["caps"], "caps", caps, nullptr);
     gst_caps_unref(caps);
 
@@ -1034,9 +1226,12 @@ Result Remote::Impl::startStream() {
             g_object_set(elements["encoder"], "bitrate", 25*1024, nullptr);
         }
 
+        // VAAPI only implements the constrained variant of the baseline profile.
+        const auto* profile = (encodingStrategy == Strategy::HardwareVAAPI) ? "constrained-baseline" : "baseline";
+
         GstCaps* hwcaps = gst_caps_new_simple("video/x-h264",
                                               "level", G_TYPE_STRING, "5",
-                                              "profile", G_TYPE_STRING, "baseline",
+                                              "profile", G_TYPE_STRING, profile,
                                               nullptr);
         g_object_set(elements["hwcaps"], "caps", hwcaps, nullptr);
         gst_caps_unref(hwcaps);
@@ -1060,6 +1255,12 @@ Result Remote::Impl::startStream() {
     g_object_set(elements["webrtc"], "meta", s, NULL);
     gst_structure_free(s);
 
+    // The stream is encoded once for every consumer and adapted here, the
+    // sink can't change the bitrate of encoded input per consumer.
+    gst_util_set_object_arg(G_OBJECT(elements["webrtc"]), "congestion-control", "disabled");
+
+    g_signal_connect(elements["webrtc"], "consumer-removed", G_CALLBACK(consumerRemovedCallback), this);
+
     GObject* signaller;
     g_object_get(elements["webrtc"], "signaller", &signaller, nullptr);
     if (signaller) {
@@ -1106,6 +1307,9 @@ Result Remote::Impl::startStream() {
     }
 
     initialFrameTime = std::chrono::steady_clock::now();
+    lastAdaptationTime = initialFrameTime;
+    bitrate = MaxBitrate;
+    framerate = config.framerate;
     forceKeyframe = true;
     streaming = true;
 
@@ -1138,6 +1342,15 @@ Result Remote::Impl::stopStream() {
 
         // Cleanup.
         gst_object_unref(pipeline);
+
+        std::lock_guard<std::mutex> lock(consumersMutex);
+        for (auto& [_, consumer] : consumers) {
+            if (consumer.tensors) {
+                g_object_unref(consumer.tensors);
+            }
+            gst_object_unref(consumer.webrtcbin);
+        }
+        consumers.clear();
     }
 
     return Result::SUCCESS;
@@ -1154,8 +1367,12 @@ void Remote::Impl::OnBufferReleaseCallback(gpointer user_data) {
     that->bufferCond.notify_one();
 }
 
+void Remote::Impl::OnDmaBufReleaseCallback(gpointer user_data, GstMiniObject*) {
+    OnBufferReleaseCallback(user_data);
+}
+
 Result Remote::pushNewFrame(const void* data) {
-    if (!pimpl->streaming) {
+    if (!pimpl->streaming || pimpl->skipFrame()) {
         return Result::SUCCESS;
     }
 
@@ -1169,22 +1386,57 @@ Result Remote::pushNewFrame(const void* data) {
                                                     pimpl.get(),
                                                     &Impl::OnBufferReleaseCallback);
 
+    return pimpl->pushBuffer(buffer);
+}
+
+Result Remote::pushNewFrame(const I32& dmabuf) {
+    if (!pimpl->streaming || pimpl->skipFrame()) {
+        return Result::SUCCESS;
+    }
+
+    if (!pimpl->dmabufAllocator) {
+        pimpl->dmabufAllocator = gst_dmabuf_allocator_new();
+    }
+
+    // Wrap descriptor. The allocator closes its own duplicate.
+
+    const I32 descriptor = dup(dmabuf);
+    if (descriptor < 0) {
+        JST_ERROR("[REMOTE] Failed to duplicate DMA-BUF descriptor.");
+        return Result::ERROR;
+    }
+
+    GstMemory* memory = gst_dmabuf_allocator_alloc(pimpl->dmabufAllocator,
+                                                   descriptor,
+                                                   pimpl->config.size.x * pimpl->config.size.y * 4);
+
+    GstBuffer* buffer = gst_buffer_new();
+    gst_buffer_append_memory(buffer, memory);
+    gst_mini_object_weak_ref(GST_MINI_OBJECT(buffer), &Impl::OnDmaBufReleaseCallback, pimpl.get());
+
+    return pimpl->pushBuffer(buffer);
+}
+
+Result Remote::Impl::pushBuffer(GstBuffer* buffer) {
+    // Adapt stream to consumers.
+
+    adaptStream();
+
     // Calculate timings.
 
     const auto currentFrameTime = std::chrono::steady_clock::now();
     const auto elapsedSinceLastFrame = std::chrono::duration_cast<std::chrono::nanoseconds>(currentFrameTime -
-                                                                                            pimpl->initialFrameTime);
-    const auto elapsedSinceLastKeyframe = std::chrono::duration_cast<std::chrono::seconds>(currentFrameTime -
-                                                                                            pimpl->lastKeyframeTime);
+                                                                                            initialFrameTime);
 
     // Set buffer timings (PTS and DTS).
 
     GST_BUFFER_PTS(buffer) = static_cast<U64>(elapsedSinceLastFrame.count());
     GST_BUFFER_DTS(buffer) = GST_CLOCK_TIME_NONE;
 
-    // Force keyframe every 1 seconds.
+    // Force keyframe every second of frames. Frames are only pushed when the
+    // window redraws, so an idle stream doesn't turn every frame into a keyframe.
 
-    if ((elapsedSinceLastKeyframe.count() > 1) || pimpl->forceKeyframe) {
+    if ((++framesSinceKeyframe > framerate) || forceKeyframe) {
         GstEvent* force_key_unit_event = gst_video_event_new_downstream_force_key_unit(
             GST_CLOCK_TIME_NONE,
             GST_CLOCK_TIME_NONE,
@@ -1193,15 +1445,15 @@ Result Remote::pushNewFrame(const void* data) {
             0
         );
 
-        gst_element_send_event(pimpl->encoder, force_key_unit_event);
+        gst_element_send_event(encoder, force_key_unit_event);
 
-        pimpl->lastKeyframeTime = currentFrameTime;
-        pimpl->forceKeyframe = false;
+        framesSinceKeyframe = 0;
+        forceKeyframe = false;
     }
 
     // Push frame to pipeline.
 
-    if (gst_app_src_push_buffer(GST_APP_SRC(pimpl->source), buffer) != GST_FLOW_OK) {
+    if (gst_app_src_push_buffer(GST_APP_SRC(source), buffer) != GST_FLOW_OK) {
         JST_ERROR("[REMOTE] Failed to push buffer to gstreamer pipeline.");
         return Result::ERROR;
     }
@@ -1209,14 +1461,255 @@ Result Remote::pushNewFrame(const void* data) {
     // Wait for buffer to be processed.
 
     {
-        std::unique_lock<std::mutex> lock(pimpl->bufferMutex);
-        pimpl->bufferCond.wait(lock, [&]{ return pimpl->bufferProcessed; });
-        pimpl->bufferProcessed = false;
+        std::unique_lock<std::mutex> lock(bufferMutex);
+        bufferCond.wait(lock, [&]{ return bufferProcessed; });
+        bufferProcessed = false;
     }
 
     return Result::SUCCESS;
 }
 
+U64 Remote::framerate() const {
+    return pimpl->framerate;
+}
+
+//
+// Tensor Streaming
+//
+
+bool Remote::Impl::skipFrame() {
+    if (!config.streamTensors || forceKeyframe) {
+        return false;
+    }
+
+    const auto currentTime = std::chrono::steady_clock::now();
+    if ((currentTime - lastFrameTime) < PreviewFrameInterval) {
+        return true;
+    }
+    lastFrameTime = currentTime;
+
+    return false;
+}
+
+Result Remote::pushTensor(const std::string& id, const std::span<const F32>& data, const F32& min, const F32& max) {
+    if (!pimpl->streaming || !pimpl->config.streamTensors) {
+        return Result::SUCCESS;
+    }
+
+    if (id.size() > 255 || data.size() > std::numeric_limits<U32>::max()) {
+        JST_ERROR("[REMOTE] Tensor '{}' is too large to stream.", id);
+        return Result::ERROR;
+    }
+
+    // Serialize message. Fields are little-endian.
+    //  - U8: Format version (1).
+    //  - U8: Identifier length followed by the identifier.
+    //  - F32: Minimum and maximum values of the quantization.
+    //  - U32: Number of values followed by the values.
+
+    auto& message = pimpl->tensorMessage;
+    message.clear();
+
+    const auto append = [&](const void* bytes, const U64& size) {
+        const auto* begin = reinterpret_cast<const U8*>(bytes);
+        message.insert(message.end(), begin, begin + size);
+    };
+
+    const U8 version = 1;
+    const U8 idSize = id.size();
+    const U32 count = data.size();
+
+    append(&version, sizeof(version));
+    append(&idSize, sizeof(idSize));
+    append(id.data(), id.size());
+    append(&min, sizeof(min));
+    append(&max, sizeof(max));
+    append(&count, sizeof(count));
+
+    const F32 scale = (max > min) ? 255.0f / (max - min) : 0.0f;
+    for (const auto& value : data) {
+        message.push_back(static_cast<U8>(std::clamp((value - min) * scale, 0.0f, 255.0f) + 0.5f));
+    }
+
+    // Send to consumers with an open channel.
+
+    GBytes* bytes = g_bytes_new(message.data(), message.size());
+
+    {
+        std::lock_guard<std::mutex> lock(pimpl->consumersMutex);
+
+        for (auto& [_, consumer] : pimpl->consumers) {
+            if (!consumer.tensors) {
+                continue;
+            }
+
+            GstWebRTCDataChannelState state;
+            g_object_get(consumer.tensors, "ready-state", &state, nullptr);
+            if (state != GST_WEBRTC_DATA_CHANNEL_STATE_OPEN) {
+                continue;
+            }
+
+            gst_webrtc_data_channel_send_data(consumer.tensors, bytes);
+        }
+    }
+
+    g_bytes_unref(bytes);
+
+    return Result::SUCCESS;
+}
+
+//
+// Adaptation
+//
+
+void Remote::Impl::onStatsCallback(GstPromise* promise, gpointer user_data) {
+    auto* request = reinterpret_cast<StatsRequest*>(user_data);
+
+    if (gst_promise_wait(promise) != GST_PROMISE_RESULT_REPLIED) {
+        gst_promise_unref(promise);
+        return;
+    }
+
+    // Find the worst loss reported back by the consumer and the bytes sent to it.
+
+    StatsReport report;
+
+    gst_structure_foreach(gst_promise_get_reply(promise), [](GQuark, const GValue* value, gpointer data) -> gboolean {
+        if (!GST_VALUE_HOLDS_STRUCTURE(value)) {
+            return TRUE;
+        }
+
+        const GstStructure* stats = gst_value_get_structure(value);
+        auto* report = reinterpret_cast<StatsReport*>(data);
+
+        GstWebRTCStatsType type;
+        if (!gst_structure_get(stats, "type", GST_TYPE_WEBRTC_STATS_TYPE, &type, nullptr)) {
+            return TRUE;
+        }
+
+        if (type == GST_WEBRTC_STATS_REMOTE_INBOUND_RTP) {
+            F64 lost;
+            if (gst_structure_get_double(stats, "fraction-lost", &lost)) {
+                report->fractionLost = std::max(report->fractionLost, lost);
+            }
+        }
+
+        if (type == GST_WEBRTC_STATS_OUTBOUND_RTP) {
+            guint64 bytes;
+            if (gst_structure_get_uint64(stats, "bytes-sent", &bytes)) {
+                report->bytesSent += bytes;
+            }
+        }
+
+        return TRUE;
+    }, &report);
+
+    gst_promise_unref(promise);
+
+    const auto currentTime = std::chrono::steady_clock::now();
+
+    std::lock_guard<std::mutex> lock(request->impl->consumersMutex);
+    if (auto it = request->impl->consumers.find(request->peerId); it != request->impl->consumers.end()) {
+        auto& consumer = it->second;
+        consumer.fractionLost = report.fractionLost;
+
+        // The first report only sets the reference.
+        if (consumer.lastStatsTime.time_since_epoch().count() > 0 && report.bytesSent >= consumer.bytesSent) {
+            const F64 elapsed = std::chrono::duration<F64>(currentTime - consumer.lastStatsTime).count();
+            if (elapsed > 0.0) {
+                consumer.bandwidth = static_cast<F64>(report.bytesSent - consumer.bytesSent) * 8.0 / 1000.0 / elapsed;
+            }
+        }
+        consumer.bytesSent = report.bytesSent;
+        consumer.lastStatsTime = currentTime;
+    }
+}
+
+void Remote::Impl::adaptStream() {
+    const auto currentTime = std::chrono::steady_clock::now();
+
+    if ((currentTime - lastAdaptationTime) < std::chrono::seconds(1)) {
+        return;
+    }
+    lastAdaptationTime = currentTime;
+
+    // Collect the last reports and request new ones. They also measure the
+    // bandwidth of every consumer, so they are requested without adaptation.
+
+    F64 fractionLost = 0.0;
+
+    {
+        std::lock_guard<std::mutex> lock(consumersMutex);
+
+        if (consumers.empty()) {
+            return;
+        }
+
+        for (auto& [peerId, consumer] : consumers) {
+            fractionLost = std::max(fractionLost, consumer.fractionLost);
+
+            GstPromise* promise = gst_promise_new_with_change_func(&onStatsCallback,
+                                                                   new StatsRequest{this, peerId},
+                                                                   [](gpointer data) {
+                delete reinterpret_cast<StatsRequest*>(data);
+            });
+            g_signal_emit_by_name(consumer.webrtcbin, "get-stats", nullptr, promise);
+        }
+    }
+
+    if (!config.adaptiveStreaming) {
+        return;
+    }
+
+    // Back off multiplicatively, lowering the framerate only once the bitrate bottoms out.
+    // Recover additively, restoring the framerate first.
+
+    const U64 lastBitrate = bitrate;
+    const U64 lastFramerate = framerate;
+    const U64 minFramerate = std::min(MinFramerate, config.framerate);
+
+    if (fractionLost > CongestedFractionLost) {
+        if (bitrate > MinBitrate) {
+            bitrate = std::max(MinBitrate, bitrate * 7 / 10);
+        } else {
+            framerate = std::max(minFramerate, framerate * 3 / 4);
+        }
+    }
+
+    if (fractionLost < ClearFractionLost) {
+        if (framerate < config.framerate) {
+            framerate = std::min<U64>(config.framerate, framerate + 5);
+        } else {
+            bitrate = std::min(MaxBitrate, bitrate + MaxBitrate / 20);
+        }
+    }
+
+    if (bitrate != lastBitrate) {
+        applyBitrate();
+    }
+
+    if (bitrate != lastBitrate || framerate != lastFramerate) {
+        JST_DEBUG("[REMOTE] Adapted stream to {:.1f}% loss: {} kbps at {} fps.", fractionLost * 100.0,
+                                                                                bitrate,
+                                                                                framerate.load());
+    }
+}
+
+void Remote::Impl::applyBitrate() {
+    if (config.codec == Viewport::VideoCodec::H264) {
+        if (encodingStrategy == Strategy::Software ||
+            encodingStrategy == Strategy::HardwareNVENC ||
+            encodingStrategy == Strategy::HardwareVAAPI) {
+            g_object_set(encoder, "bitrate", static_cast<guint>(bitrate), nullptr);
+        }
+    }
+
+    if (config.codec == Viewport::VideoCodec::VP8 ||
+        config.codec == Viewport::VideoCodec::VP9) {
+        g_object_set(encoder, "target-bitrate", static_cast<gint>(bitrate * 1024), nullptr);
+    }
+}
+
 //
 // API
 //
@@ -1341,6 +1834,8 @@ std::string Remote::Impl::StrategyToString(const Strategy& strategy) {
             return "Software";
         case Strategy::HardwareNVENC:
             return "Hardware NVIDIA (NVENC)";
+        case Strategy::HardwareVAAPI:
+            return "Hardware Linux (VAAPI)";
         case Strategy::HardwareV4L2:
             return "Hardware Linux (V4L2)";
         default:
@@ -1,7 +1,10 @@
 #include <csignal>
+#include <unistd.h>
 
 #include "jetstream/viewport/platforms/headless/vulkan.hh"
 #include "jetstream/backend/devices/vulkan/helpers.hh"
+#include "jetstream/memory/macros.hh"
+#include "jetstream/compute/tracer.hh"
 
 static bool keepRunningFlag;
 
@@ -38,17 +41,30 @@ Result Implementation::create() {
     _currentDrawableIndex = 0;
     swapchainImageFormat = VK_FORMAT_B8G8R8A8_UNORM;
     lastTime = std::chrono::steady_clock::now();
+    statsFrames = 0;
+    statsReadbackTime = 0;
+    statsEncodeTime = 0;
+    statsStallTime = 0;
+    statsLastReport = lastTime;
 
     // Create endpoint.
 
-    JST_CHECK(remote.create(config, Device::Vulkan));
+    if (recording()) {
+        JST_CHECK(recorder.create(config));
+    } else {
+        JST_CHECK(remote.create(config, Device::Vulkan));
+    }
     JST_CHECK(createSwapchain());
 
     return Result::SUCCESS;
 }
 
 Result Implementation::destroy() {
-    JST_CHECK(remote.destroy());
+    if (recording()) {
+        JST_CHECK(recorder.destroy());
+    } else {
+        JST_CHECK(remote.destroy());
+    }
     JST_CHECK(destroySwapchain());
 
     return Result::SUCCESS;
@@ -114,9 +130,14 @@ Result Implementation::createSwapchain() {
 
     // Create staging buffer.
 
-    const auto& inputMemoryDevice = remote.inputMemoryDevice();
+    const auto inputMemoryDevice = this->inputMemoryDevice();
 
     for (U32 i = 0; i < stagingBuffers.size(); i++) {
+        if (inputMemoryDevice == Device::Vulkan) {
+            JST_CHECK(createDmaBufStagingBuffer(i));
+            continue;
+        }
+
         stagingBuffers[i] = Tensor<Device::Vulkan, U8>({config.size.x, config.size.y, 4}, inputMemoryDevice == Device::CPU);
 
 #ifdef JETSTREAM_BACKEND_CUDA_AVAILABLE
@@ -218,6 +239,9 @@ Result Implementation::destroySwapchain() {
     vkDestroyCommandPool(device, swapchainCommandPool, nullptr);
 
     for (U32 i = 0; i < swapchainImageViews.size(); i++) {
+        if (inputMemoryDevice() == Device::Vulkan) {
+            destroyDmaBufStagingBuffer(i);
+        }
         stagingBuffers[i] = Tensor<Device::Vulkan, U8>();
         vkDestroyImageView(device, swapchainImageViews[i], nullptr);
         vkDestroyImage(device, swapchainImages[i], nullptr);
@@ -236,6 +260,81 @@ Result Implementation::destroySwapchain() {
     return Result::SUCCESS;
 }
 
+Result Implementation::createDmaBufStagingBuffer(const U64& index) {
+    auto& physicalDevice = Backend::State<Device::Vulkan>()->getPhysicalDevice();
+    auto& device = Backend::State<Device::Vulkan>()->getDevice();
+
+    // Create buffer object.
+
+    VkExternalMemoryBufferCreateInfo extBufferCreateInfo = {};
+    extBufferCreateInfo.sType = VK_STRUCTURE_TYPE_EXTERNAL_MEMORY_BUFFER_CREATE_INFO;
+    extBufferCreateInfo.handleTypes = VK_EXTERNAL_MEMORY_HANDLE_TYPE_DMA_BUF_BIT_EXT;
+
+    VkBufferCreateInfo bufferInfo = {};
+    bufferInfo.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+    bufferInfo.size = JST_PAGE_ALIGNED_SIZE(config.size.x * config.size.y * 4);
+    bufferInfo.usage = VK_BUFFER_USAGE_TRANSFER_DST_BIT;
+    bufferInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+    bufferInfo.pNext = &extBufferCreateInfo;
+
+    JST_VK_CHECK(vkCreateBuffer(device, &bufferInfo, nullptr, &dmabufBuffers[index]), [&]{
+        JST_ERROR("[VULKAN] Failed to create DMA-BUF staging buffer.");
+    });
+
+    // Allocate exportable memory.
+
+    VkMemoryRequirements memoryRequirements;
+    vkGetBufferMemoryRequirements(device, dmabufBuffers[index], &memoryRequirements);
+
+    VkExportMemoryAllocateInfo exportInfo = {};
+    exportInfo.sType = VK_STRUCTURE_TYPE_EXPORT_MEMORY_ALLOCATE_INFO;
+    exportInfo.handleTypes = VK_EXTERNAL_MEMORY_HANDLE_TYPE_DMA_BUF_BIT_EXT;
+
+    VkMemoryAllocateInfo memoryAllocateInfo = {};
+    memoryAllocateInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+    memoryAllocateInfo.allocationSize = memoryRequirements.size;
+    memoryAllocateInfo.memoryTypeIndex = Backend::FindMemoryType(physicalDevice,
+                                                                memoryRequirements.memoryTypeBits,
+                                                                VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+    memoryAllocateInfo.pNext = &exportInfo;
+
+    JST_VK_CHECK(vkAllocateMemory(device, &memoryAllocateInfo, nullptr, &dmabufMemory[index]), [&]{
+        vkDestroyBuffer(device, dmabufBuffers[index], nullptr);
+        JST_ERROR("[VULKAN] Failed to allocate DMA-BUF staging memory.");
+    });
+
+    JST_VK_CHECK(vkBindBufferMemory(device, dmabufBuffers[index], dmabufMemory[index], 0), [&]{
+        vkFreeMemory(device, dmabufMemory[index], nullptr);
+        vkDestroyBuffer(device, dmabufBuffers[index], nullptr);
+        JST_ERROR("[VULKAN] Failed to bind DMA-BUF staging memory.");
+    });
+
+    // Export descriptor.
+
+    auto vkGetMemoryFdKHR = reinterpret_cast<PFN_vkGetMemoryFdKHR>(vkGetDeviceProcAddr(device, "vkGetMemoryFdKHR"));
+
+    VkMemoryGetFdInfoKHR fdInfo = {};
+    fdInfo.sType = VK_STRUCTURE_TYPE_MEMORY_GET_FD_INFO_KHR;
+    fdInfo.memory = dmabufMemory[index];
+    fdInfo.handleType = VK_EXTERNAL_MEMORY_HANDLE_TYPE_DMA_BUF_BIT_EXT;
+
+    JST_VK_CHECK(vkGetMemoryFdKHR(device, &fdInfo, &dmabufDescriptors[index]), [&]{
+        vkFreeMemory(device, dmabufMemory[index], nullptr);
+        vkDestroyBuffer(device, dmabufBuffers[index], nullptr);
+        JST_ERROR("[VULKAN] Failed to export DMA-BUF staging memory.");
+    });
+
+    return Result::SUCCESS;
+}
+
+void Implementation::destroyDmaBufStagingBuffer(const U64& index) {
+    auto& device = Backend::State<Device::Vulkan>()->getDevice();
+
+    close(dmabufDescriptors[index]);
+    vkFreeMemory(device, dmabufMemory[index], nullptr);
+    vkDestroyBuffer(device, dmabufBuffers[index], nullptr);
+}
+
 Result Implementation::createImgui() {
     return Result::SUCCESS;
 }
@@ -248,17 +347,48 @@ Result Implementation::destroyImgui() {
     return Result::SUCCESS;
 }
 
+bool Implementation::streamsTensors() const {
+    return config.streamTensors && !recording();
+}
+
+Result Implementation::pushTensor(const std::string& id,
+                                  const std::span<const F32>& data,
+                                  const F32& min,
+                                  const F32& max) {
+    if (recording()) {
+        return Result::SUCCESS;
+    }
+    return remote.pushTensor(id, data, min, max);
+}
+
+bool Implementation::recording() const {
+    return !config.output.empty();
+}
+
+Device Implementation::inputMemoryDevice() const {
+    // The recorder encodes on the CPU, frames are read back to host memory.
+    return recording() ? Device::CPU : remote.inputMemoryDevice();
+}
+
 Result Implementation::nextDrawable(VkSemaphore& semaphore) {
+    // Wait for the encoder to release the drawable.
+
+    const auto stallStartTime = std::chrono::steady_clock::now();
     swapchainEvents[_currentDrawableIndex].wait(true);
     swapchainEvents[_currentDrawableIndex].test_and_set();
+    statsStallTime += std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() -
+                                                                           stallStartTime).count();
 
-    // Ensure that we don't run too fast.
+    // Ensure that we don't run too fast. Recordings render as fast as the
+    // encoder allows and advance by exactly one frame period each time.
 
     auto currentTime = std::chrono::steady_clock::now();
     auto deltaTime = std::chrono::duration<F64>(currentTime - lastTime).count();
-    const F64 targetDeltaTime = 1.0 / config.framerate;
+    const F64 targetDeltaTime = 1.0 / (recording() ? config.framerate : remote.framerate());
 
-    if (deltaTime < targetDeltaTime) {
+    if (recording()) {
+        deltaTime = targetDeltaTime;
+    } else if (deltaTime < targetDeltaTime) {
         auto sleepTime = std::chrono::duration<F64>(targetDeltaTime - deltaTime);
         auto endSleepTime = currentTime + std::chrono::duration_cast<std::chrono::steady_clock::duration>(sleepTime);
 
@@ -293,6 +423,7 @@ Result Implementation::nextDrawable(VkSemaphore& semaphore) {
     submitInfo.pSignalSemaphores = &semaphore;
 
     auto& graphicsQueue = Backend::State<Device::Vulkan>()->getGraphicsQueue();
+    std::lock_guard<std::mutex> lock(Backend::QueueMutex());
     vkQueueSubmit(graphicsQueue, 1, &submitInfo, nullptr);
 
     return Result::SUCCESS;
@@ -322,10 +453,13 @@ Result Implementation::commitDrawable(std::vector<VkSemaphore>& semaphores) {
     region.imageExtent.height = config.size.y;
     region.imageExtent.depth = 1;
 
+    const auto& stagingBuffer = (inputMemoryDevice() == Device::Vulkan) ? dmabufBuffers[_currentDrawableIndex] :
+                                                                                 stagingBuffers[_currentDrawableIndex].data();
+
     vkCmdCopyImageToBuffer(swapchainCommandBuffers[_currentDrawableIndex],
                            swapchainImages[_currentDrawableIndex],
                            VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
-                           stagingBuffers[_currentDrawableIndex].data(),
+                           stagingBuffer,
                            1,
                            &region);
 
@@ -352,9 +486,12 @@ Result Implementation::commitDrawable(std::vector<VkSemaphore>& semaphores) {
     vkResetFences(device, 1, &swapchainFences[_currentDrawableIndex]);
 
     auto& graphicsQueue = Backend::State<Device::Vulkan>()->getGraphicsQueue();
-    JST_VK_CHECK(vkQueueSubmit(graphicsQueue, 1, &submitInfo, swapchainFences[_currentDrawableIndex]), [&]{
-        JST_ERROR("[VULKAN] Can't submit headless queue.");
-    });
+    {
+        std::lock_guard<std::mutex> lock(Backend::QueueMutex());
+        JST_VK_CHECK(vkQueueSubmit(graphicsQueue, 1, &submitInfo, swapchainFences[_currentDrawableIndex]), [&]{
+            JST_ERROR("[VULKAN] Can't submit headless queue.");
+        });
+    }
 
     // Submit frame to endpoint.
 
@@ -366,7 +503,7 @@ Result Implementation::commitDrawable(std::vector<VkSemaphore>& semaphores) {
 
     // Update Viewport state.
 
-    _currentDrawableIndex = (_currentDrawableIndex + 1) % 2;
+    _currentDrawableIndex = (_currentDrawableIndex + 1) % MAX_FRAMES_IN_FLIGHT;
 
     if (endpointFrameSubmissionResult.has_value()) {
         return endpointFrameSubmissionResult.value();
@@ -376,6 +513,8 @@ Result Implementation::commitDrawable(std::vector<VkSemaphore>& semaphores) {
 }
 
 void Implementation::endpointFrameSubmissionLoop() {
+    Tracer::SetThreadName("Remote Encoder");
+
     while (endpointFrameSubmissionRunning) {
         U64 fenceIndex;
 
@@ -394,19 +533,72 @@ void Implementation::endpointFrameSubmissionLoop() {
             endpointFrameSubmissionQueue.pop();
         }
 
-        auto& device = Backend::State<Device::Vulkan>()->getDevice();
-        vkWaitForFences(device, 1, &swapchainFences[fenceIndex], true, UINT64_MAX);
+        // Wait for the readback. The renderer keeps drawing the next frames meanwhile.
+
+        const auto readbackStartTime = std::chrono::steady_clock::now();
+
+        {
+            JST_TRACE_SPAN("Remote::readback", "remote");
+
+            auto& device = Backend::State<Device::Vulkan>()->getDevice();
+            vkWaitForFences(device, 1, &swapchainFences[fenceIndex], true, UINT64_MAX);
+        }
+
+        // Hand the staging buffer to the encoder.
+
+        const auto encodeStartTime = std::chrono::steady_clock::now();
 
-        const auto& result = remote.pushNewFrame(swapchainMemoryMapped[fenceIndex]);
+        const auto& result = [&]{
+            JST_TRACE_SPAN("Remote::encode", "remote");
+
+            if (recording()) {
+                return recorder.pushNewFrame(swapchainMemoryMapped[fenceIndex]);
+            }
+
+            return (inputMemoryDevice() == Device::Vulkan) ?
+                       remote.pushNewFrame(dmabufDescriptors[fenceIndex]) :
+                       remote.pushNewFrame(swapchainMemoryMapped[fenceIndex]);
+        }();
         if (result != Result::SUCCESS) {
             endpointFrameSubmissionResult = result;
         }
 
+        const auto encodeEndTime = std::chrono::steady_clock::now();
+
         swapchainEvents[fenceIndex].clear();
         swapchainEvents[fenceIndex].notify_one();
+
+        // Update statistics.
+
+        statsFrames += 1;
+        statsReadbackTime += std::chrono::duration_cast<std::chrono::nanoseconds>(encodeStartTime -
+                                                                                  readbackStartTime).count();
+        statsEncodeTime += std::chrono::duration_cast<std::chrono::nanoseconds>(encodeEndTime -
+                                                                                encodeStartTime).count();
+        encodeHistogram.record(std::chrono::duration_cast<std::chrono::nanoseconds>(encodeEndTime -
+                                                                                    encodeStartTime).count());
+
+        if ((encodeEndTime - statsLastReport) > std::chrono::seconds(5)) {
+            const auto& s = stats();
+            JST_DEBUG("[VULKAN] Headless frame timings: readback {:.2f} ms, encode {:.2f} ms, "
+                      "stall {:.2f} ms ({} frames).", s.readbackTime / s.frames * 1e3,
+                                                       s.encodeTime / s.frames * 1e3,
+                                                       s.stallTime / s.frames * 1e3,
+                                                       s.frames);
+            statsLastReport = encodeEndTime;
+        }
     }
 }
 
+Implementation::Stats Implementation::stats() const {
+    return {
+        .frames = statsFrames,
+        .readbackTime = statsReadbackTime / 1e9,
+        .encodeTime = statsEncodeTime / 1e9,
+        .stallTime = statsStallTime / 1e9,
+    };
+}
+
 const VkFormat& Implementation::getSwapchainImageFormat() const {
     return swapchainImageFormat;
 }
@@ -0,0 +1,186 @@
+#include <atomic>
+#include <thread>
+#include <vector>
+#include <chrono>
+
+#include <nanobench.h>
+
+#include "jetstream/logger.hh"
+#include "jetstream/backend/base.hh"
+#include "jetstream/memory/base.hh"
+#include "jetstream/memory/devices/cpu/helpers.hh"
+#include "jetstream/memory/utils/circular_buffer.hh"
+#include "jetstream/memory/utils/juggler.hh"
+
+using namespace Jetstream;
+using namespace ankerl;
+
+// Microbenchmarks of the memory primitives. Each section prints a table with the time
+// per operation and the bytes moved per second.
+
+static nanobench::Bench NewBench(const std::string& title) {
+    using namespace std::chrono_literals;
+
+    nanobench::Bench bench;
+    bench.title(title)
+         .unit("byte")
+         .minEpochTime(10ms)
+         .relative(false);
+    return bench;
+}
+
+static void BenchmarkCircularBuffer() {
+    using Buffer = Memory::CircularBuffer<CF32>;
+
+    const std::vector<U64> chunkSizes = {64, 1024, 16384};
+    const std::vector<std::pair<const char*, Buffer::Mode>> modes = {
+        {"Locked", Buffer::Mode::Locked},
+        {"Lock-Free", Buffer::Mode::LockFree},
+    };
+
+    auto bench = NewBench("CircularBuffer");
+
+    for (const auto& [modeName, mode] : modes) {
+        for (const auto& chunk : chunkSizes) {
+            const U64 bytes = chunk * sizeof(CF32);
+            std::vector<CF32> input(chunk, CF32(1.0f, 2.0f));
+            std::vector<CF32> output(chunk);
+
+            // Producer and consumer on the same thread, nothing is shared.
+
+            Buffer buffer(chunk * 8, mode);
+
+            bench.batch(bytes).run(jst::fmt::format("{} Put/Get - {} elements - Uncontended", modeName, chunk), [&]{
+                buffer.put(input.data(), chunk);
+                buffer.get(output.data(), chunk);
+                nanobench::doNotOptimizeAway(output.data());
+            });
+
+            // A producer thread keeps the buffer full while the consumer is measured.
+
+            JST_CHECK_THROW(buffer.resize(chunk * 8, mode));
+            buffer.setOverflowPolicy(Buffer::OverflowPolicy::Block);
+
+            std::atomic<bool> running{true};
+            std::atomic<bool> done{false};
+
+            std::thread producer([&]{
+                while (running.load(std::memory_order_relaxed)) {
+                    buffer.put(input.data(), chunk);
+                }
+                done.store(true);
+            });
+
+            bench.batch(bytes).run(jst::fmt::format("{} Get - {} elements - Contended", modeName, chunk), [&]{
+                buffer.get(output.data(), chunk);
+                nanobench::doNotOptimizeAway(output.data());
+            });
+
+            // Drain until the producer sees the flag, it might be waiting for space.
+            running.store(false);
+            while (!done.load()) {
+                if (buffer.getOccupancy() >= chunk) {
+                    buffer.get(output.data(), chunk);
+                }
+            }
+            producer.join();
+        }
+    }
+}
+
+static void BenchmarkJuggler() {
+    const U64 size = 8192;
+    const U64 bytes = size * sizeof(CF32);
+
+    auto bench = NewBench("Juggler");
+
+    Memory::Juggler<std::vector<CF32>> juggler(8, size);
+
+    bench.batch(bytes).run("Get And Release", [&]{
+        auto object = juggler.get();
+        nanobench::doNotOptimizeAway(object->data());
+    });
+
+    // Baseline allocating every object.
+    bench.batch(bytes).run("Allocate And Free (Baseline)", [&]{
+        auto object = std::make_shared<std::vector<CF32>>(size);
+        nanobench::doNotOptimizeAway(object->data());
+    });
+}
+
+static void BenchmarkCopy() {
+    auto bench = NewBench("Memory::Copy");
+
+    Tensor<Device::CPU, F32> source({64, 2, 4096});
+    Tensor<Device::CPU, F32> contiguous({64, 2, 4096});
+    Tensor<Device::CPU, F32> destination({64, 4096});
+
+    Tensor<Device::CPU, F32> strided = source;
+    JST_CHECK_THROW(strided.slice({{}, 1, {}}));
+
+    bench.batch(contiguous.size_bytes()).run("CPU to CPU - Contiguous", [&]{
+        Memory::Copy(contiguous, source);
+        nanobench::doNotOptimizeAway(contiguous.data());
+    });
+
+    bench.batch(destination.size_bytes()).run("CPU to CPU - Strided", [&]{
+        Memory::Copy(destination, strided);
+        nanobench::doNotOptimizeAway(destination.data());
+    });
+
+#ifdef JETSTREAM_BACKEND_CUDA_AVAILABLE
+    if (Backend::Initialize<Device::CUDA>({}) == Result::SUCCESS) {
+        Tensor<Device::CUDA, F32> device({64, 2, 4096});
+
+        bench.batch(device.size_bytes()).run("CPU to CUDA - Contiguous", [&]{
+            Memory::Copy(device, source);
+            JST_CUDA_CHECK_THROW(cudaStreamSynchronize(0), [&]{});
+        });
+
+        bench.batch(source.size_bytes()).run("CUDA to CPU - Contiguous", [&]{
+            Memory::Copy(source, device);
+            JST_CUDA_CHECK_THROW(cudaStreamSynchronize(0), [&]{});
+        });
+    }
+#endif
+}
+
+static void BenchmarkAutomaticIterator() {
+    auto bench = NewBench("AutomaticIterator");
+
+    Tensor<Device::CPU, F32> source({64, 2, 4096});
+    Tensor<Device::CPU, F32> contiguous({64, 2, 4096});
+    Tensor<Device::CPU, F32> destination({64, 4096});
+
+    Tensor<Device::CPU, F32> strided = source;
+    JST_CHECK_THROW(strided.slice({{}, 1, {}}));
+
+    bench.batch(contiguous.size_bytes() * 2).run("Scale - Contiguous", [&]{
+        Memory::CPU::AutomaticIterator([](const auto& in, auto& out) {
+            out = in * 2.0f;
+        }, source, contiguous);
+        nanobench::doNotOptimizeAway(contiguous.data());
+    });
+
+    bench.batch(destination.size_bytes() * 2).run("Scale - Strided", [&]{
+        Memory::CPU::AutomaticIterator([](const auto& in, auto& out) {
+            out = in * 2.0f;
+        }, strided, destination);
+        nanobench::doNotOptimizeAway(destination.data());
+    });
+}
+
+int main() {
+    JST_LOG_SET_DEBUG_LEVEL(2);
+
+    BenchmarkCircularBuffer();
+    BenchmarkJuggler();
+    BenchmarkCopy();
+    BenchmarkAutomaticIterator();
+
+#ifdef JETSTREAM_BACKEND_CUDA_AVAILABLE
+    Backend::DestroyAll();
+#endif
+
+    return 0;
+}
@@ -0,0 +1,257 @@
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include <catch2/catch_session.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+
+#include "jetstream/logger.hh"
+#include "jetstream/memory/utils/circular_buffer.hh"
+
+using namespace Jetstream;
+
+using Mode = Memory::CircularBuffer<F64>::Mode;
+
+TEST_CASE("CircularBuffer Class Tests", "[CircularBuffer]") {
+    const auto mode = GENERATE(Mode::Locked, Mode::LockFree);
+
+    SECTION("Put And Get") {
+        Memory::CircularBuffer<F64> buffer(8, mode);
+
+        REQUIRE(buffer.getMode() == mode);
+        REQUIRE(buffer.isEmpty());
+        REQUIRE(buffer.getCapacity() >= 8);
+
+        // A mirrored buffer rounds the capacity up to whole pages.
+        const U64 capacity = buffer.getCapacity();
+        const U64 chunk = (capacity * 3) / 4;
+
+        std::vector<F64> in(chunk);
+        for (U64 i = 0; i < chunk; i++) {
+            in[i] = static_cast<F64>(i);
+        }
+
+        REQUIRE(buffer.put(in.data(), chunk) == Result::SUCCESS);
+        REQUIRE(buffer.getOccupancy() == chunk);
+
+        std::vector<F64> out(chunk);
+        REQUIRE(buffer.get(out.data(), chunk) == Result::SUCCESS);
+        REQUIRE(out == in);
+        REQUIRE(buffer.isEmpty());
+
+        // Wraps around the end of the storage.
+        REQUIRE(buffer.put(in.data(), chunk) == Result::SUCCESS);
+        REQUIRE(buffer.get(out.data(), chunk) == Result::SUCCESS);
+        REQUIRE(out == in);
+        REQUIRE(buffer.isEmpty());
+
+        std::vector<F64> fill(capacity, 1.0);
+        REQUIRE(buffer.put(fill.data(), capacity) == Result::SUCCESS);
+        REQUIRE(buffer.isFull());
+    }
+
+    SECTION("Overflow") {
+        Memory::CircularBuffer<F64> buffer(4, mode);
+
+        const U64 capacity = buffer.getCapacity();
+        const U64 chunk = (capacity * 3) / 4;
+        const std::vector<F64> a(chunk, 1.0);
+        const std::vector<F64> b(chunk, 2.0);
+
+        REQUIRE(buffer.getOverflowPolicy() == Memory::CircularBuffer<F64>::OverflowPolicy::DropOldest);
+        REQUIRE(buffer.put(a.data(), chunk) == Result::SUCCESS);
+        REQUIRE(buffer.put(b.data(), chunk) == Result::SUCCESS);
+        REQUIRE(buffer.getOverflows() == 1);
+
+        const auto gaps = buffer.takeGaps();
+        REQUIRE(gaps.size() == 1);
+        REQUIRE(buffer.takeGaps().empty());
+
+        std::vector<F64> out(chunk);
+
+        if (mode == Mode::Locked) {
+            // Only the oldest excess is discarded.
+            const U64 excess = 2 * chunk - capacity;
+            REQUIRE(buffer.isFull());
+            REQUIRE(buffer.getDroppedElements() == excess);
+            REQUIRE(gaps[0].position == excess);
+            REQUIRE(gaps[0].size == excess);
+
+            REQUIRE(buffer.get(out.data(), chunk) == Result::SUCCESS);
+            REQUIRE(out[0] == 1.0);
+            REQUIRE(out[chunk - 1] == 2.0);
+        } else {
+            // The lock-free mode can only discard the incoming elements.
+            REQUIRE(buffer.getOccupancy() == chunk);
+            REQUIRE(buffer.getDroppedElements() == chunk);
+            REQUIRE(gaps[0].position == chunk);
+            REQUIRE(gaps[0].size == chunk);
+
+            REQUIRE(buffer.get(out.data(), chunk) == Result::SUCCESS);
+            REQUIRE(out == a);
+        }
+    }
+
+    SECTION("Overflow Drop Newest") {
+        Memory::CircularBuffer<F64> buffer(4, mode);
+        buffer.setOverflowPolicy(Memory::CircularBuffer<F64>::OverflowPolicy::DropNewest);
+
+        const U64 chunk = (buffer.getCapacity() * 3) / 4;
+        const std::vector<F64> a(chunk, 1.0);
+        const std::vector<F64> b(chunk, 2.0);
+
+        REQUIRE(buffer.put(a.data(), chunk) == Result::SUCCESS);
+        REQUIRE(buffer.put(b.data(), chunk) == Result::SUCCESS);
+        REQUIRE(buffer.getDroppedElements() == chunk);
+
+        std::vector<F64> out(chunk);
+        REQUIRE(buffer.get(out.data(), chunk) == Result::SUCCESS);
+        REQUIRE(out == a);
+        REQUIRE(buffer.isEmpty());
+    }
+
+    SECTION("Overflow Block") {
+        Memory::CircularBuffer<F64> buffer(4, mode);
+        buffer.setOverflowPolicy(Memory::CircularBuffer<F64>::OverflowPolicy::Block);
+
+        const U64 chunk = (buffer.getCapacity() * 3) / 4;
+        const std::vector<F64> a(chunk, 1.0);
+        const std::vector<F64> b(chunk, 2.0);
+
+        REQUIRE(buffer.put(a.data(), chunk) == Result::SUCCESS);
+
+        // The second put waits for the consumer instead of dropping.
+        std::thread producer([&]{
+            buffer.put(b.data(), chunk);
+        });
+
+        std::vector<F64> out(chunk);
+        REQUIRE(buffer.get(out.data(), chunk) == Result::SUCCESS);
+        REQUIRE(out == a);
+        REQUIRE(buffer.get(out.data(), chunk) == Result::SUCCESS);
+        REQUIRE(out == b);
+
+        producer.join();
+
+        REQUIRE(buffer.getDroppedElements() == 0);
+    }
+
+    SECTION("Reserve And Peek") {
+        Memory::CircularBuffer<F64> buffer(8, mode);
+
+        if (mode == Mode::Locked) {
+            REQUIRE(buffer.reserve(1) == nullptr);
+            REQUIRE(buffer.peek(1) == nullptr);
+            REQUIRE(buffer.commit(1) == Result::ERROR);
+            REQUIRE(buffer.consume(1) == Result::ERROR);
+            return;
+        }
+
+        const U64 capacity = buffer.getCapacity();
+        const U64 chunk = (capacity * 3) / 4;
+
+        REQUIRE(buffer.peek(1) == nullptr);
+        REQUIRE(buffer.reserve(capacity + 1) == nullptr);
+
+        for (U64 round = 0; round < 2; round++) {
+            F64* window = buffer.reserve(chunk);
+
+            // The second round crosses the wraparound.
+            if (!buffer.isMirrored() && round == 1) {
+                REQUIRE(window == nullptr);
+                break;
+            }
+
+            REQUIRE(window != nullptr);
+            for (U64 i = 0; i < chunk; i++) {
+                window[i] = static_cast<F64>(round * chunk + i);
+            }
+            REQUIRE(buffer.commit(chunk) == Result::SUCCESS);
+            REQUIRE(buffer.getOccupancy() == chunk);
+
+            const F64* samples = buffer.peek(chunk);
+            REQUIRE(samples != nullptr);
+            for (U64 i = 0; i < chunk; i++) {
+                REQUIRE(samples[i] == static_cast<F64>(round * chunk + i));
+            }
+            REQUIRE(buffer.consume(chunk) == Result::SUCCESS);
+            REQUIRE(buffer.isEmpty());
+        }
+    }
+
+    SECTION("Concurrent Producer And Consumer") {
+        Memory::CircularBuffer<F64> buffer(4096, mode);
+
+        const U64 chunk = 64;
+        const U64 iterations = 10000;
+
+        std::thread producer([&]{
+            std::vector<F64> data(chunk);
+            U64 value = 0;
+            for (U64 i = 0; i < iterations; i++) {
+                while (buffer.getCapacity() - buffer.getOccupancy() < chunk) {
+                    std::this_thread::yield();
+                }
+                for (auto& v : data) {
+                    v = static_cast<F64>(value++);
+                }
+                buffer.put(data.data(), chunk);
+            }
+        });
+
+        std::vector<F64> data(chunk);
+        U64 expected = 0;
+        bool ordered = true;
+
+        for (U64 i = 0; i < iterations; i++) {
+            REQUIRE(buffer.get(data.data(), chunk) == Result::SUCCESS);
+            for (const auto& v : data) {
+                ordered &= v == static_cast<F64>(expected++);
+            }
+        }
+
+        producer.join();
+
+        REQUIRE(ordered);
+        REQUIRE(buffer.getOverflows() == 0);
+    }
+
+    SECTION("Statistics") {
+        Memory::CircularBuffer<F64> buffer(8, mode);
+
+        const U64 capacity = buffer.getCapacity();
+        const U64 chunk = capacity / 2;
+        const std::vector<F64> in(chunk, 1.0);
+        std::vector<F64> out(chunk);
+
+        REQUIRE(buffer.put(in.data(), chunk) == Result::SUCCESS);
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        REQUIRE(buffer.get(out.data(), chunk) == Result::SUCCESS);
+
+        auto statistics = buffer.getStatistics();
+        REQUIRE(statistics.capacity == capacity);
+        REQUIRE(statistics.occupancy == 0);
+        REQUIRE(statistics.lastLatency >= 0.01);
+        REQUIRE(statistics.maxLatency >= statistics.lastLatency);
+        REQUIRE(statistics.occupancyHistogram[5] == 1);
+        REQUIRE(statistics.occupancySum == chunk);
+
+        // A partial read doesn't measure the latency of its put.
+        REQUIRE(buffer.put(in.data(), chunk) == Result::SUCCESS);
+        REQUIRE(buffer.get(out.data(), chunk / 2) == Result::SUCCESS);
+        REQUIRE(buffer.getStatistics().lastLatency == statistics.lastLatency);
+
+        buffer.resetStatistics();
+        statistics = buffer.getStatistics();
+        REQUIRE(statistics.maxLatency == 0.0);
+        REQUIRE(statistics.occupancySum == 0);
+        REQUIRE(statistics.occupancy == chunk - chunk / 2);
+    }
+}
+
+int main(int argc, char* argv[]) {
+    JST_LOG_SET_DEBUG_LEVEL(4);
+
+    return Catch::Session().run(argc, argv);
+}
@@ -0,0 +1,91 @@
+#include <thread>
+#include <vector>
+
+#include <catch2/catch_session.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "jetstream/logger.hh"
+#include "jetstream/memory/utils/coefficient_cache.hh"
+
+using namespace Jetstream;
+
+TEST_CASE("CoefficientCache Class Tests", "[CoefficientCache]") {
+    SECTION("Generates On Miss") {
+        U64 calls = 0;
+
+        auto coeffs = Memory::CoefficientCache<F32>::Get("test:miss", [&]{
+            calls += 1;
+            return std::vector<F32>{1.0f, 2.0f, 3.0f};
+        });
+
+        REQUIRE(calls == 1);
+        REQUIRE(coeffs->size() == 3);
+        REQUIRE((*coeffs)[2] == 3.0f);
+    }
+
+    SECTION("Shares While Held") {
+        U64 calls = 0;
+        auto generator = [&]{
+            calls += 1;
+            return std::vector<F32>(16, 1.0f);
+        };
+
+        auto a = Memory::CoefficientCache<F32>::Get("test:shared", generator);
+        auto b = Memory::CoefficientCache<F32>::Get("test:shared", generator);
+
+        REQUIRE(calls == 1);
+        REQUIRE(a.get() == b.get());
+    }
+
+    SECTION("Keys Are Distinct") {
+        auto a = Memory::CoefficientCache<F32>::Get("test:a", []{ return std::vector<F32>{1.0f}; });
+        auto b = Memory::CoefficientCache<F32>::Get("test:b", []{ return std::vector<F32>{2.0f}; });
+
+        REQUIRE(a.get() != b.get());
+        REQUIRE((*a)[0] == 1.0f);
+        REQUIRE((*b)[0] == 2.0f);
+    }
+
+    SECTION("Regenerates After Release") {
+        U64 calls = 0;
+        auto generator = [&]{
+            calls += 1;
+            return std::vector<F32>(8, 0.0f);
+        };
+
+        {
+            auto coeffs = Memory::CoefficientCache<F32>::Get("test:release", generator);
+        }
+        auto coeffs = Memory::CoefficientCache<F32>::Get("test:release", generator);
+
+        REQUIRE(calls == 2);
+    }
+
+    SECTION("Concurrent Access") {
+        std::vector<std::thread> threads;
+        std::vector<Memory::CoefficientCache<F32>::Coefficients> results(8);
+
+        for (U64 t = 0; t < results.size(); t++) {
+            threads.emplace_back([&, t]{
+                results[t] = Memory::CoefficientCache<F32>::Get("test:concurrent", []{
+                    return std::vector<F32>(1024, 0.5f);
+                });
+            });
+        }
+
+        for (auto& thread : threads) {
+            thread.join();
+        }
+
+        for (const auto& coeffs : results) {
+            REQUIRE(coeffs->size() == 1024);
+            REQUIRE((*coeffs)[1023] == 0.5f);
+        }
+    }
+}
+
+int main(int argc, char* argv[]) {
+    JST_LOG_SET_DEBUG_LEVEL(4);
+
+    return Catch::Session().run(argc, argv);
+}
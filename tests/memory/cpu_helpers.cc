@@ -0,0 +1,173 @@
+#include <catch2/catch_session.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "jetstream/logger.hh"
+#include "jetstream/memory/base.hh"
+#include "jetstream/memory/devices/cpu/helpers.hh"
+
+using namespace Jetstream;
+
+TEST_CASE("CPU Helpers Tests", "[Helpers]") {
+    SECTION("Contiguous Iterator") {
+        Tensor<Device::CPU, F32> a({4, 256});
+        Tensor<Device::CPU, F32> b({4, 256});
+        Tensor<Device::CPU, F32> c({4, 256});
+
+        for (U64 i = 0; i < a.size(); i++) {
+            a.data()[i] = static_cast<F32>(i);
+            b.data()[i] = 2.0f;
+        }
+
+        Memory::CPU::AutomaticIterator([](const auto& a, const auto& b, auto& c) {
+            c = a * b;
+        }, a, b, c);
+
+        for (U64 i = 0; i < c.size(); i++) {
+            REQUIRE(c.data()[i] == static_cast<F32>(i) * 2.0f);
+        }
+    }
+
+    SECTION("Non-Contiguous Iterator") {
+        Tensor<Device::CPU, F32> a({4, 2, 64});
+        Tensor<Device::CPU, F32> b({4, 64});
+
+        for (U64 i = 0; i < a.size(); i++) {
+            a.data()[i] = static_cast<F32>(i);
+        }
+
+        Tensor<Device::CPU, F32> slice = a;
+        REQUIRE(slice.slice({{}, 1, {}}) == Result::SUCCESS);
+        REQUIRE_FALSE(slice.contiguous());
+
+        Memory::CPU::AutomaticIterator([](const auto& in, auto& out) {
+            out = in;
+        }, slice, b);
+
+        for (U64 i = 0; i < 4; i++) {
+            for (U64 j = 0; j < 64; j++) {
+                REQUIRE(b.data()[i * 64 + j] == static_cast<F32>(i * 128 + 64 + j));
+            }
+        }
+    }
+
+    SECTION("Strided Copy") {
+        Tensor<Device::CPU, F32> a({4, 3, 16});
+
+        for (U64 i = 0; i < a.size(); i++) {
+            a.data()[i] = static_cast<F32>(i);
+        }
+
+        // Non-contiguous source.
+
+        Tensor<Device::CPU, F32> slice = a;
+        REQUIRE(slice.slice({{}, {1, 3}, {}}) == Result::SUCCESS);
+
+        Tensor<Device::CPU, F32> b({4, 2, 16});
+        REQUIRE(Memory::Copy(b, slice) == Result::SUCCESS);
+
+        for (U64 i = 0; i < 4; i++) {
+            for (U64 j = 0; j < 2; j++) {
+                for (U64 k = 0; k < 16; k++) {
+                    REQUIRE(b.data()[(i * 2 + j) * 16 + k] == a.data()[(i * 3 + j + 1) * 16 + k]);
+                }
+            }
+        }
+
+        // Non-contiguous destination with a strided inner dimension.
+
+        Tensor<Device::CPU, F32> c({4, 32});
+        Tensor<Device::CPU, F32> even = c;
+        REQUIRE(even.slice({{}, {0, 32, 2}}) == Result::SUCCESS);
+
+        Tensor<Device::CPU, F32> d({4, 16});
+        for (U64 i = 0; i < d.size(); i++) {
+            d.data()[i] = static_cast<F32>(i + 1);
+        }
+
+        REQUIRE(Memory::Copy(even, d) == Result::SUCCESS);
+
+        for (U64 i = 0; i < 4; i++) {
+            for (U64 k = 0; k < 16; k++) {
+                REQUIRE(c.data()[i * 32 + 2 * k] == d.data()[i * 16 + k]);
+                REQUIRE(c.data()[i * 32 + 2 * k + 1] == 0.0f);
+            }
+        }
+
+        // Mismatched shapes.
+
+        REQUIRE(Memory::Copy(b, d) == Result::ERROR);
+    }
+
+    SECTION("Reshape View") {
+        Tensor<Device::CPU, F32> a({4, 3, 16});
+
+        for (U64 i = 0; i < a.size(); i++) {
+            a.data()[i] = static_cast<F32>(i);
+        }
+
+        Tensor<Device::CPU, F32> slice = a;
+        REQUIRE(slice.slice({{}, {1, 3}, {}}) == Result::SUCCESS);
+
+        // The two innermost dimensions stay contiguous between themselves.
+
+        Tensor<Device::CPU, F32> view = slice;
+        REQUIRE(view.reshape({4, 32}) == Result::SUCCESS);
+        REQUIRE_FALSE(view.contiguous());
+        REQUIRE(view.data() == a.data());
+
+        Tensor<Device::CPU, F32> b({4, 32});
+        Memory::CPU::AutomaticIterator([](const auto& in, auto& out) {
+            out = in;
+        }, view, b);
+
+        for (U64 i = 0; i < 4; i++) {
+            for (U64 k = 0; k < 32; k++) {
+                REQUIRE(b.data()[i * 32 + k] == a.data()[i * 48 + 16 + k]);
+            }
+        }
+
+        // Flattening needs a copy.
+
+        Tensor<Device::CPU, F32> flat = slice;
+        REQUIRE(flat.reshape({128}) == Result::ERROR);
+    }
+
+    SECTION("Parallel Iterator") {
+        WorkerPool pool;
+        REQUIRE(pool.start(4) == Result::SUCCESS);
+
+        const U64 size = 8 * Memory::CPU::ParallelIteratorGrain + 3;
+
+        Tensor<Device::CPU, U64> a({size});
+        Tensor<Device::CPU, U64> b({size});
+
+        for (U64 i = 0; i < size; i++) {
+            a.data()[i] = i;
+        }
+
+        Memory::CPU::ParallelAutomaticIterator(&pool, [](const auto& a, auto& b) {
+            b = a + 1;
+        }, a, b);
+
+        for (U64 i = 0; i < size; i++) {
+            REQUIRE(b.data()[i] == i + 1);
+        }
+
+        // Without a running pool it falls back to the serial iterator.
+        Memory::CPU::ParallelAutomaticIterator(nullptr, [](auto& b) {
+            b = 0;
+        }, b);
+
+        for (U64 i = 0; i < size; i++) {
+            REQUIRE(b.data()[i] == 0);
+        }
+
+        REQUIRE(pool.stop() == Result::SUCCESS);
+    }
+}
+
+int main(int argc, char* argv[]) {
+    JST_LOG_SET_DEBUG_LEVEL(4);
+
+    return Catch::Session().run(argc, argv);
+}
@@ -0,0 +1,69 @@
+#include <catch2/catch_session.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "jetstream/logger.hh"
+#include "jetstream/memory/base.hh"
+#include "jetstream/memory/footprint.hh"
+
+using namespace Jetstream;
+
+TEST_CASE("Memory Footprint Tests", "[MemoryFootprint]") {
+    auto& footprint = MemoryFootprint::Get();
+
+    SECTION("Attribution") {
+        const auto before = footprint.devices()[Device::CPU].current;
+
+        {
+            Tensor<Device::CPU, F32> output;
+            output.set_locale({"footprint-attribution", "module", "out"});
+            output = Tensor<Device::CPU, F32>({64, 1024});
+
+            const auto usage = footprint.block("footprint-attribution").at(Device::CPU);
+            REQUIRE(usage.current >= output.size_bytes());
+            REQUIRE(footprint.devices()[Device::CPU].current >= before + output.size_bytes());
+
+            // Copies share the storage and don't count twice.
+            Tensor<Device::CPU, F32> copy = output;
+            copy.set_locale({"footprint-other", "module", "out"});
+            REQUIRE(footprint.block("footprint-attribution").at(Device::CPU).current == usage.current);
+            REQUIRE(footprint.block("footprint-other").empty());
+        }
+
+        const auto usage = footprint.block("footprint-attribution").at(Device::CPU);
+        REQUIRE(usage.current == 0);
+        REQUIRE(usage.peak >= 64 * 1024 * sizeof(F32));
+        REQUIRE(footprint.devices()[Device::CPU].current == before);
+    }
+
+    SECTION("Scoped Block") {
+        {
+            MemoryFootprint::ScopedBlock scope("footprint-scope");
+            Tensor<Device::CPU, U8> internal({4096});
+
+            REQUIRE(footprint.block("footprint-scope").at(Device::CPU).current >= 4096);
+        }
+
+        REQUIRE(footprint.block("footprint-scope").at(Device::CPU).current == 0);
+
+        // Scopes only apply while alive.
+        Tensor<Device::CPU, U8> outside({4096});
+        REQUIRE(footprint.block("footprint-scope").at(Device::CPU).current == 0);
+    }
+
+    SECTION("Reset Peaks") {
+        {
+            MemoryFootprint::ScopedBlock scope("footprint-peaks");
+            Tensor<Device::CPU, U8> buffer({8192});
+        }
+
+        REQUIRE(footprint.block("footprint-peaks").at(Device::CPU).peak >= 8192);
+        footprint.resetPeaks();
+        REQUIRE(footprint.block("footprint-peaks").at(Device::CPU).peak == 0);
+    }
+}
+
+int main(int argc, char* argv[]) {
+    JST_LOG_SET_DEBUG_LEVEL(4);
+
+    return Catch::Session().run(argc, argv);
+}
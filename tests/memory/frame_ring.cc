@@ -0,0 +1,118 @@
+#include <thread>
+#include <vector>
+#include <algorithm>
+
+#include <catch2/catch_session.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "jetstream/logger.hh"
+#include "jetstream/memory/utils/frame_ring.hh"
+
+using namespace Jetstream;
+
+TEST_CASE("FrameRing Class Tests", "[FrameRing]") {
+    SECTION("Initial State") {
+        Memory::FrameRing<U64> ring(4, 7);
+
+        REQUIRE(ring.depth() == 4);
+        REQUIRE(ring.occupancy() == 0);
+        REQUIRE(ring.consume() == false);
+        REQUIRE(ring.front() == 7);
+        REQUIRE(ring.back() == 7);
+    }
+
+    SECTION("Frames Are Consumed In Order") {
+        Memory::FrameRing<U64> ring(4, 0);
+
+        for (U64 i = 1; i <= 3; i++) {
+            ring.back() = i;
+            REQUIRE(ring.publish() == false);
+        }
+
+        REQUIRE(ring.occupancy() == 3);
+
+        for (U64 i = 1; i <= 3; i++) {
+            REQUIRE(ring.consume() == true);
+            REQUIRE(ring.front() == i);
+        }
+
+        REQUIRE(ring.consume() == false);
+        REQUIRE(ring.front() == 3);
+    }
+
+    SECTION("Oldest Frames Are Dropped") {
+        Memory::FrameRing<U64> ring(3, 0);
+
+        for (U64 i = 1; i <= 5; i++) {
+            ring.back() = i;
+            REQUIRE(ring.publish() == (i > 3));
+        }
+
+        REQUIRE(ring.occupancy() == 3);
+        REQUIRE(ring.dropped() == 2);
+
+        for (U64 i = 3; i <= 5; i++) {
+            REQUIRE(ring.consume() == true);
+            REQUIRE(ring.front() == i);
+        }
+    }
+
+    SECTION("Slots Are Distinct") {
+        Memory::FrameRing<U64> ring(1, 0);
+
+        ring.back() = 1;
+        ring.publish();
+        REQUIRE(ring.consume() == true);
+
+        // Writing the new back slot must not change the front.
+        ring.back() = 2;
+        REQUIRE(ring.front() == 1);
+
+        ring.publish();
+        ring.back() = 3;
+        REQUIRE(ring.consume() == true);
+        REQUIRE(ring.front() == 2);
+    }
+
+    SECTION("Concurrent Producer And Consumer") {
+        Memory::FrameRing<std::vector<U64>> ring(4, std::vector<U64>(256, 0));
+
+        const U64 iterations = 100000;
+
+        std::thread producer([&]{
+            for (U64 i = 1; i <= iterations; i++) {
+                std::fill(ring.back().begin(), ring.back().end(), i);
+                ring.publish();
+            }
+        });
+
+        U64 last = 0;
+        U64 consumed = 0;
+        bool consistent = true;
+        bool monotonic = true;
+
+        while (last < iterations) {
+            if (!ring.consume()) {
+                continue;
+            }
+
+            const auto& front = ring.front();
+            consistent &= std::all_of(front.begin(), front.end(), [&](const U64& v) { return v == front[0]; });
+            monotonic &= front[0] > last;
+            last = front[0];
+            consumed++;
+        }
+
+        producer.join();
+
+        REQUIRE(consistent);
+        REQUIRE(monotonic);
+        REQUIRE(consumed + ring.dropped() == iterations);
+    }
+}
+
+int main(int argc, char* argv[]) {
+    JST_LOG_SET_DEBUG_LEVEL(4);
+
+    return Catch::Session().run(argc, argv);
+}
@@ -0,0 +1,90 @@
+#include <thread>
+
+#include <catch2/catch_session.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "jetstream/logger.hh"
+#include "jetstream/memory/utils/hot_config.hh"
+
+using namespace Jetstream;
+
+namespace {
+
+struct Config {
+    F32 sampleRate = 1.0f;
+    F32 bandwidth = 0.5f;
+};
+
+}  // namespace
+
+TEST_CASE("HotConfig Class Tests", "[HotConfig]") {
+    SECTION("Nothing Published") {
+        Memory::HotConfig<Config> hot;
+        Config active;
+
+        REQUIRE(hot.consume(active) == false);
+        REQUIRE(active.sampleRate == 1.0f);
+    }
+
+    SECTION("Publish And Consume") {
+        Memory::HotConfig<Config> hot;
+        Config control;
+        Config active;
+
+        control.sampleRate = 2.0f;
+        hot.publish(control);
+
+        REQUIRE(hot.consume(active) == true);
+        REQUIRE(active.sampleRate == 2.0f);
+        REQUIRE(hot.consume(active) == false);
+    }
+
+    SECTION("Latest Configuration Wins") {
+        Memory::HotConfig<Config> hot;
+        Config control;
+        Config active;
+
+        control.sampleRate = 2.0f;
+        hot.publish(control);
+        control.bandwidth = 0.25f;
+        hot.publish(control);
+
+        REQUIRE(hot.consume(active) == true);
+        REQUIRE(active.sampleRate == 2.0f);
+        REQUIRE(active.bandwidth == 0.25f);
+    }
+
+    SECTION("Concurrent Control And Compute") {
+        Memory::HotConfig<Config> hot;
+
+        const U64 iterations = 100000;
+
+        std::thread control([&]{
+            Config config;
+            for (U64 i = 1; i <= iterations; i++) {
+                config.sampleRate = static_cast<F32>(i);
+                config.bandwidth = static_cast<F32>(i);
+                hot.publish(config);
+            }
+        });
+
+        Config active;
+        bool consistent = true;
+
+        while (active.sampleRate < static_cast<F32>(iterations)) {
+            if (hot.consume(active)) {
+                consistent &= active.sampleRate == active.bandwidth;
+            }
+        }
+
+        control.join();
+
+        REQUIRE(consistent);
+    }
+}
+
+int main(int argc, char* argv[]) {
+    JST_LOG_SET_DEBUG_LEVEL(4);
+
+    return Catch::Session().run(argc, argv);
+}
@@ -0,0 +1,86 @@
+#include <thread>
+#include <vector>
+
+#include <catch2/catch_session.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "jetstream/logger.hh"
+#include "jetstream/memory/utils/juggler.hh"
+
+using namespace Jetstream;
+
+TEST_CASE("Juggler Class Tests", "[Juggler]") {
+    SECTION("Get And Recycle") {
+        Memory::Juggler<U64> juggler(2, 7);
+
+        REQUIRE(juggler.available() == 2);
+
+        auto a = juggler.get();
+        auto b = juggler.get();
+        REQUIRE(a != nullptr);
+        REQUIRE(b != nullptr);
+        REQUIRE(*a == 7);
+        REQUIRE(juggler.available() == 0);
+
+        REQUIRE(juggler.get() == nullptr);
+        REQUIRE(juggler.exhaustions() == 1);
+
+        // Copies keep the object out of the pool.
+        auto c = a;
+        a.reset();
+        REQUIRE(juggler.available() == 0);
+
+        c.reset();
+        REQUIRE(juggler.available() == 1);
+
+        auto d = juggler.get();
+        REQUIRE(d != nullptr);
+        REQUIRE(juggler.exhaustions() == 1);
+    }
+
+    SECTION("Clear With Objects In Use") {
+        Memory::Juggler<U64> juggler(2);
+
+        auto a = juggler.get();
+        juggler.clear();
+        REQUIRE(juggler.available() == 0);
+
+        // Dropped objects from before the clear don't return.
+        a.reset();
+        REQUIRE(juggler.available() == 0);
+    }
+
+    SECTION("Objects Outlive The Juggler") {
+        std::shared_ptr<U64> a;
+
+        {
+            Memory::Juggler<U64> juggler(1, 3);
+            a = juggler.get();
+        }
+
+        REQUIRE(*a == 3);
+        a.reset();
+    }
+
+    SECTION("Concurrent Release") {
+        Memory::Juggler<U64> juggler(64);
+
+        std::vector<std::shared_ptr<U64>> objects;
+        for (U64 i = 0; i < 64; i++) {
+            objects.push_back(juggler.get());
+        }
+
+        std::thread releaser([&]{
+            objects.clear();
+        });
+        releaser.join();
+
+        REQUIRE(juggler.available() == 64);
+    }
+}
+
+int main(int argc, char* argv[]) {
+    JST_LOG_SET_DEBUG_LEVEL(4);
+
+    return Catch::Session().run(argc, argv);
+}
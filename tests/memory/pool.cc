@@ -0,0 +1,83 @@
+#include <catch2/catch_session.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "jetstream/logger.hh"
+#include "jetstream/memory/base.hh"
+#include "jetstream/memory/devices/cpu/pool.hh"
+
+using namespace Jetstream;
+
+TEST_CASE("CPUMemoryPool Class Tests", "[CPUMemoryPool]") {
+    auto& pool = CPUMemoryPool::Get();
+    pool.setCapacity(64*1024*1024);
+    pool.trim();
+
+    SECTION("Size Classes") {
+        const U64 pageSize = JST_PAGESIZE();
+
+        REQUIRE(CPUMemoryPool::SizeClass(1) == pageSize);
+        REQUIRE(CPUMemoryPool::SizeClass(pageSize) == pageSize);
+        REQUIRE(CPUMemoryPool::SizeClass(pageSize + 1) == 2 * pageSize);
+
+        // Large classes waste at most a quarter of the size.
+        for (U64 pages = 17; pages < 4096; pages += 7) {
+            const U64 size = pages * pageSize;
+            const U64 classSize = CPUMemoryPool::SizeClass(size);
+            REQUIRE(classSize >= size);
+            REQUIRE(classSize <= size + size / 4);
+            REQUIRE(classSize % pageSize == 0);
+        }
+    }
+
+    SECTION("Reuse") {
+        U64 classSize = 0;
+        void* ptr = pool.allocate(100000, classSize);
+        REQUIRE(ptr != nullptr);
+        REQUIRE(JST_IS_ALIGNED(ptr));
+
+        pool.free(ptr, classSize);
+        REQUIRE(pool.cached() == classSize);
+
+        U64 otherClassSize = 0;
+        void* other = pool.allocate(100000, otherClassSize);
+        REQUIRE(other == ptr);
+        REQUIRE(otherClassSize == classSize);
+        REQUIRE(pool.cached() == 0);
+
+        pool.free(other, otherClassSize);
+        pool.trim();
+        REQUIRE(pool.cached() == 0);
+    }
+
+    SECTION("Capacity") {
+        pool.setCapacity(0);
+
+        U64 classSize = 0;
+        void* ptr = pool.allocate(4096, classSize);
+        pool.free(ptr, classSize);
+        REQUIRE(pool.cached() == 0);
+
+        pool.setCapacity(64*1024*1024);
+    }
+
+    SECTION("Tensor Reload") {
+        void* first = nullptr;
+
+        {
+            Tensor<Device::CPU, F32> tensor({1024, 1024});
+            first = tensor.data();
+            tensor[0] = 1.0f;
+        }
+
+        // A reload with the same shape gets the same pages back, zero-filled.
+        Tensor<Device::CPU, F32> tensor({1024, 1024});
+        REQUIRE(tensor.data() == first);
+        REQUIRE(tensor[0] == 0.0f);
+    }
+}
+
+int main(int argc, char* argv[]) {
+    JST_LOG_SET_DEBUG_LEVEL(4);
+
+    return Catch::Session().run(argc, argv);
+}
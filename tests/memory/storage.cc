@@ -18,6 +18,28 @@ TEST_CASE("Storage Class Tests", "[Storage]") {
         REQUIRE(storage.attributes().empty());
     }
 
+    SECTION("Alias") {
+        Tensor<Device::CPU, F32> storage({1024});
+        Tensor<Device::CPU, F32> copy = storage;
+        Tensor<Device::CPU, U8> arena({storage.size_bytes()});
+
+        auto& clone = storage.storage_metadata()->clones.at(Device::CPU);
+        auto buffer = std::any_cast<std::shared_ptr<TensorBuffer<Device::CPU>>>(clone);
+
+        REQUIRE(buffer->size_bytes() >= storage.size_bytes());
+        REQUIRE_FALSE(buffer->aliased());
+
+        REQUIRE(buffer->alias(arena.data()) == Result::SUCCESS);
+        REQUIRE(buffer->aliased());
+        REQUIRE(reinterpret_cast<void*>(storage.data()) == arena.data());
+        REQUIRE(reinterpret_cast<void*>(copy.data()) == arena.data());
+
+        REQUIRE(buffer->unalias() == Result::SUCCESS);
+        REQUIRE_FALSE(buffer->aliased());
+        REQUIRE(reinterpret_cast<void*>(storage.data()) != arena.data());
+        REQUIRE(storage.data()[0] == 0.0f);
+    }
+
     // TODO: Add more tests.
 
 #if defined(JETSTREAM_BACKEND_VULKAN_AVAILABLE)
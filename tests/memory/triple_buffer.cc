@@ -0,0 +1,101 @@
+#include <thread>
+#include <vector>
+#include <algorithm>
+
+#include <catch2/catch_session.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "jetstream/logger.hh"
+#include "jetstream/memory/utils/triple_buffer.hh"
+
+using namespace Jetstream;
+
+TEST_CASE("TripleBuffer Class Tests", "[TripleBuffer]") {
+    SECTION("Initial State") {
+        Memory::TripleBuffer<U64> buffer(7);
+
+        REQUIRE(buffer.consume() == false);
+        REQUIRE(buffer.front() == 7);
+        REQUIRE(buffer.back() == 7);
+    }
+
+    SECTION("Publish And Consume") {
+        Memory::TripleBuffer<U64> buffer(0);
+
+        buffer.back() = 42;
+        buffer.publish();
+
+        REQUIRE(buffer.consume() == true);
+        REQUIRE(buffer.front() == 42);
+        REQUIRE(buffer.consume() == false);
+        REQUIRE(buffer.front() == 42);
+    }
+
+    SECTION("Latest Value Wins") {
+        Memory::TripleBuffer<U64> buffer(0);
+
+        for (U64 i = 1; i <= 5; i++) {
+            buffer.back() = i;
+            buffer.publish();
+        }
+
+        REQUIRE(buffer.consume() == true);
+        REQUIRE(buffer.front() == 5);
+    }
+
+    SECTION("Slots Are Distinct") {
+        Memory::TripleBuffer<U64> buffer(0);
+
+        buffer.back() = 1;
+        buffer.publish();
+        REQUIRE(buffer.consume() == true);
+
+        // Writing the new back slot must not change the front.
+        buffer.back() = 2;
+        REQUIRE(buffer.front() == 1);
+
+        buffer.publish();
+        buffer.back() = 3;
+        REQUIRE(buffer.consume() == true);
+        REQUIRE(buffer.front() == 2);
+    }
+
+    SECTION("Concurrent Producer And Consumer") {
+        Memory::TripleBuffer<std::vector<U64>> buffer(std::vector<U64>(256, 0));
+
+        const U64 iterations = 100000;
+
+        std::thread producer([&]{
+            for (U64 i = 1; i <= iterations; i++) {
+                std::fill(buffer.back().begin(), buffer.back().end(), i);
+                buffer.publish();
+            }
+        });
+
+        U64 last = 0;
+        bool consistent = true;
+        bool monotonic = true;
+
+        while (last < iterations) {
+            if (!buffer.consume()) {
+                continue;
+            }
+
+            const auto& front = buffer.front();
+            consistent &= std::all_of(front.begin(), front.end(), [&](const U64& v) { return v == front[0]; });
+            monotonic &= front[0] > last;
+            last = front[0];
+        }
+
+        producer.join();
+
+        REQUIRE(consistent);
+        REQUIRE(monotonic);
+    }
+}
+
+int main(int argc, char* argv[]) {
+    JST_LOG_SET_DEBUG_LEVEL(4);
+
+    return Catch::Session().run(argc, argv);
+}